@@ -83,6 +83,12 @@
 //
 #define CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS 150
 
+// Staggered CASE attempts are off by default; enable them so that the unit
+// tests cover them.
+#ifndef CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS
+#define CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS 500
+#endif
+
 // Safe to enable this flag since standalone is associated with host and not a device.
 #define CONFIG_BUILD_FOR_HOST_UNIT_TEST 1
 
@@ -30,5 +30,11 @@
 // overrides CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT in CHIPProjectConfig
 #define CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT 16
 
+// Wildcard subscriptions to a bridge expand to many paths; expand them once per subscription
+#define CHIP_IM_SERVER_MAX_CACHED_ATTRIBUTE_PATHS_PER_READ_HANDLER 1024
+
+// Several controllers usually subscribe to the same bridged attributes; encode each changed value once per report run
+#define CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE 2048
+
 // include the CHIPProjectConfig from config/standalone
 #include <CHIPProjectConfig.h>
@@ -162,11 +162,6 @@ DeviceTempSensor TempSensor1("TempSensor 1", "Office", minMeasuredValue, maxMeas
 DeviceTempSensor TempSensor2("TempSensor 2", "Office", minMeasuredValue, maxMeasuredValue, initialMeasuredValue);
 
 // Declare Bridged endpoints used for Action clusters
-DataVersion gActionLight1DataVersions[ArraySize(bridgedLightClusters)];
-DataVersion gActionLight2DataVersions[ArraySize(bridgedLightClusters)];
-DataVersion gActionLight3DataVersions[ArraySize(bridgedLightClusters)];
-DataVersion gActionLight4DataVersions[ArraySize(bridgedLightClusters)];
-
 DeviceOnOff ActionLight1("Action Light 1", "Room 1");
 DeviceOnOff ActionLight2("Action Light 2", "Room 1");
 DeviceOnOff ActionLight3("Action Light 3", "Room 2");
@@ -209,8 +204,6 @@ DECLARE_DYNAMIC_CLUSTER(TemperatureMeasurement::Id, tempSensorAttrs, ZAP_CLUSTER
 
 // Declare Bridged Light endpoint
 DECLARE_DYNAMIC_ENDPOINT(bridgedTempSensorEndpoint, bridgedTempSensorClusters);
-DataVersion gTempSensor1DataVersions[ArraySize(bridgedTempSensorClusters)];
-DataVersion gTempSensor2DataVersions[ArraySize(bridgedTempSensorClusters)];
 
 // ---------------------------------------------------------------------------
 //
@@ -237,9 +230,11 @@ DECLARE_DYNAMIC_CLUSTER(Descriptor::Id, descriptorAttrs, ZAP_CLUSTER_MASK(SERVER
     DECLARE_DYNAMIC_CLUSTER_LIST_END;
 
 DECLARE_DYNAMIC_ENDPOINT(bridgedComposedDeviceEndpoint, bridgedComposedDeviceClusters);
-DataVersion gComposedDeviceDataVersions[ArraySize(bridgedComposedDeviceClusters)];
-DataVersion gComposedTempSensor1DataVersions[ArraySize(bridgedTempSensorClusters)];
-DataVersion gComposedTempSensor2DataVersions[ArraySize(bridgedTempSensorClusters)];
+
+// Data versions of the devices added at startup: Light 1, the 4 action lights, the 2 temperature
+// sensors and the composed device with its 2 temperature sensors.
+DataVersion gStartupDataVersions[5 * ArraySize(bridgedLightClusters) + 4 * ArraySize(bridgedTempSensorClusters) +
+                                 ArraySize(bridgedComposedDeviceClusters)];
 
 } // namespace
 
@@ -305,6 +300,63 @@ int AddDeviceEndpoint(Device * dev, EmberAfEndpointType * ep, const Span<const E
     return -1;
 }
 
+struct DeviceEndpointDefinition
+{
+    Device * dev;
+    EmberAfEndpointType * ep;
+    Span<const EmberAfDeviceType> deviceTypeList;
+    Device * parent; ///< Device on the parent endpoint, nullptr for the aggregator on endpoint 1
+};
+
+// Adds the devices to consecutive dynamic endpoints with a single emberAfSetDynamicEndpoints call,
+// their data versions taken from the single dataVersionStorage block, so that the PartsLists are
+// only marked as changed once for all of them. The parents have to come before their children.
+CHIP_ERROR AddDeviceEndpoints(Span<const DeviceEndpointDefinition> devices, const Span<DataVersion> & dataVersionStorage)
+{
+    EmberAfDynamicEndpointDefinition endpoints[CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT];
+    size_t count = 0;
+    for (uint16_t index = 0; index < CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT && count < devices.size(); index++)
+    {
+        if (nullptr != gDevices[index])
+        {
+            continue;
+        }
+
+        const DeviceEndpointDefinition & device = devices[count];
+        chip::EndpointId parentEndpointId       = (device.parent != nullptr) ? device.parent->GetEndpointId() : 1;
+        device.dev->SetEndpointId(gCurrentEndpointId);
+        device.dev->SetParentEndpointId(parentEndpointId);
+        endpoints[count++] = { index, gCurrentEndpointId, device.ep, device.deviceTypeList, parentEndpointId };
+
+        // Handle wrap condition
+        if (++gCurrentEndpointId < gFirstDynamicEndpointId)
+        {
+            gCurrentEndpointId = gFirstDynamicEndpointId;
+        }
+    }
+    VerifyOrReturnError(count == devices.size(), CHIP_ERROR_NO_MEMORY,
+                        ChipLogProgress(DeviceLayer, "Failed to add dynamic endpoints: Not enough endpoints available!"));
+
+    // Todo: Update this to schedule the work rather than use this lock
+    DeviceLayer::StackLock lock;
+    ReturnErrorOnFailure(
+        emberAfSetDynamicEndpoints(Span<const EmberAfDynamicEndpointDefinition>(endpoints, count), dataVersionStorage));
+
+    for (size_t i = 0; i < count; i++)
+    {
+        Device * dev                 = devices[i].dev;
+        gDevices[endpoints[i].index] = dev;
+        ChipLogProgress(DeviceLayer, "Added device %s to dynamic endpoint %d (index=%d)", dev->GetName(), endpoints[i].id,
+                        endpoints[i].index);
+
+        if (dev->GetUniqueId()[0] == '\0')
+        {
+            dev->GenerateUniqueId();
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
 int RemoveDeviceEndpoint(Device * dev)
 {
     uint8_t index = 0;
@@ -953,35 +1005,31 @@ void ApplicationInit()
     // supported clusters so that ZAP will generated the requisite code.
     emberAfEndpointEnableDisable(emberAfEndpointFromIndex(static_cast<uint16_t>(emberAfFixedEndpointCount() - 1)), false);
 
-    // Add light 1 -> will be mapped to ZCL endpoints 3
-    AddDeviceEndpoint(&Light1, &bridgedLightEndpoint, Span<const EmberAfDeviceType>(gBridgedOnOffDeviceTypes),
-                      Span<DataVersion>(gLight1DataVersions), 1);
-
-    // Add Temperature Sensor devices --> will be mapped to endpoints 4,5
-    AddDeviceEndpoint(&TempSensor1, &bridgedTempSensorEndpoint, Span<const EmberAfDeviceType>(gBridgedTempSensorDeviceTypes),
-                      Span<DataVersion>(gTempSensor1DataVersions), 1);
-    AddDeviceEndpoint(&TempSensor2, &bridgedTempSensorEndpoint, Span<const EmberAfDeviceType>(gBridgedTempSensorDeviceTypes),
-                      Span<DataVersion>(gTempSensor2DataVersions), 1);
-
-    // Add composed Device with two temperature sensors and a power source
-    AddDeviceEndpoint(&gComposedDevice, &bridgedComposedDeviceEndpoint, Span<const EmberAfDeviceType>(gBridgedComposedDeviceTypes),
-                      Span<DataVersion>(gComposedDeviceDataVersions), 1);
-    AddDeviceEndpoint(&ComposedTempSensor1, &bridgedTempSensorEndpoint,
-                      Span<const EmberAfDeviceType>(gComposedTempSensorDeviceTypes),
-                      Span<DataVersion>(gComposedTempSensor1DataVersions), gComposedDevice.GetEndpointId());
-    AddDeviceEndpoint(&ComposedTempSensor2, &bridgedTempSensorEndpoint,
-                      Span<const EmberAfDeviceType>(gComposedTempSensorDeviceTypes),
-                      Span<DataVersion>(gComposedTempSensor2DataVersions), gComposedDevice.GetEndpointId());
-
-    // Add 4 lights for the Action Clusters tests
-    AddDeviceEndpoint(&ActionLight1, &bridgedLightEndpoint, Span<const EmberAfDeviceType>(gBridgedOnOffDeviceTypes),
-                      Span<DataVersion>(gActionLight1DataVersions), 1);
-    AddDeviceEndpoint(&ActionLight2, &bridgedLightEndpoint, Span<const EmberAfDeviceType>(gBridgedOnOffDeviceTypes),
-                      Span<DataVersion>(gActionLight2DataVersions), 1);
-    AddDeviceEndpoint(&ActionLight3, &bridgedLightEndpoint, Span<const EmberAfDeviceType>(gBridgedOnOffDeviceTypes),
-                      Span<DataVersion>(gActionLight3DataVersions), 1);
-    AddDeviceEndpoint(&ActionLight4, &bridgedLightEndpoint, Span<const EmberAfDeviceType>(gBridgedOnOffDeviceTypes),
-                      Span<DataVersion>(gActionLight4DataVersions), 1);
+    // All the devices are added at once, to consecutive endpoints.
+    const DeviceEndpointDefinition startupDevices[] = {
+        // Add light 1 -> will be mapped to ZCL endpoints 3
+        { &Light1, &bridgedLightEndpoint, Span<const EmberAfDeviceType>(gBridgedOnOffDeviceTypes), nullptr },
+        // Add Temperature Sensor devices --> will be mapped to endpoints 4,5
+        { &TempSensor1, &bridgedTempSensorEndpoint, Span<const EmberAfDeviceType>(gBridgedTempSensorDeviceTypes), nullptr },
+        { &TempSensor2, &bridgedTempSensorEndpoint, Span<const EmberAfDeviceType>(gBridgedTempSensorDeviceTypes), nullptr },
+        // Add composed Device with two temperature sensors and a power source
+        { &gComposedDevice, &bridgedComposedDeviceEndpoint, Span<const EmberAfDeviceType>(gBridgedComposedDeviceTypes), nullptr },
+        { &ComposedTempSensor1, &bridgedTempSensorEndpoint, Span<const EmberAfDeviceType>(gComposedTempSensorDeviceTypes),
+          &gComposedDevice },
+        { &ComposedTempSensor2, &bridgedTempSensorEndpoint, Span<const EmberAfDeviceType>(gComposedTempSensorDeviceTypes),
+          &gComposedDevice },
+        // Add 4 lights for the Action Clusters tests
+        { &ActionLight1, &bridgedLightEndpoint, Span<const EmberAfDeviceType>(gBridgedOnOffDeviceTypes), nullptr },
+        { &ActionLight2, &bridgedLightEndpoint, Span<const EmberAfDeviceType>(gBridgedOnOffDeviceTypes), nullptr },
+        { &ActionLight3, &bridgedLightEndpoint, Span<const EmberAfDeviceType>(gBridgedOnOffDeviceTypes), nullptr },
+        { &ActionLight4, &bridgedLightEndpoint, Span<const EmberAfDeviceType>(gBridgedOnOffDeviceTypes), nullptr },
+    };
+    CHIP_ERROR err =
+        AddDeviceEndpoints(Span<const DeviceEndpointDefinition>(startupDevices), Span<DataVersion>(gStartupDataVersions));
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to add the bridged devices: %" CHIP_ERROR_FORMAT, err.Format());
+    }
 
     // Because the power source is on the same endpoint as the composed device, it needs to be explicitly added
     gDevices[CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT] = &ComposedPowerSource;
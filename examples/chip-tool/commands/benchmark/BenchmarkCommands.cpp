@@ -0,0 +1,206 @@
+/*
+ *   Copyright (c) 2024 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#include "BenchmarkCommands.h"
+
+#include <app/CommandSender.h>
+#include <app/InteractionModelEngine.h>
+#include <app/ReadClient.h>
+#include <app/data-model/EncodableToTLV.h>
+
+using namespace chip;
+using namespace chip::app;
+
+class ReadLoadCommand::ReadOperation : public LoadCommand::Operation, public ReadClient::Callback
+{
+public:
+    ReadOperation(ReadLoadCommand & command, NodeId nodeId) :
+        Operation(command, nodeId), mAttributePath(command.mEndpointId, command.mClusterId, command.mAttributeId)
+    {}
+
+    CHIP_ERROR Start(Messaging::ExchangeManager & exchangeMgr, const SessionHandle & sessionHandle) override
+    {
+        ReadPrepareParams params(sessionHandle);
+        params.mpAttributePathParamsList    = &mAttributePath;
+        params.mAttributePathParamsListSize = 1;
+
+        mReadClient = std::make_unique<ReadClient>(InteractionModelEngine::GetInstance(), &exchangeMgr, *this,
+                                                   ReadClient::InteractionType::Read);
+        return mReadClient->SendRequest(params);
+    }
+
+    /////////// ReadClient Callback Interface /////////
+    void OnAttributeData(const ConcreteDataAttributePath & path, TLV::TLVReader * data, const StatusIB & status) override
+    {
+        if (status.IsFailure() && mError == CHIP_NO_ERROR)
+        {
+            mError = status.ToChipError();
+        }
+    }
+
+    void OnError(CHIP_ERROR error) override { mError = error; }
+
+    void OnDone(ReadClient * client) override
+    {
+        Complete(mError);
+        Finish();
+    }
+
+private:
+    AttributePathParams mAttributePath;
+    std::unique_ptr<ReadClient> mReadClient;
+    CHIP_ERROR mError = CHIP_NO_ERROR;
+};
+
+std::unique_ptr<LoadCommand::Operation> ReadLoadCommand::NewOperation(NodeId nodeId)
+{
+    return std::make_unique<ReadOperation>(*this, nodeId);
+}
+
+class InvokeLoadCommand::InvokeOperation : public LoadCommand::Operation, public CommandSender::Callback
+{
+public:
+    InvokeOperation(InvokeLoadCommand & command, NodeId nodeId) : Operation(command, nodeId), mInvokeCommand(command) {}
+
+    CHIP_ERROR Start(Messaging::ExchangeManager & exchangeMgr, const SessionHandle & sessionHandle) override
+    {
+        CommandPathParams commandPath = { mInvokeCommand.mEndpointId, mInvokeCommand.mClusterId, mInvokeCommand.mCommandId,
+                                          CommandPathFlags::kEndpointIdValid };
+
+        mCommandSender = std::make_unique<CommandSender>(this, &exchangeMgr, /* aIsTimedRequest = */ false,
+                                                         /* aSuppressResponse = */ false, sessionHandle->AllowsLargePayload());
+
+        DataModel::EncodableType<CustomArgument> payload(mInvokeCommand.mPayload);
+        CommandSender::AddRequestDataParameters addRequestDataParams;
+        ReturnErrorOnFailure(mCommandSender->AddRequestData(commandPath, payload, addRequestDataParams));
+        return mCommandSender->SendCommandRequest(sessionHandle);
+    }
+
+    /////////// CommandSender Callback Interface /////////
+    void OnResponse(CommandSender * commandSender, const ConcreteCommandPath & path, const StatusIB & status,
+                    TLV::TLVReader * data) override
+    {
+        if (status.IsFailure() && mError == CHIP_NO_ERROR)
+        {
+            mError = status.ToChipError();
+        }
+    }
+
+    void OnError(const CommandSender * commandSender, CHIP_ERROR error) override { mError = error; }
+
+    void OnDone(CommandSender * commandSender) override
+    {
+        Complete(mError);
+        Finish();
+    }
+
+private:
+    const InvokeLoadCommand & mInvokeCommand;
+    std::unique_ptr<CommandSender> mCommandSender;
+    CHIP_ERROR mError = CHIP_NO_ERROR;
+};
+
+std::unique_ptr<LoadCommand::Operation> InvokeLoadCommand::NewOperation(NodeId nodeId)
+{
+    return std::make_unique<InvokeOperation>(*this, nodeId);
+}
+
+class SubscribeLoadCommand::SubscribeOperation : public LoadCommand::Operation, public ReadClient::Callback
+{
+public:
+    SubscribeOperation(SubscribeLoadCommand & command, NodeId nodeId) :
+        Operation(command, nodeId), mAttributePath(command.mEndpointId, command.mClusterId, command.mAttributeId),
+        mSubscribeCommand(command)
+    {}
+
+    CHIP_ERROR Start(Messaging::ExchangeManager & exchangeMgr, const SessionHandle & sessionHandle) override
+    {
+        ReadPrepareParams params(sessionHandle);
+        params.mpAttributePathParamsList    = &mAttributePath;
+        params.mAttributePathParamsListSize = 1;
+        params.mMinIntervalFloorSeconds     = mSubscribeCommand.mMinInterval.ValueOr(0);
+        params.mMaxIntervalCeilingSeconds   = mSubscribeCommand.mMaxInterval.ValueOr(60);
+        params.mKeepSubscriptions           = mSubscribeCommand.mKeepSubscriptions;
+
+        mReadClient = std::make_unique<ReadClient>(InteractionModelEngine::GetInstance(), &exchangeMgr, *this,
+                                                   ReadClient::InteractionType::Subscribe);
+        return mReadClient->SendRequest(params);
+    }
+
+    /////////// ReadClient Callback Interface /////////
+    void OnAttributeData(const ConcreteDataAttributePath & path, TLV::TLVReader * data, const StatusIB & status) override
+    {
+        if (status.IsFailure() && mError == CHIP_NO_ERROR)
+        {
+            mError = status.ToChipError();
+        }
+    }
+
+    void OnSubscriptionEstablished(SubscriptionId subscriptionId) override
+    {
+        Complete(mError);
+        if (!mSubscribeCommand.mKeepSubscriptions)
+        {
+            // Dropped locally, the next subscription to the node replaces it on the node side.
+            Finish();
+        }
+    }
+
+    void OnError(CHIP_ERROR error) override { mError = error; }
+
+    void OnDone(ReadClient * client) override
+    {
+        Complete(mError != CHIP_NO_ERROR ? mError : CHIP_ERROR_INCORRECT_STATE);
+        Finish();
+    }
+
+private:
+    AttributePathParams mAttributePath;
+    const SubscribeLoadCommand & mSubscribeCommand;
+    std::unique_ptr<ReadClient> mReadClient;
+    CHIP_ERROR mError = CHIP_NO_ERROR;
+};
+
+std::unique_ptr<LoadCommand::Operation> SubscribeLoadCommand::NewOperation(NodeId nodeId)
+{
+    return std::make_unique<SubscribeOperation>(*this, nodeId);
+}
+
+class CaseLoadCommand::CaseOperation : public LoadCommand::Operation
+{
+public:
+    CaseOperation(CaseLoadCommand & command, NodeId nodeId) : Operation(command, nodeId) {}
+
+    CHIP_ERROR Start(Messaging::ExchangeManager & exchangeMgr, const SessionHandle & sessionHandle) override
+    {
+        Complete(CHIP_NO_ERROR);
+        Finish();
+        return CHIP_NO_ERROR;
+    }
+};
+
+std::unique_ptr<LoadCommand::Operation> CaseLoadCommand::NewOperation(NodeId nodeId)
+{
+    return std::make_unique<CaseOperation>(*this, nodeId);
+}
+
+void CaseLoadCommand::OnOperationStarting(NodeId nodeId)
+{
+    auto & controller = CurrentCommissioner();
+    controller.SessionMgr()->ExpireAllSessions(ScopedNodeId(nodeId, controller.GetFabricIndex()));
+}
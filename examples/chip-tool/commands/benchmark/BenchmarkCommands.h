@@ -0,0 +1,134 @@
+/*
+ *   Copyright (c) 2024 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "../clusters/CustomArgument.h"
+#include "LoadCommand.h"
+
+/**
+ * Reads an attribute: the latency is the time to the end of the read.
+ */
+class ReadLoadCommand : public LoadCommand
+{
+public:
+    ReadLoadCommand(CredentialIssuerCommands * credsIssuerConfig) :
+        LoadCommand("read", credsIssuerConfig, "Reads an attribute of the nodes, at the given rate.")
+    {
+        AddArgument("endpoint-id", 0, UINT16_MAX, &mEndpointId);
+        AddArgument("cluster-id", 0, UINT32_MAX, &mClusterId);
+        AddArgument("attribute-id", 0, UINT32_MAX, &mAttributeId);
+    }
+
+protected:
+    std::unique_ptr<Operation> NewOperation(chip::NodeId nodeId) override;
+
+private:
+    class ReadOperation;
+
+    chip::EndpointId mEndpointId;
+    chip::ClusterId mClusterId;
+    chip::AttributeId mAttributeId;
+};
+
+/**
+ * Invokes a command: the latency is the time to the end of the invoke interaction.
+ */
+class InvokeLoadCommand : public LoadCommand
+{
+public:
+    InvokeLoadCommand(CredentialIssuerCommands * credsIssuerConfig) :
+        LoadCommand("invoke", credsIssuerConfig, "Invokes a command on the nodes, at the given rate.")
+    {
+        AddArgument("endpoint-id", 0, UINT16_MAX, &mEndpointId);
+        AddArgument("cluster-id", 0, UINT32_MAX, &mClusterId);
+        AddArgument("command-id", 0, UINT32_MAX, &mCommandId);
+        AddArgument("payload", &mPayload,
+                    "The command payload, as a JSON-encoded object with field ids as keys (see the command-by-id "
+                    "commands), e.g. '{}'.");
+    }
+
+protected:
+    std::unique_ptr<Operation> NewOperation(chip::NodeId nodeId) override;
+
+private:
+    class InvokeOperation;
+
+    chip::EndpointId mEndpointId;
+    chip::ClusterId mClusterId;
+    chip::CommandId mCommandId;
+    CustomArgument mPayload;
+};
+
+/**
+ * Subscribes to an attribute: the latency is the time to the establishment of the subscription.
+ *
+ * Registered twice: as "subscription-storm", which keeps the subscriptions until the end of the run, and as
+ * "resubscribe-churn", which drops each subscription once established and has the next one to the same node replace it
+ * on the node side (KeepSubscriptions false).  For the latter, only one subscription is established at a time with a
+ * given node.
+ */
+class SubscribeLoadCommand : public LoadCommand
+{
+public:
+    SubscribeLoadCommand(const char * commandName, CredentialIssuerCommands * credsIssuerConfig, const char * helpText,
+                         bool keepSubscriptions) :
+        LoadCommand(commandName, credsIssuerConfig, helpText),
+        mKeepSubscriptions(keepSubscriptions)
+    {
+        AddArgument("endpoint-id", 0, UINT16_MAX, &mEndpointId);
+        AddArgument("cluster-id", 0, UINT32_MAX, &mClusterId);
+        AddArgument("attribute-id", 0, UINT32_MAX, &mAttributeId);
+        AddArgument("min-interval", 0, UINT16_MAX, &mMinInterval, "Minimum interval, in seconds.  Defaults to 0.");
+        AddArgument("max-interval", 0, UINT16_MAX, &mMaxInterval, "Maximum interval, in seconds.  Defaults to 60.");
+    }
+
+protected:
+    std::unique_ptr<Operation> NewOperation(chip::NodeId nodeId) override;
+    bool AllowsConcurrentOperationsPerNode() const override { return mKeepSubscriptions; }
+
+private:
+    class SubscribeOperation;
+
+    chip::EndpointId mEndpointId;
+    chip::ClusterId mClusterId;
+    chip::AttributeId mAttributeId;
+    chip::Optional<uint16_t> mMinInterval;
+    chip::Optional<uint16_t> mMaxInterval;
+    const bool mKeepSubscriptions;
+};
+
+/**
+ * Establishes CASE sessions: the local sessions with the node are expired first, and the latency is the time to the
+ * establishment of the new session.  Only one session is established at a time with a given node.
+ */
+class CaseLoadCommand : public LoadCommand
+{
+public:
+    CaseLoadCommand(CredentialIssuerCommands * credsIssuerConfig) :
+        LoadCommand("case", credsIssuerConfig, "Establishes CASE sessions with the nodes, at the given rate.")
+    {}
+
+protected:
+    std::unique_ptr<Operation> NewOperation(chip::NodeId nodeId) override;
+    void OnOperationStarting(chip::NodeId nodeId) override;
+    bool AllowsConcurrentOperationsPerNode() const override { return false; }
+
+private:
+    class CaseOperation;
+};
@@ -0,0 +1,43 @@
+/*
+ *   Copyright (c) 2024 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "commands/benchmark/BenchmarkCommands.h"
+#include "commands/common/Commands.h"
+
+void registerCommandsBenchmark(Commands & commands, CredentialIssuerCommands * credsIssuerConfig)
+{
+    const char * clusterName = "benchmark";
+
+    commands_list clusterCommands = {
+        make_unique<ReadLoadCommand>(credsIssuerConfig),
+        make_unique<InvokeLoadCommand>(credsIssuerConfig),
+        make_unique<SubscribeLoadCommand>("subscription-storm", credsIssuerConfig,
+                                          "Establishes subscriptions with the nodes, at the given rate, and keeps them until the "
+                                          "end of the run.",
+                                          /* keepSubscriptions = */ true),
+        make_unique<SubscribeLoadCommand>("resubscribe-churn", credsIssuerConfig,
+                                          "Repeatedly replaces the subscription with the nodes, at the given rate.",
+                                          /* keepSubscriptions = */ false),
+        make_unique<CaseLoadCommand>(credsIssuerConfig),
+    };
+
+    commands.RegisterCommandSet(clusterName, clusterCommands,
+                                "Commands for running load against nodes and reporting latency, throughput and errors as JSON.");
+}
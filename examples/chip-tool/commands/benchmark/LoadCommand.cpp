@@ -0,0 +1,294 @@
+/*
+ *   Copyright (c) 2024 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#include "LoadCommand.h"
+
+#include <lib/support/jsontlv/TlvJson.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace chip;
+
+namespace {
+
+constexpr uint32_t kDefaultCount = 100;
+
+// Tick interval when no rate is set: operations are started as others complete.
+constexpr System::Clock::Milliseconds32 kIdleTickInterval(100);
+
+uint32_t Percentile(const std::vector<uint32_t> & sortedValues, size_t percentile)
+{
+    VerifyOrReturnValue(!sortedValues.empty(), 0);
+
+    size_t rank = (sortedValues.size() * percentile + 99) / 100;
+    return sortedValues[rank > 0 ? rank - 1 : 0];
+}
+
+} // namespace
+
+LoadCommand::LoadCommand(const char * commandName, CredentialIssuerCommands * credsIssuerConfig, const char * helpText) :
+    CHIPCommand(commandName, credsIssuerConfig, helpText)
+{
+    AddArgument("node-ids", &mNodeIdStrings, "Comma-separated list of node ids (e.g. \"1\" or \"1,0x2,3\"), used in turn.");
+    AddArgument("count", 1, UINT32_MAX, &mCount,
+                "Number of operations to run.  Defaults to 100, or to no limit when --duration-ms is set.");
+    AddArgument("duration-ms", 1, UINT32_MAX, &mDurationMs, "Time, in milliseconds, during which operations are started.");
+    AddArgument("rate", 0, UINT32_MAX, &mRate,
+                "Target number of operations started per second.  Defaults to 0, which starts operations as fast as "
+                "--concurrency allows.");
+    AddArgument("concurrency", 1, UINT16_MAX, &mConcurrency, "Maximum number of operations in flight.  Defaults to 1.");
+    AddArgument("timeout", 0, UINT16_MAX, &mTimeout,
+                "Time, in seconds, before this command is considered to have timed out.  Defaults to 300.");
+}
+
+CHIP_ERROR LoadCommand::RunCommand()
+{
+    mNodeIds.clear();
+    for (const auto & nodeIdString : mNodeIdStrings)
+    {
+        char * end    = nullptr;
+        NodeId nodeId = strtoull(nodeIdString.c_str(), &end, 0);
+        VerifyOrReturnError(end != nodeIdString.c_str() && *end == '\0', CHIP_ERROR_INVALID_ARGUMENT,
+                            ChipLogError(chipTool, "Invalid node id: %s", nodeIdString.c_str()));
+        mNodeIds.push_back(nodeId);
+    }
+    VerifyOrReturnError(!mNodeIds.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    mNextNode = 0;
+    mStarted  = 0;
+    mInFlight = 0;
+    mLatenciesUs.clear();
+    mErrors.clear();
+
+    mRunStart = System::SystemClock().GetMonotonicMicroseconds64();
+    mRunEnd   = mRunStart;
+    mRunning  = true;
+
+    Tick();
+    return CHIP_NO_ERROR;
+}
+
+void LoadCommand::Shutdown()
+{
+    mRunning = false;
+    DeviceLayer::SystemLayer().CancelTimer(OnTick, this);
+
+    // Drops the operations still running, e.g. established subscriptions.
+    mOperations.clear();
+    mNodeIds.clear();
+
+    CHIPCommand::Shutdown();
+}
+
+void LoadCommand::ScheduleTick(System::Clock::Timeout delay)
+{
+    LogErrorOnFailure(DeviceLayer::SystemLayer().StartTimer(delay, OnTick, this));
+}
+
+void LoadCommand::OnTick(System::Layer * systemLayer, void * context)
+{
+    static_cast<LoadCommand *>(context)->Tick();
+}
+
+void LoadCommand::Tick()
+{
+    VerifyOrReturn(mRunning);
+
+    RemoveFinishedOperations();
+
+    const System::Clock::Microseconds64 now = System::SystemClock().GetMonotonicMicroseconds64();
+    const uint32_t rate                     = mRate.ValueOr(0);
+
+    // With a rate, the operations due by now are started, catching up within the concurrency limit.
+    const uint64_t due = (rate == 0) ? UINT64_MAX : (now - mRunStart).count() * rate / 1000000 + 1;
+    while (StartsMoreOperations(now) && mInFlight < mConcurrency.ValueOr(1) && mStarted < due)
+    {
+        if (!StartOperation(now))
+        {
+            break;
+        }
+    }
+
+    if (!StartsMoreOperations(now) && mInFlight == 0)
+    {
+        mRunning = false;
+        Report();
+        SetCommandExitStatus(CHIP_NO_ERROR);
+        return;
+    }
+
+    ScheduleTick(rate == 0 ? System::Clock::Timeout(kIdleTickInterval)
+                           : System::Clock::Milliseconds32(std::max<uint32_t>(1, 1000 / rate)));
+}
+
+bool LoadCommand::StartsMoreOperations(System::Clock::Microseconds64 now) const
+{
+    if (mDurationMs.HasValue() && now - mRunStart >= System::Clock::Milliseconds64(mDurationMs.Value()))
+    {
+        return false;
+    }
+    return mStarted < mCount.ValueOr(mDurationMs.HasValue() ? UINT32_MAX : kDefaultCount);
+}
+
+bool LoadCommand::StartOperation(System::Clock::Microseconds64 now)
+{
+    NodeId nodeId = kUndefinedNodeId;
+    for (size_t i = 0; i < mNodeIds.size(); i++)
+    {
+        const size_t index = (mNextNode + i) % mNodeIds.size();
+        if (AllowsConcurrentOperationsPerNode() || !IsNodeBusy(mNodeIds[index]))
+        {
+            nodeId    = mNodeIds[index];
+            mNextNode = index + 1;
+            break;
+        }
+    }
+    VerifyOrReturnValue(nodeId != kUndefinedNodeId, false);
+
+    OnOperationStarting(nodeId);
+
+    mOperations.push_back(NewOperation(nodeId));
+    Operation & operation = *mOperations.back();
+    operation.mStartTime  = now;
+    mStarted++;
+    mInFlight++;
+
+    CHIP_ERROR err = CurrentCommissioner().GetConnectedDevice(nodeId, &operation.mOnDeviceConnectedCallback,
+                                                              &operation.mOnDeviceConnectionFailureCallback);
+    if (err != CHIP_NO_ERROR)
+    {
+        operation.Complete(err);
+        operation.Finish();
+    }
+    return true;
+}
+
+bool LoadCommand::IsNodeBusy(NodeId nodeId) const
+{
+    return std::any_of(mOperations.begin(), mOperations.end(), [nodeId](const std::unique_ptr<Operation> & operation) {
+        return operation->GetNodeId() == nodeId && !operation->IsCompleted();
+    });
+}
+
+void LoadCommand::RemoveFinishedOperations()
+{
+    mOperations.erase(std::remove_if(mOperations.begin(), mOperations.end(),
+                                     [](const std::unique_ptr<Operation> & operation) { return operation->IsFinished(); }),
+                      mOperations.end());
+}
+
+void LoadCommand::OnOperationCompleted(Operation & operation, CHIP_ERROR error)
+{
+    mRunEnd = System::SystemClock().GetMonotonicMicroseconds64();
+    mInFlight--;
+
+    if (error == CHIP_NO_ERROR)
+    {
+        const uint64_t latencyUs = (mRunEnd - operation.mStartTime).count();
+        mLatenciesUs.push_back(static_cast<uint32_t>(std::min<uint64_t>(latencyUs, UINT32_MAX)));
+    }
+    else
+    {
+        mErrors[ErrorStr(error)]++;
+    }
+
+    // Start the next operations without waiting for the next tick.
+    if (mRunning)
+    {
+        ScheduleTick(System::Clock::kZero);
+    }
+}
+
+void LoadCommand::Report() const
+{
+    std::vector<uint32_t> latencies = mLatenciesUs;
+    std::sort(latencies.begin(), latencies.end());
+
+    const uint64_t durationUs = (mRunEnd - mRunStart).count();
+    const auto succeeded      = static_cast<uint32_t>(latencies.size());
+
+    Json::Value value;
+    value["command"]     = GetName();
+    value["nodes"]       = static_cast<Json::UInt>(mNodeIds.size());
+    value["concurrency"] = mConcurrency.ValueOr(1);
+    value["targetRate"]  = mRate.ValueOr(0);
+    value["operations"]  = mStarted;
+    value["succeeded"]   = succeeded;
+    value["failed"]      = mStarted - succeeded;
+    value["durationMs"]  = static_cast<Json::UInt64>(durationUs / 1000);
+    value["throughput"]  = (durationUs == 0) ? 0.0 : static_cast<double>(succeeded) * 1000000 / static_cast<double>(durationUs);
+
+    Json::Value latency;
+    uint64_t totalUs = 0;
+    for (auto latencyUs : latencies)
+    {
+        totalUs += latencyUs;
+    }
+    latency["min"]      = latencies.empty() ? 0 : latencies.front();
+    latency["mean"]     = latencies.empty() ? 0 : static_cast<Json::UInt64>(totalUs / latencies.size());
+    latency["p50"]      = Percentile(latencies, 50);
+    latency["p90"]      = Percentile(latencies, 90);
+    latency["p99"]      = Percentile(latencies, 99);
+    latency["max"]      = Percentile(latencies, 100);
+    value["latencyUs"]  = latency;
+
+    Json::Value errors(Json::objectValue);
+    for (const auto & error : mErrors)
+    {
+        errors[error.first] = error.second;
+    }
+    value["errors"] = errors;
+
+    printf("%s\n", JsonToString(value).c_str());
+    fflush(stdout);
+}
+
+LoadCommand::Operation::Operation(LoadCommand & command, NodeId nodeId) :
+    mCommand(command), mNodeId(nodeId), mOnDeviceConnectedCallback(OnDeviceConnectedFn, this),
+    mOnDeviceConnectionFailureCallback(OnDeviceConnectionFailureFn, this)
+{}
+
+void LoadCommand::Operation::Complete(CHIP_ERROR error)
+{
+    VerifyOrReturn(!mCompleted);
+
+    mCompleted = true;
+    mCommand.OnOperationCompleted(*this, error);
+}
+
+void LoadCommand::Operation::OnDeviceConnectedFn(void * context, Messaging::ExchangeManager & exchangeMgr,
+                                                 const SessionHandle & sessionHandle)
+{
+    auto * operation = static_cast<Operation *>(context);
+
+    CHIP_ERROR err = operation->Start(exchangeMgr, sessionHandle);
+    if (err != CHIP_NO_ERROR)
+    {
+        operation->Complete(err);
+        operation->Finish();
+    }
+}
+
+void LoadCommand::Operation::OnDeviceConnectionFailureFn(void * context, const ScopedNodeId & peerId, CHIP_ERROR error)
+{
+    auto * operation = static_cast<Operation *>(context);
+    operation->Complete(error);
+    operation->Finish();
+}
@@ -0,0 +1,131 @@
+/*
+ *   Copyright (c) 2024 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "../common/CHIPCommand.h"
+
+#include <app/OperationalSessionSetup.h>
+#include <lib/core/CHIPCallback.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Base of the benchmark commands: runs operations against one or many nodes at a target rate, with a bounded number of
+ * operations in flight, then prints their latency percentiles, throughput and errors as a JSON object.
+ *
+ * Nodes are used in turn.  Subclasses provide the operation run once a session with the node is available.
+ */
+class LoadCommand : public CHIPCommand
+{
+public:
+    LoadCommand(const char * commandName, CredentialIssuerCommands * credsIssuerConfig, const char * helpText);
+
+    /////////// CHIPCommand Interface /////////
+    CHIP_ERROR RunCommand() override;
+    chip::System::Clock::Timeout GetWaitDuration() const override { return chip::System::Clock::Seconds16(mTimeout.ValueOr(300)); }
+    void Shutdown() override;
+
+protected:
+    class Operation
+    {
+    public:
+        Operation(LoadCommand & command, chip::NodeId nodeId);
+        virtual ~Operation() = default;
+
+        /// Runs the operation over the given session.  On success, the operation
+        /// must eventually call Complete.
+        virtual CHIP_ERROR Start(chip::Messaging::ExchangeManager & exchangeMgr, const chip::SessionHandle & sessionHandle) = 0;
+
+        chip::NodeId GetNodeId() const { return mNodeId; }
+        bool IsCompleted() const { return mCompleted; }
+        bool IsFinished() const { return mFinished; }
+
+    protected:
+        /// Records the result of the operation, with its latency since it was
+        /// started (including the session lookup).  Only the first call counts.
+        void Complete(CHIP_ERROR error);
+
+        /// Lets the operation be destroyed, which the command does outside of
+        /// the operation callbacks.
+        void Finish() { mFinished = true; }
+
+        LoadCommand & mCommand;
+
+    private:
+        friend class LoadCommand;
+
+        static void OnDeviceConnectedFn(void * context, chip::Messaging::ExchangeManager & exchangeMgr,
+                                        const chip::SessionHandle & sessionHandle);
+        static void OnDeviceConnectionFailureFn(void * context, const chip::ScopedNodeId & peerId, CHIP_ERROR error);
+
+        const chip::NodeId mNodeId;
+        chip::System::Clock::Microseconds64 mStartTime;
+        bool mCompleted = false;
+        bool mFinished  = false;
+
+        chip::Callback::Callback<chip::OnDeviceConnected> mOnDeviceConnectedCallback;
+        chip::Callback::Callback<chip::OnDeviceConnectionFailure> mOnDeviceConnectionFailureCallback;
+    };
+
+    virtual std::unique_ptr<Operation> NewOperation(chip::NodeId nodeId) = 0;
+
+    /// Called before the session with the node is looked up for a new operation.
+    virtual void OnOperationStarting(chip::NodeId nodeId) {}
+
+    /// Whether operations can run concurrently against the same node.
+    virtual bool AllowsConcurrentOperationsPerNode() const { return true; }
+
+private:
+    void OnOperationCompleted(Operation & operation, CHIP_ERROR error);
+
+    void ScheduleTick(chip::System::Clock::Timeout delay);
+    static void OnTick(chip::System::Layer * systemLayer, void * context);
+    void Tick();
+
+    bool StartsMoreOperations(chip::System::Clock::Microseconds64 now) const;
+    /// Returns false when no node is available for a new operation.
+    bool StartOperation(chip::System::Clock::Microseconds64 now);
+    bool IsNodeBusy(chip::NodeId nodeId) const;
+    void RemoveFinishedOperations();
+
+    void Report() const;
+
+    std::vector<std::string> mNodeIdStrings;
+    chip::Optional<uint32_t> mCount;
+    chip::Optional<uint32_t> mDurationMs;
+    chip::Optional<uint32_t> mRate;
+    chip::Optional<uint16_t> mConcurrency;
+    chip::Optional<uint16_t> mTimeout;
+
+    std::vector<chip::NodeId> mNodeIds;
+    size_t mNextNode = 0;
+
+    std::vector<std::unique_ptr<Operation>> mOperations;
+    chip::System::Clock::Microseconds64 mRunStart;
+    chip::System::Clock::Microseconds64 mRunEnd;
+    uint32_t mStarted  = 0;
+    uint32_t mInFlight = 0;
+    bool mRunning      = false;
+
+    std::vector<uint32_t> mLatenciesUs;
+    std::map<std::string, uint32_t> mErrors;
+};
@@ -120,6 +120,11 @@ CHIP_ERROR CHIPCommand::MaybeSetUpStack()
     ReturnLogErrorOnFailure(chip::DeviceLayer::Internal::BLEMgrImpl().ConfigureBle(mBleAdapterId.ValueOr(0), true));
 #endif
 
+    if (mStorageFlushInterval.HasValue())
+    {
+        mDefaultStorage.SetWriteBack(chip::System::Clock::Seconds32(mStorageFlushInterval.Value()));
+        mCommissionerStorage.SetWriteBack(chip::System::Clock::Seconds32(mStorageFlushInterval.Value()));
+    }
     ReturnLogErrorOnFailure(mDefaultStorage.Init(nullptr, GetStorageDirectory().ValueOr(nullptr)));
     ReturnLogErrorOnFailure(mOperationalKeystore.Init(&mDefaultStorage));
     ReturnLogErrorOnFailure(mOpCertStore.Init(&mDefaultStorage));
@@ -224,6 +229,9 @@ void CHIPCommand::MaybeTearDownStack()
         ShutdownCommissioner(commissioner.first);
     }
 
+    LogErrorOnFailure(mDefaultStorage.Flush());
+    LogErrorOnFailure(mCommissionerStorage.Flush());
+
     StopTracing();
 }
 
@@ -0,0 +1,89 @@
+/*
+ *   Copyright (c) 2024 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#include "ClusterStatisticsCommand.h"
+
+#include <app/ClusterStatistics.h>
+
+using namespace chip::app;
+
+namespace {
+
+#if CHIP_IM_SERVER_CLUSTER_STATS_ENTRIES > 0
+const char * const kOperationNames[kNumClusterOperations] = { "read", "write", "invoke", "report" };
+
+void LogEntry(const ClusterStatistics::Entry & entry)
+{
+    if (entry.mElementId == ClusterStatistics::kAnyElement)
+    {
+        ChipLogProgress(chipTool, "Cluster " ChipLogFormatMEI ":", ChipLogValueMEI(entry.mClusterId));
+    }
+    else
+    {
+        ChipLogProgress(chipTool, "Cluster " ChipLogFormatMEI " element " ChipLogFormatMEI ":", ChipLogValueMEI(entry.mClusterId),
+                        ChipLogValueMEI(entry.mElementId));
+    }
+
+    for (size_t i = 0; i < kNumClusterOperations; i++)
+    {
+        const ClusterOperationStats & stats = entry.mOperations[i];
+        if (stats.mCount == 0 && stats.mTotalBytes == 0)
+        {
+            continue;
+        }
+
+        ChipLogProgress(chipTool,
+                        "  %-6s count %" PRIu32 ", p50 <= %" PRIu32 " us, p90 <= %" PRIu32 " us, max <= %" PRIu32 " us, %" PRIu64
+                        " bytes (max %" PRIu32 "), %" PRIu32 " chunks",
+                        kOperationNames[i], stats.mCount, stats.mDurations.GetPercentileUpperBoundUs(50),
+                        stats.mDurations.GetPercentileUpperBoundUs(90), stats.mDurations.GetPercentileUpperBoundUs(100),
+                        stats.mTotalBytes, stats.mMaxBytes, stats.mChunks);
+    }
+}
+#endif // CHIP_IM_SERVER_CLUSTER_STATS_ENTRIES > 0
+
+} // namespace
+
+CHIP_ERROR ClusterStatisticsCommand::RunCommand()
+{
+#if CHIP_IM_SERVER_CLUSTER_STATS_ENTRIES > 0
+    ClusterStatistics & statistics = ClusterStatistics::Instance();
+
+    ChipLogProgress(chipTool, "Statistics of %u clusters, %" PRIu32 " operations dropped",
+                    static_cast<unsigned>(statistics.GetNumEntriesInUse()), statistics.GetNumDroppedRecords());
+    for (size_t i = 0; i < statistics.GetNumEntriesInUse(); i++)
+    {
+        LogEntry(statistics.GetEntry(i));
+    }
+
+    if (mPublish.ValueOr(false))
+    {
+        statistics.PublishMetrics();
+    }
+    if (mReset.ValueOr(false))
+    {
+        statistics.Reset();
+    }
+
+    SetCommandExitStatus(CHIP_NO_ERROR);
+    return CHIP_NO_ERROR;
+#else
+    ChipLogError(chipTool, "chip-tool was built without cluster statistics, see CHIP_IM_SERVER_CLUSTER_STATS_ENTRIES");
+    return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+#endif // CHIP_IM_SERVER_CLUSTER_STATS_ENTRIES > 0
+}
@@ -0,0 +1,46 @@
+/*
+ *   Copyright (c) 2024 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "../common/CHIPCommand.h"
+
+/**
+ * Prints the per-cluster statistics of the interaction model operations served by this process, see
+ * chip::app::ClusterStatistics.  They are only kept when chip-tool is built with CHIP_IM_SERVER_CLUSTER_STATS_ENTRIES.
+ */
+class ClusterStatisticsCommand : public CHIPCommand
+{
+public:
+    ClusterStatisticsCommand(CredentialIssuerCommands * credIssuerCommands) :
+        CHIPCommand("cluster-stats", credIssuerCommands,
+                    "Prints the latency and size statistics of the reads, writes, invokes and reports served by chip-tool, "
+                    "per cluster.")
+    {
+        AddArgument("publish", 0, 1, &mPublish, "If true, also emits the statistics as metric events. Defaults to false.");
+        AddArgument("reset", 0, 1, &mReset, "If true, clears the statistics once printed. Defaults to false.");
+    }
+
+    /////////// CHIPCommand Interface /////////
+    CHIP_ERROR RunCommand() override;
+    chip::System::Clock::Timeout GetWaitDuration() const override { return chip::System::Clock::Seconds16(10); }
+
+private:
+    chip::Optional<bool> mPublish;
+    chip::Optional<bool> mReset;
+};
@@ -19,8 +19,10 @@
 #include "commands/common/Commands.h"
 #include "commands/example/ExampleCredentialIssuerCommands.h"
 
+#include "commands/benchmark/Commands.h"
 #include "commands/clusters/SubscriptionsCommands.h"
 #include "commands/delay/Commands.h"
+#include "commands/diagnostics/Commands.h"
 #include "commands/discover/Commands.h"
 #include "commands/group/Commands.h"
 #include "commands/icd/ICDCommand.h"
@@ -39,7 +41,9 @@ int main(int argc, char * argv[])
 {
     ExampleCredentialIssuerCommands credIssuerCommands;
     Commands commands;
+    registerCommandsBenchmark(commands, &credIssuerCommands);
     registerCommandsDelay(commands, &credIssuerCommands);
+    registerCommandsDiagnostics(commands, &credIssuerCommands);
     registerCommandsDiscover(commands, &credIssuerCommands);
     registerCommandsICD(commands, &credIssuerCommands);
     registerCommandsInteractive(commands, &credIssuerCommands);
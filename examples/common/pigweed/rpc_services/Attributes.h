@@ -23,6 +23,9 @@
 
 #include <app-common/zap-generated/attribute-type.h>
 #include <app/AppConfig.h>
+#include <app/AttributePathExpandIterator.h>
+#include <app/AttributePathParams.h>
+#include <app/AttributeValueDecoder.h>
 #include <app/AttributeValueEncoder.h>
 #include <app/InteractionModelEngine.h>
 #include <app/MessageDef/AttributeReportIBs.h>
@@ -34,8 +37,12 @@
 #include <lib/core/TLV.h>
 #include <lib/core/TLVTags.h>
 #include <lib/core/TLVTypes.h>
+#include <lib/support/LinkedList.h>
 #include <platform/PlatformManager.h>
 
+#include <algorithm>
+#include <type_traits>
+
 namespace chip {
 namespace rpc {
 
@@ -198,24 +205,185 @@ public:
         return pw::OkStatus();
     }
 
+    // Writes the same value to all the attributes of the paths, expanding their wildcards in a single walk of the data model.
+    ::pw::Status BatchWrite(const chip_rpc_AttributeBatchWrite & request, pw_protobuf_Empty & response)
+    {
+        PathNode pathNodes[std::extent<decltype(request.paths)>::value];
+        PathNode * paths = BuildPathList(request.paths, request.paths_count, pathNodes);
+        Access::SubjectDescriptor subjectDescriptor{ .authMode = chip::Access::AuthMode::kPase };
+        ::pw::Status status = ::pw::Status::NotFound();
+        DeviceLayer::StackLock lock;
+
+        // TODO: this assumes a singleton data model provider
+        app::DataModel::Provider * provider = app::InteractionModelEngine::GetInstance()->GetDataModelProvider();
+
+        app::ConcreteAttributePath path;
+        for (app::AttributePathExpandIterator iterator(provider, paths); iterator.Get(path); iterator.Next())
+        {
+            TLV::TLVReader reader;
+            reader.Init(request.tlv_data.bytes, request.tlv_data.size);
+            PW_TRY(ChipErrorToPwStatus(reader.Next()));
+
+            app::DataModel::WriteAttributeRequest writeRequest;
+            writeRequest.path = app::ConcreteDataAttributePath(path);
+            writeRequest.operationFlags.Set(app::DataModel::OperationFlags::kInternal);
+            writeRequest.subjectDescriptor = &subjectDescriptor;
+
+            app::AttributeValueDecoder decoder(reader, subjectDescriptor);
+            app::DataModel::ActionReturnStatus result = provider->WriteAttribute(writeRequest, decoder);
+            if (!result.IsSuccess())
+            {
+                // Keep writing the other attributes, and report the failure at the end.
+                app::DataModel::ActionReturnStatus::StringStorage storage;
+                ChipLogError(Support, "Failed to write " ChipLogFormatMEI "/" ChipLogFormatMEI " on endpoint %u: %s",
+                             ChipLogValueMEI(path.mClusterId), ChipLogValueMEI(path.mAttributeId), path.mEndpointId,
+                             result.c_str(storage));
+                status = ::pw::Status::Internal();
+            }
+            else if (status.IsNotFound())
+            {
+                status = ::pw::OkStatus();
+            }
+        }
+
+        return status;
+    }
+
+    // Streams the attributes of the paths as chunks of AttributeReportIBs, expanding their wildcards in a single walk of the
+    // data model.
+    void BatchRead(const chip_rpc_AttributePaths & request, ServerWriter<chip_rpc_AttributeReports> & writer)
+    {
+        PathNode pathNodes[std::extent<decltype(request.paths)>::value];
+        PathNode * paths = BuildPathList(request.paths, request.paths_count, pathNodes);
+        Access::SubjectDescriptor subjectDescriptor{ .authMode = chip::Access::AuthMode::kPase };
+        chip_rpc_AttributeReports reports = chip_rpc_AttributeReports_init_default;
+        ReportChunk chunk;
+        DeviceLayer::StackLock lock;
+
+        // TODO: this assumes a singleton data model provider
+        app::DataModel::Provider * provider = app::InteractionModelEngine::GetInstance()->GetDataModelProvider();
+
+        app::ConcreteAttributePath path;
+        app::AttributePathExpandIterator iterator(provider, paths);
+        ::pw::Status status = chunk.Start(reports);
+        while (status.ok() && iterator.Get(path))
+        {
+            TLV::TLVWriter checkpoint;
+            chunk.attributeReports.Checkpoint(checkpoint);
+            app::DataModel::ActionReturnStatus result =
+                EncodeAttributeReport(provider, subjectDescriptor, path, chunk.attributeReports);
+            if (result.IsSuccess())
+            {
+                chunk.isEmpty = false;
+                iterator.Next();
+                continue;
+            }
+
+            chunk.attributeReports.Rollback(checkpoint);
+            if (!result.IsOutOfSpaceEncodingResponse())
+            {
+                // As in wildcard reports, the attributes that cannot be read are left out.
+                app::DataModel::ActionReturnStatus::StringStorage storage;
+                ChipLogError(Support, "Failed to read " ChipLogFormatMEI "/" ChipLogFormatMEI " on endpoint %u: %s",
+                             ChipLogValueMEI(path.mClusterId), ChipLogValueMEI(path.mAttributeId), path.mEndpointId,
+                             result.c_str(storage));
+                iterator.Next();
+                continue;
+            }
+
+            // Send the chunk, and retry the attribute in the next one, unless it does not fit in a chunk at all.
+            status = chunk.isEmpty ? ::pw::Status::ResourceExhausted() : chunk.Finish(reports);
+            if (status.ok())
+            {
+                status = writer.Write(reports);
+            }
+            if (status.ok())
+            {
+                status = chunk.Start(reports);
+            }
+        }
+
+        if (status.ok() && !chunk.isEmpty)
+        {
+            status = chunk.Finish(reports);
+            if (status.ok())
+            {
+                status = writer.Write(reports);
+            }
+        }
+        writer.Finish(status);
+    }
+
 private:
+    using PathNode = SingleLinkedListNode<app::AttributePathParams>;
+
     static constexpr uint8_t kReportContextTag = 0x01;
 
-    ::pw::Status ReadAttributeIntoTlvBuffer(const app::ConcreteAttributePath & path, MutableByteSpan & tlvBuffer)
+    // Bytes reserved in a chunk to close the report array and the outer structure.
+    static constexpr uint32_t kReportChunkClosingSize = 2;
+
+    // TLV encoding of the attribute reports sent in one AttributeReports message.
+    struct ReportChunk
     {
-        Access::SubjectDescriptor subjectDescriptor{ .authMode = chip::Access::AuthMode::kPase };
-        app::AttributeReportIBs::Builder attributeReports;
         TLV::TLVWriter writer;
         TLV::TLVType outer;
-        DeviceLayer::StackLock lock;
+        app::AttributeReportIBs::Builder attributeReports;
+        bool isEmpty = true;
 
-        writer.Init(tlvBuffer);
-        PW_TRY(ChipErrorToPwStatus(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer)));
-        PW_TRY(ChipErrorToPwStatus(attributeReports.Init(&writer, kReportContextTag)));
+        ::pw::Status Start(chip_rpc_AttributeReports & reports)
+        {
+            isEmpty = true;
+            writer.Init(reports.tlv_data.bytes, sizeof(reports.tlv_data.bytes));
+            PW_TRY(ChipErrorToPwStatus(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer)));
+            PW_TRY(ChipErrorToPwStatus(attributeReports.Init(&writer, kReportContextTag)));
+            return ChipErrorToPwStatus(writer.ReserveBuffer(kReportChunkClosingSize));
+        }
 
-        // TODO: this assumes a singleton data model provider
-        app::DataModel::Provider * provider = app::InteractionModelEngine::GetInstance()->GetDataModelProvider();
+        ::pw::Status Finish(chip_rpc_AttributeReports & reports)
+        {
+            PW_TRY(ChipErrorToPwStatus(writer.UnreserveBuffer(kReportChunkClosingSize)));
+            attributeReports.EndOfContainer();
+            PW_TRY(ChipErrorToPwStatus(attributeReports.GetError()));
+            PW_TRY(ChipErrorToPwStatus(writer.EndContainer(outer)));
+            PW_TRY(ChipErrorToPwStatus(writer.Finalize()));
+            reports.tlv_data.size = static_cast<pb_size_t>(writer.GetLengthWritten());
+            return ::pw::OkStatus();
+        }
+    };
 
+    template <size_t N>
+    static PathNode * BuildPathList(const chip_rpc_AttributePath (&requested)[N], pb_size_t count, PathNode (&nodes)[N])
+    {
+        PathNode * list = nullptr;
+        // Built back to front, so that the attributes come in the order of the paths.
+        for (size_t i = std::min(static_cast<size_t>(count), N); i > 0; i--)
+        {
+            const chip_rpc_AttributePath & requestedPath = requested[i - 1];
+            app::AttributePathParams & params            = nodes[i - 1].mValue;
+            params                                       = app::AttributePathParams();
+            if (requestedPath.has_endpoint)
+            {
+                params.mEndpointId = static_cast<EndpointId>(requestedPath.endpoint);
+            }
+            if (requestedPath.has_cluster)
+            {
+                params.mClusterId = requestedPath.cluster;
+            }
+            if (requestedPath.has_attribute_id)
+            {
+                params.mAttributeId = requestedPath.attribute_id;
+            }
+            nodes[i - 1].mpNext = list;
+            list                = &nodes[i - 1];
+        }
+        return list;
+    }
+
+    static app::DataModel::ActionReturnStatus EncodeAttributeReport(app::DataModel::Provider * provider,
+                                                                    const Access::SubjectDescriptor & subjectDescriptor,
+                                                                    const app::ConcreteAttributePath & path,
+                                                                    app::AttributeReportIBs::Builder & attributeReports)
+    {
         app::DataModel::ReadAttributeRequest request;
         request.path = path;
         request.operationFlags.Set(app::DataModel::OperationFlags::kInternal);
@@ -224,12 +392,34 @@ private:
         std::optional<app::DataModel::ClusterInfo> info = provider->GetClusterInfo(path);
         if (!info.has_value())
         {
-            return ::pw::Status::NotFound();
+            return Protocols::InteractionModel::Status::UnsupportedCluster;
         }
 
         app::AttributeValueEncoder encoder(attributeReports, subjectDescriptor, path, info->dataVersion,
                                            false /* isFabricFiltered */, nullptr /* attributeEncodingState */);
-        app::DataModel::ActionReturnStatus result = provider->ReadAttribute(request, encoder);
+        return provider->ReadAttribute(request, encoder);
+    }
+
+    ::pw::Status ReadAttributeIntoTlvBuffer(const app::ConcreteAttributePath & path, MutableByteSpan & tlvBuffer)
+    {
+        Access::SubjectDescriptor subjectDescriptor{ .authMode = chip::Access::AuthMode::kPase };
+        app::AttributeReportIBs::Builder attributeReports;
+        TLV::TLVWriter writer;
+        TLV::TLVType outer;
+        DeviceLayer::StackLock lock;
+
+        writer.Init(tlvBuffer);
+        PW_TRY(ChipErrorToPwStatus(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer)));
+        PW_TRY(ChipErrorToPwStatus(attributeReports.Init(&writer, kReportContextTag)));
+
+        // TODO: this assumes a singleton data model provider
+        app::DataModel::Provider * provider = app::InteractionModelEngine::GetInstance()->GetDataModelProvider();
+
+        app::DataModel::ActionReturnStatus result = EncodeAttributeReport(provider, subjectDescriptor, path, attributeReports);
+        if (result == Protocols::InteractionModel::Status::UnsupportedCluster)
+        {
+            return ::pw::Status::NotFound();
+        }
 
         if (!result.IsSuccess())
         {
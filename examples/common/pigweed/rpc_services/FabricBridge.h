@@ -59,6 +59,11 @@ public:
     {
         return pw::Status::Unimplemented();
     }
+
+    virtual void SyncDevices(ServerReader<chip_rpc_SyncDevicesRequest, pw_protobuf_Empty> & reader)
+    {
+        reader.Finish(pw_protobuf_Empty_init_default, pw::Status::Unimplemented());
+    }
 };
 
 } // namespace rpc
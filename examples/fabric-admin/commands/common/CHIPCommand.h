@@ -98,6 +98,9 @@ public:
         AddArgument("ble-adapter", 0, UINT16_MAX, &mBleAdapterId);
         AddArgument("storage-directory", &mStorageDirectory,
                     "Directory to place fabric-admin's storage files in.  Defaults to $TMPDIR, with fallback to /tmp");
+        AddArgument("storage-flush-interval", 0, UINT32_MAX, &mStorageFlushInterval,
+                    "Keep the storage in memory, and write it to its files at most every this many seconds and on exit.  0 only "
+                    "writes it on exit.  If not provided, each update is written to the files right away.");
         AddArgument(
             "commissioner-vendor-id", 0, UINT16_MAX, &mCommissionerVendorId,
             "The vendor id to use for fabric-admin. If not provided, chip::VendorId::TestVendor1 (65521, 0xFFF1) will be used.");
@@ -221,6 +224,7 @@ private:
     chip::Optional<char *> mCommissionerName;
     chip::Optional<chip::NodeId> mCommissionerNodeId;
     chip::Optional<chip::VendorId> mCommissionerVendorId;
+    chip::Optional<uint32_t> mStorageFlushInterval;
     chip::Optional<uint16_t> mBleAdapterId;
     chip::Optional<char *> mPaaTrustStorePath;
     chip::Optional<char *> mCDTrustStorePath;
@@ -17,10 +17,14 @@
  */
 #pragma once
 
+#include <app/AttributePathParams.h>
+#include <app/ClusterStateCache.h>
 #include <app/ReadClient.h>
 #include <controller/CHIPDeviceController.h>
 #include <lib/core/DataModelTypes.h>
 #include <memory>
+#include <transport/SessionHolder.h>
+#include <vector>
 
 #if defined(PW_RPC_ENABLED)
 #include "fabric_bridge_service/fabric_bridge_service.pb.h"
@@ -31,13 +35,33 @@ namespace admin {
 
 class DeviceSubscriptionManager;
 
+/// Receives the attribute changes of a remote node from the DeviceSubscription to that node, which
+/// is shared by all the listeners of the node instead of each of them subscribing on its own.
+class DeviceSubscriptionListener
+{
+public:
+    virtual ~DeviceSubscriptionListener() = default;
+
+    /// Called at the end of a report for every changed attribute within the paths of the listener.
+    /// The value of the attribute is read from `cache`.
+    virtual void OnAttributeChanged(const chip::ScopedNodeId & nodeId, const chip::app::ClusterStateCache & cache,
+                                    const chip::app::ConcreteAttributePath & path) = 0;
+
+    /// Called when the subscription to the node is terminated. The listener is not called anymore
+    /// afterwards.
+    virtual void OnSubscriptionTerminated(const chip::ScopedNodeId & nodeId) {}
+};
+
 /// Attribute subscription to attributes that are important to keep track and send to fabric-bridge
 /// via RPC when change has been identified.
 ///
+/// The subscription feeds a ClusterStateCache and fans out the changes of the attributes to the
+/// DeviceSubscriptionListeners of the node, so that there is a single subscription per remote node.
+///
 /// An instance of DeviceSubscription is intended to be used only once. Once a DeviceSubscription is
 /// terminated, either from an error or from subscriptions getting shut down, we expect the instance
 /// to be deleted. Any new subscription should instantiate another instance of DeviceSubscription.
-class DeviceSubscription : public chip::app::ReadClient::Callback
+class DeviceSubscription : public chip::app::ClusterStateCache::Callback
 {
 public:
     using OnDoneCallback = std::function<void(chip::ScopedNodeId)>;
@@ -53,11 +77,23 @@ public:
     /// Must only be called after StartSubscription was successfully called.
     void StopSubscription();
 
+    /// Adds a listener for the attributes within `path`. If `path` is not covered by the paths
+    /// subscribed to yet, the subscription is re-established with `path` added; the data versions of
+    /// the cache keep the node from reporting again the attributes that did not change. The
+    /// attributes of `path` already in the cache are reported to the listener right away.
+    ///
+    /// Must not be called from a DeviceSubscriptionListener callback.
+    CHIP_ERROR AddListener(DeviceSubscriptionListener & listener, const chip::app::AttributePathParams & path);
+
+    /// Removes all the registrations of the listener. The subscribed paths are left as they are.
+    void RemoveListener(DeviceSubscriptionListener & listener);
+
     ///////////////////////////////////////////////////////////////
-    // ReadClient::Callback implementation
+    // ClusterStateCache::Callback implementation
     ///////////////////////////////////////////////////////////////
     void OnAttributeData(const chip::app::ConcreteDataAttributePath & path, chip::TLV::TLVReader * data,
                          const chip::app::StatusIB & status) override;
+    void OnAttributeChanged(chip::app::ClusterStateCache * cache, const chip::app::ConcreteAttributePath & path) override;
     void OnReportEnd() override;
     void OnError(CHIP_ERROR error) override;
     void OnDone(chip::app::ReadClient * apReadClient) override;
@@ -78,13 +114,28 @@ private:
         AwaitingDestruction, ///< The object has completed its work and is awaiting destruction.
     };
 
+    struct ListenerEntry
+    {
+        DeviceSubscriptionListener * listener;
+        chip::app::AttributePathParams path;
+    };
+
     void MoveToState(const State aTargetState);
     const char * GetStateStr() const;
 
+    CHIP_ERROR SendSubscribeRequest();
+    void NotifyDone();
+
     chip::ScopedNodeId mScopedNodeId;
 
     OnDoneCallback mOnDoneCallback;
+    chip::app::ClusterStateCache mAttributeCache;
     std::unique_ptr<chip::app::ReadClient> mClient;
+    chip::Messaging::ExchangeManager * mExchangeMgr = nullptr;
+    chip::SessionHolder mSession;
+
+    std::vector<chip::app::AttributePathParams> mAttributePaths;
+    std::vector<ListenerEntry> mListeners;
 
     chip::Callback::Callback<chip::OnDeviceConnected> mOnDeviceConnectedCallback;
     chip::Callback::Callback<chip::OnDeviceConnectionFailure> mOnDeviceConnectionFailureCallback;
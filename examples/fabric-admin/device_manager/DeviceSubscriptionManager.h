@@ -42,6 +42,16 @@ public:
 
     CHIP_ERROR RemoveSubscription(chip::ScopedNodeId scopedNodeId);
 
+    /// Registers `listener` for the changes of the attributes within `path` on the subscription
+    /// kept to the node, instead of letting the listener open a subscription of its own. There is
+    /// at most one subscription per node, whatever the number of listeners.
+    ///
+    /// Returns CHIP_ERROR_NOT_FOUND if there is no subscription to the node.
+    CHIP_ERROR AddListener(chip::ScopedNodeId scopedNodeId, DeviceSubscriptionListener & listener,
+                           const chip::app::AttributePathParams & path);
+
+    CHIP_ERROR RemoveListener(chip::ScopedNodeId scopedNodeId, DeviceSubscriptionListener & listener);
+
 private:
     struct ScopedNodeIdHasher
     {
@@ -230,4 +230,29 @@ CHIP_ERROR DeviceReachableChanged(const chip_rpc_ReachabilityChanged & data)
     return WaitForResponse(call);
 }
 
+CHIP_ERROR SyncDevices(chip::Span<const chip_rpc_SyncDevicesRequest> changes)
+{
+    ChipLogProgress(NotSpecified, "SyncDevices: %u changes", static_cast<unsigned>(changes.size()));
+    VerifyOrReturnError(!changes.empty(), CHIP_NO_ERROR);
+
+    // The RPC call is kept alive until it completes. fabric-bridge completes it once it has applied the
+    // change with `commit` set, which is the last one.
+    auto call = fabricBridgeClient.SyncDevices(RpcCompletedWithEmptyResponse);
+
+    if (!call.active())
+    {
+        // The RPC call was not sent. This could occur due to, for example, an invalid channel ID. Handle if necessary.
+        return CHIP_ERROR_INTERNAL;
+    }
+
+    for (size_t i = 0; i < changes.size(); i++)
+    {
+        chip_rpc_SyncDevicesRequest change = changes[i];
+        change.commit                      = (i + 1 == changes.size());
+        VerifyOrReturnError(call.Write(change).ok(), CHIP_ERROR_INTERNAL);
+    }
+
+    return WaitForResponse(call);
+}
+
 } // namespace admin
@@ -19,6 +19,7 @@
 #pragma once
 
 #include <lib/core/ScopedNodeId.h>
+#include <lib/support/Span.h>
 #include <platform/CHIPDeviceLayer.h>
 
 #include "fabric_bridge_service/fabric_bridge_service.rpc.pb.h"
@@ -102,4 +103,18 @@ CHIP_ERROR AdminCommissioningAttributeChanged(const chip_rpc_AdministratorCommis
  */
 CHIP_ERROR DeviceReachableChanged(const chip_rpc_ReachabilityChanged & data);
 
+/**
+ * @brief Sends several device changes to fabric-bridge in a single SyncDevices stream.
+ *
+ * Instead of one RPC round trip and one dynamic endpoint update per change, the changes are
+ * streamed and fabric-bridge applies them all as a single update of its dynamic endpoints once the
+ * last one is received. The `commit` field of the changes is set by this function.
+ *
+ * @param changes the device additions, removals and attribute changes to apply, in order.
+ * @return CHIP_ERROR An error code indicating the success or failure of the operation.
+ * - CHIP_NO_ERROR: The RPC command was successfully processed.
+ * - CHIP_ERROR_INTERNAL: An internal error occurred while activating the RPC call, or a change failed to apply.
+ */
+CHIP_ERROR SyncDevices(chip::Span<const chip_rpc_SyncDevicesRequest> changes);
+
 } // namespace admin
@@ -22,13 +22,38 @@
 
 #include "BridgedDevice.h"
 
+#include <atomic>
 #include <memory>
+#include <thread>
 
 namespace bridge {
 
 class BridgedDeviceManager
 {
 public:
+    /**
+     * @brief Groups several additions and removals of devices into a single update of the dynamic endpoints.
+     *
+     * The Matter stack stays locked for the lifetime of the EndpointUpdate, which is a dynamic endpoint
+     * change batch: the parts lists are marked as changed once, and subscribers get one report of them
+     * instead of one per added or removed device. The methods of the BridgedDeviceManager may be
+     * called from the thread holding the EndpointUpdate, they do not lock the stack again.
+     *
+     * EndpointUpdates cannot be nested.
+     */
+    class EndpointUpdate
+    {
+    public:
+        explicit EndpointUpdate(BridgedDeviceManager & manager);
+        ~EndpointUpdate();
+
+        EndpointUpdate(const EndpointUpdate &)             = delete;
+        EndpointUpdate & operator=(const EndpointUpdate &) = delete;
+
+    private:
+        BridgedDeviceManager & mManager;
+    };
+
     BridgedDeviceManager() = default;
 
     static BridgedDeviceManager & Instance()
@@ -118,6 +143,8 @@ public:
     BridgedDevice * GetDeviceByUniqueId(const std::string & id);
 
 private:
+    bool IsInEndpointUpdate() const { return mEndpointUpdateThread.load() == std::this_thread::get_id(); }
+
     /**
      * Creates a new unique ID that is not used by any other mDevice
      */
@@ -128,6 +155,8 @@ private:
     chip::EndpointId mCurrentEndpointId;
     chip::EndpointId mFirstDynamicEndpointId;
     std::unique_ptr<BridgedDevice> mDevices[CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT + 1];
+    // Thread holding the current EndpointUpdate, if any.
+    std::atomic<std::thread::id> mEndpointUpdateThread;
 };
 
 } // namespace bridge
@@ -174,8 +174,47 @@ DataVersion sBridgedNodeDataVersions[ArraySize(bridgedNodeClusters)];
 
 const EmberAfDeviceType sBridgedDeviceTypes[] = { { DEVICE_TYPE_BRIDGED_NODE, DEVICE_VERSION_DEFAULT } };
 
+/// Locks the Matter stack, unless the calling thread already holds it for an EndpointUpdate.
+class EndpointLock
+{
+public:
+    explicit EndpointLock(bool inEndpointUpdate) : mLocked(!inEndpointUpdate)
+    {
+        if (mLocked)
+        {
+            PlatformMgr().LockChipStack();
+        }
+    }
+
+    ~EndpointLock()
+    {
+        if (mLocked)
+        {
+            PlatformMgr().UnlockChipStack();
+        }
+    }
+
+private:
+    const bool mLocked;
+};
+
 } // namespace
 
+BridgedDeviceManager::EndpointUpdate::EndpointUpdate(BridgedDeviceManager & manager) : mManager(manager)
+{
+    VerifyOrDie(!mManager.IsInEndpointUpdate());
+    PlatformMgr().LockChipStack();
+    mManager.mEndpointUpdateThread = std::this_thread::get_id();
+    emberAfBeginDynamicEndpointChanges();
+}
+
+BridgedDeviceManager::EndpointUpdate::~EndpointUpdate()
+{
+    emberAfEndDynamicEndpointChanges();
+    mManager.mEndpointUpdateThread = std::thread::id();
+    PlatformMgr().UnlockChipStack();
+}
+
 void BridgedDeviceManager::Init()
 {
     mFirstDynamicEndpointId = static_cast<chip::EndpointId>(
@@ -212,7 +251,7 @@ std::optional<unsigned> BridgedDeviceManager::AddDeviceEndpoint(std::unique_ptr<
 
         for (int retryCount = 0; retryCount < kMaxRetries; retryCount++)
         {
-            DeviceLayer::StackLock lock;
+            EndpointLock lock(IsInEndpointUpdate());
             dev->SetEndpointId(mCurrentEndpointId);
             dev->SetParentEndpointId(parentEndpointId);
             CHIP_ERROR err =
@@ -250,7 +289,7 @@ int BridgedDeviceManager::RemoveDeviceEndpoint(BridgedDevice * dev)
     {
         if (mDevices[index].get() == dev)
         {
-            DeviceLayer::StackLock lock;
+            EndpointLock lock(IsInEndpointUpdate());
             // Silence complaints about unused ep when progress logging
             // disabled.
             [[maybe_unused]] EndpointId ep = emberAfClearDynamicEndpoint(index);
@@ -332,7 +371,7 @@ std::optional<unsigned> BridgedDeviceManager::RemoveDeviceByScopedNodeId(chip::S
     {
         if (mDevices[index] && mDevices[index]->GetScopedNodeId() == scopedNodeId)
         {
-            DeviceLayer::StackLock lock;
+            EndpointLock lock(IsInEndpointUpdate());
             EndpointId ep   = emberAfClearDynamicEndpoint(index);
             mDevices[index] = nullptr;
             ChipLogProgress(NotSpecified, "Removed device with Id=[%d:0x" ChipLogFormatX64 "] from dynamic endpoint %d (index=%d)",
@@ -25,6 +25,7 @@
 
 #include <string>
 #include <thread>
+#include <vector>
 
 #if defined(PW_RPC_FABRIC_BRIDGE_SERVICE) && PW_RPC_FABRIC_BRIDGE_SERVICE
 #include "pigweed/rpc_services/FabricBridge.h"
@@ -51,6 +52,14 @@ public:
     pw::Status AdminCommissioningAttributeChanged(const chip_rpc_AdministratorCommissioningChanged & request,
                                                   pw_protobuf_Empty & response) override;
     pw::Status DeviceReachableChanged(const chip_rpc_ReachabilityChanged & request, pw_protobuf_Empty & response) override;
+    void SyncDevices(ServerReader<chip_rpc_SyncDevicesRequest, pw_protobuf_Empty> & reader) override;
+
+private:
+    void OnSyncDevicesRequest(const chip_rpc_SyncDevicesRequest & request);
+    pw::Status ApplySyncDevicesRequest(const chip_rpc_SyncDevicesRequest & request);
+
+    ServerReader<chip_rpc_SyncDevicesRequest, pw_protobuf_Empty> mSyncDevicesReader;
+    std::vector<chip_rpc_SyncDevicesRequest> mSyncDevicesBatch;
 };
 
 pw::Status FabricBridge::AddSynchronizedDevice(const chip_rpc_SynchronizedDevice & request, pw_protobuf_Empty & response)
@@ -233,6 +242,69 @@ pw::Status FabricBridge::DeviceReachableChanged(const chip_rpc_ReachabilityChang
     return pw::OkStatus();
 }
 
+void FabricBridge::SyncDevices(ServerReader<chip_rpc_SyncDevicesRequest, pw_protobuf_Empty> & reader)
+{
+    ChipLogProgress(NotSpecified, "Received SyncDevices");
+
+    // A new stream replaces the one in progress, if any, along with its changes.
+    mSyncDevicesBatch.clear();
+    mSyncDevicesReader = std::move(reader);
+    mSyncDevicesReader.set_on_next([this](const chip_rpc_SyncDevicesRequest & request) { OnSyncDevicesRequest(request); });
+}
+
+void FabricBridge::OnSyncDevicesRequest(const chip_rpc_SyncDevicesRequest & request)
+{
+    mSyncDevicesBatch.push_back(request);
+    if (!request.commit)
+    {
+        return;
+    }
+
+    ChipLogProgress(NotSpecified, "Applying %u SyncDevices changes", static_cast<unsigned>(mSyncDevicesBatch.size()));
+
+    // All the changes are applied as a single update of the dynamic endpoints. A failed change does
+    // not prevent applying the others, the stream completes with the status of the first failure.
+    pw::Status status = pw::OkStatus();
+    {
+        BridgedDeviceManager::EndpointUpdate update(BridgedDeviceManager::Instance());
+        for (const auto & change : mSyncDevicesBatch)
+        {
+            status.Update(ApplySyncDevicesRequest(change));
+        }
+    }
+
+    mSyncDevicesBatch.clear();
+    mSyncDevicesReader.Finish(pw_protobuf_Empty_init_default, status);
+}
+
+pw::Status FabricBridge::ApplySyncDevicesRequest(const chip_rpc_SyncDevicesRequest & request)
+{
+    pw_protobuf_Empty response;
+    pw::Status status = pw::OkStatus();
+
+    if (request.has_remove)
+    {
+        status.Update(RemoveSynchronizedDevice(request.remove, response));
+    }
+
+    if (request.has_add)
+    {
+        status.Update(AddSynchronizedDevice(request.add, response));
+    }
+
+    if (request.has_admin_commissioning_changed)
+    {
+        status.Update(AdminCommissioningAttributeChanged(request.admin_commissioning_changed, response));
+    }
+
+    if (request.has_reachability_changed)
+    {
+        status.Update(DeviceReachableChanged(request.reachability_changed, response));
+    }
+
+    return status;
+}
+
 FabricBridge fabric_bridge_service;
 #endif // defined(PW_RPC_FABRIC_BRIDGE_SERVICE) && PW_RPC_FABRIC_BRIDGE_SERVICE
 
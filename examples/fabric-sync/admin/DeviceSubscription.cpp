@@ -17,6 +17,8 @@
  */
 
 #include "DeviceSubscription.h"
+
+#include <algorithm>
 #include "DeviceManager.h"
 
 #include <app-common/zap-generated/ids/Attributes.h>
@@ -45,14 +47,15 @@ void OnDeviceConnectionFailureWrapper(void * context, const ScopedNodeId & peerI
 } // namespace
 
 DeviceSubscription::DeviceSubscription() :
-    mOnDeviceConnectedCallback(OnDeviceConnectedWrapper, this),
+    mAttributeCache(*this), mOnDeviceConnectedCallback(OnDeviceConnectedWrapper, this),
     mOnDeviceConnectionFailureCallback(OnDeviceConnectionFailureWrapper, this)
 {}
 
 void DeviceSubscription::OnAttributeData(const ConcreteDataAttributePath & path, TLV::TLVReader * data, const StatusIB & status)
 {
-    VerifyOrDie(path.mEndpointId == kRootEndpointId);
-    VerifyOrDie(path.mClusterId == Clusters::AdministratorCommissioning::Id);
+    // The subscription also carries the paths of the listeners, which get their changes from OnAttributeChanged.
+    VerifyOrReturn(path.mEndpointId == kRootEndpointId && path.mClusterId == Clusters::AdministratorCommissioning::Id);
+    VerifyOrReturn(data != nullptr);
 
     switch (path.mAttributeId)
     {
@@ -100,6 +103,19 @@ void DeviceSubscription::OnAttributeData(const ConcreteDataAttributePath & path,
     }
 }
 
+void DeviceSubscription::OnAttributeChanged(ClusterStateCache * cache, const ConcreteAttributePath & path)
+{
+    // Listeners may remove themselves while being notified.
+    std::vector<ListenerEntry> listeners = mListeners;
+    for (auto & entry : listeners)
+    {
+        if (entry.path.IsAttributePathSupersetOf(path))
+        {
+            entry.listener->OnAttributeChanged(mScopedNodeId, *cache, path);
+        }
+    }
+}
+
 void DeviceSubscription::OnReportEnd()
 {
     // Report end is at the end of all attributes (success)
@@ -120,8 +136,7 @@ void DeviceSubscription::OnDone(ReadClient * apReadClient)
 {
     // After calling mOnDoneCallback we are indicating that `this` is deleted and we shouldn't do anything else with
     // DeviceSubscription.
-    MoveToState(State::AwaitingDestruction);
-    mOnDoneCallback(mScopedNodeId);
+    NotifyDone();
 }
 
 void DeviceSubscription::OnError(CHIP_ERROR error)
@@ -144,38 +159,62 @@ void DeviceSubscription::OnDeviceConnected(Messaging::ExchangeManager & exchange
     {
         // After calling mOnDoneCallback we are indicating that `this` is deleted and we shouldn't do anything else with
         // DeviceSubscription.
-        MoveToState(State::AwaitingDestruction);
-        mOnDoneCallback(mScopedNodeId);
+        NotifyDone();
         return;
     }
     VerifyOrDie(mState == State::Connecting);
-    mClient = std::make_unique<ReadClient>(app::InteractionModelEngine::GetInstance(), &exchangeMgr /* echangeMgr */,
-                                           *this /* callback */, ReadClient::InteractionType::Subscribe);
-    VerifyOrDie(mClient);
-
-    AttributePathParams readPaths[1];
-    readPaths[0] = AttributePathParams(kRootEndpointId, Clusters::AdministratorCommissioning::Id);
-
-    ReadPrepareParams readParams(sessionHandle);
-
-    readParams.mpAttributePathParamsList    = readPaths;
-    readParams.mAttributePathParamsListSize = 1;
-    readParams.mMaxIntervalCeilingSeconds   = 5 * 60;
+    mExchangeMgr = &exchangeMgr;
+    mSession.Grab(sessionHandle);
 
-    CHIP_ERROR err = mClient->SendRequest(readParams);
+    CHIP_ERROR err = SendSubscribeRequest();
 
     if (err != CHIP_NO_ERROR)
     {
-        ChipLogError(NotSpecified, "Failed to issue subscription to AdministratorCommissioning data");
+        ChipLogError(NotSpecified, "Failed to issue subscription to AdministratorCommissioning data: %" CHIP_ERROR_FORMAT,
+                     err.Format());
         // After calling mOnDoneCallback we are indicating that `this` is deleted and we shouldn't do anything else with
         // DeviceSubscription.
-        MoveToState(State::AwaitingDestruction);
-        mOnDoneCallback(mScopedNodeId);
+        NotifyDone();
         return;
     }
     MoveToState(State::SubscriptionStarted);
 }
 
+CHIP_ERROR DeviceSubscription::SendSubscribeRequest()
+{
+    VerifyOrReturnError(mExchangeMgr != nullptr && mSession, CHIP_ERROR_INCORRECT_STATE);
+
+    auto client = std::make_unique<ReadClient>(app::InteractionModelEngine::GetInstance(), mExchangeMgr,
+                                               mAttributeCache.GetBufferedCallback(), ReadClient::InteractionType::Subscribe);
+    VerifyOrReturnError(client, CHIP_ERROR_NO_MEMORY);
+
+    ReadPrepareParams readParams(mSession.Get().Value());
+
+    readParams.mpAttributePathParamsList    = mAttributePaths.data();
+    readParams.mAttributePathParamsListSize = mAttributePaths.size();
+    readParams.mMaxIntervalCeilingSeconds   = 5 * 60;
+
+    ReturnErrorOnFailure(client->SendRequest(readParams));
+
+    // Replacing an established subscription drops the previous one.
+    mClient = std::move(client);
+    return CHIP_NO_ERROR;
+}
+
+void DeviceSubscription::NotifyDone()
+{
+    MoveToState(State::AwaitingDestruction);
+
+    std::vector<ListenerEntry> listeners = std::move(mListeners);
+    mListeners.clear();
+    for (auto & entry : listeners)
+    {
+        entry.listener->OnSubscriptionTerminated(mScopedNodeId);
+    }
+
+    mOnDoneCallback(mScopedNodeId);
+}
+
 void DeviceSubscription::MoveToState(const State aTargetState)
 {
     mState = aTargetState;
@@ -220,8 +259,7 @@ void DeviceSubscription::OnDeviceConnectionFailure(const ScopedNodeId & peerId,
 
     // After calling mOnDoneCallback we are indicating that `this` is deleted and we shouldn't do anything else with
     // DeviceSubscription.
-    MoveToState(State::AwaitingDestruction);
-    mOnDoneCallback(mScopedNodeId);
+    NotifyDone();
 }
 
 CHIP_ERROR DeviceSubscription::StartSubscription(OnDoneCallback onDoneCallback, Controller::DeviceController & controller,
@@ -238,6 +276,9 @@ CHIP_ERROR DeviceSubscription::StartSubscription(OnDoneCallback onDoneCallback,
     mCurrentAdministratorCommissioningAttributes.windowStatus =
         Clusters::AdministratorCommissioning::CommissioningWindowStatusEnum::kWindowNotOpen;
 
+    mAttributePaths.clear();
+    mAttributePaths.emplace_back(kRootEndpointId, Clusters::AdministratorCommissioning::Id);
+
     mOnDoneCallback = onDoneCallback;
     MoveToState(State::Connecting);
     CHIP_ERROR err =
@@ -273,8 +314,61 @@ void DeviceSubscription::StopSubscription()
     mClient.reset();
     // After calling mOnDoneCallback we are indicating that `this` is deleted and we shouldn't do anything else with
     // DeviceSubscription.
-    MoveToState(State::AwaitingDestruction);
-    mOnDoneCallback(mScopedNodeId);
+    NotifyDone();
+}
+
+CHIP_ERROR DeviceSubscription::AddListener(DeviceSubscriptionListener & listener, const AttributePathParams & path)
+{
+    assertChipStackLockedByCurrentThread();
+    VerifyOrReturnError(mState == State::Connecting || mState == State::SubscriptionStarted, CHIP_ERROR_INCORRECT_STATE);
+
+    bool subscribed = false;
+    for (const auto & subscribedPath : mAttributePaths)
+    {
+        if (subscribedPath.IsAttributePathSupersetOf(path))
+        {
+            subscribed = true;
+            break;
+        }
+    }
+
+    if (!subscribed)
+    {
+        mAttributePaths.push_back(path);
+        // While connecting, the path is part of the subscription sent once connected.
+        if (mState == State::SubscriptionStarted)
+        {
+            CHIP_ERROR err = SendSubscribeRequest();
+            if (err != CHIP_NO_ERROR)
+            {
+                mAttributePaths.pop_back();
+                return err;
+            }
+        }
+    }
+
+    mListeners.push_back({ &listener, path });
+
+    // Wildcard cluster paths only get the attributes of the next reports.
+    if (!path.HasWildcardClusterId())
+    {
+        mAttributeCache.ForEachAttribute(path.mClusterId, [&](const ConcreteAttributePath & attributePath) {
+            if (path.IsAttributePathSupersetOf(attributePath))
+            {
+                listener.OnAttributeChanged(mScopedNodeId, mAttributeCache, attributePath);
+            }
+            return CHIP_NO_ERROR;
+        });
+    }
+    return CHIP_NO_ERROR;
+}
+
+void DeviceSubscription::RemoveListener(DeviceSubscriptionListener & listener)
+{
+    assertChipStackLockedByCurrentThread();
+    mListeners.erase(std::remove_if(mListeners.begin(), mListeners.end(),
+                                    [&listener](const ListenerEntry & entry) { return entry.listener == &listener; }),
+                     mListeners.end());
 }
 
 } // namespace admin
@@ -64,6 +64,24 @@ CHIP_ERROR DeviceSubscriptionManager::RemoveSubscription(ScopedNodeId scopedNode
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR DeviceSubscriptionManager::AddListener(ScopedNodeId scopedNodeId, DeviceSubscriptionListener & listener,
+                                                  const AttributePathParams & path)
+{
+    assertChipStackLockedByCurrentThread();
+    auto it = mDeviceSubscriptionMap.find(scopedNodeId);
+    VerifyOrReturnError((it != mDeviceSubscriptionMap.end()), CHIP_ERROR_NOT_FOUND);
+    return it->second->AddListener(listener, path);
+}
+
+CHIP_ERROR DeviceSubscriptionManager::RemoveListener(ScopedNodeId scopedNodeId, DeviceSubscriptionListener & listener)
+{
+    assertChipStackLockedByCurrentThread();
+    auto it = mDeviceSubscriptionMap.find(scopedNodeId);
+    VerifyOrReturnError((it != mDeviceSubscriptionMap.end()), CHIP_ERROR_NOT_FOUND);
+    it->second->RemoveListener(listener);
+    return CHIP_NO_ERROR;
+}
+
 void DeviceSubscriptionManager::DeviceSubscriptionTerminated(ScopedNodeId scopedNodeId)
 {
     assertChipStackLockedByCurrentThread();
@@ -16,6 +16,7 @@
  */
 
 #include <ota-provider-common/BdxOtaSender.h>
+#include <ota-provider-common/BdxOtaSenderPool.h>
 
 #include <lib/core/CHIPError.h>
 #include <lib/support/BitFlags.h>
@@ -23,8 +24,10 @@
 #include <messaging/ExchangeContext.h>
 #include <messaging/Flags.h>
 #include <protocols/bdx/BdxTransferSession.h>
+#include <system/SystemClock.h>
 
-#include <fstream>
+#include <algorithm>
+#include <string.h>
 
 using chip::bdx::StatusCode;
 using chip::bdx::TransferControlFlags;
@@ -57,10 +60,17 @@ CHIP_ERROR BdxOtaSender::InitializeTransfer(chip::FabricIndex fabricIndex, chip:
     }
     mFabricIndex.SetValue(fabricIndex);
     mNodeId.SetValue(nodeId);
-    mInitialized = true;
+    mReservationTime = chip::System::SystemClock().GetMonotonicTimestamp();
+    mInitialized     = true;
     return CHIP_NO_ERROR;
 }
 
+bool BdxOtaSender::IsReservedFor(chip::FabricIndex fabricIndex, chip::NodeId nodeId) const
+{
+    return mInitialized && mFabricIndex.HasValue() && mFabricIndex.Value() == fabricIndex && mNodeId.HasValue() &&
+        mNodeId.Value() == nodeId;
+}
+
 void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & event)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -103,6 +113,32 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
         break;
     }
     case TransferSession::OutputEventType::kInitReceived: {
+        // Store the file designator used during block query
+        uint16_t fdl       = 0;
+        const uint8_t * fd = mTransfer.GetFileDesignator(fdl);
+        VerifyOrReturn(fdl < chip::bdx::kMaxFileDesignatorLen,
+                       ChipLogError(BDX, "Cannot store file designator with length = %d", fdl));
+        memcpy(mFileDesignator, fd, fdl);
+        mFileDesignator[fdl] = 0;
+
+        // Blocks are copied from the image mapped in memory rather than read from the file
+        err = (mPool != nullptr) ? mPool->AcquireImage(mFileDesignator, mImage) : CHIP_ERROR_INCORRECT_STATE;
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(BDX, "OTA file open failed: %" CHIP_ERROR_FORMAT, err.Format());
+            mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
+            return;
+        }
+
+        // A requestor resuming an interrupted download asks for the rest of the image only.
+        if (mTransfer.GetStartOffset() > mImage.size())
+        {
+            ChipLogError(BDX, "Start offset is past the end of the OTA file");
+            mTransfer.AbortTransfer(StatusCode::kStartOffsetNotSupported);
+            return;
+        }
+        mStartOffset = static_cast<uint32_t>(mTransfer.GetStartOffset());
+
         // TransferSession will automatically reject a transfer if there are no
         // common supported control modes. It will also default to the smaller
         // block size.
@@ -111,32 +147,25 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
         acceptData.MaxBlockSize = mTransfer.GetTransferBlockSize();
         acceptData.StartOffset  = mTransfer.GetStartOffset();
         acceptData.Length       = mTransfer.GetTransferLength();
-        VerifyOrReturn(mTransfer.AcceptTransfer(acceptData) == CHIP_NO_ERROR,
-                       ChipLogError(BDX, "AcceptTransfer failed: %" CHIP_ERROR_FORMAT, err.Format()));
-
-        // Store the file designator used during block query
-        uint16_t fdl       = 0;
-        const uint8_t * fd = mTransfer.GetFileDesignator(fdl);
-        VerifyOrReturn(fdl < chip::bdx::kMaxFileDesignatorLen,
-                       ChipLogError(BDX, "Cannot store file designator with length = %d", fdl));
-        memcpy(mFileDesignator, fd, fdl);
-        mFileDesignator[fdl] = 0;
+        err                     = mTransfer.AcceptTransfer(acceptData);
+        VerifyOrReturn(err == CHIP_NO_ERROR, ChipLogError(BDX, "AcceptTransfer failed: %" CHIP_ERROR_FORMAT, err.Format()));
 
         break;
     }
     case TransferSession::OutputEventType::kQueryReceived: {
-        TransferSession::BlockData blockData;
         uint16_t blockSize   = mTransfer.GetTransferBlockSize();
-        uint16_t bytesToRead = blockSize;
+        chip::ByteSpan image = mImage.SubSpan(mStartOffset);
+        size_t bytesToRead   = std::min<size_t>(blockSize, image.size() - std::min<size_t>(mNumBytesSent, image.size()));
 
         // TODO: This should be a utility function in TransferSession
-        if (mTransfer.GetTransferLength() > 0 && mNumBytesSent + blockSize > mTransfer.GetTransferLength())
+        if (mTransfer.GetTransferLength() > 0 && mNumBytesSent + bytesToRead > mTransfer.GetTransferLength())
         {
             // cast should be safe because of condition above
-            bytesToRead = static_cast<uint16_t>(mTransfer.GetTransferLength() - mNumBytesSent);
+            bytesToRead = static_cast<size_t>(mTransfer.GetTransferLength() - mNumBytesSent);
         }
 
-        chip::System::PacketBufferHandle blockBuf = chip::System::PacketBufferHandle::New(bytesToRead);
+        // Copy the image straight into the Block message buffer.
+        chip::System::PacketBufferHandle blockBuf = mTransfer.AllocateBlockBuffer();
         if (blockBuf.IsNull())
         {
             // TODO(#13981): AbortTransfer() needs to support GeneralStatusCode failures as well as BDX specific errors.
@@ -144,31 +173,13 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
             return;
         }
 
-        std::ifstream otaFile(mFileDesignator, std::ifstream::in);
-        if (!otaFile.good())
-        {
-            ChipLogError(BDX, "OTA file open failed");
-            mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
-            return;
-        }
-
-        otaFile.seekg(mNumBytesSent);
-        otaFile.read(reinterpret_cast<char *>(blockBuf->Start()), bytesToRead);
-        if (!(otaFile.good() || otaFile.eof()))
-        {
-            ChipLogError(BDX, "OTA file read failed");
-            mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
-            return;
-        }
-
-        blockData.Data   = blockBuf->Start();
-        blockData.Length = static_cast<size_t>(otaFile.gcount());
-        blockData.IsEof  = (blockData.Length < blockSize) ||
-            (mNumBytesSent + static_cast<uint64_t>(blockData.Length) == mTransfer.GetTransferLength() || (otaFile.peek() == EOF));
-        mNumBytesSent = static_cast<uint32_t>(mNumBytesSent + blockData.Length);
-        otaFile.close();
+        memcpy(blockBuf->Start(), image.data() + mNumBytesSent, bytesToRead);
+        blockBuf->SetDataLength(bytesToRead);
+        mNumBytesSent = static_cast<uint32_t>(mNumBytesSent + bytesToRead);
+        bool isEof    = (bytesToRead < blockSize) || (mNumBytesSent == image.size()) ||
+            (mNumBytesSent == mTransfer.GetTransferLength());
 
-        err = mTransfer.PrepareBlock(blockData);
+        err = mTransfer.PrepareBlock(std::move(blockBuf), isEof);
         if (err != CHIP_NO_ERROR)
         {
             ChipLogError(BDX, "PrepareBlock failed: %" CHIP_ERROR_FORMAT, err.Format());
@@ -218,7 +229,14 @@ void BdxOtaSender::Reset()
         mExchangeCtx = nullptr;
     }
 
+    if (mPool != nullptr && !mImage.empty())
+    {
+        mPool->ReleaseImage(mImage);
+    }
+    mImage = chip::ByteSpan();
+
     mInitialized  = false;
     mNumBytesSent = 0;
+    mStartOffset  = 0;
     memset(mFileDesignator, 0, chip::bdx::kMaxFileDesignatorLen);
 }
@@ -15,33 +15,59 @@
  *    limitations under the License.
  */
 
+#include <lib/support/Span.h>
 #include <protocols/bdx/BdxTransferSession.h>
 #include <protocols/bdx/TransferFacilitator.h>
+#include <system/SystemClock.h>
 
 #pragma once
 
+class BdxOtaSenderPool;
+
 class BdxOtaSender : public chip::bdx::Responder
 {
 public:
     BdxOtaSender();
 
+    // Sets the pool that owns this sender and provides the image data. Should be called before any transfer.
+    void SetPool(BdxOtaSenderPool * pool) { mPool = pool; }
+
     // Initializes BDX transfer-related metadata. Should always be called first.
     CHIP_ERROR InitializeTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId);
 
+    // Whether InitializeTransfer() reserved this sender for a transfer that has not ended yet.
+    bool IsReserved() const { return mInitialized; }
+    bool IsReservedFor(chip::FabricIndex fabricIndex, chip::NodeId nodeId) const;
+
+    // Whether the requestor the sender is reserved for has started the BDX transfer.
+    bool HasStarted() const { return mExchangeCtx != nullptr; }
+
+    // Time at which InitializeTransfer() reserved this sender.
+    chip::System::Clock::Timestamp GetReservationTime() const { return mReservationTime; }
+
+    // Ends the transfer, if any, and frees this sender for another one.
+    void Reset();
+
 private:
     // Inherited from bdx::TransferFacilitator
     void HandleTransferSessionOutput(chip::bdx::TransferSession::OutputEvent & event) override;
 
-    void Reset();
-
     // Null-terminated string representing file designator
     char mFileDesignator[chip::bdx::kMaxFileDesignatorLen];
 
     uint32_t mNumBytesSent = 0;
+    uint32_t mStartOffset  = 0; ///< Offset in mImage of the first byte sent
 
     bool mInitialized = false;
 
     chip::Optional<chip::FabricIndex> mFabricIndex;
 
     chip::Optional<chip::NodeId> mNodeId;
+
+    chip::System::Clock::Timestamp mReservationTime;
+
+    BdxOtaSenderPool * mPool = nullptr;
+
+    // Image being sent, shared with the other transfers of the same file, see BdxOtaSenderPool::AcquireImage()
+    chip::ByteSpan mImage;
 };
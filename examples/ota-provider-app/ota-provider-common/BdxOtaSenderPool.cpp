@@ -0,0 +1,145 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <ota-provider-common/BdxOtaSenderPool.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <transport/Session.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using chip::ByteSpan;
+using chip::FabricIndex;
+using chip::NodeId;
+
+BdxOtaSenderPool::BdxOtaSenderPool()
+{
+    for (auto & sender : mSenders)
+    {
+        sender.SetPool(this);
+    }
+}
+
+BdxOtaSender * BdxOtaSenderPool::ReserveSender(FabricIndex fabricIndex, NodeId nodeId,
+                                               chip::System::Clock::Timeout reservationTimeout)
+{
+    const chip::System::Clock::Timestamp now = chip::System::SystemClock().GetMonotonicTimestamp();
+    BdxOtaSender * available                 = nullptr;
+    size_t numReserved                       = 0;
+
+    for (auto & sender : mSenders)
+    {
+        if (sender.IsReservedFor(fabricIndex, nodeId))
+        {
+            // InitializeTransfer() resets the stale transfer of a requestor that queries again.
+            VerifyOrReturnValue(sender.InitializeTransfer(fabricIndex, nodeId) == CHIP_NO_ERROR, nullptr);
+            return &sender;
+        }
+
+        if (sender.IsReserved() && !sender.HasStarted() && now - sender.GetReservationTime() >= reservationTimeout)
+        {
+            ChipLogProgress(BDX, "Reclaiming OTA transfer the requestor did not start");
+            sender.Reset();
+        }
+
+        if (sender.IsReserved())
+        {
+            numReserved++;
+        }
+        else if (available == nullptr)
+        {
+            available = &sender;
+        }
+    }
+
+    VerifyOrReturnValue(available != nullptr && numReserved < mMaxConcurrentTransfers, nullptr);
+    VerifyOrReturnValue(available->InitializeTransfer(fabricIndex, nodeId) == CHIP_NO_ERROR, nullptr);
+    return available;
+}
+
+CHIP_ERROR BdxOtaSenderPool::AcquireImage(const char * filePath, ByteSpan & image)
+{
+    for (auto & mapped : mImages)
+    {
+        if (mapped.filePath == filePath)
+        {
+            mapped.refCount++;
+            image = mapped.data;
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    int fd = open(filePath, O_RDONLY);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_OPEN_FAILED);
+
+    struct stat fileStat;
+    void * data = MAP_FAILED;
+    if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+    {
+        data = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    VerifyOrReturnError(data != MAP_FAILED, CHIP_ERROR_READ_FAILED);
+
+    MappedImage mapped;
+    mapped.filePath = filePath;
+    mapped.data     = ByteSpan(static_cast<const uint8_t *>(data), static_cast<size_t>(fileStat.st_size));
+    mapped.refCount = 1;
+    mImages.push_back(mapped);
+
+    image = mapped.data;
+    return CHIP_NO_ERROR;
+}
+
+void BdxOtaSenderPool::ReleaseImage(const ByteSpan & image)
+{
+    for (auto it = mImages.begin(); it != mImages.end(); ++it)
+    {
+        if (it->data.data() == image.data())
+        {
+            if (--it->refCount == 0)
+            {
+                munmap(const_cast<uint8_t *>(it->data.data()), it->data.size());
+                mImages.erase(it);
+            }
+            return;
+        }
+    }
+}
+
+CHIP_ERROR BdxOtaSenderPool::OnUnsolicitedMessageReceived(const chip::PayloadHeader & payloadHeader,
+                                                          const chip::SessionHandle & session,
+                                                          chip::Messaging::ExchangeDelegate *& newDelegate)
+{
+    const chip::ScopedNodeId peer = session->GetPeer();
+
+    for (auto & sender : mSenders)
+    {
+        if (sender.IsReservedFor(peer.GetFabricIndex(), peer.GetNodeId()) && !sender.HasStarted())
+        {
+            newDelegate = &sender;
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    ChipLogError(BDX, "No OTA transfer reserved for " ChipLogFormatScopedNodeId, ChipLogValueScopedNodeId(peer));
+    return CHIP_ERROR_NOT_FOUND;
+}
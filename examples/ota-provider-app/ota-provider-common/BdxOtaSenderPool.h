@@ -0,0 +1,85 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/NodeId.h>
+#include <lib/support/Span.h>
+#include <messaging/ExchangeDelegate.h>
+#include <ota-provider-common/BdxOtaSender.h>
+#include <system/SystemClock.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+/**
+ * A pool of BdxOtaSender, so that the provider can serve several requestors at the same time.
+ *
+ * A sender is reserved for a requestor when its QueryImage is answered with an image, and serves the BDX transfer this
+ * requestor then starts: the pool is the unsolicited message handler for the BDX protocol, and hands each new exchange to the
+ * sender reserved for its peer. The transfers of the same file share a single read-only memory mapping of it.
+ */
+class BdxOtaSenderPool : public chip::Messaging::UnsolicitedMessageHandler
+{
+public:
+    static constexpr size_t kMaxSenders = 16;
+
+    BdxOtaSenderPool();
+
+    /**
+     * Admission policy: limit the number of transfers reserved at the same time, to at most kMaxSenders.
+     * Requestors beyond the limit are told to query again later.
+     */
+    void SetMaxConcurrentTransfers(size_t maxTransfers) { mMaxConcurrentTransfers = std::min(maxTransfers, kMaxSenders); }
+
+    /**
+     * Reserve a sender for a transfer to the given requestor.
+     *
+     * A requestor that queries again gets its sender back, reset. A sender whose requestor did not start the BDX transfer within
+     * reservationTimeout is reclaimed.
+     *
+     * @return The sender, to be prepared with PrepareForTransfer(), or nullptr if the admission policy makes the requestor wait.
+     */
+    BdxOtaSender * ReserveSender(chip::FabricIndex fabricIndex, chip::NodeId nodeId,
+                                 chip::System::Clock::Timeout reservationTimeout);
+
+    /**
+     * Map the image file into memory, or share the mapping made for another transfer of the same file.
+     * Each successful call must be balanced by a call to ReleaseImage().
+     */
+    CHIP_ERROR AcquireImage(const char * filePath, chip::ByteSpan & image);
+    void ReleaseImage(const chip::ByteSpan & image);
+
+private:
+    // Inherited from UnsolicitedMessageHandler
+    CHIP_ERROR OnUnsolicitedMessageReceived(const chip::PayloadHeader & payloadHeader, const chip::SessionHandle & session,
+                                            chip::Messaging::ExchangeDelegate *& newDelegate) override;
+
+    struct MappedImage
+    {
+        std::string filePath;
+        chip::ByteSpan data;
+        size_t refCount = 0;
+    };
+
+    BdxOtaSender mSenders[kMaxSenders];
+    size_t mMaxConcurrentTransfers = kMaxSenders;
+    std::vector<MappedImage> mImages;
+};
@@ -270,15 +270,18 @@ void OTAProviderExample::SendQueryImageResponse(app::CommandHandler * commandObj
         // Initialize the transfer session in prepartion for a BDX transfer
         BitFlags<TransferControlFlags> bdxFlags;
         bdxFlags.Set(TransferControlFlags::kReceiverDrive);
-        if (mBdxOtaSender.InitializeTransfer(commandObj->GetSubjectDescriptor().fabricIndex,
-                                             commandObj->GetSubjectDescriptor().subject) == CHIP_NO_ERROR)
+        BdxOtaSender * bdxOtaSender = mBdxOtaSenderPool.ReserveSender(commandObj->GetSubjectDescriptor().fabricIndex,
+                                                                      commandObj->GetSubjectDescriptor().subject, kBdxTimeout);
+        if (bdxOtaSender != nullptr)
         {
+            bdxOtaSender->SetLargePayloadMaxBlockSize(CHIP_CONFIG_BDX_LARGE_PAYLOAD_MAX_BLOCK_SIZE);
             CHIP_ERROR error =
-                mBdxOtaSender.PrepareForTransfer(&chip::DeviceLayer::SystemLayer(), chip::bdx::TransferRole::kSender, bdxFlags,
+                bdxOtaSender->PrepareForTransfer(&chip::DeviceLayer::SystemLayer(), chip::bdx::TransferRole::kSender, bdxFlags,
                                                  kMaxBdxBlockSize, kBdxTimeout, chip::System::Clock::Milliseconds32(mPollInterval));
             if (error != CHIP_NO_ERROR)
             {
                 ChipLogError(SoftwareUpdate, "Cannot prepare for transfer: %" CHIP_ERROR_FORMAT, error.Format());
+                bdxOtaSender->Reset();
                 commandObj->AddStatus(commandPath, Status::Failure);
                 return;
             }
@@ -290,7 +293,7 @@ void OTAProviderExample::SendQueryImageResponse(app::CommandHandler * commandObj
         }
         else
         {
-            // Another BDX transfer in progress
+            // As many BDX transfers in progress as the provider serves at the same time
             mQueryImageStatus = OTAQueryStatus::kBusy;
         }
     }
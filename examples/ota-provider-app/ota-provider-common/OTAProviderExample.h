@@ -23,7 +23,7 @@
 #include <app/clusters/ota-provider/OTAProviderUserConsentDelegate.h>
 #include <app/clusters/ota-provider/ota-provider-delegate.h>
 #include <lib/core/OTAImageHeader.h>
-#include <ota-provider-common/BdxOtaSender.h>
+#include <ota-provider-common/BdxOtaSenderPool.h>
 #include <vector>
 
 /**
@@ -69,7 +69,7 @@ public:
     //////////// OTAProviderExample public APIs ///////////////
     void SetOTAFilePath(const char * path);
     void SetImageUri(const char * imageUri);
-    BdxOtaSender * GetBdxOtaSender() { return &mBdxOtaSender; }
+    BdxOtaSenderPool * GetBdxOtaSenderPool() { return &mBdxOtaSenderPool; }
 
     void SetOTACandidates(std::vector<OTAProviderExample::DeviceSoftwareVersionModel> candidates);
     void SetIgnoreQueryImageCount(uint32_t count) { mIgnoreQueryImageCount = count; }
@@ -81,6 +81,7 @@ public:
     }
     void SetDelayedQueryActionTimeSec(uint32_t time) { mDelayedQueryActionTimeSec = time; }
     void SetDelayedApplyActionTimeSec(uint32_t time) { mDelayedApplyActionTimeSec = time; }
+    void SetMaxConcurrentTransfers(size_t maxTransfers) { mBdxOtaSenderPool.SetMaxConcurrentTransfers(maxTransfers); }
     void SetUserConsentDelegate(chip::ota::OTAProviderUserConsentDelegate * delegate) { mUserConsentDelegate = delegate; }
     void SetUserConsentNeeded(bool needed) { mUserConsentNeeded = needed; }
     void SetPollInterval(uint32_t interval)
@@ -108,7 +109,7 @@ private:
     SendQueryImageResponse(chip::app::CommandHandler * commandObj, const chip::app::ConcreteCommandPath & commandPath,
                            const chip::app::Clusters::OtaSoftwareUpdateProvider::Commands::QueryImage::DecodableType & commandData);
 
-    BdxOtaSender mBdxOtaSender;
+    BdxOtaSenderPool mBdxOtaSenderPool;
     std::vector<DeviceSoftwareVersionModel> mCandidates;
     char mOTAFilePath[kFilepathBufLen]; // null-terminated
     char mImageUri[kUriMaxLen];
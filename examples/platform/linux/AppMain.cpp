@@ -119,6 +119,7 @@
 #endif // CHIP_DEVICE_LAYER_TARGET_DARWIN
 
 #if CHIP_DEVICE_LAYER_TARGET_LINUX
+#include <platform/Linux/MappedFactoryDataProvider.h>
 #include <platform/Linux/NetworkCommissioningDriver.h>
 #endif // CHIP_DEVICE_LAYER_TARGET_LINUX
 
@@ -286,6 +287,10 @@ AppMainLoopImplementation * gMainLoopImplementation = nullptr;
 // To hold SPAKE2+ verifier, discriminator, passcode
 LinuxCommissionableDataProvider gCommissionableDataProvider;
 
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+DeviceLayer::MappedFactoryDataProvider gFactoryDataProvider;
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
+
 chip::DeviceLayer::DeviceInfoProviderImpl gExampleDeviceInfoProvider;
 
 void EventHandler(const DeviceLayer::ChipDeviceEvent * event, intptr_t arg)
@@ -424,6 +429,17 @@ int ChipLinuxAppInit(int argc, char * const argv[], OptionSet * customOptions,
     SuccessOrExit(err);
     DeviceLayer::SetCommissionableDataProvider(&gCommissionableDataProvider);
 
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+    if (LinuxDeviceOptions::GetInstance().factoryDataPath != nullptr)
+    {
+        err = gFactoryDataProvider.Init(LinuxDeviceOptions::GetInstance().factoryDataPath);
+        SuccessOrExit(err);
+        DeviceLayer::SetCommissionableDataProvider(&gFactoryDataProvider);
+        DeviceLayer::SetDeviceInstanceInfoProvider(&gFactoryDataProvider);
+        LinuxDeviceOptions::GetInstance().dacProvider = &gFactoryDataProvider;
+    }
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
+
     err = chip::examples::InitConfigurationManager(reinterpret_cast<ConfigurationManagerImpl &>(ConfigurationMgr()),
                                                    LinuxDeviceOptions::GetInstance());
     SuccessOrExit(err);
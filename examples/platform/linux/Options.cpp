@@ -16,6 +16,7 @@
  *    limitations under the License.
  */
 
+#include <ctype.h>
 #include <errno.h>
 #include <stdlib.h>
 #include <string.h>
@@ -35,6 +36,7 @@
 #include <lib/support/SafeInt.h>
 
 #include <credentials/examples/DeviceAttestationCredsExample.h>
+#include <platform/PlatformManager.h>
 
 #if ENABLE_TRACING
 #include <TracingCommandLineArgument.h> // nogncheck
@@ -126,6 +128,15 @@ enum
 #if CHIP_DEVICE_CONFIG_ENABLE_WIFIPAF
     kDeviceOption_WiFi_PAF,
 #endif
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+    kDeviceOption_FactoryData,
+    kDeviceOption_MatterThreadCpus,
+    kDeviceOption_MatterThreadPriority,
+#if CHIP_DEVICE_CONFIG_WITH_GLIB_MAIN_LOOP
+    kDeviceOption_GLibThreadCpus,
+    kDeviceOption_GLibThreadPriority,
+#endif
+#endif
 };
 
 constexpr unsigned kAppUsageLength = 64;
@@ -200,6 +211,15 @@ OptionDef sDeviceOptionDefs[] = {
 #endif
 #if CHIP_WITH_NLFAULTINJECTION
     { "faults", kArgumentRequired, kDeviceOption_FaultInjection },
+#endif
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+    { "factory-data", kArgumentRequired, kDeviceOption_FactoryData },
+    { "matter-thread-cpus", kArgumentRequired, kDeviceOption_MatterThreadCpus },
+    { "matter-thread-priority", kArgumentRequired, kDeviceOption_MatterThreadPriority },
+#if CHIP_DEVICE_CONFIG_WITH_GLIB_MAIN_LOOP
+    { "glib-thread-cpus", kArgumentRequired, kDeviceOption_GLibThreadCpus },
+    { "glib-thread-priority", kArgumentRequired, kDeviceOption_GLibThreadPriority },
+#endif
 #endif
     {}
 };
@@ -362,6 +382,28 @@ const char * sDeviceOptionHelp =
 #if CHIP_WITH_NLFAULTINJECTION
     "  --faults <fault-string,...>\n"
     "       Inject specified fault(s) at runtime.\n"
+#endif
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+    "\n"
+    "  --factory-data <filepath>\n"
+    "       A factory data file providing the attestation credentials, commissionable data and device instance info,\n"
+    "       instead of the ones given by the other options.\n"
+    "\n"
+    "  --matter-thread-cpus <cpu-list>\n"
+    "       Restricts the thread running the Matter event loop to CPUs of the list, e.g. 0,2-3.\n"
+    "\n"
+    "  --matter-thread-priority <fifo:priority|nice:value>\n"
+    "       Runs the thread running the Matter event loop in the SCHED_FIFO policy with the given priority (1 to 99),\n"
+    "       or with the given nice value (-20 to 19).\n"
+#if CHIP_DEVICE_CONFIG_WITH_GLIB_MAIN_LOOP
+    "\n"
+    "  --glib-thread-cpus <cpu-list>\n"
+    "       Restricts the thread running the GLib main loop (BlueZ, D-Bus) to CPUs of the list, e.g. 0,2-3.\n"
+    "\n"
+    "  --glib-thread-priority <fifo:priority|nice:value>\n"
+    "       Runs the thread running the GLib main loop in the SCHED_FIFO policy with the given priority (1 to 99),\n"
+    "       or with the given nice value (-20 to 19).\n"
+#endif
 #endif
     "\n";
 
@@ -414,6 +456,71 @@ bool Base64ArgToVector(const char * arg, size_t maxSize, std::vector<uint8_t> &
     return true;
 }
 
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+DeviceLayer::PlatformManagerImpl::ThreadSchedulingOptions gMatterThreadScheduling;
+#if CHIP_DEVICE_CONFIG_WITH_GLIB_MAIN_LOOP
+DeviceLayer::PlatformManagerImpl::ThreadSchedulingOptions gGLibThreadScheduling;
+#endif
+
+// Parses a list of CPUs, such as "0,2-3", into a CPU affinity mask.
+bool ParseCpuList(const char * arg, uint64_t & mask)
+{
+    mask = 0;
+    while (*arg != '\0')
+    {
+        char * end;
+        VerifyOrReturnValue(isdigit(static_cast<unsigned char>(*arg)), false);
+        unsigned long first = strtoul(arg, &end, 10);
+        unsigned long last  = first;
+        if (*end == '-')
+        {
+            arg = end + 1;
+            VerifyOrReturnValue(isdigit(static_cast<unsigned char>(*arg)), false);
+            last = strtoul(arg, &end, 10);
+        }
+        VerifyOrReturnValue(first <= last && last < 64, false);
+        VerifyOrReturnValue(*end == '\0' || *end == ',', false);
+
+        for (unsigned long cpu = first; cpu <= last; cpu++)
+        {
+            mask |= (1ull << cpu);
+        }
+        arg = (*end == ',') ? end + 1 : end;
+    }
+    return mask != 0;
+}
+
+// Parses a thread priority, either "fifo:<priority>" or "nice:<value>".
+bool ParseThreadPriority(const char * arg, DeviceLayer::PlatformManagerImpl::ThreadSchedulingOptions & options)
+{
+    constexpr char kFifoPrefix[] = "fifo:";
+    constexpr char kNicePrefix[] = "nice:";
+    char * end;
+
+    if (strncmp(arg, kFifoPrefix, strlen(kFifoPrefix)) == 0)
+    {
+        const char * value = arg + strlen(kFifoPrefix);
+        long priority      = strtol(value, &end, 10);
+        VerifyOrReturnValue(end != value && *end == '\0' && priority >= 1 && priority <= 99, false);
+        options.fifoPriority = static_cast<int>(priority);
+        options.niceValue    = 0;
+        return true;
+    }
+
+    if (strncmp(arg, kNicePrefix, strlen(kNicePrefix)) == 0)
+    {
+        const char * value = arg + strlen(kNicePrefix);
+        long niceValue     = strtol(value, &end, 10);
+        VerifyOrReturnValue(end != value && *end == '\0' && niceValue >= -20 && niceValue <= 19, false);
+        options.fifoPriority = 0;
+        options.niceValue    = static_cast<int>(niceValue);
+        return true;
+    }
+
+    return false;
+}
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
+
 bool HandleOption(const char * aProgram, OptionSet * aOptions, int aIdentifier, const char * aName, const char * aValue)
 {
     bool retval = true;
@@ -733,6 +840,36 @@ bool HandleOption(const char * aProgram, OptionSet * aOptions, int aIdentifier,
         LinuxDeviceOptions::GetInstance().mWiFiPAFExtCmds = aValue;
         break;
     }
+#endif
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+    case kDeviceOption_FactoryData:
+        LinuxDeviceOptions::GetInstance().factoryDataPath = aValue;
+        break;
+
+    case kDeviceOption_MatterThreadCpus:
+    case kDeviceOption_MatterThreadPriority:
+        if ((aIdentifier == kDeviceOption_MatterThreadCpus) ? !ParseCpuList(aValue, gMatterThreadScheduling.cpuAffinityMask)
+                                                            : !ParseThreadPriority(aValue, gMatterThreadScheduling))
+        {
+            PrintArgError("%s: Invalid value specified for %s: %s\n", aProgram, aName, aValue);
+            retval = false;
+            break;
+        }
+        DeviceLayer::PlatformMgrImpl().SetEventLoopThreadScheduling(gMatterThreadScheduling);
+        break;
+#if CHIP_DEVICE_CONFIG_WITH_GLIB_MAIN_LOOP
+    case kDeviceOption_GLibThreadCpus:
+    case kDeviceOption_GLibThreadPriority:
+        if ((aIdentifier == kDeviceOption_GLibThreadCpus) ? !ParseCpuList(aValue, gGLibThreadScheduling.cpuAffinityMask)
+                                                          : !ParseThreadPriority(aValue, gGLibThreadScheduling))
+        {
+            PrintArgError("%s: Invalid value specified for %s: %s\n", aProgram, aName, aValue);
+            retval = false;
+            break;
+        }
+        DeviceLayer::PlatformMgrImpl().SetGLibThreadScheduling(gGLibThreadScheduling);
+        break;
+#endif
 #endif
     default:
         PrintArgError("%s: INTERNAL ERROR: Unhandled option: %s\n", aProgram, aName);
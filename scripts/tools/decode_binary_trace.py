@@ -0,0 +1,171 @@
+#!/usr/bin/env -S python3 -B
+
+#
+#    Copyright (c) 2024 Project CHIP Authors
+#    All rights reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+"""Decodes traces of the binary tracing backend (src/tracing/binary).
+
+The input is either the raw serialized trace or a device log/shell output
+containing the hex lines printed by DumpToLog() or the "trace dump" shell
+command.
+"""
+
+import json
+import struct
+import sys
+import typing
+
+import click
+
+MAGIC = b'MTRB'
+HEADER = struct.Struct('<4sBBHI')
+STRING_HEADER = struct.Struct('<HB')
+RECORD = struct.Struct('<IIHHBBHI')
+LOG_LINE_PREFIX = 'btrace\t'
+
+RECORD_TYPES = ['BEGIN', 'END', 'INSTANT', 'COUNTER', 'METRIC_BEGIN', 'METRIC_END', 'METRIC_INSTANT', 'EXCHANGE']
+VALUE_TYPES = ['undefined', 'int32', 'uint32', 'error']
+
+
+class Event(typing.NamedTuple):
+    sequence: int
+    timestamp_us: int
+    label: str
+    group: str
+    type: str
+    value: typing.Optional[typing.Union[int, str]]
+    exchange_id: int
+
+
+def extract_payload(data: bytes) -> bytes:
+    """Returns the serialized trace, extracting it from log lines if needed."""
+    if data.startswith(MAGIC):
+        return data
+
+    payload = bytearray()
+    for line in data.decode('utf-8', errors='replace').splitlines():
+        index = line.find(LOG_LINE_PREFIX)
+        if index >= 0:
+            payload += bytes.fromhex(line[index + len(LOG_LINE_PREFIX):].strip())
+    return bytes(payload)
+
+
+def decode_value(value_type: int, value: int) -> typing.Optional[typing.Union[int, str]]:
+    if value_type >= len(VALUE_TYPES) or VALUE_TYPES[value_type] == 'undefined':
+        return None
+    if VALUE_TYPES[value_type] == 'int32':
+        return struct.unpack('<i', struct.pack('<I', value))[0]
+    if VALUE_TYPES[value_type] == 'error':
+        return f'0x{value:08X}'
+    return value
+
+
+def decode(payload: bytes) -> typing.Tuple[int, typing.List[Event]]:
+    """Returns the number of records ever written and the decoded events."""
+    magic, version, record_size, string_count, records_written = HEADER.unpack_from(payload)
+    if magic != MAGIC or version != 1 or record_size != RECORD.size:
+        raise click.ClickException('Not a binary trace, or an unsupported version of it')
+
+    offset = HEADER.size
+    strings = {0: ''}
+    for _ in range(string_count):
+        string_id, length = STRING_HEADER.unpack_from(payload, offset)
+        offset += STRING_HEADER.size
+        strings[string_id] = payload[offset:offset + length].decode('utf-8', errors='replace')
+        offset += length
+
+    events = []
+    timestamp_base = 0
+    last_timestamp = None
+    for offset in range(offset, len(payload) - RECORD.size + 1, RECORD.size):
+        sequence, timestamp, label_id, group_id, record_type, value_type, exchange_id, value = RECORD.unpack_from(payload, offset)
+
+        # Timestamps are the lower 32 bits of a monotonic clock: unwrap them
+        if last_timestamp is not None and timestamp < last_timestamp:
+            timestamp_base += 1 << 32
+        last_timestamp = timestamp
+
+        events.append(Event(sequence=sequence,
+                            timestamp_us=timestamp_base + timestamp,
+                            label=strings.get(label_id, f'<{label_id}>'),
+                            group=strings.get(group_id, f'<{group_id}>'),
+                            type=RECORD_TYPES[record_type] if record_type < len(RECORD_TYPES) else str(record_type),
+                            value=decode_value(value_type, value),
+                            exchange_id=exchange_id))
+
+    return records_written, events
+
+
+def to_chrome_trace(events: typing.List[Event]) -> typing.Dict:
+    """Converts the events to the Chrome trace event format, viewable in ui.perfetto.dev."""
+    phases = {'BEGIN': 'B', 'END': 'E', 'INSTANT': 'i', 'COUNTER': 'i',
+              'METRIC_BEGIN': 'B', 'METRIC_END': 'E', 'METRIC_INSTANT': 'i'}
+    trace_events = []
+    for event in events:
+        if event.type == 'EXCHANGE':
+            # One track per exchange; stages with a duration become complete events ending at their timestamp
+            trace_event = {'name': event.label, 'cat': 'exchange', 'pid': 1, 'tid': f'{event.exchange_id} {event.group}',
+                           'ph': 'X' if event.value else 'i', 'ts': event.timestamp_us - (event.value or 0)}
+            if event.value:
+                trace_event['dur'] = event.value
+            trace_events.append(trace_event)
+            continue
+
+        trace_event = {'name': event.label, 'cat': event.group or event.type.split('_')[0].lower(),
+                       'ph': phases.get(event.type, 'i'), 'ts': event.timestamp_us, 'pid': 0, 'tid': 0}
+        if event.value is not None:
+            trace_event['args'] = {'value': event.value}
+        trace_events.append(trace_event)
+    return {'traceEvents': trace_events}
+
+
+@click.command()
+@click.argument('input', type=click.File('rb'), default='-')
+@click.option('--output-format', type=click.Choice(['text', 'chrome'], case_sensitive=False), default='text',
+              help='Print events as text or as a Chrome trace event JSON.')
+def main(input, output_format):
+    """Decodes a binary trace read from INPUT (a file or standard input)."""
+    payload = extract_payload(input.read())
+    if not payload:
+        raise click.ClickException('No binary trace found in the input')
+
+    records_written, events = decode(payload)
+
+    if output_format == 'chrome':
+        json.dump(to_chrome_trace(events), sys.stdout, indent=1)
+        return
+
+    expected = events[0].sequence if events else 0
+    for event in events:
+        if event.sequence != expected:
+            click.echo(f'... {event.sequence - expected} events lost ...')
+        expected = event.sequence + 1
+
+        name = f'{event.group}:{event.label}' if event.group else event.label
+        value = f' = {event.value}' if event.value is not None else ''
+        if event.type == 'EXCHANGE':
+            name = f'E:{event.exchange_id}{"i" if event.group == "Initiator" else "r"} {event.label}'
+            value = f' ({event.value} us)' if event.value else ''
+        click.echo(f'{event.timestamp_us / 1000:14.3f} ms  #{event.sequence:<8} {event.type:<15} {name}{value}')
+
+    lost = records_written - len(events)
+    if lost > 0:
+        click.echo(f'{records_written} events recorded, {lost} overwritten or skipped')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,217 @@
+#!/usr/bin/env -S python3 -B
+
+#
+#    Copyright (c) 2024 Project CHIP Authors
+#    All rights reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+"""Decodes the ring buffer of deferred logging (src/lib/support/logging/DeferredLogging.h).
+
+The input is either the raw dump or a device log/shell output containing the
+hex lines printed by chip::Logging::DeferredLog::DumpToLog().  The format
+strings are read from the ELF image the device runs.
+"""
+
+import re
+import struct
+import typing
+
+import click
+from elftools.elf.constants import SH_FLAGS
+from elftools.elf.elffile import ELFFile
+
+MAGIC = b'MTRL'
+HEADER = struct.Struct('<4sBBHIQ')
+RECORD_HEADER = struct.Struct('<IQBBBB')
+LOG_LINE_PREFIX = 'dlog\t'
+ANCHOR = b'MatterDeferredLogAnchor\0'
+FLAG_TRUNCATED = 0x01
+
+# In the order of the LogModule enumeration (src/lib/support/logging/Constants.h).
+MODULE_NAMES = ['-', 'IN', 'BLE', 'ML', 'SM', 'EM', 'TLV', 'ASN', 'CR', 'CTL', 'AL', 'SC', 'BDX', 'DMG', 'DC', 'DD', 'ECH',
+                'FP', 'NP', 'SD', 'SP', 'SWU', 'FS', 'TS', 'HB', 'CSL', 'EVL', 'SPT', 'TOO', 'ZCL', 'SH', 'DL', 'SPL', 'SVR',
+                'DIS', 'IM', 'TST', 'OSS', 'ATM', 'CSM', 'ICD', 'FS']
+CATEGORY_NAMES = {1: 'E', 2: 'P', 3: 'D', 4: 'A'}
+
+# DeferredLogArgument::Type
+ARG_INT32, ARG_UINT32, ARG_INT64, ARG_UINT64, ARG_DOUBLE, ARG_POINTER, ARG_STRING = range(1, 8)
+ARG_FORMATS = {ARG_INT32: '<i', ARG_UINT32: '<I', ARG_INT64: '<q', ARG_UINT64: '<Q', ARG_DOUBLE: '<d', ARG_POINTER: '<Q'}
+
+CONVERSION = re.compile(r'%(?P<flags>[-+ #0]*)(?P<width>\*|\d+)?(?:\.(?P<precision>\*|\d*))?(?:hh|h|ll|l|L|q|j|z|t)?'
+                        r'(?P<conversion>[diouxXeEfFgGcsp%])')
+
+
+class Record(typing.NamedTuple):
+    sequence: int
+    format_address: int
+    module: int
+    category: int
+    truncated: bool
+    args: typing.List[typing.Union[int, float, str]]
+
+
+def extract_payload(data: bytes) -> bytes:
+    """Returns the dump, extracting it from log lines if needed."""
+    if data.startswith(MAGIC):
+        return data
+
+    payload = bytearray()
+    for line in data.decode('utf-8', errors='replace').splitlines():
+        index = line.find(LOG_LINE_PREFIX)
+        if index >= 0:
+            payload += bytes.fromhex(line[index + len(LOG_LINE_PREFIX):].strip())
+    return bytes(payload)
+
+
+def decode_args(data: bytes) -> typing.List[typing.Union[int, float, str]]:
+    args = []
+    offset = 0
+    while offset < len(data):
+        arg_type = data[offset]
+        offset += 1
+        if arg_type == ARG_STRING:
+            length = data[offset]
+            args.append(data[offset + 1:offset + 1 + length].decode('utf-8', errors='replace'))
+            offset += 1 + length
+        elif arg_type in ARG_FORMATS:
+            arg_format = ARG_FORMATS[arg_type]
+            args.append(struct.unpack_from(arg_format, data, offset)[0])
+            offset += struct.calcsize(arg_format)
+        else:
+            raise click.ClickException(f'Unknown argument type {arg_type}')
+    return args
+
+
+def decode(payload: bytes) -> typing.Tuple[int, int, typing.List[Record]]:
+    """Returns the number of records ever written, the runtime address of the anchor and the records."""
+    magic, version, _, _, records_written, anchor = HEADER.unpack_from(payload)
+    if magic != MAGIC or version != 1:
+        raise click.ClickException('Not a deferred log dump, or an unsupported version of it')
+
+    records = []
+    offset = HEADER.size
+    while offset + RECORD_HEADER.size <= len(payload):
+        sequence, format_address, module, category, flags, length = RECORD_HEADER.unpack_from(payload, offset)
+        offset += RECORD_HEADER.size
+        records.append(Record(sequence=sequence, format_address=format_address, module=module, category=category,
+                              truncated=bool(flags & FLAG_TRUNCATED), args=decode_args(payload[offset:offset + length])))
+        offset += length
+
+    return records_written, anchor, records
+
+
+class Image:
+    """Reads the strings of an ELF image at their runtime address."""
+
+    def __init__(self, elf_file: typing.BinaryIO, runtime_anchor: int):
+        self.sections = []
+        elf = ELFFile(elf_file)
+        image_anchor = None
+        for section in elf.iter_sections():
+            if not section['sh_flags'] & SH_FLAGS.SHF_ALLOC or section['sh_type'] == 'SHT_NOBITS':
+                continue
+            data = section.data()
+            self.sections.append((section['sh_addr'], data))
+            index = data.find(ANCHOR)
+            if index >= 0 and image_anchor is None:
+                image_anchor = section['sh_addr'] + index
+
+        if image_anchor is None:
+            raise click.ClickException('The image was not built with deferred logging')
+        self.slide = runtime_anchor - image_anchor
+
+    def string_at(self, runtime_address: int) -> typing.Optional[str]:
+        address = runtime_address - self.slide
+        for start, data in self.sections:
+            if start <= address < start + len(data):
+                end = data.find(b'\0', address - start)
+                return data[address - start:end if end >= 0 else len(data)].decode('utf-8', errors='replace')
+        return None
+
+
+def format_message(fmt: str, args: typing.List[typing.Union[int, float, str]]) -> str:
+    """Formats the arguments the way printf would."""
+    remaining = list(args)
+
+    def next_arg():
+        return remaining.pop(0) if remaining else None
+
+    def convert(match: re.Match) -> str:
+        conversion = match.group('conversion')
+        if conversion == '%':
+            return '%'
+
+        width = match.group('width') or ''
+        if width == '*':
+            width = str(next_arg() or '')
+        precision = match.group('precision')
+        if precision == '*':
+            precision = str(next_arg() or 0)
+
+        value = next_arg()
+        if value is None:
+            return '<missing>'
+
+        spec = '%' + match.group('flags') + width + ('.' + (precision or '0') if precision is not None else '')
+        if conversion == 'p':
+            return '0x%x' % value
+        if conversion in 'ouxX' and isinstance(value, int) and value < 0:
+            # A signed argument printed as unsigned
+            value &= 0xFFFFFFFF if value >= -(1 << 31) else 0xFFFFFFFFFFFFFFFF
+        if conversion == 'u':
+            conversion = 'd'
+        if conversion == 'c' and isinstance(value, int):
+            value = chr(value & 0xFF)
+        if conversion in 'diouxX' and not isinstance(value, int):
+            return str(value)
+        try:
+            return (spec + conversion) % value
+        except (TypeError, ValueError):
+            return str(value)
+
+    return CONVERSION.sub(convert, fmt)
+
+
+@click.command()
+@click.argument('elf', type=click.File('rb'))
+@click.argument('input', type=click.File('rb'), default='-')
+def main(elf, input):
+    """Decodes deferred logs read from INPUT (a file or standard input) using the firmware image ELF."""
+    payload = extract_payload(input.read())
+    if not payload:
+        raise click.ClickException('No deferred log dump found in the input')
+
+    records_written, anchor, records = decode(payload)
+    image = Image(elf, anchor)
+
+    expected = records[0].sequence if records else 0
+    for record in records:
+        if record.sequence != expected:
+            click.echo(f'... {record.sequence - expected} messages lost ...')
+        expected = record.sequence + 1
+
+        fmt = image.string_at(record.format_address)
+        message = format_message(fmt, record.args) if fmt is not None else f'<format at 0x{record.format_address:x}> {record.args}'
+        module = MODULE_NAMES[record.module] if record.module < len(MODULE_NAMES) else str(record.module)
+        category = CATEGORY_NAMES.get(record.category, str(record.category))
+        click.echo(f'#{record.sequence:<8} CHIP:{module}: {category}: {message}{" [truncated]" if record.truncated else ""}')
+
+    lost = records_written - len(records)
+    if lost > 0:
+        click.echo(f'{records_written} messages recorded, {lost} overwritten or skipped')
+
+
+if __name__ == '__main__':
+    main()
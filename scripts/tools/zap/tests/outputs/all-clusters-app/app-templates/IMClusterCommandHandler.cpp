@@ -26,7 +26,9 @@
 #include <app-common/zap-generated/ids/Commands.h>
 #include <app/CommandHandler.h>
 #include <app/InteractionModelEngine.h>
+#include <app/util/CommandDispatchTable.h>
 #include <app/util/util.h>
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/CHIPSafeCasts.h>
 #include <lib/support/TypeTraits.h>
 
@@ -37,6 +39,540 @@ namespace app {
 
 namespace Clusters {
 
+#if CHIP_CONFIG_COMMAND_DISPATCH_TABLE
+
+namespace AdministratorCommissioning {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::OpenCommissioningWindow::Id,
+      DecodeAndDispatchCommand<Commands::OpenCommissioningWindow::DecodableType,
+                               emberAfAdministratorCommissioningClusterOpenCommissioningWindowCallback> },
+    { Commands::OpenBasicCommissioningWindow::Id,
+      DecodeAndDispatchCommand<Commands::OpenBasicCommissioningWindow::DecodableType,
+                               emberAfAdministratorCommissioningClusterOpenBasicCommissioningWindowCallback> },
+    { Commands::RevokeCommissioning::Id,
+      DecodeAndDispatchCommand<Commands::RevokeCommissioning::DecodableType,
+                               emberAfAdministratorCommissioningClusterRevokeCommissioningCallback> },
+});
+
+} // namespace
+} // namespace AdministratorCommissioning
+
+namespace BooleanStateConfiguration {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::SuppressAlarm::Id,
+      DecodeAndDispatchCommand<Commands::SuppressAlarm::DecodableType,
+                               emberAfBooleanStateConfigurationClusterSuppressAlarmCallback> },
+    { Commands::EnableDisableAlarm::Id,
+      DecodeAndDispatchCommand<Commands::EnableDisableAlarm::DecodableType,
+                               emberAfBooleanStateConfigurationClusterEnableDisableAlarmCallback> },
+});
+
+} // namespace
+} // namespace BooleanStateConfiguration
+
+namespace ColorControl {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::MoveToHue::Id,
+      DecodeAndDispatchCommand<Commands::MoveToHue::DecodableType, emberAfColorControlClusterMoveToHueCallback> },
+    { Commands::MoveHue::Id,
+      DecodeAndDispatchCommand<Commands::MoveHue::DecodableType, emberAfColorControlClusterMoveHueCallback> },
+    { Commands::StepHue::Id,
+      DecodeAndDispatchCommand<Commands::StepHue::DecodableType, emberAfColorControlClusterStepHueCallback> },
+    { Commands::MoveToSaturation::Id,
+      DecodeAndDispatchCommand<Commands::MoveToSaturation::DecodableType, emberAfColorControlClusterMoveToSaturationCallback> },
+    { Commands::MoveSaturation::Id,
+      DecodeAndDispatchCommand<Commands::MoveSaturation::DecodableType, emberAfColorControlClusterMoveSaturationCallback> },
+    { Commands::StepSaturation::Id,
+      DecodeAndDispatchCommand<Commands::StepSaturation::DecodableType, emberAfColorControlClusterStepSaturationCallback> },
+    { Commands::MoveToHueAndSaturation::Id,
+      DecodeAndDispatchCommand<Commands::MoveToHueAndSaturation::DecodableType,
+                               emberAfColorControlClusterMoveToHueAndSaturationCallback> },
+    { Commands::MoveToColor::Id,
+      DecodeAndDispatchCommand<Commands::MoveToColor::DecodableType, emberAfColorControlClusterMoveToColorCallback> },
+    { Commands::MoveColor::Id,
+      DecodeAndDispatchCommand<Commands::MoveColor::DecodableType, emberAfColorControlClusterMoveColorCallback> },
+    { Commands::StepColor::Id,
+      DecodeAndDispatchCommand<Commands::StepColor::DecodableType, emberAfColorControlClusterStepColorCallback> },
+    { Commands::MoveToColorTemperature::Id,
+      DecodeAndDispatchCommand<Commands::MoveToColorTemperature::DecodableType,
+                               emberAfColorControlClusterMoveToColorTemperatureCallback> },
+    { Commands::EnhancedMoveToHue::Id,
+      DecodeAndDispatchCommand<Commands::EnhancedMoveToHue::DecodableType, emberAfColorControlClusterEnhancedMoveToHueCallback> },
+    { Commands::EnhancedMoveHue::Id,
+      DecodeAndDispatchCommand<Commands::EnhancedMoveHue::DecodableType, emberAfColorControlClusterEnhancedMoveHueCallback> },
+    { Commands::EnhancedStepHue::Id,
+      DecodeAndDispatchCommand<Commands::EnhancedStepHue::DecodableType, emberAfColorControlClusterEnhancedStepHueCallback> },
+    { Commands::EnhancedMoveToHueAndSaturation::Id,
+      DecodeAndDispatchCommand<Commands::EnhancedMoveToHueAndSaturation::DecodableType,
+                               emberAfColorControlClusterEnhancedMoveToHueAndSaturationCallback> },
+    { Commands::ColorLoopSet::Id,
+      DecodeAndDispatchCommand<Commands::ColorLoopSet::DecodableType, emberAfColorControlClusterColorLoopSetCallback> },
+    { Commands::StopMoveStep::Id,
+      DecodeAndDispatchCommand<Commands::StopMoveStep::DecodableType, emberAfColorControlClusterStopMoveStepCallback> },
+    { Commands::MoveColorTemperature::Id,
+      DecodeAndDispatchCommand<Commands::MoveColorTemperature::DecodableType,
+                               emberAfColorControlClusterMoveColorTemperatureCallback> },
+    { Commands::StepColorTemperature::Id,
+      DecodeAndDispatchCommand<Commands::StepColorTemperature::DecodableType,
+                               emberAfColorControlClusterStepColorTemperatureCallback> },
+});
+
+} // namespace
+} // namespace ColorControl
+
+namespace DiagnosticLogs {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::RetrieveLogsRequest::Id,
+      DecodeAndDispatchCommand<Commands::RetrieveLogsRequest::DecodableType,
+                               emberAfDiagnosticLogsClusterRetrieveLogsRequestCallback> },
+});
+
+} // namespace
+} // namespace DiagnosticLogs
+
+namespace DishwasherAlarm {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::Reset::Id, DecodeAndDispatchCommand<Commands::Reset::DecodableType, emberAfDishwasherAlarmClusterResetCallback> },
+    { Commands::ModifyEnabledAlarms::Id,
+      DecodeAndDispatchCommand<Commands::ModifyEnabledAlarms::DecodableType,
+                               emberAfDishwasherAlarmClusterModifyEnabledAlarmsCallback> },
+});
+
+} // namespace
+} // namespace DishwasherAlarm
+
+namespace EthernetNetworkDiagnostics {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::ResetCounts::Id,
+      DecodeAndDispatchCommand<Commands::ResetCounts::DecodableType, emberAfEthernetNetworkDiagnosticsClusterResetCountsCallback> },
+});
+
+} // namespace
+} // namespace EthernetNetworkDiagnostics
+
+namespace FanControl {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::Step::Id, DecodeAndDispatchCommand<Commands::Step::DecodableType, emberAfFanControlClusterStepCallback> },
+});
+
+} // namespace
+} // namespace FanControl
+
+namespace FaultInjection {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::FailAtFault::Id,
+      DecodeAndDispatchCommand<Commands::FailAtFault::DecodableType, emberAfFaultInjectionClusterFailAtFaultCallback> },
+    { Commands::FailRandomlyAtFault::Id,
+      DecodeAndDispatchCommand<Commands::FailRandomlyAtFault::DecodableType,
+                               emberAfFaultInjectionClusterFailRandomlyAtFaultCallback> },
+});
+
+} // namespace
+} // namespace FaultInjection
+
+namespace GeneralCommissioning {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::ArmFailSafe::Id,
+      DecodeAndDispatchCommand<Commands::ArmFailSafe::DecodableType, emberAfGeneralCommissioningClusterArmFailSafeCallback> },
+    { Commands::SetRegulatoryConfig::Id,
+      DecodeAndDispatchCommand<Commands::SetRegulatoryConfig::DecodableType,
+                               emberAfGeneralCommissioningClusterSetRegulatoryConfigCallback> },
+    { Commands::CommissioningComplete::Id,
+      DecodeAndDispatchCommand<Commands::CommissioningComplete::DecodableType,
+                               emberAfGeneralCommissioningClusterCommissioningCompleteCallback> },
+});
+
+} // namespace
+} // namespace GeneralCommissioning
+
+namespace GeneralDiagnostics {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::TestEventTrigger::Id,
+      DecodeAndDispatchCommand<Commands::TestEventTrigger::DecodableType,
+                               emberAfGeneralDiagnosticsClusterTestEventTriggerCallback> },
+    { Commands::TimeSnapshot::Id,
+      DecodeAndDispatchCommand<Commands::TimeSnapshot::DecodableType, emberAfGeneralDiagnosticsClusterTimeSnapshotCallback> },
+    { Commands::PayloadTestRequest::Id,
+      DecodeAndDispatchCommand<Commands::PayloadTestRequest::DecodableType,
+                               emberAfGeneralDiagnosticsClusterPayloadTestRequestCallback> },
+});
+
+} // namespace
+} // namespace GeneralDiagnostics
+
+namespace GroupKeyManagement {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::KeySetWrite::Id,
+      DecodeAndDispatchCommand<Commands::KeySetWrite::DecodableType, emberAfGroupKeyManagementClusterKeySetWriteCallback> },
+    { Commands::KeySetRead::Id,
+      DecodeAndDispatchCommand<Commands::KeySetRead::DecodableType, emberAfGroupKeyManagementClusterKeySetReadCallback> },
+    { Commands::KeySetRemove::Id,
+      DecodeAndDispatchCommand<Commands::KeySetRemove::DecodableType, emberAfGroupKeyManagementClusterKeySetRemoveCallback> },
+    { Commands::KeySetReadAllIndices::Id,
+      DecodeAndDispatchCommand<Commands::KeySetReadAllIndices::DecodableType,
+                               emberAfGroupKeyManagementClusterKeySetReadAllIndicesCallback> },
+});
+
+} // namespace
+} // namespace GroupKeyManagement
+
+namespace Groups {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::AddGroup::Id, DecodeAndDispatchCommand<Commands::AddGroup::DecodableType, emberAfGroupsClusterAddGroupCallback> },
+    { Commands::ViewGroup::Id,
+      DecodeAndDispatchCommand<Commands::ViewGroup::DecodableType, emberAfGroupsClusterViewGroupCallback> },
+    { Commands::GetGroupMembership::Id,
+      DecodeAndDispatchCommand<Commands::GetGroupMembership::DecodableType, emberAfGroupsClusterGetGroupMembershipCallback> },
+    { Commands::RemoveGroup::Id,
+      DecodeAndDispatchCommand<Commands::RemoveGroup::DecodableType, emberAfGroupsClusterRemoveGroupCallback> },
+    { Commands::RemoveAllGroups::Id,
+      DecodeAndDispatchCommand<Commands::RemoveAllGroups::DecodableType, emberAfGroupsClusterRemoveAllGroupsCallback> },
+    { Commands::AddGroupIfIdentifying::Id,
+      DecodeAndDispatchCommand<Commands::AddGroupIfIdentifying::DecodableType, emberAfGroupsClusterAddGroupIfIdentifyingCallback> },
+});
+
+} // namespace
+} // namespace Groups
+
+namespace Identify {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::Identify::Id, DecodeAndDispatchCommand<Commands::Identify::DecodableType, emberAfIdentifyClusterIdentifyCallback> },
+    { Commands::TriggerEffect::Id,
+      DecodeAndDispatchCommand<Commands::TriggerEffect::DecodableType, emberAfIdentifyClusterTriggerEffectCallback> },
+});
+
+} // namespace
+} // namespace Identify
+
+namespace LevelControl {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::MoveToLevel::Id,
+      DecodeAndDispatchCommand<Commands::MoveToLevel::DecodableType, emberAfLevelControlClusterMoveToLevelCallback> },
+    { Commands::Move::Id, DecodeAndDispatchCommand<Commands::Move::DecodableType, emberAfLevelControlClusterMoveCallback> },
+    { Commands::Step::Id, DecodeAndDispatchCommand<Commands::Step::DecodableType, emberAfLevelControlClusterStepCallback> },
+    { Commands::Stop::Id, DecodeAndDispatchCommand<Commands::Stop::DecodableType, emberAfLevelControlClusterStopCallback> },
+    { Commands::MoveToLevelWithOnOff::Id,
+      DecodeAndDispatchCommand<Commands::MoveToLevelWithOnOff::DecodableType,
+                               emberAfLevelControlClusterMoveToLevelWithOnOffCallback> },
+    { Commands::MoveWithOnOff::Id,
+      DecodeAndDispatchCommand<Commands::MoveWithOnOff::DecodableType, emberAfLevelControlClusterMoveWithOnOffCallback> },
+    { Commands::StepWithOnOff::Id,
+      DecodeAndDispatchCommand<Commands::StepWithOnOff::DecodableType, emberAfLevelControlClusterStepWithOnOffCallback> },
+    { Commands::StopWithOnOff::Id,
+      DecodeAndDispatchCommand<Commands::StopWithOnOff::DecodableType, emberAfLevelControlClusterStopWithOnOffCallback> },
+});
+
+} // namespace
+} // namespace LevelControl
+
+namespace LowPower {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::Sleep::Id, DecodeAndDispatchCommand<Commands::Sleep::DecodableType, emberAfLowPowerClusterSleepCallback> },
+});
+
+} // namespace
+} // namespace LowPower
+
+namespace ModeSelect {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::ChangeToMode::Id,
+      DecodeAndDispatchCommand<Commands::ChangeToMode::DecodableType, emberAfModeSelectClusterChangeToModeCallback> },
+});
+
+} // namespace
+} // namespace ModeSelect
+
+namespace OtaSoftwareUpdateRequestor {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::AnnounceOTAProvider::Id,
+      DecodeAndDispatchCommand<Commands::AnnounceOTAProvider::DecodableType,
+                               emberAfOtaSoftwareUpdateRequestorClusterAnnounceOTAProviderCallback> },
+});
+
+} // namespace
+} // namespace OtaSoftwareUpdateRequestor
+
+namespace OnOff {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::Off::Id, DecodeAndDispatchCommand<Commands::Off::DecodableType, emberAfOnOffClusterOffCallback> },
+    { Commands::On::Id, DecodeAndDispatchCommand<Commands::On::DecodableType, emberAfOnOffClusterOnCallback> },
+    { Commands::Toggle::Id, DecodeAndDispatchCommand<Commands::Toggle::DecodableType, emberAfOnOffClusterToggleCallback> },
+    { Commands::OffWithEffect::Id,
+      DecodeAndDispatchCommand<Commands::OffWithEffect::DecodableType, emberAfOnOffClusterOffWithEffectCallback> },
+    { Commands::OnWithRecallGlobalScene::Id,
+      DecodeAndDispatchCommand<Commands::OnWithRecallGlobalScene::DecodableType,
+                               emberAfOnOffClusterOnWithRecallGlobalSceneCallback> },
+    { Commands::OnWithTimedOff::Id,
+      DecodeAndDispatchCommand<Commands::OnWithTimedOff::DecodableType, emberAfOnOffClusterOnWithTimedOffCallback> },
+});
+
+} // namespace
+} // namespace OnOff
+
+namespace OperationalCredentials {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::AttestationRequest::Id,
+      DecodeAndDispatchCommand<Commands::AttestationRequest::DecodableType,
+                               emberAfOperationalCredentialsClusterAttestationRequestCallback> },
+    { Commands::CertificateChainRequest::Id,
+      DecodeAndDispatchCommand<Commands::CertificateChainRequest::DecodableType,
+                               emberAfOperationalCredentialsClusterCertificateChainRequestCallback> },
+    { Commands::CSRRequest::Id,
+      DecodeAndDispatchCommand<Commands::CSRRequest::DecodableType, emberAfOperationalCredentialsClusterCSRRequestCallback> },
+    { Commands::AddNOC::Id,
+      DecodeAndDispatchCommand<Commands::AddNOC::DecodableType, emberAfOperationalCredentialsClusterAddNOCCallback> },
+    { Commands::UpdateNOC::Id,
+      DecodeAndDispatchCommand<Commands::UpdateNOC::DecodableType, emberAfOperationalCredentialsClusterUpdateNOCCallback> },
+    { Commands::UpdateFabricLabel::Id,
+      DecodeAndDispatchCommand<Commands::UpdateFabricLabel::DecodableType,
+                               emberAfOperationalCredentialsClusterUpdateFabricLabelCallback> },
+    { Commands::RemoveFabric::Id,
+      DecodeAndDispatchCommand<Commands::RemoveFabric::DecodableType, emberAfOperationalCredentialsClusterRemoveFabricCallback> },
+    { Commands::AddTrustedRootCertificate::Id,
+      DecodeAndDispatchCommand<Commands::AddTrustedRootCertificate::DecodableType,
+                               emberAfOperationalCredentialsClusterAddTrustedRootCertificateCallback> },
+});
+
+} // namespace
+} // namespace OperationalCredentials
+
+namespace SmokeCoAlarm {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::SelfTestRequest::Id,
+      DecodeAndDispatchCommand<Commands::SelfTestRequest::DecodableType, emberAfSmokeCoAlarmClusterSelfTestRequestCallback> },
+});
+
+} // namespace
+} // namespace SmokeCoAlarm
+
+namespace SoftwareDiagnostics {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::ResetWatermarks::Id,
+      DecodeAndDispatchCommand<Commands::ResetWatermarks::DecodableType,
+                               emberAfSoftwareDiagnosticsClusterResetWatermarksCallback> },
+});
+
+} // namespace
+} // namespace SoftwareDiagnostics
+
+namespace TemperatureControl {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::SetTemperature::Id,
+      DecodeAndDispatchCommand<Commands::SetTemperature::DecodableType, emberAfTemperatureControlClusterSetTemperatureCallback> },
+});
+
+} // namespace
+} // namespace TemperatureControl
+
+namespace Thermostat {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::SetpointRaiseLower::Id,
+      DecodeAndDispatchCommand<Commands::SetpointRaiseLower::DecodableType, emberAfThermostatClusterSetpointRaiseLowerCallback> },
+    { Commands::SetActiveScheduleRequest::Id,
+      DecodeAndDispatchCommand<Commands::SetActiveScheduleRequest::DecodableType,
+                               emberAfThermostatClusterSetActiveScheduleRequestCallback> },
+    { Commands::SetActivePresetRequest::Id,
+      DecodeAndDispatchCommand<Commands::SetActivePresetRequest::DecodableType,
+                               emberAfThermostatClusterSetActivePresetRequestCallback> },
+    { Commands::AtomicRequest::Id,
+      DecodeAndDispatchCommand<Commands::AtomicRequest::DecodableType, emberAfThermostatClusterAtomicRequestCallback> },
+});
+
+} // namespace
+} // namespace Thermostat
+
+namespace ThreadNetworkDiagnostics {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::ResetCounts::Id,
+      DecodeAndDispatchCommand<Commands::ResetCounts::DecodableType, emberAfThreadNetworkDiagnosticsClusterResetCountsCallback> },
+});
+
+} // namespace
+} // namespace ThreadNetworkDiagnostics
+
+namespace TimeSynchronization {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::SetUTCTime::Id,
+      DecodeAndDispatchCommand<Commands::SetUTCTime::DecodableType, emberAfTimeSynchronizationClusterSetUTCTimeCallback> },
+    { Commands::SetTrustedTimeSource::Id,
+      DecodeAndDispatchCommand<Commands::SetTrustedTimeSource::DecodableType,
+                               emberAfTimeSynchronizationClusterSetTrustedTimeSourceCallback> },
+    { Commands::SetTimeZone::Id,
+      DecodeAndDispatchCommand<Commands::SetTimeZone::DecodableType, emberAfTimeSynchronizationClusterSetTimeZoneCallback> },
+    { Commands::SetDSTOffset::Id,
+      DecodeAndDispatchCommand<Commands::SetDSTOffset::DecodableType, emberAfTimeSynchronizationClusterSetDSTOffsetCallback> },
+    { Commands::SetDefaultNTP::Id,
+      DecodeAndDispatchCommand<Commands::SetDefaultNTP::DecodableType, emberAfTimeSynchronizationClusterSetDefaultNTPCallback> },
+});
+
+} // namespace
+} // namespace TimeSynchronization
+
+namespace UnitTesting {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::Test::Id, DecodeAndDispatchCommand<Commands::Test::DecodableType, emberAfUnitTestingClusterTestCallback> },
+    { Commands::TestNotHandled::Id,
+      DecodeAndDispatchCommand<Commands::TestNotHandled::DecodableType, emberAfUnitTestingClusterTestNotHandledCallback> },
+    { Commands::TestSpecific::Id,
+      DecodeAndDispatchCommand<Commands::TestSpecific::DecodableType, emberAfUnitTestingClusterTestSpecificCallback> },
+    { Commands::TestAddArguments::Id,
+      DecodeAndDispatchCommand<Commands::TestAddArguments::DecodableType, emberAfUnitTestingClusterTestAddArgumentsCallback> },
+    { Commands::TestStructArgumentRequest::Id,
+      DecodeAndDispatchCommand<Commands::TestStructArgumentRequest::DecodableType,
+                               emberAfUnitTestingClusterTestStructArgumentRequestCallback> },
+    { Commands::TestNestedStructArgumentRequest::Id,
+      DecodeAndDispatchCommand<Commands::TestNestedStructArgumentRequest::DecodableType,
+                               emberAfUnitTestingClusterTestNestedStructArgumentRequestCallback> },
+    { Commands::TestListStructArgumentRequest::Id,
+      DecodeAndDispatchCommand<Commands::TestListStructArgumentRequest::DecodableType,
+                               emberAfUnitTestingClusterTestListStructArgumentRequestCallback> },
+    { Commands::TestListInt8UArgumentRequest::Id,
+      DecodeAndDispatchCommand<Commands::TestListInt8UArgumentRequest::DecodableType,
+                               emberAfUnitTestingClusterTestListInt8UArgumentRequestCallback> },
+    { Commands::TestNestedStructListArgumentRequest::Id,
+      DecodeAndDispatchCommand<Commands::TestNestedStructListArgumentRequest::DecodableType,
+                               emberAfUnitTestingClusterTestNestedStructListArgumentRequestCallback> },
+    { Commands::TestListNestedStructListArgumentRequest::Id,
+      DecodeAndDispatchCommand<Commands::TestListNestedStructListArgumentRequest::DecodableType,
+                               emberAfUnitTestingClusterTestListNestedStructListArgumentRequestCallback> },
+    { Commands::TestListInt8UReverseRequest::Id,
+      DecodeAndDispatchCommand<Commands::TestListInt8UReverseRequest::DecodableType,
+                               emberAfUnitTestingClusterTestListInt8UReverseRequestCallback> },
+    { Commands::TestEnumsRequest::Id,
+      DecodeAndDispatchCommand<Commands::TestEnumsRequest::DecodableType, emberAfUnitTestingClusterTestEnumsRequestCallback> },
+    { Commands::TestNullableOptionalRequest::Id,
+      DecodeAndDispatchCommand<Commands::TestNullableOptionalRequest::DecodableType,
+                               emberAfUnitTestingClusterTestNullableOptionalRequestCallback> },
+    { Commands::SimpleStructEchoRequest::Id,
+      DecodeAndDispatchCommand<Commands::SimpleStructEchoRequest::DecodableType,
+                               emberAfUnitTestingClusterSimpleStructEchoRequestCallback> },
+    { Commands::TimedInvokeRequest::Id,
+      DecodeAndDispatchCommand<Commands::TimedInvokeRequest::DecodableType, emberAfUnitTestingClusterTimedInvokeRequestCallback> },
+    { Commands::TestSimpleOptionalArgumentRequest::Id,
+      DecodeAndDispatchCommand<Commands::TestSimpleOptionalArgumentRequest::DecodableType,
+                               emberAfUnitTestingClusterTestSimpleOptionalArgumentRequestCallback> },
+    { Commands::TestEmitTestEventRequest::Id,
+      DecodeAndDispatchCommand<Commands::TestEmitTestEventRequest::DecodableType,
+                               emberAfUnitTestingClusterTestEmitTestEventRequestCallback> },
+    { Commands::TestEmitTestFabricScopedEventRequest::Id,
+      DecodeAndDispatchCommand<Commands::TestEmitTestFabricScopedEventRequest::DecodableType,
+                               emberAfUnitTestingClusterTestEmitTestFabricScopedEventRequestCallback> },
+    { Commands::TestBatchHelperRequest::Id,
+      DecodeAndDispatchCommand<Commands::TestBatchHelperRequest::DecodableType,
+                               emberAfUnitTestingClusterTestBatchHelperRequestCallback> },
+    { Commands::TestSecondBatchHelperRequest::Id,
+      DecodeAndDispatchCommand<Commands::TestSecondBatchHelperRequest::DecodableType,
+                               emberAfUnitTestingClusterTestSecondBatchHelperRequestCallback> },
+    { Commands::TestDifferentVendorMeiRequest::Id,
+      DecodeAndDispatchCommand<Commands::TestDifferentVendorMeiRequest::DecodableType,
+                               emberAfUnitTestingClusterTestDifferentVendorMeiRequestCallback> },
+});
+
+} // namespace
+} // namespace UnitTesting
+
+namespace ValveConfigurationAndControl {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::Open::Id,
+      DecodeAndDispatchCommand<Commands::Open::DecodableType, emberAfValveConfigurationAndControlClusterOpenCallback> },
+    { Commands::Close::Id,
+      DecodeAndDispatchCommand<Commands::Close::DecodableType, emberAfValveConfigurationAndControlClusterCloseCallback> },
+});
+
+} // namespace
+} // namespace ValveConfigurationAndControl
+
+namespace WiFiNetworkDiagnostics {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::ResetCounts::Id,
+      DecodeAndDispatchCommand<Commands::ResetCounts::DecodableType, emberAfWiFiNetworkDiagnosticsClusterResetCountsCallback> },
+});
+
+} // namespace
+} // namespace WiFiNetworkDiagnostics
+
+namespace WindowCovering {
+namespace {
+
+constexpr auto kCommands = SortedById<CommandDispatchEntry>({
+    { Commands::UpOrOpen::Id,
+      DecodeAndDispatchCommand<Commands::UpOrOpen::DecodableType, emberAfWindowCoveringClusterUpOrOpenCallback> },
+    { Commands::DownOrClose::Id,
+      DecodeAndDispatchCommand<Commands::DownOrClose::DecodableType, emberAfWindowCoveringClusterDownOrCloseCallback> },
+    { Commands::StopMotion::Id,
+      DecodeAndDispatchCommand<Commands::StopMotion::DecodableType, emberAfWindowCoveringClusterStopMotionCallback> },
+    { Commands::GoToLiftValue::Id,
+      DecodeAndDispatchCommand<Commands::GoToLiftValue::DecodableType, emberAfWindowCoveringClusterGoToLiftValueCallback> },
+    { Commands::GoToLiftPercentage::Id,
+      DecodeAndDispatchCommand<Commands::GoToLiftPercentage::DecodableType,
+                               emberAfWindowCoveringClusterGoToLiftPercentageCallback> },
+    { Commands::GoToTiltValue::Id,
+      DecodeAndDispatchCommand<Commands::GoToTiltValue::DecodableType, emberAfWindowCoveringClusterGoToTiltValueCallback> },
+    { Commands::GoToTiltPercentage::Id,
+      DecodeAndDispatchCommand<Commands::GoToTiltPercentage::DecodableType,
+                               emberAfWindowCoveringClusterGoToTiltPercentageCallback> },
+});
+
+} // namespace
+} // namespace WindowCovering
+
+#else
 namespace AdministratorCommissioning {
 
 void DispatchServerCommand(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aDataTlv)
@@ -1928,8 +2464,80 @@ void DispatchServerCommand(CommandHandler * apCommandObj, const ConcreteCommandP
 
 } // namespace WindowCovering
 
+#endif // CHIP_CONFIG_COMMAND_DISPATCH_TABLE
+
 } // namespace Clusters
 
+#if CHIP_CONFIG_COMMAND_DISPATCH_TABLE
+
+namespace {
+
+constexpr auto kClusters = SortedById<ClusterDispatchEntry>({
+    { Clusters::AdministratorCommissioning::Id, Span<const CommandDispatchEntry>(Clusters::AdministratorCommissioning::kCommands) },
+    { Clusters::BooleanStateConfiguration::Id, Span<const CommandDispatchEntry>(Clusters::BooleanStateConfiguration::kCommands) },
+    { Clusters::ColorControl::Id, Span<const CommandDispatchEntry>(Clusters::ColorControl::kCommands) },
+    { Clusters::DiagnosticLogs::Id, Span<const CommandDispatchEntry>(Clusters::DiagnosticLogs::kCommands) },
+    { Clusters::DishwasherAlarm::Id, Span<const CommandDispatchEntry>(Clusters::DishwasherAlarm::kCommands) },
+    { Clusters::EthernetNetworkDiagnostics::Id, Span<const CommandDispatchEntry>(Clusters::EthernetNetworkDiagnostics::kCommands) },
+    { Clusters::FanControl::Id, Span<const CommandDispatchEntry>(Clusters::FanControl::kCommands) },
+    { Clusters::FaultInjection::Id, Span<const CommandDispatchEntry>(Clusters::FaultInjection::kCommands) },
+    { Clusters::GeneralCommissioning::Id, Span<const CommandDispatchEntry>(Clusters::GeneralCommissioning::kCommands) },
+    { Clusters::GeneralDiagnostics::Id, Span<const CommandDispatchEntry>(Clusters::GeneralDiagnostics::kCommands) },
+    { Clusters::GroupKeyManagement::Id, Span<const CommandDispatchEntry>(Clusters::GroupKeyManagement::kCommands) },
+    { Clusters::Groups::Id, Span<const CommandDispatchEntry>(Clusters::Groups::kCommands) },
+    { Clusters::Identify::Id, Span<const CommandDispatchEntry>(Clusters::Identify::kCommands) },
+    { Clusters::LevelControl::Id, Span<const CommandDispatchEntry>(Clusters::LevelControl::kCommands) },
+    { Clusters::LowPower::Id, Span<const CommandDispatchEntry>(Clusters::LowPower::kCommands) },
+    { Clusters::ModeSelect::Id, Span<const CommandDispatchEntry>(Clusters::ModeSelect::kCommands) },
+    { Clusters::OtaSoftwareUpdateRequestor::Id, Span<const CommandDispatchEntry>(Clusters::OtaSoftwareUpdateRequestor::kCommands) },
+    { Clusters::OnOff::Id, Span<const CommandDispatchEntry>(Clusters::OnOff::kCommands) },
+    { Clusters::OperationalCredentials::Id, Span<const CommandDispatchEntry>(Clusters::OperationalCredentials::kCommands) },
+    { Clusters::SmokeCoAlarm::Id, Span<const CommandDispatchEntry>(Clusters::SmokeCoAlarm::kCommands) },
+    { Clusters::SoftwareDiagnostics::Id, Span<const CommandDispatchEntry>(Clusters::SoftwareDiagnostics::kCommands) },
+    { Clusters::TemperatureControl::Id, Span<const CommandDispatchEntry>(Clusters::TemperatureControl::kCommands) },
+    { Clusters::Thermostat::Id, Span<const CommandDispatchEntry>(Clusters::Thermostat::kCommands) },
+    { Clusters::ThreadNetworkDiagnostics::Id, Span<const CommandDispatchEntry>(Clusters::ThreadNetworkDiagnostics::kCommands) },
+    { Clusters::TimeSynchronization::Id, Span<const CommandDispatchEntry>(Clusters::TimeSynchronization::kCommands) },
+    { Clusters::UnitTesting::Id, Span<const CommandDispatchEntry>(Clusters::UnitTesting::kCommands) },
+    { Clusters::ValveConfigurationAndControl::Id,
+      Span<const CommandDispatchEntry>(Clusters::ValveConfigurationAndControl::kCommands) },
+    { Clusters::WiFiNetworkDiagnostics::Id, Span<const CommandDispatchEntry>(Clusters::WiFiNetworkDiagnostics::kCommands) },
+    { Clusters::WindowCovering::Id, Span<const CommandDispatchEntry>(Clusters::WindowCovering::kCommands) },
+});
+
+} // namespace
+
+void DispatchSingleClusterCommand(const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aReader, CommandHandler * apCommandObj)
+{
+    const ClusterDispatchEntry * cluster = FindById(Span<const ClusterDispatchEntry>(kClusters), aCommandPath.mClusterId);
+    if (cluster == nullptr)
+    {
+        ChipLogError(Zcl, "Unknown cluster " ChipLogFormatMEI, ChipLogValueMEI(aCommandPath.mClusterId));
+        apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::UnsupportedCluster);
+        return;
+    }
+
+    const CommandDispatchEntry * command = FindById(cluster->commands, aCommandPath.mCommandId);
+    if (command == nullptr)
+    {
+        // Unrecognized command ID, error status will apply.
+        apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::UnsupportedCommand);
+        ChipLogError(Zcl, "Unknown command " ChipLogFormatMEI " for cluster " ChipLogFormatMEI,
+                     ChipLogValueMEI(aCommandPath.mCommandId), ChipLogValueMEI(aCommandPath.mClusterId));
+        return;
+    }
+
+    bool wasHandled     = false;
+    CHIP_ERROR TLVError = command->dispatch(apCommandObj, aCommandPath, aReader, wasHandled);
+    if (CHIP_NO_ERROR != TLVError || !wasHandled)
+    {
+        apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::InvalidCommand);
+        ChipLogProgress(Zcl, "Failed to dispatch command, TLVError=%" CHIP_ERROR_FORMAT, TLVError.Format());
+    }
+}
+
+#else
+
 void DispatchSingleClusterCommand(const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aReader, CommandHandler * apCommandObj)
 {
     switch (aCommandPath.mClusterId)
@@ -2028,5 +2636,7 @@ void DispatchSingleClusterCommand(const ConcreteCommandPath & aCommandPath, TLV:
     }
 }
 
+#endif // CHIP_CONFIG_COMMAND_DISPATCH_TABLE
+
 } // namespace app
 } // namespace chip
@@ -207,6 +207,10 @@ CHIP_ERROR AccessControl::Init(AccessControl::Delegate * delegate, DeviceTypeRes
     {
         mDelegate           = delegate;
         mDeviceTypeResolver = &deviceTypeResolver;
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+        mDecisionCache.Clear();
+        AddEntryListener(mDecisionCache);
+#endif
     }
 
     return retval;
@@ -218,6 +222,9 @@ void AccessControl::Finish()
     ChipLogProgress(DataManagement, "AccessControl: finishing");
     mDelegate->Finish();
     mDelegate = nullptr;
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    RemoveEntryListener(mDecisionCache);
+#endif
 }
 
 CHIP_ERROR AccessControl::CreateEntry(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t * index,
@@ -398,8 +405,39 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
         return CHIP_NO_ERROR;
     }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    CHIP_ERROR result = CHIP_NO_ERROR;
+    if (mDecisionCache.Lookup(subjectDescriptor, requestPath, requestPrivilege, result))
+    {
+#if CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+        ChipLogProgress(DataManagement, "AccessControl: %s (cached)", (result == CHIP_NO_ERROR) ? "allowed" : "denied");
+#else
+        if (result != CHIP_NO_ERROR)
+        {
+            ChipLogProgress(DataManagement, "AccessControl: denied (cached)");
+        }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+        return result;
+    }
+
+    bool dependsOnDeviceTypes = false;
+    result                    = CheckEntries(subjectDescriptor, requestPath, requestPrivilege, dependsOnDeviceTypes);
+    if (!dependsOnDeviceTypes && (result == CHIP_NO_ERROR || result == CHIP_ERROR_ACCESS_DENIED))
+    {
+        mDecisionCache.Store(subjectDescriptor, requestPath, requestPrivilege, result);
+    }
+    return result;
+#else
+    bool dependsOnDeviceTypes = false;
+    return CheckEntries(subjectDescriptor, requestPath, requestPrivilege, dependsOnDeviceTypes);
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+}
+
+CHIP_ERROR AccessControl::CheckEntries(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                       Privilege requestPrivilege, bool & dependsOnDeviceTypes)
+{
     EntryIterator iterator;
-    ReturnErrorOnFailure(Entries(iterator, &subjectDescriptor.fabricIndex));
+    ReturnErrorOnFailure(mDelegate->EntriesForSubject(iterator, subjectDescriptor));
 
     Entry entry;
     while (iterator.Next(entry) == CHIP_NO_ERROR)
@@ -485,10 +523,13 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
                 {
                     continue;
                 }
-                if (target.flags & Entry::Target::kDeviceType &&
-                    !mDeviceTypeResolver->IsDeviceTypeOnEndpoint(target.deviceType, requestPath.endpoint))
+                if (target.flags & Entry::Target::kDeviceType)
                 {
-                    continue;
+                    dependsOnDeviceTypes = true;
+                    if (!mDeviceTypeResolver->IsDeviceTypeOnEndpoint(target.deviceType, requestPath.endpoint))
+                    {
+                        continue;
+                    }
                 }
                 targetMatched = true;
                 break;
@@ -512,6 +553,65 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
     return CHIP_ERROR_ACCESS_DENIED;
 }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+bool AccessControl::DecisionCache::Decision::Matches(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                                     Privilege requestPrivilege) const
+{
+    return cluster == requestPath.cluster && endpoint == requestPath.endpoint && privilege == requestPrivilege &&
+        subject == subjectDescriptor.subject && fabricIndex == subjectDescriptor.fabricIndex &&
+        authMode == subjectDescriptor.authMode && cats == subjectDescriptor.cats;
+}
+
+bool AccessControl::DecisionCache::Lookup(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                          Privilege requestPrivilege, CHIP_ERROR & result)
+{
+    VerifyOrReturnValue(mCount > 0, false);
+
+    size_t index = mLastHit;
+    if (!mDecisions[index].Matches(subjectDescriptor, requestPath, requestPrivilege))
+    {
+        for (index = 0; index < mCount; index++)
+        {
+            if (mDecisions[index].Matches(subjectDescriptor, requestPath, requestPrivilege))
+            {
+                break;
+            }
+        }
+        VerifyOrReturnValue(index < mCount, false);
+        mLastHit = index;
+    }
+
+    result = mDecisions[index].allowed ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+    return true;
+}
+
+void AccessControl::DecisionCache::Store(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                         Privilege requestPrivilege, CHIP_ERROR result)
+{
+    size_t index;
+    if (mCount < ArraySize(mDecisions))
+    {
+        index = mCount++;
+    }
+    else
+    {
+        index = mNext;
+        mNext = (mNext + 1) % ArraySize(mDecisions);
+    }
+
+    Decision & decision  = mDecisions[index];
+    decision.fabricIndex = subjectDescriptor.fabricIndex;
+    decision.authMode    = subjectDescriptor.authMode;
+    decision.subject     = subjectDescriptor.subject;
+    decision.cats        = subjectDescriptor.cats;
+    decision.endpoint    = requestPath.endpoint;
+    decision.cluster     = requestPath.cluster;
+    decision.privilege   = requestPrivilege;
+    decision.allowed     = (result == CHIP_NO_ERROR);
+    mLastHit             = index;
+}
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
 CHIP_ERROR AccessControl::CheckARL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
                                    Privilege requestPrivilege)
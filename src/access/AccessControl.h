@@ -393,6 +393,14 @@ public:
         // Iteration
         virtual CHIP_ERROR Entries(EntryIterator & iterator, const FabricIndex * fabricIndex) const { return CHIP_NO_ERROR; }
 
+        // Iteration over the entries that can apply to a subject, used by the default check algorithm: at least the
+        // entries of its fabric and auth mode whose subjects can match it, in any order.  Defaults to all the entries
+        // of its fabric.
+        virtual CHIP_ERROR EntriesForSubject(EntryIterator & iterator, const SubjectDescriptor & subjectDescriptor) const
+        {
+            return Entries(iterator, &subjectDescriptor.fabricIndex);
+        }
+
         // Check
         // Return CHIP_NO_ERROR if allowed, CHIP_ERROR_ACCESS_DENIED if denied,
         // CHIP_ERROR_NOT_IMPLEMENTED to use the default check algorithm (against entries),
@@ -503,6 +511,7 @@ public:
     {
         VerifyOrReturnError(IsValid(entry), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        ClearDecisionCache();
         return mDelegate->CreateEntry(index, entry, fabricIndex);
     }
 
@@ -553,6 +562,7 @@ public:
     {
         VerifyOrReturnError(IsValid(entry), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        ClearDecisionCache();
         return mDelegate->UpdateEntry(index, entry, fabricIndex);
     }
 
@@ -574,6 +584,7 @@ public:
     CHIP_ERROR DeleteEntry(size_t index, const FabricIndex * fabricIndex = nullptr)
     {
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        ClearDecisionCache();
         return mDelegate->DeleteEntry(index, fabricIndex);
     }
 
@@ -656,6 +667,9 @@ public:
      *
      * If an AccessRestrictionProvider object is set, it will be checked for additional access restrictions.
      *
+     * The decisions of the access control entries are cached, see CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE, until
+     * the entries change.  The delegate is still asked first for every check.
+     *
      * @retval #CHIP_ERROR_ACCESS_DENIED if denied.
      * @retval other errors should also be treated as denied.
      * @retval #CHIP_NO_ERROR if allowed.
@@ -667,8 +681,58 @@ public:
 #endif
 
 private:
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    /**
+     * Recent decisions of the access control entries, by subject, endpoint, cluster and privilege.  The paths of a read
+     * come cluster by cluster, so the last decision is tried first.  Cleared by any change of the entries.
+     */
+    class DecisionCache : public EntryListener
+    {
+    public:
+        bool Lookup(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege,
+                    CHIP_ERROR & result);
+        void Store(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege,
+                   CHIP_ERROR result);
+        void Clear() { mCount = 0; }
+
+        void OnEntryChanged(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t index, const Entry * entry,
+                            ChangeType changeType) override
+        {
+            Clear();
+        }
+
+    private:
+        struct Decision
+        {
+            FabricIndex fabricIndex;
+            AuthMode authMode;
+            NodeId subject;
+            CATValues cats;
+            EndpointId endpoint;
+            ClusterId cluster;
+            Privilege privilege;
+            bool allowed;
+
+            bool Matches(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                         Privilege requestPrivilege) const;
+        };
+
+        Decision mDecisions[CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE];
+        size_t mCount   = 0;
+        size_t mNext    = 0; ///< Slot replaced by the next decision stored, once the cache is full
+        size_t mLastHit = 0;
+    };
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+
     bool IsInitialized() const { return (mDelegate != nullptr); }
 
+    void ClearDecisionCache()
+    {
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+        mDecisionCache.Clear();
+#endif
+    }
+
     bool IsValid(const Entry & entry);
 
     void NotifyEntryChanged(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t index, const Entry * entry,
@@ -680,6 +744,13 @@ private:
      */
     CHIP_ERROR CheckACL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege);
 
+    /**
+     * Check the ACL entries, for CheckACL.  Sets dependsOnDeviceTypes if an entry targeting a device type had to be
+     * evaluated, as the decision then also depends on the composition of the node.
+     */
+    CHIP_ERROR CheckEntries(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                            Privilege requestPrivilege, bool & dependsOnDeviceTypes);
+
     /**
      * Check CommissioningARL or ARL (as appropriate) for whether access (by a
      * subject descriptor, to a request path, requiring a privilege) should
@@ -694,6 +765,10 @@ private:
 
     EntryListener * mEntryListener = nullptr;
 
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    DecisionCache mDecisionCache;
+#endif
+
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
     AccessRestrictionProvider * mAccessRestrictionProvider;
 #endif
@@ -26,6 +26,37 @@ using namespace chip::Platform;
 namespace chip {
 namespace Access {
 
+namespace {
+
+constexpr uint8_t TypeBit(AccessRestrictionProvider::Type type)
+{
+    return static_cast<uint8_t>(1u << to_underlying(type));
+}
+
+// Restriction types denying a request, as a bitmask of TypeBit.
+uint8_t RestrictingTypes(const RequestPath & requestPath)
+{
+    using Type = AccessRestrictionProvider::Type;
+
+    switch (requestPath.requestType)
+    {
+    case RequestType::kAttributeReadRequest:
+        return IsGlobalAttribute(requestPath.entityId.value()) ? 0 : TypeBit(Type::kAttributeAccessForbidden);
+    case RequestType::kAttributeWriteRequest:
+        return IsGlobalAttribute(requestPath.entityId.value())
+            ? 0
+            : static_cast<uint8_t>(TypeBit(Type::kAttributeAccessForbidden) | TypeBit(Type::kAttributeWriteForbidden));
+    case RequestType::kCommandInvokeRequest:
+        return TypeBit(Type::kCommandForbidden);
+    case RequestType::kEventReadRequest:
+        return TypeBit(Type::kEventForbidden);
+    default:
+        return 0;
+    }
+}
+
+} // namespace
+
 void AccessRestrictionProvider::AddListener(Listener & listener)
 {
     if (mListeners == nullptr)
@@ -83,6 +114,7 @@ CHIP_ERROR AccessRestrictionProvider::SetCommissioningEntries(const std::vector<
     }
 
     mCommissioningEntries = entries;
+    IndexEntries(true, kUndefinedFabricIndex, mCommissioningEntries);
 
     for (Listener * listener = mListeners; listener != nullptr; listener = listener->mNext)
     {
@@ -110,6 +142,7 @@ CHIP_ERROR AccessRestrictionProvider::SetEntries(const FabricIndex fabricIndex,
     }
 
     mFabricEntries[fabricIndex] = std::move(updatedEntries);
+    IndexEntries(false, fabricIndex, mFabricEntries[fabricIndex]);
 
     for (Listener * listener = mListeners; listener != nullptr; listener = listener->mNext)
     {
@@ -132,19 +165,45 @@ bool AccessRestrictionProvider::StandardAccessRestrictionExceptionChecker::AreRe
     return false;
 }
 
-CHIP_ERROR AccessRestrictionProvider::CheckForCommissioning(const SubjectDescriptor & subjectDescriptor,
-                                                            const RequestPath & requestPath)
+void AccessRestrictionProvider::IndexEntries(bool commissioning, FabricIndex fabricIndex, const std::vector<Entry> & entries)
+{
+    auto begin = mRestrictionIndex.lower_bound(IndexKey(commissioning, fabricIndex, 0, 0));
+    auto end   = begin;
+    while (end != mRestrictionIndex.end() && std::get<0>(end->first) == commissioning && std::get<1>(end->first) == fabricIndex)
+    {
+        ++end;
+    }
+    mRestrictionIndex.erase(begin, end);
+
+    for (auto & entry : entries)
+    {
+        auto & clusterRestrictions = mRestrictionIndex[IndexKey(commissioning, fabricIndex, entry.endpointNumber, entry.clusterId)];
+        for (auto & restriction : entry.restrictions)
+        {
+            if (restriction.id.HasValue())
+            {
+                clusterRestrictions.idTypes |= TypeBit(restriction.restrictionType);
+                clusterRestrictions.idRestrictions.push_back(restriction);
+            }
+            else
+            {
+                clusterRestrictions.wildcardTypes |= TypeBit(restriction.restrictionType);
+            }
+        }
+    }
+}
+
+CHIP_ERROR AccessRestrictionProvider::CheckForCommissioning(const SubjectDescriptor &, const RequestPath & requestPath)
 {
-    return DoCheck(mCommissioningEntries, subjectDescriptor, requestPath);
+    return DoCheck(true, kUndefinedFabricIndex, requestPath);
 }
 
 CHIP_ERROR AccessRestrictionProvider::Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath)
 {
-    return DoCheck(mFabricEntries[subjectDescriptor.fabricIndex], subjectDescriptor, requestPath);
+    return DoCheck(false, subjectDescriptor.fabricIndex, requestPath);
 }
 
-CHIP_ERROR AccessRestrictionProvider::DoCheck(const std::vector<Entry> & entries, const SubjectDescriptor & subjectDescriptor,
-                                              const RequestPath & requestPath)
+CHIP_ERROR AccessRestrictionProvider::DoCheck(bool commissioning, FabricIndex fabricIndex, const RequestPath & requestPath)
 {
     if (!mExceptionChecker.AreRestrictionsAllowed(requestPath.endpoint, requestPath.cluster))
     {
@@ -175,56 +234,29 @@ CHIP_ERROR AccessRestrictionProvider::DoCheck(const std::vector<Entry> & entries
         }
     }
 
-    for (auto & entry : entries)
+    auto it = mRestrictionIndex.find(IndexKey(commissioning, fabricIndex, requestPath.endpoint, requestPath.cluster));
+    if (it == mRestrictionIndex.end())
     {
-        if (entry.endpointNumber != requestPath.endpoint || entry.clusterId != requestPath.cluster)
-        {
-            continue;
-        }
+        return CHIP_NO_ERROR;
+    }
 
-        for (auto & restriction : entry.restrictions)
-        {
-            // A missing id is a wildcard
-            bool idMatch = !restriction.id.HasValue() || restriction.id.Value() == requestPath.entityId.value();
-            if (!idMatch)
-            {
-                continue;
-            }
+    const ClusterRestrictions & clusterRestrictions = it->second;
+    uint8_t restrictingTypes                        = RestrictingTypes(requestPath);
+    if (clusterRestrictions.wildcardTypes & restrictingTypes)
+    {
+        return CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL;
+    }
 
-            switch (restriction.restrictionType)
-            {
-            case Type::kAttributeAccessForbidden:
-                if (requestPath.requestType == RequestType::kAttributeReadRequest ||
-                    requestPath.requestType == RequestType::kAttributeWriteRequest)
-                {
-                    if (!IsGlobalAttribute(requestPath.entityId.value()))
-                    {
-                        return CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL;
-                    }
-                }
-                break;
-            case Type::kAttributeWriteForbidden:
-                if (requestPath.requestType == RequestType::kAttributeWriteRequest)
-                {
-                    if (!IsGlobalAttribute(requestPath.entityId.value()))
-                    {
-                        return CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL;
-                    }
-                }
-                break;
-            case Type::kCommandForbidden:
-                if (requestPath.requestType == RequestType::kCommandInvokeRequest)
-                {
-                    return CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL;
-                }
-                break;
-            case Type::kEventForbidden:
-                if (requestPath.requestType == RequestType::kEventReadRequest)
-                {
-                    return CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL;
-                }
-                break;
-            }
+    if ((clusterRestrictions.idTypes & restrictingTypes) == 0)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    for (auto & restriction : clusterRestrictions.idRestrictions)
+    {
+        if ((TypeBit(restriction.restrictionType) & restrictingTypes) && restriction.id.Value() == requestPath.entityId.value())
+        {
+            return CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL;
         }
     }
 
@@ -31,6 +31,7 @@
 #include <map>
 #include <memory>
 #include <protocols/interaction_model/Constants.h>
+#include <tuple>
 #include <vector>
 
 namespace chip {
@@ -259,16 +260,40 @@ protected:
 
 private:
     /**
-     * Perform the access restriction check using the given entries.
+     * Restrictions of a cluster on an endpoint, merged from the entries of a fabric or from the commissioning entries.
+     *
+     * The types are bitmasks of (1 << Type), so that a check only looks at the restrictions with an id when one of their
+     * types applies to the request.
+     */
+    struct ClusterRestrictions
+    {
+        uint8_t wildcardTypes = 0; // types restricting all the attributes, commands or events
+        uint8_t idTypes       = 0; // types of the restrictions in idRestrictions
+        std::vector<Restriction> idRestrictions;
+    };
+
+    /**
+     * Key of the restriction index: whether the restrictions are the commissioning ones, fabric index (unused for the
+     * commissioning restrictions), endpoint and cluster.
+     */
+    using IndexKey = std::tuple<bool, FabricIndex, EndpointId, ClusterId>;
+
+    /**
+     * Replace the indexed restrictions of a fabric, or the commissioning ones, by those of the given entries.
+     */
+    void IndexEntries(bool commissioning, FabricIndex fabricIndex, const std::vector<Entry> & entries);
+
+    /**
+     * Perform the access restriction check using the indexed restrictions of a fabric, or the commissioning ones.
      */
-    CHIP_ERROR DoCheck(const std::vector<Entry> & entries, const SubjectDescriptor & subjectDescriptor,
-                       const RequestPath & requestPath);
+    CHIP_ERROR DoCheck(bool commissioning, FabricIndex fabricIndex, const RequestPath & requestPath);
 
     uint64_t mNextToken   = 1;
     Listener * mListeners = nullptr;
     StandardAccessRestrictionExceptionChecker mExceptionChecker;
     std::vector<Entry> mCommissioningEntries;
     std::map<FabricIndex, std::vector<Entry>> mFabricEntries;
+    std::map<IndexKey, ClusterRestrictions> mRestrictionIndex;
 };
 
 } // namespace Access
@@ -775,6 +775,90 @@ private:
     EntryStorage * mStorage = nullptr;
 };
 
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_SUBJECT_INDEX
+// Index of the access control list by fabric, auth mode and subject, rebuilt whenever the list changes,
+// so that checks only iterate the entries whose subjects can match.
+//
+// Each entry has a key per subject, or a key with an undefined subject if it has none (it then applies
+// to all the subjects of its fabric and auth mode). CASE Authenticated Tag subjects are keyed without
+// their version, as any tag with the same identifier and at least that version matches.
+class SubjectIndex
+{
+public:
+    struct Key
+    {
+        NodeId subject;
+        FabricIndex fabricIndex;
+        AuthMode authMode;
+        uint16_t entry; // absolute index in the access control list
+    };
+
+    struct Range
+    {
+        uint16_t begin;
+        uint16_t end;
+    };
+
+    static constexpr size_t kMaxKeys = ArraySize(EntryStorage::acl) * std::max<size_t>(EntryStorage::kMaxSubjects, 1);
+    static_assert(kMaxKeys <= UINT16_MAX, "Index positions must fit in 16 bits");
+
+    static Key keys[kMaxKeys];
+    static uint16_t count;
+
+    // Changes on every rebuild, so that outstanding iterators can tell their ranges are stale.
+    static uint32_t generation;
+
+    static void Rebuild()
+    {
+        count = 0;
+        for (uint16_t i = 0; i < ArraySize(EntryStorage::acl) && EntryStorage::acl[i].InUse(); i++)
+        {
+            const auto & storage = EntryStorage::acl[i];
+            bool hasSubjects     = false;
+            for (const auto & subjectStorage : storage.mSubjects)
+            {
+                NodeId subject = kUndefinedNodeId;
+                if (subjectStorage.Get(subject) == CHIP_NO_ERROR)
+                {
+                    keys[count++] = { KeyOf(subject), storage.mFabricIndex, storage.mAuthMode, i };
+                    hasSubjects   = true;
+                }
+            }
+            if (!hasSubjects)
+            {
+                keys[count++] = { kUndefinedNodeId, storage.mFabricIndex, storage.mAuthMode, i };
+            }
+        }
+        std::sort(keys, keys + count, Less);
+        generation++;
+    }
+
+    static NodeId KeyOf(NodeId subject) { return chip::IsCASEAuthTag(subject) ? (subject & ~chip::kTagVersionMask) : subject; }
+
+    static Range Find(FabricIndex fabricIndex, AuthMode authMode, NodeId subject)
+    {
+        const Key key{ KeyOf(subject), fabricIndex, authMode, 0 };
+        auto range = std::equal_range(keys, keys + count, key, Less);
+        return { static_cast<uint16_t>(range.first - keys), static_cast<uint16_t>(range.second - keys) };
+    }
+
+private:
+    // Ignores the entry, so that equal_range finds all the entries of a subject.
+    static bool Less(const Key & a, const Key & b)
+    {
+        if (a.fabricIndex != b.fabricIndex)
+        {
+            return a.fabricIndex < b.fabricIndex;
+        }
+        if (a.authMode != b.authMode)
+        {
+            return a.authMode < b.authMode;
+        }
+        return a.subject < b.subject;
+    }
+};
+#endif // CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_SUBJECT_INDEX
+
 class EntryIteratorDelegate : public EntryIterator::Delegate
 {
 public:
@@ -810,6 +894,13 @@ public:
 
     CHIP_ERROR Next(Entry & entry) override
     {
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_SUBJECT_INDEX
+        if (mSubjectFiltered)
+        {
+            return NextForSubject(entry);
+        }
+#endif
+
         constexpr auto & acl = EntryStorage::acl;
         constexpr auto * end = acl + ArraySize(acl);
         while (true)
@@ -856,7 +947,33 @@ public:
             mFabricIndex = *fabricIndex;
         }
         mStorage = nullptr;
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_SUBJECT_INDEX
+        mSubjectFiltered = false;
+#endif
+    }
+
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_SUBJECT_INDEX
+    void Init(EntryIterator & iterator, const SubjectDescriptor & subjectDescriptor)
+    {
+        Init(iterator, &subjectDescriptor.fabricIndex);
+        mSubjectFiltered = true;
+        mGeneration      = SubjectIndex::generation;
+        mRangeCount      = 0;
+        mRange           = 0;
+
+        const auto fabricIndex = subjectDescriptor.fabricIndex;
+        const auto authMode    = subjectDescriptor.authMode;
+        mRanges[mRangeCount++] = SubjectIndex::Find(fabricIndex, authMode, kUndefinedNodeId);
+        mRanges[mRangeCount++] = SubjectIndex::Find(fabricIndex, authMode, subjectDescriptor.subject);
+        for (auto cat : subjectDescriptor.cats.values)
+        {
+            if (cat != chip::kUndefinedCAT)
+            {
+                mRanges[mRangeCount++] = SubjectIndex::Find(fabricIndex, authMode, chip::NodeIdFromCASEAuthTag(cat));
+            }
+        }
     }
+#endif
 
     bool InUse() const { return mInUse; }
 
@@ -881,10 +998,44 @@ public:
     }
 
 private:
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_SUBJECT_INDEX
+    // Entries of the subject's ranges in the index, range by range. An entry with several subjects
+    // matching the subject descriptor is returned once per subject.
+    CHIP_ERROR NextForSubject(Entry & entry)
+    {
+        VerifyOrReturnError(mGeneration == SubjectIndex::generation, CHIP_ERROR_INCORRECT_STATE);
+        for (; mRange < mRangeCount; mRange++)
+        {
+            auto & range = mRanges[mRange];
+            if (range.begin < range.end)
+            {
+                auto & storage = EntryStorage::acl[SubjectIndex::keys[range.begin++].entry];
+                if (auto * delegate = EntryDelegate::Find(entry.GetDelegate()))
+                {
+                    delegate->Init(entry, storage);
+                    return CHIP_NO_ERROR;
+                }
+                return CHIP_ERROR_BUFFER_TOO_SMALL;
+            }
+        }
+        return CHIP_ERROR_SENTINEL;
+    }
+
+    // The subject without tags and with its node id, then each of its tags.
+    static constexpr size_t kMaxRanges = 2 + chip::kMaxSubjectCATAttributeCount;
+#endif
+
     bool mInUse = false;
     bool mFabricFiltered;
     FabricIndex mFabricIndex;
     EntryStorage * mStorage;
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_SUBJECT_INDEX
+    bool mSubjectFiltered = false;
+    uint32_t mGeneration;
+    SubjectIndex::Range mRanges[kMaxRanges];
+    size_t mRangeCount;
+    size_t mRange;
+#endif
 };
 
 CHIP_ERROR CopyViaInterface(const Entry & entry, EntryStorage & storage)
@@ -962,6 +1113,7 @@ public:
         {
             storage.Clear();
         }
+        RebuildIndex();
         return CHIP_NO_ERROR;
     }
 
@@ -1055,6 +1207,7 @@ public:
                     }
                 }
             }
+            RebuildIndex();
             return err;
         }
         return CHIP_ERROR_BUFFER_TOO_SMALL;
@@ -1078,7 +1231,9 @@ public:
     {
         if (auto * storage = EntryStorage::FindUsedInAcl(index, fabricIndex))
         {
-            return Copy(entry, *storage);
+            CHIP_ERROR err = Copy(entry, *storage);
+            RebuildIndex();
+            return err;
         }
         return CHIP_ERROR_SENTINEL;
     }
@@ -1122,6 +1277,7 @@ public:
                 delegate.FixAfterDelete(*storage);
             }
 
+            RebuildIndex();
             return CHIP_NO_ERROR;
         }
 
@@ -1138,11 +1294,31 @@ public:
         return CHIP_ERROR_BUFFER_TOO_SMALL;
     }
 
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_SUBJECT_INDEX
+    CHIP_ERROR EntriesForSubject(EntryIterator & iterator, const SubjectDescriptor & subjectDescriptor) const override
+    {
+        if (auto * delegate = EntryIteratorDelegate::Find(iterator.GetDelegate()))
+        {
+            delegate->Init(iterator, subjectDescriptor);
+            return CHIP_NO_ERROR;
+        }
+        return CHIP_ERROR_BUFFER_TOO_SMALL;
+    }
+#endif
+
     CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
                      Privilege requestPrivilege) override
     {
         return CHIP_ERROR_NOT_IMPLEMENTED;
     }
+
+private:
+    static void RebuildIndex()
+    {
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_SUBJECT_INDEX
+        SubjectIndex::Rebuild();
+#endif
+    }
 };
 
 static_assert(std::is_pod<SubjectStorage>(), "Storage type must be POD");
@@ -1153,6 +1329,11 @@ EntryStorage EntryStorage::acl[];
 EntryStorage EntryStorage::pool[];
 EntryDelegate EntryDelegate::pool[];
 EntryIteratorDelegate EntryIteratorDelegate::pool[];
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_SUBJECT_INDEX
+SubjectIndex::Key SubjectIndex::keys[];
+uint16_t SubjectIndex::count;
+uint32_t SubjectIndex::generation;
+#endif
 
 } // namespace
 
@@ -2195,5 +2195,128 @@ TEST_F(TestAccessControl, TestUpdateEntry)
     }
 }
 
+TEST_F(TestAccessControl, TestCheckAfterEntriesChange)
+{
+    EXPECT_EQ(LoadAccessControl(accessControl, entryData1, entryData1Count), CHIP_NO_ERROR);
+    for (int pass = 0; pass < 2; pass++)
+    {
+        for (const auto & checkData : checkData1)
+        {
+            CHIP_ERROR expectedResult = checkData.allow ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+            auto requestPath          = checkData.requestPath;
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+            requestPath.requestType = Access::RequestType::kAttributeReadRequest;
+#endif
+            EXPECT_EQ(accessControl.Check(checkData.subjectDescriptor, requestPath, checkData.privilege), expectedResult);
+        }
+    }
+
+    // Decisions made before the entries went away must not be reused.
+    EXPECT_EQ(ClearAccessControl(accessControl), CHIP_NO_ERROR);
+    for (const auto & checkData : checkData1)
+    {
+        auto requestPath = checkData.requestPath;
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+        requestPath.requestType = Access::RequestType::kAttributeReadRequest;
+#endif
+        CHIP_ERROR expectedResult =
+            (checkData.subjectDescriptor.authMode == AuthMode::kPase) ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+        EXPECT_EQ(accessControl.Check(checkData.subjectDescriptor, requestPath, checkData.privilege), expectedResult);
+    }
+}
+
+TEST_F(TestAccessControl, TestCheckEvaluatesEntriesOncePerCluster)
+{
+    class CountingDelegate : public AccessControl::Delegate
+    {
+    public:
+        CHIP_ERROR Entries(EntryIterator & iterator, const FabricIndex * fabricIndex) const override
+        {
+            mEntriesCount++;
+            return CHIP_NO_ERROR;
+        }
+
+        CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                         Privilege requestPrivilege) override
+        {
+            return CHIP_ERROR_NOT_IMPLEMENTED;
+        }
+
+        mutable size_t mEntriesCount = 0;
+    } delegate;
+
+    AccessControl ac;
+    ASSERT_EQ(ac.Init(&delegate, testDeviceTypeResolver), CHIP_NO_ERROR);
+
+    const SubjectDescriptor subjectDescriptor = { .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId1 };
+    RequestPath requestPath{ .cluster = kOnOffCluster, .endpoint = 1, .requestType = RequestType::kAttributeReadRequest };
+
+    // All the attributes of a cluster, as in a wildcard read.
+    for (uint32_t attribute = 0; attribute < 10; attribute++)
+    {
+        requestPath.entityId = attribute;
+        EXPECT_EQ(ac.Check(subjectDescriptor, requestPath, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+    }
+    size_t expectedCount = (CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0) ? 1 : 10;
+    EXPECT_EQ(delegate.mEntriesCount, expectedCount);
+
+    requestPath.cluster = kLevelControlCluster;
+    EXPECT_EQ(ac.Check(subjectDescriptor, requestPath, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+    EXPECT_EQ(ac.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_ERROR_ACCESS_DENIED);
+    expectedCount += 2;
+    EXPECT_EQ(delegate.mEntriesCount, expectedCount);
+
+    // A change of the entries clears the decisions.
+    EXPECT_EQ(ac.DeleteEntry(nullptr, 1, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(ac.Check(subjectDescriptor, requestPath, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+    EXPECT_EQ(delegate.mEntriesCount, expectedCount + 1);
+
+    ac.Finish();
+}
+
+#if CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_SUBJECT_INDEX
+TEST_F(TestAccessControl, TestEntriesForSubject)
+{
+    EXPECT_EQ(LoadAccessControl(accessControl, entryData1, entryData1Count), CHIP_NO_ERROR);
+    AccessControl::Delegate * delegate = Examples::GetAccessControlDelegate();
+
+    auto countEntries = [delegate](const SubjectDescriptor & subjectDescriptor) {
+        EntryIterator iterator;
+        EXPECT_EQ(delegate->EntriesForSubject(iterator, subjectDescriptor), CHIP_NO_ERROR);
+        size_t count = 0;
+        Entry entry;
+        while (iterator.Next(entry) == CHIP_NO_ERROR)
+        {
+            FabricIndex fabricIndex = kUndefinedFabricIndex;
+            EXPECT_EQ(entry.GetFabricIndex(fabricIndex), CHIP_NO_ERROR);
+            EXPECT_EQ(fabricIndex, subjectDescriptor.fabricIndex);
+            count++;
+        }
+        return count;
+    };
+
+    // Its own entry and the two without subjects, but not the one of a tag it does not have.
+    SubjectDescriptor subjectDescriptor = { .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId3 };
+    EXPECT_EQ(countEntries(subjectDescriptor), 3u);
+
+    subjectDescriptor.cats = { kCASEAuthTag0, kUndefinedCAT, kUndefinedCAT };
+    EXPECT_EQ(countEntries(subjectDescriptor), 4u);
+
+    // Tags match by identifier, whatever their version: entries 7 and 8 both list kCASEAuthTag1.
+    subjectDescriptor = { .fabricIndex = 2,
+                          .authMode    = AuthMode::kCase,
+                          .subject     = kOperationalNodeId1,
+                          .cats        = { kCASEAuthTag1, kUndefinedCAT, kUndefinedCAT } };
+    EXPECT_EQ(countEntries(subjectDescriptor), 2u);
+
+    subjectDescriptor = { .fabricIndex = 2, .authMode = AuthMode::kGroup, .subject = kGroup2 };
+    EXPECT_EQ(countEntries(subjectDescriptor), 1u);
+
+    // The index follows the changes of the list.
+    EXPECT_EQ(accessControl.DeleteEntry(nullptr, 2, 2), CHIP_NO_ERROR);
+    EXPECT_EQ(countEntries(subjectDescriptor), 0u);
+}
+#endif // CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_SUBJECT_INDEX
+
 } // namespace Access
 } // namespace chip
@@ -718,5 +718,59 @@ TEST_F(TestAccessRestriction, ListSelectiondDuringCommissioningTest)
     RunChecks(listSelectionDuringCommissioningData, ArraySize(listSelectionDuringCommissioningData));
 }
 
+
+TEST_F(TestAccessRestriction, MergedAndReplacedEntriesTest)
+{
+    SubjectDescriptor subjectDescriptor = { .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId1 };
+
+    RequestPath command1   = { .cluster     = kWiFiNetworkManagementCluster,
+                               .endpoint    = 1,
+                               .requestType = RequestType::kCommandInvokeRequest,
+                               .entityId    = 1 };
+    RequestPath command2   = { .cluster     = kWiFiNetworkManagementCluster,
+                               .endpoint    = 1,
+                               .requestType = RequestType::kCommandInvokeRequest,
+                               .entityId    = 2 };
+    RequestPath attribute1 = { .cluster     = kWiFiNetworkManagementCluster,
+                               .endpoint    = 1,
+                               .requestType = RequestType::kAttributeWriteRequest,
+                               .entityId    = 1 };
+
+    // two entries for the same cluster, whose restrictions both apply
+    std::vector<AccessRestrictionProvider::Entry> entries;
+    AccessRestrictionProvider::Entry entry1;
+    entry1.endpointNumber = 1;
+    entry1.clusterId      = kWiFiNetworkManagementCluster;
+    entry1.restrictions.push_back({ .restrictionType = AccessRestrictionProvider::Type::kCommandForbidden });
+    entry1.restrictions[0].id.SetValue(1);
+    entries.push_back(entry1);
+    AccessRestrictionProvider::Entry entry2;
+    entry2.endpointNumber = 1;
+    entry2.clusterId      = kWiFiNetworkManagementCluster;
+    entry2.restrictions.push_back({ .restrictionType = AccessRestrictionProvider::Type::kAttributeWriteForbidden });
+    entries.push_back(entry2);
+    EXPECT_EQ(accessRestrictionProvider.SetEntries(1, entries), CHIP_NO_ERROR);
+
+    EXPECT_EQ(accessRestrictionProvider.Check(subjectDescriptor, command1), CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL);
+    EXPECT_EQ(accessRestrictionProvider.Check(subjectDescriptor, command2), CHIP_NO_ERROR);
+    EXPECT_EQ(accessRestrictionProvider.Check(subjectDescriptor, attribute1), CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL);
+
+    // the restrictions of the replaced entries no longer apply
+    entries.clear();
+    entry2.restrictions[0].restrictionType = AccessRestrictionProvider::Type::kCommandForbidden;
+    entry2.restrictions[0].id.SetValue(2);
+    entries.push_back(entry2);
+    EXPECT_EQ(accessRestrictionProvider.SetEntries(1, entries), CHIP_NO_ERROR);
+
+    EXPECT_EQ(accessRestrictionProvider.Check(subjectDescriptor, command1), CHIP_NO_ERROR);
+    EXPECT_EQ(accessRestrictionProvider.Check(subjectDescriptor, command2), CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL);
+    EXPECT_EQ(accessRestrictionProvider.Check(subjectDescriptor, attribute1), CHIP_NO_ERROR);
+
+    // other fabrics and the commissioning restrictions are not affected
+    subjectDescriptor.fabricIndex = 2;
+    EXPECT_EQ(accessRestrictionProvider.Check(subjectDescriptor, command2), CHIP_NO_ERROR);
+    EXPECT_EQ(accessRestrictionProvider.CheckForCommissioning(subjectDescriptor, command2), CHIP_NO_ERROR);
+}
+
 } // namespace Access
 } // namespace chip
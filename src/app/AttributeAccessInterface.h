@@ -96,6 +96,9 @@ public:
      * 2) This function will only be called once for a series of consequent attribute data (regardless the kind of list operation)
      * of the same attribute.
      *
+     * A chunked list write replaces the list with an empty one, then appends its items one by one.  Implementations that persist
+     * their lists can defer storing them to OnListWriteEnd, rather than rewriting them on every appended item.
+     *
      * @param [in] aPath indicates the path of the modified list.
      */
     virtual void OnListWriteBegin(const ConcreteAttributePath & aPath) {}
@@ -153,6 +156,9 @@ protected:
     Optional<EndpointId> GetEndpointId() { return mEndpointId; }
 
 private:
+    // Indexes the interfaces by their endpoint and cluster.
+    friend class AttributeAccessInterfaceRegistry;
+
     Optional<EndpointId> mEndpointId;
     ClusterId mClusterId;
     AttributeAccessInterface * mNext = nullptr;
@@ -18,46 +18,6 @@
 
 #include <app/AttributeAccessInterfaceCache.h>
 
-namespace {
-
-using chip::app::AttributeAccessInterface;
-
-// shouldUnregister returns true if the given AttributeAccessInterface should be
-// unregistered.
-template <typename F>
-void UnregisterMatchingAttributeAccessInterfaces(F shouldUnregister, AttributeAccessInterface *& list_head)
-{
-    AttributeAccessInterface * prev = nullptr;
-    AttributeAccessInterface * cur  = list_head;
-    while (cur)
-    {
-        AttributeAccessInterface * next = cur->GetNext();
-        if (shouldUnregister(cur))
-        {
-            // Remove it from the list
-            if (prev)
-            {
-                prev->SetNext(next);
-            }
-            else
-            {
-                list_head = next;
-            }
-
-            cur->SetNext(nullptr);
-
-            // Do not change prev in this case.
-        }
-        else
-        {
-            prev = cur;
-        }
-        cur = next;
-    }
-}
-
-} // namespace
-
 namespace chip {
 namespace app {
 
@@ -70,30 +30,24 @@ AttributeAccessInterfaceRegistry & AttributeAccessInterfaceRegistry::Instance()
 void AttributeAccessInterfaceRegistry::Unregister(AttributeAccessInterface * attrOverride)
 {
     mAttributeAccessInterfaceCache.Invalidate();
-    UnregisterMatchingAttributeAccessInterfaces([attrOverride](AttributeAccessInterface * entry) { return entry == attrOverride; },
-                                                mAttributeAccessOverrides);
+    mAttributeAccessOverrides.Remove(attrOverride, attrOverride->mEndpointId, attrOverride->mClusterId);
 }
 
 void AttributeAccessInterfaceRegistry::UnregisterAllForEndpoint(EndpointId endpointId)
 {
     mAttributeAccessInterfaceCache.Invalidate();
-    UnregisterMatchingAttributeAccessInterfaces(
-        [endpointId](AttributeAccessInterface * entry) { return entry->MatchesEndpoint(endpointId); }, mAttributeAccessOverrides);
+    mAttributeAccessOverrides.RemoveAllForEndpoint(endpointId);
 }
 
 bool AttributeAccessInterfaceRegistry::Register(AttributeAccessInterface * attrOverride)
 {
     mAttributeAccessInterfaceCache.Invalidate();
-    for (auto * cur = mAttributeAccessOverrides; cur; cur = cur->GetNext())
+    if (mAttributeAccessOverrides.FindConflict(*attrOverride, attrOverride->mEndpointId, attrOverride->mClusterId) != nullptr)
     {
-        if (cur->Matches(*attrOverride))
-        {
-            ChipLogError(InteractionModel, "Duplicate attribute override registration failed");
-            return false;
-        }
+        ChipLogError(InteractionModel, "Duplicate attribute override registration failed");
+        return false;
     }
-    attrOverride->SetNext(mAttributeAccessOverrides);
-    mAttributeAccessOverrides = attrOverride;
+    mAttributeAccessOverrides.Insert(attrOverride, attrOverride->mEndpointId, attrOverride->mClusterId);
     return true;
 }
 
@@ -112,13 +66,11 @@ AttributeAccessInterface * AttributeAccessInterfaceRegistry::Get(EndpointId endp
     case CacheResult::kCacheMiss:
     default:
         // Did not cache yet, search set of AAI registered, and cache if found.
-        for (app::AttributeAccessInterface * cur = mAttributeAccessOverrides; cur; cur = cur->GetNext())
+        AttributeAccessInterface * found = mAttributeAccessOverrides.Find(endpointId, clusterId);
+        if (found != nullptr)
         {
-            if (cur->Matches(endpointId, clusterId))
-            {
-                mAttributeAccessInterfaceCache.MarkUsed(endpointId, clusterId, cur);
-                return cur;
-            }
+            mAttributeAccessInterfaceCache.MarkUsed(endpointId, clusterId, found);
+            return found;
         }
 
         // Did not find AAI registered: mark as definitely not using.
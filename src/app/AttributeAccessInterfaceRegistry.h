@@ -17,6 +17,8 @@
 
 #include <app/AttributeAccessInterface.h>
 #include <app/AttributeAccessInterfaceCache.h>
+#include <app/EndpointClusterRegistrationIndex.h>
+#include <lib/core/CHIPConfig.h>
 
 namespace chip {
 namespace app {
@@ -56,7 +58,7 @@ public:
     static AttributeAccessInterfaceRegistry & Instance();
 
 private:
-    AttributeAccessInterface * mAttributeAccessOverrides = nullptr;
+    EndpointClusterRegistrationIndex<AttributeAccessInterface, CHIP_IM_SERVER_INTERFACE_REGISTRY_BUCKETS> mAttributeAccessOverrides;
     AttributeAccessInterfaceCache mAttributeAccessInterfaceCache;
 };
 
@@ -31,6 +31,10 @@ namespace app {
 ///   - CurrentEncodingListIndex representing the list index that is next
 ///     to be encoded in the output. kInvalidListIndex means that a new list
 ///     encoding has been started.
+///
+/// Lists encoded with AttributeValueEncoder::EncodeResumableList also keep
+/// ListResumeCursor, the position in the source of the list from which the
+/// producer resumes at the next chunk.
 class AttributeEncodeState
 {
 public:
@@ -50,11 +54,13 @@ public:
         {
             mCurrentEncodingListIndex = kInvalidListIndex;
             mAllowPartialData         = false;
+            mListResumeCursor         = 0;
         }
     }
 
     bool AllowPartialData() const { return mAllowPartialData; }
     ListIndex CurrentEncodingListIndex() const { return mCurrentEncodingListIndex; }
+    uint32_t ListResumeCursor() const { return mListResumeCursor; }
 
     AttributeEncodeState & SetAllowPartialData(bool allow)
     {
@@ -68,10 +74,17 @@ public:
         return *this;
     }
 
+    AttributeEncodeState & SetListResumeCursor(uint32_t cursor)
+    {
+        mListResumeCursor = cursor;
+        return *this;
+    }
+
     void Reset()
     {
         mCurrentEncodingListIndex = kInvalidListIndex;
         mAllowPartialData         = false;
+        mListResumeCursor         = 0;
     }
 
 private:
@@ -97,6 +110,13 @@ private:
      * TODO: There might be a better name for this variable.
      */
     bool mAllowPartialData = false;
+
+    /**
+     * The cursor the producer of a resumable list passed along with the last item encoded, i.e. where the item at
+     * mCurrentEncodingListIndex is found in the source of the list.  0 is the start of the list.  Only meaningful to the
+     * producer of the list.
+     */
+    uint32_t mListResumeCursor = 0;
 };
 
 } // namespace app
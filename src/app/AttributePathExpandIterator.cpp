@@ -25,13 +25,21 @@ namespace chip {
 namespace app {
 
 AttributePathExpandIterator::AttributePathExpandIterator(DataModel::Provider * provider,
-                                                         SingleLinkedListNode<AttributePathParams> * attributePath) :
+                                                         SingleLinkedListNode<AttributePathParams> * attributePath,
+                                                         const AttributePathExpansionCache * cache) :
     mDataModelProvider(provider),
     mpAttributePath(attributePath), mOutputPath(kInvalidEndpointId, kInvalidClusterId, kInvalidAttributeId)
 
 {
     mOutputPath.mExpanded = true; // this is reset in 'next' if needed
 
+    if (cache != nullptr && cache->IsComplete() && cache->IsBuiltFor(attributePath))
+    {
+        mCache = cache;
+        LoadCachedPath();
+        return;
+    }
+
     // Make the iterator ready to emit the first valid path in the list.
     // TODO: the bool return value here is completely unchecked
     Next();
@@ -160,6 +168,23 @@ void AttributePathExpandIterator::ResetCurrentCluster()
     // will do nothing, since we won't be expanding the wildcard attribute ids under a cluster.
     VerifyOrReturn(mpAttributePath != nullptr && mpAttributePath->mValue.HasWildcardAttributeId());
 
+    if (mCache != nullptr)
+    {
+        // Step back to the first cached attribute of the current cluster for the same AttributePathParams
+        while (mCacheIndex > 0)
+        {
+            const AttributePathExpansionCache::Entry & previous = (*mCache)[mCacheIndex - 1];
+            if (previous.source != mpAttributePath || previous.path.mEndpointId != mOutputPath.mEndpointId ||
+                previous.path.mClusterId != mOutputPath.mClusterId)
+            {
+                break;
+            }
+            mCacheIndex--;
+        }
+        LoadCachedPath();
+        return;
+    }
+
     // Reset path expansion to ask for the first attribute of the current cluster
     mOutputPath.mAttributeId = kInvalidAttributeId;
     mOutputPath.mExpanded    = true; // we know this is a wildcard attribute
@@ -219,8 +244,30 @@ bool AttributePathExpandIterator::AdvanceOutputPath()
     }
 }
 
+bool AttributePathExpandIterator::LoadCachedPath()
+{
+    if (mCacheIndex < mCache->Size())
+    {
+        const AttributePathExpansionCache::Entry & entry = (*mCache)[mCacheIndex];
+        mOutputPath                                      = entry.path;
+        mpAttributePath                                  = entry.source;
+        return true;
+    }
+
+    mpAttributePath = nullptr;
+    mOutputPath     = ConcreteReadAttributePath();
+    return false;
+}
+
 bool AttributePathExpandIterator::Next()
 {
+    if (mCache != nullptr)
+    {
+        VerifyOrReturnValue(mpAttributePath != nullptr, false);
+        mCacheIndex++;
+        return LoadCachedPath();
+    }
+
     while (mpAttributePath != nullptr)
     {
         if (AdvanceOutputPath())
@@ -17,6 +17,7 @@
  */
 #pragma once
 
+#include <app/AttributePathExpansionCache.h>
 #include <app/AttributePathParams.h>
 #include <app/ConcreteAttributePath.h>
 #include <app/data-model-provider/Provider.h>
@@ -48,13 +49,18 @@ namespace app {
  * - Chunk full, return
  * - In a new chunk, Get()
  *
+ * When given a complete AttributePathExpansionCache built for the same AttributePathParams, the iterator emits the cached
+ * paths without querying the data model provider. DetachCache() switches such an iterator back to live expansion, resuming
+ * after the path it currently points to.
+ *
  * TODO: The AttributePathParams may support a group id, the iterator should be able to call group data provider to expand the group
  * id.
  */
 class AttributePathExpandIterator
 {
 public:
-    AttributePathExpandIterator(DataModel::Provider * provider, SingleLinkedListNode<AttributePathParams> * attributePath);
+    AttributePathExpandIterator(DataModel::Provider * provider, SingleLinkedListNode<AttributePathParams> * attributePath,
+                                const AttributePathExpansionCache * cache = nullptr);
 
     /**
      * Proceed the iterator to the next attribute path in the given cluster info.
@@ -82,16 +88,32 @@ public:
      */
     void ResetCurrentCluster();
 
-    /** Start iterating over the given `paths` */
-    inline void ResetTo(SingleLinkedListNode<AttributePathParams> * paths)
+    /** Start iterating over the given `paths`, using `cache` if it holds their expansion */
+    inline void ResetTo(SingleLinkedListNode<AttributePathParams> * paths, const AttributePathExpansionCache * cache = nullptr)
     {
-        *this = AttributePathExpandIterator(mDataModelProvider, paths);
+        *this = AttributePathExpandIterator(mDataModelProvider, paths, cache);
     }
 
+    /**
+     * Stop using the expansion cache, if any, and expand the remaining paths through the data model provider.
+     *
+     * This must be called before the cache given to the iterator is invalidated.
+     */
+    void DetachCache() { mCache = nullptr; }
+
 private:
+    friend class AttributePathExpansionCache;
+
     DataModel::Provider * mDataModelProvider;
     SingleLinkedListNode<AttributePathParams> * mpAttributePath;
     ConcreteAttributePath mOutputPath;
+    const AttributePathExpansionCache * mCache = nullptr;
+    size_t mCacheIndex                        = 0;
+
+    /// Point the iterator at the cached path at mCacheIndex.
+    ///
+    /// returns false if the cached paths are exhausted.
+    bool LoadCachedPath();
 
     /// Move to the next endpoint/cluster/attribute triplet that is valid given
     /// the current mOutputPath and mpAttributePath
@@ -0,0 +1,67 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <app/AttributePathExpansionCache.h>
+
+#include <app/AttributePathExpandIterator.h>
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+
+CHIP_ERROR AttributePathExpansionCache::Build(DataModel::Provider * provider,
+                                              SingleLinkedListNode<AttributePathParams> * attributePaths, size_t maxEntries)
+{
+    Invalidate();
+    mAttributePaths = attributePaths;
+    mBuilt          = true;
+
+    // Count the paths first, so that the entries are allocated at their final size.
+    size_t count = 0;
+    ConcreteAttributePath path;
+    for (AttributePathExpandIterator iterator(provider, attributePaths); iterator.Get(path); iterator.Next())
+    {
+        VerifyOrReturnError(++count <= maxEntries, CHIP_ERROR_NO_MEMORY);
+    }
+
+    if (count > 0)
+    {
+        VerifyOrReturnError(mEntries.Calloc(count), CHIP_ERROR_NO_MEMORY);
+    }
+
+    for (AttributePathExpandIterator iterator(provider, attributePaths); iterator.Get(path) && mSize < count; iterator.Next())
+    {
+        mEntries[mSize].path   = path;
+        mEntries[mSize].source = iterator.mpAttributePath;
+        mSize++;
+    }
+
+    mComplete = true;
+    return CHIP_NO_ERROR;
+}
+
+void AttributePathExpansionCache::Invalidate()
+{
+    mEntries.Free();
+    mSize           = 0;
+    mAttributePaths = nullptr;
+    mBuilt          = false;
+    mComplete       = false;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,83 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/data-model-provider/Provider.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/LinkedList.h>
+#include <lib/support/ScopedBuffer.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * AttributePathExpansionCache holds the concrete paths that a list of AttributePathParams-s expands to, in the order in
+ * which AttributePathExpandIterator emits them.
+ *
+ * An AttributePathExpandIterator given a built cache walks the cached paths instead of querying the data model provider,
+ * which saves the metadata traversal when the same wildcard paths are expanded for every report.
+ *
+ * The cache does not track the data model: its owner must call Invalidate() whenever the set of endpoints, clusters, or
+ * attributes that are supported changes, and before the given AttributePathParams are released.
+ */
+class AttributePathExpansionCache
+{
+public:
+    struct Entry
+    {
+        ConcreteAttributePath path;
+        // The AttributePathParams that expanded to path.
+        SingleLinkedListNode<AttributePathParams> * source;
+    };
+
+    /**
+     * Expand the given paths and cache the result.
+     *
+     * Returns CHIP_ERROR_NO_MEMORY if the paths expand to more than maxEntries concrete paths, or if the entries cannot be
+     * allocated.  The cache is then left incomplete, and IsBuiltFor() still returns true for the given paths, so that the
+     * expansion is not attempted again on every report.
+     */
+    CHIP_ERROR Build(DataModel::Provider * provider, SingleLinkedListNode<AttributePathParams> * attributePaths, size_t maxEntries);
+
+    /// Drop the cached paths.  The next Build() call expands the paths again.
+    void Invalidate();
+
+    /// Returns true if Build() was called for the given paths since the last Invalidate().
+    bool IsBuiltFor(const SingleLinkedListNode<AttributePathParams> * attributePaths) const
+    {
+        return mBuilt && mAttributePaths == attributePaths;
+    }
+
+    /// Returns true if the cache holds the full expansion of the paths it was built for.
+    bool IsComplete() const { return mBuilt && mComplete; }
+
+    size_t Size() const { return mSize; }
+    const Entry & operator[](size_t index) const { return mEntries[index]; }
+
+private:
+    Platform::ScopedMemoryBuffer<Entry> mEntries;
+    size_t mSize                                                      = 0;
+    const SingleLinkedListNode<AttributePathParams> * mAttributePaths = nullptr;
+    bool mBuilt                                                       = false;
+    bool mComplete                                                    = false;
+};
+
+} // namespace app
+} // namespace chip
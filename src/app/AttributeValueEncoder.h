@@ -68,6 +68,28 @@ public:
         AttributeValueEncoder & mAttributeValueEncoder;
     };
 
+    class ResumableListEncodeHelper
+    {
+    public:
+        ResumableListEncodeHelper(AttributeValueEncoder & encoder) : mAttributeValueEncoder(encoder) {}
+
+        /**
+         * Encode a list item as ListEncodeHelper::Encode does.  aNextCursor is the cursor of the item that follows it in the
+         * source of the list, from which the producer resumes if the list is chunked after this item.
+         */
+        template <typename T>
+        CHIP_ERROR Encode(uint32_t aNextCursor, T && aArg) const
+        {
+            ReturnErrorOnFailure(ListEncodeHelper(mAttributeValueEncoder).Encode(std::forward<T>(aArg)));
+            // Items skipped by fabric filtering move the cursor too, as they are never encoded.
+            mAttributeValueEncoder.mEncodeState.SetListResumeCursor(aNextCursor);
+            return CHIP_NO_ERROR;
+        }
+
+    private:
+        AttributeValueEncoder & mAttributeValueEncoder;
+    };
+
     AttributeValueEncoder(AttributeReportIBs::Builder & aAttributeReportIBsBuilder, Access::SubjectDescriptor subjectDescriptor,
                           const ConcreteAttributePath & aPath, DataVersion aDataVersion, bool aIsFabricFiltered = false,
                           const AttributeEncodeState & aState = AttributeEncodeState()) :
@@ -144,6 +166,35 @@ public:
         return err;
     }
 
+    /**
+     * Same as EncodeList, for producers that can resume the list where the previous chunk stopped instead of producing it again
+     * from the start.
+     *
+     * aCallback is expected to take a const auto & encoder argument and a uint32_t cursor argument.  It must produce the list
+     * items starting from the item at the given cursor, and Encode() each of them along with the cursor of the item that
+     * follows it.  The cursor is 0 when the list starts; other values are defined by the producer, which must be able to find
+     * the item at a cursor it passed to Encode() again on a later chunk.
+     *
+     * Consumers are allowed to make either one call to EncodeResumableList, EncodeList or Encode to handle a read.
+     */
+    template <typename ListGenerator>
+    CHIP_ERROR EncodeResumableList(ListGenerator aCallback)
+    {
+        mTriedEncode = true;
+        ReturnErrorOnFailure(EnsureListStarted());
+
+        // The producer starts after the items encoded in previous chunks, so none of the items it produces are skipped.
+        mCurrentEncodingListIndex = mEncodeState.CurrentEncodingListIndex();
+        CHIP_ERROR err            = aCallback(ResumableListEncodeHelper(*this), mEncodeState.ListResumeCursor());
+
+        EnsureListEnded();
+        if (err == CHIP_NO_ERROR)
+        {
+            mEncodeState.Reset();
+        }
+        return err;
+    }
+
     bool TriedEncode() const { return mTriedEncode; }
 
     const Access::SubjectDescriptor & GetSubjectDescriptor() const { return mSubjectDescriptor; }
@@ -161,6 +212,7 @@ public:
 private:
     // We made EncodeListItem() private, and ListEncoderHelper will expose it by Encode()
     friend class ListEncodeHelper;
+    friend class ResumableListEncodeHelper;
     friend class TestOnlyAttributeValueEncoderAccessor;
 
     template <typename... Ts>
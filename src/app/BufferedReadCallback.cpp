@@ -24,11 +24,40 @@
 #include "system/TLVPacketBufferBackingStore.h"
 #include <app/BufferedReadCallback.h>
 #include <app/InteractionModelEngine.h>
-#include <lib/support/ScopedBuffer.h>
+#include <lib/support/CHIPMem.h>
+
+#include <algorithm>
 
 namespace chip {
 namespace app {
 
+namespace {
+
+// The first byte of the list in contiguous mode: the control octet of an anonymous array.
+constexpr uint8_t kListStartControlByte =
+    static_cast<uint8_t>(TLV::TLVTagControl::Anonymous) | static_cast<uint8_t>(TLV::TLVElementType::Array);
+constexpr uint8_t kListEndControlByte = static_cast<uint8_t>(TLV::TLVElementType::EndOfContainer);
+
+// The smallest list buffer allocated in contiguous mode.
+constexpr size_t kMinListBufferSize = 64;
+
+} // anonymous namespace
+
+BufferedReadCallback::~BufferedReadCallback()
+{
+    Platform::MemoryFree(mpListBuffer);
+}
+
+void BufferedReadCallback::ClearBufferedList()
+{
+    mBufferedList.clear();
+    mArena.Reset();
+    Platform::MemoryFree(mpListBuffer);
+    mpListBuffer    = nullptr;
+    mListBufferSize = 0;
+    mListLength     = 0;
+}
+
 void BufferedReadCallback::OnReportBegin()
 {
     mCallback.OnReportBegin();
@@ -46,10 +75,9 @@ void BufferedReadCallback::OnReportEnd()
     mCallback.OnReportEnd();
 }
 
-CHIP_ERROR BufferedReadCallback::GenerateListTLV(TLV::ScopedBufferTLVReader & aReader)
+CHIP_ERROR BufferedReadCallback::GenerateListTLV(TLV::TLVReader & aReader)
 {
     TLV::TLVType outerType;
-    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
 
     //
     // To generate the final reconstituted list, we need to allocate a contiguous
@@ -76,10 +104,14 @@ CHIP_ERROR BufferedReadCallback::GenerateListTLV(TLV::ScopedBufferTLVReader & aR
     //
     totalBufSize += 4;
 
-    backingBuffer.Calloc(totalBufSize);
-    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    //
+    // The buffer comes from mArena, and goes away with the rest of the buffered list in ClearBufferedList().
+    //
+    uint8_t * backingBuffer = mArena.AllocateArray<uint8_t>(totalBufSize);
+    VerifyOrReturnError(backingBuffer != nullptr, CHIP_ERROR_NO_MEMORY);
 
-    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), totalBufSize);
+    TLV::TLVWriter writer;
+    writer.Init(backingBuffer, totalBufSize);
     ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, outerType));
 
     for (auto & bufHandle : mBufferedList)
@@ -93,14 +125,69 @@ CHIP_ERROR BufferedReadCallback::GenerateListTLV(TLV::ScopedBufferTLVReader & aR
     }
 
     ReturnErrorOnFailure(writer.EndContainer(outerType));
+    ReturnErrorOnFailure(writer.Finalize());
+
+    aReader.Init(backingBuffer, totalBufSize);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BufferedReadCallback::ReserveListBuffer(size_t aSize)
+{
+    VerifyOrReturnError(aSize > mListBufferSize, CHIP_NO_ERROR);
+
+    // Grow geometrically, so that the items of a long list only get moved a few times.
+    const size_t newSize = std::max(std::max(aSize, 2 * mListBufferSize), kMinListBufferSize);
+    void * newBuffer     = Platform::MemoryRealloc(mpListBuffer, newSize);
+    VerifyOrReturnError(newBuffer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    mpListBuffer    = static_cast<uint8_t *>(newBuffer);
+    mListBufferSize = newSize;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BufferedReadCallback::AppendListItem(TLV::TLVReader & reader)
+{
+    //
+    // Unlike BufferListItem, the exact size of the item is computed up front, which lets it be copied straight to its place
+    // in the list.  The byte reserved at the end is for the end of the array.
+    //
+    TLV::TLVReader sizeReader;
+    sizeReader.Init(reader);
+    TLV::TLVWriter sizeWriter;
+    sizeWriter.InitSizeOnly();
+    ReturnErrorOnFailure(sizeWriter.CopyElement(TLV::AnonymousTag(), sizeReader));
 
-    writer.Finalize(backingBuffer);
+    if (mListLength == 0)
+    {
+        ReturnErrorOnFailure(ReserveListBuffer(kMinListBufferSize));
+        mpListBuffer[mListLength++] = kListStartControlByte;
+    }
+    ReturnErrorOnFailure(ReserveListBuffer(mListLength + sizeWriter.GetLengthWritten() + 1));
 
-    aReader.Init(std::move(backingBuffer), totalBufSize);
+    TLV::TLVWriter writer;
+    writer.Init(mpListBuffer + mListLength, mListBufferSize - mListLength);
+    ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
+    ReturnErrorOnFailure(writer.Finalize());
+    mListLength += writer.GetLengthWritten();
 
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR BufferedReadCallback::FinishContiguousList(TLV::TLVReader & aReader)
+{
+    // An empty list has had no item to start it.
+    ReturnErrorOnFailure(ReserveListBuffer(mListLength + 2));
+    if (mListLength == 0)
+    {
+        mpListBuffer[mListLength++] = kListStartControlByte;
+    }
+    mpListBuffer[mListLength++] = kListEndControlByte;
+
+    aReader.Init(mpListBuffer, mListLength);
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR BufferedReadCallback::BufferListItem(TLV::TLVReader & reader)
 {
     System::PacketBufferTLVWriter writer;
@@ -144,6 +231,7 @@ CHIP_ERROR BufferedReadCallback::BufferData(const ConcreteDataAttributePath & aP
 
         VerifyOrReturnError(apData->GetType() == TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
         mBufferedList.clear();
+        mListLength = 0;
 
         ReturnErrorOnFailure(apData->EnterContainer(outerContainer));
 
@@ -151,7 +239,8 @@ CHIP_ERROR BufferedReadCallback::BufferData(const ConcreteDataAttributePath & aP
 
         while ((err = apData->Next()) == CHIP_NO_ERROR)
         {
-            ReturnErrorOnFailure(BufferListItem(*apData));
+            ReturnErrorOnFailure(mListBufferingMode == ListBufferingMode::kContiguous ? AppendListItem(*apData)
+                                                                                      : BufferListItem(*apData));
         }
 
         if (err == CHIP_END_OF_TLV)
@@ -164,7 +253,8 @@ CHIP_ERROR BufferedReadCallback::BufferData(const ConcreteDataAttributePath & aP
     }
     else if (aPath.mListOp == ConcreteDataAttributePath::ListOperation::AppendItem)
     {
-        ReturnErrorOnFailure(BufferListItem(*apData));
+        ReturnErrorOnFailure(mListBufferingMode == ListBufferingMode::kContiguous ? AppendListItem(*apData)
+                                                                                  : BufferListItem(*apData));
     }
 
     return CHIP_NO_ERROR;
@@ -202,9 +292,16 @@ CHIP_ERROR BufferedReadCallback::DispatchBufferedData(const ConcreteAttributePat
     }
 
     StatusIB statusIB;
-    TLV::ScopedBufferTLVReader reader;
+    TLV::TLVReader reader;
 
-    ReturnErrorOnFailure(GenerateListTLV(reader));
+    if (mListBufferingMode == ListBufferingMode::kContiguous)
+    {
+        ReturnErrorOnFailure(FinishContiguousList(reader));
+    }
+    else
+    {
+        ReturnErrorOnFailure(GenerateListTLV(reader));
+    }
 
     //
     // Update the list operation to now reflect the delivery of the entire list
@@ -217,12 +314,15 @@ CHIP_ERROR BufferedReadCallback::DispatchBufferedData(const ConcreteAttributePat
     //
     ReturnErrorOnFailure(reader.Next());
 
-    mCallback.OnAttributeData(mBufferedPath, &reader, statusIB);
+    {
+        InteractionArena::Scope arenaScope(mArena);
+        mCallback.OnAttributeData(mBufferedPath, &reader, statusIB);
+    }
 
     //
     // Clear out our buffered contents to free up allocated buffers, and reset the buffered path.
     //
-    mBufferedList.clear();
+    ClearBufferedList();
     mBufferedPath = ConcreteDataAttributePath();
     return CHIP_NO_ERROR;
 }
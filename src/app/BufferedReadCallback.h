@@ -23,6 +23,7 @@
 #include "system/TLVPacketBufferBackingStore.h"
 #include <app/AppConfig.h>
 #include <app/AttributePathParams.h>
+#include <app/InteractionArena.h>
 #include <app/ReadClient.h>
 #include <vector>
 
@@ -40,13 +41,31 @@ namespace app {
 class BufferedReadCallback : public ReadClient::Callback
 {
 public:
-    BufferedReadCallback(Callback & callback) : mCallback(callback) {}
+    enum class ListBufferingMode : uint8_t
+    {
+        // Each list item is copied into a packet buffer of its own, and the items are copied again into a contiguous
+        // buffer once the list is complete.
+        kPerItem,
+        // The list is encoded as its items arrive, directly into a single buffer grown as needed, which the callback
+        // then reads from.  Each item is only copied once, at the cost of reallocating the buffer as the list grows.
+        kContiguous,
+    };
+
+    BufferedReadCallback(Callback & callback, ListBufferingMode mode = ListBufferingMode::kPerItem) :
+        mCallback(callback), mListBufferingMode(mode)
+    {}
+    ~BufferedReadCallback() override;
 
 private:
     /*
-     * Generates the reconsistuted TLV array from the stored individual list elements
+     * Generates the reconsistuted TLV array from the stored individual list elements, in memory taken from mArena
      */
-    CHIP_ERROR GenerateListTLV(TLV::ScopedBufferTLVReader & reader);
+    CHIP_ERROR GenerateListTLV(TLV::TLVReader & reader);
+
+    /*
+     * Closes the list being built in contiguous mode, and positions the reader on it.
+     */
+    CHIP_ERROR FinishContiguousList(TLV::TLVReader & reader);
 
     /*
      * Dispatch any buffered list data if we need to. Buffered data will only be dispatched if:
@@ -73,7 +92,7 @@ private:
     void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override;
     void OnError(CHIP_ERROR aError) override
     {
-        mBufferedList.clear();
+        ClearBufferedList();
         return mCallback.OnError(aError);
     }
 
@@ -128,9 +147,28 @@ private:
      *
      */
     CHIP_ERROR BufferListItem(TLV::TLVReader & reader);
+
+    /*
+     * Contiguous mode counterpart of BufferListItem(): copies the list item where the reader is positioned to the end of
+     * the list buffer.
+     */
+    CHIP_ERROR AppendListItem(TLV::TLVReader & reader);
+
+    // Make room for aSize bytes in the list buffer, keeping its contents.
+    CHIP_ERROR ReserveListBuffer(size_t aSize);
+    void ClearBufferedList();
+
     ConcreteDataAttributePath mBufferedPath;
     std::vector<System::PacketBufferHandle> mBufferedList;
+    // Holds the reconstituted list in per-item mode, and is InteractionArena::Current() while the list is delivered.
+    InteractionArena mArena;
     Callback & mCallback;
+    const ListBufferingMode mListBufferingMode;
+
+    // The list being built in contiguous mode: the start of the array, followed by the items received so far.
+    uint8_t * mpListBuffer = nullptr;
+    size_t mListBufferSize = 0;
+    size_t mListLength     = 0;
 };
 
 } // namespace app
@@ -25,12 +25,38 @@ CHIP_ERROR CASESessionManager::Init(chip::System::Layer * systemLayer, const CAS
 {
     ReturnErrorOnFailure(params.sessionInitParams.Validate());
     mConfig = params;
+#if CHIP_CONFIG_CASE_WARM_SESSION_PEERS > 0
+    mSystemLayer = systemLayer;
+#endif // CHIP_CONFIG_CASE_WARM_SESSION_PEERS > 0
     params.sessionInitParams.exchangeMgr->GetReliableMessageMgr()->RegisterSessionUpdateDelegate(this);
-    return AddressResolve::Resolver::Instance().Init(systemLayer);
+    ReturnErrorOnFailure(AddressResolve::Resolver::Instance().Init(systemLayer));
+
+    if (params.addressCacheStorage != nullptr)
+    {
+        // Peers are still reachable without the cache, just not as fast
+        CHIP_ERROR err = AddressResolve::Resolver::Instance().SetPersistentStorage(params.addressCacheStorage);
+        if (err != CHIP_NO_ERROR && err != CHIP_ERROR_NOT_IMPLEMENTED)
+        {
+            ChipLogError(Discovery, "Failed to load the operational address cache: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+    }
+
+    return CHIP_NO_ERROR;
 }
 
 void CASESessionManager::Shutdown()
 {
+#if CHIP_CONFIG_CASE_WARM_SESSION_PEERS > 0
+    for (auto & warmPeer : mWarmPeers)
+    {
+        ResetWarmPeer(warmPeer);
+    }
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(HandleWarmSessionCheckTimer, this);
+    }
+#endif // CHIP_CONFIG_CASE_WARM_SESSION_PEERS > 0
+
     AddressResolve::Resolver::Instance().Shutdown();
 }
 
@@ -88,6 +114,13 @@ void CASESessionManager::FindOrEstablishSessionHelper(const ScopedNodeId & peerI
     ChipLogDetail(CASESessionManager, "FindOrEstablishSession: PeerId = [%d:" ChipLogFormatX64 "]", peerId.GetFabricIndex(),
                   ChipLogValueX64(peerId.GetNodeId()));
 
+#if CHIP_CONFIG_CASE_WARM_SESSION_PEERS > 0
+    if (!mWarmingUp)
+    {
+        MarkWarmPeerUsed(peerId);
+    }
+#endif // CHIP_CONFIG_CASE_WARM_SESSION_PEERS > 0
+
     bool forAddressUpdate             = false;
     OperationalSessionSetup * session = FindExistingSessionSetup(peerId, forAddressUpdate);
     if (session == nullptr)
@@ -131,6 +164,164 @@ void CASESessionManager::FindOrEstablishSessionHelper(const ScopedNodeId & peerI
     }
 }
 
+#if CHIP_CONFIG_CASE_WARM_SESSION_PEERS > 0
+void CASESessionManager::AddWarmSessionPeer(const ScopedNodeId & peerId)
+{
+    WarmPeer * warmPeer = FindWarmPeer(peerId);
+    if (warmPeer == nullptr)
+    {
+        warmPeer = &mWarmPeers[0];
+        for (auto & candidate : mWarmPeers)
+        {
+            if (!candidate.InUse())
+            {
+                warmPeer = &candidate;
+                break;
+            }
+            if (candidate.lastUse < warmPeer->lastUse)
+            {
+                warmPeer = &candidate;
+            }
+        }
+
+        if (warmPeer->InUse())
+        {
+            ChipLogProgress(CASESessionManager, "Warm sessions: replacing peer [%d:" ChipLogFormatX64 "]",
+                            warmPeer->peerId.GetFabricIndex(), ChipLogValueX64(warmPeer->peerId.GetNodeId()));
+            ResetWarmPeer(*warmPeer);
+        }
+        warmPeer->peerId = peerId;
+    }
+
+    warmPeer->lastUse    = System::SystemClock().GetMonotonicTimestamp();
+    warmPeer->needsCheck = true;
+
+    WarmUpSessions();
+    ScheduleWarmSessionCheck();
+}
+
+void CASESessionManager::RemoveWarmSessionPeer(const ScopedNodeId & peerId)
+{
+    WarmPeer * warmPeer = FindWarmPeer(peerId);
+    if (warmPeer != nullptr)
+    {
+        ResetWarmPeer(*warmPeer);
+    }
+}
+
+CASESessionManager::WarmPeer * CASESessionManager::FindWarmPeer(const ScopedNodeId & peerId)
+{
+    for (auto & warmPeer : mWarmPeers)
+    {
+        if (warmPeer.InUse() && warmPeer.peerId == peerId)
+        {
+            return &warmPeer;
+        }
+    }
+    return nullptr;
+}
+
+void CASESessionManager::MarkWarmPeerUsed(const ScopedNodeId & peerId)
+{
+    WarmPeer * warmPeer = FindWarmPeer(peerId);
+    if (warmPeer != nullptr)
+    {
+        warmPeer->lastUse = System::SystemClock().GetMonotonicTimestamp();
+    }
+}
+
+void CASESessionManager::ResetWarmPeer(WarmPeer & warmPeer)
+{
+    // The session setup in progress, if any, goes on for its other users.
+    warmPeer.onConnected.Cancel();
+    warmPeer.onFailure.Cancel();
+    warmPeer.peerId     = ScopedNodeId();
+    warmPeer.lastUse    = System::Clock::kZero;
+    warmPeer.needsCheck = false;
+}
+
+void CASESessionManager::WarmUpSessions()
+{
+    while (true)
+    {
+        size_t handshakes = 0;
+        WarmPeer * next   = nullptr;
+        for (auto & warmPeer : mWarmPeers)
+        {
+            if (!warmPeer.InUse())
+            {
+                continue;
+            }
+            if (warmPeer.IsEstablishing())
+            {
+                handshakes++;
+            }
+            else if (warmPeer.needsCheck && (next == nullptr || warmPeer.lastUse > next->lastUse))
+            {
+                next = &warmPeer;
+            }
+        }
+
+        VerifyOrReturn(next != nullptr && handshakes < CHIP_CONFIG_CASE_WARM_SESSION_MAX_HANDSHAKES);
+
+        next->needsCheck = false;
+        if (FindExistingSession(next->peerId).HasValue())
+        {
+            continue;
+        }
+
+        ChipLogDetail(CASESessionManager, "Warm sessions: establishing session with [%d:" ChipLogFormatX64 "]",
+                      next->peerId.GetFabricIndex(), ChipLogValueX64(next->peerId.GetNodeId()));
+        next->onConnected.mContext = this;
+        next->onFailure.mContext   = this;
+
+        // Not a use of the session, for the recent use priority.
+        mWarmingUp = true;
+        FindOrEstablishSession(next->peerId, &next->onConnected, &next->onFailure);
+        mWarmingUp = false;
+    }
+}
+
+void CASESessionManager::ScheduleWarmSessionCheck()
+{
+    VerifyOrReturn(mSystemLayer != nullptr && !mSystemLayer->IsTimerActive(HandleWarmSessionCheckTimer, this));
+
+    LogErrorOnFailure(mSystemLayer->StartTimer(System::Clock::Milliseconds32(CHIP_CONFIG_CASE_WARM_SESSION_CHECK_INTERVAL_MS),
+                                               HandleWarmSessionCheckTimer, this));
+}
+
+void CASESessionManager::HandleWarmSessionCheckTimer(System::Layer * systemLayer, void * context)
+{
+    auto * self  = static_cast<CASESessionManager *>(context);
+    bool anyPeer = false;
+    for (auto & warmPeer : self->mWarmPeers)
+    {
+        warmPeer.needsCheck = warmPeer.InUse();
+        anyPeer             = anyPeer || warmPeer.InUse();
+    }
+    VerifyOrReturn(anyPeer);
+
+    self->WarmUpSessions();
+    self->ScheduleWarmSessionCheck();
+}
+
+void CASESessionManager::HandleWarmSessionConnected(void * context, Messaging::ExchangeManager & exchangeMgr,
+                                                    const SessionHandle & sessionHandle)
+{
+    // Make room for the next peer
+    static_cast<CASESessionManager *>(context)->WarmUpSessions();
+}
+
+void CASESessionManager::HandleWarmSessionFailure(void * context, const ScopedNodeId & peerId, CHIP_ERROR error)
+{
+    // Retried at the next check
+    ChipLogProgress(CASESessionManager,
+                    "Warm sessions: failed to establish session with [%d:" ChipLogFormatX64 "]: %" CHIP_ERROR_FORMAT,
+                    peerId.GetFabricIndex(), ChipLogValueX64(peerId.GetNodeId()), error.Format());
+    static_cast<CASESessionManager *>(context)->WarmUpSessions();
+}
+#endif // CHIP_CONFIG_CASE_WARM_SESSION_PEERS > 0
+
 void CASESessionManager::ReleaseSessionsForFabric(FabricIndex fabricIndex)
 {
     mConfig.sessionSetupPool->ReleaseAllSessionSetupsForFabric(fabricIndex);
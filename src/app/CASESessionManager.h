@@ -36,6 +36,9 @@ struct CASESessionManagerConfig
     CASEClientInitParams sessionInitParams;
     CASEClientPoolDelegate * clientPool                    = nullptr;
     OperationalSessionSetupPoolDelegate * sessionSetupPool = nullptr;
+    // Optional storage for the address resolver to keep the last known
+    // addresses of peers across restarts.
+    PersistentStorageDelegate * addressCacheStorage = nullptr;
 };
 
 /**
@@ -147,6 +150,21 @@ public:
 
     void ReleaseAllSessions();
 
+#if CHIP_CONFIG_CASE_WARM_SESSION_PEERS > 0
+    /**
+     * Keeps a CASE session established with the given peer until
+     * RemoveWarmSessionPeer is called: the session is established right away
+     * if missing, and re-established when lost.
+     *
+     * When all CHIP_CONFIG_CASE_WARM_SESSION_PEERS peers are in use, the warm
+     * peer used the least recently (through FindOrEstablishSession) is
+     * replaced.  Missing sessions of the peers used the most recently are
+     * established first.
+     */
+    void AddWarmSessionPeer(const ScopedNodeId & peerId);
+    void RemoveWarmSessionPeer(const ScopedNodeId & peerId);
+#endif // CHIP_CONFIG_CASE_WARM_SESSION_PEERS > 0
+
     /**
      * This API returns the address for the given node ID.
      * If the CASESessionManager is configured with a DNS-SD cache, the cache is looked up
@@ -179,6 +197,41 @@ private:
 #endif
                                       TransportPayloadCapability transportPayloadCapability);
 
+#if CHIP_CONFIG_CASE_WARM_SESSION_PEERS > 0
+    struct WarmPeer
+    {
+        WarmPeer() : onConnected(HandleWarmSessionConnected, nullptr), onFailure(HandleWarmSessionFailure, nullptr) {}
+
+        bool InUse() const { return peerId.GetNodeId() != kUndefinedNodeId; }
+        // The callbacks are registered while the session is being established.
+        bool IsEstablishing() { return onConnected.IsRegistered(); }
+
+        ScopedNodeId peerId;
+        System::Clock::Timestamp lastUse = System::Clock::kZero;
+        bool needsCheck                  = false;
+        Callback::Callback<OnDeviceConnected> onConnected;
+        Callback::Callback<OnDeviceConnectionFailure> onFailure;
+    };
+
+    WarmPeer * FindWarmPeer(const ScopedNodeId & peerId);
+    void MarkWarmPeerUsed(const ScopedNodeId & peerId);
+    void ResetWarmPeer(WarmPeer & warmPeer);
+
+    /// Starts establishing the missing sessions of the warm peers that need a
+    /// check, within CHIP_CONFIG_CASE_WARM_SESSION_MAX_HANDSHAKES.
+    void WarmUpSessions();
+    void ScheduleWarmSessionCheck();
+
+    static void HandleWarmSessionCheckTimer(System::Layer * systemLayer, void * context);
+    static void HandleWarmSessionConnected(void * context, Messaging::ExchangeManager & exchangeMgr,
+                                           const SessionHandle & sessionHandle);
+    static void HandleWarmSessionFailure(void * context, const ScopedNodeId & peerId, CHIP_ERROR error);
+
+    WarmPeer mWarmPeers[CHIP_CONFIG_CASE_WARM_SESSION_PEERS];
+    System::Layer * mSystemLayer = nullptr;
+    bool mWarmingUp              = false;
+#endif // CHIP_CONFIG_CASE_WARM_SESSION_PEERS > 0
+
     CASESessionManagerConfig mConfig;
 };
 
@@ -19,6 +19,8 @@
 #include "system/SystemPacketBuffer.h"
 #include <app/ClusterStateCache.h>
 #include <app/InteractionModelEngine.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/ScopedBuffer.h>
 #include <tuple>
 
 namespace chip {
@@ -47,6 +49,33 @@ uint32_t SizeOfStatusIB(const StatusIB & aStatus)
     return size;
 }
 
+// Context tags of the clusters in a snapshot.
+enum class SnapshotClusterTag : uint8_t
+{
+    kEndpointId  = 0,
+    kClusterId   = 1,
+    kDataVersion = 2,
+    kAttributes  = 3,
+};
+
+// Context tags of the attributes of a cluster in a snapshot.  An attribute has one of kData, kStatus or kSize.
+enum class SnapshotAttributeTag : uint8_t
+{
+    kAttributeId   = 0,
+    kData          = 1,
+    kStatus        = 2,
+    kClusterStatus = 3,
+    kSize          = 4,
+};
+
+// Snapshots are written to, and read from, a buffer of this size, doubled until it fits a storage value.
+constexpr uint32_t kInitialSnapshotBufferSize = 1024;
+
+uint32_t GrowSnapshotBufferSize(uint32_t bufferSize)
+{
+    return std::min<uint32_t>(bufferSize * 2, UINT16_MAX);
+}
+
 } // anonymous namespace
 
 template <bool CanEnableDataCaching>
@@ -693,6 +722,316 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetLastReportDataPath(Concr
 }
 
 // Ensure that our out-of-line template methods actually get compiled.
+template <bool CanEnableDataCaching>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::WriteSnapshot(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
+{
+    TLV::TLVType outerContainer;
+    ReturnErrorOnFailure(aWriter.StartContainer(aTag, TLV::kTLVType_Array, outerContainer));
+
+    for (auto const & endpointIter : mCache)
+    {
+        for (auto const & clusterIter : endpointIter.second)
+        {
+            // The clusters without a DataVersion would be reported in full by the next subscription anyway.
+            if (clusterIter.second.mCommittedDataVersion.HasValue())
+            {
+                ReturnErrorOnFailure(WriteClusterSnapshot(aWriter, endpointIter.first, clusterIter.first, clusterIter.second));
+            }
+        }
+    }
+
+    return aWriter.EndContainer(outerContainer);
+}
+
+template <bool CanEnableDataCaching>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::WriteClusterSnapshot(TLV::TLVWriter & aWriter, EndpointId aEndpointId,
+                                                                          ClusterId aClusterId,
+                                                                          const ClusterState & aClusterState) const
+{
+    TLV::TLVType clusterContainer;
+    ReturnErrorOnFailure(aWriter.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, clusterContainer));
+    ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(SnapshotClusterTag::kEndpointId), aEndpointId));
+    ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(SnapshotClusterTag::kClusterId), aClusterId));
+    ReturnErrorOnFailure(
+        aWriter.Put(TLV::ContextTag(SnapshotClusterTag::kDataVersion), aClusterState.mCommittedDataVersion.Value()));
+
+    TLV::TLVType attributesContainer;
+    ReturnErrorOnFailure(
+        aWriter.StartContainer(TLV::ContextTag(SnapshotClusterTag::kAttributes), TLV::kTLVType_Array, attributesContainer));
+    for (auto const & attributeIter : aClusterState.mAttributes)
+    {
+        TLV::TLVType attributeContainer;
+        ReturnErrorOnFailure(aWriter.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, attributeContainer));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(SnapshotAttributeTag::kAttributeId), attributeIter.first));
+
+        if constexpr (CanEnableDataCaching)
+        {
+            if (attributeIter.second.template Is<AttributeData>())
+            {
+                TLV::TLVReader reader;
+                reader.Init(attributeIter.second.template Get<AttributeData>().Get(),
+                            attributeIter.second.template Get<AttributeData>().AllocatedSize());
+                ReturnErrorOnFailure(reader.Next());
+                ReturnErrorOnFailure(aWriter.CopyElement(TLV::ContextTag(SnapshotAttributeTag::kData), reader));
+            }
+            else if (attributeIter.second.template Is<StatusIB>())
+            {
+                const StatusIB & status = attributeIter.second.template Get<StatusIB>();
+                ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(SnapshotAttributeTag::kStatus), to_underlying(status.mStatus)));
+                if (status.mClusterStatus.HasValue())
+                {
+                    ReturnErrorOnFailure(
+                        aWriter.Put(TLV::ContextTag(SnapshotAttributeTag::kClusterStatus), status.mClusterStatus.Value()));
+                }
+            }
+            else
+            {
+                ReturnErrorOnFailure(
+                    aWriter.Put(TLV::ContextTag(SnapshotAttributeTag::kSize), attributeIter.second.template Get<uint32_t>()));
+            }
+        }
+        else
+        {
+            ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(SnapshotAttributeTag::kSize), attributeIter.second));
+        }
+
+        ReturnErrorOnFailure(aWriter.EndContainer(attributeContainer));
+    }
+    ReturnErrorOnFailure(aWriter.EndContainer(attributesContainer));
+
+    return aWriter.EndContainer(clusterContainer);
+}
+
+template <bool CanEnableDataCaching>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::RestoreSnapshot(TLV::TLVReader & aReader)
+{
+    VerifyOrReturnError(aReader.GetType() == TLV::kTLVType_Array, CHIP_ERROR_WRONG_TLV_TYPE);
+
+    TLV::TLVType outerContainer;
+    ReturnErrorOnFailure(aReader.EnterContainer(outerContainer));
+
+    CHIP_ERROR err;
+    while ((err = aReader.Next()) == CHIP_NO_ERROR)
+    {
+        ReturnErrorOnFailure(RestoreClusterSnapshot(aReader));
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    return aReader.ExitContainer(outerContainer);
+}
+
+template <bool CanEnableDataCaching>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::RestoreClusterSnapshot(TLV::TLVReader & aReader)
+{
+    VerifyOrReturnError(aReader.GetType() == TLV::kTLVType_Structure, CHIP_ERROR_WRONG_TLV_TYPE);
+
+    TLV::TLVType clusterContainer;
+    ReturnErrorOnFailure(aReader.EnterContainer(clusterContainer));
+
+    EndpointId endpointId;
+    ClusterId clusterId;
+    DataVersion dataVersion;
+    ReturnErrorOnFailure(aReader.Next(TLV::ContextTag(SnapshotClusterTag::kEndpointId)));
+    ReturnErrorOnFailure(aReader.Get(endpointId));
+    ReturnErrorOnFailure(aReader.Next(TLV::ContextTag(SnapshotClusterTag::kClusterId)));
+    ReturnErrorOnFailure(aReader.Get(clusterId));
+    ReturnErrorOnFailure(aReader.Next(TLV::ContextTag(SnapshotClusterTag::kDataVersion)));
+    ReturnErrorOnFailure(aReader.Get(dataVersion));
+    ReturnErrorOnFailure(aReader.Next(TLV::kTLVType_Array, TLV::ContextTag(SnapshotClusterTag::kAttributes)));
+
+    ClusterState clusterState;
+    TLV::TLVType attributesContainer;
+    ReturnErrorOnFailure(aReader.EnterContainer(attributesContainer));
+
+    CHIP_ERROR err;
+    while ((err = aReader.Next()) == CHIP_NO_ERROR)
+    {
+        ReturnErrorOnFailure(RestoreAttributeSnapshot(aReader, clusterState));
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    ReturnErrorOnFailure(aReader.ExitContainer(attributesContainer));
+    ReturnErrorOnFailure(aReader.ExitContainer(clusterContainer));
+
+    clusterState.mCommittedDataVersion.SetValue(dataVersion);
+    mCache[endpointId][clusterId] = std::move(clusterState);
+    return CHIP_NO_ERROR;
+}
+
+template <bool CanEnableDataCaching>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::RestoreAttributeSnapshot(TLV::TLVReader & aReader,
+                                                                              ClusterState & aClusterState)
+{
+    VerifyOrReturnError(aReader.GetType() == TLV::kTLVType_Structure, CHIP_ERROR_WRONG_TLV_TYPE);
+
+    TLV::TLVType attributeContainer;
+    ReturnErrorOnFailure(aReader.EnterContainer(attributeContainer));
+
+    AttributeId attributeId;
+    ReturnErrorOnFailure(aReader.Next(TLV::ContextTag(SnapshotAttributeTag::kAttributeId)));
+    ReturnErrorOnFailure(aReader.Get(attributeId));
+
+    ReturnErrorOnFailure(aReader.Next());
+    VerifyOrReturnError(TLV::IsContextTag(aReader.GetTag()), CHIP_ERROR_INVALID_TLV_TAG);
+
+    AttributeState state;
+    switch (static_cast<SnapshotAttributeTag>(TLV::TagNumFromTag(aReader.GetTag())))
+    {
+    case SnapshotAttributeTag::kData: {
+        // The value is stored as an anonymous element, whose head is at most a control byte and an 8-byte length.
+        TLV::TLVReader endReader(aReader);
+        ReturnErrorOnFailure(endReader.Skip());
+        size_t maxElementSize = endReader.GetLengthRead() - aReader.GetLengthRead() + 9;
+
+        Platform::ScopedMemoryBuffer<uint8_t> elementBuffer;
+        VerifyOrReturnError(elementBuffer.Calloc(maxElementSize), CHIP_ERROR_NO_MEMORY);
+        TLV::ScopedBufferTLVWriter writer(std::move(elementBuffer), maxElementSize);
+        ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), aReader));
+        uint32_t elementSize = writer.GetLengthWritten();
+        ReturnErrorOnFailure(writer.Finalize(elementBuffer));
+
+        if constexpr (CanEnableDataCaching)
+        {
+            if (mCacheData)
+            {
+                AttributeData data;
+                VerifyOrReturnError(data.Calloc(elementSize), CHIP_ERROR_NO_MEMORY);
+                memcpy(data.Get(), elementBuffer.Get(), elementSize);
+                state.template Set<AttributeData>(std::move(data));
+            }
+            else
+            {
+                state.template Set<uint32_t>(elementSize);
+            }
+        }
+        else
+        {
+            state = elementSize;
+        }
+        break;
+    }
+    case SnapshotAttributeTag::kStatus: {
+        StatusIB status;
+        std::underlying_type_t<Protocols::InteractionModel::Status> imStatus;
+        ReturnErrorOnFailure(aReader.Get(imStatus));
+        status.mStatus = static_cast<Protocols::InteractionModel::Status>(imStatus);
+
+        CHIP_ERROR err = aReader.Next(TLV::ContextTag(SnapshotAttributeTag::kClusterStatus));
+        if (err == CHIP_NO_ERROR)
+        {
+            ClusterStatus clusterStatus;
+            ReturnErrorOnFailure(aReader.Get(clusterStatus));
+            status.mClusterStatus.SetValue(clusterStatus);
+        }
+        else
+        {
+            VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+        }
+
+        if constexpr (CanEnableDataCaching)
+        {
+            if (mCacheData)
+            {
+                state.template Set<StatusIB>(status);
+            }
+            else
+            {
+                state.template Set<uint32_t>(SizeOfStatusIB(status));
+            }
+        }
+        else
+        {
+            state = SizeOfStatusIB(status);
+        }
+        break;
+    }
+    case SnapshotAttributeTag::kSize: {
+        uint32_t size;
+        ReturnErrorOnFailure(aReader.Get(size));
+
+        if constexpr (CanEnableDataCaching)
+        {
+            state.template Set<uint32_t>(size);
+        }
+        else
+        {
+            state = size;
+        }
+        break;
+    }
+    default:
+        return CHIP_ERROR_INVALID_TLV_TAG;
+    }
+
+    ReturnErrorOnFailure(aReader.ExitContainer(attributeContainer));
+
+    aClusterState.mAttributes[attributeId] = std::move(state);
+    return CHIP_NO_ERROR;
+}
+
+template <bool CanEnableDataCaching>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::StoreSnapshot(PersistentStorageDelegate & aStorage,
+                                                                   const ScopedNodeId & aNode) const
+{
+    uint32_t bufferSize = kInitialSnapshotBufferSize;
+    while (true)
+    {
+        Platform::ScopedMemoryBuffer<uint8_t> buffer;
+        VerifyOrReturnError(buffer.Alloc(bufferSize), CHIP_ERROR_NO_MEMORY);
+
+        TLV::TLVWriter writer;
+        writer.Init(buffer.Get(), bufferSize);
+        CHIP_ERROR err = WriteSnapshot(writer, TLV::AnonymousTag());
+        if (err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL)
+        {
+            // The TLV writer ran out of room at the end of the buffer.
+            VerifyOrReturnError(bufferSize < UINT16_MAX, CHIP_ERROR_BUFFER_TOO_SMALL);
+            bufferSize = GrowSnapshotBufferSize(bufferSize);
+            continue;
+        }
+        ReturnErrorOnFailure(err);
+        ReturnErrorOnFailure(writer.Finalize());
+
+        return aStorage.SyncSetKeyValue(
+            DefaultStorageKeyAllocator::ClusterStateCacheSnapshot(aNode.GetFabricIndex(), aNode.GetNodeId()).KeyName(),
+            buffer.Get(), static_cast<uint16_t>(writer.GetLengthWritten()));
+    }
+}
+
+template <bool CanEnableDataCaching>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::LoadSnapshot(PersistentStorageDelegate & aStorage, const ScopedNodeId & aNode)
+{
+    auto key            = DefaultStorageKeyAllocator::ClusterStateCacheSnapshot(aNode.GetFabricIndex(), aNode.GetNodeId());
+    uint32_t bufferSize = kInitialSnapshotBufferSize;
+    while (true)
+    {
+        Platform::ScopedMemoryBuffer<uint8_t> buffer;
+        VerifyOrReturnError(buffer.Alloc(bufferSize), CHIP_ERROR_NO_MEMORY);
+
+        uint16_t size  = static_cast<uint16_t>(bufferSize);
+        CHIP_ERROR err = aStorage.SyncGetKeyValue(key.KeyName(), buffer.Get(), size);
+        if (err == CHIP_ERROR_BUFFER_TOO_SMALL && bufferSize < UINT16_MAX)
+        {
+            bufferSize = GrowSnapshotBufferSize(bufferSize);
+            continue;
+        }
+        ReturnErrorOnFailure(err);
+
+        TLV::TLVReader reader;
+        reader.Init(buffer.Get(), size);
+        ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, TLV::AnonymousTag()));
+        return RestoreSnapshot(reader);
+    }
+}
+
+template <bool CanEnableDataCaching>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::DeleteSnapshot(PersistentStorageDelegate & aStorage,
+                                                                    const ScopedNodeId & aNode)
+{
+    return aStorage.SyncDeleteKeyValue(
+        DefaultStorageKeyAllocator::ClusterStateCacheSnapshot(aNode.GetFabricIndex(), aNode.GetNodeId()).KeyName());
+}
+
 template class ClusterStateCacheT<true>;
 template class ClusterStateCacheT<false>;
 
@@ -27,6 +27,8 @@
 #include <app/ReadClient.h>
 #include <app/data-model/DecodableList.h>
 #include <app/data-model/Decode.h>
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/core/ScopedNodeId.h>
 #include <lib/support/Variant.h>
 #include <list>
 #include <map>
@@ -547,6 +549,32 @@ public:
      */
     CHIP_ERROR GetLastReportDataPath(ConcreteClusterPath & aPath);
 
+    /*
+     * Write a snapshot of the clusters with a known DataVersion: their DataVersion and their attribute values, statuses
+     * or sizes, as stored by this cache.  Events are not included.
+     *
+     * Restoring the snapshot on a controller restart lets the subscriptions established afterwards send DataVersionFilters
+     * for the restored clusters, so that only the clusters that changed since the snapshot are reported.
+     */
+    CHIP_ERROR WriteSnapshot(TLV::TLVWriter & aWriter, TLV::Tag aTag) const;
+
+    /*
+     * Restore a snapshot written by WriteSnapshot, replacing the cached state of its clusters.  This is meant to be
+     * done before the first subscription of the cache; the callbacks are not called for the restored attributes.
+     *
+     * On error, the clusters restored so far are kept.
+     */
+    CHIP_ERROR RestoreSnapshot(TLV::TLVReader & aReader);
+
+    /*
+     * Store a snapshot of the cache for a node, or restore it.  LoadSnapshot returns CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND
+     * when none was stored.  A snapshot larger than the storage values can hold is not stored, and
+     * CHIP_ERROR_BUFFER_TOO_SMALL is returned.
+     */
+    CHIP_ERROR StoreSnapshot(PersistentStorageDelegate & aStorage, const ScopedNodeId & aNode) const;
+    CHIP_ERROR LoadSnapshot(PersistentStorageDelegate & aStorage, const ScopedNodeId & aNode);
+    static CHIP_ERROR DeleteSnapshot(PersistentStorageDelegate & aStorage, const ScopedNodeId & aNode);
+
 private:
     // An attribute state can be one of three things:
     // * If we got a path-specific error for the attribute, the corresponding
@@ -687,6 +715,11 @@ private:
 
     CHIP_ERROR GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize);
 
+    CHIP_ERROR WriteClusterSnapshot(TLV::TLVWriter & aWriter, EndpointId aEndpointId, ClusterId aClusterId,
+                                    const ClusterState & aClusterState) const;
+    CHIP_ERROR RestoreClusterSnapshot(TLV::TLVReader & aReader);
+    CHIP_ERROR RestoreAttributeSnapshot(TLV::TLVReader & aReader, ClusterState & aClusterState);
+
     Callback & mCallback;
     NodeState mCache;
     std::set<ConcreteAttributePath> mChangedAttributeSet;
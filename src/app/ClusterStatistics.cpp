@@ -0,0 +1,245 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/ClusterStatistics.h>
+
+#include <lib/support/CodeUtils.h>
+#include <tracing/metric_event.h>
+#include <tracing/metric_keys.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace app {
+
+namespace {
+
+struct OperationMetricKeys
+{
+    const char * count;
+    const char * chunks;
+    const char * bytes;
+    const char * maxBytes;
+    const char * p50Us;
+    const char * p90Us;
+    const char * maxUs;
+};
+
+#define IM_CLUSTER_STATS_METRIC_KEYS(name)                                                                                         \
+    {                                                                                                                              \
+        "im_cluster_" name "_ctr", "im_cluster_" name "_chunks_ctr", "im_cluster_" name "_bytes", "im_cluster_" name "_max_bytes", \
+            "im_cluster_" name "_p50_us", "im_cluster_" name "_p90_us", "im_cluster_" name "_max_us"                               \
+    }
+
+// Indexed by ClusterOperation.
+const OperationMetricKeys sOperationMetricKeys[kNumClusterOperations] = {
+    IM_CLUSTER_STATS_METRIC_KEYS("read"),
+    IM_CLUSTER_STATS_METRIC_KEYS("write"),
+    IM_CLUSTER_STATS_METRIC_KEYS("invoke"),
+    IM_CLUSTER_STATS_METRIC_KEYS("report"),
+};
+
+#undef IM_CLUSTER_STATS_METRIC_KEYS
+
+#if CHIP_IM_SERVER_CLUSTER_STATS_ENTRIES > 0
+ClusterStatistics::Entry sEntries[CHIP_IM_SERVER_CLUSTER_STATS_ENTRIES];
+ClusterStatistics sServerStatistics{ Span<ClusterStatistics::Entry>(sEntries) };
+#endif
+
+uint32_t ClampToUint32(uint64_t value)
+{
+    return static_cast<uint32_t>(std::min<uint64_t>(value, UINT32_MAX));
+}
+
+} // namespace
+
+void DurationHistogram::Record(System::Clock::Microseconds64 duration)
+{
+    size_t bucket = 0;
+    for (uint64_t us = duration.count(); us > 0 && bucket < kNumBuckets - 1; us >>= 1)
+    {
+        bucket++;
+    }
+    mBuckets[bucket]++;
+}
+
+uint32_t DurationHistogram::GetTotalCount() const
+{
+    uint32_t total = 0;
+    for (uint32_t count : mBuckets)
+    {
+        total += count;
+    }
+    return total;
+}
+
+uint32_t DurationHistogram::GetPercentileUpperBoundUs(uint8_t percent) const
+{
+    const uint64_t total = GetTotalCount();
+    VerifyOrReturnValue(total > 0, 0);
+
+    // Smallest number of durations that makes the percentile, at least one.
+    const uint64_t wanted = std::max<uint64_t>((total * std::min<uint8_t>(percent, 100) + 99) / 100, 1);
+    uint64_t seen         = 0;
+    for (size_t bucket = 0; bucket < kNumBuckets - 1; bucket++)
+    {
+        seen += mBuckets[bucket];
+        if (seen >= wanted)
+        {
+            return GetBucketUpperBoundUs(bucket);
+        }
+    }
+    return GetBucketUpperBoundUs(kNumBuckets - 2);
+}
+
+#if CHIP_IM_SERVER_CLUSTER_STATS_ENTRIES > 0
+ClusterStatistics & ClusterStatistics::Instance()
+{
+    return sServerStatistics;
+}
+#endif
+
+ClusterStatistics::Entry * ClusterStatistics::FindOrAdd(ClusterId clusterId, uint32_t elementId)
+{
+    if (!mPerElement)
+    {
+        elementId = kAnyElement;
+    }
+
+    for (size_t i = 0; i < mNumEntriesInUse; i++)
+    {
+        if (mEntries[i].mClusterId == clusterId && mEntries[i].mElementId == elementId)
+        {
+            return &mEntries[i];
+        }
+    }
+
+    if (mNumEntriesInUse == mEntries.size())
+    {
+        mNumDroppedRecords++;
+        return nullptr;
+    }
+
+    Entry & entry    = mEntries[mNumEntriesInUse++];
+    entry            = Entry();
+    entry.mClusterId = clusterId;
+    entry.mElementId = elementId;
+    return &entry;
+}
+
+const ClusterStatistics::Entry * ClusterStatistics::Find(ClusterId clusterId, uint32_t elementId) const
+{
+    for (size_t i = 0; i < mNumEntriesInUse; i++)
+    {
+        if (mEntries[i].mClusterId == clusterId && mEntries[i].mElementId == (mPerElement ? elementId : kAnyElement))
+        {
+            return &mEntries[i];
+        }
+    }
+    return nullptr;
+}
+
+void ClusterStatistics::RecordDuration(ClusterOperation operation, ClusterId clusterId, uint32_t elementId,
+                                       System::Clock::Microseconds64 duration)
+{
+    Entry * entry = FindOrAdd(clusterId, elementId);
+    VerifyOrReturn(entry != nullptr);
+
+    ClusterOperationStats & stats = entry->mOperations[to_underlying(operation)];
+    stats.mCount++;
+    stats.mDurations.Record(duration);
+}
+
+void ClusterStatistics::RecordBytes(ClusterOperation operation, ClusterId clusterId, uint32_t elementId, size_t bytes)
+{
+    Entry * entry = FindOrAdd(clusterId, elementId);
+    VerifyOrReturn(entry != nullptr);
+
+    ClusterOperationStats & stats = entry->mOperations[to_underlying(operation)];
+    stats.mTotalBytes += bytes;
+    stats.mMaxBytes = std::max(stats.mMaxBytes, ClampToUint32(bytes));
+}
+
+void ClusterStatistics::RecordChunk(ClusterId clusterId, uint32_t elementId)
+{
+    Entry * entry = FindOrAdd(clusterId, elementId);
+    VerifyOrReturn(entry != nullptr);
+
+    entry->mOperations[to_underlying(ClusterOperation::kReport)].mChunks++;
+}
+
+void ClusterStatistics::Reset()
+{
+    mNumEntriesInUse   = 0;
+    mNumDroppedRecords = 0;
+}
+
+void ClusterStatistics::PublishMetrics() const
+{
+    using namespace chip::Tracing;
+
+    for (size_t i = 0; i < mNumEntriesInUse; i++)
+    {
+        const Entry & entry = mEntries[i];
+        MATTER_LOG_METRIC(kMetricIMClusterStatsCluster, static_cast<uint32_t>(entry.mClusterId));
+        MATTER_LOG_METRIC(kMetricIMClusterStatsElement, entry.mElementId);
+
+        for (size_t operation = 0; operation < kNumClusterOperations; operation++)
+        {
+            const ClusterOperationStats & stats = entry.mOperations[operation];
+            if (stats.mCount == 0 && stats.mTotalBytes == 0)
+            {
+                continue;
+            }
+
+            MATTER_LOG_METRIC(sOperationMetricKeys[operation].count, stats.mCount);
+            MATTER_LOG_METRIC(sOperationMetricKeys[operation].chunks, stats.mChunks);
+            MATTER_LOG_METRIC(sOperationMetricKeys[operation].bytes, ClampToUint32(stats.mTotalBytes));
+            MATTER_LOG_METRIC(sOperationMetricKeys[operation].maxBytes, stats.mMaxBytes);
+            MATTER_LOG_METRIC(sOperationMetricKeys[operation].p50Us, stats.mDurations.GetPercentileUpperBoundUs(50));
+            MATTER_LOG_METRIC(sOperationMetricKeys[operation].p90Us, stats.mDurations.GetPercentileUpperBoundUs(90));
+            MATTER_LOG_METRIC(sOperationMetricKeys[operation].maxUs, stats.mDurations.GetPercentileUpperBoundUs(100));
+        }
+    }
+
+    MATTER_LOG_METRIC(kMetricIMClusterStatsDropped, mNumDroppedRecords);
+}
+
+size_t ClusterStatistics::GetElementLength(const TLV::TLVReader & reader)
+{
+    TLV::TLVReader copy;
+    copy.Init(reader);
+    const uint32_t start = copy.GetLengthRead();
+    VerifyOrReturnValue(copy.Skip() == CHIP_NO_ERROR, 0);
+    return copy.GetLengthRead() - start;
+}
+
+ClusterStatistics::ScopedTimer::ScopedTimer(ClusterStatistics & statistics, ClusterOperation operation, ClusterId clusterId,
+                                            uint32_t elementId) :
+    mStatistics(statistics),
+    mOperation(operation), mClusterId(clusterId), mElementId(elementId),
+    mStart(System::SystemClock().GetMonotonicMicroseconds64())
+{}
+
+ClusterStatistics::ScopedTimer::~ScopedTimer()
+{
+    mStatistics.RecordDuration(mOperation, mClusterId, mElementId, System::SystemClock().GetMonotonicMicroseconds64() - mStart);
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,183 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/TLVReader.h>
+#include <lib/support/Span.h>
+#include <lib/support/TypeTraits.h>
+#include <system/SystemClock.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * The operations accounted for by ClusterStatistics.
+ */
+enum class ClusterOperation : uint8_t
+{
+    kReadAttribute,  ///< DataModel::Provider::ReadAttribute, including the reads done to build reports
+    kWriteAttribute, ///< DataModel::Provider::WriteAttribute
+    kInvoke,         ///< DataModel::Provider::Invoke
+    kReport,         ///< Encoding of the attribute data of a cluster into a ReportData, including access checks
+};
+
+inline constexpr size_t kNumClusterOperations = 4;
+
+/**
+ * Histogram of operation durations.  Bucket 0 counts the durations below 1 us, bucket i those in [2^(i-1), 2^i) us, and
+ * the last bucket everything longer.
+ */
+class DurationHistogram
+{
+public:
+    static constexpr size_t kNumBuckets = 20;
+
+    void Record(System::Clock::Microseconds64 duration);
+    uint32_t GetCount(size_t bucket) const { return mBuckets[bucket]; }
+    uint32_t GetTotalCount() const;
+
+    /**
+     * The upper bound, in microseconds, of the bucket holding the given percentile of the recorded durations, or 0 if
+     * none were recorded.  The last bucket reports the lower bound of its range.
+     */
+    uint32_t GetPercentileUpperBoundUs(uint8_t percent) const;
+
+    static uint32_t GetBucketUpperBoundUs(size_t bucket) { return static_cast<uint32_t>(1) << bucket; }
+
+private:
+    uint32_t mBuckets[kNumBuckets] = {};
+};
+
+struct ClusterOperationStats
+{
+    uint32_t mCount      = 0; ///< Number of timed operations
+    uint32_t mChunks     = 0; ///< kReport only: times the data of the cluster was split across ReportData messages
+    uint64_t mTotalBytes = 0; ///< TLV bytes of the write and invoke payloads, and of the attribute data reported
+    uint32_t mMaxBytes   = 0; ///< Largest single payload or report recorded
+    DurationHistogram mDurations;
+};
+
+/**
+ * Latency and size statistics of the interaction model operations served by the data model provider, kept per cluster
+ * (or per attribute and command), to find the clusters that make interactions slow or large.
+ *
+ * Entries are taken by the first clusters seen; the operations of other clusters are only counted as dropped.  The
+ * statistics are only touched from the Matter event loop.
+ *
+ * The server instance, Instance(), is only available when CHIP_IM_SERVER_CLUSTER_STATS_ENTRIES is not zero, and the
+ * IM_CLUSTER_STATS_* macros below compile to nothing otherwise.
+ */
+class ClusterStatistics
+{
+public:
+    /// Element id of the entries aggregating whole clusters.
+    static constexpr uint32_t kAnyElement = 0xFFFF'FFFF;
+
+    struct Entry
+    {
+        ClusterId mClusterId = kInvalidClusterId;
+        uint32_t mElementId  = kAnyElement;
+        ClusterOperationStats mOperations[kNumClusterOperations];
+
+        const ClusterOperationStats & Get(ClusterOperation operation) const { return mOperations[to_underlying(operation)]; }
+    };
+
+    /**
+     * @param[in] entries      Storage of the entries, which has to outlive the statistics.
+     * @param[in] perElement   Whether the entries are kept per attribute and command rather than per cluster.
+     */
+    ClusterStatistics(Span<Entry> entries, bool perElement = CHIP_IM_SERVER_CLUSTER_STATS_PER_ELEMENT) :
+        mEntries(entries), mPerElement(perElement)
+    {}
+
+#if CHIP_IM_SERVER_CLUSTER_STATS_ENTRIES > 0
+    static ClusterStatistics & Instance();
+#endif
+
+    void RecordDuration(ClusterOperation operation, ClusterId clusterId, uint32_t elementId,
+                        System::Clock::Microseconds64 duration);
+    void RecordBytes(ClusterOperation operation, ClusterId clusterId, uint32_t elementId, size_t bytes);
+    void RecordChunk(ClusterId clusterId, uint32_t elementId);
+
+    size_t GetNumEntriesInUse() const { return mNumEntriesInUse; }
+    const Entry & GetEntry(size_t index) const { return mEntries[index]; }
+    const Entry * Find(ClusterId clusterId, uint32_t elementId = kAnyElement) const;
+    uint32_t GetNumDroppedRecords() const { return mNumDroppedRecords; }
+
+    void Reset();
+
+    /**
+     * Emit the statistics as metric events.  The metrics of each entry follow a kMetricIMClusterStatsCluster and a
+     * kMetricIMClusterStatsElement event naming it, and use the same keys for all entries.
+     */
+    void PublishMetrics() const;
+
+    /**
+     * The number of TLV bytes left to read to get past the element the reader is positioned on: the data of strings and
+     * the contents of containers.  Scalars, whose values are read together with their control byte and tag, count as 0.
+     */
+    static size_t GetElementLength(const TLV::TLVReader & reader);
+
+    /**
+     * Records the time from its construction to its destruction as the duration of an operation.
+     */
+    class ScopedTimer
+    {
+    public:
+        ScopedTimer(ClusterStatistics & statistics, ClusterOperation operation, ClusterId clusterId, uint32_t elementId);
+        ~ScopedTimer();
+
+    private:
+        ClusterStatistics & mStatistics;
+        const ClusterOperation mOperation;
+        const ClusterId mClusterId;
+        const uint32_t mElementId;
+        const System::Clock::Microseconds64 mStart;
+    };
+
+private:
+    Entry * FindOrAdd(ClusterId clusterId, uint32_t elementId);
+
+    Span<Entry> mEntries;
+    const bool mPerElement;
+    size_t mNumEntriesInUse     = 0;
+    uint32_t mNumDroppedRecords = 0;
+};
+
+} // namespace app
+} // namespace chip
+
+#if CHIP_IM_SERVER_CLUSTER_STATS_ENTRIES > 0
+#define IM_CLUSTER_STATS_TIME(operation, clusterId, elementId)                                                                     \
+    ::chip::app::ClusterStatistics::ScopedTimer _imClusterStatsTimer(::chip::app::ClusterStatistics::Instance(),                   \
+                                                                     ::chip::app::ClusterOperation::operation, clusterId, elementId)
+#define IM_CLUSTER_STATS_RECORD_BYTES(operation, clusterId, elementId, bytes)                                                      \
+    ::chip::app::ClusterStatistics::Instance().RecordBytes(::chip::app::ClusterOperation::operation, clusterId, elementId, bytes)
+#define IM_CLUSTER_STATS_RECORD_CHUNK(clusterId, elementId)                                                                        \
+    ::chip::app::ClusterStatistics::Instance().RecordChunk(clusterId, elementId)
+#else // CHIP_IM_SERVER_CLUSTER_STATS_ENTRIES > 0
+#define IM_CLUSTER_STATS_TIME(operation, clusterId, elementId)
+#define IM_CLUSTER_STATS_RECORD_BYTES(operation, clusterId, elementId, bytes)
+#define IM_CLUSTER_STATS_RECORD_CHUNK(clusterId, elementId)
+#endif // CHIP_IM_SERVER_CLUSTER_STATS_ENTRIES > 0
@@ -96,6 +96,18 @@ public:
      */
     virtual void AddInvokeResponseToSend(System::PacketBufferHandle && aPacket) = 0;
 
+    /**
+     * @brief Called to indicate that some of the work of a batched InvokeRequest completed while other
+     * commands of the batch are still being processed asynchronously.
+     *
+     * Implementations may start sending the InvokeResponseMessages already added with AddInvokeResponseToSend,
+     * instead of holding them until the CommandHandler is done. Whatever is not sent here must still be sent
+     * once the CommandHandler is done. The default implementation holds all the messages until then.
+     *
+     * Called by CommandHandler, only after the initial processing of the InvokeRequestMessage has completed.
+     */
+    virtual void InvokeResponsesReadyToSend() {}
+
     /**
      * @brief Called to indicate that an InvokeResponse was dropped.
      *
@@ -258,6 +258,8 @@ Status CommandHandlerImpl::ProcessInvokeRequest(System::PacketBufferHandle && pa
         mReserveSpaceForMoreChunkMessages = true;
     }
 
+    // The arena outlives the dispatch: a command going async may keep using what it allocated until the handler closes.
+    InteractionArena::Scope arenaScope(mArena);
     while (CHIP_NO_ERROR == (err = invokeRequestsReader.Next()))
     {
         VerifyOrReturnError(TLV::AnonymousTag() == invokeRequestsReader.GetTag(), Status::InvalidAction);
@@ -301,6 +303,7 @@ void CommandHandlerImpl::Close()
     VerifyOrDieWithMsg(mPendingWork == 0, DataManagement, "CommandHandlerImpl::Close() called with %u unfinished async work items",
                        static_cast<unsigned int>(mPendingWork));
     InvalidateHandles();
+    mArena.Reset();
 
     if (mpCallback)
     {
@@ -345,6 +348,12 @@ void CommandHandlerImpl::DecrementHoldOff(Handle * apHandle)
 
     if (mPendingWork != 0)
     {
+        // Some asynchronous work of the batch completed: the responder may send the full response messages already queued,
+        // rather than having the requester wait for the slowest command of the batch.
+        if (mGoneAsync && mpResponder != nullptr && !IsGroupRequest())
+        {
+            mpResponder->InvokeResponsesReadyToSend();
+        }
         return;
     }
 
@@ -478,8 +487,12 @@ Status CommandHandlerImpl::ProcessGroupCommandDataIB(CommandDataIB::Parser & aCo
     // No check for `CommandIsFabricScoped` unlike in `ProcessCommandDataIB()` since group commands
     // always have an accessing fabric, by definition.
 
-    // Find which endpoints can process the command, and dispatch to them.
-    iterator = groupDataProvider->IterateEndpoints(fabric);
+    // Find which endpoints can process the command, and dispatch to them in batches: the command is run once all the endpoints
+    // of a batch are checked, so that a handler may process it for the whole batch at once.
+    EndpointId endpoints[CHIP_CONFIG_GROUP_COMMAND_ENDPOINT_BATCH_SIZE];
+    size_t endpointCount = 0;
+
+    iterator = groupDataProvider->IterateEndpoints(fabric, groupId);
     VerifyOrReturnError(iterator != nullptr, Status::Failure);
 
     while (iterator->Next(mapping))
@@ -489,17 +502,12 @@ Status CommandHandlerImpl::ProcessGroupCommandDataIB(CommandDataIB::Parser & aCo
             continue;
         }
 
-        ChipLogDetail(DataManagement,
-                      "Processing group command for Endpoint=%u Cluster=" ChipLogFormatMEI " Command=" ChipLogFormatMEI,
-                      mapping.endpoint_id, ChipLogValueMEI(clusterId), ChipLogValueMEI(commandId));
-
-        const ConcreteCommandPath concretePath(mapping.endpoint_id, clusterId, commandId);
-
+        // Access is checked for each endpoint, as access control entries may target specific endpoints.
         {
             Access::SubjectDescriptor subjectDescriptor = GetSubjectDescriptor();
             DataModel::InvokeRequest request;
 
-            request.path              = concretePath;
+            request.path              = ConcreteCommandPath(mapping.endpoint_id, clusterId, commandId);
             request.subjectDescriptor = &subjectDescriptor;
             request.invokeFlags.Set(DataModel::InvokeFlags::kTimed, IsTimedInvoke());
 
@@ -511,23 +519,58 @@ Status CommandHandlerImpl::ProcessGroupCommandDataIB(CommandDataIB::Parser & aCo
             }
         }
 
-        if ((err = DataModelCallbacks::GetInstance()->PreCommandReceived(concretePath, GetSubjectDescriptor())) == CHIP_NO_ERROR)
+        if (endpointCount == ArraySize(endpoints))
         {
-            TLV::TLVReader dataReader(commandDataReader);
-            mpCallback->DispatchCommand(*this, concretePath, dataReader);
-            DataModelCallbacks::GetInstance()->PostCommandReceived(concretePath, GetSubjectDescriptor());
+            DispatchGroupCommand(clusterId, commandId, Span<EndpointId>(endpoints, endpointCount), commandDataReader);
+            endpointCount = 0;
         }
-        else
+        endpoints[endpointCount++] = mapping.endpoint_id;
+    }
+    iterator->Release();
+
+    DispatchGroupCommand(clusterId, commandId, Span<EndpointId>(endpoints, endpointCount), commandDataReader);
+    return Status::Success;
+}
+
+void CommandHandlerImpl::DispatchGroupCommand(ClusterId aClusterId, CommandId aCommandId, Span<EndpointId> aEndpoints,
+                                              const TLV::TLVReader & aCommandDataReader)
+{
+    size_t endpointCount = 0;
+    for (EndpointId endpoint : aEndpoints)
+    {
+        const ConcreteCommandPath concretePath(endpoint, aClusterId, aCommandId);
+        CHIP_ERROR err = DataModelCallbacks::GetInstance()->PreCommandReceived(concretePath, GetSubjectDescriptor());
+        if (err != CHIP_NO_ERROR)
         {
             ChipLogError(DataManagement,
                          "Error when calling PreCommandReceived for Endpoint=%u Cluster=" ChipLogFormatMEI
                          " Command=" ChipLogFormatMEI " : %" CHIP_ERROR_FORMAT,
-                         mapping.endpoint_id, ChipLogValueMEI(clusterId), ChipLogValueMEI(commandId), err.Format());
+                         endpoint, ChipLogValueMEI(aClusterId), ChipLogValueMEI(aCommandId), err.Format());
             continue;
         }
+        aEndpoints[endpointCount++] = endpoint;
+    }
+    VerifyOrReturn(endpointCount > 0);
+    aEndpoints = aEndpoints.SubSpan(0, endpointCount);
+
+    TLV::TLVReader groupDataReader(aCommandDataReader);
+    const ConcreteCommandPath firstPath(aEndpoints[0], aClusterId, aCommandId);
+    const bool dispatchedToAll = mpCallback->DispatchGroupCommand(*this, firstPath, aEndpoints, groupDataReader);
+
+    for (EndpointId endpoint : aEndpoints)
+    {
+        const ConcreteCommandPath concretePath(endpoint, aClusterId, aCommandId);
+        if (!dispatchedToAll)
+        {
+            ChipLogDetail(DataManagement,
+                          "Processing group command for Endpoint=%u Cluster=" ChipLogFormatMEI " Command=" ChipLogFormatMEI,
+                          endpoint, ChipLogValueMEI(aClusterId), ChipLogValueMEI(aCommandId));
+
+            TLV::TLVReader dataReader(aCommandDataReader);
+            mpCallback->DispatchCommand(*this, concretePath, dataReader);
+        }
+        DataModelCallbacks::GetInstance()->PostCommandReceived(concretePath, GetSubjectDescriptor());
     }
-    iterator->Release();
-    return Status::Success;
 }
 
 CHIP_ERROR CommandHandlerImpl::TryAddStatusInternal(const ConcreteCommandPath & aCommandPath, const StatusIB & aStatus)
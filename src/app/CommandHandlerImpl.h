@@ -19,6 +19,7 @@
 #include <app/CommandHandler.h>
 
 #include <app/CommandPathRegistry.h>
+#include <app/InteractionArena.h>
 #include <app/MessageDef/InvokeRequestMessage.h>
 #include <app/MessageDef/InvokeResponseMessage.h>
 #include <app/data-model-provider/OperationTypes.h>
@@ -74,6 +75,19 @@ public:
          */
         virtual void DispatchCommand(CommandHandlerImpl & apCommandObj, const ConcreteCommandPath & aCommandPath,
                                      TLV::TLVReader & apPayload) = 0;
+
+        /*
+         * Dispatches a group command to several endpoints at once. aCommandPath is the path of the command on the first of
+         * aEndpoints, all of which passed ValidateCommandCanBeDispatched.
+         *
+         * Returns true if the command was dispatched to all the endpoints, false if DispatchCommand is to be called for each
+         * of them.
+         */
+        virtual bool DispatchGroupCommand(CommandHandlerImpl & apCommandObj, const ConcreteCommandPath & aCommandPath,
+                                          Span<const EndpointId> aEndpoints, TLV::TLVReader & apPayload)
+        {
+            return false;
+        }
     };
 
     struct InvokeResponseParameters
@@ -165,6 +179,12 @@ public:
     Protocols::InteractionModel::Status OnInvokeCommandRequest(CommandHandlerExchangeInterface & commandResponder,
                                                                System::PacketBufferHandle && payload, bool isTimedInvoke);
 
+    /**
+     * Scratch memory for the commands of this invoke, released when the handler closes.  It is also
+     * InteractionArena::Current() while the commands are being dispatched.
+     */
+    InteractionArena & GetArena() { return mArena; }
+
     /**
      * Checks that all CommandDataIB within InvokeRequests satisfy the spec's general
      * constraints for CommandDataIB. Additionally checks that InvokeRequestMessage is
@@ -411,6 +431,13 @@ private:
      */
     Protocols::InteractionModel::Status ProcessGroupCommandDataIB(CommandDataIB::Parser & aCommandElement);
 
+    /**
+     * Dispatches a group command to endpoints on which it passed its checks, all at once if the callback supports it.
+     * aEndpoints is modified: the endpoints for which PreCommandReceived fails are removed from it.
+     */
+    void DispatchGroupCommand(ClusterId aClusterId, CommandId aCommandId, Span<EndpointId> aEndpoints,
+                              const TLV::TLVReader & aCommandDataReader);
+
     CHIP_ERROR TryAddStatusInternal(const ConcreteCommandPath & aCommandPath, const StatusIB & aStatus);
 
     CHIP_ERROR AddStatusInternal(const ConcreteCommandPath & aCommandPath, const StatusIB & aStatus);
@@ -462,6 +489,7 @@ private:
 
     chip::System::PacketBufferTLVWriter mCommandMessageWriter;
     TLV::TLVWriter mBackupWriter;
+    InteractionArena mArena;
     size_t mMaxPathsPerInvoke = CHIP_CONFIG_MAX_PATHS_PER_INVOKE;
     // TODO(#30453): See if we can reduce this size for the default cases
     // TODO Allow flexibility in registration.
@@ -25,6 +25,7 @@
 #include <app/data-model/List.h> // So we can encode lists
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/Iterators.h>
+#include <lib/support/Span.h>
 
 namespace chip {
 namespace app {
@@ -101,6 +102,20 @@ public:
      */
     virtual void InvokeCommand(HandlerContext & handlerContext) = 0;
 
+    /**
+     * Function that may be implemented to handle a group command for several endpoints at once, rather than through one
+     * InvokeCommand call per endpoint: the payload is then decoded once, and the command applied to all the endpoints
+     * together.
+     *
+     * @param [in] handlerContext Context of the request for the first of aEndpoints. Handlers call SetCommandHandled()
+     *                            only if they handled the command for all of aEndpoints, otherwise InvokeCommand is called
+     *                            for each of them.
+     * @param [in] aEndpoints     Endpoints of the group this handler is used for, on which the command passed its checks.
+     *
+     * Group commands have no response: there is no status to add to the handler.
+     */
+    virtual void InvokeGroupCommand(HandlerContext & handlerContext, Span<const EndpointId> aEndpoints) {}
+
     typedef Loop (*CommandIdCallback)(CommandId id, void * context);
 
     /**
@@ -227,6 +242,9 @@ protected:
     Optional<EndpointId> GetEndpointId() { return mEndpointId; }
 
 private:
+    // Indexes the interfaces by their endpoint and cluster.
+    friend class CommandHandlerInterfaceRegistry;
+
     Optional<EndpointId> mEndpointId;
     ClusterId mClusterId;
     CommandHandlerInterface * mNext = nullptr;
@@ -28,113 +28,44 @@ CommandHandlerInterfaceRegistry & CommandHandlerInterfaceRegistry::Instance()
 
 void CommandHandlerInterfaceRegistry::UnregisterAllHandlers()
 {
-
-    CommandHandlerInterface * handlerIter = mCommandHandlerList;
-
-    //
-    // Walk our list of command handlers and de-register them, before finally
-    // nulling out the list entirely.
-    //
-    while (handlerIter)
-    {
-        CommandHandlerInterface * nextHandler = handlerIter->GetNext();
-        handlerIter->SetNext(nullptr);
-        handlerIter = nextHandler;
-    }
-
-    mCommandHandlerList = nullptr;
+    mCommandHandlers.RemoveAll();
 }
 
 CHIP_ERROR CommandHandlerInterfaceRegistry::RegisterCommandHandler(CommandHandlerInterface * handler)
 {
     VerifyOrReturnError(handler != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
-    for (auto * cur = mCommandHandlerList; cur; cur = cur->GetNext())
+    if (mCommandHandlers.FindConflict(*handler, handler->mEndpointId, handler->mClusterId) != nullptr)
     {
-        if (cur->Matches(*handler))
-        {
-            ChipLogError(InteractionModel, "Duplicate command handler registration failed");
-            return CHIP_ERROR_INCORRECT_STATE;
-        }
+        ChipLogError(InteractionModel, "Duplicate command handler registration failed");
+        return CHIP_ERROR_INCORRECT_STATE;
     }
 
-    handler->SetNext(mCommandHandlerList);
-    mCommandHandlerList = handler;
+    mCommandHandlers.Insert(handler, handler->mEndpointId, handler->mClusterId);
 
     return CHIP_NO_ERROR;
 }
 
 void CommandHandlerInterfaceRegistry::UnregisterAllCommandHandlersForEndpoint(EndpointId endpointId)
 {
-    CommandHandlerInterface * prev = nullptr;
-
-    for (auto * cur = mCommandHandlerList; cur;)
-    {
-        // Fetch next node in the list before we remove this one.
-        auto * next = cur->GetNext();
-
-        if (cur->MatchesEndpoint(endpointId))
-        {
-            if (prev == nullptr)
-            {
-                mCommandHandlerList = cur->GetNext();
-            }
-            else
-            {
-                prev->SetNext(cur->GetNext());
-            }
-
-            cur->SetNext(nullptr);
-        }
-        else
-        {
-            prev = cur;
-        }
-
-        cur = next;
-    }
+    mCommandHandlers.RemoveAllForEndpoint(endpointId);
 }
 
 CHIP_ERROR CommandHandlerInterfaceRegistry::UnregisterCommandHandler(CommandHandlerInterface * handler)
 {
     VerifyOrReturnError(handler != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
-    CommandHandlerInterface * prev = nullptr;
-
-    for (auto * cur = mCommandHandlerList; cur; cur = cur->GetNext())
-    {
-        if (cur->Matches(*handler))
-        {
-            if (prev == nullptr)
-            {
-                mCommandHandlerList = cur->GetNext();
-            }
-            else
-            {
-                prev->SetNext(cur->GetNext());
-            }
-
-            cur->SetNext(nullptr);
-
-            return CHIP_NO_ERROR;
-        }
 
-        prev = cur;
-    }
+    // Unregisters the handler registered for the commands of `handler`, which may not be `handler` itself.
+    CommandHandlerInterface * registered = mCommandHandlers.FindConflict(*handler, handler->mEndpointId, handler->mClusterId);
+    VerifyOrReturnError(registered != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
 
-    return CHIP_ERROR_KEY_NOT_FOUND;
+    mCommandHandlers.Remove(registered, registered->mEndpointId, registered->mClusterId);
+    return CHIP_NO_ERROR;
 }
 
 CommandHandlerInterface * CommandHandlerInterfaceRegistry::GetCommandHandler(EndpointId endpointId, ClusterId clusterId)
 {
-    for (auto * cur = mCommandHandlerList; cur; cur = cur->GetNext())
-    {
-        if (cur->Matches(endpointId, clusterId))
-        {
-            return cur;
-        }
-    }
-
-    return nullptr;
+    return mCommandHandlers.Find(endpointId, clusterId);
 }
 
 } // namespace app
@@ -16,13 +16,15 @@
 #pragma once
 
 #include <app/CommandHandlerInterface.h>
+#include <app/EndpointClusterRegistrationIndex.h>
+#include <lib/core/CHIPConfig.h>
 
 namespace chip {
 namespace app {
 
-/// Keeps track of a list of registered command handler interfaces
+/// Keeps track of the registered command handler interfaces, hashed by endpoint and cluster
 ///
-/// NOTE: command handler interface objects are IntrusiveList elements (i.e.
+/// NOTE: command handler interface objects are intrusive list elements (i.e.
 ///       their pointers are contained within). As a result, a command handler
 ///       may only ever be part of a single registry.
 class CommandHandlerInterfaceRegistry
@@ -53,7 +55,7 @@ public:
     static CommandHandlerInterfaceRegistry & Instance();
 
 private:
-    CommandHandlerInterface * mCommandHandlerList = nullptr;
+    EndpointClusterRegistrationIndex<CommandHandlerInterface, CHIP_IM_SERVER_INTERFACE_REGISTRY_BUCKETS> mCommandHandlers;
 };
 
 } // namespace app
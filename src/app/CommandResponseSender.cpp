@@ -19,6 +19,8 @@
 #include "InteractionModelEngine.h"
 #include "messaging/ExchangeContext.h"
 
+#include <lib/support/Scoped.h>
+
 namespace chip {
 namespace app {
 using Status = Protocols::InteractionModel::Status;
@@ -38,13 +40,21 @@ CHIP_ERROR CommandResponseSender::OnMessageReceived(Messaging::ExchangeContext *
         err = statusError;
         VerifyOrExit(err == CHIP_NO_ERROR, failureStatusToSend.SetValue(Status::InvalidAction));
 
+        if (mChunks.IsNull() && !mCommandHandlerDone)
+        {
+            // The messages sent early are all acknowledged; keep the exchange until the CommandHandler queues the next one.
+            MoveToState(State::AwaitingInvokeResponses);
+            mExchangeCtx->WillSendMessage();
+            return CHIP_NO_ERROR;
+        }
+
         err = SendCommandResponse();
         // If SendCommandResponse() fails, we must close the exchange. We signal the failure to the
         // requester with a StatusResponse ('Failure'). Since we're in the middle of processing an
         // incoming message, we close the exchange by indicating that we don't expect a further response.
         VerifyOrExit(err == CHIP_NO_ERROR, failureStatusToSend.SetValue(Status::Failure));
 
-        bool moreToSend = !mChunks.IsNull();
+        bool moreToSend = !mChunks.IsNull() || !mCommandHandlerDone;
         if (!moreToSend)
         {
             // We are sending the final message and do not anticipate any further responses. We are
@@ -61,12 +71,12 @@ CHIP_ERROR CommandResponseSender::OnMessageReceived(Messaging::ExchangeContext *
         failureStatusToSend.SetValue(Status::Failure);
         ExitNow();
     }
-    StatusResponse::Send(Status::InvalidAction, mExchangeCtx.Get(), false /*aExpectResponse*/);
+    StatusResponse::Send(Status::InvalidAction, mExchangeCtx.Get(), false /*aExpectResponse*/, std::move(aPayload));
     return err;
 exit:
     if (failureStatusToSend.HasValue())
     {
-        StatusResponse::Send(failureStatusToSend.Value(), mExchangeCtx.Get(), false /*aExpectResponse*/);
+        StatusResponse::Send(failureStatusToSend.Value(), mExchangeCtx.Get(), false /*aExpectResponse*/, std::move(aPayload));
     }
     Close();
     return err;
@@ -81,7 +91,7 @@ void CommandResponseSender::OnResponseTimeout(Messaging::ExchangeContext * apExc
 
 void CommandResponseSender::StartSendingCommandResponses()
 {
-    VerifyOrDie(mState == State::ReadyForInvokeResponses);
+    VerifyOrDie(mState == State::ReadyForInvokeResponses || mState == State::AwaitingInvokeResponses);
     CHIP_ERROR err = SendCommandResponse();
     if (err != CHIP_NO_ERROR)
     {
@@ -102,7 +112,7 @@ void CommandResponseSender::StartSendingCommandResponses()
         return;
     }
 
-    if (HasMoreToSend())
+    if (HasMoreToSend() || !mCommandHandlerDone)
     {
         MoveToState(State::AwaitingStatusResponse);
         mExchangeCtx->SetDelegate(this);
@@ -115,6 +125,7 @@ void CommandResponseSender::StartSendingCommandResponses()
 
 void CommandResponseSender::OnDone(CommandHandlerImpl & apCommandObj)
 {
+    mCommandHandlerDone = true;
     if (mState == State::ErrorSentDelayCloseUntilOnDone)
     {
         // We have already sent a message to the client indicating that we are not expecting
@@ -122,6 +133,20 @@ void CommandResponseSender::OnDone(CommandHandlerImpl & apCommandObj)
         Close();
         return;
     }
+    if (mState == State::AwaitingStatusResponse)
+    {
+        // Some InvokeResponses were sent early; the rest go out as the requester acknowledges them.
+        return;
+    }
+    StartSendingCommandResponses();
+}
+
+void CommandResponseSender::InvokeResponsesReadyToSend()
+{
+    // An error StatusResponse may still replace the queued InvokeResponses until the initial processing is over.
+    VerifyOrReturn(!mProcessingInvokeRequest);
+    VerifyOrReturn(mState == State::ReadyForInvokeResponses || mState == State::AwaitingInvokeResponses);
+    VerifyOrReturn(!mChunks.IsNull());
     StartSendingCommandResponses();
 }
 
@@ -151,7 +176,7 @@ CHIP_ERROR CommandResponseSender::SendCommandResponse()
     System::PacketBufferHandle commandResponsePayload = mChunks.PopHead();
 
     Messaging::SendFlags sendFlag = Messaging::SendMessageFlags::kNone;
-    if (HasMoreToSend())
+    if (HasMoreToSend() || !mCommandHandlerDone)
     {
         sendFlag = Messaging::SendMessageFlags::kExpectResponse;
         mExchangeCtx->UseSuggestedResponseTimeout(app::kExpectedIMProcessingTime);
@@ -174,6 +199,9 @@ const char * CommandResponseSender::GetStateStr() const
     case State::AwaitingStatusResponse:
         return "AwaitingStatusResponse";
 
+    case State::AwaitingInvokeResponses:
+        return "AwaitingInvokeResponses";
+
     case State::AllInvokeResponsesSent:
         return "AllInvokeResponsesSent";
 
@@ -196,6 +224,14 @@ void CommandResponseSender::MoveToState(const State aTargetState)
 
 void CommandResponseSender::Close()
 {
+    if (!mCommandHandlerDone)
+    {
+        // The exchange failed after InvokeResponses were sent early. mCommandHandler still has pending work and must not
+        // outlive this object, so only give up the exchange now and finish closing in OnDone.
+        mExchangeCtx.Release();
+        MoveToState(State::ErrorSentDelayCloseUntilOnDone);
+        return;
+    }
     MoveToState(State::AllInvokeResponsesSent);
     mpCallback->OnDone(*this);
 }
@@ -214,16 +250,21 @@ void CommandResponseSender::OnInvokeCommandRequest(Messaging::ExchangeContext *
     // Grabbing Handle to prevent mCommandHandler from calling OnDone before OnInvokeCommandRequest returns.
     // This allows us to send a StatusResponse error instead of any potentially queued up InvokeResponseMessages.
     CommandHandler::Handle workHandle(&mCommandHandler);
-    Status status = mCommandHandler.OnInvokeCommandRequest(*this, std::move(payload), isTimedInvoke);
-    if (status != Status::Success)
     {
-        VerifyOrDie(mState == State::ReadyForInvokeResponses);
-        SendStatusResponse(status);
-        // The API contract of OnInvokeCommandRequest requires the CommandResponder instance to outlive
-        // the CommandHandler. Therefore, we cannot safely call Close() here, even though we have
-        // finished sending data. Closing must be deferred until the CommandHandler::OnDone callback.
-        MoveToState(State::ErrorSentDelayCloseUntilOnDone);
+        ScopedChange<bool> processingInvokeRequest(mProcessingInvokeRequest, true);
+        Status status = mCommandHandler.OnInvokeCommandRequest(*this, std::move(payload), isTimedInvoke);
+        if (status != Status::Success)
+        {
+            VerifyOrDie(mState == State::ReadyForInvokeResponses);
+            SendStatusResponse(status);
+            // The API contract of OnInvokeCommandRequest requires the CommandResponder instance to outlive
+            // the CommandHandler. Therefore, we cannot safely call Close() here, even though we have
+            // finished sending data. Closing must be deferred until the CommandHandler::OnDone callback.
+            MoveToState(State::ErrorSentDelayCloseUntilOnDone);
+        }
     }
+    // Releasing workHandle either completes the CommandHandler, or lets the InvokeResponses already queued go out
+    // while asynchronous commands of the batch are pending.
 }
 
 size_t CommandResponseSender::GetCommandResponseMaxBufferSize()
@@ -118,10 +118,21 @@ public:
 
     void AddInvokeResponseToSend(System::PacketBufferHandle && aPacket) override
     {
-        VerifyOrDie(mState == State::ReadyForInvokeResponses);
+        // The exchange is gone after an error, so the InvokeResponses still coming from mCommandHandler are dropped.
+        VerifyOrReturn(mState != State::ErrorSentDelayCloseUntilOnDone);
+        VerifyOrDie(mState == State::ReadyForInvokeResponses || mState == State::AwaitingStatusResponse ||
+                    mState == State::AwaitingInvokeResponses);
         mChunks.AddToEnd(std::move(aPacket));
     }
 
+    /**
+     * Starts sending the InvokeResponseMessages queued so far, if none is already awaiting a status response.
+     *
+     * The requester acknowledges each InvokeResponseMessage with a StatusResponse, so that the messages completed early in a
+     * batch reach it while the slower commands of the batch are still being processed.
+     */
+    void InvokeResponsesReadyToSend() override;
+
     void ResponseDropped() override { mReportResponseDropped = true; }
 
     size_t GetCommandResponseMaxBufferSize() override;
@@ -159,6 +170,7 @@ private:
     {
         ReadyForInvokeResponses,       ///< Accepting InvokeResponses to send back to requester.
         AwaitingStatusResponse,        ///< Awaiting status response from requester, after sending InvokeResponse.
+        AwaitingInvokeResponses,       ///< All queued InvokeResponses were sent, awaiting more from the CommandHandler.
         AllInvokeResponsesSent,        ///< All InvokeResponses have been sent out.
         ErrorSentDelayCloseUntilOnDone ///< We have sent an early error response, but still need to clean up.
     };
@@ -190,6 +202,10 @@ private:
     State mState = State::ReadyForInvokeResponses;
 
     bool mReportResponseDropped = false;
+    // Set once the CommandHandler is done, and no more InvokeResponses will be queued.
+    bool mCommandHandlerDone = false;
+    // Set while the initial processing of the InvokeRequestMessage may still end with an error StatusResponse.
+    bool mProcessingInvokeRequest = false;
 };
 
 } // namespace app
@@ -0,0 +1,598 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/CompactClusterStateCache.h>
+
+#include <lib/core/TLVWriter.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+#include <new>
+
+#if CHIP_CONFIG_ENABLE_READ_CLIENT
+namespace chip {
+namespace app {
+
+namespace {
+
+// Determine how much space a StatusIB takes up on the wire; see ClusterStateCache.
+uint32_t SizeOfStatusIB(const StatusIB & aStatus)
+{
+    return aStatus.mClusterStatus.HasValue() ? 8 : 5;
+}
+
+} // anonymous namespace
+
+ClusterStateArena::~ClusterStateArena()
+{
+    while (mpFreeBlocks != nullptr)
+    {
+        Block * block = mpFreeBlocks;
+        mpFreeBlocks  = block->mpNext;
+        Platform::MemoryFree(block);
+    }
+}
+
+ClusterStateArena::Block * ClusterStateArena::Allocate(uint32_t aMinCapacity)
+{
+    if (aMinCapacity <= mBlockSize && mpFreeBlocks != nullptr)
+    {
+        Block * block = mpFreeBlocks;
+        mpFreeBlocks  = block->mpNext;
+        mNumFreeBlocks--;
+        block->mpNext = nullptr;
+        block->mUsed  = 0;
+        return block;
+    }
+
+    const uint32_t capacity = std::max(mBlockSize, aMinCapacity);
+    void * memory           = Platform::MemoryAlloc(sizeof(Block) + capacity);
+    VerifyOrReturnValue(memory != nullptr, nullptr);
+
+    Block * block    = new (memory) Block();
+    block->mCapacity = capacity;
+    return block;
+}
+
+void ClusterStateArena::Release(Block * apBlocks)
+{
+    while (apBlocks != nullptr)
+    {
+        Block * block = apBlocks;
+        apBlocks      = block->mpNext;
+
+        // Only the blocks of the regular size can be handed out again.
+        if (block->mCapacity == mBlockSize && mNumFreeBlocks < mMaxFreeBlocks)
+        {
+            block->mpNext = mpFreeBlocks;
+            mpFreeBlocks  = block;
+            mNumFreeBlocks++;
+        }
+        else
+        {
+            Platform::MemoryFree(block);
+        }
+    }
+}
+
+CompactClusterStateCache::~CompactClusterStateCache()
+{
+    mArena.Release(mpBlocks);
+}
+
+CompactClusterStateCache::AttributeIterator CompactClusterStateCache::LowerBound(uint64_t clusterKey,
+                                                                                 AttributeId attributeId) const
+{
+    return std::lower_bound(mAttributes.begin(), mAttributes.end(), std::make_pair(clusterKey, attributeId),
+                            [](const AttributeEntry & entry, const std::pair<uint64_t, AttributeId> & key) {
+                                return entry.mClusterKey < key.first ||
+                                    (entry.mClusterKey == key.first && entry.mAttributeId < key.second);
+                            });
+}
+
+CompactClusterStateCache::AttributeIterator CompactClusterStateCache::FindAttribute(const ConcreteAttributePath & path) const
+{
+    const uint64_t key = ClusterKey(path.mEndpointId, path.mClusterId);
+    auto iter          = LowerBound(key, path.mAttributeId);
+    if (iter != mAttributes.end() && iter->mClusterKey == key && iter->mAttributeId == path.mAttributeId)
+    {
+        return iter;
+    }
+    return mAttributes.end();
+}
+
+CompactClusterStateCache::ClusterIterator CompactClusterStateCache::LowerBoundCluster(uint64_t clusterKey) const
+{
+    return std::lower_bound(mClusters.begin(), mClusters.end(), clusterKey,
+                            [](const ClusterEntry & entry, uint64_t key) { return entry.mClusterKey < key; });
+}
+
+CompactClusterStateCache::ClusterIterator CompactClusterStateCache::FindCluster(uint64_t clusterKey) const
+{
+    auto iter = LowerBoundCluster(clusterKey);
+    return (iter != mClusters.end() && iter->mClusterKey == clusterKey) ? iter : mClusters.end();
+}
+
+CompactClusterStateCache::ClusterEntry & CompactClusterStateCache::GetOrCreateCluster(uint64_t clusterKey)
+{
+    auto iter = mClusters.begin() + (LowerBoundCluster(clusterKey) - mClusters.cbegin());
+    if (iter == mClusters.end() || iter->mClusterKey != clusterKey)
+    {
+        ClusterEntry entry;
+        entry.mClusterKey = clusterKey;
+        iter              = mClusters.insert(iter, entry);
+    }
+    return *iter;
+}
+
+CHIP_ERROR CompactClusterStateCache::StoreValue(TLV::TLVReader & aData, uint32_t aSize, const uint8_t *& apValue)
+{
+    ClusterStateArena::Block * block = mpBlocks;
+    if (block == nullptr || block->mCapacity - block->mUsed < aSize)
+    {
+        block = mArena.Allocate(aSize);
+        VerifyOrReturnError(block != nullptr, CHIP_ERROR_NO_MEMORY);
+
+        // A value larger than the regular blocks gets a block of its own, which must not end the filling of the current one.
+        if (mpBlocks != nullptr && aSize > mArena.GetBlockSize())
+        {
+            block->mpNext    = mpBlocks->mpNext;
+            mpBlocks->mpNext = block;
+        }
+        else
+        {
+            block->mpNext = mpBlocks;
+            mpBlocks      = block;
+        }
+    }
+
+    uint8_t * value = block->Data() + block->mUsed;
+    block->mUsed += aSize;
+
+    TLV::TLVWriter writer;
+    writer.Init(value, aSize);
+    CHIP_ERROR err = writer.CopyElement(TLV::AnonymousTag(), aData);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = writer.Finalize();
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        // The space stays reserved until the next compaction.
+        mDeadValueBytes += aSize;
+        return err;
+    }
+
+    apValue = value;
+    return CHIP_NO_ERROR;
+}
+
+void CompactClusterStateCache::DropValue(AttributeEntry & aEntry)
+{
+    if (aEntry.mpData != nullptr)
+    {
+        mLiveValueBytes -= aEntry.mSize;
+        mDeadValueBytes += aEntry.mSize;
+        aEntry.mpData = nullptr;
+    }
+}
+
+void CompactClusterStateCache::EraseAttributes(std::vector<AttributeEntry>::iterator aBegin,
+                                               std::vector<AttributeEntry>::iterator aEnd)
+{
+    for (auto iter = aBegin; iter != aEnd; ++iter)
+    {
+        DropValue(*iter);
+    }
+    mAttributes.erase(aBegin, aEnd);
+}
+
+void CompactClusterStateCache::CompactValuesIfNeeded()
+{
+    if (mDeadValueBytes < mArena.GetBlockSize() || mDeadValueBytes <= mLiveValueBytes)
+    {
+        return;
+    }
+
+    ClusterStateArena::Block * oldBlocks = mpBlocks;
+    const size_t deadValueBytes          = mDeadValueBytes;
+    mpBlocks                             = nullptr;
+
+    // Copy everything before touching the entries, so that running out of memory leaves the cache as it was.
+    std::vector<const uint8_t *> values;
+    values.reserve(mAttributes.size());
+    for (const auto & attribute : mAttributes)
+    {
+        const uint8_t * value = nullptr;
+        if (attribute.mpData != nullptr)
+        {
+            TLV::TLVReader reader;
+            reader.Init(attribute.mpData, attribute.mSize);
+            if (reader.Next() != CHIP_NO_ERROR || StoreValue(reader, attribute.mSize, value) != CHIP_NO_ERROR)
+            {
+                ChipLogError(DataManagement, "Failed to compact the attribute cache");
+                mArena.Release(mpBlocks);
+                mpBlocks        = oldBlocks;
+                mDeadValueBytes = deadValueBytes;
+                return;
+            }
+        }
+        values.push_back(value);
+    }
+
+    for (size_t i = 0; i < mAttributes.size(); i++)
+    {
+        mAttributes[i].mpData = values[i];
+    }
+    mArena.Release(oldBlocks);
+    mDeadValueBytes = 0;
+}
+
+CHIP_ERROR CompactClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                                                 const StatusIB & aStatus)
+{
+    const uint64_t key       = ClusterKey(aPath.mEndpointId, aPath.mClusterId);
+    auto endpointIter        = LowerBoundCluster(ClusterKey(aPath.mEndpointId, 0));
+    const bool endpointIsNew = endpointIter == mClusters.end() || EndpointIdOf(endpointIter->mClusterKey) != aPath.mEndpointId;
+    const uint8_t * value    = nullptr;
+    uint32_t size            = 0;
+
+    if (apData)
+    {
+        TLV::TLVReader reader;
+        reader.Init(*apData);
+        TLV::TLVWriter sizeWriter;
+        sizeWriter.InitSizeOnly();
+        ReturnErrorOnFailure(sizeWriter.CopyElement(TLV::AnonymousTag(), reader));
+        size = sizeWriter.GetLengthWritten();
+        ReturnErrorOnFailure(StoreValue(*apData, size, value));
+
+        // This commits a pending data version if the last report path is valid and it is different from the current path.
+        if (mLastReportDataPath.IsValidConcreteClusterPath() && mLastReportDataPath != aPath)
+        {
+            CommitPendingDataVersion();
+        }
+
+        //
+        // Clear out the committed data version and only set it again once we have received all data for this cluster.
+        // Otherwise, we may have incomplete data that looks like it's complete since it has a valid data version.
+        //
+        ClusterEntry & cluster = GetOrCreateCluster(key);
+        cluster.mCommittedDataVersion.ClearValue();
+
+        // if this data item is encompassed by a wildcard path, let's go ahead and update its pending data version.
+        for (const auto & path : mRequestPaths)
+        {
+            if (path.IncludesAllAttributesInCluster(aPath))
+            {
+                cluster.mPendingDataVersion = aPath.mDataVersion;
+                break;
+            }
+        }
+
+        mLastReportDataPath = aPath;
+    }
+    else
+    {
+        GetOrCreateCluster(key);
+    }
+
+    if (endpointIsNew)
+    {
+        mAddedEndpoints.push_back(aPath.mEndpointId);
+    }
+
+    auto iter = mAttributes.begin() + (LowerBound(key, aPath.mAttributeId) - mAttributes.cbegin());
+    if (iter == mAttributes.end() || iter->mClusterKey != key || iter->mAttributeId != aPath.mAttributeId)
+    {
+        AttributeEntry entry;
+        entry.mClusterKey  = key;
+        entry.mAttributeId = aPath.mAttributeId;
+        entry.mpData       = nullptr;
+        iter               = mAttributes.insert(iter, entry);
+    }
+    else
+    {
+        DropValue(*iter);
+    }
+
+    iter->mSize   = size;
+    iter->mpData  = value;
+    iter->mStatus = aStatus;
+    mLiveValueBytes += size;
+
+    mChangedAttributes.push_back(aPath);
+    return CHIP_NO_ERROR;
+}
+
+void CompactClusterStateCache::CommitPendingDataVersion()
+{
+    if (!mLastReportDataPath.IsValidConcreteClusterPath())
+    {
+        return;
+    }
+
+    auto iter = FindCluster(ClusterKey(mLastReportDataPath.mEndpointId, mLastReportDataPath.mClusterId));
+    if (iter == mClusters.end() || !iter->mPendingDataVersion.HasValue())
+    {
+        return;
+    }
+
+    auto & cluster                = mClusters[static_cast<size_t>(iter - mClusters.cbegin())];
+    cluster.mCommittedDataVersion = cluster.mPendingDataVersion;
+    cluster.mPendingDataVersion.ClearValue();
+}
+
+void CompactClusterStateCache::OnReportBegin()
+{
+    mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
+    mChangedAttributes.clear();
+    mAddedEndpoints.clear();
+    mCallback.OnReportBegin();
+}
+
+void CompactClusterStateCache::OnReportEnd()
+{
+    CommitPendingDataVersion();
+    mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
+    CompactValuesIfNeeded();
+
+    std::sort(mChangedAttributes.begin(), mChangedAttributes.end());
+    mChangedAttributes.erase(std::unique(mChangedAttributes.begin(), mChangedAttributes.end()), mChangedAttributes.end());
+
+    for (auto & path : mChangedAttributes)
+    {
+        mCallback.OnAttributeChanged(this, path);
+    }
+
+    // The changed paths are sorted, so each changed cluster is only conveyed once.
+    for (size_t i = 0; i < mChangedAttributes.size(); i++)
+    {
+        const ConcreteClusterPath & cluster = mChangedAttributes[i];
+        if (i == 0 || cluster != mChangedAttributes[i - 1])
+        {
+            mCallback.OnClusterChanged(this, cluster.mEndpointId, cluster.mClusterId);
+        }
+    }
+
+    for (auto endpoint : mAddedEndpoints)
+    {
+        mCallback.OnEndpointAdded(this, endpoint);
+    }
+
+    mCallback.OnReportEnd();
+}
+
+void CompactClusterStateCache::OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                                               const StatusIB & aStatus)
+{
+    // As with ClusterStateCache, list item operations mean the cache was registered instead of GetBufferedCallback().
+    VerifyOrDie(!aPath.IsListItemOperation());
+
+    // Copy the reader for forwarding
+    TLV::TLVReader dataSnapshot;
+    if (apData)
+    {
+        dataSnapshot.Init(*apData);
+    }
+
+    CHIP_ERROR err = UpdateCache(aPath, apData, aStatus);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to cache attribute " ChipLogFormatMEI "/" ChipLogFormatMEI ": %" CHIP_ERROR_FORMAT,
+                     ChipLogValueMEI(aPath.mClusterId), ChipLogValueMEI(aPath.mAttributeId), err.Format());
+    }
+
+    mCallback.OnAttributeData(aPath, apData ? &dataSnapshot : nullptr, aStatus);
+}
+
+CHIP_ERROR CompactClusterStateCache::Get(const ConcreteAttributePath & path, TLV::TLVReader & reader) const
+{
+    auto iter = FindAttribute(path);
+    VerifyOrReturnError(iter != mAttributes.end(), CHIP_ERROR_KEY_NOT_FOUND);
+    VerifyOrReturnError(iter->mpData != nullptr, CHIP_ERROR_IM_STATUS_CODE_RECEIVED);
+
+    reader.Init(iter->mpData, iter->mSize);
+    return reader.Next();
+}
+
+CHIP_ERROR CompactClusterStateCache::GetStatus(const ConcreteAttributePath & path, StatusIB & status) const
+{
+    auto iter = FindAttribute(path);
+    VerifyOrReturnError(iter != mAttributes.end(), CHIP_ERROR_KEY_NOT_FOUND);
+    VerifyOrReturnError(iter->mpData == nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    status = iter->mStatus;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CompactClusterStateCache::GetVersion(const ConcreteClusterPath & aPath, Optional<DataVersion> & aVersion) const
+{
+    VerifyOrReturnError(aPath.IsValidConcreteClusterPath(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    auto iter = FindCluster(ClusterKey(aPath.mEndpointId, aPath.mClusterId));
+    VerifyOrReturnError(iter != mClusters.end(), CHIP_ERROR_KEY_NOT_FOUND);
+    aVersion = iter->mCommittedDataVersion;
+    return CHIP_NO_ERROR;
+}
+
+void CompactClusterStateCache::GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const
+{
+    auto attributeIter = mAttributes.begin();
+    for (const auto & cluster : mClusters)
+    {
+        // Both vectors are sorted by cluster, so the attributes of each cluster follow those of the previous one.
+        size_t clusterSize = 0;
+        for (; attributeIter != mAttributes.end() && attributeIter->mClusterKey <= cluster.mClusterKey; ++attributeIter)
+        {
+            if (attributeIter->mClusterKey == cluster.mClusterKey)
+            {
+                clusterSize += (attributeIter->mpData != nullptr) ? attributeIter->mSize : SizeOfStatusIB(attributeIter->mStatus);
+            }
+        }
+
+        // No data in this cluster, so no point in sending a dataVersion along at all.
+        if (!cluster.mCommittedDataVersion.HasValue() || clusterSize == 0)
+        {
+            continue;
+        }
+
+        DataVersionFilter filter(EndpointIdOf(cluster.mClusterKey), ClusterIdOf(cluster.mClusterKey),
+                                 cluster.mCommittedDataVersion.Value());
+        aVector.push_back(std::make_pair(filter, clusterSize));
+    }
+
+    std::sort(aVector.begin(), aVector.end(),
+              [](const std::pair<DataVersionFilter, size_t> & x, const std::pair<DataVersionFilter, size_t> & y) {
+                  return x.second > y.second;
+              });
+}
+
+CHIP_ERROR CompactClusterStateCache::OnUpdateDataVersionFilterList(DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder,
+                                                                   const Span<AttributePathParams> & aAttributePaths,
+                                                                   bool & aEncodedDataVersionList)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TLV::TLVWriter backup;
+
+    // As in ClusterStateCache, only track the paths that cover clusters in their entirety, and that no other path of the
+    // request points to a specific attribute of.
+    for (auto & attribute1 : aAttributePaths)
+    {
+        if (!attribute1.HasWildcardAttributeId())
+        {
+            continue;
+        }
+
+        bool intersected = false;
+        for (auto & attribute2 : aAttributePaths)
+        {
+            if (!attribute2.HasWildcardAttributeId() && attribute1.Intersects(attribute2))
+            {
+                intersected = true;
+                break;
+            }
+        }
+
+        if (!intersected)
+        {
+            mRequestPaths.push_back(attribute1);
+        }
+    }
+
+    std::vector<std::pair<DataVersionFilter, size_t>> filterVector;
+    GetSortedFilters(filterVector);
+
+    aEncodedDataVersionList = false;
+    for (auto & filter : filterVector)
+    {
+        bool intersected = false;
+        aDataVersionFilterIBsBuilder.Checkpoint(backup);
+
+        // if the particular cached cluster does not intersect with user provided attribute paths, skip the cached one
+        for (const auto & attributePath : aAttributePaths)
+        {
+            if (attributePath.IncludesAttributesInCluster(filter.first))
+            {
+                intersected = true;
+                break;
+            }
+        }
+        if (!intersected)
+        {
+            continue;
+        }
+
+        SuccessOrExit(err = aDataVersionFilterIBsBuilder.EncodeDataVersionFilterIB(filter.first));
+        aEncodedDataVersionList = true;
+    }
+
+exit:
+    if (err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL)
+    {
+        ChipLogProgress(DataManagement, "OnUpdateDataVersionFilterList out of space; rolling back");
+        aDataVersionFilterIBsBuilder.Rollback(backup);
+        err = CHIP_NO_ERROR;
+    }
+    return err;
+}
+
+void CompactClusterStateCache::ClearAttributes(EndpointId endpoint)
+{
+    // The keys of the endpoint span the 32 bits of the cluster ID.
+    const uint64_t firstKey = ClusterKey(endpoint, 0);
+    const uint64_t endKey   = firstKey + (static_cast<uint64_t>(1) << 32);
+
+    auto clusterBegin = LowerBoundCluster(firstKey);
+    mClusters.erase(clusterBegin, LowerBoundCluster(endKey));
+
+    auto attributeBegin = mAttributes.begin() + (LowerBound(firstKey, 0) - mAttributes.cbegin());
+    auto attributeEnd   = mAttributes.begin() + (LowerBound(endKey, 0) - mAttributes.cbegin());
+    EraseAttributes(attributeBegin, attributeEnd);
+}
+
+void CompactClusterStateCache::ClearAttributes(const ConcreteClusterPath & cluster)
+{
+    const uint64_t key = ClusterKey(cluster.mEndpointId, cluster.mClusterId);
+
+    auto clusterIter = FindCluster(key);
+    VerifyOrReturn(clusterIter != mClusters.end());
+    mClusters.erase(clusterIter);
+
+    auto attributeBegin = mAttributes.begin() + (LowerBound(key, 0) - mAttributes.cbegin());
+    auto attributeEnd   = mAttributes.begin() + (LowerBound(key + 1, 0) - mAttributes.cbegin());
+    EraseAttributes(attributeBegin, attributeEnd);
+}
+
+void CompactClusterStateCache::ClearAttribute(const ConcreteAttributePath & attribute)
+{
+    auto iter = FindAttribute(attribute);
+    VerifyOrReturn(iter != mAttributes.end());
+
+    auto begin = mAttributes.begin() + (iter - mAttributes.cbegin());
+    EraseAttributes(begin, begin + 1);
+}
+
+void CompactClusterStateCache::Clear()
+{
+    mClusters.clear();
+    mAttributes.clear();
+    mArena.Release(mpBlocks);
+    mpBlocks        = nullptr;
+    mLiveValueBytes = 0;
+    mDeadValueBytes = 0;
+    mChangedAttributes.clear();
+    mAddedEndpoints.clear();
+    mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
+}
+
+CHIP_ERROR CompactClusterStateCache::GetLastReportDataPath(ConcreteClusterPath & aPath)
+{
+    if (mLastReportDataPath.IsValidConcreteClusterPath())
+    {
+        aPath = mLastReportDataPath;
+        return CHIP_NO_ERROR;
+    }
+    return CHIP_ERROR_INCORRECT_STATE;
+}
+
+} // namespace app
+} // namespace chip
+#endif // CHIP_CONFIG_ENABLE_READ_CLIENT
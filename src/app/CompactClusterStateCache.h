@@ -0,0 +1,443 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AppConfig.h>
+#include <app/AttributePathParams.h>
+#include <app/BufferedReadCallback.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/MessageDef/StatusIB.h>
+#include <app/ReadClient.h>
+#include <app/data-model/Decode.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/Optional.h>
+
+#include <list>
+#include <vector>
+
+#if CHIP_CONFIG_ENABLE_READ_CLIENT
+namespace chip {
+namespace app {
+
+/**
+ * A pool of memory blocks holding the attribute values of CompactClusterStateCache instances.
+ *
+ * A controller typically keeps one cache per node; sharing one arena between them lets the blocks released by a node that
+ * is cleared or removed be reused by the others, instead of going back to the heap.  The arena must outlive the caches
+ * using it.
+ */
+class ClusterStateArena
+{
+public:
+    struct Block
+    {
+        uint8_t * Data() { return reinterpret_cast<uint8_t *>(this + 1); }
+
+        Block * mpNext = nullptr;
+        uint32_t mCapacity;
+        uint32_t mUsed = 0;
+    };
+
+    /**
+     * @param[in] aBlockSize     The capacity of the blocks.  Values larger than that get a block of their own.
+     * @param[in] aMaxFreeBlocks The number of released blocks kept for reuse; the others are freed.
+     */
+    ClusterStateArena(uint32_t aBlockSize = kDefaultBlockSize, size_t aMaxFreeBlocks = kDefaultMaxFreeBlocks) :
+        mBlockSize(aBlockSize), mMaxFreeBlocks(aMaxFreeBlocks)
+    {}
+    ~ClusterStateArena();
+
+    ClusterStateArena(const ClusterStateArena &)             = delete;
+    ClusterStateArena & operator=(const ClusterStateArena &) = delete;
+
+    /**
+     * Get an empty block with room for at least aMinCapacity bytes, or nullptr if out of memory.
+     */
+    Block * Allocate(uint32_t aMinCapacity);
+
+    /**
+     * Give back a chain of blocks, linked through mpNext.
+     */
+    void Release(Block * apBlocks);
+
+    uint32_t GetBlockSize() const { return mBlockSize; }
+    size_t GetNumFreeBlocks() const { return mNumFreeBlocks; }
+
+    static constexpr uint32_t kDefaultBlockSize   = 1024;
+    static constexpr size_t kDefaultMaxFreeBlocks = 8;
+
+private:
+    const uint32_t mBlockSize;
+    const size_t mMaxFreeBlocks;
+    Block * mpFreeBlocks  = nullptr;
+    size_t mNumFreeBlocks = 0;
+};
+
+/*
+ * CompactClusterStateCache is an attribute cache with the same query API as ClusterStateCache, for controllers that keep
+ * the state of many nodes resident.
+ *
+ * Rather than nested std::map instances with one heap allocation per cluster, attribute and value, it keeps:
+ *
+ * - the clusters and the attributes in two vectors sorted by path, keyed by the (endpoint, cluster) pair packed into 64
+ *   bits.  Reports list paths in order, so updates mostly append.
+ * - the TLV values in blocks of a ClusterStateArena, appended one after the other.  Values that got replaced are
+ *   reclaimed by compacting the blocks at the end of a report, once they take more room than the live values.  Clear()
+ *   gives all the blocks of the node back to the arena at once.
+ *
+ * Chunked lists are reassembled in the contiguous mode of BufferedReadCallback, so that each list item is only copied once
+ * before reaching the arena.
+ *
+ * Events are not cached: they are only forwarded to the callback.  Use ClusterStateCache when events need to be kept.
+ *
+ * The TLV buffers handed out by Get() point into the arena, and only remain valid until the cache is next updated.
+ *
+ * **NOTE**
+ * 1. This already includes the BufferedReadCallback, so there is no need to add that to the ReadClient callback chain.
+ * 2. The same cache cannot be used by multiple subscribe/read interactions at the same time.
+ */
+class CompactClusterStateCache : protected ReadClient::Callback
+{
+public:
+    class Callback : public ReadClient::Callback
+    {
+    public:
+        Callback() = default;
+
+        // Callbacks are not expected to be copyable or movable.
+        Callback(const Callback &)             = delete;
+        Callback(Callback &&)                  = delete;
+        Callback & operator=(const Callback &) = delete;
+        Callback & operator=(Callback &&)      = delete;
+
+        /*
+         * Called anytime an attribute value has changed in the cache
+         */
+        virtual void OnAttributeChanged(CompactClusterStateCache * cache, const ConcreteAttributePath & path) {}
+
+        /*
+         * Called anytime any attribute in a cluster has changed in the cache
+         */
+        virtual void OnClusterChanged(CompactClusterStateCache * cache, EndpointId endpointId, ClusterId clusterId) {}
+
+        /*
+         * Called anytime an endpoint was added to the cache
+         */
+        virtual void OnEndpointAdded(CompactClusterStateCache * cache, EndpointId endpointId) {}
+    };
+
+    CompactClusterStateCache(Callback & callback, ClusterStateArena & arena) :
+        mCallback(callback), mArena(arena), mBufferedReader(*this, BufferedReadCallback::ListBufferingMode::kContiguous)
+    {}
+    ~CompactClusterStateCache() override;
+
+    CompactClusterStateCache(const CompactClusterStateCache &)             = delete;
+    CompactClusterStateCache(CompactClusterStateCache &&)                  = delete;
+    CompactClusterStateCache & operator=(const CompactClusterStateCache &) = delete;
+    CompactClusterStateCache & operator=(CompactClusterStateCache &&)      = delete;
+
+    /*
+     * The callback to register with the ReadClient; see ClusterStateCache::GetBufferedCallback().
+     */
+    ReadClient::Callback & GetBufferedCallback() { return mBufferedReader; }
+
+    /*
+     * Decode the cached value of an attribute; see ClusterStateCache::Get().
+     */
+    template <typename AttributeObjectTypeT>
+    CHIP_ERROR Get(const ConcreteAttributePath & path, typename AttributeObjectTypeT::DecodableType & value) const
+    {
+        TLV::TLVReader reader;
+
+        if (path.mClusterId != AttributeObjectTypeT::GetClusterId() || path.mAttributeId != AttributeObjectTypeT::GetAttributeId())
+        {
+            return CHIP_ERROR_SCHEMA_MISMATCH;
+        }
+
+        ReturnErrorOnFailure(Get(path, reader));
+        return DataModel::Decode(reader, value);
+    }
+
+    template <typename AttributeObjectTypeT>
+    CHIP_ERROR Get(EndpointId endpoint, typename AttributeObjectTypeT::DecodableType & value) const
+    {
+        ConcreteAttributePath path(endpoint, AttributeObjectTypeT::GetClusterId(), AttributeObjectTypeT::GetAttributeId());
+        return Get<AttributeObjectTypeT>(path, value);
+    }
+
+    /*
+     * Encapsulates a StatusIB and a ConcreteAttributePath pair.
+     */
+    struct AttributeStatus
+    {
+        AttributeStatus(const ConcreteAttributePath & path, StatusIB & status) : mPath(path), mStatus(status) {}
+        ConcreteAttributePath mPath;
+        StatusIB mStatus;
+    };
+
+    /*
+     * Decode an entire cluster instance, collecting the StatusIBs cached instead of data; see ClusterStateCache::Get().
+     */
+    template <typename ClusterObjectTypeT>
+    CHIP_ERROR Get(EndpointId endpointId, ClusterId clusterId, ClusterObjectTypeT & value,
+                   std::list<AttributeStatus> & statusList) const
+    {
+        statusList.clear();
+
+        return ForEachAttribute(endpointId, clusterId, [&value, this, &statusList](const ConcreteAttributePath & path) {
+            TLV::TLVReader reader;
+            CHIP_ERROR err = Get(path, reader);
+            if (err == CHIP_ERROR_IM_STATUS_CODE_RECEIVED)
+            {
+                StatusIB status;
+                ReturnErrorOnFailure(GetStatus(path, status));
+                statusList.push_back(AttributeStatus(path, status));
+                return CHIP_NO_ERROR;
+            }
+            ReturnErrorOnFailure(err);
+            return DataModel::Decode(reader, path, value);
+        });
+    }
+
+    /*
+     * Position a TLVReader on the cached value of an attribute.
+     *
+     * Notable return values:
+     *      - If neither data nor status for the specified path exist in the cache, CHIP_ERROR_KEY_NOT_FOUND
+     *        shall be returned.
+     *
+     *      - If a StatusIB is present in the cache instead of data, CHIP_ERROR_IM_STATUS_CODE_RECEIVED shall be returned.
+     */
+    CHIP_ERROR Get(const ConcreteAttributePath & path, TLV::TLVReader & reader) const;
+
+    /*
+     * Retrieve the StatusIB cached for an attribute.  CHIP_ERROR_KEY_NOT_FOUND shall be returned if nothing is cached for the
+     * path, and CHIP_ERROR_INVALID_ARGUMENT if data is cached instead of status.
+     */
+    CHIP_ERROR GetStatus(const ConcreteAttributePath & path, StatusIB & status) const;
+
+    /*
+     * Retrieve the data version of a cluster; see ClusterStateCache::GetVersion().
+     */
+    CHIP_ERROR GetVersion(const ConcreteClusterPath & path, Optional<DataVersion> & aVersion) const;
+
+    /*
+     * Call func for every attribute of the given cluster instance, in increasing attribute ID order.
+     *
+     * The iterator is expected to have this signature:
+     *      CHIP_ERROR IteratorFunc(const ConcreteAttributePath &path);
+     *
+     * CHIP_ERROR_KEY_NOT_FOUND shall be returned if the cluster instance is not in the cache, and an error returned by func
+     * stops the iteration and is returned.
+     */
+    template <typename IteratorFunc>
+    CHIP_ERROR ForEachAttribute(EndpointId endpointId, ClusterId clusterId, IteratorFunc func) const
+    {
+        const uint64_t key = ClusterKey(endpointId, clusterId);
+        VerifyOrReturnError(FindCluster(key) != mClusters.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+        for (auto iter = LowerBound(key, 0); iter != mAttributes.end() && iter->mClusterKey == key; ++iter)
+        {
+            ReturnErrorOnFailure(func(ConcreteAttributePath(endpointId, clusterId, iter->mAttributeId)));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    /*
+     * Call func for every attribute of the given cluster across all endpoints; an error returned by func stops the
+     * iteration and is returned.
+     */
+    template <typename IteratorFunc>
+    CHIP_ERROR ForEachAttribute(ClusterId clusterId, IteratorFunc func) const
+    {
+        for (auto & attribute : mAttributes)
+        {
+            if (ClusterIdOf(attribute.mClusterKey) == clusterId)
+            {
+                ReturnErrorOnFailure(func(ConcreteAttributePath(EndpointIdOf(attribute.mClusterKey), clusterId,
+                                                                attribute.mAttributeId)));
+            }
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    /*
+     * Call func with the ID of every cluster of the given endpoint; an error returned by func stops the iteration and is
+     * returned.
+     *
+     * The iterator is expected to have this signature:
+     *      CHIP_ERROR IteratorFunc(ClusterId clusterId);
+     */
+    template <typename IteratorFunc>
+    CHIP_ERROR ForEachCluster(EndpointId endpointId, IteratorFunc func) const
+    {
+        for (auto iter = LowerBoundCluster(ClusterKey(endpointId, 0));
+             iter != mClusters.end() && EndpointIdOf(iter->mClusterKey) == endpointId; ++iter)
+        {
+            ReturnErrorOnFailure(func(ClusterIdOf(iter->mClusterKey)));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    /*
+     * Clear out all the attribute data and DataVersions stored for a given endpoint.
+     */
+    void ClearAttributes(EndpointId endpoint);
+
+    /*
+     * Clear out all the attribute data and the DataVersion stored for a given cluster.
+     */
+    void ClearAttributes(const ConcreteClusterPath & cluster);
+
+    /*
+     * Clear out the data stored for an attribute.
+     */
+    void ClearAttribute(const ConcreteAttributePath & attribute);
+
+    /*
+     * Clear out everything cached for the node, giving all the value blocks back to the arena.
+     */
+    void Clear();
+
+    /*
+     * Get the last concrete report data path, if path is not concrete cluster path, return CHIP_ERROR_NOT_FOUND
+     */
+    CHIP_ERROR GetLastReportDataPath(ConcreteClusterPath & aPath);
+
+    size_t GetNumAttributes() const { return mAttributes.size(); }
+
+    /*
+     * The number of value bytes held in the arena blocks of this cache, including the replaced values not reclaimed yet.
+     */
+    size_t GetValueBytesInUse() const { return mLiveValueBytes + mDeadValueBytes; }
+
+private:
+    // mpData is null when mStatus is cached instead of data.
+    struct AttributeEntry
+    {
+        uint64_t mClusterKey;
+        AttributeId mAttributeId;
+        uint32_t mSize;
+        const uint8_t * mpData;
+        StatusIB mStatus;
+    };
+
+    // See ClusterStateCache for the pending and committed data versions.
+    struct ClusterEntry
+    {
+        uint64_t mClusterKey;
+        Optional<DataVersion> mPendingDataVersion;
+        Optional<DataVersion> mCommittedDataVersion;
+    };
+
+    using AttributeIterator = std::vector<AttributeEntry>::const_iterator;
+    using ClusterIterator   = std::vector<ClusterEntry>::const_iterator;
+
+    static constexpr uint64_t ClusterKey(EndpointId endpointId, ClusterId clusterId)
+    {
+        return (static_cast<uint64_t>(endpointId) << 32) | clusterId;
+    }
+    static constexpr EndpointId EndpointIdOf(uint64_t clusterKey) { return static_cast<EndpointId>(clusterKey >> 32); }
+    static constexpr ClusterId ClusterIdOf(uint64_t clusterKey) { return static_cast<ClusterId>(clusterKey); }
+
+    AttributeIterator LowerBound(uint64_t clusterKey, AttributeId attributeId) const;
+    AttributeIterator FindAttribute(const ConcreteAttributePath & path) const;
+    ClusterIterator LowerBoundCluster(uint64_t clusterKey) const;
+    ClusterIterator FindCluster(uint64_t clusterKey) const;
+    ClusterEntry & GetOrCreateCluster(uint64_t clusterKey);
+
+    CHIP_ERROR UpdateCache(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus);
+    CHIP_ERROR StoreValue(TLV::TLVReader & aData, uint32_t aSize, const uint8_t *& apValue);
+    void DropValue(AttributeEntry & aEntry);
+    void EraseAttributes(std::vector<AttributeEntry>::iterator aBegin, std::vector<AttributeEntry>::iterator aEnd);
+
+    // Copy the live values into fresh blocks once the replaced values take more room than they do.
+    void CompactValuesIfNeeded();
+
+    void CommitPendingDataVersion();
+    void GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const;
+
+    //
+    // ReadClient::Callback
+    //
+    void OnReportBegin() override;
+    void OnReportEnd() override;
+    void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override;
+    void OnError(CHIP_ERROR aError) override { return mCallback.OnError(aError); }
+
+    void OnEventData(const EventHeader & aEventHeader, TLV::TLVReader * apData, const StatusIB * apStatus) override
+    {
+        mCallback.OnEventData(aEventHeader, apData, apStatus);
+    }
+
+    void OnDone(ReadClient * apReadClient) override
+    {
+        mRequestPaths.clear();
+        return mCallback.OnDone(apReadClient);
+    }
+
+    void OnSubscriptionEstablished(SubscriptionId aSubscriptionId) override
+    {
+        mCallback.OnSubscriptionEstablished(aSubscriptionId);
+    }
+
+    CHIP_ERROR OnResubscriptionNeeded(ReadClient * apReadClient, CHIP_ERROR aTerminationCause) override
+    {
+        return mCallback.OnResubscriptionNeeded(apReadClient, aTerminationCause);
+    }
+
+    void OnDeallocatePaths(chip::app::ReadPrepareParams && aReadPrepareParams) override
+    {
+        mCallback.OnDeallocatePaths(std::move(aReadPrepareParams));
+    }
+
+    CHIP_ERROR OnUpdateDataVersionFilterList(DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder,
+                                             const Span<AttributePathParams> & aAttributePaths,
+                                             bool & aEncodedDataVersionList) override;
+
+    void OnUnsolicitedMessageFromPublisher(ReadClient * apReadClient) override
+    {
+        return mCallback.OnUnsolicitedMessageFromPublisher(apReadClient);
+    }
+
+    void OnCASESessionEstablished(const SessionHandle & aSession, ReadPrepareParams & aSubscriptionParams) override
+    {
+        return mCallback.OnCASESessionEstablished(aSession, aSubscriptionParams);
+    }
+
+    Callback & mCallback;
+    ClusterStateArena & mArena;
+    BufferedReadCallback mBufferedReader;
+
+    std::vector<ClusterEntry> mClusters;
+    std::vector<AttributeEntry> mAttributes;
+    // The blocks holding the values, the one being filled first.
+    ClusterStateArena::Block * mpBlocks = nullptr;
+    size_t mLiveValueBytes              = 0;
+    size_t mDeadValueBytes              = 0;
+
+    std::vector<AttributePathParams> mRequestPaths; // wildcard attribute request paths only
+    std::vector<ConcreteAttributePath> mChangedAttributes;
+    std::vector<EndpointId> mAddedEndpoints;
+    ConcreteClusterPath mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
+};
+
+} // namespace app
+} // namespace chip
+#endif // CHIP_CONFIG_ENABLE_READ_CLIENT
@@ -0,0 +1,203 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/Optional.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * @brief Hash index of interfaces registered for a cluster on one endpoint or on all endpoints, such as
+ *        AttributeAccessInterface and CommandHandlerInterface.
+ *
+ * The interfaces are chained through their own GetNext()/SetNext() links, so an interface can only be part of one index.
+ * Interfaces for a single endpoint are bucketed by endpoint and cluster, and interfaces for all endpoints by cluster, so
+ * finding the interface of a path only walks the interfaces that share its buckets, however many are registered.
+ *
+ * `T` has to provide GetNext(), SetNext(), Matches(EndpointId, ClusterId), Matches(const T &) and MatchesEndpoint(EndpointId).
+ * The endpoint and cluster an interface is keyed by are passed by the registry, which has access to them.
+ */
+template <typename T, size_t kNumBuckets>
+class EndpointClusterRegistrationIndex
+{
+public:
+    static_assert(kNumBuckets > 0, "The index needs at least one bucket");
+
+    /**
+     * Returns the interface that handles the given path, or nullptr if there is none.
+     */
+    T * Find(EndpointId endpointId, ClusterId clusterId) const
+    {
+        for (T * cur = mEndpointBuckets[EndpointBucket(endpointId, clusterId)]; cur != nullptr; cur = cur->GetNext())
+        {
+            if (cur->Matches(endpointId, clusterId))
+            {
+                return cur;
+            }
+        }
+        for (T * cur = mAllEndpointsBuckets[ClusterBucket(clusterId)]; cur != nullptr; cur = cur->GetNext())
+        {
+            if (cur->Matches(endpointId, clusterId))
+            {
+                return cur;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * Returns an interface that handles some of the paths `other`, keyed by `endpointId` and `clusterId`, handles, or
+     * nullptr if there is none.
+     *
+     * An interface for all endpoints can conflict with interfaces of any endpoint, so all the buckets are walked for it.
+     */
+    T * FindConflict(const T & other, const Optional<EndpointId> & endpointId, ClusterId clusterId) const
+    {
+        T * conflict = FindIn(mAllEndpointsBuckets[ClusterBucket(clusterId)], other);
+        if (conflict != nullptr)
+        {
+            return conflict;
+        }
+
+        if (endpointId.HasValue())
+        {
+            return FindIn(mEndpointBuckets[EndpointBucket(endpointId.Value(), clusterId)], other);
+        }
+
+        for (T * head : mEndpointBuckets)
+        {
+            conflict = FindIn(head, other);
+            if (conflict != nullptr)
+            {
+                return conflict;
+            }
+        }
+        return nullptr;
+    }
+
+    void Insert(T * item, const Optional<EndpointId> & endpointId, ClusterId clusterId)
+    {
+        T *& head = Head(endpointId, clusterId);
+        item->SetNext(head);
+        head = item;
+    }
+
+    /**
+     * Removes `item`, keyed by `endpointId` and `clusterId`, from the index.  Returns whether it was there.
+     */
+    bool Remove(T * item, const Optional<EndpointId> & endpointId, ClusterId clusterId)
+    {
+        bool removed = false;
+        RemoveFrom(Head(endpointId, clusterId), [item, &removed](T * cur) {
+            removed = removed || (cur == item);
+            return cur == item;
+        });
+        return removed;
+    }
+
+    /**
+     * Removes the interfaces registered for the given endpoint, but not those for all endpoints.
+     */
+    void RemoveAllForEndpoint(EndpointId endpointId)
+    {
+        for (T *& head : mEndpointBuckets)
+        {
+            RemoveFrom(head, [endpointId](T * cur) { return cur->MatchesEndpoint(endpointId); });
+        }
+    }
+
+    void RemoveAll()
+    {
+        for (T *& head : mEndpointBuckets)
+        {
+            RemoveFrom(head, [](T *) { return true; });
+        }
+        for (T *& head : mAllEndpointsBuckets)
+        {
+            RemoveFrom(head, [](T *) { return true; });
+        }
+    }
+
+private:
+    static size_t EndpointBucket(EndpointId endpointId, ClusterId clusterId)
+    {
+        // Bridges register the same clusters on many consecutive endpoints: spread those.
+        return static_cast<size_t>((clusterId * 2654435761u) ^ (endpointId * 40503u)) % kNumBuckets;
+    }
+
+    static size_t ClusterBucket(ClusterId clusterId) { return static_cast<size_t>(clusterId * 2654435761u) % kNumBuckets; }
+
+    static T * FindIn(T * head, const T & other)
+    {
+        for (T * cur = head; cur != nullptr; cur = cur->GetNext())
+        {
+            if (cur->Matches(other))
+            {
+                return cur;
+            }
+        }
+        return nullptr;
+    }
+
+    // shouldRemove returns true for the items to unlink from the chain.
+    template <typename F>
+    static void RemoveFrom(T *& head, F shouldRemove)
+    {
+        T * prev = nullptr;
+        T * cur  = head;
+        while (cur != nullptr)
+        {
+            T * next = cur->GetNext();
+            if (shouldRemove(cur))
+            {
+                if (prev != nullptr)
+                {
+                    prev->SetNext(next);
+                }
+                else
+                {
+                    head = next;
+                }
+                cur->SetNext(nullptr);
+            }
+            else
+            {
+                prev = cur;
+            }
+            cur = next;
+        }
+    }
+
+    T *& Head(const Optional<EndpointId> & endpointId, ClusterId clusterId)
+    {
+        return endpointId.HasValue() ? mEndpointBuckets[EndpointBucket(endpointId.Value(), clusterId)]
+                                     : mAllEndpointsBuckets[ClusterBucket(clusterId)];
+    }
+
+    T * mEndpointBuckets[kNumBuckets]     = {};
+    T * mAllEndpointsBuckets[kNumBuckets] = {};
+};
+
+} // namespace app
+} // namespace chip
@@ -102,5 +102,41 @@ CHIP_ERROR LogEvent(const T & aEventData, EndpointId aEndpoint, EventNumber & aE
     return logMgmt.LogEvent(&eventData, eventOptions, aEventNumber);
 }
 
+/**
+ * @brief
+ *   Stage an event for logging, from any thread and without holding the stack
+ *   lock. The event data is encoded right away, and the event is logged by the
+ *   Matter thread along with the other events staged by then.
+ *
+ * StageEvent has the same 2 variants as LogEvent. See
+ * EventManagement::StageEvent for the errors returned.
+ *
+ * @param[in] aEventData  The event cluster object
+ * @param[in] aEndpoint    The current cluster's Endpoint Id
+ *
+ * @return CHIP_ERROR  CHIP Error Code
+ */
+template <typename T, std::enable_if_t<DataModel::IsFabricScoped<T>::value, bool> = true>
+CHIP_ERROR StageEvent(const T & aEventData, EndpointId aEndpoint)
+{
+    EventLogger<T> eventData(aEventData);
+    EventOptions eventOptions;
+    eventOptions.mPath        = ConcreteEventPath(aEndpoint, aEventData.GetClusterId(), aEventData.GetEventId());
+    eventOptions.mPriority    = aEventData.GetPriorityLevel();
+    eventOptions.mFabricIndex = aEventData.GetFabricIndex();
+    VerifyOrReturnError(eventOptions.mFabricIndex != kUndefinedFabricIndex, CHIP_ERROR_INVALID_FABRIC_INDEX);
+    return EventManagement::GetInstance().StageEvent(&eventData, eventOptions);
+}
+
+template <typename T, std::enable_if_t<!DataModel::IsFabricScoped<T>::value, bool> = true>
+CHIP_ERROR StageEvent(const T & aEventData, EndpointId aEndpoint)
+{
+    EventLogger<T> eventData(aEventData);
+    EventOptions eventOptions;
+    eventOptions.mPath     = ConcreteEventPath(aEndpoint, aEventData.GetClusterId(), aEventData.GetEventId());
+    eventOptions.mPriority = aEventData.GetPriorityLevel();
+    return EventManagement::GetInstance().StageEvent(&eventData, eventOptions);
+}
+
 } // namespace app
 } // namespace chip
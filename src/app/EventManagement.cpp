@@ -26,7 +26,9 @@
 #include <inttypes.h>
 #include <lib/core/TLVUtilities.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/LockFreeStagingRing.h>
 #include <lib/support/logging/CHIPLogging.h>
+#include <platform/PlatformManager.h>
 
 using namespace chip::TLV;
 
@@ -34,6 +36,43 @@ namespace chip {
 namespace app {
 static EventManagement sInstance;
 
+namespace {
+
+struct StagedEvent
+{
+    EndpointId endpoint     = kInvalidEndpointId;
+    ClusterId cluster       = kInvalidClusterId;
+    EventId event           = kInvalidEventId;
+    PriorityLevel priority  = PriorityLevel::Invalid;
+    FabricIndex fabricIndex = kUndefinedFabricIndex;
+    uint16_t dataLength     = 0;
+
+    // The encoded EventDataIB::Tag::kData element.
+    uint8_t data[CHIP_CONFIG_STAGED_EVENT_MAX_DATA_SIZE] = {};
+};
+
+LockFreeStagingRing<StagedEvent, CHIP_CONFIG_STAGED_EVENTS_QUEUE_SIZE> sStagedEvents;
+
+// Writes the event data serialized when the event was staged.
+class StagedEventLogger : public EventLoggingDelegate
+{
+public:
+    StagedEventLogger(const StagedEvent & aEvent) : mEvent(aEvent) {}
+
+    CHIP_ERROR WriteEvent(TLV::TLVWriter & aWriter) final override
+    {
+        TLV::TLVReader reader;
+        reader.Init(mEvent.data, mEvent.dataLength);
+        ReturnErrorOnFailure(reader.Next());
+        return aWriter.CopyElement(reader);
+    }
+
+private:
+    const StagedEvent & mEvent;
+};
+
+} // namespace
+
 /**
  * @brief
  *   A TLVReader backed by CircularEventBuffer
@@ -64,8 +103,10 @@ EventManagement & EventManagement::GetInstance()
 
 struct ReclaimEventCtx
 {
-    CircularEventBuffer * mpEventBuffer = nullptr;
-    size_t mSpaceNeededForMovedEvent    = 0;
+    CircularEventBuffer * mpEventBuffer       = nullptr;
+    size_t mSpaceNeededForMovedEvent          = 0;
+    EventNumber mEventNumber                  = 0;
+    PersistentEventLog * mpPersistentEventLog = nullptr;
 };
 
 /**
@@ -126,44 +167,6 @@ void EventManagement::Init(Messaging::ExchangeManager * apExchangeManager, uint3
     mMonotonicStartupTime = aMonotonicStartupTime;
 }
 
-CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer)
-{
-    CircularTLVWriter writer;
-    CircularTLVReader reader;
-    CHIP_ERROR err                   = CHIP_NO_ERROR;
-    CircularEventBuffer * nextBuffer = apEventBuffer->GetNextCircularEventBuffer();
-    if (nextBuffer == nullptr)
-    {
-        return CHIP_ERROR_INVALID_ARGUMENT;
-    }
-    CircularEventBuffer backup = *nextBuffer;
-
-    // Set up the next buffer s.t. it fails if needs to evict an element
-    nextBuffer->mProcessEvictedElement = AlwaysFail;
-
-    writer.Init(*nextBuffer);
-
-    // Set up the reader s.t. it is positioned to read the head event
-    reader.Init(*apEventBuffer);
-
-    err = reader.Next();
-    SuccessOrExit(err);
-
-    err = writer.CopyElement(reader);
-    SuccessOrExit(err);
-
-    err = writer.Finalize();
-    SuccessOrExit(err);
-
-    ChipLogDetail(EventLogging, "Copy Event to next buffer with priority %u", static_cast<unsigned>(nextBuffer->GetPriority()));
-exit:
-    if (err != CHIP_NO_ERROR)
-    {
-        *nextBuffer = backup;
-    }
-    return err;
-}
-
 CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, PriorityLevel aPriority)
 {
     CHIP_ERROR err                    = CHIP_NO_ERROR;
@@ -186,6 +189,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
     }
 
     VerifyOrExit(eventBuffer != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+    ctx.mpPersistentEventLog = mpPersistentEventLog;
 
     // check whether we actually need to do anything, exit if we don't
     VerifyOrExit(requiredSpace > eventBuffer->AvailableDataLength(), err = CHIP_NO_ERROR);
@@ -199,7 +203,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
 
             eventBuffer->mProcessEvictedElement = EvictEvent;
             eventBuffer->mAppData               = &ctx;
-            err                                 = eventBuffer->EvictHead();
+            err                                 = eventBuffer->EvictOldestEvent();
 
             // one of two things happened: either the element was evicted immediately if the head's priority is same as current
             // buffer(final one), or we figured out how much space we need to evict it into the next buffer, the check happens in
@@ -211,22 +215,10 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
                 VerifyOrExit(eventBuffer->GetNextCircularEventBuffer() != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
                 if (ctx.mSpaceNeededForMovedEvent <= eventBuffer->GetNextCircularEventBuffer()->AvailableDataLength())
                 {
-                    // we can copy the event outright.  copy event and
-                    // subsequently evict head s.t. evicting the head
-                    // element always succeeds.
-                    // Since we're calling CopyElement and we've checked
-                    // that there is space in the next buffer, we don't expect
-                    // this to fail.
-                    err = CopyToNextBuffer(eventBuffer);
-                    SuccessOrExit(err);
-                    // success; evict head unconditionally
-                    eventBuffer->mProcessEvictedElement = nullptr;
-                    err                                 = eventBuffer->EvictHead();
-                    // if unconditional eviction failed, this
-                    // means that we have no way of further
-                    // clearing the buffer.  fail out and let the
-                    // caller know that we could not honor the
-                    // request
+                    // we can move the event outright.  Its encoding is
+                    // moved as it is, without being decoded again, and
+                    // that frees its space in the current buffer.
+                    err = eventBuffer->PromoteOldestEvent(static_cast<uint32_t>(ctx.mSpaceNeededForMovedEvent), ctx.mEventNumber);
                     SuccessOrExit(err);
                     continue;
                 }
@@ -356,6 +348,8 @@ void EventManagement::DestroyEventManagement()
     sInstance.mState        = EventManagementStates::Shutdown;
     sInstance.mpEventBuffer = nullptr;
     sInstance.mpExchangeMgr = nullptr;
+
+    sInstance.mpPersistentEventLog = nullptr;
 }
 
 CircularEventBuffer * EventManagement::GetPriorityBuffer(PriorityLevel aPriority) const
@@ -418,6 +412,61 @@ CHIP_ERROR EventManagement::LogEvent(EventLoggingDelegate * apDelegate, const Ev
     return LogEventPrivate(apDelegate, aEventOptions, aEventNumber);
 }
 
+CHIP_ERROR EventManagement::StageEvent(EventLoggingDelegate * apDelegate, const EventOptions & aEventOptions)
+{
+    bool needsWake = false;
+    CHIP_ERROR err = sStagedEvents.Push(
+        [&](StagedEvent & event) {
+            event.endpoint    = aEventOptions.mPath.mEndpointId;
+            event.cluster     = aEventOptions.mPath.mClusterId;
+            event.event       = aEventOptions.mPath.mEventId;
+            event.priority    = aEventOptions.mPriority;
+            event.fabricIndex = aEventOptions.mFabricIndex;
+
+            TLV::TLVWriter writer;
+            writer.Init(event.data);
+            CHIP_ERROR encodeErr = apDelegate->WriteEvent(writer);
+            if (encodeErr == CHIP_NO_ERROR)
+            {
+                encodeErr = writer.Finalize();
+            }
+            // Running out of room in the entry is not to be mistaken for a full queue.
+            VerifyOrReturnError(encodeErr != CHIP_ERROR_NO_MEMORY, CHIP_ERROR_BUFFER_TOO_SMALL);
+            ReturnErrorOnFailure(encodeErr);
+            event.dataLength = static_cast<uint16_t>(writer.GetLengthWritten());
+            return CHIP_NO_ERROR;
+        },
+        needsWake);
+    VerifyOrReturnError(err == CHIP_NO_ERROR && needsWake, err);
+
+    err = DeviceLayer::PlatformMgr().ScheduleWork(LogStagedEvents);
+    if (err != CHIP_NO_ERROR)
+    {
+        // The event stays staged, and is logged along with the next one.
+        sStagedEvents.CancelWake();
+    }
+    return err;
+}
+
+void EventManagement::LogStagedEvents(intptr_t)
+{
+    EventManagement & instance = GetInstance();
+
+    sStagedEvents.Drain([&instance](const StagedEvent & event) {
+        // Events staged around a shutdown are dropped, but still drained to free the queue.
+        VerifyOrReturn(instance.mState != EventManagementStates::Shutdown);
+
+        StagedEventLogger logger(event);
+        EventOptions options;
+        options.mPath        = ConcreteEventPath(event.endpoint, event.cluster, event.event);
+        options.mPriority    = event.priority;
+        options.mFabricIndex = event.fabricIndex;
+
+        EventNumber eventNumber;
+        LogErrorOnFailure(instance.LogEventPrivate(&logger, options, eventNumber));
+    });
+}
+
 CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, const EventOptions & aEventOptions,
                                             EventNumber & aEventNumber)
 {
@@ -428,6 +477,7 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     CircularTLVWriter checkpoint = writer;
     EventLoadOutContext ctxt     = EventLoadOutContext(writer, aEventOptions.mPriority, mLastEventNumber);
     EventOptions opts;
+    uint64_t eventOffset = 0;
 
     Timestamp timestamp;
 #if CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS
@@ -465,9 +515,11 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     err = EnsureSpaceInCircularBuffer(requestSize, aEventOptions.mPriority);
     SuccessOrExit(err);
 
-    err = ConstructEvent(&ctxt, apDelegate, &opts);
+    eventOffset = mpEventBuffer->GetTailOffset();
+    err         = ConstructEvent(&ctxt, apDelegate, &opts);
     SuccessOrExit(err);
 
+    mpEventBuffer->IndexEvent(ctxt.mCurrentEventNumber, eventOffset);
     mBytesWritten += writer.GetLengthWritten();
 
 exit:
@@ -660,6 +712,31 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const SingleLi
     err                            = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
     SuccessOrExit(err);
 
+    // Events are read from the most important buffer down to the least important one, and come out in increasing event
+    // number order.  Start at the newest indexed event that is not newer than aEventMin, skipping the older events.
+    for (CircularEventBuffer * buffer = bufWrapper.mpCurrent; buffer != nullptr; buffer = buffer->GetPreviousCircularEventBuffer())
+    {
+        const uint8_t * startPoint = buffer->FindIndexedEventAtOrBefore(aEventMin);
+        if (startPoint != nullptr)
+        {
+            bufWrapper.mpCurrent    = buffer;
+            bufWrapper.mpStartPoint = startPoint;
+        }
+    }
+    if (bufWrapper.mpStartPoint != nullptr)
+    {
+        CircularEventReader circularReader;
+        circularReader.Init(&bufWrapper);
+        reader.Init(circularReader);
+    }
+
+    // The events of the persistent log were evicted from the buffers, so they are older than all the buffered events.
+    if (mpPersistentEventLog != nullptr)
+    {
+        err = mpPersistentEventLog->Iterate(aEventMin, CopyEventsSince, &context);
+        SuccessOrExit(err);
+    }
+
     err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
     if (err == CHIP_END_OF_TLV)
     {
@@ -737,6 +814,12 @@ CHIP_ERROR EventManagement::FabricRemoved(FabricIndex aFabricIndex)
     {
         err = CHIP_NO_ERROR;
     }
+    ReturnErrorOnFailure(err);
+
+    if (mpPersistentEventLog != nullptr)
+    {
+        err = mpPersistentEventLog->FabricRemoved(aFabricIndex);
+    }
     return err;
 }
 
@@ -812,6 +895,9 @@ CHIP_ERROR EventManagement::EvictEvent(TLVCircularBuffer & apBuffer, void * apAp
     // pull out the delta time, pull out the priority
     ReturnErrorOnFailure(aReader.Next());
 
+    TLVReader eventReader;
+    eventReader.Init(aReader);
+
     TLVType containerType;
     TLVType containerType1;
     ReturnErrorOnFailure(aReader.EnterContainer(containerType));
@@ -833,8 +919,21 @@ CHIP_ERROR EventManagement::EvictEvent(TLVCircularBuffer & apBuffer, void * apAp
 
     ReclaimEventCtx * const ctx             = static_cast<ReclaimEventCtx *>(apAppData);
     CircularEventBuffer * const eventBuffer = ctx->mpEventBuffer;
+    ctx->mEventNumber                       = context.mEventNumber;
     if (eventBuffer->IsFinalDestinationForPriority(imp))
     {
+        if (ctx->mpPersistentEventLog != nullptr && eventBuffer->GetNextCircularEventBuffer() == nullptr)
+        {
+            // Only the events evicted from the last buffer are kept, since they leave the buffers oldest first.
+            err = ctx->mpPersistentEventLog->Append(context.mEventNumber, eventReader);
+            if (err == CHIP_NO_ERROR)
+            {
+                ctx->mSpaceNeededForMovedEvent = 0;
+                return CHIP_NO_ERROR;
+            }
+            ChipLogError(EventLogging, "Failed to persist event 0x" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                         ChipLogValueX64(context.mEventNumber), err.Format());
+        }
         ChipLogProgress(EventLogging,
                         "Dropped 1 event from buffer with priority %u and event number  0x" ChipLogFormatX64
                         " due to overflow: event priority_level: %u",
@@ -865,9 +964,105 @@ void CircularEventBuffer::Init(uint8_t * apBuffer, uint32_t aBufferLength, Circu
                                CircularEventBuffer * apNext, PriorityLevel aPriorityLevel)
 {
     TLVCircularBuffer::Init(apBuffer, aBufferLength);
-    mpPrev    = apPrev;
-    mpNext    = apNext;
-    mPriority = aPriorityLevel;
+    mpPrev           = apPrev;
+    mpNext           = apNext;
+    mPriority        = aPriorityLevel;
+    mHeadOffset      = 0;
+    mEventIndexStart = 0;
+    mEventIndexCount = 0;
+}
+
+CHIP_ERROR CircularEventBuffer::EvictOldestEvent()
+{
+    const uint32_t dataLength = DataLength();
+    ReturnErrorOnFailure(EvictHead());
+    mHeadOffset += dataLength - DataLength();
+
+    DropIndexedEventsBeforeHead();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CircularEventBuffer::PromoteOldestEvent(uint32_t aLength, EventNumber aEventNumber)
+{
+    VerifyOrReturnError(mpNext != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    const uint64_t eventOffset = mpNext->GetTailOffset();
+    ReturnErrorOnFailure(MoveHeadTo(*mpNext, aLength));
+    mHeadOffset += aLength;
+
+    DropIndexedEventsBeforeHead();
+    mpNext->IndexEvent(aEventNumber, eventOffset);
+
+    ChipLogDetail(EventLogging, "Moved event to next buffer with priority %u", static_cast<unsigned>(mpNext->GetPriority()));
+    return CHIP_NO_ERROR;
+}
+
+void CircularEventBuffer::DropIndexedEventsBeforeHead()
+{
+    while (mEventIndexCount > 0 && mEventIndex[mEventIndexStart].mOffset < mHeadOffset)
+    {
+        mEventIndexStart = (mEventIndexStart + 1) % kEventIndexSize;
+        mEventIndexCount--;
+    }
+}
+
+void CircularEventBuffer::IndexEvent(EventNumber aEventNumber, uint64_t aOffset)
+{
+    // Events closer than this to the previous indexed event are not indexed, which keeps the indexed events of a full
+    // buffer within kEventIndexSize entries.
+    const uint64_t stride = (GetTotalDataLength() + kEventIndexSize - 1) / kEventIndexSize;
+
+    if (mEventIndexCount > 0)
+    {
+        const EventIndexEntry & newest = mEventIndex[(mEventIndexStart + mEventIndexCount - 1) % kEventIndexSize];
+        VerifyOrReturn(aOffset >= newest.mOffset + stride);
+    }
+    VerifyOrReturn(mEventIndexCount < kEventIndexSize);
+
+    EventIndexEntry & entry = mEventIndex[(mEventIndexStart + mEventIndexCount) % kEventIndexSize];
+    entry.mEventNumber      = aEventNumber;
+    entry.mOffset           = aOffset;
+    mEventIndexCount++;
+}
+
+const uint8_t * CircularEventBuffer::FindIndexedEventAtOrBefore(EventNumber aEventNumber) const
+{
+    const uint8_t * point = nullptr;
+    for (size_t i = 0; i < mEventIndexCount; i++)
+    {
+        const EventIndexEntry & entry = mEventIndex[(mEventIndexStart + i) % kEventIndexSize];
+        if (entry.mEventNumber > aEventNumber)
+        {
+            break;
+        }
+        point = GetQueue() + (entry.mOffset % GetTotalDataLength());
+    }
+    return point;
+}
+
+void CircularEventBuffer::GetBufferFrom(const uint8_t * aPoint, const uint8_t *& aBufStart, uint32_t & aBufLen) const
+{
+    const uint8_t * tail = QueueTail();
+
+    aBufStart = aPoint;
+    if (tail <= aPoint)
+    {
+        // The data after aPoint wraps around the end of the storage (this includes a completely full buffer).
+        aBufLen = GetTotalDataLength() - static_cast<uint32_t>(aPoint - GetQueue());
+    }
+    else
+    {
+        aBufLen = static_cast<uint32_t>(tail - aPoint);
+    }
+}
+
+uint32_t CircularEventBuffer::DataLengthFrom(const uint8_t * aPoint) const
+{
+    VerifyOrReturnValue(aPoint != nullptr, DataLength());
+
+    const uint32_t distanceFromHead =
+        static_cast<uint32_t>((aPoint - QueueHead() + GetTotalDataLength()) % GetTotalDataLength());
+    return DataLength() - distanceFromHead;
 }
 
 bool CircularEventBuffer::IsFinalDestinationForPriority(PriorityLevel aPriority) const
@@ -893,8 +1088,8 @@ void CircularEventReader::Init(CircularEventBufferWrapper * apBufWrapper)
     if (apBufWrapper->mpCurrent == nullptr)
         return;
 
-    TLVReader::Init(*apBufWrapper, apBufWrapper->mpCurrent->DataLength());
-    mMaxLen = apBufWrapper->mpCurrent->DataLength();
+    TLVReader::Init(*apBufWrapper, apBufWrapper->mpCurrent->DataLengthFrom(apBufWrapper->mpStartPoint));
+    mMaxLen = apBufWrapper->mpCurrent->DataLengthFrom(apBufWrapper->mpStartPoint);
     for (prev = apBufWrapper->mpCurrent->GetPreviousCircularEventBuffer(); prev != nullptr;
          prev = prev->GetPreviousCircularEventBuffer())
     {
@@ -907,6 +1102,12 @@ void CircularEventReader::Init(CircularEventBufferWrapper * apBufWrapper)
 CHIP_ERROR CircularEventBufferWrapper::GetNextBuffer(TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
+    if ((aBufStart == nullptr) && (mpStartPoint != nullptr))
+    {
+        mpCurrent->GetBufferFrom(mpStartPoint, aBufStart, aBufLen);
+        mpStartPoint = nullptr;
+        return CHIP_NO_ERROR;
+    }
     mpCurrent->GetNextBuffer(aReader, aBufStart, aBufLen);
     SuccessOrExit(err);
 
@@ -31,6 +31,7 @@
 #include <app/EventLoggingTypes.h>
 #include <app/MessageDef/EventDataIB.h>
 #include <app/MessageDef/StatusIB.h>
+#include <app/PersistentEventLog.h>
 #include <app/data-model-provider/EventsGenerator.h>
 #include <app/util/basic-types.h>
 #include <lib/core/TLVCircularBuffer.h>
@@ -129,9 +130,66 @@ public:
     void SetRequiredSpaceforEvicted(size_t aRequiredSpace) { mRequiredSpaceForEvicted = aRequiredSpace; }
     size_t GetRequiredSpaceforEvicted() const { return mRequiredSpaceForEvicted; }
 
+    /**
+     * @brief
+     *   Evict the oldest event, see TLVCircularBuffer::EvictHead, and forget its position in the event index.
+     *
+     *   Events must be evicted from a CircularEventBuffer through this method.
+     */
+    CHIP_ERROR EvictOldestEvent();
+
+    /**
+     * @brief
+     *   Move the oldest event, of aLength bytes as measured when it was about to be evicted, to the next buffer.  The
+     *   encoded event is moved as it is, see TLVCircularBuffer::MoveHeadTo, and indexed in the next buffer.
+     *
+     *   The next buffer must have aLength bytes available.
+     */
+    CHIP_ERROR PromoteOldestEvent(uint32_t aLength, EventNumber aEventNumber);
+
+    /**
+     * @brief
+     *   The offset, counted in bytes ever written to this buffer, at which the next event will be written.  Pass it to
+     *   IndexEvent() once that event is written.
+     */
+    uint64_t GetTailOffset() const { return mHeadOffset + DataLength(); }
+
+    /**
+     * @brief
+     *   Record the position of an event that was just written at the given offset.  Only a few positions are kept, spread
+     *   over the buffer.
+     */
+    void IndexEvent(EventNumber aEventNumber, uint64_t aOffset);
+
+    /**
+     * @brief
+     *   Returns the position of the newest indexed event whose event number is at most aEventNumber, or nullptr if there is
+     *   no such event.  Reading from that position skips only events older than aEventNumber.
+     */
+    const uint8_t * FindIndexedEventAtOrBefore(EventNumber aEventNumber) const;
+
+    /**
+     * @brief
+     *   Returns the contiguous data that starts at the given position within the buffer's data, as TLVBackingStore::OnInit
+     *   would for the head.
+     */
+    void GetBufferFrom(const uint8_t * aPoint, const uint8_t *& aBufStart, uint32_t & aBufLen) const;
+
+    /// Returns the length of the data from the given position within the buffer's data to the tail.
+    uint32_t DataLengthFrom(const uint8_t * aPoint) const;
+
     ~CircularEventBuffer() override = default;
 
 private:
+    struct EventIndexEntry
+    {
+        EventNumber mEventNumber = 0;
+        uint64_t mOffset         = 0;
+    };
+
+    static constexpr size_t kEventIndexSize = CHIP_CONFIG_EVENT_INDEX_ENTRIES_PER_BUFFER;
+    static_assert(kEventIndexSize > 0, "The event index needs at least one entry");
+
     CircularEventBuffer * mpPrev = nullptr; ///< A pointer CircularEventBuffer storing events less important events
     CircularEventBuffer * mpNext = nullptr; ///< A pointer CircularEventBuffer storing events more important events
 
@@ -140,6 +198,18 @@ private:
 
     size_t mRequiredSpaceForEvicted = 0; ///< Required space for previous buffer to evict event to new buffer
 
+    // The offset of the head, counted in bytes ever written to the buffer.  The byte at offset X lives at
+    // GetQueue()[X % GetTotalDataLength()].
+    uint64_t mHeadOffset = 0;
+
+    // Ring of indexed events, oldest first.
+    EventIndexEntry mEventIndex[kEventIndexSize];
+    size_t mEventIndexStart = 0;
+    size_t mEventIndexCount = 0;
+
+    // Forget the indexed events the head has moved past.
+    void DropIndexedEventsBeforeHead();
+
     CHIP_ERROR OnInit(TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override;
 };
 
@@ -156,6 +226,8 @@ class CircularEventBufferWrapper : public TLV::TLVCircularBuffer
 public:
     CircularEventBufferWrapper() : TLVCircularBuffer(nullptr, 0), mpCurrent(nullptr){};
     CircularEventBuffer * mpCurrent;
+    // If set, reading starts at this event in mpCurrent instead of at its head.
+    const uint8_t * mpStartPoint = nullptr;
 
 private:
     CHIP_ERROR GetNextBuffer(chip::TLV::TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen) override;
@@ -267,6 +339,15 @@ public:
 
     static void DestroyEventManagement();
 
+    /**
+     * @brief Set the persistent tier of the event log, or nullptr to have none.
+     *
+     * Events evicted from the last event buffer are appended to the persistent log instead of being dropped, and
+     * FetchEventsSince returns the events of the persistent log before those of the buffers.  The persistent log must be
+     * initialized, and must outlive its use by EventManagement.
+     */
+    void SetPersistentEventLog(PersistentEventLog * apPersistentEventLog) { mpPersistentEventLog = apPersistentEventLog; }
+
     /**
      * @brief
      *   Log an event via a EventLoggingDelegate, with options.
@@ -305,6 +386,27 @@ public:
      */
     CHIP_ERROR LogEvent(EventLoggingDelegate * apDelegate, const EventOptions & aEventOptions, EventNumber & aEventNumber);
 
+    /**
+     * @brief
+     *   Stage an event for logging, from any thread and without holding the
+     *   stack lock.
+     *
+     * The event data is serialized right away into a lock-free queue of
+     * CHIP_CONFIG_STAGED_EVENTS_QUEUE_SIZE events, which the Matter thread
+     * drains in batches, logging each event as LogEvent would. Its timestamp
+     * and event number are assigned then.
+     *
+     * @param[in] apDelegate The EventLoggingDelegate to serialize the event data
+     *
+     * @param[in] aEventOptions    The options for the event metadata.
+     *
+     * @retval CHIP_ERROR_NO_MEMORY if the queue is full: the caller then has to
+     *         log the event with the stack lock held.
+     * @retval CHIP_ERROR_BUFFER_TOO_SMALL if the event data is larger than
+     *         CHIP_CONFIG_STAGED_EVENT_MAX_DATA_SIZE.
+     */
+    CHIP_ERROR StageEvent(EventLoggingDelegate * apDelegate, const EventOptions & aEventOptions);
+
     /**
      * @brief
      *   A helper method to get tlv reader along with buffer has data from particular priority
@@ -437,13 +539,8 @@ private:
     // Internal function to log event
     CHIP_ERROR LogEventPrivate(EventLoggingDelegate * apDelegate, const EventOptions & aEventOptions, EventNumber & aEventNumber);
 
-    /**
-     * @brief copy the event outright to next buffer with higher priority
-     *
-     * @param[in] apEventBuffer  CircularEventBuffer
-     *
-     */
-    CHIP_ERROR CopyToNextBuffer(CircularEventBuffer * apEventBuffer);
+    // Log the events staged by StageEvent, on the Matter thread.
+    static void LogStagedEvents(intptr_t);
 
     /**
      * @brief Ensure that:
@@ -517,10 +614,6 @@ private:
      * requires, and return.
      */
     static CHIP_ERROR EvictEvent(chip::TLV::TLVCircularBuffer & aBuffer, void * apAppData, TLV::TLVReader & aReader);
-    static CHIP_ERROR AlwaysFail(chip::TLV::TLVCircularBuffer & aBuffer, void * apAppData, TLV::TLVReader & aReader)
-    {
-        return CHIP_ERROR_NO_MEMORY;
-    };
 
     /**
      * @brief Check whether the event instance represented by the EventEnvelopeContext should be included in the report.
@@ -563,6 +656,9 @@ private:
     Timestamp mLastEventTimestamp;    ///< The timestamp of the last event in this buffer
 
     System::Clock::Milliseconds64 mMonotonicStartupTime;
+
+    // The tier events evicted from the last buffer are moved to, if any.
+    PersistentEventLog * mpPersistentEventLog = nullptr;
 };
 
 } // namespace app
@@ -0,0 +1,128 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/InteractionArena.h>
+
+#include <lib/support/CHIPMem.h>
+
+namespace chip {
+namespace app {
+
+static_assert(InteractionArena::kBlockSize > 0, "CHIP_IM_INTERACTION_ARENA_BLOCK_SIZE must not be zero");
+
+InteractionArena * InteractionArena::sCurrent             = nullptr;
+InteractionArena::Block * InteractionArena::sCachedBlocks = nullptr;
+size_t InteractionArena::sNumCachedBlocks                 = 0;
+
+InteractionArena::Block * InteractionArena::AllocateBlock(size_t aCapacity)
+{
+    if (aCapacity == kBlockSize && sCachedBlocks != nullptr)
+    {
+        Block * block = sCachedBlocks;
+        sCachedBlocks = block->mpNext;
+        sNumCachedBlocks--;
+        block->mpNext = nullptr;
+        return block;
+    }
+
+    VerifyOrReturnValue(aCapacity <= SIZE_MAX - sizeof(Block), nullptr);
+    void * memory = Platform::MemoryAlloc(sizeof(Block) + aCapacity);
+    VerifyOrReturnValue(memory != nullptr, nullptr);
+
+    Block * block    = static_cast<Block *>(memory);
+    block->mpNext    = nullptr;
+    block->mCapacity = aCapacity;
+    return block;
+}
+
+void InteractionArena::ReleaseBlock(Block * aBlock)
+{
+    if (aBlock->mCapacity == kBlockSize && sNumCachedBlocks < kMaxFreeBlocks)
+    {
+        aBlock->mpNext = sCachedBlocks;
+        sCachedBlocks  = aBlock;
+        sNumCachedBlocks++;
+        return;
+    }
+    Platform::MemoryFree(aBlock);
+}
+
+void * InteractionArena::Allocate(size_t aSize, size_t aAlignment)
+{
+    VerifyOrDie(aAlignment != 0 && (aAlignment & (aAlignment - 1)) == 0 && aAlignment <= alignof(std::max_align_t));
+
+    if (aSize > kBlockSize)
+    {
+        // Too big to share a block: give it one of its own, behind the block being carved so that it stays current.
+        Block * block = AllocateBlock(aSize);
+        VerifyOrReturnValue(block != nullptr, nullptr);
+        if (mpBlocks == nullptr)
+        {
+            // Small allocations never carve from a block that is not kBlockSize long, see below.
+            mpBlocks = block;
+        }
+        else
+        {
+            block->mpNext    = mpBlocks->mpNext;
+            mpBlocks->mpNext = block;
+        }
+        mBytesAllocated += aSize;
+        return block->Data();
+    }
+
+    // Block data is aligned on max_align_t, so aligning the offset aligns the address.
+    size_t offset = (mUsed + aAlignment - 1) & ~(aAlignment - 1);
+    if (mpBlocks == nullptr || mpBlocks->mCapacity != kBlockSize || offset + aSize > kBlockSize)
+    {
+        Block * block = AllocateBlock(kBlockSize);
+        VerifyOrReturnValue(block != nullptr, nullptr);
+        block->mpNext = mpBlocks;
+        mpBlocks      = block;
+        offset        = 0;
+    }
+
+    mUsed = offset + aSize;
+    mBytesAllocated += aSize;
+    return mpBlocks->Data() + offset;
+}
+
+void InteractionArena::Reset()
+{
+    while (mpBlocks != nullptr)
+    {
+        Block * block = mpBlocks;
+        mpBlocks      = block->mpNext;
+        ReleaseBlock(block);
+    }
+    mUsed           = 0;
+    mBytesAllocated = 0;
+}
+
+void InteractionArena::ReleaseCachedBlocks()
+{
+    while (sCachedBlocks != nullptr)
+    {
+        Block * block = sCachedBlocks;
+        sCachedBlocks = block->mpNext;
+        Platform::MemoryFree(block);
+    }
+    sNumCachedBlocks = 0;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,143 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/support/CodeUtils.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace chip {
+namespace app {
+
+/**
+ * Scratch memory bound to the lifetime of one interaction.
+ *
+ * Allocations are carved one after the other out of blocks of CHIP_IM_INTERACTION_ARENA_BLOCK_SIZE bytes and are never
+ * freed individually: Reset() releases all of them at once.  The blocks released that way go to a cache shared by all
+ * arenas, holding at most CHIP_IM_INTERACTION_ARENA_MAX_FREE_BLOCKS of them, so a hub serving a steady flow of reads,
+ * writes and invokes reuses the same few blocks instead of going through the heap for every small buffer.  Requests
+ * larger than a block get a block of their own, which goes back to the heap on Reset().
+ *
+ * ReadHandler, WriteHandler and CommandHandlerImpl each own an arena and make it the current one (see Scope) while they
+ * call into the data model, so that code serving the interaction can get its scratch buffers from Current() and forget
+ * about them.  Memory obtained that way must not be kept past the call into the data model, except as documented by the
+ * GetArena() of the handler.
+ *
+ * Arenas and the block cache are not thread-safe: they must only be used with the Matter stack lock held.
+ */
+class InteractionArena
+{
+public:
+    InteractionArena() = default;
+    ~InteractionArena() { Reset(); }
+
+    InteractionArena(const InteractionArena &)             = delete;
+    InteractionArena & operator=(const InteractionArena &) = delete;
+
+    /**
+     * Make an arena the current one for as long as the scope lives, restoring the previous one afterwards.
+     */
+    class Scope
+    {
+    public:
+        explicit Scope(InteractionArena & aArena) : mpPrevious(sCurrent) { sCurrent = &aArena; }
+        ~Scope() { sCurrent = mpPrevious; }
+
+        Scope(const Scope &)             = delete;
+        Scope & operator=(const Scope &) = delete;
+
+    private:
+        InteractionArena * const mpPrevious;
+    };
+
+    /**
+     * Get the arena of the interaction being served, or nullptr outside of one.  Callers getting nullptr are expected to
+     * fall back to Platform::MemoryAlloc().
+     */
+    static InteractionArena * Current() { return sCurrent; }
+
+    /**
+     * Allocate aSize bytes aligned on aAlignment, which must be a power of two no larger than alignof(std::max_align_t).
+     *
+     * @return nullptr when out of memory.
+     */
+    void * Allocate(size_t aSize, size_t aAlignment = alignof(std::max_align_t));
+
+    /**
+     * Allocate zero-initialized room for aCount values of T.  T must be trivially destructible, since the arena never
+     * runs destructors.
+     */
+    template <typename T>
+    T * AllocateArray(size_t aCount)
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "InteractionArena does not run destructors");
+        static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types are not supported");
+        VerifyOrReturnValue(aCount <= SIZE_MAX / sizeof(T), nullptr);
+        void * memory = Allocate(aCount * sizeof(T), alignof(T));
+        VerifyOrReturnValue(memory != nullptr, nullptr);
+        memset(memory, 0, aCount * sizeof(T));
+        return static_cast<T *>(memory);
+    }
+
+    /**
+     * Release all the allocations made from the arena.
+     */
+    void Reset();
+
+    /// The number of bytes handed out since the last Reset(), excluding alignment padding.
+    size_t GetBytesAllocated() const { return mBytesAllocated; }
+    bool IsEmpty() const { return mpBlocks == nullptr; }
+
+    /// The number of blocks waiting in the shared cache.
+    static size_t GetNumCachedBlocks() { return sNumCachedBlocks; }
+
+    /// Give the blocks of the shared cache back to the heap, e.g. on shutdown.
+    static void ReleaseCachedBlocks();
+
+    static constexpr size_t kBlockSize     = CHIP_IM_INTERACTION_ARENA_BLOCK_SIZE;
+    static constexpr size_t kMaxFreeBlocks = CHIP_IM_INTERACTION_ARENA_MAX_FREE_BLOCKS;
+
+private:
+    struct alignas(std::max_align_t) Block
+    {
+        uint8_t * Data() { return reinterpret_cast<uint8_t *>(this + 1); }
+
+        Block * mpNext;
+        size_t mCapacity;
+    };
+
+    static Block * AllocateBlock(size_t aCapacity);
+    static void ReleaseBlock(Block * aBlock);
+
+    // The first block is the one allocations are carved from; blocks of their own are linked after it.
+    Block * mpBlocks       = nullptr;
+    size_t mUsed           = 0;
+    size_t mBytesAllocated = 0;
+
+    static InteractionArena * sCurrent;
+    static Block * sCachedBlocks;
+    static size_t sNumCachedBlocks;
+};
+
+} // namespace app
+} // namespace chip
@@ -46,9 +46,11 @@
 #include <lib/core/Global.h>
 #include <lib/core/TLVUtilities.h>
 #include <lib/support/CHIPFaultInjection.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/FibonacciUtils.h>
 #include <protocols/interaction_model/StatusCode.h>
+#include <tracing/metric_event.h>
 
 // TODO: defaulting to codegen should eventually be an application choice and not
 //       hard-coded in the interaction model
@@ -171,6 +173,7 @@ CHIP_ERROR InteractionModelEngine::Init(Messaging::ExchangeManager * apExchangeM
     ReturnErrorOnFailure(mpExchangeMgr->RegisterUnsolicitedMessageHandlerForProtocol(Protocols::InteractionModel::Id, this));
 
     mReportingEngine.Init();
+    mReadHandlersStats.Register(mReadHandlers);
 
     StatusIB::RegisterErrorFormatter();
 
@@ -183,6 +186,10 @@ void InteractionModelEngine::Shutdown()
     VerifyOrReturn(State::kUninitialized != mState);
 
     mpExchangeMgr->GetSessionManager()->SystemLayer()->CancelTimer(ResumeSubscriptionsTimerCallback, this);
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    ClearSubscriptionResumptions();
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    mReadHandlersStats.Unregister();
 
     // TODO: individual object clears the entire command handler interface registry.
     //       This may not be expected as IME does NOT own the command handler interface registry.
@@ -214,10 +221,12 @@ void InteractionModelEngine::Shutdown()
     //
     // However, we should null out their pointers back to us at the very least so that
     // at destruction time, they won't attempt to reach back here to remove themselves
-    // from this list.
+    // from this list. They can't reach the resubscription coordinator either anymore,
+    // so they give up their place in it first.
     //
     for (auto * readClient = mpActiveReadClientList; readClient != nullptr;)
     {
+        readClient->ReleaseResubscriptionSlot();
         readClient->mpImEngine = nullptr;
         auto * tmpClient       = readClient->GetNextClient();
         readClient->SetNextClient(nullptr);
@@ -242,6 +251,7 @@ void InteractionModelEngine::Shutdown()
     mAttributePathPool.ReleaseAll();
     mEventPathPool.ReleaseAll();
     mDataVersionFilterPool.ReleaseAll();
+    InteractionArena::ReleaseCachedBlocks();
     mpExchangeMgr->UnregisterUnsolicitedMessageHandlerForProtocol(Protocols::InteractionModel::Id);
 
     mpCASESessionMgr = nullptr;
@@ -512,6 +522,14 @@ Status InteractionModelEngine::OnInvokeCommandRequest(Messaging::ExchangeContext
                                                       const PayloadHeader & aPayloadHeader, System::PacketBufferHandle && aPayload,
                                                       bool aIsTimedInvoke)
 {
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    if (mHandlerPoolCapacities.mCommandHandlers != 0 &&
+        mCommandResponderObjs.Allocated() >= mHandlerPoolCapacities.mCommandHandlers)
+    {
+        ChipLogProgress(InteractionModel, "no resource for Invoke interaction");
+        return Status::Busy;
+    }
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
     // TODO(#30453): Refactor CommandResponseSender's constructor to accept an exchange context parameter.
     CommandResponseSender * commandResponder = mCommandResponderObjs.CreateObject(this, this);
     if (commandResponder == nullptr)
@@ -951,6 +969,7 @@ CHIP_ERROR InteractionModelEngine::OnMessageReceived(Messaging::ExchangeContext
                                                      const PayloadHeader & aPayloadHeader, System::PacketBufferHandle && aPayload)
 {
     using namespace Protocols::InteractionModel;
+    CHIP_MEMORY_TAG_SCOPE(kInteractionModel);
 
     Protocols::InteractionModel::Status status = Status::Failure;
 
@@ -1001,7 +1020,8 @@ CHIP_ERROR InteractionModelEngine::OnMessageReceived(Messaging::ExchangeContext
 
     if (status != Status::Success && !apExchangeContext->IsGroupExchangeContext())
     {
-        return StatusResponse::Send(status, apExchangeContext, false /*aExpectResponse*/);
+        // A rejected request is still held by aPayload: build the StatusResponse in its buffer.
+        return StatusResponse::Send(status, apExchangeContext, false /*aExpectResponse*/, std::move(aPayload));
     }
 
     return CHIP_NO_ERROR;
@@ -1052,6 +1072,59 @@ void InteractionModelEngine::AddReadClient(ReadClient * apReadClient)
 }
 #endif // CHIP_CONFIG_ENABLE_READ_CLIENT
 
+bool InteractionModelEngine::IsHandlerQuotaEnforced() const
+{
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP && !CHIP_CONFIG_IM_FORCE_FABRIC_QUOTA_CHECK
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+    VerifyOrReturnValue(!mForceHandlerQuota, true);
+#endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
+    // If the resources are allocated on the heap, we should be able to handle as many Read / Subscribe requests as possible,
+    // unless the application bounded the pools.
+    return mHasHandlerPoolCapacities;
+#else  // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP && !CHIP_CONFIG_IM_FORCE_FABRIC_QUOTA_CHECK
+    return true;
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP && !CHIP_CONFIG_IM_FORCE_FABRIC_QUOTA_CHECK
+}
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+CHIP_ERROR InteractionModelEngine::SetHandlerPoolCapacities(const HandlerPoolCapacities & capacities)
+{
+    const size_t maxFabrics = GetConfigMaxFabrics();
+    const size_t readHandlersForReads =
+        CapacityOrDefault(capacities.mReadHandlersForReads, static_cast<size_t>(CHIP_IM_MAX_NUM_READS));
+    const size_t readHandlersForSubscriptions =
+        CapacityOrDefault(capacities.mReadHandlersForSubscriptions, static_cast<size_t>(CHIP_IM_MAX_NUM_SUBSCRIPTIONS));
+    const size_t pathsForReads =
+        CapacityOrDefault(capacities.mPathsForReads, static_cast<size_t>(CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS));
+    const size_t pathsForSubscriptions = CapacityOrDefault(
+        capacities.mPathsForSubscriptions, static_cast<size_t>(CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS));
+
+    // The same requirements as for the static pools, see the static_asserts in InteractionModelEngine.h.
+    VerifyOrReturnError(readHandlersForReads >= maxFabrics * kMinSupportedReadRequestsPerFabric, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(readHandlersForSubscriptions >= maxFabrics * kMinSupportedSubscriptionsPerFabric,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(pathsForReads >= maxFabrics * kMinSupportedReadRequestsPerFabric * kMinSupportedPathsPerReadRequest,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(pathsForSubscriptions >=
+                            maxFabrics * kMinSupportedSubscriptionsPerFabric * kMinSupportedPathsPerSubscription,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    mHandlerPoolCapacities    = capacities;
+    mHasHandlerPoolCapacities = true;
+    ChipLogProgress(InteractionModel,
+                    "Handler pool capacities: %u reads, %u subscriptions, %u read paths, %u subscription paths",
+                    static_cast<unsigned>(readHandlersForReads), static_cast<unsigned>(readHandlersForSubscriptions),
+                    static_cast<unsigned>(pathsForReads), static_cast<unsigned>(pathsForSubscriptions));
+    return CHIP_NO_ERROR;
+}
+
+void InteractionModelEngine::ClearHandlerPoolCapacities()
+{
+    mHandlerPoolCapacities    = HandlerPoolCapacities();
+    mHasHandlerPoolCapacities = false;
+}
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
 bool InteractionModelEngine::TrimFabricForSubscriptions(FabricIndex aFabricIndex, bool aForceEvict)
 {
     const size_t pathPoolCapacity        = GetPathPoolCapacityForSubscriptions();
@@ -1131,16 +1204,7 @@ bool InteractionModelEngine::TrimFabricForSubscriptions(FabricIndex aFabricIndex
 bool InteractionModelEngine::EnsureResourceForSubscription(FabricIndex aFabricIndex, size_t aRequestedAttributePathCount,
                                                            size_t aRequestedEventPathCount)
 {
-#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP && !CHIP_CONFIG_IM_FORCE_FABRIC_QUOTA_CHECK
-#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
-    const bool allowUnlimited = !mForceHandlerQuota;
-#else  // CONFIG_BUILD_FOR_HOST_UNIT_TEST
-       // If the resources are allocated on the heap, we should be able to handle as many Read / Subscribe requests as possible.
-    const bool allowUnlimited = true;
-#endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
-#else  // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP && !CHIP_CONFIG_IM_FORCE_FABRIC_QUOTA_CHECK
-    const bool allowUnlimited = false;
-#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP && !CHIP_CONFIG_IM_FORCE_FABRIC_QUOTA_CHECK
+    const bool allowUnlimited = !IsHandlerQuotaEnforced();
 
     // Don't couple with read requests, always reserve enough resource for read requests.
 
@@ -1315,16 +1379,7 @@ Protocols::InteractionModel::Status InteractionModelEngine::EnsureResourceForRea
                                                                                   size_t aRequestedAttributePathCount,
                                                                                   size_t aRequestedEventPathCount)
 {
-#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP && !CHIP_CONFIG_IM_FORCE_FABRIC_QUOTA_CHECK
-#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
-    const bool allowUnlimited = !mForceHandlerQuota;
-#else  // CONFIG_BUILD_FOR_HOST_UNIT_TEST
-       // If the resources are allocated on the heap, we should be able to handle as many Read / Subscribe requests as possible.
-    const bool allowUnlimited = true;
-#endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
-#else  // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP && !CHIP_CONFIG_IM_FORCE_FABRIC_QUOTA_CHECK
-    const bool allowUnlimited = false;
-#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP && !CHIP_CONFIG_IM_FORCE_FABRIC_QUOTA_CHECK
+    const bool allowUnlimited = !IsHandlerQuotaEnforced();
 
     // If we return early here, the compiler will complain about the unreachable code, so we add a always-true check.
     const size_t attributePathCap = allowUnlimited ? SIZE_MAX : GetPathPoolCapacityForReads();
@@ -1604,6 +1659,53 @@ void InteractionModelEngine::RemoveDuplicateConcreteAttributePath(SingleLinkedLi
     }
 }
 
+bool InteractionModelEngine::AttributePathCovers(const AttributePathParams & aCovering, const AttributePathParams & aCovered)
+{
+    if (aCovering == aCovered)
+    {
+        return true;
+    }
+    if (!aCovering.IsWildcardPath() || !aCovering.IsAttributePathSupersetOf(aCovered))
+    {
+        return false;
+    }
+    return aCovered.IsWildcardPath() ||
+        IsExistentAttributePath(ConcreteAttributePath(aCovered.mEndpointId, aCovered.mClusterId, aCovered.mAttributeId));
+}
+
+CHIP_ERROR InteractionModelEngine::MergeIntoAttributePathList(SingleLinkedListNode<AttributePathParams> *& aAttributePathList,
+                                                              AttributePathParams & aAttributePath)
+{
+    for (auto * path = aAttributePathList; path != nullptr; path = path->mpNext)
+    {
+        if (AttributePathCovers(path->mValue, aAttributePath))
+        {
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    // Only a wildcard path can cover a path it is not the same as.
+    if (aAttributePath.IsWildcardPath())
+    {
+        SingleLinkedListNode<AttributePathParams> ** link = &aAttributePathList;
+        while (*link != nullptr)
+        {
+            SingleLinkedListNode<AttributePathParams> * path = *link;
+            if (AttributePathCovers(aAttributePath, path->mValue))
+            {
+                *link = path->mpNext;
+                mAttributePathPool.ReleaseObject(path);
+            }
+            else
+            {
+                link = &path->mpNext;
+            }
+        }
+    }
+
+    return PushFrontAttributePathList(aAttributePathList, aAttributePath);
+}
+
 void InteractionModelEngine::ReleaseEventPathList(SingleLinkedListNode<EventPathParams> *& aEventPathList)
 {
     ReleasePool(aEventPathList, mEventPathPool);
@@ -1621,6 +1723,20 @@ CHIP_ERROR InteractionModelEngine::PushFrontEventPathParamsList(SingleLinkedList
     return err;
 }
 
+CHIP_ERROR InteractionModelEngine::MergeIntoEventPathList(SingleLinkedListNode<EventPathParams> *& aEventPathList,
+                                                          EventPathParams & aEventPath)
+{
+    for (auto * path = aEventPathList; path != nullptr; path = path->mpNext)
+    {
+        if (path->mValue.IsSamePath(aEventPath))
+        {
+            path->mValue.mIsUrgentEvent = path->mValue.mIsUrgentEvent || aEventPath.mIsUrgentEvent;
+            return CHIP_NO_ERROR;
+        }
+    }
+    return PushFrontEventPathParamsList(aEventPathList, aEventPath);
+}
+
 void InteractionModelEngine::ReleaseDataVersionFilterList(SingleLinkedListNode<DataVersionFilter> *& aDataVersionFilterList)
 {
     ReleasePool(aDataVersionFilterList, mDataVersionFilterPool);
@@ -1689,6 +1805,19 @@ void InteractionModelEngine::DispatchCommand(CommandHandlerImpl & apCommandObj,
     }
 }
 
+bool InteractionModelEngine::DispatchGroupCommand(CommandHandlerImpl & apCommandObj, const ConcreteCommandPath & aCommandPath,
+                                                  Span<const EndpointId> aEndpoints, TLV::TLVReader & apPayload)
+{
+    Access::SubjectDescriptor subjectDescriptor = apCommandObj.GetSubjectDescriptor();
+
+    DataModel::InvokeRequest request;
+    request.path = aCommandPath;
+    request.invokeFlags.Set(DataModel::InvokeFlags::kTimed, apCommandObj.IsTimedInvoke());
+    request.subjectDescriptor = &subjectDescriptor;
+
+    return GetDataModelProvider()->InvokeGroup(request, aEndpoints, apPayload, &apCommandObj);
+}
+
 Protocols::InteractionModel::Status InteractionModelEngine::ValidateCommandCanBeDispatched(const DataModel::InvokeRequest & request)
 {
 
@@ -1862,7 +1991,7 @@ void InteractionModelEngine::OnTimedInvoke(TimedHandler * apTimedHandler, Messag
     Status status = OnInvokeCommandRequest(apExchangeContext, aPayloadHeader, std::move(aPayload), /* aIsTimedInvoke = */ true);
     if (status != Status::Success)
     {
-        StatusResponse::Send(status, apExchangeContext, /* aExpectResponse = */ false);
+        StatusResponse::Send(status, apExchangeContext, /* aExpectResponse = */ false, std::move(aPayload));
     }
 }
 
@@ -1882,7 +2011,7 @@ void InteractionModelEngine::OnTimedWrite(TimedHandler * apTimedHandler, Messagi
     Status status = OnWriteRequest(apExchangeContext, aPayloadHeader, std::move(aPayload), /* aIsTimedWrite = */ true);
     if (status != Status::Success)
     {
-        StatusResponse::Send(status, apExchangeContext, /* aExpectResponse = */ false);
+        StatusResponse::Send(status, apExchangeContext, /* aExpectResponse = */ false, std::move(aPayload));
     }
 }
 
@@ -1901,11 +2030,10 @@ bool InteractionModelEngine::HasActiveRead()
 uint16_t InteractionModelEngine::GetMinGuaranteedSubscriptionsPerFabric() const
 {
 #if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
-    return UINT16_MAX;
-#else
+    VerifyOrReturnValue(mHasHandlerPoolCapacities, UINT16_MAX);
+#endif
     return static_cast<uint16_t>(
         std::min(GetReadHandlerPoolCapacityForSubscriptions() / GetConfigMaxFabrics(), static_cast<size_t>(UINT16_MAX)));
-#endif
 }
 
 size_t InteractionModelEngine::GetNumDirtySubscriptions() const
@@ -2035,25 +2163,24 @@ void InteractionModelEngine::ResumeSubscriptionsTimerCallback(System::Layer * ap
             continue;
         }
 
-        auto subscriptionResumptionSessionEstablisher = Platform::MakeUnique<SubscriptionResumptionSessionEstablisher>();
-        if (subscriptionResumptionSessionEstablisher == nullptr)
+        // The subscriptions queued or in flight from a previous attempt will complete on their own
+        if (imEngine->IsSubscriptionBeingResumed(subscriptionInfo.mSubscriptionId))
         {
-            ChipLogProgress(InteractionModel, "Failed to create SubscriptionResumptionSessionEstablisher");
-            return;
+            continue;
         }
 
-        if (subscriptionResumptionSessionEstablisher->ResumeSubscription(*imEngine->mpCASESessionMgr, subscriptionInfo) !=
-            CHIP_NO_ERROR)
+        if (imEngine->QueueSubscriptionResumption(subscriptionInfo) != CHIP_NO_ERROR)
         {
             ChipLogProgress(InteractionModel, "Failed to ResumeSubscription 0x%" PRIx32, subscriptionInfo.mSubscriptionId);
-            return;
+            break;
         }
-        subscriptionResumptionSessionEstablisher.release();
 #if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
         resumedSubscriptions = true;
 #endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
     }
 
+    imEngine->StartQueuedSubscriptionResumptions();
+
 #if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
     // If no persisted subscriptions needed resumption then all resumption retries are done
     if (!resumedSubscriptions)
@@ -2117,6 +2244,139 @@ bool InteractionModelEngine::HasSubscriptionsToResume()
 #endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS && CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
 
 #if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+bool InteractionModelEngine::IsSubscriptionBeingResumed(SubscriptionId subscriptionId)
+{
+    for (auto * list : { &mQueuedSubscriptionResumptions, &mSubscriptionResumptionsInFlight })
+    {
+        for (auto & establisher : *list)
+        {
+            if (establisher.HasSubscription(subscriptionId))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+CHIP_ERROR
+InteractionModelEngine::QueueSubscriptionResumption(const SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo)
+{
+    const ScopedNodeId peer(subscriptionInfo.mNodeId, subscriptionInfo.mFabricIndex);
+    for (auto & establisher : mQueuedSubscriptionResumptions)
+    {
+        if (establisher.GetPeer() == peer)
+        {
+            return establisher.AddSubscription(subscriptionInfo);
+        }
+    }
+
+    auto establisher = Platform::MakeUnique<SubscriptionResumptionSessionEstablisher>();
+    VerifyOrReturnError(establisher != nullptr, CHIP_ERROR_NO_MEMORY);
+    ReturnErrorOnFailure(establisher->AddSubscription(subscriptionInfo));
+#if CHIP_CONFIG_ENABLE_ICD_CIP
+    establisher->SetCheckInClient(mICDManager != nullptr &&
+                                  mICDManager->IsCheckInClientRegistered(peer.GetFabricIndex(), peer.GetNodeId()));
+#endif // CHIP_CONFIG_ENABLE_ICD_CIP
+
+    if (mQueuedSubscriptionResumptions.Empty() && mSubscriptionResumptionsInFlight.Empty())
+    {
+        MATTER_LOG_METRIC_BEGIN(Tracing::kMetricDeviceSubscriptionResumption);
+    }
+    mQueuedSubscriptionResumptions.PushBack(establisher.release());
+    mSubscriptionResumptionStats.mNumPeersQueued++;
+    return CHIP_NO_ERROR;
+}
+
+bool InteractionModelEngine::IsResumedBefore(const SubscriptionResumptionSessionEstablisher & establisher,
+                                             const SubscriptionResumptionSessionEstablisher & other)
+{
+    // The clients registered for Check-In messages go first, as they keep being sent Check-In messages until their
+    // subscriptions are back.  Then the peers that would notice the loss of their subscriptions first.
+    if (establisher.IsCheckInClient() != other.IsCheckInClient())
+    {
+        return establisher.IsCheckInClient();
+    }
+    return establisher.GetShortestMaxInterval() < other.GetShortestMaxInterval();
+}
+
+void InteractionModelEngine::StartQueuedSubscriptionResumptions()
+{
+    VerifyOrReturn(mpCASESessionMgr != nullptr);
+
+    while (mSubscriptionResumptionStats.mNumPeersInFlight < CHIP_CONFIG_MAX_PARALLEL_SUBSCRIPTION_RESUMPTIONS &&
+           !mQueuedSubscriptionResumptions.Empty())
+    {
+        SubscriptionResumptionSessionEstablisher * nextResumption = nullptr;
+        for (auto & establisher : mQueuedSubscriptionResumptions)
+        {
+            if (nextResumption == nullptr || IsResumedBefore(establisher, *nextResumption))
+            {
+                nextResumption = &establisher;
+            }
+        }
+
+        mQueuedSubscriptionResumptions.Remove(nextResumption);
+        mSubscriptionResumptionStats.mNumPeersQueued--;
+        mSubscriptionResumptionsInFlight.PushBack(nextResumption);
+        mSubscriptionResumptionStats.mNumPeersInFlight++;
+
+        // The establisher may be done, and deleted, before ResumeSubscriptions returns.
+        ChipLogProgress(InteractionModel, "Resuming %u subscription(s) of " ChipLogFormatScopedNodeId,
+                        static_cast<unsigned>(nextResumption->GetNumSubscriptions()),
+                        ChipLogValueScopedNodeId(nextResumption->GetPeer()));
+        CHIP_ERROR err = nextResumption->ResumeSubscriptions(*mpCASESessionMgr);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(InteractionModel, "Failed to resume subscriptions: %" CHIP_ERROR_FORMAT, err.Format());
+            OnSubscriptionResumptionDone(*nextResumption, 0, nextResumption->GetNumSubscriptions());
+        }
+    }
+}
+
+void InteractionModelEngine::OnSubscriptionResumptionDone(SubscriptionResumptionSessionEstablisher & establisher,
+                                                          size_t numResumed, size_t numFailed)
+{
+    if (establisher.IsInList())
+    {
+        mSubscriptionResumptionsInFlight.Remove(&establisher);
+        mSubscriptionResumptionStats.mNumPeersInFlight--;
+    }
+    Platform::Delete(&establisher);
+
+    mSubscriptionResumptionStats.mNumSubscriptionsResumed += static_cast<uint32_t>(numResumed);
+    mSubscriptionResumptionStats.mNumSubscriptionsFailed += static_cast<uint32_t>(numFailed);
+    MATTER_LOG_METRIC(Tracing::kMetricDeviceSubscriptionResumptionResumedCount, static_cast<uint32_t>(numResumed));
+    MATTER_LOG_METRIC(Tracing::kMetricDeviceSubscriptionResumptionFailedCount, static_cast<uint32_t>(numFailed));
+    ChipLogProgress(InteractionModel,
+                    "Subscription resumption: %" PRIu32 " resumed, %" PRIu32 " failed, %u peer(s) in flight, %u peer(s) queued",
+                    mSubscriptionResumptionStats.mNumSubscriptionsResumed, mSubscriptionResumptionStats.mNumSubscriptionsFailed,
+                    mSubscriptionResumptionStats.mNumPeersInFlight, mSubscriptionResumptionStats.mNumPeersQueued);
+
+    if (mQueuedSubscriptionResumptions.Empty() && mSubscriptionResumptionsInFlight.Empty())
+    {
+        MATTER_LOG_METRIC_END(Tracing::kMetricDeviceSubscriptionResumption);
+        return;
+    }
+    StartQueuedSubscriptionResumptions();
+}
+
+void InteractionModelEngine::ClearSubscriptionResumptions()
+{
+    // Deleting the establishers in flight cancels their session callbacks.
+    for (auto * list : { &mQueuedSubscriptionResumptions, &mSubscriptionResumptionsInFlight })
+    {
+        while (!list->Empty())
+        {
+            SubscriptionResumptionSessionEstablisher * establisher = &(*list->begin());
+            list->Remove(establisher);
+            Platform::Delete(establisher);
+        }
+    }
+    mSubscriptionResumptionStats.mNumPeersQueued   = 0;
+    mSubscriptionResumptionStats.mNumPeersInFlight = 0;
+}
+
 void InteractionModelEngine::DecrementNumSubscriptionsToResume()
 {
     VerifyOrReturn(mNumOfSubscriptionsToResume > 0);
@@ -59,6 +59,7 @@
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
+#include <lib/support/IntrusiveList.h>
 #include <lib/support/LinkedList.h>
 #include <lib/support/Pool.h>
 #include <lib/support/logging/CHIPLogging.h>
@@ -68,6 +69,7 @@
 #include <protocols/Protocols.h>
 #include <protocols/interaction_model/Constants.h>
 #include <system/SystemPacketBuffer.h>
+#include <system/SystemStats.h>
 
 #include <app/CASESessionManager.h>
 
@@ -204,10 +206,26 @@ public:
     // the path SHALL be removed from the list.
     void RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths);
 
+    /**
+     * Adds the attribute path to the front of the list, unless a path of the list already covers it, and removes the paths
+     * of the list that it covers, so that overlapping requested paths use a single entry of the pool.
+     *
+     * A path covers another one if they are the same, or if it is a wildcard superset of either a wildcard path or an
+     * existent concrete path: a concrete path to a non-existent attribute is kept for its status to be reported.
+     */
+    CHIP_ERROR MergeIntoAttributePathList(SingleLinkedListNode<AttributePathParams> *& aAttributePathList,
+                                          AttributePathParams & aAttributePath);
+
     void ReleaseEventPathList(SingleLinkedListNode<EventPathParams> *& aEventPathList);
 
     CHIP_ERROR PushFrontEventPathParamsList(SingleLinkedListNode<EventPathParams> *& aEventPathList, EventPathParams & aEventPath);
 
+    /**
+     * Adds the event path to the front of the list, unless the same path is already in it, in which case that path is only
+     * made urgent if the added one is.
+     */
+    CHIP_ERROR MergeIntoEventPathList(SingleLinkedListNode<EventPathParams> *& aEventPathList, EventPathParams & aEventPath);
+
     void ReleaseDataVersionFilterList(SingleLinkedListNode<DataVersionFilter> *& aDataVersionFilterList);
 
     CHIP_ERROR PushFrontDataVersionFilterList(SingleLinkedListNode<DataVersionFilter> *& aDataVersionFilterList,
@@ -269,6 +287,13 @@ public:
      * Return the number of active read clients being tracked by the engine.
      */
     size_t GetNumActiveReadClients();
+
+    /**
+     * Set the coordinator spreading and capping the resubscriptions of the read clients, or nullptr to let them resubscribe
+     * on their own schedule.  The coordinator has to outlive the subscriptions, and should be set before any of them starts.
+     */
+    void SetResubscriptionCoordinator(ResubscriptionCoordinator * apCoordinator) { mpResubscriptionCoordinator = apCoordinator; }
+    ResubscriptionCoordinator * GetResubscriptionCoordinator() const { return mpResubscriptionCoordinator; }
 #endif // CHIP_CONFIG_ENABLE_READ_CLIENT
 
     /**
@@ -298,12 +323,43 @@ public:
 
     /**
      * Returns the minimal value of guaranteed subscriptions per fabic. UINT16_MAX will be returned if current app is configured to
-     * use heap for the object pools used by interaction model engine.
+     * use heap for the object pools used by interaction model engine, and no handler pool capacities were set.
      *
      * @retval the minimal value of guaranteed subscriptions per fabic.
      */
     uint16_t GetMinGuaranteedSubscriptionsPerFabric() const;
 
+    /**
+     * Capacities of the handler pools, for platforms allocating the object pools used by interaction model engine from the
+     * heap.  A capacity of 0 keeps the compile-time value of the corresponding CHIP_IM_* configuration.
+     */
+    struct HandlerPoolCapacities
+    {
+        size_t mReadHandlersForReads         = 0;
+        size_t mReadHandlersForSubscriptions = 0;
+        size_t mPathsForReads                = 0;
+        size_t mPathsForSubscriptions        = 0;
+        size_t mCommandHandlers              = 0;
+    };
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    /**
+     * Bound the handler pools, which otherwise grow for as long as memory is available, without any per-fabric quota.
+     *
+     * Once capacities are set, the per-fabric quotas are derived from them and enforced by evicting reads and subscriptions, as
+     * for statically allocated pools.  The capacities can be raised or lowered at runtime; lowering them does not evict the
+     * handlers in use until new requests need their resources.
+     *
+     * @retval #CHIP_ERROR_INVALID_ARGUMENT if the capacities do not leave the minimas of spec 8.5.1 to each fabric.
+     */
+    CHIP_ERROR SetHandlerPoolCapacities(const HandlerPoolCapacities & capacities);
+
+    /**
+     * Go back to unbounded handler pools.
+     */
+    void ClearHandlerPoolCapacities();
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
     // virtual method from FabricTable::Delegate
     void OnFabricRemoved(const FabricTable & fabricTable, FabricIndex fabricIndex) override;
 
@@ -322,6 +378,20 @@ public:
      *        was succesful or not.
      */
     void DecrementNumSubscriptionsToResume();
+
+    /**
+     * Progress of the resumption of the persisted subscriptions.  The counts of resumed and failed subscriptions accumulate
+     * over the resumption attempts.
+     */
+    struct SubscriptionResumptionStats
+    {
+        uint16_t mNumPeersQueued          = 0;
+        uint16_t mNumPeersInFlight        = 0;
+        uint32_t mNumSubscriptionsResumed = 0;
+        uint32_t mNumSubscriptionsFailed  = 0;
+    };
+
+    const SubscriptionResumptionStats & GetSubscriptionResumptionStats() const { return mSubscriptionResumptionStats; }
 #endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
 
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
@@ -387,6 +457,7 @@ public:
 #if CHIP_CONFIG_ENABLE_READ_CLIENT
         for (auto * readClient = mpActiveReadClientList; readClient != nullptr;)
         {
+            readClient->ReleaseResubscriptionSlot();
             readClient->mpImEngine = nullptr;
             auto * tmpClient       = readClient->GetNextClient();
             readClient->SetNextClient(nullptr);
@@ -509,37 +580,52 @@ private:
     void DispatchCommand(CommandHandlerImpl & apCommandObj, const ConcreteCommandPath & aCommandPath,
                          TLV::TLVReader & apPayload) override;
 
+    bool DispatchGroupCommand(CommandHandlerImpl & apCommandObj, const ConcreteCommandPath & aCommandPath,
+                              Span<const EndpointId> aEndpoints, TLV::TLVReader & apPayload) override;
+
     Protocols::InteractionModel::Status ValidateCommandCanBeDispatched(const DataModel::InvokeRequest & request) override;
 
     bool HasActiveRead();
 
+    static constexpr size_t CapacityOrDefault(size_t aCapacity, size_t aDefaultCapacity)
+    {
+        return (aCapacity == 0) ? aDefaultCapacity : aCapacity;
+    }
+
+    // Whether the fabric quotas and pool capacities are enforced, which they always are for statically allocated pools.
+    bool IsHandlerQuotaEnforced() const;
+
     inline size_t GetPathPoolCapacityForReads() const
     {
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
-        return (mPathPoolCapacityForReadsOverride == -1) ? CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS
-                                                         : static_cast<size_t>(mPathPoolCapacityForReadsOverride);
+        return (mPathPoolCapacityForReadsOverride == -1)
+            ? CapacityOrDefault(mHandlerPoolCapacities.mPathsForReads, CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS)
+            : static_cast<size_t>(mPathPoolCapacityForReadsOverride);
 #else
-        return CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS;
+        return CapacityOrDefault(mHandlerPoolCapacities.mPathsForReads, CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS);
 #endif
     }
 
     inline size_t GetReadHandlerPoolCapacityForReads() const
     {
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
-        return (mReadHandlerCapacityForReadsOverride == -1) ? CHIP_IM_MAX_NUM_READS
-                                                            : static_cast<size_t>(mReadHandlerCapacityForReadsOverride);
+        return (mReadHandlerCapacityForReadsOverride == -1)
+            ? CapacityOrDefault(mHandlerPoolCapacities.mReadHandlersForReads, CHIP_IM_MAX_NUM_READS)
+            : static_cast<size_t>(mReadHandlerCapacityForReadsOverride);
 #else
-        return CHIP_IM_MAX_NUM_READS;
+        return CapacityOrDefault(mHandlerPoolCapacities.mReadHandlersForReads, CHIP_IM_MAX_NUM_READS);
 #endif
     }
 
     inline size_t GetPathPoolCapacityForSubscriptions() const
     {
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
-        return (mPathPoolCapacityForSubscriptionsOverride == -1) ? CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS
-                                                                 : static_cast<size_t>(mPathPoolCapacityForSubscriptionsOverride);
+        return (mPathPoolCapacityForSubscriptionsOverride == -1)
+            ? CapacityOrDefault(mHandlerPoolCapacities.mPathsForSubscriptions, CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS)
+            : static_cast<size_t>(mPathPoolCapacityForSubscriptionsOverride);
 #else
-        return CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS;
+        return CapacityOrDefault(mHandlerPoolCapacities.mPathsForSubscriptions,
+                                 CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS);
 #endif
     }
 
@@ -547,10 +633,10 @@ private:
     {
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
         return (mReadHandlerCapacityForSubscriptionsOverride == -1)
-            ? CHIP_IM_MAX_NUM_SUBSCRIPTIONS
+            ? CapacityOrDefault(mHandlerPoolCapacities.mReadHandlersForSubscriptions, CHIP_IM_MAX_NUM_SUBSCRIPTIONS)
             : static_cast<size_t>(mReadHandlerCapacityForSubscriptionsOverride);
 #else
-        return CHIP_IM_MAX_NUM_SUBSCRIPTIONS;
+        return CapacityOrDefault(mHandlerPoolCapacities.mReadHandlersForSubscriptions, CHIP_IM_MAX_NUM_SUBSCRIPTIONS);
 #endif
     }
 
@@ -622,6 +708,11 @@ private:
      */
     bool IsExistentAttributePath(const ConcreteAttributePath & path);
 
+    /**
+     * Check if the requested attribute path aCovering makes the requested attribute path aCovered redundant.
+     */
+    bool AttributePathCovers(const AttributePathParams & aCovering, const AttributePathParams & aCovered);
+
     static void ResumeSubscriptionsTimerCallback(System::Layer * apSystemLayer, void * apAppState);
 
     template <typename T, size_t N>
@@ -668,13 +759,19 @@ private:
         mDataVersionFilterPool;
 
     ObjectPool<ReadHandler, CHIP_IM_MAX_NUM_READS + CHIP_IM_MAX_NUM_SUBSCRIPTIONS> mReadHandlers;
+    System::Stats::PoolStatistics mReadHandlersStats{ SYSTEM_STATS_METRIC_KEYS("read_handlers") };
 
 #if CHIP_CONFIG_ENABLE_READ_CLIENT
-    ReadClient * mpActiveReadClientList = nullptr;
+    ReadClient * mpActiveReadClientList                     = nullptr;
+    ResubscriptionCoordinator * mpResubscriptionCoordinator = nullptr;
 #endif
 
     ReadHandler::ApplicationCallback * mpReadHandlerApplicationCallback = nullptr;
 
+    // Only set on platforms using heap for the pools, through SetHandlerPoolCapacities.
+    HandlerPoolCapacities mHandlerPoolCapacities;
+    bool mHasHandlerPoolCapacities = false;
+
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     int mReadHandlerCapacityForSubscriptionsOverride = -1;
     int mPathPoolCapacityForSubscriptionsOverride    = -1;
@@ -701,6 +798,25 @@ private:
      * by ComputeTimeSecondsTillNextSubscriptionResumption.
      */
     int8_t mNumOfSubscriptionsToResume = 0;
+
+    /**
+     * The subscriptions to resume are grouped by peer, each peer getting an establisher for all of its subscriptions.  At most
+     * CHIP_CONFIG_MAX_PARALLEL_SUBSCRIPTION_RESUMPTIONS peers are resumed at the same time; the others wait in
+     * mQueuedSubscriptionResumptions, and are started by order of priority as the resumptions in flight complete.
+     */
+    IntrusiveList<SubscriptionResumptionSessionEstablisher> mQueuedSubscriptionResumptions;
+    IntrusiveList<SubscriptionResumptionSessionEstablisher> mSubscriptionResumptionsInFlight;
+    SubscriptionResumptionStats mSubscriptionResumptionStats;
+
+    bool IsSubscriptionBeingResumed(SubscriptionId subscriptionId);
+    CHIP_ERROR QueueSubscriptionResumption(const SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo);
+    // Whether the subscriptions of the first establisher should be resumed before those of the second one.
+    bool IsResumedBefore(const SubscriptionResumptionSessionEstablisher & establisher,
+                         const SubscriptionResumptionSessionEstablisher & other);
+    void StartQueuedSubscriptionResumptions();
+    // Called by the establishers when they are done, deleting them.
+    void OnSubscriptionResumptionDone(SubscriptionResumptionSessionEstablisher & establisher, size_t numResumed, size_t numFailed);
+    void ClearSubscriptionResumptions();
 #if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
     bool HasSubscriptionsToResume();
     uint32_t ComputeTimeSecondsTillNextSubscriptionResumption();
@@ -25,15 +25,20 @@
 namespace chip {
 namespace app {
 
-static CHIP_ERROR InitWriterWithSpaceReserved(System::PacketBufferTLVWriter & aWriter, uint32_t aReserveSpace)
+/**
+ * Initialize a writer with a buffer for a message of at most aMaxSize bytes (kMaxLargeSecureSduLengthBytes for sessions that
+ * allow large payloads), reserving aReserveSpace bytes at its end in addition to the MIC.
+ */
+static CHIP_ERROR InitWriterWithSpaceReserved(System::PacketBufferTLVWriter & aWriter, uint32_t aReserveSpace,
+                                              size_t aMaxSize = kMaxSecureSduLengthBytes)
 {
-    System::PacketBufferHandle msgBuf = System::PacketBufferHandle::New(kMaxSecureSduLengthBytes);
+    System::PacketBufferHandle msgBuf = System::PacketBufferHandle::New(aMaxSize);
     VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_NO_MEMORY);
     uint16_t reservedSize = 0;
 
-    if (msgBuf->AvailableDataLength() > kMaxSecureSduLengthBytes)
+    if (msgBuf->AvailableDataLength() > aMaxSize)
     {
-        reservedSize = static_cast<uint16_t>(msgBuf->AvailableDataLength() - kMaxSecureSduLengthBytes);
+        reservedSize = static_cast<uint16_t>(msgBuf->AvailableDataLength() - aMaxSize);
     }
 
     reservedSize = static_cast<uint16_t>(reservedSize + Crypto::CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES + aReserveSpace);
@@ -221,7 +221,8 @@ void OperationalSessionSetup::UpdateDeviceData(const ResolveResult & result)
                   mPeerId.GetFabricIndex(), ChipLogValueX64(mPeerId.GetNodeId()), peerAddrBuff, static_cast<int>(mState));
 #endif
 
-    mDeviceAddress = addr;
+    mDeviceAddress      = addr;
+    mUsingCachedAddress = result.isFromCache;
 
     // Initialize CASE session state with any MRP parameters that DNS-SD has provided.
     // It can be overridden by CASE session protocol messages that include MRP parameters.
@@ -331,6 +332,10 @@ CHIP_ERROR OperationalSessionSetup::EstablishConnection(const ResolveResult & re
 
     MoveToState(State::Connecting);
 
+#if CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS > 0
+    ScheduleStaggeredAttempt();
+#endif // CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS > 0
+
     return CHIP_NO_ERROR;
 }
 
@@ -436,6 +441,24 @@ void OperationalSessionSetup::OnSessionEstablishmentError(CHIP_ERROR error, Sess
     VerifyOrReturn(mState == State::Connecting,
                    ChipLogError(Discovery, "OnSessionEstablishmentError was called while we were not connecting"));
 
+#if CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS > 0
+    if (mStaggeredCASEClient != nullptr)
+    {
+        // The handshake to another address of the peer is still in progress:
+        // it is now the only one.
+        ChipLogProgress(Discovery,
+                        "OperationalSessionSetup[%u:" ChipLogFormatX64 "]: CASE failed (%" CHIP_ERROR_FORMAT
+                        "), waiting for the staggered attempt",
+                        mPeerId.GetFabricIndex(), ChipLogValueX64(mPeerId.GetNodeId()), error.Format());
+        mClientPool->Release(mCASEClient);
+        mCASEClient          = mStaggeredCASEClient;
+        mStaggeredCASEClient = nullptr;
+        mDeviceAddress       = mStaggeredResult.address;
+        mUsingCachedAddress  = mStaggeredResult.isFromCache;
+        return;
+    }
+#endif // CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS > 0
+
     // If this condition ever changes, we may need to store the error in a
     // member instead of having a boolean
     // mTryingNextResultDueToSessionEstablishmentError, so we can recover the
@@ -466,6 +489,18 @@ void OperationalSessionSetup::OnSessionEstablishmentError(CHIP_ERROR error, Sess
         mTryingNextResultDueToSessionEstablishmentError = false;
 #endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
 
+        if (mUsingCachedAddress && CHIP_ERROR_TIMEOUT == error)
+        {
+            // The last known address of the peer did not answer, the peer may
+            // have moved: look up its current address before giving up.
+            mUsingCachedAddress  = false;
+            mCachedAddressFailed = true;
+            if (CHIP_NO_ERROR == LookupPeerAddress())
+            {
+                return;
+            }
+        }
+
         // Moving back to the Connecting state would be a bit of a lie, since we
         // don't have an mCASEClient.  Just go back to NeedsAddress, since
         // that's really where we are now.
@@ -535,8 +570,136 @@ void OperationalSessionSetup::CleanupCASEClient()
         mClientPool->Release(mCASEClient);
         mCASEClient = nullptr;
     }
+
+#if CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS > 0
+    CleanupStaggeredAttempt();
+#endif // CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS > 0
+}
+
+#if CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS > 0
+void OperationalSessionSetup::ScheduleStaggeredAttempt()
+{
+    auto * sessionManager = mInitParams.exchangeMgr->GetSessionManager();
+    VerifyOrReturn(sessionManager != nullptr && sessionManager->SystemLayer() != nullptr);
+
+    // Without the timer, addresses are just tried one after the other.
+    LogErrorOnFailure(sessionManager->SystemLayer()->StartTimer(
+        System::Clock::Milliseconds32(CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS), OnStaggeredAttemptTimer, this));
+}
+
+void OperationalSessionSetup::OnStaggeredAttemptTimer(System::Layer * systemLayer, void * context)
+{
+    auto * self = static_cast<OperationalSessionSetup *>(context);
+    VerifyOrReturn(self->mState == State::Connecting && self->mStaggeredCASEClient == nullptr);
+
+    self->mStartingStaggeredAttempt = true;
+    CHIP_ERROR err                  = Resolver::Instance().TryNextResult(self->mAddressLookupHandle);
+    self->mStartingStaggeredAttempt = false;
+
+    // CHIP_ERROR_NOT_FOUND just means that there is no other address to try,
+    // in which case the handshake in progress is the last one.
+    if (err != CHIP_ERROR_NOT_FOUND)
+    {
+        LogErrorOnFailure(err);
+    }
 }
 
+void OperationalSessionSetup::StartStaggeredAttempt(const ResolveResult & result)
+{
+    mStaggeredResult = result;
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT
+    if (mTransportPayloadCapability == TransportPayloadCapability::kLargePayload)
+    {
+        if (!result.supportsTcpServer)
+        {
+            // Not usable for this session, move on to the next address.
+            ScheduleStaggeredAttempt();
+            return;
+        }
+        mStaggeredResult.address.SetTransportType(chip::Transport::Type::kTcp);
+    }
+#endif
+
+    mStaggeredCASEClient = mClientPool->Allocate();
+    VerifyOrReturn(mStaggeredCASEClient != nullptr);
+
+#if CHIP_PROGRESS_LOGGING
+    char peerAddrBuff[Transport::PeerAddress::kMaxToStringSize];
+    mStaggeredResult.address.ToString(peerAddrBuff);
+    ChipLogProgress(Discovery, "OperationalSessionSetup[%u:" ChipLogFormatX64 "]: Also trying CASE to %s",
+                    mPeerId.GetFabricIndex(), ChipLogValueX64(mPeerId.GetNodeId()), peerAddrBuff);
+#endif // CHIP_PROGRESS_LOGGING
+
+    CHIP_ERROR err = mStaggeredCASEClient->EstablishSession(mInitParams, mPeerId, mStaggeredResult.address,
+                                                            mStaggeredResult.mrpRemoteConfig, &mStaggeredAttemptDelegate);
+    if (err != CHIP_NO_ERROR)
+    {
+        LogErrorOnFailure(err);
+        CleanupStaggeredAttempt();
+        ScheduleStaggeredAttempt();
+    }
+}
+
+void OperationalSessionSetup::CleanupStaggeredAttempt()
+{
+    auto * sessionManager = mInitParams.exchangeMgr->GetSessionManager();
+    if (sessionManager != nullptr && sessionManager->SystemLayer() != nullptr)
+    {
+        sessionManager->SystemLayer()->CancelTimer(OnStaggeredAttemptTimer, this);
+    }
+
+    if (mStaggeredCASEClient)
+    {
+        mClientPool->Release(mStaggeredCASEClient);
+        mStaggeredCASEClient = nullptr;
+    }
+}
+
+void OperationalSessionSetup::OnStaggeredSessionEstablishmentError(CHIP_ERROR error, SessionEstablishmentStage stage)
+{
+    if (mStaggeredCASEClient == nullptr)
+    {
+        // This handshake replaced the first one, which failed already.
+        OnSessionEstablishmentError(error, stage);
+        return;
+    }
+
+    ChipLogProgress(Discovery, "OperationalSessionSetup[%u:" ChipLogFormatX64 "]: Staggered CASE failed: %" CHIP_ERROR_FORMAT,
+                    mPeerId.GetFabricIndex(), ChipLogValueX64(mPeerId.GetNodeId()), error.Format());
+    CleanupStaggeredAttempt();
+
+    // The first handshake is still in progress, and may be raced by the next
+    // address, unless the peer said it is busy: its other addresses reach the
+    // same busy node.
+    if (error != CHIP_ERROR_BUSY)
+    {
+        ScheduleStaggeredAttempt();
+    }
+}
+
+void OperationalSessionSetup::OnStaggeredSessionEstablished(const SessionHandle & session)
+{
+    if (mStaggeredCASEClient != nullptr)
+    {
+        // The other address of the peer answered first: use it from now on.
+        mDeviceAddress = mStaggeredResult.address;
+        mInitParams.sessionManager->UpdateAllSessionsPeerAddress(mPeerId, mDeviceAddress);
+    }
+
+    OnSessionEstablished(session);
+}
+
+void OperationalSessionSetup::OnStaggeredResponderBusy(System::Clock::Milliseconds16 requestedDelay)
+{
+    // Busy responses to the first handshake are the ones that matter, unless
+    // this handshake replaced it.
+    if (mStaggeredCASEClient == nullptr)
+    {
+        OnResponderBusy(requestedDelay);
+    }
+}
+#endif // CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS > 0
+
 OperationalSessionSetup::~OperationalSessionSetup()
 {
     if (mAddressLookupHandle.IsActive())
@@ -561,6 +724,10 @@ OperationalSessionSetup::~OperationalSessionSetup()
         mClientPool->Release(mCASEClient);
     }
 
+#if CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS > 0
+    CleanupStaggeredAttempt();
+#endif // CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS > 0
+
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
     CancelSessionSetupReattempt();
 #endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
@@ -608,6 +775,7 @@ CHIP_ERROR OperationalSessionSetup::LookupPeerAddress()
     PeerId peerId(fabricInfo->GetCompressedFabricId(), mPeerId.GetNodeId());
 
     NodeLookupRequest request(peerId);
+    request.SetUseCachedAddress(!mPerformingAddressUpdate && !mCachedAddressFailed);
 
     return Resolver::Instance().LookupNode(request, mAddressLookupHandle);
 }
@@ -640,6 +808,14 @@ void OperationalSessionSetup::PerformAddressUpdate()
 
 void OperationalSessionSetup::OnNodeAddressResolved(const PeerId & peerId, const ResolveResult & result)
 {
+#if CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS > 0
+    if (mStartingStaggeredAttempt)
+    {
+        StartStaggeredAttempt(result);
+        return;
+    }
+#endif // CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS > 0
+
     UpdateDeviceData(result);
 }
 
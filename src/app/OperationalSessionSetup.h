@@ -285,6 +285,8 @@ public:
 #endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
 
 private:
+    friend class TestOperationalSessionSetup;
+
     enum class State : uint8_t
     {
         Uninitialized,    // Error state: OperationalSessionSetup is useless
@@ -304,6 +306,41 @@ private:
     // allocated it as part of an attempt to enter State::Connecting.
     CASEClient * mCASEClient = nullptr;
 
+#if CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS > 0
+    // Forwards the events of the staggered CASE handshake, so that they can
+    // be told apart from the ones of mCASEClient.
+    class StaggeredAttemptDelegate : public SessionEstablishmentDelegate
+    {
+    public:
+        StaggeredAttemptDelegate(OperationalSessionSetup & owner) : mOwner(owner) {}
+
+        void OnSessionEstablishmentError(CHIP_ERROR error, SessionEstablishmentStage stage) override
+        {
+            mOwner.OnStaggeredSessionEstablishmentError(error, stage);
+        }
+        void OnSessionEstablished(const SessionHandle & session) override { mOwner.OnStaggeredSessionEstablished(session); }
+        void OnResponderBusy(System::Clock::Milliseconds16 requestedDelay) override
+        {
+            mOwner.OnStaggeredResponderBusy(requestedDelay);
+        }
+
+    private:
+        OperationalSessionSetup & mOwner;
+    };
+
+    // mStaggeredCASEClient is only non-null while its handshake, to the
+    // address in mStaggeredResult, races the one of mCASEClient.  If the
+    // handshake of mCASEClient fails first, mStaggeredCASEClient replaces it
+    // (and keeps using mStaggeredAttemptDelegate).
+    CASEClient * mStaggeredCASEClient = nullptr;
+    AddressResolve::ResolveResult mStaggeredResult;
+    StaggeredAttemptDelegate mStaggeredAttemptDelegate{ *this };
+
+    // Set while TryNextResult is fetching the address of a staggered attempt,
+    // since the resolver reports it synchronously to OnNodeAddressResolved.
+    bool mStartingStaggeredAttempt = false;
+#endif // CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS > 0
+
     ScopedNodeId mPeerId;
 
     Transport::PeerAddress mDeviceAddress = Transport::PeerAddress::UDP(Inet::IPAddress::Any);
@@ -322,6 +359,12 @@ private:
 
     bool mPerformingAddressUpdate = false;
 
+    // Whether the address being tried is the last known address of the peer
+    // rather than a fresh DNS-SD result, and whether such an address already
+    // failed, in which case lookups only accept fresh results.
+    bool mUsingCachedAddress  = false;
+    bool mCachedAddressFailed = false;
+
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES || CHIP_CONFIG_ENABLE_BUSY_HANDLING_FOR_OPERATIONAL_SESSION_SETUP
     System::Clock::Milliseconds16 mRequestedBusyDelay = System::Clock::kZero;
 #endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES || CHIP_CONFIG_ENABLE_BUSY_HANDLING_FOR_OPERATIONAL_SESSION_SETUP
@@ -360,6 +403,25 @@ private:
 
     void CleanupCASEClient();
 
+#if CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS > 0
+    /**
+     * Starts the timer after which the next address of the peer, if any, is
+     * tried in parallel with the CASE handshake in progress.
+     */
+    void ScheduleStaggeredAttempt();
+    static void OnStaggeredAttemptTimer(System::Layer * systemLayer, void * context);
+    void StartStaggeredAttempt(const AddressResolve::ResolveResult & result);
+
+    /**
+     * Cancels the staggered attempt timer, and the staggered handshake if any.
+     */
+    void CleanupStaggeredAttempt();
+
+    void OnStaggeredSessionEstablishmentError(CHIP_ERROR error, SessionEstablishmentStage stage);
+    void OnStaggeredSessionEstablished(const SessionHandle & session);
+    void OnStaggeredResponderBusy(System::Clock::Milliseconds16 requestedDelay);
+#endif // CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS > 0
+
     void Connect(Callback::Callback<OnDeviceConnected> * onConnection, Callback::Callback<OnDeviceConnectionFailure> * onFailure,
                  Callback::Callback<OnSetupFailure> * onSetupFailure,
                  TransportPayloadCapability transportPayloadCapability = TransportPayloadCapability::kMRPPayload);
@@ -0,0 +1,355 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <app/PersistentEventLog.h>
+
+#include <app/EventManagement.h>
+#include <app/MessageDef/EventReportIB.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace app {
+
+namespace {
+
+constexpr TLV::Tag kFirstSegmentTag     = TLV::ContextTag(1);
+constexpr TLV::Tag kSegmentsTag         = TLV::ContextTag(2);
+constexpr TLV::Tag kFirstEventNumberTag = TLV::ContextTag(1);
+constexpr TLV::Tag kLastEventNumberTag  = TLV::ContextTag(2);
+constexpr TLV::Tag kLengthTag           = TLV::ContextTag(3);
+
+constexpr size_t kSegmentInfoSize = TLV::EstimateStructOverhead(sizeof(EventNumber), sizeof(EventNumber), sizeof(uint16_t));
+constexpr size_t kIndexBufferSize =
+    TLV::EstimateStructOverhead(sizeof(uint16_t), PersistentEventLog::kSegmentCount * kSegmentInfoSize);
+
+// Sets the fabric index of an event in a segment buffer to kUndefinedFabricIndex if it is the given one.
+CHIP_ERROR ClearEventFabric(uint8_t * apSegment, const TLV::TLVReader & aReader, FabricIndex aFabricIndex, bool & aChanged)
+{
+    TLV::TLVReader event;
+    TLV::TLVType tlvType;
+    TLV::TLVType tlvType1;
+    event.Init(aReader);
+    ReturnErrorOnFailure(event.EnterContainer(tlvType));
+    ReturnErrorOnFailure(event.Next(TLV::ContextTag(EventReportIB::Tag::kEventData)));
+    ReturnErrorOnFailure(event.EnterContainer(tlvType1));
+
+    CHIP_ERROR err;
+    while ((err = event.Next()) == CHIP_NO_ERROR)
+    {
+        if (event.GetTag() != TLV::ProfileTag(kEventManagementProfile, kFabricIndexTag))
+        {
+            continue;
+        }
+
+        uint8_t fabricIndex = kUndefinedFabricIndex;
+        ReturnErrorOnFailure(event.Get(fabricIndex));
+        if (fabricIndex == aFabricIndex)
+        {
+            // As in EventManagement::FabricRemovedCB, the fabric index is assumed to be minimally encoded in the byte just
+            // before the read point.
+            apSegment[event.GetReadPoint() - apSegment - 1] = kUndefinedFabricIndex;
+            aChanged                                        = true;
+        }
+        return CHIP_NO_ERROR;
+    }
+    return err == CHIP_END_OF_TLV ? CHIP_NO_ERROR : err;
+}
+
+} // namespace
+
+CHIP_ERROR PersistentEventLog::Init(PersistentStorageDelegate * apStorage)
+{
+    VerifyOrReturnError(apStorage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    mpStorage = apStorage;
+
+    CHIP_ERROR err = LoadIndex();
+    if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        ResetIndex();
+        return CHIP_NO_ERROR;
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(EventLogging, "Discarding the persistent event log, its index cannot be read: %" CHIP_ERROR_FORMAT,
+                     err.Format());
+        return Clear();
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PersistentEventLog::Append(EventNumber aEventNumber, const TLV::TLVReader & aEventReader)
+{
+    VerifyOrReturnError(mpStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    if (!IsEmpty() && aEventNumber <= GetLastEventNumber())
+    {
+        ChipLogError(EventLogging, "Event number 0x" ChipLogFormatX64 " is not newer than the persistent event log, clearing it",
+                     ChipLogValueX64(aEventNumber));
+        ReturnErrorOnFailure(Clear());
+    }
+
+    Platform::ScopedMemoryBuffer<uint8_t> segment;
+    VerifyOrReturnError(segment.Alloc(kSegmentSize), CHIP_ERROR_NO_MEMORY);
+
+    TLV::TLVReader reader;
+    TLV::TLVWriter writer;
+    CHIP_ERROR err = CHIP_ERROR_BUFFER_TOO_SMALL;
+    uint16_t start = 0;
+
+    if (!IsEmpty())
+    {
+        const size_t slot = SegmentAt(mSegmentsInUse - 1);
+        start             = mSegments[slot].mLength;
+        ReturnErrorOnFailure(LoadSegment(slot, segment.Get()));
+
+        reader.Init(aEventReader);
+        writer.Init(segment.Get() + start, kSegmentSize - start);
+        err = writer.CopyElement(reader);
+        if (err == CHIP_NO_ERROR)
+        {
+            err = writer.Finalize();
+        }
+    }
+
+    if (err == CHIP_ERROR_BUFFER_TOO_SMALL)
+    {
+        // The event does not fit in the last segment: start a new one, dropping the oldest segment if all are in use.
+        reader.Init(aEventReader);
+        writer.Init(segment.Get(), kSegmentSize);
+        ReturnErrorOnFailure(writer.CopyElement(reader));
+        ReturnErrorOnFailure(writer.Finalize());
+
+        if (mSegmentsInUse == kSegmentCount)
+        {
+            mFirstSegment = SegmentAt(1);
+            mSegmentsInUse--;
+        }
+        mSegments[SegmentAt(mSegmentsInUse)] = SegmentInfo{ aEventNumber, aEventNumber, 0 };
+        mSegmentsInUse++;
+        start = 0;
+
+        // Record the empty segment first, so that the index never describes the previous content of its storage entry.
+        ReturnErrorOnFailure(StoreIndex());
+    }
+    else
+    {
+        ReturnErrorOnFailure(err);
+    }
+
+    SegmentInfo & info    = mSegments[SegmentAt(mSegmentsInUse - 1)];
+    const uint16_t length = static_cast<uint16_t>(start + writer.GetLengthWritten());
+    ReturnErrorOnFailure(StoreSegment(SegmentAt(mSegmentsInUse - 1), segment.Get(), length));
+
+    info.mLastEventNumber = aEventNumber;
+    info.mLength          = length;
+    return StoreIndex();
+}
+
+CHIP_ERROR PersistentEventLog::Iterate(EventNumber aEventMin, TLV::Utilities::IterateHandler aHandler, void * apContext) const
+{
+    VerifyOrReturnError(!IsEmpty() && GetLastEventNumber() >= aEventMin, CHIP_NO_ERROR);
+
+    Platform::ScopedMemoryBuffer<uint8_t> segment;
+    VerifyOrReturnError(segment.Alloc(kSegmentSize), CHIP_ERROR_NO_MEMORY);
+
+    for (size_t i = 0; i < mSegmentsInUse; i++)
+    {
+        const size_t slot = SegmentAt(i);
+        if (mSegments[slot].mLastEventNumber < aEventMin)
+        {
+            continue;
+        }
+
+        ReturnErrorOnFailure(LoadSegment(slot, segment.Get()));
+
+        TLV::TLVReader reader;
+        reader.Init(segment.Get(), mSegments[slot].mLength);
+        CHIP_ERROR err = TLV::Utilities::Iterate(reader, aHandler, apContext, false /* recurse */);
+        VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV, err);
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PersistentEventLog::FabricRemoved(FabricIndex aFabricIndex)
+{
+    VerifyOrReturnError(!IsEmpty(), CHIP_NO_ERROR);
+
+    Platform::ScopedMemoryBuffer<uint8_t> segment;
+    VerifyOrReturnError(segment.Alloc(kSegmentSize), CHIP_ERROR_NO_MEMORY);
+
+    for (size_t i = 0; i < mSegmentsInUse; i++)
+    {
+        const size_t slot = SegmentAt(i);
+        ReturnErrorOnFailure(LoadSegment(slot, segment.Get()));
+
+        TLV::TLVReader reader;
+        bool changed = false;
+        CHIP_ERROR err;
+        reader.Init(segment.Get(), mSegments[slot].mLength);
+        while ((err = reader.Next()) == CHIP_NO_ERROR)
+        {
+            ReturnErrorOnFailure(ClearEventFabric(segment.Get(), reader, aFabricIndex, changed));
+        }
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+        if (changed)
+        {
+            ReturnErrorOnFailure(StoreSegment(slot, segment.Get(), mSegments[slot].mLength));
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PersistentEventLog::Clear()
+{
+    VerifyOrReturnError(mpStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    ResetIndex();
+    ReturnErrorOnFailure(StoreIndex());
+
+    // The index no longer refers to the segments, so failing to delete them only leaves unused entries in storage.
+    for (size_t slot = 0; slot < kSegmentCount; slot++)
+    {
+        mpStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::PersistentEventLogSegment(slot).KeyName());
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PersistentEventLog::LoadIndex()
+{
+    uint8_t buffer[kIndexBufferSize];
+    uint16_t size = sizeof(buffer);
+    ReturnErrorOnFailure(mpStorage->SyncGetKeyValue(DefaultStorageKeyAllocator::PersistentEventLogIndex().KeyName(), buffer, size));
+
+    TLV::TLVReader reader;
+    TLV::TLVType indexType;
+    TLV::TLVType segmentsType;
+    uint16_t firstSegment;
+    reader.Init(buffer, size);
+
+    ResetIndex();
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()));
+    ReturnErrorOnFailure(reader.EnterContainer(indexType));
+    ReturnErrorOnFailure(reader.Next(kFirstSegmentTag));
+    ReturnErrorOnFailure(reader.Get(firstSegment));
+    VerifyOrReturnError(firstSegment < kSegmentCount, CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    mFirstSegment = firstSegment;
+
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, kSegmentsTag));
+    ReturnErrorOnFailure(reader.EnterContainer(segmentsType));
+
+    CHIP_ERROR err;
+    size_t count = 0;
+    while ((err = reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag())) == CHIP_NO_ERROR)
+    {
+        VerifyOrExit(count < kSegmentCount, err = CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+
+        TLV::TLVType segmentType;
+        SegmentInfo & info = mSegments[SegmentAt(count)];
+        SuccessOrExit(err = reader.EnterContainer(segmentType));
+        SuccessOrExit(err = reader.Next(kFirstEventNumberTag));
+        SuccessOrExit(err = reader.Get(info.mFirstEventNumber));
+        SuccessOrExit(err = reader.Next(kLastEventNumberTag));
+        SuccessOrExit(err = reader.Get(info.mLastEventNumber));
+        SuccessOrExit(err = reader.Next(kLengthTag));
+        SuccessOrExit(err = reader.Get(info.mLength));
+        SuccessOrExit(err = reader.ExitContainer(segmentType));
+
+        // Segments hold increasing event numbers, each newer than all the events of the previous segments.
+        VerifyOrExit(info.mFirstEventNumber <= info.mLastEventNumber && info.mLength <= kSegmentSize,
+                     err = CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+        VerifyOrExit(count == 0 || info.mFirstEventNumber > mSegments[SegmentAt(count - 1)].mLastEventNumber,
+                     err = CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+        count++;
+    }
+    VerifyOrExit(err == CHIP_END_OF_TLV, /* return err */);
+    SuccessOrExit(err = reader.ExitContainer(segmentsType));
+    SuccessOrExit(err = reader.ExitContainer(indexType));
+    mSegmentsInUse = count;
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        ResetIndex();
+    }
+    return err;
+}
+
+CHIP_ERROR PersistentEventLog::StoreIndex() const
+{
+    uint8_t buffer[kIndexBufferSize];
+    TLV::TLVWriter writer;
+    TLV::TLVType indexType;
+    TLV::TLVType segmentsType;
+    writer.Init(buffer);
+
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, indexType));
+    ReturnErrorOnFailure(writer.Put(kFirstSegmentTag, static_cast<uint16_t>(mFirstSegment)));
+    ReturnErrorOnFailure(writer.StartContainer(kSegmentsTag, TLV::kTLVType_Array, segmentsType));
+    for (size_t i = 0; i < mSegmentsInUse; i++)
+    {
+        const SegmentInfo & info = mSegments[SegmentAt(i)];
+        TLV::TLVType segmentType;
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, segmentType));
+        ReturnErrorOnFailure(writer.Put(kFirstEventNumberTag, info.mFirstEventNumber));
+        ReturnErrorOnFailure(writer.Put(kLastEventNumberTag, info.mLastEventNumber));
+        ReturnErrorOnFailure(writer.Put(kLengthTag, info.mLength));
+        ReturnErrorOnFailure(writer.EndContainer(segmentType));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(segmentsType));
+    ReturnErrorOnFailure(writer.EndContainer(indexType));
+    ReturnErrorOnFailure(writer.Finalize());
+
+    return mpStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::PersistentEventLogIndex().KeyName(), buffer,
+                                      static_cast<uint16_t>(writer.GetLengthWritten()));
+}
+
+CHIP_ERROR PersistentEventLog::LoadSegment(size_t slot, uint8_t * apBuffer) const
+{
+    const uint16_t length = mSegments[slot].mLength;
+    uint16_t size         = length;
+    VerifyOrReturnError(length > 0, CHIP_NO_ERROR);
+
+    CHIP_ERROR err =
+        mpStorage->SyncGetKeyValue(DefaultStorageKeyAllocator::PersistentEventLogSegment(slot).KeyName(), apBuffer, size);
+    // The stored segment may be longer than the index says, if an append was interrupted before the index was updated.
+    VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_ERROR_BUFFER_TOO_SMALL, err);
+    VerifyOrReturnError(size == length, CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PersistentEventLog::StoreSegment(size_t slot, const uint8_t * apBuffer, uint16_t aLength) const
+{
+    return mpStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::PersistentEventLogSegment(slot).KeyName(), apBuffer, aLength);
+}
+
+void PersistentEventLog::ResetIndex()
+{
+    for (auto & info : mSegments)
+    {
+        info = SegmentInfo();
+    }
+    mFirstSegment  = 0;
+    mSegmentsInUse = 0;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,122 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVUtilities.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * PersistentEventLog keeps events, encoded as they are in the event buffers, in persistent storage.
+ *
+ * The events are appended to a ring of CHIP_CONFIG_PERSISTENT_EVENT_LOG_SEGMENT_COUNT storage entries (segments) of up to
+ * CHIP_CONFIG_PERSISTENT_EVENT_LOG_SEGMENT_SIZE bytes each.  When the last segment is full, the next event starts a new
+ * segment, and the oldest segment is dropped if all of them are in use.  A separate index entry records, for every segment,
+ * its length and the range of event numbers it holds, so that reading the events since a given event number skips the
+ * older segments without loading them.
+ *
+ * Events must be appended in increasing event number order.
+ */
+class PersistentEventLog
+{
+public:
+    static constexpr size_t kSegmentCount = CHIP_CONFIG_PERSISTENT_EVENT_LOG_SEGMENT_COUNT;
+    static constexpr size_t kSegmentSize  = CHIP_CONFIG_PERSISTENT_EVENT_LOG_SEGMENT_SIZE;
+
+    static_assert(kSegmentCount >= 1, "The persistent event log needs at least one segment");
+    static_assert(kSegmentSize <= UINT16_MAX, "Persistent event log segments are limited to 64KiB");
+
+    /**
+     * Initialize the log with the events already in the given storage, if any.
+     *
+     * An index that is missing or cannot be decoded starts an empty log.
+     */
+    CHIP_ERROR Init(PersistentStorageDelegate * apStorage);
+
+    void Shutdown() { mpStorage = nullptr; }
+
+    /**
+     * Append an event to the log.
+     *
+     * @param[in] aEventNumber  The number of the event, greater than that of any event in the log.  A smaller number means
+     *                          the event numbers were reset, and the older events are deleted first.
+     * @param[in] aEventReader  A reader positioned on the event element.
+     *
+     * @retval CHIP_ERROR_BUFFER_TOO_SMALL if the event is larger than a segment.
+     */
+    CHIP_ERROR Append(EventNumber aEventNumber, const TLV::TLVReader & aEventReader);
+
+    /**
+     * Call aHandler, as TLV::Utilities::Iterate does, on every event of the segments that hold events numbered aEventMin
+     * or later, oldest first.  Earlier events in those segments are passed to the handler too.
+     *
+     * Iteration stops at the first error returned by aHandler other than CHIP_END_OF_TLV, which is returned.
+     */
+    CHIP_ERROR Iterate(EventNumber aEventMin, TLV::Utilities::IterateHandler aHandler, void * apContext) const;
+
+    /**
+     * Mark the events of the given fabric as belonging to no fabric, as EventManagement::FabricRemoved does for the
+     * events in the event buffers.
+     */
+    CHIP_ERROR FabricRemoved(FabricIndex aFabricIndex);
+
+    /// Delete all the events of the log from storage.
+    CHIP_ERROR Clear();
+
+    bool IsEmpty() const { return mSegmentsInUse == 0; }
+
+    /// Returns the number of the oldest event in the log.  The log must not be empty.
+    EventNumber GetFirstEventNumber() const { return mSegments[mFirstSegment].mFirstEventNumber; }
+
+    /// Returns the number of the newest event in the log.  The log must not be empty.
+    EventNumber GetLastEventNumber() const { return mSegments[SegmentAt(mSegmentsInUse - 1)].mLastEventNumber; }
+
+private:
+    struct SegmentInfo
+    {
+        EventNumber mFirstEventNumber = 0;
+        EventNumber mLastEventNumber  = 0;
+        uint16_t mLength              = 0;
+    };
+
+    // Returns the storage slot of the index-th oldest segment in use.
+    size_t SegmentAt(size_t index) const { return (mFirstSegment + index) % kSegmentCount; }
+
+    CHIP_ERROR LoadIndex();
+    CHIP_ERROR StoreIndex() const;
+    CHIP_ERROR LoadSegment(size_t slot, uint8_t * apBuffer) const;
+    CHIP_ERROR StoreSegment(size_t slot, const uint8_t * apBuffer, uint16_t aLength) const;
+    void ResetIndex();
+
+    PersistentStorageDelegate * mpStorage = nullptr;
+    SegmentInfo mSegments[kSegmentCount];
+    size_t mFirstSegment  = 0;
+    size_t mSegmentsInUse = 0;
+};
+
+} // namespace app
+} // namespace chip
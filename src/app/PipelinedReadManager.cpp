@@ -0,0 +1,419 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/PipelinedReadManager.h>
+
+#include <app/ReadPrepareParams.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+
+#if CHIP_CONFIG_ENABLE_READ_CLIENT
+namespace chip {
+namespace app {
+
+bool PipelinedReadManager::PendingRead::IsAttributePathWanted(const ConcreteAttributePath & aPath) const
+{
+    for (size_t i = 0; i < mPaths.AllocatedSize(); i++)
+    {
+        if (mPaths[i].IsAttributePathSupersetOf(aPath))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+PipelinedReadManager::Batch::Batch(PipelinedReadManager & aManager, const SessionHolder & aSession, bool aIsFabricFiltered) :
+    mManager(aManager), mReadClient(aManager.mpImEngine, aManager.mpExchangeMgr, *this, ReadClient::InteractionType::Read),
+    mSession(aSession), mIsFabricFiltered(aIsFabricFiltered)
+{}
+
+PipelinedReadManager::Batch::~Batch()
+{
+    while (!mReads.Empty())
+    {
+        PendingRead * read = &*mReads.begin();
+        mReads.Remove(read);
+        Platform::Delete(read);
+    }
+}
+
+bool PipelinedReadManager::Batch::TryAdd(PendingRead * apRead)
+{
+    const size_t readPathCount = apRead->mPaths.AllocatedSize();
+
+    if (mReads.Empty())
+    {
+        mPaths.Calloc(std::max(readPathCount, mManager.mMaxPathsPerReadRequest));
+        VerifyOrReturnValue(mPaths.Get() != nullptr, false);
+    }
+
+    size_t newPathCount = 0;
+    for (size_t i = 0; i < readPathCount; i++)
+    {
+        bool isShared = false;
+        for (size_t j = 0; j < mPathCount; j++)
+        {
+            if (mPaths[j] == apRead->mPaths[i])
+            {
+                isShared = true;
+                break;
+            }
+            // Different paths reporting the same attributes would deliver them twice to the reads of either path.
+            VerifyOrReturnValue(!mPaths[j].Intersects(apRead->mPaths[i]), false);
+        }
+        if (!isShared)
+        {
+            newPathCount++;
+        }
+    }
+    VerifyOrReturnValue(mPathCount + newPathCount <= mPaths.AllocatedSize(), false);
+
+    for (size_t i = 0; i < readPathCount; i++)
+    {
+        bool isShared = false;
+        for (size_t j = 0; j < mPathCount && !isShared; j++)
+        {
+            isShared = (mPaths[j] == apRead->mPaths[i]);
+        }
+        if (!isShared)
+        {
+            mPaths[mPathCount++] = apRead->mPaths[i];
+        }
+    }
+    mReads.PushBack(apRead);
+    return true;
+}
+
+CHIP_ERROR PipelinedReadManager::Batch::SendRequest()
+{
+    ReadPrepareParams readPrepareParams;
+    readPrepareParams.mSessionHolder               = mSession;
+    readPrepareParams.mpAttributePathParamsList    = mPaths.Get();
+    readPrepareParams.mAttributePathParamsListSize = mPathCount;
+    readPrepareParams.mIsFabricFiltered            = mIsFabricFiltered;
+
+    return mReadClient.SendRequest(readPrepareParams);
+}
+
+void PipelinedReadManager::Batch::Fail(CHIP_ERROR aError)
+{
+    OnError(aError);
+    OnDone(&mReadClient);
+}
+
+bool PipelinedReadManager::Batch::IsOnSession(const SessionHolder & aSession) const
+{
+    return IsSameSession(mSession, aSession);
+}
+
+void PipelinedReadManager::Batch::Cancel(ReadClient::Callback & aCallback)
+{
+    for (auto & read : mReads)
+    {
+        if (read.mpCallback == &aCallback)
+        {
+            // The read stays in the batch, so that the batch can keep iterating it if a callback cancels another read.
+            read.mpCallback = nullptr;
+        }
+    }
+}
+
+void PipelinedReadManager::Batch::OnReportBegin()
+{
+    for (auto & read : mReads)
+    {
+        if (read.mpCallback != nullptr)
+        {
+            read.mpCallback->OnReportBegin();
+        }
+    }
+}
+
+void PipelinedReadManager::Batch::OnReportEnd()
+{
+    for (auto & read : mReads)
+    {
+        if (read.mpCallback != nullptr)
+        {
+            read.mpCallback->OnReportEnd();
+        }
+    }
+}
+
+void PipelinedReadManager::Batch::OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                                                  const StatusIB & aStatus)
+{
+    for (auto & read : mReads)
+    {
+        if (read.mpCallback == nullptr || !read.IsAttributePathWanted(aPath))
+        {
+            continue;
+        }
+
+        if (apData == nullptr)
+        {
+            read.mpCallback->OnAttributeData(aPath, nullptr, aStatus);
+            continue;
+        }
+
+        // Each read gets a reader of its own, positioned on the data.
+        TLV::TLVReader reader;
+        reader.Init(*apData);
+        read.mpCallback->OnAttributeData(aPath, &reader, aStatus);
+    }
+}
+
+void PipelinedReadManager::Batch::OnError(CHIP_ERROR aError)
+{
+    for (auto & read : mReads)
+    {
+        if (read.mpCallback != nullptr)
+        {
+            read.mpCallback->OnError(aError);
+        }
+    }
+}
+
+void PipelinedReadManager::Batch::OnDone(ReadClient * apReadClient)
+{
+    while (!mReads.Empty())
+    {
+        PendingRead * read = &*mReads.begin();
+        mReads.Remove(read);
+        ReadClient::Callback * callback = read->mpCallback;
+        Platform::Delete(read);
+        if (callback != nullptr)
+        {
+            callback->OnDone(apReadClient);
+        }
+    }
+
+    // Destroys this batch.
+    mManager.OnBatchDone(this);
+}
+
+PipelinedReadManager::PipelinedReadManager(InteractionModelEngine * apImEngine, Messaging::ExchangeManager * apExchangeMgr,
+                                           size_t aMaxReadsInFlightPerSession, size_t aMaxPathsPerReadRequest) :
+    mpImEngine(apImEngine),
+    mpExchangeMgr(apExchangeMgr), mMaxReadsInFlightPerSession(aMaxReadsInFlightPerSession),
+    mMaxPathsPerReadRequest(aMaxPathsPerReadRequest)
+{
+    VerifyOrDie(mMaxReadsInFlightPerSession > 0 && mMaxPathsPerReadRequest > 0);
+}
+
+PipelinedReadManager::~PipelinedReadManager()
+{
+    mpExchangeMgr->GetSessionManager()->SystemLayer()->CancelTimer(DispatchTimerCallback, this);
+
+    while (!mQueuedReads.Empty())
+    {
+        PendingRead * read = &*mQueuedReads.begin();
+        mQueuedReads.Remove(read);
+        Platform::Delete(read);
+    }
+
+    // Destroying the ReadClients aborts their exchanges, without calling OnDone.
+    while (!mBatches.Empty())
+    {
+        Batch * batch = &*mBatches.begin();
+        mBatches.Remove(batch);
+        Platform::Delete(batch);
+    }
+}
+
+CHIP_ERROR PipelinedReadManager::Read(const SessionHandle & aSession, const AttributePathParams * apPaths, size_t aPathCount,
+                                      ReadClient::Callback & aCallback, bool aIsFabricFiltered)
+{
+    VerifyOrReturnError(apPaths != nullptr && aPathCount > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    for (size_t i = 0; i < aPathCount; i++)
+    {
+        VerifyOrReturnError(apPaths[i].IsValidAttributePath(), CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    PendingRead * read = Platform::New<PendingRead>();
+    VerifyOrReturnError(read != nullptr, CHIP_ERROR_NO_MEMORY);
+    read->mPaths.Calloc(aPathCount);
+    if (read->mPaths.Get() == nullptr)
+    {
+        Platform::Delete(read);
+        return CHIP_ERROR_NO_MEMORY;
+    }
+    std::copy(apPaths, apPaths + aPathCount, read->mPaths.Get());
+    read->mSession.Grab(aSession);
+    read->mpCallback        = &aCallback;
+    read->mIsFabricFiltered = aIsFabricFiltered;
+
+    mQueuedReads.PushBack(read);
+    ScheduleDispatch();
+    return CHIP_NO_ERROR;
+}
+
+void PipelinedReadManager::Cancel(ReadClient::Callback & aCallback)
+{
+    for (auto it = mQueuedReads.begin(); it != mQueuedReads.end();)
+    {
+        PendingRead * read = &*it;
+        ++it;
+        if (read->mpCallback == &aCallback)
+        {
+            mQueuedReads.Remove(read);
+            Platform::Delete(read);
+        }
+    }
+
+    for (auto & batch : mBatches)
+    {
+        batch.Cancel(aCallback);
+    }
+}
+
+size_t PipelinedReadManager::GetNumQueuedReads()
+{
+    size_t count = 0;
+    for (auto it = mQueuedReads.begin(); it != mQueuedReads.end(); ++it)
+    {
+        count++;
+    }
+    return count;
+}
+
+size_t PipelinedReadManager::GetNumReadRequestsInFlight()
+{
+    size_t count = 0;
+    for (auto it = mBatches.begin(); it != mBatches.end(); ++it)
+    {
+        count++;
+    }
+    return count;
+}
+
+bool PipelinedReadManager::IsSameSession(const SessionHolder & aSession, const SessionHolder & aOther)
+{
+    // Reads whose session is gone are never packed together; each of them fails on its own.
+    VerifyOrReturnValue(aSession && aOther, false);
+    return aSession.Contains(aOther.Get().Value());
+}
+
+void PipelinedReadManager::ScheduleDispatch()
+{
+    // Dispatching from the event loop packs the reads queued by the current callers together.
+    CHIP_ERROR err =
+        mpExchangeMgr->GetSessionManager()->SystemLayer()->StartTimer(System::Clock::kZero, DispatchTimerCallback, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to schedule pipelined reads: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+void PipelinedReadManager::DispatchTimerCallback(System::Layer * apSystemLayer, void * apAppState)
+{
+    static_cast<PipelinedReadManager *>(apAppState)->Dispatch();
+}
+
+void PipelinedReadManager::Dispatch()
+{
+    auto it = mQueuedReads.begin();
+    while (it != mQueuedReads.end())
+    {
+        PendingRead * first = &*it;
+        ++it;
+        if (first->mSession && CountBatchesOnSession(first->mSession) >= mMaxReadsInFlightPerSession)
+        {
+            continue;
+        }
+
+        Batch * batch = Platform::New<Batch>(*this, first->mSession, first->mIsFabricFiltered);
+        if (batch == nullptr)
+        {
+            ChipLogError(DataManagement, "No memory for pipelined read, retrying once a read completes");
+            return;
+        }
+        mBatches.PushBack(batch);
+
+        mQueuedReads.Remove(first);
+        if (!batch->TryAdd(first))
+        {
+            // Only a path buffer allocation failure keeps a read from joining an empty batch.
+            mQueuedReads.InsertBefore(it, first);
+            mBatches.Remove(batch);
+            Platform::Delete(batch);
+            ChipLogError(DataManagement, "No memory for pipelined read, retrying once a read completes");
+            return;
+        }
+
+        while (it != mQueuedReads.end())
+        {
+            PendingRead * read = &*it;
+            ++it;
+            if (!IsSameSession(read->mSession, first->mSession) || read->mIsFabricFiltered != first->mIsFabricFiltered)
+            {
+                continue;
+            }
+            mQueuedReads.Remove(read);
+            if (!batch->TryAdd(read))
+            {
+                mQueuedReads.InsertBefore(it, read);
+            }
+        }
+
+        CHIP_ERROR err = batch->SendRequest();
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DataManagement, "Failed to send pipelined read: %" CHIP_ERROR_FORMAT, err.Format());
+            // The callbacks may queue or cancel reads: start over on the updated queue.
+            batch->Fail(err);
+            ScheduleDispatch();
+            return;
+        }
+
+        // Reads that did not fit may still go out in another ReadRequest of the same session.
+        it = mQueuedReads.begin();
+    }
+}
+
+size_t PipelinedReadManager::CountBatchesOnSession(const SessionHolder & aSession)
+{
+    size_t count = 0;
+    for (auto & batch : mBatches)
+    {
+        if (batch.IsOnSession(aSession))
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+void PipelinedReadManager::OnBatchDone(Batch * apBatch)
+{
+    mBatches.Remove(apBatch);
+    Platform::Delete(apBatch);
+
+    if (!mQueuedReads.Empty())
+    {
+        ScheduleDispatch();
+    }
+}
+
+} // namespace app
+} // namespace chip
+#endif // CHIP_CONFIG_ENABLE_READ_CLIENT
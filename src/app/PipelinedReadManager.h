@@ -0,0 +1,155 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AppConfig.h>
+#include <app/AttributePathParams.h>
+#include <app/InteractionModelEngine.h>
+#include <app/ReadClient.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/support/IntrusiveList.h>
+#include <lib/support/ScopedBuffer.h>
+#include <messaging/ExchangeMgr.h>
+#include <system/SystemLayer.h>
+#include <transport/Session.h>
+
+#if CHIP_CONFIG_ENABLE_READ_CLIENT
+namespace chip {
+namespace app {
+
+/**
+ * PipelinedReadManager issues attribute reads for many callers, keeping several read interactions in flight on each session
+ * and packing the reads queued behind them into shared ReadRequests.
+ *
+ * Reads are queued by Read() and sent from the event loop, so that the reads issued together can share a ReadRequest.  A
+ * queued read joins a ReadRequest of the same session and fabric filtering when:
+ *
+ * - its paths, added to those of the ReadRequest, stay within the path limit of the manager, and
+ * - none of its paths intersects a different path of the ReadRequest, so that no attribute is reported twice.  Identical
+ *   paths are only sent once.
+ *
+ * Each read only receives the attributes of its own paths, together with the OnReportBegin, OnReportEnd, OnError and OnDone
+ * calls of the ReadRequest it was sent in, as if it had its own ReadClient.  The ReadClient passed to OnDone belongs to the
+ * manager and must not be destroyed by the callback.
+ *
+ * Only attribute reads without data version filters are pipelined; events and subscriptions keep using ReadClient directly.
+ */
+class PipelinedReadManager
+{
+public:
+    /**
+     * @param[in] aMaxReadsInFlightPerSession The number of ReadRequests kept in flight on a single session.
+     * @param[in] aMaxPathsPerReadRequest     The number of paths packed into a ReadRequest.  Publishers support at least
+     *                                        InteractionModelEngine::kMinSupportedPathsPerReadRequest of them.
+     */
+    PipelinedReadManager(InteractionModelEngine * apImEngine, Messaging::ExchangeManager * apExchangeMgr,
+                         size_t aMaxReadsInFlightPerSession = CHIP_IM_MAX_PIPELINED_READS_PER_SESSION,
+                         size_t aMaxPathsPerReadRequest     = InteractionModelEngine::kMinSupportedPathsPerReadRequest);
+
+    /**
+     * Abort all the reads, without calling their callbacks.
+     */
+    ~PipelinedReadManager();
+
+    /**
+     * Queue a read of the given attribute paths.  The paths are copied.
+     *
+     * A read with more paths than the path limit of the manager is sent in a ReadRequest of its own.
+     *
+     * @param[in] aCallback The callback of the read, which has to outlive it, until OnDone or Cancel.
+     *
+     * @retval #CHIP_ERROR_INVALID_ARGUMENT if there are no paths, or one of them is not a valid attribute path.
+     * @retval #CHIP_ERROR_NO_MEMORY if the read cannot be queued.
+     */
+    CHIP_ERROR Read(const SessionHandle & aSession, const AttributePathParams * apPaths, size_t aPathCount,
+                    ReadClient::Callback & aCallback, bool aIsFabricFiltered = true);
+
+    /**
+     * Stop calling the given callback for its reads.  Reads that were not sent yet are dropped; the others complete without
+     * the callback.
+     */
+    void Cancel(ReadClient::Callback & aCallback);
+
+    size_t GetNumQueuedReads();
+    size_t GetNumReadRequestsInFlight();
+
+private:
+    struct PendingRead : public IntrusiveListNodeBase<>
+    {
+        // Whether this read wants the attribute at the given path.
+        bool IsAttributePathWanted(const ConcreteAttributePath & aPath) const;
+
+        SessionHolder mSession;
+        Platform::ScopedMemoryBufferWithSize<AttributePathParams> mPaths;
+        ReadClient::Callback * mpCallback = nullptr;
+        bool mIsFabricFiltered            = true;
+    };
+
+    // A ReadRequest in flight, shared by the reads packed into it.
+    class Batch : public ReadClient::Callback, public IntrusiveListNodeBase<>
+    {
+    public:
+        Batch(PipelinedReadManager & aManager, const SessionHolder & aSession, bool aIsFabricFiltered);
+        ~Batch() override;
+
+        // Add the read if it fits in the ReadRequest, taking ownership of it.
+        bool TryAdd(PendingRead * apRead);
+        CHIP_ERROR SendRequest();
+        void Fail(CHIP_ERROR aError);
+
+        bool IsOnSession(const SessionHolder & aSession) const;
+        void Cancel(ReadClient::Callback & aCallback);
+
+    private:
+        void OnReportBegin() override;
+        void OnReportEnd() override;
+        void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override;
+        void OnError(CHIP_ERROR aError) override;
+        void OnDone(ReadClient * apReadClient) override;
+
+        PipelinedReadManager & mManager;
+        ReadClient mReadClient;
+        SessionHolder mSession;
+        IntrusiveList<PendingRead> mReads;
+        Platform::ScopedMemoryBufferWithSize<AttributePathParams> mPaths;
+        size_t mPathCount = 0;
+        bool mIsFabricFiltered;
+    };
+
+    static bool IsSameSession(const SessionHolder & aSession, const SessionHolder & aOther);
+
+    void ScheduleDispatch();
+    static void DispatchTimerCallback(System::Layer * apSystemLayer, void * apAppState);
+
+    // Send the queued reads that fit in the reads in flight allowed on their sessions.
+    void Dispatch();
+    size_t CountBatchesOnSession(const SessionHolder & aSession);
+    void OnBatchDone(Batch * apBatch);
+
+    InteractionModelEngine * mpImEngine;
+    Messaging::ExchangeManager * mpExchangeMgr;
+    size_t mMaxReadsInFlightPerSession;
+    size_t mMaxPathsPerReadRequest;
+    IntrusiveList<PendingRead> mQueuedReads;
+    IntrusiveList<Batch> mBatches;
+};
+
+} // namespace app
+} // namespace chip
+#endif // CHIP_CONFIG_ENABLE_READ_CLIENT
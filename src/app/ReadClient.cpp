@@ -26,6 +26,7 @@
 #include <app/InteractionModelEngine.h>
 #include <app/InteractionModelHelper.h>
 #include <app/ReadClient.h>
+#include <app/ResubscriptionCoordinator.h>
 #include <app/StatusResponse.h>
 #include <assert.h>
 #include <lib/core/TLVTypes.h>
@@ -80,6 +81,7 @@ void ReadClient::StopResubscription()
 {
     CancelLivenessCheckTimer();
     CancelResubscribeTimer();
+    ReleaseResubscriptionSlot();
 
     // Only deallocate the paths if they are not already deallocated.
     if (mReadPrepareParams.mpAttributePathParamsList != nullptr || mReadPrepareParams.mpEventPathParamsList != nullptr ||
@@ -168,6 +170,12 @@ CHIP_ERROR ReadClient::ScheduleResubscription(uint32_t aTimeTillNextResubscripti
         mReadPrepareParams.mSessionHolder->AsSecureSession()->MarkAsDefunct();
     }
 
+    ResubscriptionCoordinator * coordinator = GetResubscriptionCoordinator();
+    if (coordinator != nullptr)
+    {
+        aTimeTillNextResubscriptionMs = coordinator->AddJitter(aTimeTillNextResubscriptionMs);
+    }
+
     ReturnErrorOnFailure(
         InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->StartTimer(
             System::Clock::Milliseconds32(aTimeTillNextResubscriptionMs), OnResubscribeTimerCallback, this));
@@ -192,6 +200,8 @@ void ReadClient::Close(CHIP_ERROR aError, bool allowResubscription)
             MATTER_LOG_METRIC_END(Tracing::kMetricDeviceSubscriptionSetup, aError);
         }
 
+        // Whether or not it is rescheduled, this attempt is over: let the next resubscription waiting for a slot go.
+        ReleaseResubscriptionSlot();
         ClearActiveSubscriptionState();
         if (aError != CHIP_NO_ERROR)
         {
@@ -294,7 +304,7 @@ CHIP_ERROR ReadClient::SendReadRequest(ReadPrepareParams & aReadPrepareParams)
     ReadRequestMessage::Builder request;
     System::PacketBufferTLVWriter writer;
 
-    InitWriterWithSpaceReserved(writer, kReservedSizeForTLVEncodingOverhead);
+    ReturnErrorOnFailure(InitRequestWriter(writer, aReadPrepareParams));
     ReturnErrorOnFailure(request.Init(&writer));
 
     if (!attributePaths.empty())
@@ -371,6 +381,21 @@ CHIP_ERROR ReadClient::SendReadRequest(ReadPrepareParams & aReadPrepareParams)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR ReadClient::InitRequestWriter(System::PacketBufferTLVWriter & aWriter, const ReadPrepareParams & aReadPrepareParams)
+{
+    size_t maxRequestSize = kMaxSecureSduLengthBytes;
+
+    // Reports larger than the MTU can only be received over a session that carries them.
+    if (aReadPrepareParams.mAllowLargePayload)
+    {
+        VerifyOrReturnError(aReadPrepareParams.mSessionHolder, CHIP_ERROR_MISSING_SECURE_SESSION);
+        VerifyOrReturnError(aReadPrepareParams.mSessionHolder->AllowsLargePayload(), CHIP_ERROR_INCORRECT_STATE);
+        maxRequestSize = kMaxLargeSecureSduLengthBytes;
+    }
+
+    return InitWriterWithSpaceReserved(aWriter, kReservedSizeForTLVEncodingOverhead, maxRequestSize);
+}
+
 CHIP_ERROR ReadClient::GenerateEventPaths(EventPathIBs::Builder & aEventPathsBuilder, const Span<EventPathParams> & aEventPaths)
 {
     for (auto & event : aEventPaths)
@@ -1010,6 +1035,20 @@ void ReadClient::CancelResubscribeTimer()
     mIsResubscriptionScheduled = false;
 }
 
+ResubscriptionCoordinator * ReadClient::GetResubscriptionCoordinator() const
+{
+    return mpImEngine != nullptr ? mpImEngine->GetResubscriptionCoordinator() : nullptr;
+}
+
+void ReadClient::ReleaseResubscriptionSlot()
+{
+    ResubscriptionCoordinator * coordinator = GetResubscriptionCoordinator();
+    if (coordinator != nullptr)
+    {
+        coordinator->Release(*this);
+    }
+}
+
 void ReadClient::OnLivenessTimeoutCallback(System::Layer * apSystemLayer, void * apAppState)
 {
     ReadClient * const _this = reinterpret_cast<ReadClient *>(apAppState);
@@ -1093,6 +1132,7 @@ CHIP_ERROR ReadClient::ProcessSubscribeResponse(System::PacketBufferHandle && aP
     ReturnErrorOnFailure(subscribeResponse.ExitContainer());
 
     MoveToState(ClientState::SubscriptionActive);
+    ReleaseResubscriptionSlot();
 
     mpCallback.OnSubscriptionEstablished(subscriptionId);
 
@@ -1173,7 +1213,7 @@ CHIP_ERROR ReadClient::SendSubscribeRequestImpl(const ReadPrepareParams & aReadP
     System::PacketBufferHandle msgBuf;
     System::PacketBufferTLVWriter writer;
     SubscribeRequestMessage::Builder request;
-    InitWriterWithSpaceReserved(writer, kReservedSizeForTLVEncodingOverhead);
+    ReturnErrorOnFailure(InitRequestWriter(writer, aReadPrepareParams));
 
     ReturnErrorOnFailure(request.Init(&writer));
 
@@ -1333,6 +1373,15 @@ void ReadClient::OnResubscribeTimerCallback(System::Layer * /* If this starts be
 
     _this->mIsResubscriptionScheduled = false;
 
+    ResubscriptionCoordinator * coordinator = _this->GetResubscriptionCoordinator();
+    if (coordinator != nullptr && !coordinator->Acquire(*_this))
+    {
+        // Still scheduled, from the point of view of TriggerResubscribeIfScheduled: the coordinator fires this callback again
+        // once a slot is free.
+        _this->mIsResubscriptionScheduled = true;
+        return;
+    }
+
     CHIP_ERROR err;
 
     ChipLogProgress(DataManagement, "OnResubscribeTimerCallback: ForceCASE = %d", _this->mForceCaseOnNextResub);
@@ -1441,7 +1490,14 @@ CHIP_ERROR ReadClient::EstablishSessionToPeer()
     ChipLogProgress(DataManagement, "Trying to establish a CASE session for subscription");
     auto * caseSessionManager = InteractionModelEngine::GetInstance()->GetCASESessionManager();
     VerifyOrReturnError(caseSessionManager != nullptr, CHIP_ERROR_INCORRECT_STATE);
-    caseSessionManager->FindOrEstablishSession(mPeer, &mOnConnectedCallback, &mOnConnectionFailureCallback);
+    const TransportPayloadCapability payloadCapability =
+        mReadPrepareParams.mAllowLargePayload ? TransportPayloadCapability::kLargePayload : TransportPayloadCapability::kMRPPayload;
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+    caseSessionManager->FindOrEstablishSession(mPeer, &mOnConnectedCallback, &mOnConnectionFailureCallback, 1 /* attemptCount */,
+                                               nullptr /* onRetry */, payloadCapability);
+#else
+    caseSessionManager->FindOrEstablishSession(mPeer, &mOnConnectedCallback, &mOnConnectionFailureCallback, payloadCapability);
+#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
     return CHIP_NO_ERROR;
 }
 
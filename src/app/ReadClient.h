@@ -55,6 +55,7 @@ namespace chip {
 namespace app {
 
 class InteractionModelEngine;
+class ResubscriptionCoordinator;
 
 /**
  *  @class ReadClient
@@ -506,6 +507,7 @@ public:
 private:
     friend class TestReadInteraction;
     friend class InteractionModelEngine;
+    friend class ResubscriptionCoordinator;
 
     enum class ClientState : uint8_t
     {
@@ -596,6 +598,10 @@ private:
     CHIP_ERROR SendSubscribeRequestImpl(const ReadPrepareParams & aSubscribePrepareParams);
     void UpdateDataVersionFilters(const ConcreteDataAttributePath & aPath);
     static void OnResubscribeTimerCallback(System::Layer * apSystemLayer, void * apAppState);
+
+    // The coordinator of the resubscriptions set on the engine, if any.
+    ResubscriptionCoordinator * GetResubscriptionCoordinator() const;
+    void ReleaseResubscriptionSlot();
     // Called to ensure OnReportBegin is called before calling OnEventData or OnAttributeData
     void NoteReportingData();
 
@@ -619,6 +625,12 @@ private:
 
     CHIP_ERROR GetMinEventNumber(const ReadPrepareParams & aReadPrepareParams, Optional<EventNumber> & aEventMin);
 
+    /**
+     * Initialize the writer of a read or subscribe request with a buffer sized for the session: large payload
+     * sessions, requested with ReadPrepareParams::mAllowLargePayload, carry requests beyond the MTU.
+     */
+    CHIP_ERROR InitRequestWriter(System::PacketBufferTLVWriter & aWriter, const ReadPrepareParams & aReadPrepareParams);
+
     /**
      * Start setting up a CASE session to our peer, if we can locate a
      * CASESessionManager.  Returns error if we did not even manage to kick off
@@ -645,6 +657,11 @@ private:
     bool mForceCaseOnNextResub      = true;
     bool mIsResubscriptionScheduled = false;
 
+    // State of this client in the ResubscriptionCoordinator, if any.
+    bool mHoldsResubscriptionSlot            = false;
+    bool mWaitingForResubscriptionSlot       = false;
+    ReadClient * mpNextWaitingResubscription = nullptr;
+
     // mMinimalResubscribeDelay is used to store the delay returned with a BUSY
     // response to a Sigma1 message.
     System::Clock::Milliseconds16 mMinimalResubscribeDelay = System::Clock::kZero;
@@ -91,18 +91,18 @@ ReadHandler::ReadHandler(ManagementCallback & apCallback, Observer * observer, D
 }
 
 void ReadHandler::OnSubscriptionResumed(const SessionHandle & sessionHandle,
-                                        SubscriptionResumptionSessionEstablisher & resumptionSessionEstablisher)
+                                        SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo)
 {
-    mSubscriptionId          = resumptionSessionEstablisher.mSubscriptionInfo.mSubscriptionId;
-    mMinIntervalFloorSeconds = resumptionSessionEstablisher.mSubscriptionInfo.mMinInterval;
-    mMaxInterval             = resumptionSessionEstablisher.mSubscriptionInfo.mMaxInterval;
-    SetStateFlag(ReadHandlerFlags::FabricFiltered, resumptionSessionEstablisher.mSubscriptionInfo.mFabricFiltered);
+    mSubscriptionId          = subscriptionInfo.mSubscriptionId;
+    mMinIntervalFloorSeconds = subscriptionInfo.mMinInterval;
+    mMaxInterval             = subscriptionInfo.mMaxInterval;
+    SetStateFlag(ReadHandlerFlags::FabricFiltered, subscriptionInfo.mFabricFiltered);
 
     // Move dynamically allocated attributes and events from the SubscriptionInfo struct into
     // the object pool managed by the IM engine
-    for (size_t i = 0; i < resumptionSessionEstablisher.mSubscriptionInfo.mAttributePaths.AllocatedSize(); i++)
+    for (size_t i = 0; i < subscriptionInfo.mAttributePaths.AllocatedSize(); i++)
     {
-        AttributePathParams params = resumptionSessionEstablisher.mSubscriptionInfo.mAttributePaths[i].GetParams();
+        AttributePathParams params = subscriptionInfo.mAttributePaths[i].GetParams();
         CHIP_ERROR err = mManagementCallback.GetInteractionModelEngine()->PushFrontAttributePathList(mpAttributePathList, params);
         if (err != CHIP_NO_ERROR)
         {
@@ -110,9 +110,9 @@ void ReadHandler::OnSubscriptionResumed(const SessionHandle & sessionHandle,
             return;
         }
     }
-    for (size_t i = 0; i < resumptionSessionEstablisher.mSubscriptionInfo.mEventPaths.AllocatedSize(); i++)
+    for (size_t i = 0; i < subscriptionInfo.mEventPaths.AllocatedSize(); i++)
     {
-        EventPathParams params = resumptionSessionEstablisher.mSubscriptionInfo.mEventPaths[i].GetParams();
+        EventPathParams params = subscriptionInfo.mEventPaths[i].GetParams();
         CHIP_ERROR err = mManagementCallback.GetInteractionModelEngine()->PushFrontEventPathParamsList(mpEventPathList, params);
         if (err != CHIP_NO_ERROR)
         {
@@ -120,6 +120,7 @@ void ReadHandler::OnSubscriptionResumed(const SessionHandle & sessionHandle,
             return;
         }
     }
+    UpdateUrgentEventClusterFilter();
 
     mSessionHandle.Grab(sessionHandle);
 
@@ -232,7 +233,8 @@ CHIP_ERROR ReadHandler::OnStatusResponse(Messaging::ExchangeContext * apExchange
     CHIP_ERROR err         = CHIP_NO_ERROR;
     aSendStatusResponse    = true;
     CHIP_ERROR statusError = CHIP_NO_ERROR;
-    SuccessOrExit(err = StatusResponse::ProcessStatusResponse(std::move(aPayload), statusError));
+    // Keep hold of the StatusResponse: its buffer is reused for the SubscribeResponse or for a StatusResponse in reply.
+    SuccessOrExit(err = StatusResponse::ProcessStatusResponse(aPayload.Retain(), statusError));
     // Since this is a valid Status Response message, we don't have to send a Status Response in reply to it.
     aSendStatusResponse = false;
     SuccessOrExit(err = statusError);
@@ -247,7 +249,7 @@ CHIP_ERROR ReadHandler::OnStatusResponse(Messaging::ExchangeContext * apExchange
         {
             if (IsPriming())
             {
-                err = SendSubscribeResponse();
+                err = SendSubscribeResponse(std::move(aPayload));
 
                 SetStateFlag(ReadHandlerFlags::ActiveSubscription);
 
@@ -309,6 +311,8 @@ CHIP_ERROR ReadHandler::SendStatusReport(Protocols::InteractionModel::Status aSt
 
 CHIP_ERROR ReadHandler::SendReportData(System::PacketBufferHandle && aPayload, bool aMoreChunks)
 {
+    // Whatever the data model needed to encode this chunk is done with once it is in aPayload.
+    mArena.Reset();
     VerifyOrReturnLogError(mState == HandlerState::CanStartReporting, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrDie(!IsAwaitingReportResponse()); // Should not be reportable!
     if (IsPriming() || IsChunkedReport())
@@ -390,7 +394,7 @@ CHIP_ERROR ReadHandler::OnMessageReceived(Messaging::ExchangeContext * apExchang
 
     if (sendStatusResponse)
     {
-        StatusResponse::Send(Status::InvalidAction, apExchangeContext, false /*aExpectResponse*/);
+        StatusResponse::Send(Status::InvalidAction, apExchangeContext, false /*aExpectResponse*/, std::move(aPayload));
     }
 
     if (err != CHIP_NO_ERROR)
@@ -503,13 +507,16 @@ CHIP_ERROR ReadHandler::ProcessAttributePaths(AttributePathIBs::Parser & aAttrib
         AttributePathIB::Parser path;
         ReturnErrorOnFailure(path.Init(reader));
         ReturnErrorOnFailure(path.ParsePath(attribute));
+        // Overlapping paths are merged as they are added, so that they do not exhaust the pool.
         ReturnErrorOnFailure(
-            mManagementCallback.GetInteractionModelEngine()->PushFrontAttributePathList(mpAttributePathList, attribute));
+            mManagementCallback.GetInteractionModelEngine()->MergeIntoAttributePathList(mpAttributePathList, attribute));
     }
     // if we have exhausted this container
     if (CHIP_END_OF_TLV == err)
     {
-        mManagementCallback.GetInteractionModelEngine()->RemoveDuplicateConcreteAttributePath(mpAttributePathList);
+#if CHIP_IM_SERVER_MAX_CACHED_ATTRIBUTE_PATHS_PER_READ_HANDLER > 0
+        mAttributePathExpansionCache.Invalidate();
+#endif // CHIP_IM_SERVER_MAX_CACHED_ATTRIBUTE_PATHS_PER_READ_HANDLER > 0
         mAttributePathExpandIterator.ResetTo(mpAttributePathList);
         err = CHIP_NO_ERROR;
     }
@@ -559,8 +566,9 @@ CHIP_ERROR ReadHandler::ProcessEventPaths(EventPathIBs::Parser & aEventPathsPars
         EventPathIB::Parser path;
         ReturnErrorOnFailure(path.Init(reader));
         ReturnErrorOnFailure(path.ParsePath(event));
-        ReturnErrorOnFailure(mManagementCallback.GetInteractionModelEngine()->PushFrontEventPathParamsList(mpEventPathList, event));
+        ReturnErrorOnFailure(mManagementCallback.GetInteractionModelEngine()->MergeIntoEventPathList(mpEventPathList, event));
     }
+    UpdateUrgentEventClusterFilter();
 
     // if we have exhausted this container
     if (CHIP_END_OF_TLV == err)
@@ -570,6 +578,24 @@ CHIP_ERROR ReadHandler::ProcessEventPaths(EventPathIBs::Parser & aEventPathsPars
     return err;
 }
 
+void ReadHandler::UpdateUrgentEventClusterFilter()
+{
+    mUrgentEventClusterFilter = 0;
+    for (auto * path = mpEventPathList; path != nullptr; path = path->mpNext)
+    {
+        if (!path->mValue.mIsUrgentEvent)
+        {
+            continue;
+        }
+        if (path->mValue.HasWildcardClusterId())
+        {
+            mUrgentEventClusterFilter = UINT32_MAX;
+            return;
+        }
+        mUrgentEventClusterFilter |= UrgentEventClusterFilterBit(path->mValue.mClusterId);
+    }
+}
+
 CHIP_ERROR ReadHandler::ProcessEventFilters(EventFilterIBs::Parser & aEventFiltersParser)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -665,9 +691,10 @@ bool ReadHandler::CheckEventClean(EventManagement & aEventManager)
     return true;
 }
 
-CHIP_ERROR ReadHandler::SendSubscribeResponse()
+CHIP_ERROR ReadHandler::SendSubscribeResponse(System::PacketBufferHandle && aReusableBuffer)
 {
-    System::PacketBufferHandle packet = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
+    System::PacketBufferHandle packet =
+        System::PacketBufferHandle::NewReusing(std::move(aReusableBuffer), chip::app::kMaxSecureSduLengthBytes);
     VerifyOrReturnLogError(!packet.IsNull(), CHIP_ERROR_NO_MEMORY);
 
     System::PacketBufferTLVWriter writer;
@@ -853,10 +880,42 @@ void ReadHandler::PersistSubscription()
 
 void ReadHandler::ResetPathIterator()
 {
+#if CHIP_IM_SERVER_MAX_CACHED_ATTRIBUTE_PATHS_PER_READ_HANDLER > 0
+    mAttributePathExpandIterator.ResetTo(mpAttributePathList, GetAttributePathExpansionCache());
+#else
     mAttributePathExpandIterator.ResetTo(mpAttributePathList);
+#endif // CHIP_IM_SERVER_MAX_CACHED_ATTRIBUTE_PATHS_PER_READ_HANDLER > 0
     mAttributeEncoderState.Reset();
 }
 
+#if CHIP_IM_SERVER_MAX_CACHED_ATTRIBUTE_PATHS_PER_READ_HANDLER > 0
+const AttributePathExpansionCache * ReadHandler::GetAttributePathExpansionCache()
+{
+    if (!mAttributePathExpansionCache.IsBuiltFor(mpAttributePathList))
+    {
+        // The iterator may still point into the previous expansion.
+        mAttributePathExpandIterator.DetachCache();
+
+        CHIP_ERROR err =
+            mAttributePathExpansionCache.Build(mManagementCallback.GetInteractionModelEngine()->GetDataModelProvider(),
+                                               mpAttributePathList, CHIP_IM_SERVER_MAX_CACHED_ATTRIBUTE_PATHS_PER_READ_HANDLER);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogDetail(DataManagement, "Attribute paths are not cached, expanding them for every report: %" CHIP_ERROR_FORMAT,
+                          err.Format());
+        }
+    }
+
+    return mAttributePathExpansionCache.IsComplete() ? &mAttributePathExpansionCache : nullptr;
+}
+
+void ReadHandler::DataModelStructureChanged()
+{
+    mAttributePathExpandIterator.DetachCache();
+    mAttributePathExpansionCache.Invalidate();
+}
+#endif // CHIP_IM_SERVER_MAX_CACHED_ATTRIBUTE_PATHS_PER_READ_HANDLER > 0
+
 void ReadHandler::AttributePathIsDirty(const AttributePathParams & aAttributeChanged)
 {
     ConcreteAttributePath path;
@@ -26,9 +26,11 @@
 
 #include <access/AccessControl.h>
 #include <app/AttributePathExpandIterator.h>
+#include <app/AttributePathExpansionCache.h>
 #include <app/AttributePathParams.h>
 #include <app/AttributeValueEncoder.h>
 #include <app/CASESessionManager.h>
+#include <app/InteractionArena.h>
 #include <app/DataVersionFilter.h>
 #include <app/EventManagement.h>
 #include <app/EventPathParams.h>
@@ -286,7 +288,8 @@ public:
      *
      *  Used after the SubscriptionResumptionSessionEstablisher establishs the CASE session
      */
-    void OnSubscriptionResumed(const SessionHandle & sessionHandle, SubscriptionResumptionSessionEstablisher & sessionEstablisher);
+    void OnSubscriptionResumed(const SessionHandle & sessionHandle,
+                               SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo);
 #endif
 
 private:
@@ -390,6 +393,16 @@ private:
     // Resets the path iterator to the beginning of the whole report for generating a series of new reports.
     void ResetPathIterator();
 
+#if CHIP_IM_SERVER_MAX_CACHED_ATTRIBUTE_PATHS_PER_READ_HANDLER > 0
+    // Returns the expansion cache for the attribute paths of this handler, building it if needed, or nullptr if the paths do not
+    // fit in the cache.
+    const AttributePathExpansionCache * GetAttributePathExpansionCache();
+
+    // Drops the cached expansion of the attribute paths, because the set of endpoints, clusters or attributes may have changed.
+    // A report in progress continues by expanding the remaining paths through the data model provider.
+    void DataModelStructureChanged();
+#endif // CHIP_IM_SERVER_MAX_CACHED_ATTRIBUTE_PATHS_PER_READ_HANDLER > 0
+
     CHIP_ERROR ProcessDataVersionFilterList(DataVersionFilterIBs::Parser & aDataVersionFilterListParser);
 
     // if current priority is in the middle, it has valid snapshoted last event number, it check cleaness via comparing
@@ -435,6 +448,12 @@ private:
 
     auto GetTransactionStartGeneration() const { return mTransactionStartGeneration; }
 
+    /**
+     * Scratch memory for building the current report chunk, released when the chunk is sent.  It is also
+     * InteractionArena::Current() while the reporting engine reads attributes and events for this handler.
+     */
+    InteractionArena & GetArena() { return mArena; }
+
     /// @brief Forces the read handler into a dirty state, regardless of what's going on with attributes.
     /// This can lead to scheduling of a reporting run immediately, if the min interval has been reached,
     /// or after the min interval is reached if it has not yet been reached.
@@ -449,8 +468,23 @@ private:
     size_t GetEventPathCount() const { return mpEventPathList == nullptr ? 0 : mpEventPathList->Count(); };
     size_t GetDataVersionFilterCount() const { return mpDataVersionFilterList == nullptr ? 0 : mpDataVersionFilterList->Count(); };
 
+    // Returns false if none of the urgent event paths of this handler can match aPath, so that logging an event
+    // does not have to walk the event path list of every subscription.  A true result may be a false positive.
+    bool MayHaveUrgentEventPathFor(const ConcreteEventPath & aPath) const
+    {
+        return (mUrgentEventClusterFilter & UrgentEventClusterFilterBit(aPath.mClusterId)) != 0;
+    }
+
     CHIP_ERROR SendStatusReport(Protocols::InteractionModel::Status aStatus);
 
+    static constexpr uint32_t UrgentEventClusterFilterBit(ClusterId aClusterId)
+    {
+        return static_cast<uint32_t>(1) << ((aClusterId ^ (aClusterId >> 16)) & 0x1F);
+    }
+
+    // Recomputes mUrgentEventClusterFilter; must be called whenever mpEventPathList changes.
+    void UpdateUrgentEventClusterFilter();
+
     friend class TestReadInteraction;
     friend class chip::app::reporting::TestReportingEngine;
     friend class chip::app::reporting::TestReportScheduler;
@@ -491,7 +525,8 @@ private:
      */
     void Close(CloseOptions options = CloseOptions::kDropPersistedSubscription);
 
-    CHIP_ERROR SendSubscribeResponse();
+    // aReusableBuffer, e.g. the StatusResponse acknowledging the priming reports, is reused for the SubscribeResponse if possible.
+    CHIP_ERROR SendSubscribeResponse(System::PacketBufferHandle && aReusableBuffer);
     CHIP_ERROR ProcessSubscribeRequest(System::PacketBufferHandle && aPayload);
     CHIP_ERROR ProcessReadRequest(System::PacketBufferHandle && aPayload);
     CHIP_ERROR ProcessAttributePaths(AttributePathIBs::Parser & aAttributePathListParser);
@@ -519,7 +554,11 @@ private:
     /// @param aFlag Flag to clear
     void ClearStateFlag(ReadHandlerFlags aFlag);
 
+    InteractionArena mArena;
     AttributePathExpandIterator mAttributePathExpandIterator;
+#if CHIP_IM_SERVER_MAX_CACHED_ATTRIBUTE_PATHS_PER_READ_HANDLER > 0
+    AttributePathExpansionCache mAttributePathExpansionCache;
+#endif // CHIP_IM_SERVER_MAX_CACHED_ATTRIBUTE_PATHS_PER_READ_HANDLER > 0
 
     // The current generation of the reporting engine dirty set the last time we were notified that a path we're interested in was
     // marked dirty.
@@ -585,6 +624,10 @@ private:
     SingleLinkedListNode<EventPathParams> * mpEventPathList           = nullptr;
     SingleLinkedListNode<DataVersionFilter> * mpDataVersionFilterList = nullptr;
 
+    // One bit per bucket of cluster ids that have an urgent event path in mpEventPathList, all bits for an urgent
+    // wildcard cluster; see UpdateUrgentEventClusterFilter.
+    uint32_t mUrgentEventClusterFilter = 0;
+
     ManagementCallback & mManagementCallback;
 
     uint32_t mLastWrittenEventsBytes = 0;
@@ -48,6 +48,11 @@ struct ReadPrepareParams
     bool mKeepSubscriptions             = false;
     bool mIsFabricFiltered              = true;
     bool mIsPeerLIT                     = false;
+    // Whether the session is expected to carry messages larger than the MTU (e.g. over TCP). The request may then hold more
+    // data version filters, and the publisher reports in chunks of up to kMaxLargeSecureSduLengthBytes rather than
+    // kMaxSecureSduLengthBytes, which saves most of the round trips of large reads. When resubscribing, the CASE session
+    // is established with TransportPayloadCapability::kLargePayload.
+    bool mAllowLargePayload = false;
 
     ReadPrepareParams() {}
     ReadPrepareParams(const SessionHandle & sessionHandle) { mSessionHolder.Grab(sessionHandle); }
@@ -66,6 +71,7 @@ struct ReadPrepareParams
         mTimeout                           = other.mTimeout;
         mIsFabricFiltered                  = other.mIsFabricFiltered;
         mIsPeerLIT                         = other.mIsPeerLIT;
+        mAllowLargePayload                 = other.mAllowLargePayload;
         other.mpEventPathParamsList        = nullptr;
         other.mEventPathParamsListSize     = 0;
         other.mpAttributePathParamsList    = nullptr;
@@ -91,6 +97,7 @@ struct ReadPrepareParams
         mTimeout                           = other.mTimeout;
         mIsFabricFiltered                  = other.mIsFabricFiltered;
         mIsPeerLIT                         = other.mIsPeerLIT;
+        mAllowLargePayload                 = other.mAllowLargePayload;
         other.mpEventPathParamsList        = nullptr;
         other.mEventPathParamsListSize     = 0;
         other.mpAttributePathParamsList    = nullptr;
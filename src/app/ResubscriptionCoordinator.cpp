@@ -0,0 +1,175 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/ResubscriptionCoordinator.h>
+
+#include <app/InteractionModelEngine.h>
+#include <app/ReadClient.h>
+#include <crypto/RandUtils.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <limits>
+
+#if CHIP_CONFIG_ENABLE_READ_CLIENT
+namespace chip {
+namespace app {
+
+ResubscriptionCoordinator::ResubscriptionCoordinator(size_t aMaxConcurrent, uint32_t aMaxJitterMs) :
+    mMaxConcurrent(aMaxConcurrent > 0 ? aMaxConcurrent : 1), mMaxJitterMs(aMaxJitterMs)
+{}
+
+uint32_t ResubscriptionCoordinator::AddJitter(uint32_t aDelayMs) const
+{
+    VerifyOrReturnValue(mMaxJitterMs > 0, aDelayMs);
+
+    uint32_t jitterMs = (mMaxJitterMs == std::numeric_limits<uint32_t>::max()) ? Crypto::GetRandU32()
+                                                                               : Crypto::GetRandU32() % (mMaxJitterMs + 1);
+    if (aDelayMs > std::numeric_limits<uint32_t>::max() - jitterMs)
+    {
+        return std::numeric_limits<uint32_t>::max();
+    }
+    return aDelayMs + jitterMs;
+}
+
+size_t ResubscriptionCoordinator::GetNumWaiting() const
+{
+    size_t count = 0;
+    for (ReadClient * client = mpWaitingHead; client != nullptr; client = client->mpNextWaitingResubscription)
+    {
+        count++;
+    }
+    return count;
+}
+
+bool ResubscriptionCoordinator::Acquire(ReadClient & aClient)
+{
+    VerifyOrReturnValue(!aClient.mHoldsResubscriptionSlot, true);
+
+    if (!aClient.mWaitingForResubscriptionSlot && mNumInProgress < mMaxConcurrent)
+    {
+        aClient.mHoldsResubscriptionSlot = true;
+        mNumInProgress++;
+        return true;
+    }
+
+    if (!aClient.mWaitingForResubscriptionSlot)
+    {
+        ChipLogProgress(DataManagement, "ReadClient[%p] waiting for one of the %u resubscription slots", &aClient,
+                        static_cast<unsigned>(mMaxConcurrent));
+        Enqueue(aClient);
+    }
+    return false;
+}
+
+void ResubscriptionCoordinator::Release(ReadClient & aClient)
+{
+    if (aClient.mWaitingForResubscriptionSlot)
+    {
+        Dequeue(aClient);
+        return;
+    }
+
+    VerifyOrReturn(aClient.mHoldsResubscriptionSlot);
+    aClient.mHoldsResubscriptionSlot = false;
+    mNumInProgress--;
+    StartNext();
+}
+
+void ResubscriptionCoordinator::StartNext()
+{
+    while (mNumInProgress < mMaxConcurrent && mpWaitingHead != nullptr)
+    {
+        ReadClient * client = PickNext();
+        Dequeue(*client);
+        client->mHoldsResubscriptionSlot = true;
+        mNumInProgress++;
+
+        // Resume from the event loop: the client releasing its slot may be in the middle of its own callbacks.
+        CHIP_ERROR err =
+            InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->StartTimer(
+                System::Clock::kZero, ReadClient::OnResubscribeTimerCallback, client);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DataManagement, "Failed to resume the resubscription of ReadClient[%p]: %" CHIP_ERROR_FORMAT, client,
+                         err.Format());
+            ReadClient::OnResubscribeTimerCallback(nullptr, client);
+        }
+    }
+}
+
+void ResubscriptionCoordinator::Enqueue(ReadClient & aClient)
+{
+    aClient.mWaitingForResubscriptionSlot = true;
+    aClient.mpNextWaitingResubscription   = nullptr;
+    if (mpWaitingTail == nullptr)
+    {
+        mpWaitingHead = &aClient;
+    }
+    else
+    {
+        mpWaitingTail->mpNextWaitingResubscription = &aClient;
+    }
+    mpWaitingTail = &aClient;
+}
+
+void ResubscriptionCoordinator::Dequeue(ReadClient & aClient)
+{
+    ReadClient * prev = nullptr;
+    for (ReadClient * client = mpWaitingHead; client != nullptr; prev = client, client = client->mpNextWaitingResubscription)
+    {
+        if (client != &aClient)
+        {
+            continue;
+        }
+
+        if (prev == nullptr)
+        {
+            mpWaitingHead = client->mpNextWaitingResubscription;
+        }
+        else
+        {
+            prev->mpNextWaitingResubscription = client->mpNextWaitingResubscription;
+        }
+        if (mpWaitingTail == client)
+        {
+            mpWaitingTail = prev;
+        }
+        break;
+    }
+
+    aClient.mWaitingForResubscriptionSlot = false;
+    aClient.mpNextWaitingResubscription   = nullptr;
+}
+
+ReadClient * ResubscriptionCoordinator::PickNext() const
+{
+    for (ReadClient * client = mpWaitingHead; client != nullptr; client = client->mpNextWaitingResubscription)
+    {
+        const auto & session = client->mReadPrepareParams.mSessionHolder;
+        if (session && session->AsSecureSession()->IsActiveSession())
+        {
+            return client;
+        }
+    }
+    return mpWaitingHead;
+}
+
+} // namespace app
+} // namespace chip
+#endif // CHIP_CONFIG_ENABLE_READ_CLIENT
@@ -0,0 +1,91 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AppConfig.h>
+#include <lib/core/CHIPConfig.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if CHIP_CONFIG_ENABLE_READ_CLIENT
+namespace chip {
+namespace app {
+
+class ReadClient;
+
+/**
+ * ResubscriptionCoordinator paces the resubscriptions of all the read clients of a controller, so that the subscriptions
+ * dropped together, e.g. by a controller restart or a network outage, do not all retry at once.
+ *
+ * Once set on the InteractionModelEngine, the coordinator:
+ *
+ * - adds a random delay of up to its maximum jitter to every resubscription a ReadClient schedules, and
+ * - lets at most its maximum number of resubscriptions re-establish at a time.  A resubscription whose timer fires while all
+ *   the slots are taken waits for one; it holds its slot until the subscription is established or the attempt fails.
+ *
+ * When a slot frees up, the waiting resubscriptions whose session to the peer is still active go first, since they only have
+ * to send a SubscribeRequest, then the others in the order they started waiting.
+ */
+class ResubscriptionCoordinator
+{
+public:
+    /**
+     * @param[in] aMaxConcurrent The number of resubscriptions allowed to re-establish at the same time, at least one.
+     * @param[in] aMaxJitterMs   The upper bound of the random delay added to each scheduled resubscription.
+     */
+    ResubscriptionCoordinator(size_t aMaxConcurrent = CHIP_RESUBSCRIBE_COORDINATOR_MAX_CONCURRENT,
+                              uint32_t aMaxJitterMs = CHIP_RESUBSCRIBE_COORDINATOR_MAX_JITTER_MS);
+
+    /**
+     * Add a random delay of up to the maximum jitter to the given resubscription delay.
+     */
+    uint32_t AddJitter(uint32_t aDelayMs) const;
+
+    size_t GetNumInProgress() const { return mNumInProgress; }
+    size_t GetNumWaiting() const;
+
+private:
+    friend class ReadClient;
+    friend class TestResubscriptionCoordinator;
+
+    // Take a slot for the resubscription of the client.  Returns false, and queues the client, if all the slots are taken:
+    // its resubscribe timer is fired again once it is granted one.
+    bool Acquire(ReadClient & aClient);
+
+    // Give up the slot of the client, or its place in the queue.
+    void Release(ReadClient & aClient);
+
+    // Grant the free slots to the waiting clients.
+    void StartNext();
+
+    void Enqueue(ReadClient & aClient);
+    void Dequeue(ReadClient & aClient);
+    ReadClient * PickNext() const;
+
+    const size_t mMaxConcurrent;
+    const uint32_t mMaxJitterMs;
+    size_t mNumInProgress      = 0;
+    ReadClient * mpWaitingHead = nullptr;
+    ReadClient * mpWaitingTail = nullptr;
+};
+
+} // namespace app
+} // namespace chip
+#endif // CHIP_CONFIG_ENABLE_READ_CLIENT
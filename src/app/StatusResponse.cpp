@@ -25,8 +25,15 @@ namespace app {
 CHIP_ERROR StatusResponse::Send(Protocols::InteractionModel::Status aStatus, Messaging::ExchangeContext * apExchangeContext,
                                 bool aExpectResponse)
 {
+    return Send(aStatus, apExchangeContext, aExpectResponse, System::PacketBufferHandle());
+}
+
+CHIP_ERROR StatusResponse::Send(Protocols::InteractionModel::Status aStatus, Messaging::ExchangeContext * apExchangeContext,
+                                bool aExpectResponse, System::PacketBufferHandle && aRequest)
+{
+    System::PacketBufferHandle msgBuf = std::move(aRequest);
     VerifyOrReturnError(apExchangeContext != nullptr, CHIP_ERROR_INCORRECT_STATE);
-    System::PacketBufferHandle msgBuf = System::PacketBufferHandle::New(kMaxSecureSduLengthBytes);
+    msgBuf = System::PacketBufferHandle::NewReusing(std::move(msgBuf), kMaxSecureSduLengthBytes);
     VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_NO_MEMORY);
 
     System::PacketBufferTLVWriter writer;
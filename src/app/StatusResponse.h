@@ -35,6 +35,11 @@ public:
     static CHIP_ERROR Send(Protocols::InteractionModel::Status aStatus, Messaging::ExchangeContext * apExchangeContext,
                            bool aExpectResponse);
 
+    // Same as above, building the StatusResponse in aRequest, the message being responded to, when its buffer can be reused.
+    // Either way aRequest is released before the StatusResponse is sent, so that the two are never held at once.
+    static CHIP_ERROR Send(Protocols::InteractionModel::Status aStatus, Messaging::ExchangeContext * apExchangeContext,
+                           bool aExpectResponse, System::PacketBufferHandle && aRequest);
+
     // The return value indicates whether the StatusResponse was parsed properly, and if it is CHIP_NO_ERROR
     // then aStatus has been set to the actual status, which might be success or failure.
     static CHIP_ERROR ProcessStatusResponse(System::PacketBufferHandle && aPayload, CHIP_ERROR & aStatus);
@@ -19,78 +19,117 @@
 #include <app/SubscriptionResumptionSessionEstablisher.h>
 #include <app/codegen-data-model-provider/Instance.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace app {
 
-class AutoDeleteEstablisher
-{
-public:
-    AutoDeleteEstablisher(SubscriptionResumptionSessionEstablisher * sessionEstablisher) : mSessionEstablisher(sessionEstablisher)
-    {}
-    ~AutoDeleteEstablisher() { chip::Platform::Delete(mSessionEstablisher); }
-
-    SubscriptionResumptionSessionEstablisher * operator->() const { return mSessionEstablisher; }
-
-    SubscriptionResumptionSessionEstablisher & operator*() const { return *mSessionEstablisher; }
-
-private:
-    SubscriptionResumptionSessionEstablisher * mSessionEstablisher;
-};
-
 SubscriptionResumptionSessionEstablisher::SubscriptionResumptionSessionEstablisher() :
     mOnConnectedCallback(HandleDeviceConnected, this), mOnConnectionFailureCallback(HandleDeviceConnectionFailure, this)
 {}
 
+SubscriptionResumptionSessionEstablisher::~SubscriptionResumptionSessionEstablisher()
+{
+    while (mpSubscriptions != nullptr)
+    {
+        ResumingSubscription * next = mpSubscriptions->mpNext;
+        Platform::Delete(mpSubscriptions);
+        mpSubscriptions = next;
+    }
+}
+
 CHIP_ERROR
-SubscriptionResumptionSessionEstablisher::ResumeSubscription(
-    CASESessionManager & caseSessionManager, const SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo)
+SubscriptionResumptionSessionEstablisher::AddSubscription(const SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo)
 {
-    mSubscriptionInfo.mNodeId         = subscriptionInfo.mNodeId;
-    mSubscriptionInfo.mFabricIndex    = subscriptionInfo.mFabricIndex;
-    mSubscriptionInfo.mSubscriptionId = subscriptionInfo.mSubscriptionId;
-    mSubscriptionInfo.mMinInterval    = subscriptionInfo.mMinInterval;
-    mSubscriptionInfo.mMaxInterval    = subscriptionInfo.mMaxInterval;
-    mSubscriptionInfo.mFabricFiltered = subscriptionInfo.mFabricFiltered;
+    const ScopedNodeId peer(subscriptionInfo.mNodeId, subscriptionInfo.mFabricIndex);
+    VerifyOrReturnError(mpSubscriptions == nullptr || GetPeer() == peer, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Platform::UniquePtr<ResumingSubscription> subscription(Platform::New<ResumingSubscription>());
+    VerifyOrReturnError(subscription, CHIP_ERROR_NO_MEMORY);
+
+    SubscriptionResumptionStorage::SubscriptionInfo & info = subscription->mSubscriptionInfo;
+    info.mNodeId                                           = subscriptionInfo.mNodeId;
+    info.mFabricIndex                                      = subscriptionInfo.mFabricIndex;
+    info.mSubscriptionId                                   = subscriptionInfo.mSubscriptionId;
+    info.mMinInterval                                      = subscriptionInfo.mMinInterval;
+    info.mMaxInterval                                      = subscriptionInfo.mMaxInterval;
+    info.mFabricFiltered                                   = subscriptionInfo.mFabricFiltered;
 #if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
-    mSubscriptionInfo.mResumptionRetries = subscriptionInfo.mResumptionRetries;
+    info.mResumptionRetries = subscriptionInfo.mResumptionRetries;
 #endif
     // Copy the Attribute Paths and Event Paths
     if (subscriptionInfo.mAttributePaths.AllocatedSize() > 0)
     {
-        mSubscriptionInfo.mAttributePaths.Alloc(subscriptionInfo.mAttributePaths.AllocatedSize());
-        if (!mSubscriptionInfo.mAttributePaths.Get())
+        info.mAttributePaths.Alloc(subscriptionInfo.mAttributePaths.AllocatedSize());
+        if (!info.mAttributePaths.Get())
         {
             return CHIP_ERROR_NO_MEMORY;
         }
-        for (size_t i = 0; i < mSubscriptionInfo.mAttributePaths.AllocatedSize(); ++i)
+        for (size_t i = 0; i < info.mAttributePaths.AllocatedSize(); ++i)
         {
-            mSubscriptionInfo.mAttributePaths[i] = subscriptionInfo.mAttributePaths[i];
+            info.mAttributePaths[i] = subscriptionInfo.mAttributePaths[i];
         }
     }
     if (subscriptionInfo.mEventPaths.AllocatedSize() > 0)
     {
-        mSubscriptionInfo.mEventPaths.Alloc(subscriptionInfo.mEventPaths.AllocatedSize());
-        if (!mSubscriptionInfo.mEventPaths.Get())
+        info.mEventPaths.Alloc(subscriptionInfo.mEventPaths.AllocatedSize());
+        if (!info.mEventPaths.Get())
         {
             return CHIP_ERROR_NO_MEMORY;
         }
-        for (size_t i = 0; i < mSubscriptionInfo.mEventPaths.AllocatedSize(); ++i)
+        for (size_t i = 0; i < info.mEventPaths.AllocatedSize(); ++i)
         {
-            mSubscriptionInfo.mEventPaths[i] = subscriptionInfo.mEventPaths[i];
+            info.mEventPaths[i] = subscriptionInfo.mEventPaths[i];
         }
     }
 
-    ScopedNodeId peerNode = ScopedNodeId(mSubscriptionInfo.mNodeId, mSubscriptionInfo.mFabricIndex);
-    caseSessionManager.FindOrEstablishSession(peerNode, &mOnConnectedCallback, &mOnConnectionFailureCallback);
+    subscription->mpNext = mpSubscriptions;
+    mpSubscriptions      = subscription.release();
+    mNumSubscriptions++;
     return CHIP_NO_ERROR;
 }
 
-void SubscriptionResumptionSessionEstablisher::HandleDeviceConnected(void * context, Messaging::ExchangeManager & exchangeMgr,
-                                                                     const SessionHandle & sessionHandle)
+CHIP_ERROR SubscriptionResumptionSessionEstablisher::ResumeSubscriptions(CASESessionManager & caseSessionManager)
 {
-    AutoDeleteEstablisher establisher(static_cast<SubscriptionResumptionSessionEstablisher *>(context));
-    SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo = establisher->mSubscriptionInfo;
-    InteractionModelEngine * imEngine                                  = InteractionModelEngine::GetInstance();
+    VerifyOrReturnError(mpSubscriptions != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    // The callbacks may run, and delete this establisher, before FindOrEstablishSession returns.
+    caseSessionManager.FindOrEstablishSession(GetPeer(), &mOnConnectedCallback, &mOnConnectionFailureCallback);
+    return CHIP_NO_ERROR;
+}
+
+ScopedNodeId SubscriptionResumptionSessionEstablisher::GetPeer() const
+{
+    VerifyOrReturnValue(mpSubscriptions != nullptr, ScopedNodeId());
+    return ScopedNodeId(mpSubscriptions->mSubscriptionInfo.mNodeId, mpSubscriptions->mSubscriptionInfo.mFabricIndex);
+}
+
+bool SubscriptionResumptionSessionEstablisher::HasSubscription(SubscriptionId subscriptionId) const
+{
+    for (const ResumingSubscription * subscription = mpSubscriptions; subscription != nullptr; subscription = subscription->mpNext)
+    {
+        if (subscription->mSubscriptionInfo.mSubscriptionId == subscriptionId)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint16_t SubscriptionResumptionSessionEstablisher::GetShortestMaxInterval() const
+{
+    uint16_t maxInterval = UINT16_MAX;
+    for (const ResumingSubscription * subscription = mpSubscriptions; subscription != nullptr; subscription = subscription->mpNext)
+    {
+        maxInterval = std::min(maxInterval, subscription->mSubscriptionInfo.mMaxInterval);
+    }
+    return maxInterval;
+}
+
+bool SubscriptionResumptionSessionEstablisher::ResumeSubscription(
+    SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo, const SessionHandle & sessionHandle)
+{
+    InteractionModelEngine * imEngine = InteractionModelEngine::GetInstance();
 
     // Decrement the number of subscriptions to resume since we have completed our retry attempt for a given subscription.
     // We do this before the readHandler creation since we do not care if the subscription has successfully been resumed or
@@ -102,7 +141,7 @@ void SubscriptionResumptionSessionEstablisher::HandleDeviceConnected(void * cont
     {
         // TODO - Should we keep the subscription here?
         ChipLogProgress(InteractionModel, "no resource for subscription resumption");
-        return;
+        return false;
     }
     ReadHandler * readHandler =
         imEngine->mReadHandlers.CreateObject(*imEngine, imEngine->GetReportScheduler(), imEngine->GetDataModelProvider());
@@ -110,9 +149,9 @@ void SubscriptionResumptionSessionEstablisher::HandleDeviceConnected(void * cont
     {
         // TODO - Should we keep the subscription here?
         ChipLogProgress(InteractionModel, "no resource for ReadHandler creation");
-        return;
+        return false;
     }
-    readHandler->OnSubscriptionResumed(sessionHandle, *establisher);
+    readHandler->OnSubscriptionResumed(sessionHandle, subscriptionInfo);
 #if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
     // Reset the resumption retries to 0 if subscription is resumed
     subscriptionInfo.mResumptionRetries  = 0;
@@ -122,16 +161,13 @@ void SubscriptionResumptionSessionEstablisher::HandleDeviceConnected(void * cont
         subscriptionResumptionStorage->Save(subscriptionInfo);
     }
 #endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+    return true;
 }
 
-void SubscriptionResumptionSessionEstablisher::HandleDeviceConnectionFailure(void * context, const ScopedNodeId & peerId,
-                                                                             CHIP_ERROR error)
+void SubscriptionResumptionSessionEstablisher::HandleResumptionFailure(
+    SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo)
 {
-    AutoDeleteEstablisher establisher(static_cast<SubscriptionResumptionSessionEstablisher *>(context));
-    InteractionModelEngine * imEngine                                  = InteractionModelEngine::GetInstance();
-    SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo = establisher->mSubscriptionInfo;
-    ChipLogError(DataManagement, "Failed to establish CASE for subscription-resumption with error '%" CHIP_ERROR_FORMAT "'",
-                 error.Format());
+    InteractionModelEngine * imEngine = InteractionModelEngine::GetInstance();
 
     // Decrement the number of subscriptions to resume since we have completed our retry attempt for a given subscription.
     // We do this here since we were not able to connect to the subscriber thus we have completed our resumption attempt.
@@ -162,5 +198,42 @@ void SubscriptionResumptionSessionEstablisher::HandleDeviceConnectionFailure(voi
     }
 }
 
+void SubscriptionResumptionSessionEstablisher::HandleDeviceConnected(void * context, Messaging::ExchangeManager & exchangeMgr,
+                                                                     const SessionHandle & sessionHandle)
+{
+    auto * establisher = static_cast<SubscriptionResumptionSessionEstablisher *>(context);
+    size_t numResumed  = 0;
+
+    for (ResumingSubscription * subscription = establisher->mpSubscriptions; subscription != nullptr;
+         subscription                        = subscription->mpNext)
+    {
+        if (ResumeSubscription(subscription->mSubscriptionInfo, sessionHandle))
+        {
+            numResumed++;
+        }
+    }
+
+    // Deletes the establisher.
+    InteractionModelEngine::GetInstance()->OnSubscriptionResumptionDone(*establisher, numResumed,
+                                                                        establisher->mNumSubscriptions - numResumed);
+}
+
+void SubscriptionResumptionSessionEstablisher::HandleDeviceConnectionFailure(void * context, const ScopedNodeId & peerId,
+                                                                             CHIP_ERROR error)
+{
+    auto * establisher = static_cast<SubscriptionResumptionSessionEstablisher *>(context);
+    ChipLogError(DataManagement, "Failed to establish CASE for subscription-resumption with error '%" CHIP_ERROR_FORMAT "'",
+                 error.Format());
+
+    for (ResumingSubscription * subscription = establisher->mpSubscriptions; subscription != nullptr;
+         subscription                        = subscription->mpNext)
+    {
+        HandleResumptionFailure(subscription->mSubscriptionInfo);
+    }
+
+    // Deletes the establisher.
+    InteractionModelEngine::GetInstance()->OnSubscriptionResumptionDone(*establisher, 0, establisher->mNumSubscriptions);
+}
+
 } // namespace app
 } // namespace chip
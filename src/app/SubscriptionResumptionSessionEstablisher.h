@@ -20,28 +20,58 @@
 #include <app/AttributePathParams.h>
 #include <app/CASESessionManager.h>
 #include <app/SubscriptionResumptionStorage.h>
+#include <lib/support/IntrusiveList.h>
 
 namespace chip {
 namespace app {
 
 /**
- *  Session Establisher to resume persistent subscription. A CASE session will be established upon invoking
- *  ResumeSubscription(), followed by the creation and intialization of a ReadHandler. This class helps prevent
- *  a scenario where all ReadHandlers in the pool grab the invalid session handle. In such scenario, if the device
- *  receives a new subscription request, it will crash as there is no evictable ReadHandler.
+ *  Session Establisher to resume persistent subscriptions. A CASE session will be established upon invoking
+ *  ResumeSubscriptions(), followed by the creation and intialization of a ReadHandler for each of the subscriptions added to
+ *  the establisher. This class helps prevent a scenario where all ReadHandlers in the pool grab the invalid session handle. In
+ *  such scenario, if the device receives a new subscription request, it will crash as there is no evictable ReadHandler.
+ *
+ *  All the subscriptions of an establisher belong to the same peer, so that they share a single CASE session.  The
+ *  InteractionModelEngine queues the establishers, and deletes them once the resumption completes.
  */
 
-class SubscriptionResumptionSessionEstablisher
+class SubscriptionResumptionSessionEstablisher : public IntrusiveListNodeBase<>
 {
 public:
     SubscriptionResumptionSessionEstablisher();
+    ~SubscriptionResumptionSessionEstablisher();
+
+    /**
+     * Add a copy of the given subscription to the subscriptions to resume.  The subscription must be to the peer of the
+     * subscriptions added before.
+     */
+    CHIP_ERROR AddSubscription(const SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo);
+
+    CHIP_ERROR ResumeSubscriptions(CASESessionManager & caseSessionManager);
+
+    ScopedNodeId GetPeer() const;
+    size_t GetNumSubscriptions() const { return mNumSubscriptions; }
+    bool HasSubscription(SubscriptionId subscriptionId) const;
 
-    CHIP_ERROR ResumeSubscription(CASESessionManager & caseSessionManager,
-                                  const SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo);
+    // The shortest max interval of the subscriptions, which is how soon the peer notices that they are gone.
+    uint16_t GetShortestMaxInterval() const;
 
-    SubscriptionResumptionStorage::SubscriptionInfo mSubscriptionInfo;
+    // Whether the peer registered for Check-In messages, which it gets for as long as its subscriptions are not resumed.
+    bool IsCheckInClient() const { return mIsCheckInClient; }
+    void SetCheckInClient(bool isCheckInClient) { mIsCheckInClient = isCheckInClient; }
 
 private:
+    struct ResumingSubscription
+    {
+        SubscriptionResumptionStorage::SubscriptionInfo mSubscriptionInfo;
+        ResumingSubscription * mpNext = nullptr;
+    };
+
+    // Resume the subscription on the established session, returning whether it got a ReadHandler.
+    static bool ResumeSubscription(SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo,
+                                   const SessionHandle & sessionHandle);
+    static void HandleResumptionFailure(SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo);
+
     // Callback funstions for continuing the subscription resumption
     static void HandleDeviceConnected(void * context, Messaging::ExchangeManager & exchangeMgr,
                                       const SessionHandle & sessionHandle);
@@ -50,6 +80,10 @@ private:
     // Callbacks to handle server-initiated session success/failure
     chip::Callback::Callback<OnDeviceConnected> mOnConnectedCallback;
     chip::Callback::Callback<OnDeviceConnectionFailure> mOnConnectionFailureCallback;
+
+    ResumingSubscription * mpSubscriptions = nullptr;
+    size_t mNumSubscriptions               = 0;
+    bool mIsCheckInClient                  = false;
 };
 } // namespace app
 } // namespace chip
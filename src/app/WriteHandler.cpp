@@ -17,8 +17,8 @@
  */
 
 #include <app/AppConfig.h>
-#include <app/AttributeAccessInterfaceRegistry.h>
 #include <app/AttributeValueDecoder.h>
+#include <app/ClusterStatistics.h>
 #include <app/InteractionModelEngine.h>
 #include <app/MessageDef/EventPathIB.h>
 #include <app/MessageDef/StatusIB.h>
@@ -94,6 +94,7 @@ void WriteHandler::Close()
     // wasSuccessful here is safe: if it does anything, we were in fact not
     // successful.
     DeliverFinalListWriteEnd(false /* wasSuccessful */);
+    mArena.Reset();
     mExchangeCtx.Release();
     mStateFlags.Clear(StateBits::kSuppressResponse);
     mDataModelProvider = nullptr;
@@ -249,18 +250,16 @@ exit:
 
 void WriteHandler::DeliverListWriteBegin(const ConcreteAttributePath & aPath)
 {
-    if (auto * attrOverride = AttributeAccessInterfaceRegistry::Instance().Get(aPath.mEndpointId, aPath.mClusterId))
-    {
-        attrOverride->OnListWriteBegin(aPath);
-    }
+    VerifyOrReturn(mDataModelProvider != nullptr);
+    mDataModelProvider->ListAttributeWriteNotification(aPath, DataModel::ListWriteOperation::kListWriteBegin);
 }
 
 void WriteHandler::DeliverListWriteEnd(const ConcreteAttributePath & aPath, bool writeWasSuccessful)
 {
-    if (auto * attrOverride = AttributeAccessInterfaceRegistry::Instance().Get(aPath.mEndpointId, aPath.mClusterId))
-    {
-        attrOverride->OnListWriteEnd(aPath, writeWasSuccessful);
-    }
+    VerifyOrReturn(mDataModelProvider != nullptr);
+    mDataModelProvider->ListAttributeWriteNotification(aPath,
+                                                       writeWasSuccessful ? DataModel::ListWriteOperation::kListWriteSuccess
+                                                                          : DataModel::ListWriteOperation::kListWriteFailure);
 }
 
 void WriteHandler::DeliverFinalListWriteEnd(bool writeWasSuccessful)
@@ -287,7 +286,7 @@ CHIP_ERROR WriteHandler::DeliverFinalListWriteEndForGroupWrite(bool writeWasSucc
     auto processingConcreteAttributePath = mProcessingAttributePath.Value();
     mProcessingAttributePath.ClearValue();
 
-    iterator = groupDataProvider->IterateEndpoints(fabricIndex);
+    iterator = groupDataProvider->IterateEndpoints(fabricIndex, groupId);
     VerifyOrReturnError(iterator != nullptr, CHIP_ERROR_NO_MEMORY);
 
     while (iterator->Next(mapping))
@@ -472,7 +471,7 @@ CHIP_ERROR WriteHandler::ProcessGroupAttributeDataIBs(TLV::TLVReader & aAttribut
                       "Received group attribute write for Group=%u Cluster=" ChipLogFormatMEI " attribute=" ChipLogFormatMEI,
                       groupId, ChipLogValueMEI(dataAttributePath.mClusterId), ChipLogValueMEI(dataAttributePath.mAttributeId));
 
-        AutoReleaseGroupEndpointIterator iterator(Credentials::GetGroupDataProvider()->IterateEndpoints(fabric));
+        AutoReleaseGroupEndpointIterator iterator(Credentials::GetGroupDataProvider()->IterateEndpoints(fabric, groupId));
         VerifyOrExit(!iterator.IsNull(), err = CHIP_ERROR_NO_MEMORY);
 
         bool shouldReportListWriteEnd = ShouldReportListWriteEnd(
@@ -654,13 +653,17 @@ Status WriteHandler::ProcessWriteRequest(System::PacketBufferHandle && aPayload,
 
     AttributeDataIBsParser.GetReader(&AttributeDataIBsReader);
 
-    if (mExchangeCtx->IsGroupExchangeContext())
-    {
-        err = ProcessGroupAttributeDataIBs(AttributeDataIBsReader);
-    }
-    else
     {
-        err = ProcessAttributeDataIBs(AttributeDataIBsReader);
+        // Kept until Close(), since the chunks of a list write arrive in separate messages.
+        InteractionArena::Scope arenaScope(mArena);
+        if (mExchangeCtx->IsGroupExchangeContext())
+        {
+            err = ProcessGroupAttributeDataIBs(AttributeDataIBsReader);
+        }
+        else
+        {
+            err = ProcessAttributeDataIBs(AttributeDataIBsReader);
+        }
     }
     SuccessOrExit(err);
     SuccessOrExit(err = writeRequestParser.ExitContainer());
@@ -765,6 +768,9 @@ CHIP_ERROR WriteHandler::WriteClusterData(const Access::SubjectDescriptor & aSub
     request.previousSuccessPath = mLastSuccessfullyWrittenPath;
     request.writeFlags.Set(DataModel::WriteFlags::kTimed, IsTimedWrite());
 
+    IM_CLUSTER_STATS_RECORD_BYTES(kWriteAttribute, aPath.mClusterId, aPath.mAttributeId,
+                                  ClusterStatistics::GetElementLength(aData));
+
     AttributeValueDecoder decoder(aData, aSubject);
 
     DataModel::ActionReturnStatus status = mDataModelProvider->WriteAttribute(request, decoder);
@@ -22,6 +22,7 @@
 #include <app/AttributeAccessToken.h>
 #include <app/AttributePathParams.h>
 #include <app/ConcreteAttributePath.h>
+#include <app/InteractionArena.h>
 #include <app/InteractionModelDelegatePointers.h>
 #include <app/MessageDef/WriteResponseMessage.h>
 #include <app/data-model-provider/Provider.h>
@@ -125,6 +126,12 @@ public:
      */
     bool IsTimedWrite() const { return mStateFlags.Has(StateBits::kIsTimedRequest); }
 
+    /**
+     * Scratch memory for the write, kept across the chunks of a list write and released when the handler closes.  It is
+     * also InteractionArena::Current() while attribute data is being written.
+     */
+    InteractionArena & GetArena() { return mArena; }
+
     bool MatchesExchangeContext(Messaging::ExchangeContext * apExchangeContext) const
     {
         return !IsFree() && mExchangeCtx.Get() == apExchangeContext;
@@ -202,6 +209,7 @@ private:
 
     DataModel::Provider * mDataModelProvider = nullptr;
     std::optional<ConcreteAttributePath> mLastSuccessfullyWrittenPath;
+    InteractionArena mArena;
 
     // This may be a "fake" pointer or a real delegate pointer, depending
     // on CHIP_CONFIG_STATIC_GLOBAL_INTERACTION_MODEL_ENGINE setting.
@@ -18,8 +18,10 @@
 
 #pragma once
 
+#include <cmath>
 #include <functional>
 #include <stdbool.h>
+#include <stddef.h>
 #include <type_traits>
 
 #include <app/data-model/Nullable.h>
@@ -50,6 +52,41 @@ using Timestamp = System::Clock::Milliseconds64;
 template <typename T>
 using Nullable = DataModel::Nullable<T>;
 
+/**
+ * Deadband of a measured attribute: the changes from the value last marked dirty are only reported once significant.
+ *
+ * A change is significant when it reaches any of the enabled thresholds, a threshold of zero being disabled. When all the
+ * thresholds are disabled, every change is significant.
+ */
+template <typename T>
+struct QuieterReportingDeadband
+{
+    // Change from the last dirty value that is significant.
+    T absoluteChange = 0;
+    // Change from the last dirty value, in percent of the last dirty value, that is significant.
+    uint8_t percentChange = 0;
+    // Time since the last dirty value after which any change is significant.
+    System::Clock::Milliseconds64 quietTime{ 0 };
+
+    bool IsDisabled() const { return absoluteChange == 0 && percentChange == 0 && quietTime == System::Clock::kZero; }
+};
+
+// Magnitude of the difference between two values, computed without overflowing: unsigned for integers, double otherwise.
+template <typename T>
+auto AbsoluteDifference(T a, T b)
+{
+    if constexpr (std::is_integral<T>::value)
+    {
+        using U = std::make_unsigned_t<T>;
+        return static_cast<U>((a > b) ? static_cast<U>(static_cast<U>(a) - static_cast<U>(b))
+                                      : static_cast<U>(static_cast<U>(b) - static_cast<U>(a)));
+    }
+    else
+    {
+        return std::fabs(static_cast<double>(a) - static_cast<double>(b));
+    }
+}
+
 /**
  * This class helps track reporting state of an attribute to properly keep track of whether
  * it needs to be marked as dirty or not for purposes of reporting using
@@ -144,6 +181,50 @@ public:
         };
     }
 
+    /**
+     * @brief Factory to generate a functor for "attribute changed significantly since last marked as dirty", according to a
+     *        deadband. See `QuieterReportingDeadband`.
+     *
+     * @param deadband - thresholds of a significant change, copied into the functor.
+     * @return a functor usable for the `changedPredicate` arg of `SetValue()`
+     */
+    static SufficientChangePredicate GetPredicateForDeadband(const QuieterReportingDeadband<T> & deadband)
+    {
+        return [deadband](const SufficientChangePredicateCandidate & candidate) -> bool {
+            return IsSignificantChange(deadband, candidate);
+        };
+    }
+
+    /**
+     * @brief Returns whether the change of `candidate` is significant according to `deadband`.
+     */
+    static bool IsSignificantChange(const QuieterReportingDeadband<T> & deadband,
+                                    const SufficientChangePredicateCandidate & candidate)
+    {
+        if (candidate.lastDirtyValue == candidate.newValue)
+        {
+            return false;
+        }
+        if (deadband.IsDisabled() || candidate.lastDirtyValue.IsNull() || candidate.newValue.IsNull())
+        {
+            return true;
+        }
+
+        const T lastValue = candidate.lastDirtyValue.Value();
+        const auto change = AbsoluteDifference(candidate.newValue.Value(), lastValue);
+        if (deadband.absoluteChange > 0 && change >= AbsoluteDifference(deadband.absoluteChange, T{ 0 }))
+        {
+            return true;
+        }
+        if (deadband.percentChange != 0 &&
+            static_cast<double>(change) * 100 >= deadband.percentChange * std::fabs(static_cast<double>(lastValue)))
+        {
+            return true;
+        }
+        return deadband.quietTime != System::Clock::kZero &&
+            (candidate.nowTimestamp - candidate.lastDirtyTimestamp) >= deadband.quietTime;
+    }
+
     Nullable<T> value() const { return mValue; }
     QuieterReportingPolicyFlags & policy() { return mPolicyFlags; }
     const QuieterReportingPolicyFlags & policy() const { return mPolicyFlags; }
@@ -231,9 +312,62 @@ protected:
     chip::System::Clock::Timestamp mLastDirtyTimestampMillis{};
 };
 
+/**
+ * Quieter reporting state of a set of measured attributes of a cluster instance, each one with its deadband.
+ *
+ * Meant for the measurement clusters, which get new samples of many attributes at a high rate: the server passes each new
+ * sample to `SetValue()` and only marks dirty the attributes that changed significantly, per their `QuieterReportingDeadband`.
+ *
+ *     QuieterReportingAttributeSet<int64_t, kMeasuredAttributeCount> mReporting;
+ *
+ *     for (size_t i = 0; i < kMeasuredAttributeCount; i++)
+ *     {
+ *         if (mReporting.SetValue(i, delegate.GetMeasurement(i), now) == AttributeDirtyState::kMustReport)
+ *         {
+ *             MatterReportingAttributeChangeCallback(path_for_attribute_at(i));
+ *         }
+ *     }
+ *
+ * @tparam T - the type of underlying numerical value of the attributes.
+ * @tparam N - the number of attributes.
+ */
+template <typename T, size_t N>
+class QuieterReportingAttributeSet
+{
+public:
+    static constexpr size_t Size() { return N; }
+
+    QuieterReportingAttribute<T> & operator[](size_t index) { return mAttributes[index]; }
+    const QuieterReportingAttribute<T> & operator[](size_t index) const { return mAttributes[index]; }
+
+    const QuieterReportingDeadband<T> & GetDeadband(size_t index) const { return mDeadbands[index]; }
+    void SetDeadband(size_t index, const QuieterReportingDeadband<T> & deadband) { mDeadbands[index] = deadband; }
+
+    /**
+     * Same as `QuieterReportingAttribute::SetValue()` for the attribute at `index`, with the changes made significant by its
+     * deadband also marked dirty.
+     */
+    AttributeDirtyState SetValue(size_t index, const Nullable<T> & newValue, Timestamp now)
+    {
+        using Attribute = QuieterReportingAttribute<T>;
+
+        const QuieterReportingDeadband<T> & deadband = mDeadbands[index];
+        return mAttributes[index].SetValue(newValue, now,
+                                           [&deadband](const typename Attribute::SufficientChangePredicateCandidate & candidate) {
+                                               return Attribute::IsSignificantChange(deadband, candidate);
+                                           });
+    }
+
+private:
+    QuieterReportingAttribute<T> mAttributes[N];
+    QuieterReportingDeadband<T> mDeadbands[N];
+};
+
 } // namespace detail
 
 using detail::QuieterReportingAttribute;
+using detail::QuieterReportingAttributeSet;
+using detail::QuieterReportingDeadband;
 
 } // namespace app
 } // namespace chip
@@ -270,3 +270,97 @@ TEST(TestQuieterReporting, SufficientChangePredicateWorks)
     EXPECT_EQ(attribute.SetValue(NullNullable, now, predicate), AttributeDirtyState::kNoReportNeeded);
     EXPECT_TRUE(attribute.value().IsNull());
 }
+
+TEST(TestQuieterReporting, DeadbandPredicateWorks)
+{
+    FakeClock fakeClock;
+    fakeClock.SetMonotonic(100_ms);
+
+    QuieterReportingAttribute<int64_t> attribute{ MakeNullable<int64_t>(1000) };
+    auto now = fakeClock.now();
+
+    QuieterReportingDeadband<int64_t> deadband;
+    deadband.absoluteChange = 50;
+    deadband.percentChange  = 10;
+    deadband.quietTime      = 1000_ms;
+    auto predicate          = attribute.GetPredicateForDeadband(deadband);
+
+    // Last dirty value is 1000. Changes below both the absolute and the percent thresholds are not significant.
+    EXPECT_EQ(attribute.SetValue(1049, now, predicate), AttributeDirtyState::kNoReportNeeded);
+    EXPECT_EQ(attribute.SetValue(951, now, predicate), AttributeDirtyState::kNoReportNeeded);
+    EXPECT_EQ(attribute.value().ValueOr(0), 951);
+
+    // A change of 50 reaches the absolute threshold.
+    EXPECT_EQ(attribute.SetValue(950, now, predicate), AttributeDirtyState::kMustReport);
+
+    // Last dirty value is 950. Without the absolute threshold, 10% is a change of 95.
+    deadband.absoluteChange = 0;
+    predicate               = attribute.GetPredicateForDeadband(deadband);
+    EXPECT_EQ(attribute.SetValue(1044, now, predicate), AttributeDirtyState::kNoReportNeeded);
+    EXPECT_EQ(attribute.SetValue(1045, now, predicate), AttributeDirtyState::kMustReport);
+
+    // Once the quiet time elapsed, any change from the last dirty value is significant.
+    now = fakeClock.Advance(999_ms);
+    EXPECT_EQ(attribute.SetValue(1046, now, predicate), AttributeDirtyState::kNoReportNeeded);
+    now = fakeClock.Advance(1_ms);
+    EXPECT_EQ(attribute.SetValue(1045, now, predicate), AttributeDirtyState::kNoReportNeeded);
+    EXPECT_EQ(attribute.SetValue(1046, now, predicate), AttributeDirtyState::kMustReport);
+
+    // Changes of nullability are always significant.
+    EXPECT_EQ(attribute.SetValue(NullNullable, now, predicate), AttributeDirtyState::kMustReport);
+    EXPECT_EQ(attribute.SetValue(1046, now, predicate), AttributeDirtyState::kMustReport);
+
+    // Without any threshold, every change is significant.
+    predicate = attribute.GetPredicateForDeadband(QuieterReportingDeadband<int64_t>{});
+    EXPECT_EQ(attribute.SetValue(1047, now, predicate), AttributeDirtyState::kMustReport);
+    EXPECT_EQ(attribute.SetValue(1047, now, predicate), AttributeDirtyState::kNoReportNeeded);
+}
+
+TEST(TestQuieterReporting, DeadbandHandlesExtremeValues)
+{
+    FakeClock fakeClock;
+    auto now = fakeClock.now();
+
+    QuieterReportingAttribute<int64_t> attribute{ MakeNullable<int64_t>(INT64_MIN) };
+    QuieterReportingDeadband<int64_t> deadband;
+    deadband.absoluteChange = INT64_MAX;
+    auto predicate          = attribute.GetPredicateForDeadband(deadband);
+
+    EXPECT_EQ(attribute.SetValue(-2, now, predicate), AttributeDirtyState::kNoReportNeeded);
+    EXPECT_EQ(attribute.SetValue(INT64_MAX, now, predicate), AttributeDirtyState::kMustReport);
+
+    QuieterReportingAttribute<uint8_t> unsignedAttribute{ MakeNullable<uint8_t>(200) };
+    QuieterReportingDeadband<uint8_t> unsignedDeadband;
+    unsignedDeadband.absoluteChange = 100;
+    auto unsignedPredicate          = unsignedAttribute.GetPredicateForDeadband(unsignedDeadband);
+
+    EXPECT_EQ(unsignedAttribute.SetValue(101, now, unsignedPredicate), AttributeDirtyState::kNoReportNeeded);
+    EXPECT_EQ(unsignedAttribute.SetValue(100, now, unsignedPredicate), AttributeDirtyState::kMustReport);
+}
+
+TEST(TestQuieterReporting, AttributeSetAppliesDeadbandsPerAttribute)
+{
+    FakeClock fakeClock;
+    fakeClock.SetMonotonic(100_ms);
+    auto now = fakeClock.now();
+
+    QuieterReportingAttributeSet<int64_t, 2> attributes;
+    EXPECT_EQ(attributes.Size(), 2u);
+
+    QuieterReportingDeadband<int64_t> deadband;
+    deadband.absoluteChange = 10;
+    attributes.SetDeadband(1, deadband);
+    EXPECT_EQ(attributes.GetDeadband(1).absoluteChange, 10);
+    EXPECT_TRUE(attributes.GetDeadband(0).IsDisabled());
+
+    // Null --> value is always dirty.
+    EXPECT_EQ(attributes.SetValue(0, MakeNullable<int64_t>(100), now), AttributeDirtyState::kMustReport);
+    EXPECT_EQ(attributes.SetValue(1, MakeNullable<int64_t>(100), now), AttributeDirtyState::kMustReport);
+
+    // Attribute 0 reports every change, attribute 1 only changes of 10 or more.
+    EXPECT_EQ(attributes.SetValue(0, MakeNullable<int64_t>(101), now), AttributeDirtyState::kMustReport);
+    EXPECT_EQ(attributes.SetValue(1, MakeNullable<int64_t>(105), now), AttributeDirtyState::kNoReportNeeded);
+    EXPECT_EQ(attributes[1].value().ValueOr(0), 105);
+    EXPECT_EQ(attributes.SetValue(1, MakeNullable<int64_t>(110), now), AttributeDirtyState::kMustReport);
+    EXPECT_EQ(attributes[0].value().ValueOr(0), 101);
+}
@@ -58,6 +58,25 @@ constexpr uint16_t kClusterRevision = 2;
 
 namespace {
 
+// Cursors of resumable list encoding for lists of per-fabric entries: the fabric index above the position of the entry in its
+// fabric.
+constexpr uint32_t kFabricEntryCursorIndexBits = 24;
+
+constexpr uint32_t FabricEntryCursor(FabricIndex fabric, size_t index)
+{
+    return (static_cast<uint32_t>(fabric) << kFabricEntryCursorIndexBits) | static_cast<uint32_t>(index);
+}
+
+constexpr FabricIndex FabricEntryCursorFabric(uint32_t cursor)
+{
+    return static_cast<FabricIndex>(cursor >> kFabricEntryCursorIndexBits);
+}
+
+constexpr size_t FabricEntryCursorIndex(uint32_t cursor)
+{
+    return cursor & ((1u << kFabricEntryCursorIndexBits) - 1);
+}
+
 class AccessControlAttribute : public AttributeAccessInterface,
                                public AccessControl::EntryListener
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
@@ -78,6 +97,9 @@ public:
     /// Returns appropriately mapped CHIP_ERROR if applicable (may return CHIP_IM_GLOBAL_STATUS errors)
     CHIP_ERROR Write(const ConcreteDataAttributePath & aPath, AttributeValueDecoder & aDecoder) override;
 
+    void OnListWriteBegin(const ConcreteAttributePath & aPath) override;
+    void OnListWriteEnd(const ConcreteAttributePath & aPath, bool aWriteWasSuccessful) override;
+
 public:
     void OnEntryChanged(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t index,
                         const AccessControl::Entry * entry, AccessControl::EntryListener::ChangeType changeType) override;
@@ -106,6 +128,25 @@ private:
     CHIP_ERROR ReadCommissioningArl(AttributeValueEncoder & aEncoder);
     CHIP_ERROR ReadArl(AttributeValueEncoder & aEncoder);
 #endif
+
+    /// Writes the entry at the given position of the ACL of the fabric, which has `count` entries, replacing the entry
+    /// already there if any.
+    CHIP_ERROR WriteAclEntryAt(const SubjectDescriptor & aSubjectDescriptor, size_t aIndex, size_t aCount, const Entry & aEntry);
+
+    /// Deletes the entries of the ACL of the fabric past the first `aCount` ones, last first.
+    CHIP_ERROR TruncateAcl(const SubjectDescriptor & aSubjectDescriptor, size_t aCount);
+
+    // Write of the ACL list in progress, between OnListWriteBegin and OnListWriteEnd.  Once a ReplaceAll started it, the
+    // entries it writes replace the existing ones in place and the entries left past its end are only deleted when it ends,
+    // so that a chunked write (an empty ReplaceAll followed by AppendItem operations) persists every entry once, rather than
+    // deleting the whole list and creating it again.
+    struct AclListWrite
+    {
+        bool mInProgress = false;
+        bool mReplacing  = false;
+        SubjectDescriptor mSubjectDescriptor;
+        size_t mWrittenCount = 0;
+    } mAclListWrite;
 } sAttribute;
 
 CHIP_ERROR LogExtensionChangedEvent(const AccessControlCluster::Structs::AccessControlExtensionStruct::Type & item,
@@ -202,20 +243,32 @@ CHIP_ERROR AccessControlAttribute::ReadImpl(const ConcreteReadAttributePath & aP
 
 CHIP_ERROR AccessControlAttribute::ReadAcl(AttributeValueEncoder & aEncoder)
 {
-    AccessControl::EntryIterator iterator;
     AccessControl::Entry entry;
     AclStorage::EncodableEntry encodableEntry(entry);
-    return aEncoder.EncodeList([&](const auto & encoder) -> CHIP_ERROR {
+    return aEncoder.EncodeResumableList([&](const auto & encoder, uint32_t cursor) -> CHIP_ERROR {
+        // When resuming a chunked list, the fabrics before the one of the cursor were encoded entirely in previous chunks.
+        bool resumed = (cursor == 0);
         for (auto & info : Server::GetInstance().GetFabricTable())
         {
-            auto fabric = info.GetFabricIndex();
-            ReturnErrorOnFailure(GetAccessControl().Entries(fabric, iterator));
-            CHIP_ERROR err = CHIP_NO_ERROR;
-            while ((err = iterator.Next(entry)) == CHIP_NO_ERROR)
+            auto fabric  = info.GetFabricIndex();
+            size_t index = 0;
+            if (!resumed)
             {
-                ReturnErrorOnFailure(encoder.Encode(encodableEntry));
+                if (fabric != FabricEntryCursorFabric(cursor))
+                {
+                    continue;
+                }
+                resumed = true;
+                index   = FabricEntryCursorIndex(cursor);
+            }
+
+            size_t count = 0;
+            ReturnErrorOnFailure(GetAccessControl().GetEntryCount(fabric, count));
+            for (; index < count; index++)
+            {
+                ReturnErrorOnFailure(GetAccessControl().ReadEntry(fabric, index, entry));
+                ReturnErrorOnFailure(encoder.Encode(FabricEntryCursor(fabric, index + 1), encodableEntry));
             }
-            VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_ERROR_SENTINEL, err);
         }
         return CHIP_NO_ERROR;
     });
@@ -285,35 +338,38 @@ CHIP_ERROR AccessControlAttribute::WriteAcl(const ConcreteDataAttributePath & aP
         size_t i      = 0;
         while (iterator.Next())
         {
-            if (i < oldCount)
-            {
-                ReturnErrorOnFailure(GetAccessControl().UpdateEntry(&aDecoder.GetSubjectDescriptor(), accessingFabricIndex, i,
-                                                                    iterator.GetValue().GetEntry()));
-            }
-            else
-            {
-                ReturnErrorOnFailure(GetAccessControl().CreateEntry(&aDecoder.GetSubjectDescriptor(), accessingFabricIndex, nullptr,
-                                                                    iterator.GetValue().GetEntry()));
-            }
+            ReturnErrorOnFailure(WriteAclEntryAt(aDecoder.GetSubjectDescriptor(), i, oldCount, iterator.GetValue().GetEntry()));
             ++i;
         }
         ReturnErrorOnFailure(iterator.GetStatus());
 
-        while (i < oldCount)
+        if (mAclListWrite.mInProgress)
         {
-            --oldCount;
-            ReturnErrorOnFailure(GetAccessControl().DeleteEntry(&aDecoder.GetSubjectDescriptor(), accessingFabricIndex, oldCount));
+            // The items appended next overwrite the remaining entries, and OnListWriteEnd deletes those left over.
+            mAclListWrite.mReplacing         = true;
+            mAclListWrite.mSubjectDescriptor = aDecoder.GetSubjectDescriptor();
+            mAclListWrite.mWrittenCount      = i;
+        }
+        else
+        {
+            ReturnErrorOnFailure(TruncateAcl(aDecoder.GetSubjectDescriptor(), i));
         }
     }
     else if (aPath.mListOp == ConcreteDataAttributePath::ListOperation::AppendItem)
     {
-        VerifyOrReturnError((oldCount + 1) <= maxCount, CHIP_IM_GLOBAL_STATUS(ResourceExhausted));
+        const bool replacing = mAclListWrite.mInProgress && mAclListWrite.mReplacing &&
+            mAclListWrite.mSubjectDescriptor.fabricIndex == accessingFabricIndex;
+        const size_t index = replacing ? mAclListWrite.mWrittenCount : oldCount;
+        VerifyOrReturnError((index + 1) <= maxCount, CHIP_IM_GLOBAL_STATUS(ResourceExhausted));
 
         AclStorage::DecodableEntry decodableEntry;
         ReturnErrorOnFailure(aDecoder.Decode(decodableEntry));
 
-        ReturnErrorOnFailure(GetAccessControl().CreateEntry(&aDecoder.GetSubjectDescriptor(), accessingFabricIndex, nullptr,
-                                                            decodableEntry.GetEntry()));
+        ReturnErrorOnFailure(WriteAclEntryAt(aDecoder.GetSubjectDescriptor(), index, oldCount, decodableEntry.GetEntry()));
+        if (replacing)
+        {
+            mAclListWrite.mWrittenCount++;
+        }
     }
     else
     {
@@ -323,6 +379,47 @@ CHIP_ERROR AccessControlAttribute::WriteAcl(const ConcreteDataAttributePath & aP
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR AccessControlAttribute::WriteAclEntryAt(const SubjectDescriptor & aSubjectDescriptor, size_t aIndex, size_t aCount,
+                                                   const Entry & aEntry)
+{
+    if (aIndex < aCount)
+    {
+        return GetAccessControl().UpdateEntry(&aSubjectDescriptor, aSubjectDescriptor.fabricIndex, aIndex, aEntry);
+    }
+    return GetAccessControl().CreateEntry(&aSubjectDescriptor, aSubjectDescriptor.fabricIndex, nullptr, aEntry);
+}
+
+CHIP_ERROR AccessControlAttribute::TruncateAcl(const SubjectDescriptor & aSubjectDescriptor, size_t aCount)
+{
+    size_t count;
+    ReturnErrorOnFailure(GetAccessControl().GetEntryCount(aSubjectDescriptor.fabricIndex, count));
+    while (count > aCount)
+    {
+        --count;
+        ReturnErrorOnFailure(GetAccessControl().DeleteEntry(&aSubjectDescriptor, aSubjectDescriptor.fabricIndex, count));
+    }
+    return CHIP_NO_ERROR;
+}
+
+void AccessControlAttribute::OnListWriteBegin(const ConcreteAttributePath & aPath)
+{
+    VerifyOrReturn(aPath.mAttributeId == AccessControlCluster::Attributes::Acl::Id);
+    mAclListWrite             = AclListWrite();
+    mAclListWrite.mInProgress = true;
+}
+
+void AccessControlAttribute::OnListWriteEnd(const ConcreteAttributePath & aPath, bool aWriteWasSuccessful)
+{
+    VerifyOrReturn(aPath.mAttributeId == AccessControlCluster::Attributes::Acl::Id);
+
+    // Even when the write failed, the ACL ends with the entries written so far, as it would have without deferring.
+    if (mAclListWrite.mReplacing)
+    {
+        LogErrorOnFailure(TruncateAcl(mAclListWrite.mSubjectDescriptor, mAclListWrite.mWrittenCount));
+    }
+    mAclListWrite = AclListWrite();
+}
+
 CHIP_ERROR AccessControlAttribute::WriteExtension(const ConcreteDataAttributePath & aPath, AttributeValueDecoder & aDecoder)
 {
     auto & storage = Server::GetInstance().GetPersistentStorage();
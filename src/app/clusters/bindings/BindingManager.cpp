@@ -104,12 +104,12 @@ CHIP_ERROR BindingManager::EstablishConnection(const ScopedNodeId & nodeId)
 {
     VerifyOrReturnError(mInitParams.mCASESessionManager != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    mLastSessionEstablishmentError = CHIP_NO_ERROR;
-    auto * connectionCallback      = Platform::New<ConnectionCallback>(*this);
-    VerifyOrReturnError(connectionCallback != nullptr, CHIP_ERROR_NO_MEMORY);
+    // The notifications pending for the peer are sent once the connection in progress is established.
+    VerifyOrReturnError(!IsConnecting(nodeId), CHIP_NO_ERROR);
+    // The notifications pending for the peer wait for a connection in progress to complete.
+    VerifyOrReturnError(mConnectingPeerCount < kMaxConcurrentConnections, CHIP_NO_ERROR);
 
-    mInitParams.mCASESessionManager->FindOrEstablishSession(nodeId, connectionCallback->GetOnDeviceConnected(),
-                                                            connectionCallback->GetOnDeviceConnectionFailure());
+    ReturnErrorOnFailure(FindOrEstablishSession(nodeId));
     if (mLastSessionEstablishmentError == CHIP_ERROR_NO_MEMORY)
     {
         // Release the least recently used entry
@@ -119,21 +119,95 @@ CHIP_ERROR BindingManager::EstablishConnection(const ScopedNodeId & nodeId)
             mPendingNotificationMap.RemoveAllEntriesForNode(peerToRemove);
 
             // Now retry
-            mLastSessionEstablishmentError = CHIP_NO_ERROR;
-            // At this point connectionCallback is null since it deletes itself when the callback is called.
-            connectionCallback = Platform::New<ConnectionCallback>(*this);
-            mInitParams.mCASESessionManager->FindOrEstablishSession(nodeId, connectionCallback->GetOnDeviceConnected(),
-                                                                    connectionCallback->GetOnDeviceConnectionFailure());
+            ReturnErrorOnFailure(FindOrEstablishSession(nodeId));
         }
     }
     return mLastSessionEstablishmentError;
 }
 
+CHIP_ERROR BindingManager::FindOrEstablishSession(const ScopedNodeId & nodeId)
+{
+    mLastSessionEstablishmentError = CHIP_NO_ERROR;
+    // The connection callback deletes itself when it is called.
+    auto * connectionCallback = Platform::New<ConnectionCallback>(*this);
+    VerifyOrReturnError(connectionCallback != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    // The callbacks may be called synchronously, which completes the connection right away.
+    mConnectingPeers[mConnectingPeerCount++] = nodeId;
+    mEstablishingConnection                  = true;
+    mInitParams.mCASESessionManager->FindOrEstablishSession(nodeId, connectionCallback->GetOnDeviceConnected(),
+                                                            connectionCallback->GetOnDeviceConnectionFailure());
+    mEstablishingConnection = false;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BindingManager::ConnectPendingPeers()
+{
+    CHIP_ERROR error = CHIP_NO_ERROR;
+    bool connecting  = true;
+
+    while (connecting && mConnectingPeerCount < kMaxConcurrentConnections)
+    {
+        connecting = false;
+        // Look again from the start after each connection, a connection established synchronously removes entries.
+        for (PendingNotificationEntry pendingNotification : mPendingNotificationMap)
+        {
+            EmberBindingTableEntry entry = BindingTable::GetInstance().GetAt(pendingNotification.mBindingEntryId);
+            ScopedNodeId peer(entry.nodeId, entry.fabricIndex);
+            if (IsConnecting(peer))
+            {
+                continue;
+            }
+
+            CHIP_ERROR err = EstablishConnection(peer);
+            if (err != CHIP_NO_ERROR)
+            {
+                ChipLogError(AppServer, "Failed to connect to node 0x" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                             ChipLogValueX64(peer.GetNodeId()), err.Format());
+                mPendingNotificationMap.RemoveAllEntriesForNode(peer);
+                if (error == CHIP_NO_ERROR)
+                {
+                    error = err;
+                }
+            }
+            connecting = true;
+            break;
+        }
+    }
+    return error;
+}
+
+bool BindingManager::IsConnecting(const ScopedNodeId & nodeId) const
+{
+    for (uint8_t i = 0; i < mConnectingPeerCount; i++)
+    {
+        if (mConnectingPeers[i] == nodeId)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void BindingManager::ConnectionAttemptDone(const ScopedNodeId & nodeId)
+{
+    for (uint8_t i = 0; i < mConnectingPeerCount; i++)
+    {
+        if (mConnectingPeers[i] == nodeId)
+        {
+            mConnectingPeers[i] = mConnectingPeers[--mConnectingPeerCount];
+            return;
+        }
+    }
+}
+
 void BindingManager::HandleDeviceConnected(Messaging::ExchangeManager & exchangeMgr, const SessionHandle & sessionHandle)
 {
     FabricIndex fabricToRemove = kUndefinedFabricIndex;
     NodeId nodeToRemove        = kUndefinedNodeId;
 
+    ConnectionAttemptDone(sessionHandle->GetPeer());
+
     // Note: not using a const ref here, because the mPendingNotificationMap
     // iterator returns things by value anyway.
     for (PendingNotificationEntry pendingNotification : mPendingNotificationMap)
@@ -150,22 +224,38 @@ void BindingManager::HandleDeviceConnected(Messaging::ExchangeManager & exchange
     }
 
     mPendingNotificationMap.RemoveAllEntriesForNode(ScopedNodeId(nodeToRemove, fabricToRemove));
+
+    if (!mEstablishingConnection)
+    {
+        (void) ConnectPendingPeers();
+    }
 }
 
 void BindingManager::HandleDeviceConnectionFailure(const ScopedNodeId & peerId, CHIP_ERROR error)
 {
-    // Simply release the entry, the connection will be re-established as needed.
     ChipLogError(AppServer, "Failed to establish connection to node 0x" ChipLogFormatX64, ChipLogValueX64(peerId.GetNodeId()));
     mLastSessionEstablishmentError = error;
-    // We don't release the entry when connection fails, because inside
-    // BindingManager::EstablishConnection we may try again the connection.
-    // TODO(#22173): The logic in there doesn't actually make any sense with how
-    // mPendingNotificationMap and CASESessionManager are implemented today.
+    ConnectionAttemptDone(peerId);
+
+    // Failures reported synchronously are handled by BindingManager::EstablishConnection, which may try the connection again.
+    // Otherwise release the entries, the connection will be re-established as needed.
+    if (!mEstablishingConnection)
+    {
+        mPendingNotificationMap.RemoveAllEntriesForNode(peerId);
+        (void) ConnectPendingPeers();
+    }
 }
 
 void BindingManager::FabricRemoved(FabricIndex fabricIndex)
 {
     mPendingNotificationMap.RemoveAllEntriesForFabric(fabricIndex);
+    for (uint8_t i = mConnectingPeerCount; i > 0; i--)
+    {
+        if (mConnectingPeers[i - 1].GetFabricIndex() == fabricIndex)
+        {
+            ConnectionAttemptDone(mConnectingPeers[i - 1]);
+        }
+    }
 
     // TODO(#18436): NOC cluster should handle fabric removal without needing binding manager
     //               to execute such a release. Currently not done because paths were not tested.
@@ -191,8 +281,6 @@ CHIP_ERROR BindingManager::NotifyBoundClusterChanged(EndpointId endpoint, Cluste
             {
                 error = mPendingNotificationMap.AddPendingNotification(iter.GetIndex(), bindingContext);
                 SuccessOrExit(error);
-                error = EstablishConnection(ScopedNodeId(iter->nodeId, iter->fabricIndex));
-                SuccessOrExit(error);
             }
             else if (iter->type == MATTER_MULTICAST_BINDING)
             {
@@ -201,6 +289,10 @@ CHIP_ERROR BindingManager::NotifyBoundClusterChanged(EndpointId endpoint, Cluste
         }
     }
 
+    // Connect once all the notifications are pending, so that each peer is connected to once, with all the peers connected to
+    // in parallel.
+    error = ConnectPendingPeers();
+
 exit:
     bindingContext->DecrementConsumersNumber();
 
@@ -66,6 +66,10 @@ struct BindingManagerInitParams
  *  - The binding cluster adds a unicast entry to the binding table.
  *  - A watched cluster changes with a unicast binding but we cannot find an active connection to the peer.
  *
+ * Up to CHIP_CONFIG_BINDING_MANAGER_MAX_CONCURRENT_CONNECTIONS connections are established at the same time, the notifications to
+ * the other peers stay pending until one of these completes. The notifications to a peer that is being connected to are sent
+ * along with the other ones once the connection is established, without connecting again.
+ *
  * The class uses an LRU mechanism to choose the connection to eliminate when there is no space for a new connection.
  * The BindingManager class will not actively re-establish connection and will connect on-demand (when binding cluster
  * or watched cluster is changed).
@@ -164,9 +168,16 @@ private:
         Callback::Callback<OnDeviceConnectionFailure> mOnConnectionFailureCallback;
     };
 
+    static constexpr uint8_t kMaxConcurrentConnections = CHIP_CONFIG_BINDING_MANAGER_MAX_CONCURRENT_CONNECTIONS;
+
     static BindingManager sBindingManager;
 
     CHIP_ERROR EstablishConnection(const ScopedNodeId & nodeId);
+    CHIP_ERROR FindOrEstablishSession(const ScopedNodeId & nodeId);
+    // Connects to the peers of the pending notifications, as many as there can be connections in progress.
+    CHIP_ERROR ConnectPendingPeers();
+    bool IsConnecting(const ScopedNodeId & nodeId) const;
+    void ConnectionAttemptDone(const ScopedNodeId & nodeId);
 
     PendingNotificationMap mPendingNotificationMap;
     BoundDeviceChangedHandler mBoundDeviceChangedHandler;
@@ -177,6 +188,12 @@ private:
 
     // Used to keep track of synchronous failures from FindOrEstablishSession.
     CHIP_ERROR mLastSessionEstablishmentError;
+
+    // Peers a connection is being established to.
+    ScopedNodeId mConnectingPeers[kMaxConcurrentConnections];
+    uint8_t mConnectingPeerCount = 0;
+    // Set while calling CASESessionManager::FindOrEstablishSession, which may call the connection callbacks synchronously.
+    bool mEstablishingConnection = false;
 };
 
 } // namespace chip
@@ -391,7 +391,7 @@ static DefaultColorControlSceneHandler sColorControlSceneHandler;
  * Matter timer scheduling glue logic
  *********************************************************/
 
-void ColorControlServer::timerCallback(System::Layer *, void * callbackContext)
+void ColorControlServer::timerCallback(void * callbackContext)
 {
     auto control = static_cast<EmberEventControl *>(callbackContext);
     (control->callback)(control->endpoint);
@@ -399,7 +399,10 @@ void ColorControlServer::timerCallback(System::Layer *, void * callbackContext)
 
 void ColorControlServer::scheduleTimerCallbackMs(EmberEventControl * control, uint32_t delayMs)
 {
-    CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(chip::System::Clock::Milliseconds32(delayMs), timerCallback, control);
+    // The transition steps of all the endpoints are aligned on the update period, so that they all run from the same tick
+    CHIP_ERROR err = TransitionTickScheduler::Instance().Schedule(transitionTicks[control - eventControls], timerCallback, control,
+                                                                  chip::System::Clock::Milliseconds32(delayMs),
+                                                                  TRANSITION_UPDATE_TIME_MS);
 
     if (err != CHIP_NO_ERROR)
     {
@@ -409,7 +412,7 @@ void ColorControlServer::scheduleTimerCallbackMs(EmberEventControl * control, ui
 
 void ColorControlServer::cancelEndpointTimerCallback(EmberEventControl * control)
 {
-    DeviceLayer::SystemLayer().CancelTimer(timerCallback, control);
+    TransitionTickScheduler::Instance().Cancel(transitionTicks[control - eventControls]);
 }
 
 void ColorControlServer::cancelEndpointTimerCallback(EndpointId endpoint)
@@ -22,6 +22,7 @@
 #include <app/ConcreteCommandPath.h>
 #include <app/cluster-building-blocks/QuieterReporting.h>
 #include <app/data-model/Nullable.h>
+#include <app/util/TransitionTickScheduler.h>
 #include <app/util/af-types.h>
 #include <app/util/attribute-storage.h>
 #include <app/util/basic-types.h>
@@ -237,7 +238,7 @@ private:
     bool computeNewColor16uValue(Color16uTransitionState * p);
 
     // Matter timer scheduling glue logic
-    static void timerCallback(chip::System::Layer *, void * callbackContext);
+    static void timerCallback(void * callbackContext);
     void scheduleTimerCallbackMs(EmberEventControl * control, uint32_t delayMs);
     void cancelEndpointTimerCallback(EmberEventControl * control);
     uint16_t getEndpointIndex(chip::EndpointId);
@@ -317,6 +318,7 @@ private:
 #endif // MATTER_DM_PLUGIN_COLOR_CONTROL_SERVER_TEMP
 
     EmberEventControl eventControls[kColorControlClusterServerMaxEndpointCount];
+    chip::app::TransitionTickScheduler::Tick transitionTicks[kColorControlClusterServerMaxEndpointCount];
     chip::app::QuieterReportingAttribute<uint16_t> quietRemainingTime[kColorControlClusterServerMaxEndpointCount];
 
 #ifdef MATTER_DM_PLUGIN_SCENES_MANAGEMENT
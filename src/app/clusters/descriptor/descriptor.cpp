@@ -40,6 +40,30 @@ using namespace chip::app::Clusters::Descriptor::Attributes;
 
 namespace {
 
+// Returns the index of the descendant of the endpoint at rootIndex that follows the one at the given index depth first, or
+// kEmberInvalidEndpointIndex if there is none.
+uint16_t NextDescendantIndex(uint16_t rootIndex, uint16_t index)
+{
+    uint16_t next = emberAfFirstChildEndpointIndexFromIndex(index);
+    while (next == kEmberInvalidEndpointIndex && index != rootIndex && index != kEmberInvalidEndpointIndex)
+    {
+        next  = emberAfNextSiblingEndpointIndexFromIndex(index);
+        index = emberAfParentEndpointIndexFromIndex(index);
+    }
+    return next;
+}
+
+bool IsDescendantIndex(uint16_t rootIndex, uint16_t index)
+{
+    VerifyOrReturnValue(rootIndex != kEmberInvalidEndpointIndex, false);
+    for (index = emberAfParentEndpointIndexFromIndex(index); index != kEmberInvalidEndpointIndex;
+         index = emberAfParentEndpointIndexFromIndex(index))
+    {
+        VerifyOrReturnValue(index != rootIndex, true);
+    }
+    return false;
+}
+
 class DescriptorAttrAccess : public AttributeAccessInterface
 {
 public:
@@ -95,8 +119,9 @@ CHIP_ERROR DescriptorAttrAccess::ReadPartsAttribute(EndpointId endpoint, Attribu
 
     if (endpoint == 0x00)
     {
-        err = aEncoder.EncodeList([](const auto & encoder) -> CHIP_ERROR {
-            for (uint16_t index = 0; index < emberAfEndpointCount(); index++)
+        // The cursor is the index of the next endpoint to look at.
+        err = aEncoder.EncodeResumableList([](const auto & encoder, uint32_t cursor) -> CHIP_ERROR {
+            for (uint16_t index = static_cast<uint16_t>(cursor); index < emberAfEndpointCount(); index++)
             {
                 if (emberAfEndpointIndexIsEnabled(index))
                 {
@@ -104,7 +129,7 @@ CHIP_ERROR DescriptorAttrAccess::ReadPartsAttribute(EndpointId endpoint, Attribu
                     if (endpointId == 0)
                         continue;
 
-                    ReturnErrorOnFailure(encoder.Encode(endpointId));
+                    ReturnErrorOnFailure(encoder.Encode(index + 1u, endpointId));
                 }
             }
 
@@ -113,27 +138,30 @@ CHIP_ERROR DescriptorAttrAccess::ReadPartsAttribute(EndpointId endpoint, Attribu
     }
     else if (IsFlatCompositionForEndpoint(endpoint))
     {
-        err = aEncoder.EncodeList([endpoint](const auto & encoder) -> CHIP_ERROR {
-            for (uint16_t index = 0; index < emberAfEndpointCount(); index++)
+        // The descendants are listed depth first, the cursor is the index of the next one plus one.
+        err = aEncoder.EncodeResumableList([endpoint](const auto & encoder, uint32_t cursor) -> CHIP_ERROR {
+            const uint16_t rootIndex = emberAfIndexFromEndpoint(endpoint);
+            uint16_t index           = NextDescendantIndex(rootIndex, rootIndex);
+            uint32_t minIndex        = 0;
+            if (cursor > 0)
             {
-                if (!emberAfEndpointIndexIsEnabled(index))
-                    continue;
-
-                uint16_t childIndex = index;
-                while (childIndex != chip::kInvalidListIndex)
+                // Unless the topology changed since the previous chunk, resume at the next descendant; otherwise skip the ones
+                // that are likely to have been encoded already.
+                index = static_cast<uint16_t>(cursor - 1);
+                if (!IsDescendantIndex(rootIndex, index))
                 {
-                    EndpointId parentEndpointId = emberAfParentEndpointFromIndex(childIndex);
-                    if (parentEndpointId == chip::kInvalidEndpointId)
-                        break;
+                    index    = NextDescendantIndex(rootIndex, rootIndex);
+                    minIndex = cursor - 1;
+                }
+            }
 
-                    if (parentEndpointId == endpoint)
-                    {
-                        ReturnErrorOnFailure(encoder.Encode(emberAfEndpointFromIndex(index)));
-                        break;
-                    }
+            for (; index != kEmberInvalidEndpointIndex; index = NextDescendantIndex(rootIndex, index))
+            {
+                if (index < minIndex)
+                    continue;
 
-                    childIndex = emberAfIndexFromEndpoint(parentEndpointId);
-                }
+                uint16_t nextIndex = NextDescendantIndex(rootIndex, index);
+                ReturnErrorOnFailure(encoder.Encode(nextIndex + 1u, emberAfEndpointFromIndex(index)));
             }
 
             return CHIP_NO_ERROR;
@@ -141,17 +169,23 @@ CHIP_ERROR DescriptorAttrAccess::ReadPartsAttribute(EndpointId endpoint, Attribu
     }
     else if (IsTreeCompositionForEndpoint(endpoint))
     {
-        err = aEncoder.EncodeList([endpoint](const auto & encoder) -> CHIP_ERROR {
-            for (uint16_t index = 0; index < emberAfEndpointCount(); index++)
+        // The children are sorted by index, the cursor is the index of the next one plus one.
+        err = aEncoder.EncodeResumableList([endpoint](const auto & encoder, uint32_t cursor) -> CHIP_ERROR {
+            const uint16_t parentIndex = emberAfIndexFromEndpoint(endpoint);
+            uint16_t index             = emberAfFirstChildEndpointIndexFromIndex(parentIndex);
+            if (cursor > 0 && cursor - 1 < kEmberInvalidEndpointIndex &&
+                emberAfParentEndpointIndexFromIndex(static_cast<uint16_t>(cursor - 1)) == parentIndex)
             {
-                if (!emberAfEndpointIndexIsEnabled(index))
+                index = static_cast<uint16_t>(cursor - 1);
+            }
+
+            for (; index != kEmberInvalidEndpointIndex; index = emberAfNextSiblingEndpointIndexFromIndex(index))
+            {
+                if (cursor > 0 && index < cursor - 1)
                     continue;
 
-                EndpointId parentEndpointId = emberAfParentEndpointFromIndex(index);
-                if (parentEndpointId == endpoint)
-                {
-                    ReturnErrorOnFailure(encoder.Encode(emberAfEndpointFromIndex(index)));
-                }
+                uint16_t nextIndex = emberAfNextSiblingEndpointIndexFromIndex(index);
+                ReturnErrorOnFailure(encoder.Encode(nextIndex + 1u, emberAfEndpointFromIndex(index)));
             }
 
             return CHIP_NO_ERROR;
@@ -72,7 +72,9 @@ CHIP_ERROR BDXDiagnosticLogsProvider::InitializeTransfer(CommandHandler * comman
 
     TransferSession::TransferInitData initOptions;
     initOptions.TransferCtlFlags = TransferControlFlags::kSenderDrive;
-    initOptions.MaxBlockSize     = kBdxMaxBlockSize;
+    // Sessions that carry large payloads (e.g. TCP) can move the logs in a handful of large blocks.
+    initOptions.MaxBlockSize =
+        sessionHandle->AllowsLargePayload() ? CHIP_CONFIG_BDX_LARGE_PAYLOAD_MAX_BLOCK_SIZE : kBdxMaxBlockSize;
     initOptions.FileDesLength    = static_cast<uint16_t>(fileDesignator.size());
     initOptions.FileDesignator   = Uint8::from_const_char(fileDesignator.data());
 
@@ -176,12 +178,11 @@ void BDXDiagnosticLogsProvider::OnAcceptReceived()
 
 void BDXDiagnosticLogsProvider::OnAckReceived()
 {
-    uint16_t blockSize = mTransfer.GetTransferBlockSize();
-
-    auto blockBuf = System::PacketBufferHandle::New(blockSize);
+    // Have the delegate write the log chunk straight into the buffer of the outgoing block message.
+    auto blockBuf = mTransfer.AllocateBlockBuffer();
     VerifyOrReturn(!blockBuf.IsNull(), mTransfer.AbortTransfer(GetBdxStatusCodeFromChipError(CHIP_ERROR_NO_MEMORY)));
 
-    auto buffer     = MutableByteSpan(blockBuf->Start(), blockSize);
+    auto buffer     = MutableByteSpan(blockBuf->Start(), mTransfer.GetTransferBlockSize());
     bool isEndOfLog = false;
 
     // Get the log next chunk and see if it fits i.e. if is end of log is reported
@@ -196,12 +197,8 @@ void BDXDiagnosticLogsProvider::OnAckReceived()
     }
 
     // Prepare the BDX block to send to the requestor
-    TransferSession::BlockData blockData;
-    blockData.Data   = blockBuf->Start();
-    blockData.Length = static_cast<size_t>(buffer.size());
-    blockData.IsEof  = isEndOfLog;
-
-    err = mTransfer.PrepareBlock(blockData);
+    blockBuf->SetDataLength(buffer.size());
+    err = mTransfer.PrepareBlock(std::move(blockBuf), isEndOfLog);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(BDX, "PrepareBlock failed: %" CHIP_ERROR_FORMAT, err.Format());
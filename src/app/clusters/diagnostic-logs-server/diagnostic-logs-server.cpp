@@ -80,7 +80,20 @@ void AddResponse(CommandHandler * commandObj, const ConcreteCommandPath & path,
 }
 
 #if CHIP_CONFIG_ENABLE_BDX_LOG_TRANSFER
-BDXDiagnosticLogsProvider gBDXDiagnosticLogsProvider;
+BDXDiagnosticLogsProvider gBDXDiagnosticLogsProviders[CHIP_CONFIG_MAX_BDX_LOG_PROVIDER_TRANSFERS];
+
+BDXDiagnosticLogsProvider * GetIdleBDXDiagnosticLogsProvider()
+{
+    for (auto & provider : gBDXDiagnosticLogsProviders)
+    {
+        if (!provider.IsBusy())
+        {
+            return &provider;
+        }
+    }
+
+    return nullptr;
+}
 #endif // CHIP_CONFIG_ENABLE_BDX_LOG_TRANSFER
 
 } // anonymous namespace
@@ -152,8 +165,9 @@ void DiagnosticLogsServer::HandleLogRequestForBdx(CommandHandler * commandObj, c
     // to transfer as much of the current logs as it can fit within the response, and the Status field of the
     // RetrieveLogsResponse SHALL be set to Exhausted.
 #if CHIP_CONFIG_ENABLE_BDX_LOG_TRANSFER
-    VerifyOrReturn(!gBDXDiagnosticLogsProvider.IsBusy(), AddResponse(commandObj, path, StatusEnum::kBusy));
-    auto err = gBDXDiagnosticLogsProvider.InitializeTransfer(commandObj, path, delegate, intent, transferFileDesignator.Value());
+    auto * provider = GetIdleBDXDiagnosticLogsProvider();
+    VerifyOrReturn(nullptr != provider, AddResponse(commandObj, path, StatusEnum::kBusy));
+    auto err = provider->InitializeTransfer(commandObj, path, delegate, intent, transferFileDesignator.Value());
     VerifyOrReturn(CHIP_NO_ERROR == err, AddResponse(commandObj, path, StatusEnum::kDenied));
 #else
     HandleLogRequestForResponsePayload(commandObj, path, intent, StatusEnum::kExhausted);
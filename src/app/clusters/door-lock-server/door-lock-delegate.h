@@ -143,6 +143,40 @@ public:
      * Clear the Aliro reader configuration for the lock.
      */
     virtual CHIP_ERROR ClearAliroReaderConfig() = 0;
+
+    /**
+     * @brief Find the occupied credential of the given type that has the given data.
+     *
+     * Optional. Locks storing many users and credentials should implement it with an index keyed on the credential type and
+     * data, e.g. a hash table, since the server otherwise reads every user and credential slot to find a credential.
+     *
+     * @param[in] credentialType Type of the credential.
+     * @param[in] credentialData Data of the credential.
+     * @param[out] credentialIndex Index of the credential.
+     * @param[out] userIndex Index of the user the credential is associated with, 0 if it is not associated with a user.
+     * @return CHIP_ERROR_NOT_FOUND if there is no such credential, CHIP_ERROR_NOT_IMPLEMENTED if the lookup is not supported.
+     */
+    virtual CHIP_ERROR FindCredentialByData(CredentialTypeEnum credentialType, const ByteSpan & credentialData,
+                                            uint16_t & credentialIndex, uint16_t & userIndex)
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+    /**
+     * @brief Find the user an occupied credential is associated with.
+     *
+     * Optional, see FindCredentialByData.
+     *
+     * @param[in] credentialType Type of the credential.
+     * @param[in] credentialIndex Index of the credential.
+     * @param[out] userIndex Index of the user the credential is associated with.
+     * @return CHIP_ERROR_NOT_FOUND if the credential is not associated with a user, CHIP_ERROR_NOT_IMPLEMENTED if the lookup is
+     *         not supported.
+     */
+    virtual CHIP_ERROR FindUserByCredential(CredentialTypeEnum credentialType, uint16_t credentialIndex, uint16_t & userIndex)
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
 };
 
 } // namespace DoorLock
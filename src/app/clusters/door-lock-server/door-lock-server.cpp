@@ -724,7 +724,27 @@ void DoorLockServer::setCredentialCommandHandler(
     }
 
     // appclusters, 5.2.4.41.1: we should return DUPLICATE in the response if we're trying to create duplicated credential entry
-    for (uint16_t i = 1; CredentialTypeEnum::kProgrammingPIN != credentialType && (i <= maxNumberOfCredentials); ++i)
+    bool checkDuplicateBySlot = (CredentialTypeEnum::kProgrammingPIN != credentialType);
+    Delegate * delegate       = GetDelegate(commandPath.mEndpointId);
+    if (checkDuplicateBySlot && nullptr != delegate)
+    {
+        uint16_t existingCredentialIndex = 0;
+        uint16_t existingUserIndex       = 0;
+        CHIP_ERROR err = delegate->FindCredentialByData(credentialType, credentialData, existingCredentialIndex, existingUserIndex);
+        if (CHIP_NO_ERROR == err)
+        {
+            ChipLogProgress(Zcl,
+                            "[SetCredential] Credential with the same data and type already exist "
+                            "[endpointId=%d,credentialType=%u,dataLength=%u,existingCredentialIndex=%d,credentialIndex=%d]",
+                            commandPath.mEndpointId, to_underlying(credentialType),
+                            static_cast<unsigned int>(credentialData.size()), existingCredentialIndex, credentialIndex);
+            sendSetCredentialResponse(commandObj, commandPath, DlStatus::kDuplicate, 0, nextAvailableCredentialSlot);
+            return;
+        }
+        checkDuplicateBySlot = (CHIP_ERROR_NOT_IMPLEMENTED == err);
+    }
+
+    for (uint16_t i = 1; checkDuplicateBySlot && (i <= maxNumberOfCredentials); ++i)
     {
         EmberAfPluginDoorLockCredentialInfo currentCredential;
         if (!emberAfPluginDoorLockGetCredential(commandPath.mEndpointId, i, credentialType, currentCredential))
@@ -1848,6 +1868,16 @@ bool DoorLockServer::findUnoccupiedCredentialSlot(chip::EndpointId endpointId, C
 bool DoorLockServer::findUserIndexByCredential(chip::EndpointId endpointId, CredentialTypeEnum credentialType,
                                                uint16_t credentialIndex, uint16_t & userIndex)
 {
+    Delegate * delegate = GetDelegate(endpointId);
+    if (nullptr != delegate)
+    {
+        CHIP_ERROR err = delegate->FindUserByCredential(credentialType, credentialIndex, userIndex);
+        if (CHIP_ERROR_NOT_IMPLEMENTED != err)
+        {
+            return CHIP_NO_ERROR == err;
+        }
+    }
+
     uint16_t maxNumberOfUsers = 0;
     VerifyOrReturnError(GetAttribute(endpointId, Attributes::NumberOfTotalUsersSupported::Id,
                                      Attributes::NumberOfTotalUsersSupported::Get, maxNumberOfUsers),
@@ -1886,6 +1916,28 @@ bool DoorLockServer::findUserIndexByCredential(chip::EndpointId endpointId, Cred
                                                chip::ByteSpan credentialData, uint16_t & userIndex, uint16_t & credentialIndex,
                                                EmberAfPluginDoorLockUserInfo & userInfo)
 {
+    Delegate * delegate = GetDelegate(endpointId);
+    if (nullptr != delegate)
+    {
+        uint16_t foundCredentialIndex = 0;
+        uint16_t foundUserIndex       = 0;
+        CHIP_ERROR err = delegate->FindCredentialByData(credentialType, credentialData, foundCredentialIndex, foundUserIndex);
+        if (CHIP_ERROR_NOT_IMPLEMENTED != err)
+        {
+            VerifyOrReturnValue(CHIP_NO_ERROR == err && 0 != foundUserIndex, false);
+            if (!emberAfPluginDoorLockGetUser(endpointId, foundUserIndex, userInfo))
+            {
+                ChipLogError(Zcl, "[findUserIndexByCredential] Unable to get user: app error [userIndex=%d]", foundUserIndex);
+                return false;
+            }
+            VerifyOrReturnValue(UserStatusEnum::kAvailable != userInfo.userStatus, false);
+
+            userIndex       = foundUserIndex;
+            credentialIndex = foundCredentialIndex;
+            return true;
+        }
+    }
+
     uint16_t maxNumberOfUsers = 0;
     VerifyOrReturnError(GetAttribute(endpointId, Attributes::NumberOfTotalUsersSupported::Id,
                                      Attributes::NumberOfTotalUsersSupported::Get, maxNumberOfUsers),
@@ -20,6 +20,8 @@
 #include <app/AttributeAccessInterface.h>
 #include <app/AttributeAccessInterfaceRegistry.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace app {
 namespace Clusters {
@@ -156,7 +158,8 @@ std::unique_ptr<EcosystemDeviceStruct> EcosystemDeviceStruct::Builder::Build()
     return ret;
 }
 
-CHIP_ERROR EcosystemDeviceStruct::Encode(const AttributeValueEncoder::ListEncodeHelper & aEncoder)
+CHIP_ERROR EcosystemDeviceStruct::Encode(const AttributeValueEncoder::ResumableListEncodeHelper & aEncoder,
+                                         uint32_t aNextCursor) const
 {
     Structs::EcosystemDeviceStruct::Type deviceStruct;
     if (!mDeviceName.empty())
@@ -168,18 +171,12 @@ CHIP_ERROR EcosystemDeviceStruct::Encode(const AttributeValueEncoder::ListEncode
     deviceStruct.bridgedEndpoint  = mBridgedEndpoint;
     deviceStruct.originalEndpoint = mOriginalEndpoint;
     deviceStruct.deviceTypes = DataModel::List<const Structs::DeviceTypeStruct::Type>(mDeviceTypes.data(), mDeviceTypes.size());
-
-    std::vector<CharSpan> locationIds;
-    locationIds.reserve(mUniqueLocationIds.size());
-    for (auto & id : mUniqueLocationIds)
-    {
-        locationIds.push_back(CharSpan(id.c_str(), id.size()));
-    }
-    deviceStruct.uniqueLocationIDs = DataModel::List<CharSpan>(locationIds.data(), locationIds.size());
+    deviceStruct.uniqueLocationIDs =
+        DataModel::List<const CharSpan>(mUniqueLocationIdSpans.data(), mUniqueLocationIdSpans.size());
 
     deviceStruct.uniqueLocationIDsLastEdit = mUniqueLocationIdsLastEditEpochUs;
     deviceStruct.SetFabricIndex(mFabricIndex);
-    return aEncoder.Encode(deviceStruct);
+    return aEncoder.Encode(aNextCursor, deviceStruct);
 }
 
 EcosystemLocationStruct::Builder & EcosystemLocationStruct::Builder::SetLocationName(std::string aLocationName)
@@ -228,15 +225,16 @@ std::unique_ptr<EcosystemLocationStruct> EcosystemLocationStruct::Builder::Build
     return ret;
 }
 
-CHIP_ERROR EcosystemLocationStruct::Encode(const AttributeValueEncoder::ListEncodeHelper & aEncoder,
-                                           const std::string & aUniqueLocationId, const FabricIndex & aFabricIndex)
+CHIP_ERROR EcosystemLocationStruct::Encode(const AttributeValueEncoder::ResumableListEncodeHelper & aEncoder,
+                                           uint32_t aNextCursor, const std::string & aUniqueLocationId,
+                                           const FabricIndex & aFabricIndex) const
 {
     Structs::EcosystemLocationStruct::Type locationStruct;
     locationStruct.uniqueLocationID           = CharSpan(aUniqueLocationId.c_str(), aUniqueLocationId.size());
     locationStruct.locationDescriptor         = GetEncodableLocationDescriptorStruct(mLocationDescriptor);
     locationStruct.locationDescriptorLastEdit = mLocationDescriptorLastEditEpochUs;
     locationStruct.SetFabricIndex(aFabricIndex);
-    return aEncoder.Encode(locationStruct);
+    return aEncoder.Encode(aNextCursor, locationStruct);
 }
 
 EcosystemInformationServer EcosystemInformationServer::mInstance;
@@ -278,11 +276,14 @@ CHIP_ERROR EcosystemInformationServer::AddLocationInfo(EndpointId aEndpoint, con
     VerifyOrReturnError(aFabricIndex >= kMinValidFabricIndex, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(aFabricIndex <= kMaxValidFabricIndex, CHIP_ERROR_INVALID_ARGUMENT);
 
-    auto & deviceInfo        = mDevicesMap[aEndpoint];
+    auto & locationDirectory = mDevicesMap[aEndpoint].mLocationDirectory;
     EcosystemLocationKey key = { .mUniqueLocationId = aLocationId, .mFabricIndex = aFabricIndex };
-    VerifyOrReturnError((deviceInfo.mLocationDirectory.find(key) == deviceInfo.mLocationDirectory.end()),
-                        CHIP_ERROR_INVALID_ARGUMENT);
-    deviceInfo.mLocationDirectory[key] = std::move(aLocation);
+    auto keyLess             = [](const LocationDirectoryEntry & entry, const EcosystemLocationKey & other) {
+        return entry.first < other;
+    };
+    auto position = std::lower_bound(locationDirectory.begin(), locationDirectory.end(), key, keyLess);
+    VerifyOrReturnError((position == locationDirectory.end() || key < position->first), CHIP_ERROR_INVALID_ARGUMENT);
+    locationDirectory.emplace(position, std::move(key), std::move(aLocation));
     mMatterContext.MarkDirty(aEndpoint, Attributes::LocationDirectory::Id);
     return CHIP_NO_ERROR;
 }
@@ -327,10 +328,11 @@ CHIP_ERROR EcosystemInformationServer::EncodeDeviceDirectoryAttribute(EndpointId
         return aEncoder.EncodeEmptyList();
     }
 
-    return aEncoder.EncodeList([&](const auto & encoder) -> CHIP_ERROR {
-        for (auto & device : deviceInfo.mDeviceDirectory)
+    // The cursor is the index of the next device to encode.
+    return aEncoder.EncodeResumableList([&](const auto & encoder, uint32_t cursor) -> CHIP_ERROR {
+        for (size_t i = cursor; i < deviceInfo.mDeviceDirectory.size(); i++)
         {
-            ReturnErrorOnFailure(device->Encode(encoder));
+            ReturnErrorOnFailure(deviceInfo.mDeviceDirectory[i]->Encode(encoder, static_cast<uint32_t>(i + 1)));
         }
         return CHIP_NO_ERROR;
     });
@@ -353,14 +355,15 @@ CHIP_ERROR EcosystemInformationServer::EncodeLocationStructAttribute(EndpointId
         return aEncoder.EncodeEmptyList();
     }
 
-    return aEncoder.EncodeList([&](const auto & encoder) -> CHIP_ERROR {
-        for (auto & [key, device] : deviceInfo.mLocationDirectory)
+    // The cursor is the index of the next location to encode.
+    return aEncoder.EncodeResumableList([&](const auto & encoder, uint32_t cursor) -> CHIP_ERROR {
+        for (size_t i = cursor; i < deviceInfo.mLocationDirectory.size(); i++)
         {
-            ReturnErrorOnFailure(device->Encode(encoder, key.mUniqueLocationId, key.mFabricIndex));
+            auto & [key, location] = deviceInfo.mLocationDirectory[i];
+            ReturnErrorOnFailure(location->Encode(encoder, static_cast<uint32_t>(i + 1), key.mUniqueLocationId, key.mFabricIndex));
         }
         return CHIP_NO_ERROR;
     });
-    return CHIP_NO_ERROR;
 }
 
 } // namespace EcosystemInformation
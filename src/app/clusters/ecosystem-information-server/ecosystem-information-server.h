@@ -84,7 +84,8 @@ public:
         bool mIsAlreadyBuilt                       = false;
     };
 
-    CHIP_ERROR Encode(const AttributeValueEncoder::ListEncodeHelper & aEncoder);
+    /// aNextCursor is the cursor of the device that follows this one in the device directory.
+    CHIP_ERROR Encode(const AttributeValueEncoder::ResumableListEncodeHelper & aEncoder, uint32_t aNextCursor) const;
 
 private:
     // Constructor is intentionally private. This is to ensure that it is only constructed with
@@ -99,14 +100,22 @@ private:
         mUniqueLocationIds(std::move(aUniqueLocationIds)), mUniqueLocationIdsLastEditEpochUs(aUniqueLocationIdsLastEditEpochUs),
         mFabricIndex(aFabricIndex)
 
-    {}
+    {
+        // The location ids are never modified once built: their spans are made once rather than on every read.
+        mUniqueLocationIdSpans.reserve(mUniqueLocationIds.size());
+        for (auto & id : mUniqueLocationIds)
+        {
+            mUniqueLocationIdSpans.push_back(CharSpan(id.c_str(), id.size()));
+        }
+    }
 
     const std::string mDeviceName;
     uint64_t mDeviceNameLastEditEpochUs;
     EndpointId mBridgedEndpoint;
     EndpointId mOriginalEndpoint;
     std::vector<Structs::DeviceTypeStruct::Type> mDeviceTypes;
-    std::vector<std::string> mUniqueLocationIds;
+    const std::vector<std::string> mUniqueLocationIds;
+    std::vector<CharSpan> mUniqueLocationIdSpans;
     uint64_t mUniqueLocationIdsLastEditEpochUs;
     FabricIndex mFabricIndex;
 };
@@ -143,8 +152,9 @@ public:
         bool mIsAlreadyBuilt                        = false;
     };
 
-    CHIP_ERROR Encode(const AttributeValueEncoder::ListEncodeHelper & aEncoder, const std::string & aUniqueLocationId,
-                      const FabricIndex & aFabricIndex);
+    /// aNextCursor is the cursor of the location that follows this one in the location directory.
+    CHIP_ERROR Encode(const AttributeValueEncoder::ResumableListEncodeHelper & aEncoder, uint32_t aNextCursor,
+                      const std::string & aUniqueLocationId, const FabricIndex & aFabricIndex) const;
 
 private:
     // Constructor is intentionally private. This is to ensure that it is only constructed with
@@ -222,10 +232,16 @@ private:
         FabricIndex mFabricIndex;
     };
 
+    using LocationDirectoryEntry = std::pair<EcosystemLocationKey, std::unique_ptr<EcosystemLocationStruct>>;
+
+    // The directories are vectors so that a chunked read resumes encoding a list at the index where the previous chunk
+    // stopped, instead of encoding again the entries encoded in the previous chunks to skip them.
     struct DeviceInfo
     {
+        // In the order the devices were added.
         std::vector<std::unique_ptr<EcosystemDeviceStruct>> mDeviceDirectory;
-        std::map<EcosystemLocationKey, std::unique_ptr<EcosystemLocationStruct>> mLocationDirectory;
+        // Sorted by key.
+        std::vector<LocationDirectoryEntry> mLocationDirectory;
     };
 
     CHIP_ERROR EncodeDeviceDirectoryAttribute(EndpointId aEndpoint, AttributeValueEncoder & aEncoder);
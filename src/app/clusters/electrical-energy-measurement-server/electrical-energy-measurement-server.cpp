@@ -25,6 +25,7 @@
 #include <app/reporting/reporting.h>
 #include <app/util/attribute-storage.h>
 #include <app/util/config.h>
+#include <system/SystemClock.h>
 #include <zap-generated/gen_config.h>
 
 using chip::Protocols::InteractionModel::Status;
@@ -41,6 +42,26 @@ using namespace chip::app::Clusters::ElectricalEnergyMeasurement::Structs;
 MeasurementData gMeasurements[MATTER_DM_ELECTRICAL_ENERGY_MEASUREMENT_CLUSTER_SERVER_ENDPOINT_COUNT +
                               CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT];
 
+namespace {
+
+void UpdateEnergyReporting(EndpointId endpointId, MeasurementData & data, EnergyAttributeIndex index, AttributeId attributeId,
+                           const Optional<EnergyMeasurementStruct::Type> & energy)
+{
+    DataModel::Nullable<int64_t> energyValue;
+    if (energy.HasValue())
+    {
+        energyValue.SetNonNull(energy.Value().energy);
+    }
+
+    if (data.energyReporting.SetValue(to_underlying(index), energyValue, System::SystemClock().GetMonotonicTimestamp()) ==
+        AttributeDirtyState::kMustReport)
+    {
+        MatterReportingAttributeChangeCallback(endpointId, ElectricalEnergyMeasurement::Id, attributeId);
+    }
+}
+
+} // namespace
+
 CHIP_ERROR ElectricalEnergyMeasurementAttrAccess::Init()
 {
     VerifyOrReturnError(AttributeAccessInterfaceRegistry::Instance().Register(this), CHIP_ERROR_INCORRECT_STATE);
@@ -161,6 +182,19 @@ MeasurementData * MeasurementDataForEndpoint(EndpointId endpointId)
     return &gMeasurements[index];
 }
 
+CHIP_ERROR SetEnergyReportingDeadband(EndpointId endpointId, const QuieterReportingDeadband<int64_t> & deadband)
+{
+    MeasurementData * data = MeasurementDataForEndpoint(endpointId);
+    VerifyOrReturnError(data != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    for (size_t i = 0; i < data->energyReporting.Size(); i++)
+    {
+        data->energyReporting.SetDeadband(i, deadband);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR SetMeasurementAccuracy(EndpointId endpointId, const MeasurementAccuracyStruct::Type & accuracy)
 {
 
@@ -195,6 +229,10 @@ bool NotifyCumulativeEnergyMeasured(EndpointId endpointId, const Optional<Energy
     {
         data->cumulativeImported = energyImported;
         data->cumulativeExported = energyExported;
+        UpdateEnergyReporting(endpointId, *data, EnergyAttributeIndex::kCumulativeImported, CumulativeEnergyImported::Id,
+                              energyImported);
+        UpdateEnergyReporting(endpointId, *data, EnergyAttributeIndex::kCumulativeExported, CumulativeEnergyExported::Id,
+                              energyExported);
     }
 
     Events::CumulativeEnergyMeasured::Type event;
@@ -224,6 +262,10 @@ bool NotifyPeriodicEnergyMeasured(EndpointId endpointId, const Optional<EnergyMe
     {
         data->periodicImported = energyImported;
         data->periodicExported = energyExported;
+        UpdateEnergyReporting(endpointId, *data, EnergyAttributeIndex::kPeriodicImported, PeriodicEnergyImported::Id,
+                              energyImported);
+        UpdateEnergyReporting(endpointId, *data, EnergyAttributeIndex::kPeriodicExported, PeriodicEnergyExported::Id,
+                              energyExported);
     }
 
     Events::PeriodicEnergyMeasured::Type event;
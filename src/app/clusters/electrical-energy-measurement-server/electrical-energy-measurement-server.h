@@ -18,15 +18,27 @@
 #pragma once
 
 #include <lib/core/Optional.h>
+#include <lib/support/TypeTraits.h>
 
 #include <app-common/zap-generated/cluster-objects.h>
 #include <app/AttributeAccessInterface.h>
+#include <app/cluster-building-blocks/QuieterReporting.h>
 
 namespace chip {
 namespace app {
 namespace Clusters {
 namespace ElectricalEnergyMeasurement {
 
+// Index of the energy attributes in the reporting state of MeasurementData
+enum class EnergyAttributeIndex : uint8_t
+{
+    kCumulativeImported = 0,
+    kCumulativeExported,
+    kPeriodicImported,
+    kPeriodicExported,
+    kCount,
+};
+
 struct MeasurementData
 {
     Structs::MeasurementAccuracyStruct::Type measurementAccuracy;
@@ -35,6 +47,9 @@ struct MeasurementData
     Optional<Structs::EnergyMeasurementStruct::Type> periodicImported;
     Optional<Structs::EnergyMeasurementStruct::Type> periodicExported;
     Optional<Structs::CumulativeEnergyResetStruct::Type> cumulativeReset;
+
+    // Energy, in mWh, last reported for each of the energy attributes
+    QuieterReportingAttributeSet<int64_t, to_underlying(EnergyAttributeIndex::kCount)> energyReporting;
 };
 
 enum class OptionalAttributes : uint32_t
@@ -71,6 +86,12 @@ bool NotifyCumulativeEnergyMeasured(EndpointId endpointId, const Optional<Struct
 bool NotifyPeriodicEnergyMeasured(EndpointId endpointId, const Optional<Structs::EnergyMeasurementStruct::Type> & energyImported,
                                   const Optional<Structs::EnergyMeasurementStruct::Type> & energyExported);
 
+/**
+ * @brief Sets the deadband of the energy attributes of an endpoint: the energy measured by NotifyCumulativeEnergyMeasured and
+ *        NotifyPeriodicEnergyMeasured is only reported once its change is significant. Every change is reported by default.
+ */
+CHIP_ERROR SetEnergyReportingDeadband(EndpointId endpointId, const QuieterReportingDeadband<int64_t> & deadband);
+
 CHIP_ERROR SetMeasurementAccuracy(EndpointId endpointId, const Structs::MeasurementAccuracyStruct::Type & accuracy);
 
 CHIP_ERROR SetCumulativeReset(EndpointId endpointId, const Optional<Structs::CumulativeEnergyResetStruct::Type> & cumulativeReset);
@@ -24,6 +24,7 @@
 #include <app/EventLogging.h>
 #include <app/reporting/reporting.h>
 #include <app/util/attribute-storage.h>
+#include <system/SystemClock.h>
 
 using namespace chip;
 using namespace chip::app;
@@ -40,6 +41,38 @@ namespace app {
 namespace Clusters {
 namespace ElectricalPowerMeasurement {
 
+namespace {
+
+// Optional attribute flag of the mandatory attributes
+constexpr OptionalAttributes kMandatoryAttribute = static_cast<OptionalAttributes>(0);
+
+struct MeasuredAttribute
+{
+    AttributeId id;
+    OptionalAttributes optionalAttribute;
+    DataModel::Nullable<int64_t> (Delegate::*get)();
+};
+
+constexpr MeasuredAttribute kMeasuredAttributes[] = {
+    { Voltage::Id, OptionalAttributes::kOptionalAttributeVoltage, &Delegate::GetVoltage },
+    { ActiveCurrent::Id, OptionalAttributes::kOptionalAttributeActiveCurrent, &Delegate::GetActiveCurrent },
+    { ReactiveCurrent::Id, OptionalAttributes::kOptionalAttributeReactiveCurrent, &Delegate::GetReactiveCurrent },
+    { ApparentCurrent::Id, OptionalAttributes::kOptionalAttributeApparentCurrent, &Delegate::GetApparentCurrent },
+    { ActivePower::Id, kMandatoryAttribute, &Delegate::GetActivePower },
+    { ReactivePower::Id, OptionalAttributes::kOptionalAttributeReactivePower, &Delegate::GetReactivePower },
+    { ApparentPower::Id, OptionalAttributes::kOptionalAttributeApparentPower, &Delegate::GetApparentPower },
+    { RMSVoltage::Id, OptionalAttributes::kOptionalAttributeRMSVoltage, &Delegate::GetRMSVoltage },
+    { RMSCurrent::Id, OptionalAttributes::kOptionalAttributeRMSCurrent, &Delegate::GetRMSCurrent },
+    { RMSPower::Id, OptionalAttributes::kOptionalAttributeRMSPower, &Delegate::GetRMSPower },
+    { Frequency::Id, OptionalAttributes::kOptionalAttributeFrequency, &Delegate::GetFrequency },
+    { PowerFactor::Id, OptionalAttributes::kOptionalAttributePowerFactor, &Delegate::GetPowerFactor },
+    { NeutralCurrent::Id, OptionalAttributes::kOptionalAttributeNeutralCurrent, &Delegate::GetNeutralCurrent },
+};
+
+static_assert(ArraySize(kMeasuredAttributes) == Instance::kMeasuredAttributeCount, "Unexpected number of measured attributes");
+
+} // namespace
+
 CHIP_ERROR Instance::Init()
 {
     VerifyOrReturnError(AttributeAccessInterfaceRegistry::Instance().Register(this), CHIP_ERROR_INCORRECT_STATE);
@@ -61,6 +94,39 @@ bool Instance::SupportsOptAttr(OptionalAttributes aOptionalAttrs) const
     return mOptionalAttrs.Has(aOptionalAttrs);
 }
 
+CHIP_ERROR Instance::SetReportingDeadband(AttributeId aAttributeId, const QuieterReportingDeadband<int64_t> & aDeadband)
+{
+    for (size_t i = 0; i < ArraySize(kMeasuredAttributes); i++)
+    {
+        if (kMeasuredAttributes[i].id == aAttributeId)
+        {
+            mReporting.SetDeadband(i, aDeadband);
+            return CHIP_NO_ERROR;
+        }
+    }
+    return CHIP_ERROR_INVALID_ARGUMENT;
+}
+
+void Instance::NotifyMeasurementsChanged()
+{
+    const EndpointId endpointId        = GetEndpointId().Value();
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+
+    for (size_t i = 0; i < ArraySize(kMeasuredAttributes); i++)
+    {
+        const MeasuredAttribute & attribute = kMeasuredAttributes[i];
+        if (attribute.optionalAttribute != kMandatoryAttribute && !SupportsOptAttr(attribute.optionalAttribute))
+        {
+            continue;
+        }
+
+        if (mReporting.SetValue(i, (mDelegate.*attribute.get)(), now) == AttributeDirtyState::kMustReport)
+        {
+            MatterReportingAttributeChangeCallback(endpointId, ElectricalPowerMeasurement::Id, attribute.id);
+        }
+    }
+}
+
 // AttributeAccessInterface
 CHIP_ERROR Instance::Read(const ConcreteReadAttributePath & aPath, AttributeValueEncoder & aEncoder)
 {
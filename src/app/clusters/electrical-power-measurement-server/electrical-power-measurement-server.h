@@ -21,6 +21,7 @@
 
 #include <app-common/zap-generated/cluster-objects.h>
 #include <app/AttributeAccessInterface.h>
+#include <app/cluster-building-blocks/QuieterReporting.h>
 #include <protocols/interaction_model/StatusCode.h>
 
 namespace chip {
@@ -114,11 +115,30 @@ public:
     bool HasFeature(Feature aFeature) const;
     bool SupportsOptAttr(OptionalAttributes aOptionalAttrs) const;
 
+    /**
+     * @brief Sets the deadband of a measured attribute (Voltage, ActivePower, ...): its changes are only reported by
+     *        NotifyMeasurementsChanged once significant. Every change is reported by default.
+     *
+     * @return CHIP_ERROR_INVALID_ARGUMENT if aAttributeId is not a measured attribute
+     */
+    CHIP_ERROR SetReportingDeadband(AttributeId aAttributeId, const QuieterReportingDeadband<int64_t> & aDeadband);
+
+    /**
+     * @brief Called by the delegate once it updated its measurements, instead of reporting each of them: the measured
+     *        attributes are read from the delegate, and those whose change is significant are marked dirty.
+     */
+    void NotifyMeasurementsChanged();
+
+    static constexpr size_t kMeasuredAttributeCount = 13;
+
 private:
     Delegate & mDelegate;
     BitMask<Feature> mFeature;
     BitMask<OptionalAttributes> mOptionalAttrs;
 
+    // Last reported state of the measured attributes, in the order of the table of measured attributes
+    QuieterReportingAttributeSet<int64_t, kMeasuredAttributeCount> mReporting;
+
     // AttributeAccessInterface
     CHIP_ERROR Read(const ConcreteReadAttributePath & aPath, AttributeValueEncoder & aEncoder) override;
 
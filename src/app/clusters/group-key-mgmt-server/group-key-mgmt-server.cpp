@@ -40,6 +40,25 @@ using chip::Protocols::InteractionModel::Status;
 
 namespace {
 
+// Cursors of resumable list encoding for lists of per-fabric entries: the fabric index above the position of the entry in its
+// fabric.
+constexpr uint32_t kFabricEntryCursorIndexBits = 24;
+
+constexpr uint32_t FabricEntryCursor(FabricIndex fabric, size_t index)
+{
+    return (static_cast<uint32_t>(fabric) << kFabricEntryCursorIndexBits) | static_cast<uint32_t>(index);
+}
+
+constexpr FabricIndex FabricEntryCursorFabric(uint32_t cursor)
+{
+    return static_cast<FabricIndex>(cursor >> kFabricEntryCursorIndexBits);
+}
+
+constexpr size_t FabricEntryCursorIndex(uint32_t cursor)
+{
+    return cursor & ((1u << kFabricEntryCursorIndexBits) - 1);
+}
+
 struct GroupTableCodec
 {
     static constexpr TLV::Tag TagFabric()
@@ -166,24 +185,45 @@ private:
         auto provider = GetGroupDataProvider();
         VerifyOrReturnError(nullptr != provider, CHIP_ERROR_INTERNAL);
 
-        CHIP_ERROR err = aEncoder.EncodeList([provider](const auto & encoder) -> CHIP_ERROR {
+        CHIP_ERROR err = aEncoder.EncodeResumableList([provider](const auto & encoder, uint32_t cursor) -> CHIP_ERROR {
+            // When resuming a chunked list, the fabrics before the one of the cursor were encoded entirely in previous chunks.
+            bool resumed = (cursor == 0);
             for (auto & fabric : Server::GetInstance().GetFabricTable())
             {
                 auto fabric_index = fabric.GetFabricIndex();
-                auto iter         = provider->IterateGroupKeys(fabric_index);
+                size_t skip       = 0;
+                if (!resumed)
+                {
+                    if (fabric_index != FabricEntryCursorFabric(cursor))
+                    {
+                        continue;
+                    }
+                    resumed = true;
+                    skip    = FabricEntryCursorIndex(cursor);
+                }
+
+                auto iter = provider->IterateGroupKeys(fabric_index);
                 VerifyOrReturnError(nullptr != iter, CHIP_ERROR_NO_MEMORY);
 
+                CHIP_ERROR encodeErr = CHIP_NO_ERROR;
+                size_t index         = 0;
                 GroupDataProvider::GroupKey mapping;
-                while (iter->Next(mapping))
+                while (encodeErr == CHIP_NO_ERROR && iter->Next(mapping))
                 {
+                    // The iterator cannot seek, but skipping entries is much cheaper than encoding them.
+                    if (index++ < skip)
+                    {
+                        continue;
+                    }
                     GroupKeyManagement::Structs::GroupKeyMapStruct::Type key = {
                         .groupId       = mapping.group_id,
                         .groupKeySetID = mapping.keyset_id,
                         .fabricIndex   = fabric_index,
                     };
-                    encoder.Encode(key);
+                    encodeErr = encoder.Encode(FabricEntryCursor(fabric_index, index), key);
                 }
                 iter->Release();
+                ReturnErrorOnFailure(encodeErr);
             }
             return CHIP_NO_ERROR;
         });
@@ -254,19 +294,41 @@ private:
         auto provider = GetGroupDataProvider();
         VerifyOrReturnError(nullptr != provider, CHIP_ERROR_INTERNAL);
 
-        CHIP_ERROR err = aEncoder.EncodeList([provider](const auto & encoder) -> CHIP_ERROR {
+        CHIP_ERROR err = aEncoder.EncodeResumableList([provider](const auto & encoder, uint32_t cursor) -> CHIP_ERROR {
+            // When resuming a chunked list, the fabrics before the one of the cursor were encoded entirely in previous chunks.
+            bool resumed = (cursor == 0);
             for (auto & fabric : Server::GetInstance().GetFabricTable())
             {
                 auto fabric_index = fabric.GetFabricIndex();
-                auto iter         = provider->IterateGroupInfo(fabric_index);
+                size_t skip       = 0;
+                if (!resumed)
+                {
+                    if (fabric_index != FabricEntryCursorFabric(cursor))
+                    {
+                        continue;
+                    }
+                    resumed = true;
+                    skip    = FabricEntryCursorIndex(cursor);
+                }
+
+                auto iter = provider->IterateGroupInfo(fabric_index);
                 VerifyOrReturnError(nullptr != iter, CHIP_ERROR_NO_MEMORY);
 
+                CHIP_ERROR encodeErr = CHIP_NO_ERROR;
+                size_t index         = 0;
                 GroupDataProvider::GroupInfo info;
-                while (iter->Next(info))
+                while (encodeErr == CHIP_NO_ERROR && iter->Next(info))
                 {
-                    encoder.Encode(GroupTableCodec(provider, fabric_index, info));
+                    // Skipping groups does not look up their endpoints, which encoding them does.
+                    if (index++ < skip)
+                    {
+                        continue;
+                    }
+                    encodeErr =
+                        encoder.Encode(FabricEntryCursor(fabric_index, index), GroupTableCodec(provider, fabric_index, info));
                 }
                 iter->Release();
+                ReturnErrorOnFailure(encodeErr);
             }
             return CHIP_NO_ERROR;
         });
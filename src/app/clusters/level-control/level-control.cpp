@@ -26,6 +26,7 @@
 #include <app/CommandHandler.h>
 #include <app/ConcreteCommandPath.h>
 #include <app/cluster-building-blocks/QuieterReporting.h>
+#include <app/util/TransitionTickScheduler.h>
 #include <app/util/attribute-storage.h>
 #include <app/util/config.h>
 #include <app/util/util.h>
@@ -277,7 +278,9 @@ static void reallyUpdateCoupledColorTemp(EndpointId endpoint);
 
 void emberAfLevelControlClusterServerTickCallback(EndpointId endpoint);
 
-static void timerCallback(System::Layer *, void * callbackContext)
+static TransitionTickScheduler::Tick transitionTicks[kLevelControlStateTableSize];
+
+static void timerCallback(void * callbackContext)
 {
     emberAfLevelControlClusterServerTickCallback(static_cast<EndpointId>(reinterpret_cast<uintptr_t>(callbackContext)));
 }
@@ -286,7 +289,7 @@ static uint32_t computeCallbackWaitTimeMs(CallbackScheduleState & callbackSchedu
 {
     auto delay             = System::Clock::Milliseconds32(delayMs);
     auto waitTime          = delay;
-    const auto currentTime = System::SystemClock().GetMonotonicTimestamp();
+    const auto currentTime = TransitionTickScheduler::Instance().Now();
 
     // Subsequent call
     if (callbackSchedule.runTime.count())
@@ -324,8 +327,12 @@ static uint32_t computeCallbackWaitTimeMs(CallbackScheduleState & callbackSchedu
 
 static void scheduleTimerCallbackMs(EndpointId endpoint, uint32_t delayMs)
 {
-    CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(chip::System::Clock::Milliseconds32(delayMs), timerCallback,
-                                                           reinterpret_cast<void *>(static_cast<uintptr_t>(endpoint)));
+    EmberAfLevelControlState * state = getState(endpoint);
+    VerifyOrReturn(state != nullptr);
+
+    CHIP_ERROR err = TransitionTickScheduler::Instance().Schedule(transitionTicks[state - stateTable], timerCallback,
+                                                                  reinterpret_cast<void *>(static_cast<uintptr_t>(endpoint)),
+                                                                  chip::System::Clock::Milliseconds32(delayMs));
 
     if (err != CHIP_NO_ERROR)
     {
@@ -335,7 +342,10 @@ static void scheduleTimerCallbackMs(EndpointId endpoint, uint32_t delayMs)
 
 static void cancelEndpointTimerCallback(EndpointId endpoint)
 {
-    DeviceLayer::SystemLayer().CancelTimer(timerCallback, reinterpret_cast<void *>(static_cast<uintptr_t>(endpoint)));
+    EmberAfLevelControlState * state = getState(endpoint);
+    VerifyOrReturn(state != nullptr);
+
+    TransitionTickScheduler::Instance().Cancel(transitionTicks[state - stateTable]);
 }
 
 static EmberAfLevelControlState * getState(EndpointId endpoint)
@@ -33,7 +33,6 @@
 #include <credentials/CHIPCert.h>
 #include <lib/core/CHIPConfig.h>
 #include <lib/support/SafeInt.h>
-#include <lib/support/SortUtils.h>
 #include <lib/support/ThreadOperationalDataset.h>
 #include <platform/CHIPDeviceConfig.h>
 #include <platform/ConnectivityManager.h>
@@ -56,9 +55,77 @@ using namespace DeviceLayer::NetworkCommissioning;
 
 namespace {
 
-// For WiFi and Thread scan results, each item will cost ~60 bytes in TLV, thus 15 is a safe upper bound of scan results.
 #if CHIP_DEVICE_CONFIG_ENABLE_WIFI_STATION || CHIP_DEVICE_CONFIG_ENABLE_WIFI_AP || CHIP_DEVICE_CONFIG_ENABLE_THREAD
-constexpr size_t kMaxNetworksInScanResponse = 15;
+constexpr size_t kMaxNetworksInScanResponse = CHIP_CONFIG_NETWORK_COMMISSIONING_MAX_SCAN_RESULTS;
+
+// Space kept to close the scan results list and the response structure once the response is full.
+constexpr uint32_t kScanResponseEndSize = 2;
+
+/// Keeps the strongest scan responses delivered by a driver, sorted by decreasing rssi.
+///
+/// Each response is inserted at its position, so that keeping the strongest of n responses costs O(n * capacity) copies at
+/// most, and no more than the capacity is allocated however many networks were found.
+template <typename ScanResponse>
+class StrongestScanResponses
+{
+public:
+    CHIP_ERROR Init(size_t capacity)
+    {
+        VerifyOrReturnError(capacity == 0 || mResponses.Alloc(capacity), CHIP_ERROR_NO_MEMORY);
+        mCapacity = capacity;
+        return CHIP_NO_ERROR;
+    }
+
+    /// Keeps response if it is stronger than the weakest one kept, or if there is still room for it.
+    void Insert(const ScanResponse & response)
+    {
+        if (mCount == mCapacity)
+        {
+            VerifyOrReturn(mCount > 0 && mResponses[mCount - 1].rssi < response.rssi);
+            mCount--;
+        }
+
+        size_t position = mCount;
+        for (; position > 0 && mResponses[position - 1].rssi < response.rssi; position--)
+        {
+            mResponses[position] = mResponses[position - 1];
+        }
+        mResponses[position] = response;
+        mCount++;
+    }
+
+    void Remove(size_t index)
+    {
+        for (mCount--; index < mCount; index++)
+        {
+            mResponses[index] = mResponses[index + 1];
+        }
+    }
+
+    Span<const ScanResponse> Responses() const { return Span<const ScanResponse>(mResponses.Get(), mCount); }
+
+private:
+    Platform::ScopedMemoryBuffer<ScanResponse> mResponses;
+    size_t mCapacity = 0;
+    size_t mCount    = 0;
+};
+
+/// Encodes a scan result in the list of results, unless the response has no room left for it: the results that do not fit
+/// in the response are dropped, and `encoded` set to false.
+template <typename ScanResult>
+CHIP_ERROR EncodeScanResult(TLV::TLVWriter & writer, const ScanResult & result, bool & encoded)
+{
+    TLV::TLVWriter checkpoint = writer;
+
+    CHIP_ERROR err = DataModel::Encode(writer, TLV::AnonymousTag(), result);
+    encoded        = (err == CHIP_NO_ERROR);
+    if (err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL)
+    {
+        writer = checkpoint;
+        return CHIP_NO_ERROR;
+    }
+    return err;
+}
 #endif
 
 constexpr uint16_t kCurrentClusterRevision = 2;
@@ -154,6 +221,12 @@ private:
     Status mStatus;
     CharSpan mDebugText;
     WiFiScanResponseIterator * mNetworks;
+
+    /// Encodes the strongest networks of mNetworks, as many as fit in the response.
+    CHIP_ERROR EncodeNetworks(TLV::TLVWriter & writer) const;
+
+    /// The result refers to the ssid and bssid of response, it is only valid as long as response is.
+    static Structs::WiFiInterfaceScanResultStruct::Type ToScanResult(const WiFiScanResponse & response);
 };
 
 CHIP_ERROR WifiScanResponseToTLV::EncodeTo(TLV::TLVWriter & writer, TLV::Tag tag) const
@@ -172,36 +245,62 @@ CHIP_ERROR WifiScanResponseToTLV::EncodeTo(TLV::TLVWriter & writer, TLV::Tag tag
         TLV::TLVType listContainerType;
         ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(Commands::ScanNetworksResponse::Fields::kWiFiScanResults),
                                                    TLV::kTLVType_Array, listContainerType));
+        ReturnErrorOnFailure(writer.ReserveBuffer(kScanResponseEndSize));
 
         if ((mStatus == Status::kSuccess) && (mNetworks != nullptr))
         {
-            WiFiScanResponse scanResponse;
-            size_t networksEncoded = 0;
-            while (mNetworks->Next(scanResponse))
-            {
-                Structs::WiFiInterfaceScanResultStruct::Type result;
-                result.security = scanResponse.security;
-                result.ssid     = ByteSpan(scanResponse.ssid, scanResponse.ssidLen);
-                result.bssid    = ByteSpan(scanResponse.bssid, sizeof(scanResponse.bssid));
-                result.channel  = scanResponse.channel;
-                result.wiFiBand = scanResponse.wiFiBand;
-                result.rssi     = scanResponse.rssi;
-                ReturnErrorOnFailure(DataModel::Encode(writer, TLV::AnonymousTag(), result));
-
-                ++networksEncoded;
-                if (networksEncoded >= kMaxNetworksInScanResponse)
-                {
-                    break;
-                }
-            }
+            ReturnErrorOnFailure(EncodeNetworks(writer));
         }
 
+        ReturnErrorOnFailure(writer.UnreserveBuffer(kScanResponseEndSize));
         ReturnErrorOnFailure(writer.EndContainer(listContainerType));
     }
 
     return writer.EndContainer(outerType);
 }
 
+CHIP_ERROR WifiScanResponseToTLV::EncodeNetworks(TLV::TLVWriter & writer) const
+{
+    WiFiScanResponse scanResponse;
+    bool encoded = true;
+
+    // When all the networks found fit in the response, they are encoded as the driver delivers them.
+    if (mNetworks->Count() <= kMaxNetworksInScanResponse)
+    {
+        while (encoded && mNetworks->Next(scanResponse))
+        {
+            ReturnErrorOnFailure(EncodeScanResult(writer, ToScanResult(scanResponse), encoded));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    StrongestScanResponses<WiFiScanResponse> strongestResponses;
+    ReturnErrorOnFailure(strongestResponses.Init(kMaxNetworksInScanResponse));
+    while (mNetworks->Next(scanResponse))
+    {
+        strongestResponses.Insert(scanResponse);
+    }
+
+    for (const WiFiScanResponse & response : strongestResponses.Responses())
+    {
+        ReturnErrorOnFailure(EncodeScanResult(writer, ToScanResult(response), encoded));
+        VerifyOrReturnError(encoded, CHIP_NO_ERROR);
+    }
+    return CHIP_NO_ERROR;
+}
+
+Structs::WiFiInterfaceScanResultStruct::Type WifiScanResponseToTLV::ToScanResult(const WiFiScanResponse & response)
+{
+    Structs::WiFiInterfaceScanResultStruct::Type result;
+    result.security = response.security;
+    result.ssid     = ByteSpan(response.ssid, response.ssidLen);
+    result.bssid    = ByteSpan(response.bssid, sizeof(response.bssid));
+    result.channel  = response.channel;
+    result.wiFiBand = response.wiFiBand;
+    result.rssi     = response.rssi;
+    return result;
+}
+
 #endif // CHIP_DEVICE_CONFIG_ENABLE_WIFI_STATION || CHIP_DEVICE_CONFIG_ENABLE_WIFI_AP
 
 #if CHIP_DEVICE_CONFIG_ENABLE_THREAD
@@ -221,77 +320,47 @@ private:
     CharSpan mDebugText;
     ThreadScanResponseIterator * mNetworks;
 
-    /// Fills up scanResponseArray with valid and de-duplicated thread responses from mNetworks.
-    /// Handles sorting and keeping only larger rssi
-    ///
-    /// Returns the valid list of scan responses into `validResponses`, which is only valid
-    /// as long as scanResponseArray is valid.
-    CHIP_ERROR LoadResponses(Platform::ScopedMemoryBuffer<ThreadScanResponse> & scanResponseArray,
-                             Span<ThreadScanResponse> & validResponses) const;
+    /// Keeps the strongest of the de-duplicated thread responses from mNetworks in strongestResponses.
+    CHIP_ERROR LoadResponses(StrongestScanResponses<ThreadScanResponse> & strongestResponses) const;
 };
 
-CHIP_ERROR ThreadScanResponseToTLV::LoadResponses(Platform::ScopedMemoryBuffer<ThreadScanResponse> & scanResponseArray,
-                                                  Span<ThreadScanResponse> & validResponses) const
+CHIP_ERROR ThreadScanResponseToTLV::LoadResponses(StrongestScanResponses<ThreadScanResponse> & strongestResponses) const
 {
-    VerifyOrReturnError(scanResponseArray.Alloc(std::min(mNetworks->Count(), kMaxNetworksInScanResponse)), CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(mNetworks != nullptr, CHIP_NO_ERROR);
+    ReturnErrorOnFailure(strongestResponses.Init(std::min(mNetworks->Count(), kMaxNetworksInScanResponse)));
 
     ThreadScanResponse scanResponse;
-    size_t scanResponseArrayLength = 0;
-    for (; mNetworks != nullptr && mNetworks->Next(scanResponse);)
+    while (mNetworks->Next(scanResponse))
     {
-        if ((scanResponseArrayLength == kMaxNetworksInScanResponse) &&
-            (scanResponseArray[scanResponseArrayLength - 1].rssi > scanResponse.rssi))
+        // Only the strongest response of each network is kept.
+        bool isDuplicated                         = false;
+        const Span<const ThreadScanResponse> kept = strongestResponses.Responses();
+        for (size_t i = 0; i < kept.size(); i++)
         {
-            continue;
-        }
-
-        bool isDuplicated = false;
-
-        for (size_t i = 0; i < scanResponseArrayLength; i++)
-        {
-            if ((scanResponseArray[i].panId == scanResponse.panId) &&
-                (scanResponseArray[i].extendedPanId == scanResponse.extendedPanId))
+            if ((kept[i].panId == scanResponse.panId) && (kept[i].extendedPanId == scanResponse.extendedPanId))
             {
-                if (scanResponseArray[i].rssi < scanResponse.rssi)
-                {
-                    scanResponseArray[i] = scanResponseArray[--scanResponseArrayLength];
-                }
-                else
+                isDuplicated = (kept[i].rssi >= scanResponse.rssi);
+                if (!isDuplicated)
                 {
-                    isDuplicated = true;
+                    strongestResponses.Remove(i);
                 }
                 break;
             }
         }
 
-        if (isDuplicated)
+        if (!isDuplicated)
         {
-            continue;
+            strongestResponses.Insert(scanResponse);
         }
-
-        if (scanResponseArrayLength < kMaxNetworksInScanResponse)
-        {
-            scanResponseArrayLength++;
-        }
-        scanResponseArray[scanResponseArrayLength - 1] = scanResponse;
-
-        // TODO: this is a sort (insertion sort even, so O(n^2)) in a O(n) loop.
-        ///      There should be some better alternatives to not have some O(n^3) processing complexity.
-        Sorting::InsertionSort(scanResponseArray.Get(), scanResponseArrayLength,
-                               [](const ThreadScanResponse & a, const ThreadScanResponse & b) -> bool { return a.rssi > b.rssi; });
     }
 
-    validResponses = Span<ThreadScanResponse>(scanResponseArray.Get(), scanResponseArrayLength);
-
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR ThreadScanResponseToTLV::EncodeTo(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    Platform::ScopedMemoryBuffer<ThreadScanResponse> responseArray;
-    Span<ThreadScanResponse> responseSpan;
-
-    ReturnErrorOnFailure(LoadResponses(responseArray, responseSpan));
+    StrongestScanResponses<ThreadScanResponse> strongestResponses;
+    ReturnErrorOnFailure(LoadResponses(strongestResponses));
 
     TLV::TLVType outerType;
     ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outerType));
@@ -307,8 +376,9 @@ CHIP_ERROR ThreadScanResponseToTLV::EncodeTo(TLV::TLVWriter & writer, TLV::Tag t
         TLV::TLVType listContainerType;
         ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(Commands::ScanNetworksResponse::Fields::kThreadScanResults),
                                                    TLV::kTLVType_Array, listContainerType));
+        ReturnErrorOnFailure(writer.ReserveBuffer(kScanResponseEndSize));
 
-        for (const ThreadScanResponse & response : responseSpan)
+        for (const ThreadScanResponse & response : strongestResponses.Responses())
         {
             Structs::ThreadInterfaceScanResultStruct::Type result;
             uint8_t extendedAddressBuffer[Thread::kSizeExtendedPanId];
@@ -323,9 +393,15 @@ CHIP_ERROR ThreadScanResponseToTLV::EncodeTo(TLV::TLVWriter & writer, TLV::Tag t
             result.rssi            = response.rssi;
             result.lqi             = response.lqi;
 
-            ReturnErrorOnFailure(DataModel::Encode(writer, TLV::AnonymousTag(), result));
+            bool encoded;
+            ReturnErrorOnFailure(EncodeScanResult(writer, result, encoded));
+            if (!encoded)
+            {
+                break;
+            }
         }
 
+        ReturnErrorOnFailure(writer.UnreserveBuffer(kScanResponseEndSize));
         ReturnErrorOnFailure(writer.EndContainer(listContainerType));
     }
 
@@ -94,7 +94,7 @@ void BDXDownloader::OnMessageReceived(const chip::PayloadHeader & payloadHeader,
 }
 
 CHIP_ERROR BDXDownloader::SetBDXParams(const chip::bdx::TransferSession::TransferInitData & bdxInitData,
-                                       System::Clock::Timeout timeout)
+                                       System::Clock::Timeout timeout, const OTADownloadCheckpoint * resumeFrom)
 {
     mTimeout = timeout;
     mState   = State::kIdle;
@@ -102,14 +102,56 @@ CHIP_ERROR BDXDownloader::SetBDXParams(const chip::bdx::TransferSession::Transfe
 
     VerifyOrReturnError(mState == State::kIdle, CHIP_ERROR_INCORRECT_STATE);
 
+    mInitData                 = bdxInitData;
+    mResuming                 = (resumeFrom != nullptr && resumeFrom->offset > 0);
+    mResumeCheckpoint         = mResuming ? *resumeFrom : OTADownloadCheckpoint();
+    mInitData.StartOffset     = mResumeCheckpoint.offset;
+    mReportedCheckpointOffset = mResumeCheckpoint.offset;
+
     // Must call StartTransfer() here to store the the pointer data contained in bdxInitData in the TransferSession object.
     // Otherwise it could be freed before we can use it.
-    ReturnErrorOnFailure(mBdxTransfer.StartTransfer(chip::bdx::TransferRole::kReceiver, bdxInitData,
+    ReturnErrorOnFailure(mBdxTransfer.StartTransfer(chip::bdx::TransferRole::kReceiver, mInitData,
                                                     /* TODO:(#12520) */ chip::System::Clock::Seconds16(30)));
 
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR BDXDownloader::StartOver()
+{
+    VerifyOrReturnError(mResuming, CHIP_NO_ERROR);
+
+    ChipLogProgress(BDX, "Cannot resume at offset 0x" ChipLogFormatX64 ", downloading from the start",
+                    ChipLogValueX64(mResumeCheckpoint.offset));
+    DiscardCheckpoint();
+
+    mBdxTransfer.Reset();
+    mInitData.StartOffset = 0;
+    return mBdxTransfer.StartTransfer(chip::bdx::TransferRole::kReceiver, mInitData,
+                                      /* TODO:(#12520) */ chip::System::Clock::Seconds16(30));
+}
+
+void BDXDownloader::ReportCheckpoint()
+{
+    OTADownloadCheckpoint checkpoint;
+    VerifyOrReturn(mStateDelegate != nullptr && mImageProcessor->GetDownloadCheckpoint(checkpoint) == CHIP_NO_ERROR);
+
+    // Each checkpoint is a write to persistent storage: only report them every so often.
+    VerifyOrReturn(checkpoint.offset >= mReportedCheckpointOffset + CHIP_CONFIG_OTA_REQUESTOR_DOWNLOAD_CHECKPOINT_INTERVAL);
+    mReportedCheckpointOffset = checkpoint.offset;
+    mStateDelegate->OnDownloadCheckpointChanged(&checkpoint);
+}
+
+void BDXDownloader::DiscardCheckpoint()
+{
+    mResuming                 = false;
+    mResumeCheckpoint         = OTADownloadCheckpoint();
+    mReportedCheckpointOffset = 0;
+    if (mStateDelegate)
+    {
+        mStateDelegate->OnDownloadCheckpointChanged(nullptr);
+    }
+}
+
 CHIP_ERROR BDXDownloader::BeginPrepareDownload()
 {
     VerifyOrReturnError(mState == State::kIdle, CHIP_ERROR_INCORRECT_STATE);
@@ -121,7 +163,13 @@ CHIP_ERROR BDXDownloader::BeginPrepareDownload()
     // anywhere in the range of [mTimeout, 2*mTimeout)
     DeviceLayer::SystemLayer().StartTimer(mTimeout, TransferTimeoutCheckHandler, this);
 
-    ReturnErrorOnFailure(mImageProcessor->PrepareDownload());
+    CHIP_ERROR err = mResuming ? mImageProcessor->PrepareDownloadFrom(mResumeCheckpoint) : CHIP_ERROR_NOT_IMPLEMENTED;
+    if (err == CHIP_ERROR_NOT_IMPLEMENTED)
+    {
+        ReturnErrorOnFailure(StartOver());
+        err = mImageProcessor->PrepareDownload();
+    }
+    ReturnErrorOnFailure(err);
 
     SetState(State::kPreparing, OTAChangeReasonEnum::kSuccess);
 
@@ -139,6 +187,11 @@ CHIP_ERROR BDXDownloader::OnPreparedForDownload(CHIP_ERROR status)
         // Must call here because StartTransfer() should have prepared a ReceiveInit message, and now we should send it.
         PollTransferSession();
     }
+    else if (status == CHIP_ERROR_INTEGRITY_CHECK_FAILED && mResuming && StartOver() == CHIP_NO_ERROR)
+    {
+        // What the image processor kept does not match the checkpoint: prepare again for the whole image.
+        return mImageProcessor->PrepareDownload();
+    }
     else
     {
         ChipLogError(BDX, "failed to prepare download: %" CHIP_ERROR_FORMAT, status.Format());
@@ -169,7 +222,8 @@ void BDXDownloader::OnDownloadTimeout()
         mBdxTransfer.Reset();
         if (mImageProcessor != nullptr)
         {
-            mImageProcessor->Abort();
+            // The download may resume from the last checkpoint.
+            mImageProcessor->Suspend();
         }
         SetState(State::kIdle, OTAChangeReasonEnum::kTimeOut);
     }
@@ -201,6 +255,7 @@ void BDXDownloader::EndDownload(CHIP_ERROR reason)
         {
             mImageProcessor->Abort();
         }
+        DiscardCheckpoint();
 
         // Because AbortTransfer() will generate a StatusReport to send.
         PollTransferSession();
@@ -228,12 +283,21 @@ void BDXDownloader::PollTransferSession()
     } while (outEvent.EventType != TransferSession::OutputEventType::kNone);
 }
 
-void BDXDownloader::CleanupOnError(OTAChangeReasonEnum reason)
+void BDXDownloader::CleanupOnError(OTAChangeReasonEnum reason, bool canResume)
 {
     Reset();
     mBdxTransfer.Reset();
+    if (!canResume)
+    {
+        DiscardCheckpoint();
+    }
     SetState(State::kIdle, reason);
-    if (mImageProcessor)
+    if (mImageProcessor && canResume)
+    {
+        // The download may resume from the last checkpoint after a transfer error.
+        mImageProcessor->Suspend();
+    }
+    else if (mImageProcessor)
     {
         mImageProcessor->Abort();
     }
@@ -248,8 +312,16 @@ CHIP_ERROR BDXDownloader::HandleBdxEvent(const chip::bdx::TransferSession::Outpu
     case TransferSession::OutputEventType::kNone:
         break;
     case TransferSession::OutputEventType::kAcceptReceived:
+        if (mBdxTransfer.GetStartOffset() != mInitData.StartOffset)
+        {
+            // The next attempt downloads from the start; the kInternalError that follows the abort cleans up.
+            ChipLogError(BDX, "Provider did not accept the start offset");
+            DiscardCheckpoint();
+            mBdxTransfer.AbortTransfer(bdx::StatusCode::kStartOffsetNotSupported);
+            break;
+        }
         ReturnErrorOnFailure(mBdxTransfer.PrepareBlockQuery());
-        // TODO: need to check ReceiveAccept parameters
+        // TODO: need to check the other ReceiveAccept parameters
         break;
     case TransferSession::OutputEventType::kMsgToSend: {
         VerifyOrReturnError(mMsgDelegate != nullptr, CHIP_ERROR_INCORRECT_STATE);
@@ -267,6 +339,7 @@ CHIP_ERROR BDXDownloader::HandleBdxEvent(const chip::bdx::TransferSession::Outpu
         chip::ByteSpan blockData(outEvent.blockdata.Data, outEvent.blockdata.Length);
         ReturnErrorOnFailure(mImageProcessor->ProcessBlock(blockData));
         mStateDelegate->OnUpdateProgressChanged(mImageProcessor->GetPercentComplete());
+        ReportCheckpoint();
 
         // TODO: this will cause problems if Finalize() is not guaranteed to do its work after ProcessBlock().
         if (outEvent.blockdata.IsEof)
@@ -279,15 +352,16 @@ CHIP_ERROR BDXDownloader::HandleBdxEvent(const chip::bdx::TransferSession::Outpu
     }
     case TransferSession::OutputEventType::kStatusReceived:
         ChipLogError(BDX, "BDX StatusReport %x", static_cast<uint16_t>(outEvent.statusData.statusCode));
-        CleanupOnError(OTAChangeReasonEnum::kFailure);
+        CleanupOnError(OTAChangeReasonEnum::kFailure,
+                       /* canResume = */ outEvent.statusData.statusCode != bdx::StatusCode::kStartOffsetNotSupported);
         break;
     case TransferSession::OutputEventType::kInternalError:
         ChipLogError(BDX, "TransferSession error");
-        CleanupOnError(OTAChangeReasonEnum::kFailure);
+        CleanupOnError(OTAChangeReasonEnum::kFailure, /* canResume = */ true);
         break;
     case TransferSession::OutputEventType::kTransferTimeout:
         ChipLogError(BDX, "Transfer timed out");
-        CleanupOnError(OTAChangeReasonEnum::kTimeOut);
+        CleanupOnError(OTAChangeReasonEnum::kTimeOut, /* canResume = */ true);
         break;
     case TransferSession::OutputEventType::kInitReceived:
     case TransferSession::OutputEventType::kAckReceived:
@@ -53,7 +53,9 @@ public:
         virtual void OnDownloadStateChanged(State state, app::Clusters::OtaSoftwareUpdateRequestor::OTAChangeReasonEnum reason) = 0;
         // Handle update progress change
         virtual void OnUpdateProgressChanged(app::DataModel::Nullable<uint8_t> percent) = 0;
-        virtual ~StateDelegate()                                                        = default;
+        // Handle a new point from which the download can resume, or nullptr once it can no longer resume
+        virtual void OnDownloadCheckpointChanged(const OTADownloadCheckpoint * checkpoint) {}
+        virtual ~StateDelegate() = default;
     };
 
     // To be called when there is an incoming message to handle (of any protocol type)
@@ -63,7 +65,10 @@ public:
     void SetStateDelegate(StateDelegate * delegate) { mStateDelegate = delegate; }
 
     // Initialize a BDX transfer session but will not proceed until OnPreparedForDownload() is called.
-    CHIP_ERROR SetBDXParams(const chip::bdx::TransferSession::TransferInitData & bdxInitData, System::Clock::Timeout timeout);
+    // If resumeFrom is given, the transfer starts at its offset when the image processor can resume from it, and from the
+    // start of the image otherwise. The data pointed to by bdxInitData must remain valid until the transfer began.
+    CHIP_ERROR SetBDXParams(const chip::bdx::TransferSession::TransferInitData & bdxInitData, System::Clock::Timeout timeout,
+                            const OTADownloadCheckpoint * resumeFrom = nullptr);
 
     // OTADownloader Overrides
     CHIP_ERROR BeginPrepareDownload() override;
@@ -82,10 +87,14 @@ public:
 
 private:
     void PollTransferSession();
-    void CleanupOnError(app::Clusters::OtaSoftwareUpdateRequestor::OTAChangeReasonEnum reason);
+    void CleanupOnError(app::Clusters::OtaSoftwareUpdateRequestor::OTAChangeReasonEnum reason, bool canResume);
     CHIP_ERROR HandleBdxEvent(const chip::bdx::TransferSession::OutputEvent & outEvent);
     void SetState(State state, app::Clusters::OtaSoftwareUpdateRequestor::OTAChangeReasonEnum reason);
     void Reset();
+    // Give up on the checkpoint and restart the transfer from the start of the image.
+    CHIP_ERROR StartOver();
+    void ReportCheckpoint();
+    void DiscardCheckpoint();
 
     chip::bdx::TransferSession mBdxTransfer;
     MessagingDelegate * mMsgDelegate = nullptr;
@@ -94,6 +103,12 @@ private:
     System::Clock::Timeout mTimeout = System::Clock::kZero;
     // Tracks the last block counter used during the transfer session as of the previous check.
     uint32_t mPrevBlockCounter = 0;
+
+    chip::bdx::TransferSession::TransferInitData mInitData;
+    OTADownloadCheckpoint mResumeCheckpoint;
+    bool mResuming = false;
+    // Offset of the last checkpoint reported to the state delegate
+    uint64_t mReportedCheckpointOffset = 0;
 };
 
 } // namespace chip
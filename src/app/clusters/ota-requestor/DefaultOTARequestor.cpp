@@ -32,6 +32,8 @@
 #include "BDXDownloader.h"
 #include "DefaultOTARequestor.h"
 
+#include <algorithm>
+
 namespace chip {
 
 using namespace app;
@@ -625,6 +627,7 @@ void DefaultOTARequestor::OnDownloadStateChanged(OTADownloader::State state, OTA
     switch (state)
     {
     case OTADownloader::State::kComplete:
+        mStorage->ClearDownloadCheckpoint();
         mOtaRequestorDriver->UpdateDownloaded();
         mBdxMessenger.Reset();
         break;
@@ -645,6 +648,16 @@ void DefaultOTARequestor::OnUpdateProgressChanged(Nullable<uint8_t> percent)
     OtaRequestorServerSetUpdateStateProgress(percent);
 }
 
+void DefaultOTARequestor::OnDownloadCheckpointChanged(const OTADownloadCheckpoint * checkpoint)
+{
+    CHIP_ERROR error = (checkpoint != nullptr) ? mStorage->StoreDownloadCheckpoint(mTargetVersion, *checkpoint)
+                                               : mStorage->ClearDownloadCheckpoint();
+    if ((error != CHIP_NO_ERROR) && (error != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND))
+    {
+        ChipLogError(SoftwareUpdate, "Failed to store download checkpoint: %" CHIP_ERROR_FORMAT, error.Format());
+    }
+}
+
 IdleStateReason DefaultOTARequestor::MapErrorToIdleStateReason(CHIP_ERROR error)
 {
     if (error == CHIP_NO_ERROR)
@@ -807,6 +820,12 @@ CHIP_ERROR DefaultOTARequestor::StartDownload(Messaging::ExchangeManager & excha
     initOptions.FileDesLength    = static_cast<uint16_t>(mFileDesignator.size());
     initOptions.FileDesignator   = reinterpret_cast<const uint8_t *>(mFileDesignator.data());
 
+    // Blocks are not bound by the MTU over sessions that allow large payloads (e.g. TCP): ask for large ones.
+    if (sessionHandle->AllowsLargePayload())
+    {
+        initOptions.MaxBlockSize = std::max<uint16_t>(initOptions.MaxBlockSize, CHIP_CONFIG_BDX_LARGE_PAYLOAD_MAX_BLOCK_SIZE);
+    }
+
     chip::Messaging::ExchangeContext * exchangeCtx = exchangeMgr.NewContext(sessionHandle, &mBdxMessenger);
     VerifyOrReturnError(exchangeCtx != nullptr, CHIP_ERROR_NO_MEMORY);
 
@@ -814,7 +833,23 @@ CHIP_ERROR DefaultOTARequestor::StartDownload(Messaging::ExchangeManager & excha
     mBdxDownloader->SetMessageDelegate(&mBdxMessenger);
     mBdxDownloader->SetStateDelegate(this);
 
-    CHIP_ERROR err = mBdxDownloader->SetBDXParams(initOptions, kDownloadTimeoutSec);
+    // Resume an interrupted download of the same image
+    OTADownloadCheckpoint checkpoint;
+    uint32_t checkpointVersion = 0;
+    CHIP_ERROR loadError       = mStorage->LoadDownloadCheckpoint(checkpointVersion, checkpoint);
+    bool resume                = (loadError == CHIP_NO_ERROR) && (checkpointVersion == mTargetVersion);
+    if (resume)
+    {
+        ChipLogProgress(SoftwareUpdate, "Resuming download of version %" PRIu32 " at offset 0x" ChipLogFormatX64, mTargetVersion,
+                        ChipLogValueX64(checkpoint.offset));
+    }
+    else if (loadError == CHIP_NO_ERROR)
+    {
+        // Left by the download of another image
+        mStorage->ClearDownloadCheckpoint();
+    }
+
+    CHIP_ERROR err = mBdxDownloader->SetBDXParams(initOptions, kDownloadTimeoutSec, resume ? &checkpoint : nullptr);
     if (err == CHIP_NO_ERROR)
     {
         err = mBdxDownloader->BeginPrepareDownload();
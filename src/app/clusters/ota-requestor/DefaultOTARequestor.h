@@ -106,6 +106,7 @@ public:
     void OnDownloadStateChanged(OTADownloader::State state,
                                 app::Clusters::OtaSoftwareUpdateRequestor::OTAChangeReasonEnum reason) override;
     void OnUpdateProgressChanged(app::DataModel::Nullable<uint8_t> percent) override;
+    void OnDownloadCheckpointChanged(const OTADownloadCheckpoint * checkpoint) override;
 
     //////////// DefaultOTARequestor public APIs ///////////////
 
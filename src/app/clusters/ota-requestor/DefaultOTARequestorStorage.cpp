@@ -25,6 +25,7 @@
 #include <lib/support/DefaultStorageKeyAllocator.h>
 
 #include <limits>
+#include <string.h>
 
 namespace chip {
 
@@ -38,6 +39,20 @@ constexpr size_t kProviderMaxSerializedSize = 19u;
 // Multiply the serialized provider size by the maximum number of fabrics and add 2 bytes for the array start and end.
 constexpr size_t kProviderListMaxSerializedSize = kProviderMaxSerializedSize * CHIP_CONFIG_MAX_FABRICS + 2;
 
+// A structure of the target version, three 64-bit offsets and the digest.
+constexpr size_t kDownloadCheckpointMaxSerializedSize =
+    TLV::EstimateStructOverhead(sizeof(uint32_t), sizeof(uint64_t), sizeof(uint64_t), sizeof(uint64_t),
+                                OTADownloadCheckpoint::kDigestLength);
+
+enum class DownloadCheckpointTag : uint8_t
+{
+    kTargetVersion  = 1,
+    kOffset         = 2,
+    kStoredBytes    = 3,
+    kTotalFileBytes = 4,
+    kPrefixDigest   = 5,
+};
+
 CHIP_ERROR DefaultOTARequestorStorage::StoreDefaultProviders(const ProviderLocationList & providers)
 {
     uint8_t buffer[kProviderListMaxSerializedSize];
@@ -171,6 +186,60 @@ CHIP_ERROR DefaultOTARequestorStorage::ClearTargetVersion()
     return mPersistentStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::OTATargetVersion().KeyName());
 }
 
+CHIP_ERROR DefaultOTARequestorStorage::StoreDownloadCheckpoint(uint32_t targetVersion, const OTADownloadCheckpoint & checkpoint)
+{
+    uint8_t buffer[kDownloadCheckpointMaxSerializedSize];
+    TLV::TLVWriter writer;
+    TLV::TLVType outerType;
+
+    writer.Init(buffer);
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerType));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(DownloadCheckpointTag::kTargetVersion), targetVersion));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(DownloadCheckpointTag::kOffset), checkpoint.offset));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(DownloadCheckpointTag::kStoredBytes), checkpoint.storedBytes));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(DownloadCheckpointTag::kTotalFileBytes), checkpoint.totalFileBytes));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(DownloadCheckpointTag::kPrefixDigest), ByteSpan(checkpoint.prefixDigest)));
+    ReturnErrorOnFailure(writer.EndContainer(outerType));
+
+    return mPersistentStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::OTADownloadCheckpoint().KeyName(), buffer,
+                                               static_cast<uint16_t>(writer.GetLengthWritten()));
+}
+
+CHIP_ERROR DefaultOTARequestorStorage::LoadDownloadCheckpoint(uint32_t & targetVersion, OTADownloadCheckpoint & checkpoint)
+{
+    uint8_t buffer[kDownloadCheckpointMaxSerializedSize];
+    MutableByteSpan bufferSpan(buffer);
+
+    ReturnErrorOnFailure(Load(DefaultStorageKeyAllocator::OTADownloadCheckpoint().KeyName(), bufferSpan));
+
+    TLV::TLVReader reader;
+    TLV::TLVType outerType;
+    ByteSpan prefixDigest;
+
+    reader.Init(bufferSpan.data(), bufferSpan.size());
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()));
+    ReturnErrorOnFailure(reader.EnterContainer(outerType));
+    ReturnErrorOnFailure(reader.Next(TLV::ContextTag(DownloadCheckpointTag::kTargetVersion)));
+    ReturnErrorOnFailure(reader.Get(targetVersion));
+    ReturnErrorOnFailure(reader.Next(TLV::ContextTag(DownloadCheckpointTag::kOffset)));
+    ReturnErrorOnFailure(reader.Get(checkpoint.offset));
+    ReturnErrorOnFailure(reader.Next(TLV::ContextTag(DownloadCheckpointTag::kStoredBytes)));
+    ReturnErrorOnFailure(reader.Get(checkpoint.storedBytes));
+    ReturnErrorOnFailure(reader.Next(TLV::ContextTag(DownloadCheckpointTag::kTotalFileBytes)));
+    ReturnErrorOnFailure(reader.Get(checkpoint.totalFileBytes));
+    ReturnErrorOnFailure(reader.Next(TLV::ContextTag(DownloadCheckpointTag::kPrefixDigest)));
+    ReturnErrorOnFailure(reader.Get(prefixDigest));
+    VerifyOrReturnError(prefixDigest.size() == sizeof(checkpoint.prefixDigest), CHIP_ERROR_INVALID_TLV_ELEMENT);
+    memcpy(checkpoint.prefixDigest, prefixDigest.data(), sizeof(checkpoint.prefixDigest));
+
+    return reader.ExitContainer(outerType);
+}
+
+CHIP_ERROR DefaultOTARequestorStorage::ClearDownloadCheckpoint()
+{
+    return mPersistentStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::OTADownloadCheckpoint().KeyName());
+}
+
 CHIP_ERROR DefaultOTARequestorStorage::Load(const char * key, MutableByteSpan & buffer)
 {
     uint16_t size = static_cast<uint16_t>(buffer.size());
@@ -48,6 +48,10 @@ public:
     CHIP_ERROR LoadTargetVersion(uint32_t & targetVersion) override;
     CHIP_ERROR ClearTargetVersion() override;
 
+    CHIP_ERROR StoreDownloadCheckpoint(uint32_t targetVersion, const OTADownloadCheckpoint & checkpoint) override;
+    CHIP_ERROR LoadDownloadCheckpoint(uint32_t & targetVersion, OTADownloadCheckpoint & checkpoint) override;
+    CHIP_ERROR ClearDownloadCheckpoint() override;
+
 private:
     CHIP_ERROR Load(const char * key, MutableByteSpan & buffer);
     PersistentStorageDelegate * mPersistentStorage = nullptr;
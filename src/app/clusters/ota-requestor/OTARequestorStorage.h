@@ -20,6 +20,7 @@
 
 #include <app-common/zap-generated/cluster-objects.h>
 #include <lib/support/Span.h>
+#include <platform/OTAImageProcessor.h>
 
 namespace chip {
 
@@ -51,6 +52,11 @@ public:
     virtual CHIP_ERROR StoreTargetVersion(uint32_t targetVersion)  = 0;
     virtual CHIP_ERROR LoadTargetVersion(uint32_t & targetVersion) = 0;
     virtual CHIP_ERROR ClearTargetVersion()                        = 0;
+
+    // Point from which the interrupted download of the targetVersion image can resume
+    virtual CHIP_ERROR StoreDownloadCheckpoint(uint32_t targetVersion, const OTADownloadCheckpoint & checkpoint) = 0;
+    virtual CHIP_ERROR LoadDownloadCheckpoint(uint32_t & targetVersion, OTADownloadCheckpoint & checkpoint)       = 0;
+    virtual CHIP_ERROR ClearDownloadCheckpoint()                                                                  = 0;
 };
 
 } // namespace chip
@@ -17,6 +17,8 @@
 
 #include <app/clusters/scenes-server/SceneTableImpl.h>
 #include <lib/support/DefaultStorageKeyAllocator.h>
+
+#include <algorithm>
 #include <stdlib.h>
 
 namespace chip {
@@ -106,19 +108,22 @@ static constexpr size_t kPersistentSceneBufferMax = CHIP_CONFIG_SCENES_MAX_SERIA
 
 struct SceneTableData : public SceneTableEntry, PersistentData<kPersistentSceneBufferMax>
 {
+    SceneTableCache & cache;
     EndpointId endpoint_id   = kInvalidEndpointId;
     FabricIndex fabric_index = kUndefinedFabricIndex;
     SceneIndex index         = 0;
     bool first               = true;
 
-    SceneTableData(EndpointId endpoint, FabricIndex fabric, SceneIndex idx = 0) :
-        endpoint_id(endpoint), fabric_index(fabric), index(idx)
+    SceneTableData(SceneTableCache & sceneCache, EndpointId endpoint, FabricIndex fabric, SceneIndex idx = 0) :
+        cache(sceneCache), endpoint_id(endpoint), fabric_index(fabric), index(idx)
     {}
-    SceneTableData(EndpointId endpoint, FabricIndex fabric, SceneStorageId storageId) :
-        SceneTableEntry(storageId), endpoint_id(endpoint), fabric_index(fabric)
+    SceneTableData(SceneTableCache & sceneCache, EndpointId endpoint, FabricIndex fabric, SceneStorageId storageId) :
+        SceneTableEntry(storageId), cache(sceneCache), endpoint_id(endpoint), fabric_index(fabric)
     {}
-    SceneTableData(EndpointId endpoint, FabricIndex fabric, SceneStorageId storageId, SceneData data) :
-        SceneTableEntry(storageId, data), endpoint_id(endpoint), fabric_index(fabric)
+    SceneTableData(SceneTableCache & sceneCache, EndpointId endpoint, FabricIndex fabric, SceneStorageId storageId,
+                   SceneData data) :
+        SceneTableEntry(storageId, data),
+        cache(sceneCache), endpoint_id(endpoint), fabric_index(fabric)
     {}
 
     CHIP_ERROR UpdateKey(StorageKeyName & key) override
@@ -188,6 +193,41 @@ struct SceneTableData : public SceneTableEntry, PersistentData<kPersistentSceneB
 
         return reader.ExitContainer(container);
     }
+
+    CHIP_ERROR Load(PersistentStorageDelegate * storage) override
+    {
+        const SceneTableCache::CachedScene * cached = cache.FindScene(endpoint_id, fabric_index, index);
+        if (cached != nullptr)
+        {
+            mStorageId   = cached->scene.mStorageId;
+            mStorageData = cached->scene.mStorageData;
+            return CHIP_NO_ERROR;
+        }
+
+        ReturnErrorOnFailure(PersistentData::Load(storage));
+        cache.StoreScene(endpoint_id, fabric_index, index, *this);
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR Save(PersistentStorageDelegate * storage) override
+    {
+        CHIP_ERROR err = PersistentData::Save(storage);
+        if (CHIP_NO_ERROR == err)
+        {
+            cache.StoreScene(endpoint_id, fabric_index, index, *this);
+        }
+        else
+        {
+            cache.RemoveScene(endpoint_id, fabric_index, index);
+        }
+        return err;
+    }
+
+    CHIP_ERROR Delete(PersistentStorageDelegate * storage) override
+    {
+        cache.RemoveScene(endpoint_id, fabric_index, index);
+        return PersistentData::Delete(storage);
+    }
 };
 
 // A Full fabric serialized TLV length is 88 bytes, 128 bytes gives some slack.  Tested by running writer.GetLengthWritten at the
@@ -201,6 +241,7 @@ static constexpr size_t kPersistentFabricBufferMax = 128;
  */
 struct FabricSceneData : public PersistentData<kPersistentFabricBufferMax>
 {
+    SceneTableCache & cache;
     EndpointId endpoint_id;
     FabricIndex fabric_index;
     uint8_t scene_count = 0;
@@ -208,10 +249,12 @@ struct FabricSceneData : public PersistentData<kPersistentFabricBufferMax>
     uint16_t max_scenes_per_endpoint;
     SceneStorageId scene_map[CHIP_CONFIG_MAX_SCENES_TABLE_SIZE];
 
-    FabricSceneData(EndpointId endpoint = kInvalidEndpointId, FabricIndex fabric = kUndefinedFabricIndex,
-                    uint16_t maxScenesPerFabric = kMaxScenesPerFabric, uint16_t maxScenesPerEndpoint = kMaxScenesPerEndpoint) :
-        endpoint_id(endpoint),
-        fabric_index(fabric), max_scenes_per_fabric(maxScenesPerFabric), max_scenes_per_endpoint(maxScenesPerEndpoint)
+    FabricSceneData(SceneTableCache & sceneCache, EndpointId endpoint = kInvalidEndpointId,
+                    FabricIndex fabric = kUndefinedFabricIndex, uint16_t maxScenesPerFabric = kMaxScenesPerFabric,
+                    uint16_t maxScenesPerEndpoint = kMaxScenesPerEndpoint) :
+        cache(sceneCache),
+        endpoint_id(endpoint), fabric_index(fabric), max_scenes_per_fabric(maxScenesPerFabric),
+        max_scenes_per_endpoint(maxScenesPerEndpoint)
     {}
 
     CHIP_ERROR UpdateKey(StorageKeyName & key) override
@@ -299,7 +342,7 @@ struct FabricSceneData : public PersistentData<kPersistentFabricBufferMax>
             }
             else
             {
-                SceneTableData scene(endpoint_id, fabric_index, i);
+                SceneTableData scene(cache, endpoint_id, fabric_index, i);
                 ReturnErrorOnFailure(reader.EnterContainer(sceneIdContainer));
                 ReturnErrorOnFailure(reader.Next(TLV::ContextTag(TagScene::kGroupID)));
                 ReturnErrorOnFailure(reader.Get(scene.mStorageId.mGroupId));
@@ -355,7 +398,7 @@ struct FabricSceneData : public PersistentData<kPersistentFabricBufferMax>
     CHIP_ERROR SaveScene(PersistentStorageDelegate * storage, const SceneTableEntry & entry)
     {
         CHIP_ERROR err = CHIP_NO_ERROR;
-        SceneTableData scene(endpoint_id, fabric_index, entry.mStorageId, entry.mStorageData);
+        SceneTableData scene(cache, endpoint_id, fabric_index, entry.mStorageId, entry.mStorageData);
         // Look for empty storage space
 
         err = this->Find(entry.mStorageId, scene.index);
@@ -412,7 +455,7 @@ struct FabricSceneData : public PersistentData<kPersistentFabricBufferMax>
     CHIP_ERROR RemoveScene(PersistentStorageDelegate * storage, const SceneStorageId & scene_id)
     {
         CHIP_ERROR err = CHIP_NO_ERROR;
-        SceneTableData scene(endpoint_id, fabric_index, scene_id);
+        SceneTableData scene(cache, endpoint_id, fabric_index, scene_id);
 
         // Empty Scene Fabric Data returns CHIP_NO_ERROR on remove
         if (scene_count > 0)
@@ -469,10 +512,23 @@ struct FabricSceneData : public PersistentData<kPersistentFabricBufferMax>
         // Update storage key
         ReturnErrorOnFailure(UpdateKey(key));
 
+        const SceneTableCache::FabricSceneMap * cached = cache.FindFabric(endpoint_id, fabric_index, max_scenes_per_fabric);
+        if (cached != nullptr)
+        {
+            VerifyOrReturnError(cached->stored, CHIP_ERROR_NOT_FOUND);
+            scene_count = cached->scene_count;
+            std::copy(cached->scene_map, cached->scene_map + max_scenes_per_fabric, scene_map);
+            return CHIP_NO_ERROR;
+        }
+
         // Load the serialized data
         uint16_t size  = static_cast<uint16_t>(sizeof(buffer));
         CHIP_ERROR err = storage->SyncGetKeyValue(key.KeyName(), buffer, size);
-        VerifyOrReturnError(CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND != err, CHIP_ERROR_NOT_FOUND);
+        if (CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND == err)
+        {
+            UpdateCache(/* stored = */ false);
+            return CHIP_ERROR_NOT_FOUND;
+        }
         ReturnErrorOnFailure(err);
 
         // Decode serialized data
@@ -493,10 +549,203 @@ struct FabricSceneData : public PersistentData<kPersistentFabricBufferMax>
             ReturnErrorOnFailure(this->Save(storage));
         }
 
+        if (CHIP_NO_ERROR == err)
+        {
+            UpdateCache(/* stored = */ true);
+        }
         return err;
     }
+
+    CHIP_ERROR Save(PersistentStorageDelegate * storage) override
+    {
+        CHIP_ERROR err = PersistentData::Save(storage);
+        if (CHIP_NO_ERROR == err)
+        {
+            UpdateCache(/* stored = */ true);
+        }
+        else
+        {
+            cache.RemoveFabric(endpoint_id, fabric_index);
+        }
+        return err;
+    }
+
+    CHIP_ERROR Delete(PersistentStorageDelegate * storage) override
+    {
+        CHIP_ERROR err = PersistentData::Delete(storage);
+        if (CHIP_NO_ERROR == err)
+        {
+            UpdateCache(/* stored = */ false);
+        }
+        else
+        {
+            cache.RemoveFabric(endpoint_id, fabric_index);
+        }
+        return err;
+    }
+
+    void UpdateCache(bool stored)
+    {
+        SceneTableCache::FabricSceneMap map;
+        map.endpoint_id           = endpoint_id;
+        map.fabric_index          = fabric_index;
+        map.max_scenes_per_fabric = max_scenes_per_fabric;
+        map.stored                = stored;
+        map.scene_count           = stored ? scene_count : 0;
+        if (stored)
+        {
+            std::copy(scene_map, scene_map + max_scenes_per_fabric, map.scene_map);
+        }
+        cache.StoreFabric(map);
+    }
 };
 
+namespace {
+
+// Bumped whenever a scene table updates its cache, so that the caches of the other scene tables sharing the storage (e.g. a table
+// created with other capacities) are dropped rather than getting stale when that table changes the storage.
+uint32_t gSceneStorageGeneration = 0;
+
+} // namespace
+
+const SceneTableCache::FabricSceneMap * SceneTableCache::FindFabric(EndpointId endpoint, FabricIndex fabric,
+                                                                    uint16_t maxScenesPerFabric)
+{
+    Revalidate();
+    for (size_t i = 0; i < kFabricMapCount; i++)
+    {
+        FabricSceneMap & map = mFabricMaps[i];
+        if (map.endpoint_id == endpoint && map.fabric_index == fabric &&
+            (!map.stored || map.max_scenes_per_fabric == maxScenesPerFabric))
+        {
+            map.last_used = ++mUseCounter;
+            return &map;
+        }
+    }
+    return nullptr;
+}
+
+void SceneTableCache::StoreFabric(const FabricSceneMap & map)
+{
+    Revalidate();
+    FabricSceneMap * slot = nullptr;
+    for (size_t i = 0; i < kFabricMapCount; i++)
+    {
+        FabricSceneMap & entry = mFabricMaps[i];
+        if (entry.endpoint_id == map.endpoint_id && entry.fabric_index == map.fabric_index)
+        {
+            // Copies read with another number of slots are replaced as well
+            entry.endpoint_id = kInvalidEndpointId;
+        }
+        if (slot == nullptr || (slot->endpoint_id != kInvalidEndpointId &&
+                                (entry.endpoint_id == kInvalidEndpointId || entry.last_used < slot->last_used)))
+        {
+            slot = &entry;
+        }
+    }
+    VerifyOrReturn(slot != nullptr);
+
+    *slot           = map;
+    slot->last_used = ++mUseCounter;
+    OnStorageChanged();
+}
+
+void SceneTableCache::RemoveFabric(EndpointId endpoint, FabricIndex fabric)
+{
+    Revalidate();
+    for (size_t i = 0; i < kFabricMapCount; i++)
+    {
+        if (mFabricMaps[i].endpoint_id == endpoint && mFabricMaps[i].fabric_index == fabric)
+        {
+            mFabricMaps[i].endpoint_id = kInvalidEndpointId;
+        }
+    }
+    OnStorageChanged();
+}
+
+const SceneTableCache::CachedScene * SceneTableCache::FindScene(EndpointId endpoint, FabricIndex fabric, SceneIndex index)
+{
+    Revalidate();
+    for (size_t i = 0; i < kSceneCount; i++)
+    {
+        CachedScene & cached = mScenes[i];
+        if (cached.endpoint_id == endpoint && cached.fabric_index == fabric && cached.index == index)
+        {
+            cached.last_used = ++mUseCounter;
+            return &cached;
+        }
+    }
+    return nullptr;
+}
+
+void SceneTableCache::StoreScene(EndpointId endpoint, FabricIndex fabric, SceneIndex index, const SceneTableEntry & scene)
+{
+    Revalidate();
+    CachedScene * slot = nullptr;
+    for (size_t i = 0; i < kSceneCount; i++)
+    {
+        CachedScene & cached = mScenes[i];
+        if (cached.endpoint_id == endpoint && cached.fabric_index == fabric && cached.index == index)
+        {
+            slot = &cached;
+            break;
+        }
+        if (slot == nullptr || (slot->endpoint_id != kInvalidEndpointId &&
+                                (cached.endpoint_id == kInvalidEndpointId || cached.last_used < slot->last_used)))
+        {
+            slot = &cached;
+        }
+    }
+    VerifyOrReturn(slot != nullptr);
+
+    slot->endpoint_id  = endpoint;
+    slot->fabric_index = fabric;
+    slot->index        = index;
+    slot->scene        = scene;
+    slot->last_used    = ++mUseCounter;
+    OnStorageChanged();
+}
+
+void SceneTableCache::RemoveScene(EndpointId endpoint, FabricIndex fabric, SceneIndex index)
+{
+    Revalidate();
+    for (size_t i = 0; i < kSceneCount; i++)
+    {
+        CachedScene & cached = mScenes[i];
+        if (cached.endpoint_id == endpoint && cached.fabric_index == fabric && cached.index == index)
+        {
+            cached.endpoint_id = kInvalidEndpointId;
+        }
+    }
+    OnStorageChanged();
+}
+
+void SceneTableCache::Clear()
+{
+    for (auto & map : mFabricMaps)
+    {
+        map.endpoint_id = kInvalidEndpointId;
+    }
+    for (auto & cached : mScenes)
+    {
+        cached.endpoint_id = kInvalidEndpointId;
+    }
+    mGeneration = gSceneStorageGeneration;
+}
+
+void SceneTableCache::Revalidate()
+{
+    if (mGeneration != gSceneStorageGeneration)
+    {
+        Clear();
+    }
+}
+
+void SceneTableCache::OnStorageChanged()
+{
+    mGeneration = ++gSceneStorageGeneration;
+}
+
 CHIP_ERROR DefaultSceneTableImpl::Init(PersistentStorageDelegate * storage)
 {
     if (storage == nullptr)
@@ -508,6 +757,7 @@ CHIP_ERROR DefaultSceneTableImpl::Init(PersistentStorageDelegate * storage)
     VerifyOrReturnError(mMaxScenesPerFabric <= kMaxScenesPerFabric && mMaxScenesPerEndpoint <= kMaxScenesPerEndpoint,
                         CHIP_ERROR_INVALID_INTEGER_VALUE);
     mStorage = storage;
+    mCache.Clear();
     return CHIP_NO_ERROR;
 }
 
@@ -515,12 +765,13 @@ void DefaultSceneTableImpl::Finish()
 {
     UnregisterAllHandlers();
     mSceneEntryIterators.ReleaseAll();
+    mCache.Clear();
 }
 CHIP_ERROR DefaultSceneTableImpl::GetFabricSceneCount(FabricIndex fabric_index, uint8_t & scene_count)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
-    FabricSceneData fabric(mEndpointId, fabric_index);
+    FabricSceneData fabric(mCache, mEndpointId, fabric_index);
     CHIP_ERROR err = fabric.Load(mStorage);
     VerifyOrReturnError(CHIP_NO_ERROR == err || CHIP_ERROR_NOT_FOUND == err, err);
 
@@ -566,7 +817,7 @@ CHIP_ERROR DefaultSceneTableImpl::GetRemainingCapacity(FabricIndex fabric_index,
     uint8_t remaining_capacity_global = static_cast<uint8_t>(mMaxScenesPerEndpoint - endpoint_scene_count);
     uint8_t remaining_capacity_fabric = static_cast<uint8_t>(mMaxScenesPerFabric);
 
-    FabricSceneData fabric(mEndpointId, fabric_index);
+    FabricSceneData fabric(mCache, mEndpointId, fabric_index);
 
     // Load fabric data (defaults to zero)
     CHIP_ERROR err = fabric.Load(mStorage);
@@ -586,7 +837,7 @@ CHIP_ERROR DefaultSceneTableImpl::SetSceneTableEntry(FabricIndex fabric_index, c
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
-    FabricSceneData fabric(mEndpointId, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
+    FabricSceneData fabric(mCache, mEndpointId, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
 
     // Load fabric data (defaults to zero)
     CHIP_ERROR err = fabric.Load(mStorage);
@@ -600,8 +851,8 @@ CHIP_ERROR DefaultSceneTableImpl::GetSceneTableEntry(FabricIndex fabric_index, S
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
-    FabricSceneData fabric(mEndpointId, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
-    SceneTableData scene(mEndpointId, fabric_index);
+    FabricSceneData fabric(mCache, mEndpointId, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
+    SceneTableData scene(mCache, mEndpointId, fabric_index);
 
     ReturnErrorOnFailure(fabric.Load(mStorage));
     VerifyOrReturnError(fabric.Find(scene_id, scene.index) == CHIP_NO_ERROR, CHIP_ERROR_NOT_FOUND);
@@ -625,7 +876,7 @@ CHIP_ERROR DefaultSceneTableImpl::GetSceneTableEntry(FabricIndex fabric_index, S
 CHIP_ERROR DefaultSceneTableImpl::RemoveSceneTableEntry(FabricIndex fabric_index, SceneStorageId scene_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
-    FabricSceneData fabric(mEndpointId, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
+    FabricSceneData fabric(mCache, mEndpointId, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
 
     ReturnErrorOnFailure(fabric.Load(mStorage));
 
@@ -643,8 +894,8 @@ CHIP_ERROR DefaultSceneTableImpl::RemoveSceneTableEntryAtPosition(EndpointId end
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
     CHIP_ERROR err = CHIP_NO_ERROR;
-    FabricSceneData fabric(endpoint, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
-    SceneTableData scene(endpoint, fabric_index, scene_idx);
+    FabricSceneData fabric(mCache, endpoint, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
+    SceneTableData scene(mCache, endpoint, fabric_index, scene_idx);
 
     ReturnErrorOnFailure(fabric.Load(mStorage));
     err = scene.Load(mStorage);
@@ -656,8 +907,8 @@ CHIP_ERROR DefaultSceneTableImpl::RemoveSceneTableEntryAtPosition(EndpointId end
 
 CHIP_ERROR DefaultSceneTableImpl::GetAllSceneIdsInGroup(FabricIndex fabric_index, GroupId group_id, Span<SceneId> & scene_list)
 {
-    FabricSceneData fabric(mEndpointId, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
-    SceneTableData scene(mEndpointId, fabric_index);
+    FabricSceneData fabric(mCache, mEndpointId, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
+    SceneTableData scene(mCache, mEndpointId, fabric_index);
 
     auto * iterator = this->IterateSceneEntries(fabric_index);
     VerifyOrReturnError(nullptr != iterator, CHIP_ERROR_INTERNAL);
@@ -686,8 +937,8 @@ CHIP_ERROR DefaultSceneTableImpl::DeleteAllScenesInGroup(FabricIndex fabric_inde
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
-    FabricSceneData fabric(mEndpointId, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
-    SceneTableData scene(mEndpointId, fabric_index);
+    FabricSceneData fabric(mCache, mEndpointId, fabric_index, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
+    SceneTableData scene(mCache, mEndpointId, fabric_index);
 
     CHIP_ERROR err = fabric.Load(mStorage);
     VerifyOrReturnValue(CHIP_ERROR_NOT_FOUND != err, CHIP_NO_ERROR);
@@ -804,7 +1055,7 @@ CHIP_ERROR DefaultSceneTableImpl::RemoveFabric(FabricIndex fabric_index)
 
     for (auto endpoint : app::EnabledEndpointsWithServerCluster(chip::app::Clusters::ScenesManagement::Id))
     {
-        FabricSceneData fabric(endpoint, fabric_index);
+        FabricSceneData fabric(mCache, endpoint, fabric_index);
         SceneIndex idx = 0;
         CHIP_ERROR err = fabric.Load(mStorage);
         VerifyOrReturnError(CHIP_NO_ERROR == err || CHIP_ERROR_NOT_FOUND == err, err);
@@ -833,7 +1084,7 @@ CHIP_ERROR DefaultSceneTableImpl::RemoveEndpoint()
 
     for (FabricIndex fabric_index = kMinValidFabricIndex; fabric_index < kMaxValidFabricIndex; fabric_index++)
     {
-        FabricSceneData fabric(mEndpointId, fabric_index);
+        FabricSceneData fabric(mCache, mEndpointId, fabric_index);
         CHIP_ERROR err = fabric.Load(mStorage);
         VerifyOrReturnError(CHIP_NO_ERROR == err || CHIP_ERROR_NOT_FOUND == err, err);
         if (CHIP_ERROR_NOT_FOUND == err)
@@ -896,7 +1147,7 @@ DefaultSceneTableImpl::SceneEntryIteratorImpl::SceneEntryIteratorImpl(DefaultSce
     mProvider(provider),
     mFabric(fabricIdx), mEndpoint(endpoint), mMaxScenesPerFabric(maxScenesPerFabric), mMaxScenesPerEndpoint(maxScenesEndpoint)
 {
-    FabricSceneData fabric(mEndpoint, fabricIdx, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
+    FabricSceneData fabric(provider.mCache, mEndpoint, fabricIdx, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
     ReturnOnFailure(fabric.Load(provider.mStorage));
     mTotalScenes = fabric.scene_count;
     mSceneIndex  = 0;
@@ -909,8 +1160,8 @@ size_t DefaultSceneTableImpl::SceneEntryIteratorImpl::Count()
 
 bool DefaultSceneTableImpl::SceneEntryIteratorImpl::Next(SceneTableEntry & output)
 {
-    FabricSceneData fabric(mEndpoint, mFabric);
-    SceneTableData scene(mEndpoint, mFabric);
+    FabricSceneData fabric(mProvider.mCache, mEndpoint, mFabric, mMaxScenesPerFabric, mMaxScenesPerEndpoint);
+    SceneTableData scene(mProvider.mCache, mEndpoint, mFabric);
 
     VerifyOrReturnError(fabric.Load(mProvider.mStorage) == CHIP_NO_ERROR, false);
 
@@ -41,6 +41,66 @@ static_assert(kMaxScenesPerEndpoint <= CHIP_CONFIG_MAX_SCENES_TABLE_SIZE,
 static_assert(kMaxScenesPerEndpoint >= 16, "Per spec, kMaxScenesPerEndpoint must be at least 16");
 static constexpr uint16_t kMaxScenesPerFabric = (kMaxScenesPerEndpoint - 1) / 2;
 
+/**
+ * @brief RAM copy of recently used scene table records, so that looking a scene up does not read the storage back.
+ *
+ * Holds up to CHIP_CONFIG_SCENES_TABLE_INDEX_SIZE scene maps, each mapping the (group, scene) ids of a fabric on an endpoint to
+ * their storage slot, and up to CHIP_CONFIG_SCENES_TABLE_CACHED_SCENES scenes with their extension field sets. Least recently
+ * used records are replaced. The cache is written through by DefaultSceneTableImpl: entries always match the storage.
+ */
+class SceneTableCache
+{
+public:
+    using SceneStorageId  = SceneTable<ExtensionFieldSetsImpl>::SceneStorageId;
+    using SceneTableEntry = SceneTable<ExtensionFieldSetsImpl>::SceneTableEntry;
+
+    struct FabricSceneMap
+    {
+        EndpointId endpoint_id         = kInvalidEndpointId;
+        FabricIndex fabric_index       = kUndefinedFabricIndex;
+        uint16_t max_scenes_per_fabric = 0; // Slots of scene_map read from storage
+        bool stored                    = false;
+        uint8_t scene_count            = 0;
+        SceneStorageId scene_map[CHIP_CONFIG_MAX_SCENES_TABLE_SIZE];
+        uint32_t last_used = 0;
+    };
+
+    struct CachedScene
+    {
+        EndpointId endpoint_id   = kInvalidEndpointId;
+        FabricIndex fabric_index = kUndefinedFabricIndex;
+        SceneIndex index         = 0;
+        SceneTableEntry scene;
+        uint32_t last_used = 0;
+    };
+
+    /// Returns the scene map of a fabric on an endpoint read with the given number of slots, nullptr if not cached
+    const FabricSceneMap * FindFabric(EndpointId endpoint, FabricIndex fabric, uint16_t maxScenesPerFabric);
+    /// Records the scene map of a fabric on an endpoint as stored, replacing any other copy of it
+    void StoreFabric(const FabricSceneMap & map);
+    void RemoveFabric(EndpointId endpoint, FabricIndex fabric);
+
+    const CachedScene * FindScene(EndpointId endpoint, FabricIndex fabric, SceneIndex index);
+    void StoreScene(EndpointId endpoint, FabricIndex fabric, SceneIndex index, const SceneTableEntry & scene);
+    void RemoveScene(EndpointId endpoint, FabricIndex fabric, SceneIndex index);
+
+    void Clear();
+
+private:
+    static constexpr size_t kFabricMapCount = CHIP_CONFIG_SCENES_TABLE_INDEX_SIZE;
+    static constexpr size_t kSceneCount     = CHIP_CONFIG_SCENES_TABLE_CACHED_SCENES;
+
+    // Drops the content if another scene table changed the storage since this cache was last updated
+    void Revalidate();
+    // Called after updating the cache for a change made to the storage
+    void OnStorageChanged();
+
+    FabricSceneMap mFabricMaps[kFabricMapCount > 0 ? kFabricMapCount : 1];
+    CachedScene mScenes[kSceneCount > 0 ? kSceneCount : 1];
+    uint32_t mUseCounter = 0;
+    uint32_t mGeneration = 0;
+};
+
 /**
  * @brief Implementation of a storage in nonvolatile storage of the scene table.
  *
@@ -134,6 +194,7 @@ protected:
     EndpointId mEndpointId                     = kInvalidEndpointId;
     chip::PersistentStorageDelegate * mStorage = nullptr;
     ObjectPool<SceneEntryIteratorImpl, kIteratorsMax> mSceneEntryIterators;
+    SceneTableCache mCache;
 }; // class DefaultSceneTableImpl
 
 /// @brief Gets a pointer to the instance of Scene Table Impl, providing EndpointId and Table Size for said endpoint
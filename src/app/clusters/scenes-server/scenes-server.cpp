@@ -366,8 +366,9 @@ void ScenesServer::Shutdown()
 {
     chip::app::CommandHandlerInterfaceRegistry::Instance().UnregisterCommandHandler(this);
 
-    mGroupProvider = nullptr;
-    mIsInitialized = false;
+    mGroupProvider      = nullptr;
+    mPendingRecallCount = 0;
+    mIsInitialized      = false;
 }
 
 template <typename CommandData, typename ResponseType>
@@ -614,13 +615,11 @@ CHIP_ERROR StoreSceneParse(const FabricIndex & fabricIdx, const EndpointId & end
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR RecallSceneParse(const FabricIndex & fabricIdx, const EndpointId & endpointID, const GroupId & groupID,
+/// @brief Looks up a scene and applies its extension field sets to an endpoint, the SceneInfo attribute is left to the caller
+CHIP_ERROR RecallSceneApply(const FabricIndex & fabricIdx, const EndpointId & endpointID, const GroupId & groupID,
                             const SceneId & sceneID, const Optional<DataModel::Nullable<uint32_t>> & transitionTime,
                             GroupDataProvider * groupProvider)
 {
-    // Make SceneValid false for all fabrics before recalling a scene
-    ScenesServer::Instance().MakeSceneInvalidForAllFabrics(endpointID);
-
     uint16_t endpointTableSize = 0;
     ReturnErrorOnFailure(StatusIB(Attributes::SceneTableSize::Get(endpointID, &endpointTableSize)).ToChipError());
 
@@ -650,7 +649,17 @@ CHIP_ERROR RecallSceneParse(const FabricIndex & fabricIdx, const EndpointId & en
         }
     }
 
-    ReturnErrorOnFailure(sceneTable->SceneApplyEFS(scene));
+    return sceneTable->SceneApplyEFS(scene);
+}
+
+CHIP_ERROR RecallSceneParse(const FabricIndex & fabricIdx, const EndpointId & endpointID, const GroupId & groupID,
+                            const SceneId & sceneID, const Optional<DataModel::Nullable<uint32_t>> & transitionTime,
+                            GroupDataProvider * groupProvider)
+{
+    // Make SceneValid false for all fabrics before recalling a scene
+    ScenesServer::Instance().MakeSceneInvalidForAllFabrics(endpointID);
+
+    ReturnErrorOnFailure(RecallSceneApply(fabricIdx, endpointID, groupID, sceneID, transitionTime, groupProvider));
 
     // Update FabricSceneInfo, at this point the scene is considered valid
     ReturnErrorOnFailure(
@@ -789,6 +798,80 @@ void ScenesServer::RecallScene(FabricIndex aFabricIx, EndpointId aEndpointId, Gr
     RecallSceneParse(aFabricIx, aEndpointId, aGroupId, aSceneId, transitionTime, mGroupProvider);
 }
 
+void ScenesServer::QueueGroupRecall(const PendingRecall & recall)
+{
+    // A newer recall on an endpoint supersedes the one still pending
+    for (size_t i = 0; i < mPendingRecallCount; i++)
+    {
+        if (mPendingRecalls[i].mEndpointId == recall.mEndpointId)
+        {
+            mPendingRecalls[i] = recall;
+            return;
+        }
+    }
+
+    if (mPendingRecallCount >= kScenesServerMaxEndpointCount)
+    {
+        ApplyPendingRecalls();
+    }
+    mPendingRecalls[mPendingRecallCount++] = recall;
+
+    if (!mPendingRecallsScheduled)
+    {
+        CHIP_ERROR err = DeviceLayer::PlatformMgr().ScheduleWork(ApplyPendingRecallsWork, reinterpret_cast<intptr_t>(this));
+        if (CHIP_NO_ERROR != err)
+        {
+            ChipLogError(Zcl, "Failed to defer group scene recall: %" CHIP_ERROR_FORMAT, err.Format());
+            ApplyPendingRecalls();
+            return;
+        }
+        mPendingRecallsScheduled = true;
+    }
+}
+
+void ScenesServer::ApplyPendingRecalls()
+{
+    bool applied[kScenesServerMaxEndpointCount];
+
+    // Invalidate the current scenes first so that nothing but the extension field sets is applied between two endpoints
+    for (size_t i = 0; i < mPendingRecallCount; i++)
+    {
+        MakeSceneInvalidForAllFabrics(mPendingRecalls[i].mEndpointId);
+    }
+
+    for (size_t i = 0; i < mPendingRecallCount; i++)
+    {
+        const PendingRecall & recall = mPendingRecalls[i];
+        CHIP_ERROR err = RecallSceneApply(recall.mFabricIndex, recall.mEndpointId, recall.mGroupId, recall.mSceneId,
+                                          recall.mTransitionTime, mGroupProvider);
+        applied[i]     = (CHIP_NO_ERROR == err);
+        if (!applied[i] && CHIP_IM_GLOBAL_STATUS(InvalidCommand) != err)
+        {
+            ChipLogError(Zcl, "Group scene recall failed on endpoint %u: %" CHIP_ERROR_FORMAT, recall.mEndpointId, err.Format());
+        }
+    }
+
+    for (size_t i = 0; i < mPendingRecallCount; i++)
+    {
+        const PendingRecall & recall = mPendingRecalls[i];
+        if (applied[i])
+        {
+            UpdateFabricSceneInfo(recall.mEndpointId, recall.mFabricIndex, MakeOptional(recall.mGroupId),
+                                  MakeOptional(recall.mSceneId), MakeOptional(true));
+        }
+    }
+
+    mPendingRecallCount = 0;
+}
+
+void ScenesServer::ApplyPendingRecallsWork(intptr_t context)
+{
+    ScenesServer * server            = reinterpret_cast<ScenesServer *>(context);
+    server->mPendingRecallsScheduled = false;
+    VerifyOrReturn(server->mIsInitialized);
+    server->ApplyPendingRecalls();
+}
+
 bool ScenesServer::IsHandlerRegistered(EndpointId aEndpointId, scenes::SceneHandler * handler)
 {
     SceneTable * sceneTable = scenes::GetSceneTableImpl(aEndpointId);
@@ -987,6 +1070,15 @@ void ScenesServer::HandleRecallScene(HandlerContext & ctx, const Commands::Recal
         return;
     }
 
+    // Group commands get no response, their recall is applied along with the ones of the other endpoints of the group
+    if (AuthMode::kGroup == ctx.mCommandHandler.GetSubjectDescriptor().authMode)
+    {
+        QueueGroupRecall({ ctx.mCommandHandler.GetAccessingFabricIndex(), ctx.mRequestPath.mEndpointId, req.groupID, req.sceneID,
+                           req.transitionTime });
+        ctx.mCommandHandler.AddStatus(ctx.mRequestPath, Protocols::InteractionModel::Status::Success);
+        return;
+    }
+
     CHIP_ERROR err = RecallSceneParse(ctx.mCommandHandler.GetAccessingFabricIndex(), ctx.mRequestPath.mEndpointId, req.groupID,
                                       req.sceneID, req.transitionTime, mGroupProvider);
 
@@ -118,12 +118,35 @@ private:
     void HandleGetSceneMembership(HandlerContext & ctx, const Commands::GetSceneMembership::DecodableType & req);
     void HandleCopyScene(HandlerContext & ctx, const Commands::CopyScene::DecodableType & req);
 
+    // Group addressed recalls
+    struct PendingRecall
+    {
+        FabricIndex mFabricIndex;
+        EndpointId mEndpointId;
+        GroupId mGroupId;
+        SceneId mSceneId;
+        Optional<DataModel::Nullable<uint32_t>> mTransitionTime;
+    };
+
+    /// @brief Queues a group addressed recall to be applied with the recalls of the other endpoints of the group.
+    /// @details A group command is dispatched to every endpoint of the group during the same event, the recalls are therefore
+    /// applied once that event is done: the extension field sets of all the endpoints are applied back to back, starting their
+    /// transitions together, and the SceneInfo attributes are only updated afterwards.
+    void QueueGroupRecall(const PendingRecall & recall);
+    void ApplyPendingRecalls();
+    static void ApplyPendingRecallsWork(intptr_t context);
+
     // Group Data Provider
     Credentials::GroupDataProvider * mGroupProvider = nullptr;
 
     // FabricSceneInfo
     FabricSceneInfo mFabricSceneInfo;
 
+    // Group addressed recalls, at most one per endpoint
+    PendingRecall mPendingRecalls[kScenesServerMaxEndpointCount];
+    size_t mPendingRecallCount = 0;
+    bool mPendingRecallsScheduled = false;
+
     // Instance
     static ScenesServer mInstance;
 };
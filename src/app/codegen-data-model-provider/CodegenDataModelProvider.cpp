@@ -18,6 +18,7 @@
 
 #include <access/AccessControl.h>
 #include <app-common/zap-generated/attribute-type.h>
+#include <app/ClusterStatistics.h>
 #include <app/CommandHandlerInterface.h>
 #include <app/CommandHandlerInterfaceRegistry.h>
 #include <app/ConcreteClusterPath.h>
@@ -372,6 +373,10 @@ std::optional<DataModel::ActionReturnStatus> CodegenDataModelProvider::Invoke(co
                                                                               TLV::TLVReader & input_arguments,
                                                                               CommandHandler * handler)
 {
+    IM_CLUSTER_STATS_RECORD_BYTES(kInvoke, request.path.mClusterId, request.path.mCommandId,
+                                  ClusterStatistics::GetElementLength(input_arguments));
+    IM_CLUSTER_STATS_TIME(kInvoke, request.path.mClusterId, request.path.mCommandId);
+
     CommandHandlerInterface * handler_interface =
         CommandHandlerInterfaceRegistry::Instance().GetCommandHandler(request.path.mEndpointId, request.path.mClusterId);
 
@@ -392,6 +397,25 @@ std::optional<DataModel::ActionReturnStatus> CodegenDataModelProvider::Invoke(co
     return std::nullopt;
 }
 
+bool CodegenDataModelProvider::InvokeGroup(const DataModel::InvokeRequest & request, Span<const EndpointId> endpoints,
+                                           TLV::TLVReader & input_arguments, CommandHandler * handler)
+{
+    // Only a handler used for all the endpoints can handle the command for all of them.
+    CommandHandlerInterface * handler_interface =
+        CommandHandlerInterfaceRegistry::Instance().GetCommandHandler(request.path.mEndpointId, request.path.mClusterId);
+    VerifyOrReturnValue(handler_interface != nullptr, false);
+    for (EndpointId endpoint : endpoints)
+    {
+        VerifyOrReturnValue(CommandHandlerInterfaceRegistry::Instance().GetCommandHandler(endpoint, request.path.mClusterId) ==
+                                handler_interface,
+                            false);
+    }
+
+    CommandHandlerInterface::HandlerContext context(*handler, request.path, input_arguments);
+    handler_interface->InvokeGroupCommand(context, endpoints);
+    return context.mCommandHandled;
+}
+
 bool CodegenDataModelProvider::EndpointExists(EndpointId endpoint)
 {
     return (emberAfIndexFromEndpoint(endpoint) != kEmberInvalidEndpointIndex);
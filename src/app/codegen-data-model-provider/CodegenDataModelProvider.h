@@ -145,8 +145,11 @@ public:
                                                 AttributeValueEncoder & encoder) override;
     DataModel::ActionReturnStatus WriteAttribute(const DataModel::WriteAttributeRequest & request,
                                                  AttributeValueDecoder & decoder) override;
+    void ListAttributeWriteNotification(const ConcreteAttributePath & path, DataModel::ListWriteOperation operation) override;
     std::optional<DataModel::ActionReturnStatus> Invoke(const DataModel::InvokeRequest & request,
                                                         chip::TLV::TLVReader & input_arguments, CommandHandler * handler) override;
+    bool InvokeGroup(const DataModel::InvokeRequest & request, Span<const EndpointId> endpoints,
+                     chip::TLV::TLVReader & input_arguments, CommandHandler * handler) override;
 
     /// attribute tree iteration
     EndpointId FirstEndpoint() override;
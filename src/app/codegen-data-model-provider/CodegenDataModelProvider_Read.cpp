@@ -26,6 +26,7 @@
 #include <app/AttributeAccessInterface.h>
 #include <app/AttributeAccessInterfaceRegistry.h>
 #include <app/AttributeValueEncoder.h>
+#include <app/ClusterStatistics.h>
 #include <app/GlobalAttributes.h>
 #include <app/RequiredPrivilege.h>
 #include <app/codegen-data-model-provider/EmberAttributeDataBuffer.h>
@@ -104,6 +105,8 @@ DataModel::ActionReturnStatus CodegenDataModelProvider::ReadAttribute(const Data
                   ChipLogValueMEI(request.path.mClusterId), request.path.mEndpointId, ChipLogValueMEI(request.path.mAttributeId),
                   request.path.mExpanded);
 
+    IM_CLUSTER_STATS_TIME(kReadAttribute, request.path.mClusterId, request.path.mAttributeId);
+
     auto metadata = Ember::FindAttributeMetadata(request.path);
 
     // Explicit failure in finding a suitable metadata
@@ -20,6 +20,7 @@
 #include <app-common/zap-generated/attribute-type.h>
 #include <app/AttributeAccessInterface.h>
 #include <app/AttributeAccessInterfaceRegistry.h>
+#include <app/ClusterStatistics.h>
 #include <app/RequiredPrivilege.h>
 #include <app/codegen-data-model-provider/EmberAttributeDataBuffer.h>
 #include <app/codegen-data-model-provider/EmberMetadata.h>
@@ -94,6 +95,8 @@ DataModel::ActionReturnStatus CodegenDataModelProvider::WriteAttribute(const Dat
     ChipLogDetail(DataManagement, "Writing attribute: Cluster=" ChipLogFormatMEI " Endpoint=0x%x AttributeId=" ChipLogFormatMEI,
                   ChipLogValueMEI(request.path.mClusterId), request.path.mEndpointId, ChipLogValueMEI(request.path.mAttributeId));
 
+    IM_CLUSTER_STATS_TIME(kWriteAttribute, request.path.mClusterId, request.path.mAttributeId);
+
     // TODO: ordering is to check writability/existence BEFORE ACL and this seems wrong, however
     //       existing unit tests (TC_AcessChecker.py) validate that we get UnsupportedWrite instead of UnsupportedAccess
     //
@@ -261,5 +264,25 @@ DataModel::ActionReturnStatus CodegenDataModelProvider::WriteAttribute(const Dat
     return CHIP_NO_ERROR;
 }
 
+void CodegenDataModelProvider::ListAttributeWriteNotification(const ConcreteAttributePath & path,
+                                                              DataModel::ListWriteOperation operation)
+{
+    AttributeAccessInterface * aai = AttributeAccessInterfaceRegistry::Instance().Get(path.mEndpointId, path.mClusterId);
+    VerifyOrReturn(aai != nullptr);
+
+    switch (operation)
+    {
+    case DataModel::ListWriteOperation::kListWriteBegin:
+        aai->OnListWriteBegin(path);
+        break;
+    case DataModel::ListWriteOperation::kListWriteSuccess:
+        aai->OnListWriteEnd(path, true);
+        break;
+    case DataModel::ListWriteOperation::kListWriteFailure:
+        aai->OnListWriteEnd(path, false);
+        break;
+    }
+}
+
 } // namespace app
 } // namespace chip
@@ -643,6 +643,33 @@ private:
     unsigned mCount = 0;
 };
 
+class ListWriteNotificationAccessInterface : public AttributeAccessInterface
+{
+public:
+    ListWriteNotificationAccessInterface(ConcreteAttributePath path) :
+        AttributeAccessInterface(MakeOptional(path.mEndpointId), path.mClusterId)
+    {}
+
+    CHIP_ERROR Read(const ConcreteReadAttributePath & path, AttributeValueEncoder & encoder) override { return CHIP_NO_ERROR; }
+
+    void OnListWriteBegin(const ConcreteAttributePath & aPath) override { mBeginCount++; }
+    void OnListWriteEnd(const ConcreteAttributePath & aPath, bool aWriteWasSuccessful) override
+    {
+        if (aWriteWasSuccessful)
+        {
+            mSuccessCount++;
+        }
+        else
+        {
+            mFailureCount++;
+        }
+    }
+
+    unsigned mBeginCount   = 0;
+    unsigned mSuccessCount = 0;
+    unsigned mFailureCount = 0;
+};
+
 /// RAII registration of an attribute access interface
 template <typename T>
 class RegisteredAttributeAccessInterface
@@ -2605,3 +2632,26 @@ TEST(TestCodegenModelViaMocks, DeviceTypeIteration)
     entry = model.FirstDeviceType(kMockEndpoint3);
     ASSERT_FALSE(entry.has_value());
 }
+
+TEST(TestCodegenModelViaMocks, ListAttributeWriteNotificationReachesAttributeAccessInterface)
+{
+    UseMockNodeConfig config(gTestNodeConfig);
+    CodegenDataModelProviderWithContext model;
+
+    const ConcreteAttributePath kListPath(kMockEndpoint3, MockClusterId(4),
+                                          MOCK_ATTRIBUTE_ID_FOR_NON_NULLABLE_TYPE(ZCL_ARRAY_ATTRIBUTE_TYPE));
+
+    // Nothing handles the notifications of paths without an attribute access interface.
+    model.ListAttributeWriteNotification(kListPath, DataModel::ListWriteOperation::kListWriteBegin);
+
+    RegisteredAttributeAccessInterface<ListWriteNotificationAccessInterface> aai(kListPath);
+
+    model.ListAttributeWriteNotification(kListPath, DataModel::ListWriteOperation::kListWriteBegin);
+    model.ListAttributeWriteNotification(kListPath, DataModel::ListWriteOperation::kListWriteSuccess);
+    model.ListAttributeWriteNotification(kListPath, DataModel::ListWriteOperation::kListWriteBegin);
+    model.ListAttributeWriteNotification(kListPath, DataModel::ListWriteOperation::kListWriteFailure);
+
+    EXPECT_EQ(aai->mBeginCount, 2u);
+    EXPECT_EQ(aai->mSuccessCount, 1u);
+    EXPECT_EQ(aai->mFailureCount, 1u);
+}
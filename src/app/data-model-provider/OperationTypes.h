@@ -101,6 +101,14 @@ struct WriteAttributeRequest : OperationRequest
     std::optional<ConcreteAttributePath> previousSuccessPath;
 };
 
+/// Stages of the write of a list attribute, see Provider::ListAttributeWriteNotification.
+enum class ListWriteOperation : uint8_t
+{
+    kListWriteBegin,   // The list is about to be written, by one or more WriteAttribute calls
+    kListWriteSuccess, // The whole list was written
+    kListWriteFailure, // The write stopped before the end of the list, e.g. on an error or an aborted chunked write
+};
+
 enum class InvokeFlags : uint32_t
 {
     kTimed = 0x0001, // Command received as part of a timed invoke interaction.
@@ -81,6 +81,16 @@ public:
     ///     - Validation of timed interaction required (also controlled by OperationFlags::kInternal)
     virtual ActionReturnStatus WriteAttribute(const WriteAttributeRequest & request, AttributeValueDecoder & decoder) = 0;
 
+    /// Brackets the WriteAttribute calls that write list attribute `path`.
+    ///
+    /// A list may be written by several calls: a chunked write replaces the list with an empty one and then appends its
+    /// items one by one, possibly across several WriteRequest messages.  kListWriteBegin comes before the first of these
+    /// calls and kListWriteSuccess or kListWriteFailure after the last, so that implementations can apply or persist the
+    /// list once, instead of on every item.
+    ///
+    /// Only one write of a given list is in progress at a time: the interaction model rejects conflicting writes as busy.
+    virtual void ListAttributeWriteNotification(const ConcreteAttributePath & path, ListWriteOperation operation) {}
+
     /// `handler` is used to send back the reply.
     ///    - returning `std::nullopt` means that return value was placed in handler directly.
     ///      This includes cases where command handling and value return will be done asynchronously.
@@ -97,6 +107,16 @@ public:
     virtual std::optional<ActionReturnStatus> Invoke(const InvokeRequest & request, chip::TLV::TLVReader & input_arguments,
                                                      CommandHandler * handler) = 0;
 
+    /// Invokes a group command on several endpoints at once. `request.path` is the path of the command on the first of
+    /// `endpoints`, all of which passed the command checks.
+    ///
+    /// Returns true if the command was handled for all the endpoints, false if it is to be invoked on each of them.
+    virtual bool InvokeGroup(const InvokeRequest & request, Span<const EndpointId> endpoints,
+                             chip::TLV::TLVReader & input_arguments, CommandHandler * handler)
+    {
+        return false;
+    }
+
 private:
     InteractionModelContext mContext = { nullptr };
 };
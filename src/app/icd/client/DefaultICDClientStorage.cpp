@@ -16,7 +16,9 @@
  */
 
 #include <app/icd/client/DefaultICDClientStorage.h>
+#include <algorithm>
 #include <iterator>
+#include <lib/core/CHIPEncoding.h>
 #include <lib/core/Global.h>
 #include <lib/support/Base64.h>
 #include <lib/support/CodeUtils.h>
@@ -114,13 +116,11 @@ size_t DefaultICDClientStorage::ICDClientInfoIteratorImpl::Count()
     size_t total = 0;
     for (auto & fabric_idx : mManager.mFabricList)
     {
-        size_t count          = 0;
-        size_t clientInfoSize = 0;
-        if (mManager.LoadCounter(fabric_idx, count, clientInfoSize) != CHIP_NO_ERROR)
+        size_t count = 0;
+        if (mManager.LoadEntryCount(fabric_idx, count) != CHIP_NO_ERROR)
         {
             return 0;
         };
-        IgnoreUnusedVariable(clientInfoSize);
         total += count;
     }
 
@@ -211,8 +211,40 @@ CHIP_ERROR DefaultICDClientStorage::LoadCounter(FabricIndex fabricIndex, size_t
     return reader.VerifyEndOfContainer();
 }
 
+CHIP_ERROR DefaultICDClientStorage::LoadEntryCount(FabricIndex fabricIndex, size_t & count)
+{
+    if (mWriteBehind)
+    {
+        FabricCache * fabricCache = nullptr;
+        ReturnErrorOnFailure(GetFabricCache(fabricIndex, fabricCache));
+        count = fabricCache->clientInfoVector.size();
+        return CHIP_NO_ERROR;
+    }
+
+    size_t clientInfoSize = 0;
+    ReturnErrorOnFailure(LoadCounter(fabricIndex, count, clientInfoSize));
+    IgnoreUnusedVariable(clientInfoSize);
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR DefaultICDClientStorage::Load(FabricIndex fabricIndex, std::vector<ICDClientInfo> & clientInfoVector,
                                          size_t & clientInfoSize)
+{
+    if (mWriteBehind)
+    {
+        FabricCache * fabricCache = nullptr;
+        ReturnErrorOnFailure(GetFabricCache(fabricIndex, fabricCache));
+        clientInfoVector.insert(clientInfoVector.end(), fabricCache->clientInfoVector.begin(),
+                                fabricCache->clientInfoVector.end());
+        clientInfoSize = MaxICDClientInfoSize();
+        return CHIP_NO_ERROR;
+    }
+
+    return LoadFromStorage(fabricIndex, clientInfoVector, clientInfoSize);
+}
+
+CHIP_ERROR DefaultICDClientStorage::LoadFromStorage(FabricIndex fabricIndex, std::vector<ICDClientInfo> & clientInfoVector,
+                                                    size_t & clientInfoSize)
 {
     size_t count = 0;
     ReturnErrorOnFailure(LoadCounter(fabricIndex, count, clientInfoSize));
@@ -362,23 +394,9 @@ bool DefaultICDClientStorage::FabricExists(FabricIndex fabricIndex)
     return false;
 }
 
-CHIP_ERROR DefaultICDClientStorage::StoreEntry(const ICDClientInfo & clientInfo)
+CHIP_ERROR DefaultICDClientStorage::StoreClientInfos(FabricIndex fabricIndex, const std::vector<ICDClientInfo> & clientInfoVector,
+                                                     size_t clientInfoSize)
 {
-    VerifyOrReturnError(FabricExists(clientInfo.peer_node.GetFabricIndex()), CHIP_ERROR_INVALID_FABRIC_INDEX);
-    std::vector<ICDClientInfo> clientInfoVector;
-    size_t clientInfoSize = MaxICDClientInfoSize();
-    ReturnErrorOnFailure(Load(clientInfo.peer_node.GetFabricIndex(), clientInfoVector, clientInfoSize));
-
-    for (auto it = clientInfoVector.begin(); it != clientInfoVector.end(); it++)
-    {
-        if (clientInfo.peer_node.GetNodeId() == it->peer_node.GetNodeId())
-        {
-            ReturnErrorOnFailure(DecreaseEntryCountForFabric(clientInfo.peer_node.GetFabricIndex()));
-            clientInfoVector.erase(it);
-            break;
-        }
-    }
-    clientInfoVector.push_back(clientInfo);
     size_t total = clientInfoSize * clientInfoVector.size() + kArrayOverHead;
     Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
     VerifyOrReturnError(backingBuffer.Calloc(total), CHIP_ERROR_NO_MEMORY);
@@ -390,11 +408,55 @@ CHIP_ERROR DefaultICDClientStorage::StoreEntry(const ICDClientInfo & clientInfo)
     VerifyOrReturnError(CanCastTo<uint16_t>(len), CHIP_ERROR_BUFFER_TOO_SMALL);
 
     ReturnErrorOnFailure(writer.Finalize(backingBuffer));
-    ReturnErrorOnFailure(mpClientInfoStore->SyncSetKeyValue(
-        DefaultStorageKeyAllocator::ICDClientInfoKey(clientInfo.peer_node.GetFabricIndex()).KeyName(), backingBuffer.Get(),
-        static_cast<uint16_t>(len)));
+    return mpClientInfoStore->SyncSetKeyValue(DefaultStorageKeyAllocator::ICDClientInfoKey(fabricIndex).KeyName(),
+                                              backingBuffer.Get(), static_cast<uint16_t>(len));
+}
 
-    ReturnErrorOnFailure(IncreaseEntryCountForFabric(clientInfo.peer_node.GetFabricIndex()));
+CHIP_ERROR DefaultICDClientStorage::StoreEntry(const ICDClientInfo & clientInfo)
+{
+    VerifyOrReturnError(FabricExists(clientInfo.peer_node.GetFabricIndex()), CHIP_ERROR_INVALID_FABRIC_INDEX);
+    if (mWriteBehind)
+    {
+        FabricCache * fabricCache = nullptr;
+        ReturnErrorOnFailure(GetFabricCache(clientInfo.peer_node.GetFabricIndex(), fabricCache));
+        auto it = std::find_if(fabricCache->clientInfoVector.begin(), fabricCache->clientInfoVector.end(),
+                               [&](const ICDClientInfo & info) { return info.peer_node == clientInfo.peer_node; });
+        if (it != fabricCache->clientInfoVector.end())
+        {
+            *it = clientInfo;
+        }
+        else
+        {
+            fabricCache->clientInfoVector.push_back(clientInfo);
+        }
+        fabricCache->dirty = true;
+        ScheduleFlush();
+    }
+    else
+    {
+        std::vector<ICDClientInfo> clientInfoVector;
+        size_t clientInfoSize = MaxICDClientInfoSize();
+        ReturnErrorOnFailure(Load(clientInfo.peer_node.GetFabricIndex(), clientInfoVector, clientInfoSize));
+
+        for (auto it = clientInfoVector.begin(); it != clientInfoVector.end(); it++)
+        {
+            if (clientInfo.peer_node.GetNodeId() == it->peer_node.GetNodeId())
+            {
+                ReturnErrorOnFailure(DecreaseEntryCountForFabric(clientInfo.peer_node.GetFabricIndex()));
+                clientInfoVector.erase(it);
+                break;
+            }
+        }
+        clientInfoVector.push_back(clientInfo);
+        ReturnErrorOnFailure(StoreClientInfos(clientInfo.peer_node.GetFabricIndex(), clientInfoVector, clientInfoSize));
+        ReturnErrorOnFailure(IncreaseEntryCountForFabric(clientInfo.peer_node.GetFabricIndex()));
+    }
+
+    if (mCheckInIndexBuilt)
+    {
+        RemoveFromCheckInIndex(clientInfo.peer_node);
+        AddToCheckInIndex(clientInfo);
+    }
     ChipLogProgress(ICD,
                     "Store ICD entry successfully with peer nodeId " ChipLogFormatScopedNodeId
                     " and checkin nodeId " ChipLogFormatScopedNodeId,
@@ -426,6 +488,11 @@ CHIP_ERROR DefaultICDClientStorage::UpdateEntryCountForFabric(FabricIndex fabric
         count--;
     }
 
+    return StoreCounter(fabricIndex, count, clientInfoSize);
+}
+
+CHIP_ERROR DefaultICDClientStorage::StoreCounter(FabricIndex fabricIndex, size_t count, size_t clientInfoSize)
+{
     size_t total = MaxICDCounterSize();
     Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
     VerifyOrReturnError(backingBuffer.Calloc(total), CHIP_ERROR_NO_MEMORY);
@@ -448,6 +515,23 @@ CHIP_ERROR DefaultICDClientStorage::UpdateEntryCountForFabric(FabricIndex fabric
 CHIP_ERROR DefaultICDClientStorage::DeleteEntry(const ScopedNodeId & peerNode)
 {
     VerifyOrReturnError(FabricExists(peerNode.GetFabricIndex()), CHIP_NO_ERROR);
+    if (mWriteBehind)
+    {
+        FabricCache * fabricCache = nullptr;
+        ReturnErrorOnFailure(GetFabricCache(peerNode.GetFabricIndex(), fabricCache));
+        auto it = std::find_if(fabricCache->clientInfoVector.begin(), fabricCache->clientInfoVector.end(),
+                               [&](const ICDClientInfo & info) { return info.peer_node == peerNode; });
+        VerifyOrReturnError(it != fabricCache->clientInfoVector.end(), CHIP_NO_ERROR);
+        RemoveKey(*it);
+        fabricCache->clientInfoVector.erase(it);
+        fabricCache->dirty = true;
+        ScheduleFlush();
+        RemoveFromCheckInIndex(peerNode);
+        ChipLogProgress(ICD, "Remove ICD entry successfully with peer nodeId " ChipLogFormatScopedNodeId,
+                        ChipLogValueScopedNodeId(peerNode));
+        return CHIP_NO_ERROR;
+    }
+
     size_t clientInfoSize = 0;
     std::vector<ICDClientInfo> clientInfoVector;
     ReturnErrorOnFailure(Load(peerNode.GetFabricIndex(), clientInfoVector, clientInfoSize));
@@ -465,22 +549,10 @@ CHIP_ERROR DefaultICDClientStorage::DeleteEntry(const ScopedNodeId & peerNode)
 
     ReturnErrorOnFailure(
         mpClientInfoStore->SyncDeleteKeyValue(DefaultStorageKeyAllocator::ICDClientInfoKey(peerNode.GetFabricIndex()).KeyName()));
-    size_t total = clientInfoSize * clientInfoVector.size() + kArrayOverHead;
-    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
-    VerifyOrReturnError(backingBuffer.Calloc(total), CHIP_ERROR_NO_MEMORY);
-    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), total);
-
-    ReturnErrorOnFailure(SerializeToTlv(writer, clientInfoVector));
-
-    const auto len = writer.GetLengthWritten();
-    VerifyOrReturnError(CanCastTo<uint16_t>(len), CHIP_ERROR_BUFFER_TOO_SMALL);
-
-    ReturnErrorOnFailure(writer.Finalize(backingBuffer));
-    ReturnErrorOnFailure(
-        mpClientInfoStore->SyncSetKeyValue(DefaultStorageKeyAllocator::ICDClientInfoKey(peerNode.GetFabricIndex()).KeyName(),
-                                           backingBuffer.Get(), static_cast<uint16_t>(len)));
+    ReturnErrorOnFailure(StoreClientInfos(peerNode.GetFabricIndex(), clientInfoVector, clientInfoSize));
 
     ReturnErrorOnFailure(DecreaseEntryCountForFabric(peerNode.GetFabricIndex()));
+    RemoveFromCheckInIndex(peerNode);
     ChipLogProgress(ICD, "Remove ICD entry successfully with peer nodeId " ChipLogFormatScopedNodeId,
                     ChipLogValueScopedNodeId(peerNode));
     return CHIP_NO_ERROR;
@@ -502,6 +574,8 @@ CHIP_ERROR DefaultICDClientStorage::DeleteAllEntries(FabricIndex fabricIndex)
         mpClientInfoStore->SyncDeleteKeyValue(DefaultStorageKeyAllocator::ICDClientInfoKey(fabricIndex).KeyName()));
     ReturnErrorOnFailure(
         mpClientInfoStore->SyncDeleteKeyValue(DefaultStorageKeyAllocator::FabricICDClientInfoCounter(fabricIndex).KeyName()));
+    RemoveFromCheckInIndex(fabricIndex);
+    RemoveFabricCache(fabricIndex);
 
     for (auto fabric = mFabricList.begin(); fabric != mFabricList.end(); fabric++)
     {
@@ -527,6 +601,27 @@ CHIP_ERROR DefaultICDClientStorage::ProcessCheckInPayload(const ByteSpan & paylo
 {
     uint8_t appDataBuffer[kAppDataLength];
     MutableByteSpan appData(appDataBuffer);
+
+    if (kCheckInIndexWindow > 0 && payload.size() >= sizeof(uint32_t))
+    {
+        if (!mCheckInIndexBuilt)
+        {
+            BuildCheckInIndex();
+        }
+
+        const uint32_t nonceTag = Encoding::LittleEndian::Get32(payload.data());
+        for (const auto & entry : mCheckInIndex)
+        {
+            if (entry.nonceTag == nonceTag && LoadEntry(entry.peerNode, clientInfo) == CHIP_NO_ERROR &&
+                chip::Protocols::SecureChannel::CheckinMessage::ParseCheckinMessagePayload(
+                    clientInfo.aes_key_handle, clientInfo.hmac_key_handle, payload, counter, appData) == CHIP_NO_ERROR)
+            {
+                return CHIP_NO_ERROR;
+            }
+        }
+    }
+
+    // Not indexed, e.g. because the ICD sent check-in messages to its other clients in between: try every key.
     auto * iterator = IterateICDClientInfo();
     VerifyOrReturnError(iterator != nullptr, CHIP_ERROR_NO_MEMORY);
     while (iterator->Next(clientInfo))
@@ -543,12 +638,167 @@ CHIP_ERROR DefaultICDClientStorage::ProcessCheckInPayload(const ByteSpan & paylo
     return CHIP_ERROR_NOT_FOUND;
 }
 
+CHIP_ERROR DefaultICDClientStorage::LoadEntry(const ScopedNodeId & peerNode, ICDClientInfo & clientInfo)
+{
+    size_t clientInfoSize = 0;
+    std::vector<ICDClientInfo> clientInfoVector;
+    ReturnErrorOnFailure(Load(peerNode.GetFabricIndex(), clientInfoVector, clientInfoSize));
+    IgnoreUnusedVariable(clientInfoSize);
+    for (const auto & info : clientInfoVector)
+    {
+        if (info.peer_node == peerNode)
+        {
+            clientInfo = info;
+            return CHIP_NO_ERROR;
+        }
+    }
+    return CHIP_ERROR_NOT_FOUND;
+}
+
+void DefaultICDClientStorage::BuildCheckInIndex()
+{
+    auto * iterator = IterateICDClientInfo();
+    VerifyOrReturn(iterator != nullptr);
+
+    mCheckInIndex.clear();
+    mCheckInIndex.reserve(iterator->Count() * kCheckInIndexWindow);
+    ICDClientInfo clientInfo;
+    while (iterator->Next(clientInfo))
+    {
+        AddToCheckInIndex(clientInfo);
+    }
+    iterator->Release();
+    mCheckInIndexBuilt = true;
+}
+
+void DefaultICDClientStorage::AddToCheckInIndex(const ICDClientInfo & clientInfo)
+{
+    using Protocols::SecureChannel::CheckinMessage;
+    using Protocols::SecureChannel::CounterType;
+
+    // The counters of the next check-in messages the client accepts, see CheckInHandler
+    const CounterType lastCounter = clientInfo.start_icd_counter + clientInfo.offset;
+    for (CounterType i = 1; i <= kCheckInIndexWindow; i++)
+    {
+        uint8_t nonce[Crypto::CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES];
+        Encoding::LittleEndian::BufferWriter writer(nonce, sizeof(nonce));
+        // A client left out of the index is still found by trying every key
+        VerifyOrReturn(CheckinMessage::GenerateCheckInMessageNonce(clientInfo.hmac_key_handle, lastCounter + i, writer) ==
+                       CHIP_NO_ERROR);
+        mCheckInIndex.push_back({ Encoding::LittleEndian::Get32(nonce), clientInfo.peer_node });
+    }
+}
+
+void DefaultICDClientStorage::RemoveFromCheckInIndex(const ScopedNodeId & peerNode)
+{
+    mCheckInIndex.erase(std::remove_if(mCheckInIndex.begin(), mCheckInIndex.end(),
+                                       [&](const CheckInIndexEntry & entry) { return entry.peerNode == peerNode; }),
+                        mCheckInIndex.end());
+}
+
+void DefaultICDClientStorage::RemoveFromCheckInIndex(FabricIndex fabricIndex)
+{
+    mCheckInIndex.erase(std::remove_if(
+                            mCheckInIndex.begin(), mCheckInIndex.end(),
+                            [&](const CheckInIndexEntry & entry) { return entry.peerNode.GetFabricIndex() == fabricIndex; }),
+                        mCheckInIndex.end());
+}
+
+CHIP_ERROR DefaultICDClientStorage::EnableWriteBehind(System::Layer * systemLayer, System::Clock::Timeout flushDelay)
+{
+    VerifyOrReturnError(mpClientInfoStore != nullptr && !mWriteBehind, CHIP_ERROR_INCORRECT_STATE);
+    mWriteBehind  = true;
+    mpSystemLayer = systemLayer;
+    mFlushDelay   = flushDelay;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DefaultICDClientStorage::GetFabricCache(FabricIndex fabricIndex, FabricCache *& fabricCache)
+{
+    for (auto & fabric : mFabricCache)
+    {
+        if (fabric.fabricIndex == fabricIndex)
+        {
+            fabricCache = &fabric;
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    FabricCache newFabricCache{ fabricIndex, {}, false };
+    size_t clientInfoSize = 0;
+    ReturnErrorOnFailure(LoadFromStorage(fabricIndex, newFabricCache.clientInfoVector, clientInfoSize));
+    IgnoreUnusedVariable(clientInfoSize);
+    mFabricCache.push_back(std::move(newFabricCache));
+    fabricCache = &mFabricCache.back();
+    return CHIP_NO_ERROR;
+}
+
+void DefaultICDClientStorage::RemoveFabricCache(FabricIndex fabricIndex)
+{
+    mFabricCache.erase(std::remove_if(mFabricCache.begin(), mFabricCache.end(),
+                                      [&](const FabricCache & fabric) { return fabric.fabricIndex == fabricIndex; }),
+                       mFabricCache.end());
+}
+
+void DefaultICDClientStorage::ScheduleFlush()
+{
+    VerifyOrReturn(mpSystemLayer != nullptr);
+    // Only the first change since the last flush starts the timer, so that a flush is not pushed back forever.
+    VerifyOrReturn(!mpSystemLayer->IsTimerActive(OnFlushTimer, this));
+    CHIP_ERROR err = mpSystemLayer->StartTimer(mFlushDelay, OnFlushTimer, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(ICD, "Failed to schedule the ICD client info flush: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+void DefaultICDClientStorage::OnFlushTimer(System::Layer * systemLayer, void * appState)
+{
+    CHIP_ERROR err = static_cast<DefaultICDClientStorage *>(appState)->Flush();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(ICD, "Failed to flush the ICD client info: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+CHIP_ERROR DefaultICDClientStorage::Flush()
+{
+    for (auto & fabric : mFabricCache)
+    {
+        if (!fabric.dirty)
+        {
+            continue;
+        }
+        ReturnErrorOnFailure(StoreClientInfos(fabric.fabricIndex, fabric.clientInfoVector, MaxICDClientInfoSize()));
+        ReturnErrorOnFailure(StoreCounter(fabric.fabricIndex, fabric.clientInfoVector.size(), MaxICDClientInfoSize()));
+        fabric.dirty = false;
+    }
+    return CHIP_NO_ERROR;
+}
+
 void DefaultICDClientStorage::Shutdown()
 {
+    if (mWriteBehind)
+    {
+        if (mpSystemLayer != nullptr)
+        {
+            mpSystemLayer->CancelTimer(OnFlushTimer, this);
+        }
+        CHIP_ERROR err = Flush();
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(ICD, "Failed to flush the ICD client info: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+        mFabricCache.clear();
+        mWriteBehind  = false;
+        mpSystemLayer = nullptr;
+    }
     mICDClientInfoIterators.ReleaseAll();
     mpClientInfoStore = nullptr;
     mpKeyStore        = nullptr;
     mFabricList.clear();
+    mCheckInIndex.clear();
+    mCheckInIndexBuilt = false;
 }
 
 } // namespace app
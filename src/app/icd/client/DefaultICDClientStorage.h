@@ -33,6 +33,10 @@
 #include <lib/core/TLV.h>
 #include <lib/support/CommonIterator.h>
 #include <lib/support/Pool.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+#include <algorithm>
 #include <vector>
 
 // TODO: SymmetricKeystore is an alias for SessionKeystore, replace the below when sdk supports SymmetricKeystore
@@ -77,6 +81,8 @@ public:
 
     static constexpr size_t kIteratorsMax = CHIP_CONFIG_MAX_ICD_CLIENTS_INFO_STORAGE_CONCURRENT_ITERATORS;
 
+    static constexpr Protocols::SecureChannel::CounterType kCheckInIndexWindow = CHIP_CONFIG_ICD_CLIENT_CHECK_IN_INDEX_WINDOW;
+
     CHIP_ERROR Init(PersistentStorageDelegate * clientInfoStore, Crypto::SymmetricKeystore * keyStore);
 
     /**
@@ -120,6 +126,26 @@ public:
     CHIP_ERROR ProcessCheckInPayload(const ByteSpan & payload, ICDClientInfo & clientInfo,
                                      Protocols::SecureChannel::CounterType & counter) override;
 
+    /**
+     * Keep the ICD client infos in RAM and write the changes behind. StoreEntry and DeleteEntry then only update the
+     * entries held in RAM and mark their fabric dirty, instead of rewriting the whole list of the fabric to the storage on
+     * every call, e.g. on every check-in counter update. The dirty fabrics are written by Flush, which runs flushDelay after
+     * the first change when a system layer is given, and on Shutdown. The storage format is unchanged.
+     *
+     * The changes made since the last flush are lost if the process stops before the next one.
+     *
+     * Must be called after Init.
+     *
+     * @param[in] systemLayer The system layer to schedule the flushes on, or nullptr to only flush when Flush is called.
+     * @param[in] flushDelay  How long after the first change the dirty fabrics are written.
+     */
+    CHIP_ERROR EnableWriteBehind(System::Layer * systemLayer, System::Clock::Timeout flushDelay);
+
+    /**
+     * Write the fabrics whose entries changed since the last flush to the storage. No-op unless EnableWriteBehind was called.
+     */
+    CHIP_ERROR Flush();
+
     /**
      * Shut down DefaultICDClientStorage
      *
@@ -130,6 +156,13 @@ public:
     size_t GetFabricListSize() { return mFabricList.size(); }
 
     PersistentStorageDelegate * GetClientInfoStore() { return mpClientInfoStore; }
+
+    size_t GetCheckInIndexSize() { return mCheckInIndex.size(); }
+
+    bool HasPendingWrites()
+    {
+        return std::any_of(mFabricCache.begin(), mFabricCache.end(), [](const FabricCache & fabric) { return fabric.dirty; });
+    }
 #endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
 
 protected:
@@ -194,15 +227,55 @@ private:
     CHIP_ERROR IncreaseEntryCountForFabric(FabricIndex fabricIndex);
     CHIP_ERROR DecreaseEntryCountForFabric(FabricIndex fabricIndex);
     CHIP_ERROR UpdateEntryCountForFabric(FabricIndex fabricIndex, bool increase);
+    CHIP_ERROR StoreCounter(FabricIndex fabricIndex, size_t count, size_t clientInfoSize);
+    CHIP_ERROR LoadEntryCount(FabricIndex fabricIndex, size_t & count);
 
     CHIP_ERROR SerializeToTlv(TLV::TLVWriter & writer, const std::vector<ICDClientInfo> & clientInfoVector);
+    CHIP_ERROR StoreClientInfos(FabricIndex fabricIndex, const std::vector<ICDClientInfo> & clientInfoVector,
+                                size_t clientInfoSize);
     CHIP_ERROR Load(FabricIndex fabricIndex, std::vector<ICDClientInfo> & clientInfoVector, size_t & clientInfoSize);
+    CHIP_ERROR LoadFromStorage(FabricIndex fabricIndex, std::vector<ICDClientInfo> & clientInfoVector, size_t & clientInfoSize);
+    CHIP_ERROR LoadEntry(const ScopedNodeId & peerNode, ICDClientInfo & clientInfo);
+
+    // The check-in index maps the first bytes of the nonces of the next check-in messages of each client to the client, so
+    // that a check-in message is only decrypted with the keys of the clients that can have sent it. It is built on the first
+    // check-in message, and then kept up to date with the stored entries.
+    struct CheckInIndexEntry
+    {
+        uint32_t nonceTag;
+        ScopedNodeId peerNode;
+    };
+
+    void BuildCheckInIndex();
+    void AddToCheckInIndex(const ICDClientInfo & clientInfo);
+    void RemoveFromCheckInIndex(const ScopedNodeId & peerNode);
+    void RemoveFromCheckInIndex(FabricIndex fabricIndex);
+
+    // The entries of a fabric held in RAM when the changes are written behind, loaded on the first access to the fabric.
+    struct FabricCache
+    {
+        FabricIndex fabricIndex;
+        std::vector<ICDClientInfo> clientInfoVector;
+        bool dirty;
+    };
+
+    CHIP_ERROR GetFabricCache(FabricIndex fabricIndex, FabricCache *& fabricCache);
+    void RemoveFabricCache(FabricIndex fabricIndex);
+    void ScheduleFlush();
+    static void OnFlushTimer(System::Layer * systemLayer, void * appState);
 
     ObjectPool<ICDClientInfoIteratorImpl, kIteratorsMax> mICDClientInfoIterators;
 
     PersistentStorageDelegate * mpClientInfoStore = nullptr;
     Crypto::SymmetricKeystore * mpKeyStore        = nullptr;
     std::vector<FabricIndex> mFabricList;
+    std::vector<CheckInIndexEntry> mCheckInIndex;
+    bool mCheckInIndexBuilt = false;
+
+    bool mWriteBehind                  = false;
+    System::Layer * mpSystemLayer      = nullptr;
+    System::Clock::Timeout mFlushDelay = System::Clock::kZero;
+    std::vector<FabricCache> mFabricCache;
 };
 } // namespace app
 } // namespace chip
@@ -27,6 +27,10 @@
 #include <platform/ConnectivityManager.h>
 #include <platform/LockTracker.h>
 #include <platform/internal/CHIPDeviceLayerInternal.h>
+#include <tracing/metric_event.h>
+#include <tracing/metric_keys.h>
+
+#include <algorithm>
 
 namespace {
 enum class ICDTestEventTriggerEvent : uint64_t
@@ -67,6 +71,9 @@ void ICDManager::Init()
     VerifyOrDie(ICDConfigurationData::GetInstance().GetICDCounter().Init(mStorage, DefaultStorageKeyAllocator::ICDCheckInCounter(),
                                                                          ICDConfigurationData::kICDCounterPersistenceIncrement) ==
                 CHIP_NO_ERROR);
+
+    // Check-In messages are sent on each wake-up, keep their clients in RAM
+    ICDMonitoringTable::EnableCache(*mStorage);
 #endif // CHIP_CONFIG_ENABLE_ICD_CIP
 
 #if CHIP_CONFIG_ENABLE_ICD_LIT
@@ -102,7 +109,11 @@ void ICDManager::Shutdown()
     mOperationalState = OperationalState::ActiveMode;
     mStateObserverPool.ReleaseAll();
 
+    mActiveModeStartTime.ClearValue();
+    mActiveModeStatistics = ActiveModeStatistics();
+
 #if CHIP_CONFIG_ENABLE_ICD_CIP
+    ICDMonitoringTable::DisableCache();
     mStorage         = nullptr;
     mFabricTable     = nullptr;
     mSubInfoProvider = nullptr;
@@ -134,6 +145,9 @@ uint32_t ICDManager::StayActiveRequest(uint32_t stayActiveDuration)
     uint32_t promisedActiveDuration =
         std::min(ICDConfigurationData::GetInstance().GetGuaranteedStayActiveDuration().count(), stayActiveDuration);
 
+    mActiveModeExtensions++;
+    mActiveModeStatistics.extensions[to_underlying(ActiveModeTrigger::kStayActiveRequest)]++;
+
     // If the device is already in ActiveMode, we need to extend the active mode duration
     // for whichever is smallest between 30000 milliseconds and stayActiveDuration, taking in account the remaining active time.
     ExtendActiveMode(System::Clock::Milliseconds16(promisedActiveDuration));
@@ -216,6 +230,13 @@ void ICDManager::SendCheckInMsgs()
 #endif // !(CONFIG_BUILD_FOR_HOST_UNIT_TEST)
 }
 
+bool ICDManager::IsCheckInClientRegistered(FabricIndex aFabricIndex, NodeId aSubjectID)
+{
+    return CheckInMessagesWouldBeSent([aFabricIndex, aSubjectID](FabricIndex fabricIndex, NodeId subjectID) {
+        return fabricIndex == aFabricIndex && subjectID == aSubjectID;
+    });
+}
+
 bool ICDManager::CheckInMessagesWouldBeSent(const std::function<ShouldCheckInMsgsBeSentFunction> & shouldCheckInMsgsBeSentFunction)
 {
     VerifyOrReturnValue(shouldCheckInMsgsBeSentFunction, false);
@@ -352,7 +373,7 @@ void ICDManager::TriggerCheckInMessages(const std::function<ShouldCheckInMsgsBeS
 
     // If we don't have any Check-In messages to send, do nothing
     VerifyOrReturn(CheckInMessagesWouldBeSent(verifier));
-    UpdateOperationState(OperationalState::ActiveMode);
+    UpdateOperationState(OperationalState::ActiveMode, ActiveModeTrigger::kCheckIn);
 }
 #endif // CHIP_CONFIG_ENABLE_ICD_CIP
 
@@ -412,7 +433,7 @@ void ICDManager::UpdateICDMode()
     }
 }
 
-void ICDManager::UpdateOperationState(OperationalState state)
+void ICDManager::UpdateOperationState(OperationalState state, ActiveModeTrigger trigger)
 {
     assertChipStackLockedByCurrentThread();
     // Active mode can be re-triggered.
@@ -421,6 +442,7 @@ void ICDManager::UpdateOperationState(OperationalState state)
     if (state == OperationalState::IdleMode)
     {
         mOperationalState = OperationalState::IdleMode;
+        EndActiveModeAccounting();
 
 #if CHIP_CONFIG_ENABLE_ICD_CIP
         std::function<ShouldCheckInMsgsBeSentFunction> sendCheckInMessagesOnActiveMode =
@@ -464,6 +486,11 @@ void ICDManager::UpdateOperationState(OperationalState state)
             mOperationalState                 = OperationalState::ActiveMode;
             Milliseconds32 activeModeDuration = ICDConfigurationData::GetInstance().GetActiveModeDuration();
 
+            mActiveModeStartTime.SetValue(System::SystemClock().GetMonotonicTimestamp());
+            mActiveModeTrigger    = trigger;
+            mActiveModeExtensions = 0;
+            mActiveModeStatistics.activations[to_underlying(trigger)]++;
+
             if (activeModeDuration == kZero && !mKeepActiveFlags.HasAny())
             {
                 // Network Activity triggered the active mode and activeModeDuration is 0.
@@ -502,11 +529,33 @@ void ICDManager::UpdateOperationState(OperationalState state)
         }
         else
         {
+            mActiveModeExtensions++;
+            mActiveModeStatistics.extensions[to_underlying(trigger)]++;
             ExtendActiveMode(ICDConfigurationData::GetInstance().GetActiveModeThreshold());
         }
     }
 }
 
+void ICDManager::EndActiveModeAccounting()
+{
+    // The ICD starts in ActiveMode at boot, before any trigger
+    VerifyOrReturn(mActiveModeStartTime.HasValue());
+
+    Milliseconds64 duration = System::SystemClock().GetMonotonicTimestamp() - mActiveModeStartTime.Value();
+    size_t trigger          = to_underlying(mActiveModeTrigger);
+    mActiveModeStartTime.ClearValue();
+    mActiveModeStatistics.activeTimeMs[trigger] += duration.count();
+
+    MATTER_LOG_METRIC(Tracing::kMetricICDActiveModeTrigger, static_cast<uint32_t>(trigger));
+    MATTER_LOG_METRIC(Tracing::kMetricICDActiveModeDuration,
+                      static_cast<uint32_t>(std::min<uint64_t>(duration.count(), UINT32_MAX)));
+    MATTER_LOG_METRIC(Tracing::kMetricICDActiveModeExtensions, mActiveModeExtensions);
+    MATTER_LOG_METRIC(Tracing::kMetricICDActiveModeTriggerActivations, mActiveModeStatistics.activations[trigger]);
+    MATTER_LOG_METRIC(Tracing::kMetricICDActiveModeTriggerExtensions, mActiveModeStatistics.extensions[trigger]);
+    MATTER_LOG_METRIC(Tracing::kMetricICDActiveModeTriggerTime,
+                      static_cast<uint32_t>(std::min<uint64_t>(mActiveModeStatistics.activeTimeMs[trigger], UINT32_MAX)));
+}
+
 void ICDManager::SetKeepActiveModeRequirements(KeepActiveFlags flag, bool state)
 {
     assertChipStackLockedByCurrentThread();
@@ -514,7 +563,7 @@ void ICDManager::SetKeepActiveModeRequirements(KeepActiveFlags flag, bool state)
     mKeepActiveFlags.Set(flag, state);
     if (mOperationalState == OperationalState::IdleMode && mKeepActiveFlags.HasAny())
     {
-        UpdateOperationState(OperationalState::ActiveMode);
+        UpdateOperationState(OperationalState::ActiveMode, ActiveModeTrigger::kKeepActiveRequest);
     }
     else if (mOperationalState == OperationalState::ActiveMode && !mKeepActiveFlags.HasAny() &&
              !DeviceLayer::SystemLayer().IsTimerActive(OnActiveModeDone, this))
@@ -527,7 +576,7 @@ void ICDManager::SetKeepActiveModeRequirements(KeepActiveFlags flag, bool state)
 void ICDManager::OnIdleModeDone(System::Layer * aLayer, void * appState)
 {
     ICDManager * pICDManager = reinterpret_cast<ICDManager *>(appState);
-    pICDManager->UpdateOperationState(OperationalState::ActiveMode);
+    pICDManager->UpdateOperationState(OperationalState::ActiveMode, ActiveModeTrigger::kIdleModeDone);
 }
 
 void ICDManager::OnActiveModeDone(System::Layer * aLayer, void * appState)
@@ -636,7 +685,7 @@ void ICDManager::OnSITModeRequest()
     mSITModeRequested = true;
     this->UpdateICDMode();
     // Update the poll interval also to comply with SIT requirements
-    UpdateOperationState(OperationalState::ActiveMode);
+    UpdateOperationState(OperationalState::ActiveMode, ActiveModeTrigger::kSITModeRequest);
 }
 
 void ICDManager::OnSITModeRequestWithdrawal()
@@ -644,13 +693,13 @@ void ICDManager::OnSITModeRequestWithdrawal()
     mSITModeRequested = false;
     this->UpdateICDMode();
     // Update the poll interval also to comply with LIT requirements
-    UpdateOperationState(OperationalState::ActiveMode);
+    UpdateOperationState(OperationalState::ActiveMode, ActiveModeTrigger::kSITModeRequest);
 }
 #endif // CHIP_CONFIG_ENABLE_ICD_DSLS
 
 void ICDManager::OnNetworkActivity()
 {
-    this->UpdateOperationState(OperationalState::ActiveMode);
+    this->UpdateOperationState(OperationalState::ActiveMode, ActiveModeTrigger::kNetworkActivity);
 }
 
 void ICDManager::OnICDManagementServerEvent(ICDManagementEvents event)
@@ -671,7 +720,7 @@ void ICDManager::OnSubscriptionReport()
     // Since we only mark them dirty when we enter ActiveMode, it is not necessary to update the operational state a second time.
     // Doing so will only add an ActiveModeThreshold to the active time which we don't want to do here.
     VerifyOrReturn(mOperationalState == OperationalState::IdleMode);
-    this->UpdateOperationState(OperationalState::ActiveMode);
+    this->UpdateOperationState(OperationalState::ActiveMode, ActiveModeTrigger::kSubscriptionReport);
 }
 
 void ICDManager::ExtendActiveMode(Milliseconds16 extendDuration)
@@ -26,7 +26,9 @@
 #include <app/icd/server/ICDStateObserver.h>
 #include <credentials/FabricTable.h>
 #include <crypto/SessionKeystore.h>
+#include <lib/core/Optional.h>
 #include <lib/support/BitFlags.h>
+#include <lib/support/TypeTraits.h>
 #include <messaging/ExchangeMgr.h>
 #include <platform/CHIPDeviceConfig.h>
 #include <platform/internal/CHIPDeviceLayerInternal.h>
@@ -102,6 +104,40 @@ public:
         ICDModeChange,
     };
 
+    /**
+     * @brief Events that bring the ICD to ActiveMode or extend it, to which the ActiveMode time is attributed.
+     *
+     *        User-active mode triggers are reported by the applications as network activity, so they are accounted as
+     *        kNetworkActivity.
+     */
+    enum class ActiveModeTrigger : uint8_t
+    {
+        kIdleModeDone,       ///< The IdleMode duration expired
+        kCheckIn,            ///< Check-In messages had to be sent to registered clients
+        kSubscriptionReport, ///< A subscription report had to be sent
+        kNetworkActivity,    ///< Network activity or a user-active mode trigger
+        kKeepActiveRequest,  ///< A keep ActiveMode requirement, see ICDListener::KeepActiveFlags
+        kStayActiveRequest,  ///< A StayActiveRequest command
+        kSITModeRequest,     ///< A request to switch between SIT and LIT modes
+
+        kCount,
+    };
+
+    /**
+     * @brief Accounting of the ActiveMode time since the ICDManager initialization, per ActiveModeTrigger.
+     *
+     *        ActiveMode periods are attributed to the trigger that started them. Triggers received while the ICD is
+     *        already in ActiveMode are counted as extensions of the period.
+     */
+    struct ActiveModeStatistics
+    {
+        static constexpr size_t kTriggerCount = to_underlying(ActiveModeTrigger::kCount);
+
+        uint32_t activations[kTriggerCount]  = {}; ///< Number of ActiveMode periods started by each trigger
+        uint32_t extensions[kTriggerCount]   = {}; ///< Number of times each trigger extended an ActiveMode period
+        uint64_t activeTimeMs[kTriggerCount] = {}; ///< ActiveMode time of the periods started by each trigger
+    };
+
     /**
      * @brief Verifier template function
      *        This type can be used to implement specific verifiers that can be used in the CheckInMessagesWouldBeSent function.
@@ -200,6 +236,14 @@ public:
      */
     uint32_t StayActiveRequest(uint32_t stayActiveDuration);
 
+    /**
+     * @brief Returns the accounting of the ActiveMode time of the completed ActiveMode periods.
+     *
+     *        Each time an ActiveMode period ends, its trigger, duration and number of extensions are also logged as
+     *        kMetricICDActiveMode* tracing metrics, followed by the totals of the trigger.
+     */
+    const ActiveModeStatistics & GetActiveModeStatistics() const { return mActiveModeStatistics; }
+
     /**
      * @brief TestEventTriggerHandler for the ICD feature set
      *
@@ -218,6 +262,13 @@ public:
      */
     void TriggerCheckInMessages(const std::function<ShouldCheckInMsgsBeSentFunction> & function);
 
+    /**
+     * @brief Check whether the given subject has a registration that Check-In messages would be sent to
+     *
+     * @return true if a non-ephemeral client registered the subject on the fabric
+     */
+    bool IsCheckInClientRegistered(FabricIndex aFabricIndex, NodeId aSubjectID);
+
 #if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS && !CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
     /**
      * @brief Set mSubCheckInBootCheckExecuted to true
@@ -276,8 +327,14 @@ private:
      *        ActiveMode -> IdleMode   : Transition ICD to IdleMode and start the IdleMode timer.
      *
      * @param state requested OperationalState for the ICD to transition to
+     * @param trigger event requesting ActiveMode, to which the ActiveMode time is attributed. Unused for IdleMode.
+     */
+    void UpdateOperationState(OperationalState state, ActiveModeTrigger trigger = ActiveModeTrigger::kIdleModeDone);
+
+    /**
+     * @brief Accounts the ActiveMode period that just ended to its trigger and logs it as tracing metrics.
      */
-    void UpdateOperationState(OperationalState state);
+    void EndActiveModeAccounting();
 
     /**
      * @brief Set or Remove a keep ActiveMode requirement for the given flag
@@ -362,6 +419,12 @@ private:
     ObjectPool<ObserverPointer, CHIP_CONFIG_ICD_OBSERVERS_POOL_SIZE> mStateObserverPool;
     uint8_t mOpenExchangeContextCount = 0;
 
+    // Accounting of the current ActiveMode period
+    Optional<System::Clock::Timestamp> mActiveModeStartTime;
+    ActiveModeTrigger mActiveModeTrigger = ActiveModeTrigger::kIdleModeDone;
+    uint32_t mActiveModeExtensions       = 0;
+    ActiveModeStatistics mActiveModeStatistics;
+
 #if CHIP_CONFIG_ENABLE_ICD_DSLS
     bool mSITModeRequested = false;
 #endif
@@ -30,6 +30,112 @@ enum class Fields : uint8_t
     kClientType       = 5,
 };
 
+#if CHIP_CONFIG_ICD_MONITORING_TABLE_CACHE
+namespace {
+
+struct CachedEntry
+{
+    enum class State : uint8_t
+    {
+        kUnknown, ///< Not read from the storage yet
+        kPresent,
+        kAbsent,
+    };
+
+    State state                                             = State::kUnknown;
+    NodeId checkInNodeID                                    = kUndefinedNodeId;
+    uint64_t monitoredSubject                               = 0;
+    app::Clusters::IcdManagement::ClientTypeEnum clientType = app::Clusters::IcdManagement::ClientTypeEnum::kPermanent;
+    bool keyHandleValid                                     = false;
+    Crypto::Symmetric128BitsKeyByteArray aesKeyHandle;
+    Crypto::Symmetric128BitsKeyByteArray hmacKeyHandle;
+};
+
+struct CachedFabric
+{
+    FabricIndex fabricIndex = kUndefinedFabricIndex;
+    CachedEntry entries[CHIP_CONFIG_ICD_CLIENTS_SUPPORTED_PER_FABRIC];
+};
+
+PersistentStorageDelegate * gCachedStorage = nullptr;
+CachedFabric gCachedFabrics[CHIP_CONFIG_MAX_FABRICS];
+
+/**
+ * Returns the cache of the entry, allocating room for its fabric if needed, or nullptr if the entry cannot be cached.
+ */
+CachedEntry * GetCachedEntry(const PersistentStorageDelegate * storage, FabricIndex fabric, uint16_t index)
+{
+    VerifyOrReturnValue(storage != nullptr && storage == gCachedStorage, nullptr);
+    VerifyOrReturnValue(index < CHIP_CONFIG_ICD_CLIENTS_SUPPORTED_PER_FABRIC, nullptr);
+
+    CachedFabric * freeFabric = nullptr;
+    for (auto & cachedFabric : gCachedFabrics)
+    {
+        if (cachedFabric.fabricIndex == fabric)
+        {
+            return &cachedFabric.entries[index];
+        }
+        if (freeFabric == nullptr && cachedFabric.fabricIndex == kUndefinedFabricIndex)
+        {
+            freeFabric = &cachedFabric;
+        }
+    }
+
+    VerifyOrReturnValue(freeFabric != nullptr, nullptr);
+    *freeFabric             = CachedFabric();
+    freeFabric->fabricIndex = fabric;
+    return &freeFabric->entries[index];
+}
+
+void CacheEntry(CachedEntry & cachedEntry, const ICDMonitoringEntry & entry)
+{
+    cachedEntry.state            = CachedEntry::State::kPresent;
+    cachedEntry.checkInNodeID    = entry.checkInNodeID;
+    cachedEntry.monitoredSubject = entry.monitoredSubject;
+    cachedEntry.clientType       = entry.clientType;
+    cachedEntry.keyHandleValid   = entry.keyHandleValid;
+    memcpy(cachedEntry.aesKeyHandle, entry.aesKeyHandle.As<Crypto::Symmetric128BitsKeyByteArray>(),
+           sizeof(Crypto::Symmetric128BitsKeyByteArray));
+    memcpy(cachedEntry.hmacKeyHandle, entry.hmacKeyHandle.As<Crypto::Symmetric128BitsKeyByteArray>(),
+           sizeof(Crypto::Symmetric128BitsKeyByteArray));
+}
+
+void RestoreEntry(const CachedEntry & cachedEntry, ICDMonitoringEntry & entry)
+{
+    entry.checkInNodeID    = cachedEntry.checkInNodeID;
+    entry.monitoredSubject = cachedEntry.monitoredSubject;
+    entry.clientType       = cachedEntry.clientType;
+    entry.keyHandleValid   = cachedEntry.keyHandleValid;
+    memcpy(entry.aesKeyHandle.AsMutable<Crypto::Symmetric128BitsKeyByteArray>(), cachedEntry.aesKeyHandle,
+           sizeof(Crypto::Symmetric128BitsKeyByteArray));
+    memcpy(entry.hmacKeyHandle.AsMutable<Crypto::Symmetric128BitsKeyByteArray>(), cachedEntry.hmacKeyHandle,
+           sizeof(Crypto::Symmetric128BitsKeyByteArray));
+}
+
+void SetCachedEntryState(const PersistentStorageDelegate * storage, FabricIndex fabric, uint16_t index, CachedEntry::State state)
+{
+    CachedEntry * cachedEntry = GetCachedEntry(storage, fabric, index);
+    if (cachedEntry != nullptr)
+    {
+        cachedEntry->state = state;
+    }
+}
+
+void ReleaseCachedFabric(const PersistentStorageDelegate * storage, FabricIndex fabric)
+{
+    VerifyOrReturn(storage != nullptr && storage == gCachedStorage);
+    for (auto & cachedFabric : gCachedFabrics)
+    {
+        if (cachedFabric.fabricIndex == fabric)
+        {
+            cachedFabric = CachedFabric();
+        }
+    }
+}
+
+} // namespace
+#endif // CHIP_CONFIG_ICD_MONITORING_TABLE_CACHE
+
 CHIP_ERROR ICDMonitoringEntry::UpdateKey(StorageKeyName & skey)
 {
     VerifyOrReturnError(kUndefinedFabricIndex != this->fabricIndex, CHIP_ERROR_INVALID_FABRIC_INDEX);
@@ -235,8 +341,34 @@ CHIP_ERROR ICDMonitoringTable::Get(uint16_t index, ICDMonitoringEntry & entry) c
 {
     entry.fabricIndex = this->mFabric;
     entry.index       = index;
+
+#if CHIP_CONFIG_ICD_MONITORING_TABLE_CACHE
+    CachedEntry * cachedEntry = GetCachedEntry(this->mStorage, this->mFabric, index);
+    if (cachedEntry != nullptr && cachedEntry->state != CachedEntry::State::kUnknown)
+    {
+        entry.Clear();
+        VerifyOrReturnError(cachedEntry->state == CachedEntry::State::kPresent, CHIP_ERROR_NOT_FOUND);
+        RestoreEntry(*cachedEntry, entry);
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR err = entry.Load(this->mStorage);
+    if (cachedEntry != nullptr && err == CHIP_ERROR_NOT_FOUND)
+    {
+        cachedEntry->state = CachedEntry::State::kAbsent;
+    }
+    ReturnErrorOnFailure(err);
+    entry.fabricIndex = this->mFabric;
+
+    if (cachedEntry != nullptr)
+    {
+        CacheEntry(*cachedEntry, entry);
+    }
+#else
     ReturnErrorOnFailure(entry.Load(this->mStorage));
     entry.fabricIndex = this->mFabric;
+#endif // CHIP_CONFIG_ICD_MONITORING_TABLE_CACHE
+
     return CHIP_NO_ERROR;
 }
 
@@ -290,7 +422,25 @@ CHIP_ERROR ICDMonitoringTable::Set(uint16_t index, const ICDMonitoringEntry & en
         return error;
     }
 
+#if CHIP_CONFIG_ICD_MONITORING_TABLE_CACHE
+    e.keyHandleValid = true;
+    error            = e.Save(this->mStorage);
+
+    // The stored entry is unknown after a failed write
+    CachedEntry * cachedEntry = GetCachedEntry(this->mStorage, this->mFabric, index);
+    if (cachedEntry != nullptr)
+    {
+        cachedEntry->state = CachedEntry::State::kUnknown;
+        if (error == CHIP_NO_ERROR)
+        {
+            CacheEntry(*cachedEntry, e);
+        }
+    }
+
+    return error;
+#else
     return e.Save(this->mStorage);
+#endif // CHIP_CONFIG_ICD_MONITORING_TABLE_CACHE
 }
 
 CHIP_ERROR ICDMonitoringTable::Remove(uint16_t index)
@@ -313,7 +463,14 @@ CHIP_ERROR ICDMonitoringTable::Remove(uint16_t index)
     entry.index       = index;
 
     // entry.Delete() doesn't delete the key from the AES128KeyHandle
+#if CHIP_CONFIG_ICD_MONITORING_TABLE_CACHE
+    CHIP_ERROR error = entry.Delete(this->mStorage);
+    SetCachedEntryState(this->mStorage, this->mFabric, index,
+                        (error == CHIP_NO_ERROR) ? CachedEntry::State::kAbsent : CachedEntry::State::kUnknown);
+    return error;
+#else
     return entry.Delete(this->mStorage);
+#endif // CHIP_CONFIG_ICD_MONITORING_TABLE_CACHE
 }
 
 CHIP_ERROR ICDMonitoringTable::RemoveAll()
@@ -330,8 +487,21 @@ CHIP_ERROR ICDMonitoringTable::RemoveAll()
         ReturnErrorOnFailure(err);
         entry.fabricIndex = this->mFabric;
         ReturnErrorOnFailure(entry.DeleteKey());
+#if CHIP_CONFIG_ICD_MONITORING_TABLE_CACHE
+        err = entry.Delete(this->mStorage);
+        SetCachedEntryState(this->mStorage, this->mFabric, entry.index,
+                            (err == CHIP_NO_ERROR) ? CachedEntry::State::kAbsent : CachedEntry::State::kUnknown);
+        ReturnErrorOnFailure(err);
+#else
         ReturnErrorOnFailure(entry.Delete(this->mStorage));
+#endif // CHIP_CONFIG_ICD_MONITORING_TABLE_CACHE
     }
+
+#if CHIP_CONFIG_ICD_MONITORING_TABLE_CACHE
+    // Give the room of the empty table to other fabrics
+    ReleaseCachedFabric(this->mStorage, this->mFabric);
+#endif // CHIP_CONFIG_ICD_MONITORING_TABLE_CACHE
+
     return CHIP_NO_ERROR;
 }
 
@@ -346,4 +516,23 @@ uint16_t ICDMonitoringTable::Limit() const
     return mLimit;
 }
 
+void ICDMonitoringTable::EnableCache(PersistentStorageDelegate & storage)
+{
+#if CHIP_CONFIG_ICD_MONITORING_TABLE_CACHE
+    DisableCache();
+    gCachedStorage = &storage;
+#endif // CHIP_CONFIG_ICD_MONITORING_TABLE_CACHE
+}
+
+void ICDMonitoringTable::DisableCache()
+{
+#if CHIP_CONFIG_ICD_MONITORING_TABLE_CACHE
+    gCachedStorage = nullptr;
+    for (auto & cachedFabric : gCachedFabrics)
+    {
+        cachedFabric = CachedFabric();
+    }
+#endif // CHIP_CONFIG_ICD_MONITORING_TABLE_CACHE
+}
+
 } // namespace chip
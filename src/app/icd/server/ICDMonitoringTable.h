@@ -199,6 +199,18 @@ struct ICDMonitoringTable
      */
     uint16_t Limit() const;
 
+    /**
+     * @brief Keep in RAM the entries of the tables persisted in the given storage, once read or written, so that reading
+     *        them again does not access the storage (see CHIP_CONFIG_ICD_MONITORING_TABLE_CACHE). Only one storage is
+     *        cached at a time, and all changes to its tables must go through ICDMonitoringTable.
+     */
+    static void EnableCache(PersistentStorageDelegate & storage);
+
+    /**
+     * @brief Stop caching the entries and drop the cached ones.
+     */
+    static void DisableCache();
+
 private:
     PersistentStorageDelegate * mStorage;
     FabricIndex mFabric;
@@ -249,6 +249,43 @@ TEST_F(TestICDManager, TestICDModeDurations)
     EXPECT_EQ(mICDManager.GetOperaionalState(), ICDManager::OperationalState::IdleMode);
 }
 
+TEST_F(TestICDManager, TestActiveModeStatistics)
+{
+    using Trigger = ICDManager::ActiveModeTrigger;
+
+    const ICDManager::ActiveModeStatistics & stats = mICDManager.GetActiveModeStatistics();
+    Milliseconds32 activeModeDuration              = ICDConfigurationData::GetInstance().GetActiveModeDuration();
+    Milliseconds32 activeModeThreshold             = ICDConfigurationData::GetInstance().GetActiveModeThreshold();
+
+    // The IdleMode duration expires and brings the ICD to ActiveMode
+    EXPECT_EQ(mICDManager.GetOperaionalState(), ICDManager::OperationalState::IdleMode);
+    AdvanceClockAndRunEventLoop(ICDConfigurationData::GetInstance().GetIdleModeDuration() + 1_s);
+    EXPECT_EQ(mICDManager.GetOperaionalState(), ICDManager::OperationalState::ActiveMode);
+    EXPECT_EQ(stats.activations[to_underlying(Trigger::kIdleModeDone)], 1u);
+
+    // Network activity extends the ActiveMode period, which stays attributed to its trigger
+    ICDNotifier::GetInstance().NotifyNetworkActivityNotification();
+    EXPECT_EQ(stats.extensions[to_underlying(Trigger::kNetworkActivity)], 1u);
+    EXPECT_EQ(stats.activeTimeMs[to_underlying(Trigger::kIdleModeDone)], 0u);
+
+    AdvanceClockAndRunEventLoop(activeModeDuration + activeModeThreshold + 1_ms32);
+    EXPECT_EQ(mICDManager.GetOperaionalState(), ICDManager::OperationalState::IdleMode);
+    EXPECT_GE(stats.activeTimeMs[to_underlying(Trigger::kIdleModeDone)], activeModeDuration.count());
+    EXPECT_EQ(stats.activations[to_underlying(Trigger::kNetworkActivity)], 0u);
+    EXPECT_EQ(stats.activeTimeMs[to_underlying(Trigger::kNetworkActivity)], 0u);
+
+    // Network activity brings the ICD to ActiveMode
+    ICDNotifier::GetInstance().NotifyNetworkActivityNotification();
+    EXPECT_EQ(mICDManager.GetOperaionalState(), ICDManager::OperationalState::ActiveMode);
+    EXPECT_EQ(stats.activations[to_underlying(Trigger::kNetworkActivity)], 1u);
+
+    AdvanceClockAndRunEventLoop(activeModeDuration + 1_ms32);
+    EXPECT_EQ(mICDManager.GetOperaionalState(), ICDManager::OperationalState::IdleMode);
+    EXPECT_GE(stats.activeTimeMs[to_underlying(Trigger::kNetworkActivity)], activeModeDuration.count());
+    EXPECT_EQ(stats.activations[to_underlying(Trigger::kIdleModeDone)], 1u);
+    EXPECT_EQ(stats.activations[to_underlying(Trigger::kSubscriptionReport)], 0u);
+}
+
 #if CHIP_CONFIG_ENABLE_ICD_CIP
 /**
  * @brief Test verifies that the ICDManager starts its timers correctly based on if it will have any messages to send
@@ -438,4 +438,80 @@ TEST(TestICDMonitoringTable, TestDeleteValidEntryFromStorage)
     EXPECT_EQ(CHIP_ERROR_NOT_FOUND, table2.Get(0, entry));
 }
 
+TEST(TestICDMonitoringTable, TestCachedEntries)
+{
+    TestPersistentStorageDelegate storage;
+    TestSessionKeystoreImpl keystore;
+    ICDMonitoringTable table(storage, kTestFabricIndex1, kMaxTestClients1, &keystore);
+    ICDMonitoringEntry entry(&keystore);
+
+    ICDMonitoringTable::EnableCache(storage);
+
+    // A missing entry is cached as well
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, table.Get(1, entry));
+
+    ICDMonitoringEntry entry1(&keystore);
+    entry1.checkInNodeID    = kClientNodeId11;
+    entry1.monitoredSubject = kClientNodeId12;
+    EXPECT_EQ(CHIP_NO_ERROR, entry1.SetKey(ByteSpan(kKeyBuffer1a)));
+    EXPECT_EQ(CHIP_NO_ERROR, table.Set(0, entry1));
+
+    ICDMonitoringEntry entry2(&keystore);
+    entry2.checkInNodeID    = kClientNodeId13;
+    entry2.monitoredSubject = kClientNodeId11;
+    entry2.clientType       = ClientTypeEnum::kEphemeral;
+    EXPECT_EQ(CHIP_NO_ERROR, entry2.SetKey(ByteSpan(kKeyBuffer2a)));
+    EXPECT_EQ(CHIP_NO_ERROR, table.Set(1, entry2));
+
+    // Entries are read from the cache
+    storage.AddPoisonKey(DefaultStorageKeyAllocator::ICDManagementTableEntry(kTestFabricIndex1, 0).KeyName());
+    storage.AddPoisonKey(DefaultStorageKeyAllocator::ICDManagementTableEntry(kTestFabricIndex1, 1).KeyName());
+    storage.AddPoisonKey(DefaultStorageKeyAllocator::ICDManagementTableEntry(kTestFabricIndex1, 2).KeyName());
+
+    EXPECT_EQ(CHIP_NO_ERROR, table.Get(0, entry));
+    EXPECT_EQ(kTestFabricIndex1, entry.fabricIndex);
+    EXPECT_EQ(kClientNodeId11, entry.checkInNodeID);
+    EXPECT_EQ(kClientNodeId12, entry.monitoredSubject);
+    EXPECT_EQ(ClientTypeEnum::kPermanent, entry.clientType);
+    EXPECT_TRUE(entry.IsKeyEquivalent(ByteSpan(kKeyBuffer1a)));
+
+    EXPECT_EQ(CHIP_NO_ERROR, table.Get(1, entry));
+    EXPECT_EQ(kClientNodeId13, entry.checkInNodeID);
+    EXPECT_EQ(kClientNodeId11, entry.monitoredSubject);
+    EXPECT_EQ(ClientTypeEnum::kEphemeral, entry.clientType);
+    EXPECT_TRUE(entry.IsKeyEquivalent(ByteSpan(kKeyBuffer2a)));
+    EXPECT_EQ(memcmp(entry2.hmacKeyHandle.As<Crypto::Symmetric128BitsKeyByteArray>(),
+                     entry.hmacKeyHandle.As<Crypto::Symmetric128BitsKeyByteArray>(), sizeof(Crypto::Symmetric128BitsKeyByteArray)),
+              0);
+
+    // Entries past the table limit are not cached
+    EXPECT_NE(CHIP_NO_ERROR, table.Get(2, entry));
+    EXPECT_NE(CHIP_ERROR_NOT_FOUND, table.Get(2, entry));
+
+    // Removing an entry keeps the cache coherent with the storage
+    storage.ClearPoisonKeys();
+    EXPECT_EQ(CHIP_NO_ERROR, table.Remove(0));
+
+    EXPECT_EQ(CHIP_NO_ERROR, table.Get(0, entry));
+    EXPECT_EQ(kClientNodeId13, entry.checkInNodeID);
+    EXPECT_TRUE(entry.IsKeyEquivalent(ByteSpan(kKeyBuffer2a)));
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, table.Get(1, entry));
+
+    ICDMonitoringTable::DisableCache();
+
+    EXPECT_EQ(CHIP_NO_ERROR, table.Get(0, entry));
+    EXPECT_EQ(kClientNodeId13, entry.checkInNodeID);
+    EXPECT_TRUE(entry.IsKeyEquivalent(ByteSpan(kKeyBuffer2a)));
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, table.Get(1, entry));
+
+    // Tables on other storages are not cached
+    TestPersistentStorageDelegate otherStorage;
+    ICDMonitoringTable otherTable(otherStorage, kTestFabricIndex1, kMaxTestClients1, &keystore);
+    ICDMonitoringTable::EnableCache(otherStorage);
+    EXPECT_EQ(CHIP_NO_ERROR, table.RemoveAll());
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, table.Get(0, entry));
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, otherTable.Get(0, entry));
+    ICDMonitoringTable::DisableCache();
+}
+
 } // namespace
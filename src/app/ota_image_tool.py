@@ -25,6 +25,9 @@ Usage examples:
 Creating OTA image file:
 ./ota_image_tool.py create -v 0xDEAD -p 0xBEEF -vn 1 -vs "1.0" -da sha256 my-firmware.bin my-firmware.ota
 
+Creating OTA image file with an LZ4-compressed payload:
+./ota_image_tool.py create -v 0xDEAD -p 0xBEEF -vn 1 -vs "1.0" -da sha256 -c lz4 my-firmware.bin my-firmware.ota
+
 Showing OTA image file info:
 ./ota_image_tool.py show my-firmware.ota
 """
@@ -34,6 +37,7 @@ import hashlib
 import os
 import struct
 import sys
+import tempfile
 from enum import IntEnum
 
 sys.path.insert(0, os.path.join(
@@ -65,6 +69,24 @@ DIGEST_ALL_ALGORITHMS = hashlib.algorithms_available.intersection(
 # into memory fully before processing.
 PAYLOAD_BUFFER_SIZE = 16 * 1024
 
+PAYLOAD_COMPRESSION_ID = dict(
+    none=0,
+    lz4=1,
+)
+
+# A compressed payload is a sequence of chunks, each of them a little-endian 16-bit
+# length followed by an LZ4 block holding at most that many bytes of the original
+# payload. Keep in sync with kOTAImageCompressedChunkSize in OTAImagePayloadDecompressor.h
+COMPRESSED_CHUNK_SIZE = 4096
+COMPRESSED_CHUNK_HEADER_FORMAT = '<H'
+
+# Parameters of the LZ4 block format: matches are at least 4 bytes long, may not
+# start in the last 12 bytes of a block and the last 5 bytes are always literals.
+LZ4_MIN_MATCH = 4
+LZ4_MATCH_START_LIMIT = 12
+LZ4_LAST_LITERALS = 5
+LZ4_MAX_OFFSET = 65535
+
 
 class HeaderTag(IntEnum):
     VENDOR_ID = 0
@@ -77,6 +99,7 @@ class HeaderTag(IntEnum):
     RELEASE_NOTES_URL = 7
     DIGEST_TYPE = 8
     DIGEST = 9
+    PAYLOAD_COMPRESSION = 10
 
 
 def warn(message: str):
@@ -142,6 +165,91 @@ def generate_payload_summary(args: object):
     return total_size, digest.digest()
 
 
+def lz4_write_length(out: bytearray, length: int):
+    while length >= 255:
+        out.append(255)
+        length -= 255
+    out.append(length)
+
+
+def lz4_write_sequence(out: bytearray, literals: bytes, offset: int = 0, match_length: int = 0):
+    token = min(len(literals), 15) << 4
+    if match_length:
+        token |= min(match_length - LZ4_MIN_MATCH, 15)
+    out.append(token)
+
+    if len(literals) >= 15:
+        lz4_write_length(out, len(literals) - 15)
+    out.extend(literals)
+
+    if match_length:
+        out.extend(struct.pack('<H', offset))
+        if match_length - LZ4_MIN_MATCH >= 15:
+            lz4_write_length(out, match_length - LZ4_MIN_MATCH - 15)
+
+
+def lz4_compress_block(data: bytes) -> bytes:
+    """
+    Compress data into a single LZ4 block, using a greedy search for matches
+    """
+
+    out = bytearray()
+    last_positions = {}
+    anchor = 0
+    pos = 0
+    match_end_limit = len(data) - LZ4_LAST_LITERALS
+
+    while pos < len(data) - LZ4_MATCH_START_LIMIT:
+        sequence = data[pos:pos + LZ4_MIN_MATCH]
+        candidate = last_positions.get(sequence)
+        last_positions[sequence] = pos
+
+        if candidate is None or pos - candidate > LZ4_MAX_OFFSET:
+            pos += 1
+            continue
+
+        length = LZ4_MIN_MATCH
+        while pos + length < match_end_limit and data[candidate + length] == data[pos + length]:
+            length += 1
+
+        lz4_write_sequence(out, data[anchor:pos], pos - candidate, length)
+        pos += length
+        anchor = pos
+
+    lz4_write_sequence(out, data[anchor:])
+    return bytes(out)
+
+
+def read_payload_chunks(args: object, size: int):
+    """
+    Read the concatenated input payload files in chunks of the given size
+    """
+
+    pending = b''
+    for path in args.input_files:
+        with open(path, 'rb') as file:
+            while data := file.read(size - len(pending)):
+                pending += data
+                if len(pending) == size:
+                    yield pending
+                    pending = b''
+
+    if pending:
+        yield pending
+
+
+def compress_payload(args: object, path: str):
+    """
+    Write the compressed concatenation of the input payload files to the given path
+    """
+
+    with open(path, 'wb') as out_file:
+        for chunk in read_payload_chunks(args, COMPRESSED_CHUNK_SIZE):
+            compressed = lz4_compress_block(chunk)
+            out_file.write(struct.pack(COMPRESSED_CHUNK_HEADER_FORMAT, len(compressed)))
+            out_file.write(compressed)
+
+
 def generate_header_tlv(args: object, payload_size: int, payload_digest: bytes):
     """
     Generate anonymous TLV structure with fields describing the OTA image contents
@@ -166,6 +274,11 @@ def generate_header_tlv(args: object, payload_size: int, payload_digest: bytes):
     if args.release_notes is not None:
         fields.update({HeaderTag.RELEASE_NOTES_URL: args.release_notes})
 
+    # Tools built on top of this one may not have the compression argument
+    compression = getattr(args, 'compression', 'none')
+    if compression != 'none':
+        fields.update({HeaderTag.PAYLOAD_COMPRESSION: uint(PAYLOAD_COMPRESSION_ID[compression])})
+
     writer = TLVWriter()
     writer.put(None, fields)
 
@@ -206,11 +319,19 @@ def write_image(args: object, header: bytes):
 def generate_image(args: object):
     """
     Generate OTA image header and write it along with payload files to the OTA image file
+
+    A compressed payload is first written to a temporary file, which then stands for the input payload files.
     """
-    payload_size, payload_digest = generate_payload_summary(args)
-    header_tlv = generate_header_tlv(args, payload_size, payload_digest)
-    header = generate_header(header_tlv, payload_size)
-    write_image(args, header)
+    with tempfile.TemporaryDirectory() as temp_dir:
+        if getattr(args, 'compression', 'none') != 'none':
+            compressed_path = os.path.join(temp_dir, 'payload')
+            compress_payload(args, compressed_path)
+            args.input_files = [compressed_path]
+
+        payload_size, payload_digest = generate_payload_summary(args)
+        header_tlv = generate_header_tlv(args, payload_size, payload_digest)
+        header = generate_header(header_tlv, payload_size)
+        write_image(args, header)
 
 
 def parse_header(args: object):
@@ -306,6 +427,10 @@ def update_header_args(args: object) -> None:
     if args.release_notes is None and HeaderTag.RELEASE_NOTES_URL in header_tlv:
         args.release_notes = header_tlv[HeaderTag.RELEASE_NOTES_URL]
 
+    # The payload is copied as it is, so it keeps its compression
+    val = header_tlv.get(HeaderTag.PAYLOAD_COMPRESSION, PAYLOAD_COMPRESSION_ID['none'])
+    args.compression = next(key for key, value in PAYLOAD_COMPRESSION_ID.items() if value == val)
+
     new_header_tlv = generate_header_tlv(args, payload_size, payload_digest)
     header = generate_header(new_header_tlv, payload_size)
 
@@ -342,6 +467,8 @@ def main():
                                help='Maximum software version that can be updated to this image')
     create_parser.add_argument(
         '-rn', '--release-notes', help='Release note URL')
+    create_parser.add_argument('-c', '--compression', choices=PAYLOAD_COMPRESSION_ID.keys(), default='none',
+                               help='Payload compression, only for requestors that support it')
     create_parser.add_argument('input_files', nargs='+',
                                help='Path to input image payload file')
     create_parser.add_argument('output_file', help='Path to output image file')
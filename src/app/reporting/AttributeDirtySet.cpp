@@ -0,0 +1,249 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/AttributeDirtySet.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+void AttributeDirtySet::Entry::Absorb(AttributeMask mask, uint64_t generation)
+{
+    VerifyOrReturn(mask != 0);
+
+    if (generation == mLatestGeneration)
+    {
+        mLatestMask |= mask;
+        return;
+    }
+
+    if (generation < mLatestGeneration)
+    {
+        mOlderMask |= mask;
+        mOlderGeneration = std::max(mOlderGeneration, generation);
+        return;
+    }
+
+    // The bits marked again move to the new generation; the other latest bits become older bits.
+    const AttributeMask demoted = mLatestMask & ~mask;
+    mOlderMask                  = (mOlderMask & ~mask) | demoted;
+    if (demoted != 0)
+    {
+        mOlderGeneration = mLatestGeneration;
+    }
+    mLatestMask       = mask;
+    mLatestGeneration = generation;
+}
+
+void AttributeDirtySet::Entry::Absorb(const Entry & other)
+{
+    Absorb(other.mOlderMask, other.mOlderGeneration);
+    Absorb(other.mLatestMask, other.mLatestGeneration);
+}
+
+bool AttributeDirtySet::Entry::IsDirtySince(AttributeMask mask, uint64_t generation) const
+{
+    return ((mLatestMask & mask) != 0 && mLatestGeneration > generation) ||
+        ((mOlderMask & mask) != 0 && mOlderGeneration > generation);
+}
+
+AttributeDirtySet::AttributeMask AttributeDirtySet::MaskFor(AttributeId attributeId)
+{
+    return AttributeMask(1) << (attributeId % kAttributeBits);
+}
+
+size_t AttributeDirtySet::SlotFor(EndpointId endpointId, ClusterId clusterId)
+{
+    // Fibonacci hashing of the endpoint spreads consecutive endpoints with the same clusters across the table.
+    const uint32_t hash = (static_cast<uint32_t>(endpointId) * 0x9E3779B1u) ^ clusterId;
+    return hash % kCapacity;
+}
+
+const AttributeDirtySet::Entry * AttributeDirtySet::Find(EndpointId endpointId, ClusterId clusterId) const
+{
+    const size_t start = SlotFor(endpointId, clusterId);
+    for (size_t i = 0; i < kCapacity; i++)
+    {
+        const Entry & entry = mEntries[(start + i) % kCapacity];
+        // Entries are only released all together, so a free entry ends the probe sequence.
+        if (!entry.mInUse)
+        {
+            return nullptr;
+        }
+        if (entry.HasKey(endpointId, clusterId))
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+AttributeDirtySet::Entry * AttributeDirtySet::FindOrAllocate(EndpointId endpointId, ClusterId clusterId)
+{
+    const size_t start = SlotFor(endpointId, clusterId);
+    for (size_t i = 0; i < kCapacity; i++)
+    {
+        Entry & entry = mEntries[(start + i) % kCapacity];
+        if (!entry.mInUse)
+        {
+            entry             = Entry();
+            entry.mEndpointId = endpointId;
+            entry.mClusterId  = clusterId;
+            entry.mInUse      = true;
+            mSize++;
+            mHasWildcardEndpointEntries = mHasWildcardEndpointEntries || endpointId == kInvalidEndpointId;
+            mHasWildcardClusterEntries  = mHasWildcardClusterEntries || clusterId == kInvalidClusterId;
+            return &entry;
+        }
+        if (entry.HasKey(endpointId, clusterId))
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void AttributeDirtySet::MarkDirty(const AttributePathParams & path, uint64_t generation)
+{
+    const AttributeMask mask = path.HasWildcardAttributeId() ? kAllAttributes : MaskFor(path.mAttributeId);
+
+    Entry * entry = FindOrAllocate(path.mEndpointId, path.mClusterId);
+    if (entry == nullptr && MergeEntriesUnderSameEndpoint())
+    {
+        ChipLogDetail(DataManagement, "Global dirty set full, merged paths by endpoint.");
+        entry = FindOrAllocate(path.mEndpointId, path.mClusterId);
+    }
+    if (entry == nullptr)
+    {
+        ChipLogDetail(DataManagement, "Global dirty set full, merge all paths.");
+        MergeAllEntries();
+        entry = FindOrAllocate(kInvalidEndpointId, kInvalidClusterId);
+    }
+
+    // The table always has room for the wildcard entry once all entries are merged.
+    VerifyOrDie(entry != nullptr);
+    entry->Absorb(mask, generation);
+}
+
+bool AttributeDirtySet::IsDirtySince(const ConcreteAttributePath & path, uint64_t generation) const
+{
+    VerifyOrReturnValue(mSize != 0, false);
+
+    const AttributeMask mask = MaskFor(path.mAttributeId);
+    auto isDirty             = [&](EndpointId endpointId, ClusterId clusterId) {
+        const Entry * entry = Find(endpointId, clusterId);
+        return entry != nullptr && entry->IsDirtySince(mask, generation);
+    };
+
+    if (isDirty(path.mEndpointId, path.mClusterId))
+    {
+        return true;
+    }
+    if (mHasWildcardClusterEntries && isDirty(path.mEndpointId, kInvalidClusterId))
+    {
+        return true;
+    }
+    if (mHasWildcardEndpointEntries)
+    {
+        return isDirty(kInvalidEndpointId, path.mClusterId) || isDirty(kInvalidEndpointId, kInvalidClusterId);
+    }
+    return false;
+}
+
+void AttributeDirtySet::Clear()
+{
+    for (auto & entry : mEntries)
+    {
+        entry = Entry();
+    }
+    mSize                       = 0;
+    mHasWildcardEndpointEntries = false;
+    mHasWildcardClusterEntries  = false;
+}
+
+bool AttributeDirtySet::MergeEntriesUnderSameEndpoint()
+{
+    Entry merged[kCapacity];
+    size_t mergedCount = 0;
+
+    for (const auto & entry : mEntries)
+    {
+        if (!entry.mInUse)
+        {
+            continue;
+        }
+
+        size_t entriesOnEndpoint = 0;
+        for (const auto & other : mEntries)
+        {
+            entriesOnEndpoint += (other.mInUse && other.mEndpointId == entry.mEndpointId) ? 1 : 0;
+        }
+
+        const bool mergeCluster   = entry.mEndpointId != kInvalidEndpointId && entriesOnEndpoint > 1;
+        const ClusterId clusterId = mergeCluster ? kInvalidClusterId : entry.mClusterId;
+
+        Entry * target = std::find_if(merged, merged + mergedCount,
+                                      [&](const Entry & candidate) { return candidate.HasKey(entry.mEndpointId, clusterId); });
+        if (target == merged + mergedCount)
+        {
+            target              = &merged[mergedCount++];
+            target->mEndpointId = entry.mEndpointId;
+            target->mClusterId  = clusterId;
+            target->mInUse      = true;
+        }
+        target->Absorb(entry);
+    }
+
+    VerifyOrReturnValue(mergedCount < mSize, false);
+    Rebuild(merged, mergedCount);
+    return true;
+}
+
+void AttributeDirtySet::MergeAllEntries()
+{
+    Entry merged;
+    merged.mInUse = true;
+    for (const auto & entry : mEntries)
+    {
+        if (entry.mInUse)
+        {
+            merged.Absorb(entry);
+        }
+    }
+    Rebuild(&merged, 1);
+}
+
+void AttributeDirtySet::Rebuild(const Entry * entries, size_t count)
+{
+    Clear();
+    for (size_t i = 0; i < count; i++)
+    {
+        Entry * entry = FindOrAllocate(entries[i].mEndpointId, entries[i].mClusterId);
+        VerifyOrDie(entry != nullptr);
+        *entry = entries[i];
+    }
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -0,0 +1,122 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/DataModelTypes.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * @brief The set of attributes marked dirty for reporting, together with the dirty set generation at which they were marked.
+ *
+ *   The set is a small hash table with one entry per (endpoint, cluster) pair, where either may be a wildcard.  Each
+ *   entry holds a bitmap of the dirty attributes, indexed by the attribute id modulo kAttributeBits, so that marking a path
+ *   dirty and testing a concrete path are each a few table lookups and bitwise tests.
+ *
+ *   Each entry tracks two generations: the bits set by the most recent MarkDirty() call on the entry, and all older bits
+ *   under the most recent of their generations.  An attribute reported after the older generation is therefore not
+ *   reported again because another attribute of the same cluster changed later.
+ *
+ *   The set may report false positives, never false negatives: attribute ids that share a bit, older bits whose
+ *   generation was raised by a later change, and entries merged by endpoint (then into a single wildcard entry) when the
+ *   table is full.  A false positive only causes an attribute to be reported again.
+ */
+class AttributeDirtySet
+{
+public:
+    static constexpr size_t kCapacity      = CHIP_IM_SERVER_MAX_NUM_DIRTY_SET;
+    static constexpr size_t kAttributeBits = 64;
+
+    static_assert(kCapacity >= 1, "The dirty set needs at least one entry");
+
+    /**
+     * Mark the attributes matching the given path dirty at the given generation.
+     *
+     * The generation must be non-zero, and no smaller than the generation of any earlier call.
+     */
+    void MarkDirty(const AttributePathParams & path, uint64_t generation);
+
+    /**
+     * Returns true if the given attribute may have been marked dirty at a generation strictly greater than the given one.
+     */
+    bool IsDirtySince(const ConcreteAttributePath & path, uint64_t generation) const;
+
+    void Clear();
+
+    /// Returns the number of (endpoint, cluster) entries in use.
+    size_t Size() const { return mSize; }
+
+private:
+    using AttributeMask = uint64_t;
+
+    static constexpr AttributeMask kAllAttributes = ~AttributeMask(0);
+
+    struct Entry
+    {
+        EndpointId mEndpointId = kInvalidEndpointId;
+        ClusterId mClusterId   = kInvalidClusterId;
+        // Attributes marked dirty at mLatestGeneration.
+        AttributeMask mLatestMask = 0;
+        // Other attributes, marked dirty at or before mOlderGeneration.
+        AttributeMask mOlderMask   = 0;
+        uint64_t mLatestGeneration = 0;
+        uint64_t mOlderGeneration  = 0;
+        bool mInUse                = false;
+
+        bool HasKey(EndpointId endpoint, ClusterId cluster) const { return mEndpointId == endpoint && mClusterId == cluster; }
+        void Absorb(AttributeMask mask, uint64_t generation);
+        void Absorb(const Entry & other);
+        bool IsDirtySince(AttributeMask mask, uint64_t generation) const;
+    };
+
+    static AttributeMask MaskFor(AttributeId attributeId);
+    static size_t SlotFor(EndpointId endpointId, ClusterId clusterId);
+
+    // Returns the entry with the given key, or nullptr if there is none.
+    const Entry * Find(EndpointId endpointId, ClusterId clusterId) const;
+    // Returns the entry with the given key, or a free entry assigned to that key, or nullptr if the table is full.
+    Entry * FindOrAllocate(EndpointId endpointId, ClusterId clusterId);
+
+    // Merges the entries of every endpoint with several entries into one wildcard cluster entry for that endpoint.
+    // Returns whether any entry was released.
+    bool MergeEntriesUnderSameEndpoint();
+    // Merges all entries into a single wildcard entry.
+    void MergeAllEntries();
+    // Reinserts the given entries, which must fit, into an empty table.
+    void Rebuild(const Entry * entries, size_t count);
+
+    Entry mEntries[kCapacity];
+    size_t mSize = 0;
+    // Whether any entry has a wildcard endpoint id, so that lookups can skip probing for one.
+    bool mHasWildcardEndpointEntries = false;
+    // Whether any entry has a wildcard cluster id.
+    bool mHasWildcardClusterEntries = false;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
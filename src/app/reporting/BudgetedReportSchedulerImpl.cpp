@@ -0,0 +1,213 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/BudgetedReportSchedulerImpl.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TypeTraits.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+using namespace System::Clock;
+using ReadHandlerNode = ReportScheduler::ReadHandlerNode;
+
+void BudgetedReportSchedulerImpl::TokenBucket::Fill(const Budget & aBudget, const Timestamp & now)
+{
+    mUnits      = aBudget.mBurst * kUnitsPerReport;
+    mLastRefill = now;
+}
+
+void BudgetedReportSchedulerImpl::TokenBucket::Refill(const Budget & aBudget, const Timestamp & now)
+{
+    VerifyOrReturn(now > mLastRefill);
+
+    const uint32_t capacity = aBudget.mBurst * kUnitsPerReport;
+    const uint64_t added    = (now - mLastRefill).count() * aBudget.mReportsPerMinute;
+    mUnits                  = static_cast<uint32_t>(std::min<uint64_t>(capacity, mUnits + added));
+    mLastRefill             = now;
+}
+
+Timeout BudgetedReportSchedulerImpl::TokenBucket::TimeUntilReport(const Budget & aBudget) const
+{
+    VerifyOrReturnValue(mUnits < kUnitsPerReport, Milliseconds32(0));
+    // Round up, so that the bucket holds a report when the timeout expires.
+    const uint32_t missing = kUnitsPerReport - mUnits;
+    return Milliseconds32((missing + aBudget.mReportsPerMinute - 1u) / aBudget.mReportsPerMinute);
+}
+
+BudgetedReportSchedulerImpl::BudgetedReportSchedulerImpl(TimerDelegate * aTimerDelegate, const Budget & aFabricBudget,
+                                                         const Budget & aPeerBudget) :
+    ReportSchedulerImpl(aTimerDelegate),
+    mFabricBudget(aFabricBudget), mPeerBudget(aPeerBudget)
+{
+    VerifyOrDie(mFabricBudget.mBurst > 0 && mPeerBudget.mBurst > 0);
+}
+
+bool BudgetedReportSchedulerImpl::IsReportableNow(ReadHandler * aReadHandler)
+{
+    Timestamp now          = mTimerDelegate->GetCurrentMonotonicTimestamp();
+    ReadHandlerNode * node = FindReadHandlerNode(aReadHandler);
+    VerifyOrReturnValue(nullptr != node && node->IsReportableNow(now), false);
+    VerifyOrReturnValue(ClassifyReport(*node, now) == ReportClass::kDataChange, true);
+
+    const Timeout budgetTimeout = TimeUntilBudget(*aReadHandler, now);
+    VerifyOrReturnValue(budgetTimeout > Milliseconds32(0), true);
+
+    // Another subscription of the same fabric or peer spent the budget since this report was scheduled.
+    if (node->IsEngineRunScheduled())
+    {
+        ChipLogDetail(DataManagement, "Deferring report of ReadHandler %p by %" PRIu32 "ms for lack of budget", aReadHandler,
+                      budgetTimeout.count());
+        mMetrics.mReportsDeferred++;
+    }
+    ScheduleReport(std::min<Timeout>(budgetTimeout, node->GetMaxTimestamp() - now), node, now);
+    return false;
+}
+
+void BudgetedReportSchedulerImpl::OnSubscriptionReportSent(ReadHandler * aReadHandler)
+{
+    ReadHandlerNode * node = FindReadHandlerNode(aReadHandler);
+    if (nullptr != node)
+    {
+        Timestamp now = mTimerDelegate->GetCurrentMonotonicTimestamp();
+        mMetrics.mReportsSent[to_underlying(ClassifyReport(*node, now))]++;
+
+        TokenBucket * bucket = GetFabricBucket(*aReadHandler, now);
+        if (nullptr != bucket)
+        {
+            bucket->Spend();
+        }
+        bucket = GetPeerBucket(*aReadHandler, now);
+        if (nullptr != bucket)
+        {
+            bucket->Spend();
+        }
+    }
+
+    ReportSchedulerImpl::OnSubscriptionReportSent(aReadHandler);
+}
+
+CHIP_ERROR BudgetedReportSchedulerImpl::CalculateNextReportTimeout(Timeout & timeout, ReadHandlerNode * aNode,
+                                                                   const Timestamp & now)
+{
+    ReturnErrorOnFailure(ReportSchedulerImpl::CalculateNextReportTimeout(timeout, aNode, now));
+
+    // Only data change reports wait for budget, and never past the max interval, when they become keep-alive reports.
+    VerifyOrReturnError(IsReadHandlerReportable(aNode->GetReadHandler()), CHIP_NO_ERROR);
+    VerifyOrReturnError(ClassifyReport(*aNode, now) == ReportClass::kDataChange, CHIP_NO_ERROR);
+
+    const Timeout budgetTimeout = TimeUntilBudget(*aNode->GetReadHandler(), now);
+    VerifyOrReturnError(budgetTimeout > timeout, CHIP_NO_ERROR);
+
+    mMetrics.mReportsDeferred++;
+    timeout = std::min<Timeout>(budgetTimeout, aNode->GetMaxTimestamp() - now);
+    return CHIP_NO_ERROR;
+}
+
+BudgetedReportSchedulerImpl::ReportClass BudgetedReportSchedulerImpl::ClassifyReport(const ReadHandlerNode & aNode,
+                                                                                     const Timestamp & now) const
+{
+    const ReadHandler * readHandler = aNode.GetReadHandler();
+    if (IsReadHandlerForcedDirty(readHandler) || aNode.IsChunkedReport())
+    {
+        return ReportClass::kUrgent;
+    }
+    if (!IsReadHandlerDirty(readHandler) || now >= aNode.GetMaxTimestamp())
+    {
+        return ReportClass::kKeepAlive;
+    }
+    return ReportClass::kDataChange;
+}
+
+BudgetedReportSchedulerImpl::TokenBucket * BudgetedReportSchedulerImpl::GetBucket(BucketEntry * apEntries, size_t aCount,
+                                                                                  const ScopedNodeId & aKey,
+                                                                                  const Budget & aBudget, const Timestamp & now)
+{
+    VerifyOrReturnValue(aBudget.mReportsPerMinute != 0, nullptr);
+
+    BucketEntry * entry = nullptr;
+    for (size_t i = 0; i < aCount; i++)
+    {
+        if (apEntries[i].mInUse && apEntries[i].mKey == aKey)
+        {
+            apEntries[i].mBucket.Refill(aBudget, now);
+            return &apEntries[i].mBucket;
+        }
+        if (!apEntries[i].mInUse && entry == nullptr)
+        {
+            entry = &apEntries[i];
+        }
+    }
+
+    if (entry == nullptr)
+    {
+        // Reuse the bucket holding the most reports: a full bucket behaves exactly like a new one.
+        for (size_t i = 0; i < aCount; i++)
+        {
+            apEntries[i].mBucket.Refill(aBudget, now);
+            if (entry == nullptr || apEntries[i].mBucket.GetUnits() > entry->mBucket.GetUnits())
+            {
+                entry = &apEntries[i];
+            }
+        }
+    }
+
+    entry->mKey   = aKey;
+    entry->mInUse = true;
+    entry->mBucket.Fill(aBudget, now);
+    return &entry->mBucket;
+}
+
+BudgetedReportSchedulerImpl::TokenBucket * BudgetedReportSchedulerImpl::GetFabricBucket(const ReadHandler & aReadHandler,
+                                                                                        const Timestamp & now)
+{
+    return GetBucket(mFabricBuckets, ArraySize(mFabricBuckets),
+                     ScopedNodeId(kUndefinedNodeId, GetReadHandlerPeer(aReadHandler).GetFabricIndex()), mFabricBudget, now);
+}
+
+BudgetedReportSchedulerImpl::TokenBucket * BudgetedReportSchedulerImpl::GetPeerBucket(const ReadHandler & aReadHandler,
+                                                                                      const Timestamp & now)
+{
+    return GetBucket(mPeerBuckets, ArraySize(mPeerBuckets), GetReadHandlerPeer(aReadHandler), mPeerBudget, now);
+}
+
+Timeout BudgetedReportSchedulerImpl::TimeUntilBudget(const ReadHandler & aReadHandler, const Timestamp & now)
+{
+    Timeout timeout(0);
+
+    TokenBucket * bucket = GetFabricBucket(aReadHandler, now);
+    if (nullptr != bucket)
+    {
+        timeout = std::max(timeout, bucket->TimeUntilReport(mFabricBudget));
+    }
+    bucket = GetPeerBucket(aReadHandler, now);
+    if (nullptr != bucket)
+    {
+        timeout = std::max(timeout, bucket->TimeUntilReport(mPeerBudget));
+    }
+    return timeout;
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
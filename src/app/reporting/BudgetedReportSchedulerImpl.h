@@ -0,0 +1,158 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/reporting/ReportSchedulerImpl.h>
+#include <lib/core/CHIPConfig.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * @class BudgetedReportSchedulerImpl
+ *
+ * @brief This class extends ReportSchedulerImpl and shapes the reports of each fabric and of each peer node to a budget.
+ *
+ * Every report a subscription sends spends one report from the token bucket of its fabric and from the token bucket of its
+ * peer node.  The buckets refill at a configured number of reports per minute, up to a configured burst.
+ *
+ * ## Scheduling Logic
+ *
+ * Reports are sorted in classes when they become due:
+ *
+ * - Urgent reports, for ReadHandlers forced dirty (for instance by an urgent event) or in the middle of a chunked report, are
+ *   scheduled as by ReportSchedulerImpl.
+ *
+ * - Keep-alive reports, for ReadHandlers that reached their max interval, are scheduled as by ReportSchedulerImpl, so that
+ *   subscriptions never time out because of the budget.
+ *
+ * - Reports for data changes, for ReadHandlers dirty past their min interval, wait until both buckets of the ReadHandler hold a
+ *   report, and at the latest until the max interval of the ReadHandler.
+ *
+ * Urgent and keep-alive reports still spend from the buckets, so that they delay the data change reports of the same peer or
+ * fabric.
+ */
+class BudgetedReportSchedulerImpl : public ReportSchedulerImpl
+{
+public:
+    struct Budget
+    {
+        /// The rate at which the budget refills, in reports per minute.  0 means the reports are not limited.
+        uint16_t mReportsPerMinute = 0;
+        /// The largest number of reports the budget holds.  Must be at least 1.
+        uint16_t mBurst = 1;
+    };
+
+    enum class ReportClass : uint8_t
+    {
+        kUrgent,
+        kKeepAlive,
+        kDataChange,
+    };
+    static constexpr size_t kReportClassCount = 3;
+
+    struct Metrics
+    {
+        /// The number of subscription reports sent, by ReportClass.
+        uint32_t mReportsSent[kReportClassCount] = {};
+        /// The number of times a data change report was pushed back for lack of budget, when it was scheduled or when it was due.
+        uint32_t mReportsDeferred = 0;
+    };
+
+    static constexpr Budget kDefaultFabricBudget = { CHIP_IM_REPORT_BUDGET_PER_FABRIC_REPORTS_PER_MINUTE,
+                                                     CHIP_IM_REPORT_BUDGET_PER_FABRIC_BURST };
+    static constexpr Budget kDefaultPeerBudget   = { CHIP_IM_REPORT_BUDGET_PER_PEER_REPORTS_PER_MINUTE,
+                                                     CHIP_IM_REPORT_BUDGET_PER_PEER_BURST };
+
+    BudgetedReportSchedulerImpl(TimerDelegate * aTimerDelegate, const Budget & aFabricBudget = kDefaultFabricBudget,
+                                const Budget & aPeerBudget = kDefaultPeerBudget);
+    ~BudgetedReportSchedulerImpl() override { UnregisterAllHandlers(); }
+
+    /**
+     * @brief A ReadHandler due for a data change report is only reportable if its fabric and peer have budget left.  If they
+     * don't, the report is rescheduled for when they will.
+     */
+    bool IsReportableNow(ReadHandler * aReadHandler) override;
+
+    /**
+     * @brief Spend the report from the budgets of the ReadHandler, then reschedule as ReportSchedulerImpl does.
+     */
+    void OnSubscriptionReportSent(ReadHandler * aReadHandler) override;
+
+    const Metrics & GetMetrics() const { return mMetrics; }
+    void ResetMetrics() { mMetrics = Metrics(); }
+
+protected:
+    /**
+     * @brief Calculate the timeout as ReportSchedulerImpl does, then push data change reports back until both budgets of the
+     * ReadHandler hold a report, without going past its max interval.
+     */
+    CHIP_ERROR CalculateNextReportTimeout(Timeout & timeout, ReadHandlerNode * aNode, const Timestamp & now) override;
+
+private:
+    friend class chip::app::reporting::TestReportScheduler;
+
+    // A token bucket counted in 1/60000ths of a report, so that refilling at some reports per minute is exact in milliseconds.
+    class TokenBucket
+    {
+    public:
+        static constexpr uint32_t kUnitsPerReport = 60000;
+
+        void Fill(const Budget & aBudget, const Timestamp & now);
+        void Refill(const Budget & aBudget, const Timestamp & now);
+        void Spend() { mUnits = (mUnits >= kUnitsPerReport) ? mUnits - kUnitsPerReport : 0; }
+        uint32_t GetUnits() const { return mUnits; }
+
+        /// Returns how long until the bucket holds a report, 0 if it already does.
+        Timeout TimeUntilReport(const Budget & aBudget) const;
+
+    private:
+        uint32_t mUnits = 0;
+        Timestamp mLastRefill;
+    };
+
+    struct BucketEntry
+    {
+        ScopedNodeId mKey;
+        TokenBucket mBucket;
+        bool mInUse = false;
+    };
+
+    ReportClass ClassifyReport(const ReadHandlerNode & aNode, const Timestamp & now) const;
+
+    // Returns the refilled bucket for the given key, or nullptr if the budget does not limit reports.
+    TokenBucket * GetBucket(BucketEntry * apEntries, size_t aCount, const ScopedNodeId & aKey, const Budget & aBudget,
+                            const Timestamp & now);
+    TokenBucket * GetFabricBucket(const ReadHandler & aReadHandler, const Timestamp & now);
+    TokenBucket * GetPeerBucket(const ReadHandler & aReadHandler, const Timestamp & now);
+
+    // Returns how long until both budgets of the ReadHandler hold a report, 0 if they already do.
+    Timeout TimeUntilBudget(const ReadHandler & aReadHandler, const Timestamp & now);
+
+    Budget mFabricBudget;
+    Budget mPeerBudget;
+    BucketEntry mFabricBuckets[CHIP_CONFIG_MAX_FABRICS];
+    BucketEntry mPeerBuckets[CHIP_IM_MAX_NUM_READS + CHIP_IM_MAX_NUM_SUBSCRIPTIONS];
+    Metrics mMetrics;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -0,0 +1,66 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/EncodedAttributeCache.h>
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+bool EncodedAttributeCache::Find(const Key & key, ByteSpan & encoded) const
+{
+    for (size_t i = 0; i < mEntryCount; i++)
+    {
+        if (mEntries[i].key == key)
+        {
+            encoded = ByteSpan(mBuffer + mEntries[i].offset, mEntries[i].length);
+            return true;
+        }
+    }
+    return false;
+}
+
+MutableByteSpan EncodedAttributeCache::FreeSpace()
+{
+    VerifyOrReturnValue(mEntryCount < mMaxEntries, MutableByteSpan());
+    return MutableByteSpan(mBuffer + mBufferUsed, mBufferSize - mBufferUsed);
+}
+
+void EncodedAttributeCache::Insert(const Key & key, ByteSpan encoded)
+{
+    VerifyOrDie(mEntryCount < mMaxEntries);
+    VerifyOrDie(encoded.data() >= mBuffer + mBufferUsed && encoded.data() + encoded.size() <= mBuffer + mBufferSize);
+
+    Entry & entry = mEntries[mEntryCount++];
+    entry.key     = key;
+    entry.offset  = static_cast<uint16_t>(encoded.data() - mBuffer);
+    entry.length  = static_cast<uint16_t>(encoded.size());
+    mBufferUsed   = entry.offset + entry.length;
+}
+
+void EncodedAttributeCache::Clear()
+{
+    mEntryCount = 0;
+    mBufferUsed = 0;
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -0,0 +1,124 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/ConcreteAttributePath.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/Span.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * @brief Holds the encoded AttributeReportIB-s of attributes read during one run of the reporting engine.
+ *
+ *   When several ReadHandler-s report the same attribute in one run, the engine reads and encodes it once into the cache,
+ *   and copies the encoded bytes into the report of every other handler.  The cache is keyed by the attribute path, the
+ *   cluster data version and whether the read is fabric filtered.  It does not know which attributes are safe to share
+ *   between subjects: the engine only caches attributes whose value does not depend on the reading subject.
+ *
+ *   The encoded values live in a fixed buffer, filled in order and emptied all together by Clear().  The storage is
+ *   provided by EncodedAttributeCacheWithStorage.
+ */
+class EncodedAttributeCache
+{
+public:
+    struct Key
+    {
+        ConcreteAttributePath path;
+        DataVersion dataVersion = 0;
+        bool fabricFiltered     = false;
+
+        bool operator==(const Key & other) const
+        {
+            return path == other.path && dataVersion == other.dataVersion && fabricFiltered == other.fabricFiltered;
+        }
+    };
+
+    EncodedAttributeCache(const EncodedAttributeCache &)             = delete;
+    EncodedAttributeCache & operator=(const EncodedAttributeCache &) = delete;
+
+    /**
+     * Look up the encoded value of the given key.
+     *
+     * Returns true and sets encoded to the cached AttributeReportIB-s if there is one.
+     */
+    bool Find(const Key & key, ByteSpan & encoded) const;
+
+    /**
+     * Returns the unused part of the buffer, for the caller to encode a value into before calling Insert().
+     *
+     * The span is empty if no more values can be cached.
+     */
+    MutableByteSpan FreeSpace();
+
+    /**
+     * Cache the given encoded value for the given key.  The value must lie within the span last returned by FreeSpace(),
+     * and no value may be cached for the key yet.
+     */
+    void Insert(const Key & key, ByteSpan encoded);
+
+    void Clear();
+
+    /// Returns the number of cached values.
+    size_t Size() const { return mEntryCount; }
+
+protected:
+    struct Entry
+    {
+        Key key;
+        uint16_t offset = 0;
+        uint16_t length = 0;
+    };
+
+    EncodedAttributeCache(Entry * entries, size_t maxEntries, uint8_t * buffer, size_t bufferSize) :
+        mEntries(entries), mMaxEntries(maxEntries), mBuffer(buffer), mBufferSize(bufferSize)
+    {}
+
+private:
+    Entry * const mEntries;
+    const size_t mMaxEntries;
+    uint8_t * const mBuffer;
+    const size_t mBufferSize;
+
+    size_t mEntryCount = 0;
+    size_t mBufferUsed = 0;
+};
+
+template <size_t kBufferSize, size_t kMaxEntries>
+class EncodedAttributeCacheWithStorage : public EncodedAttributeCache
+{
+public:
+    static_assert(kBufferSize > 0 && kMaxEntries > 0, "The encoded attribute cache needs storage");
+    static_assert(kBufferSize <= UINT16_MAX, "Encoded value offsets are stored in 16 bits");
+
+    EncodedAttributeCacheWithStorage() : EncodedAttributeCache(mEntryStorage, kMaxEntries, mBufferStorage, kBufferSize) {}
+
+private:
+    Entry mEntryStorage[kMaxEntries];
+    uint8_t mBufferStorage[kBufferSize];
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -18,7 +18,10 @@
 
 #include <access/AccessRestrictionProvider.h>
 #include <access/Privilege.h>
+#include <app-common/zap-generated/ids/Attributes.h>
+#include <app-common/zap-generated/ids/Clusters.h>
 #include <app/AppConfig.h>
+#include <app/ClusterStatistics.h>
 #include <app/ConcreteEventPath.h>
 #include <app/GlobalAttributes.h>
 #include <app/InteractionModelEngine.h>
@@ -32,6 +35,7 @@
 #include <app/util/MatterCallbacks.h>
 #include <lib/core/CHIPError.h>
 #include <lib/core/DataModelTypes.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <optional>
 #include <protocols/interaction_model/StatusCode.h>
@@ -132,9 +136,83 @@ std::optional<CHIP_ERROR> ValidateReadAttributeACL(DataModel::Provider * dataMod
     return err == CHIP_ERROR_ACCESS_DENIED ? CHIP_IM_GLOBAL_STATUS(UnsupportedAccess) : CHIP_IM_GLOBAL_STATUS(AccessRestricted);
 }
 
+#if CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE > 0
+/// Returns true if the encoded value of the given attribute does not depend on the subject reading it, once the subject
+/// passed the access check of the read.
+bool IsSubjectIndependentAttribute(DataModel::Provider * dataModel, const ConcreteAttributePath & path)
+{
+    std::optional<DataModel::AttributeInfo> info = dataModel->GetAttributeInfo(path);
+    return info.has_value() && !info->flags.Has(DataModel::AttributeQualityFlags::kFabricScoped) &&
+        info->readPrivilege.has_value() && *info->readPrivilege == Privilege::kView;
+}
+
+CHIP_ERROR CopyEncodedAttributeReports(const ByteSpan & encoded, AttributeReportIBs::Builder & reportBuilder)
+{
+    TLV::TLVReader reader;
+    reader.Init(encoded);
+
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        ReturnErrorOnFailure(reportBuilder.GetWriter()->CopyElement(reader));
+    }
+    return err == CHIP_END_OF_TLV ? CHIP_NO_ERROR : err;
+}
+
+/// Reads the given attribute into reportBuilder through the encoded attribute cache, encoding it into the cache first if
+/// no other ReadHandler read it in this run.
+///
+/// Returns std::nullopt, leaving reportBuilder unchanged, if the value cannot be cached (including read errors) or does
+/// not fit in the report.  The attribute must then be read directly, which also takes care of list chunking.
+std::optional<DataModel::ActionReturnStatus>
+ReadAttributeThroughCache(DataModel::Provider * dataModel, EncodedAttributeCache & cache,
+                          const DataModel::ReadAttributeRequest & readRequest, DataVersion version,
+                          AttributeReportIBs::Builder & reportBuilder)
+{
+    EncodedAttributeCache::Key key;
+    key.path           = readRequest.path;
+    key.dataVersion    = version;
+    key.fabricFiltered = readRequest.readFlags.Has(DataModel::ReadFlags::kFabricFiltered);
+
+    ByteSpan encoded;
+    if (!cache.Find(key, encoded))
+    {
+        MutableByteSpan freeSpace = cache.FreeSpace();
+        VerifyOrReturnValue(!freeSpace.empty(), std::nullopt);
+
+        TLV::TLVWriter writer;
+        writer.Init(freeSpace);
+        AttributeReportIBs::Builder cacheBuilder;
+        VerifyOrReturnValue(cacheBuilder.Init(&writer) == CHIP_NO_ERROR, std::nullopt);
+
+        // Only the AttributeReportIB-s are cached, not the start of the AttributeReportIBs list around them.
+        const uint32_t start = writer.GetLengthWritten();
+        AttributeValueEncoder encoder(cacheBuilder, *readRequest.subjectDescriptor, readRequest.path, version, key.fabricFiltered);
+        VerifyOrReturnValue(dataModel->ReadAttribute(readRequest, encoder).IsSuccess(), std::nullopt);
+
+        encoded = ByteSpan(freeSpace.data() + start, writer.GetLengthWritten() - start);
+        cache.Insert(key, encoded);
+    }
+
+    TLV::TLVWriter checkpoint;
+    reportBuilder.Checkpoint(checkpoint);
+    if (CopyEncodedAttributeReports(encoded, reportBuilder) != CHIP_NO_ERROR)
+    {
+        reportBuilder.Rollback(checkpoint);
+        return std::nullopt;
+    }
+    return std::make_optional<DataModel::ActionReturnStatus>(CHIP_NO_ERROR);
+}
+#endif // CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE > 0
+
+/// Reads the given attribute into reportBuilder.
+///
+/// encodedAttributeCache may be null; otherwise, attributes that other ReadHandler-s may report identically are read through
+/// it.
 DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataModel, const SubjectDescriptor & subjectDescriptor,
                                                   bool isFabricFiltered, AttributeReportIBs::Builder & reportBuilder,
-                                                  const ConcreteReadAttributePath & path, AttributeEncodeState * encoderState)
+                                                  const ConcreteReadAttributePath & path, AttributeEncodeState * encoderState,
+                                                  EncodedAttributeCache * encodedAttributeCache)
 {
     ChipLogDetail(DataManagement, "<RE:Run> Cluster %" PRIx32 ", Attribute %" PRIx32 " is dirty", path.mClusterId,
                   path.mAttributeId);
@@ -169,7 +247,16 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
     }
     else
     {
-        status = dataModel->ReadAttribute(readRequest, attributeValueEncoder);
+        std::optional<DataModel::ActionReturnStatus> cachedStatus;
+#if CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE > 0
+        // Values are only shared when encoded from the start: a list resumed in a later chunk is specific to this report.
+        const bool startsEncoding = (encoderState == nullptr) || (encoderState->CurrentEncodingListIndex() == kInvalidListIndex);
+        if (encodedAttributeCache != nullptr && startsEncoding && IsSubjectIndependentAttribute(dataModel, path))
+        {
+            cachedStatus = ReadAttributeThroughCache(dataModel, *encodedAttributeCache, readRequest, version, reportBuilder);
+        }
+#endif // CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE > 0
+        status = cachedStatus.has_value() ? *cachedStatus : dataModel->ReadAttribute(readRequest, attributeValueEncoder);
     }
 
     if (status.IsSuccess())
@@ -217,6 +304,21 @@ bool IsClusterDataVersionEqualTo(DataModel::Provider * dataModel, const Concrete
     return (info->dataVersion == dataVersion);
 }
 
+#if CHIP_IM_SERVER_MAX_CACHED_ATTRIBUTE_PATHS_PER_READ_HANDLER > 0
+/// Returns true if marking the given path dirty may signal a change in the set of endpoints, clusters or attributes.
+///
+/// Such changes are reported through the Descriptor PartsList and ServerList attributes and the global AttributeList
+/// attribute, or by marking a whole endpoint dirty (see emberAfEndpointChanged).
+bool IsDataModelStructureChange(const AttributePathParams & path)
+{
+    using namespace Clusters;
+
+    return path.Intersects(AttributePathParams(Descriptor::Id, Descriptor::Attributes::PartsList::Id)) ||
+        path.Intersects(AttributePathParams(Descriptor::Id, Descriptor::Attributes::ServerList::Id)) ||
+        path.Intersects(AttributePathParams(kInvalidClusterId, Globals::Attributes::AttributeList::Id));
+}
+#endif // CHIP_IM_SERVER_MAX_CACHED_ATTRIBUTE_PATHS_PER_READ_HANDLER > 0
+
 } // namespace
 
 Engine::Engine(InteractionModelEngine * apImEngine) : mpImEngine(apImEngine) {}
@@ -235,7 +337,7 @@ void Engine::Shutdown()
 
     mNumReportsInFlight = 0;
     mCurReadHandlerIdx  = 0;
-    mGlobalDirtySet.ReleaseAll();
+    mGlobalDirtySet.Clear();
 }
 
 bool Engine::IsClusterDataVersionMatch(const SingleLinkedListNode<DataVersionFilter> * aDataVersionFilterList,
@@ -276,6 +378,13 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
     const uint32_t kReservedSizeEndOfReportIBs = 1;
     bool reservedEndOfReportIBs                = false;
 
+#if CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE > 0
+    // Values cached by the current run are only valid during that run.
+    EncodedAttributeCache * encodedAttributeCache = (apReadHandler == mRunningReadHandler) ? &mEncodedAttributeCache : nullptr;
+#else
+    EncodedAttributeCache * encodedAttributeCache = nullptr;
+#endif // CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE > 0
+
     aReportDataBuilder.Checkpoint(backup);
 
     AttributeReportIBs::Builder & attributeReportIBs = aReportDataBuilder.CreateAttributeReportIBs();
@@ -317,23 +426,10 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
         {
             if (!apReadHandler->IsPriming())
             {
-                bool concretePathDirty = false;
+                // We don't need to worry about paths that were already marked dirty before the last time this read handler
+                // started a report that it completed: those paths already got reported.
                 // TODO: Optimize this implementation by making the iterator only emit intersected paths.
-                mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
-                    if (dirtyPath->IsAttributePathSupersetOf(readPath))
-                    {
-                        // We don't need to worry about paths that were already marked dirty before the last time this read handler
-                        // started a report that it completed: those paths already got reported.
-                        if (dirtyPath->mGeneration > apReadHandler->mPreviousReportsBeginGeneration)
-                        {
-                            concretePathDirty = true;
-                            return Loop::Break;
-                        }
-                    }
-                    return Loop::Continue;
-                });
-
-                if (!concretePathDirty)
+                if (!mGlobalDirtySet.IsDirtySince(readPath, apReadHandler->mPreviousReportsBeginGeneration))
                 {
                     // This attribute is not dirty, we just skip this one.
                     continue;
@@ -362,9 +458,13 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             ConcreteReadAttributePath pathForRetrieval(readPath);
             // Load the saved state from previous encoding session for chunking of one single attribute (list chunking).
             AttributeEncodeState encodeState = apReadHandler->GetAttributeEncodeState();
-            DataModel::ActionReturnStatus status =
-                RetrieveClusterData(mpImEngine->GetDataModelProvider(), apReadHandler->GetSubjectDescriptor(),
-                                    apReadHandler->IsFabricFiltered(), attributeReportIBs, pathForRetrieval, &encodeState);
+            DataModel::ActionReturnStatus status(CHIP_NO_ERROR);
+            {
+                IM_CLUSTER_STATS_TIME(kReport, pathForRetrieval.mClusterId, pathForRetrieval.mAttributeId);
+                status = RetrieveClusterData(mpImEngine->GetDataModelProvider(), apReadHandler->GetSubjectDescriptor(),
+                                             apReadHandler->IsFabricFiltered(), attributeReportIBs, pathForRetrieval, &encodeState,
+                                             encodedAttributeCache);
+            }
             if (status.IsError())
             {
                 // Operation error set, since this will affect early return or override on status encoding
@@ -387,6 +487,7 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
                     // is true, we may not have encoded a complete attribute value, but we did, if we encoded anything, encode a
                     // set of complete AttributeReportIB instances that represent part of the attribute value.
                     apReadHandler->SetAttributeEncodeState(encodeState);
+                    IM_CLUSTER_STATS_RECORD_CHUNK(pathForRetrieval.mClusterId, pathForRetrieval.mAttributeId);
                 }
                 else
                 {
@@ -421,6 +522,9 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
                     }
                 }
             }
+            // What remains after the rollbacks above is what this attribute adds to the report.
+            IM_CLUSTER_STATS_RECORD_BYTES(kReport, pathForRetrieval.mClusterId, pathForRetrieval.mAttributeId,
+                                          attributeReportIBs.GetWriter()->GetLengthWritten() - attributeBackup.GetLengthWritten());
             SuccessOrExit(err);
             // Successfully encoded the attribute, clear the internal state.
             apReadHandler->SetAttributeEncodeState(AttributeEncodeState());
@@ -691,6 +795,14 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     reportBufferMaxSize = apReadHandler->GetReportBufferMaxSize();
 
     bufHandle = System::PacketBufferHandle::New(reportBufferMaxSize);
+    if (bufHandle.IsNull() && reportBufferMaxSize > kMaxSecureSduLengthBytes)
+    {
+        // Large buffers are scarce on some platforms: keep reporting, in MTU-sized chunks, rather than fail the report.
+        ChipLogDetail(DataManagement, "No large buffer for the report, falling back to %u bytes chunks",
+                      static_cast<unsigned>(kMaxSecureSduLengthBytes));
+        reportBufferMaxSize = kMaxSecureSduLengthBytes;
+        bufHandle           = System::PacketBufferHandle::New(reportBufferMaxSize);
+    }
     VerifyOrExit(!bufHandle.IsNull(), err = CHIP_ERROR_NO_MEMORY);
 
     if (bufHandle->AvailableDataLength() > reportBufferMaxSize)
@@ -840,8 +952,15 @@ CHIP_ERROR Engine::ScheduleRun()
 
 void Engine::Run()
 {
+    CHIP_MEMORY_TAG_SCOPE(kInteractionModel);
+
     uint32_t numReadHandled = 0;
 
+#if CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE > 0
+    // Attribute values may have changed since the last run.
+    mEncodedAttributeCache.Clear();
+#endif // CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE > 0
+
     // We may be deallocating read handlers as we go.  Track how many we had
     // initially, so we make sure to go through all of them.
     size_t initialAllocated = mpImEngine->mReadHandlers.Allocated();
@@ -854,8 +973,13 @@ void Engine::Run()
         if (readHandler->ShouldReportUnscheduled() || mpImEngine->GetReportScheduler()->IsReportableNow(readHandler))
         {
 
+            CHIP_ERROR err      = CHIP_NO_ERROR;
             mRunningReadHandler = readHandler;
-            CHIP_ERROR err      = BuildAndSendSingleReportData(readHandler);
+            {
+                // The scope only restores a pointer on exit, so the handler may be freed while building the report.
+                InteractionArena::Scope arenaScope(readHandler->GetArena());
+                err = BuildAndSendSingleReportData(readHandler);
+            }
             mRunningReadHandler = nullptr;
             if (err != CHIP_NO_ERROR)
             {
@@ -896,148 +1020,25 @@ void Engine::Run()
     {
         ChipLogDetail(DataManagement, "All ReadHandler-s are clean, clear GlobalDirtySet");
 
-        mGlobalDirtySet.ReleaseAll();
+        mGlobalDirtySet.Clear();
     }
 }
 
-bool Engine::MergeOverlappedAttributePath(const AttributePathParams & aAttributePath)
-{
-    return Loop::Break == mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
-        if (path->IsAttributePathSupersetOf(aAttributePath))
-        {
-            path->mGeneration = GetDirtySetGeneration();
-            return Loop::Break;
-        }
-        if (aAttributePath.IsAttributePathSupersetOf(*path))
-        {
-            // TODO: the wildcard input path may be superset of next paths in globalDirtySet, it is fine at this moment, since
-            // when building report, it would use the first path of globalDirtySet to compare against interested paths read clients
-            // want.
-            // It is better to eliminate the duplicate wildcard paths in follow-up
-            path->mGeneration  = GetDirtySetGeneration();
-            path->mEndpointId  = aAttributePath.mEndpointId;
-            path->mClusterId   = aAttributePath.mClusterId;
-            path->mListIndex   = aAttributePath.mListIndex;
-            path->mAttributeId = aAttributePath.mAttributeId;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
-}
-
-bool Engine::ClearTombPaths()
-{
-    bool pathReleased = false;
-    mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
-        if (path->mGeneration == 0)
-        {
-            mGlobalDirtySet.ReleaseObject(path);
-            pathReleased = true;
-        }
-        return Loop::Continue;
-    });
-    return pathReleased;
-}
-
-bool Engine::MergeDirtyPathsUnderSameCluster()
-{
-    mGlobalDirtySet.ForEachActiveObject([&](auto * outerPath) {
-        if (outerPath->HasWildcardClusterId() || outerPath->mGeneration == 0)
-        {
-            return Loop::Continue;
-        }
-        mGlobalDirtySet.ForEachActiveObject([&](auto * innerPath) {
-            if (innerPath == outerPath)
-            {
-                return Loop::Continue;
-            }
-            // We don't support paths with a wildcard endpoint + a concrete cluster in global dirty set, so we do a simple == check
-            // here.
-            if (innerPath->mEndpointId != outerPath->mEndpointId || innerPath->mClusterId != outerPath->mClusterId)
-            {
-                return Loop::Continue;
-            }
-            if (innerPath->mGeneration > outerPath->mGeneration)
-            {
-                outerPath->mGeneration = innerPath->mGeneration;
-            }
-            outerPath->SetWildcardAttributeId();
-
-            // The object pool does not allow us to release objects in a nested iteration, mark the path as a tomb by setting its
-            // generation to 0 and then clear it later.
-            innerPath->mGeneration = 0;
-            return Loop::Continue;
-        });
-        return Loop::Continue;
-    });
-
-    return ClearTombPaths();
-}
-
-bool Engine::MergeDirtyPathsUnderSameEndpoint()
+CHIP_ERROR Engine::SetDirty(const AttributePathParams & aAttributePath)
 {
-    mGlobalDirtySet.ForEachActiveObject([&](auto * outerPath) {
-        if (outerPath->HasWildcardEndpointId() || outerPath->mGeneration == 0)
-        {
-            return Loop::Continue;
-        }
-        mGlobalDirtySet.ForEachActiveObject([&](auto * innerPath) {
-            if (innerPath == outerPath)
-            {
-                return Loop::Continue;
-            }
-            if (innerPath->mEndpointId != outerPath->mEndpointId)
-            {
-                return Loop::Continue;
-            }
-            if (innerPath->mGeneration > outerPath->mGeneration)
-            {
-                outerPath->mGeneration = innerPath->mGeneration;
-            }
-            outerPath->SetWildcardClusterId();
-            outerPath->SetWildcardAttributeId();
+    BumpDirtySetGeneration();
 
-            // The object pool does not allow us to release objects in a nested iteration, mark the path as a tomb by setting its
-            // generation to 0 and then clear it later.
-            innerPath->mGeneration = 0;
+#if CHIP_IM_SERVER_MAX_CACHED_ATTRIBUTE_PATHS_PER_READ_HANDLER > 0
+    // Every handler drops its cached path expansion, including those whose paths do not intersect the dirty path: removing
+    // an endpoint only marks the PartsList attributes dirty.
+    if (IsDataModelStructureChange(aAttributePath))
+    {
+        mpImEngine->mReadHandlers.ForEachActiveObject([](ReadHandler * handler) {
+            handler->DataModelStructureChanged();
             return Loop::Continue;
         });
-        return Loop::Continue;
-    });
-    return ClearTombPaths();
-}
-
-CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttributePath)
-{
-    VerifyOrReturnError(!MergeOverlappedAttributePath(aAttributePath), CHIP_NO_ERROR);
-
-    if (mGlobalDirtySet.Exhausted() && !MergeDirtyPathsUnderSameCluster() && !MergeDirtyPathsUnderSameEndpoint())
-    {
-        ChipLogDetail(DataManagement, "Global dirty set pool exhausted, merge all paths.");
-        mGlobalDirtySet.ReleaseAll();
-        auto object         = mGlobalDirtySet.CreateObject();
-        object->mGeneration = GetDirtySetGeneration();
     }
-
-    VerifyOrReturnError(!MergeOverlappedAttributePath(aAttributePath), CHIP_NO_ERROR);
-    ChipLogDetail(DataManagement, "Cannot merge the new path into any existing path, create one.");
-
-    auto object = mGlobalDirtySet.CreateObject();
-    if (object == nullptr)
-    {
-        // This should not happen, this path should be merged into the wildcard endpoint at least.
-        ChipLogError(DataManagement, "mGlobalDirtySet pool full, cannot handle more entries!");
-        return CHIP_ERROR_NO_MEMORY;
-    }
-    *object             = aAttributePath;
-    object->mGeneration = GetDirtySetGeneration();
-
-    return CHIP_NO_ERROR;
-}
-
-CHIP_ERROR Engine::SetDirty(const AttributePathParams & aAttributePath)
-{
-    BumpDirtySetGeneration();
+#endif // CHIP_IM_SERVER_MAX_CACHED_ATTRIBUTE_PATHS_PER_READ_HANDLER > 0
 
     bool intersectsInterestPath = false;
     mpImEngine->mReadHandlers.ForEachActiveObject([&aAttributePath, &intersectsInterestPath](ReadHandler * handler) {
@@ -1064,7 +1065,7 @@ CHIP_ERROR Engine::SetDirty(const AttributePathParams & aAttributePath)
     {
         return CHIP_NO_ERROR;
     }
-    ReturnErrorOnFailure(InsertPathIntoDirtySet(aAttributePath));
+    mGlobalDirtySet.MarkDirty(aAttributePath, GetDirtySetGeneration());
 
     return CHIP_NO_ERROR;
 }
@@ -1141,7 +1142,7 @@ CHIP_ERROR Engine::ScheduleEventDelivery(ConcreteEventPath & aPath, uint32_t aBy
 
     bool isUrgentEvent = false;
     mpImEngine->mReadHandlers.ForEachActiveObject([&aPath, &isUrgentEvent](ReadHandler * handler) {
-        if (handler->IsType(ReadHandler::InteractionType::Read))
+        if (handler->IsType(ReadHandler::InteractionType::Read) || !handler->MayHaveUrgentEventPathFor(aPath))
         {
             return Loop::Continue;
         }
@@ -24,6 +24,7 @@
 #include <app/ReadHandler.h>
 #include <app/icd/server/ICDStateObserver.h>
 #include <lib/core/CHIPError.h>
+#include <lib/core/ScopedNodeId.h>
 #include <system/SystemClock.h>
 
 namespace chip {
@@ -198,7 +199,7 @@ public:
 
     /// @brief Check whether a ReadHandler is reportable right now, taking into account its minimum and maximum intervals.
     /// @param aReadHandler read handler to check
-    bool IsReportableNow(ReadHandler * aReadHandler)
+    virtual bool IsReportableNow(ReadHandler * aReadHandler)
     {
         // Update the now timestamp to ensure external calls to IsReportableNow are always comparing to the current time
         Timestamp now          = mTimerDelegate->GetCurrentMonotonicTimestamp();
@@ -211,6 +212,13 @@ public:
     {
         return (nullptr != aReadHandler) ? aReadHandler->ShouldStartReporting() : false;
     }
+    /// @brief Check if a ReadHandler has data to report, either from data changes or from its ForceDirty flag
+    bool IsReadHandlerDirty(const ReadHandler * aReadHandler) const { return aReadHandler->IsDirty(); }
+    /// @brief Check if the ForceDirty flag of a ReadHandler is set, for instance by an urgent event
+    bool IsReadHandlerForcedDirty(const ReadHandler * aReadHandler) const
+    {
+        return aReadHandler->mFlags.Has(ReadHandler::ReadHandlerFlags::ForceDirty);
+    }
     /// @brief Sets the ForceDirty flag of a ReadHandler
     void HandlerForceDirtyState(ReadHandler * aReadHandler) { aReadHandler->ForceDirtyState(); }
 
@@ -234,6 +242,12 @@ public:
 protected:
     friend class chip::app::reporting::TestReportScheduler;
 
+    /// @brief Get the peer node and fabric of the session of a ReadHandler, with undefined ids if it has no session
+    static ScopedNodeId GetReadHandlerPeer(const ReadHandler & aReadHandler)
+    {
+        return ScopedNodeId(aReadHandler.GetInitiatorNodeId(), aReadHandler.GetAccessingFabricIndex());
+    }
+
     /// @brief Find the ReadHandlerNode for a given ReadHandler pointer
     /// @param [in] aReadHandler ReadHandler pointer to look for in the ReadHandler nodes list
     /// @return Node Address if the node was found, nullptr otherwise
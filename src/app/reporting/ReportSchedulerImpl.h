@@ -118,7 +118,7 @@ public:
      *
      * @note This method sets a now Timestamp that is used to calculate the next report timeout.
      */
-    void OnSubscriptionReportSent(ReadHandler * aReadHandler) final;
+    void OnSubscriptionReportSent(ReadHandler * aReadHandler) override;
 
     /**
      * @brief When a ReadHandler is destroyed, remove the node from the scheduler node pool and cancel the timer associated to it.
@@ -151,9 +151,6 @@ protected:
     void CancelReport(ReadHandler * aReadHandler);
     virtual void UnregisterAllHandlers();
 
-private:
-    friend class chip::app::reporting::TestReportScheduler;
-
     /**
      * @brief Find the next timestamp when a report should be scheduled for a ReadHandler.
      *
@@ -165,6 +162,9 @@ private:
      *
      */
     virtual CHIP_ERROR CalculateNextReportTimeout(Timeout & timeout, ReadHandlerNode * aNode, const Timestamp & now);
+
+private:
+    friend class chip::app::reporting::TestReportScheduler;
 };
 
 } // namespace reporting
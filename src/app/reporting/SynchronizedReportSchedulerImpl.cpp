@@ -16,9 +16,14 @@
  */
 
 #include <app/InteractionModelEngine.h>
+#include <app/icd/server/ICDServerConfig.h>
 #include <app/reporting/SynchronizedReportSchedulerImpl.h>
 #include <lib/support/logging/CHIPLogging.h>
 
+#if CHIP_CONFIG_ENABLE_ICD_SERVER
+#include <app/icd/server/ICDConfigurationData.h> //nogncheck
+#endif
+
 namespace chip {
 namespace app {
 namespace reporting {
@@ -44,8 +49,33 @@ void SynchronizedReportSchedulerImpl::OnReadHandlerDestroyed(ReadHandler * aRead
     }
 }
 
+void SynchronizedReportSchedulerImpl::OnEnterActiveMode()
+{
+    mICDIdle = false;
+    ReportSchedulerImpl::OnEnterActiveMode();
+
+    VerifyOrReturn(mMode == Mode::kICDActiveWindows && mNodesPool.Allocated());
+
+    // Send the reports held during IdleMode
+    Timestamp now   = mTimerDelegate->GetCurrentMonotonicTimestamp();
+    Timeout timeout = Milliseconds32(0);
+    ReturnOnFailure(CalculateNextReportTimeout(timeout, nullptr, now));
+    ScheduleReport(timeout, nullptr, now);
+}
+
+void SynchronizedReportSchedulerImpl::OnEnterIdleMode()
+{
+    mICDIdle = true;
+}
+
 void SynchronizedReportSchedulerImpl::OnTransitionToIdle()
 {
+    if (mMode == Mode::kICDActiveWindows)
+    {
+        ReportBeforeIdleMode();
+        return;
+    }
+
     Timestamp now               = mTimerDelegate->GetCurrentMonotonicTimestamp();
     uint32_t targetIdleInterval = static_cast<uint32_t>(ICD_SLEEP_TIME_JITTER_MS);
     VerifyOrReturn(now >= mNextReportTimestamp);
@@ -84,6 +114,52 @@ bool SynchronizedReportSchedulerImpl::IsReportScheduled(ReadHandler * ReadHandle
     return mTimerDelegate->IsTimerActive(this);
 }
 
+bool SynchronizedReportSchedulerImpl::IsReportableNow(ReadHandler * aReadHandler)
+{
+    Timestamp now          = mTimerDelegate->GetCurrentMonotonicTimestamp();
+    ReadHandlerNode * node = FindReadHandlerNode(aReadHandler);
+    VerifyOrReturnValue(nullptr != node && node->IsReportableNow(now), false);
+
+    // Held reports are only sent along with a report the scheduler has decided to send
+    return node->IsEngineRunScheduled() || !IsReportHeld(*node, now);
+}
+
+bool SynchronizedReportSchedulerImpl::IsReportHeld(const ReadHandlerNode & aNode, const Timestamp & now) const
+{
+    VerifyOrReturnValue(mMode == Mode::kICDActiveWindows && mICDIdle, false);
+
+    const ReadHandler * readHandler = aNode.GetReadHandler();
+    return !IsReadHandlerForcedDirty(readHandler) && !aNode.IsChunkedReport() && now < aNode.GetMaxTimestamp();
+}
+
+void SynchronizedReportSchedulerImpl::ReportBeforeIdleMode()
+{
+    Timestamp now = mTimerDelegate->GetCurrentMonotonicTimestamp();
+
+    // The ICD goes to IdleMode in ICD_ACTIVE_TIME_JITTER_MS, and stays there for the IdleMode duration
+    Timestamp nextActiveMode = now + Milliseconds32(ICD_ACTIVE_TIME_JITTER_MS);
+#if CHIP_CONFIG_ENABLE_ICD_SERVER
+    nextActiveMode += ICDConfigurationData::GetInstance().GetIdleModeDuration();
+#endif // CHIP_CONFIG_ENABLE_ICD_SERVER
+
+    bool reportScheduled = false;
+    mNodesPool.ForEachActiveObject([this, now, nextActiveMode, &reportScheduled](ReadHandlerNode * node) {
+        if (node->CanStartReporting() && now >= node->GetMinTimestamp() &&
+            (this->IsReadHandlerReportable(node->GetReadHandler()) || node->GetMaxTimestamp() <= nextActiveMode))
+        {
+            node->SetCanBeSynced(true);
+            node->SetEngineRunScheduled(true);
+            reportScheduled = true;
+        }
+
+        return Loop::Continue;
+    });
+
+    VerifyOrReturn(reportScheduled);
+    CancelReport();
+    InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
+}
+
 CHIP_ERROR SynchronizedReportSchedulerImpl::FindNextMaxInterval(const Timestamp & now)
 {
     VerifyOrReturnError(mNodesPool.Allocated(), CHIP_ERROR_INVALID_LIST_LENGTH);
@@ -140,7 +216,7 @@ CHIP_ERROR SynchronizedReportSchedulerImpl::CalculateNextReportTimeout(Timeout &
         // If a node is already scheduled, we don't need to check if it is reportable now unless a chunked report is in progress.
         // In this case, the node will be Reportable, as it is impossible to have node->IsChunkedReport() == true without being
         // reportable, therefore we need to keep scheduling engine runs until the report is complete
-        if (!node->IsEngineRunScheduled() || node->IsChunkedReport())
+        if ((!node->IsEngineRunScheduled() || node->IsChunkedReport()) && !this->IsReportHeld(*node, now))
         {
             if (node->IsReportableNow(now))
             {
@@ -182,7 +258,7 @@ void SynchronizedReportSchedulerImpl::TimerFired()
     // If there are no handlers registered, no need to do anything.
     VerifyOrReturn(mNodesPool.Allocated());
 
-    mNodesPool.ForEachActiveObject([now, &firedEarly](ReadHandlerNode * node) {
+    mNodesPool.ForEachActiveObject([this, now, &firedEarly](ReadHandlerNode * node) {
         if (node->GetMinTimestamp() <= now && node->CanStartReporting())
         {
             // Since this handler can now report whenever it wants to, mark it as allowed to report if any other handler is
@@ -190,7 +266,7 @@ void SynchronizedReportSchedulerImpl::TimerFired()
             node->SetCanBeSynced(true);
         }
 
-        if (node->IsReportableNow(now))
+        if (node->IsReportableNow(now) && !this->IsReportHeld(*node, now))
         {
             // We set firedEarly false here because we assume we fired the timer early if no handler is reportable at the
             // moment, which becomes false if we find a handler that is reportable
@@ -215,6 +291,16 @@ void SynchronizedReportSchedulerImpl::TimerFired()
     }
     else
     {
+        // Held reports are sent along with the scheduled ones
+        mNodesPool.ForEachActiveObject([now](ReadHandlerNode * node) {
+            if (node->IsReportableNow(now))
+            {
+                node->SetEngineRunScheduled(true);
+            }
+
+            return Loop::Continue;
+        });
+
         // If we have a reportable handler, we can schedule an engine run
         InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
     }
@@ -73,18 +73,43 @@ using TimerDelegate   = ReportScheduler::TimerDelegate;
  * fires before a reportable timestamp is reached.
  *
  * @note In this implementation, nodes still keep track of their own min and max interval timestamps.
+ *
+ * ## ICD Active Windows Mode
+ *
+ * When constructed with Mode::kICDActiveWindows, the scheduler also aligns the reports of all ReadHandlers to the ActiveMode
+ * windows of the ICD, so that the radio is woken up as little as possible:
+ *
+ * - While the ICD is in IdleMode, reports for data changes are held. Only urgent reports (ReadHandlers forced dirty, chunked
+ *   reports) and reports that reached their max interval are scheduled, and the held reports are sent along with them.
+ *
+ * - When the ICD enters ActiveMode, the held reports are sent together in one burst.
+ *
+ * - When the ICD is about to go back to IdleMode, every ReadHandler past its min interval that has data to report, or whose
+ *   max interval would expire before the next ActiveMode, reports in one burst. This moves the max intervals of the
+ *   ReadHandlers to the ActiveMode windows instead of waking up the ICD for each of them.
  */
 class SynchronizedReportSchedulerImpl : public ReportSchedulerImpl, public TimerContext
 {
 public:
+    enum class Mode : uint8_t
+    {
+        kDefault,          ///< Synchronize the reports on the min and max intervals of the ReadHandlers
+        kICDActiveWindows, ///< Also align the reports to the ActiveMode windows of the ICD
+    };
+
     void OnReadHandlerDestroyed(ReadHandler * aReadHandler) override;
 
-    SynchronizedReportSchedulerImpl(TimerDelegate * aTimerDelegate) : ReportSchedulerImpl(aTimerDelegate) {}
+    SynchronizedReportSchedulerImpl(TimerDelegate * aTimerDelegate, Mode aMode = Mode::kDefault) :
+        ReportSchedulerImpl(aTimerDelegate), mMode(aMode)
+    {}
     ~SynchronizedReportSchedulerImpl() override { UnregisterAllHandlers(); }
 
+    void OnEnterActiveMode() override;
     void OnTransitionToIdle() override;
+    void OnEnterIdleMode() override;
 
     bool IsReportScheduled(ReadHandler * ReadHandler) override;
+    bool IsReportableNow(ReadHandler * aReadHandler) override;
 
     /** @brief Callback called when the report timer expires to schedule an engine run regardless of the state of the ReadHandlers,
      *
@@ -173,6 +198,20 @@ private:
      */
     CHIP_ERROR CalculateNextReportTimeout(Timeout & timeout, ReadHandlerNode * aReadHandlerNode, const Timestamp & now) override;
 
+    /**
+     * @brief Check whether the report of a node is held until the next ActiveMode window, see Mode::kICDActiveWindows.
+     */
+    bool IsReportHeld(const ReadHandlerNode & aNode, const Timestamp & now) const;
+
+    /**
+     * @brief Send in one burst the reports that would otherwise be sent during the next IdleMode period, see
+     *        Mode::kICDActiveWindows.
+     */
+    void ReportBeforeIdleMode();
+
+    Mode mMode;
+    bool mICDIdle = false;
+
     Timestamp mNextMaxTimestamp = Milliseconds64(0);
     Timestamp mNextMinTimestamp = Milliseconds64(0);
 
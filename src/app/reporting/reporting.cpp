@@ -19,11 +19,33 @@
 #include <app/AttributePathParams.h>
 #include <app/InteractionModelEngine.h>
 #include <app/util/attribute-storage.h>
+#include <lib/support/LockFreeStagingRing.h>
 #include <platform/LockTracker.h>
+#include <platform/PlatformManager.h>
 
 using namespace chip;
 using namespace chip::app;
 
+namespace {
+
+struct StagedAttributeChange
+{
+    EndpointId endpoint   = kInvalidEndpointId;
+    ClusterId cluster     = kInvalidClusterId;
+    AttributeId attribute = kInvalidAttributeId;
+};
+
+LockFreeStagingRing<StagedAttributeChange, CHIP_CONFIG_STAGED_ATTRIBUTE_CHANGES_QUEUE_SIZE> sStagedAttributeChanges;
+
+void ReportStagedAttributeChanges(intptr_t)
+{
+    sStagedAttributeChanges.Drain([](const StagedAttributeChange & change) {
+        MatterReportingAttributeChangeCallback(change.endpoint, change.cluster, change.attribute);
+    });
+}
+
+} // namespace
+
 void MatterReportingAttributeChangeCallback(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId)
 {
     // Attribute writes have asserted this already, but this assert should catch
@@ -51,3 +73,25 @@ void MatterReportingAttributeChangeCallback(EndpointId endpoint)
 
     emberAfEndpointChanged(endpoint, emberAfGlobalInteractionModelAttributesChangedListener());
 }
+
+CHIP_ERROR MatterReportingStageAttributeChange(const ConcreteAttributePath & aPath)
+{
+    bool needsWake = false;
+    ReturnErrorOnFailure(sStagedAttributeChanges.Push(
+        [&aPath](StagedAttributeChange & change) {
+            change.endpoint  = aPath.mEndpointId;
+            change.cluster   = aPath.mClusterId;
+            change.attribute = aPath.mAttributeId;
+            return CHIP_NO_ERROR;
+        },
+        needsWake));
+    VerifyOrReturnError(needsWake, CHIP_NO_ERROR);
+
+    CHIP_ERROR err = DeviceLayer::PlatformMgr().ScheduleWork(ReportStagedAttributeChanges);
+    if (err != CHIP_NO_ERROR)
+    {
+        // The change stays staged, and is reported along with the next one.
+        sStagedAttributeChanges.CancelWake();
+    }
+    return err;
+}
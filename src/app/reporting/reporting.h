@@ -18,6 +18,7 @@
 #pragma once
 
 #include <app/ConcreteAttributePath.h>
+#include <lib/core/CHIPError.h>
 
 /** @brief Reporting Attribute Change
  *
@@ -37,3 +38,12 @@ void MatterReportingAttributeChangeCallback(const chip::app::ConcreteAttributePa
  * Same but only with an EndpointId, this is used when adding / enabling an endpoint during runtime.
  */
 void MatterReportingAttributeChangeCallback(chip::EndpointId endpoint);
+
+/*
+ * Same, but callable from any thread without holding the stack lock: the change is staged in a lock-free queue, and
+ * reported on the Matter thread along with the other changes staged by then.
+ *
+ * Returns CHIP_ERROR_NO_MEMORY when the queue, of CHIP_CONFIG_STAGED_ATTRIBUTE_CHANGES_QUEUE_SIZE changes, is full: the
+ * caller then has to report the change with the stack lock held.
+ */
+CHIP_ERROR MatterReportingStageAttributeChange(const chip::app::ConcreteAttributePath & aPath);
@@ -100,14 +100,50 @@ static uint8_t sDebugEventBuffer[CHIP_DEVICE_CONFIG_EVENT_LOGGING_DEBUG_BUFFER_S
 static uint8_t sCritEventBuffer[CHIP_DEVICE_CONFIG_EVENT_LOGGING_CRIT_BUFFER_SIZE];
 static ::chip::PersistedCounter<chip::EventNumber> sGlobalEventIdCounter;
 static ::chip::app::CircularEventBuffer sLoggingBuffer[CHIP_NUM_EVENT_LOGGING_BUFFERS];
+#if CHIP_CONFIG_ENABLE_PERSISTENT_EVENT_LOG
+static ::chip::app::PersistentEventLog sPersistentEventLog;
+#endif // CHIP_CONFIG_ENABLE_PERSISTENT_EVENT_LOG
 #endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
 
+namespace {
+
+// Logs the time taken by the steps of the server initialization, when CHIP_CONFIG_SERVER_INIT_PROFILING is enabled.
+class InitProfiler
+{
+public:
+    explicit InitProfiler(System::Clock::Microseconds64 start) : mStart(start), mStepStart(start) {}
+
+    void StepDone(const char * step)
+    {
+#if CHIP_CONFIG_SERVER_INIT_PROFILING
+        const System::Clock::Microseconds64 now = System::SystemClock().GetMonotonicMicroseconds64();
+        ChipLogProgress(AppServer, "Server init: %s took %" PRIu32 " us", step, static_cast<uint32_t>((now - mStepStart).count()));
+        mStepStart = now;
+#endif // CHIP_CONFIG_SERVER_INIT_PROFILING
+    }
+
+    void Done()
+    {
+#if CHIP_CONFIG_SERVER_INIT_PROFILING
+        const System::Clock::Microseconds64 now = System::SystemClock().GetMonotonicMicroseconds64();
+        ChipLogProgress(AppServer, "Server init took %" PRIu32 " us", static_cast<uint32_t>((now - mStart).count()));
+#endif // CHIP_CONFIG_SERVER_INIT_PROFILING
+    }
+
+private:
+    [[maybe_unused]] System::Clock::Microseconds64 mStart;
+    [[maybe_unused]] System::Clock::Microseconds64 mStepStart;
+};
+
+} // namespace
+
 CHIP_ERROR Server::Init(const ServerInitParams & initParams)
 {
     ChipLogProgress(AppServer, "Server initializing...");
     assertChipStackLockedByCurrentThread();
 
     mInitTimestamp = System::SystemClock().GetMonotonicMicroseconds64();
+    InitProfiler profiler(mInitTimestamp);
 
     CASESessionManagerConfig caseSessionManagerConfig;
     DeviceLayer::DeviceInfoProvider * deviceInfoprovider = nullptr;
@@ -169,6 +205,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     SuccessOrExit(err = mAttributePersister.Init(mDeviceStorage));
     SetAttributePersistenceProvider(&mAttributePersister);
     SetSafeAttributePersistenceProvider(&mAttributePersister);
+    profiler.StepDone("attribute persistence");
 
     // SetDataModelProvider() actually initializes/starts the provider.  We need
     // to preserve the following ordering guarantees:
@@ -180,6 +217,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     //    on atttribute persistence being already set up before it runs.  Longer-term, the logic from
     //    InitDataModelHandler should just move into the codegen provider.
     chip::app::InteractionModelEngine::GetInstance()->SetDataModelProvider(initParams.dataModelProvider);
+    profiler.StepDone("data model provider");
 
     {
         FabricTable::InitParams fabricTableInitParams;
@@ -190,6 +228,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
         err = mFabrics.Init(fabricTableInitParams);
         SuccessOrExit(err);
     }
+    profiler.StepDone("fabric table");
 
     SuccessOrExit(err = mAccessControl.Init(initParams.accessDelegate, sDeviceTypeResolver));
     Access::SetAccessControl(mAccessControl);
@@ -203,6 +242,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
 
     mAclStorage = initParams.aclStorage;
     SuccessOrExit(err = mAclStorage->Init(*mDeviceStorage, mFabrics.begin(), mFabrics.end()));
+    profiler.StepDone("access control");
 
     mGroupsProvider = initParams.groupDataProvider;
     SetGroupDataProvider(mGroupsProvider);
@@ -250,6 +290,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     );
 
     SuccessOrExit(err);
+    profiler.StepDone("transports");
     err = mListener.Init(this);
     SuccessOrExit(err);
     mGroupsProvider->SetListener(&mListener);
@@ -282,12 +323,14 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     app::DnssdServer::Instance().SetCommissioningModeProvider(&mCommissioningWindowManager);
 
     chip::Dnssd::Resolver::Instance().Init(DeviceLayer::UDPEndPointManager());
+    profiler.StepDone("sessions and exchanges");
 
 #if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
     // Initialize event logging subsystem
     err = sGlobalEventIdCounter.Init(mDeviceStorage, DefaultStorageKeyAllocator::IMEventNumber(),
                                      CHIP_DEVICE_CONFIG_EVENT_ID_COUNTER_EPOCH);
     SuccessOrExit(err);
+    sGlobalEventIdCounter.SetMaxEpoch(CHIP_DEVICE_CONFIG_EVENT_ID_COUNTER_MAX_EPOCH);
 
     {
         ::chip::app::LogStorageResources logStorageResources[] = {
@@ -300,10 +343,26 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
                                                        &logStorageResources[0], &sGlobalEventIdCounter,
                                                        std::chrono::duration_cast<System::Clock::Milliseconds64>(mInitTimestamp));
     }
+
+#if CHIP_CONFIG_ENABLE_PERSISTENT_EVENT_LOG
+    if (initParams.deferNonCriticalInit)
+    {
+        // Loaded once the server is ready, until then the events are only kept in the event buffers.
+        mHasDeferredInitSteps = true;
+    }
+    else
+    {
+        err = sPersistentEventLog.Init(mDeviceStorage);
+        SuccessOrExit(err);
+        chip::app::EventManagement::GetInstance().SetPersistentEventLog(&sPersistentEventLog);
+    }
+#endif // CHIP_CONFIG_ENABLE_PERSISTENT_EVENT_LOG
+    profiler.StepDone("event logging");
 #endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
 
     // This initializes clusters, so should come after lower level initialization.
     InitDataModelHandler();
+    profiler.StepDone("data model");
 
 #if defined(CHIP_APP_USE_ECHO)
     err = InitEchoHandler(&mExchangeMgr);
@@ -350,6 +409,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     // StartServer only enables commissioning mode if device has not been commissioned
     app::DnssdServer::Instance().StartServer();
 #endif
+    profiler.StepDone("DNS-SD");
 
     caseSessionManagerConfig = {
         .sessionInitParams =  {
@@ -377,6 +437,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     err = chip::app::InteractionModelEngine::GetInstance()->Init(&mExchangeMgr, &GetFabricTable(), mReportScheduler,
                                                                  &mCASESessionManager, mSubscriptionResumptionStorage);
     SuccessOrExit(err);
+    profiler.StepDone("CASE and interaction model");
 
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
     app::InteractionModelEngine::GetInstance()->SetICDManager(&mICDManager);
@@ -407,6 +468,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     {
         mTestEventTriggerDelegate->AddHandler(&mICDManager);
     }
+    profiler.StepDone("ICD");
 
 #endif // CHIP_CONFIG_ENABLE_ICD_SERVER
 
@@ -417,6 +479,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     // src/platform/OpenThread/GenericThreadStackManagerImpl_OpenThread_LwIP.cpp
 #if !CHIP_SYSTEM_CONFIG_USE_OPEN_THREAD_ENDPOINT
     RejoinExistingMulticastGroups();
+    profiler.StepDone("multicast groups");
 #endif // !CHIP_SYSTEM_CONFIG_USE_OPEN_THREAD_ENDPOINT
 
     // Handle deferred clean-up of a previously armed fail-safe that occurred during FabricTable commit.
@@ -476,6 +539,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
 
     mIsDnssdReady = Dnssd::Resolver::Instance().IsInitialized();
     CheckServerReadyEvent();
+    profiler.Done();
 
 exit:
     if (err != CHIP_NO_ERROR)
@@ -515,6 +579,7 @@ void Server::OnPlatformEvent(const DeviceLayer::ChipDeviceEvent & event)
             mICDManager.TriggerCheckInMessages(sendCheckInMessagesOnBootUp);
         }
 #endif // CHIP_CONFIG_ENABLE_ICD_SERVER && CHIP_CONFIG_ENABLE_ICD_CIP
+        CompleteDeferredInit();
 #if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
         ResumeSubscriptions();
 #endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
@@ -547,6 +612,22 @@ void Server::CheckServerReadyEvent()
     }
 }
 
+void Server::CompleteDeferredInit()
+{
+    VerifyOrReturn(mHasDeferredInitSteps);
+    mHasDeferredInitSteps = false;
+
+#if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT && CHIP_CONFIG_ENABLE_PERSISTENT_EVENT_LOG
+    CHIP_ERROR err = sPersistentEventLog.Init(mDeviceStorage);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(AppServer, "Failed to load the persistent event log: %" CHIP_ERROR_FORMAT, err.Format());
+        return;
+    }
+    chip::app::EventManagement::GetInstance().SetPersistentEventLog(&sPersistentEventLog);
+#endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT && CHIP_CONFIG_ENABLE_PERSISTENT_EVENT_LOG
+}
+
 void Server::OnPlatformEventWrapper(const DeviceLayer::ChipDeviceEvent * event, intptr_t server)
 {
     reinterpret_cast<Server *>(server)->OnPlatformEvent(*event);
@@ -617,6 +698,7 @@ void Server::Shutdown()
 {
     assertChipStackLockedByCurrentThread();
     PlatformMgr().RemoveEventHandler(OnPlatformEventWrapper, 0);
+    mHasDeferredInitSteps = false;
     mCASEServer.Shutdown();
     mCASESessionManager.Shutdown();
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
@@ -640,6 +722,10 @@ void Server::Shutdown()
 
     chip::Dnssd::Resolver::Instance().Shutdown();
     chip::app::InteractionModelEngine::GetInstance()->Shutdown();
+#if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT && CHIP_CONFIG_ENABLE_PERSISTENT_EVENT_LOG
+    chip::app::EventManagement::GetInstance().SetPersistentEventLog(nullptr);
+    sPersistentEventLog.Shutdown();
+#endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT && CHIP_CONFIG_ENABLE_PERSISTENT_EVENT_LOG
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
     app::InteractionModelEngine::GetInstance()->SetICDManager(nullptr);
 #endif // CHIP_CONFIG_ENABLE_ICD_SERVER
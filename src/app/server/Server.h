@@ -89,6 +89,10 @@ namespace chip {
 
 inline constexpr size_t kMaxBlePendingPackets = 1;
 
+#if CHIP_DEVICE_CONFIG_ENABLE_WIFIPAF
+inline constexpr size_t kMaxWiFiPAFPendingPackets = 4;
+#endif
+
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
 inline constexpr size_t kMaxTcpActiveConnectionCount = CHIP_CONFIG_MAX_ACTIVE_TCP_CONNECTIONS;
 
@@ -114,7 +118,7 @@ using ServerTransportMgr = chip::TransportMgr<chip::Transport::UDP
 #endif
 #if CHIP_DEVICE_CONFIG_ENABLE_WIFIPAF
                                               ,
-                                              chip::Transport::WiFiPAFBase
+                                              chip::Transport::WiFiPAF<kMaxWiFiPAFPendingPackets>
 #endif
                                               >;
 
@@ -197,6 +201,11 @@ struct ServerInitParams
     // data model it wants to use. Backwards-compatibility can use `CodegenDataModelProviderInstance`
     // for ember/zap-generated models.
     chip::app::DataModel::Provider * dataModelProvider = nullptr;
+
+    // Optional. When true, the loads from persistent storage that are not needed to become operational (currently the
+    // persistent event log) are deferred until the server is ready, i.e. once it is advertising. Subscriptions are always
+    // resumed once the server is ready.
+    bool deferNonCriticalInit = false;
 };
 
 /**
@@ -462,6 +471,11 @@ private:
     void OnPlatformEvent(const DeviceLayer::ChipDeviceEvent & event);
     void CheckServerReadyEvent();
 
+    /**
+     * @brief Runs the initialization steps deferred by ServerInitParams::deferNonCriticalInit, once the server is ready.
+     */
+    void CompleteDeferredInit();
+
     static void OnPlatformEventWrapper(const DeviceLayer::ChipDeviceEvent * event, intptr_t);
 
 #if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
@@ -702,7 +716,8 @@ private:
     Credentials::OperationalCertificateStore * mOpCertStore;
     app::FailSafeContext mFailSafeContext;
 
-    bool mIsDnssdReady = false;
+    bool mIsDnssdReady        = false;
+    bool mHasDeferredInitSteps = false;
     uint16_t mOperationalServicePort;
     uint16_t mUserDirectedCommissioningPort;
     Inet::InterfaceId mInterfaceId;
@@ -0,0 +1,446 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  @file
+ *    Measures the Interaction Model hot paths over the loopback transport of AppContext,
+ *    against a mock data model of a varying number of endpoints:
+ *      - wildcard read throughput
+ *      - report generation for N subscriptions x M dirty attributes
+ *      - batched invoke latency
+ *      - chunked write throughput
+ *
+ *    Each measurement is printed on a single line of space-separated key=value pairs,
+ *    starting with "BENCHMARK", so that results can be collected and compared across runs.
+ *    Usage: im-benchmark [--gtest_filter=InteractionModelBenchmark.<Scenario>]
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app/AttributePathParams.h>
+#include <app/CommandSender.h>
+#include <app/InteractionModelEngine.h>
+#include <app/ReadClient.h>
+#include <app/WriteClient.h>
+#include <app/data-model-provider/ActionReturnStatus.h>
+#include <app/data-model/List.h>
+#include <app/tests/AppTestContext.h>
+#include <app/tests/test-interaction-model-api.h>
+#include <app/util/mock/Constants.h>
+#include <app/util/mock/Functions.h>
+#include <app/util/mock/MockNodeConfig.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters::Globals::Attributes;
+using namespace chip::Test;
+
+namespace {
+
+constexpr EndpointId kEndpointCounts[] = { 1, 8, 32 };
+
+constexpr ClusterId kBenchmarkClusterId   = MockClusterId(1);
+constexpr AttributeId kListAttributeId    = MockAttributeId(4);
+constexpr CommandId kBenchmarkCommandId   = 1;
+constexpr size_t kScalarAttributeCount    = 3; // MockAttributeId(1) to MockAttributeId(3)
+constexpr size_t kMaxInvokeBatchSize      = 8;
+constexpr size_t kWriteListLength         = 8;
+constexpr size_t kWriteListItemSize       = 128;
+constexpr uint32_t kReadIterations        = 20;
+constexpr uint32_t kReportIterations      = 50;
+constexpr uint32_t kInvokeIterations      = 200;
+constexpr uint32_t kWriteIterations       = 20;
+constexpr uint16_t kSubscriptionCounts[]  = { 1, 4, 16 };
+constexpr size_t kDirtyAttributeCounts[]  = { 1, 8 };
+constexpr int kMaxDrainCountPerOperation  = 1000;
+constexpr uint16_t kMaxIntervalCeilingSec = 3600;
+
+/// Data model answering reads like TestImCustomDataModel and every invoke with a success status
+class BenchmarkDataModel : public TestImCustomDataModel
+{
+public:
+    static BenchmarkDataModel & Instance()
+    {
+        static BenchmarkDataModel model;
+        return model;
+    }
+
+    std::optional<DataModel::ActionReturnStatus> Invoke(const DataModel::InvokeRequest & request,
+                                                        TLV::TLVReader & input_arguments, CommandHandler * handler) override
+    {
+        return std::make_optional<DataModel::ActionReturnStatus>(Protocols::InteractionModel::Status::Success);
+    }
+};
+
+/// Every endpoint has a cluster with scalar attributes, a list attribute and a command
+MockNodeConfig MakeNodeConfig(EndpointId endpointCount)
+{
+    std::vector<MockEndpointConfig> endpoints;
+    endpoints.reserve(endpointCount);
+
+    for (EndpointId endpoint = 1; endpoint <= endpointCount; endpoint++)
+    {
+        endpoints.emplace_back(endpoint,
+                               std::initializer_list<MockClusterConfig>{
+                                   MockClusterConfig(kBenchmarkClusterId,
+                                                     {
+                                                         ClusterRevision::Id,
+                                                         FeatureMap::Id,
+                                                         MockAttributeId(1),
+                                                         MockAttributeId(2),
+                                                         MockAttributeId(3),
+                                                         MockAttributeConfig(kListAttributeId, ZCL_ARRAY_ATTRIBUTE_TYPE),
+                                                     },
+                                                     {}, { kBenchmarkCommandId }),
+                               });
+    }
+
+    return MockNodeConfig(std::move(endpoints));
+}
+
+class Stopwatch
+{
+public:
+    Stopwatch() : mStart(std::chrono::steady_clock::now()) {}
+
+    double ElapsedMicroseconds() const
+    {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - mStart).count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point mStart;
+};
+
+class CountingReadCallback : public ReadClient::Callback
+{
+public:
+    void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override
+    {
+        if (aStatus.IsSuccess())
+        {
+            mAttributeCount++;
+        }
+    }
+
+    void OnReportEnd() override { mReportCount++; }
+    void OnSubscriptionEstablished(SubscriptionId aSubscriptionId) override { mSubscriptionCount++; }
+    void OnError(CHIP_ERROR aError) override { mErrorCount++; }
+    void OnDone(ReadClient *) override { mDoneCount++; }
+
+    uint32_t mAttributeCount    = 0;
+    uint32_t mReportCount       = 0;
+    uint32_t mSubscriptionCount = 0;
+    uint32_t mErrorCount        = 0;
+    uint32_t mDoneCount         = 0;
+};
+
+class CountingCommandCallback : public CommandSender::ExtendableCallback
+{
+public:
+    void OnResponse(CommandSender * apCommandSender, const CommandSender::ResponseData & aResponseData) override
+    {
+        if (aResponseData.statusIB.IsSuccess())
+        {
+            mResponseCount++;
+        }
+    }
+
+    void OnError(const CommandSender * apCommandSender, const CommandSender::ErrorData & aErrorData) override { mErrorCount++; }
+    void OnDone(CommandSender * apCommandSender) override { mDoneCount++; }
+
+    uint32_t mResponseCount = 0;
+    uint32_t mErrorCount    = 0;
+    uint32_t mDoneCount     = 0;
+};
+
+class CountingWriteCallback : public WriteClient::Callback
+{
+public:
+    void OnResponse(const WriteClient * apWriteClient, const ConcreteDataAttributePath & aPath, StatusIB aStatus) override
+    {
+        if (aStatus.IsSuccess())
+        {
+            mSuccessCount++;
+        }
+        else
+        {
+            mErrorCount++;
+        }
+    }
+
+    void OnError(const WriteClient * apWriteClient, CHIP_ERROR aError) override { mErrorCount++; }
+    void OnDone(WriteClient * apWriteClient) override { mDoneCount++; }
+
+    uint32_t mSuccessCount = 0;
+    uint32_t mErrorCount   = 0;
+    uint32_t mDoneCount    = 0;
+};
+
+void PrintResult(const char * scenario, EndpointId endpointCount, const char * parameters, uint32_t operations,
+                 double elapsedUs, uint64_t items, const char * itemName)
+{
+    printf("BENCHMARK scenario=%s endpoints=%u %s operations=%" PRIu32 " us_per_op=%.1f %s_per_s=%.0f\n", scenario,
+           static_cast<unsigned>(endpointCount), parameters, operations, operations > 0 ? elapsedUs / operations : 0.0, itemName,
+           elapsedUs > 0 ? static_cast<double>(items) * 1e6 / elapsedUs : 0.0);
+}
+
+class InteractionModelBenchmark : public chip::Test::AppContext
+{
+public:
+    static void SetUpTestSuite()
+    {
+        AppContext::SetUpTestSuite();
+
+        // Logging of every attribute and message would dominate the measurements
+        chip::Logging::SetLogFilter(chip::Logging::kLogCategory_Error);
+    }
+
+    void SetUp() override
+    {
+        AppContext::SetUp();
+        mOldProvider = InteractionModelEngine::GetInstance()->SetDataModelProvider(&BenchmarkDataModel::Instance());
+    }
+
+    void TearDown() override
+    {
+        chip::Test::ResetMockNodeConfig();
+        InteractionModelEngine::GetInstance()->SetDataModelProvider(mOldProvider);
+        AppContext::TearDown();
+    }
+
+protected:
+    /// Services the loopback transport until the condition holds, returning false if it never did
+    template <typename Condition>
+    bool DrainUntil(Condition condition)
+    {
+        for (int i = 0; i < kMaxDrainCountPerOperation && !condition(); i++)
+        {
+            DrainAndServiceIO();
+        }
+        return condition();
+    }
+
+    DataModel::Provider * mOldProvider = nullptr;
+};
+
+TEST_F(InteractionModelBenchmark, WildcardRead)
+{
+    for (EndpointId endpointCount : kEndpointCounts)
+    {
+        MockNodeConfig config = MakeNodeConfig(endpointCount);
+        chip::Test::SetMockNodeConfig(config);
+
+        AttributePathParams wildcardPath;
+        CountingReadCallback callback;
+
+        Stopwatch stopwatch;
+        for (uint32_t i = 0; i < kReadIterations; i++)
+        {
+            ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+            readPrepareParams.mpAttributePathParamsList    = &wildcardPath;
+            readPrepareParams.mAttributePathParamsListSize = 1;
+
+            ReadClient readClient(InteractionModelEngine::GetInstance(), &GetExchangeManager(), callback,
+                                  ReadClient::InteractionType::Read);
+            ASSERT_EQ(readClient.SendRequest(readPrepareParams), CHIP_NO_ERROR);
+            ASSERT_TRUE(DrainUntil([&] { return callback.mDoneCount == i + 1; }));
+        }
+        const double elapsedUs = stopwatch.ElapsedMicroseconds();
+
+        EXPECT_EQ(callback.mErrorCount, 0u);
+        EXPECT_GT(callback.mAttributeCount, 0u);
+        PrintResult("wildcard_read", endpointCount, "", kReadIterations, elapsedUs, callback.mAttributeCount, "attributes");
+    }
+}
+
+TEST_F(InteractionModelBenchmark, SubscriptionReports)
+{
+    for (EndpointId endpointCount : kEndpointCounts)
+    {
+        MockNodeConfig config = MakeNodeConfig(endpointCount);
+        chip::Test::SetMockNodeConfig(config);
+
+        for (uint16_t subscriptionCount : kSubscriptionCounts)
+        {
+            // The scalar attributes of the benchmark cluster on every endpoint
+            AttributePathParams paths[kScalarAttributeCount];
+            for (size_t i = 0; i < kScalarAttributeCount; i++)
+            {
+                paths[i] = AttributePathParams(kBenchmarkClusterId, MockAttributeId(static_cast<uint16_t>(i + 1)));
+            }
+
+            CountingReadCallback callback;
+            std::vector<std::unique_ptr<ReadClient>> readClients;
+            for (uint16_t i = 0; i < subscriptionCount; i++)
+            {
+                ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+                readPrepareParams.mpAttributePathParamsList    = paths;
+                readPrepareParams.mAttributePathParamsListSize = kScalarAttributeCount;
+                readPrepareParams.mMinIntervalFloorSeconds     = 0;
+                readPrepareParams.mMaxIntervalCeilingSeconds   = kMaxIntervalCeilingSec;
+                readPrepareParams.mKeepSubscriptions           = true;
+
+                readClients.push_back(std::make_unique<ReadClient>(InteractionModelEngine::GetInstance(), &GetExchangeManager(),
+                                                                   callback, ReadClient::InteractionType::Subscribe));
+                ASSERT_EQ(readClients.back()->SendRequest(readPrepareParams), CHIP_NO_ERROR);
+            }
+            ASSERT_TRUE(DrainUntil([&] { return callback.mSubscriptionCount == subscriptionCount; }));
+
+            for (size_t dirtyCount : kDirtyAttributeCounts)
+            {
+                callback.mReportCount    = 0;
+                callback.mAttributeCount = 0;
+
+                Stopwatch stopwatch;
+                for (uint32_t i = 0; i < kReportIterations; i++)
+                {
+                    for (size_t j = 0; j < dirtyCount; j++)
+                    {
+                        AttributePathParams dirtyPath(
+                            static_cast<EndpointId>(1 + j % endpointCount), kBenchmarkClusterId,
+                            MockAttributeId(static_cast<uint16_t>(1 + (j / endpointCount) % kScalarAttributeCount)));
+                        ASSERT_EQ(InteractionModelEngine::GetInstance()->GetReportingEngine().SetDirty(dirtyPath), CHIP_NO_ERROR);
+                    }
+                    ASSERT_TRUE(DrainUntil([&] { return callback.mReportCount == (i + 1) * subscriptionCount; }));
+                }
+                const double elapsedUs = stopwatch.ElapsedMicroseconds();
+
+                char parameters[64];
+                snprintf(parameters, sizeof(parameters), "subscriptions=%u dirty=%u", static_cast<unsigned>(subscriptionCount),
+                         static_cast<unsigned>(dirtyCount));
+                PrintResult("subscription_reports", endpointCount, parameters, kReportIterations, elapsedUs,
+                            callback.mAttributeCount, "attributes");
+            }
+
+            EXPECT_EQ(callback.mErrorCount, 0u);
+            readClients.clear();
+            DrainAndServiceIO();
+        }
+    }
+}
+
+TEST_F(InteractionModelBenchmark, BatchedInvoke)
+{
+    // Batching needs support from both ends; otherwise every request carries a single command
+    size_t batchSize = std::min<size_t>(CHIP_CONFIG_MAX_PATHS_PER_INVOKE, kMaxInvokeBatchSize);
+
+    for (EndpointId endpointCount : kEndpointCounts)
+    {
+        MockNodeConfig config = MakeNodeConfig(endpointCount);
+        chip::Test::SetMockNodeConfig(config);
+
+        CountingCommandCallback callback;
+
+        Stopwatch stopwatch;
+        for (uint32_t i = 0; i < kInvokeIterations; i++)
+        {
+            CommandSender commandSender(&callback, &GetExchangeManager());
+            if (batchSize > 1)
+            {
+                CommandSender::ConfigParameters configParameters;
+                configParameters.SetRemoteMaxPathsPerInvoke(static_cast<uint16_t>(batchSize));
+                if (commandSender.SetCommandSenderConfig(configParameters) != CHIP_NO_ERROR)
+                {
+                    batchSize = 1;
+                }
+            }
+
+            for (size_t j = 0; j < batchSize; j++)
+            {
+                CommandPathParams commandPath(static_cast<EndpointId>(1 + (i * batchSize + j) % endpointCount), 0,
+                                              kBenchmarkClusterId, kBenchmarkCommandId, CommandPathFlags::kEndpointIdValid);
+
+                CommandSender::PrepareCommandParameters prepareParameters;
+                CommandSender::FinishCommandParameters finishParameters;
+                if (batchSize > 1)
+                {
+                    prepareParameters.SetCommandRef(static_cast<uint16_t>(j));
+                    finishParameters.SetCommandRef(static_cast<uint16_t>(j));
+                }
+                ASSERT_EQ(commandSender.PrepareCommand(commandPath, prepareParameters.SetStartDataStruct(true)), CHIP_NO_ERROR);
+                ASSERT_EQ(commandSender.FinishCommand(finishParameters.SetEndDataStruct(true)), CHIP_NO_ERROR);
+            }
+
+            ASSERT_EQ(commandSender.SendCommandRequest(GetSessionBobToAlice()), CHIP_NO_ERROR);
+            ASSERT_TRUE(DrainUntil([&] { return callback.mDoneCount == i + 1; }));
+        }
+        const double elapsedUs = stopwatch.ElapsedMicroseconds();
+
+        EXPECT_EQ(callback.mErrorCount, 0u);
+        EXPECT_EQ(callback.mResponseCount, kInvokeIterations * batchSize);
+
+        char parameters[32];
+        snprintf(parameters, sizeof(parameters), "batch=%u", static_cast<unsigned>(batchSize));
+        PrintResult("batched_invoke", endpointCount, parameters, kInvokeIterations, elapsedUs, callback.mResponseCount, "commands");
+    }
+}
+
+TEST_F(InteractionModelBenchmark, ChunkedWrite)
+{
+    uint8_t itemData[kWriteListItemSize];
+    memset(itemData, 0xA5, sizeof(itemData));
+
+    ByteSpan list[kWriteListLength];
+    for (auto & item : list)
+    {
+        item = ByteSpan(itemData);
+    }
+
+    for (EndpointId endpointCount : kEndpointCounts)
+    {
+        MockNodeConfig config = MakeNodeConfig(endpointCount);
+        chip::Test::SetMockNodeConfig(config);
+
+        CountingWriteCallback callback;
+
+        Stopwatch stopwatch;
+        for (uint32_t i = 0; i < kWriteIterations; i++)
+        {
+            // Writing the list attribute of every endpoint in a single request, which has to be chunked
+            WriteClient writeClient(&GetExchangeManager(), &callback, Optional<uint16_t>::Missing());
+            for (EndpointId endpoint = 1; endpoint <= endpointCount; endpoint++)
+            {
+                ASSERT_EQ(writeClient.EncodeAttribute(AttributePathParams(endpoint, kBenchmarkClusterId, kListAttributeId),
+                                                      DataModel::List<ByteSpan>(list, kWriteListLength)),
+                          CHIP_NO_ERROR);
+            }
+
+            ASSERT_EQ(writeClient.SendWriteRequest(GetSessionBobToAlice()), CHIP_NO_ERROR);
+            ASSERT_TRUE(DrainUntil([&] { return callback.mDoneCount == i + 1; }));
+        }
+        const double elapsedUs = stopwatch.ElapsedMicroseconds();
+
+        EXPECT_EQ(callback.mErrorCount, 0u);
+
+        char parameters[48];
+        snprintf(parameters, sizeof(parameters), "list_length=%u item_size=%u", static_cast<unsigned>(kWriteListLength),
+                 static_cast<unsigned>(kWriteListItemSize));
+        PrintResult("chunked_write", endpointCount, parameters, kWriteIterations, elapsedUs,
+                    static_cast<uint64_t>(kWriteIterations) * endpointCount * kWriteListLength * kWriteListItemSize, "bytes");
+    }
+}
+
+} // namespace
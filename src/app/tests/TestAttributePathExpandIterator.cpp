@@ -18,12 +18,14 @@
 
 #include <app-common/zap-generated/ids/Attributes.h>
 #include <app/AttributePathExpandIterator.h>
+#include <app/AttributePathExpansionCache.h>
 #include <app/ConcreteAttributePath.h>
 #include <app/EventManagement.h>
 #include <app/codegen-data-model-provider/Instance.h>
 #include <app/util/mock/Constants.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/TLVDebug.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
 #include <lib/support/LinkedList.h>
@@ -365,4 +367,149 @@ TEST(TestAttributePathExpandIterator, TestMultipleClusInfo)
     EXPECT_EQ(index, ArraySize(paths));
 }
 
+class TestAttributePathExpansionCache : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+/// Builds the path list used by the expansion cache tests: all attributes of (kMockEndpoint2, MockClusterId(3)), then
+/// ClusterRevision of every cluster on kMockEndpoint3, then a concrete path.
+class CacheTestPaths
+{
+public:
+    CacheTestPaths()
+    {
+        mWildcardAttribute.mValue.mEndpointId = kMockEndpoint2;
+        mWildcardAttribute.mValue.mClusterId  = MockClusterId(3);
+        mWildcardAttribute.mpNext             = &mWildcardCluster;
+
+        mWildcardCluster.mValue.mEndpointId  = kMockEndpoint3;
+        mWildcardCluster.mValue.mAttributeId = Clusters::Globals::Attributes::ClusterRevision::Id;
+        mWildcardCluster.mpNext              = &mConcrete;
+
+        mConcrete.mValue.mEndpointId  = kMockEndpoint2;
+        mConcrete.mValue.mClusterId   = MockClusterId(3);
+        mConcrete.mValue.mAttributeId = MockAttributeId(3);
+    }
+
+    SingleLinkedListNode<app::AttributePathParams> * Get() { return &mWildcardAttribute; }
+
+private:
+    SingleLinkedListNode<app::AttributePathParams> mWildcardAttribute;
+    SingleLinkedListNode<app::AttributePathParams> mWildcardCluster;
+    SingleLinkedListNode<app::AttributePathParams> mConcrete;
+};
+
+void ExpectSameRemainingPaths(app::AttributePathExpandIterator & expected, app::AttributePathExpandIterator & actual)
+{
+    app::ConcreteAttributePath expectedPath;
+    app::ConcreteAttributePath actualPath;
+    size_t count = 0;
+    while (expected.Get(expectedPath))
+    {
+        ASSERT_TRUE(actual.Get(actualPath));
+        EXPECT_EQ(expectedPath, actualPath);
+        EXPECT_EQ(expectedPath.mExpanded, actualPath.mExpanded);
+        expected.Next();
+        actual.Next();
+        count++;
+    }
+    EXPECT_FALSE(actual.Get(actualPath));
+    EXPECT_GT(count, 0u);
+}
+
+TEST_F(TestAttributePathExpansionCache, TestIteration)
+{
+    CacheTestPaths paths;
+    app::AttributePathExpansionCache cache;
+
+    EXPECT_FALSE(cache.IsBuiltFor(paths.Get()));
+    ASSERT_EQ(cache.Build(CodegenDataModelProviderInstance(), paths.Get(), 100), CHIP_NO_ERROR);
+    EXPECT_TRUE(cache.IsBuiltFor(paths.Get()));
+    EXPECT_TRUE(cache.IsComplete());
+    EXPECT_EQ(cache.Size(), 13u);
+
+    app::AttributePathExpandIterator live(CodegenDataModelProviderInstance(), paths.Get());
+    app::AttributePathExpandIterator cached(CodegenDataModelProviderInstance(), paths.Get(), &cache);
+    ExpectSameRemainingPaths(live, cached);
+
+    // A cache built for other paths is not used.
+    SingleLinkedListNode<app::AttributePathParams> otherPaths;
+    otherPaths.mValue.mEndpointId  = kMockEndpoint2;
+    otherPaths.mValue.mClusterId   = MockClusterId(3);
+    otherPaths.mValue.mAttributeId = MockAttributeId(1);
+    app::AttributePathExpandIterator other(CodegenDataModelProviderInstance(), &otherPaths, &cache);
+    app::ConcreteAttributePath path;
+    ASSERT_TRUE(other.Get(path));
+    EXPECT_EQ(path, P(kMockEndpoint2, MockClusterId(3), MockAttributeId(1)));
+    EXPECT_FALSE(other.Next());
+
+    cache.Invalidate();
+    EXPECT_FALSE(cache.IsBuiltFor(paths.Get()));
+    EXPECT_EQ(cache.Size(), 0u);
+}
+
+TEST_F(TestAttributePathExpansionCache, TestTooManyPaths)
+{
+    CacheTestPaths paths;
+    app::AttributePathExpansionCache cache;
+
+    EXPECT_EQ(cache.Build(CodegenDataModelProviderInstance(), paths.Get(), 12), CHIP_ERROR_NO_MEMORY);
+    EXPECT_TRUE(cache.IsBuiltFor(paths.Get()));
+    EXPECT_FALSE(cache.IsComplete());
+
+    // An incomplete cache is ignored.
+    app::AttributePathExpandIterator live(CodegenDataModelProviderInstance(), paths.Get());
+    app::AttributePathExpandIterator cached(CodegenDataModelProviderInstance(), paths.Get(), &cache);
+    ExpectSameRemainingPaths(live, cached);
+}
+
+TEST_F(TestAttributePathExpansionCache, TestResetCurrentCluster)
+{
+    CacheTestPaths paths;
+    app::AttributePathExpansionCache cache;
+    ASSERT_EQ(cache.Build(CodegenDataModelProviderInstance(), paths.Get(), 100), CHIP_NO_ERROR);
+
+    app::AttributePathExpandIterator live(CodegenDataModelProviderInstance(), paths.Get());
+    app::AttributePathExpandIterator cached(CodegenDataModelProviderInstance(), paths.Get(), &cache);
+    for (int i = 0; i < 3; i++)
+    {
+        live.Next();
+        cached.Next();
+    }
+
+    live.ResetCurrentCluster();
+    cached.ResetCurrentCluster();
+    app::ConcreteAttributePath path;
+    ASSERT_TRUE(cached.Get(path));
+    EXPECT_EQ(path, P(kMockEndpoint2, MockClusterId(3), Clusters::Globals::Attributes::ClusterRevision::Id));
+    ExpectSameRemainingPaths(live, cached);
+}
+
+TEST_F(TestAttributePathExpansionCache, TestDetach)
+{
+    CacheTestPaths paths;
+    app::AttributePathExpansionCache cache;
+    ASSERT_EQ(cache.Build(CodegenDataModelProviderInstance(), paths.Get(), 100), CHIP_NO_ERROR);
+
+    // Detaching resumes live expansion after the current path, both within a wildcard and across path params.
+    for (int steps : { 2, 9, 12 })
+    {
+        app::AttributePathExpandIterator live(CodegenDataModelProviderInstance(), paths.Get());
+        app::AttributePathExpandIterator cached(CodegenDataModelProviderInstance(), paths.Get(), &cache);
+        for (int i = 0; i < steps; i++)
+        {
+            live.Next();
+            cached.Next();
+        }
+
+        cached.DetachCache();
+        cache.Invalidate();
+        ExpectSameRemainingPaths(live, cached);
+        ASSERT_EQ(cache.Build(CodegenDataModelProviderInstance(), paths.Get(), 100), CHIP_NO_ERROR);
+    }
+}
+
 } // namespace
@@ -17,6 +17,7 @@
  */
 
 #include <optional>
+#include <vector>
 
 #include <lib/core/StringBuilderAdapters.h>
 #include <pw_unit_test/framework.h>
@@ -577,6 +578,78 @@ TEST(TestAttributeValueEncoder, TestEncodeListChunking2)
     }
 }
 
+TEST(TestAttributeValueEncoder, TestEncodeResumableListChunking)
+{
+    AttributeEncodeState state;
+    AttributeEncodeState resumableState;
+
+    bool list[]      = { true, false, false, true, true, false };
+    auto listEncoder = [&list](const auto & encoder) -> CHIP_ERROR {
+        for (auto & item : list)
+        {
+            ReturnErrorOnFailure(encoder.Encode(item));
+        }
+        return CHIP_NO_ERROR;
+    };
+
+    std::vector<uint32_t> startCursors;
+    size_t itemsProduced  = 0;
+    auto resumableEncoder = [&](const auto & encoder, uint32_t cursor) -> CHIP_ERROR {
+        startCursors.push_back(cursor);
+        for (uint32_t i = cursor; i < ArraySize(list); i++)
+        {
+            itemsProduced++;
+            ReturnErrorOnFailure(encoder.Encode(i + 1, list[i]));
+        }
+        return CHIP_NO_ERROR;
+    };
+
+    // Chunk the list as TestEncodeListChunking does: a resumable producer must encode exactly the same chunks.
+    {
+        LimitedTestSetup<30> test1(kTestFabricIndex);
+        LimitedTestSetup<30> resumableTest1(kTestFabricIndex);
+        CHIP_ERROR err = test1.encoder.EncodeList(listEncoder);
+        EXPECT_TRUE(err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL);
+        EXPECT_EQ(resumableTest1.encoder.EncodeResumableList(resumableEncoder), err);
+        state          = test1.encoder.GetState();
+        resumableState = resumableTest1.encoder.GetState();
+
+        EXPECT_EQ(resumableState.CurrentEncodingListIndex(), state.CurrentEncodingListIndex());
+        EXPECT_EQ(resumableState.ListResumeCursor(), 2u);
+        ASSERT_EQ(resumableTest1.writer.GetLengthWritten(), test1.writer.GetLengthWritten());
+        EXPECT_EQ(memcmp(resumableTest1.buf, test1.buf, test1.writer.GetLengthWritten()), 0);
+    }
+    {
+        LimitedTestSetup<30> test2(0, state);
+        LimitedTestSetup<30> resumableTest2(0, resumableState);
+        CHIP_ERROR err = test2.encoder.EncodeList(listEncoder);
+        EXPECT_TRUE(err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL);
+        EXPECT_EQ(resumableTest2.encoder.EncodeResumableList(resumableEncoder), err);
+        state          = test2.encoder.GetState();
+        resumableState = resumableTest2.encoder.GetState();
+
+        EXPECT_EQ(resumableState.CurrentEncodingListIndex(), state.CurrentEncodingListIndex());
+        EXPECT_EQ(resumableState.ListResumeCursor(), 3u);
+        ASSERT_EQ(resumableTest2.writer.GetLengthWritten(), test2.writer.GetLengthWritten());
+        EXPECT_EQ(memcmp(resumableTest2.buf, test2.buf, test2.writer.GetLengthWritten()), 0);
+    }
+    {
+        TestSetup test3(0, state);
+        TestSetup resumableTest3(0, resumableState);
+        EXPECT_EQ(test3.encoder.EncodeList(listEncoder), CHIP_NO_ERROR);
+        EXPECT_EQ(resumableTest3.encoder.EncodeResumableList(resumableEncoder), CHIP_NO_ERROR);
+        EXPECT_EQ(resumableTest3.encoder.GetState().ListResumeCursor(), 0u);
+
+        ASSERT_EQ(resumableTest3.writer.GetLengthWritten(), test3.writer.GetLengthWritten());
+        EXPECT_EQ(memcmp(resumableTest3.buf, test3.buf, test3.writer.GetLengthWritten()), 0);
+    }
+
+    // Every chunk resumed from the first item that was not encoded yet, so each item was produced at most twice: once in the
+    // chunk it did not fit in, and once in the next.
+    EXPECT_EQ(startCursors, (std::vector<uint32_t>{ 0, 2, 3 }));
+    EXPECT_EQ(itemsProduced, 8u);
+}
+
 TEST(TestAttributeValueEncoder, TestEncodePreEncoded)
 {
     TestSetup test{};
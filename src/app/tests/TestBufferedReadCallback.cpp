@@ -517,12 +517,16 @@ void DataSeriesGenerator::Generate()
 
 void RunAndValidateSequence(std::vector<ValidationInstruction> instructionList)
 {
-    DataSeriesValidator validator(instructionList);
-    BufferedReadCallback bufferedCallback(validator);
-    DataSeriesGenerator generator(bufferedCallback, instructionList);
-    generator.Generate();
+    // Both list buffering modes must deliver the same data.
+    for (auto mode : { BufferedReadCallback::ListBufferingMode::kPerItem, BufferedReadCallback::ListBufferingMode::kContiguous })
+    {
+        DataSeriesValidator validator(instructionList);
+        BufferedReadCallback bufferedCallback(validator, mode);
+        DataSeriesGenerator generator(bufferedCallback, instructionList);
+        generator.Generate();
 
-    EXPECT_EQ(validator.mCurrentInstruction, instructionList.size());
+        EXPECT_EQ(validator.mCurrentInstruction, instructionList.size());
+    }
 }
 
 TEST_F(TestBufferedReadCallback, TestBufferedSequences)
@@ -33,6 +33,7 @@
 #include <app/data-model/Decode.h>
 #include <app/tests/AppTestContext.h>
 #include <lib/support/ScopedBuffer.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
 
 #include <lib/core/StringBuilderAdapters.h>
 #include <pw_unit_test/framework.h>
@@ -771,4 +772,73 @@ TEST_F(TestClusterStateCache, TestCache)
                              AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData) });
 }
 
+TEST_F(TestClusterStateCache, TestSnapshot)
+{
+    AttributeInstructionListType list = { AttributeInstruction(AttributeInstruction::kAttributeA, 1, AttributeInstruction::kData),
+                                          AttributeInstruction(AttributeInstruction::kAttributeD, 2, AttributeInstruction::kData) };
+    ForwardedDataCallbackValidator dataCallbackValidator;
+    CacheValidator client(list, dataCallbackValidator);
+    ClusterStateCache cache(client);
+
+    // Claim a wildcard path, so that the cache tracks the data versions.
+    AttributePathParams wildcardPath;
+    const Span<AttributePathParams> pathSpan(&wildcardPath, 1);
+    {
+        uint8_t buf[20];
+        TLV::TLVWriter writer;
+        writer.Init(buf);
+        DataVersionFilterIBs::Builder builder;
+        EXPECT_EQ(builder.Init(&writer), CHIP_NO_ERROR);
+        bool encodedDataVersionList = false;
+        EXPECT_EQ(cache.GetBufferedCallback().OnUpdateDataVersionFilterList(builder, pathSpan, encodedDataVersionList),
+                  CHIP_NO_ERROR);
+    }
+
+    DataSeriesGenerator generator(&cache.GetBufferedCallback(), list);
+    generator.Generate(dataCallbackValidator);
+
+    chip::TestPersistentStorageDelegate storage;
+    const ScopedNodeId node(0x1234, 1);
+    EXPECT_EQ(cache.StoreSnapshot(storage, node), CHIP_NO_ERROR);
+
+    CacheValidator restoredClient(list, dataCallbackValidator);
+    ClusterStateCache restoredCache(restoredClient);
+    EXPECT_EQ(restoredCache.LoadSnapshot(storage, node), CHIP_NO_ERROR);
+
+    for (auto & instruction : list)
+    {
+        ConcreteAttributePath path = instruction.GetAttributePath();
+
+        Optional<DataVersion> version;
+        Optional<DataVersion> restoredVersion;
+        EXPECT_EQ(cache.GetVersion(path, version), CHIP_NO_ERROR);
+        EXPECT_EQ(restoredCache.GetVersion(path, restoredVersion), CHIP_NO_ERROR);
+        EXPECT_TRUE(restoredVersion.HasValue());
+        EXPECT_EQ(restoredVersion, version);
+
+        TLV::TLVReader reader;
+        TLV::TLVReader restoredReader;
+        EXPECT_EQ(cache.Get(path, reader), CHIP_NO_ERROR);
+        EXPECT_EQ(restoredCache.Get(path, restoredReader), CHIP_NO_ERROR);
+        ASSERT_EQ(restoredReader.GetRemainingLength(), reader.GetRemainingLength());
+        EXPECT_EQ(memcmp(restoredReader.GetReadPoint(), reader.GetReadPoint(), reader.GetRemainingLength()), 0);
+    }
+
+    // A subscription of the restored cache sends the DataVersionFilters of the restored clusters.
+    {
+        uint8_t buf[100];
+        TLV::TLVWriter writer;
+        writer.Init(buf);
+        DataVersionFilterIBs::Builder builder;
+        EXPECT_EQ(builder.Init(&writer), CHIP_NO_ERROR);
+        bool encodedDataVersionList = false;
+        EXPECT_EQ(restoredCache.GetBufferedCallback().OnUpdateDataVersionFilterList(builder, pathSpan, encodedDataVersionList),
+                  CHIP_NO_ERROR);
+        EXPECT_TRUE(encodedDataVersionList);
+    }
+
+    EXPECT_EQ(ClusterStateCache::DeleteSnapshot(storage, node), CHIP_NO_ERROR);
+    EXPECT_EQ(restoredCache.LoadSnapshot(storage, node), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+}
+
 } // namespace
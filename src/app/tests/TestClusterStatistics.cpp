@@ -0,0 +1,143 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/ClusterStatistics.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVWriter.h>
+#include <pw_unit_test/framework.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::System::Clock::Literals;
+
+TEST(TestClusterStatistics, TestDurationHistogram)
+{
+    DurationHistogram histogram;
+    EXPECT_EQ(histogram.GetPercentileUpperBoundUs(50), 0u);
+
+    for (int i = 0; i < 8; i++)
+    {
+        histogram.Record(3_us);
+    }
+    histogram.Record(100_us);
+    histogram.Record(System::Clock::Microseconds64(10'000'000));
+
+    EXPECT_EQ(histogram.GetTotalCount(), 10u);
+    EXPECT_EQ(histogram.GetCount(2), 8u);
+    EXPECT_EQ(histogram.GetCount(7), 1u);
+    EXPECT_EQ(histogram.GetCount(DurationHistogram::kNumBuckets - 1), 1u);
+
+    EXPECT_EQ(histogram.GetPercentileUpperBoundUs(50), 4u);
+    EXPECT_EQ(histogram.GetPercentileUpperBoundUs(90), 128u);
+    // Durations beyond the last bucket only report its lower bound.
+    EXPECT_EQ(histogram.GetPercentileUpperBoundUs(100),
+              DurationHistogram::GetBucketUpperBoundUs(DurationHistogram::kNumBuckets - 2));
+}
+
+TEST(TestClusterStatistics, TestPerClusterEntries)
+{
+    ClusterStatistics::Entry entries[2];
+    ClusterStatistics statistics(Span<ClusterStatistics::Entry>(entries), false);
+
+    {
+        ClusterStatistics::ScopedTimer timer(statistics, ClusterOperation::kReadAttribute, 6, 0);
+    }
+    statistics.RecordDuration(ClusterOperation::kReadAttribute, 6, 1, 10_us);
+    statistics.RecordDuration(ClusterOperation::kInvoke, 6, 2, 20_us);
+    statistics.RecordBytes(ClusterOperation::kInvoke, 6, 2, 12);
+    statistics.RecordBytes(ClusterOperation::kReport, 8, 0, 100);
+    statistics.RecordBytes(ClusterOperation::kReport, 8, 0, 40);
+    statistics.RecordChunk(8, 0);
+
+    // All the entries are in use: the third cluster is only counted as dropped.
+    statistics.RecordDuration(ClusterOperation::kWriteAttribute, 10, 0, 10_us);
+    EXPECT_EQ(statistics.GetNumDroppedRecords(), 1u);
+    EXPECT_EQ(statistics.Find(10), nullptr);
+
+    ASSERT_EQ(statistics.GetNumEntriesInUse(), 2u);
+    // Elements are folded into their cluster.
+    const ClusterStatistics::Entry * onOff = statistics.Find(6, 1);
+    ASSERT_NE(onOff, nullptr);
+    EXPECT_EQ(onOff, statistics.Find(6));
+    EXPECT_EQ(onOff->mElementId, ClusterStatistics::kAnyElement);
+    EXPECT_EQ(onOff->Get(ClusterOperation::kReadAttribute).mCount, 2u);
+    EXPECT_EQ(onOff->Get(ClusterOperation::kInvoke).mCount, 1u);
+    EXPECT_EQ(onOff->Get(ClusterOperation::kInvoke).mTotalBytes, 12u);
+    EXPECT_EQ(onOff->Get(ClusterOperation::kWriteAttribute).mCount, 0u);
+
+    const ClusterStatistics::Entry * levelControl = statistics.Find(8);
+    ASSERT_NE(levelControl, nullptr);
+    const ClusterOperationStats & report = levelControl->Get(ClusterOperation::kReport);
+    EXPECT_EQ(report.mCount, 0u);
+    EXPECT_EQ(report.mTotalBytes, 140u);
+    EXPECT_EQ(report.mMaxBytes, 100u);
+    EXPECT_EQ(report.mChunks, 1u);
+
+    statistics.Reset();
+    EXPECT_EQ(statistics.GetNumEntriesInUse(), 0u);
+    EXPECT_EQ(statistics.GetNumDroppedRecords(), 0u);
+    statistics.RecordDuration(ClusterOperation::kWriteAttribute, 10, 0, 10_us);
+    ASSERT_NE(statistics.Find(10), nullptr);
+    EXPECT_EQ(statistics.Find(10)->Get(ClusterOperation::kWriteAttribute).mCount, 1u);
+    EXPECT_EQ(statistics.Find(10)->Get(ClusterOperation::kReadAttribute).mCount, 0u);
+}
+
+TEST(TestClusterStatistics, TestPerElementEntries)
+{
+    ClusterStatistics::Entry entries[4];
+    ClusterStatistics statistics(Span<ClusterStatistics::Entry>(entries), true);
+
+    statistics.RecordDuration(ClusterOperation::kReadAttribute, 6, 0, 10_us);
+    statistics.RecordDuration(ClusterOperation::kReadAttribute, 6, 1, 10_us);
+    statistics.RecordDuration(ClusterOperation::kReadAttribute, 6, 1, 10_us);
+
+    EXPECT_EQ(statistics.GetNumEntriesInUse(), 2u);
+    EXPECT_EQ(statistics.Find(6), nullptr);
+    ASSERT_NE(statistics.Find(6, 1), nullptr);
+    EXPECT_EQ(statistics.Find(6, 1)->Get(ClusterOperation::kReadAttribute).mCount, 2u);
+}
+
+TEST(TestClusterStatistics, TestElementLength)
+{
+    uint8_t buffer[64];
+    TLV::TLVWriter writer;
+    writer.Init(buffer);
+    TLV::TLVType outer;
+    ASSERT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.PutString(TLV::ContextTag(0), "hello"), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Put(TLV::ContextTag(1), static_cast<uint8_t>(1)), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.EndContainer(outer), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+    TLV::TLVReader reader;
+    reader.Init(buffer, writer.GetLengthWritten());
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+    // Everything but the control byte of the structure itself, and the reader is left where it was.
+    EXPECT_EQ(ClusterStatistics::GetElementLength(reader), writer.GetLengthWritten() - 1);
+    EXPECT_EQ(reader.GetType(), TLV::kTLVType_Structure);
+
+    ASSERT_EQ(reader.EnterContainer(outer), CHIP_NO_ERROR);
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(ClusterStatistics::GetElementLength(reader), 5u);
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(ClusterStatistics::GetElementLength(reader), 0u);
+}
+
+} // namespace
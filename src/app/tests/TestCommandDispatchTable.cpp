@@ -0,0 +1,86 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/util/CommandDispatchTable.h>
+
+#include <pw_unit_test/framework.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+
+CHIP_ERROR DispatchFirst(CommandHandler *, const ConcreteCommandPath &, TLV::TLVReader &, bool & wasHandled)
+{
+    wasHandled = true;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DispatchSecond(CommandHandler *, const ConcreteCommandPath &, TLV::TLVReader &, bool & wasHandled)
+{
+    wasHandled = false;
+    return CHIP_NO_ERROR;
+}
+
+constexpr auto kFirstCommands = SortedById<CommandDispatchEntry>({
+    { 0x40, DispatchSecond },
+    { 0x00, DispatchFirst },
+    { 0x02, DispatchSecond },
+});
+
+constexpr auto kSecondCommands = SortedById<CommandDispatchEntry>({
+    { 0x01, DispatchFirst },
+});
+
+constexpr auto kClusters = SortedById<ClusterDispatchEntry>({
+    { 0x0300, Span<const CommandDispatchEntry>(kSecondCommands) },
+    { 0x0006, Span<const CommandDispatchEntry>(kFirstCommands) },
+    { 0xFFF1FC01, Span<const CommandDispatchEntry>(kSecondCommands) },
+});
+
+static_assert(kFirstCommands[0].id == 0x00 && kFirstCommands[1].id == 0x02 && kFirstCommands[2].id == 0x40,
+              "Tables are sorted at compile time");
+static_assert(kClusters[0].id == 0x0006 && kClusters[1].id == 0x0300 && kClusters[2].id == 0xFFF1FC01,
+              "Tables are sorted at compile time");
+
+TEST(TestCommandDispatchTable, TestFindById)
+{
+    const ClusterDispatchEntry * cluster = FindById(Span<const ClusterDispatchEntry>(kClusters), ClusterId(0x0006));
+    ASSERT_NE(cluster, nullptr);
+    EXPECT_EQ(cluster->commands.size(), 3u);
+
+    const CommandDispatchEntry * command = FindById(cluster->commands, CommandId(0x00));
+    ASSERT_NE(command, nullptr);
+    EXPECT_EQ(command->dispatch, &DispatchFirst);
+
+    command = FindById(cluster->commands, CommandId(0x40));
+    ASSERT_NE(command, nullptr);
+    EXPECT_EQ(command->dispatch, &DispatchSecond);
+
+    EXPECT_EQ(FindById(cluster->commands, CommandId(0x01)), nullptr);
+    EXPECT_EQ(FindById(cluster->commands, CommandId(0x41)), nullptr);
+
+    cluster = FindById(Span<const ClusterDispatchEntry>(kClusters), ClusterId(0xFFF1FC01));
+    ASSERT_NE(cluster, nullptr);
+    EXPECT_EQ(cluster->commands.data(), kSecondCommands.data());
+
+    EXPECT_EQ(FindById(Span<const ClusterDispatchEntry>(kClusters), ClusterId(0x0005)), nullptr);
+    EXPECT_EQ(FindById(Span<const ClusterDispatchEntry>(kClusters), ClusterId(0xFFFFFFFF)), nullptr);
+}
+
+} // namespace
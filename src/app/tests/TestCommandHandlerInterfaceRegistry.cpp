@@ -22,6 +22,7 @@
 #include <app/CommandHandlerInterfaceRegistry.h>
 
 #include <type_traits>
+#include <vector>
 
 namespace chip {
 namespace app {
@@ -99,5 +100,54 @@ TEST(TestCommandHandlerInterfaceRegistry, TestUnregisterAll)
     EXPECT_EQ(registry.GetCommandHandler(5, 3), &d);
 }
 
+TEST(TestCommandHandlerInterfaceRegistry, TestManyEndpointsAndConflicts)
+{
+    constexpr EndpointId kEndpointCount = 100;
+    std::vector<TestCommandHandlerInterface> handlers;
+    handlers.reserve(kEndpointCount);
+    for (EndpointId endpoint = 0; endpoint < kEndpointCount; endpoint++)
+    {
+        handlers.emplace_back(Optional<EndpointId>(endpoint), 1);
+    }
+    TestCommandHandlerInterface allEndpoints(NullOptional, 1);
+    TestCommandHandlerInterface duplicate(Optional<EndpointId>(50), 1);
+    TestCommandHandlerInterface otherAllEndpoints(NullOptional, 2);
+    TestCommandHandlerInterface otherEndpoint(Optional<EndpointId>(7), 2);
+
+    CommandHandlerInterfaceRegistry registry;
+    for (auto & handler : handlers)
+    {
+        EXPECT_EQ(registry.RegisterCommandHandler(&handler), CHIP_NO_ERROR);
+    }
+
+    // Registrations for all endpoints conflict with those of any endpoint, and the other way around.
+    EXPECT_EQ(registry.RegisterCommandHandler(&allEndpoints), CHIP_ERROR_INCORRECT_STATE);
+    EXPECT_EQ(registry.RegisterCommandHandler(&duplicate), CHIP_ERROR_INCORRECT_STATE);
+    EXPECT_EQ(registry.RegisterCommandHandler(&otherAllEndpoints), CHIP_NO_ERROR);
+    EXPECT_EQ(registry.RegisterCommandHandler(&otherEndpoint), CHIP_ERROR_INCORRECT_STATE);
+
+    for (EndpointId endpoint = 0; endpoint < kEndpointCount; endpoint++)
+    {
+        EXPECT_EQ(registry.GetCommandHandler(endpoint, 1), &handlers[endpoint]);
+        EXPECT_EQ(registry.GetCommandHandler(endpoint, 2), &otherAllEndpoints);
+    }
+    EXPECT_EQ(registry.GetCommandHandler(kEndpointCount, 1), nullptr);
+
+    // Unregistering a conflicting handler unregisters the registered one.
+    EXPECT_EQ(registry.UnregisterCommandHandler(&duplicate), CHIP_NO_ERROR);
+    EXPECT_EQ(registry.GetCommandHandler(50, 1), nullptr);
+
+    registry.UnregisterAllCommandHandlersForEndpoint(51);
+    EXPECT_EQ(registry.GetCommandHandler(51, 1), nullptr);
+    EXPECT_EQ(registry.GetCommandHandler(51, 2), &otherAllEndpoints);
+    EXPECT_EQ(registry.GetCommandHandler(52, 1), &handlers[52]);
+
+    registry.UnregisterAllHandlers();
+    EXPECT_EQ(registry.GetCommandHandler(52, 1), nullptr);
+    EXPECT_EQ(registry.GetCommandHandler(52, 2), nullptr);
+    EXPECT_EQ(registry.RegisterCommandHandler(&allEndpoints), CHIP_NO_ERROR);
+    EXPECT_EQ(registry.GetCommandHandler(52, 1), &allEndpoints);
+}
+
 } // namespace app
 } // namespace chip
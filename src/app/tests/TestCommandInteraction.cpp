@@ -355,12 +355,14 @@ public:
     Optional<GroupId> GetGroupId() const override { return NullOptional; }
 
     void AddInvokeResponseToSend(System::PacketBufferHandle && aPacket) override { mChunks.AddToEnd(std::move(aPacket)); }
+    void InvokeResponsesReadyToSend() override { mResponsesReadyToSendCount++; }
     void ResponseDropped() override { mResponseDropped = true; }
 
     size_t GetCommandResponseMaxBufferSize() override { return kMaxSecureSduLengthBytes; }
 
     System::PacketBufferHandle mChunks;
-    bool mResponseDropped = false;
+    bool mResponseDropped          = false;
+    int mResponsesReadyToSendCount = 0;
 };
 
 class MockCommandHandlerCallback : public CommandHandlerImpl::Callback
@@ -1370,6 +1372,34 @@ TEST_F(TestCommandInteraction, TestCommandHandler_WithOnInvokeReceivedEmptyDataM
     }
 }
 
+TEST_F(TestCommandInteraction, TestCommandHandler_ResponsesReadyToSendWhileAsyncWorkPending)
+{
+    mockCommandHandlerDelegate.ResetCounter();
+    CommandHandlerImpl commandHandler(&mockCommandHandlerDelegate);
+    System::PacketBufferHandle commandDatabuf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    GenerateInvokeRequest(commandDatabuf, /* aIsTimedRequest = */ false, kTestCommandIdNoData);
+
+    MockCommandResponder mockCommandResponder;
+    sendResponse = false;
+    asyncCommand = true;
+    Protocols::InteractionModel::Status status =
+        commandHandler.OnInvokeCommandRequest(mockCommandResponder, std::move(commandDatabuf), false);
+    EXPECT_EQ(status, Protocols::InteractionModel::Status::Success);
+
+    // The initial processing is over while the command is still pending: the responder may send what is queued.
+    EXPECT_EQ(mockCommandResponder.mResponsesReadyToSendCount, 1);
+    EXPECT_EQ(mockCommandHandlerDelegate.onFinalCalledTimes, 0);
+
+    // Completing the last pending work finishes the CommandHandler instead.
+    asyncCommandHandle.Get()->AddStatus(ConcreteCommandPath(kTestEndpointId, kTestClusterId, kTestCommandIdNoData),
+                                        Protocols::InteractionModel::Status::Success);
+    asyncCommandHandle = nullptr;
+    EXPECT_EQ(mockCommandResponder.mResponsesReadyToSendCount, 1);
+    EXPECT_EQ(mockCommandHandlerDelegate.onFinalCalledTimes, 1);
+    EXPECT_FALSE(mockCommandResponder.mChunks.IsNull());
+    sendResponse = true;
+}
+
 TEST_F(TestCommandInteraction, TestCommandSenderLegacyCallbackUnsupportedCommand)
 {
 
@@ -0,0 +1,223 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app/CompactClusterStateCache.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/CHIPMem.h>
+#include <protocols/interaction_model/Constants.h>
+#include <pw_unit_test/framework.h>
+
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters::UnitTesting;
+
+class TestCompactClusterStateCache : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+class CacheCallback : public CompactClusterStateCache::Callback
+{
+public:
+    void OnAttributeChanged(CompactClusterStateCache * cache, const ConcreteAttributePath & path) override
+    {
+        mChangedAttributes.push_back(path);
+    }
+    void OnClusterChanged(CompactClusterStateCache * cache, EndpointId endpointId, ClusterId clusterId) override
+    {
+        mChangedClusterCount++;
+    }
+    void OnEndpointAdded(CompactClusterStateCache * cache, EndpointId endpointId) override
+    {
+        mAddedEndpoints.push_back(endpointId);
+    }
+    void OnReportEnd() override { mReportEndCount++; }
+    void OnDone(ReadClient *) override {}
+
+    std::vector<ConcreteAttributePath> mChangedAttributes;
+    std::vector<EndpointId> mAddedEndpoints;
+    int mChangedClusterCount = 0;
+    int mReportEndCount      = 0;
+};
+
+// Feeds the attribute reports of a single ReportData into a cache.
+class ReportGenerator
+{
+public:
+    ReportGenerator(CompactClusterStateCache & cache) : mCallback(cache.GetBufferedCallback()) { mCallback.OnReportBegin(); }
+    ~ReportGenerator() { mCallback.OnReportEnd(); }
+
+    template <typename T>
+    void Data(EndpointId endpoint, AttributeId attribute, const T & value)
+    {
+        uint8_t buffer[128];
+        TLV::TLVWriter writer;
+        writer.Init(buffer);
+        ASSERT_EQ(DataModel::Encode(writer, TLV::AnonymousTag(), value), CHIP_NO_ERROR);
+        ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+        TLV::TLVReader reader;
+        reader.Init(buffer, writer.GetLengthWritten());
+        ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+        ConcreteDataAttributePath path(endpoint, Id, attribute);
+        path.mDataVersion.SetValue(1);
+        mCallback.OnAttributeData(path, &reader, StatusIB());
+    }
+
+    void Status(EndpointId endpoint, AttributeId attribute)
+    {
+        ConcreteDataAttributePath path(endpoint, Id, attribute);
+        mCallback.OnAttributeData(path, nullptr, StatusIB(Protocols::InteractionModel::Status::UnsupportedAccess));
+    }
+
+private:
+    ReadClient::Callback & mCallback;
+};
+
+TEST_F(TestCompactClusterStateCache, TestGetAndIterate)
+{
+    ClusterStateArena arena;
+    CacheCallback callback;
+    CompactClusterStateCache cache(callback, arena);
+
+    const uint8_t hello[] = { 'h', 'e', 'l', 'l', 'o' };
+    {
+        // Out of order, so that entries get inserted in the middle of the vectors.
+        ReportGenerator report(cache);
+        report.Data(2, Attributes::Int16u::Id, static_cast<uint16_t>(20));
+        report.Data(1, Attributes::OctetString::Id, ByteSpan(hello));
+        report.Data(1, Attributes::Int16u::Id, static_cast<uint16_t>(10));
+        report.Status(1, Attributes::Int8u::Id);
+    }
+
+    EXPECT_EQ(callback.mReportEndCount, 1);
+    EXPECT_EQ(callback.mChangedAttributes.size(), 4u);
+    EXPECT_EQ(callback.mChangedClusterCount, 2);
+    EXPECT_EQ(callback.mAddedEndpoints, (std::vector<EndpointId>{ 2, 1 }));
+    EXPECT_EQ(cache.GetNumAttributes(), 4u);
+
+    Attributes::Int16u::TypeInfo::DecodableType intValue;
+    EXPECT_EQ(cache.Get<Attributes::Int16u::TypeInfo>(1, intValue), CHIP_NO_ERROR);
+    EXPECT_EQ(intValue, 10);
+    EXPECT_EQ(cache.Get<Attributes::Int16u::TypeInfo>(2, intValue), CHIP_NO_ERROR);
+    EXPECT_EQ(intValue, 20);
+    EXPECT_EQ(cache.Get<Attributes::Int16u::TypeInfo>(3, intValue), CHIP_ERROR_KEY_NOT_FOUND);
+
+    Attributes::OctetString::TypeInfo::DecodableType octetValue;
+    EXPECT_EQ(cache.Get<Attributes::OctetString::TypeInfo>(1, octetValue), CHIP_NO_ERROR);
+    EXPECT_TRUE(octetValue.data_equal(ByteSpan(hello)));
+
+    Attributes::Int8u::TypeInfo::DecodableType statusValue;
+    StatusIB status;
+    EXPECT_EQ(cache.Get<Attributes::Int8u::TypeInfo>(1, statusValue), CHIP_ERROR_IM_STATUS_CODE_RECEIVED);
+    EXPECT_EQ(cache.GetStatus(ConcreteAttributePath(1, Id, Attributes::Int8u::Id), status), CHIP_NO_ERROR);
+    EXPECT_EQ(status.mStatus, Protocols::InteractionModel::Status::UnsupportedAccess);
+    EXPECT_EQ(cache.GetStatus(ConcreteAttributePath(1, Id, Attributes::Int16u::Id), status), CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::vector<AttributeId> attributes;
+    EXPECT_EQ(cache.ForEachAttribute(1, Id,
+                                     [&attributes](const ConcreteAttributePath & path) {
+                                         attributes.push_back(path.mAttributeId);
+                                         return CHIP_NO_ERROR;
+                                     }),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(attributes, (std::vector<AttributeId>{ Attributes::Int8u::Id, Attributes::Int16u::Id, Attributes::OctetString::Id }));
+    EXPECT_EQ(cache.ForEachAttribute(3, Id, [](const ConcreteAttributePath &) { return CHIP_NO_ERROR; }),
+              CHIP_ERROR_KEY_NOT_FOUND);
+
+    size_t clusterCount = 0;
+    EXPECT_EQ(cache.ForEachCluster(2,
+                                   [&clusterCount](ClusterId clusterId) {
+                                       EXPECT_EQ(clusterId, Id);
+                                       clusterCount++;
+                                       return CHIP_NO_ERROR;
+                                   }),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(clusterCount, 1u);
+
+    cache.ClearAttribute(ConcreteAttributePath(1, Id, Attributes::Int16u::Id));
+    EXPECT_EQ(cache.Get<Attributes::Int16u::TypeInfo>(1, intValue), CHIP_ERROR_KEY_NOT_FOUND);
+    cache.ClearAttributes(1);
+    EXPECT_EQ(cache.Get<Attributes::OctetString::TypeInfo>(1, octetValue), CHIP_ERROR_KEY_NOT_FOUND);
+    Optional<DataVersion> version;
+    EXPECT_EQ(cache.GetVersion(ConcreteClusterPath(1, Id), version), CHIP_ERROR_KEY_NOT_FOUND);
+    EXPECT_EQ(cache.GetVersion(ConcreteClusterPath(2, Id), version), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.GetNumAttributes(), 1u);
+}
+
+TEST_F(TestCompactClusterStateCache, TestValuesShareArena)
+{
+    ClusterStateArena arena(64);
+    CacheCallback callback;
+    CompactClusterStateCache cache(callback, arena);
+
+    uint8_t bytes[40] = {};
+    for (uint8_t i = 0; i < 20; i++)
+    {
+        bytes[0] = i;
+        ReportGenerator report(cache);
+        report.Data(1, Attributes::OctetString::Id, ByteSpan(bytes));
+        report.Data(1, Attributes::Int16u::Id, static_cast<uint16_t>(i));
+    }
+
+    // The replaced values got reclaimed along the way.
+    EXPECT_LT(cache.GetValueBytesInUse(), 3 * arena.GetBlockSize());
+
+    Attributes::OctetString::TypeInfo::DecodableType octetValue;
+    EXPECT_EQ(cache.Get<Attributes::OctetString::TypeInfo>(1, octetValue), CHIP_NO_ERROR);
+    EXPECT_TRUE(octetValue.data_equal(ByteSpan(bytes)));
+    Attributes::Int16u::TypeInfo::DecodableType intValue;
+    EXPECT_EQ(cache.Get<Attributes::Int16u::TypeInfo>(1, intValue), CHIP_NO_ERROR);
+    EXPECT_EQ(intValue, 19);
+
+    // A value larger than the blocks gets one of its own.
+    uint8_t largeBytes[100] = {};
+    {
+        ReportGenerator report(cache);
+        report.Data(2, Attributes::OctetString::Id, ByteSpan(largeBytes));
+    }
+    EXPECT_EQ(cache.Get<Attributes::OctetString::TypeInfo>(2, octetValue), CHIP_NO_ERROR);
+    EXPECT_TRUE(octetValue.data_equal(ByteSpan(largeBytes)));
+
+    // Clearing the node gives its regular blocks back to the arena, for the caches of other nodes.
+    const size_t freeBlocksBeforeClear = arena.GetNumFreeBlocks();
+    cache.Clear();
+    EXPECT_EQ(cache.GetNumAttributes(), 0u);
+    EXPECT_EQ(cache.GetValueBytesInUse(), 0u);
+    const size_t freeBlocks = arena.GetNumFreeBlocks();
+    EXPECT_GT(freeBlocks, freeBlocksBeforeClear);
+
+    CacheCallback otherCallback;
+    CompactClusterStateCache otherCache(otherCallback, arena);
+    {
+        ReportGenerator report(otherCache);
+        report.Data(1, Attributes::Int16u::Id, static_cast<uint16_t>(1));
+    }
+    EXPECT_EQ(arena.GetNumFreeBlocks(), freeBlocks - 1);
+}
+
+} // namespace
@@ -617,6 +617,98 @@ TEST_F(TestDataModelSerialization, ExtraField)
     }
 }
 
+TEST_F(TestDataModelSerialization, OutOfOrderFields)
+{
+    using Fields = Clusters::UnitTesting::Structs::SimpleStruct::Fields;
+
+    char strbuf[10]      = "chip";
+    char otherStrbuf[10] = "matter";
+    uint8_t unknown      = 42;
+
+    Clusters::UnitTesting::Structs::SimpleStruct::Type t;
+    t.a = 20;
+    t.b = true;
+    t.c = Clusters::UnitTesting::SimpleEnum::kValueA;
+    t.e = Span<char>{ strbuf, strlen(strbuf) };
+
+    SetupBuf();
+    //
+    // Case #1: Fields out of canonical order, with an unknown field in between.
+    //
+    {
+        EXPECT_EQ(EncodeStruct(mWriter, TLV::AnonymousTag(), MakeTagValuePair(TLV::ContextTag(Fields::kE), t.e),
+                               MakeTagValuePair(TLV::ContextTag(Fields::kC), t.c),
+                               MakeTagValuePair(TLV::ContextTag(200), unknown),
+                               MakeTagValuePair(TLV::ContextTag(Fields::kA), t.a),
+                               MakeTagValuePair(TLV::ContextTag(Fields::kB), t.b)),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(mWriter.Finalize(), CHIP_NO_ERROR);
+        DumpBuf();
+
+        Clusters::UnitTesting::Structs::SimpleStruct::DecodableType decoded;
+        SetupReader();
+        EXPECT_EQ(DataModel::Decode(mReader, decoded), CHIP_NO_ERROR);
+
+        EXPECT_EQ(decoded.a, 20);
+        EXPECT_TRUE(decoded.b);
+        EXPECT_EQ(decoded.c, Clusters::UnitTesting::SimpleEnum::kValueA);
+        EXPECT_TRUE(StringMatches(decoded.e, "chip"));
+    }
+
+    SetupBuf();
+    //
+    // Case #2: Fields in canonical order, one of them missing, with unknown fields first and last.
+    //
+    {
+        EXPECT_EQ(EncodeStruct(mWriter, TLV::AnonymousTag(), MakeTagValuePair(TLV::ContextTag(200), unknown),
+                               MakeTagValuePair(TLV::ContextTag(Fields::kA), t.a),
+                               MakeTagValuePair(TLV::ContextTag(Fields::kB), t.b),
+                               MakeTagValuePair(TLV::ContextTag(Fields::kC), t.c),
+                               MakeTagValuePair(TLV::ContextTag(Fields::kE), t.e),
+                               MakeTagValuePair(TLV::ContextTag(201), unknown)),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(mWriter.Finalize(), CHIP_NO_ERROR);
+        DumpBuf();
+
+        Clusters::UnitTesting::Structs::SimpleStruct::DecodableType decoded;
+        SetupReader();
+        EXPECT_EQ(DataModel::Decode(mReader, decoded), CHIP_NO_ERROR);
+
+        EXPECT_EQ(decoded.a, 20);
+        EXPECT_TRUE(decoded.b);
+        EXPECT_EQ(decoded.c, Clusters::UnitTesting::SimpleEnum::kValueA);
+        EXPECT_TRUE(StringMatches(decoded.e, "chip"));
+    }
+
+    SetupBuf();
+    //
+    // Case #3: Duplicated fields, both right after each other and further apart: the last value wins.
+    //
+    {
+        uint8_t otherA = 30;
+        Span<char> otherE{ otherStrbuf, strlen(otherStrbuf) };
+
+        EXPECT_EQ(EncodeStruct(mWriter, TLV::AnonymousTag(), MakeTagValuePair(TLV::ContextTag(Fields::kA), t.a),
+                               MakeTagValuePair(TLV::ContextTag(Fields::kB), t.b),
+                               MakeTagValuePair(TLV::ContextTag(Fields::kA), otherA),
+                               MakeTagValuePair(TLV::ContextTag(Fields::kC), t.c),
+                               MakeTagValuePair(TLV::ContextTag(Fields::kE), t.e),
+                               MakeTagValuePair(TLV::ContextTag(Fields::kE), otherE)),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(mWriter.Finalize(), CHIP_NO_ERROR);
+        DumpBuf();
+
+        Clusters::UnitTesting::Structs::SimpleStruct::DecodableType decoded;
+        SetupReader();
+        EXPECT_EQ(DataModel::Decode(mReader, decoded), CHIP_NO_ERROR);
+
+        EXPECT_EQ(decoded.a, 30);
+        EXPECT_TRUE(decoded.b);
+        EXPECT_EQ(decoded.c, Clusters::UnitTesting::SimpleEnum::kValueA);
+        EXPECT_TRUE(StringMatches(decoded.e, "matter"));
+    }
+}
+
 TEST_F(TestDataModelSerialization, InvalidSimpleFieldTypes)
 {
     SetupBuf();
@@ -395,3 +395,150 @@ TEST_F(TestDefaultICDClientStorage, TestProcessCheckInPayloadWithEmptyIcdStorage
     ByteSpan payload1{ buffer->Start(), buffer->DataLength() };
     EXPECT_EQ(manager.ProcessCheckInPayload(payload1, decodeClientInfo, checkInCounter), CHIP_ERROR_NOT_FOUND);
 }
+
+TEST_F(TestDefaultICDClientStorage, TestProcessCheckInPayloadWithCheckInIndex)
+{
+    FabricIndex fabricId = 1;
+    TestPersistentStorageDelegate clientInfoStorage;
+    TestSessionKeystoreImpl keystore;
+
+    DefaultICDClientStorage manager;
+    EXPECT_EQ(manager.Init(&clientInfoStorage, &keystore), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.UpdateFabricList(fabricId), CHIP_NO_ERROR);
+
+    ICDClientInfo clientInfo1;
+    clientInfo1.peer_node = ScopedNodeId(6666, fabricId);
+    EXPECT_EQ(manager.SetKey(clientInfo1, ByteSpan(kKeyBuffer1)), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.StoreEntry(clientInfo1), CHIP_NO_ERROR);
+
+    ICDClientInfo clientInfo2;
+    clientInfo2.peer_node = ScopedNodeId(7777, fabricId);
+    EXPECT_EQ(manager.SetKey(clientInfo2, ByteSpan(kKeyBuffer2)), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.StoreEntry(clientInfo2), CHIP_NO_ERROR);
+
+    // The index is only built with the first check-in message
+    EXPECT_EQ(manager.GetCheckInIndexSize(), 0u);
+
+    System::PacketBufferHandle buffer = MessagePacketBuffer::New(chip::Protocols::SecureChannel::CheckinMessage::kMinPayloadSize);
+    MutableByteSpan output{ buffer->Start(), buffer->MaxDataLength() };
+    ICDClientInfo decodeClientInfo;
+    uint32_t checkInCounter = 0;
+
+    // Counter within the indexed window
+    uint32_t counter = 1;
+    EXPECT_EQ(chip::Protocols::SecureChannel::CheckinMessage::GenerateCheckinMessagePayload(
+                  clientInfo2.aes_key_handle, clientInfo2.hmac_key_handle, counter, ByteSpan(), output),
+              CHIP_NO_ERROR);
+    buffer->SetDataLength(static_cast<uint16_t>(output.size()));
+    ByteSpan payload{ buffer->Start(), buffer->DataLength() };
+    EXPECT_EQ(manager.ProcessCheckInPayload(payload, decodeClientInfo, checkInCounter), CHIP_NO_ERROR);
+    EXPECT_EQ(checkInCounter, counter);
+    EXPECT_EQ(decodeClientInfo.peer_node, clientInfo2.peer_node);
+    EXPECT_EQ(manager.GetCheckInIndexSize(), 2 * static_cast<size_t>(CHIP_CONFIG_ICD_CLIENT_CHECK_IN_INDEX_WINDOW));
+
+    // Counter past the indexed window, matched by trying every key
+    counter = 1000;
+    output  = MutableByteSpan{ buffer->Start(), buffer->MaxDataLength() };
+    EXPECT_EQ(chip::Protocols::SecureChannel::CheckinMessage::GenerateCheckinMessagePayload(
+                  clientInfo1.aes_key_handle, clientInfo1.hmac_key_handle, counter, ByteSpan(), output),
+              CHIP_NO_ERROR);
+    buffer->SetDataLength(static_cast<uint16_t>(output.size()));
+    ByteSpan payload1{ buffer->Start(), buffer->DataLength() };
+    EXPECT_EQ(manager.ProcessCheckInPayload(payload1, decodeClientInfo, checkInCounter), CHIP_NO_ERROR);
+    EXPECT_EQ(checkInCounter, counter);
+    EXPECT_EQ(decodeClientInfo.peer_node, clientInfo1.peer_node);
+
+    // Storing the new offset moves the indexed window of the client
+    decodeClientInfo.offset = counter - decodeClientInfo.start_icd_counter;
+    EXPECT_EQ(manager.StoreEntry(decodeClientInfo), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.GetCheckInIndexSize(), 2 * static_cast<size_t>(CHIP_CONFIG_ICD_CLIENT_CHECK_IN_INDEX_WINDOW));
+    counter++;
+    output = MutableByteSpan{ buffer->Start(), buffer->MaxDataLength() };
+    EXPECT_EQ(chip::Protocols::SecureChannel::CheckinMessage::GenerateCheckinMessagePayload(
+                  clientInfo1.aes_key_handle, clientInfo1.hmac_key_handle, counter, ByteSpan(), output),
+              CHIP_NO_ERROR);
+    buffer->SetDataLength(static_cast<uint16_t>(output.size()));
+    ByteSpan payload2{ buffer->Start(), buffer->DataLength() };
+    EXPECT_EQ(manager.ProcessCheckInPayload(payload2, decodeClientInfo, checkInCounter), CHIP_NO_ERROR);
+    EXPECT_EQ(checkInCounter, counter);
+
+    EXPECT_EQ(manager.DeleteEntry(clientInfo2.peer_node), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.GetCheckInIndexSize(), static_cast<size_t>(CHIP_CONFIG_ICD_CLIENT_CHECK_IN_INDEX_WINDOW));
+    counter = 1;
+    output  = MutableByteSpan{ buffer->Start(), buffer->MaxDataLength() };
+    EXPECT_EQ(chip::Protocols::SecureChannel::CheckinMessage::GenerateCheckinMessagePayload(
+                  clientInfo2.aes_key_handle, clientInfo2.hmac_key_handle, counter, ByteSpan(), output),
+              CHIP_NO_ERROR);
+    buffer->SetDataLength(static_cast<uint16_t>(output.size()));
+    ByteSpan payload3{ buffer->Start(), buffer->DataLength() };
+    EXPECT_EQ(manager.ProcessCheckInPayload(payload3, decodeClientInfo, checkInCounter), CHIP_ERROR_NOT_FOUND);
+
+    EXPECT_EQ(manager.DeleteAllEntries(fabricId), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.GetCheckInIndexSize(), 0u);
+}
+
+TEST_F(TestDefaultICDClientStorage, TestWriteBehind)
+{
+    FabricIndex fabricId = 1;
+    TestPersistentStorageDelegate clientInfoStorage;
+    TestSessionKeystoreImpl keystore;
+
+    DefaultICDClientStorage manager;
+    EXPECT_EQ(manager.Init(&clientInfoStorage, &keystore), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.UpdateFabricList(fabricId), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.EnableWriteBehind(nullptr, System::Clock::kZero), CHIP_NO_ERROR);
+
+    ICDClientInfo clientInfo1;
+    clientInfo1.peer_node = ScopedNodeId(6666, fabricId);
+    EXPECT_EQ(manager.SetKey(clientInfo1, ByteSpan(kKeyBuffer1)), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.StoreEntry(clientInfo1), CHIP_NO_ERROR);
+
+    ICDClientInfo clientInfo2;
+    clientInfo2.peer_node = ScopedNodeId(7777, fabricId);
+    EXPECT_EQ(manager.SetKey(clientInfo2, ByteSpan(kKeyBuffer2)), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.StoreEntry(clientInfo2), CHIP_NO_ERROR);
+
+    // Updating an entry does not add one
+    clientInfo1.offset = 10;
+    EXPECT_EQ(manager.StoreEntry(clientInfo1), CHIP_NO_ERROR);
+
+    // The entries are served from RAM, nothing is written yet
+    EXPECT_TRUE(manager.HasPendingWrites());
+    EXPECT_FALSE(clientInfoStorage.HasKey(DefaultStorageKeyAllocator::ICDClientInfoKey(fabricId).KeyName()));
+    {
+        auto * iterator = manager.IterateICDClientInfo();
+        ASSERT_NE(iterator, nullptr);
+        DefaultICDClientStorage::ICDClientInfoIteratorWrapper clientInfoIteratorWrapper(iterator);
+        EXPECT_EQ(iterator->Count(), 2u);
+        ICDClientInfo clientInfo;
+        while (iterator->Next(clientInfo))
+        {
+            if (clientInfo.peer_node == clientInfo1.peer_node)
+            {
+                EXPECT_EQ(clientInfo.offset, 10u);
+            }
+        }
+    }
+
+    EXPECT_EQ(manager.Flush(), CHIP_NO_ERROR);
+    EXPECT_FALSE(manager.HasPendingWrites());
+    EXPECT_TRUE(clientInfoStorage.HasKey(DefaultStorageKeyAllocator::ICDClientInfoKey(fabricId).KeyName()));
+
+    EXPECT_EQ(manager.DeleteEntry(clientInfo2.peer_node), CHIP_NO_ERROR);
+    EXPECT_TRUE(manager.HasPendingWrites());
+
+    // Shutdown writes the pending changes
+    manager.Shutdown();
+
+    DefaultICDClientStorage reloadedManager;
+    EXPECT_EQ(reloadedManager.Init(&clientInfoStorage, &keystore), CHIP_NO_ERROR);
+    auto * iterator = reloadedManager.IterateICDClientInfo();
+    ASSERT_NE(iterator, nullptr);
+    DefaultICDClientStorage::ICDClientInfoIteratorWrapper clientInfoIteratorWrapper(iterator);
+    EXPECT_EQ(iterator->Count(), 1u);
+    ICDClientInfo clientInfo;
+    EXPECT_TRUE(iterator->Next(clientInfo));
+    EXPECT_EQ(clientInfo.peer_node, clientInfo1.peer_node);
+    EXPECT_EQ(clientInfo.offset, 10u);
+    EXPECT_FALSE(iterator->Next(clientInfo));
+}
@@ -183,4 +183,35 @@ TEST(TestDefaultOTARequestorStorage, TestTargetVersion)
     EXPECT_NE(CHIP_NO_ERROR, otaStorage.LoadTargetVersion(targetVersion));
 }
 
+TEST(TestDefaultOTARequestorStorage, TestDownloadCheckpoint)
+{
+    TestPersistentStorageDelegate persistentStorage;
+    DefaultOTARequestorStorage otaStorage;
+    otaStorage.Init(persistentStorage);
+
+    OTADownloadCheckpoint checkpoint;
+    checkpoint.offset         = 0x12345678901ULL;
+    checkpoint.storedBytes    = 0x12345678801ULL;
+    checkpoint.totalFileBytes = 0x22345678801ULL;
+    for (size_t i = 0; i < sizeof(checkpoint.prefixDigest); i++)
+    {
+        checkpoint.prefixDigest[i] = static_cast<uint8_t>(i);
+    }
+
+    EXPECT_EQ(CHIP_NO_ERROR, otaStorage.StoreDownloadCheckpoint(3, checkpoint));
+
+    uint32_t targetVersion = 0;
+    OTADownloadCheckpoint loaded;
+
+    EXPECT_EQ(CHIP_NO_ERROR, otaStorage.LoadDownloadCheckpoint(targetVersion, loaded));
+    EXPECT_EQ(targetVersion, 3u);
+    EXPECT_EQ(loaded.offset, checkpoint.offset);
+    EXPECT_EQ(loaded.storedBytes, checkpoint.storedBytes);
+    EXPECT_EQ(loaded.totalFileBytes, checkpoint.totalFileBytes);
+    EXPECT_EQ(0, memcmp(loaded.prefixDigest, checkpoint.prefixDigest, sizeof(checkpoint.prefixDigest)));
+
+    EXPECT_EQ(CHIP_NO_ERROR, otaStorage.ClearDownloadCheckpoint());
+    EXPECT_NE(CHIP_NO_ERROR, otaStorage.LoadDownloadCheckpoint(targetVersion, loaded));
+}
+
 } // namespace
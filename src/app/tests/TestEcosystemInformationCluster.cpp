@@ -285,6 +285,71 @@ TEST_F(TestEcosystemInformationCluster, AddDeviceInfo)
     ASSERT_FALSE(iterator.Next());
 }
 
+TEST_F(TestEcosystemInformationCluster, ChunkedReadOfDeviceDirectoryResumesWhereItStopped)
+{
+    // Large enough for the directory not to fit in a single report.
+    constexpr uint16_t kDeviceCount = 30;
+    const std::string kDeviceName(64, 'x');
+    for (uint16_t i = 0; i < kDeviceCount; i++)
+    {
+        std::unique_ptr<EcosystemDeviceStruct> deviceInfo = EcosystemDeviceStruct::Builder()
+                                                                .SetDeviceName(kDeviceName, 0)
+                                                                .SetOriginalEndpoint(static_cast<EndpointId>(i + 1))
+                                                                .AddDeviceType(kValidDeviceType)
+                                                                .SetFabricIndex(kValidFabricIndex)
+                                                                .Build();
+        ASSERT_TRUE(deviceInfo);
+        ASSERT_EQ(EcoInfoCluster().AddDeviceInfo(kValidEndpointId, std::move(deviceInfo)), CHIP_NO_ERROR);
+    }
+
+    ConcreteAttributePath deviceDirectoryPath(kValidEndpointId, kEcosystemInfoClusterId, kDeviceDirectoryAttributeId);
+    AttributeEncodeState state;
+    uint16_t nextOriginalEndpoint = 1;
+    size_t chunkCount             = 0;
+    CHIP_ERROR err                = CHIP_NO_ERROR;
+    do
+    {
+        Testing::ReadOperation testDeviceDirectoryRequest(deviceDirectoryPath);
+        testDeviceDirectoryRequest.SetSubjectDescriptor(kSubjectDescriptor);
+        std::unique_ptr<AttributeValueEncoder> encoder =
+            testDeviceDirectoryRequest.StartEncoding(Testing::ReadOperation::EncodingParams().SetEncodingState(state));
+
+        err = EcoInfoCluster().ReadAttribute(deviceDirectoryPath, *encoder);
+        ASSERT_TRUE(err == CHIP_NO_ERROR || err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL);
+        state = encoder->GetState();
+        ASSERT_EQ(testDeviceDirectoryRequest.FinishEncoding(), CHIP_NO_ERROR);
+
+        std::vector<Testing::DecodedAttributeData> attributeData;
+        ASSERT_EQ(testDeviceDirectoryRequest.GetEncodedIBs().Decode(attributeData), CHIP_NO_ERROR);
+        for (auto & encodedData : attributeData)
+        {
+            if (chunkCount == 0)
+            {
+                // The first chunk holds the beginning of the list, the next ones append the following devices.
+                EcosystemInformation::Attributes::DeviceDirectory::TypeInfo::DecodableType decodableDeviceDirectory;
+                ASSERT_EQ(decodableDeviceDirectory.Decode(encodedData.dataReader), CHIP_NO_ERROR);
+                auto iterator = decodableDeviceDirectory.begin();
+                while (iterator.Next())
+                {
+                    ASSERT_EQ(iterator.GetValue().originalEndpoint, nextOriginalEndpoint++);
+                }
+                ASSERT_EQ(iterator.GetStatus(), CHIP_NO_ERROR);
+            }
+            else
+            {
+                EcosystemInformation::Structs::EcosystemDeviceStruct::DecodableType device;
+                ASSERT_EQ(device.Decode(encodedData.dataReader), CHIP_NO_ERROR);
+                ASSERT_EQ(device.originalEndpoint, nextOriginalEndpoint++);
+            }
+        }
+        chunkCount++;
+    } while (err != CHIP_NO_ERROR && chunkCount < kDeviceCount);
+
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_GT(chunkCount, 1u);
+    EXPECT_EQ(nextOriginalEndpoint, kDeviceCount + 1);
+}
+
 TEST_F(TestEcosystemInformationCluster, AddDeviceInfoResultInMarkDirty)
 {
     std::unique_ptr<EcosystemDeviceStruct> deviceInfo = CreateSimplestValidDeviceStruct();
@@ -0,0 +1,151 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/AttributeValueEncoder.h>
+#include <app/MessageDef/AttributeReportIBs.h>
+#include <app/reporting/EncodedAttributeCache.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVWriter.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::reporting;
+
+namespace {
+
+constexpr EndpointId kTestEndpointId   = 1;
+constexpr ClusterId kTestClusterId     = 6;
+constexpr AttributeId kTestAttributeId = 0;
+
+EncodedAttributeCache::Key MakeKey(AttributeId attributeId, DataVersion dataVersion = 1, bool fabricFiltered = false)
+{
+    EncodedAttributeCache::Key key;
+    key.path           = ConcreteAttributePath(kTestEndpointId, kTestClusterId, attributeId);
+    key.dataVersion    = dataVersion;
+    key.fabricFiltered = fabricFiltered;
+    return key;
+}
+
+// Encodes the given value into the free space of the cache the way the reporting engine does, and caches it.
+CHIP_ERROR EncodeIntoCache(EncodedAttributeCache & cache, const EncodedAttributeCache::Key & key, uint32_t value)
+{
+    MutableByteSpan freeSpace = cache.FreeSpace();
+    VerifyOrReturnError(!freeSpace.empty(), CHIP_ERROR_NO_MEMORY);
+
+    TLV::TLVWriter writer;
+    writer.Init(freeSpace);
+    AttributeReportIBs::Builder builder;
+    ReturnErrorOnFailure(builder.Init(&writer));
+
+    const uint32_t start = writer.GetLengthWritten();
+    AttributeValueEncoder encoder(builder, Access::SubjectDescriptor(), key.path, key.dataVersion, key.fabricFiltered);
+    ReturnErrorOnFailure(encoder.Encode(value));
+
+    cache.Insert(key, ByteSpan(freeSpace.data() + start, writer.GetLengthWritten() - start));
+    return CHIP_NO_ERROR;
+}
+
+TEST(TestEncodedAttributeCache, TestFindAndCopy)
+{
+    EncodedAttributeCacheWithStorage<256, 4> cache;
+    const EncodedAttributeCache::Key key = MakeKey(kTestAttributeId);
+
+    ByteSpan encoded;
+    EXPECT_FALSE(cache.Find(key, encoded));
+    EXPECT_EQ(EncodeIntoCache(cache, key, 42), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Size(), 1u);
+
+    ASSERT_TRUE(cache.Find(key, encoded));
+    EXPECT_FALSE(cache.Find(MakeKey(kTestAttributeId + 1), encoded));
+    EXPECT_FALSE(cache.Find(MakeKey(kTestAttributeId, 2), encoded));
+    EXPECT_FALSE(cache.Find(MakeKey(kTestAttributeId, 1, true), encoded));
+
+    // Copy the cached AttributeReportIB into a report, and check that it parses as the value that was encoded.
+    ASSERT_TRUE(cache.Find(key, encoded));
+    uint8_t reportBuffer[128];
+    TLV::TLVWriter reportWriter;
+    reportWriter.Init(reportBuffer);
+    AttributeReportIBs::Builder reportBuilder;
+    ASSERT_EQ(reportBuilder.Init(&reportWriter), CHIP_NO_ERROR);
+
+    TLV::TLVReader cachedReader;
+    cachedReader.Init(encoded);
+    ASSERT_EQ(cachedReader.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(reportWriter.CopyElement(cachedReader), CHIP_NO_ERROR);
+    EXPECT_EQ(cachedReader.Next(), CHIP_END_OF_TLV);
+    reportBuilder.EndOfAttributeReportIBs();
+    ASSERT_EQ(reportBuilder.GetError(), CHIP_NO_ERROR);
+    ASSERT_EQ(reportWriter.Finalize(), CHIP_NO_ERROR);
+
+    TLV::TLVReader reader;
+    reader.Init(reportBuffer, reportWriter.GetLengthWritten());
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+    AttributeReportIBs::Parser reportsParser;
+    ASSERT_EQ(reportsParser.Init(reader), CHIP_NO_ERROR);
+
+    TLV::TLVReader reportsReader;
+    reportsParser.GetReader(&reportsReader);
+    ASSERT_EQ(reportsReader.Next(), CHIP_NO_ERROR);
+    AttributeReportIB::Parser reportParser;
+    ASSERT_EQ(reportParser.Init(reportsReader), CHIP_NO_ERROR);
+    AttributeDataIB::Parser dataParser;
+    ASSERT_EQ(reportParser.GetAttributeData(&dataParser), CHIP_NO_ERROR);
+
+    DataVersion version = 0;
+    EXPECT_EQ(dataParser.GetDataVersion(&version), CHIP_NO_ERROR);
+    EXPECT_EQ(version, key.dataVersion);
+
+    TLV::TLVReader dataReader;
+    ASSERT_EQ(dataParser.GetData(&dataReader), CHIP_NO_ERROR);
+    uint32_t value = 0;
+    EXPECT_EQ(dataReader.Get(value), CHIP_NO_ERROR);
+    EXPECT_EQ(value, 42u);
+    EXPECT_EQ(reportsReader.Next(), CHIP_END_OF_TLV);
+}
+
+TEST(TestEncodedAttributeCache, TestCapacity)
+{
+    EncodedAttributeCacheWithStorage<256, 2> cache;
+
+    EXPECT_EQ(EncodeIntoCache(cache, MakeKey(1), 1), CHIP_NO_ERROR);
+    EXPECT_EQ(EncodeIntoCache(cache, MakeKey(2), 2), CHIP_NO_ERROR);
+    EXPECT_TRUE(cache.FreeSpace().empty());
+    EXPECT_EQ(EncodeIntoCache(cache, MakeKey(3), 3), CHIP_ERROR_NO_MEMORY);
+
+    ByteSpan first;
+    ByteSpan second;
+    ASSERT_TRUE(cache.Find(MakeKey(1), first));
+    ASSERT_TRUE(cache.Find(MakeKey(2), second));
+    EXPECT_LE(first.data() + first.size(), second.data());
+
+    cache.Clear();
+    EXPECT_EQ(cache.Size(), 0u);
+    EXPECT_FALSE(cache.Find(MakeKey(1), first));
+    EXPECT_EQ(cache.FreeSpace().size(), 256u);
+
+    // A value larger than the remaining space fails to encode, and the cache stays usable.
+    EncodedAttributeCacheWithStorage<8, 2> smallCache;
+    EXPECT_NE(EncodeIntoCache(smallCache, MakeKey(1), 1), CHIP_NO_ERROR);
+    EXPECT_EQ(smallCache.Size(), 0u);
+    EXPECT_EQ(smallCache.FreeSpace().size(), 8u);
+}
+
+} // namespace
@@ -30,6 +30,7 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/EnforceFormat.h>
 #include <lib/support/LinkedList.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
 #include <lib/support/logging/Constants.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/Flags.h>
@@ -332,4 +333,83 @@ TEST_F(TestEventLoggingNoUTCTime, TestCheckLogEventWithDiscardLowEvent)
     CheckLogState(logMgmt, 4, chip::app::PriorityLevel::Info);
 }
 
+static size_t FetchEventCount(chip::app::EventManagement & alogMgmt, chip::EventNumber startingEventNumber,
+                              chip::SingleLinkedListNode<chip::app::EventPathParams> * clusterInfo)
+{
+    chip::TLV::TLVWriter writer;
+    size_t eventCount = 0;
+
+    chip::Platform::ScopedMemoryBuffer<uint8_t> backingStore;
+    VerifyOrDie(backingStore.Alloc(1024));
+
+    writer.Init(backingStore.Get(), 1024);
+    CHIP_ERROR err =
+        alogMgmt.FetchEventsSince(writer, clusterInfo, startingEventNumber, eventCount, chip::Access::SubjectDescriptor{});
+    EXPECT_TRUE(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV);
+    return eventCount;
+}
+
+TEST_F(TestEventLoggingNoUTCTime, TestFetchEventsSinceEveryEventNumber)
+{
+    chip::app::EventOptions options;
+    options.mPath     = { kTestEndpointId1, kLivenessClusterId, kLivenessChangeEvent };
+    options.mPriority = chip::app::PriorityLevel::Critical;
+    TestEventGenerator testEventGenerator;
+    chip::SingleLinkedListNode<chip::app::EventPathParams> path;
+
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+
+    // Critical events are promoted through every buffer and only dropped from the critical buffer, so the events left
+    // always have consecutive numbers.  Fetching from any event number must start at that event, wherever the fetch
+    // resumes from in the buffers.
+    for (int32_t i = 0; i < 20; i++)
+    {
+        chip::EventNumber lastEventNumber;
+        testEventGenerator.SetStatus(i);
+        EXPECT_EQ(logMgmt.LogEvent(&testEventGenerator, options, lastEventNumber), CHIP_NO_ERROR);
+
+        const size_t totalCount              = FetchEventCount(logMgmt, 0, &path);
+        const chip::EventNumber oldestNumber = lastEventNumber + 1 - totalCount;
+        for (chip::EventNumber eventNumber = 0; eventNumber <= lastEventNumber + 1; eventNumber++)
+        {
+            const size_t expectedCount =
+                (eventNumber <= oldestNumber) ? totalCount : static_cast<size_t>(lastEventNumber + 1 - eventNumber);
+            EXPECT_EQ(FetchEventCount(logMgmt, eventNumber, &path), expectedCount);
+        }
+    }
+}
+
+TEST_F(TestEventLoggingNoUTCTime, TestFetchEventsSinceFromPersistentEventLog)
+{
+    chip::app::EventOptions options;
+    options.mPath     = { kTestEndpointId1, kLivenessClusterId, kLivenessChangeEvent };
+    options.mPriority = chip::app::PriorityLevel::Critical;
+    TestEventGenerator testEventGenerator;
+    chip::SingleLinkedListNode<chip::app::EventPathParams> path;
+    chip::TestPersistentStorageDelegate storage;
+    chip::app::PersistentEventLog persistentEventLog;
+
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+    ASSERT_EQ(persistentEventLog.Init(&storage), CHIP_NO_ERROR);
+    logMgmt.SetPersistentEventLog(&persistentEventLog);
+
+    // Far more events than the buffers hold: the evicted ones are read back from the persistent log.
+    chip::EventNumber firstEventNumber = 0;
+    chip::EventNumber lastEventNumber  = 0;
+    for (int32_t i = 0; i < 20; i++)
+    {
+        testEventGenerator.SetStatus(i);
+        EXPECT_EQ(logMgmt.LogEvent(&testEventGenerator, options, lastEventNumber), CHIP_NO_ERROR);
+        firstEventNumber = (i == 0) ? lastEventNumber : firstEventNumber;
+    }
+    EXPECT_FALSE(persistentEventLog.IsEmpty());
+
+    for (chip::EventNumber eventNumber = firstEventNumber; eventNumber <= lastEventNumber + 1; eventNumber++)
+    {
+        EXPECT_EQ(FetchEventCount(logMgmt, eventNumber, &path), static_cast<size_t>(lastEventNumber + 1 - eventNumber));
+    }
+
+    logMgmt.SetPersistentEventLog(nullptr);
+}
+
 } // namespace
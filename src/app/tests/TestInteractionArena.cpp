@@ -0,0 +1,146 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/InteractionArena.h>
+#include <lib/support/CHIPMem.h>
+#include <pw_unit_test/framework.h>
+
+#include <cstdint>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+
+class TestInteractionArena : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void TearDown() override { InteractionArena::ReleaseCachedBlocks(); }
+};
+
+TEST_F(TestInteractionArena, TestAlignmentAndZeroing)
+{
+    InteractionArena arena;
+    EXPECT_TRUE(arena.IsEmpty());
+
+    uint8_t * bytes = arena.AllocateArray<uint8_t>(3);
+    ASSERT_NE(bytes, nullptr);
+    EXPECT_EQ(bytes[0] | bytes[1] | bytes[2], 0);
+
+    uint64_t * words = arena.AllocateArray<uint64_t>(4);
+    ASSERT_NE(words, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(words) % alignof(uint64_t), 0u);
+    EXPECT_EQ(words[0] | words[1] | words[2] | words[3], 0u);
+
+    // Allocations do not overlap.
+    EXPECT_GE(reinterpret_cast<uint8_t *>(words), bytes + 3);
+    EXPECT_EQ(arena.GetBytesAllocated(), 3 + 4 * sizeof(uint64_t));
+    EXPECT_FALSE(arena.IsEmpty());
+
+    arena.Reset();
+    EXPECT_TRUE(arena.IsEmpty());
+    EXPECT_EQ(arena.GetBytesAllocated(), 0u);
+}
+
+TEST_F(TestInteractionArena, TestBlocksAreReused)
+{
+    InteractionArena arena;
+
+    // Fill more than one block.
+    size_t chunk = InteractionArena::kBlockSize / 4;
+    void * first = arena.Allocate(chunk);
+    ASSERT_NE(first, nullptr);
+    for (int i = 0; i < 4; i++)
+    {
+        ASSERT_NE(arena.Allocate(chunk), nullptr);
+    }
+    EXPECT_EQ(InteractionArena::GetNumCachedBlocks(), 0u);
+
+    arena.Reset();
+    EXPECT_EQ(InteractionArena::GetNumCachedBlocks(), 2u);
+
+    // Another arena picks up a cached block rather than going to the heap.
+    InteractionArena other;
+    ASSERT_NE(other.Allocate(chunk), nullptr);
+    EXPECT_EQ(InteractionArena::GetNumCachedBlocks(), 1u);
+}
+
+TEST_F(TestInteractionArena, TestOversizedAllocations)
+{
+    InteractionArena arena;
+
+    uint8_t * small = static_cast<uint8_t *>(arena.Allocate(16));
+    ASSERT_NE(small, nullptr);
+
+    uint8_t * big = arena.AllocateArray<uint8_t>(InteractionArena::kBlockSize * 3);
+    ASSERT_NE(big, nullptr);
+    big[InteractionArena::kBlockSize * 3 - 1] = 0xAA;
+
+    // The block being carved stays current: the next small allocation follows the first one.
+    uint8_t * next = static_cast<uint8_t *>(arena.Allocate(16));
+    EXPECT_EQ(next, small + 16);
+
+    // Oversized blocks go back to the heap; only the regular one is cached.
+    arena.Reset();
+    EXPECT_EQ(InteractionArena::GetNumCachedBlocks(), 1u);
+
+    // An oversized first allocation is not carved from afterwards.
+    big = arena.AllocateArray<uint8_t>(InteractionArena::kBlockSize + 1);
+    ASSERT_NE(big, nullptr);
+    next = static_cast<uint8_t *>(arena.Allocate(16));
+    ASSERT_NE(next, nullptr);
+    EXPECT_TRUE(next + 16 <= big || next >= big + InteractionArena::kBlockSize + 1);
+}
+
+TEST_F(TestInteractionArena, TestCacheIsBounded)
+{
+    {
+        InteractionArena arena;
+        for (size_t i = 0; i < InteractionArena::kMaxFreeBlocks + 2; i++)
+        {
+            ASSERT_NE(arena.Allocate(InteractionArena::kBlockSize), nullptr);
+        }
+    }
+    EXPECT_EQ(InteractionArena::GetNumCachedBlocks(), InteractionArena::kMaxFreeBlocks);
+
+    InteractionArena::ReleaseCachedBlocks();
+    EXPECT_EQ(InteractionArena::GetNumCachedBlocks(), 0u);
+}
+
+TEST_F(TestInteractionArena, TestScope)
+{
+    InteractionArena outer;
+    InteractionArena inner;
+
+    EXPECT_EQ(InteractionArena::Current(), nullptr);
+    {
+        InteractionArena::Scope outerScope(outer);
+        EXPECT_EQ(InteractionArena::Current(), &outer);
+        {
+            InteractionArena::Scope innerScope(inner);
+            EXPECT_EQ(InteractionArena::Current(), &inner);
+        }
+        EXPECT_EQ(InteractionArena::Current(), &outer);
+    }
+    EXPECT_EQ(InteractionArena::Current(), nullptr);
+}
+
+} // namespace
@@ -66,8 +66,10 @@ public:
     void TestSubjectHasActiveSubscriptionMultipleSubsSingleEntry();
     void TestSubjectHasActiveSubscriptionMultipleSubsMultipleEntries();
     void TestSubjectHasActiveSubscriptionSubWithCAT();
+    void TestHandlerPoolCapacities();
     void TestSubscriptionResumptionTimer();
     void TestDecrementNumSubscriptionsToResume();
+    void TestSubscriptionResumptionQueue();
     static int GetAttributePathListLength(SingleLinkedListNode<AttributePathParams> * apattributePathParamsList);
 };
 
@@ -242,6 +244,69 @@ TEST_F(TestInteractionModelEngine, TestRemoveDuplicateConcreteAttribute)
     engine->ReleaseAttributePathList(attributePathParamsList);
 }
 
+TEST_F(TestInteractionModelEngine, TestMergeIntoAttributePathList)
+{
+    InteractionModelEngine * engine = InteractionModelEngine::GetInstance();
+
+    EXPECT_EQ(CHIP_NO_ERROR, engine->Init(&GetExchangeManager(), &GetFabricTable(), app::reporting::GetDefaultReportScheduler()));
+
+    SingleLinkedListNode<AttributePathParams> * attributePathParamsList = nullptr;
+
+    AttributePathParams concretePath(chip::Test::kMockEndpoint3, chip::Test::MockClusterId(2), chip::Test::MockAttributeId(2));
+    AttributePathParams otherConcretePath(chip::Test::kMockEndpoint3, chip::Test::MockClusterId(2), chip::Test::MockAttributeId(3));
+    AttributePathParams nonExistentPath(chip::Test::kMockEndpoint3, chip::Test::MockClusterId(2), chip::Test::MockAttributeId(10));
+    AttributePathParams endpointWildcardPath(chip::Test::kMockEndpoint3);
+    AttributePathParams wildcardPath;
+
+    // The same concrete path is only added once.
+    EXPECT_EQ(CHIP_NO_ERROR, engine->MergeIntoAttributePathList(attributePathParamsList, concretePath));
+    EXPECT_EQ(CHIP_NO_ERROR, engine->MergeIntoAttributePathList(attributePathParamsList, concretePath));
+    EXPECT_EQ(CHIP_NO_ERROR, engine->MergeIntoAttributePathList(attributePathParamsList, otherConcretePath));
+    EXPECT_EQ(CHIP_NO_ERROR, engine->MergeIntoAttributePathList(attributePathParamsList, nonExistentPath));
+    EXPECT_EQ(GetAttributePathListLength(attributePathParamsList), 3);
+
+    // A wildcard replaces the existent paths it covers, but not the non-existent one.
+    EXPECT_EQ(CHIP_NO_ERROR, engine->MergeIntoAttributePathList(attributePathParamsList, endpointWildcardPath));
+    EXPECT_EQ(GetAttributePathListLength(attributePathParamsList), 2);
+
+    // Paths covered by a wildcard in the list are not added.
+    EXPECT_EQ(CHIP_NO_ERROR, engine->MergeIntoAttributePathList(attributePathParamsList, concretePath));
+    EXPECT_EQ(GetAttributePathListLength(attributePathParamsList), 2);
+
+    // A wider wildcard replaces the one it contains.
+    EXPECT_EQ(CHIP_NO_ERROR, engine->MergeIntoAttributePathList(attributePathParamsList, wildcardPath));
+    EXPECT_EQ(GetAttributePathListLength(attributePathParamsList), 2);
+    EXPECT_EQ(CHIP_NO_ERROR, engine->MergeIntoAttributePathList(attributePathParamsList, endpointWildcardPath));
+    EXPECT_EQ(GetAttributePathListLength(attributePathParamsList), 2);
+    ASSERT_NE(attributePathParamsList, nullptr);
+    EXPECT_EQ(attributePathParamsList->mValue, wildcardPath);
+
+    engine->ReleaseAttributePathList(attributePathParamsList);
+}
+
+TEST_F(TestInteractionModelEngine, TestMergeIntoEventPathList)
+{
+    InteractionModelEngine * engine = InteractionModelEngine::GetInstance();
+
+    EXPECT_EQ(CHIP_NO_ERROR, engine->Init(&GetExchangeManager(), &GetFabricTable(), app::reporting::GetDefaultReportScheduler()));
+
+    SingleLinkedListNode<EventPathParams> * eventPathParamsList = nullptr;
+    EventPathParams eventPath(1, 2, 3);
+    EventPathParams urgentEventPath(1, 2, 3, true /* aUrgentEvent */);
+    EventPathParams otherEventPath(1, 2, 4);
+
+    EXPECT_EQ(CHIP_NO_ERROR, engine->MergeIntoEventPathList(eventPathParamsList, eventPath));
+    EXPECT_EQ(CHIP_NO_ERROR, engine->MergeIntoEventPathList(eventPathParamsList, otherEventPath));
+    EXPECT_EQ(CHIP_NO_ERROR, engine->MergeIntoEventPathList(eventPathParamsList, urgentEventPath));
+    ASSERT_NE(eventPathParamsList, nullptr);
+    ASSERT_NE(eventPathParamsList->mpNext, nullptr);
+    EXPECT_EQ(eventPathParamsList->mpNext->mpNext, nullptr);
+    EXPECT_TRUE(eventPathParamsList->mpNext->mValue.IsSamePath(eventPath));
+    EXPECT_TRUE(eventPathParamsList->mpNext->mValue.mIsUrgentEvent);
+
+    engine->ReleaseEventPathList(eventPathParamsList);
+}
+
 /**
  * @brief Test verifies the SubjectHasActiveSubscription with a single subscription with a single entry
  */
@@ -561,6 +626,40 @@ TEST_F_FROM_FIXTURE(TestInteractionModelEngine, TestSubjectHasActiveSubscription
     EXPECT_FALSE(engine->SubjectHasActiveSubscription(bobFabricIndex, invalideSubjectId));
 }
 
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+TEST_F_FROM_FIXTURE(TestInteractionModelEngine, TestHandlerPoolCapacities)
+{
+    InteractionModelEngine * engine = InteractionModelEngine::GetInstance();
+
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), app::reporting::GetDefaultReportScheduler()), CHIP_NO_ERROR);
+
+    // Heap pools are unbounded by default.
+    EXPECT_EQ(engine->GetMinGuaranteedSubscriptionsPerFabric(), UINT16_MAX);
+
+    // The capacities have to leave the spec minimas to each fabric.
+    InteractionModelEngine::HandlerPoolCapacities capacities;
+    capacities.mReadHandlersForSubscriptions = InteractionModelEngine::kMinSupportedSubscriptionsPerFabric;
+    EXPECT_EQ(engine->SetHandlerPoolCapacities(capacities), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(engine->GetMinGuaranteedSubscriptionsPerFabric(), UINT16_MAX);
+
+    const size_t subscriptionsPerFabric      = 2 * InteractionModelEngine::kMinSupportedSubscriptionsPerFabric;
+    capacities.mReadHandlersForSubscriptions = subscriptionsPerFabric * engine->GetConfigMaxFabrics();
+    capacities.mPathsForSubscriptions =
+        capacities.mReadHandlersForSubscriptions * InteractionModelEngine::kMinSupportedPathsPerSubscription;
+    EXPECT_EQ(engine->SetHandlerPoolCapacities(capacities), CHIP_NO_ERROR);
+    EXPECT_TRUE(engine->IsHandlerQuotaEnforced());
+    EXPECT_EQ(engine->GetMinGuaranteedSubscriptionsPerFabric(), subscriptionsPerFabric);
+    EXPECT_EQ(engine->GetReadHandlerPoolCapacityForSubscriptions(), capacities.mReadHandlersForSubscriptions);
+    EXPECT_EQ(engine->GetPathPoolCapacityForSubscriptions(), capacities.mPathsForSubscriptions);
+    // The capacities that were not set keep their compile-time values.
+    EXPECT_EQ(engine->GetReadHandlerPoolCapacityForReads(), static_cast<size_t>(CHIP_IM_MAX_NUM_READS));
+
+    engine->ClearHandlerPoolCapacities();
+    EXPECT_EQ(engine->GetMinGuaranteedSubscriptionsPerFabric(), UINT16_MAX);
+    EXPECT_EQ(engine->GetReadHandlerPoolCapacityForSubscriptions(), static_cast<size_t>(CHIP_IM_MAX_NUM_SUBSCRIPTIONS));
+}
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
 #if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
 
 /**
@@ -708,6 +807,58 @@ TEST_F_FROM_FIXTURE(TestInteractionModelEngine, TestDecrementNumSubscriptionsToR
     engine->SetICDManager(nullptr);
 #endif // CHIP_CONFIG_ENABLE_ICD_CIP && CHIP_CONFIG_PERSIST_SUBSCRIPTIONS && !CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
 }
+
+TEST_F_FROM_FIXTURE(TestInteractionModelEngine, TestSubscriptionResumptionQueue)
+{
+    InteractionModelEngine * engine = InteractionModelEngine::GetInstance();
+
+    // Without a CASESessionManager, the resumptions stay queued.
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), app::reporting::GetDefaultReportScheduler()), CHIP_NO_ERROR);
+
+    SubscriptionResumptionStorage::SubscriptionInfo info1 = { .mNodeId         = 1,
+                                                              .mFabricIndex    = 1,
+                                                              .mSubscriptionId = 1,
+                                                              .mMaxInterval    = 60 };
+    SubscriptionResumptionStorage::SubscriptionInfo info2 = { .mNodeId         = 1,
+                                                              .mFabricIndex    = 1,
+                                                              .mSubscriptionId = 2,
+                                                              .mMaxInterval    = 30 };
+    SubscriptionResumptionStorage::SubscriptionInfo info3 = { .mNodeId         = 2,
+                                                              .mFabricIndex    = 1,
+                                                              .mSubscriptionId = 3,
+                                                              .mMaxInterval    = 10 };
+
+    // The subscriptions of a peer share its establisher.
+    EXPECT_EQ(engine->QueueSubscriptionResumption(info1), CHIP_NO_ERROR);
+    EXPECT_EQ(engine->QueueSubscriptionResumption(info2), CHIP_NO_ERROR);
+    EXPECT_EQ(engine->QueueSubscriptionResumption(info3), CHIP_NO_ERROR);
+    engine->StartQueuedSubscriptionResumptions();
+    EXPECT_EQ(engine->GetSubscriptionResumptionStats().mNumPeersQueued, 2u);
+    EXPECT_EQ(engine->GetSubscriptionResumptionStats().mNumPeersInFlight, 0u);
+
+    EXPECT_TRUE(engine->IsSubscriptionBeingResumed(1));
+    EXPECT_TRUE(engine->IsSubscriptionBeingResumed(2));
+    EXPECT_TRUE(engine->IsSubscriptionBeingResumed(3));
+    EXPECT_FALSE(engine->IsSubscriptionBeingResumed(4));
+
+    // The peer with the shortest max interval goes first.
+    SubscriptionResumptionSessionEstablisher & first  = *engine->mQueuedSubscriptionResumptions.begin();
+    SubscriptionResumptionSessionEstablisher & second = *(++engine->mQueuedSubscriptionResumptions.begin());
+    EXPECT_TRUE(first.GetPeer() == ScopedNodeId(1, 1));
+    EXPECT_EQ(first.GetNumSubscriptions(), 2u);
+    EXPECT_EQ(first.GetShortestMaxInterval(), 30);
+    EXPECT_TRUE(second.GetPeer() == ScopedNodeId(2, 1));
+    EXPECT_TRUE(engine->IsResumedBefore(second, first));
+    EXPECT_FALSE(engine->IsResumedBefore(first, second));
+
+    // Unless the other peer is a client registered for Check-In messages.
+    first.SetCheckInClient(true);
+    EXPECT_TRUE(engine->IsResumedBefore(first, second));
+
+    engine->ClearSubscriptionResumptions();
+    EXPECT_EQ(engine->GetSubscriptionResumptionStats().mNumPeersQueued, 0u);
+    EXPECT_FALSE(engine->IsSubscriptionBeingResumed(1));
+}
 #endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
 
 } // namespace app
@@ -0,0 +1,237 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/CASEClientPool.h>
+#include <app/OperationalSessionSetup.h>
+#include <app/tests/AppTestContext.h>
+#include <credentials/GroupDataProviderImpl.h>
+#include <inet/IPAddress.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/Pool.h>
+#include <lib/support/tests/ExtraPwTestMacros.h>
+#include <pw_unit_test/framework.h>
+#include <transport/raw/PeerAddress.h>
+
+#if CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS > 0
+
+namespace chip {
+
+namespace {
+
+constexpr NodeId kPeerNodeId = 0xDEDEDEDE00010001;
+
+class TestCASEClientPool : public CASEClientPoolDelegate
+{
+public:
+    ~TestCASEClientPool() override { mClients.ReleaseAll(); }
+
+    CASEClient * Allocate() override { return mClients.CreateObject(); }
+
+    void Release(CASEClient * client) override { mClients.ReleaseObject(client); }
+
+    size_t Allocated() const { return mClients.Allocated(); }
+
+private:
+    ObjectPool<CASEClient, 3> mClients;
+};
+
+class TestReleaseDelegate : public OperationalSessionReleaseDelegate
+{
+public:
+    void ReleaseSession(OperationalSessionSetup * sessionSetup) override { mReleased = true; }
+
+    bool mReleased = false;
+};
+
+Transport::PeerAddress MakeAddress(const char * ipAddress)
+{
+    Inet::IPAddress address;
+    Inet::IPAddress::FromString(ipAddress, address);
+    return Transport::PeerAddress::UDP(address, CHIP_PORT);
+}
+
+} // namespace
+
+class TestOperationalSessionSetup : public Test::AppContext
+{
+public:
+    void SetUp() override
+    {
+        AppContext::SetUp();
+
+        mInitParams.sessionManager    = &GetSecureSessionManager();
+        mInitParams.exchangeMgr       = &GetExchangeManager();
+        mInitParams.fabricTable       = &GetFabricTable();
+        mInitParams.groupDataProvider = &mGroupDataProvider;
+    }
+
+    void TestStaggeredAttemptPromotedWhenFirstFails();
+    void TestStaggeredAttemptFailureTriesNextAddress();
+    void TestStaggeredAttemptBusyDoesNotTryNextAddress();
+    void TestStaggeredAttemptWithoutMoreAddresses();
+    void TestCleanupCancelsStaggeredAttempt();
+
+protected:
+    using State = OperationalSessionSetup::State;
+
+    // Returns a session setup with a CASE handshake to kFirstAddress in progress.
+    OperationalSessionSetup * NewConnectingSetup()
+    {
+        auto * setup = Platform::New<OperationalSessionSetup>(mInitParams, &mClientPool,
+                                                              ScopedNodeId(kPeerNodeId, GetBobFabricIndex()), &mReleaseDelegate);
+        setup->MoveToState(State::Connecting);
+        setup->mCASEClient    = mClientPool.Allocate();
+        setup->mDeviceAddress = mFirstAddress;
+        return setup;
+    }
+
+    // Makes the staggered handshake to mSecondAddress race the first one.
+    CASEClient * StartStaggeredHandshake(OperationalSessionSetup * setup)
+    {
+        setup->mStaggeredCASEClient     = mClientPool.Allocate();
+        setup->mStaggeredResult.address = mSecondAddress;
+        return setup->mStaggeredCASEClient;
+    }
+
+    bool IsStaggeredAttemptScheduled(OperationalSessionSetup * setup)
+    {
+        return GetSystemLayer().IsTimerActive(OperationalSessionSetup::OnStaggeredAttemptTimer, setup);
+    }
+
+    CASEClientInitParams mInitParams;
+    Credentials::GroupDataProviderImpl mGroupDataProvider;
+    TestCASEClientPool mClientPool;
+    TestReleaseDelegate mReleaseDelegate;
+
+    const Transport::PeerAddress mFirstAddress  = MakeAddress("fd00::1");
+    const Transport::PeerAddress mSecondAddress = MakeAddress("fd00::2");
+};
+
+TEST_F_FROM_FIXTURE(TestOperationalSessionSetup, TestStaggeredAttemptPromotedWhenFirstFails)
+{
+    OperationalSessionSetup * setup = NewConnectingSetup();
+    CASEClient * staggeredClient    = StartStaggeredHandshake(setup);
+    EXPECT_EQ(mClientPool.Allocated(), 2u);
+
+    // The first handshake failing leaves the staggered one as the only attempt,
+    // without reporting anything to the consumers.
+    setup->OnSessionEstablishmentError(CHIP_ERROR_TIMEOUT, SessionEstablishmentStage::kSentSigma1);
+
+    EXPECT_EQ(setup->mState, State::Connecting);
+    EXPECT_EQ(setup->mCASEClient, staggeredClient);
+    EXPECT_EQ(setup->mStaggeredCASEClient, nullptr);
+    EXPECT_EQ(setup->mDeviceAddress, mSecondAddress);
+    EXPECT_EQ(mClientPool.Allocated(), 1u);
+    EXPECT_FALSE(mReleaseDelegate.mReleased);
+
+    Platform::Delete(setup);
+    EXPECT_EQ(mClientPool.Allocated(), 0u);
+}
+
+TEST_F_FROM_FIXTURE(TestOperationalSessionSetup, TestStaggeredAttemptFailureTriesNextAddress)
+{
+    OperationalSessionSetup * setup = NewConnectingSetup();
+    CASEClient * firstClient        = setup->mCASEClient;
+    StartStaggeredHandshake(setup);
+
+    setup->mStaggeredAttemptDelegate.OnSessionEstablishmentError(CHIP_ERROR_TIMEOUT, SessionEstablishmentStage::kSentSigma1);
+
+    // The first handshake goes on, and the next address will race it.
+    EXPECT_EQ(setup->mState, State::Connecting);
+    EXPECT_EQ(setup->mCASEClient, firstClient);
+    EXPECT_EQ(setup->mStaggeredCASEClient, nullptr);
+    EXPECT_EQ(setup->mDeviceAddress, mFirstAddress);
+    EXPECT_EQ(mClientPool.Allocated(), 1u);
+    EXPECT_TRUE(IsStaggeredAttemptScheduled(setup));
+
+    Platform::Delete(setup);
+}
+
+TEST_F_FROM_FIXTURE(TestOperationalSessionSetup, TestStaggeredAttemptBusyDoesNotTryNextAddress)
+{
+    OperationalSessionSetup * setup = NewConnectingSetup();
+    CASEClient * firstClient        = setup->mCASEClient;
+    StartStaggeredHandshake(setup);
+
+    setup->mStaggeredAttemptDelegate.OnResponderBusy(System::Clock::Milliseconds16(1000));
+    setup->mStaggeredAttemptDelegate.OnSessionEstablishmentError(CHIP_ERROR_BUSY, SessionEstablishmentStage::kSentSigma1);
+
+    // The other addresses reach the same busy peer: only the first handshake
+    // is left.
+    EXPECT_EQ(setup->mState, State::Connecting);
+    EXPECT_EQ(setup->mCASEClient, firstClient);
+    EXPECT_EQ(setup->mStaggeredCASEClient, nullptr);
+    EXPECT_EQ(mClientPool.Allocated(), 1u);
+    EXPECT_FALSE(IsStaggeredAttemptScheduled(setup));
+
+    Platform::Delete(setup);
+}
+
+TEST_F_FROM_FIXTURE(TestOperationalSessionSetup, TestStaggeredAttemptWithoutMoreAddresses)
+{
+    OperationalSessionSetup * setup = NewConnectingSetup();
+    CASEClient * firstClient        = setup->mCASEClient;
+
+    // The resolver has no other address for the peer.
+    OperationalSessionSetup::OnStaggeredAttemptTimer(&GetSystemLayer(), setup);
+
+    EXPECT_EQ(setup->mState, State::Connecting);
+    EXPECT_EQ(setup->mCASEClient, firstClient);
+    EXPECT_EQ(setup->mStaggeredCASEClient, nullptr);
+    EXPECT_FALSE(setup->mStartingStaggeredAttempt);
+    EXPECT_EQ(mClientPool.Allocated(), 1u);
+
+    Platform::Delete(setup);
+}
+
+TEST_F_FROM_FIXTURE(TestOperationalSessionSetup, TestCleanupCancelsStaggeredAttempt)
+{
+    OperationalSessionSetup * setup = NewConnectingSetup();
+    setup->ScheduleStaggeredAttempt();
+    EXPECT_TRUE(IsStaggeredAttemptScheduled(setup));
+
+    // Leaving the Connecting state cancels the staggered attempt timer.
+    setup->MoveToState(State::NeedsAddress);
+    EXPECT_FALSE(IsStaggeredAttemptScheduled(setup));
+    EXPECT_EQ(setup->mCASEClient, nullptr);
+    EXPECT_EQ(mClientPool.Allocated(), 0u);
+
+    // It also aborts a staggered handshake in progress.
+    setup->MoveToState(State::Connecting);
+    setup->mCASEClient = mClientPool.Allocate();
+    StartStaggeredHandshake(setup);
+    EXPECT_EQ(mClientPool.Allocated(), 2u);
+
+    setup->MoveToState(State::NeedsAddress);
+    EXPECT_EQ(setup->mCASEClient, nullptr);
+    EXPECT_EQ(setup->mStaggeredCASEClient, nullptr);
+    EXPECT_EQ(mClientPool.Allocated(), 0u);
+
+    // And so does destroying the session setup.
+    setup->MoveToState(State::Connecting);
+    setup->mCASEClient = mClientPool.Allocate();
+    StartStaggeredHandshake(setup);
+    setup->ScheduleStaggeredAttempt();
+
+    Platform::Delete(setup);
+    EXPECT_FALSE(IsStaggeredAttemptScheduled(setup));
+    EXPECT_EQ(mClientPool.Allocated(), 0u);
+}
+
+} // namespace chip
+
+#endif // CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS > 0
@@ -0,0 +1,209 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/EventManagement.h>
+#include <app/MessageDef/EventDataIB.h>
+#include <app/MessageDef/EventReportIB.h>
+#include <app/PersistentEventLog.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <pw_unit_test/framework.h>
+
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+
+struct StoredEvent
+{
+    EventNumber mEventNumber;
+    FabricIndex mFabricIndex;
+};
+
+// Encodes an event the way EventManagement stores it, with only the fields the persistent log looks at.
+CHIP_ERROR AppendEvent(PersistentEventLog & log, EventNumber eventNumber, FabricIndex fabricIndex)
+{
+    uint8_t buffer[64];
+    TLV::TLVWriter writer;
+    TLV::TLVType eventType;
+    TLV::TLVType dataType;
+    writer.Init(buffer);
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, eventType));
+    ReturnErrorOnFailure(
+        writer.StartContainer(TLV::ContextTag(EventReportIB::Tag::kEventData), TLV::kTLVType_Structure, dataType));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(EventDataIB::Tag::kEventNumber), eventNumber));
+    ReturnErrorOnFailure(writer.Put(TLV::ProfileTag(kEventManagementProfile, kFabricIndexTag), fabricIndex));
+    ReturnErrorOnFailure(writer.EndContainer(dataType));
+    ReturnErrorOnFailure(writer.EndContainer(eventType));
+    ReturnErrorOnFailure(writer.Finalize());
+
+    TLV::TLVReader reader;
+    reader.Init(buffer, writer.GetLengthWritten());
+    ReturnErrorOnFailure(reader.Next());
+    return log.Append(eventNumber, reader);
+}
+
+CHIP_ERROR CollectEvent(const TLV::TLVReader & aReader, size_t, void * apContext)
+{
+    auto * events = static_cast<std::vector<StoredEvent> *>(apContext);
+    StoredEvent event;
+    TLV::TLVReader reader;
+    TLV::TLVType eventType;
+    TLV::TLVType dataType;
+    reader.Init(aReader);
+    ReturnErrorOnFailure(reader.EnterContainer(eventType));
+    ReturnErrorOnFailure(reader.Next(TLV::ContextTag(EventReportIB::Tag::kEventData)));
+    ReturnErrorOnFailure(reader.EnterContainer(dataType));
+    ReturnErrorOnFailure(reader.Next(TLV::ContextTag(EventDataIB::Tag::kEventNumber)));
+    ReturnErrorOnFailure(reader.Get(event.mEventNumber));
+    ReturnErrorOnFailure(reader.Next(TLV::ProfileTag(kEventManagementProfile, kFabricIndexTag)));
+    ReturnErrorOnFailure(reader.Get(event.mFabricIndex));
+    events->push_back(event);
+    return CHIP_NO_ERROR;
+}
+
+std::vector<StoredEvent> CollectEvents(const PersistentEventLog & log, EventNumber eventMin)
+{
+    std::vector<StoredEvent> events;
+    EXPECT_EQ(log.Iterate(eventMin, CollectEvent, &events), CHIP_NO_ERROR);
+    return events;
+}
+
+void ExpectConsecutive(const std::vector<StoredEvent> & events, EventNumber first, EventNumber last)
+{
+    ASSERT_EQ(events.size(), static_cast<size_t>(last - first + 1));
+    for (size_t i = 0; i < events.size(); i++)
+    {
+        EXPECT_EQ(events[i].mEventNumber, first + i);
+    }
+}
+
+class TestPersistentEventLog : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestPersistentEventLog, TestAppendDropsOldestSegment)
+{
+    TestPersistentStorageDelegate storage;
+    PersistentEventLog log;
+    ASSERT_EQ(log.Init(&storage), CHIP_NO_ERROR);
+    EXPECT_TRUE(log.IsEmpty());
+    EXPECT_TRUE(CollectEvents(log, 0).empty());
+
+    // Far more events than the segments hold, so that the oldest segments are dropped.
+    constexpr EventNumber kLastEventNumber = 2 * PersistentEventLog::kSegmentCount * PersistentEventLog::kSegmentSize / 8;
+    for (EventNumber eventNumber = 1; eventNumber <= kLastEventNumber; eventNumber++)
+    {
+        ASSERT_EQ(AppendEvent(log, eventNumber, 1), CHIP_NO_ERROR);
+    }
+
+    EXPECT_FALSE(log.IsEmpty());
+    EXPECT_GT(log.GetFirstEventNumber(), 1u);
+    EXPECT_EQ(log.GetLastEventNumber(), kLastEventNumber);
+    ExpectConsecutive(CollectEvents(log, 0), log.GetFirstEventNumber(), kLastEventNumber);
+
+    // Reading from an event skips the segments that only hold older events.
+    const auto recentEvents = CollectEvents(log, kLastEventNumber - 1);
+    ASSERT_FALSE(recentEvents.empty());
+    EXPECT_LE(recentEvents.front().mEventNumber, kLastEventNumber - 1);
+    EXPECT_LT(recentEvents.size(), CollectEvents(log, 0).size());
+    ExpectConsecutive(recentEvents, recentEvents.front().mEventNumber, kLastEventNumber);
+    EXPECT_TRUE(CollectEvents(log, kLastEventNumber + 1).empty());
+
+    // Older event numbers mean the numbers were reset, and start the log over.
+    EXPECT_EQ(AppendEvent(log, 1, 1), CHIP_NO_ERROR);
+    ExpectConsecutive(CollectEvents(log, 0), 1, 1);
+}
+
+TEST_F(TestPersistentEventLog, TestEventsSurviveReinit)
+{
+    TestPersistentStorageDelegate storage;
+    {
+        PersistentEventLog log;
+        ASSERT_EQ(log.Init(&storage), CHIP_NO_ERROR);
+        for (EventNumber eventNumber = 10; eventNumber < 200; eventNumber++)
+        {
+            ASSERT_EQ(AppendEvent(log, eventNumber, 1), CHIP_NO_ERROR);
+        }
+    }
+
+    PersistentEventLog log;
+    ASSERT_EQ(log.Init(&storage), CHIP_NO_ERROR);
+    EXPECT_EQ(log.GetFirstEventNumber(), 10u);
+    EXPECT_EQ(log.GetLastEventNumber(), 199u);
+    ExpectConsecutive(CollectEvents(log, 0), 10, 199);
+
+    ASSERT_EQ(AppendEvent(log, 200, 1), CHIP_NO_ERROR);
+    ExpectConsecutive(CollectEvents(log, 0), 10, 200);
+
+    EXPECT_EQ(log.Clear(), CHIP_NO_ERROR);
+    EXPECT_TRUE(log.IsEmpty());
+    EXPECT_FALSE(storage.SyncDoesKeyExist(DefaultStorageKeyAllocator::PersistentEventLogSegment(0).KeyName()));
+}
+
+TEST_F(TestPersistentEventLog, TestCorruptIndexStartsEmptyLog)
+{
+    TestPersistentStorageDelegate storage;
+    {
+        PersistentEventLog log;
+        ASSERT_EQ(log.Init(&storage), CHIP_NO_ERROR);
+        ASSERT_EQ(AppendEvent(log, 1, 1), CHIP_NO_ERROR);
+    }
+
+    const uint8_t garbage[] = { 0x15, 0x24, 0x01, 0xff };
+    ASSERT_EQ(storage.SyncSetKeyValue(DefaultStorageKeyAllocator::PersistentEventLogIndex().KeyName(), garbage, sizeof(garbage)),
+              CHIP_NO_ERROR);
+
+    PersistentEventLog log;
+    ASSERT_EQ(log.Init(&storage), CHIP_NO_ERROR);
+    EXPECT_TRUE(log.IsEmpty());
+    EXPECT_TRUE(CollectEvents(log, 0).empty());
+    EXPECT_FALSE(storage.SyncDoesKeyExist(DefaultStorageKeyAllocator::PersistentEventLogSegment(0).KeyName()));
+}
+
+TEST_F(TestPersistentEventLog, TestFabricRemoved)
+{
+    TestPersistentStorageDelegate storage;
+    {
+        PersistentEventLog log;
+        ASSERT_EQ(log.Init(&storage), CHIP_NO_ERROR);
+        for (EventNumber eventNumber = 1; eventNumber <= 100; eventNumber++)
+        {
+            ASSERT_EQ(AppendEvent(log, eventNumber, static_cast<FabricIndex>(1 + eventNumber % 2)), CHIP_NO_ERROR);
+        }
+        EXPECT_EQ(log.FabricRemoved(1), CHIP_NO_ERROR);
+    }
+
+    PersistentEventLog log;
+    ASSERT_EQ(log.Init(&storage), CHIP_NO_ERROR);
+    const auto events = CollectEvents(log, 0);
+    ExpectConsecutive(events, 1, 100);
+    for (const auto & event : events)
+    {
+        EXPECT_EQ(event.mFabricIndex, (event.mEventNumber % 2 == 0) ? kUndefinedFabricIndex : 2);
+    }
+}
+
+} // namespace
@@ -0,0 +1,191 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/InteractionModelEngine.h>
+#include <app/PipelinedReadManager.h>
+#include <app/tests/AppTestContext.h>
+#include <app/tests/test-interaction-model-api.h>
+#include <app/util/mock/Constants.h>
+#include <app/util/mock/Functions.h>
+#include <app/util/mock/MockNodeConfig.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::Test;
+
+const MockNodeConfig & TestMockNodeConfig()
+{
+    using namespace chip::app::Clusters::Globals::Attributes;
+
+    // clang-format off
+    static const MockNodeConfig config({
+        MockEndpointConfig(kMockEndpoint2, {
+            MockClusterConfig(MockClusterId(2), {
+                ClusterRevision::Id, FeatureMap::Id, MockAttributeId(1), MockAttributeId(2),
+            }),
+            MockClusterConfig(MockClusterId(3), {
+                ClusterRevision::Id, FeatureMap::Id, MockAttributeId(1),
+            }),
+        }),
+    });
+    // clang-format on
+    return config;
+}
+
+class TestReadCallback : public ReadClient::Callback
+{
+public:
+    TestReadCallback(PipelinedReadManager & aManager) : mManager(aManager) {}
+
+    void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override
+    {
+        EXPECT_TRUE(aStatus.IsSuccess());
+        EXPECT_NE(apData, nullptr);
+        mAttributePaths.push_back(aPath);
+    }
+
+    void OnReportEnd() override { mReportEndCount++; }
+    void OnError(CHIP_ERROR aError) override { mError = aError; }
+
+    void OnDone(ReadClient *) override
+    {
+        mDoneCount++;
+        mQueuedReadsWhenDone = mManager.GetNumQueuedReads();
+    }
+
+    PipelinedReadManager & mManager;
+    std::vector<ConcreteAttributePath> mAttributePaths;
+    int mReportEndCount         = 0;
+    int mDoneCount              = 0;
+    size_t mQueuedReadsWhenDone = 0;
+    CHIP_ERROR mError           = CHIP_NO_ERROR;
+};
+
+class TestPipelinedReadManager : public AppContext
+{
+public:
+    void SetUp() override
+    {
+        AppContext::SetUp();
+        mOldProvider = InteractionModelEngine::GetInstance()->SetDataModelProvider(&TestImCustomDataModel::Instance());
+        SetMockNodeConfig(TestMockNodeConfig());
+    }
+
+    void TearDown() override
+    {
+        ResetMockNodeConfig();
+        InteractionModelEngine::GetInstance()->SetDataModelProvider(mOldProvider);
+        AppContext::TearDown();
+    }
+
+private:
+    DataModel::Provider * mOldProvider = nullptr;
+};
+
+TEST_F(TestPipelinedReadManager, TestReadsSharingReadRequests)
+{
+    // A single read in flight, of up to 3 paths, so that the reads queue and get packed together.
+    PipelinedReadManager manager(InteractionModelEngine::GetInstance(), &GetExchangeManager(), 1, 3);
+
+    const AttributePathParams clusterPath(kMockEndpoint2, MockClusterId(2));
+    const AttributePathParams attributePath(kMockEndpoint2, MockClusterId(3), MockAttributeId(1));
+    const AttributePathParams overlappingPath(kMockEndpoint2, MockClusterId(2), MockAttributeId(1));
+
+    TestReadCallback clusterRead(manager);
+    TestReadCallback attributeRead(manager);
+    TestReadCallback overlappingRead(manager);
+    TestReadCallback sameAttributeRead(manager);
+    EXPECT_EQ(manager.Read(GetSessionBobToAlice(), &clusterPath, 1, clusterRead), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.Read(GetSessionBobToAlice(), &attributePath, 1, attributeRead), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.Read(GetSessionBobToAlice(), &overlappingPath, 1, overlappingRead), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.Read(GetSessionBobToAlice(), &attributePath, 1, sameAttributeRead), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.GetNumQueuedReads(), 4u);
+    EXPECT_EQ(manager.GetNumReadRequestsInFlight(), 0u);
+
+    DrainAndServiceIO();
+
+    EXPECT_EQ(manager.GetNumQueuedReads(), 0u);
+    EXPECT_EQ(manager.GetNumReadRequestsInFlight(), 0u);
+
+    // Each read only got the attributes of its own paths.
+    // The cluster wildcard also reports the global attributes that are not in the mock metadata.
+    EXPECT_GE(clusterRead.mAttributePaths.size(), 4u);
+    size_t mockAttributeCount = 0;
+    for (const auto & path : clusterRead.mAttributePaths)
+    {
+        EXPECT_EQ(path.mClusterId, MockClusterId(2));
+        if (path.mAttributeId == MockAttributeId(1) || path.mAttributeId == MockAttributeId(2))
+        {
+            mockAttributeCount++;
+        }
+    }
+    EXPECT_EQ(mockAttributeCount, 2u);
+    ASSERT_EQ(attributeRead.mAttributePaths.size(), 1u);
+    EXPECT_EQ(attributeRead.mAttributePaths[0], ConcreteAttributePath(kMockEndpoint2, MockClusterId(3), MockAttributeId(1)));
+    ASSERT_EQ(sameAttributeRead.mAttributePaths.size(), 1u);
+    EXPECT_EQ(sameAttributeRead.mAttributePaths[0], attributeRead.mAttributePaths[0]);
+    ASSERT_EQ(overlappingRead.mAttributePaths.size(), 1u);
+    EXPECT_EQ(overlappingRead.mAttributePaths[0], ConcreteAttributePath(kMockEndpoint2, MockClusterId(2), MockAttributeId(1)));
+
+    // The overlapping read waited for the first ReadRequest, which carried the three other reads.
+    for (auto * read : { &clusterRead, &attributeRead, &sameAttributeRead, &overlappingRead })
+    {
+        EXPECT_EQ(read->mError, CHIP_NO_ERROR);
+        EXPECT_EQ(read->mReportEndCount, 1);
+        EXPECT_EQ(read->mDoneCount, 1);
+    }
+    EXPECT_EQ(clusterRead.mQueuedReadsWhenDone, 1u);
+    EXPECT_EQ(attributeRead.mQueuedReadsWhenDone, 1u);
+    EXPECT_EQ(sameAttributeRead.mQueuedReadsWhenDone, 1u);
+    EXPECT_EQ(overlappingRead.mQueuedReadsWhenDone, 0u);
+
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+TEST_F(TestPipelinedReadManager, TestCancel)
+{
+    PipelinedReadManager manager(InteractionModelEngine::GetInstance(), &GetExchangeManager(), 1, 3);
+
+    const AttributePathParams clusterPath(kMockEndpoint2, MockClusterId(2));
+    const AttributePathParams attributePath(kMockEndpoint2, MockClusterId(3), MockAttributeId(1));
+    const AttributePathParams invalidPath(kMockEndpoint2, MockClusterId(3), kInvalidAttributeId, 0);
+
+    TestReadCallback cancelledRead(manager);
+    TestReadCallback read(manager);
+    EXPECT_EQ(manager.Read(GetSessionBobToAlice(), &invalidPath, 1, read), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(manager.Read(GetSessionBobToAlice(), &clusterPath, 1, cancelledRead), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.Read(GetSessionBobToAlice(), &attributePath, 1, read), CHIP_NO_ERROR);
+    manager.Cancel(cancelledRead);
+    EXPECT_EQ(manager.GetNumQueuedReads(), 1u);
+
+    DrainAndServiceIO();
+
+    EXPECT_TRUE(cancelledRead.mAttributePaths.empty());
+    EXPECT_EQ(cancelledRead.mDoneCount, 0);
+    EXPECT_EQ(read.mAttributePaths.size(), 1u);
+    EXPECT_EQ(read.mDoneCount, 1);
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+} // namespace
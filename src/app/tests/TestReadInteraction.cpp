@@ -350,6 +350,7 @@ public:
     void TestReadChunkingInvalidSubscriptionId();
     void TestReadChunkingStatusReportTimeout();
     void TestReadClient();
+    void TestReadClientLargePayloadRequiresCapableSession();
     void TestReadClientGenerateAttributePathList();
     void TestReadClientGenerateInvalidAttributePathList();
     void TestReadClientGenerateOneEventPaths();
@@ -525,6 +526,41 @@ void TestReadInteraction::TestReadClient()
     EXPECT_EQ(readClient.ProcessReportData(std::move(buf), ReadClient::ReportType::kContinuingTransaction), CHIP_NO_ERROR);
 }
 
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestReadClientLargePayloadRequiresCapableSession)
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteractionSync, TestReadClientLargePayloadRequiresCapableSession)
+void TestReadInteraction::TestReadClientLargePayloadRequiresCapableSession()
+{
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+
+    chip::app::AttributePathParams attributePathParams[1];
+    attributePathParams[0].mEndpointId  = kTestEndpointId;
+    attributePathParams[0].mClusterId   = kTestClusterId;
+    attributePathParams[0].mAttributeId = 1;
+
+    // The loopback sessions are not over TCP, so they cannot carry large reports.
+    GetLoopback().mSentMessageCount = 0;
+    {
+        app::ReadClient readClient(engine, &GetExchangeManager(), delegate, chip::app::ReadClient::InteractionType::Read);
+        ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+        readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+        readPrepareParams.mAttributePathParamsListSize = 1;
+        readPrepareParams.mAllowLargePayload           = true;
+        EXPECT_EQ(readClient.SendRequest(readPrepareParams), CHIP_ERROR_INCORRECT_STATE);
+    }
+    {
+        app::ReadClient readClient(engine, &GetExchangeManager(), delegate, chip::app::ReadClient::InteractionType::Subscribe);
+        ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+        readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+        readPrepareParams.mAttributePathParamsListSize = 1;
+        readPrepareParams.mMinIntervalFloorSeconds     = 0;
+        readPrepareParams.mMaxIntervalCeilingSeconds   = 1;
+        readPrepareParams.mAllowLargePayload           = true;
+        EXPECT_EQ(readClient.SendRequest(readPrepareParams), CHIP_ERROR_INCORRECT_STATE);
+    }
+    EXPECT_EQ(GetLoopback().mSentMessageCount, 0u);
+}
+
 TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestReadUnexpectedSubscriptionId)
 TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteractionSync, TestReadUnexpectedSubscriptionId)
 void TestReadInteraction::TestReadUnexpectedSubscriptionId()
@@ -2223,6 +2259,12 @@ void TestReadInteraction::TestSubscribeEarlyReport()
         ASSERT_NE(engine->ActiveHandlerAt(0), nullptr);
         delegate.mpReadHandler = engine->ActiveHandlerAt(0);
 
+        // Only events of the subscribed cluster need to walk the urgent event paths of the handler.
+        EXPECT_TRUE(delegate.mpReadHandler->MayHaveUrgentEventPathFor(
+            ConcreteEventPath(kTestEventEndpointId, kTestEventClusterId, kTestEventIdCritical)));
+        EXPECT_FALSE(delegate.mpReadHandler->MayHaveUrgentEventPathFor(
+            ConcreteEventPath(kTestEventEndpointId, chip::Test::MockClusterId(2), kTestEventIdCritical)));
+
         uint16_t minInterval;
         uint16_t maxInterval;
         delegate.mpReadHandler->GetReportingIntervals(minInterval, maxInterval);
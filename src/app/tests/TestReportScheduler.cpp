@@ -18,10 +18,12 @@
 
 #include <app/InteractionModelEngine.h>
 #include <app/codegen-data-model-provider/Instance.h>
+#include <app/reporting/BudgetedReportSchedulerImpl.h>
 #include <app/reporting/ReportSchedulerImpl.h>
 #include <app/reporting/SynchronizedReportSchedulerImpl.h>
 #include <app/tests/AppTestContext.h>
 #include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/TypeTraits.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
 #include <pw_unit_test/framework.h>
@@ -58,6 +60,8 @@ public:
     void TestReportTiming();
     void TestObserverCallbacks();
     void TestSynchronizedScheduler();
+    void TestICDActiveWindowsScheduler();
+    void TestBudgetedScheduler();
 
     /// @brief Mimicks the various operations that happen on a subscription transaction after a read handler was created so that
     /// readhandlers are in the expected state for further tests.
@@ -76,6 +80,24 @@ public:
         return CHIP_NO_ERROR;
     }
 
+    /// @brief Mimicks an attribute change on the paths of a read handler.
+    static void MockAttributeChange(ReadHandler * readHandler)
+    {
+        readHandler->mDirtyGeneration++;
+        readHandler->mObserver->OnBecameReportable(readHandler);
+    }
+
+    /// @brief Mimicks the states a read handler goes through when it sends a subscription report until the report is
+    /// acknowledged, without involving the reporting engine.
+    static void MockSubscriptionReportSent(ReadHandler * readHandler)
+    {
+        readHandler->mState = ReadHandler::HandlerState::AwaitingReportResponse;
+        readHandler->mObserver->OnSubscriptionReportSent(readHandler);
+        readHandler->mPreviousReportsBeginGeneration = readHandler->mDirtyGeneration;
+        readHandler->ClearForceDirtyFlag();
+        readHandler->mState = ReadHandler::HandlerState::CanStartReporting;
+    }
+
     static ReadHandler * GetReadHandlerFromPool(ReportScheduler * scheduler, uint32_t target)
     {
         uint32_t i        = 0;
@@ -259,6 +281,11 @@ ReportSchedulerImpl sScheduler(&sTestTimerDelegate);
 
 TestTimerSynchronizedDelegate sTestTimerSynchronizedDelegate;
 SynchronizedReportSchedulerImpl syncScheduler(&sTestTimerSynchronizedDelegate);
+SynchronizedReportSchedulerImpl activeWindowsScheduler(&sTestTimerSynchronizedDelegate,
+                                                       SynchronizedReportSchedulerImpl::Mode::kICDActiveWindows);
+
+// One report per second per peer and no limit per fabric
+BudgetedReportSchedulerImpl budgetedScheduler(&sTestTimerDelegate, { 0, 1 }, { 60, 1 });
 
 TEST_F_FROM_FIXTURE(TestReportScheduler, TestReadHandlerList)
 {
@@ -807,6 +834,141 @@ TEST_F_FROM_FIXTURE(TestReportScheduler, TestSynchronizedScheduler)
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+TEST_F_FROM_FIXTURE(TestReportScheduler, TestICDActiveWindowsScheduler)
+{
+    NullReadHandlerCallback nullCallback;
+    // exchange context
+    Messaging::ExchangeContext * exchangeCtx = NewExchangeToAlice(nullptr, false);
+
+    // Read handler pool
+    ObjectPool<ReadHandler, kNumMaxReadHandlers> readHandlerPool;
+
+    // Initialize the mock system time
+    sTestTimerSynchronizedDelegate.SetMockSystemTimestamp(System::Clock::Milliseconds64(0));
+
+    ReadHandler * readHandler1 = readHandlerPool.CreateObject(nullCallback, exchangeCtx, ReadHandler::InteractionType::Subscribe,
+                                                              &activeWindowsScheduler, CodegenDataModelProviderInstance());
+    EXPECT_EQ(CHIP_NO_ERROR, MockReadHandlerSubscriptionTransaction(readHandler1, &activeWindowsScheduler, 0, 10));
+    ReadHandler * readHandler2 = readHandlerPool.CreateObject(nullCallback, exchangeCtx, ReadHandler::InteractionType::Subscribe,
+                                                              &activeWindowsScheduler, CodegenDataModelProviderInstance());
+    EXPECT_EQ(CHIP_NO_ERROR, MockReadHandlerSubscriptionTransaction(readHandler2, &activeWindowsScheduler, 0, 4));
+    ReadHandlerNode * node2 = activeWindowsScheduler.FindReadHandlerNode(readHandler2);
+
+    // Data changes are held while the ICD is in IdleMode
+    activeWindowsScheduler.OnEnterIdleMode();
+    MockAttributeChange(readHandler1);
+    EXPECT_FALSE(activeWindowsScheduler.IsReportableNow(readHandler1));
+    EXPECT_EQ(activeWindowsScheduler.mNextReportTimestamp, node2->GetMaxTimestamp());
+
+    sTestTimerSynchronizedDelegate.IncrementMockTimestamp(System::Clock::Milliseconds64(1000));
+    EXPECT_FALSE(activeWindowsScheduler.IsReportableNow(readHandler1));
+
+    // Held reports are sent in one burst when the ICD enters ActiveMode
+    activeWindowsScheduler.OnEnterActiveMode();
+    EXPECT_TRUE(activeWindowsScheduler.IsReportableNow(readHandler1));
+    EXPECT_TRUE(activeWindowsScheduler.IsReportableNow(readHandler2));
+    MockSubscriptionReportSent(readHandler1);
+    MockSubscriptionReportSent(readHandler2);
+
+    // Held reports are also sent along with a report reaching its max interval during IdleMode
+    activeWindowsScheduler.OnEnterIdleMode();
+    MockAttributeChange(readHandler1);
+    EXPECT_FALSE(activeWindowsScheduler.IsReportableNow(readHandler1));
+    sTestTimerSynchronizedDelegate.IncrementMockTimestamp(System::Clock::Milliseconds64(3999));
+    EXPECT_FALSE(activeWindowsScheduler.IsReportableNow(readHandler1));
+    EXPECT_FALSE(activeWindowsScheduler.IsReportableNow(readHandler2));
+    sTestTimerSynchronizedDelegate.IncrementMockTimestamp(System::Clock::Milliseconds64(1));
+    EXPECT_TRUE(activeWindowsScheduler.IsReportableNow(readHandler1));
+    EXPECT_TRUE(activeWindowsScheduler.IsReportableNow(readHandler2));
+    MockSubscriptionReportSent(readHandler1);
+    MockSubscriptionReportSent(readHandler2);
+
+    // Urgent reports are not held
+    readHandler1->ForceDirtyState();
+    EXPECT_TRUE(activeWindowsScheduler.IsReportableNow(readHandler1));
+    MockSubscriptionReportSent(readHandler1);
+    MockSubscriptionReportSent(readHandler2);
+
+    // A max interval expiring before the next ActiveMode is reported before the ICD goes to IdleMode
+    sTestTimerSynchronizedDelegate.IncrementMockTimestamp(System::Clock::Milliseconds64(3800));
+    activeWindowsScheduler.OnEnterActiveMode();
+    EXPECT_FALSE(activeWindowsScheduler.IsReportableNow(readHandler2));
+    activeWindowsScheduler.OnTransitionToIdle();
+    EXPECT_TRUE(activeWindowsScheduler.IsReportableNow(readHandler2));
+    EXPECT_FALSE(activeWindowsScheduler.IsReportScheduled(readHandler2));
+
+    activeWindowsScheduler.UnregisterAllHandlers();
+    readHandlerPool.ReleaseAll();
+    exchangeCtx->Close();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+TEST_F_FROM_FIXTURE(TestReportScheduler, TestBudgetedScheduler)
+{
+    using ReportClass = BudgetedReportSchedulerImpl::ReportClass;
+
+    NullReadHandlerCallback nullCallback;
+    // exchange context
+    Messaging::ExchangeContext * exchangeCtx = NewExchangeToAlice(nullptr, false);
+
+    // Read handler pool
+    ObjectPool<ReadHandler, kNumMaxReadHandlers> readHandlerPool;
+
+    // Initialize mock timestamp
+    sTestTimerDelegate.SetMockSystemTimestamp(Milliseconds64(0));
+    budgetedScheduler.ResetMetrics();
+
+    // Two subscriptions of the same peer, sharing its budget
+    ReadHandler * readHandler1 = readHandlerPool.CreateObject(nullCallback, exchangeCtx, ReadHandler::InteractionType::Subscribe,
+                                                              &budgetedScheduler, CodegenDataModelProviderInstance());
+    EXPECT_EQ(CHIP_NO_ERROR, MockReadHandlerSubscriptionTransaction(readHandler1, &budgetedScheduler, 0, 10));
+    ReadHandler * readHandler2 = readHandlerPool.CreateObject(nullCallback, exchangeCtx, ReadHandler::InteractionType::Subscribe,
+                                                              &budgetedScheduler, CodegenDataModelProviderInstance());
+    EXPECT_EQ(CHIP_NO_ERROR, MockReadHandlerSubscriptionTransaction(readHandler2, &budgetedScheduler, 0, 10));
+
+    // The first data change report goes out immediately and spends the budget of the peer
+    MockAttributeChange(readHandler1);
+    EXPECT_TRUE(budgetedScheduler.IsReportableNow(readHandler1));
+    MockSubscriptionReportSent(readHandler1);
+
+    // The second one waits for the budget to refill
+    MockAttributeChange(readHandler2);
+    EXPECT_FALSE(budgetedScheduler.IsReportableNow(readHandler2));
+    EXPECT_TRUE(budgetedScheduler.IsReportScheduled(readHandler2));
+    EXPECT_EQ(budgetedScheduler.GetMetrics().mReportsDeferred, 1u);
+
+    sTestTimerDelegate.IncrementMockTimestamp(Milliseconds64(999));
+    EXPECT_FALSE(budgetedScheduler.IsReportableNow(readHandler2));
+    sTestTimerDelegate.IncrementMockTimestamp(Milliseconds64(1));
+    EXPECT_FALSE(budgetedScheduler.IsReportScheduled(readHandler2));
+    EXPECT_TRUE(budgetedScheduler.IsReportableNow(readHandler2));
+    MockSubscriptionReportSent(readHandler2);
+
+    // Urgent reports are not held back by the empty budget
+    readHandler1->ForceDirtyState();
+    EXPECT_TRUE(budgetedScheduler.IsReportableNow(readHandler1));
+    MockSubscriptionReportSent(readHandler1);
+
+    // Neither are keep-alive reports, nor data change reports that reached the max interval
+    sTestTimerDelegate.IncrementMockTimestamp(Milliseconds64(10000));
+    EXPECT_TRUE(budgetedScheduler.IsReportableNow(readHandler2));
+    MockSubscriptionReportSent(readHandler2);
+    MockAttributeChange(readHandler1);
+    EXPECT_TRUE(budgetedScheduler.IsReportableNow(readHandler1));
+    MockSubscriptionReportSent(readHandler1);
+
+    const auto & metrics = budgetedScheduler.GetMetrics();
+    EXPECT_EQ(metrics.mReportsSent[to_underlying(ReportClass::kUrgent)], 1u);
+    EXPECT_EQ(metrics.mReportsSent[to_underlying(ReportClass::kKeepAlive)], 2u);
+    EXPECT_EQ(metrics.mReportsSent[to_underlying(ReportClass::kDataChange)], 2u);
+    EXPECT_EQ(metrics.mReportsDeferred, 1u);
+
+    budgetedScheduler.UnregisterAllHandlers();
+    readHandlerPool.ReleaseAll();
+    exchangeCtx->Close();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
@@ -91,22 +91,16 @@ public:
         chip::Test::AppContext::TearDown();
     }
 
-    template <typename... Args>
-    static bool VerifyDirtySetContent(const Args &... args);
-    static bool InsertToDirtySet(const AttributePathParams & aPath);
+    static AttributeDirtySet & GetDirtySet() { return InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet; }
+    static void InsertToDirtySet(const AttributePathParams & aPath);
+    static bool IsDirty(const ConcreteAttributePath & aPath, uint64_t aGeneration = 0);
 
     void TestBuildAndSendSingleReportData();
-    void TestMergeOverlappedAttributePath();
+    void TestDirtySetGenerations();
     void TestMergeAttributePathWhenDirtySetPoolExhausted();
 
 private:
     chip::app::DataModel::Provider * mOldProvider = nullptr;
-
-    struct ExpectedDirtySetContent : public AttributePathParams
-    {
-        ExpectedDirtySetContent(const AttributePathParams & path) : AttributePathParams(path) {}
-        bool verified = false;
-    };
 };
 
 class TestExchangeDelegate : public Messaging::ExchangeDelegate
@@ -131,49 +125,14 @@ public:
     }
 };
 
-template <typename... Args>
-bool TestReportingEngine::VerifyDirtySetContent(const Args &... args)
+void TestReportingEngine::InsertToDirtySet(const AttributePathParams & aPath)
 {
-    const int size                        = sizeof...(args);
-    ExpectedDirtySetContent content[size] = { ExpectedDirtySetContent(args)... };
-
-    if (InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
-            for (int i = 0; i < size; i++)
-            {
-                if (static_cast<AttributePathParams>(content[i]) == static_cast<AttributePathParams>(*path))
-                {
-                    content[i].verified = true;
-                    return Loop::Continue;
-                }
-            }
-            ChipLogDetail(DataManagement, "Dirty path Endpoint %x Cluster %" PRIx32 ", Attribute %" PRIx32 " is not expected",
-                          path->mEndpointId, path->mClusterId, path->mAttributeId);
-            return Loop::Break;
-        }) == Loop::Break)
-    {
-        return false;
-    }
-
-    for (int i = 0; i < size; i++)
-    {
-        if (!content[i].verified)
-        {
-            ChipLogDetail(DataManagement,
-                          "Dirty path Endpoint %x Cluster %" PRIx32 ", Attribute %" PRIx32 " is not found in the dirty set",
-                          content[i].mEndpointId, content[i].mClusterId, content[i].mAttributeId);
-            return false;
-        }
-    }
-    return true;
+    GetDirtySet().MarkDirty(aPath, InteractionModelEngine::GetInstance()->GetReportingEngine().GetDirtySetGeneration());
 }
 
-bool TestReportingEngine::InsertToDirtySet(const AttributePathParams & aPath)
+bool TestReportingEngine::IsDirty(const ConcreteAttributePath & aPath, uint64_t aGeneration)
 {
-    auto path = InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject();
-    VerifyOrReturnError(path != nullptr, false);
-    *path             = aPath;
-    path->mGeneration = InteractionModelEngine::GetInstance()->GetReportingEngine().GetDirtySetGeneration();
-    return true;
+    return GetDirtySet().IsDirtySince(aPath, aGeneration);
 }
 
 TEST_F_FROM_FIXTURE(TestReportingEngine, TestBuildAndSendSingleReportData)
@@ -218,58 +177,56 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestBuildAndSendSingleReportData)
     DrainAndServiceIO();
 }
 
-TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeOverlappedAttributePath)
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestDirtySetGenerations)
 {
     EXPECT_EQ(InteractionModelEngine::GetInstance()->Init(&GetExchangeManager(), &GetFabricTable(),
                                                           app::reporting::GetDefaultReportScheduler()),
               CHIP_NO_ERROR);
 
-    AttributePathParams * clusterInfo = InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject();
-    clusterInfo->mEndpointId          = 1;
-    clusterInfo->mClusterId           = 1;
-    clusterInfo->mAttributeId         = 1;
-
-    {
-        AttributePathParams testClusterInfo;
-        testClusterInfo.mEndpointId  = 1;
-        testClusterInfo.mClusterId   = 1;
-        testClusterInfo.mAttributeId = 3;
-        EXPECT_FALSE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-    }
-    {
-        AttributePathParams testClusterInfo;
-        testClusterInfo.mEndpointId  = 1;
-        testClusterInfo.mClusterId   = 1;
-        testClusterInfo.mAttributeId = 1;
-        testClusterInfo.mListIndex   = 2;
-        EXPECT_TRUE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-    }
-
-    {
-        AttributePathParams testClusterInfo;
-        testClusterInfo.mEndpointId  = 1;
-        testClusterInfo.mClusterId   = 1;
-        testClusterInfo.mAttributeId = kInvalidAttributeId;
-        EXPECT_TRUE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-    }
-
-    {
-        AttributePathParams testClusterInfo;
-        testClusterInfo.mClusterId   = kInvalidClusterId;
-        testClusterInfo.mAttributeId = kInvalidAttributeId;
-        EXPECT_TRUE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-        EXPECT_TRUE(clusterInfo->mClusterId == kInvalidClusterId && clusterInfo->mAttributeId == kInvalidAttributeId);
-    }
+    Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    GetDirtySet().Clear();
+
+    engine.BumpDirtySetGeneration();
+    const uint64_t firstGeneration = engine.GetDirtySetGeneration();
+    InsertToDirtySet(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId1));
+
+    EXPECT_TRUE(IsDirty(ConcreteAttributePath(kTestEndpointId, kTestClusterId, kTestFieldId1)));
+    EXPECT_FALSE(IsDirty(ConcreteAttributePath(kTestEndpointId, kTestClusterId, kTestFieldId2)));
+    EXPECT_FALSE(IsDirty(ConcreteAttributePath(kTestEndpointId, kTestClusterId + 1, kTestFieldId1)));
+    EXPECT_FALSE(IsDirty(ConcreteAttributePath(kTestEndpointId + 1, kTestClusterId, kTestFieldId1)));
+    // A path is not dirty for a read handler that started its report at or after the generation it was marked at.
+    EXPECT_FALSE(IsDirty(ConcreteAttributePath(kTestEndpointId, kTestClusterId, kTestFieldId1), firstGeneration));
+
+    // A later change to another attribute of the cluster does not make the first attribute dirty again.
+    engine.BumpDirtySetGeneration();
+    const uint64_t secondGeneration = engine.GetDirtySetGeneration();
+    InsertToDirtySet(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId2));
+    EXPECT_EQ(engine.GetGlobalDirtySetSize(), 1u);
+    EXPECT_FALSE(IsDirty(ConcreteAttributePath(kTestEndpointId, kTestClusterId, kTestFieldId1), firstGeneration));
+    EXPECT_TRUE(IsDirty(ConcreteAttributePath(kTestEndpointId, kTestClusterId, kTestFieldId2), firstGeneration));
+    EXPECT_FALSE(IsDirty(ConcreteAttributePath(kTestEndpointId, kTestClusterId, kTestFieldId2), secondGeneration));
+
+    // Marking the first attribute again makes it dirty at the new generation.
+    engine.BumpDirtySetGeneration();
+    InsertToDirtySet(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId1));
+    EXPECT_TRUE(IsDirty(ConcreteAttributePath(kTestEndpointId, kTestClusterId, kTestFieldId1), secondGeneration));
+
+    // Wildcard paths mark every attribute they cover.
+    GetDirtySet().Clear();
+    EXPECT_EQ(engine.GetGlobalDirtySetSize(), 0u);
+    InsertToDirtySet(AttributePathParams(kTestEndpointId, kTestClusterId));
+    EXPECT_TRUE(IsDirty(ConcreteAttributePath(kTestEndpointId, kTestClusterId, kTestFieldId2)));
+    EXPECT_FALSE(IsDirty(ConcreteAttributePath(kTestEndpointId, kTestClusterId + 1, kTestFieldId2)));
+
+    AttributePathParams wildcardClusterPath;
+    wildcardClusterPath.mEndpointId = kTestEndpointId + 1;
+    InsertToDirtySet(wildcardClusterPath);
+    EXPECT_TRUE(IsDirty(ConcreteAttributePath(kTestEndpointId + 1, kTestClusterId + 1, kTestFieldId2)));
+    EXPECT_FALSE(IsDirty(ConcreteAttributePath(kTestEndpointId + 2, kTestClusterId + 1, kTestFieldId2)));
+
+    InsertToDirtySet(AttributePathParams());
+    EXPECT_TRUE(IsDirty(ConcreteAttributePath(kTestEndpointId + 2, kTestClusterId + 1, kTestFieldId2)));
 
-    {
-        AttributePathParams testClusterInfo;
-        testClusterInfo.mEndpointId  = kInvalidEndpointId;
-        testClusterInfo.mClusterId   = kInvalidClusterId;
-        testClusterInfo.mAttributeId = kInvalidAttributeId;
-        EXPECT_TRUE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-        EXPECT_TRUE(clusterInfo->mEndpointId == kInvalidEndpointId && clusterInfo->mClusterId == kInvalidClusterId &&
-                    clusterInfo->mAttributeId == kInvalidAttributeId);
-    }
     InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
 }
 
@@ -279,74 +236,73 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeAttributePathWhenDirtySetPoolE
                                                           app::reporting::GetDefaultReportScheduler()),
               CHIP_NO_ERROR);
 
-    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ReleaseAll();
-    InteractionModelEngine::GetInstance()->GetReportingEngine().BumpDirtySetGeneration();
+    Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    GetDirtySet().Clear();
+    engine.BumpDirtySetGeneration();
 
     // Case 1: All dirty paths including the new one are under the same cluster.
-    // -> Expected behavior: The dirty set is replaced by a wildcard attribute path under the same cluster.
-    for (AttributeId i = 1; i <= CHIP_IM_SERVER_MAX_NUM_DIRTY_SET; i++)
+    // -> Expected behavior: The paths share a single entry, and nothing else is dirty.
+    for (AttributeId i = 1; i <= CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1; i++)
     {
-        EXPECT_TRUE(InsertToDirtySet(AttributePathParams(kTestEndpointId, kTestClusterId, i)));
+        InsertToDirtySet(AttributePathParams(kTestEndpointId, kTestClusterId, i));
     }
-    EXPECT_EQ(CHIP_NO_ERROR,
-              InteractionModelEngine::GetInstance()->GetReportingEngine().InsertPathIntoDirtySet(
-                  AttributePathParams(kTestEndpointId, kTestClusterId, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1)));
-    EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(kTestEndpointId, kTestClusterId)));
+    EXPECT_EQ(engine.GetGlobalDirtySetSize(), 1u);
+    EXPECT_TRUE(IsDirty(ConcreteAttributePath(kTestEndpointId, kTestClusterId, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1)));
+    EXPECT_FALSE(IsDirty(ConcreteAttributePath(kTestEndpointId, kTestClusterId + 1, 1)));
 
-    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ReleaseAll();
+    GetDirtySet().Clear();
 
     // Case 2: All dirty paths including the new one are under the same endpoint.
-    // -> Expected behavior: The dirty set is replaced by a wildcard cluster path under the same endpoint.
-    for (ClusterId i = 1; i <= CHIP_IM_SERVER_MAX_NUM_DIRTY_SET; i++)
+    // -> Expected behavior: The existing paths are merged into one single wildcard cluster path. New path is inserted as-is.
+    for (ClusterId i = 1; i <= CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1; i++)
     {
-        EXPECT_TRUE(InsertToDirtySet(AttributePathParams(kTestEndpointId, i, 1)));
+        InsertToDirtySet(AttributePathParams(kTestEndpointId, i, 1));
     }
-    EXPECT_EQ(CHIP_NO_ERROR,
-              InteractionModelEngine::GetInstance()->GetReportingEngine().InsertPathIntoDirtySet(
-                  AttributePathParams(kTestEndpointId, ClusterId(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1), 1)));
-    EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(kTestEndpointId, kInvalidClusterId)));
+    EXPECT_EQ(engine.GetGlobalDirtySetSize(), 2u);
+    EXPECT_TRUE(IsDirty(ConcreteAttributePath(kTestEndpointId, 1, 1)));
+    EXPECT_TRUE(IsDirty(ConcreteAttributePath(kTestEndpointId, ClusterId(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1), 1)));
+    EXPECT_FALSE(IsDirty(ConcreteAttributePath(kTestEndpointId + 1, 1, 1)));
 
-    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ReleaseAll();
+    GetDirtySet().Clear();
 
     // Case 3: All dirty paths including the new one are under the different endpoints.
     // -> Expected behavior: The dirty set is replaced by a wildcard endpoint.
-    for (EndpointId i = 1; i <= CHIP_IM_SERVER_MAX_NUM_DIRTY_SET; i++)
+    for (EndpointId i = 1; i <= CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1; i++)
     {
-        EXPECT_TRUE(InsertToDirtySet(AttributePathParams(EndpointId(i), i, i)));
+        InsertToDirtySet(AttributePathParams(i, i, i));
     }
-    EXPECT_EQ(CHIP_NO_ERROR,
-              InteractionModelEngine::GetInstance()->GetReportingEngine().InsertPathIntoDirtySet(
-                  AttributePathParams(EndpointId(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1), 1, 1)));
-    EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams()));
+    EXPECT_EQ(engine.GetGlobalDirtySetSize(), 1u);
+    EXPECT_TRUE(IsDirty(ConcreteAttributePath(EndpointId(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 2), 1, 1)));
 
-    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ReleaseAll();
+    GetDirtySet().Clear();
 
-    // Case 4: All existing dirty paths are under the same cluster, the new path comes from another cluster.
-    // -> Expected behavior: The existing paths are merged into one single wildcard attribute path. New path is inserted
-    // as-is.
-    for (EndpointId i = 1; i <= CHIP_IM_SERVER_MAX_NUM_DIRTY_SET; i++)
+    // Case 4: All existing dirty paths are under the same endpoint, the new path comes from another endpoint.
+    // -> Expected behavior: The existing paths are merged into one single wildcard cluster path. New path is inserted as-is.
+    for (ClusterId i = 1; i <= CHIP_IM_SERVER_MAX_NUM_DIRTY_SET; i++)
     {
-        EXPECT_TRUE(InsertToDirtySet(AttributePathParams(kTestEndpointId, kTestClusterId, i)));
+        InsertToDirtySet(AttributePathParams(kTestEndpointId, i, 1));
     }
-    EXPECT_EQ(CHIP_NO_ERROR,
-              InteractionModelEngine::GetInstance()->GetReportingEngine().InsertPathIntoDirtySet(
-                  AttributePathParams(kTestEndpointId + 1, kTestClusterId + 1, 1)));
-    EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(kTestEndpointId, kTestClusterId),
-                                      AttributePathParams(kTestEndpointId + 1, kTestClusterId + 1, 1)));
-
-    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ReleaseAll();
-
-    // Case 5: All existing dirty paths are under the same endpoint, the new path comes from another endpoint.
-    // -> Expected behavior: The existing paths are merged into one single wildcard cluster path. New path is inserted as-is.
-    for (EndpointId i = 1; i <= CHIP_IM_SERVER_MAX_NUM_DIRTY_SET; i++)
+    InsertToDirtySet(AttributePathParams(kTestEndpointId + 1, kTestClusterId + 1, 1));
+    EXPECT_EQ(engine.GetGlobalDirtySetSize(), 2u);
+    EXPECT_TRUE(IsDirty(ConcreteAttributePath(kTestEndpointId, ClusterId(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1), 1)));
+    EXPECT_TRUE(IsDirty(ConcreteAttributePath(kTestEndpointId + 1, kTestClusterId + 1, 1)));
+    EXPECT_FALSE(IsDirty(ConcreteAttributePath(kTestEndpointId + 1, kTestClusterId + 1, 2)));
+    EXPECT_FALSE(IsDirty(ConcreteAttributePath(kTestEndpointId + 1, kTestClusterId, 1)));
+
+    // Case 5: Merged entries keep the generations of their paths.
+    GetDirtySet().Clear();
+    const uint64_t firstGeneration = engine.GetDirtySetGeneration();
+    for (ClusterId i = 1; i <= CHIP_IM_SERVER_MAX_NUM_DIRTY_SET; i++)
     {
-        EXPECT_TRUE(InsertToDirtySet(AttributePathParams(kTestEndpointId, i, 1)));
+        InsertToDirtySet(AttributePathParams(kTestEndpointId, i, 1));
     }
-    EXPECT_EQ(CHIP_NO_ERROR,
-              InteractionModelEngine::GetInstance()->GetReportingEngine().InsertPathIntoDirtySet(
-                  AttributePathParams(kTestEndpointId + 1, kTestClusterId + 1, 1)));
-    EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(kTestEndpointId, kInvalidClusterId),
-                                      AttributePathParams(kTestEndpointId + 1, kTestClusterId + 1, 1)));
+    engine.BumpDirtySetGeneration();
+    InsertToDirtySet(AttributePathParams(kTestEndpointId, ClusterId(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1), 2));
+    EXPECT_EQ(engine.GetGlobalDirtySetSize(), 2u);
+    EXPECT_TRUE(IsDirty(ConcreteAttributePath(kTestEndpointId, 1, 1)));
+    EXPECT_FALSE(IsDirty(ConcreteAttributePath(kTestEndpointId, 1, 1), firstGeneration));
+    EXPECT_TRUE(
+        IsDirty(ConcreteAttributePath(kTestEndpointId, ClusterId(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1), 2), firstGeneration));
 
     InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
 }
@@ -0,0 +1,120 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/InteractionModelEngine.h>
+#include <app/ReadClient.h>
+#include <app/ResubscriptionCoordinator.h>
+#include <app/tests/AppTestContext.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <limits>
+
+namespace {
+
+class NoopReadCallback : public chip::app::ReadClient::Callback
+{
+public:
+    void OnDone(chip::app::ReadClient *) override {}
+};
+
+} // namespace
+
+namespace chip {
+namespace app {
+
+class TestResubscriptionCoordinator : public chip::Test::AppContext
+{
+public:
+    void TearDown() override
+    {
+        InteractionModelEngine::GetInstance()->SetResubscriptionCoordinator(nullptr);
+        AppContext::TearDown();
+    }
+
+protected:
+    static bool Acquire(ResubscriptionCoordinator & aCoordinator, ReadClient & aClient) { return aCoordinator.Acquire(aClient); }
+    static void Release(ResubscriptionCoordinator & aCoordinator, ReadClient & aClient) { aCoordinator.Release(aClient); }
+};
+
+TEST_F(TestResubscriptionCoordinator, TestJitter)
+{
+    ResubscriptionCoordinator noJitter(1, 0);
+    EXPECT_EQ(noJitter.AddJitter(0), 0u);
+    EXPECT_EQ(noJitter.AddJitter(1000), 1000u);
+
+    ResubscriptionCoordinator coordinator(1, 100);
+    for (int i = 0; i < 100; i++)
+    {
+        uint32_t delayMs = coordinator.AddJitter(1000);
+        EXPECT_GE(delayMs, 1000u);
+        EXPECT_LE(delayMs, 1100u);
+    }
+    EXPECT_EQ(coordinator.AddJitter(std::numeric_limits<uint32_t>::max()), std::numeric_limits<uint32_t>::max());
+}
+
+TEST_F(TestResubscriptionCoordinator, TestSlots)
+{
+    ResubscriptionCoordinator coordinator(1, 0);
+    InteractionModelEngine::GetInstance()->SetResubscriptionCoordinator(&coordinator);
+
+    NoopReadCallback callback;
+    ReadClient first(InteractionModelEngine::GetInstance(), &GetExchangeManager(), callback,
+                     ReadClient::InteractionType::Subscribe);
+    ReadClient withoutSession(InteractionModelEngine::GetInstance(), &GetExchangeManager(), callback,
+                              ReadClient::InteractionType::Subscribe);
+    ReadClient withSession(InteractionModelEngine::GetInstance(), &GetExchangeManager(), callback,
+                           ReadClient::InteractionType::Subscribe);
+
+    // Far enough in the future not to fire during the test, only to give the client a session.
+    EXPECT_EQ(withSession.ScheduleResubscription(3600 * 1000, MakeOptional(GetSessionBobToAlice()), false), CHIP_NO_ERROR);
+
+    EXPECT_TRUE(Acquire(coordinator, first));
+    EXPECT_TRUE(Acquire(coordinator, first));
+    EXPECT_EQ(coordinator.GetNumInProgress(), 1u);
+
+    EXPECT_FALSE(Acquire(coordinator, withoutSession));
+    EXPECT_FALSE(Acquire(coordinator, withSession));
+    EXPECT_FALSE(Acquire(coordinator, withoutSession));
+    EXPECT_EQ(coordinator.GetNumWaiting(), 2u);
+
+    // The client whose session is still active goes first, ahead of the one that started waiting before it.
+    Release(coordinator, first);
+    EXPECT_EQ(coordinator.GetNumInProgress(), 1u);
+    EXPECT_EQ(coordinator.GetNumWaiting(), 1u);
+    EXPECT_TRUE(Acquire(coordinator, withSession));
+    EXPECT_FALSE(Acquire(coordinator, withoutSession));
+
+    // Giving up a place in the queue does not take a slot.
+    EXPECT_FALSE(Acquire(coordinator, first));
+    EXPECT_EQ(coordinator.GetNumWaiting(), 2u);
+    Release(coordinator, first);
+    EXPECT_EQ(coordinator.GetNumWaiting(), 1u);
+    EXPECT_EQ(coordinator.GetNumInProgress(), 1u);
+
+    Release(coordinator, withSession);
+    EXPECT_EQ(coordinator.GetNumWaiting(), 0u);
+    EXPECT_EQ(coordinator.GetNumInProgress(), 1u);
+    EXPECT_TRUE(Acquire(coordinator, withoutSession));
+
+    Release(coordinator, withoutSession);
+    EXPECT_EQ(coordinator.GetNumInProgress(), 0u);
+}
+
+} // namespace app
+} // namespace chip
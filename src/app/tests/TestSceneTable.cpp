@@ -2363,4 +2363,51 @@ TEST_F(TestSceneTable, TestOTAChanges)
     EXPECT_EQ(1, fabric_capacity);
 }
 
+TEST_F(TestSceneTable, TestSceneCache)
+{
+    SceneTable * sceneTable = scenes::GetSceneTableImpl(kTestEndpoint1, defaultTestTableSize);
+    ASSERT_NE(nullptr, sceneTable);
+
+    // Reset test
+    ResetSceneTable(sceneTable);
+
+    SceneTableEntry scene;
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable->SetSceneTableEntry(kFabric1, scene1));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable->SetSceneTableEntry(kFabric1, scene2));
+
+#if CHIP_CONFIG_SCENES_TABLE_INDEX_SIZE > 0 && CHIP_CONFIG_SCENES_TABLE_CACHED_SCENES > 0
+    // Scenes found in the cache are not read back from storage
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable->GetSceneTableEntry(kFabric1, sceneId2, scene));
+    for (const std::string & key : mpTestStorage->GetKeys())
+    {
+        mpTestStorage->AddPoisonKey(key);
+    }
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable->GetSceneTableEntry(kFabric1, sceneId2, scene));
+    EXPECT_EQ(scene, scene2);
+    mpTestStorage->ClearPoisonKeys();
+#endif
+
+    // A table sharing the storage drops the cache of the others when changing the storage
+    TestSceneTableImpl otherSceneTable;
+    EXPECT_EQ(CHIP_NO_ERROR, otherSceneTable.Init(mpTestStorage));
+    otherSceneTable.SetEndpoint(kTestEndpoint1);
+    EXPECT_EQ(CHIP_NO_ERROR, otherSceneTable.SetSceneTableEntry(kFabric1, scene10));
+    EXPECT_EQ(CHIP_NO_ERROR, otherSceneTable.RemoveSceneTableEntry(kFabric1, scene2.mStorageId));
+    otherSceneTable.Finish();
+
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable->GetSceneTableEntry(kFabric1, sceneId1, scene));
+    EXPECT_EQ(scene, scene10);
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable->GetSceneTableEntry(kFabric1, sceneId2, scene));
+
+    // Failing writes leave the cache matching the storage
+    mpTestStorage->SetRejectWrites(true);
+    EXPECT_NE(CHIP_NO_ERROR, sceneTable->SetSceneTableEntry(kFabric1, scene3));
+    mpTestStorage->SetRejectWrites(false);
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable->GetSceneTableEntry(kFabric1, sceneId3, scene));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable->GetSceneTableEntry(kFabric1, sceneId1, scene));
+    EXPECT_EQ(scene, scene10);
+
+    ResetSceneTable(sceneTable);
+}
+
 } // namespace TestScenes
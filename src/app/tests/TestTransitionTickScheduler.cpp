@@ -0,0 +1,208 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/util/TransitionTickScheduler.h>
+#include <lib/support/CHIPMem.h>
+#include <system/SystemLayerImpl.h>
+
+#include <pw_unit_test/framework.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::System::Clock::Literals;
+
+class TestTransitionTickScheduler : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+        ASSERT_EQ(sLayer.Init(), CHIP_NO_ERROR);
+    }
+
+    static void TearDownTestSuite()
+    {
+        sLayer.Shutdown();
+        Platform::MemoryShutdown();
+    }
+
+    void SetUp() override
+    {
+        mSavedClock = &System::SystemClock();
+        System::Clock::Internal::SetSystemClockForTesting(&mMockClock);
+        mMockClock.SetMonotonic(1000_ms);
+    }
+
+    void TearDown() override { System::Clock::Internal::SetSystemClockForTesting(mSavedClock); }
+
+    void AdvanceTo(System::Clock::Milliseconds64 time)
+    {
+        mMockClock.SetMonotonic(time);
+        // Keeps the select from waiting when no tick is scheduled
+        EXPECT_EQ(sLayer.StartTimer(System::Clock::kZero, [](System::Layer *, void *) {}, nullptr), CHIP_NO_ERROR);
+        sLayer.PrepareEvents();
+        sLayer.WaitForEvents();
+        sLayer.HandleEvents();
+    }
+
+    static System::LayerImpl sLayer;
+
+    System::Clock::Internal::MockClock mMockClock;
+    System::Clock::ClockBase * mSavedClock = nullptr;
+};
+
+System::LayerImpl TestTransitionTickScheduler::sLayer;
+
+struct Transition
+{
+    TransitionTickScheduler * scheduler = nullptr;
+    TransitionTickScheduler::Tick tick;
+    System::Clock::Milliseconds32 period      = 100_ms;
+    System::Clock::Milliseconds32 granularity = System::Clock::kZero;
+    uint8_t stepsRemaining                    = 0;
+    System::Clock::Timestamp lastStepTime;
+    Transition * cancelOnStep = nullptr;
+
+    static void Step(void * context)
+    {
+        auto transition          = static_cast<Transition *>(context);
+        transition->lastStepTime = transition->scheduler->Now();
+        if (transition->cancelOnStep != nullptr)
+        {
+            transition->scheduler->Cancel(transition->cancelOnStep->tick);
+        }
+        if (transition->stepsRemaining > 0 && --transition->stepsRemaining > 0)
+        {
+            transition->Start();
+        }
+    }
+
+    void Start() { EXPECT_EQ(scheduler->Schedule(tick, Step, this, period, granularity), CHIP_NO_ERROR); }
+};
+
+TEST_F(TestTransitionTickScheduler, TestAlignedTicksRunTogether)
+{
+    TransitionTickScheduler scheduler(sLayer);
+    Transition transitions[3];
+
+    // Started at different times, the transitions all step on the 100ms grid
+    for (size_t i = 0; i < 3; i++)
+    {
+        mMockClock.SetMonotonic(System::Clock::Milliseconds64(1000 + 20 * i));
+        transitions[i].scheduler      = &scheduler;
+        transitions[i].granularity    = 100_ms;
+        transitions[i].stepsRemaining = 3;
+        transitions[i].Start();
+    }
+
+    AdvanceTo(1099_ms);
+    for (auto & transition : transitions)
+    {
+        EXPECT_EQ(transition.stepsRemaining, 3u);
+    }
+
+    AdvanceTo(1100_ms);
+    for (auto & transition : transitions)
+    {
+        EXPECT_EQ(transition.stepsRemaining, 2u);
+        EXPECT_EQ(transition.lastStepTime, System::Clock::Timestamp(1100));
+        EXPECT_TRUE(transition.tick.IsScheduled());
+    }
+
+    // A late run does not delay the next steps
+    AdvanceTo(1230_ms);
+    AdvanceTo(1300_ms);
+    for (auto & transition : transitions)
+    {
+        EXPECT_EQ(transition.stepsRemaining, 0u);
+        EXPECT_EQ(transition.lastStepTime, System::Clock::Timestamp(1300));
+        EXPECT_FALSE(transition.tick.IsScheduled());
+    }
+}
+
+TEST_F(TestTransitionTickScheduler, TestUnalignedTicksKeepTheirPeriod)
+{
+    TransitionTickScheduler scheduler(sLayer);
+    Transition fast;
+    Transition slow;
+
+    fast.scheduler      = &scheduler;
+    fast.period         = 30_ms;
+    fast.stepsRemaining = 4;
+    slow.scheduler      = &scheduler;
+    slow.period         = 70_ms;
+    slow.stepsRemaining = 2;
+    fast.Start();
+    slow.Start();
+
+    AdvanceTo(1030_ms);
+    EXPECT_EQ(fast.stepsRemaining, 3u);
+    EXPECT_EQ(slow.stepsRemaining, 2u);
+
+    AdvanceTo(1075_ms);
+    EXPECT_EQ(fast.stepsRemaining, 2u);
+    EXPECT_EQ(fast.lastStepTime, System::Clock::Timestamp(1060));
+    EXPECT_EQ(slow.stepsRemaining, 1u);
+    EXPECT_EQ(slow.lastStepTime, System::Clock::Timestamp(1070));
+
+    // Running late, the fast transition steps once per run rather than catching up in a burst
+    AdvanceTo(1140_ms);
+    EXPECT_EQ(fast.stepsRemaining, 1u);
+    EXPECT_EQ(fast.lastStepTime, System::Clock::Timestamp(1090));
+    EXPECT_EQ(slow.stepsRemaining, 0u);
+    EXPECT_EQ(slow.lastStepTime, System::Clock::Timestamp(1140));
+
+    AdvanceTo(1140_ms);
+    EXPECT_EQ(fast.stepsRemaining, 0u);
+    EXPECT_EQ(fast.lastStepTime, System::Clock::Timestamp(1140));
+}
+
+TEST_F(TestTransitionTickScheduler, TestCancel)
+{
+    TransitionTickScheduler scheduler(sLayer);
+    Transition first;
+    Transition second;
+    Transition third;
+
+    for (auto transition : { &first, &second, &third })
+    {
+        transition->scheduler      = &scheduler;
+        transition->stepsRemaining = 2;
+        transition->Start();
+    }
+
+    // Cancelled before it is due, and while the other ticks due at the same time run
+    scheduler.Cancel(second.tick);
+    first.cancelOnStep = &third;
+
+    AdvanceTo(1100_ms);
+    EXPECT_EQ(first.stepsRemaining, 1u);
+    EXPECT_EQ(second.stepsRemaining, 2u);
+    EXPECT_EQ(third.stepsRemaining, 2u);
+    EXPECT_FALSE(second.tick.IsScheduled());
+    EXPECT_FALSE(third.tick.IsScheduled());
+
+    first.cancelOnStep = nullptr;
+    scheduler.Cancel(first.tick);
+    AdvanceTo(1200_ms);
+    EXPECT_EQ(first.stepsRemaining, 1u);
+}
+
+} // namespace
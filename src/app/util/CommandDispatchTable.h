@@ -0,0 +1,102 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/CommandHandler.h>
+#include <app/ConcreteCommandPath.h>
+#include <app/data-model/Decode.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/TLVReader.h>
+#include <lib/support/Span.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+namespace chip {
+namespace app {
+
+/**
+ * Building blocks of the table driven command dispatch generated in IMClusterCommandHandler.cpp when
+ * CHIP_CONFIG_COMMAND_DISPATCH_TABLE is enabled.
+ *
+ * Instead of a switch over the cluster id calling a switch over the command id of each cluster, with the decoding of every
+ * command inlined, the generated code is a table of clusters, sorted by id, pointing to the table of their commands, sorted
+ * by id, each command having a thunk that decodes its payload and calls its ember callback. A command is then found with
+ * two binary searches, and the status handling is shared by all the commands.
+ */
+
+/// Decodes the payload of a command and calls its callback. Returns the decoding error, wasHandled being set to the
+/// result of the callback if the payload could be decoded.
+using CommandDispatchFunction = CHIP_ERROR (*)(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath,
+                                               TLV::TLVReader & aDataTlv, bool & wasHandled);
+
+struct CommandDispatchEntry
+{
+    CommandId id;
+    CommandDispatchFunction dispatch;
+};
+
+struct ClusterDispatchEntry
+{
+    ClusterId id;
+    Span<const CommandDispatchEntry> commands;
+};
+
+template <typename DecodableType, bool (*Callback)(CommandHandler *, const ConcreteCommandPath &, const DecodableType &)>
+CHIP_ERROR DecodeAndDispatchCommand(CommandHandler * apCommandObj, const ConcreteCommandPath & aCommandPath,
+                                    TLV::TLVReader & aDataTlv, bool & wasHandled)
+{
+    DecodableType commandData;
+    ReturnErrorOnFailure(DataModel::Decode(aDataTlv, commandData));
+    wasHandled = Callback(apCommandObj, aCommandPath, commandData);
+    return CHIP_NO_ERROR;
+}
+
+/// Sorts the entries of a dispatch table by id at compile time, so that the generated tables can list the clusters and
+/// commands in any order.
+template <typename Entry, size_t N>
+constexpr std::array<Entry, N> SortedById(const Entry (&entries)[N])
+{
+    std::array<Entry, N> sorted{};
+    for (size_t i = 0; i < N; i++)
+    {
+        // Insertion sort: the tables are small, and mostly sorted already.
+        size_t position = i;
+        while (position > 0 && entries[i].id < sorted[position - 1].id)
+        {
+            sorted[position] = sorted[position - 1];
+            position--;
+        }
+        sorted[position] = entries[i];
+    }
+    return sorted;
+}
+
+/// Finds the entry of the given id in a table sorted by SortedById. Returns nullptr if there is none.
+template <typename Entry, typename Id>
+const Entry * FindById(Span<const Entry> table, Id id)
+{
+    const Entry * entry = std::lower_bound(table.begin(), table.end(), id, [](const Entry & e, Id value) { return e.id < value; });
+    return (entry != table.end() && entry->id == id) ? entry : nullptr;
+}
+
+} // namespace app
+} // namespace chip
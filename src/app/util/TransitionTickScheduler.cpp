@@ -0,0 +1,159 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/util/TransitionTickScheduler.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
+
+namespace chip {
+namespace app {
+
+using namespace System::Clock;
+
+TransitionTickScheduler::~TransitionTickScheduler()
+{
+    while (!mTicks.Empty())
+    {
+        mTicks.Remove(&(*mTicks.begin()));
+    }
+}
+
+TransitionTickScheduler & TransitionTickScheduler::Instance()
+{
+    static TransitionTickScheduler sInstance;
+    return sInstance;
+}
+
+CHIP_ERROR TransitionTickScheduler::Schedule(Tick & tick, Tick::Callback callback, void * context, Milliseconds32 delay,
+                                             Milliseconds32 granularity)
+{
+    VerifyOrReturnError(callback != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    tick.Unlink();
+
+    const Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    Timestamp dueTime   = Now() + delay;
+    if (delay > kZero && granularity > kZero)
+    {
+        const Timestamp::rep remainder = dueTime.count() % granularity.count();
+        dueTime -= Timestamp(remainder);
+        if (2 * remainder >= granularity.count() || dueTime <= now)
+        {
+            dueTime += granularity;
+        }
+    }
+
+    // A transition running late steps once per run rather than catching up in a burst
+    tick.mCallback = callback;
+    tick.mContext  = context;
+    tick.mDueTime  = (dueTime < now) ? now : dueTime;
+
+    // Ticks are mostly rescheduled after the others, look for their position from the end
+    auto position = mTicks.end();
+    while (position != mTicks.begin())
+    {
+        auto previous = position;
+        --previous;
+        if (previous->mDueTime <= tick.mDueTime)
+        {
+            break;
+        }
+        position = previous;
+    }
+    mTicks.InsertBefore(position, &tick);
+
+    // The timer is already armed for an earlier tick otherwise
+    VerifyOrReturnError(&(*mTicks.begin()) == &tick, CHIP_NO_ERROR);
+    return ArmTimer();
+}
+
+void TransitionTickScheduler::Cancel(Tick & tick)
+{
+    tick.Unlink();
+
+    if (mTicks.Empty() && !mRunning)
+    {
+        GetSystemLayer().CancelTimer(HandleTimer, this);
+    }
+}
+
+Timestamp TransitionTickScheduler::Now() const
+{
+    return mRunning ? mRunningDueTime : System::SystemClock().GetMonotonicTimestamp();
+}
+
+void TransitionTickScheduler::HandleTimer(System::Layer * layer, void * context)
+{
+    static_cast<TransitionTickScheduler *>(context)->RunDueTicks();
+}
+
+void TransitionTickScheduler::RunDueTicks()
+{
+    const Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+
+    // Take the due ticks out first: a callback reschedules its own tick, and may schedule or cancel the tick of other transitions.
+    IntrusiveList<Tick, IntrusiveMode::AutoUnlink> dueTicks;
+    while (!mTicks.Empty() && mTicks.begin()->mDueTime <= now)
+    {
+        Tick & tick = *mTicks.begin();
+        mTicks.Remove(&tick);
+        dueTicks.PushBack(&tick);
+    }
+
+    mRunning = true;
+    while (!dueTicks.Empty())
+    {
+        Tick & tick = *dueTicks.begin();
+        dueTicks.Remove(&tick);
+        mRunningDueTime = tick.mDueTime;
+        tick.mCallback(tick.mContext);
+    }
+    mRunning = false;
+
+    CHIP_ERROR err = ArmTimer();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Zcl, "Failed to schedule the transition ticks: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+CHIP_ERROR TransitionTickScheduler::ArmTimer()
+{
+    VerifyOrReturnError(!mRunning, CHIP_NO_ERROR);
+
+    if (mTicks.Empty())
+    {
+        GetSystemLayer().CancelTimer(HandleTimer, this);
+        return CHIP_NO_ERROR;
+    }
+
+    const Timestamp now     = System::SystemClock().GetMonotonicTimestamp();
+    const Timestamp dueTime = mTicks.begin()->mDueTime;
+    return GetSystemLayer().StartTimer((dueTime > now) ? std::chrono::duration_cast<Timeout>(dueTime - now) : kZero, HandleTimer,
+                                       this);
+}
+
+System::Layer & TransitionTickScheduler::GetSystemLayer()
+{
+    return (mSystemLayer != nullptr) ? *mSystemLayer : DeviceLayer::SystemLayer();
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,101 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/IntrusiveList.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * @brief Runs the steps of the cluster transitions (level, color, ...) of all the endpoints from a single timer.
+ *
+ * Each transition owns a Tick, scheduled after the delay of its next step. All the ticks that are due are run from the same timer
+ * callback, so the attribute changes of one step of every transition are made, and reported, together.
+ *
+ * A tick scheduled from a tick callback is timed from the time its step was due rather than from the time the callback ran: the
+ * transitions do not drift, and transitions that stepped together keep stepping together. A granularity can also be given to
+ * align the due times on a common grid, so that transitions started at slightly different times share their ticks as well.
+ */
+class TransitionTickScheduler
+{
+public:
+    class Tick : public IntrusiveListNodeBase<IntrusiveMode::AutoUnlink>
+    {
+    public:
+        using Callback = void (*)(void * context);
+
+        bool IsScheduled() const { return IsInList(); }
+
+    private:
+        friend class TransitionTickScheduler;
+
+        Callback mCallback = nullptr;
+        void * mContext    = nullptr;
+        System::Clock::Timestamp mDueTime;
+    };
+
+    /// @brief Uses the system layer of the device layer
+    TransitionTickScheduler() = default;
+    explicit TransitionTickScheduler(System::Layer & systemLayer) : mSystemLayer(&systemLayer) {}
+    ~TransitionTickScheduler();
+
+    TransitionTickScheduler(const TransitionTickScheduler &)             = delete;
+    TransitionTickScheduler & operator=(const TransitionTickScheduler &) = delete;
+
+    static TransitionTickScheduler & Instance();
+
+    /// @brief Schedules a tick, replacing its previous schedule if any
+    /// @param tick tick to schedule, it must stay valid until it is run or cancelled
+    /// @param callback function called with context when the tick is due
+    /// @param delay delay of the step, a delay of zero runs the tick as soon as possible
+    /// @param granularity the due time is rounded to the nearest multiple of the granularity that is still to come, unless the
+    ///                    delay is zero
+    /// @return CHIP_NO_ERROR, or the error of the system layer if the timer could not be started
+    CHIP_ERROR Schedule(Tick & tick, Tick::Callback callback, void * context, System::Clock::Milliseconds32 delay,
+                        System::Clock::Milliseconds32 granularity = System::Clock::kZero);
+
+    void Cancel(Tick & tick);
+
+    /// @brief Time the delays are counted from: the due time of the tick being run when called from a tick callback, the current
+    ///        monotonic time otherwise.
+    System::Clock::Timestamp Now() const;
+
+private:
+    static void HandleTimer(System::Layer * layer, void * context);
+
+    void RunDueTicks();
+    CHIP_ERROR ArmTimer();
+    System::Layer & GetSystemLayer();
+
+    System::Layer * mSystemLayer = nullptr;
+
+    // Sorted by due time
+    IntrusiveList<Tick, IntrusiveMode::AutoUnlink> mTicks;
+
+    // Set while running the tick callbacks, the timer is armed once they are all done
+    bool mRunning = false;
+    System::Clock::Timestamp mRunningDueTime;
+};
+
+} // namespace app
+} // namespace chip
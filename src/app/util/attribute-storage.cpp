@@ -34,6 +34,11 @@
 #include <platform/LockTracker.h>
 #include <protocols/interaction_model/StatusCode.h>
 
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <iterator>
+
 using chip::Protocols::InteractionModel::Status;
 
 // Attribute storage depends on knowing the current layout/setup of attributes
@@ -49,9 +54,22 @@ using namespace chip::app;
 
 //------------------------------------------------------------------------------
 // Globals
+
+#if CHIP_CONFIG_ROM_FIXED_ENDPOINT_TABLE && FIXED_ENDPOINT_COUNT > 0
+#define EMBER_AF_ROM_FIXED_ENDPOINTS 1
+#else
+#define EMBER_AF_ROM_FIXED_ENDPOINTS 0
+#endif
+
+// Index of the first endpoint kept in emAfEndpoints: with
+// EMBER_AF_ROM_FIXED_ENDPOINTS, the fixed endpoints are read from the
+// generated tables, and emAfEndpoints only holds the dynamic ones.
+constexpr uint16_t kFirstRamEndpointIndex = EMBER_AF_ROM_FIXED_ENDPOINTS ? FIXED_ENDPOINT_COUNT : 0;
+constexpr uint16_t kRamEndpointCount      = MAX_ENDPOINT_COUNT - kFirstRamEndpointIndex;
+
 // This is not declared CONST in order to handle dynamic endpoint information
 // retrieved from tokens.
-EmberAfDefinedEndpoint emAfEndpoints[MAX_ENDPOINT_COUNT];
+EmberAfDefinedEndpoint emAfEndpoints[kRamEndpointCount > 0 ? kRamEndpointCount : 1];
 
 #if (ATTRIBUTE_MAX_SIZE == 0)
 #define ACTUAL_ATTRIBUTE_SIZE 1
@@ -98,6 +116,58 @@ uint16_t emberEndpointCount = 0;
 /// ember metadata (e.g. changing dynamic endpoints or enabling/disabling endpoints)
 unsigned emberMetadataStructureGeneration = 0;
 
+/// Entry of the index of the defined endpoints, which finds an endpoint by id
+/// without walking emAfEndpoints.
+struct EndpointIndexEntry
+{
+    EndpointId endpoint;
+    uint16_t index; ///< Index in emAfEndpoints
+    /// Offset in attributeData of the storage of the endpoint. Only meaningful
+    /// for fixed endpoints, as dynamic ones are externally stored.
+    uint16_t storageOffset;
+};
+
+/// Index of the defined endpoints, sorted by endpoint id and then by index in
+/// emAfEndpoints. Rebuilt whenever the endpoints are configured or the dynamic
+/// endpoints change, and kept regardless of the endpoints being enabled.
+EndpointIndexEntry endpointIndex[MAX_ENDPOINT_COUNT];
+uint16_t endpointIndexCount = 0;
+
+/// Parents whose PartsList changes are deferred by the dynamic endpoint change
+/// batch in progress. Bridges usually hang their devices off one aggregator;
+/// past this many parents, all the PartsLists are marked as changed instead.
+constexpr size_t kMaxBatchedPartsListParents = 8;
+
+struct DynamicEndpointChangeBatch
+{
+    unsigned depth         = 0; ///< Nesting level of emberAfBeginDynamicEndpointChanges
+    bool partsListsChanged = false;
+    bool tooManyParents    = false;
+    uint8_t parentCount    = 0;
+    EndpointId parents[kMaxBatchedPartsListParents];
+};
+
+DynamicEndpointChangeBatch dynamicEndpointChangeBatch;
+
+/// Node of the topology of the enabled endpoints, which the Descriptor
+/// PartsLists are read from without walking emAfEndpoints. An enabled endpoint
+/// is linked in the children of its parent once the parent is enabled; the
+/// children of an endpoint are sorted by index in emAfEndpoints.
+struct EndpointTopologyNode
+{
+    uint16_t parent      = kEmberInvalidEndpointIndex;
+    uint16_t firstChild  = kEmberInvalidEndpointIndex;
+    uint16_t lastChild   = kEmberInvalidEndpointIndex;
+    uint16_t prevSibling = kEmberInvalidEndpointIndex;
+    uint16_t nextSibling = kEmberInvalidEndpointIndex;
+};
+
+EndpointTopologyNode endpointTopology[MAX_ENDPOINT_COUNT];
+
+/// Number of enabled endpoints that have a parent endpoint but are not linked
+/// to it, mostly because the parent is not enabled yet.
+uint16_t unlinkedEndpointCount = 0;
+
 // If we have attributes that are more than 4 bytes, then
 // we need this data block for the defaults
 #if (defined(GENERATED_DEFAULTS) && GENERATED_DEFAULTS_COUNT)
@@ -136,38 +206,459 @@ constexpr const EmberAfAttributeMetadata generatedAttributes[] = GENERATED_ATTRI
 #ifdef GENERATED_CLUSTERS
 constexpr const EmberAfCluster generatedClusters[] = GENERATED_CLUSTERS;
 #define ZAP_CLUSTER_INDEX(index) (&generatedClusters[index])
+
+// ZAP emits the attributes of a cluster in ascending id order, except for
+// manufacturer-specific ones; find out at compile time which clusters can have
+// their attributes binary searched.
+constexpr std::array<bool, ArraySize(generatedClusters)> generatedClustersWithSortedAttributes()
+{
+    std::array<bool, ArraySize(generatedClusters)> sorted = {};
+    for (size_t c = 0; c < ArraySize(generatedClusters); c++)
+    {
+        sorted[c] = true;
+        for (uint16_t i = 1; i < generatedClusters[c].attributeCount; i++)
+        {
+            if (generatedClusters[c].attributes[i - 1].attributeId >= generatedClusters[c].attributes[i].attributeId)
+            {
+                sorted[c] = false;
+                break;
+            }
+        }
+    }
+    return sorted;
+}
+
+constexpr std::array<bool, ArraySize(generatedClusters)> generatedClusterHasSortedAttributes =
+    generatedClustersWithSortedAttributes();
+
+bool hasSortedAttributes(const EmberAfCluster * cluster)
+{
+    // std::less, as the cluster may not be one of the array.
+    if (std::less<const EmberAfCluster *>()(cluster, std::begin(generatedClusters)) ||
+        !std::less<const EmberAfCluster *>()(cluster, std::end(generatedClusters)))
+    {
+        return false;
+    }
+    return generatedClusterHasSortedAttributes[static_cast<size_t>(cluster - generatedClusters)];
+}
 #endif
 
 #if FIXED_ENDPOINT_COUNT > 0
 constexpr const EmberAfEndpointType generatedEmberAfEndpointTypes[] = GENERATED_ENDPOINT_TYPES;
 constexpr const EmberAfDeviceType fixedDeviceTypeList[]             = FIXED_DEVICE_TYPES;
 
+constexpr uint16_t fixedEndpoints[]             = FIXED_ENDPOINT_ARRAY;
+constexpr uint16_t fixedDeviceTypeListLengths[] = FIXED_DEVICE_TYPE_LENGTHS;
+constexpr uint16_t fixedDeviceTypeListOffsets[] = FIXED_DEVICE_TYPE_OFFSETS;
+constexpr uint8_t fixedEmberAfEndpointTypes[]   = FIXED_ENDPOINT_TYPES;
+constexpr EndpointId fixedParentEndpoints[]     = FIXED_PARENT_ENDPOINTS;
+
 // Not const, because these need to mutate.
 DataVersion fixedEndpointDataVersions[ZAP_FIXED_ENDPOINT_DATA_VERSION_COUNT];
+
+// Each fixed endpoint has a slot in fixedEndpointDataVersions per server
+// cluster, after those of the endpoints before it.
+constexpr std::array<uint16_t, FIXED_ENDPOINT_COUNT> fixedEndpointDataVersionOffsets()
+{
+    std::array<uint16_t, FIXED_ENDPOINT_COUNT> offsets = {};
+    uint16_t offset                                    = 0;
+    for (size_t ep = 0; ep < FIXED_ENDPOINT_COUNT; ep++)
+    {
+        offsets[ep]                      = offset;
+        const EmberAfEndpointType & type = generatedEmberAfEndpointTypes[fixedEmberAfEndpointTypes[ep]];
+        for (uint8_t c = 0; c < type.clusterCount; c++)
+        {
+            if ((type.cluster[c].mask & CLUSTER_MASK_SERVER) != 0)
+            {
+                offset++;
+            }
+        }
+    }
+    return offsets;
+}
+
+constexpr std::array<uint16_t, FIXED_ENDPOINT_COUNT> fixedEndpointDataVersionOffset = fixedEndpointDataVersionOffsets();
+
+constexpr bool isStoredInEndpoint(const EmberAfAttributeMetadata & am)
+{
+    return !(am.mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am.mask & ATTRIBUTE_MASK_SINGLETON);
+}
+
+constexpr size_t generatedAttributeIndex(const EmberAfAttributeMetadata * am)
+{
+    return static_cast<size_t>(am - generatedAttributes);
+}
+
+#if CHIP_CONFIG_ATTRIBUTE_STORAGE_PACK_HOT_ATTRIBUTES
+struct HotAttribute
+{
+    ClusterId clusterId;
+    AttributeId attributeId;
+};
+
+constexpr HotAttribute hotAttributes[] = { CHIP_CONFIG_ATTRIBUTE_STORAGE_HOT_ATTRIBUTES };
+
+constexpr bool isHotAttribute(const EmberAfCluster & cluster, const EmberAfAttributeMetadata & am)
+{
+    for (const HotAttribute & hot : hotAttributes)
+    {
+        if (hot.clusterId == cluster.clusterId && hot.attributeId == am.attributeId)
+        {
+            return isStoredInEndpoint(am);
+        }
+    }
+    return false;
+}
+
+// Whether an attribute of the given size goes with those aligned to the given
+// power of two, checked from 8 down to 1.
+constexpr bool hasLargestAlignment(uint16_t size, uint16_t alignment)
+{
+    return (size % alignment) == 0 && (alignment == 8 || (size % (2 * alignment)) != 0);
+}
+#endif // CHIP_CONFIG_ATTRIBUTE_STORAGE_PACK_HOT_ATTRIBUTES
+
+// Offset of each internally stored attribute: singletons in
+// singletonAttributeData, in the generated order, and the others from the start
+// of the storage of their endpoint in attributeData. The latter follow the
+// generated order, each cluster taking its clusterSize, unless the hot
+// attributes are packed first. Computed at compile time instead of walking the
+// attributes before the one accessed.
+constexpr std::array<uint16_t, ArraySize(generatedAttributes)> generatedAttributeStorageOffsets()
+{
+    std::array<uint16_t, ArraySize(generatedAttributes)> offsets = {};
+
+    uint16_t singletonOffset = 0;
+    for (size_t a = 0; a < ArraySize(generatedAttributes); a++)
+    {
+        const EmberAfAttributeMetadata & am = generatedAttributes[a];
+        if ((am.mask & ATTRIBUTE_MASK_SINGLETON) && !(am.mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE))
+        {
+            offsets[a]      = singletonOffset;
+            singletonOffset = static_cast<uint16_t>(singletonOffset + am.size);
+        }
+    }
+
+    for (const EmberAfEndpointType & type : generatedEmberAfEndpointTypes)
+    {
+        uint16_t offset = 0;
+#if CHIP_CONFIG_ATTRIBUTE_STORAGE_PACK_HOT_ATTRIBUTES
+        for (uint16_t alignment = 8; alignment > 0; alignment = static_cast<uint16_t>(alignment / 2))
+        {
+            for (uint8_t c = 0; c < type.clusterCount; c++)
+            {
+                const EmberAfCluster & cluster = type.cluster[c];
+                for (uint16_t i = 0; i < cluster.attributeCount; i++)
+                {
+                    const EmberAfAttributeMetadata & am = cluster.attributes[i];
+                    if (isHotAttribute(cluster, am) && hasLargestAlignment(am.size, alignment))
+                    {
+                        offsets[generatedAttributeIndex(&am)] = offset;
+                        offset                                = static_cast<uint16_t>(offset + am.size);
+                    }
+                }
+            }
+        }
+        for (uint8_t c = 0; c < type.clusterCount; c++)
+        {
+            const EmberAfCluster & cluster = type.cluster[c];
+            for (uint16_t i = 0; i < cluster.attributeCount; i++)
+            {
+                const EmberAfAttributeMetadata & am = cluster.attributes[i];
+                if (isStoredInEndpoint(am) && !isHotAttribute(cluster, am))
+                {
+                    offsets[generatedAttributeIndex(&am)] = offset;
+                    offset                                = static_cast<uint16_t>(offset + am.size);
+                }
+            }
+        }
+#else
+        for (uint8_t c = 0; c < type.clusterCount; c++)
+        {
+            const EmberAfCluster & cluster = type.cluster[c];
+            uint16_t attributeOffset       = offset;
+            for (uint16_t i = 0; i < cluster.attributeCount; i++)
+            {
+                const EmberAfAttributeMetadata & am = cluster.attributes[i];
+                if (isStoredInEndpoint(am))
+                {
+                    offsets[generatedAttributeIndex(&am)] = attributeOffset;
+                    attributeOffset                       = static_cast<uint16_t>(attributeOffset + am.size);
+                }
+            }
+            offset = static_cast<uint16_t>(offset + cluster.clusterSize);
+        }
+#endif // CHIP_CONFIG_ATTRIBUTE_STORAGE_PACK_HOT_ATTRIBUTES
+    }
+    return offsets;
+}
+
+// The offsets above are only right if no attribute is shared between clusters
+// and the attributes of each endpoint type fit in its endpointSize.
+constexpr bool generatedAttributeStorageIsConsistent()
+{
+    std::array<bool, ArraySize(generatedAttributes)> seen = {};
+    for (const EmberAfEndpointType & type : generatedEmberAfEndpointTypes)
+    {
+        uint32_t size = 0;
+        for (uint8_t c = 0; c < type.clusterCount; c++)
+        {
+            const EmberAfCluster & cluster = type.cluster[c];
+            uint32_t clusterSize           = 0;
+            for (uint16_t i = 0; i < cluster.attributeCount; i++)
+            {
+                const size_t index = generatedAttributeIndex(&cluster.attributes[i]);
+                if (seen[index])
+                {
+                    return false;
+                }
+                seen[index] = true;
+                if (isStoredInEndpoint(cluster.attributes[i]))
+                {
+                    clusterSize += cluster.attributes[i].size;
+                }
+            }
+            if (clusterSize > cluster.clusterSize)
+            {
+                return false;
+            }
+            size += cluster.clusterSize;
+        }
+        if (size > type.endpointSize)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(generatedAttributeStorageIsConsistent(), "The generated attributes do not match the generated storage sizes");
+
+constexpr std::array<uint16_t, ArraySize(generatedAttributes)> generatedAttributeStorageOffset =
+    generatedAttributeStorageOffsets();
+
+/// Location of an internally stored attribute of the fixed endpoint whose
+/// storage starts at the given offset in attributeData.
+uint8_t * internalAttributeLocation(uint16_t endpointStorageOffset, const EmberAfAttributeMetadata * am)
+{
+    const uint16_t offset = generatedAttributeStorageOffset[generatedAttributeIndex(am)];
+    if (am->IsSingleton())
+    {
+        return singletonAttributeData + offset;
+    }
+    return attributeData + endpointStorageOffset + offset;
+}
 #endif // FIXED_ENDPOINT_COUNT > 0
 
+#if EMBER_AF_ROM_FIXED_ENDPOINTS
+/// What can change about a fixed endpoint served from the generated tables.
+struct FixedEndpointState
+{
+    Span<const Clusters::Descriptor::Structs::SemanticTagStruct::Type> tagList;
+    EndpointId parentEndpointId = kInvalidEndpointId;
+    BitMask<EmberAfEndpointOptions> bitmask;
+};
+
+FixedEndpointState fixedEndpointStates[FIXED_ENDPOINT_COUNT];
+
+bool isRomEndpointIndex(uint16_t epi)
+{
+    return epi < FIXED_ENDPOINT_COUNT;
+}
+#endif // EMBER_AF_ROM_FIXED_ENDPOINTS
+
+/// The endpoint at the given index, which must be kept in RAM, i.e. be dynamic
+/// if EMBER_AF_ROM_FIXED_ENDPOINTS.
+EmberAfDefinedEndpoint & ramEndpointAt(uint16_t epi)
+{
+    return emAfEndpoints[epi - kFirstRamEndpointIndex];
+}
+
+EndpointId endpointIdAt(uint16_t epi)
+{
+#if EMBER_AF_ROM_FIXED_ENDPOINTS
+    if (isRomEndpointIndex(epi))
+    {
+        return fixedEndpoints[epi];
+    }
+#endif
+    return ramEndpointAt(epi).endpoint;
+}
+
+const EmberAfEndpointType * endpointTypeAt(uint16_t epi)
+{
+#if EMBER_AF_ROM_FIXED_ENDPOINTS
+    if (isRomEndpointIndex(epi))
+    {
+        return &generatedEmberAfEndpointTypes[fixedEmberAfEndpointTypes[epi]];
+    }
+#endif
+    return ramEndpointAt(epi).endpointType;
+}
+
+Span<const EmberAfDeviceType> deviceTypeListAt(uint16_t epi)
+{
+#if EMBER_AF_ROM_FIXED_ENDPOINTS
+    if (isRomEndpointIndex(epi))
+    {
+        return Span<const EmberAfDeviceType>(&fixedDeviceTypeList[fixedDeviceTypeListOffsets[epi]],
+                                             fixedDeviceTypeListLengths[epi]);
+    }
+#endif
+    return ramEndpointAt(epi).deviceTypeList;
+}
+
+DataVersion * dataVersionsAt(uint16_t epi)
+{
+#if EMBER_AF_ROM_FIXED_ENDPOINTS
+    if (isRomEndpointIndex(epi))
+    {
+        return fixedEndpointDataVersions + fixedEndpointDataVersionOffset[epi];
+    }
+#endif
+    return ramEndpointAt(epi).dataVersions;
+}
+
+EndpointId & parentEndpointIdAt(uint16_t epi)
+{
+#if EMBER_AF_ROM_FIXED_ENDPOINTS
+    if (isRomEndpointIndex(epi))
+    {
+        return fixedEndpointStates[epi].parentEndpointId;
+    }
+#endif
+    return ramEndpointAt(epi).parentEndpointId;
+}
+
+BitMask<EmberAfEndpointOptions> & endpointOptionsAt(uint16_t epi)
+{
+#if EMBER_AF_ROM_FIXED_ENDPOINTS
+    if (isRomEndpointIndex(epi))
+    {
+        return fixedEndpointStates[epi].bitmask;
+    }
+#endif
+    return ramEndpointAt(epi).bitmask;
+}
+
+Span<const Clusters::Descriptor::Structs::SemanticTagStruct::Type> & tagListAt(uint16_t epi)
+{
+#if EMBER_AF_ROM_FIXED_ENDPOINTS
+    if (isRomEndpointIndex(epi))
+    {
+        return fixedEndpointStates[epi].tagList;
+    }
+#endif
+    return ramEndpointAt(epi).tagList;
+}
+
 bool emberAfIsThisDataTypeAListType(EmberAfAttributeType dataType)
 {
     return dataType == ZCL_ARRAY_ATTRIBUTE_TYPE;
 }
 
-uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEndpoints)
+bool endpointIndexEntryLess(const EndpointIndexEntry & a, const EndpointIndexEntry & b)
 {
-    if (endpoint == kInvalidEndpointId)
+    return (a.endpoint < b.endpoint) || (a.endpoint == b.endpoint && a.index < b.index);
+}
+
+void rebuildEndpointIndex()
+{
+    uint16_t storageOffset = 0;
+
+    endpointIndexCount = 0;
+    for (uint16_t epi = 0; epi < emberAfEndpointCount(); epi++)
     {
-        return kEmberInvalidEndpointIndex;
+        if (endpointIdAt(epi) != kInvalidEndpointId)
+        {
+            endpointIndex[endpointIndexCount++] = { endpointIdAt(epi), epi, storageOffset };
+        }
+
+        // Dynamic endpoints are external and don't factor into storage size
+        if (epi < emberAfFixedEndpointCount())
+        {
+            storageOffset = static_cast<uint16_t>(storageOffset + endpointTypeAt(epi)->endpointSize);
+        }
     }
 
-    uint16_t epi;
-    for (epi = 0; epi < emberAfEndpointCount(); epi++)
+    std::sort(endpointIndex, endpointIndex + endpointIndexCount, endpointIndexEntryLess);
+}
+
+// Adds the dynamic endpoint at the given index to the endpoint index, without
+// rebuilding it.
+void insertDynamicEndpointIndexEntry(uint16_t epi)
+{
+    const EndpointIndexEntry entry = { endpointIdAt(epi), epi, 0 };
+    EndpointIndexEntry * end       = endpointIndex + endpointIndexCount;
+    EndpointIndexEntry * position  = std::upper_bound(endpointIndex, end, entry, endpointIndexEntryLess);
+
+    std::move_backward(position, end, end + 1);
+    *position = entry;
+    endpointIndexCount++;
+}
+
+// Removes the dynamic endpoint with the given id at the given index from the
+// endpoint index, without rebuilding it.
+void eraseDynamicEndpointIndexEntry(EndpointId endpoint, uint16_t epi)
+{
+    const EndpointIndexEntry entry = { endpoint, epi, 0 };
+    EndpointIndexEntry * end       = endpointIndex + endpointIndexCount;
+    EndpointIndexEntry * position  = std::lower_bound(endpointIndex, end, entry, endpointIndexEntryLess);
+
+    if (position != end && position->endpoint == endpoint && position->index == epi)
     {
-        if (emAfEndpoints[epi].endpoint == endpoint &&
-            (!ignoreDisabledEndpoints || emAfEndpoints[epi].bitmask.Has(EmberAfEndpointOptions::isEnabled)))
+        std::move(position + 1, end, position);
+        endpointIndexCount--;
+    }
+}
+
+// Returns the index entry of the first endpoint with the given id, or null if
+// there is none.
+const EndpointIndexEntry * lookupEndpoint(EndpointId endpoint, bool ignoreDisabledEndpoints)
+{
+    const EndpointIndexEntry * begin = endpointIndex;
+    const EndpointIndexEntry * end   = endpointIndex + endpointIndexCount;
+    const EndpointIndexEntry * entry =
+        std::lower_bound(begin, end, endpoint, [](const EndpointIndexEntry & e, EndpointId id) { return e.endpoint < id; });
+
+    for (; entry != end && entry->endpoint == endpoint; entry++)
+    {
+        if (!ignoreDisabledEndpoints || endpointOptionsAt(entry->index).Has(EmberAfEndpointOptions::isEnabled))
+        {
+            return entry;
+        }
+    }
+    return nullptr;
+}
+
+// Returns the index entry of the dynamic endpoint with the given id, or null if
+// there is none.
+const EndpointIndexEntry * lookupDynamicEndpoint(EndpointId endpoint)
+{
+    const EndpointIndexEntry * begin = endpointIndex;
+    const EndpointIndexEntry * end   = endpointIndex + endpointIndexCount;
+    const EndpointIndexEntry * entry =
+        std::lower_bound(begin, end, endpoint, [](const EndpointIndexEntry & e, EndpointId id) { return e.endpoint < id; });
+
+    for (; entry != end && entry->endpoint == endpoint; entry++)
+    {
+        if (entry->index >= FIXED_ENDPOINT_COUNT)
         {
-            return epi;
+            return entry;
         }
     }
-    return kEmberInvalidEndpointIndex;
+    return nullptr;
+}
+
+uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEndpoints)
+{
+    if (endpoint == kInvalidEndpointId)
+    {
+        return kEmberInvalidEndpointIndex;
+    }
+
+    const EndpointIndexEntry * entry = lookupEndpoint(endpoint, ignoreDisabledEndpoints);
+    return (entry != nullptr) ? entry->index : kEmberInvalidEndpointIndex;
 }
 
 // Returns the index of a given endpoint.  Considers disabled endpoints.
@@ -176,6 +667,122 @@ uint16_t emberAfIndexFromEndpointIncludingDisabledEndpoints(EndpointId endpoint)
     return findIndexFromEndpoint(endpoint, false /* ignoreDisabledEndpoints */);
 }
 
+bool hasParentEndpoint(uint16_t epi)
+{
+    return parentEndpointIdAt(epi) != kInvalidEndpointId;
+}
+
+// Links the enabled endpoint at the given index in the children of its parent.
+// Returns false if the parent is not enabled, or if linking it would make a
+// cycle.
+bool linkEndpointTopologyNode(uint16_t epi)
+{
+    const uint16_t parent = emberAfIndexFromEndpoint(parentEndpointIdAt(epi));
+    VerifyOrReturnValue(parent != kEmberInvalidEndpointIndex, false);
+    for (uint16_t ancestor = parent; ancestor != kEmberInvalidEndpointIndex; ancestor = endpointTopology[ancestor].parent)
+    {
+        VerifyOrReturnValue(ancestor != epi, false);
+    }
+
+    EndpointTopologyNode & node       = endpointTopology[epi];
+    EndpointTopologyNode & parentNode = endpointTopology[parent];
+
+    // Endpoints are mostly enabled in index order, look for the position from the end.
+    uint16_t next = kEmberInvalidEndpointIndex;
+    uint16_t prev = parentNode.lastChild;
+    while (prev != kEmberInvalidEndpointIndex && prev > epi)
+    {
+        next = prev;
+        prev = endpointTopology[prev].prevSibling;
+    }
+
+    node.parent      = parent;
+    node.prevSibling = prev;
+    node.nextSibling = next;
+    ((prev != kEmberInvalidEndpointIndex) ? endpointTopology[prev].nextSibling : parentNode.firstChild) = epi;
+    ((next != kEmberInvalidEndpointIndex) ? endpointTopology[next].prevSibling : parentNode.lastChild)  = epi;
+    return true;
+}
+
+// Links the enabled endpoints that are not linked to their parent yet, and
+// recounts those that still can't be.
+void linkUnlinkedEndpoints()
+{
+    unlinkedEndpointCount = 0;
+    for (uint16_t epi = 0; epi < emberAfEndpointCount(); epi++)
+    {
+        if (endpointIdAt(epi) == kInvalidEndpointId || !emberAfEndpointIndexIsEnabled(epi) || !hasParentEndpoint(epi) ||
+            endpointTopology[epi].parent != kEmberInvalidEndpointIndex)
+        {
+            continue;
+        }
+        if (!linkEndpointTopologyNode(epi))
+        {
+            unlinkedEndpointCount++;
+        }
+    }
+}
+
+void rebuildEndpointTopology()
+{
+    std::fill(std::begin(endpointTopology), std::end(endpointTopology), EndpointTopologyNode());
+    linkUnlinkedEndpoints();
+}
+
+// Adds the endpoint at the given index, which just got enabled, to the
+// topology.
+void addEndpointToTopology(uint16_t epi)
+{
+    if (unlinkedEndpointCount > 0)
+    {
+        // The endpoint may be the parent of unlinked endpoints, and is linked
+        // along with them.
+        linkUnlinkedEndpoints();
+    }
+    else if (hasParentEndpoint(epi) && !linkEndpointTopologyNode(epi))
+    {
+        unlinkedEndpointCount++;
+    }
+}
+
+// Removes the endpoint at the given index, which just got disabled, from the
+// topology. Its children are left unlinked until it is enabled again.
+void removeEndpointFromTopology(uint16_t epi)
+{
+    EndpointTopologyNode & node = endpointTopology[epi];
+
+    if (node.parent != kEmberInvalidEndpointIndex)
+    {
+        EndpointTopologyNode & parentNode = endpointTopology[node.parent];
+        ((node.prevSibling != kEmberInvalidEndpointIndex) ? endpointTopology[node.prevSibling].nextSibling
+                                                           : parentNode.firstChild) = node.nextSibling;
+        ((node.nextSibling != kEmberInvalidEndpointIndex) ? endpointTopology[node.nextSibling].prevSibling
+                                                           : parentNode.lastChild)  = node.prevSibling;
+    }
+    else if (hasParentEndpoint(epi) && unlinkedEndpointCount > 0)
+    {
+        unlinkedEndpointCount--;
+    }
+
+    bool hadChildren = false;
+    for (uint16_t child = node.firstChild; child != kEmberInvalidEndpointIndex;)
+    {
+        EndpointTopologyNode & childNode = endpointTopology[child];
+        child                            = childNode.nextSibling;
+        childNode.parent                 = kEmberInvalidEndpointIndex;
+        childNode.prevSibling            = kEmberInvalidEndpointIndex;
+        childNode.nextSibling            = kEmberInvalidEndpointIndex;
+        hadChildren                      = true;
+    }
+    node = EndpointTopologyNode();
+
+    if (hadChildren)
+    {
+        // Another enabled endpoint may have the same id.
+        linkUnlinkedEndpoints();
+    }
+}
+
 } // anonymous namespace
 
 // Initial configuration
@@ -190,12 +797,6 @@ void emberAfEndpointConfigure()
 
 #if FIXED_ENDPOINT_COUNT > 0
 
-    constexpr uint16_t fixedEndpoints[]             = FIXED_ENDPOINT_ARRAY;
-    constexpr uint16_t fixedDeviceTypeListLengths[] = FIXED_DEVICE_TYPE_LENGTHS;
-    constexpr uint16_t fixedDeviceTypeListOffsets[] = FIXED_DEVICE_TYPE_OFFSETS;
-    constexpr uint8_t fixedEmberAfEndpointTypes[]   = FIXED_ENDPOINT_TYPES;
-    constexpr EndpointId fixedParentEndpoints[]     = FIXED_PARENT_ENDPOINTS;
-
 #if ZAP_FIXED_ENDPOINT_DATA_VERSION_COUNT > 0
     // Initialize our data version storage.  If
     // ZAP_FIXED_ENDPOINT_DATA_VERSION_COUNT == 0, gcc complains about a memset
@@ -209,22 +810,23 @@ void emberAfEndpointConfigure()
     }
 #endif // ZAP_FIXED_ENDPOINT_DATA_VERSION_COUNT > 0
 
-    DataVersion * currentDataVersions = fixedEndpointDataVersions;
     for (ep = 0; ep < FIXED_ENDPOINT_COUNT; ep++)
     {
-        emAfEndpoints[ep].endpoint = fixedEndpoints[ep];
-        emAfEndpoints[ep].deviceTypeList =
+#if EMBER_AF_ROM_FIXED_ENDPOINTS
+        // The rest of the definition is read from the generated tables.
+        fixedEndpointStates[ep] = FixedEndpointState();
+#else
+        EmberAfDefinedEndpoint & definedEndpoint = ramEndpointAt(ep);
+        definedEndpoint.endpoint                 = fixedEndpoints[ep];
+        definedEndpoint.deviceTypeList =
             Span<const EmberAfDeviceType>(&fixedDeviceTypeList[fixedDeviceTypeListOffsets[ep]], fixedDeviceTypeListLengths[ep]);
-        emAfEndpoints[ep].endpointType     = &generatedEmberAfEndpointTypes[fixedEmberAfEndpointTypes[ep]];
-        emAfEndpoints[ep].dataVersions     = currentDataVersions;
-        emAfEndpoints[ep].parentEndpointId = fixedParentEndpoints[ep];
+        definedEndpoint.endpointType = &generatedEmberAfEndpointTypes[fixedEmberAfEndpointTypes[ep]];
+        definedEndpoint.dataVersions = fixedEndpointDataVersions + fixedEndpointDataVersionOffset[ep];
+#endif // EMBER_AF_ROM_FIXED_ENDPOINTS
+        parentEndpointIdAt(ep) = fixedParentEndpoints[ep];
 
-        emAfEndpoints[ep].bitmask.Set(EmberAfEndpointOptions::isEnabled);
-        emAfEndpoints[ep].bitmask.Set(EmberAfEndpointOptions::isFlatComposition);
-
-        // Increment currentDataVersions by 1 (slot) for every server cluster
-        // this endpoint has.
-        currentDataVersions += emberAfClusterCountByIndex(ep, /* server = */ true);
+        endpointOptionsAt(ep).Set(EmberAfEndpointOptions::isEnabled);
+        endpointOptionsAt(ep).Set(EmberAfEndpointOptions::isFlatComposition);
     }
 
 #endif // FIXED_ENDPOINT_COUNT > 0
@@ -237,15 +839,23 @@ void emberAfEndpointConfigure()
         //
         for (ep = FIXED_ENDPOINT_COUNT; ep < MAX_ENDPOINT_COUNT; ep++)
         {
-            emAfEndpoints[ep] = EmberAfDefinedEndpoint();
+            ramEndpointAt(ep) = EmberAfDefinedEndpoint();
         }
     }
 #endif
+
+    rebuildEndpointIndex();
+    rebuildEndpointTopology();
 }
 
 void emberAfSetDynamicEndpointCount(uint16_t dynamicEndpointCount)
 {
-    emberEndpointCount = static_cast<uint16_t>(FIXED_ENDPOINT_COUNT + dynamicEndpointCount);
+    const uint16_t endpointCount = static_cast<uint16_t>(FIXED_ENDPOINT_COUNT + dynamicEndpointCount);
+    if (endpointCount != emberEndpointCount)
+    {
+        emberEndpointCount = endpointCount;
+        rebuildEndpointIndex();
+    }
 }
 
 uint16_t emberAfGetDynamicIndexFromEndpoint(EndpointId id)
@@ -255,15 +865,8 @@ uint16_t emberAfGetDynamicIndexFromEndpoint(EndpointId id)
         return kEmberInvalidEndpointIndex;
     }
 
-    uint16_t index;
-    for (index = FIXED_ENDPOINT_COUNT; index < MAX_ENDPOINT_COUNT; index++)
-    {
-        if (emAfEndpoints[index].endpoint == id)
-        {
-            return static_cast<uint16_t>(index - FIXED_ENDPOINT_COUNT);
-        }
-    }
-    return kEmberInvalidEndpointIndex;
+    const EndpointIndexEntry * entry = lookupDynamicEndpoint(id);
+    return (entry != nullptr) ? static_cast<uint16_t>(entry->index - FIXED_ENDPOINT_COUNT) : kEmberInvalidEndpointIndex;
 }
 
 CHIP_ERROR emberAfSetDynamicEndpoint(uint16_t index, EndpointId id, const EmberAfEndpointType * ep,
@@ -287,24 +890,34 @@ CHIP_ERROR emberAfSetDynamicEndpoint(uint16_t index, EndpointId id, const EmberA
         return CHIP_ERROR_NO_MEMORY;
     }
 
+    // From now on, all the dynamic endpoint slots are in the endpoint index.
+    emberAfSetDynamicEndpointCount(MAX_ENDPOINT_COUNT - FIXED_ENDPOINT_COUNT);
+
     index = static_cast<uint16_t>(realIndex);
-    for (uint16_t i = FIXED_ENDPOINT_COUNT; i < MAX_ENDPOINT_COUNT; i++)
+    if (lookupDynamicEndpoint(id) != nullptr)
     {
-        if (emAfEndpoints[i].endpoint == id)
-        {
-            return CHIP_ERROR_ENDPOINT_EXISTS;
-        }
+        return CHIP_ERROR_ENDPOINT_EXISTS;
     }
 
-    emAfEndpoints[index].endpoint       = id;
-    emAfEndpoints[index].deviceTypeList = deviceTypeList;
-    emAfEndpoints[index].endpointType   = ep;
-    emAfEndpoints[index].dataVersions   = dataVersionStorage.data();
-    // Start the endpoint off as disabled.
-    emAfEndpoints[index].bitmask.Clear(EmberAfEndpointOptions::isEnabled);
-    emAfEndpoints[index].parentEndpointId = parentEndpointId;
+    EmberAfDefinedEndpoint & definedEndpoint = ramEndpointAt(index);
+    if (definedEndpoint.endpoint != kInvalidEndpointId)
+    {
+        // The slot is reused without having been cleared.
+        eraseDynamicEndpointIndexEntry(definedEndpoint.endpoint, index);
+    }
 
-    emberAfSetDynamicEndpointCount(MAX_ENDPOINT_COUNT - FIXED_ENDPOINT_COUNT);
+    definedEndpoint.endpoint       = id;
+    definedEndpoint.deviceTypeList = deviceTypeList;
+    definedEndpoint.endpointType   = ep;
+    definedEndpoint.dataVersions   = dataVersionStorage.data();
+    // Start the endpoint off as disabled.
+    if (emberAfEndpointIndexIsEnabled(index))
+    {
+        definedEndpoint.bitmask.Clear(EmberAfEndpointOptions::isEnabled);
+        removeEndpointFromTopology(index);
+    }
+    definedEndpoint.parentEndpointId = parentEndpointId;
+    insertDynamicEndpointIndexEntry(index);
 
     // Initialize the data versions.
     size_t dataSize = sizeof(DataVersion) * serverClusterCount;
@@ -324,18 +937,68 @@ CHIP_ERROR emberAfSetDynamicEndpoint(uint16_t index, EndpointId id, const EmberA
     return CHIP_NO_ERROR;
 }
 
+size_t emberAfDynamicEndpointsDataVersionCount(Span<const EmberAfDynamicEndpointDefinition> endpoints)
+{
+    size_t count = 0;
+    for (const auto & endpoint : endpoints)
+    {
+        count += emberAfClusterCountForEndpointType(endpoint.endpointType, /* server = */ true);
+    }
+    return count;
+}
+
+CHIP_ERROR emberAfSetDynamicEndpoints(Span<const EmberAfDynamicEndpointDefinition> endpoints,
+                                      const Span<DataVersion> & dataVersionStorage)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturnError(dataVersionStorage.size() >= emberAfDynamicEndpointsDataVersionCount(endpoints), CHIP_ERROR_NO_MEMORY);
+
+    emberAfBeginDynamicEndpointChanges();
+
+    CHIP_ERROR err            = CHIP_NO_ERROR;
+    size_t registered         = 0;
+    size_t dataVersionsOffset = 0;
+    for (; registered < endpoints.size(); registered++)
+    {
+        const EmberAfDynamicEndpointDefinition & endpoint = endpoints[registered];
+        size_t serverClusterCount = emberAfClusterCountForEndpointType(endpoint.endpointType, /* server = */ true);
+
+        err = emberAfSetDynamicEndpoint(endpoint.index, endpoint.id, endpoint.endpointType,
+                                        dataVersionStorage.SubSpan(dataVersionsOffset, serverClusterCount),
+                                        endpoint.deviceTypeList, endpoint.parentEndpointId);
+        if (err != CHIP_NO_ERROR)
+        {
+            break;
+        }
+        dataVersionsOffset += serverClusterCount;
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        while (registered > 0)
+        {
+            emberAfClearDynamicEndpoint(endpoints[--registered].index);
+        }
+    }
+
+    emberAfEndDynamicEndpointChanges();
+    return err;
+}
+
 EndpointId emberAfClearDynamicEndpoint(uint16_t index)
 {
     EndpointId ep = 0;
 
     index = static_cast<uint16_t>(index + FIXED_ENDPOINT_COUNT);
 
-    if ((index < MAX_ENDPOINT_COUNT) && (emAfEndpoints[index].endpoint != kInvalidEndpointId) &&
+    if ((index < MAX_ENDPOINT_COUNT) && (ramEndpointAt(index).endpoint != kInvalidEndpointId) &&
         (emberAfEndpointIndexIsEnabled(index)))
     {
-        ep = emAfEndpoints[index].endpoint;
+        ep = ramEndpointAt(index).endpoint;
         emberAfEndpointEnableDisable(ep, false);
-        emAfEndpoints[index].endpoint = kInvalidEndpointId;
+        ramEndpointAt(index).endpoint = kInvalidEndpointId;
+        eraseDynamicEndpointIndexEntry(ep, index);
     }
 
     emberMetadataStructureGeneration++;
@@ -354,7 +1017,7 @@ uint16_t emberAfEndpointCount()
 
 bool emberAfEndpointIndexIsEnabled(uint16_t index)
 {
-    return (emAfEndpoints[index].bitmask.Has(EmberAfEndpointOptions::isEnabled));
+    return (endpointOptionsAt(index).Has(EmberAfEndpointOptions::isEnabled));
 }
 
 // This function is used to call the per-cluster attribute changed callback
@@ -397,40 +1060,42 @@ Status emAfClusterPreAttributeChangedCallback(const ConcreteAttributePath & attr
     return status;
 }
 
-static void initializeEndpoint(EmberAfDefinedEndpoint * definedEndpoint)
+static void initializeEndpoint(uint16_t endpointIndex)
 {
     uint8_t clusterIndex;
-    const EmberAfEndpointType * epType = definedEndpoint->endpointType;
+    const EndpointId endpoint          = endpointIdAt(endpointIndex);
+    const EmberAfEndpointType * epType = endpointTypeAt(endpointIndex);
     for (clusterIndex = 0; clusterIndex < epType->clusterCount; clusterIndex++)
     {
         const EmberAfCluster * cluster = &(epType->cluster[clusterIndex]);
         EmberAfGenericClusterFunction f;
-        emberAfClusterInitCallback(definedEndpoint->endpoint, cluster->clusterId);
+        emberAfClusterInitCallback(endpoint, cluster->clusterId);
         f = emberAfFindClusterFunction(cluster, CLUSTER_MASK_INIT_FUNCTION);
         if (f != nullptr)
         {
-            ((EmberAfInitFunction) f)(definedEndpoint->endpoint);
+            ((EmberAfInitFunction) f)(endpoint);
         }
     }
 }
 
-static void shutdownEndpoint(EmberAfDefinedEndpoint * definedEndpoint)
+static void shutdownEndpoint(uint16_t endpointIndex)
 {
     // Call shutdown callbacks from clusters, mainly for canceling pending timers
     uint8_t clusterIndex;
-    const EmberAfEndpointType * epType = definedEndpoint->endpointType;
+    const EndpointId endpoint          = endpointIdAt(endpointIndex);
+    const EmberAfEndpointType * epType = endpointTypeAt(endpointIndex);
     for (clusterIndex = 0; clusterIndex < epType->clusterCount; clusterIndex++)
     {
         const EmberAfCluster * cluster  = &(epType->cluster[clusterIndex]);
         EmberAfGenericClusterFunction f = emberAfFindClusterFunction(cluster, CLUSTER_MASK_SHUTDOWN_FUNCTION);
         if (f != nullptr)
         {
-            ((EmberAfShutdownFunction) f)(definedEndpoint->endpoint);
+            ((EmberAfShutdownFunction) f)(endpoint);
         }
     }
 
-    CommandHandlerInterfaceRegistry::Instance().UnregisterAllCommandHandlersForEndpoint(definedEndpoint->endpoint);
-    AttributeAccessInterfaceRegistry::Instance().UnregisterAllForEndpoint(definedEndpoint->endpoint);
+    CommandHandlerInterfaceRegistry::Instance().UnregisterAllCommandHandlersForEndpoint(endpoint);
+    AttributeAccessInterfaceRegistry::Instance().UnregisterAllForEndpoint(endpoint);
 }
 
 // Calls the init functions.
@@ -441,7 +1106,7 @@ void emAfCallInits()
     {
         if (emberAfEndpointIndexIsEnabled(index))
         {
-            initializeEndpoint(&(emAfEndpoints[index]));
+            initializeEndpoint(index);
         }
     }
 }
@@ -461,21 +1126,6 @@ const EmberAfAttributeMetadata * emberAfLocateAttributeMetadata(EndpointId endpo
     return metadata;
 }
 
-static uint8_t * singletonAttributeLocation(const EmberAfAttributeMetadata * am)
-{
-    const EmberAfAttributeMetadata * m = &(generatedAttributes[0]);
-    uint16_t index                     = 0;
-    while (m < am)
-    {
-        if (m->IsSingleton() && !m->IsExternal())
-        {
-            index = static_cast<uint16_t>(index + m->size);
-        }
-        m++;
-    }
-    return (uint8_t *) (singletonAttributeData + index);
-}
-
 // This function does mem copy, but smartly, which means that if the type is a
 // string, it will copy as much as it can.
 // If src == NULL, then this method will set memory to zeroes
@@ -562,6 +1212,42 @@ bool emAfMatchAttribute(const EmberAfCluster * cluster, const EmberAfAttributeMe
     return (am->attributeId == attRecord->attributeId);
 }
 
+/**
+ * @brief Finds the attribute of the search record in a cluster.
+ *   Binary searches the clusters generated by ZAP whose attributes are in
+ *   ascending id order, and walks the others.
+ *
+ * Returns the index of the attribute in the cluster, or the attribute count of
+ * the cluster if it is not there.
+ */
+static uint16_t findAttributeIndex(const EmberAfCluster * cluster, const EmberAfAttributeSearchRecord * attRecord)
+{
+#ifdef GENERATED_CLUSTERS
+    if (hasSortedAttributes(cluster))
+    {
+        auto idLess = [](const EmberAfAttributeMetadata & a, AttributeId id) { return a.attributeId < id; };
+
+        const EmberAfAttributeMetadata * begin = cluster->attributes;
+        const EmberAfAttributeMetadata * end   = begin + cluster->attributeCount;
+        const EmberAfAttributeMetadata * am    = std::lower_bound(begin, end, attRecord->attributeId, idLess);
+        if (am != end && emAfMatchAttribute(cluster, am, attRecord))
+        {
+            return static_cast<uint16_t>(am - begin);
+        }
+        return cluster->attributeCount;
+    }
+#endif // GENERATED_CLUSTERS
+
+    for (uint16_t attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+    {
+        if (emAfMatchAttribute(cluster, &(cluster->attributes[attrIndex]), attRecord))
+        {
+            return attrIndex;
+        }
+    }
+    return cluster->attributeCount;
+}
+
 // When reading non-string attributes, this function returns an error when destination
 // buffer isn't large enough to accommodate the attribute type.  For strings, the
 // function will copy at most readLength bytes.  This means the resulting string
@@ -580,117 +1266,83 @@ Status emAfReadOrWriteAttribute(const EmberAfAttributeSearchRecord * attRecord,
 {
     assertChipStackLockedByCurrentThread();
 
-    uint16_t attributeOffsetIndex = 0;
-
-    for (uint16_t ep = 0; ep < emberAfEndpointCount(); ep++)
+    // Disabled endpoints are not found.
+    const EndpointIndexEntry * indexEntry = lookupEndpoint(attRecord->endpoint, true /* ignoreDisabledEndpoints */);
+    if (indexEntry == nullptr)
     {
-        // Is this a dynamic endpoint?
-        bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
+        return Status::UnsupportedEndpoint; // Sorry, endpoint was not found.
+    }
 
-        if (emAfEndpoints[ep].endpoint == attRecord->endpoint)
-        {
-            const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
-            uint8_t clusterIndex;
-            if (!emberAfEndpointIndexIsEnabled(ep))
+    const uint16_t ep = indexEntry->index;
+    // Is this a dynamic endpoint?
+    const bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
+
+    const EmberAfEndpointType * endpointType = endpointTypeAt(ep);
+    uint8_t clusterIndex;
+    for (clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+    {
+        const EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
+        if (emAfMatchCluster(cluster, attRecord))
+        { // Got the cluster
+            const uint16_t attrIndex = findAttributeIndex(cluster, attRecord);
+            if (attrIndex == cluster->attributeCount)
             {
-                continue;
+                // Attribute is not in the cluster.
+                return Status::UnsupportedAttribute;
             }
-            for (clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+
+            const EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
+            // If passed metadata location is not null, populate
+            if (metadata != nullptr)
             {
-                const EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
-                if (emAfMatchCluster(cluster, attRecord))
-                { // Got the cluster
-                    uint16_t attrIndex;
-                    for (attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
-                    {
-                        const EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
-                        if (emAfMatchAttribute(cluster, am, attRecord))
-                        { // Got the attribute
-                            // If passed metadata location is not null, populate
-                            if (metadata != nullptr)
-                            {
-                                *metadata = am;
-                            }
+                *metadata = am;
+            }
 
-                            {
-                                uint8_t * attributeLocation =
-                                    (am->mask & ATTRIBUTE_MASK_SINGLETON ? singletonAttributeLocation(am)
-                                                                         : attributeData + attributeOffsetIndex);
-                                uint8_t *src, *dst;
-                                if (write)
-                                {
-                                    src = buffer;
-                                    dst = attributeLocation;
-                                    if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                             am->attributeId))
-                                    {
-                                        return Status::UnsupportedAccess;
-                                    }
-                                }
-                                else
-                                {
-                                    if (buffer == nullptr)
-                                    {
-                                        return Status::Success;
-                                    }
-
-                                    src = attributeLocation;
-                                    dst = buffer;
-                                    if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                            am->attributeId))
-                                    {
-                                        return Status::UnsupportedAccess;
-                                    }
-                                }
-
-                                // Is the attribute externally stored?
-                                if (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE)
-                                {
-                                    return (write ? emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                                          am, buffer)
-                                                  : emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                                         am, buffer, emberAfAttributeSize(am)));
-                                }
-
-                                // Internal storage is only supported for fixed endpoints
-                                if (!isDynamicEndpoint)
-                                {
-                                    return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
-                                }
-
-                                return Status::Failure;
-                            }
-                        }
-                        else
-                        { // Not the attribute we are looking for
-                            // Increase the index if attribute is not externally stored
-                            if (!(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am->mask & ATTRIBUTE_MASK_SINGLETON))
-                            {
-                                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
-                            }
-                        }
-                    }
+            if (write)
+            {
+                if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
+                {
+                    return Status::UnsupportedAccess;
+                }
+            }
+            else
+            {
+                if (buffer == nullptr)
+                {
+                    return Status::Success;
+                }
 
-                    // Attribute is not in the cluster.
-                    return Status::UnsupportedAttribute;
+                if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
+                {
+                    return Status::UnsupportedAccess;
                 }
+            }
 
-                // Not the cluster we are looking for
-                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
+            // Is the attribute externally stored?
+            if (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE)
+            {
+                return (write ? emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am, buffer)
+                              : emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am, buffer,
+                                                                     emberAfAttributeSize(am)));
             }
 
-            // Cluster is not in the endpoint.
-            return Status::UnsupportedCluster;
-        }
+            // Internal storage is only supported for fixed endpoints
+            if (isDynamicEndpoint)
+            {
+                return Status::Failure;
+            }
 
-        // Not the endpoint we are looking for
-        // Dynamic endpoints are external and don't factor into storage size
-        if (!isDynamicEndpoint)
-        {
-            attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emAfEndpoints[ep].endpointType->endpointSize);
+#if FIXED_ENDPOINT_COUNT > 0
+            // The storage of the endpoint follows that of the fixed endpoints before it.
+            uint8_t * attributeLocation = internalAttributeLocation(indexEntry->storageOffset, am);
+            return write ? typeSensitiveMemCopy(attRecord->clusterId, attributeLocation, buffer, am, write, readLength)
+                         : typeSensitiveMemCopy(attRecord->clusterId, buffer, attributeLocation, am, write, readLength);
+#endif // FIXED_ENDPOINT_COUNT > 0
         }
     }
-    return Status::UnsupportedEndpoint; // Sorry, endpoint was not found.
+
+    // Cluster is not in the endpoint.
+    return Status::UnsupportedCluster;
 }
 
 const EmberAfEndpointType * emberAfFindEndpointType(EndpointId endpointId)
@@ -700,7 +1352,7 @@ const EmberAfEndpointType * emberAfFindEndpointType(EndpointId endpointId)
     {
         return nullptr;
     }
-    return emAfEndpoints[ep].endpointType;
+    return endpointTypeAt(ep);
 }
 
 const EmberAfCluster * emberAfFindClusterInType(const EmberAfEndpointType * endpointType, ClusterId clusterId,
@@ -734,19 +1386,16 @@ const EmberAfCluster * emberAfFindClusterInType(const EmberAfEndpointType * endp
 
 uint8_t emberAfClusterIndex(EndpointId endpoint, ClusterId clusterId, EmberAfClusterMask mask)
 {
-    for (uint16_t ep = 0; ep < emberAfEndpointCount(); ep++)
+    uint16_t ep = findIndexFromEndpoint(endpoint, false /* ignoreDisabledEndpoints */);
+    if (ep == kEmberInvalidEndpointIndex)
     {
-        // Check the endpoint id first, because that way we avoid examining the
-        // endpoint type for endpoints that are not actually defined.
-        if (emAfEndpoints[ep].endpoint == endpoint)
-        {
-            const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
-            uint8_t index                            = 0xFF;
-            if (emberAfFindClusterInType(endpointType, clusterId, mask, &index) != nullptr)
-            {
-                return index;
-            }
-        }
+        return 0xFF;
+    }
+
+    uint8_t index = 0xFF;
+    if (emberAfFindClusterInType(endpointTypeAt(ep), clusterId, mask, &index) != nullptr)
+    {
+        return index;
     }
     return 0xFF;
 }
@@ -766,7 +1415,7 @@ bool emberAfContainsClient(EndpointId endpoint, ClusterId clusterId)
         return false;
     }
 
-    return (emberAfFindClusterInType(emAfEndpoints[ep].endpointType, clusterId, CLUSTER_MASK_CLIENT) != nullptr);
+    return (emberAfFindClusterInType(endpointTypeAt(ep), clusterId, CLUSTER_MASK_CLIENT) != nullptr);
 }
 
 // This will find the first server that has the clusterId given from the index of endpoint.
@@ -777,7 +1426,7 @@ bool emberAfContainsServerFromIndex(uint16_t index, ClusterId clusterId)
         return false;
     }
 
-    return emberAfFindClusterInType(emAfEndpoints[index].endpointType, clusterId, CLUSTER_MASK_SERVER);
+    return emberAfFindClusterInType(endpointTypeAt(index), clusterId, CLUSTER_MASK_SERVER);
 }
 
 namespace chip {
@@ -829,7 +1478,7 @@ const EmberAfCluster * emberAfFindServerCluster(EndpointId endpoint, ClusterId c
         return nullptr;
     }
 
-    return emberAfFindClusterInType(emAfEndpoints[ep].endpointType, clusterId, CLUSTER_MASK_SERVER);
+    return emberAfFindClusterInType(endpointTypeAt(ep), clusterId, CLUSTER_MASK_SERVER);
 }
 
 // Returns cluster within the endpoint; Does not ignore disabled endpoints
@@ -839,7 +1488,7 @@ const EmberAfCluster * emberAfFindClusterIncludingDisabledEndpoints(EndpointId e
     uint16_t ep = emberAfIndexFromEndpointIncludingDisabledEndpoints(endpoint);
     if (ep < MAX_ENDPOINT_COUNT)
     {
-        return emberAfFindClusterInType(emAfEndpoints[ep].endpointType, clusterId, mask);
+        return emberAfFindClusterInType(endpointTypeAt(ep), clusterId, mask);
     }
     return nullptr;
 }
@@ -855,7 +1504,7 @@ uint16_t emberAfGetClusterServerEndpointIndex(EndpointId endpoint, ClusterId clu
         return kEmberInvalidEndpointIndex;
     }
 
-    if (emberAfFindClusterInType(emAfEndpoints[epIndex].endpointType, cluster, CLUSTER_MASK_SERVER) == nullptr)
+    if (emberAfFindClusterInType(endpointTypeAt(epIndex), cluster, CLUSTER_MASK_SERVER) == nullptr)
     {
         // The provided endpoint does not contain the given cluster server.
         return kEmberInvalidEndpointIndex;
@@ -870,8 +1519,8 @@ uint16_t emberAfGetClusterServerEndpointIndex(EndpointId endpoint, ClusterId clu
         {
             // Increase adjustedEndpointIndex for every endpoint containing the cluster server
             // before our endpoint of interest
-            if (emAfEndpoints[i].endpoint != kInvalidEndpointId &&
-                (emberAfFindClusterInType(emAfEndpoints[i].endpointType, cluster, CLUSTER_MASK_SERVER) != nullptr))
+            if (endpointIdAt(i) != kInvalidEndpointId &&
+                (emberAfFindClusterInType(endpointTypeAt(i), cluster, CLUSTER_MASK_SERVER) != nullptr))
             {
                 adjustedEndpointIndex++;
             }
@@ -903,6 +1552,107 @@ bool emberAfEndpointIsEnabled(EndpointId endpoint)
     return emberAfEndpointIndexIsEnabled(index);
 }
 
+static void partsListChanged(EndpointId endpoint)
+{
+    emberAfAttributeChanged(endpoint, Clusters::Descriptor::Id, Clusters::Descriptor::Attributes::PartsList::Id,
+                            emberAfGlobalInteractionModelAttributesChangedListener());
+}
+
+// Defers to the end of the dynamic endpoint change batch in progress, if any,
+// the change of the PartsList of a parent of an endpoint.
+static void batchPartsListChanged(EndpointId parentEndpointId)
+{
+    DynamicEndpointChangeBatch & batch = dynamicEndpointChangeBatch;
+    if (batch.tooManyParents || std::find(batch.parents, batch.parents + batch.parentCount, parentEndpointId) !=
+            batch.parents + batch.parentCount)
+    {
+        return;
+    }
+
+    if (batch.parentCount == kMaxBatchedPartsListParents)
+    {
+        batch.tooManyParents = true;
+        return;
+    }
+    batch.parents[batch.parentCount++] = parentEndpointId;
+}
+
+// Marks as changed the PartsList of the root endpoint and of the parents of
+// the endpoint at the given index, which got enabled or disabled.
+static void partsListsChanged(uint16_t index)
+{
+    const bool batched = (dynamicEndpointChangeBatch.depth > 0);
+
+    EndpointId parentEndpointId = emberAfParentEndpointFromIndex(index);
+    while (parentEndpointId != kInvalidEndpointId)
+    {
+        if (batched)
+        {
+            batchPartsListChanged(parentEndpointId);
+        }
+        else
+        {
+            partsListChanged(parentEndpointId);
+        }
+        uint16_t parentIndex = emberAfIndexFromEndpoint(parentEndpointId);
+        if (parentIndex == kEmberInvalidEndpointIndex)
+        {
+            // Something has gone wrong.
+            break;
+        }
+        parentEndpointId = emberAfParentEndpointFromIndex(parentIndex);
+    }
+
+    if (batched)
+    {
+        dynamicEndpointChangeBatch.partsListsChanged = true;
+    }
+    else
+    {
+        partsListChanged(/* endpoint = */ 0);
+    }
+}
+
+void emberAfBeginDynamicEndpointChanges()
+{
+    assertChipStackLockedByCurrentThread();
+
+    dynamicEndpointChangeBatch.depth++;
+}
+
+void emberAfEndDynamicEndpointChanges()
+{
+    assertChipStackLockedByCurrentThread();
+
+    DynamicEndpointChangeBatch & batch = dynamicEndpointChangeBatch;
+    VerifyOrReturn(batch.depth > 0);
+    VerifyOrReturn(--batch.depth == 0);
+    VerifyOrReturn(batch.partsListsChanged);
+
+    if (batch.tooManyParents)
+    {
+        for (uint16_t index = 0; index < emberAfEndpointCount(); index++)
+        {
+            EndpointId endpoint = emberAfEndpointFromIndex(index);
+            if (emberAfEndpointIndexIsEnabled(index) && endpoint != 0 &&
+                emberAfFindServerCluster(endpoint, Clusters::Descriptor::Id) != nullptr)
+            {
+                partsListChanged(endpoint);
+            }
+        }
+    }
+    else
+    {
+        for (uint8_t i = 0; i < batch.parentCount; i++)
+        {
+            partsListChanged(batch.parents[i]);
+        }
+    }
+    partsListChanged(/* endpoint = */ 0);
+
+    batch = DynamicEndpointChangeBatch();
+}
+
 bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable)
 {
     uint16_t index = findIndexFromEndpoint(endpoint, false /* ignoreDisabledEndpoints */);
@@ -913,42 +1663,29 @@ bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable)
         return false;
     }
 
-    currentlyEnabled = emAfEndpoints[index].bitmask.Has(EmberAfEndpointOptions::isEnabled);
+    currentlyEnabled = endpointOptionsAt(index).Has(EmberAfEndpointOptions::isEnabled);
 
     if (enable)
     {
-        emAfEndpoints[index].bitmask.Set(EmberAfEndpointOptions::isEnabled);
+        endpointOptionsAt(index).Set(EmberAfEndpointOptions::isEnabled);
     }
 
     if (currentlyEnabled != enable)
     {
         if (enable)
         {
-            initializeEndpoint(&(emAfEndpoints[index]));
+            addEndpointToTopology(index);
+            initializeEndpoint(index);
             emberAfEndpointChanged(endpoint, emberAfGlobalInteractionModelAttributesChangedListener());
         }
         else
         {
-            shutdownEndpoint(&(emAfEndpoints[index]));
-            emAfEndpoints[index].bitmask.Clear(EmberAfEndpointOptions::isEnabled);
-        }
-
-        EndpointId parentEndpointId = emberAfParentEndpointFromIndex(index);
-        while (parentEndpointId != kInvalidEndpointId)
-        {
-            emberAfAttributeChanged(parentEndpointId, Clusters::Descriptor::Id, Clusters::Descriptor::Attributes::PartsList::Id,
-                                    emberAfGlobalInteractionModelAttributesChangedListener());
-            uint16_t parentIndex = emberAfIndexFromEndpoint(parentEndpointId);
-            if (parentIndex == kEmberInvalidEndpointIndex)
-            {
-                // Something has gone wrong.
-                break;
-            }
-            parentEndpointId = emberAfParentEndpointFromIndex(parentIndex);
+            shutdownEndpoint(index);
+            endpointOptionsAt(index).Clear(EmberAfEndpointOptions::isEnabled);
+            removeEndpointFromTopology(index);
         }
 
-        emberAfAttributeChanged(/* endpoint = */ 0, Clusters::Descriptor::Id, Clusters::Descriptor::Attributes::PartsList::Id,
-                                emberAfGlobalInteractionModelAttributesChangedListener());
+        partsListsChanged(index);
     }
 
     emberMetadataStructureGeneration++;
@@ -968,12 +1705,27 @@ uint16_t emberAfIndexFromEndpoint(EndpointId endpoint)
 
 EndpointId emberAfEndpointFromIndex(uint16_t index)
 {
-    return emAfEndpoints[index].endpoint;
+    return endpointIdAt(index);
 }
 
 EndpointId emberAfParentEndpointFromIndex(uint16_t index)
 {
-    return emAfEndpoints[index].parentEndpointId;
+    return parentEndpointIdAt(index);
+}
+
+uint16_t emberAfParentEndpointIndexFromIndex(uint16_t index)
+{
+    return (index < MAX_ENDPOINT_COUNT) ? endpointTopology[index].parent : kEmberInvalidEndpointIndex;
+}
+
+uint16_t emberAfFirstChildEndpointIndexFromIndex(uint16_t index)
+{
+    return (index < MAX_ENDPOINT_COUNT) ? endpointTopology[index].firstChild : kEmberInvalidEndpointIndex;
+}
+
+uint16_t emberAfNextSiblingEndpointIndexFromIndex(uint16_t index)
+{
+    return (index < MAX_ENDPOINT_COUNT) ? endpointTopology[index].nextSibling : kEmberInvalidEndpointIndex;
 }
 
 // If server == true, returns the number of server clusters,
@@ -991,13 +1743,13 @@ uint8_t emberAfClusterCount(EndpointId endpoint, bool server)
 
 uint8_t emberAfClusterCountByIndex(uint16_t endpointIndex, bool server)
 {
-    const EmberAfDefinedEndpoint * de = &(emAfEndpoints[endpointIndex]);
-    if (de->endpointType == nullptr)
+    const EmberAfEndpointType * endpointType = endpointTypeAt(endpointIndex);
+    if (endpointType == nullptr)
     {
         return 0;
     }
 
-    return emberAfClusterCountForEndpointType(de->endpointType, server);
+    return emberAfClusterCountForEndpointType(endpointType, server);
 }
 
 uint8_t emberAfClusterCountForEndpointType(const EmberAfEndpointType * type, bool server)
@@ -1015,7 +1767,7 @@ uint8_t emberAfGetClusterCountForEndpoint(EndpointId endpoint)
     {
         return 0;
     }
-    return emAfEndpoints[index].endpointType->clusterCount;
+    return endpointTypeAt(index)->clusterCount;
 }
 
 Span<const EmberAfDeviceType> emberAfDeviceTypeListFromEndpoint(EndpointId endpoint, CHIP_ERROR & err)
@@ -1032,7 +1784,7 @@ chip::Span<const EmberAfDeviceType> emberAfDeviceTypeListFromEndpointIndex(unsig
     }
 
     err = CHIP_NO_ERROR;
-    return emAfEndpoints[endpointIndex].deviceTypeList;
+    return deviceTypeListAt(static_cast<uint16_t>(endpointIndex));
 }
 
 CHIP_ERROR GetSemanticTagForEndpointAtIndex(EndpointId endpoint, size_t index,
@@ -1040,11 +1792,11 @@ CHIP_ERROR GetSemanticTagForEndpointAtIndex(EndpointId endpoint, size_t index,
 {
     uint16_t endpointIndex = emberAfIndexFromEndpoint(endpoint);
 
-    if (endpointIndex == 0xFFFF || index >= emAfEndpoints[endpointIndex].tagList.size())
+    if (endpointIndex == 0xFFFF || index >= tagListAt(endpointIndex).size())
     {
         return CHIP_ERROR_NOT_FOUND;
     }
-    tag = emAfEndpoints[endpointIndex].tagList[index];
+    tag = tagListAt(endpointIndex)[index];
     return CHIP_NO_ERROR;
 }
 
@@ -1056,7 +1808,11 @@ CHIP_ERROR emberAfSetDeviceTypeList(EndpointId endpoint, Span<const EmberAfDevic
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
 
-    emAfEndpoints[endpointIndex].deviceTypeList = deviceTypeList;
+#if EMBER_AF_ROM_FIXED_ENDPOINTS
+    // Served from the generated tables.
+    VerifyOrReturnError(!isRomEndpointIndex(endpointIndex), CHIP_ERROR_NOT_IMPLEMENTED);
+#endif
+    ramEndpointAt(endpointIndex).deviceTypeList = deviceTypeList;
     return CHIP_NO_ERROR;
 }
 
@@ -1068,7 +1824,7 @@ CHIP_ERROR SetTagList(EndpointId endpoint, Span<const Clusters::Descriptor::Stru
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
 
-    emAfEndpoints[endpointIndex].tagList = tagList;
+    tagListAt(endpointIndex) = tagList;
     return CHIP_NO_ERROR;
 }
 
@@ -1082,7 +1838,7 @@ const EmberAfCluster * emberAfGetNthCluster(EndpointId endpoint, uint8_t n, bool
         return nullptr;
     }
 
-    const EmberAfEndpointType * endpointType = emAfEndpoints[index].endpointType;
+    const EmberAfEndpointType * endpointType = endpointTypeAt(index);
     const EmberAfClusterMask cluster_mask    = server ? CLUSTER_MASK_SERVER : CLUSTER_MASK_CLIENT;
     const uint8_t clusterCount               = endpointType->clusterCount;
 
@@ -1157,7 +1913,6 @@ void emAfLoadAttributeDefaults(EndpointId endpoint, Optional<ClusterId> clusterI
 
     for (ep = 0; ep < epCount; ep++)
     {
-        EmberAfDefinedEndpoint * de;
         if (endpoint != kInvalidEndpointId)
         {
             ep = emberAfIndexFromEndpoint(endpoint);
@@ -1166,11 +1921,12 @@ void emAfLoadAttributeDefaults(EndpointId endpoint, Optional<ClusterId> clusterI
                 return;
             }
         }
-        de = &(emAfEndpoints[ep]);
+        const EndpointId endpointId              = endpointIdAt(ep);
+        const EmberAfEndpointType * endpointType = endpointTypeAt(ep);
 
-        for (clusterI = 0; clusterI < de->endpointType->clusterCount; clusterI++)
+        for (clusterI = 0; clusterI < endpointType->clusterCount; clusterI++)
         {
-            const EmberAfCluster * cluster = &(de->endpointType->cluster[clusterI]);
+            const EmberAfCluster * cluster = &(endpointType->cluster[clusterI]);
             if (clusterId.HasValue())
             {
                 if (clusterId.Value() != cluster->clusterId)
@@ -1198,7 +1954,7 @@ void emAfLoadAttributeDefaults(EndpointId endpoint, Optional<ClusterId> clusterI
                     VerifyOrDieWithMsg(attrStorage != nullptr, Zcl, "Attribute persistence needs a persistence provider");
                     MutableByteSpan bytes(attrData);
                     CHIP_ERROR err =
-                        attrStorage->ReadValue(ConcreteAttributePath(de->endpoint, cluster->clusterId, am->attributeId), am, bytes);
+                        attrStorage->ReadValue(ConcreteAttributePath(endpointId, cluster->clusterId, am->attributeId), am, bytes);
                     if (err == CHIP_NO_ERROR)
                     {
                         ptr = attrData;
@@ -1208,7 +1964,7 @@ void emAfLoadAttributeDefaults(EndpointId endpoint, Optional<ClusterId> clusterI
                         ChipLogDetail(
                             DataManagement,
                             "Failed to read stored attribute (%u, " ChipLogFormatMEI ", " ChipLogFormatMEI ": %" CHIP_ERROR_FORMAT,
-                            de->endpoint, ChipLogValueMEI(cluster->clusterId), ChipLogValueMEI(am->attributeId), err.Format());
+                            endpointId, ChipLogValueMEI(cluster->clusterId), ChipLogValueMEI(am->attributeId), err.Format());
                         // Just fall back to default value.
                     }
                 }
@@ -1216,7 +1972,7 @@ void emAfLoadAttributeDefaults(EndpointId endpoint, Optional<ClusterId> clusterI
                 if (!am->IsExternal())
                 {
                     EmberAfAttributeSearchRecord record;
-                    record.endpoint    = de->endpoint;
+                    record.endpoint    = endpointId;
                     record.clusterId   = cluster->clusterId;
                     record.attributeId = am->attributeId;
 
@@ -1367,7 +2123,9 @@ CHIP_ERROR SetParentEndpointForEndpoint(EndpointId childEndpoint, EndpointId par
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
-    emAfEndpoints[childIndex].parentEndpointId = parentEndpoint;
+    removeEndpointFromTopology(childIndex);
+    parentEndpointIdAt(childIndex) = parentEndpoint;
+    addEndpointToTopology(childIndex);
     return CHIP_NO_ERROR;
 }
 
@@ -1378,8 +2136,8 @@ CHIP_ERROR SetFlatCompositionForEndpoint(EndpointId endpoint)
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
-    emAfEndpoints[index].bitmask.Clear(EmberAfEndpointOptions::isTreeComposition);
-    emAfEndpoints[index].bitmask.Set(EmberAfEndpointOptions::isFlatComposition);
+    endpointOptionsAt(index).Clear(EmberAfEndpointOptions::isTreeComposition);
+    endpointOptionsAt(index).Set(EmberAfEndpointOptions::isFlatComposition);
     return CHIP_NO_ERROR;
 }
 
@@ -1390,8 +2148,8 @@ CHIP_ERROR SetTreeCompositionForEndpoint(EndpointId endpoint)
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
-    emAfEndpoints[index].bitmask.Clear(EmberAfEndpointOptions::isFlatComposition);
-    emAfEndpoints[index].bitmask.Set(EmberAfEndpointOptions::isTreeComposition);
+    endpointOptionsAt(index).Clear(EmberAfEndpointOptions::isFlatComposition);
+    endpointOptionsAt(index).Set(EmberAfEndpointOptions::isTreeComposition);
     return CHIP_NO_ERROR;
 }
 
@@ -1402,7 +2160,7 @@ bool IsFlatCompositionForEndpoint(EndpointId endpoint)
     {
         return false;
     }
-    return emAfEndpoints[index].bitmask.Has(EmberAfEndpointOptions::isFlatComposition);
+    return endpointOptionsAt(index).Has(EmberAfEndpointOptions::isFlatComposition);
 }
 
 bool IsTreeCompositionForEndpoint(EndpointId endpoint)
@@ -1412,7 +2170,7 @@ bool IsTreeCompositionForEndpoint(EndpointId endpoint)
     {
         return false;
     }
-    return emAfEndpoints[index].bitmask.Has(EmberAfEndpointOptions::isTreeComposition);
+    return endpointOptionsAt(index).Has(EmberAfEndpointOptions::isTreeComposition);
 }
 
 } // namespace app
@@ -1458,8 +2216,8 @@ DataVersion * emberAfDataVersionStorage(const ConcreteClusterPath & aConcreteClu
         // Unknown endpoint.
         return nullptr;
     }
-    const EmberAfDefinedEndpoint & ep = emAfEndpoints[index];
-    if (!ep.dataVersions)
+    DataVersion * dataVersions = dataVersionsAt(index);
+    if (!dataVersions)
     {
         // No storage provided.
         return nullptr;
@@ -1474,7 +2232,7 @@ DataVersion * emberAfDataVersionStorage(const ConcreteClusterPath & aConcreteClu
         return nullptr;
     }
 
-    return ep.dataVersions + clusterIndex;
+    return dataVersions + clusterIndex;
 }
 
 namespace {
@@ -131,6 +131,26 @@ uint16_t emberAfIndexFromEndpoint(chip::EndpointId endpoint);
  */
 chip::EndpointId emberAfParentEndpointFromIndex(uint16_t index);
 
+/**
+ * @brief Returns the index of the parent of the enabled endpoint at the given
+ * index, or kEmberInvalidEndpointIndex if it has no enabled parent.
+ */
+uint16_t emberAfParentEndpointIndexFromIndex(uint16_t index);
+
+/**
+ * @brief Returns the index of the first enabled child of the enabled endpoint at
+ * the given index, or kEmberInvalidEndpointIndex if it has none.  The children
+ * of an endpoint are sorted by index.
+ */
+uint16_t emberAfFirstChildEndpointIndexFromIndex(uint16_t index);
+
+/**
+ * @brief Returns the index of the enabled child of the same parent that follows
+ * the enabled endpoint at the given index, or kEmberInvalidEndpointIndex if it
+ * is the last one.
+ */
+uint16_t emberAfNextSiblingEndpointIndexFromIndex(uint16_t index);
+
 /**
  *  @brief Returns the index of the given endpoint in the list of all endpoints that might support the given cluster server.
  *
@@ -262,6 +282,50 @@ CHIP_ERROR emberAfSetDynamicEndpoint(uint16_t index, chip::EndpointId id, const
                                      chip::EndpointId parentEndpointId                  = chip::kInvalidEndpointId);
 chip::EndpointId emberAfClearDynamicEndpoint(uint16_t index);
 uint16_t emberAfGetDynamicIndexFromEndpoint(chip::EndpointId id);
+
+// One of the dynamic endpoints registered by emberAfSetDynamicEndpoints. The
+// arguments are the ones of emberAfSetDynamicEndpoint, except for the storage of
+// the data versions.
+struct EmberAfDynamicEndpointDefinition
+{
+    uint16_t index;
+    chip::EndpointId id;
+    const EmberAfEndpointType * endpointType;
+    chip::Span<const EmberAfDeviceType> deviceTypeList = {};
+    chip::EndpointId parentEndpointId                  = chip::kInvalidEndpointId;
+};
+
+// Returns the number of data versions emberAfSetDynamicEndpoints needs for the
+// given endpoints: the total of their server clusters.
+size_t emberAfDynamicEndpointsDataVersionCount(chip::Span<const EmberAfDynamicEndpointDefinition> endpoints);
+
+// Register several dynamic endpoints at once, such as all the devices of a
+// bridge at startup. This is one dynamic endpoint change batch (see
+// emberAfBeginDynamicEndpointChanges below): the PartsLists are only marked as
+// changed once for all the endpoints.
+//
+// The data versions of all the endpoints are carved, in order, out of the single
+// dataVersionStorage block, which needs to hold at least
+// emberAfDynamicEndpointsDataVersionCount(endpoints) data versions and to remain
+// allocated until these dynamic endpoints are cleared.
+//
+// Either all the endpoints are registered, or none: if one of them fails, the
+// ones registered before it are cleared again and its error is returned. The
+// errors are the ones of emberAfSetDynamicEndpoint.
+//
+// Has to be called with the Matter stack lock held.
+CHIP_ERROR emberAfSetDynamicEndpoints(chip::Span<const EmberAfDynamicEndpointDefinition> endpoints,
+                                      const chip::Span<chip::DataVersion> & dataVersionStorage);
+
+// Batch the changes of the dynamic endpoints, such as a bridge adding or removing
+// many devices at once: between these calls, the PartsList of the root endpoint
+// and of the parents of the endpoints added, removed, enabled or disabled are
+// only marked as changed once, by emberAfEndDynamicEndpointChanges(), instead of
+// once per endpoint. Batches can be nested; the outermost one reports the changes.
+//
+// Both have to be called with the Matter stack lock held.
+void emberAfBeginDynamicEndpointChanges();
+void emberAfEndDynamicEndpointChanges();
 /**
  * @brief Loads attribute defaults and any non-volatile attributes stored
  *
@@ -289,6 +353,8 @@ chip::Span<const EmberAfDeviceType> emberAfDeviceTypeListFromEndpointIndex(unsig
 //
 // NOTE: It is the application's responsibility to free the existing list that is being replaced if needed.
 //
+// Returns CHIP_ERROR_NOT_IMPLEMENTED for a fixed endpoint if CHIP_CONFIG_ROM_FIXED_ENDPOINT_TABLE is set.
+//
 CHIP_ERROR emberAfSetDeviceTypeList(chip::EndpointId endpoint, chip::Span<const EmberAfDeviceType> deviceTypeList);
 
 /// Returns a change listener that uses the global InteractionModelEngine
@@ -210,6 +210,11 @@ MockNodeConfig::MockNodeConfig(std::initializer_list<MockEndpointConfig> aEndpoi
     VerifyOrDie(aEndpoints.size() < kEmberInvalidEndpointIndex);
 }
 
+MockNodeConfig::MockNodeConfig(std::vector<MockEndpointConfig> aEndpoints) : endpoints(std::move(aEndpoints))
+{
+    VerifyOrDie(endpoints.size() < kEmberInvalidEndpointIndex);
+}
+
 const MockEndpointConfig * MockNodeConfig::endpointById(EndpointId endpointId, ptrdiff_t * outIndex) const
 {
     return findById(endpoints, endpointId, outIndex);
@@ -99,6 +99,50 @@ CHIP_ERROR DefaultAttributePersistenceProvider::SafeReadValue(const ConcreteAttr
         DefaultStorageKeyAllocator::SafeAttributeValue(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId), aValue);
 }
 
+CHIP_ERROR DefaultAttributePersistenceProvider::StartPatch(const ConcreteAttributePath & aPath, TLV::Tag aTag,
+                                                           MutableByteSpan & aScratch, TLV::TLVUpdater & aUpdater)
+{
+    ReturnErrorOnFailure(InternalReadValue(
+        DefaultStorageKeyAllocator::SafeAttributeValue(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId), aScratch));
+    VerifyOrReturnError(CanCastTo<uint32_t>(aScratch.size()), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    // No free space, so that the updater patches the value where it was read.
+    const uint32_t length = static_cast<uint32_t>(aScratch.size());
+    ReturnErrorOnFailure(aUpdater.Init(aScratch.data(), length, length));
+    ReturnErrorOnFailure(aUpdater.Next());
+    if (aUpdater.GetTag() == aTag)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    VerifyOrReturnError(TLV::TLVTypeIsContainer(aUpdater.GetType()), CHIP_ERROR_TLV_TAG_NOT_FOUND);
+    TLV::TLVType outerContainerType;
+    ReturnErrorOnFailure(aUpdater.EnterContainer(outerContainerType));
+    while (true)
+    {
+        CHIP_ERROR err = aUpdater.Next();
+        VerifyOrReturnError(err != CHIP_END_OF_TLV, CHIP_ERROR_TLV_TAG_NOT_FOUND);
+        ReturnErrorOnFailure(err);
+        if (aUpdater.GetTag() == aTag)
+        {
+            return CHIP_NO_ERROR;
+        }
+        ReturnErrorOnFailure(aUpdater.Move());
+    }
+}
+
+CHIP_ERROR DefaultAttributePersistenceProvider::FinishPatch(const ConcreteAttributePath & aPath, const MutableByteSpan & aScratch,
+                                                            TLV::TLVUpdater & aUpdater)
+{
+    aUpdater.MoveUntilEnd();
+    ReturnErrorOnFailure(aUpdater.Finalize());
+    VerifyOrReturnError(aUpdater.GetLengthWritten() == aScratch.size(), CHIP_ERROR_INTERNAL);
+
+    // The storage delegate can only replace a whole value, but it is written back as read, with just the scalar patched.
+    return InternalWriteValue(
+        DefaultStorageKeyAllocator::SafeAttributeValue(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId), aScratch);
+}
+
 namespace {
 
 AttributePersistenceProvider * gAttributeSaver = nullptr;
@@ -18,6 +18,7 @@
 #include <app/SafeAttributePersistenceProvider.h>
 #include <app/util/persistence/AttributePersistenceProvider.h>
 #include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/core/TLVUpdater.h>
 #include <lib/support/DefaultStorageKeyAllocator.h>
 
 namespace chip {
@@ -58,6 +59,41 @@ public:
     CHIP_ERROR SafeWriteValue(const ConcreteAttributePath & aPath, const ByteSpan & aValue) override;
     CHIP_ERROR SafeReadValue(const ConcreteAttributePath & aPath, MutableByteSpan & aValue) override;
 
+    /**
+     * Change one scalar of a TLV value stored with SafeWriteValue(), without re-encoding the value.
+     *
+     * The stored value must be a single TLV element: either the scalar itself (aTag is AnonymousTag()), or a
+     * structure or list with the scalar as a direct member tagged aTag.  The scalar keeps its TLV type and width
+     * (see TLVUpdater::ReplaceInPlace), so the stored value keeps its size; nothing is written if the value
+     * does not change.
+     *
+     * @param [in]    aPath     the attribute path of the stored value.
+     * @param [in]    aTag      the tag of the scalar to change.
+     * @param [in]    aValue    the new value of the scalar.
+     * @param [in]    aScratch  a buffer large enough to hold the stored value.
+     *
+     * @retval CHIP_ERROR_BUFFER_TOO_SMALL if aValue does not fit the width of the stored scalar, or the stored
+     *         value does not fit aScratch.  The caller has to encode the whole value and SafeWriteValue() it.
+     * @retval CHIP_ERROR_TLV_TAG_NOT_FOUND if the stored value has no scalar tagged aTag.
+     * @retval CHIP_ERROR_WRONG_TLV_TYPE if the element tagged aTag is not a scalar of a type compatible with T.
+     */
+    template <typename T>
+    CHIP_ERROR SafePatchScalarValue(const ConcreteAttributePath & aPath, TLV::Tag aTag, T aValue, MutableByteSpan aScratch)
+    {
+        TLV::TLVUpdater updater;
+        ReturnErrorOnFailure(StartPatch(aPath, aTag, aScratch, updater));
+
+        T currentValue;
+        ReturnErrorOnFailure(updater.Get(currentValue));
+        if (currentValue == aValue)
+        {
+            return CHIP_NO_ERROR;
+        }
+
+        ReturnErrorOnFailure(updater.ReplaceInPlace(aValue));
+        return FinishPatch(aPath, aScratch, updater);
+    }
+
 protected:
     PersistentStorageDelegate * mStorage;
 
@@ -66,6 +102,11 @@ private:
     CHIP_ERROR InternalReadValue(const StorageKeyName & aKey, MutableByteSpan & aValue);
     CHIP_ERROR InternalReadValue(const StorageKeyName & aKey, EmberAfAttributeType aType, size_t aExpectedSize,
                                  MutableByteSpan & aValue);
+
+    // Read the value stored for aPath into aScratch, and position an in-place updater on its element tagged aTag.
+    CHIP_ERROR StartPatch(const ConcreteAttributePath & aPath, TLV::Tag aTag, MutableByteSpan & aScratch,
+                          TLV::TLVUpdater & aUpdater);
+    CHIP_ERROR FinishPatch(const ConcreteAttributePath & aPath, const MutableByteSpan & aScratch, TLV::TLVUpdater & aUpdater);
 };
 
 } // namespace app
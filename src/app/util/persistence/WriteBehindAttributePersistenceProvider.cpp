@@ -0,0 +1,169 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/util/persistence/WriteBehindAttributePersistenceProvider.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <tracing/metric_event.h>
+#include <tracing/metric_keys.h>
+
+#include <algorithm>
+#include <string.h>
+#include <utility>
+
+namespace chip {
+namespace app {
+
+CHIP_ERROR WriteBehindAttribute::Set(const ConcreteAttributePath & path, const ByteSpan & value)
+{
+    if (mValue.AllocatedSize() != value.size())
+    {
+        // Allocate before freeing, so that a pending value survives a failed replacement.
+        Platform::ScopedMemoryBufferWithSize<uint8_t> buffer;
+        VerifyOrReturnError(buffer.Alloc(value.size()), CHIP_ERROR_NO_MEMORY);
+        mValue = std::move(buffer);
+    }
+
+    memcpy(mValue.Get(), value.data(), value.size());
+    mPath = path;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR WriteBehindAttribute::Flush(AttributePersistenceProvider & persister)
+{
+    VerifyOrReturnError(IsPending(), CHIP_NO_ERROR);
+    CHIP_ERROR err = persister.WriteValue(mPath, GetValue());
+    mValue.Free();
+    return err;
+}
+
+WriteBehindAttributePersistenceProvider::~WriteBehindAttributePersistenceProvider()
+{
+    Flush();
+}
+
+CHIP_ERROR WriteBehindAttributePersistenceProvider::WriteValue(const ConcreteAttributePath & aPath, const ByteSpan & aValue)
+{
+    // The timer may be late, or not running at all on a busy or shut down event loop.
+    FlushIfDue();
+
+    for (WriteBehindAttribute & slot : mSlots)
+    {
+        if (slot.Matches(aPath))
+        {
+            ReturnErrorOnFailure(slot.Set(aPath, aValue));
+            mCoalescedWriteCount++;
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    WriteBehindAttribute * freeSlot = nullptr;
+    for (WriteBehindAttribute & slot : mSlots)
+    {
+        if (!slot.IsPending())
+        {
+            freeSlot = &slot;
+            break;
+        }
+    }
+
+    // Empty values cannot be kept pending, see WriteBehindAttribute::IsPending().
+    if (freeSlot == nullptr || aValue.empty() || freeSlot->Set(aPath, aValue) != CHIP_NO_ERROR)
+    {
+        mWriteThroughCount++;
+        return mPersister.WriteValue(aPath, aValue);
+    }
+
+    if (mPendingWriteCount++ == 0)
+    {
+        mBatchStartTime = System::SystemClock().GetMonotonicTimestamp();
+        DeviceLayer::SystemLayer().StartTimer(mPolicy.maxDelay, OnFlushTimer, this);
+    }
+
+    // Flushing as the last slot is taken keeps a slot free for the next attribute.
+    if (mPendingWriteCount >= GetFlushThreshold())
+    {
+        return Flush();
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR WriteBehindAttributePersistenceProvider::ReadValue(const ConcreteAttributePath & aPath,
+                                                              const EmberAfAttributeMetadata * aMetadata, MutableByteSpan & aValue)
+{
+    for (const WriteBehindAttribute & slot : mSlots)
+    {
+        if (slot.Matches(aPath))
+        {
+            return CopySpanToMutableSpan(slot.GetValue(), aValue);
+        }
+    }
+
+    return mPersister.ReadValue(aPath, aMetadata, aValue);
+}
+
+CHIP_ERROR WriteBehindAttributePersistenceProvider::Flush()
+{
+    VerifyOrReturnError(mPendingWriteCount > 0, CHIP_NO_ERROR);
+
+    DeviceLayer::SystemLayer().CancelTimer(OnFlushTimer, this);
+
+    CHIP_ERROR firstError = CHIP_NO_ERROR;
+    for (WriteBehindAttribute & slot : mSlots)
+    {
+        CHIP_ERROR err = slot.Flush(mPersister);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Zcl, "Failed to write back an attribute value: %" CHIP_ERROR_FORMAT, err.Format());
+            if (firstError == CHIP_NO_ERROR)
+            {
+                firstError = err;
+            }
+        }
+    }
+
+    MATTER_LOG_METRIC(Tracing::kMetricAttributePersistenceFlushedWrites, static_cast<uint32_t>(mPendingWriteCount));
+    MATTER_LOG_METRIC(Tracing::kMetricAttributePersistenceCoalescedWrites, mCoalescedWriteCount);
+    MATTER_LOG_METRIC(Tracing::kMetricAttributePersistenceWriteThroughs, mWriteThroughCount);
+
+    mPendingWriteCount = 0;
+    mFlushCount++;
+    return firstError;
+}
+
+void WriteBehindAttributePersistenceProvider::OnFlushTimer(System::Layer * layer, void * me)
+{
+    static_cast<WriteBehindAttributePersistenceProvider *>(me)->Flush();
+}
+
+size_t WriteBehindAttributePersistenceProvider::GetFlushThreshold() const
+{
+    return (mPolicy.maxPendingWrites == 0) ? mSlots.size() : std::min(mPolicy.maxPendingWrites, mSlots.size());
+}
+
+void WriteBehindAttributePersistenceProvider::FlushIfDue()
+{
+    VerifyOrReturn(mPendingWriteCount > 0);
+    VerifyOrReturn(System::SystemClock().GetMonotonicTimestamp() - mBatchStartTime >= mPolicy.maxDelay);
+    Flush();
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,136 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/util/persistence/AttributePersistenceProvider.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/Span.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * Storage of one attribute value waiting to be written by WriteBehindAttributePersistenceProvider.
+ */
+class WriteBehindAttribute
+{
+public:
+    bool IsPending() const { return static_cast<bool>(mValue); }
+    bool Matches(const ConcreteAttributePath & path) const { return IsPending() && mPath == path; }
+    ByteSpan GetValue() const { return ByteSpan(mValue.Get(), mValue.AllocatedSize()); }
+
+    CHIP_ERROR Set(const ConcreteAttributePath & path, const ByteSpan & value);
+    CHIP_ERROR Flush(AttributePersistenceProvider & persister);
+
+private:
+    ConcreteAttributePath mPath;
+    Platform::ScopedMemoryBufferWithSize<uint8_t> mValue;
+};
+
+/**
+ * When the pending writes of WriteBehindAttributePersistenceProvider are written to the decorated persister.
+ */
+struct WriteBehindPolicy
+{
+    /// Longest time a written value waits for the flush, from the first write of the batch.
+    System::Clock::Milliseconds32 maxDelay = System::Clock::Milliseconds32(5000);
+    /// Number of pending attributes that triggers a flush, or 0 to flush only when all the slots are in use.
+    size_t maxPendingWrites = 0;
+};
+
+/**
+ * Decorator class for the AttributePersistenceProvider implementation that
+ * writes all attributes behind, in batches.
+ *
+ * Written values are kept in RAM, and repeated writes of the same attribute
+ * replace the pending value instead of reaching the decorated persister.  The
+ * pending values are written together once the oldest of them has waited for
+ * the maximum delay of the policy, once the policy's number of attributes are
+ * pending, or when Flush() is called.  Writes that cannot be held back, as
+ * there is no slot or no memory for the value, go straight to the decorated
+ * persister.
+ *
+ * Unlike DeferredAttributePersistenceProvider, the attributes do not have to
+ * be listed, and a value changing continuously, such as the CurrentLevel
+ * attribute of the LevelControl cluster during a transition, does not postpone
+ * its write forever: it is written at most once per maximum delay.
+ *
+ * Reads of an attribute with a pending value return that value.
+ *
+ * The provider, including its timer, is only used from the Matter event loop.
+ */
+class WriteBehindAttributePersistenceProvider : public AttributePersistenceProvider
+{
+public:
+    /**
+     * @param[in] persister  The persister the values are written to.
+     * @param[in] slots      Storage of the pending values, which has to outlive the provider.
+     * @param[in] policy     When the pending values are written.
+     */
+    WriteBehindAttributePersistenceProvider(AttributePersistenceProvider & persister, const Span<WriteBehindAttribute> & slots,
+                                            const WriteBehindPolicy & policy = WriteBehindPolicy()) :
+        mPersister(persister),
+        mSlots(slots), mPolicy(policy)
+    {}
+
+    ~WriteBehindAttributePersistenceProvider() override;
+
+    CHIP_ERROR WriteValue(const ConcreteAttributePath & aPath, const ByteSpan & aValue) override;
+    CHIP_ERROR ReadValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
+                         MutableByteSpan & aValue) override;
+
+    /**
+     * Write all the pending values to the decorated persister.  To be called on shutdown, and by the platform when it
+     * detects an imminent power loss.
+     *
+     * Values that fail to be written are dropped.  The destructor flushes as well.
+     *
+     * @return The first error of the decorated persister, if any.
+     */
+    CHIP_ERROR Flush();
+
+    size_t GetPendingWriteCount() const { return mPendingWriteCount; }
+    /// Writes replacing a pending value, so that they never reached the decorated persister.
+    uint32_t GetCoalescedWriteCount() const { return mCoalescedWriteCount; }
+    /// Writes that could not be held back and went straight to the decorated persister.
+    uint32_t GetWriteThroughCount() const { return mWriteThroughCount; }
+    uint32_t GetFlushCount() const { return mFlushCount; }
+
+private:
+    static void OnFlushTimer(System::Layer * layer, void * me);
+
+    size_t GetFlushThreshold() const;
+    void FlushIfDue();
+
+    AttributePersistenceProvider & mPersister;
+    const Span<WriteBehindAttribute> mSlots;
+    const WriteBehindPolicy mPolicy;
+    System::Clock::Timestamp mBatchStartTime;
+    size_t mPendingWriteCount     = 0;
+    uint32_t mCoalescedWriteCount = 0;
+    uint32_t mWriteThroughCount   = 0;
+    uint32_t mFlushCount          = 0;
+};
+
+} // namespace app
+} // namespace chip
@@ -351,4 +351,78 @@ TEST_F(TestAttributePersistenceProvider, TestBufferTooSmallErrors)
     persistenceProvider.Shutdown();
 }
 
+/**
+ * Tests patching a scalar of a stored TLV value in place
+ */
+TEST_F(TestAttributePersistenceProvider, TestPatchScalarValue)
+{
+    TestPersistentStorageDelegate storageDelegate;
+    DefaultAttributePersistenceProvider persistenceProvider;
+    EXPECT_EQ(persistenceProvider.Init(&storageDelegate), CHIP_NO_ERROR);
+
+    uint8_t encoded[32];
+    TLVWriter writer;
+    TLVType outerContainerType;
+    writer.Init(encoded);
+    EXPECT_EQ(writer.StartContainer(AnonymousTag(), kTLVType_Structure, outerContainerType), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.PutString(ContextTag(0), "name"), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Put(ContextTag(1), static_cast<uint16_t>(0x1234)), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.PutBoolean(ContextTag(2), false), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.EndContainer(outerContainerType), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+    const uint32_t encodedLen = writer.GetLengthWritten();
+    EXPECT_EQ(persistenceProvider.SafeWriteValue(TestConcretePath, ByteSpan(encoded, encodedLen)), CHIP_NO_ERROR);
+
+    uint8_t scratch[32];
+    EXPECT_EQ(persistenceProvider.SafePatchScalarValue(TestConcretePath, ContextTag(1), static_cast<uint16_t>(0xBEEF),
+                                                       MutableByteSpan(scratch)),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(persistenceProvider.SafePatchScalarValue(TestConcretePath, ContextTag(2), true, MutableByteSpan(scratch)),
+              CHIP_NO_ERROR);
+
+    // Values that need a wider encoding, or that are not there, are left to the caller.
+    EXPECT_EQ(persistenceProvider.SafePatchScalarValue(TestConcretePath, ContextTag(1), static_cast<uint32_t>(0x10000),
+                                                       MutableByteSpan(scratch)),
+              CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(persistenceProvider.SafePatchScalarValue(TestConcretePath, ContextTag(3), static_cast<uint8_t>(1),
+                                                       MutableByteSpan(scratch)),
+              CHIP_ERROR_TLV_TAG_NOT_FOUND);
+    EXPECT_EQ(persistenceProvider.SafePatchScalarValue(TestConcretePath, ContextTag(1), static_cast<uint16_t>(1),
+                                                       MutableByteSpan(scratch, encodedLen - 1)),
+              CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    // An unchanged value is not written.
+    storageDelegate.SetRejectWrites(true);
+    EXPECT_EQ(persistenceProvider.SafePatchScalarValue(TestConcretePath, ContextTag(2), true, MutableByteSpan(scratch)),
+              CHIP_NO_ERROR);
+    storageDelegate.SetRejectWrites(false);
+
+    uint8_t readBack[32];
+    MutableByteSpan readBackSpan(readBack);
+    EXPECT_EQ(persistenceProvider.SafeReadValue(TestConcretePath, readBackSpan), CHIP_NO_ERROR);
+    EXPECT_EQ(readBackSpan.size(), encodedLen);
+
+    TLVReader reader;
+    reader.Init(readBackSpan);
+    EXPECT_EQ(reader.Next(kTLVType_Structure, AnonymousTag()), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.EnterContainer(outerContainerType), CHIP_NO_ERROR);
+
+    CharSpan name;
+    EXPECT_EQ(reader.Next(ContextTag(0)), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Get(name), CHIP_NO_ERROR);
+    EXPECT_TRUE(name.data_equal(CharSpan::fromCharString("name")));
+
+    uint16_t value16;
+    EXPECT_EQ(reader.Next(ContextTag(1)), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Get(value16), CHIP_NO_ERROR);
+    EXPECT_EQ(value16, 0xBEEF);
+
+    bool flag;
+    EXPECT_EQ(reader.Next(ContextTag(2)), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Get(flag), CHIP_NO_ERROR);
+    EXPECT_TRUE(flag);
+
+    persistenceProvider.Shutdown();
+}
+
 } // anonymous namespace
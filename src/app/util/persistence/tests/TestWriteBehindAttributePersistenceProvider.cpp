@@ -0,0 +1,170 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/util/persistence/WriteBehindAttributePersistenceProvider.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <pw_unit_test/framework.h>
+#include <system/SystemClock.h>
+
+#include <map>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+const ConcreteAttributePath kLevelPath(1, 8, 0);
+const ConcreteAttributePath kOnOffPath(1, 6, 0);
+const ConcreteAttributePath kColorPath(1, 0x300, 7);
+
+class RecordingPersistenceProvider : public AttributePersistenceProvider
+{
+public:
+    CHIP_ERROR WriteValue(const ConcreteAttributePath & aPath, const ByteSpan & aValue) override
+    {
+        mWrites.push_back(aPath);
+        mValues[aPath] = std::vector<uint8_t>(aValue.begin(), aValue.end());
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR ReadValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
+                         MutableByteSpan & aValue) override
+    {
+        auto it = mValues.find(aPath);
+        VerifyOrReturnError(it != mValues.end(), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+        return CopySpanToMutableSpan(ByteSpan(it->second.data(), it->second.size()), aValue);
+    }
+
+    std::vector<ConcreteAttributePath> mWrites;
+    std::map<ConcreteAttributePath, std::vector<uint8_t>> mValues;
+};
+
+class TestWriteBehindAttributePersistenceProvider : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        mRealClock = &System::SystemClock();
+        System::Clock::Internal::SetSystemClockForTesting(&mMockClock);
+    }
+    void TearDown() override { System::Clock::Internal::SetSystemClockForTesting(mRealClock); }
+
+protected:
+    System::Clock::Internal::MockClock mMockClock;
+    System::Clock::ClockBase * mRealClock = nullptr;
+};
+
+TEST_F(TestWriteBehindAttributePersistenceProvider, TestCoalescingAndReadBack)
+{
+    RecordingPersistenceProvider persister;
+    WriteBehindAttribute slots[4];
+    WriteBehindAttributePersistenceProvider provider(persister, Span<WriteBehindAttribute>(slots));
+
+    // A level transition: many ticks of the same attribute.
+    for (uint8_t level = 0; level < 50; level++)
+    {
+        EXPECT_EQ(provider.WriteValue(kLevelPath, ByteSpan(&level, 1)), CHIP_NO_ERROR);
+    }
+    EXPECT_TRUE(persister.mWrites.empty());
+    EXPECT_EQ(provider.GetPendingWriteCount(), 1u);
+    EXPECT_EQ(provider.GetCoalescedWriteCount(), 49u);
+
+    // Reads see the pending value.
+    uint8_t buffer[4];
+    MutableByteSpan readBack(buffer);
+    EXPECT_EQ(provider.ReadValue(kLevelPath, nullptr, readBack), CHIP_NO_ERROR);
+    ASSERT_EQ(readBack.size(), 1u);
+    EXPECT_EQ(buffer[0], 49);
+
+    // Shutdown or a power fail hook flushes the last value only.
+    EXPECT_EQ(provider.Flush(), CHIP_NO_ERROR);
+    ASSERT_EQ(persister.mWrites.size(), 1u);
+    EXPECT_EQ(persister.mWrites[0], kLevelPath);
+    EXPECT_EQ(persister.mValues[kLevelPath], std::vector<uint8_t>{ 49 });
+    EXPECT_EQ(provider.GetPendingWriteCount(), 0u);
+    EXPECT_EQ(provider.GetFlushCount(), 1u);
+
+    // Nothing pending: reads go to the decorated persister.
+    readBack = MutableByteSpan(buffer);
+    EXPECT_EQ(provider.ReadValue(kLevelPath, nullptr, readBack), CHIP_NO_ERROR);
+    EXPECT_EQ(readBack.size(), 1u);
+    readBack = MutableByteSpan(buffer);
+    EXPECT_EQ(provider.ReadValue(kOnOffPath, nullptr, readBack), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    EXPECT_EQ(provider.Flush(), CHIP_NO_ERROR);
+    EXPECT_EQ(provider.GetFlushCount(), 1u);
+}
+
+TEST_F(TestWriteBehindAttributePersistenceProvider, TestFlushPolicy)
+{
+    RecordingPersistenceProvider persister;
+    WriteBehindAttribute slots[4];
+    WriteBehindPolicy policy;
+    policy.maxDelay         = System::Clock::Milliseconds32(1000);
+    policy.maxPendingWrites = 2;
+    WriteBehindAttributePersistenceProvider provider(persister, Span<WriteBehindAttribute>(slots), policy);
+
+    // The count threshold flushes the batch.
+    const uint8_t value = 1;
+    EXPECT_EQ(provider.WriteValue(kLevelPath, ByteSpan(&value, 1)), CHIP_NO_ERROR);
+    EXPECT_TRUE(persister.mWrites.empty());
+    EXPECT_EQ(provider.WriteValue(kOnOffPath, ByteSpan(&value, 1)), CHIP_NO_ERROR);
+    EXPECT_EQ(persister.mWrites.size(), 2u);
+    EXPECT_EQ(provider.GetFlushCount(), 1u);
+
+    // A value keeps changing: it is still written once the batch is older than the delay.
+    for (uint8_t level = 0; level < 20; level++)
+    {
+        EXPECT_EQ(provider.WriteValue(kLevelPath, ByteSpan(&level, 1)), CHIP_NO_ERROR);
+        mMockClock.AdvanceMonotonic(System::Clock::Milliseconds64(100));
+    }
+    EXPECT_EQ(persister.mWrites.size(), 3u);
+    EXPECT_EQ(persister.mValues[kLevelPath], std::vector<uint8_t>{ 9 });
+    EXPECT_EQ(provider.GetPendingWriteCount(), 1u);
+
+    // The provider flushes what is left when it goes away.
+    {
+        WriteBehindAttributePersistenceProvider other(persister, Span<WriteBehindAttribute>(slots + 2, 2), policy);
+        EXPECT_EQ(other.WriteValue(kColorPath, ByteSpan(&value, 1)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(persister.mWrites.size(), 4u);
+    EXPECT_EQ(persister.mWrites.back(), kColorPath);
+}
+
+TEST_F(TestWriteBehindAttributePersistenceProvider, TestWriteThrough)
+{
+    RecordingPersistenceProvider persister;
+    WriteBehindAttribute slots[1];
+    WriteBehindAttributePersistenceProvider provider(persister, Span<WriteBehindAttribute>(slots));
+
+    // With a single slot, taking it flushes right away.
+    const uint8_t value = 1;
+    EXPECT_EQ(provider.WriteValue(kLevelPath, ByteSpan(&value, 1)), CHIP_NO_ERROR);
+    EXPECT_EQ(persister.mWrites.size(), 1u);
+
+    // Empty values are not held back.
+    EXPECT_EQ(provider.WriteValue(kOnOffPath, ByteSpan()), CHIP_NO_ERROR);
+    EXPECT_EQ(persister.mWrites.size(), 2u);
+    EXPECT_EQ(provider.GetWriteThroughCount(), 1u);
+}
+
+} // namespace
@@ -58,16 +58,6 @@
 #define ChipLogDebugBleEndPoint(MOD, MSG, ...)
 #endif
 
-/**
- *  @def BLE_CONFIG_IMMEDIATE_ACK_WINDOW_THRESHOLD
- *
- *  @brief
- *    If an end point's receive window drops equal to or below this value, it will send an immediate acknowledgement
- *    packet to re-open its window instead of waiting for the send-ack timer to expire.
- *
- */
-#define BLE_CONFIG_IMMEDIATE_ACK_WINDOW_THRESHOLD 1
-
 /**
  *  @def BLE_UNSUBSCRIBE_TIMEOUT_MS
  *
@@ -78,8 +68,6 @@
  */
 #define BLE_UNSUBSCRIBE_TIMEOUT_MS 5000
 
-#define BTP_ACK_SEND_TIMEOUT_MS 2500
-
 /**
  *  @def BTP_WINDOW_NO_ACK_SEND_THRESHOLD
  *
@@ -1300,7 +1288,11 @@ CHIP_ERROR BLEEndPoint::SendWrite(PacketBufferHandle && buf)
 {
     mConnStateFlags.Set(ConnectionStateFlag::kGattOperationInFlight);
 
-    auto err = mBle->mPlatformDelegate->SendWriteRequest(mConnObj, &CHIP_BLE_SVC_ID, &CHIP_BLE_CHAR_1_UUID, std::move(buf));
+    // Write commands only wait for the local controller to take the fragment rather than for a round trip to the
+    // peripheral, which lets the platform pipeline the fragments of a window.
+    auto err = mBle->mPlatformDelegate->SupportsWriteWithoutResponse(mConnObj)
+        ? mBle->mPlatformDelegate->SendWriteWithoutResponse(mConnObj, &CHIP_BLE_SVC_ID, &CHIP_BLE_CHAR_1_UUID, std::move(buf))
+        : mBle->mPlatformDelegate->SendWriteRequest(mConnObj, &CHIP_BLE_SVC_ID, &CHIP_BLE_CHAR_1_UUID, std::move(buf));
     VerifyOrReturnError(err == CHIP_NO_ERROR, err,
                         ChipLogError(Ble, "Send write request failed: %" CHIP_ERROR_FORMAT, err.Format()));
 
@@ -160,6 +160,44 @@
 #error "BLE_MAX_RECEIVE_WINDOW_SIZE must be greater than 2 for BLE transport protocol stability."
 #endif
 
+#if (BLE_MAX_RECEIVE_WINDOW_SIZE > 255)
+#error "BLE_MAX_RECEIVE_WINDOW_SIZE must fit in the one byte window size field of the BTP handshake."
+#endif
+
+/**
+ *  @def BLE_CONFIG_IMMEDIATE_ACK_WINDOW_THRESHOLD
+ *
+ *  @brief
+ *    If an end point's receive window drops equal to or below this value, it will send an immediate acknowledgement
+ *    packet to re-open its window instead of waiting for the send-ack timer to expire.
+ *
+ *    Until then, acknowledgements are coalesced: a single ack, piggybacked on an outbound fragment or sent stand-alone
+ *    when the send-ack timer expires, acknowledges all the fragments received so far. Platforms with a large
+ *    BLE_MAX_RECEIVE_WINDOW_SIZE may raise this threshold so that the window is re-opened before the sender has to
+ *    stop and wait for it.
+ *
+ */
+#ifndef BLE_CONFIG_IMMEDIATE_ACK_WINDOW_THRESHOLD
+#define BLE_CONFIG_IMMEDIATE_ACK_WINDOW_THRESHOLD 1
+#endif // BLE_CONFIG_IMMEDIATE_ACK_WINDOW_THRESHOLD
+
+#if (BLE_MAX_RECEIVE_WINDOW_SIZE <= BLE_CONFIG_IMMEDIATE_ACK_WINDOW_THRESHOLD + 1)
+#error "BLE_MAX_RECEIVE_WINDOW_SIZE must exceed (BLE_CONFIG_IMMEDIATE_ACK_WINDOW_THRESHOLD + 1)."
+#endif
+
+/**
+ *  @def BTP_ACK_SEND_TIMEOUT_MS
+ *
+ *  @brief
+ *    Maximum amount of time, in milliseconds, that a BLE end point holds back the acknowledgement of received
+ *    fragments, waiting for an outbound fragment to piggyback it on, before sending it stand-alone. Must be well
+ *    below BTP_ACK_TIMEOUT_MS.
+ *
+ */
+#ifndef BTP_ACK_SEND_TIMEOUT_MS
+#define BTP_ACK_SEND_TIMEOUT_MS 2500
+#endif // BTP_ACK_SEND_TIMEOUT_MS
+
 /**
  *  @def BLE_CONFIG_ERROR_MIN
  *
@@ -69,6 +69,21 @@ public:
     // Send GATT characteristic write request
     virtual CHIP_ERROR SendWriteRequest(BLE_CONNECTION_OBJECT connObj, const ChipBleUUID * svcId, const ChipBleUUID * charId,
                                         PacketBufferHandle pBuf) = 0;
+
+    // Following APIs are optional:
+
+    // Return true if GATT characteristic writes on the specified BLE connection may be sent as write commands (write
+    // without response). BLEEndPoint then sends its fragments with SendWriteWithoutResponse() instead of
+    // SendWriteRequest(), so that several of them may be queued per connection event.
+    virtual bool SupportsWriteWithoutResponse(BLE_CONNECTION_OBJECT connObj) const { return false; }
+
+    // Send GATT characteristic write without response. The platform must call BleLayer::HandleWriteConfirmation()
+    // once it is ready to accept the next write, typically as soon as the write has been queued to the controller.
+    virtual CHIP_ERROR SendWriteWithoutResponse(BLE_CONNECTION_OBJECT connObj, const ChipBleUUID * svcId,
+                                                const ChipBleUUID * charId, PacketBufferHandle pBuf)
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
 };
 
 } /* namespace Ble */
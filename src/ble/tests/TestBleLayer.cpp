@@ -122,7 +122,7 @@ public:
     ///
     // Implementation of BleLayerDelegate
 
-    void OnBleConnectionComplete(BLEEndPoint * endpoint) override {}
+    void OnBleConnectionComplete(BLEEndPoint * endpoint) override { mConnectedEndPoint = endpoint; }
     void OnBleConnectionError(CHIP_ERROR err) override {}
     void OnEndPointConnectComplete(BLEEndPoint * endPoint, CHIP_ERROR err) override {}
     void OnEndPointMessageReceived(BLEEndPoint * endPoint, System::PacketBufferHandle && msg) override {}
@@ -148,9 +148,22 @@ public:
     }
     CHIP_ERROR SendWriteRequest(BLE_CONNECTION_OBJECT, const ChipBleUUID *, const ChipBleUUID *, PacketBufferHandle) override
     {
+        mNumWriteRequests++;
+        return CHIP_NO_ERROR;
+    }
+    bool SupportsWriteWithoutResponse(BLE_CONNECTION_OBJECT) const override { return mSupportsWriteWithoutResponse; }
+    CHIP_ERROR SendWriteWithoutResponse(BLE_CONNECTION_OBJECT, const ChipBleUUID *, const ChipBleUUID *,
+                                        PacketBufferHandle) override
+    {
+        mNumWritesWithoutResponse++;
         return CHIP_NO_ERROR;
     }
 
+    BLEEndPoint * mConnectedEndPoint       = nullptr;
+    bool mSupportsWriteWithoutResponse     = false;
+    unsigned int mNumWriteRequests         = 0;
+    unsigned int mNumWritesWithoutResponse = 0;
+
 private:
     unsigned int mNumConnection = 0;
 };
@@ -310,6 +323,33 @@ TEST_F(TestBleLayer, HandleWriteConfirmation)
     EXPECT_TRUE(HandleWriteConfirmation(connObj, &CHIP_BLE_SVC_ID, &CHIP_BLE_CHAR_1_UUID));
 }
 
+TEST_F(TestBleLayer, StartConnectWithWriteRequest)
+{
+    auto connObj = GetConnectionObject();
+    ASSERT_EQ(NewBleConnectionByObject(connObj), CHIP_NO_ERROR);
+    ASSERT_NE(mConnectedEndPoint, nullptr);
+
+    EXPECT_EQ(mConnectedEndPoint->StartConnect(), CHIP_NO_ERROR);
+    EXPECT_EQ(mNumWriteRequests, 1u);
+    EXPECT_EQ(mNumWritesWithoutResponse, 0u);
+}
+
+TEST_F(TestBleLayer, StartConnectWithWriteWithoutResponse)
+{
+    mSupportsWriteWithoutResponse = true;
+
+    auto connObj = GetConnectionObject();
+    ASSERT_EQ(NewBleConnectionByObject(connObj), CHIP_NO_ERROR);
+    ASSERT_NE(mConnectedEndPoint, nullptr);
+
+    EXPECT_EQ(mConnectedEndPoint->StartConnect(), CHIP_NO_ERROR);
+    EXPECT_EQ(mNumWriteRequests, 0u);
+    EXPECT_EQ(mNumWritesWithoutResponse, 1u);
+
+    // Write commands are confirmed by the platform through the same path as write requests.
+    EXPECT_TRUE(HandleWriteConfirmation(connObj, &CHIP_BLE_SVC_ID, &CHIP_BLE_CHAR_1_UUID));
+}
+
 TEST_F(TestBleLayer, HandleIndicationReceivedInvalidUUID)
 {
     auto connObj = GetConnectionObject();
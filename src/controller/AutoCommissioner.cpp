@@ -637,6 +637,7 @@ Optional<System::Clock::Timeout> AutoCommissioner::GetCommandTimeout(DeviceProxy
         break;
     case CommissioningStage::kSendNOC:
     case CommissioningStage::kSendOpCertSigningRequest:
+    case CommissioningStage::kAttestationVerification: // For the CSR request, see SetPipelineCSRRequest
         timeout = kSlowCryptoProcessingTime;
         break;
     default:
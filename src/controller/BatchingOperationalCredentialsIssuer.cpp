@@ -0,0 +1,230 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/BatchingOperationalCredentialsIssuer.h>
+
+#include <lib/core/TLV.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/PlatformManager.h>
+
+namespace chip {
+namespace Controller {
+
+using namespace Credentials;
+using namespace Crypto;
+using namespace TLV;
+
+CHIP_ERROR BatchingOperationalCredentialsIssuer::Init(NOCBatchSigner & signer, size_t maxBatchSize,
+                                                      System::Clock::Milliseconds32 batchWindow)
+{
+    VerifyOrReturnError(maxBatchSize > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mState == nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    mState         = std::make_shared<SharedState>();
+    mState->issuer = this;
+    mWorker        = std::thread(WorkerMain, mState, &signer, maxBatchSize, batchWindow);
+    return CHIP_NO_ERROR;
+}
+
+void BatchingOperationalCredentialsIssuer::Shutdown()
+{
+    VerifyOrReturn(mState != nullptr);
+
+    {
+        std::lock_guard<std::mutex> lock(mState->mutex);
+        mState->stopping = true;
+        mState->queued.clear();
+    }
+    mState->condition.notify_one();
+    mWorker.join();
+
+    // A delivery may still be scheduled: it holds its own reference to the state, and drops the completed requests.
+    mState->issuer = nullptr;
+    mState.reset();
+}
+
+CHIP_ERROR BatchingOperationalCredentialsIssuer::GenerateNOCChain(const ByteSpan & csrElements, const ByteSpan & csrNonce,
+                                                                  const ByteSpan & attestationSignature,
+                                                                  const ByteSpan & attestationChallenge, const ByteSpan & DAC,
+                                                                  const ByteSpan & PAI,
+                                                                  Callback::Callback<OnNOCChainGeneration> * onCompletion)
+{
+    VerifyOrReturnError(mState != nullptr, CHIP_ERROR_UNINITIALIZED);
+    VerifyOrReturnError(onCompletion != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // At this point, Credential issuer may wish to validate the CSR information
+    (void) attestationChallenge;
+    (void) csrNonce;
+
+    TLVReader reader;
+    reader.Init(csrElements);
+
+    if (reader.GetType() == kTLVType_NotSpecified)
+    {
+        ReturnErrorOnFailure(reader.Next());
+    }
+
+    ReturnErrorOnFailure(reader.Expect(kTLVType_Structure, AnonymousTag()));
+
+    TLVType containerType;
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+    ReturnErrorOnFailure(reader.Next(kTLVType_ByteString, TLV::ContextTag(1)));
+
+    ByteSpan csr(reader.GetReadPoint(), reader.GetLength());
+    reader.ExitContainer(containerType);
+
+    auto pending = std::make_unique<PendingRequest>();
+    ReturnErrorOnFailure(VerifyCertificateSigningRequest(csr.data(), csr.size(), pending->request.pubkey));
+
+    VerifyOrReturnError(pending->buffer.Alloc(3 * kMaxDERCertLength), CHIP_ERROR_NO_MEMORY);
+    pending->request.noc  = MutableByteSpan(pending->buffer.Get(), kMaxDERCertLength);
+    pending->request.icac = MutableByteSpan(pending->buffer.Get() + kMaxDERCertLength, kMaxDERCertLength);
+    pending->request.rcac = MutableByteSpan(pending->buffer.Get() + 2 * kMaxDERCertLength, kMaxDERCertLength);
+    pending->onCompletion = onCompletion;
+
+    if (mNodeIdRequested)
+    {
+        pending->request.nodeId = mNextRequestedNodeId;
+        mNodeIdRequested        = false;
+    }
+    else
+    {
+        pending->request.nodeId = mNextAvailableNodeId++;
+    }
+    pending->request.fabricId = mNextFabricId;
+    pending->request.cats     = mNextCATs;
+
+    ChipLogProgress(Controller, "Queueing NOC request for node 0x" ChipLogFormatX64, ChipLogValueX64(pending->request.nodeId));
+    {
+        std::lock_guard<std::mutex> lock(mState->mutex);
+        mState->queued.push_back(std::move(pending));
+    }
+    mState->condition.notify_one();
+    return CHIP_NO_ERROR;
+}
+
+void BatchingOperationalCredentialsIssuer::WorkerMain(std::shared_ptr<SharedState> state, NOCBatchSigner * signer,
+                                                      size_t maxBatchSize, System::Clock::Milliseconds32 batchWindow)
+{
+    std::vector<std::unique_ptr<PendingRequest>> batch;
+    std::vector<NOCBatchSigner::Request *> requests;
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    while (true)
+    {
+        state->condition.wait(lock, [&] { return state->stopping || !state->queued.empty(); });
+        if (state->stopping)
+        {
+            return;
+        }
+
+        // Give the other commissionings running concurrently a chance to join the batch.
+        if (batchWindow.count() > 0 && state->queued.size() < maxBatchSize)
+        {
+            state->condition.wait_for(lock, std::chrono::milliseconds(batchWindow.count()),
+                                      [&] { return state->stopping || state->queued.size() >= maxBatchSize; });
+            if (state->stopping)
+            {
+                return;
+            }
+        }
+
+        while (!state->queued.empty() && batch.size() < maxBatchSize)
+        {
+            batch.push_back(std::move(state->queued.front()));
+            state->queued.pop_front();
+            requests.push_back(&batch.back()->request);
+        }
+
+        lock.unlock();
+        ChipLogProgress(Controller, "Signing a batch of %u NOC requests", static_cast<unsigned>(requests.size()));
+        signer->SignBatch(Span<NOCBatchSigner::Request *>(requests.data(), requests.size()));
+        requests.clear();
+        lock.lock();
+
+        for (auto & pending : batch)
+        {
+            state->completed.push_back(std::move(pending));
+        }
+        batch.clear();
+
+        VerifyOrReturn(!state->stopping);
+        if (!state->deliveryScheduled)
+        {
+            auto * context = Platform::New<std::shared_ptr<SharedState>>(state);
+            if (context == nullptr ||
+                DeviceLayer::PlatformMgr().ScheduleWork(DeliverCompleted, reinterpret_cast<intptr_t>(context)) != CHIP_NO_ERROR)
+            {
+                ChipLogError(Controller, "Failed to schedule the delivery of the issued NOC chains");
+                Platform::Delete(context);
+                for (auto & pending : state->completed)
+                {
+                    // Reported with the next delivery, instead of leaving the commissioning waiting forever.
+                    pending->request.status = CHIP_ERROR_NO_MEMORY;
+                }
+                continue;
+            }
+            state->deliveryScheduled = true;
+        }
+    }
+}
+
+void BatchingOperationalCredentialsIssuer::DeliverCompleted(intptr_t context)
+{
+    auto * statePtr = reinterpret_cast<std::shared_ptr<SharedState> *>(context);
+    std::shared_ptr<SharedState> state(std::move(*statePtr));
+    Platform::Delete(statePtr);
+
+    std::vector<std::unique_ptr<PendingRequest>> completed;
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        completed.swap(state->completed);
+        state->deliveryScheduled = false;
+    }
+
+    auto * issuer = state->issuer;
+    VerifyOrReturn(issuer != nullptr);
+
+    for (auto & pending : completed)
+    {
+        auto & request = pending->request;
+        CHIP_ERROR err = request.status;
+        if (err == CHIP_NO_ERROR && !issuer->mHasIpk)
+        {
+            err = CHIP_ERROR_INCORRECT_STATE;
+        }
+
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Controller, "Failed to issue NOC chain for node 0x" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                         ChipLogValueX64(request.nodeId), err.Format());
+            pending->onCompletion->mCall(pending->onCompletion->mContext, err, ByteSpan(), ByteSpan(), ByteSpan(), NullOptional,
+                                         NullOptional);
+            continue;
+        }
+
+        ChipLogProgress(Controller, "Providing certificate chain to the commissioner");
+        pending->onCompletion->mCall(pending->onCompletion->mContext, CHIP_NO_ERROR, request.noc, request.icac, request.rcac,
+                                     MakeOptional(IdentityProtectionKeySpan(issuer->mIpk)), Optional<NodeId>());
+    }
+}
+
+} // namespace Controller
+} // namespace chip
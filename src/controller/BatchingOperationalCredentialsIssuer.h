@@ -0,0 +1,169 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  @file
+ *    Operational credentials issuer queueing the NOC requests of concurrent commissionings, and handing them in batches
+ *    to a signer, e.g. backed by an HSM, on a worker thread. The Matter thread only validates the CSRs and delivers the
+ *    issued chains, so it keeps serving the commissionings while the certificates are signed.
+ */
+
+#pragma once
+
+#include <controller/OperationalCredentialsDelegate.h>
+#include <credentials/CHIPCert.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CASEAuthTag.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/Span.h>
+#include <system/SystemClock.h>
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace chip {
+namespace Controller {
+
+/**
+ * Issues the certificates of the requests queued by a BatchingOperationalCredentialsIssuer.
+ *
+ * SignBatch is called on the worker thread of the issuer, never concurrently with itself, and must not call into the
+ * Matter stack.
+ */
+class NOCBatchSigner
+{
+public:
+    struct Request
+    {
+        // Inputs, the CSR having been validated
+        NodeId nodeId;
+        FabricId fabricId;
+        CATValues cats;
+        Crypto::P256PublicKey pubkey;
+
+        // Outputs, of up to Credentials::kMaxDERCertLength bytes each: SignBatch reduces them to the size of the
+        // certificates, and sets status to the result of the issuance of this request.
+        MutableByteSpan noc;
+        MutableByteSpan icac;
+        MutableByteSpan rcac;
+        CHIP_ERROR status = CHIP_NO_ERROR;
+    };
+
+    virtual ~NOCBatchSigner() = default;
+
+    /**
+     * Issue the NOC chains of a batch of requests, e.g. in a single HSM session.
+     */
+    virtual void SignBatch(Span<Request *> requests) = 0;
+};
+
+class BatchingOperationalCredentialsIssuer : public OperationalCredentialsDelegate
+{
+public:
+    BatchingOperationalCredentialsIssuer() = default;
+    ~BatchingOperationalCredentialsIssuer() override { Shutdown(); }
+
+    BatchingOperationalCredentialsIssuer(const BatchingOperationalCredentialsIssuer &)             = delete;
+    BatchingOperationalCredentialsIssuer & operator=(const BatchingOperationalCredentialsIssuer &) = delete;
+
+    /**
+     * Start the worker thread.
+     *
+     * @param[in] signer        Signer of the batches, must outlive the issuer.
+     * @param[in] maxBatchSize  Most requests handed to the signer at once.
+     * @param[in] batchWindow   How long the worker waits for more requests after the first of a batch, to batch the
+     *                          requests of commissionings running concurrently. Zero signs what is queued right away.
+     */
+    CHIP_ERROR Init(NOCBatchSigner & signer, size_t maxBatchSize, System::Clock::Milliseconds32 batchWindow);
+
+    /**
+     * Stop the worker thread, after the batch being signed. The queued requests are dropped, without calling their
+     * completion callbacks.
+     */
+    void Shutdown();
+
+    CHIP_ERROR GenerateNOCChain(const ByteSpan & csrElements, const ByteSpan & csrNonce, const ByteSpan & attestationSignature,
+                                const ByteSpan & attestationChallenge, const ByteSpan & DAC, const ByteSpan & PAI,
+                                Callback::Callback<OnNOCChainGeneration> * onCompletion) override;
+
+    void SetNodeIdForNextNOCRequest(NodeId nodeId) override
+    {
+        mNextRequestedNodeId = nodeId;
+        mNodeIdRequested     = true;
+    }
+
+    void SetFabricIdForNextNOCRequest(FabricId fabricId) override { mNextFabricId = fabricId; }
+
+    void SetCATValuesForNextNOCRequest(CATValues cats) { mNextCATs = cats; }
+
+    /**
+     * Set the IPK provided with the issued chains. The commissioning fails without one.
+     */
+    void SetIpk(const Crypto::IdentityProtectionKeySpan & ipk)
+    {
+        memcpy(mIpk, ipk.data(), sizeof(mIpk));
+        mHasIpk = true;
+    }
+
+private:
+    struct PendingRequest
+    {
+        NOCBatchSigner::Request request;
+        Platform::ScopedMemoryBuffer<uint8_t> buffer; // backs noc, icac and rcac
+        Callback::Callback<OnNOCChainGeneration> * onCompletion;
+    };
+
+    // State shared with the worker thread and with the deliveries scheduled on the Matter thread, which may run after the
+    // issuer is gone. The members are guarded by the mutex, except issuer, only accessed on the Matter thread.
+    struct SharedState
+    {
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::deque<std::unique_ptr<PendingRequest>> queued;
+        std::vector<std::unique_ptr<PendingRequest>> completed;
+        bool deliveryScheduled = false;
+        bool stopping          = false;
+
+        BatchingOperationalCredentialsIssuer * issuer = nullptr;
+    };
+
+    static void WorkerMain(std::shared_ptr<SharedState> state, NOCBatchSigner * signer, size_t maxBatchSize,
+                           System::Clock::Milliseconds32 batchWindow);
+    static void DeliverCompleted(intptr_t context);
+
+    std::shared_ptr<SharedState> mState;
+    std::thread mWorker;
+
+    NodeId mNextAvailableNodeId = 1;
+    NodeId mNextRequestedNodeId = 1;
+    FabricId mNextFabricId      = 1;
+    CATValues mNextCATs         = kUndefinedCATs;
+    bool mNodeIdRequested       = false;
+
+    uint8_t mIpk[Crypto::CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES];
+    bool mHasIpk = false;
+};
+
+} // namespace Controller
+} // namespace chip
@@ -477,6 +477,7 @@ DeviceCommissioner::~DeviceCommissioner()
 #if CHIP_DEVICE_CONFIG_ENABLE_WIFIPAF
     DeviceLayer::ConnectivityMgr().WiFiPAFCancelConnect();
 #endif
+    ReleaseCommissioningStepSlot();
 }
 
 CHIP_ERROR DeviceCommissioner::Init(CommissionerInitParams params)
@@ -485,7 +486,8 @@ CHIP_ERROR DeviceCommissioner::Init(CommissionerInitParams params)
     mOperationalCredentialsDelegate = params.operationalCredentialsDelegate;
     ReturnErrorOnFailure(DeviceController::Init(params));
 
-    mPairingDelegate = params.pairingDelegate;
+    mPairingDelegate           = params.pairingDelegate;
+    mCommissioningStepThrottle = params.commissioningStepThrottle;
 
     // Configure device attestation validation
     mDeviceAttestationVerifier = params.deviceAttestationVerifier;
@@ -560,6 +562,7 @@ void DeviceCommissioner::Shutdown()
     }
 
     CancelCommissioningInteractions();
+    ReleaseCommissioningStepSlot();
 
 #if CHIP_DEVICE_CONFIG_ENABLE_COMMISSIONER_DISCOVERY // make this commissioner discoverable
     if (mUdcTransportMgr != nullptr)
@@ -635,6 +638,7 @@ void DeviceCommissioner::ReleaseCommissioneeDevice(CommissioneeDeviceProxy * dev
     if (mDeviceBeingCommissioned == device)
     {
         mDeviceBeingCommissioned = nullptr;
+        ReleaseCommissioningStepSlot();
     }
 
     // Release the commissionee device after we have nulled out our pointers,
@@ -1114,6 +1118,7 @@ void DeviceCommissioner::CancelCommissioningInteractions()
         ChipLogDetail(Controller, "Cancelling CASE setup for step '%s'", StageToString(mCommissioningStage));
         CancelCASECallbacks();
     }
+    ResetPipelinedCSR();
 }
 
 void DeviceCommissioner::CancelCASECallbacks()
@@ -1272,6 +1277,9 @@ void DeviceCommissioner::OnDeviceAttestationInformationVerification(
     MATTER_TRACE_SCOPE("OnDeviceAttestationInformationVerification", "DeviceCommissioner");
     DeviceCommissioner * commissioner = reinterpret_cast<DeviceCommissioner *>(context);
 
+    // The verification is over, even if the result still has to go through the attestation delegate.
+    commissioner->ReleaseCommissioningStepSlot();
+
     if (commissioner->mCommissioningStage == CommissioningStage::kAttestationVerification)
     {
         // Check for revoked DAC Chain before calling delegate. Enter next stage.
@@ -1584,12 +1592,124 @@ void DeviceCommissioner::OnOperationalCertificateSigningRequest(
     commissioner->CommissioningStageComplete(CHIP_NO_ERROR, report);
 }
 
+void DeviceCommissioner::SendPipelinedCSRRequest(DeviceProxy * device, const ByteSpan & csrNonce,
+                                                 Optional<System::Clock::Timeout> timeout)
+{
+    ResetPipelinedCSR();
+
+    OperationalCredentials::Commands::CSRRequest::Type request;
+    request.CSRNonce = csrNonce;
+
+    auto onSuccessCb = [this](const app::ConcreteCommandPath & aPath, const app::StatusIB & aStatus,
+                              const OperationalCredentials::Commands::CSRResponse::DecodableType & responseData) {
+        OnPipelinedCSRResponse(responseData);
+    };
+    auto onFailureCb = [this](CHIP_ERROR aError) { OnPipelinedCSRFailure(aError); };
+
+    CHIP_ERROR err = InvokeCommandRequest(device->GetExchangeManager(), device->GetSecureSession().Value(), kRootEndpointId,
+                                          request, onSuccessCb, onFailureCb, NullOptional, timeout, &mPipelinedCSRCancelFn);
+    if (err != CHIP_NO_ERROR)
+    {
+        // The CSR will be requested in its own stage.
+        ChipLogError(Controller, "Failed to send pipelined CSR request: %" CHIP_ERROR_FORMAT, err.Format());
+        return;
+    }
+
+    ChipLogDetail(Controller, "Sent CSR request during attestation verification");
+    mPipelinedCSRState = PipelinedCSRState::kInFlight;
+}
+
+void DeviceCommissioner::OnPipelinedCSRResponse(const OperationalCredentials::Commands::CSRResponse::DecodableType & data)
+{
+    mPipelinedCSRCancelFn = nullptr;
+    VerifyOrReturn(mPipelinedCSRState == PipelinedCSRState::kInFlight);
+
+    if (mCommissioningStage == CommissioningStage::kSendOpCertSigningRequest && mDeviceBeingCommissioned != nullptr)
+    {
+        // The stage was waiting for this response.
+        mPipelinedCSRState = PipelinedCSRState::kIdle;
+        OnOperationalCertificateSigningRequest(this, data);
+        return;
+    }
+
+    // The response only lives for the duration of this callback.
+    if (!mPipelinedCSRElements.Alloc(data.NOCSRElements.size()) || !mPipelinedCSRSignature.Alloc(data.attestationSignature.size()))
+    {
+        OnPipelinedCSRFailure(CHIP_ERROR_NO_MEMORY);
+        return;
+    }
+    memcpy(mPipelinedCSRElements.Get(), data.NOCSRElements.data(), data.NOCSRElements.size());
+    memcpy(mPipelinedCSRSignature.Get(), data.attestationSignature.data(), data.attestationSignature.size());
+    mPipelinedCSRState = PipelinedCSRState::kReceived;
+}
+
+void DeviceCommissioner::OnPipelinedCSRFailure(CHIP_ERROR error)
+{
+    mPipelinedCSRCancelFn = nullptr;
+    VerifyOrReturn(mPipelinedCSRState == PipelinedCSRState::kInFlight);
+
+    if (mCommissioningStage == CommissioningStage::kSendOpCertSigningRequest && mDeviceBeingCommissioned != nullptr)
+    {
+        mPipelinedCSRState = PipelinedCSRState::kIdle;
+        OnCSRFailureResponse(this, error);
+        return;
+    }
+
+    mPipelinedCSRState = PipelinedCSRState::kFailed;
+    mPipelinedCSRError = error;
+}
+
+void DeviceCommissioner::CompletePipelinedCSRStage()
+{
+    switch (mPipelinedCSRState)
+    {
+    case PipelinedCSRState::kIdle:
+        break;
+    case PipelinedCSRState::kInFlight:
+        // Completed by OnPipelinedCSRResponse / OnPipelinedCSRFailure
+        ChipLogProgress(Controller, "Waiting for the response to the pipelined CSR request");
+        break;
+    case PipelinedCSRState::kReceived: {
+        mPipelinedCSRState = PipelinedCSRState::kIdle;
+
+        // Keep the response alive for the duration of the completion.
+        Platform::ScopedMemoryBufferWithSize<uint8_t> elements(std::move(mPipelinedCSRElements));
+        Platform::ScopedMemoryBufferWithSize<uint8_t> signature(std::move(mPipelinedCSRSignature));
+
+        CommissioningDelegate::CommissioningReport report;
+        report.Set<CSRResponse>(CSRResponse(ByteSpan(elements.Get(), elements.AllocatedSize()),
+                                            ByteSpan(signature.Get(), signature.AllocatedSize())));
+        CommissioningStageComplete(CHIP_NO_ERROR, report);
+        break;
+    }
+    case PipelinedCSRState::kFailed:
+        mPipelinedCSRState = PipelinedCSRState::kIdle;
+        ChipLogProgress(Controller, "Pipelined CSR request failed: %" CHIP_ERROR_FORMAT, mPipelinedCSRError.Format());
+        CommissioningStageComplete(mPipelinedCSRError);
+        break;
+    }
+}
+
+void DeviceCommissioner::ResetPipelinedCSR()
+{
+    if (mPipelinedCSRCancelFn)
+    {
+        ChipLogDetail(Controller, "Cancelling pipelined CSR request");
+        mPipelinedCSRCancelFn();
+        mPipelinedCSRCancelFn = nullptr;
+    }
+    mPipelinedCSRState = PipelinedCSRState::kIdle;
+    mPipelinedCSRElements.Free();
+    mPipelinedCSRSignature.Free();
+}
+
 void DeviceCommissioner::OnDeviceNOCChainGeneration(void * context, CHIP_ERROR status, const ByteSpan & noc, const ByteSpan & icac,
                                                     const ByteSpan & rcac, Optional<IdentityProtectionKeySpan> ipk,
                                                     Optional<NodeId> adminSubject)
 {
     MATTER_TRACE_SCOPE("OnDeviceNOCChainGeneration", "DeviceCommissioner");
     DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    commissioner->ReleaseCommissioningStepSlot();
 
     // The placeholder IPK is not satisfactory, but is there to fill the NocChain struct on error. It will still fail.
     const uint8_t placeHolderIpk[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -2060,6 +2180,7 @@ void DeviceCommissioner::CommissioningStageComplete(CHIP_ERROR err, Commissionin
     MATTER_TRACE_SCOPE("CommissioningStageComplete", "DeviceCommissioner");
     MATTER_LOG_METRIC_END(MetricKeyForCommissioningStage(mCommissioningStage), err);
     VerifyOrDie(mDeviceBeingCommissioned);
+    ReleaseCommissioningStepSlot();
 
     NodeId nodeId            = mDeviceBeingCommissioned->GetDeviceId();
     DeviceProxy * proxy      = mDeviceBeingCommissioned;
@@ -2878,11 +2999,85 @@ void DeviceCommissioner::SendCommissioningReadRequest(DeviceProxy * proxy, Optio
     mReadClient     = std::move(readClient);
 }
 
+bool DeviceCommissioner::IsThrottledStage(CommissioningStage stage)
+{
+    return stage == CommissioningStage::kAttestationVerification || stage == CommissioningStage::kAttestationRevocationCheck ||
+        stage == CommissioningStage::kGenerateNOCChain;
+}
+
+bool DeviceCommissioner::AcquireCommissioningStepSlot(DeviceProxy * proxy, CommissioningStage step,
+                                                      CommissioningParameters & params, CommissioningDelegate * delegate,
+                                                      EndpointId endpoint, Optional<System::Clock::Timeout> timeout)
+{
+    if (mCommissioningStepThrottle == nullptr || mHoldsCommissioningStepSlot || !IsThrottledStage(step))
+    {
+        return true;
+    }
+
+    if (mCommissioningStepThrottle->Acquire(*this))
+    {
+        mHoldsCommissioningStepSlot = true;
+        return true;
+    }
+
+    ChipLogProgress(Controller, "Commissioning step '%s' waits for %u other steps in progress", StageToString(step),
+                    static_cast<unsigned>(mCommissioningStepThrottle->GetStepsInProgress()));
+
+    mCommissioningStage      = step;
+    mCommissioningDelegate   = delegate;
+    mDeviceBeingCommissioned = proxy;
+    mThrottledStepParams     = &params;
+    mThrottledStepEndpoint   = endpoint;
+    mThrottledStepTimeout    = timeout;
+    return false;
+}
+
+void DeviceCommissioner::ReleaseCommissioningStepSlot()
+{
+    VerifyOrReturn(mCommissioningStepThrottle != nullptr);
+
+    if (mThrottledStepParams != nullptr)
+    {
+        mCommissioningStepThrottle->CancelWait(*this);
+        mThrottledStepParams = nullptr;
+    }
+
+    if (mHoldsCommissioningStepSlot)
+    {
+        mHoldsCommissioningStepSlot = false;
+        mCommissioningStepThrottle->Release();
+    }
+}
+
+void DeviceCommissioner::OnCommissioningStepSlotAcquired()
+{
+    mHoldsCommissioningStepSlot = true;
+
+    CommissioningParameters * params = mThrottledStepParams;
+    mThrottledStepParams             = nullptr;
+    if (params == nullptr || mDeviceBeingCommissioned == nullptr)
+    {
+        ReleaseCommissioningStepSlot();
+        return;
+    }
+
+    PerformCommissioningStep(mDeviceBeingCommissioned, mCommissioningStage, *params, mCommissioningDelegate,
+                             mThrottledStepEndpoint, mThrottledStepTimeout);
+}
+
 void DeviceCommissioner::PerformCommissioningStep(DeviceProxy * proxy, CommissioningStage step, CommissioningParameters & params,
                                                   CommissioningDelegate * delegate, EndpointId endpoint,
                                                   Optional<System::Clock::Timeout> timeout)
 
 {
+    CHIP_MEMORY_TAG_SCOPE(kController);
+
+    if (!AcquireCommissioningStepSlot(proxy, step, params, delegate, endpoint, timeout))
+    {
+        // Performed once other commissioners are done with their step.
+        return;
+    }
+
     MATTER_LOG_METRIC(kMetricDeviceCommissionerCommissionStage, step);
     MATTER_LOG_METRIC_BEGIN(MetricKeyForCommissioningStage(step));
 
@@ -3219,6 +3414,12 @@ void DeviceCommissioner::PerformCommissioningStep(DeviceProxy * proxy, Commissio
             params.GetAttestationSignature().Value(), params.GetPAI().Value(), params.GetDAC().Value(),
             params.GetAttestationNonce().Value(), params.GetRemoteVendorId().Value(), params.GetRemoteProductId().Value());
 
+        // Sent first, so that the device works on it while the attestation information is verified.
+        if (params.GetPipelineCSRRequest() && params.GetCSRNonce().HasValue())
+        {
+            SendPipelinedCSRRequest(proxy, params.GetCSRNonce().Value(), timeout);
+        }
+
         if (ValidateAttestationInfo(info) != CHIP_NO_ERROR)
         {
             ChipLogError(Controller, "Error validating attestation information");
@@ -3251,6 +3452,12 @@ void DeviceCommissioner::PerformCommissioningStep(DeviceProxy * proxy, Commissio
     }
     break;
     case CommissioningStage::kSendOpCertSigningRequest: {
+        if (mPipelinedCSRState != PipelinedCSRState::kIdle)
+        {
+            // Requested during attestation verification already
+            CompletePipelinedCSRStage();
+            return;
+        }
         if (!params.GetCSRNonce().HasValue())
         {
             ChipLogError(Controller, "No CSR nonce found");
@@ -3613,6 +3820,7 @@ void DeviceCommissioner::PerformCommissioningStep(DeviceProxy * proxy, Commissio
     }
     break;
     case CommissioningStage::kCleanup:
+        ResetPipelinedCSR();
         CleanupCommissioning(proxy, proxy->GetDeviceId(), params.GetCompletionStatus());
         break;
     case CommissioningStage::kError:
@@ -40,6 +40,7 @@
 #include <controller/CHIPDeviceControllerSystemState.h>
 #include <controller/CommissioneeDeviceProxy.h>
 #include <controller/CommissioningDelegate.h>
+#include <controller/CommissioningStepThrottle.h>
 #include <controller/DevicePairingDelegate.h>
 #include <controller/OperationalCredentialsDelegate.h>
 #include <controller/SetUpCodePairer.h>
@@ -56,6 +57,7 @@
 #include <lib/support/DLLUtil.h>
 #include <lib/support/Pool.h>
 #include <lib/support/SafeInt.h>
+#include <lib/support/ScopedBuffer.h>
 #include <lib/support/Span.h>
 #include <lib/support/ThreadOperationalDataset.h>
 #include <messaging/ExchangeMgr.h>
@@ -165,6 +167,9 @@ struct CommissionerInitParams : public ControllerInitParams
     // If null, the globally set attestation verifier (e.g. from GetDeviceAttestationVerifier()
     // singleton) will be used.
     Credentials::DeviceAttestationVerifier * deviceAttestationVerifier = nullptr;
+    // Throttle shared with other commissioners, to bound the attestation
+    // verifications and NOC chain generations they run at once. Optional.
+    CommissioningStepThrottle * commissioningStepThrottle = nullptr;
 };
 
 /**
@@ -474,7 +479,8 @@ class DLL_EXPORT DeviceCommissioner : public DeviceController,
 #if CHIP_CONFIG_ENABLE_READ_CLIENT
                                       public app::ClusterStateCache::Callback,
 #endif
-                                      public SessionEstablishmentDelegate
+                                      public SessionEstablishmentDelegate,
+                                      public CommissioningStepThrottle::Waiter
 {
 public:
     DeviceCommissioner();
@@ -1049,6 +1055,22 @@ private:
     void CancelCommissioningInteractions();
     void CancelCASECallbacks();
 
+    // CSR request sent during the kAttestationVerification stage, see
+    // CommissioningParameters::SetPipelineCSRRequest.  Its outcome is kept
+    // until the kSendOpCertSigningRequest stage.
+    enum class PipelinedCSRState : uint8_t
+    {
+        kIdle,
+        kInFlight,
+        kReceived,
+        kFailed,
+    };
+    void SendPipelinedCSRRequest(DeviceProxy * device, const ByteSpan & csrNonce, Optional<System::Clock::Timeout> timeout);
+    void OnPipelinedCSRResponse(const app::Clusters::OperationalCredentials::Commands::CSRResponse::DecodableType & data);
+    void OnPipelinedCSRFailure(CHIP_ERROR error);
+    void CompletePipelinedCSRStage();
+    void ResetPipelinedCSR();
+
 #if CHIP_CONFIG_ENABLE_READ_CLIENT
     void ParseCommissioningInfo();
     // Parsing attributes read in kReadCommissioningInfo stage.
@@ -1109,6 +1131,28 @@ private:
     Credentials::AttestationVerificationResult mAttestationResult;
     Platform::UniquePtr<Credentials::DeviceAttestationVerifier::AttestationDeviceInfo> mAttestationDeviceInfo;
     Credentials::DeviceAttestationVerifier * mDeviceAttestationVerifier = nullptr;
+
+    // Throttling of the commissioning steps, see CommissionerInitParams::commissioningStepThrottle.
+    // While waiting for a slot, the step to perform is kept in mCommissioningStage and its
+    // parameters in mThrottledStep*.
+    static bool IsThrottledStage(CommissioningStage stage);
+    bool AcquireCommissioningStepSlot(DeviceProxy * proxy, CommissioningStage step, CommissioningParameters & params,
+                                      CommissioningDelegate * delegate, EndpointId endpoint,
+                                      Optional<System::Clock::Timeout> timeout);
+    void ReleaseCommissioningStepSlot();
+    void OnCommissioningStepSlotAcquired() override;
+
+    CommissioningStepThrottle * mCommissioningStepThrottle = nullptr;
+    bool mHoldsCommissioningStepSlot                       = false;
+    CommissioningParameters * mThrottledStepParams         = nullptr;
+    EndpointId mThrottledStepEndpoint                      = kRootEndpointId;
+    Optional<System::Clock::Timeout> mThrottledStepTimeout;
+
+    PipelinedCSRState mPipelinedCSRState = PipelinedCSRState::kIdle;
+    Internal::InvokeCancelFn mPipelinedCSRCancelFn;
+    CHIP_ERROR mPipelinedCSRError = CHIP_NO_ERROR;
+    Platform::ScopedMemoryBufferWithSize<uint8_t> mPipelinedCSRElements;
+    Platform::ScopedMemoryBufferWithSize<uint8_t> mPipelinedCSRSignature;
 };
 
 } // namespace Controller
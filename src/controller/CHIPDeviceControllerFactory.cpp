@@ -286,9 +286,10 @@ CHIP_ERROR DeviceControllerFactory::InitSystemState(FactoryInitParams params)
     };
 
     CASESessionManagerConfig sessionManagerConfig = {
-        .sessionInitParams = sessionInitParams,
-        .clientPool        = stateParams.caseClientPool,
-        .sessionSetupPool  = stateParams.sessionSetupPool,
+        .sessionInitParams   = sessionInitParams,
+        .clientPool          = stateParams.caseClientPool,
+        .sessionSetupPool    = stateParams.sessionSetupPool,
+        .addressCacheStorage = params.fabricIndependentStorage,
     };
 
     // TODO: Need to be able to create a CASESessionManagerConfig here!
@@ -371,6 +372,7 @@ CHIP_ERROR DeviceControllerFactory::SetupCommissioner(SetupParams params, Device
     commissionerParams.pairingDelegate           = params.pairingDelegate;
     commissionerParams.defaultCommissioner       = params.defaultCommissioner;
     commissionerParams.deviceAttestationVerifier = params.deviceAttestationVerifier;
+    commissionerParams.commissioningStepThrottle = params.commissioningStepThrottle;
 
     CHIP_ERROR err = commissioner.Init(commissionerParams);
 
@@ -123,6 +123,10 @@ struct SetupParams
 
     Credentials::DeviceAttestationVerifier * deviceAttestationVerifier = nullptr;
     CommissioningDelegate * defaultCommissioner                        = nullptr;
+
+    // Shared by the commissioners set up to commission devices in parallel,
+    // see CommissionerInitParams::commissioningStepThrottle.
+    CommissioningStepThrottle * commissioningStepThrottle = nullptr;
 };
 
 // TODO everything other than the fabric storage, group data provider, OperationalKeystore,
@@ -162,6 +166,12 @@ struct FactoryInitParams
     uint16_t listenPort = 0;
 };
 
+// All the controllers of a process share one DeviceControllerSystemState and
+// run on the Matter event loop: the InteractionModelEngine, the platform
+// manager and its stack lock are process-wide singletons, so there can only be
+// one system state at a time. To spread a large number of nodes over several
+// cores, run one process per shard of the nodes, each with its own storage and
+// listen port.
 class DeviceControllerFactory
 {
 public:
@@ -60,7 +60,7 @@ namespace chip {
 
 inline constexpr size_t kMaxDeviceTransportBlePendingPackets = 1;
 #if CHIP_DEVICE_CONFIG_ENABLE_WIFIPAF
-inline constexpr size_t kMaxDeviceTransportWiFiPAFPendingPackets = 1;
+inline constexpr size_t kMaxDeviceTransportWiFiPAFPendingPackets = 4;
 #endif
 
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
@@ -531,6 +531,17 @@ public:
         return *this;
     }
 
+    // Send the CSR request while the device attestation information is being
+    // verified, rather than after it, so that the device generates its
+    // operational key during the verification.  The CSR response is only used
+    // once the attestation is verified.
+    bool GetPipelineCSRRequest() const { return mPipelineCSRRequest; }
+    CommissioningParameters & SetPipelineCSRRequest(bool pipelineCSRRequest)
+    {
+        mPipelineCSRRequest = pipelineCSRRequest;
+        return *this;
+    }
+
     ICDRegistrationStrategy GetICDRegistrationStrategy() const { return mICDRegistrationStrategy; }
     CommissioningParameters & SetICDRegistrationStrategy(ICDRegistrationStrategy icdRegistrationStrategy)
     {
@@ -644,6 +655,7 @@ private:
     Optional<uint32_t> mICDStayActiveDurationMsec;
     ICDRegistrationStrategy mICDRegistrationStrategy = ICDRegistrationStrategy::kIgnore;
     bool mCheckForMatchingFabric                     = false;
+    bool mPipelineCSRRequest                         = false;
 };
 
 struct RequestedCertificate
@@ -0,0 +1,66 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/CommissioningStepThrottle.h>
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace Controller {
+
+bool CommissioningStepThrottle::Acquire(Waiter & waiter)
+{
+    if (mStepsInProgress < mMaxConcurrentSteps)
+    {
+        mStepsInProgress++;
+        return true;
+    }
+
+    if (!mWaiters.Contains(&waiter))
+    {
+        mWaiters.PushBack(&waiter);
+    }
+    return false;
+}
+
+void CommissioningStepThrottle::Release()
+{
+    VerifyOrReturn(mStepsInProgress > 0);
+
+    if (mWaiters.begin() == mWaiters.end())
+    {
+        mStepsInProgress--;
+        return;
+    }
+
+    // The slot goes to the first waiter, so mStepsInProgress does not change.
+    Waiter & waiter = *mWaiters.begin();
+    mWaiters.Remove(&waiter);
+    waiter.OnCommissioningStepSlotAcquired();
+}
+
+void CommissioningStepThrottle::CancelWait(Waiter & waiter)
+{
+    if (mWaiters.Contains(&waiter))
+    {
+        mWaiters.Remove(&waiter);
+    }
+}
+
+} // namespace Controller
+} // namespace chip
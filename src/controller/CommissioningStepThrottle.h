@@ -0,0 +1,76 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <lib/support/IntrusiveList.h>
+
+namespace chip {
+namespace Controller {
+
+/**
+ * Bounds how many commissioning steps run at once across the DeviceCommissioner
+ * instances sharing the throttle.
+ *
+ * Commissioning many devices in parallel is done with one DeviceCommissioner
+ * per device (see ControllerInitParams::permitMultiControllerFabrics).  The
+ * throttle then bounds the steps that load the commissioner side the most:
+ * device attestation verification and operational certificate issuance.
+ */
+class CommissioningStepThrottle
+{
+public:
+    class Waiter : public IntrusiveListNodeBase<>
+    {
+    public:
+        virtual ~Waiter() = default;
+
+        /// Called once a slot, freed by another step, has been acquired on behalf of the waiter.
+        virtual void OnCommissioningStepSlotAcquired() = 0;
+    };
+
+    /// maxConcurrentSteps must be at least 1.
+    CommissioningStepThrottle(size_t maxConcurrentSteps) : mMaxConcurrentSteps(maxConcurrentSteps) {}
+    ~CommissioningStepThrottle() { mWaiters.Clear(); }
+
+    /**
+     * Acquires a slot if one is free.  Otherwise queues the waiter, to be
+     * notified when a slot is acquired on its behalf.
+     *
+     * @return true if the slot was acquired right away.
+     */
+    bool Acquire(Waiter & waiter);
+
+    /// Releases a slot, passing it on to the first queued waiter if any.
+    void Release();
+
+    /// Removes the waiter from the queue, if queued.
+    void CancelWait(Waiter & waiter);
+
+    size_t GetStepsInProgress() const { return mStepsInProgress; }
+
+private:
+    const size_t mMaxConcurrentSteps;
+    size_t mStepsInProgress = 0;
+    IntrusiveList<Waiter> mWaiters;
+};
+
+} // namespace Controller
+} // namespace chip
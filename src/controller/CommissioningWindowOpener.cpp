@@ -19,10 +19,13 @@
 #include <controller/CommissioningWindowOpener.h>
 #include <lib/core/CHIPSafeCasts.h>
 #include <lib/support/CHIPMem.h>
+#include <platform/PlatformManager.h>
 #include <protocols/secure_channel/PASESession.h>
 #include <setup_payload/ManualSetupPayloadGenerator.h>
 #include <setup_payload/QRCodeSetupPayloadGenerator.h>
 
+#include <atomic>
+
 using namespace chip::app::Clusters;
 using namespace chip::System::Clock;
 using namespace chip::Crypto;
@@ -35,6 +38,36 @@ constexpr uint16_t kTimedInvokeTimeoutMs = 10000;
 namespace chip {
 namespace Controller {
 
+// Inputs and result of a verifier computed via ScheduleBackgroundWork.  Owned by nobody while the
+// background part runs; released by OnVerifierComputed on the Matter thread afterwards.
+struct CommissioningWindowOpener::VerifierWork
+{
+    // Cleared if the opener is destroyed first; only accessed on the Matter thread.
+    CommissioningWindowOpener * opener = nullptr;
+    PASEVerifierCache * verifierCache  = nullptr;
+    uint32_t iterations                = 0;
+    uint8_t saltBuffer[kSpake2p_Max_PBKDF_Salt_Length];
+    size_t saltLength = 0;
+    uint32_t setupPIN = 0;
+    Spake2pVerifier verifier;
+    CHIP_ERROR status = CHIP_NO_ERROR;
+    // Set by the background part if OnVerifierComputed could not be scheduled.
+    std::atomic<bool> abandoned{ false };
+};
+
+CommissioningWindowOpener::~CommissioningWindowOpener()
+{
+    VerifyOrReturn(mPendingVerifierWork != nullptr);
+    if (mPendingVerifierWork->abandoned.load())
+    {
+        Platform::Delete(mPendingVerifierWork);
+    }
+    else
+    {
+        mPendingVerifierWork->opener = nullptr;
+    }
+}
+
 CHIP_ERROR CommissioningWindowOpener::OpenBasicCommissioningWindow(NodeId deviceId, Seconds16 timeout,
                                                                    Callback::Callback<OnOpenBasicCommissioningWindow> * callback)
 {
@@ -116,9 +149,26 @@ CHIP_ERROR CommissioningWindowOpener::OpenCommissioningWindow(const Commissionin
     }
     mPBKDFIterations = params.GetIteration();
 
-    bool randomSetupPIN = !params.HasSetupPIN();
-    ReturnErrorOnFailure(
-        PASESession::GeneratePASEVerifier(mVerifier, mPBKDFIterations, mPBKDFSalt, randomSetupPIN, mSetupPayload.setUpPINCode));
+    bool randomSetupPIN      = !params.HasSetupPIN();
+    bool computeInBackground = params.GetComputeVerifierInBackground();
+    if (computeInBackground)
+    {
+        // The PIN is part of the returned payload, so only PBKDF2 is deferred.
+        if (randomSetupPIN)
+        {
+            ReturnErrorOnFailure(SetupPayload::generateRandomSetupPin(mSetupPayload.setUpPINCode));
+        }
+        else if (params.GetVerifierCache() != nullptr)
+        {
+            computeInBackground = params.GetVerifierCache()->Find(mPBKDFIterations, mPBKDFSalt, mSetupPayload.setUpPINCode,
+                                                                  mVerifier) != CHIP_NO_ERROR;
+        }
+    }
+    else
+    {
+        ReturnErrorOnFailure(PASESession::GeneratePASEVerifier(mVerifier, mPBKDFIterations, mPBKDFSalt, randomSetupPIN,
+                                                               mSetupPayload.setUpPINCode, params.GetVerifierCache()));
+    }
 
     payload                              = mSetupPayload;
     mCommissioningWindowCallback         = params.GetCallback();
@@ -137,9 +187,87 @@ CHIP_ERROR CommissioningWindowOpener::OpenCommissioningWindow(const Commissionin
         mNextStep = Step::kOpenCommissioningWindow;
     }
 
+    if (computeInBackground)
+    {
+        // Connecting to the device starts once the verifier is ready.
+        return StartVerifierComputation(randomSetupPIN ? nullptr : params.GetVerifierCache());
+    }
+
     return mController->GetConnectedDevice(mNodeId, &mDeviceConnected, &mDeviceConnectionFailure);
 }
 
+CHIP_ERROR CommissioningWindowOpener::StartVerifierComputation(PASEVerifierCache * verifierCache)
+{
+    auto * work = Platform::New<VerifierWork>();
+    VerifyOrReturnError(work != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    work->opener        = this;
+    work->verifierCache = verifierCache;
+    work->iterations    = mPBKDFIterations;
+    memcpy(work->saltBuffer, mPBKDFSalt.data(), mPBKDFSalt.size());
+    work->saltLength = mPBKDFSalt.size();
+    work->setupPIN   = mSetupPayload.setUpPINCode;
+
+    CHIP_ERROR err = DeviceLayer::PlatformMgr().ScheduleBackgroundWork(ComputeVerifierWork, reinterpret_cast<intptr_t>(work));
+    if (err != CHIP_NO_ERROR)
+    {
+        Platform::Delete(work);
+        return err;
+    }
+
+    mPendingVerifierWork = work;
+    return CHIP_NO_ERROR;
+}
+
+void CommissioningWindowOpener::ComputeVerifierWork(intptr_t context)
+{
+    auto * work  = reinterpret_cast<VerifierWork *>(context);
+    work->status = work->verifier.Generate(work->iterations, ByteSpan(work->saltBuffer, work->saltLength), work->setupPIN);
+
+    CHIP_ERROR err = DeviceLayer::PlatformMgr().ScheduleWork(OnVerifierComputed, context);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Failed to schedule PASE verifier completion: %" CHIP_ERROR_FORMAT, err.Format());
+        // Leave the work for the opener's destructor to release; it must not be touched from here on.
+        work->abandoned.store(true);
+    }
+}
+
+void CommissioningWindowOpener::OnVerifierComputed(intptr_t context)
+{
+    auto * work = reinterpret_cast<VerifierWork *>(context);
+    auto * self = work->opener;
+    if (self == nullptr)
+    {
+        Platform::Delete(work);
+        return;
+    }
+
+    self->mPendingVerifierWork = nullptr;
+
+    CHIP_ERROR err = work->status;
+    if (err == CHIP_NO_ERROR)
+    {
+        memcpy(&self->mVerifier, &work->verifier, sizeof(Spake2pVerifier));
+        if (work->verifierCache != nullptr)
+        {
+            CHIP_ERROR cacheErr =
+                work->verifierCache->Store(work->iterations, self->mPBKDFSalt, work->setupPIN, work->verifier);
+            if (cacheErr != CHIP_NO_ERROR)
+            {
+                ChipLogError(Controller, "Failed to cache PASE verifier: %" CHIP_ERROR_FORMAT, cacheErr.Format());
+            }
+        }
+        err = self->mController->GetConnectedDevice(self->mNodeId, &self->mDeviceConnected, &self->mDeviceConnectionFailure);
+    }
+    Platform::Delete(work);
+
+    if (err != CHIP_NO_ERROR)
+    {
+        OnOpenCommissioningWindowFailure(self, err);
+    }
+}
+
 CHIP_ERROR CommissioningWindowOpener::OpenCommissioningWindow(const CommissioningWindowVerifierParams & params)
 {
     VerifyOrReturnError(mNextStep == Step::kAcceptCommissioningStart, CHIP_ERROR_INCORRECT_STATE);
@@ -41,6 +41,7 @@ public:
         mController(controller), mDeviceConnected(&OnDeviceConnectedCallback, this),
         mDeviceConnectionFailure(&OnDeviceConnectionFailureCallback, this)
     {}
+    ~CommissioningWindowOpener();
 
     enum class CommissioningWindowOption : uint8_t
     {
@@ -147,7 +148,12 @@ private:
         kOpenCommissioningWindow,
     };
 
+    struct VerifierWork;
+
     CHIP_ERROR OpenCommissioningWindowInternal(Messaging::ExchangeManager & exchangeMgr, const SessionHandle & sessionHandle);
+    CHIP_ERROR StartVerifierComputation(PASEVerifierCache * verifierCache);
+    static void ComputeVerifierWork(intptr_t context);
+    static void OnVerifierComputed(intptr_t context);
     static void OnPIDReadResponse(void * context, uint16_t value);
     static void OnVIDReadResponse(void * context, VendorId value);
     static void OnVIDPIDReadFailureResponse(void * context, CHIP_ERROR error);
@@ -174,6 +180,8 @@ private:
     uint32_t mPBKDFIterations = 0;
     uint8_t mPBKDFSaltBuffer[Crypto::kSpake2p_Max_PBKDF_Salt_Length];
     ByteSpan mPBKDFSalt;
+    // Outstanding background verifier computation, if any.
+    VerifierWork * mPendingVerifierWork = nullptr;
 
     Callback::Callback<OnDeviceConnected> mDeviceConnected;
     Callback::Callback<OnDeviceConnectionFailure> mDeviceConnectionFailure;
@@ -27,6 +27,9 @@
 #include <system/SystemClock.h>
 
 namespace chip {
+
+class PASEVerifierCache;
+
 namespace Controller {
 
 // Passing SetupPayload by value on purpose, in case a consumer decides to reuse
@@ -141,6 +144,28 @@ public:
         return *this;
     }
 
+    PASEVerifierCache * GetVerifierCache() const { return mVerifierCache; }
+    // A cache of previously generated verifiers, used when a setup PIN is provided, so that
+    // reopening a window with the same PIN, salt and iteration count does not rerun PBKDF2.
+    // Must outlive the opening of the commissioning window.
+    CommissioningWindowPasscodeParams & SetVerifierCache(PASEVerifierCache * verifierCache)
+    {
+        mVerifierCache = verifierCache;
+        return *this;
+    }
+
+    bool GetComputeVerifierInBackground() const { return mComputeVerifierInBackground; }
+    // Should the PBKDF2 run that generates the verifier be done via
+    // PlatformManager::ScheduleBackgroundWork rather than on the Matter thread.  The setup
+    // payload, including a generated setup PIN, is still returned synchronously.  Without
+    // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING the work still runs on the Matter thread,
+    // but after OpenCommissioningWindow has returned.
+    CommissioningWindowPasscodeParams & SetComputeVerifierInBackground(bool computeVerifierInBackground)
+    {
+        mComputeVerifierInBackground = computeVerifierInBackground;
+        return *this;
+    }
+
     Callback::Callback<OnOpenCommissioningWindow> * GetCallback() const { return mCallback; }
     // The function to be called on success or failure of opening the commissioning window.
     // This will include the SetupPayload generated from provided parameters.
@@ -154,6 +179,8 @@ private:
     Optional<uint32_t> mSetupPIN                              = NullOptional;
     Optional<ByteSpan> mSalt                                  = NullOptional;
     bool mReadVIDPIDAttributes                                = false;
+    bool mComputeVerifierInBackground                         = false;
+    PASEVerifierCache * mVerifierCache                        = nullptr;
     Callback::Callback<OnOpenCommissioningWindow> * mCallback = nullptr;
 };
 
@@ -70,10 +70,18 @@ std::string GetFilename(const char * directory, const char * name)
     return std::string(dir) + "/chip_tool_config." + std::string(name) + ".ini";
 }
 
+PersistentStorage::~PersistentStorage()
+{
+    LogErrorOnFailure(Flush());
+}
+
 CHIP_ERROR PersistentStorage::Init(const char * name, const char * directory)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
+    // The storage may be re-initialized with another name: keep the updates made under the previous one.
+    ReturnErrorOnFailure(Flush());
+
     std::ifstream ifs;
     ifs.open(GetFilename(directory, name), std::ifstream::in);
     if (!ifs.good())
@@ -141,7 +149,7 @@ CHIP_ERROR PersistentStorage::SyncSetKeyValue(const char * key, const void * val
     }
 
     mConfig.sections[kDefaultSectionName] = section;
-    return CommitConfig(mDirectory, mName);
+    return CommitOrDefer();
 }
 
 CHIP_ERROR PersistentStorage::SyncDeleteKeyValue(const char * key)
@@ -154,7 +162,7 @@ CHIP_ERROR PersistentStorage::SyncDeleteKeyValue(const char * key)
     section.erase(escapedKey);
 
     mConfig.sections[kDefaultSectionName] = section;
-    return CommitConfig(mDirectory, mName);
+    return CommitOrDefer();
 }
 
 bool PersistentStorage::SyncDoesKeyExist(const char * key)
@@ -189,7 +197,24 @@ CHIP_ERROR PersistentStorage::SyncClearAll()
     auto section = mConfig.sections[kDefaultSectionName];
     section.clear();
     mConfig.sections[kDefaultSectionName] = section;
-    return CommitConfig(mDirectory, mName);
+    return CommitOrDefer();
+}
+
+void PersistentStorage::SetWriteBack(System::Clock::Seconds32 flushInterval)
+{
+    mWriteBack     = true;
+    mFlushInterval = flushInterval;
+    mLastCommit    = System::SystemClock().GetMonotonicTimestamp();
+}
+
+CHIP_ERROR PersistentStorage::Flush()
+{
+    VerifyOrReturnError(mDirty, CHIP_NO_ERROR);
+
+    ReturnErrorOnFailure(CommitConfig(mDirectory, mName));
+    mDirty      = false;
+    mLastCommit = System::SystemClock().GetMonotonicTimestamp();
+    return CHIP_NO_ERROR;
 }
 
 const char * PersistentStorage::GetDirectory() const
@@ -216,6 +241,21 @@ exit:
     return err;
 }
 
+CHIP_ERROR PersistentStorage::CommitOrDefer()
+{
+    if (!mWriteBack)
+    {
+        return CommitConfig(mDirectory, mName);
+    }
+
+    mDirty = true;
+    if (mFlushInterval.count() != 0 && System::SystemClock().GetMonotonicTimestamp() - mLastCommit >= mFlushInterval)
+    {
+        return Flush();
+    }
+    return CHIP_NO_ERROR;
+}
+
 uint16_t PersistentStorage::GetListenPort()
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
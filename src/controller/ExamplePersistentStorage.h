@@ -22,10 +22,13 @@
 #include <controller/CHIPDeviceController.h>
 #include <inipp/inipp.h>
 #include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
 
 class PersistentStorage : public chip::PersistentStorageDelegate
 {
 public:
+    ~PersistentStorage() override;
+
     /**
      * name is the name of the storage to use.  If null, defaults to
      * "chip_tool_config.ini".
@@ -39,6 +42,18 @@ public:
      */
     CHIP_ERROR Init(const char * name = nullptr, const char * directory = nullptr);
 
+    /**
+     * Keep the updates in memory instead of rewriting the storage file on each
+     * of them, which dominates the run time of controllers driving many
+     * devices.  The pending updates are written by the first update made
+     * flushInterval or more after the last write, when flushInterval is not
+     * zero, and by Flush, which Init and the destructor call.
+     */
+    void SetWriteBack(chip::System::Clock::Seconds32 flushInterval);
+
+    // Write the pending updates, if any, to the storage file.
+    CHIP_ERROR Flush();
+
     /////////// PersistentStorageDelegate Interface /////////
     CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override;
     CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override;
@@ -70,7 +85,13 @@ public:
 
 private:
     CHIP_ERROR CommitConfig(const char * directory, const char * name);
+    CHIP_ERROR CommitOrDefer();
     inipp::Ini<char> mConfig;
-    const char * mName;
-    const char * mDirectory;
+    const char * mName      = nullptr;
+    const char * mDirectory = nullptr;
+
+    bool mWriteBack = false;
+    bool mDirty     = false;
+    chip::System::Clock::Seconds32 mFlushInterval{ 0 };
+    chip::System::Clock::Timestamp mLastCommit{ 0 };
 };
@@ -0,0 +1,614 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/InteractionBatcher.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+#include <string.h>
+
+namespace chip {
+namespace Controller {
+
+namespace {
+
+constexpr uint32_t kInitialPreencodeBufferSize = 256;
+
+// Copies an element encoded beforehand, e.g. the fields of a queued command.
+class PreencodedElement : public app::DataModel::EncodableToTLV
+{
+public:
+    PreencodedElement(const ByteSpan & aElement) : mElement(aElement) {}
+
+    CHIP_ERROR EncodeTo(TLV::TLVWriter & aWriter, TLV::Tag aTag) const override
+    {
+        TLV::TLVReader reader;
+        reader.Init(mElement);
+        ReturnErrorOnFailure(reader.Next());
+        return aWriter.CopyElement(aTag, reader);
+    }
+
+private:
+    ByteSpan mElement;
+};
+
+bool IsSameAttribute(const app::ConcreteAttributePath & aPath, const app::ConcreteAttributePath & aOther)
+{
+    return aPath.mEndpointId == aOther.mEndpointId && aPath.mClusterId == aOther.mClusterId &&
+        aPath.mAttributeId == aOther.mAttributeId;
+}
+
+} // namespace
+
+void InteractionBatcher::PendingWrite::Complete(const app::ConcreteDataAttributePath * apPath, CHIP_ERROR aError)
+{
+    VerifyOrReturn(!mCompleted);
+    mCompleted = true;
+
+    if (apPath != nullptr && aError == CHIP_NO_ERROR)
+    {
+        mOnSuccess(*apPath);
+    }
+    else
+    {
+        mOnError(apPath, aError);
+    }
+}
+
+InteractionBatcher::InvokeBatch::InvokeBatch(InteractionBatcher & aBatcher, const SessionHolder & aSession,
+                                             const Optional<uint16_t> & aTimedInvokeTimeoutMs) :
+    mBatcher(aBatcher),
+    mSession(aSession), mCommandSender(this, aBatcher.mpExchangeMgr, aTimedInvokeTimeoutMs.HasValue())
+{
+    VerifyOrReturn(mSession);
+
+    app::CommandSender::ConfigParameters config;
+    config.SetRemoteMaxPathsPerInvoke(mSession->GetRemoteSessionParameters().GetMaxPathsPerInvoke());
+    LogErrorOnFailure(mCommandSender.SetCommandSenderConfig(config));
+}
+
+InteractionBatcher::InvokeBatch::~InvokeBatch()
+{
+    while (!mInvokes.Empty())
+    {
+        PendingInvoke * invoke = &*mInvokes.begin();
+        mInvokes.Remove(invoke);
+        Platform::Delete(invoke);
+    }
+}
+
+CHIP_ERROR InteractionBatcher::InvokeBatch::TryAdd(PendingInvoke * apInvoke)
+{
+    app::CommandSender::AddRequestDataParameters params(apInvoke->mTimedInvokeTimeoutMs);
+    params.SetCommandRef(mNextCommandRef);
+
+    // AddRequestData rolls the InvokeRequest back if the command does not fit, e.g. past MaxPathsPerInvoke.
+    PreencodedElement fields(ByteSpan(apInvoke->mFields.Get(), apInvoke->mFields.AllocatedSize()));
+    ReturnErrorOnFailure(
+        mCommandSender.AddRequestData(apInvoke->mPath, static_cast<const app::DataModel::EncodableToTLV &>(fields), params));
+
+    apInvoke->mCommandRef = mNextCommandRef++;
+    mInvokes.PushBack(apInvoke);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR InteractionBatcher::InvokeBatch::SendRequest()
+{
+    VerifyOrReturnError(mSession, CHIP_ERROR_NOT_CONNECTED);
+    return mCommandSender.SendCommandRequest(mSession.Get().Value());
+}
+
+void InteractionBatcher::InvokeBatch::Fail(CHIP_ERROR aError)
+{
+    OnError(&mCommandSender, app::CommandSender::ErrorData{ aError });
+    OnDone(&mCommandSender);
+}
+
+void InteractionBatcher::InvokeBatch::OnResponse(app::CommandSender * apCommandSender,
+                                                 const app::CommandSender::ResponseData & aResponseData)
+{
+    VerifyOrReturn(aResponseData.commandRef.HasValue());
+
+    for (auto & invoke : mInvokes)
+    {
+        if (invoke.mCommandRef != aResponseData.commandRef.Value())
+        {
+            continue;
+        }
+
+        // As CommandSender does for callbacks that are not extendable, path-specific errors are reported to OnError.
+        if (aResponseData.statusIB.IsSuccess())
+        {
+            invoke.mpCallback->OnResponse(apCommandSender, aResponseData.path, aResponseData.statusIB, aResponseData.data);
+        }
+        else
+        {
+            invoke.mpCallback->OnError(apCommandSender, aResponseData.statusIB.ToChipError());
+        }
+        return;
+    }
+}
+
+void InteractionBatcher::InvokeBatch::OnError(const app::CommandSender * apCommandSender,
+                                              const app::CommandSender::ErrorData & aErrorData)
+{
+    for (auto & invoke : mInvokes)
+    {
+        invoke.mpCallback->OnError(apCommandSender, aErrorData.error);
+    }
+}
+
+void InteractionBatcher::InvokeBatch::OnDone(app::CommandSender * apCommandSender)
+{
+    while (!mInvokes.Empty())
+    {
+        PendingInvoke * invoke = &*mInvokes.begin();
+        mInvokes.Remove(invoke);
+        // Reports the commands the peer did not respond to.
+        invoke->mpCallback->OnDone(apCommandSender);
+        Platform::Delete(invoke);
+    }
+
+    // Destroys this batch.
+    mBatcher.OnInvokeBatchDone(this);
+}
+
+InteractionBatcher::WriteBatch::WriteBatch(InteractionBatcher & aBatcher, const SessionHolder & aSession,
+                                           const Optional<uint16_t> & aTimedWriteTimeoutMs) :
+    mBatcher(aBatcher),
+    mSession(aSession), mChunkedCallback(this), mWriteClient(aBatcher.mpExchangeMgr, &mChunkedCallback, aTimedWriteTimeoutMs)
+{}
+
+InteractionBatcher::WriteBatch::~WriteBatch()
+{
+    while (!mWrites.Empty())
+    {
+        PendingWrite * write = &*mWrites.begin();
+        mWrites.Remove(write);
+        Platform::Delete(write);
+    }
+}
+
+bool InteractionBatcher::WriteBatch::WritesAttribute(const app::ConcreteAttributePath & aPath) const
+{
+    for (const auto & write : mWrites)
+    {
+        if (IsSameAttribute(write.mPath, aPath))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+CHIP_ERROR InteractionBatcher::WriteBatch::Add(PendingWrite * apWrite)
+{
+    mWrites.PushBack(apWrite);
+
+    TLV::TLVReader reader;
+    reader.Init(apWrite->mValue.Get(), apWrite->mValue.AllocatedSize());
+    ReturnErrorOnFailure(reader.Next());
+    return mWriteClient.PutPreencodedAttribute(apWrite->mPath, reader);
+}
+
+CHIP_ERROR InteractionBatcher::WriteBatch::SendRequest()
+{
+    VerifyOrReturnError(mSession, CHIP_ERROR_NOT_CONNECTED);
+    return mWriteClient.SendWriteRequest(mSession.Get().Value());
+}
+
+void InteractionBatcher::WriteBatch::Fail(CHIP_ERROR aError)
+{
+    OnError(&mWriteClient, aError);
+    OnDone(&mWriteClient);
+}
+
+void InteractionBatcher::WriteBatch::OnResponse(const app::WriteClient * apWriteClient,
+                                                const app::ConcreteDataAttributePath & aPath, app::StatusIB aStatus)
+{
+    for (auto & write : mWrites)
+    {
+        if (!write.mCompleted && IsSameAttribute(write.mPath, aPath))
+        {
+            write.Complete(&aPath, aStatus.IsSuccess() ? CHIP_NO_ERROR : aStatus.ToChipError());
+            return;
+        }
+    }
+}
+
+void InteractionBatcher::WriteBatch::OnError(const app::WriteClient * apWriteClient, CHIP_ERROR aError)
+{
+    for (auto & write : mWrites)
+    {
+        write.Complete(nullptr, aError);
+    }
+}
+
+void InteractionBatcher::WriteBatch::OnDone(app::WriteClient * apWriteClient)
+{
+    while (!mWrites.Empty())
+    {
+        PendingWrite * write = &*mWrites.begin();
+        mWrites.Remove(write);
+        // The peer did not respond for this attribute, which WriteAttribute reports the same way.
+        write->Complete(nullptr, CHIP_END_OF_TLV);
+        Platform::Delete(write);
+    }
+
+    // Destroys this batch.
+    mBatcher.OnWriteBatchDone(this);
+}
+
+InteractionBatcher::InteractionBatcher(Messaging::ExchangeManager * apExchangeMgr, System::Clock::Milliseconds32 aBatchWindow) :
+    mpExchangeMgr(apExchangeMgr), mBatchWindow(aBatchWindow)
+{}
+
+InteractionBatcher::~InteractionBatcher()
+{
+    mpExchangeMgr->GetSessionManager()->SystemLayer()->CancelTimer(DispatchTimerCallback, this);
+
+    while (!mQueuedInvokes.Empty())
+    {
+        PendingInvoke * invoke = &*mQueuedInvokes.begin();
+        mQueuedInvokes.Remove(invoke);
+        Platform::Delete(invoke);
+    }
+    while (!mQueuedWrites.Empty())
+    {
+        PendingWrite * write = &*mQueuedWrites.begin();
+        mQueuedWrites.Remove(write);
+        Platform::Delete(write);
+    }
+
+    // Destroying the CommandSenders and WriteClients aborts their exchanges, without calling OnDone.
+    while (!mInvokeBatches.Empty())
+    {
+        InvokeBatch * batch = &*mInvokeBatches.begin();
+        mInvokeBatches.Remove(batch);
+        Platform::Delete(batch);
+    }
+    while (!mWriteBatches.Empty())
+    {
+        WriteBatch * batch = &*mWriteBatches.begin();
+        mWriteBatches.Remove(batch);
+        Platform::Delete(batch);
+    }
+}
+
+void InteractionBatcher::Flush()
+{
+    ScheduleDispatch(System::Clock::kZero);
+}
+
+size_t InteractionBatcher::GetNumQueuedRequests() const
+{
+    size_t count = 0;
+    for (auto it = mQueuedInvokes.begin(); it != mQueuedInvokes.end(); ++it)
+    {
+        count++;
+    }
+    for (auto it = mQueuedWrites.begin(); it != mQueuedWrites.end(); ++it)
+    {
+        count++;
+    }
+    return count;
+}
+
+size_t InteractionBatcher::GetNumBatchesInFlight() const
+{
+    size_t count = 0;
+    for (auto it = mInvokeBatches.begin(); it != mInvokeBatches.end(); ++it)
+    {
+        count++;
+    }
+    for (auto it = mWriteBatches.begin(); it != mWriteBatches.end(); ++it)
+    {
+        count++;
+    }
+    return count;
+}
+
+CHIP_ERROR InteractionBatcher::Preencode(const app::DataModel::EncodableToTLV & aEncodable,
+                                         Platform::ScopedMemoryBufferWithSize<uint8_t> & aBuffer)
+{
+    // Most commands and attribute values are small: start with a small buffer, and grow it as needed.
+    uint32_t bufferSize = kInitialPreencodeBufferSize;
+    while (true)
+    {
+        Platform::ScopedMemoryBuffer<uint8_t> buffer;
+        VerifyOrReturnError(buffer.Alloc(bufferSize), CHIP_ERROR_NO_MEMORY);
+
+        TLV::TLVWriter writer;
+        writer.Init(buffer.Get(), bufferSize);
+        CHIP_ERROR err = aEncodable.EncodeTo(writer, TLV::AnonymousTag());
+        if (err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL)
+        {
+            // The TLV writer ran out of room at the end of the buffer.
+            VerifyOrReturnError(bufferSize < UINT16_MAX, CHIP_ERROR_BUFFER_TOO_SMALL);
+            bufferSize = std::min<uint32_t>(bufferSize * 2, UINT16_MAX);
+            continue;
+        }
+        ReturnErrorOnFailure(err);
+        ReturnErrorOnFailure(writer.Finalize());
+
+        VerifyOrReturnError(aBuffer.Alloc(writer.GetLengthWritten()), CHIP_ERROR_NO_MEMORY);
+        memcpy(aBuffer.Get(), buffer.Get(), aBuffer.AllocatedSize());
+        return CHIP_NO_ERROR;
+    }
+}
+
+bool InteractionBatcher::IsSameSession(const SessionHolder & aSession, const SessionHolder & aOther)
+{
+    // Requests whose session is gone are never batched together; each of them fails on its own.
+    VerifyOrReturnValue(aSession && aOther, false);
+    return aSession.Contains(aOther.Get().Value());
+}
+
+CHIP_ERROR InteractionBatcher::QueueInvoke(const SessionHandle & aSession, const app::CommandPathParams & aPath,
+                                           const app::DataModel::EncodableToTLV & aFields,
+                                           app::CommandSender::Callback * apCallback,
+                                           const Optional<uint16_t> & aTimedInvokeTimeoutMs)
+{
+    PendingInvoke * invoke = Platform::New<PendingInvoke>(aPath);
+    if (invoke == nullptr)
+    {
+        Platform::Delete(apCallback);
+        return CHIP_ERROR_NO_MEMORY;
+    }
+    invoke->mpCallback = apCallback;
+
+    // Commands to a group have no responses to route.
+    CHIP_ERROR err = aSession->IsGroupSession() ? CHIP_ERROR_INVALID_ARGUMENT : Preencode(aFields, invoke->mFields);
+    if (err != CHIP_NO_ERROR)
+    {
+        Platform::Delete(invoke);
+        return err;
+    }
+    invoke->mSession.Grab(aSession);
+    invoke->mTimedInvokeTimeoutMs = aTimedInvokeTimeoutMs;
+
+    mQueuedInvokes.PushBack(invoke);
+    if (!mDispatchScheduled)
+    {
+        ScheduleDispatch(mBatchWindow);
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR InteractionBatcher::QueueWrite(const SessionHandle & aSession, const app::ConcreteDataAttributePath & aPath,
+                                          const app::DataModel::EncodableToTLV & aValue,
+                                          WriteCallback::OnSuccessCallbackType aOnSuccess,
+                                          WriteCallback::OnErrorCallbackType aOnError,
+                                          const Optional<uint16_t> & aTimedWriteTimeoutMs)
+{
+    // Writes to a group have no responses to route.
+    VerifyOrReturnError(!aSession->IsGroupSession(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    PendingWrite * write = Platform::New<PendingWrite>();
+    VerifyOrReturnError(write != nullptr, CHIP_ERROR_NO_MEMORY);
+    CHIP_ERROR err = Preencode(aValue, write->mValue);
+    if (err != CHIP_NO_ERROR)
+    {
+        Platform::Delete(write);
+        return err;
+    }
+    write->mSession.Grab(aSession);
+    write->mPath                = aPath;
+    write->mTimedWriteTimeoutMs = aTimedWriteTimeoutMs;
+    write->mOnSuccess           = std::move(aOnSuccess);
+    write->mOnError             = std::move(aOnError);
+
+    mQueuedWrites.PushBack(write);
+    if (!mDispatchScheduled)
+    {
+        ScheduleDispatch(mBatchWindow);
+    }
+    return CHIP_NO_ERROR;
+}
+
+void InteractionBatcher::ScheduleDispatch(System::Clock::Timeout aDelay)
+{
+    // An earlier dispatch already scheduled is replaced.
+    CHIP_ERROR err = mpExchangeMgr->GetSessionManager()->SystemLayer()->StartTimer(aDelay, DispatchTimerCallback, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Failed to schedule batched interactions: %" CHIP_ERROR_FORMAT, err.Format());
+        return;
+    }
+    mDispatchScheduled = true;
+}
+
+void InteractionBatcher::DispatchTimerCallback(System::Layer * apSystemLayer, void * apAppState)
+{
+    auto * batcher              = static_cast<InteractionBatcher *>(apAppState);
+    batcher->mDispatchScheduled = false;
+    batcher->Dispatch();
+}
+
+void InteractionBatcher::Dispatch()
+{
+    DispatchInvokes();
+    DispatchWrites();
+}
+
+void InteractionBatcher::DispatchInvokes()
+{
+    auto it = mQueuedInvokes.begin();
+    while (it != mQueuedInvokes.end())
+    {
+        PendingInvoke * first = &*it;
+        ++it;
+
+        bool sessionBusy = false;
+        for (auto & batch : mInvokeBatches)
+        {
+            sessionBusy = sessionBusy || IsSameSession(batch.GetSession(), first->mSession);
+        }
+        if (sessionBusy)
+        {
+            continue;
+        }
+
+        const Optional<uint16_t> timedInvokeTimeoutMs = first->mTimedInvokeTimeoutMs;
+        InvokeBatch * batch                           = Platform::New<InvokeBatch>(*this, first->mSession, timedInvokeTimeoutMs);
+        if (batch == nullptr)
+        {
+            ChipLogError(Controller, "No memory for batched invoke, retrying once a batch completes");
+            return;
+        }
+
+        mQueuedInvokes.Remove(first);
+        CHIP_ERROR err = batch->TryAdd(first);
+        if (err != CHIP_NO_ERROR)
+        {
+            // A command that does not fit in an empty InvokeRequest cannot be sent at all.
+            Platform::Delete(batch);
+            first->mpCallback->OnError(nullptr, err);
+            first->mpCallback->OnDone(nullptr);
+            Platform::Delete(first);
+            it = mQueuedInvokes.begin();
+            continue;
+        }
+        mInvokeBatches.PushBack(batch);
+
+        while (it != mQueuedInvokes.end())
+        {
+            PendingInvoke * invoke = &*it;
+            if (!IsSameSession(invoke->mSession, batch->GetSession()))
+            {
+                ++it;
+                continue;
+            }
+
+            // Commands after one that does not fit wait for the next InvokeRequest, to be processed in order.
+            ++it;
+            mQueuedInvokes.Remove(invoke);
+            if (invoke->mTimedInvokeTimeoutMs != timedInvokeTimeoutMs || batch->TryAdd(invoke) != CHIP_NO_ERROR)
+            {
+                mQueuedInvokes.InsertBefore(it, invoke);
+                break;
+            }
+        }
+
+        err = batch->SendRequest();
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Controller, "Failed to send batched invoke: %" CHIP_ERROR_FORMAT, err.Format());
+            // Dispatching starts over, on the updated queue, once the callbacks are done.
+            batch->Fail(err);
+            return;
+        }
+
+        it = mQueuedInvokes.begin();
+    }
+}
+
+void InteractionBatcher::DispatchWrites()
+{
+    auto it = mQueuedWrites.begin();
+    while (it != mQueuedWrites.end())
+    {
+        PendingWrite * first = &*it;
+        ++it;
+
+        bool sessionBusy = false;
+        for (auto & batch : mWriteBatches)
+        {
+            sessionBusy = sessionBusy || IsSameSession(batch.GetSession(), first->mSession);
+        }
+        if (sessionBusy)
+        {
+            continue;
+        }
+
+        const Optional<uint16_t> timedWriteTimeoutMs = first->mTimedWriteTimeoutMs;
+        WriteBatch * batch                           = Platform::New<WriteBatch>(*this, first->mSession, timedWriteTimeoutMs);
+        if (batch == nullptr)
+        {
+            ChipLogError(Controller, "No memory for batched write, retrying once a batch completes");
+            return;
+        }
+        mWriteBatches.PushBack(batch);
+
+        mQueuedWrites.Remove(first);
+        CHIP_ERROR err = batch->Add(first);
+
+        while (err == CHIP_NO_ERROR && it != mQueuedWrites.end())
+        {
+            PendingWrite * write = &*it;
+            if (!IsSameSession(write->mSession, batch->GetSession()))
+            {
+                ++it;
+                continue;
+            }
+
+            // A second write of an attribute waits for the next WriteRequest, with the writes after it, to be processed in
+            // order.
+            if (write->mTimedWriteTimeoutMs != timedWriteTimeoutMs || batch->WritesAttribute(write->mPath))
+            {
+                break;
+            }
+            ++it;
+            mQueuedWrites.Remove(write);
+            err = batch->Add(write);
+        }
+
+        if (err == CHIP_NO_ERROR)
+        {
+            err = batch->SendRequest();
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Controller, "Failed to send batched write: %" CHIP_ERROR_FORMAT, err.Format());
+            // Dispatching starts over, on the updated queue, once the callbacks are done.
+            batch->Fail(err);
+            return;
+        }
+
+        it = mQueuedWrites.begin();
+    }
+}
+
+void InteractionBatcher::OnInvokeBatchDone(InvokeBatch * apBatch)
+{
+    mInvokeBatches.Remove(apBatch);
+    Platform::Delete(apBatch);
+
+    // The requests queued behind this batch go out right away.
+    if (!mQueuedInvokes.Empty() || !mQueuedWrites.Empty())
+    {
+        ScheduleDispatch(System::Clock::kZero);
+    }
+}
+
+void InteractionBatcher::OnWriteBatchDone(WriteBatch * apBatch)
+{
+    mWriteBatches.Remove(apBatch);
+    Platform::Delete(apBatch);
+
+    // The requests queued behind this batch go out right away.
+    if (!mQueuedInvokes.Empty() || !mQueuedWrites.Empty())
+    {
+        ScheduleDispatch(System::Clock::kZero);
+    }
+}
+
+} // namespace Controller
+} // namespace chip
@@ -0,0 +1,317 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  @file
+ *    Controller-side queue merging the commands and attribute writes issued to a node within a short window into batched
+ *    InvokeRequests and WriteRequests, and routing the responses back to the callbacks of the individual requests.
+ */
+
+#pragma once
+
+#include <app/ChunkedWriteCallback.h>
+#include <app/CommandPathParams.h>
+#include <app/CommandSender.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/WriteClient.h>
+#include <app/data-model/Encode.h>
+#include <app/data-model/EncodableToTLV.h>
+#include <app/data-model/List.h>
+#include <app/data-model/Nullable.h>
+#include <controller/TypedCommandCallback.h>
+#include <controller/WriteInteraction.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/Optional.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/IntrusiveList.h>
+#include <lib/support/ScopedBuffer.h>
+#include <messaging/ExchangeMgr.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+#include <transport/Session.h>
+
+namespace chip {
+namespace Controller {
+
+namespace Internal {
+
+// Encode attribute values the way WriteClient::EncodeAttribute does, so that the batcher can keep a copy of them until the
+// WriteRequest is built.
+template <class T, std::enable_if_t<!app::DataModel::IsFabricScoped<T>::value, int> = 0>
+CHIP_ERROR EncodeWriteValue(TLV::TLVWriter & aWriter, TLV::Tag aTag, const T & aValue)
+{
+    return app::DataModel::Encode(aWriter, aTag, aValue);
+}
+
+template <class T, std::enable_if_t<app::DataModel::IsFabricScoped<T>::value, int> = 0>
+CHIP_ERROR EncodeWriteValue(TLV::TLVWriter & aWriter, TLV::Tag aTag, const T & aValue)
+{
+    return app::DataModel::EncodeForWrite(aWriter, aTag, aValue);
+}
+
+template <class T>
+CHIP_ERROR EncodeWriteValue(TLV::TLVWriter & aWriter, TLV::Tag aTag, const app::DataModel::List<T> & aValue)
+{
+    TLV::TLVType outerType;
+    ReturnErrorOnFailure(aWriter.StartContainer(aTag, TLV::kTLVType_Array, outerType));
+    for (const auto & item : aValue)
+    {
+        ReturnErrorOnFailure(EncodeWriteValue(aWriter, TLV::AnonymousTag(), item));
+    }
+    return aWriter.EndContainer(outerType);
+}
+
+template <class T>
+CHIP_ERROR EncodeWriteValue(TLV::TLVWriter & aWriter, TLV::Tag aTag, const app::DataModel::Nullable<T> & aValue)
+{
+    if (aValue.IsNull())
+    {
+        return aWriter.PutNull(aTag);
+    }
+    return EncodeWriteValue(aWriter, aTag, aValue.Value());
+}
+
+template <class T>
+class WriteValueEncodable : public app::DataModel::EncodableToTLV
+{
+public:
+    WriteValueEncodable(const T & aValue) : mValue(aValue) {}
+
+    CHIP_ERROR EncodeTo(TLV::TLVWriter & aWriter, TLV::Tag aTag) const override { return EncodeWriteValue(aWriter, aTag, mValue); }
+
+private:
+    const T & mValue;
+};
+
+} // namespace Internal
+
+/**
+ * InteractionBatcher queues the commands and attribute writes issued to a node, and sends the ones queued within its batch
+ * window together:
+ *
+ * - consecutive commands to the same session, with the same timed invoke timeout, share an InvokeRequest, up to the
+ *   MaxPathsPerInvoke of the peer and to what fits in a message;
+ * - consecutive attribute writes to the same session, with the same timed write timeout, share a WriteRequest, which is
+ *   chunked as needed.  A second write of the same attribute goes in the next WriteRequest.
+ *
+ * Each session has at most one InvokeRequest and one WriteRequest of the batcher in flight, so the commands, and the writes,
+ * issued to a node are processed in order.  The callbacks are the ones of InvokeCommandRequest and WriteAttribute, and are
+ * called as if each request had been sent on its own.
+ *
+ * The requests are copied when queued.  Group sessions are not supported, since their requests have no responses to route.
+ */
+class InteractionBatcher
+{
+public:
+    /**
+     * @param[in] aBatchWindow How long the first request queued waits for others to join its batch.  Zero sends the requests
+     *                         queued by the current callers from the event loop.
+     */
+    InteractionBatcher(Messaging::ExchangeManager * apExchangeMgr, System::Clock::Milliseconds32 aBatchWindow);
+
+    /**
+     * Drop the queued requests and abort the ones in flight, without calling their callbacks.
+     */
+    ~InteractionBatcher();
+
+    InteractionBatcher(const InteractionBatcher &)             = delete;
+    InteractionBatcher & operator=(const InteractionBatcher &) = delete;
+
+    /**
+     * Queue a command, as InvokeCommandRequest would send it.
+     *
+     * @retval #CHIP_ERROR_INVALID_ARGUMENT if the session is a group session, or the command needs a timed invoke timeout.
+     * @retval #CHIP_ERROR_NO_MEMORY if the command cannot be queued.
+     */
+    template <typename RequestObjectT>
+    CHIP_ERROR
+    InvokeCommand(const SessionHandle & aSession, EndpointId aEndpointId, const RequestObjectT & aRequest,
+                  typename TypedCommandCallback<typename RequestObjectT::ResponseType>::OnSuccessCallbackType aOnSuccess,
+                  typename TypedCommandCallback<typename RequestObjectT::ResponseType>::OnErrorCallbackType aOnError,
+                  const Optional<uint16_t> & aTimedInvokeTimeoutMs = NullOptional)
+    {
+        VerifyOrReturnError(!RequestObjectT::MustUseTimedInvoke() || aTimedInvokeTimeoutMs.HasValue(),
+                            CHIP_ERROR_INVALID_ARGUMENT);
+
+        app::CommandPathParams path(aEndpointId, 0, RequestObjectT::GetClusterId(), RequestObjectT::GetCommandId(),
+                                    app::CommandPathFlags::kEndpointIdValid);
+        app::DataModel::EncodableType<RequestObjectT> encodable(aRequest);
+
+        // The batcher routes the responses to the callback, and deletes it once the InvokeRequest is done.
+        auto * callback = Platform::New<TypedCommandCallback<typename RequestObjectT::ResponseType>>(
+            aOnSuccess, aOnError, [](app::CommandSender *) {});
+        VerifyOrReturnError(callback != nullptr, CHIP_ERROR_NO_MEMORY);
+        return QueueInvoke(aSession, path, encodable, callback, aTimedInvokeTimeoutMs);
+    }
+
+    /**
+     * Queue an attribute write, as WriteAttribute would send it.
+     *
+     * @retval #CHIP_ERROR_INVALID_ARGUMENT if the session is a group session.
+     * @retval #CHIP_ERROR_NO_MEMORY if the write cannot be queued.
+     */
+    template <typename AttrType>
+    CHIP_ERROR WriteAttribute(const SessionHandle & aSession, EndpointId aEndpointId, ClusterId aClusterId,
+                              AttributeId aAttributeId, const AttrType & aValue, WriteCallback::OnSuccessCallbackType aOnSuccess,
+                              WriteCallback::OnErrorCallbackType aOnError,
+                              const Optional<uint16_t> & aTimedWriteTimeoutMs = NullOptional,
+                              const Optional<DataVersion> & aDataVersion      = NullOptional)
+    {
+        Internal::WriteValueEncodable<AttrType> encodable(aValue);
+        return QueueWrite(aSession, app::ConcreteDataAttributePath(aEndpointId, aClusterId, aAttributeId, aDataVersion), encodable,
+                          std::move(aOnSuccess), std::move(aOnError), aTimedWriteTimeoutMs);
+    }
+
+    template <typename AttributeInfo>
+    CHIP_ERROR WriteAttribute(const SessionHandle & aSession, EndpointId aEndpointId, const typename AttributeInfo::Type & aValue,
+                              WriteCallback::OnSuccessCallbackType aOnSuccess, WriteCallback::OnErrorCallbackType aOnError,
+                              const Optional<uint16_t> & aTimedWriteTimeoutMs = NullOptional,
+                              const Optional<DataVersion> & aDataVersion      = NullOptional)
+    {
+        VerifyOrReturnError(!AttributeInfo::MustUseTimedWrite() || aTimedWriteTimeoutMs.HasValue(), CHIP_ERROR_INVALID_ARGUMENT);
+        return WriteAttribute(aSession, aEndpointId, AttributeInfo::GetClusterId(), AttributeInfo::GetAttributeId(), aValue,
+                              std::move(aOnSuccess), std::move(aOnError), aTimedWriteTimeoutMs, aDataVersion);
+    }
+
+    /**
+     * Send the queued requests from the event loop, instead of at the end of the batch window.
+     */
+    void Flush();
+
+    size_t GetNumQueuedRequests() const;
+    size_t GetNumBatchesInFlight() const;
+
+private:
+    struct PendingInvoke : public IntrusiveListNodeBase<>
+    {
+        PendingInvoke(const app::CommandPathParams & aPath) : mPath(aPath) {}
+        ~PendingInvoke() { Platform::Delete(mpCallback); }
+
+        SessionHolder mSession;
+        app::CommandPathParams mPath;
+        Optional<uint16_t> mTimedInvokeTimeoutMs;
+        Platform::ScopedMemoryBufferWithSize<uint8_t> mFields;
+        app::CommandSender::Callback * mpCallback = nullptr;
+        uint16_t mCommandRef                      = 0;
+    };
+
+    struct PendingWrite : public IntrusiveListNodeBase<>
+    {
+        // Call the callbacks with the outcome of the write, unless they already were.
+        void Complete(const app::ConcreteDataAttributePath * apPath, CHIP_ERROR aError);
+
+        SessionHolder mSession;
+        app::ConcreteDataAttributePath mPath;
+        Optional<uint16_t> mTimedWriteTimeoutMs;
+        Platform::ScopedMemoryBufferWithSize<uint8_t> mValue;
+        WriteCallback::OnSuccessCallbackType mOnSuccess;
+        WriteCallback::OnErrorCallbackType mOnError;
+        bool mCompleted = false;
+    };
+
+    // An InvokeRequest in flight, shared by the commands packed into it.
+    class InvokeBatch : public app::CommandSender::ExtendableCallback, public IntrusiveListNodeBase<>
+    {
+    public:
+        InvokeBatch(InteractionBatcher & aBatcher, const SessionHolder & aSession,
+                    const Optional<uint16_t> & aTimedInvokeTimeoutMs);
+        ~InvokeBatch() override;
+
+        // Add the command to the InvokeRequest, taking ownership of it.  Fails, leaving the command to the caller, if the
+        // InvokeRequest is full.
+        CHIP_ERROR TryAdd(PendingInvoke * apInvoke);
+        CHIP_ERROR SendRequest();
+        void Fail(CHIP_ERROR aError);
+
+        const SessionHolder & GetSession() const { return mSession; }
+
+    private:
+        void OnResponse(app::CommandSender * apCommandSender, const app::CommandSender::ResponseData & aResponseData) override;
+        void OnError(const app::CommandSender * apCommandSender, const app::CommandSender::ErrorData & aErrorData) override;
+        void OnDone(app::CommandSender * apCommandSender) override;
+
+        InteractionBatcher & mBatcher;
+        SessionHolder mSession;
+        app::CommandSender mCommandSender;
+        IntrusiveList<PendingInvoke> mInvokes;
+        uint16_t mNextCommandRef = 0;
+    };
+
+    // A WriteRequest in flight, shared by the writes packed into it.
+    class WriteBatch : public app::WriteClient::Callback, public IntrusiveListNodeBase<>
+    {
+    public:
+        WriteBatch(InteractionBatcher & aBatcher, const SessionHolder & aSession, const Optional<uint16_t> & aTimedWriteTimeoutMs);
+        ~WriteBatch() override;
+
+        bool WritesAttribute(const app::ConcreteAttributePath & aPath) const;
+
+        // Add the write to the WriteRequest, taking ownership of it.  The WriteRequest cannot be sent if this fails.
+        CHIP_ERROR Add(PendingWrite * apWrite);
+        CHIP_ERROR SendRequest();
+        void Fail(CHIP_ERROR aError);
+
+        const SessionHolder & GetSession() const { return mSession; }
+
+    private:
+        void OnResponse(const app::WriteClient * apWriteClient, const app::ConcreteDataAttributePath & aPath,
+                        app::StatusIB aStatus) override;
+        void OnError(const app::WriteClient * apWriteClient, CHIP_ERROR aError) override;
+        void OnDone(app::WriteClient * apWriteClient) override;
+
+        InteractionBatcher & mBatcher;
+        SessionHolder mSession;
+        app::ChunkedWriteCallback mChunkedCallback;
+        app::WriteClient mWriteClient;
+        IntrusiveList<PendingWrite> mWrites;
+    };
+
+    // Keep a copy of the element encoded by aEncodable.
+    static CHIP_ERROR Preencode(const app::DataModel::EncodableToTLV & aEncodable,
+                                Platform::ScopedMemoryBufferWithSize<uint8_t> & aBuffer);
+    static bool IsSameSession(const SessionHolder & aSession, const SessionHolder & aOther);
+
+    CHIP_ERROR QueueInvoke(const SessionHandle & aSession, const app::CommandPathParams & aPath,
+                           const app::DataModel::EncodableToTLV & aFields, app::CommandSender::Callback * apCallback,
+                           const Optional<uint16_t> & aTimedInvokeTimeoutMs);
+    CHIP_ERROR QueueWrite(const SessionHandle & aSession, const app::ConcreteDataAttributePath & aPath,
+                          const app::DataModel::EncodableToTLV & aValue, WriteCallback::OnSuccessCallbackType aOnSuccess,
+                          WriteCallback::OnErrorCallbackType aOnError, const Optional<uint16_t> & aTimedWriteTimeoutMs);
+
+    void ScheduleDispatch(System::Clock::Timeout aDelay);
+    static void DispatchTimerCallback(System::Layer * apSystemLayer, void * apAppState);
+
+    // Send the queued requests of the sessions without a request of the same kind in flight.
+    void Dispatch();
+    void DispatchInvokes();
+    void DispatchWrites();
+    void OnInvokeBatchDone(InvokeBatch * apBatch);
+    void OnWriteBatchDone(WriteBatch * apBatch);
+
+    Messaging::ExchangeManager * mpExchangeMgr;
+    System::Clock::Milliseconds32 mBatchWindow;
+    bool mDispatchScheduled = false;
+    IntrusiveList<PendingInvoke> mQueuedInvokes;
+    IntrusiveList<PendingWrite> mQueuedWrites;
+    IntrusiveList<InvokeBatch> mInvokeBatches;
+    IntrusiveList<WriteBatch> mWriteBatches;
+};
+
+} // namespace Controller
+} // namespace chip
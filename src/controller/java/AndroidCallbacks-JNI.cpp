@@ -24,6 +24,9 @@
 #define JNI_METHOD(RETURN, CLASS_NAME, METHOD_NAME)                                                                                \
     extern "C" JNIEXPORT RETURN JNICALL Java_chip_devicecontroller_##CLASS_NAME##_##METHOD_NAME
 
+#define JNI_MODEL_METHOD(RETURN, CLASS_NAME, METHOD_NAME)                                                                          \
+    extern "C" JNIEXPORT RETURN JNICALL Java_chip_devicecontroller_model_##CLASS_NAME##_##METHOD_NAME
+
 using namespace chip::Controller;
 
 JNI_METHOD(jlong, GetConnectedDeviceCallbackJni, newCallback)(JNIEnv * env, jobject self, jobject callback)
@@ -37,10 +40,11 @@ JNI_METHOD(void, GetConnectedDeviceCallbackJni, deleteCallback)(JNIEnv * env, jo
 }
 
 JNI_METHOD(jlong, ReportCallbackJni, newCallback)
-(JNIEnv * env, jobject self, jobject subscriptionEstablishedCallbackJava, jobject resubscriptionAttemptCallbackJava)
+(JNIEnv * env, jobject self, jobject subscriptionEstablishedCallbackJava, jobject resubscriptionAttemptCallbackJava,
+ jboolean batchReports)
 {
     return newReportCallback(env, self, subscriptionEstablishedCallbackJava, resubscriptionAttemptCallbackJava,
-                             "()Lchip/devicecontroller/model/NodeState;");
+                             "()Lchip/devicecontroller/model/NodeState;", batchReports == JNI_TRUE);
 }
 
 JNI_METHOD(void, ReportCallbackJni, deleteCallback)(JNIEnv * env, jobject self, jlong callbackHandle)
@@ -48,6 +52,23 @@ JNI_METHOD(void, ReportCallbackJni, deleteCallback)(JNIEnv * env, jobject self,
     deleteReportCallback(env, self, callbackHandle);
 }
 
+JNI_MODEL_METHOD(jobject, ReportBatch, decodeAttributeValue)
+(JNIEnv * env, jclass clazz, jint endpointId, jlong clusterId, jlong attributeId, jbyteArray tlv)
+{
+    return decodeReportBatchAttributeValue(env, endpointId, clusterId, attributeId, tlv);
+}
+
+JNI_MODEL_METHOD(jobject, ReportBatch, decodeEventValue)
+(JNIEnv * env, jclass clazz, jint endpointId, jlong clusterId, jlong eventId, jbyteArray tlv)
+{
+    return decodeReportBatchEventValue(env, endpointId, clusterId, eventId, tlv);
+}
+
+JNI_MODEL_METHOD(jstring, ReportBatch, convertToJson)(JNIEnv * env, jclass clazz, jlong id, jbyteArray tlv)
+{
+    return convertReportBatchTlvToJson(env, id, tlv);
+}
+
 JNI_METHOD(jlong, WriteAttributesCallbackJni, newCallback)
 (JNIEnv * env, jobject self)
 {
@@ -148,9 +148,9 @@ jobject GetNodeStateObj(JNIEnv * env, const char * nodeStateClassSignature, jobj
 }
 
 ReportCallback::ReportCallback(jobject wrapperCallback, jobject subscriptionEstablishedCallback,
-                               jobject resubscriptionAttemptCallback, const char * nodeStateClassSignature) :
+                               jobject resubscriptionAttemptCallback, const char * nodeStateClassSignature, bool batchReports) :
     mClusterCacheAdapter(*this, Optional<EventNumber>::Missing(), false /*cacheData*/),
-    mNodeStateClassSignature(nodeStateClassSignature)
+    mNodeStateClassSignature(nodeStateClassSignature), mBatchReports(batchReports)
 {
     JNIEnv * env = JniReferences::GetInstance().GetEnvForCurrentThread();
     VerifyOrReturn(env != nullptr, ChipLogError(Controller, "Could not get JNIEnv for current thread"));
@@ -180,6 +180,13 @@ ReportCallback::~ReportCallback()
 
 void ReportCallback::OnReportBegin()
 {
+    if (mBatchReports)
+    {
+        mBatchTlv.clear();
+        mBatchIndex.clear();
+        return;
+    }
+
     JNIEnv * env = JniReferences::GetInstance().GetEnvForCurrentThread();
     VerifyOrReturn(env != nullptr, ChipLogError(Controller, "Could not get JNIEnv for current thread"));
 
@@ -225,6 +232,12 @@ void ReportCallback::OnReportEnd()
 {
     UpdateClusterDataVersion();
 
+    if (mBatchReports)
+    {
+        DeliverBatchedReport();
+        return;
+    }
+
     // Transform C++ jobject pair list to a Java HashMap, and call onReport() on the Java callback.
     CHIP_ERROR err = CHIP_NO_ERROR;
     JNIEnv * env   = JniReferences::GetInstance().GetEnvForCurrentThread();
@@ -272,6 +285,12 @@ CHIP_ERROR ConvertReportTlvToJson(const uint32_t id, TLV::TLVReader & data, std:
 void ReportCallback::OnAttributeData(const app::ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
                                      const app::StatusIB & aStatus)
 {
+    if (mBatchReports)
+    {
+        AddBatchAttributeData(aPath, apData, aStatus);
+        return;
+    }
+
     DeviceLayer::StackUnlock unlock;
     CHIP_ERROR err = CHIP_NO_ERROR;
     JNIEnv * env   = JniReferences::GetInstance().GetEnvForCurrentThread();
@@ -399,6 +418,14 @@ void ReportCallback::UpdateClusterDataVersion()
         return;
     }
 
+    if (mBatchReports)
+    {
+        AddBatchRecord({ kBatchRecordDataVersion, static_cast<jlong>(lastConcreteClusterPath.mEndpointId),
+                         static_cast<jlong>(lastConcreteClusterPath.mClusterId),
+                         static_cast<jlong>(committedDataVersion.Value()) });
+        return;
+    }
+
     VerifyOrReturn(mWrapperCallbackRef.HasValidObjectRef(),
                    ChipLogError(Controller, "mReportCallbackRef is not valid in %s", __func__));
     jobject wrapperCallback = mWrapperCallbackRef.ObjectRef();
@@ -415,6 +442,12 @@ void ReportCallback::UpdateClusterDataVersion()
 
 void ReportCallback::OnEventData(const app::EventHeader & aEventHeader, TLV::TLVReader * apData, const app::StatusIB * apStatus)
 {
+    if (mBatchReports)
+    {
+        AddBatchEventData(aEventHeader, apData, apStatus);
+        return;
+    }
+
     DeviceLayer::StackUnlock unlock;
     CHIP_ERROR err = CHIP_NO_ERROR;
     JNIEnv * env   = JniReferences::GetInstance().GetEnvForCurrentThread();
@@ -530,6 +563,130 @@ void ReportCallback::OnEventData(const app::EventHeader & aEventHeader, TLV::TLV
     VerifyOrReturn(!env->ExceptionCheck(), env->ExceptionDescribe(); aEventHeader.LogPath());
 }
 
+void ReportCallback::AddBatchRecord(const jlong (&aRecord)[kBatchRecordSize])
+{
+    mBatchIndex.insert(mBatchIndex.end(), std::begin(aRecord), std::end(aRecord));
+}
+
+CHIP_ERROR ReportCallback::AddBatchTlv(TLV::TLVReader & aData, jlong & aOffset, jlong & aLength)
+{
+    TLV::TLVReader reader;
+    reader.Init(aData);
+
+    // Same normalized TLV as the per attribute delivery: the element wrapped with an anonymous tag.
+    const size_t offset    = mBatchTlv.size();
+    const size_t bufferLen = reader.GetRemainingLength() + reader.GetLengthRead();
+    mBatchTlv.resize(offset + bufferLen);
+
+    TLV::TLVWriter writer;
+    writer.Init(mBatchTlv.data() + offset, bufferLen);
+    CHIP_ERROR err = writer.CopyElement(TLV::AnonymousTag(), reader);
+    mBatchTlv.resize(err == CHIP_NO_ERROR ? offset + writer.GetLengthWritten() : offset);
+    ReturnErrorOnFailure(err);
+
+    aOffset = static_cast<jlong>(offset);
+    aLength = static_cast<jlong>(writer.GetLengthWritten());
+    return CHIP_NO_ERROR;
+}
+
+void ReportCallback::AddBatchAttributeData(const app::ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                                           const app::StatusIB & aStatus)
+{
+    VerifyOrReturn(!aPath.IsListItemOperation(), ChipLogError(Controller, "Expect non-list item operation"); aPath.LogPath());
+
+    const jlong endpointId  = static_cast<jlong>(aPath.mEndpointId);
+    const jlong clusterId   = static_cast<jlong>(aPath.mClusterId);
+    const jlong attributeId = static_cast<jlong>(aPath.mAttributeId);
+
+    if (!aStatus.IsSuccess() || apData == nullptr)
+    {
+        const jlong clusterStatus = aStatus.mClusterStatus.HasValue() ? static_cast<jlong>(aStatus.mClusterStatus.Value()) : -1;
+        AddBatchRecord({ kBatchRecordAttributeStatus, endpointId, clusterId, attributeId, static_cast<jlong>(aStatus.mStatus),
+                         clusterStatus });
+        return;
+    }
+
+    jlong offset   = 0;
+    jlong length   = 0;
+    CHIP_ERROR err = AddBatchTlv(*apData, offset, length);
+    VerifyOrReturn(err == CHIP_NO_ERROR, ChipLogError(Controller, "Fail to copy tlv element with error %s", ErrorStr(err));
+                   aPath.LogPath());
+    AddBatchRecord({ kBatchRecordAttribute, endpointId, clusterId, attributeId, offset, length });
+
+    UpdateClusterDataVersion();
+}
+
+void ReportCallback::AddBatchEventData(const app::EventHeader & aEventHeader, TLV::TLVReader * apData,
+                                       const app::StatusIB * apStatus)
+{
+    const jlong endpointId = static_cast<jlong>(aEventHeader.mPath.mEndpointId);
+    const jlong clusterId  = static_cast<jlong>(aEventHeader.mPath.mClusterId);
+    const jlong eventId    = static_cast<jlong>(aEventHeader.mPath.mEventId);
+
+    if (apStatus != nullptr)
+    {
+        const jlong clusterStatus =
+            apStatus->mClusterStatus.HasValue() ? static_cast<jlong>(apStatus->mClusterStatus.Value()) : -1;
+        AddBatchRecord(
+            { kBatchRecordEventStatus, endpointId, clusterId, eventId, static_cast<jlong>(apStatus->mStatus), clusterStatus });
+        return;
+    }
+    VerifyOrReturn(apData != nullptr, ChipLogError(Controller, "Receive empty apData"); aEventHeader.LogPath());
+
+    jlong timestampType = 0;
+    if (aEventHeader.mTimestamp.mType == app::Timestamp::Type::kSystem)
+    {
+        timestampType = static_cast<jlong>(MILLIS_SINCE_BOOT);
+    }
+    else if (aEventHeader.mTimestamp.mType == app::Timestamp::Type::kEpoch)
+    {
+        timestampType = static_cast<jlong>(MILLIS_SINCE_EPOCH);
+    }
+    else
+    {
+        ChipLogError(Controller, "Unsupported event timestamp type");
+        aEventHeader.LogPath();
+        return;
+    }
+
+    jlong offset   = 0;
+    jlong length   = 0;
+    CHIP_ERROR err = AddBatchTlv(*apData, offset, length);
+    VerifyOrReturn(err == CHIP_NO_ERROR, ChipLogError(Controller, "Fail to copy element with error %s", ErrorStr(err));
+                   aEventHeader.LogPath());
+    AddBatchRecord({ kBatchRecordEvent, endpointId, clusterId, eventId, offset, length,
+                     static_cast<jlong>(aEventHeader.mEventNumber), static_cast<jlong>(aEventHeader.mPriorityLevel), timestampType,
+                     static_cast<jlong>(aEventHeader.mTimestamp.mValue) });
+}
+
+void ReportCallback::DeliverBatchedReport()
+{
+    JNIEnv * env = JniReferences::GetInstance().GetEnvForCurrentThread();
+    VerifyOrReturn(env != nullptr, ChipLogError(Controller, "Could not get JNIEnv for current thread"));
+
+    JniLocalReferenceScope scope(env);
+    VerifyOrReturn(mWrapperCallbackRef.HasValidObjectRef(),
+                   ChipLogError(Controller, "mWrapperCallbackRef is not valid in %s", __func__));
+    jobject wrapperCallback = mWrapperCallbackRef.ObjectRef();
+    jmethodID onBatchedReportMethod;
+    CHIP_ERROR err =
+        JniReferences::GetInstance().FindMethod(env, wrapperCallback, "onBatchedReport", "([B[J)V", &onBatchedReportMethod);
+    VerifyOrReturn(err == CHIP_NO_ERROR, ChipLogError(Controller, "Could not find onBatchedReport method"));
+
+    chip::ByteArray jniTlv(env, ByteSpan(mBatchTlv.data(), mBatchTlv.size()));
+    jlongArray jniIndex = env->NewLongArray(static_cast<jsize>(mBatchIndex.size()));
+    VerifyOrReturn(jniTlv.jniValue() != nullptr && jniIndex != nullptr,
+                   ChipLogError(Controller, "Could not allocate the batched report arrays"));
+    env->SetLongArrayRegion(jniIndex, 0, static_cast<jsize>(mBatchIndex.size()), mBatchIndex.data());
+
+    mBatchTlv.clear();
+    mBatchIndex.clear();
+
+    DeviceLayer::StackUnlock unlock;
+    env->CallVoidMethod(wrapperCallback, onBatchedReportMethod, jniTlv.jniValue(), jniIndex);
+    VerifyOrReturn(!env->ExceptionCheck(), env->ExceptionDescribe());
+}
+
 void ReportCallback::OnError(CHIP_ERROR aError)
 {
     ReportError(nullptr, nullptr, aError);
@@ -1204,11 +1361,12 @@ void deleteConnectedDeviceCallback(JNIEnv * env, jobject self, jlong callbackHan
 }
 
 jlong newReportCallback(JNIEnv * env, jobject self, jobject subscriptionEstablishedCallbackJava,
-                        jobject resubscriptionAttemptCallbackJava, const char * nodeStateClassSignature)
+                        jobject resubscriptionAttemptCallbackJava, const char * nodeStateClassSignature, bool batchReports)
 {
     chip::DeviceLayer::StackLock lock;
-    ReportCallback * reportCallback = chip::Platform::New<ReportCallback>(
-        self, subscriptionEstablishedCallbackJava, resubscriptionAttemptCallbackJava, nodeStateClassSignature);
+    ReportCallback * reportCallback =
+        chip::Platform::New<ReportCallback>(self, subscriptionEstablishedCallbackJava, resubscriptionAttemptCallbackJava,
+                                            nodeStateClassSignature, batchReports);
     return reinterpret_cast<jlong>(reportCallback);
 }
 
@@ -1264,5 +1422,81 @@ void deleteExtendableInvokeCallback(JNIEnv * env, jobject self, jlong callbackHa
     VerifyOrReturn(invokeCallback != nullptr, ChipLogError(Controller, "ExtendableInvokeCallback handle is nullptr"));
     chip::Platform::Delete(invokeCallback);
 }
+
+jobject decodeReportBatchAttributeValue(JNIEnv * env, jint endpointId, jlong clusterId, jlong attributeId, jbyteArray tlv)
+{
+    VerifyOrReturnValue(tlv != nullptr, nullptr, ChipLogError(Controller, "invalid parameter: tlv is null"));
+    chip::JniByteArray tlvBytes(env, tlv);
+
+    TLV::TLVReader reader;
+    reader.Init(tlvBytes.byteSpan());
+    CHIP_ERROR err = reader.Next();
+    VerifyOrReturnValue(err == CHIP_NO_ERROR, nullptr, ChipLogError(Controller, "TLV Parsing is wrong"));
+
+#ifdef USE_JAVA_TLV_ENCODE_DECODE
+    app::ConcreteAttributePath path(static_cast<EndpointId>(endpointId), static_cast<ClusterId>(clusterId),
+                                    static_cast<AttributeId>(attributeId));
+    TLV::TLVReader readerForGeneralValueObject;
+    readerForGeneralValueObject.Init(reader);
+    jobject value = DecodeAttributeValue(path, reader, &err);
+    // Same as the per attribute delivery: decode unknown attributes as general values.
+    if (err == CHIP_ERROR_IM_MALFORMED_ATTRIBUTE_PATH_IB)
+    {
+        value = DecodeGeneralTLVValue(env, readerForGeneralValueObject, err);
+    }
+#else
+    jobject value = DecodeGeneralTLVValue(env, reader, err);
+#endif
+    VerifyOrReturnValue(err == CHIP_NO_ERROR, nullptr,
+                        ChipLogError(Controller, "Fail to decode attribute with error %" CHIP_ERROR_FORMAT, err.Format()));
+    return value;
+}
+
+jobject decodeReportBatchEventValue(JNIEnv * env, jint endpointId, jlong clusterId, jlong eventId, jbyteArray tlv)
+{
+    VerifyOrReturnValue(tlv != nullptr, nullptr, ChipLogError(Controller, "invalid parameter: tlv is null"));
+    chip::JniByteArray tlvBytes(env, tlv);
+
+    TLV::TLVReader reader;
+    reader.Init(tlvBytes.byteSpan());
+    CHIP_ERROR err = reader.Next();
+    VerifyOrReturnValue(err == CHIP_NO_ERROR, nullptr, ChipLogError(Controller, "TLV Parsing is wrong"));
+
+#ifdef USE_JAVA_TLV_ENCODE_DECODE
+    app::ConcreteEventPath path(static_cast<EndpointId>(endpointId), static_cast<ClusterId>(clusterId),
+                                static_cast<EventId>(eventId));
+    TLV::TLVReader readerForGeneralValueObject;
+    readerForGeneralValueObject.Init(reader);
+    jobject value = DecodeEventValue(path, reader, &err);
+    // Same as the per event delivery: decode unknown events as general values.
+    if (err == CHIP_ERROR_IM_MALFORMED_EVENT_PATH_IB)
+    {
+        value = DecodeGeneralTLVValue(env, readerForGeneralValueObject, err);
+    }
+#else
+    jobject value = DecodeGeneralTLVValue(env, reader, err);
+#endif
+    VerifyOrReturnValue(err == CHIP_NO_ERROR, nullptr,
+                        ChipLogError(Controller, "Fail to decode event with error %" CHIP_ERROR_FORMAT, err.Format()));
+    return value;
+}
+
+jstring convertReportBatchTlvToJson(JNIEnv * env, jlong id, jbyteArray tlv)
+{
+    VerifyOrReturnValue(tlv != nullptr, nullptr, ChipLogError(Controller, "invalid parameter: tlv is null"));
+    chip::JniByteArray tlvBytes(env, tlv);
+
+    TLV::TLVReader reader;
+    reader.Init(tlvBytes.byteSpan());
+    CHIP_ERROR err = reader.Next();
+    VerifyOrReturnValue(err == CHIP_NO_ERROR, nullptr, ChipLogError(Controller, "TLV Parsing is wrong"));
+
+    std::string json;
+    err = ConvertReportTlvToJson(static_cast<uint32_t>(id), reader, json);
+    VerifyOrReturnValue(
+        err == CHIP_NO_ERROR, nullptr,
+        ChipLogError(Controller, "Fail to convert report tlv to json with error %" CHIP_ERROR_FORMAT, err.Format()));
+    return env->NewStringUTF(json.c_str());
+}
 } // namespace Controller
 } // namespace chip
@@ -27,6 +27,7 @@
 #include <list>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace chip {
 namespace Controller {
@@ -55,9 +56,15 @@ private:
 
 struct ReportCallback : public app::ClusterStateCache::Callback
 {
-    /** Subscription established callback can be nullptr. */
+    /**
+     * Subscription established callback can be nullptr.
+     *
+     * With batchReports, the attributes and events of a report are not handed to the Java layer one by one: they are
+     * collected, and delivered at the end of the report with a single onBatchedReport call, as a TLV byte array and an
+     * index of the paths (see chip.devicecontroller.model.ReportBatch).
+     */
     ReportCallback(jobject wrapperCallback, jobject subscriptionEstablishedCallback, jobject resubscriptionAttemptCallback,
-                   const char * nodeStateClassSignature);
+                   const char * nodeStateClassSignature, bool batchReports = false);
     ~ReportCallback();
 
     void OnReportBegin() override;
@@ -87,6 +94,27 @@ struct ReportCallback : public app::ClusterStateCache::Callback
 
     void UpdateClusterDataVersion();
 
+    // Kinds of the records of mBatchIndex.  Keep in sync with chip.devicecontroller.model.ReportBatch.
+    enum BatchRecordKind : jlong
+    {
+        kBatchRecordAttribute       = 0,
+        kBatchRecordAttributeStatus = 1,
+        kBatchRecordEvent           = 2,
+        kBatchRecordEventStatus     = 3,
+        kBatchRecordDataVersion     = 4,
+    };
+
+    // A record is { kind, endpoint, cluster, attribute/event id or data version, TLV offset or status, TLV length or
+    // cluster status (-1 if none), event number, priority, timestamp type, timestamp value }.
+    static constexpr size_t kBatchRecordSize = 10;
+
+    void AddBatchRecord(const jlong (&aRecord)[kBatchRecordSize]);
+    CHIP_ERROR AddBatchTlv(TLV::TLVReader & aData, jlong & aOffset, jlong & aLength);
+    void AddBatchAttributeData(const app::ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                               const app::StatusIB & aStatus);
+    void AddBatchEventData(const app::EventHeader & aEventHeader, TLV::TLVReader * apData, const app::StatusIB * apStatus);
+    void DeliverBatchedReport();
+
     app::ReadClient * mReadClient = nullptr;
 
     app::ClusterStateCache mClusterCacheAdapter;
@@ -95,6 +123,10 @@ struct ReportCallback : public app::ClusterStateCache::Callback
     JniGlobalReference mResubscriptionAttemptCallbackRef;
 
     const char * mNodeStateClassSignature;
+
+    const bool mBatchReports;
+    std::vector<uint8_t> mBatchTlv;
+    std::vector<jlong> mBatchIndex;
 };
 
 struct WriteAttributesCallback : public app::WriteClient::Callback
@@ -156,7 +188,7 @@ struct ExtendableInvokeCallback : public app::CommandSender::ExtendableCallback
 jlong newConnectedDeviceCallback(JNIEnv * env, jobject self, jobject callback);
 void deleteConnectedDeviceCallback(JNIEnv * env, jobject self, jlong callbackHandle);
 jlong newReportCallback(JNIEnv * env, jobject self, jobject subscriptionEstablishedCallbackJava,
-                        jobject resubscriptionAttemptCallbackJava, const char * nodeStateClassSignature);
+                        jobject resubscriptionAttemptCallbackJava, const char * nodeStateClassSignature, bool batchReports = false);
 void deleteReportCallback(JNIEnv * env, jobject self, jlong callbackHandle);
 jlong newWriteAttributesCallback(JNIEnv * env, jobject self);
 void deleteWriteAttributesCallback(JNIEnv * env, jobject self, jlong callbackHandle);
@@ -165,5 +197,10 @@ void deleteInvokeCallback(JNIEnv * env, jobject self, jlong callbackHandle);
 jlong newExtendableInvokeCallback(JNIEnv * env, jobject self);
 void deleteExtendableInvokeCallback(JNIEnv * env, jobject self, jlong callbackHandle);
 
+// Lazy decoding of the values of chip.devicecontroller.model.ReportBatch.
+jobject decodeReportBatchAttributeValue(JNIEnv * env, jint endpointId, jlong clusterId, jlong attributeId, jbyteArray tlv);
+jobject decodeReportBatchEventValue(JNIEnv * env, jint endpointId, jlong clusterId, jlong eventId, jbyteArray tlv);
+jstring convertReportBatchTlvToJson(JNIEnv * env, jlong id, jbyteArray tlv);
+
 } // namespace Controller
 } // namespace chip
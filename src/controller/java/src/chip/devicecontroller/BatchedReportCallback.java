@@ -0,0 +1,36 @@
+/*
+ *   Copyright (c) 2024 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+package chip.devicecontroller;
+
+import chip.devicecontroller.model.NodeState;
+import chip.devicecontroller.model.ReportBatch;
+
+/**
+ * A {@link ReportCallback} receiving each report in a single call, as a {@link ReportBatch}, which
+ * only decodes the values that are asked for.
+ *
+ * <p>The attributes and events of the report are not handed from native code one by one, which
+ * saves a JNI transition and the decoding of every attribute and event of busy subscriptions.
+ */
+public interface BatchedReportCallback extends ReportCallback {
+  void onBatchedReport(ReportBatch reportBatch);
+
+  /** Not called for a {@code BatchedReportCallback}: reports go to {@link #onBatchedReport}. */
+  @Override
+  default void onReport(NodeState nodeState) {}
+}
@@ -20,9 +20,13 @@ package chip.devicecontroller;
 import chip.devicecontroller.model.ChipAttributePath;
 import chip.devicecontroller.model.ChipEventPath;
 import chip.devicecontroller.model.NodeState;
+import chip.devicecontroller.model.ReportBatch;
 import javax.annotation.Nullable;
 
-/** JNI wrapper callback class for {@link ReportCallback}. */
+/**
+ * JNI wrapper callback class for {@link ReportCallback}. Reports to a {@link
+ * BatchedReportCallback} are delivered in batched mode.
+ */
 public class ReportCallbackJni {
   @Nullable private SubscriptionEstablishedCallback wrappedSubscriptionEstablishedCallback;
   @Nullable private ResubscriptionAttemptCallback wrappedResubscriptionAttemptCallback;
@@ -38,7 +42,10 @@ public class ReportCallbackJni {
     this.wrappedReportCallback = reportCallback;
     this.wrappedResubscriptionAttemptCallback = resubscriptionAttemptCallback;
     this.callbackHandle =
-        newCallback(subscriptionEstablishedCallback, resubscriptionAttemptCallback);
+        newCallback(
+            subscriptionEstablishedCallback,
+            resubscriptionAttemptCallback,
+            reportCallback instanceof BatchedReportCallback);
   }
 
   long getCallbackHandle() {
@@ -47,7 +54,8 @@ public class ReportCallbackJni {
 
   private native long newCallback(
       @Nullable SubscriptionEstablishedCallback subscriptionEstablishedCallback,
-      @Nullable ResubscriptionAttemptCallback resubscriptionAttemptCallback);
+      @Nullable ResubscriptionAttemptCallback resubscriptionAttemptCallback,
+      boolean batchReports);
 
   private native void deleteCallback(long callbackHandle);
 
@@ -63,6 +71,10 @@ public class ReportCallbackJni {
     nodeState = null;
   }
 
+  private void onBatchedReport(byte[] tlv, long[] index) {
+    ((BatchedReportCallback) wrappedReportCallback).onBatchedReport(new ReportBatch(tlv, index));
+  }
+
   private NodeState getNodeState() {
     return nodeState;
   }
@@ -86,7 +86,7 @@ public final class NodeState {
     addEventStatus(endpointId, clusterId, eventId, Status.newInstance(status, clusterStatus));
   }
 
-  private void setDataVersion(int endpointId, long clusterId, long dataVersion) {
+  void setDataVersion(int endpointId, long clusterId, long dataVersion) {
     EndpointState endpointState = getEndpointState(endpointId);
     ClusterState clusterState = endpointState.getClusterState(clusterId);
 
@@ -95,7 +95,7 @@ public final class NodeState {
     }
   }
 
-  private void addAttribute(
+  void addAttribute(
       int endpointId, long clusterId, long attributeId, AttributeState attributeStateToAdd) {
     EndpointState endpointState = getEndpointState(endpointId);
     if (endpointState == null) {
@@ -118,7 +118,7 @@ public final class NodeState {
     clusterState.getAttributeStates().put(attributeId, attributeStateToAdd);
   }
 
-  private void addEvent(int endpointId, long clusterId, long eventId, EventState eventStateToAdd) {
+  void addEvent(int endpointId, long clusterId, long eventId, EventState eventStateToAdd) {
     EndpointState endpointState = getEndpointState(endpointId);
     if (endpointState == null) {
       endpointState = new EndpointState(new HashMap<>());
@@ -143,8 +143,7 @@ public final class NodeState {
     clusterState.getEventStates().get(eventId).add(eventStateToAdd);
   }
 
-  private void addAttributeStatus(
-      int endpointId, long clusterId, long attributeId, Status statusToAdd) {
+  void addAttributeStatus(int endpointId, long clusterId, long attributeId, Status statusToAdd) {
     EndpointState endpointState = getEndpointState(endpointId);
     if (endpointState == null) {
       endpointState = new EndpointState(new HashMap<>());
@@ -165,7 +164,7 @@ public final class NodeState {
     clusterState.getAttributeStatuses().put(attributeId, statusToAdd);
   }
 
-  private void addEventStatus(int endpointId, long clusterId, long eventId, Status statusToAdd) {
+  void addEventStatus(int endpointId, long clusterId, long eventId, Status statusToAdd) {
     EndpointState endpointState = getEndpointState(endpointId);
     if (endpointState == null) {
       endpointState = new EndpointState(new HashMap<>());
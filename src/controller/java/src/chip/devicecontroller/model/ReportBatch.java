@@ -0,0 +1,232 @@
+/*
+ *   Copyright (c) 2024 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+package chip.devicecontroller.model;
+
+import java.util.Arrays;
+import javax.annotation.Nullable;
+
+/**
+ * A whole report, as delivered to a {@code BatchedReportCallback}: the TLV of all the attributes
+ * and events of the report in a single byte array, with an index of their paths.
+ *
+ * <p>Nothing is decoded up front: the values are only decoded when asked for, with {@link
+ * #getAttributeState(int)} and {@link #getEventState(int)}, or all at once with {@link
+ * #toNodeState()}.
+ */
+public final class ReportBatch {
+  // Keep in sync with ReportCallback::BatchRecordKind in AndroidCallbacks.h
+  private static final long RECORD_ATTRIBUTE = 0;
+  private static final long RECORD_ATTRIBUTE_STATUS = 1;
+  private static final long RECORD_EVENT = 2;
+  private static final long RECORD_EVENT_STATUS = 3;
+  private static final long RECORD_DATA_VERSION = 4;
+
+  private static final int RECORD_SIZE = 10;
+  private static final int KIND = 0;
+  private static final int ENDPOINT_ID = 1;
+  private static final int CLUSTER_ID = 2;
+  private static final int ID = 3;
+  private static final int TLV_OFFSET = 4;
+  private static final int TLV_LENGTH = 5;
+  private static final int STATUS = 4;
+  private static final int CLUSTER_STATUS = 5;
+  private static final int EVENT_NUMBER = 6;
+  private static final int PRIORITY_LEVEL = 7;
+  private static final int TIMESTAMP_TYPE = 8;
+  private static final int TIMESTAMP_VALUE = 9;
+
+  private final byte[] tlv;
+  private final long[] index;
+  // Offsets in index of the attribute and event records, in report order.
+  private final int[] attributeRecords;
+  private final int[] eventRecords;
+
+  public ReportBatch(byte[] tlv, long[] index) {
+    this.tlv = tlv;
+    this.index = index;
+
+    int attributeCount = 0;
+    int eventCount = 0;
+    int[] attributes = new int[index.length / RECORD_SIZE];
+    int[] events = new int[index.length / RECORD_SIZE];
+    for (int record = 0; record + RECORD_SIZE <= index.length; record += RECORD_SIZE) {
+      long kind = index[record + KIND];
+      if (kind == RECORD_ATTRIBUTE || kind == RECORD_ATTRIBUTE_STATUS) {
+        attributes[attributeCount++] = record;
+      } else if (kind == RECORD_EVENT || kind == RECORD_EVENT_STATUS) {
+        events[eventCount++] = record;
+      }
+    }
+    this.attributeRecords = Arrays.copyOf(attributes, attributeCount);
+    this.eventRecords = Arrays.copyOf(events, eventCount);
+  }
+
+  /** Returns the number of attribute reports, values and statuses, of the report. */
+  public int getAttributeCount() {
+    return attributeRecords.length;
+  }
+
+  public ChipAttributePath getAttributePath(int i) {
+    int record = attributeRecords[i];
+    return ChipAttributePath.newInstance(
+        (int) index[record + ENDPOINT_ID], index[record + CLUSTER_ID], index[record + ID]);
+  }
+
+  /** Returns the status of the attribute report, or null if the report is a value. */
+  @Nullable
+  public Status getAttributeStatus(int i) {
+    return getStatus(attributeRecords[i], RECORD_ATTRIBUTE_STATUS);
+  }
+
+  /**
+   * Returns the TLV of the attribute value, wrapped within an anonymous TLV tag, or null if the
+   * report is a status.
+   */
+  @Nullable
+  public byte[] getAttributeTlv(int i) {
+    return getTlv(attributeRecords[i], RECORD_ATTRIBUTE);
+  }
+
+  /** Decodes the attribute value, or returns null if the report is a status. */
+  @Nullable
+  public AttributeState getAttributeState(int i) {
+    int record = attributeRecords[i];
+    byte[] valueTlv = getTlv(record, RECORD_ATTRIBUTE);
+    if (valueTlv == null) {
+      return null;
+    }
+
+    int endpointId = (int) index[record + ENDPOINT_ID];
+    long clusterId = index[record + CLUSTER_ID];
+    long attributeId = index[record + ID];
+    return new AttributeState(
+        decodeAttributeValue(endpointId, clusterId, attributeId, valueTlv),
+        valueTlv,
+        convertToJson(attributeId, valueTlv));
+  }
+
+  /** Returns the number of event reports, values and statuses, of the report. */
+  public int getEventCount() {
+    return eventRecords.length;
+  }
+
+  public ChipEventPath getEventPath(int i) {
+    int record = eventRecords[i];
+    return ChipEventPath.newInstance(
+        (int) index[record + ENDPOINT_ID], index[record + CLUSTER_ID], index[record + ID]);
+  }
+
+  /** Returns the status of the event report, or null if the report is an event. */
+  @Nullable
+  public Status getEventStatus(int i) {
+    return getStatus(eventRecords[i], RECORD_EVENT_STATUS);
+  }
+
+  /**
+   * Returns the TLV of the event data, wrapped within an anonymous TLV tag, or null if the report
+   * is a status.
+   */
+  @Nullable
+  public byte[] getEventTlv(int i) {
+    return getTlv(eventRecords[i], RECORD_EVENT);
+  }
+
+  /** Decodes the event, or returns null if the report is a status. */
+  @Nullable
+  public EventState getEventState(int i) {
+    int record = eventRecords[i];
+    byte[] valueTlv = getTlv(record, RECORD_EVENT);
+    if (valueTlv == null) {
+      return null;
+    }
+
+    int endpointId = (int) index[record + ENDPOINT_ID];
+    long clusterId = index[record + CLUSTER_ID];
+    long eventId = index[record + ID];
+    return new EventState(
+        index[record + EVENT_NUMBER],
+        (int) index[record + PRIORITY_LEVEL],
+        (int) index[record + TIMESTAMP_TYPE],
+        index[record + TIMESTAMP_VALUE],
+        decodeEventValue(endpointId, clusterId, eventId, valueTlv),
+        valueTlv,
+        convertToJson(eventId, valueTlv));
+  }
+
+  /**
+   * Decodes the whole report into the {@code NodeState} that a {@code ReportCallback} would have
+   * received for it.
+   */
+  public NodeState toNodeState() {
+    NodeState nodeState = new NodeState();
+    int attribute = 0;
+    int event = 0;
+    for (int record = 0; record + RECORD_SIZE <= index.length; record += RECORD_SIZE) {
+      long kind = index[record + KIND];
+      int endpointId = (int) index[record + ENDPOINT_ID];
+      long clusterId = index[record + CLUSTER_ID];
+      long id = index[record + ID];
+      if (kind == RECORD_ATTRIBUTE) {
+        AttributeState state = getAttributeState(attribute++);
+        if (state != null) {
+          nodeState.addAttribute(endpointId, clusterId, id, state);
+        }
+      } else if (kind == RECORD_ATTRIBUTE_STATUS) {
+        nodeState.addAttributeStatus(endpointId, clusterId, id, getAttributeStatus(attribute++));
+      } else if (kind == RECORD_EVENT) {
+        EventState state = getEventState(event++);
+        if (state != null) {
+          nodeState.addEvent(endpointId, clusterId, id, state);
+        }
+      } else if (kind == RECORD_EVENT_STATUS) {
+        nodeState.addEventStatus(endpointId, clusterId, id, getEventStatus(event++));
+      } else if (kind == RECORD_DATA_VERSION) {
+        nodeState.setDataVersion(endpointId, clusterId, id);
+      }
+    }
+    return nodeState;
+  }
+
+  @Nullable
+  private Status getStatus(int record, long statusKind) {
+    if (index[record + KIND] != statusKind) {
+      return null;
+    }
+    long clusterStatus = index[record + CLUSTER_STATUS];
+    return Status.newInstance(
+        (int) index[record + STATUS],
+        clusterStatus >= 0 ? Integer.valueOf((int) clusterStatus) : null);
+  }
+
+  @Nullable
+  private byte[] getTlv(int record, long valueKind) {
+    if (index[record + KIND] != valueKind) {
+      return null;
+    }
+    int offset = (int) index[record + TLV_OFFSET];
+    return Arrays.copyOfRange(tlv, offset, offset + (int) index[record + TLV_LENGTH]);
+  }
+
+  private static native Object decodeAttributeValue(
+      int endpointId, long clusterId, long attributeId, byte[] tlv);
+
+  private static native Object decodeEventValue(
+      int endpointId, long clusterId, long eventId, byte[] tlv);
+
+  private static native String convertToJson(long id, byte[] tlv);
+}
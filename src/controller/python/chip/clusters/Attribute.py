@@ -32,13 +32,13 @@ from typing import Any, Callable, Dict, List, Optional, Set, Tuple, Union
 import chip
 import chip.exceptions
 import chip.interaction_model
-import chip.tlv
 import construct  # type: ignore
 from chip.interaction_model import PyWriteAttributeData
 from chip.native import ErrorSDKPart, PyChipError
 from rich.pretty import pprint  # type: ignore
 
 from .ClusterObjects import Cluster, ClusterAttributeDescriptor, ClusterEvent
+from .TLVDecode import DecodeTLV
 
 LOGGER = logging.getLogger(__name__)
 
@@ -690,8 +690,7 @@ class AsyncReadTransaction:
                 attributeValue = ValueDecodeFailure(
                     None, chip.interaction_model.InteractionModelError(imStatus))
             else:
-                tlvData = chip.tlv.TLVReader(data).get().get("Any", {})
-                attributeValue = tlvData
+                attributeValue = DecodeTLV(data)
 
             self._cache.UpdateTLV(path, dataVersion, attributeValue)
             self._changedPathSet.add(path)
@@ -706,14 +705,14 @@ class AsyncReadTransaction:
 
             if data:
                 # data will be an empty buffer when we received an EventStatusIB instead of an EventDataIB.
-                tlvData = chip.tlv.TLVReader(data).get().get("Any", {})
+                tlvData = DecodeTLV(data)
 
                 if eventType is None:
                     eventValue = ValueDecodeFailure(
                         tlvData, LookupError("event schema not found"))
                 else:
                     try:
-                        eventValue = eventType.FromTLV(data)
+                        eventValue = eventType.FromDict(data=eventType.descriptor.TagDictToLabelDict('', tlvData))
                     except Exception as ex:
                         LOGGER.error(
                             f"Error convering TLV to Cluster Object for path: Endpoint = {path.EndpointId}/"
@@ -0,0 +1,158 @@
+#
+#    Copyright (c) 2024 Project CHIP Authors
+#    All rights reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+'''Decoding of TLV into Python values, with the TLV parsed by the native library.
+
+DecodeTLV returns the same values as `chip.tlv.TLVReader(data).get().get("Any", {})`: the elements are parsed in bulk by
+pychip_TLV_Tokenize into fixed size records, from which the Python values are built, instead of parsing the TLV byte by
+byte in Python.  Data the native tokenizer does not handle is decoded by chip.tlv.
+'''
+
+import ctypes
+import logging
+import struct
+from typing import Any
+
+import chip.native
+import chip.tlv
+from chip.tlv import TLVList, float32, uint
+
+LOGGER = logging.getLogger(__name__)
+
+# Keep in sync with PyTLVTokenType and PyTLVToken in tlvdecode.cpp
+_SIGNED_INTEGER = 0
+_UNSIGNED_INTEGER = 1
+_BOOLEAN = 2
+_FLOAT = 3
+_DOUBLE = 4
+_UTF8_STRING = 5
+_BYTE_STRING = 6
+_NULL = 7
+_STRUCTURE = 8
+_ARRAY = 9
+_LIST = 10
+_END_OF_CONTAINER = 11
+
+_TAG_ANONYMOUS = 0
+_TAG_CONTEXT = 1
+
+_TOKEN = struct.Struct('<BBHIIIq')
+_INT64 = struct.Struct('<q')
+_DOUBLE_BITS = struct.Struct('<d')
+
+_nativeTokenizeUnavailable = False
+
+
+def _handle():
+    handle = chip.native.GetLibraryHandle(chip.native.HandleFlags(0))
+    if handle.pychip_TLV_Tokenize.argtypes is None:
+        setter = chip.native.NativeLibraryHandleMethodArguments(handle)
+        setter.Set("pychip_TLV_Tokenize", chip.native.PyChipError, [ctypes.c_char_p, ctypes.c_size_t, ctypes.c_void_p,
+                                                                     ctypes.c_size_t, ctypes.POINTER(ctypes.c_size_t)])
+    return handle
+
+
+def _tokenize(data: bytes):
+    global _nativeTokenizeUnavailable
+    if _nativeTokenizeUnavailable:
+        return None
+
+    try:
+        handle = _handle()
+    except Exception as ex:
+        LOGGER.info(f"Native TLV decoding is unavailable, using chip.tlv: {ex}")
+        _nativeTokenizeUnavailable = True
+        return None
+
+    # A TLV element takes at least one byte, each takes one token.
+    tokens = ctypes.create_string_buffer(len(data) * _TOKEN.size)
+    tokenCount = ctypes.c_size_t(0)
+    res = handle.pychip_TLV_Tokenize(data, len(data), tokens, len(data), ctypes.byref(tokenCount))
+    if not res.is_success:
+        return None
+    return tokens.raw[:tokenCount.value * _TOKEN.size]
+
+
+def _build(data: bytes, tokens: bytes):
+    root = {}
+    stack = []
+    out = root
+    for (tokenType, tagType, _, tagNum, profileId, length, value) in _TOKEN.iter_unpack(tokens):
+        if tokenType == _END_OF_CONTAINER:
+            out = stack.pop()
+            continue
+
+        isContainer = False
+        if tokenType == _UNSIGNED_INTEGER:
+            value = uint(value if value >= 0 else value + (1 << 64))
+        elif tokenType == _SIGNED_INTEGER:
+            pass
+        elif tokenType == _STRUCTURE:
+            value = {}
+            isContainer = True
+        elif tokenType == _UTF8_STRING:
+            value = data[value:value + length]
+            try:
+                value = str(value, "utf-8")
+            except Exception:
+                pass
+        elif tokenType == _BOOLEAN:
+            value = bool(value)
+        elif tokenType == _ARRAY:
+            value = []
+            isContainer = True
+        elif tokenType == _NULL:
+            value = None
+        elif tokenType == _BYTE_STRING:
+            value = data[value:value + length]
+        elif tokenType == _LIST:
+            value = TLVList()
+            isContainer = True
+        elif tokenType == _FLOAT:
+            (value,) = _DOUBLE_BITS.unpack(_INT64.pack(value))
+            value = float32(value)
+        elif tokenType == _DOUBLE:
+            (value,) = _DOUBLE_BITS.unpack(_INT64.pack(value))
+        else:
+            raise ValueError("Attempt to decode unsupported TLV type")
+
+        # Same placement of the values as chip.tlv.TLVReader
+        if tagType == _TAG_CONTEXT or tagType == _TAG_ANONYMOUS:
+            tag = tagNum if tagType == _TAG_CONTEXT else None
+            if isinstance(out, dict):
+                out[tag if tag is not None else "Any"] = value
+            elif isinstance(out, TLVList):
+                out.append(tag, value)
+            else:
+                out.append(value)
+        else:
+            out[(profileId, tagNum)] = value
+
+        if isContainer:
+            stack.append(out)
+            out = value
+
+    return root
+
+
+def DecodeTLV(data: bytes) -> Any:
+    '''Decodes the anonymous element of the TLV buffer, or returns an empty dict if there is none.'''
+    data = bytes(data)
+    tokens = _tokenize(data) if data else None
+    if tokens is None:
+        return chip.tlv.TLVReader(data).get().get("Any", {})
+    return _build(data, tokens).get("Any", {})
@@ -0,0 +1,222 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <cstring>
+
+#include <controller/python/chip/native/PyChipError.h>
+#include <lib/core/TLVReader.h>
+#include <lib/support/CodeUtils.h>
+
+using namespace chip;
+
+namespace {
+
+// Keep in sync with chip/clusters/TLVDecode.py
+enum class PyTLVTokenType : uint8_t
+{
+    kSignedInteger   = 0,
+    kUnsignedInteger = 1,
+    kBoolean         = 2,
+    kFloat           = 3,
+    kDouble          = 4,
+    kUTF8String      = 5,
+    kByteString      = 6,
+    kNull            = 7,
+    kStructure       = 8,
+    kArray           = 9,
+    kList            = 10,
+    kEndOfContainer  = 11,
+};
+
+enum class PyTLVTagType : uint8_t
+{
+    kAnonymous = 0,
+    kContext   = 1,
+    kProfile   = 2,
+};
+
+/// A decoded TLV element.  Containers are followed by the tokens of their
+/// elements, then by a kEndOfContainer token.
+struct PyTLVToken
+{
+    uint8_t type;
+    uint8_t tagType;
+    uint16_t reserved;
+    uint32_t tagNum;
+    uint32_t profileId;
+    // Strings: length of the data, found at `value` bytes into the TLV buffer.
+    uint32_t length;
+    // Integers and booleans: the value.  Floating point numbers: the bits of the value, as a double.
+    int64_t value;
+};
+
+static_assert(sizeof(PyTLVToken) == 24, "PyTLVToken layout is shared with chip/clusters/TLVDecode.py");
+
+class TokenWriter
+{
+public:
+    TokenWriter(const uint8_t * tlv, PyTLVToken * tokens, size_t capacity) : mTLV(tlv), mTokens(tokens), mCapacity(capacity) {}
+
+    CHIP_ERROR AddElements(TLV::TLVReader & reader)
+    {
+        CHIP_ERROR err;
+        while ((err = reader.Next()) == CHIP_NO_ERROR)
+        {
+            ReturnErrorOnFailure(AddElement(reader));
+        }
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+        return CHIP_NO_ERROR;
+    }
+
+    size_t GetCount() const { return mCount; }
+
+private:
+    CHIP_ERROR AddElement(TLV::TLVReader & reader)
+    {
+        VerifyOrReturnError(mCount < mCapacity, CHIP_ERROR_BUFFER_TOO_SMALL);
+        PyTLVToken & token = mTokens[mCount++];
+        memset(&token, 0, sizeof(token));
+
+        const TLV::Tag tag = reader.GetTag();
+        if (tag == TLV::AnonymousTag())
+        {
+            token.tagType = to_underlying(PyTLVTagType::kAnonymous);
+        }
+        else if (TLV::IsContextTag(tag))
+        {
+            token.tagType = to_underlying(PyTLVTagType::kContext);
+            token.tagNum  = TLV::TagNumFromTag(tag);
+        }
+        else
+        {
+            // Implicit profile tags are only readable with a known implicit
+            // profile: leave those to the Python decoder.
+            VerifyOrReturnError(tag != TLV::UnknownImplicitTag(), CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE);
+            token.tagType   = to_underlying(PyTLVTagType::kProfile);
+            token.profileId = TLV::ProfileIdFromTag(tag);
+            token.tagNum    = TLV::TagNumFromTag(tag);
+        }
+
+        switch (reader.GetType())
+        {
+        case TLV::kTLVType_SignedInteger:
+            token.type = to_underlying(PyTLVTokenType::kSignedInteger);
+            return reader.Get(token.value);
+        case TLV::kTLVType_UnsignedInteger: {
+            uint64_t value;
+            ReturnErrorOnFailure(reader.Get(value));
+            token.type  = to_underlying(PyTLVTokenType::kUnsignedInteger);
+            token.value = static_cast<int64_t>(value);
+            return CHIP_NO_ERROR;
+        }
+        case TLV::kTLVType_Boolean: {
+            bool value;
+            ReturnErrorOnFailure(reader.Get(value));
+            token.type  = to_underlying(PyTLVTokenType::kBoolean);
+            token.value = value ? 1 : 0;
+            return CHIP_NO_ERROR;
+        }
+        case TLV::kTLVType_FloatingPointNumber: {
+            float floatValue;
+            double value;
+            ReturnErrorOnFailure(reader.Get(value));
+            token.type = to_underlying(reader.Get(floatValue) == CHIP_NO_ERROR ? PyTLVTokenType::kFloat : PyTLVTokenType::kDouble);
+            memcpy(&token.value, &value, sizeof(value));
+            return CHIP_NO_ERROR;
+        }
+        case TLV::kTLVType_UTF8String:
+        case TLV::kTLVType_ByteString: {
+            const uint8_t * data;
+            ReturnErrorOnFailure(reader.GetDataPtr(data));
+            token.type   = to_underlying(reader.GetType() == TLV::kTLVType_UTF8String ? PyTLVTokenType::kUTF8String
+                                                                                       : PyTLVTokenType::kByteString);
+            token.length = reader.GetLength();
+            token.value  = data - mTLV;
+            return CHIP_NO_ERROR;
+        }
+        case TLV::kTLVType_Null:
+            token.type = to_underlying(PyTLVTokenType::kNull);
+            return CHIP_NO_ERROR;
+        case TLV::kTLVType_Structure:
+        case TLV::kTLVType_Array:
+        case TLV::kTLVType_List:
+            return AddContainer(reader);
+        default:
+            return CHIP_ERROR_WRONG_TLV_TYPE;
+        }
+    }
+
+    CHIP_ERROR AddContainer(TLV::TLVReader & reader)
+    {
+        PyTLVToken & token = mTokens[mCount - 1];
+        switch (reader.GetType())
+        {
+        case TLV::kTLVType_Structure:
+            token.type = to_underlying(PyTLVTokenType::kStructure);
+            break;
+        case TLV::kTLVType_Array:
+            token.type = to_underlying(PyTLVTokenType::kArray);
+            break;
+        default:
+            token.type = to_underlying(PyTLVTokenType::kList);
+            break;
+        }
+
+        TLV::TLVType containerType;
+        ReturnErrorOnFailure(reader.EnterContainer(containerType));
+        ReturnErrorOnFailure(AddElements(reader));
+        ReturnErrorOnFailure(reader.ExitContainer(containerType));
+
+        VerifyOrReturnError(mCount < mCapacity, CHIP_ERROR_BUFFER_TOO_SMALL);
+        PyTLVToken & endToken = mTokens[mCount++];
+        memset(&endToken, 0, sizeof(endToken));
+        endToken.type = to_underlying(PyTLVTokenType::kEndOfContainer);
+        return CHIP_NO_ERROR;
+    }
+
+    const uint8_t * const mTLV;
+    PyTLVToken * const mTokens;
+    const size_t mCapacity;
+    size_t mCount = 0;
+};
+
+} // namespace
+
+extern "C" {
+
+/// Decodes all the TLV elements of the buffer into PyTLVToken records, for
+/// chip/clusters/TLVDecode.py to build the Python values from without parsing
+/// TLV in Python.
+///
+/// A TLV buffer never holds more elements (including ends of containers) than
+/// bytes, so a capacity of `tlvLen` tokens is always enough.
+PyChipError pychip_TLV_Tokenize(const uint8_t * tlv, size_t tlvLen, void * tokens, size_t tokensCapacity, size_t * tokenCount)
+{
+    VerifyOrReturnError(tlv != nullptr && tokens != nullptr && tokenCount != nullptr, ToPyChipError(CHIP_ERROR_INVALID_ARGUMENT));
+
+    TLV::TLVReader reader;
+    reader.Init(tlv, tlvLen);
+
+    TokenWriter writer(tlv, static_cast<PyTLVToken *>(tokens), tokensCapacity);
+    CHIP_ERROR err = writer.AddElements(reader);
+    VerifyOrReturnError(err == CHIP_NO_ERROR, ToPyChipError(err));
+
+    *tokenCount = writer.GetCount();
+    return ToPyChipError(CHIP_NO_ERROR);
+}
+}
@@ -0,0 +1,62 @@
+#
+#    Copyright (c) 2024 Project CHIP Authors
+#    All rights reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+import unittest
+
+from chip.clusters.TLVDecode import DecodeTLV
+from chip.tlv import TLVList, TLVReader, TLVWriter, float32, uint
+
+
+class TestTLVDecode(unittest.TestCase):
+    def _assertSameDecoding(self, val, tag=None):
+        writer = TLVWriter()
+        writer.put(tag, val)
+        expected = TLVReader(writer.encoding).get().get("Any", {})
+        decoded = DecodeTLV(writer.encoding)
+        self.assertEqual(decoded, expected)
+        self.assertEqual(type(decoded), type(expected))
+        return decoded
+
+    def test_primitives(self):
+        for val in [0, 1, -1, 0x7f, -0x80, 0xdeadbeef, -0x55555555, 0x7fffffffffffffff, -0x8000000000000000,
+                    True, False, None, 1.5, "", "Hello!", "été", b"", b"\xde\xad\xbe\xef"]:
+            self._assertSameDecoding(val)
+
+        self.assertIsInstance(self._assertSameDecoding(uint(0xffffffffffffffff)), uint)
+        self.assertIsInstance(self._assertSameDecoding(float32(2.5)), float32)
+
+    def test_containers(self):
+        decoded = self._assertSameDecoding({
+            0: uint(1),
+            1: [uint(1), uint(2), "three", [], {}],
+            2: {0: None, 1: {0: b"\x01", 1: [True, False]}},
+            3: TLVList([(1, 'a'), (None, 'b')]),
+            254: uint(2),
+        })
+        self.assertIsInstance(decoded[3], TLVList)
+
+        self._assertSameDecoding([{0: uint(i), 1: f"name {i}"} for i in range(100)])
+
+    def test_profile_tags(self):
+        self._assertSameDecoding({(0x235A0000, 42): "FOO", 1: uint(2)})
+
+    def test_empty_buffer(self):
+        self.assertEqual(DecodeTLV(b""), {})
+
+
+if __name__ == '__main__':
+    unittest.main()
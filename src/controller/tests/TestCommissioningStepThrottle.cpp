@@ -0,0 +1,86 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <controller/CommissioningStepThrottle.h>
+
+using namespace chip;
+using namespace chip::Controller;
+
+namespace {
+
+class TestWaiter : public CommissioningStepThrottle::Waiter
+{
+public:
+    void OnCommissioningStepSlotAcquired() override { mSlotsAcquired++; }
+
+    int mSlotsAcquired = 0;
+};
+
+TEST(TestCommissioningStepThrottle, TestSlotsArePassedToWaitersInOrder)
+{
+    CommissioningStepThrottle throttle(2);
+    TestWaiter first, second, third, fourth;
+
+    EXPECT_TRUE(throttle.Acquire(first));
+    EXPECT_TRUE(throttle.Acquire(second));
+    EXPECT_FALSE(throttle.Acquire(third));
+    EXPECT_FALSE(throttle.Acquire(fourth));
+    EXPECT_EQ(throttle.GetStepsInProgress(), 2u);
+
+    throttle.Release();
+    EXPECT_EQ(third.mSlotsAcquired, 1);
+    EXPECT_EQ(fourth.mSlotsAcquired, 0);
+    EXPECT_EQ(throttle.GetStepsInProgress(), 2u);
+
+    throttle.Release();
+    EXPECT_EQ(fourth.mSlotsAcquired, 1);
+
+    throttle.Release();
+    throttle.Release();
+    EXPECT_EQ(throttle.GetStepsInProgress(), 0u);
+
+    // Releasing more than acquired is ignored
+    throttle.Release();
+    EXPECT_EQ(throttle.GetStepsInProgress(), 0u);
+    EXPECT_EQ(first.mSlotsAcquired, 0);
+    EXPECT_EQ(second.mSlotsAcquired, 0);
+}
+
+TEST(TestCommissioningStepThrottle, TestCancelWait)
+{
+    CommissioningStepThrottle throttle(1);
+    TestWaiter first, second, third;
+
+    EXPECT_TRUE(throttle.Acquire(first));
+    EXPECT_FALSE(throttle.Acquire(second));
+    EXPECT_FALSE(throttle.Acquire(third));
+
+    throttle.CancelWait(second);
+    throttle.CancelWait(first); // Not waiting
+
+    throttle.Release();
+    EXPECT_EQ(second.mSlotsAcquired, 0);
+    EXPECT_EQ(third.mSlotsAcquired, 1);
+
+    throttle.Release();
+    EXPECT_EQ(throttle.GetStepsInProgress(), 0u);
+}
+
+} // namespace
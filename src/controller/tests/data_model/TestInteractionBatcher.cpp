@@ -0,0 +1,177 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include "DataModelFixtures.h"
+
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app/InteractionModelEngine.h>
+#include <app/data-model/NullObject.h>
+#include <app/tests/AppTestContext.h>
+#include <controller/InteractionBatcher.h>
+#include <lib/core/CHIPError.h>
+#include <messaging/tests/MessagingContext.h>
+#include <protocols/interaction_model/Constants.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+using namespace chip::app::DataModelTests;
+
+namespace {
+
+const chip::Test::MockNodeConfig & TestMockNodeConfig()
+{
+    using namespace chip::Test;
+    using namespace chip::app::Clusters::Globals::Attributes;
+
+    // clang-format off
+    static const MockNodeConfig config({
+        MockEndpointConfig(kTestEndpointId, {
+            MockClusterConfig(Clusters::UnitTesting::Id, {
+                ClusterRevision::Id, FeatureMap::Id,
+            },
+            {},      // events
+            {
+               Clusters::UnitTesting::Commands::TestSimpleArgumentRequest::Id,
+            }, // accepted commands
+            {} // generated commands
+          ),
+        }),
+    });
+    // clang-format on
+    return config;
+}
+
+class TestInteractionBatcher : public chip::Test::AppContext
+{
+public:
+    void SetUp() override
+    {
+        AppContext::SetUp();
+        mOldProvider = InteractionModelEngine::GetInstance()->SetDataModelProvider(&CustomDataModel::Instance());
+        chip::Test::SetMockNodeConfig(TestMockNodeConfig());
+    }
+
+    void TearDown() override
+    {
+        chip::Test::ResetMockNodeConfig();
+        InteractionModelEngine::GetInstance()->SetDataModelProvider(mOldProvider);
+        AppContext::TearDown();
+    }
+
+protected:
+    chip::app::DataModel::Provider * mOldProvider = nullptr;
+};
+
+TEST_F(TestInteractionBatcher, TestInvokes)
+{
+    struct FakeRequest : public Clusters::UnitTesting::Commands::TestSimpleArgumentRequest::Type
+    {
+        using ResponseType = DataModel::NullObjectType;
+    };
+
+    Controller::InteractionBatcher batcher(&GetExchangeManager(), System::Clock::kZero);
+    ScopedChange directive(gCommandResponseDirective, CommandResponseDirective::kSendSuccessStatusCode);
+
+    FakeRequest request;
+    request.arg1 = true;
+
+    size_t successCalls = 0;
+    size_t failureCalls = 0;
+    auto onSuccessCb    = [&successCalls](const ConcreteCommandPath & commandPath, const StatusIB & aStatus, const auto &) {
+        EXPECT_EQ(commandPath.mEndpointId, kTestEndpointId);
+        EXPECT_TRUE(aStatus.IsSuccess());
+        successCalls++;
+    };
+    auto onFailureCb = [&failureCalls](CHIP_ERROR aError) { failureCalls++; };
+
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(batcher.InvokeCommand(GetSessionBobToAlice(), kTestEndpointId, request, onSuccessCb, onFailureCb),
+                  CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(batcher.GetNumQueuedRequests(), 3u);
+
+    DrainAndServiceIO();
+
+    EXPECT_EQ(successCalls, 3u);
+    EXPECT_EQ(failureCalls, 0u);
+    EXPECT_EQ(batcher.GetNumQueuedRequests(), 0u);
+    EXPECT_EQ(batcher.GetNumBatchesInFlight(), 0u);
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+TEST_F(TestInteractionBatcher, TestWrites)
+{
+    Controller::InteractionBatcher batcher(&GetExchangeManager(), System::Clock::kZero);
+    ScopedChange directive(gWriteResponseDirective, WriteResponseDirective::kSendClusterSpecificSuccess);
+
+    std::vector<AttributeId> succeeded;
+    std::vector<AttributeId> failed;
+    auto onSuccessCb = [&succeeded](const ConcreteAttributePath & aPath) { succeeded.push_back(aPath.mAttributeId); };
+    auto onFailureCb = [&failed](const ConcreteAttributePath * apPath, CHIP_ERROR aError) {
+        EXPECT_NE(apPath, nullptr);
+        failed.push_back(apPath != nullptr ? apPath->mAttributeId : kInvalidAttributeId);
+    };
+
+    // The list write fails with this directive: each write gets the status of its own attribute.
+    Clusters::UnitTesting::Structs::TestListStructOctet::Type listValue[1];
+    listValue[0].member1 = 0;
+    DataModel::List<Clusters::UnitTesting::Structs::TestListStructOctet::Type> list(listValue);
+
+    EXPECT_EQ(batcher.WriteAttribute<UnitTesting::Attributes::Int8u::TypeInfo>(GetSessionBobToAlice(), kTestEndpointId, 1,
+                                                                                onSuccessCb, onFailureCb),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(batcher.WriteAttribute<UnitTesting::Attributes::ListStructOctetString::TypeInfo>(
+                  GetSessionBobToAlice(), kTestEndpointId, list, onSuccessCb, onFailureCb),
+              CHIP_NO_ERROR);
+    // A second write of the same attribute goes out in the next WriteRequest.
+    EXPECT_EQ(batcher.WriteAttribute<UnitTesting::Attributes::Int8u::TypeInfo>(GetSessionBobToAlice(), kTestEndpointId, 2,
+                                                                                onSuccessCb, onFailureCb),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(batcher.GetNumQueuedRequests(), 3u);
+
+    DrainAndServiceIO();
+
+    ASSERT_EQ(succeeded.size(), 2u);
+    EXPECT_EQ(succeeded[0], UnitTesting::Attributes::Int8u::Id);
+    EXPECT_EQ(succeeded[1], UnitTesting::Attributes::Int8u::Id);
+    ASSERT_EQ(failed.size(), 1u);
+    EXPECT_EQ(failed[0], UnitTesting::Attributes::ListStructOctetString::Id);
+    EXPECT_EQ(batcher.GetNumQueuedRequests(), 0u);
+    EXPECT_EQ(batcher.GetNumBatchesInFlight(), 0u);
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+TEST_F(TestInteractionBatcher, TestGroupSessionRejected)
+{
+    Controller::InteractionBatcher batcher(&GetExchangeManager(), System::Clock::kZero);
+    Transport::OutgoingGroupSession groupSession(1, GetAliceFabricIndex());
+
+    auto onSuccessCb = [](const ConcreteAttributePath &) {};
+    auto onFailureCb = [](const ConcreteAttributePath *, CHIP_ERROR) {};
+    EXPECT_EQ(batcher.WriteAttribute<UnitTesting::Attributes::Int8u::TypeInfo>(SessionHandle(groupSession), kTestEndpointId, 1,
+                                                                                onSuccessCb, onFailureCb),
+              CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(batcher.GetNumQueuedRequests(), 0u);
+}
+
+} // namespace
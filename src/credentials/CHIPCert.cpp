@@ -25,6 +25,8 @@
  *
  */
 
+#include <array>
+#include <mutex>
 #include <stddef.h>
 
 #include <credentials/CHIPCert_Internal.h>
@@ -41,6 +43,7 @@
 #include <lib/support/ScopedBuffer.h>
 #include <lib/support/TimeUtils.h>
 #include <protocols/Protocols.h>
+#include <system/SystemMutex.h>
 
 namespace chip {
 namespace Credentials {
@@ -226,11 +229,118 @@ CHIP_ERROR ChipCertificateSet::VerifySignature(const ChipCertificateData * cert,
     return VerifyCertSignature(*cert, *caCert);
 }
 
+#if CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE > 0
+namespace {
+
+/**
+ * Remembers the digests of (TBS hash, signature, signer public key) tuples whose signature verified
+ * successfully.  A hit means the exact same inputs already passed ECDSA verification.  Validity period
+ * and usage checks are done by the callers on every use and are not affected.
+ *
+ * VerifyCertSignature() is not only called with the Matter stack lock held: CASESession validates the
+ * Sigma3 credentials in background work.  The entries are therefore guarded by their own mutex.
+ */
+class VerifiedSignatureCache
+{
+public:
+    using Digest = std::array<uint8_t, kSHA256_Hash_Length>;
+
+    VerifiedSignatureCache() { InitLock(); }
+
+    static CHIP_ERROR ComputeDigest(const ChipCertificateData & cert, const ChipCertificateData & signer, Digest & digest)
+    {
+        Hash_SHA256_stream hash;
+        MutableByteSpan digestSpan(digest.data(), digest.size());
+        ReturnErrorOnFailure(hash.Begin());
+        ReturnErrorOnFailure(hash.AddData(ByteSpan(cert.mTBSHash)));
+        ReturnErrorOnFailure(hash.AddData(cert.mSignature));
+        ReturnErrorOnFailure(hash.AddData(signer.mPublicKey));
+        return hash.Finish(digestSpan);
+    }
+
+    bool Contains(const Digest & digest)
+    {
+        std::lock_guard<System::Mutex> lock(GetLock());
+        for (uint8_t i = 0; i < mCount; i++)
+        {
+            if (mEntries[i] == digest)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Add(const Digest & digest)
+    {
+        std::lock_guard<System::Mutex> lock(GetLock());
+        mEntries[mNext] = digest;
+        mNext           = static_cast<uint8_t>((mNext + 1) % CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE);
+        if (mCount < CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE)
+        {
+            mCount++;
+        }
+    }
+
+    void Clear()
+    {
+        std::lock_guard<System::Mutex> lock(GetLock());
+        mCount = 0;
+        mNext  = 0;
+    }
+
+private:
+    void InitLock()
+    {
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+        System::Mutex::Init(mLock);
+#endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    }
+
+    System::Mutex & GetLock()
+    {
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING && CHIP_SYSTEM_CONFIG_FREERTOS_LOCKING
+        // The cache is constructed during static initialization, which may run before the
+        // FreeRTOS scheduler can create semaphores.
+        if (!mLock.isInitialized())
+        {
+            InitLock();
+        }
+#endif
+        return mLock;
+    }
+
+    static_assert(CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE <= UINT8_MAX, "Signature cache size must fit in uint8_t");
+
+    Digest mEntries[CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE];
+    uint8_t mCount = 0;
+    uint8_t mNext  = 0;
+    System::Mutex mLock;
+};
+
+VerifiedSignatureCache sVerifiedSignatureCache;
+
+} // namespace
+#endif // CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE > 0
+
+void ClearCertSignatureCache()
+{
+#if CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE > 0
+    sVerifiedSignatureCache.Clear();
+#endif
+}
+
 CHIP_ERROR VerifyCertSignature(const ChipCertificateData & cert, const ChipCertificateData & signer)
 {
     VerifyOrReturnError(cert.mCertFlags.Has(CertFlags::kTBSHashPresent), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(cert.mSigAlgoOID == kOID_SigAlgo_ECDSAWithSHA256, CHIP_ERROR_UNSUPPORTED_SIGNATURE_TYPE);
 
+#if CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE > 0
+    VerifiedSignatureCache::Digest digest;
+    ReturnErrorOnFailure(VerifiedSignatureCache::ComputeDigest(cert, signer, digest));
+    VerifyOrReturnError(!sVerifiedSignatureCache.Contains(digest), CHIP_NO_ERROR);
+#endif
+
 #ifdef ENABLE_HSM_ECDSA_VERIFY
     P256PublicKeyHSM signerPublicKey;
 #else
@@ -246,6 +356,10 @@ CHIP_ERROR VerifyCertSignature(const ChipCertificateData & cert, const ChipCerti
     ReturnErrorOnFailure(
         signerPublicKey.ECDSA_validate_hash_signature(cert.mTBSHash, chip::Crypto::kSHA256_Hash_Length, signature));
 
+#if CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE > 0
+    sVerifiedSignatureCache.Add(digest);
+#endif
+
     return CHIP_NO_ERROR;
 }
 
@@ -532,9 +532,21 @@ CHIP_ERROR ConvertChipCertToX509Cert(const ByteSpan chipCert, MutableByteSpan &
  *
  * Note that this function performs ONLY signature verification. No Subject and Issuer DN
  * comparison, Key Usage extension checks or similar validation is performed.
+ *
+ * If CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE is non-zero, successful verifications are remembered,
+ * see ClearCertSignatureCache().
  **/
 CHIP_ERROR VerifyCertSignature(const ChipCertificateData & cert, const ChipCertificateData & signer);
 
+/**
+ * @brief Forgets all signatures remembered by VerifyCertSignature().
+ *
+ * VerifyCertSignature() skips the ECDSA verification of a (TBS hash, signature, signer key) tuple that
+ * verified recently; see CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE.  Does nothing when the cache is
+ * disabled.
+ **/
+void ClearCertSignatureCache();
+
 /**
  * Validate CHIP Root CA Certificate (RCAC) in ByteSpan TLV-encoded form.
  * This function performs RCAC parsing, checks SubjectDN validity, verifies that SubjectDN
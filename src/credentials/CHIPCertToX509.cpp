@@ -608,7 +608,7 @@ static CHIP_ERROR DecodeConvertCert(TLVReader & reader, ASN1Writer & writer, ASN
         {
             // If the struct starts with the ec-pub-key we're dealing with a
             // Network (Client) Identity in compact-pdc-identity format.
-            DecodeConvertTBSCertCompactIdentity(reader, tbsWriter, certData);
+            ReturnErrorOnFailure(DecodeConvertTBSCertCompactIdentity(reader, tbsWriter, certData));
         }
         else
         {
@@ -663,6 +663,66 @@ CHIP_ERROR DecodeChipCert(const ByteSpan chipCert, ChipCertificateData & certDat
     return DecodeChipCert(reader, certData, decodeFlags);
 }
 
+/**
+ * Decode a CHIP TLV certificate and compute the hash of its X.509 DER encoded TBS portion
+ * without storing the encoding.
+ *
+ * DER places the length of each element in front of its value, so the certificate is converted
+ * twice: once to record the length of every constructed element, and once to stream the
+ * encoding into the hash.  Returns CHIP_ERROR_BUFFER_TOO_SMALL if the certificate has more
+ * elements than can be recorded.
+ */
+static CHIP_ERROR DecodeConvertCertStreamingTBSHash(TLVReader & reader, ChipCertificateData & certData)
+{
+    struct HashContext
+    {
+        Hash_SHA256_stream mHash;
+        CHIP_ERROR mError = CHIP_NO_ERROR;
+    };
+
+    ASN1Writer nullWriter;
+    nullWriter.InitNullWriter();
+
+    uint16_t lengths[kMaxCHIPCertTBSStreamedLengths];
+    TLVReader lengthReader;
+    lengthReader.Init(reader);
+
+    ASN1Writer lengthRecorder;
+    lengthRecorder.InitLengthRecorder(lengths, ArraySize(lengths));
+    CHIP_ERROR err = DecodeConvertCert(lengthReader, nullWriter, lengthRecorder, certData);
+    // Without a buffer, a length recorder only overflows when it runs out of length slots.
+    VerifyOrReturnError(err != ASN1_ERROR_OVERFLOW, CHIP_ERROR_BUFFER_TOO_SMALL);
+    ReturnErrorOnFailure(err);
+
+    // Enforce the same TBS size limit as when the TBS is captured in the decode buffer.
+    VerifyOrReturnError(lengthRecorder.GetLengthWritten() <= kMaxCHIPCertDecodeBufLength, ASN1_ERROR_OVERFLOW);
+    VerifyOrReturnError(certData.mSigAlgoOID == kOID_SigAlgo_ECDSAWithSHA256, CHIP_ERROR_UNSUPPORTED_SIGNATURE_TYPE);
+
+    HashContext context;
+    ReturnErrorOnFailure(context.mHash.Begin());
+
+    ASN1Writer tbsWriter;
+    tbsWriter.InitStreamWriter(
+        lengths, lengthRecorder.GetRecordedLengthCount(),
+        [](void * ctx, const uint8_t * data, size_t len) {
+            auto * hashContext = static_cast<HashContext *>(ctx);
+            if (hashContext->mError == CHIP_NO_ERROR)
+            {
+                hashContext->mError = hashContext->mHash.AddData(ByteSpan(data, len));
+            }
+        },
+        &context);
+
+    certData.Clear();
+    ReturnErrorOnFailure(DecodeConvertCert(reader, nullWriter, tbsWriter, certData));
+    ReturnErrorOnFailure(context.mError);
+
+    MutableByteSpan tbsHash(certData.mTBSHash);
+    ReturnErrorOnFailure(context.mHash.Finish(tbsHash));
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR DecodeChipCert(TLVReader & reader, ChipCertificateData & certData, BitFlags<CertDecodeFlags> decodeFlags)
 {
     ASN1Writer nullWriter;
@@ -672,18 +732,29 @@ CHIP_ERROR DecodeChipCert(TLVReader & reader, ChipCertificateData & certData, Bi
 
     if (decodeFlags.Has(CertDecodeFlags::kGenerateTBSHash))
     {
-        // Create a buffer and writer to capture the TBS (to-be-signed) portion of the certificate
-        // when we decode (and convert) the certificate, so we can hash it to create the TBSHash.
-        chip::Platform::ScopedMemoryBuffer<uint8_t> asn1TBSBuf;
-        VerifyOrReturnError(asn1TBSBuf.Alloc(kMaxCHIPCertDecodeBufLength), CHIP_ERROR_NO_MEMORY);
-        ASN1Writer tbsWriter;
-        tbsWriter.Init(asn1TBSBuf.Get(), kMaxCHIPCertDecodeBufLength);
-
-        ReturnErrorOnFailure(DecodeConvertCert(reader, nullWriter, tbsWriter, certData));
-
-        // Hash the encoded TBS certificate. Only SHA256 is supported.
-        VerifyOrReturnError(certData.mSigAlgoOID == kOID_SigAlgo_ECDSAWithSHA256, CHIP_ERROR_UNSUPPORTED_SIGNATURE_TYPE);
-        ReturnErrorOnFailure(Hash_SHA256(asn1TBSBuf.Get(), tbsWriter.GetLengthWritten(), certData.mTBSHash));
+        TLVReader fallbackReader;
+        fallbackReader.Init(reader);
+
+        CHIP_ERROR err = DecodeConvertCertStreamingTBSHash(reader, certData);
+        if (err == CHIP_ERROR_BUFFER_TOO_SMALL)
+        {
+            // Too many elements to stream; capture the TBS (to-be-signed) portion of the certificate
+            // in a buffer when we decode (and convert) the certificate, and hash that instead.
+            reader.Init(fallbackReader);
+            certData.Clear();
+
+            chip::Platform::ScopedMemoryBuffer<uint8_t> asn1TBSBuf;
+            VerifyOrReturnError(asn1TBSBuf.Alloc(kMaxCHIPCertDecodeBufLength), CHIP_ERROR_NO_MEMORY);
+            ASN1Writer tbsWriter;
+            tbsWriter.Init(asn1TBSBuf.Get(), kMaxCHIPCertDecodeBufLength);
+
+            ReturnErrorOnFailure(DecodeConvertCert(reader, nullWriter, tbsWriter, certData));
+
+            // Hash the encoded TBS certificate. Only SHA256 is supported.
+            VerifyOrReturnError(certData.mSigAlgoOID == kOID_SigAlgo_ECDSAWithSHA256, CHIP_ERROR_UNSUPPORTED_SIGNATURE_TYPE);
+            err = Hash_SHA256(asn1TBSBuf.Get(), tbsWriter.GetLengthWritten(), certData.mTBSHash);
+        }
+        ReturnErrorOnFailure(err);
         certData.mCertFlags.Set(CertFlags::kTBSHashPresent);
     }
     else
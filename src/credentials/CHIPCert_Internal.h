@@ -26,6 +26,10 @@ namespace Credentials {
 // The decode buffer is used to reconstruct TBS section of X.509 certificate, which doesn't include signature.
 inline constexpr size_t kMaxCHIPCertDecodeBufLength = kMaxDERCertLength - Crypto::kMax_ECDSA_Signature_Length_Der;
 
+// Number of constructed and encapsulated elements whose lengths are recorded when the TBS hash is computed
+// by streaming the TBS section. Operational certificates need about 40; larger ones fall back to the decode buffer.
+inline constexpr size_t kMaxCHIPCertTBSStreamedLengths = 64;
+
 // The TBSCerticate of a Network (Client) Identity has a fixed (smaller) size.
 inline constexpr size_t kNetworkIdentityTBSLength = 244;
 
@@ -46,6 +46,13 @@ static_assert(CHIP_CONFIG_MAX_FABRICS <= kMaxValidFabricIndex, "Max fabric count
 constexpr TLV::Tag kVendorIdTag    = TLV::ContextTag(0);
 constexpr TLV::Tag kFabricLabelTag = TLV::ContextTag(1);
 
+// Tags for our fabric identity cache storage.
+constexpr TLV::Tag kNodeIdTag             = TLV::ContextTag(0);
+constexpr TLV::Tag kFabricIdTag           = TLV::ContextTag(1);
+constexpr TLV::Tag kCompressedFabricIdTag = TLV::ContextTag(2);
+constexpr TLV::Tag kRootPublicKeyTag      = TLV::ContextTag(3);
+constexpr TLV::Tag kCATsTag               = TLV::ContextTag(4);
+
 // Tags for our index list storage.
 constexpr TLV::Tag kNextAvailableFabricIndexTag = TLV::ContextTag(0);
 constexpr TLV::Tag kFabricIndicesTag            = TLV::ContextTag(1);
@@ -122,6 +129,7 @@ CHIP_ERROR FabricInfo::Init(const FabricInfo::InitParams & initParams)
     mFabricIndex             = initParams.fabricIndex;
     mCompressedFabricId      = initParams.compressedFabricId;
     mRootPublicKey           = initParams.rootPublicKey;
+    mCATs                    = initParams.cats;
     mVendorId                = static_cast<VendorId>(initParams.vendorId);
     mShouldAdvertiseIdentity = initParams.advertiseIdentity;
 
@@ -150,6 +158,7 @@ void FabricInfo::operator=(FabricInfo && other)
     mFabricIndex             = other.mFabricIndex;
     mCompressedFabricId      = other.mCompressedFabricId;
     mRootPublicKey           = other.mRootPublicKey;
+    mCATs                    = other.mCATs;
     mVendorId                = other.mVendorId;
     mShouldAdvertiseIdentity = other.mShouldAdvertiseIdentity;
 
@@ -199,6 +208,7 @@ CHIP_ERROR FabricInfo::LoadFromStorage(PersistentStorageDelegate * storage, Fabr
     // Regenerate operational metadata from NOC/RCAC
     {
         ReturnErrorOnFailure(ExtractNodeIdFabricIdFromOpCert(noc, &mNodeId, &mFabricId));
+        ReturnErrorOnFailure(ExtractCATsFromOpCert(noc, mCATs));
 
         P256PublicKeySpan rootPubKeySpan;
         ReturnErrorOnFailure(ExtractPublicKeyFromChipCert(rcac, rootPubKeySpan));
@@ -213,6 +223,93 @@ CHIP_ERROR FabricInfo::LoadFromStorage(PersistentStorageDelegate * storage, Fabr
         mCompressedFabricId = Encoding::BigEndian::Get64(compressedFabricIdBuf);
     }
 
+    return LoadMetadataFromStorage(storage);
+}
+
+CHIP_ERROR FabricInfo::LoadFromStorage(PersistentStorageDelegate * storage, FabricIndex newFabricIndex)
+{
+    mFabricIndex = newFabricIndex;
+
+    {
+        uint8_t buf[IdentityTLVMaxSize()];
+        uint16_t size = sizeof(buf);
+        ReturnErrorOnFailure(
+            storage->SyncGetKeyValue(DefaultStorageKeyAllocator::FabricIdentity(mFabricIndex).KeyName(), buf, size));
+        TLV::ContiguousBufferTLVReader reader;
+        reader.Init(buf, size);
+
+        ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()));
+        TLV::TLVType containerType;
+        ReturnErrorOnFailure(reader.EnterContainer(containerType));
+
+        ReturnErrorOnFailure(reader.Next(kNodeIdTag));
+        ReturnErrorOnFailure(reader.Get(mNodeId));
+        ReturnErrorOnFailure(reader.Next(kFabricIdTag));
+        ReturnErrorOnFailure(reader.Get(mFabricId));
+        ReturnErrorOnFailure(reader.Next(kCompressedFabricIdTag));
+        ReturnErrorOnFailure(reader.Get(mCompressedFabricId));
+
+        ByteSpan rootPublicKey;
+        ReturnErrorOnFailure(reader.Next(kRootPublicKeyTag));
+        ReturnErrorOnFailure(reader.Get(rootPublicKey));
+        VerifyOrReturnError(rootPublicKey.size() == Crypto::kP256_PublicKey_Length, CHIP_ERROR_INVALID_TLV_ELEMENT);
+        mRootPublicKey = P256PublicKeySpan(rootPublicKey.data());
+
+        ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, kCATsTag));
+        TLV::TLVType arrayType;
+        ReturnErrorOnFailure(reader.EnterContainer(arrayType));
+        mCATs = kUndefinedCATs;
+        CHIP_ERROR err;
+        for (size_t i = 0; (err = reader.Next()) == CHIP_NO_ERROR; i++)
+        {
+            VerifyOrReturnError(i < mCATs.size(), CHIP_ERROR_INVALID_TLV_ELEMENT);
+            ReturnErrorOnFailure(reader.Get(mCATs.values[i]));
+        }
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+        ReturnErrorOnFailure(reader.ExitContainer(arrayType));
+
+        // Fields added by later versions are ignored.
+        ReturnErrorOnFailure(reader.ExitContainer(containerType));
+    }
+
+    return LoadMetadataFromStorage(storage);
+}
+
+CHIP_ERROR FabricInfo::CommitIdentityToStorage(PersistentStorageDelegate * storage) const
+{
+    uint8_t buf[IdentityTLVMaxSize()];
+    TLV::TLVWriter writer;
+    writer.Init(buf);
+
+    TLV::TLVType outerType;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerType));
+
+    ReturnErrorOnFailure(writer.Put(kNodeIdTag, mNodeId));
+    ReturnErrorOnFailure(writer.Put(kFabricIdTag, mFabricId));
+    ReturnErrorOnFailure(writer.Put(kCompressedFabricIdTag, mCompressedFabricId));
+    ReturnErrorOnFailure(writer.Put(kRootPublicKeyTag, ByteSpan(mRootPublicKey.ConstBytes(), mRootPublicKey.Length())));
+
+    TLV::TLVType arrayType;
+    ReturnErrorOnFailure(writer.StartContainer(kCATsTag, TLV::kTLVType_Array, arrayType));
+    for (CASEAuthTag cat : mCATs.values)
+    {
+        if (cat != kUndefinedCAT)
+        {
+            ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), cat));
+        }
+    }
+    ReturnErrorOnFailure(writer.EndContainer(arrayType));
+
+    ReturnErrorOnFailure(writer.EndContainer(outerType));
+
+    const auto identityLength = writer.GetLengthWritten();
+    VerifyOrReturnError(CanCastTo<uint16_t>(identityLength), CHIP_ERROR_BUFFER_TOO_SMALL);
+    return storage->SyncSetKeyValue(DefaultStorageKeyAllocator::FabricIdentity(mFabricIndex).KeyName(), buf,
+                                    static_cast<uint16_t>(identityLength));
+}
+
+CHIP_ERROR FabricInfo::LoadMetadataFromStorage(PersistentStorageDelegate * storage)
+{
     // Load other storable metadata (label, vendorId, etc)
     {
         uint8_t buf[MetadataTLVMaxSize()];
@@ -273,6 +370,18 @@ CHIP_ERROR FabricTable::DeleteMetadataFromStorage(FabricIndex fabricIndex)
         }
     }
 
+    // The identity cache only exists when it was enabled, whether now or by a previous firmware.
+    CHIP_ERROR identityErr = mStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::FabricIdentity(fabricIndex).KeyName());
+    if (identityErr != CHIP_NO_ERROR && identityErr != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        ChipLogError(FabricProvisioning, "Error deleting identity for fabric 0x%x: %" CHIP_ERROR_FORMAT,
+                     static_cast<unsigned>(fabricIndex), identityErr.Format());
+        if (deleteErr == CHIP_NO_ERROR)
+        {
+            deleteErr = identityErr;
+        }
+    }
+
     return deleteErr;
 }
 
@@ -492,33 +601,22 @@ const FabricInfo * FabricTable::FindIdentity(const Crypto::P256PublicKey & rootP
 
 const FabricInfo * FabricTable::FindFabricCommon(const Crypto::P256PublicKey & rootPubKey, FabricId fabricId, NodeId nodeId) const
 {
-    P256PublicKey candidatePubKey;
+    // The cached root public key is compared in place, and only once the cheaper IDs match.
+    auto matches = [&](const FabricInfo & fabric) {
+        auto matchingNodeId = (nodeId == kUndefinedNodeId) ? fabric.GetNodeId() : nodeId;
+        return fabric.IsInitialized() && fabricId == fabric.GetFabricId() && matchingNodeId == fabric.GetNodeId() &&
+            rootPubKey.Matches(fabric.mRootPublicKey);
+    };
 
     // Try to match pending fabric first if available
-    if (HasPendingFabricUpdate())
+    if (HasPendingFabricUpdate() && matches(mPendingFabric))
     {
-        bool pubKeyAvailable = (mPendingFabric.FetchRootPubkey(candidatePubKey) == CHIP_NO_ERROR);
-        auto matchingNodeId  = (nodeId == kUndefinedNodeId) ? mPendingFabric.GetNodeId() : nodeId;
-        if (pubKeyAvailable && rootPubKey.Matches(candidatePubKey) && fabricId == mPendingFabric.GetFabricId() &&
-            matchingNodeId == mPendingFabric.GetNodeId())
-        {
-            return &mPendingFabric;
-        }
+        return &mPendingFabric;
     }
 
     for (auto & fabric : mStates)
     {
-        auto matchingNodeId = (nodeId == kUndefinedNodeId) ? fabric.GetNodeId() : nodeId;
-
-        if (!fabric.IsInitialized())
-        {
-            continue;
-        }
-        if (fabric.FetchRootPubkey(candidatePubKey) != CHIP_NO_ERROR)
-        {
-            continue;
-        }
-        if (rootPubKey.Matches(candidatePubKey) && fabricId == fabric.GetFabricId() && matchingNodeId == fabric.GetNodeId())
+        if (matches(fabric))
         {
             return &fabric;
         }
@@ -666,10 +764,10 @@ CHIP_ERROR FabricTable::FetchRootPubkey(FabricIndex fabricIndex, Crypto::P256Pub
 
 CHIP_ERROR FabricTable::FetchCATs(const FabricIndex fabricIndex, CATValues & cats) const
 {
-    uint8_t nocBuf[Credentials::kMaxCHIPCertLength];
-    MutableByteSpan nocSpan{ nocBuf };
-    ReturnErrorOnFailure(FetchNOCCert(fabricIndex, nocSpan));
-    ReturnErrorOnFailure(ExtractCATsFromOpCert(nocSpan, cats));
+    // The CATs of the NOC, pending or committed, are cached when the fabric is loaded, added or updated.
+    const FabricInfo * fabricInfo = FindFabricWithIndex(fabricIndex);
+    VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_INVALID_FABRIC_INDEX);
+    cats = fabricInfo->mCATs;
     return CHIP_NO_ERROR;
 }
 
@@ -683,6 +781,10 @@ CHIP_ERROR FabricTable::StoreFabricMetadata(const FabricInfo * fabricInfo) const
 
     // TODO: Refactor not to internally rely directly on storage
     ReturnErrorOnFailure(fabricInfo->CommitToStorage(mStorage));
+#if CHIP_CONFIG_FABRIC_TABLE_LAZY_CERT_LOADING
+    // Written with the metadata, so that it follows every commit of the NOC it is derived from.
+    ReturnErrorOnFailure(fabricInfo->CommitIdentityToStorage(mStorage));
+#endif // CHIP_CONFIG_FABRIC_TABLE_LAZY_CERT_LOADING
 
     ChipLogProgress(FabricProvisioning, "Metadata for Fabric 0x%x persisted to storage.", static_cast<unsigned>(fabricIndex));
 
@@ -694,6 +796,21 @@ CHIP_ERROR FabricTable::LoadFromStorage(FabricInfo * fabric, FabricIndex newFabr
     VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(!fabric->IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
 
+#if CHIP_CONFIG_FABRIC_TABLE_LAZY_CERT_LOADING
+    if (fabric->LoadFromStorage(mStorage, newFabricIndex) == CHIP_NO_ERROR)
+    {
+        ChipLogProgress(FabricProvisioning,
+                        "Fabric index 0x%x was retrieved from its cached identity. Compressed FabricId 0x" ChipLogFormatX64
+                        ", FabricId 0x" ChipLogFormatX64 ", NodeId 0x" ChipLogFormatX64 ", VendorId 0x%04X",
+                        static_cast<unsigned>(fabric->GetFabricIndex()), ChipLogValueX64(fabric->GetCompressedFabricId()),
+                        ChipLogValueX64(fabric->GetFabricId()), ChipLogValueX64(fabric->GetNodeId()),
+                        to_underlying(fabric->GetVendorId()));
+        return CHIP_NO_ERROR;
+    }
+    // Not cached yet, or unreadable: fall back to the certificates.
+    fabric->Reset();
+#endif // CHIP_CONFIG_FABRIC_TABLE_LAZY_CERT_LOADING
+
     uint8_t nocBuf[kMaxCHIPCertLength];
     MutableByteSpan nocSpan{ nocBuf };
     uint8_t rcacBuf[kMaxCHIPCertLength];
@@ -720,6 +837,15 @@ CHIP_ERROR FabricTable::LoadFromStorage(FabricInfo * fabric, FabricIndex newFabr
         return err;
     }
 
+#if CHIP_CONFIG_FABRIC_TABLE_LAZY_CERT_LOADING
+    err = fabric->CommitIdentityToStorage(mStorage);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(FabricProvisioning, "Failed to cache the identity of Fabric (0x%x): %" CHIP_ERROR_FORMAT,
+                     static_cast<unsigned>(newFabricIndex), err.Format());
+    }
+#endif // CHIP_CONFIG_FABRIC_TABLE_LAZY_CERT_LOADING
+
     ChipLogProgress(FabricProvisioning,
                     "Fabric index 0x%x was retrieved from storage. Compressed FabricId 0x" ChipLogFormatX64
                     ", FabricId 0x" ChipLogFormatX64 ", NodeId 0x" ChipLogFormatX64 ", VendorId 0x%04X",
@@ -876,6 +1002,7 @@ FabricTable::AddOrUpdateInner(FabricIndex fabricIndex, bool isAddition, Crypto::
         ReturnErrorOnFailure(ValidateIncomingNOCChain(nocSpan, icacSpan, rcacSpan, fabricIdToValidate, &notBeforeCollector,
                                                       newFabricInfo.compressedFabricId, newFabricInfo.fabricId,
                                                       newFabricInfo.nodeId, nocPubKey, newFabricInfo.rootPublicKey));
+        ReturnErrorOnFailure(ExtractCATsFromOpCert(nocSpan, newFabricInfo.cats));
     }
 
     if (existingOpKey != nullptr)
@@ -1072,6 +1199,8 @@ void FabricTable::DeleteAllFabrics()
 
 CHIP_ERROR FabricTable::Init(const FabricTable::InitParams & initParams)
 {
+    CHIP_MEMORY_TAG_SCOPE(kCredentials);
+
     VerifyOrReturnError(initParams.storage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(initParams.opCertStore != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
@@ -2032,6 +2161,16 @@ CHIP_ERROR FabricTable::CommitPendingFabricData()
     mFabricIndexWithPendingState = kUndefinedFabricIndex;
     mPendingFabric.Reset();
 
+    // The fabric is only committed once its data survives a reboot, even on storage writing in the background.
+    if (stickyError == CHIP_NO_ERROR)
+    {
+        stickyError = mStorage->SyncFlush();
+        if (stickyError != CHIP_NO_ERROR)
+        {
+            ChipLogError(FabricProvisioning, "Failed to flush committed fabric data: %" CHIP_ERROR_FORMAT, stickyError.Format());
+        }
+    }
+
     if (stickyError != CHIP_NO_ERROR)
     {
         // Blow-away everything if we got past any storage, even on Update: system state is broken
@@ -103,6 +103,16 @@ public:
 
     CHIP_ERROR FetchRootPubkey(Crypto::P256PublicKey & outPublicKey) const;
 
+    /**
+     * @brief Returns whether the other fabric is on the same logical fabric, i.e. has the same root public key and
+     *        fabric ID, without copying the root public keys out.
+     */
+    bool IsSameLogicalFabric(const FabricInfo & other) const
+    {
+        return IsInitialized() && other.IsInitialized() && (mFabricId == other.mFabricId) &&
+            mRootPublicKey.Matches(other.mRootPublicKey);
+    }
+
     VendorId GetVendorId() const { return mVendorId; }
 
     bool IsInitialized() const { return (mFabricIndex != kUndefinedFabricIndex) && IsOperationalNodeId(mNodeId); }
@@ -122,6 +132,7 @@ private:
         Crypto::P256Keypair * operationalKeypair = nullptr;
         FabricId fabricId                        = kUndefinedFabricId;
         Crypto::P256PublicKey rootPublicKey;
+        CATValues cats                 = kUndefinedCATs;
         VendorId vendorId              = VendorId::NotSpecified; /**< Vendor ID for commissioner of fabric */
         bool hasExternallyOwnedKeypair = false;
         bool advertiseIdentity         = false;
@@ -196,6 +207,7 @@ private:
         mFabricId           = kUndefinedFabricId;
         mFabricIndex        = kUndefinedFabricIndex;
         mCompressedFabricId = kUndefinedCompressedFabricId;
+        mCATs               = kUndefinedCATs;
 
         mVendorId       = VendorId::NotSpecified;
         mFabricLabel[0] = '\0';
@@ -219,6 +231,13 @@ private:
         return TLV::EstimateStructOverhead(sizeof(uint16_t), kFabricLabelMaxLengthInBytes);
     }
 
+    static constexpr size_t IdentityTLVMaxSize()
+    {
+        return TLV::EstimateStructOverhead(sizeof(NodeId), sizeof(FabricId), sizeof(CompressedFabricId),
+                                           Crypto::kP256_PublicKey_Length,
+                                           CATValues::size() * (1 + sizeof(CASEAuthTag)) + 1); // CATs array
+    }
+
     static constexpr size_t OpKeyTLVMaxSize()
     {
         return TLV::EstimateStructOverhead(sizeof(uint16_t), Crypto::P256SerializedKeypair::Capacity());
@@ -230,6 +249,8 @@ private:
     CompressedFabricId mCompressedFabricId = kUndefinedCompressedFabricId;
     // We cache the root public key since it's used so often and costly to get.
     Crypto::P256PublicKey mRootPublicKey;
+    // We cache the CASE Authenticated Tags of the NOC, so that fetching them does not read and parse the NOC.
+    CATValues mCATs = kUndefinedCATs;
 
     // mFabricLabel is 33 bytes, so ends on a 1 mod 4 byte boundary.
     char mFabricLabel[kFabricLabelMaxLengthInBytes + 1] = { '\0' };
@@ -251,6 +272,13 @@ private:
     CHIP_ERROR CommitToStorage(PersistentStorageDelegate * storage) const;
     CHIP_ERROR LoadFromStorage(PersistentStorageDelegate * storage, FabricIndex newFabricIndex, const ByteSpan & rcac,
                                const ByteSpan & noc);
+
+    // The identity of the fabric (node and fabric ids, CATs, root public key and compressed fabric id) is what is
+    // derived from its NOC and RCAC. Caching it in storage lets the fabric be loaded without reading and decoding its
+    // certificates.
+    CHIP_ERROR CommitIdentityToStorage(PersistentStorageDelegate * storage) const;
+    CHIP_ERROR LoadFromStorage(PersistentStorageDelegate * storage, FabricIndex newFabricIndex);
+    CHIP_ERROR LoadMetadataFromStorage(PersistentStorageDelegate * storage);
 };
 
 /**
@@ -311,6 +311,12 @@ public:
     // Decryption
     virtual GroupSessionIterator * IterateGroupSessions(uint16_t session_id)                        = 0;
     virtual Crypto::SymmetricKeyContext * GetKeyContext(FabricIndex fabric_index, GroupId group_id) = 0;
+    /**
+     *  Number of the most recent GroupSession values returned by a GroupSessionIterator whose keyContext
+     *  remain usable while the iteration continues.  By default, each call to Next() invalidates the
+     *  keyContext returned by the previous one.
+     */
+    virtual size_t GetLiveGroupSessionCount() const { return 1; }
 
     // Listener
     void SetListener(GroupListener * listener) { mListener = listener; };
@@ -22,6 +22,9 @@
 #include <lib/support/DefaultStorageKeyAllocator.h>
 #include <lib/support/PersistentData.h>
 #include <lib/support/Pool.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
 #include <stdlib.h>
 
 namespace chip {
@@ -826,6 +829,9 @@ CHIP_ERROR GroupDataProviderImpl::Init()
 
 void GroupDataProviderImpl::Finish()
 {
+    InvalidateIpkCache(kUndefinedFabricIndex);
+    InvalidateSessionIndex();
+    InvalidateEndpointIndex();
     mGroupInfoIterators.ReleaseAll();
     mGroupKeyIterators.ReleaseAll();
     mEndpointIterators.ReleaseAll();
@@ -838,6 +844,9 @@ void GroupDataProviderImpl::SetStorageDelegate(PersistentStorageDelegate * stora
 {
     VerifyOrDie(storage != nullptr);
     mStorage = storage;
+    InvalidateIpkCache(kUndefinedFabricIndex);
+    InvalidateSessionIndex();
+    InvalidateEndpointIndex();
 }
 
 //
@@ -895,6 +904,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupInfo(chip::FabricIndex fabric_index
 CHIP_ERROR GroupDataProviderImpl::SetGroupInfoAt(chip::FabricIndex fabric_index, size_t index, const GroupInfo & info)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateEndpointIndex();
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -977,6 +987,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupInfoAt(chip::FabricIndex fabric_index,
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupInfoAt(chip::FabricIndex fabric_index, size_t index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateEndpointIndex();
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1025,6 +1036,22 @@ bool GroupDataProviderImpl::HasEndpoint(chip::FabricIndex fabric_index, chip::Gr
 {
     VerifyOrReturnError(IsInitialized(), false);
 
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE > 0
+    size_t begin = 0;
+    size_t end   = 0;
+    if (FindIndexedEndpoints(fabric_index, group_id, begin, end))
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            if (mEndpointIndex[i].endpoint_id == endpoint_id)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+#endif // CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE > 0
+
     FabricData fabric(fabric_index);
     GroupData group;
     EndpointData endpoint;
@@ -1037,6 +1064,7 @@ bool GroupDataProviderImpl::HasEndpoint(chip::FabricIndex fabric_index, chip::Gr
 CHIP_ERROR GroupDataProviderImpl::AddEndpoint(chip::FabricIndex fabric_index, chip::GroupId group_id, chip::EndpointId endpoint_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateEndpointIndex();
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1095,6 +1123,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoint(chip::FabricIndex fabric_index,
                                                  chip::EndpointId endpoint_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateEndpointIndex();
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1219,6 +1248,19 @@ GroupDataProviderImpl::EndpointIteratorImpl::EndpointIteratorImpl(GroupDataProvi
     mProvider(provider),
     mFabric(fabric_index)
 {
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE > 0
+    if (group_id.has_value())
+    {
+        mIndexed = provider.FindIndexedEndpoints(fabric_index, *group_id, mIndexBegin, mIndexEnd);
+        if (mIndexed)
+        {
+            mIndexPosition   = mIndexBegin;
+            mIndexGeneration = provider.mEndpointIndexGeneration;
+            return;
+        }
+    }
+#endif // CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE > 0
+
     FabricData fabric(fabric_index);
     VerifyOrReturn(CHIP_NO_ERROR == fabric.Load(provider.mStorage));
 
@@ -1248,6 +1290,13 @@ GroupDataProviderImpl::EndpointIteratorImpl::EndpointIteratorImpl(GroupDataProvi
 
 size_t GroupDataProviderImpl::EndpointIteratorImpl::Count()
 {
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE > 0
+    if (mIndexed)
+    {
+        return mIndexEnd - mIndexBegin;
+    }
+#endif // CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE > 0
+
     GroupData group(mFabric, mFirstGroup);
     size_t group_index    = 0;
     size_t endpoint_index = 0;
@@ -1277,6 +1326,20 @@ size_t GroupDataProviderImpl::EndpointIteratorImpl::Count()
 
 bool GroupDataProviderImpl::EndpointIteratorImpl::Next(GroupEndpoint & output)
 {
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE > 0
+    if (mIndexed)
+    {
+        // The groups or their endpoints changed since the iterator was created.
+        VerifyOrReturnError(mIndexGeneration == mProvider.mEndpointIndexGeneration, false);
+        VerifyOrReturnError(mIndexPosition < mIndexEnd, false);
+
+        const IndexedGroupEndpoint & entry = mProvider.mEndpointIndex[mIndexPosition++];
+        output.group_id                    = entry.group_id;
+        output.endpoint_id                 = entry.endpoint_id;
+        return true;
+    }
+#endif // CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE > 0
+
     while (mGroupIndex < mGroupCount)
     {
         GroupData group(mFabric, mGroup);
@@ -1319,6 +1382,7 @@ void GroupDataProviderImpl::EndpointIteratorImpl::Release()
 CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index, chip::GroupId group_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateEndpointIndex();
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1349,6 +1413,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index
 CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index, size_t index, const GroupKey & in_map)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateSessionIndex();
 
     FabricData fabric(fabric_index);
     KeyMapData map(fabric_index);
@@ -1415,6 +1480,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupKeyAt(chip::FabricIndex fabric_index,
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_index, size_t index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateSessionIndex();
 
     FabricData fabric(fabric_index);
     KeyMapData map;
@@ -1447,6 +1513,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_inde
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeys(chip::FabricIndex fabric_index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateSessionIndex();
 
     FabricData fabric(fabric_index);
     VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mStorage), CHIP_ERROR_INVALID_FABRIC_INDEX);
@@ -1523,6 +1590,8 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
                                             const KeySet & in_keyset)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateIpkCache(fabric_index);
+    InvalidateSessionIndex();
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1594,6 +1663,8 @@ CHIP_ERROR GroupDataProviderImpl::GetKeySet(chip::FabricIndex fabric_index, uint
 CHIP_ERROR GroupDataProviderImpl::RemoveKeySet(chip::FabricIndex fabric_index, uint16_t target_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateIpkCache(fabric_index);
+    InvalidateSessionIndex();
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1695,6 +1766,10 @@ void GroupDataProviderImpl::KeySetIteratorImpl::Release()
 
 CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
 {
+    InvalidateIpkCache(fabric_index);
+    InvalidateSessionIndex();
+    InvalidateEndpointIndex();
+
     FabricData fabric(fabric_index);
 
     // Fabric data defaults to zero, so if not entry is found, no mappings, or keys are removed
@@ -1770,6 +1845,53 @@ Crypto::SymmetricKeyContext * GroupDataProviderImpl::GetKeyContext(FabricIndex f
 }
 
 CHIP_ERROR GroupDataProviderImpl::GetIpkKeySet(FabricIndex fabric_index, KeySet & out_keyset)
+{
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_CACHE_IPK
+    VerifyOrReturnError(kUndefinedFabricIndex != fabric_index, CHIP_ERROR_INVALID_FABRIC_INDEX);
+
+    CachedIpkKeySet * freeEntry = nullptr;
+    for (auto & entry : mIpkCache)
+    {
+        if (entry.fabric_index == fabric_index)
+        {
+            out_keyset = entry.keyset;
+            return CHIP_NO_ERROR;
+        }
+        if (freeEntry == nullptr && entry.fabric_index == kUndefinedFabricIndex)
+        {
+            freeEntry = &entry;
+        }
+    }
+
+    ReturnErrorOnFailure(LoadIpkKeySet(fabric_index, out_keyset));
+
+    if (freeEntry != nullptr)
+    {
+        freeEntry->fabric_index = fabric_index;
+        freeEntry->keyset       = out_keyset;
+    }
+    return CHIP_NO_ERROR;
+#else
+    return LoadIpkKeySet(fabric_index, out_keyset);
+#endif // CHIP_CONFIG_GROUP_DATA_PROVIDER_CACHE_IPK
+}
+
+void GroupDataProviderImpl::InvalidateIpkCache(FabricIndex fabric_index)
+{
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_CACHE_IPK
+    // kUndefinedFabricIndex drops every entry.
+    for (auto & entry : mIpkCache)
+    {
+        if (fabric_index == kUndefinedFabricIndex || entry.fabric_index == fabric_index)
+        {
+            entry.keyset.ClearKeys();
+            entry.fabric_index = kUndefinedFabricIndex;
+        }
+    }
+#endif // CHIP_CONFIG_GROUP_DATA_PROVIDER_CACHE_IPK
+}
+
+CHIP_ERROR GroupDataProviderImpl::LoadIpkKeySet(FabricIndex fabric_index, KeySet & out_keyset)
 {
     FabricData fabric(fabric_index);
     VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mStorage), CHIP_ERROR_NOT_FOUND);
@@ -1800,6 +1922,185 @@ CHIP_ERROR GroupDataProviderImpl::GetIpkKeySet(FabricIndex fabric_index, KeySet
     return CHIP_NO_ERROR;
 }
 
+bool GroupDataProviderImpl::LoadSessionIndex()
+{
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE > 0
+    if (mSessionIndexState == IndexState::kStale)
+    {
+        CHIP_ERROR err = BuildSessionIndex();
+        if (CHIP_NO_ERROR != err)
+        {
+            ChipLogProgress(Crypto, "Group session index unavailable: %" CHIP_ERROR_FORMAT, err.Format());
+            InvalidateSessionIndex();
+        }
+        mSessionIndexState = (CHIP_NO_ERROR == err) ? IndexState::kValid : IndexState::kUnavailable;
+    }
+    return mSessionIndexState == IndexState::kValid;
+#else
+    return false;
+#endif // CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE > 0
+}
+
+CHIP_ERROR GroupDataProviderImpl::BuildSessionIndex()
+{
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE > 0
+    FabricList fabric_list;
+    CHIP_ERROR err = fabric_list.Load(mStorage);
+    // No fabric, no keys
+    VerifyOrReturnError(CHIP_ERROR_NOT_FOUND != err, CHIP_NO_ERROR);
+    ReturnErrorOnFailure(err);
+
+    FabricData fabric(fabric_list.first_entry);
+    for (size_t i = 0; i < fabric_list.entry_count; i++, fabric.fabric_index = fabric.next)
+    {
+        ReturnErrorOnFailure(fabric.Load(mStorage));
+
+        KeyMapData mapping(fabric.fabric_index, fabric.first_map);
+        for (uint16_t j = 0; j < fabric.map_count; ++j, mapping.id = mapping.next)
+        {
+            ReturnErrorOnFailure(mapping.Load(mStorage));
+
+            // The storage walk of GroupSessionIteratorImpl stops at a missing keyset, keep to it.
+            KeySetData keyset;
+            VerifyOrReturnError(keyset.Find(mStorage, fabric, mapping.keyset_id), CHIP_ERROR_KEY_NOT_FOUND);
+
+            for (uint16_t k = 0; k < keyset.keys_count; ++k)
+            {
+                VerifyOrReturnError(mSessionIndexCount < ArraySize(mSessionIndex), CHIP_ERROR_NO_MEMORY);
+                const Crypto::GroupOperationalCredentials & creds = keyset.operational_keys[k];
+
+                // Insert sorted by session id, after the keys with the same id, so that lookups see the keys in storage order.
+                size_t pos = mSessionIndexCount++;
+                for (; pos > 0 && mSessionIndex[pos - 1].session_id > creds.hash; --pos)
+                {
+                    mSessionIndex[pos] = mSessionIndex[pos - 1];
+                }
+                IndexedGroupSession & entry = mSessionIndex[pos];
+                entry.session_id            = creds.hash;
+                entry.fabric_index          = fabric.fabric_index;
+                entry.group_id              = mapping.group_id;
+                entry.security_policy       = keyset.policy;
+                memcpy(entry.encryption_key, creds.encryption_key, sizeof(entry.encryption_key));
+                memcpy(entry.privacy_key, creds.privacy_key, sizeof(entry.privacy_key));
+            }
+        }
+    }
+    return CHIP_NO_ERROR;
+#else
+    return CHIP_ERROR_NOT_IMPLEMENTED;
+#endif // CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE > 0
+}
+
+void GroupDataProviderImpl::InvalidateSessionIndex()
+{
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE > 0
+    for (size_t i = 0; i < mSessionIndexCount; ++i)
+    {
+        Crypto::ClearSecretData(mSessionIndex[i].encryption_key);
+        Crypto::ClearSecretData(mSessionIndex[i].privacy_key);
+    }
+    mSessionIndexCount = 0;
+    mSessionIndexState = IndexState::kStale;
+    // Ends the iterators over the previous contents
+    mSessionIndexGeneration++;
+#endif // CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE > 0
+}
+
+bool GroupDataProviderImpl::LoadEndpointIndex()
+{
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE > 0
+    if (mEndpointIndexState == IndexState::kStale)
+    {
+        CHIP_ERROR err = BuildEndpointIndex();
+        if (CHIP_NO_ERROR != err)
+        {
+            ChipLogProgress(Zcl, "Group endpoint index unavailable: %" CHIP_ERROR_FORMAT, err.Format());
+            InvalidateEndpointIndex();
+        }
+        mEndpointIndexState = (CHIP_NO_ERROR == err) ? IndexState::kValid : IndexState::kUnavailable;
+    }
+    return mEndpointIndexState == IndexState::kValid;
+#else
+    return false;
+#endif // CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE > 0
+}
+
+CHIP_ERROR GroupDataProviderImpl::BuildEndpointIndex()
+{
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE > 0
+    FabricList fabric_list;
+    CHIP_ERROR err = fabric_list.Load(mStorage);
+    // No fabric, no groups
+    VerifyOrReturnError(CHIP_ERROR_NOT_FOUND != err, CHIP_NO_ERROR);
+    ReturnErrorOnFailure(err);
+
+    FabricData fabric(fabric_list.first_entry);
+    for (size_t i = 0; i < fabric_list.entry_count; i++, fabric.fabric_index = fabric.next)
+    {
+        ReturnErrorOnFailure(fabric.Load(mStorage));
+
+        GroupData group(fabric.fabric_index, fabric.first_group);
+        for (size_t j = 0; j < fabric.group_count; j++, group.group_id = group.next)
+        {
+            ReturnErrorOnFailure(group.Load(mStorage));
+
+            EndpointData endpoint(fabric.fabric_index, group.group_id, group.first_endpoint);
+            for (size_t k = 0; k < group.endpoint_count; k++, endpoint.endpoint_id = endpoint.next)
+            {
+                ReturnErrorOnFailure(endpoint.Load(mStorage));
+                VerifyOrReturnError(mEndpointIndexCount < ArraySize(mEndpointIndex), CHIP_ERROR_NO_MEMORY);
+
+                // Insert sorted by fabric and group, after the endpoints of the same group, to keep them in storage order.
+                IndexedGroupEndpoint entry;
+                entry.fabric_index = fabric.fabric_index;
+                entry.group_id     = group.group_id;
+                entry.endpoint_id  = endpoint.endpoint_id;
+
+                size_t pos = mEndpointIndexCount++;
+                for (; pos > 0 && IndexedGroupEndpoint::Less(entry, mEndpointIndex[pos - 1]); --pos)
+                {
+                    mEndpointIndex[pos] = mEndpointIndex[pos - 1];
+                }
+                mEndpointIndex[pos] = entry;
+            }
+        }
+    }
+    return CHIP_NO_ERROR;
+#else
+    return CHIP_ERROR_NOT_IMPLEMENTED;
+#endif // CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE > 0
+}
+
+void GroupDataProviderImpl::InvalidateEndpointIndex()
+{
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE > 0
+    mEndpointIndexCount = 0;
+    mEndpointIndexState = IndexState::kStale;
+    // Ends the iterators over the previous contents
+    mEndpointIndexGeneration++;
+#endif // CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE > 0
+}
+
+bool GroupDataProviderImpl::FindIndexedEndpoints(FabricIndex fabric_index, GroupId group_id, size_t & begin, size_t & end)
+{
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE > 0
+    VerifyOrReturnError(LoadEndpointIndex(), false);
+
+    IndexedGroupEndpoint key;
+    key.fabric_index = fabric_index;
+    key.group_id     = group_id;
+
+    const IndexedGroupEndpoint * first = mEndpointIndex;
+    const IndexedGroupEndpoint * last  = mEndpointIndex + mEndpointIndexCount;
+    const auto range                   = std::equal_range(first, last, key, IndexedGroupEndpoint::Less);
+    begin                              = static_cast<size_t>(range.first - first);
+    end                                = static_cast<size_t>(range.second - first);
+    return true;
+#else
+    return false;
+#endif // CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE > 0
+}
+
 void GroupDataProviderImpl::GroupKeyContext::Release()
 {
     ReleaseKeys();
@@ -1843,8 +2144,27 @@ GroupDataProviderImpl::GroupSessionIterator * GroupDataProviderImpl::IterateGrou
 }
 
 GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupDataProviderImpl & provider, uint16_t session_id) :
-    mProvider(provider), mSessionId(session_id), mGroupKeyContext(provider)
+    mProvider(provider), mSessionId(session_id),
+    mGroupKeyContexts(MakeKeyContexts(provider, std::make_index_sequence<kLiveGroupSessionsMax>()))
 {
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE > 0
+    mIndexed = provider.LoadSessionIndex();
+    if (mIndexed)
+    {
+        const IndexedGroupSession * begin = provider.mSessionIndex;
+        const IndexedGroupSession * end   = begin + provider.mSessionIndexCount;
+        const IndexedGroupSession * first = std::lower_bound(
+            begin, end, session_id, [](const IndexedGroupSession & entry, uint16_t id) { return entry.session_id < id; });
+        const IndexedGroupSession * last = std::upper_bound(
+            first, end, session_id, [](uint16_t id, const IndexedGroupSession & entry) { return id < entry.session_id; });
+        mIndexBegin      = static_cast<size_t>(first - begin);
+        mIndexEnd        = static_cast<size_t>(last - begin);
+        mIndexPosition   = mIndexBegin;
+        mIndexGeneration = provider.mSessionIndexGeneration;
+        return;
+    }
+#endif // CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE > 0
+
     FabricList fabric_list;
     ReturnOnFailure(fabric_list.Load(provider.mStorage));
     mFirstFabric = fabric_list.first_entry;
@@ -1857,6 +2177,13 @@ GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupD
 
 size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 {
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE > 0
+    if (mIndexed)
+    {
+        return mIndexEnd - mIndexBegin;
+    }
+#endif // CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE > 0
+
     FabricData fabric(mFirstFabric);
     size_t count = 0;
 
@@ -1898,6 +2225,19 @@ size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 
 bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output)
 {
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE > 0
+    if (mIndexed)
+    {
+        // The mappings or key sets changed since the iterator was created.
+        VerifyOrReturnError(mIndexGeneration == mProvider.mSessionIndexGeneration, false);
+        VerifyOrReturnError(mIndexPosition < mIndexEnd, false);
+
+        const IndexedGroupSession & entry = mProvider.mSessionIndex[mIndexPosition++];
+        SetSession(output, entry.fabric_index, entry.group_id, entry.security_policy, entry.encryption_key, entry.privacy_key);
+        return true;
+    }
+#endif // CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE > 0
+
     while (mFabricCount < mFabricTotal)
     {
         FabricData fabric(mFabric);
@@ -1938,11 +2278,7 @@ bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output
         Crypto::GroupOperationalCredentials & creds = keyset.operational_keys[mKeyIndex++];
         if (creds.hash == mSessionId)
         {
-            mGroupKeyContext.Initialize(creds.encryption_key, mSessionId, creds.privacy_key);
-            output.fabric_index    = fabric.fabric_index;
-            output.group_id        = mapping.group_id;
-            output.security_policy = keyset.policy;
-            output.keyContext      = &mGroupKeyContext;
+            SetSession(output, fabric.fabric_index, mapping.group_id, keyset.policy, creds.encryption_key, creds.privacy_key);
             return true;
         }
     }
@@ -1950,9 +2286,26 @@ bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output
     return false;
 }
 
+void GroupDataProviderImpl::GroupSessionIteratorImpl::SetSession(GroupSession & output, FabricIndex fabric_index,
+                                                                 GroupId group_id, SecurityPolicy policy,
+                                                                 const Crypto::Symmetric128BitsKeyByteArray & encryptionKey,
+                                                                 const Crypto::Symmetric128BitsKeyByteArray & privacyKey)
+{
+    GroupKeyContext & keyContext = mGroupKeyContexts[mNextKeyContext];
+    mNextKeyContext              = (mNextKeyContext + 1) % mGroupKeyContexts.size();
+    keyContext.Initialize(encryptionKey, mSessionId, privacyKey);
+    output.fabric_index    = fabric_index;
+    output.group_id        = group_id;
+    output.security_policy = policy;
+    output.keyContext      = &keyContext;
+}
+
 void GroupDataProviderImpl::GroupSessionIteratorImpl::Release()
 {
-    mGroupKeyContext.ReleaseKeys();
+    for (auto & keyContext : mGroupKeyContexts)
+    {
+        keyContext.ReleaseKeys();
+    }
     mProvider.mGroupSessionsIterator.ReleaseObject(this);
 }
 
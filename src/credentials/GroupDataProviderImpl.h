@@ -21,13 +21,18 @@
 #include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/support/Pool.h>
 
+#include <array>
+#include <utility>
+
 namespace chip {
 namespace Credentials {
 
 class GroupDataProviderImpl : public GroupDataProvider
 {
 public:
-    static constexpr size_t kIteratorsMax = CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS;
+    static constexpr size_t kIteratorsMax        = CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS;
+    static constexpr size_t kLiveGroupSessionsMax = CHIP_CONFIG_GROUP_TRIAL_DECRYPTION_BATCH_SIZE;
+    static_assert(kLiveGroupSessionsMax >= 1, "At least the last group session must stay usable");
 
     GroupDataProviderImpl() = default;
     GroupDataProviderImpl(uint16_t maxGroupsPerFabric, uint16_t maxGroupKeysPerFabric) :
@@ -96,6 +101,7 @@ public:
     // Decryption
     Crypto::SymmetricKeyContext * GetKeyContext(FabricIndex fabric_index, GroupId group_id) override;
     GroupSessionIterator * IterateGroupSessions(uint16_t session_id) override;
+    size_t GetLiveGroupSessionCount() const override { return kLiveGroupSessionsMax; }
 
 protected:
     class GroupInfoIteratorImpl : public GroupInfoIterator
@@ -149,6 +155,14 @@ protected:
         size_t mEndpointIndex = 0;
         size_t mEndpointCount = 0;
         bool mFirstEndpoint   = true;
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE > 0
+        // Range of the provider's endpoint index matching the group, when iterating a single group over a usable index.
+        bool mIndexed             = false;
+        size_t mIndexBegin        = 0;
+        size_t mIndexEnd          = 0;
+        size_t mIndexPosition     = 0;
+        uint32_t mIndexGeneration = 0;
+#endif // CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE > 0
     };
 
     class GroupKeyContext : public Crypto::SymmetricKeyContext
@@ -193,6 +207,7 @@ protected:
                                   MutableByteSpan & ciphertext) const override;
         CHIP_ERROR MessageDecrypt(const ByteSpan & ciphertext, const ByteSpan & aad, const ByteSpan & nonce, const ByteSpan & mic,
                                   MutableByteSpan & plaintext) const override;
+        const Crypto::Aes128KeyHandle * GetMessageKeyHandle() const override { return &mEncryptionKey; }
         CHIP_ERROR PrivacyEncrypt(const ByteSpan & input, const ByteSpan & nonce, MutableByteSpan & output) const override;
         CHIP_ERROR PrivacyDecrypt(const ByteSpan & input, const ByteSpan & nonce, MutableByteSpan & output) const override;
 
@@ -241,10 +256,41 @@ protected:
         uint16_t mKeyIndex       = 0;
         uint16_t mKeyCount       = 0;
         bool mFirstMap           = true;
-        GroupKeyContext mGroupKeyContext;
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE > 0
+        // Range of the provider's session index matching mSessionId, when the index was usable.
+        bool mIndexed             = false;
+        size_t mIndexBegin        = 0;
+        size_t mIndexEnd          = 0;
+        size_t mIndexPosition     = 0;
+        uint32_t mIndexGeneration = 0;
+#endif // CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE > 0
+        // Used in turn, so that the sessions returned by the last kLiveGroupSessionsMax calls to Next() stay usable.
+        std::array<GroupKeyContext, kLiveGroupSessionsMax> mGroupKeyContexts;
+        size_t mNextKeyContext = 0;
+
+    private:
+        void SetSession(GroupSession & output, FabricIndex fabric_index, GroupId group_id, SecurityPolicy policy,
+                        const Crypto::Symmetric128BitsKeyByteArray & encryptionKey,
+                        const Crypto::Symmetric128BitsKeyByteArray & privacyKey);
+
+        template <size_t... Indices>
+        static std::array<GroupKeyContext, sizeof...(Indices)> MakeKeyContexts(GroupDataProviderImpl & provider,
+                                                                               std::index_sequence<Indices...>)
+        {
+            return { { (static_cast<void>(Indices), GroupKeyContext(provider))... } };
+        }
     };
     bool IsInitialized() { return (mStorage != nullptr); }
     CHIP_ERROR RemoveEndpoints(FabricIndex fabric_index, GroupId group_id);
+    CHIP_ERROR LoadIpkKeySet(FabricIndex fabric_index, KeySet & out_keyset);
+    void InvalidateIpkCache(FabricIndex fabric_index);
+    bool LoadSessionIndex();
+    CHIP_ERROR BuildSessionIndex();
+    void InvalidateSessionIndex();
+    bool LoadEndpointIndex();
+    CHIP_ERROR BuildEndpointIndex();
+    void InvalidateEndpointIndex();
+    bool FindIndexedEndpoints(FabricIndex fabric_index, GroupId group_id, size_t & begin, size_t & end);
 
     PersistentStorageDelegate * mStorage       = nullptr;
     Crypto::SessionKeystore * mSessionKeystore = nullptr;
@@ -254,6 +300,56 @@ protected:
     ObjectPool<KeySetIteratorImpl, kIteratorsMax> mKeySetIterators;
     ObjectPool<GroupSessionIteratorImpl, kIteratorsMax> mGroupSessionsIterator;
     ObjectPool<GroupKeyContext, kIteratorsMax> mGroupKeyContexPool;
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_CACHE_IPK
+    struct CachedIpkKeySet
+    {
+        FabricIndex fabric_index = kUndefinedFabricIndex;
+        KeySet keyset;
+    };
+    CachedIpkKeySet mIpkCache[CHIP_CONFIG_MAX_FABRICS];
+#endif // CHIP_CONFIG_GROUP_DATA_PROVIDER_CACHE_IPK
+    enum class IndexState : uint8_t
+    {
+        kStale,       // Rebuilt by the next lookup
+        kValid,       // Holds all the entries
+        kUnavailable, // Too many entries, or the storage could not be read: lookups read the storage until the next change
+    };
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE > 0
+    // The operational keys of all the group-key mappings, sorted by session id.  Rebuilt by the first lookup following a
+    // change of the mappings or key sets.
+    struct IndexedGroupSession
+    {
+        uint16_t session_id            = 0;
+        FabricIndex fabric_index       = kUndefinedFabricIndex;
+        GroupId group_id               = kUndefinedGroupId;
+        SecurityPolicy security_policy = SecurityPolicy::kTrustFirst;
+        Crypto::Symmetric128BitsKeyByteArray encryption_key;
+        Crypto::Symmetric128BitsKeyByteArray privacy_key;
+    };
+    IndexedGroupSession mSessionIndex[CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE];
+    size_t mSessionIndexCount        = 0;
+    uint32_t mSessionIndexGeneration = 0;
+    IndexState mSessionIndexState    = IndexState::kStale;
+#endif // CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE > 0
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE > 0
+    // The endpoints of all the groups, sorted by fabric and group, in storage order within a group.  Rebuilt by the first
+    // lookup following a change of the groups or their endpoints.
+    struct IndexedGroupEndpoint
+    {
+        FabricIndex fabric_index = kUndefinedFabricIndex;
+        GroupId group_id         = kUndefinedGroupId;
+        EndpointId endpoint_id   = kInvalidEndpointId;
+
+        static bool Less(const IndexedGroupEndpoint & a, const IndexedGroupEndpoint & b)
+        {
+            return a.fabric_index < b.fabric_index || (a.fabric_index == b.fabric_index && a.group_id < b.group_id);
+        }
+    };
+    IndexedGroupEndpoint mEndpointIndex[CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE];
+    size_t mEndpointIndexCount        = 0;
+    uint32_t mEndpointIndexGeneration = 0;
+    IndexState mEndpointIndexState    = IndexState::kStale;
+#endif // CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE > 0
 };
 
 } // namespace Credentials
@@ -28,6 +28,9 @@
 
 #include "PersistentStorageOpCertStore.h"
 
+#include <string.h>
+#include <utility>
+
 namespace chip {
 namespace Credentials {
 
@@ -205,7 +208,10 @@ bool PersistentStorageOpCertStore::HasCertificateForFabric(FabricIndex fabricInd
         }
     }
 
-    return StorageHasCertificate(mStorage, fabricIndex, element);
+    // TODO(#16958): need to actually read the cert to know if it's there, see StorageHasCertificate.
+    uint8_t placeHolderCertBuffer[kMaxCHIPCertLength];
+    MutableByteSpan placeHolderCertSpan{ placeHolderCertBuffer };
+    return LoadPersistedCertificate(fabricIndex, element, placeHolderCertSpan) == CHIP_NO_ERROR;
 }
 
 CHIP_ERROR PersistentStorageOpCertStore::AddNewTrustedRootCertForFabric(FabricIndex fabricIndex, const ByteSpan & rcac)
@@ -335,6 +341,9 @@ CHIP_ERROR PersistentStorageOpCertStore::CommitOpCertsForFabric(FabricIndex fabr
 
     // TODO: Handle transaction marking to revert partial certs at next boot if we get interrupted by reboot.
 
+    // Whatever the outcome, the persisted certs of the fabric are about to change.
+    InvalidateCachedCertificates(mPendingFabricIndex);
+
     // Start committing NOC first so we don't have dangling roots if one was added.
     ByteSpan pendingNocSpan{ mPendingNoc.Get(), mPendingNoc.AllocatedSize() };
     CHIP_ERROR nocErr = SaveCertToStorage(mStorage, mPendingFabricIndex, CertChainElement::kNoc, pendingNocSpan);
@@ -409,6 +418,7 @@ CHIP_ERROR PersistentStorageOpCertStore::RemoveOpCertsForFabric(FabricIndex fabr
 
     // Clear any pending state
     RevertPendingOpCerts();
+    InvalidateCachedCertificates(fabricIndex);
 
     // Remove all persisted certs for the given fabric, blindly
     CHIP_ERROR nocErr  = DeleteCertFromStorage(mStorage, fabricIndex, CertChainElement::kNoc);
@@ -491,7 +501,70 @@ CHIP_ERROR PersistentStorageOpCertStore::GetCertificate(FabricIndex fabricIndex,
     }
 
     // Not found in pending, let's look in persisted
+    return LoadPersistedCertificate(fabricIndex, element, outCertificate);
+}
+
+CHIP_ERROR PersistentStorageOpCertStore::LoadPersistedCertificate(FabricIndex fabricIndex, CertChainElement element,
+                                                                  MutableByteSpan & outCertificate) const
+{
+#if CHIP_CONFIG_OP_CERT_STORE_CACHE_SIZE > 0
+    CachedCertificate * victim = &mCachedCertificates[0];
+    for (auto & entry : mCachedCertificates)
+    {
+        if (entry.fabricIndex == fabricIndex && entry.element == element)
+        {
+            entry.lastUse = ++mCacheUseCount;
+            if (entry.certificate.Get() == nullptr)
+            {
+                // Only absent ICACs are recorded.
+                outCertificate.reduce_size(0);
+                return CHIP_ERROR_NOT_FOUND;
+            }
+            return CopySpanToMutableSpan(ByteSpan{ entry.certificate.Get(), entry.certificate.AllocatedSize() }, outCertificate);
+        }
+
+        // Free entries first, then the least recently used one.
+        if (victim->fabricIndex != kUndefinedFabricIndex &&
+            (entry.fabricIndex == kUndefinedFabricIndex || entry.lastUse < victim->lastUse))
+        {
+            victim = &entry;
+        }
+    }
+
+    CHIP_ERROR err = LoadCertFromStorage(mStorage, fabricIndex, element, outCertificate);
+    bool missingIcac = (element == CertChainElement::kIcac) && (err == CHIP_ERROR_NOT_FOUND);
+    VerifyOrReturnError(err == CHIP_NO_ERROR || missingIcac, err);
+
+    Platform::ScopedMemoryBufferWithSize<uint8_t> certificate;
+    if (!missingIcac)
+    {
+        // Without memory for it, the certificate is just not cached.
+        VerifyOrReturnError(certificate.Alloc(outCertificate.size()), err);
+        memcpy(certificate.Get(), outCertificate.data(), outCertificate.size());
+    }
+
+    victim->fabricIndex = fabricIndex;
+    victim->element     = element;
+    victim->lastUse     = ++mCacheUseCount;
+    victim->certificate = std::move(certificate);
+    return err;
+#else
     return LoadCertFromStorage(mStorage, fabricIndex, element, outCertificate);
+#endif // CHIP_CONFIG_OP_CERT_STORE_CACHE_SIZE > 0
+}
+
+void PersistentStorageOpCertStore::InvalidateCachedCertificates(FabricIndex fabricIndex)
+{
+#if CHIP_CONFIG_OP_CERT_STORE_CACHE_SIZE > 0
+    for (auto & entry : mCachedCertificates)
+    {
+        if (fabricIndex == kUndefinedFabricIndex || entry.fabricIndex == fabricIndex)
+        {
+            entry.fabricIndex = kUndefinedFabricIndex;
+            entry.certificate.Free();
+        }
+    }
+#endif // CHIP_CONFIG_OP_CERT_STORE_CACHE_SIZE > 0
 }
 
 } // namespace Credentials
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/CHIPError.h>
 #include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/core/DataModelTypes.h>
@@ -57,6 +58,7 @@ public:
     {
         VerifyOrReturnError(mStorage == nullptr, CHIP_ERROR_INCORRECT_STATE);
         RevertPendingOpCerts();
+        InvalidateCachedCertificates(kUndefinedFabricIndex);
         mStorage = storage;
         return CHIP_NO_ERROR;
     }
@@ -69,6 +71,7 @@ public:
         VerifyOrReturn(mStorage != nullptr);
 
         RevertPendingOpCerts();
+        InvalidateCachedCertificates(kUndefinedFabricIndex);
         mStorage = nullptr;
     }
 
@@ -124,6 +127,12 @@ protected:
     // Returns true if any pending or persisted state exists for the fabricIndex, false if nothing at all is found.
     bool HasAnyCertificateForFabric(FabricIndex fabricIndex) const;
 
+    // Returns the persisted certificate, from the cache if it is there, with the errors of reading it from storage.
+    CHIP_ERROR LoadPersistedCertificate(FabricIndex fabricIndex, CertChainElement element, MutableByteSpan & outCertificate) const;
+
+    // Drops the cached certificates of the fabric, or of all fabrics for kUndefinedFabricIndex.
+    void InvalidateCachedCertificates(FabricIndex fabricIndex);
+
     PersistentStorageDelegate * mStorage = nullptr;
 
     // This pending fabric index is `kUndefinedFabricIndex` if there are no pending certs at all for the fabric
@@ -134,6 +143,21 @@ protected:
     Platform::ScopedMemoryBufferWithSize<uint8_t> mPendingNoc;
 
     BitFlags<StateFlags> mStateFlags;
+
+#if CHIP_CONFIG_OP_CERT_STORE_CACHE_SIZE > 0
+    // Copy of a persisted certificate.  An ICAC entry without a certificate records that the fabric has no ICAC.
+    struct CachedCertificate
+    {
+        FabricIndex fabricIndex  = kUndefinedFabricIndex;
+        CertChainElement element = CertChainElement::kRcac;
+        uint32_t lastUse         = 0;
+        Platform::ScopedMemoryBufferWithSize<uint8_t> certificate;
+    };
+
+    // Filled by the const getters.
+    mutable CachedCertificate mCachedCertificates[CHIP_CONFIG_OP_CERT_STORE_CACHE_SIZE];
+    mutable uint32_t mCacheUseCount = 0;
+#endif // CHIP_CONFIG_OP_CERT_STORE_CACHE_SIZE > 0
 };
 
 } // namespace Credentials
@@ -26,6 +26,7 @@
 
 #include <lib/core/CHIPError.h>
 #include <lib/core/Global.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/ScopedBuffer.h>
 #include <lib/support/Span.h>
@@ -313,6 +314,8 @@ AttestationVerificationResult MapError(CertificateChainValidationResult certific
 void DefaultDACVerifier::VerifyAttestationInformation(const DeviceAttestationVerifier::AttestationInfo & info,
                                                       Callback::Callback<OnAttestationInformationVerification> * onCompletion)
 {
+    CHIP_MEMORY_TAG_SCOPE(kCredentials);
+
     AttestationVerificationResult attestationError = AttestationVerificationResult::kSuccess;
 
     Platform::ScopedMemoryBuffer<uint8_t> paaCert;
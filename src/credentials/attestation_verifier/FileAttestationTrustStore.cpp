@@ -17,6 +17,8 @@
 #include "FileAttestationTrustStore.h"
 
 #include <crypto/CHIPCryptoPAL.h>
+
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <string>
@@ -48,6 +50,7 @@ FileAttestationTrustStore::FileAttestationTrustStore(const char * paaTrustStoreP
     {
         mPAADerCerts = LoadAllX509DerCerts(paaTrustStorePath);
         VerifyOrReturn(paaCount());
+        BuildIndex();
     }
 
     mIsInitialized = true;
@@ -138,8 +141,30 @@ FileAttestationTrustStore::~FileAttestationTrustStore()
     Cleanup();
 }
 
+void FileAttestationTrustStore::BuildIndex()
+{
+    mPAAIndex.clear();
+    mPAAIndex.reserve(mPAADerCerts.size());
+    for (size_t i = 0; i < mPAADerCerts.size(); i++)
+    {
+        Skid skid;
+        MutableByteSpan skidSpan{ skid };
+        const auto & candidate = mPAADerCerts[i];
+        if (CHIP_NO_ERROR == Crypto::ExtractSKIDFromX509Cert(ByteSpan{ candidate.data(), candidate.size() }, skidSpan) &&
+            skidSpan.size() == skid.size())
+        {
+            mPAAIndex.emplace_back(skid, i);
+        }
+    }
+
+    // Stable, so that the first loaded certificate keeps winning among those with the same SKID.
+    std::stable_sort(mPAAIndex.begin(), mPAAIndex.end(),
+                     [](const auto & a, const auto & b) { return a.first < b.first; });
+}
+
 void FileAttestationTrustStore::Cleanup()
 {
+    mPAAIndex.clear();
     mPAADerCerts.clear();
     mIsInitialized = false;
 }
@@ -158,7 +183,20 @@ CHIP_ERROR FileAttestationTrustStore::GetProductAttestationAuthorityCert(const B
     VerifyOrReturnError(!skid.empty() && (skid.data() != nullptr), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(skid.size() == Crypto::kSubjectKeyIdentifierLength, CHIP_ERROR_INVALID_ARGUMENT);
 
-    for (auto candidate : mPAADerCerts)
+    Skid key;
+    memcpy(key.data(), skid.data(), key.size());
+    auto entry = std::lower_bound(mPAAIndex.begin(), mPAAIndex.end(), key,
+                                  [](const auto & indexEntry, const Skid & value) { return indexEntry.first < value; });
+    if (entry != mPAAIndex.end() && entry->first == key && entry->second < mPAADerCerts.size())
+    {
+        const auto & candidate = mPAADerCerts[entry->second];
+        return CopySpanToMutableSpan(ByteSpan{ candidate.data(), candidate.size() }, outPaaDerBuffer);
+    }
+
+    // Certificates not loaded by the constructor are not indexed.
+    VerifyOrReturnError(mPAAIndex.size() != mPAADerCerts.size(), CHIP_ERROR_CA_CERT_NOT_FOUND);
+
+    for (const auto & candidate : mPAADerCerts)
     {
         uint8_t skidBuf[Crypto::kSubjectKeyIdentifierLength] = { 0 };
         MutableByteSpan candidateSkidSpan{ skidBuf };
@@ -18,8 +18,10 @@
 
 #include <credentials/CHIPCert.h>
 #include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
+#include <crypto/CHIPCryptoPAL.h>
 
 #include <array>
+#include <utility>
 #include <vector>
 
 namespace chip {
@@ -49,6 +51,12 @@ enum class CertificateValidationMode
 std::vector<std::vector<uint8_t>> LoadAllX509DerCerts(const char * trustStorePath,
                                                       CertificateValidationMode validationMode = CertificateValidationMode::kPAA);
 
+/**
+ * @brief Trust store of the PAA certificates found in a directory.
+ *
+ * The certificates are indexed by SKID when loaded, so that the lookups done for each attestation do not depend on the
+ * number of PAAs, which is in the hundreds for the full DCL set.
+ */
 class FileAttestationTrustStore : public AttestationTrustStore
 {
 public:
@@ -64,8 +72,13 @@ protected:
     std::vector<std::vector<uint8_t>> mPAADerCerts;
 
 private:
+    using Skid = std::array<uint8_t, Crypto::kSubjectKeyIdentifierLength>;
+
     bool mIsInitialized = false;
+    // Index in mPAADerCerts of each SKID, sorted by SKID, in load order for duplicate SKIDs.
+    std::vector<std::pair<Skid, size_t>> mPAAIndex;
 
+    void BuildIndex();
     void Cleanup();
 };
 
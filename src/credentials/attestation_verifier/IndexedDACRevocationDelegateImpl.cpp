@@ -0,0 +1,245 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <credentials/attestation_verifier/IndexedDACRevocationDelegateImpl.h>
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/support/Base64.h>
+#include <lib/support/BytesToHex.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <json/json.h>
+#include <string>
+
+using namespace chip::Crypto;
+
+namespace chip {
+namespace Credentials {
+
+namespace {
+
+void StripLeadingZeros(std::vector<uint8_t> & bytes)
+{
+    bytes.erase(bytes.begin(), std::find_if(bytes.begin(), bytes.end(), [](uint8_t byte) { return byte != 0; }));
+}
+
+CHIP_ERROR DecodeHexString(const Json::Value & value, std::vector<uint8_t> & outBytes)
+{
+    VerifyOrReturnError(value.isString(), CHIP_ERROR_INVALID_ARGUMENT);
+    std::string hex = value.asString();
+    VerifyOrReturnError(!hex.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // generate-revocation-set.py formats serial numbers as integers, without a leading zero nibble.
+    if (hex.size() % 2 != 0)
+    {
+        hex.insert(hex.begin(), '0');
+    }
+
+    outBytes.resize(hex.size() / 2);
+    VerifyOrReturnError(Encoding::HexToBytes(hex.data(), hex.size(), outBytes.data(), outBytes.size()) == outBytes.size(),
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DecodeBase64String(const Json::Value & value, std::vector<uint8_t> & outBytes)
+{
+    VerifyOrReturnError(value.isString(), CHIP_ERROR_INVALID_ARGUMENT);
+    std::string base64 = value.asString();
+    VerifyOrReturnError(!base64.empty() && base64.size() <= UINT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+
+    outBytes.resize(BASE64_MAX_DECODED_LEN(base64.size()));
+    uint16_t decodedLen = Base64Decode(base64.data(), static_cast<uint16_t>(base64.size()), outBytes.data());
+    VerifyOrReturnError(decodedLen != UINT16_MAX && decodedLen > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    outBytes.resize(decodedLen);
+    return CHIP_NO_ERROR;
+}
+
+} // anonymous namespace
+
+CHIP_ERROR IndexedDACRevocationDelegateImpl::LoadRevocationSet(std::string_view path)
+{
+    RevocationSet entries;
+    ReturnErrorOnFailure(ParseRevocationSet(path, entries));
+
+    RevocationSet revocationSet;
+    Merge(revocationSet, std::move(entries));
+    mRevocationSet = std::move(revocationSet);
+
+    ChipLogProgress(NotSpecified, "Loaded %u revoked serial numbers of %u issuers",
+                    static_cast<unsigned>(GetRevokedSerialNumberCount()), static_cast<unsigned>(mRevocationSet.size()));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR IndexedDACRevocationDelegateImpl::MergeRevocationSet(std::string_view path)
+{
+    RevocationSet entries;
+    ReturnErrorOnFailure(ParseRevocationSet(path, entries));
+    Merge(mRevocationSet, std::move(entries));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR IndexedDACRevocationDelegateImpl::AddRevokedSerialNumbers(const ByteSpan & akid, const ByteSpan & issuerName,
+                                                                     const Span<const ByteSpan> & serialNumbers)
+{
+    VerifyOrReturnError(akid.size() == kAuthorityKeyIdentifierLength, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!issuerName.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    RevocationSet entries;
+    auto & serials = entries[Issuer(Bytes(akid.begin(), akid.end()), Bytes(issuerName.begin(), issuerName.end()))];
+    for (const ByteSpan & serialNumber : serialNumbers)
+    {
+        serials.emplace_back(serialNumber.begin(), serialNumber.end());
+        StripLeadingZeros(serials.back());
+    }
+
+    Merge(mRevocationSet, std::move(entries));
+    return CHIP_NO_ERROR;
+}
+
+size_t IndexedDACRevocationDelegateImpl::GetRevokedSerialNumberCount() const
+{
+    size_t count = 0;
+    for (const auto & entry : mRevocationSet)
+    {
+        count += entry.second.size();
+    }
+    return count;
+}
+
+// The file holds the JSON array documented in TestDACRevocationDelegateImpl.cpp, with serial numbers as uppercase hex.
+CHIP_ERROR IndexedDACRevocationDelegateImpl::ParseRevocationSet(std::string_view path, RevocationSet & outRevocationSet)
+{
+    std::string pathStr(path);
+    std::ifstream file(pathStr);
+    if (!file.is_open())
+    {
+        ChipLogError(NotSpecified, "Failed to open file: %s", pathStr.c_str());
+        return CHIP_ERROR_OPEN_FAILED;
+    }
+
+    Json::CharReaderBuilder readerBuilder;
+    Json::Value jsonData;
+    std::string errs;
+
+    if (!Json::parseFromStream(readerBuilder, file, &jsonData, &errs) || !jsonData.isArray())
+    {
+        ChipLogError(NotSpecified, "Failed to parse JSON: %s", errs.c_str());
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+
+    for (const auto & revokedSet : jsonData)
+    {
+        VerifyOrReturnError(revokedSet.isObject(), CHIP_ERROR_INVALID_ARGUMENT);
+        if (!revokedSet["type"].isString() || revokedSet["type"].asString() != "revocation_set")
+        {
+            continue;
+        }
+
+        Issuer issuer;
+        ReturnErrorOnFailure(DecodeHexString(revokedSet["issuer_subject_key_id"], issuer.first));
+        VerifyOrReturnError(issuer.first.size() == kAuthorityKeyIdentifierLength, CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(DecodeBase64String(revokedSet["issuer_name"], issuer.second));
+
+        const Json::Value & revokedSerialNumbers = revokedSet["revoked_serial_numbers"];
+        VerifyOrReturnError(revokedSerialNumbers.isArray(), CHIP_ERROR_INVALID_ARGUMENT);
+
+        auto & serials = outRevocationSet[std::move(issuer)];
+        for (const auto & revokedSerialNumber : revokedSerialNumbers)
+        {
+            Bytes serial;
+            ReturnErrorOnFailure(DecodeHexString(revokedSerialNumber, serial));
+            VerifyOrReturnError(serial.size() <= kMaxCertificateSerialNumberLength + 1, CHIP_ERROR_INVALID_ARGUMENT);
+            StripLeadingZeros(serial);
+            serials.push_back(std::move(serial));
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void IndexedDACRevocationDelegateImpl::Merge(RevocationSet & revocationSet, RevocationSet && entries)
+{
+    // Only the serial numbers of the issuers with new entries are sorted again.
+    for (auto & entry : entries)
+    {
+        auto & serials = revocationSet[entry.first];
+        serials.insert(serials.end(), std::make_move_iterator(entry.second.begin()), std::make_move_iterator(entry.second.end()));
+        std::sort(serials.begin(), serials.end());
+        serials.erase(std::unique(serials.begin(), serials.end()), serials.end());
+    }
+}
+
+bool IndexedDACRevocationDelegateImpl::IsCertificateRevoked(const ByteSpan & certDer) const
+{
+    uint8_t akidBuf[kAuthorityKeyIdentifierLength];
+    uint8_t issuerBuf[kMaxCertificateDistinguishedNameLength];
+    uint8_t serialNumberBuf[kMaxCertificateSerialNumberLength];
+
+    MutableByteSpan akid(akidBuf);
+    MutableByteSpan issuer(issuerBuf);
+    MutableByteSpan serialNumber(serialNumberBuf);
+
+    VerifyOrReturnValue(CHIP_NO_ERROR == ExtractAKIDFromX509Cert(certDer, akid), false);
+    VerifyOrReturnValue(CHIP_NO_ERROR == ExtractIssuerFromX509Cert(certDer, issuer), false);
+    VerifyOrReturnValue(CHIP_NO_ERROR == ExtractSerialNumberFromX509Cert(certDer, serialNumber), false);
+
+    auto entry = mRevocationSet.find(Issuer(Bytes(akid.begin(), akid.end()), Bytes(issuer.begin(), issuer.end())));
+    VerifyOrReturnValue(entry != mRevocationSet.end(), false);
+
+    Bytes serial(serialNumber.begin(), serialNumber.end());
+    StripLeadingZeros(serial);
+    return std::binary_search(entry->second.begin(), entry->second.end(), serial);
+}
+
+void IndexedDACRevocationDelegateImpl::CheckForRevokedDACChain(
+    const DeviceAttestationVerifier::AttestationInfo & info,
+    Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> * onCompletion)
+{
+    AttestationVerificationResult attestationError = AttestationVerificationResult::kSuccess;
+
+    // TODO: Cross-validate the CRLSignerCertificate and CRLSignerDelegator per spec: #34587
+    bool dacRevoked = IsCertificateRevoked(info.dacDerBuffer);
+    bool paiRevoked = IsCertificateRevoked(info.paiDerBuffer);
+
+    if (dacRevoked && paiRevoked)
+    {
+        attestationError = AttestationVerificationResult::kPaiAndDacRevoked;
+    }
+    else if (dacRevoked)
+    {
+        attestationError = AttestationVerificationResult::kDacRevoked;
+    }
+    else if (paiRevoked)
+    {
+        attestationError = AttestationVerificationResult::kPaiRevoked;
+    }
+
+    if (attestationError != AttestationVerificationResult::kSuccess)
+    {
+        ChipLogProgress(NotSpecified, "Found revoked certificates in the DAC chain");
+    }
+
+    onCompletion->mCall(onCompletion->mContext, info, attestationError);
+}
+
+} // namespace Credentials
+} // namespace chip
@@ -0,0 +1,90 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
+#include <lib/support/Span.h>
+
+#include <map>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace chip {
+namespace Credentials {
+
+/**
+ * @brief Revocation delegate keeping the revocation set in memory, indexed by issuer, for commissioners checking
+ *        attestations against the full DCL revocation set.
+ *
+ * Unlike TestDACRevocationDelegateImpl, which parses the revocation set file for every certificate it checks, the
+ * revocation set is parsed once, into a sorted array of revoked serial numbers per issuer AKID and name, so that checks
+ * do not depend on its size.  Revocation sets of the JSON format generated by credentials/generate-revocation-set.py
+ * can be merged into the loaded one, to apply incremental updates without loading the whole set again.
+ *
+ * Serial numbers are compared as integers: the leading zero bytes of DER serial numbers, and the leading zero nibbles the
+ * JSON hex strings may lack, do not matter.
+ */
+class IndexedDACRevocationDelegateImpl : public DeviceAttestationRevocationDelegate
+{
+public:
+    /**
+     * Replace the revocation set with the one of the given JSON file.  On failure, the revocation set is left unchanged.
+     */
+    CHIP_ERROR LoadRevocationSet(std::string_view path);
+
+    /**
+     * Add the entries of the given JSON file, typically the ones revoked since the last update, to the revocation set.
+     * On failure, the revocation set is left unchanged.
+     */
+    CHIP_ERROR MergeRevocationSet(std::string_view path);
+
+    /**
+     * Add the serial numbers of revoked certificates of the given issuer to the revocation set.
+     *
+     * @param[in] akid           Authority key identifier of the certificates.
+     * @param[in] issuerName     DER encoded issuer name of the certificates.
+     * @param[in] serialNumbers  Big endian serial numbers of the certificates.
+     */
+    CHIP_ERROR AddRevokedSerialNumbers(const ByteSpan & akid, const ByteSpan & issuerName,
+                                       const Span<const ByteSpan> & serialNumbers);
+
+    void ClearRevocationSet() { mRevocationSet.clear(); }
+    size_t GetRevokedSerialNumberCount() const;
+
+    void CheckForRevokedDACChain(
+        const DeviceAttestationVerifier::AttestationInfo & info,
+        Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> * onCompletion) override;
+
+private:
+    using Bytes = std::vector<uint8_t>;
+    // AKID and DER encoded name of the issuer.
+    using Issuer = std::pair<Bytes, Bytes>;
+    // Sorted serial numbers without leading zero bytes, by issuer.
+    using RevocationSet = std::map<Issuer, std::vector<Bytes>>;
+
+    static CHIP_ERROR ParseRevocationSet(std::string_view path, RevocationSet & outRevocationSet);
+    static void Merge(RevocationSet & revocationSet, RevocationSet && entries);
+    bool IsCertificateRevoked(const ByteSpan & certDer) const;
+
+    RevocationSet mRevocationSet;
+};
+
+} // namespace Credentials
+} // namespace chip
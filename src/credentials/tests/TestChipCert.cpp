@@ -24,6 +24,9 @@
  *
  */
 
+#include <atomic>
+#include <thread>
+
 #include <pw_unit_test/framework.h>
 
 #include <credentials/CHIPCert.h>
@@ -1307,6 +1310,84 @@ TEST_F(TestChipCert, TestChipCert_DecodingOptions)
     EXPECT_EQ(err, CHIP_NO_ERROR);
 }
 
+TEST_F(TestChipCert, TestChipCert_SignatureCache)
+{
+    ByteSpan rootCert;
+    ByteSpan icaCert;
+    ChipCertificateData rootCertData;
+    ChipCertificateData icaCertData;
+
+    ClearCertSignatureCache();
+
+    EXPECT_EQ(GetTestCert(TestCert::kRoot01, sNullLoadFlag, rootCert), CHIP_NO_ERROR);
+    EXPECT_EQ(GetTestCert(TestCert::kICA01, sNullLoadFlag, icaCert), CHIP_NO_ERROR);
+    EXPECT_EQ(DecodeChipCert(rootCert, rootCertData, CertDecodeFlags::kGenerateTBSHash), CHIP_NO_ERROR);
+    EXPECT_EQ(DecodeChipCert(icaCert, icaCertData, CertDecodeFlags::kGenerateTBSHash), CHIP_NO_ERROR);
+
+    // Verifying the same signature again is served from the cache and gives the same result.
+    EXPECT_EQ(VerifyCertSignature(icaCertData, rootCertData), CHIP_NO_ERROR);
+    EXPECT_EQ(VerifyCertSignature(icaCertData, rootCertData), CHIP_NO_ERROR);
+
+    // A cached success must not leak to a different signer or a different TBS hash.
+    EXPECT_NE(VerifyCertSignature(icaCertData, icaCertData), CHIP_NO_ERROR);
+    icaCertData.mTBSHash[0] ^= 0x01;
+    EXPECT_NE(VerifyCertSignature(icaCertData, rootCertData), CHIP_NO_ERROR);
+    icaCertData.mTBSHash[0] ^= 0x01;
+
+    ClearCertSignatureCache();
+    EXPECT_EQ(VerifyCertSignature(icaCertData, rootCertData), CHIP_NO_ERROR);
+}
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+TEST_F(TestChipCert, TestChipCert_SignatureCacheConcurrentVerification)
+{
+    static constexpr int kIterations = 50;
+
+    ByteSpan rootCert;
+    ByteSpan icaCert;
+    ChipCertificateData rootCertData;
+    ChipCertificateData icaCertData;
+    ChipCertificateData tamperedCertData;
+
+    ClearCertSignatureCache();
+
+    EXPECT_EQ(GetTestCert(TestCert::kRoot01, sNullLoadFlag, rootCert), CHIP_NO_ERROR);
+    EXPECT_EQ(GetTestCert(TestCert::kICA01, sNullLoadFlag, icaCert), CHIP_NO_ERROR);
+    EXPECT_EQ(DecodeChipCert(rootCert, rootCertData, CertDecodeFlags::kGenerateTBSHash), CHIP_NO_ERROR);
+    EXPECT_EQ(DecodeChipCert(icaCert, icaCertData, CertDecodeFlags::kGenerateTBSHash), CHIP_NO_ERROR);
+    EXPECT_EQ(DecodeChipCert(icaCert, tamperedCertData, CertDecodeFlags::kGenerateTBSHash), CHIP_NO_ERROR);
+    tamperedCertData.mTBSHash[0] ^= 0x01;
+
+    // Like CASESession's Sigma3 background work, a second thread validates certificates while this
+    // thread keeps validating and clearing the cache.  No invalid signature may ever be reported as
+    // verified, and no valid one as failed.
+    std::atomic<int> wrongResults{ 0 };
+    auto verifyLoop = [&](bool clearCache) {
+        for (int i = 0; i < kIterations; i++)
+        {
+            if (VerifyCertSignature(icaCertData, rootCertData) != CHIP_NO_ERROR)
+            {
+                wrongResults++;
+            }
+            if (VerifyCertSignature(tamperedCertData, rootCertData) == CHIP_NO_ERROR)
+            {
+                wrongResults++;
+            }
+            if (clearCache)
+            {
+                ClearCertSignatureCache();
+            }
+        }
+    };
+
+    std::thread backgroundThread(verifyLoop, false);
+    verifyLoop(true);
+    backgroundThread.join();
+
+    EXPECT_EQ(wrongResults.load(), 0);
+}
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
 TEST_F(TestChipCert, TestChipCert_LoadDuplicateCerts)
 {
     CHIP_ERROR err;
@@ -25,6 +25,7 @@
 #include <credentials/DeviceAttestationCredsProvider.h>
 #include <credentials/attestation_verifier/DefaultDeviceAttestationVerifier.h>
 #include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
+#include <credentials/attestation_verifier/IndexedDACRevocationDelegateImpl.h>
 #include <credentials/attestation_verifier/TestDACRevocationDelegateImpl.h>
 #include <credentials/attestation_verifier/TestPAAStore.h>
 #include <credentials/examples/DeviceAttestationCredsExample.h>
@@ -573,3 +574,120 @@ TEST_F(TestDeviceAttestationCredentials, TestDACRevocationDelegateImpl)
     revocationDelegateImpl.CheckForRevokedDACChain(info, &attestationInformationVerificationCallback);
     EXPECT_EQ(attestationResult, AttestationVerificationResult::kSuccess);
 }
+
+TEST_F(TestDeviceAttestationCredentials, TestIndexedDACRevocationDelegateImpl)
+{
+    uint8_t attestationElementsTestVector[]  = { 0 };
+    uint8_t attestationChallengeTestVector[] = { 0 };
+    uint8_t attestationSignatureTestVector[] = { 0 };
+    uint8_t attestationNonceTestVector[]     = { 0 };
+
+    // Same DAC and PAI as in TestDACRevocationDelegateImpl
+    Credentials::DeviceAttestationVerifier::AttestationInfo info(
+        ByteSpan(attestationElementsTestVector), ByteSpan(attestationChallengeTestVector), ByteSpan(attestationSignatureTestVector),
+        TestCerts::sTestCert_PAI_FFF1_8000_Cert, TestCerts::sTestCert_DAC_FFF1_8000_0004_Cert, ByteSpan(attestationNonceTestVector),
+        static_cast<VendorId>(0xFFF1), 0x8000);
+
+    AttestationVerificationResult attestationResult = AttestationVerificationResult::kNotImplemented;
+
+    Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> attestationInformationVerificationCallback(
+        OnAttestationInformationVerificationCallback, &attestationResult);
+
+    IndexedDACRevocationDelegateImpl revocationDelegateImpl;
+
+    // Test without revocation set
+    revocationDelegateImpl.CheckForRevokedDACChain(info, &attestationInformationVerificationCallback);
+    EXPECT_EQ(attestationResult, AttestationVerificationResult::kSuccess);
+
+    // Test unreadable revocation sets are rejected
+    const char * tmpJsonFile = "/tmp/sample_indexed_revoked_set.json";
+    WriteTestRevokedData("", tmpJsonFile);
+    EXPECT_NE(revocationDelegateImpl.LoadRevocationSet(tmpJsonFile), CHIP_NO_ERROR);
+    EXPECT_NE(revocationDelegateImpl.LoadRevocationSet("/tmp/no_such_revoked_set.json"), CHIP_NO_ERROR);
+
+    // Test DAC is revoked, with the serial number formatted as an integer, like generate-revocation-set.py does
+    const char * jsonData = R"(
+    [{
+        "type": "revocation_set",
+        "issuer_subject_key_id": "AF42B7094DEBD515EC6ECF33B81115225F325288",
+        "issuer_name": "MEYxGDAWBgNVBAMMD01hdHRlciBUZXN0IFBBSTEUMBIGCisGAQQBgqJ8AgEMBEZGRjExFDASBgorBgEEAYKifAICDAQ4MDAw",
+        "revoked_serial_numbers": ["BC694F7F866067B1", "C694F7F866067B2"]
+    }]
+    )";
+    WriteTestRevokedData(jsonData, tmpJsonFile);
+    EXPECT_EQ(revocationDelegateImpl.LoadRevocationSet(tmpJsonFile), CHIP_NO_ERROR);
+    EXPECT_EQ(revocationDelegateImpl.GetRevokedSerialNumberCount(), 2u);
+    revocationDelegateImpl.CheckForRevokedDACChain(info, &attestationInformationVerificationCallback);
+    EXPECT_EQ(attestationResult, AttestationVerificationResult::kDacRevoked);
+
+    // Test a failed load keeps the revocation set
+    jsonData = R"(
+    [{
+        "type": "revocation_set",
+        "issuer_subject_key_id": "not hex",
+        "issuer_name": "MEYxGDAWBgNVBAMMD01hdHRlciBUZXN0IFBBSTEUMBIGCisGAQQBgqJ8AgEMBEZGRjExFDASBgorBgEEAYKifAICDAQ4MDAw",
+        "revoked_serial_numbers": []
+    }]
+    )";
+    WriteTestRevokedData(jsonData, tmpJsonFile);
+    EXPECT_NE(revocationDelegateImpl.LoadRevocationSet(tmpJsonFile), CHIP_NO_ERROR);
+    EXPECT_NE(revocationDelegateImpl.MergeRevocationSet(tmpJsonFile), CHIP_NO_ERROR);
+    EXPECT_EQ(revocationDelegateImpl.GetRevokedSerialNumberCount(), 2u);
+
+    // Test a delta revoking the PAI is merged with the loaded set
+    jsonData = R"(
+    [{
+        "type": "revocation_set",
+        "issuer_subject_key_id": "6AFD22771F511FECBF1641976710DCDC31A1717E",
+        "issuer_name": "MDAxGDAWBgNVBAMMD01hdHRlciBUZXN0IFBBQTEUMBIGCisGAQQBgqJ8AgEMBEZGRjE=",
+        "revoked_serial_numbers": ["3E6CE6509AD840CD"]
+    },
+    {
+        "type": "revocation_set",
+        "issuer_subject_key_id": "AF42B7094DEBD515EC6ECF33B81115225F325288",
+        "issuer_name": "MEYxGDAWBgNVBAMMD01hdHRlciBUZXN0IFBBSTEUMBIGCisGAQQBgqJ8AgEMBEZGRjExFDASBgorBgEEAYKifAICDAQ4MDAw",
+        "revoked_serial_numbers": ["0C694F7F866067B2"]
+    }]
+    )";
+    WriteTestRevokedData(jsonData, tmpJsonFile);
+    EXPECT_EQ(revocationDelegateImpl.MergeRevocationSet(tmpJsonFile), CHIP_NO_ERROR);
+    EXPECT_EQ(revocationDelegateImpl.GetRevokedSerialNumberCount(), 3u);
+    revocationDelegateImpl.CheckForRevokedDACChain(info, &attestationInformationVerificationCallback);
+    EXPECT_EQ(attestationResult, AttestationVerificationResult::kPaiAndDacRevoked);
+
+    // Test loading replaces the whole set
+    jsonData = R"(
+    [{
+        "type": "revocation_set",
+        "issuer_subject_key_id": "AF42B7094DEBD515EC6ECF33B81115225F325288",
+        "issuer_name": "MEYxGDAWBgNVBAMMD01hdHRlciBUZXN0IFBBSTEUMBIGCisGAQQBgqJ8AgEMBEZGRjExFDASBgorBgEEAYKifAICDAQ4MDAw",
+        "revoked_serial_numbers": ["0C694F7F866067B21234"]
+    }]
+    )";
+    WriteTestRevokedData(jsonData, tmpJsonFile);
+    EXPECT_EQ(revocationDelegateImpl.LoadRevocationSet(tmpJsonFile), CHIP_NO_ERROR);
+    revocationDelegateImpl.CheckForRevokedDACChain(info, &attestationInformationVerificationCallback);
+    EXPECT_EQ(attestationResult, AttestationVerificationResult::kSuccess);
+
+    // Test entries added from the certificate fields
+    uint8_t akidBuf[Crypto::kAuthorityKeyIdentifierLength];
+    uint8_t issuerBuf[Crypto::kMaxCertificateDistinguishedNameLength];
+    uint8_t serialNumberBuf[Crypto::kMaxCertificateSerialNumberLength];
+    MutableByteSpan akid(akidBuf);
+    MutableByteSpan issuer(issuerBuf);
+    MutableByteSpan serialNumber(serialNumberBuf);
+    ASSERT_EQ(Crypto::ExtractAKIDFromX509Cert(TestCerts::sTestCert_PAI_FFF1_8000_Cert, akid), CHIP_NO_ERROR);
+    ASSERT_EQ(Crypto::ExtractIssuerFromX509Cert(TestCerts::sTestCert_PAI_FFF1_8000_Cert, issuer), CHIP_NO_ERROR);
+    ASSERT_EQ(Crypto::ExtractSerialNumberFromX509Cert(TestCerts::sTestCert_PAI_FFF1_8000_Cert, serialNumber), CHIP_NO_ERROR);
+
+    const ByteSpan serialNumbers[] = { serialNumber };
+    EXPECT_EQ(revocationDelegateImpl.AddRevokedSerialNumbers(akid, issuer, Span<const ByteSpan>(serialNumbers)), CHIP_NO_ERROR);
+    EXPECT_EQ(revocationDelegateImpl.AddRevokedSerialNumbers(akid, issuer, Span<const ByteSpan>(serialNumbers)), CHIP_NO_ERROR);
+    EXPECT_EQ(revocationDelegateImpl.GetRevokedSerialNumberCount(), 2u);
+    revocationDelegateImpl.CheckForRevokedDACChain(info, &attestationInformationVerificationCallback);
+    EXPECT_EQ(attestationResult, AttestationVerificationResult::kPaiRevoked);
+
+    revocationDelegateImpl.ClearRevocationSet();
+    revocationDelegateImpl.CheckForRevokedDACChain(info, &attestationInformationVerificationCallback);
+    EXPECT_EQ(attestationResult, AttestationVerificationResult::kSuccess);
+}
@@ -38,6 +38,7 @@
 #include <crypto/PersistentStorageOperationalKeystore.h>
 #include <lib/asn1/ASN1.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
 #include <lib/support/TestPersistentStorageDelegate.h>
 
 #include <platform/ConfigurationManager.h>
@@ -2362,6 +2363,16 @@ TEST_F(TestFabricTable, TestFabricLookup)
         EXPECT_FALSE(fabricInfo->ShouldAdvertiseIdentity());
     }
 
+    // Same fabric ID, different roots: not the same logical fabric.
+    {
+        auto fabric1 = fabricTable.FindFabricWithIndex(1);
+        auto fabric2 = fabricTable.FindFabricWithIndex(2);
+        ASSERT_NE(fabric1, nullptr);
+        ASSERT_NE(fabric2, nullptr);
+        EXPECT_TRUE(fabric1->IsSameLogicalFabric(*fabric1));
+        EXPECT_FALSE(fabric1->IsSameLogicalFabric(*fabric2));
+    }
+
     // Attempt lookup of FabricIndex 0 --> should always fail.
     {
         EXPECT_EQ(fabricTable.FindFabricWithIndex(0), nullptr);
@@ -2457,6 +2468,25 @@ TEST_F(TestFabricTable, TestFetchCATs)
         EXPECT_EQ(cats, kUndefinedCATs);
     }
 
+    // The CATs are cached with the fabric: fetching them does not read the NOC back.
+    {
+        testStorage.AddPoisonKey(DefaultStorageKeyAllocator::FabricNOC(1).KeyName());
+        uint8_t nocBuf[kMaxCHIPCertLength];
+        MutableByteSpan nocSpan{ nocBuf };
+        EXPECT_NE(fabricTable.FetchNOCCert(1, nocSpan), CHIP_NO_ERROR);
+
+        CATValues cats;
+        EXPECT_EQ(fabricTable.FetchCATs(1, cats), CHIP_NO_ERROR);
+        EXPECT_EQ(cats, kUndefinedCATs);
+        testStorage.ClearPoisonKeys();
+    }
+
+    // Attempt Fetching CATs of a missing fabric.
+    {
+        CATValues cats;
+        EXPECT_EQ(fabricTable.FetchCATs(3, cats), CHIP_ERROR_INVALID_FABRIC_INDEX);
+    }
+
     // TODO(#20335): Add test cases for NOCs that actually embed CATs
 }
 
@@ -28,6 +28,7 @@
 #include <lib/core/StringBuilderAdapters.h>
 #include <lib/core/TLV.h>
 #include <lib/support/CHIPMem.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
 #include <lib/support/TestPersistentStorageDelegate.h>
 #include <platform/KeyValueStoreManager.h>
 
@@ -918,6 +919,12 @@ TEST_F(TestGroupDataProvider, TestIpk)
     EXPECT_EQ(SecurityPolicy::kTrustFirst, ipkOperationalKeySet.policy);
     EXPECT_EQ(ipkOperationalKeySet.epoch_keys[0].start_time, 0u); // default time is zero for SetSingleIpkEpochKey
     EXPECT_EQ(memcmp(ipkOperationalKeySet.epoch_keys[0].key, kExpectedIpkFromSpec, sizeof(kExpectedIpkFromSpec)), 0);
+
+    // Reading the IPK again must give the same result, and removing the fabric must drop it
+    EXPECT_EQ(provider->GetIpkKeySet(kFabric1, ipkOperationalKeySet), CHIP_NO_ERROR);
+    EXPECT_EQ(memcmp(ipkOperationalKeySet.epoch_keys[0].key, kExpectedIpkFromSpec, sizeof(kExpectedIpkFromSpec)), 0);
+    EXPECT_EQ(provider->RemoveFabric(kFabric1), CHIP_NO_ERROR);
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, provider->GetIpkKeySet(kFabric1, ipkOperationalKeySet));
 }
 
 TEST_F(TestGroupDataProvider, TestKeySetIterator)
@@ -1222,6 +1229,143 @@ TEST_F(TestGroupDataProvider, TestGroupDecryption)
     it->Release();
 }
 
+TEST_F(TestGroupDataProvider, TestGroupSessionIndex)
+{
+    GroupDataProvider * provider = GetGroupDataProvider();
+    EXPECT_TRUE(provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, kKeySet2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetKeySet(kFabric2, kCompressedFabricId2, kKeySet1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetKeySet(kFabric2, kCompressedFabricId2, kKeySet3), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 0, kGroup1Keyset2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric2, 0, kGroup2Keyset1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric2, 1, kGroup2Keyset3), CHIP_NO_ERROR);
+
+    Crypto::SymmetricKeyContext * key_context = provider->GetKeyContext(kFabric2, kGroup2);
+    ASSERT_NE(nullptr, key_context);
+    const uint16_t session_id = key_context->GetKeyHash();
+    key_context->Release();
+
+    auto sessions = [&]() {
+        std::set<std::pair<FabricIndex, GroupId>> found;
+        GroupSession session;
+        auto it = provider->IterateGroupSessions(session_id);
+        VerifyOrReturnValue(it != nullptr, found);
+        const size_t count = it->Count();
+        while (it->Next(session))
+        {
+            found.insert({ session.fabric_index, session.group_id });
+        }
+        it->Release();
+        EXPECT_EQ(count, found.size());
+        return found;
+    };
+
+    const std::set<std::pair<FabricIndex, GroupId>> expected = { { kFabric2, kGroup2 } };
+    EXPECT_EQ(sessions(), expected);
+
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE > 0
+    // Once indexed, the sessions are found without reading the storage
+    sDelegate.AddPoisonKey(DefaultStorageKeyAllocator::GroupFabricList().KeyName());
+    EXPECT_EQ(sessions(), expected);
+    sDelegate.ClearPoisonKeys();
+#endif
+
+    // The same epoch keys and compressed fabric id give the same operational keys, on another fabric
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId2, kKeySet1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 1, kGroup3Keyset1), CHIP_NO_ERROR);
+    const std::set<std::pair<FabricIndex, GroupId>> expected_both = { { kFabric1, kGroup3 }, { kFabric2, kGroup2 } };
+    EXPECT_EQ(sessions(), expected_both);
+
+    EXPECT_EQ(provider->RemoveGroupKeyAt(kFabric2, 0), CHIP_NO_ERROR);
+    const std::set<std::pair<FabricIndex, GroupId>> expected_fabric1 = { { kFabric1, kGroup3 } };
+    EXPECT_EQ(sessions(), expected_fabric1);
+
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE > 0
+    // Iterators created before a change end
+    GroupSession session;
+    auto it = provider->IterateGroupSessions(session_id);
+    ASSERT_NE(it, nullptr);
+    EXPECT_EQ(it->Count(), 1u);
+    EXPECT_EQ(provider->RemoveFabric(kFabric1), CHIP_NO_ERROR);
+    EXPECT_FALSE(it->Next(session));
+    it->Release();
+#else
+    EXPECT_EQ(provider->RemoveFabric(kFabric1), CHIP_NO_ERROR);
+#endif
+    EXPECT_TRUE(sessions().empty());
+}
+
+TEST_F(TestGroupDataProvider, TestGroupEndpointIndex)
+{
+    GroupDataProvider * provider = GetGroupDataProvider();
+    EXPECT_TRUE(provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    EXPECT_EQ(provider->AddEndpoint(kFabric1, kGroup2, kEndpointId1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->AddEndpoint(kFabric1, kGroup1, kEndpointId0), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->AddEndpoint(kFabric1, kGroup2, kEndpointId3), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->AddEndpoint(kFabric2, kGroup2, kEndpointId2), CHIP_NO_ERROR);
+
+    auto endpoints = [&](FabricIndex fabric_index, GroupId group_id) {
+        std::set<EndpointId> found;
+        GroupEndpoint output;
+        auto it = provider->IterateEndpoints(fabric_index, group_id);
+        VerifyOrReturnValue(it != nullptr, found);
+        const size_t count = it->Count();
+        while (it->Next(output))
+        {
+            EXPECT_EQ(output.group_id, group_id);
+            found.insert(output.endpoint_id);
+        }
+        it->Release();
+        EXPECT_EQ(count, found.size());
+        return found;
+    };
+
+    const std::set<EndpointId> expected_f1g2 = { kEndpointId1, kEndpointId3 };
+    const std::set<EndpointId> expected_f2g2 = { kEndpointId2 };
+    EXPECT_EQ(endpoints(kFabric1, kGroup2), expected_f1g2);
+    EXPECT_EQ(endpoints(kFabric2, kGroup2), expected_f2g2);
+    EXPECT_TRUE(provider->HasEndpoint(kFabric1, kGroup2, kEndpointId3));
+    EXPECT_FALSE(provider->HasEndpoint(kFabric1, kGroup2, kEndpointId2));
+    EXPECT_FALSE(provider->HasEndpoint(kFabric1, kGroup3, kEndpointId1));
+
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE > 0
+    // Once indexed, the endpoints are found without reading the storage
+    sDelegate.AddPoisonKey(DefaultStorageKeyAllocator::GroupFabricList().KeyName());
+    sDelegate.AddPoisonKey(DefaultStorageKeyAllocator::FabricGroups(kFabric1).KeyName());
+    EXPECT_EQ(endpoints(kFabric1, kGroup2), expected_f1g2);
+    EXPECT_TRUE(provider->HasEndpoint(kFabric1, kGroup1, kEndpointId0));
+    sDelegate.ClearPoisonKeys();
+#endif
+
+    EXPECT_EQ(provider->RemoveEndpoint(kFabric1, kGroup2, kEndpointId1), CHIP_NO_ERROR);
+    const std::set<EndpointId> expected_f1g2_removed = { kEndpointId3 };
+    EXPECT_EQ(endpoints(kFabric1, kGroup2), expected_f1g2_removed);
+    EXPECT_FALSE(provider->HasEndpoint(kFabric1, kGroup2, kEndpointId1));
+
+#if CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE > 0
+    // Iterators created before a change end
+    GroupEndpoint output;
+    auto it = provider->IterateEndpoints(kFabric2, kGroup2);
+    ASSERT_NE(it, nullptr);
+    EXPECT_EQ(it->Count(), 1u);
+    EXPECT_EQ(provider->RemoveFabric(kFabric2), CHIP_NO_ERROR);
+    EXPECT_FALSE(it->Next(output));
+    it->Release();
+#else
+    EXPECT_EQ(provider->RemoveFabric(kFabric2), CHIP_NO_ERROR);
+#endif
+    EXPECT_TRUE(endpoints(kFabric2, kGroup2).empty());
+    EXPECT_FALSE(provider->HasEndpoint(kFabric2, kGroup2, kEndpointId2));
+}
+
 } // namespace TestGroups
 } // namespace app
 } // namespace chip
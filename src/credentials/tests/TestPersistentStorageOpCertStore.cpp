@@ -842,4 +842,75 @@ TEST_F(TestPersistentStorageOpCertStore, TestRevertPendingOpCertsExceptRoot)
     opCertStore.Finish();
 }
 
+#if CHIP_CONFIG_OP_CERT_STORE_CACHE_SIZE > 0
+TEST_F(TestPersistentStorageOpCertStore, TestCachedCertificates)
+{
+    TestPersistentStorageDelegate storageDelegate;
+    PersistentStorageOpCertStore opCertStore;
+
+    uint8_t largeBuf[400];
+    MutableByteSpan largeSpan{ largeBuf };
+
+    EXPECT_EQ(opCertStore.Init(&storageDelegate), CHIP_NO_ERROR);
+    EXPECT_EQ(opCertStore.AddNewTrustedRootCertForFabric(kFabricIndex1, kTestRcacSpan), CHIP_NO_ERROR);
+    EXPECT_EQ(opCertStore.AddNewOpCertsForFabric(kFabricIndex1, kTestNocSpan, ByteSpan{}), CHIP_NO_ERROR);
+    EXPECT_EQ(opCertStore.CommitOpCertsForFabric(kFabricIndex1), CHIP_NO_ERROR);
+
+    // Read once to fill the cache, including the absence of ICAC
+    EXPECT_EQ(opCertStore.GetCertificate(kFabricIndex1, CertChainElement::kNoc, largeSpan), CHIP_NO_ERROR);
+    largeSpan = MutableByteSpan{ largeBuf };
+    EXPECT_EQ(opCertStore.GetCertificate(kFabricIndex1, CertChainElement::kIcac, largeSpan), CHIP_ERROR_NOT_FOUND);
+    EXPECT_TRUE(largeSpan.empty());
+
+    // Further reads do not touch the storage anymore
+    storageDelegate.AddPoisonKey(DefaultStorageKeyAllocator::FabricNOC(kFabricIndex1).KeyName());
+    storageDelegate.AddPoisonKey(DefaultStorageKeyAllocator::FabricICAC(kFabricIndex1).KeyName());
+
+    largeSpan = MutableByteSpan{ largeBuf };
+    EXPECT_EQ(opCertStore.GetCertificate(kFabricIndex1, CertChainElement::kNoc, largeSpan), CHIP_NO_ERROR);
+    EXPECT_TRUE(largeSpan.data_equal(kTestNocSpan));
+    EXPECT_TRUE(opCertStore.HasCertificateForFabric(kFabricIndex1, CertChainElement::kNoc));
+    largeSpan = MutableByteSpan{ largeBuf };
+    EXPECT_EQ(opCertStore.GetCertificate(kFabricIndex1, CertChainElement::kIcac, largeSpan), CHIP_ERROR_NOT_FOUND);
+    EXPECT_FALSE(opCertStore.HasCertificateForFabric(kFabricIndex1, CertChainElement::kIcac));
+
+    // Too small a buffer still fails
+    uint8_t smallBuf[1];
+    MutableByteSpan smallSpan{ smallBuf };
+    EXPECT_EQ(opCertStore.GetCertificate(kFabricIndex1, CertChainElement::kNoc, smallSpan), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    // Pending certs take precedence over the cached ones, and replace them once committed
+    storageDelegate.ClearPoisonKeys();
+    const uint8_t kTestNocBufUpdated[] = { 'n', 'e', 'w', ' ', 'n', 'o', 'c' };
+    EXPECT_EQ(opCertStore.UpdateOpCertsForFabric(kFabricIndex1, ByteSpan{ kTestNocBufUpdated }, kTestIcacSpan), CHIP_NO_ERROR);
+    largeSpan = MutableByteSpan{ largeBuf };
+    EXPECT_EQ(opCertStore.GetCertificate(kFabricIndex1, CertChainElement::kNoc, largeSpan), CHIP_NO_ERROR);
+    EXPECT_TRUE(largeSpan.data_equal(ByteSpan{ kTestNocBufUpdated }));
+    EXPECT_EQ(opCertStore.CommitOpCertsForFabric(kFabricIndex1), CHIP_NO_ERROR);
+
+    largeSpan = MutableByteSpan{ largeBuf };
+    EXPECT_EQ(opCertStore.GetCertificate(kFabricIndex1, CertChainElement::kNoc, largeSpan), CHIP_NO_ERROR);
+    EXPECT_TRUE(largeSpan.data_equal(ByteSpan{ kTestNocBufUpdated }));
+    largeSpan = MutableByteSpan{ largeBuf };
+    EXPECT_EQ(opCertStore.GetCertificate(kFabricIndex1, CertChainElement::kIcac, largeSpan), CHIP_NO_ERROR);
+    EXPECT_TRUE(largeSpan.data_equal(kTestIcacSpan));
+
+    // A reverted update leaves the cached certs alone
+    EXPECT_EQ(opCertStore.UpdateOpCertsForFabric(kFabricIndex1, kTestNocSpan, kTestIcacSpan), CHIP_NO_ERROR);
+    opCertStore.RevertPendingOpCerts();
+    largeSpan = MutableByteSpan{ largeBuf };
+    EXPECT_EQ(opCertStore.GetCertificate(kFabricIndex1, CertChainElement::kNoc, largeSpan), CHIP_NO_ERROR);
+    EXPECT_TRUE(largeSpan.data_equal(ByteSpan{ kTestNocBufUpdated }));
+
+    // Removal drops the cached certs
+    EXPECT_EQ(opCertStore.RemoveOpCertsForFabric(kFabricIndex1), CHIP_NO_ERROR);
+    largeSpan = MutableByteSpan{ largeBuf };
+    EXPECT_EQ(opCertStore.GetCertificate(kFabricIndex1, CertChainElement::kNoc, largeSpan), CHIP_ERROR_NOT_FOUND);
+    largeSpan = MutableByteSpan{ largeBuf };
+    EXPECT_EQ(opCertStore.GetCertificate(kFabricIndex1, CertChainElement::kRcac, largeSpan), CHIP_ERROR_NOT_FOUND);
+
+    opCertStore.Finish();
+}
+#endif // CHIP_CONFIG_OP_CERT_STORE_CACHE_SIZE > 0
+
 } // namespace
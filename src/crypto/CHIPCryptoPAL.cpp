@@ -785,6 +785,68 @@ CHIP_ERROR AES_CTR_crypt(const uint8_t * input, size_t input_length, const Aes12
     return AES_CCM_encrypt(input, input_length, nullptr, 0, key, nonce, nonce_length, output, tag, kTagLen);
 }
 
+CHIP_ERROR AES_CCM_decrypt_multi_key(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                     const uint8_t * tag, size_t tag_length, const Aes128KeyHandle * const * keys,
+                                     size_t key_count, const uint8_t * nonce, size_t nonce_length, uint8_t * plaintext,
+                                     size_t & key_index)
+{
+    VerifyOrReturnError(keys != nullptr || key_count == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext_length == 0 || (plaintext != nullptr && ciphertext != nullptr), CHIP_ERROR_INVALID_ARGUMENT);
+    // A failed attempt may leave garbage in the output, which must not clobber the input of the next one.
+    VerifyOrReturnError(ciphertext_length == 0 || plaintext + ciphertext_length <= ciphertext ||
+                            ciphertext + ciphertext_length <= plaintext,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    // None of the backends exposes a multi-key CCM primitive, so the candidates are tried in turn.
+    for (size_t i = 0; i < key_count; i++)
+    {
+        VerifyOrReturnError(keys[i] != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+        if (AES_CCM_decrypt(ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, *keys[i], nonce, nonce_length,
+                            plaintext) == CHIP_NO_ERROR)
+        {
+            key_index = i;
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    if (ciphertext_length > 0)
+    {
+        ClearSecretData(plaintext, ciphertext_length);
+    }
+    return CHIP_ERROR_INTEGRITY_CHECK_FAILED;
+}
+
+#if !(CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL || CHIP_CRYPTO_MBEDTLS)
+// PSA keeps the expanded key behind the key identifier already, and platform backends only provide the one-shot functions,
+// so the context only remembers the key.
+CHIP_ERROR Aes128CcmContext::Init(const Aes128KeyHandle & key)
+{
+    mKey = &key;
+    return CHIP_NO_ERROR;
+}
+
+void Aes128CcmContext::Release()
+{
+    mKey = nullptr;
+}
+
+CHIP_ERROR Aes128CcmContext::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                     const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag,
+                                     size_t tag_length)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    return AES_CCM_encrypt(plaintext, plaintext_length, aad, aad_length, *mKey, nonce, nonce_length, ciphertext, tag, tag_length);
+}
+
+CHIP_ERROR Aes128CcmContext::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                     const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                                     uint8_t * plaintext)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    return AES_CCM_decrypt(ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, *mKey, nonce, nonce_length, plaintext);
+}
+#endif // !(CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL || CHIP_CRYPTO_MBEDTLS)
+
 CHIP_ERROR GenerateCompressedFabricId(const Crypto::P256PublicKey & root_public_key, uint64_t fabric_id,
                                       MutableByteSpan & out_compressed_fabric_id)
 {
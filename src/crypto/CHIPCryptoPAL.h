@@ -786,6 +786,99 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
                            const uint8_t * tag, size_t tag_length, const Aes128KeyHandle & key, const uint8_t * nonce,
                            size_t nonce_length, uint8_t * plaintext);
 
+/**
+ * @brief AES-CCM decryption with the first of several candidate keys whose tag verifies
+ *
+ * Used for trial decryption when the key cannot be identified up front, e.g. for group
+ * messages whose session ID is shared by several operational group keys. Unlike repeated
+ * in-place AES_CCM_decrypt() calls, the ciphertext is left intact between attempts, so the
+ * caller does not need to restore it for each candidate. The plaintext buffer must therefore
+ * not overlap the ciphertext.
+ *
+ * @param ciphertext Ciphertext to decrypt
+ * @param ciphertext_length Length of ciphertext
+ * @param aad Additional authentical data.
+ * @param aad_length Length of additional authentication data
+ * @param tag Tag to use to decrypt
+ * @param tag_length Length of tag
+ * @param keys Candidate decryption keys, tried in order
+ * @param key_count Number of candidate keys
+ * @param nonce Encryption nonce
+ * @param nonce_length Length of encryption nonce
+ * @param plaintext Buffer to write plaintext into; cleared if no key verifies
+ * @param key_index Set to the index in keys of the key that verified
+ * @return CHIP_ERROR_INTEGRITY_CHECK_FAILED if no key verifies the tag, another CHIP_ERROR
+ *         on error, CHIP_NO_ERROR otherwise
+ **/
+CHIP_ERROR AES_CCM_decrypt_multi_key(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                     const uint8_t * tag, size_t tag_length, const Aes128KeyHandle * const * keys,
+                                     size_t key_count, const uint8_t * nonce, size_t nonce_length, uint8_t * plaintext,
+                                     size_t & key_index);
+
+/**
+ * @brief AES-CCM context bound to a single key, for encrypting or decrypting many messages with it.
+ *
+ * AES_CCM_encrypt() and AES_CCM_decrypt() set up the cipher and expand the key on every call. This
+ * context does that once in Init() and keeps the backend state until Release(), so that each message
+ * only pays for the nonce setup and the actual encryption. Backends that have nothing to cache fall
+ * back to the one-shot functions.
+ *
+ * The key handle passed to Init() must outlive the context, and the context must be released before
+ * the key is destroyed. A context must not be used from more than one thread at a time.
+ */
+class Aes128CcmContext
+{
+public:
+    Aes128CcmContext() = default;
+    ~Aes128CcmContext() { Release(); }
+
+    Aes128CcmContext(const Aes128CcmContext &)             = delete;
+    Aes128CcmContext & operator=(const Aes128CcmContext &) = delete;
+
+    /**
+     * @brief Bind the context to a key, releasing any previous state.
+     *
+     * @return CHIP_ERROR_NO_MEMORY or CHIP_ERROR_INTERNAL if the cipher state cannot be set up,
+     *         CHIP_NO_ERROR otherwise.
+     */
+    CHIP_ERROR Init(const Aes128KeyHandle & key);
+
+    /**
+     * @brief Free the cipher state. The context can be bound to a key again afterwards.
+     */
+    void Release();
+
+    bool IsInitialized() const { return mKey != nullptr; }
+
+    /**
+     * @brief Same as AES_CCM_encrypt(), using the key the context was initialized with.
+     *
+     * @return CHIP_ERROR_INCORRECT_STATE if the context is not initialized, otherwise as AES_CCM_encrypt().
+     */
+    CHIP_ERROR Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag, size_t tag_length);
+
+    /**
+     * @brief Same as AES_CCM_decrypt(), using the key the context was initialized with.
+     *
+     * @return CHIP_ERROR_INCORRECT_STATE if the context is not initialized, otherwise as AES_CCM_decrypt().
+     */
+    CHIP_ERROR Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length, uint8_t * plaintext);
+
+private:
+    const Aes128KeyHandle * mKey = nullptr;
+#if CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL || CHIP_CRYPTO_MBEDTLS
+    void * mCipherContext = nullptr;
+#endif
+#if CHIP_CRYPTO_OPENSSL
+    // Nonce and tag lengths and direction the cipher context is currently keyed for.
+    size_t mNonceLength   = 0;
+    size_t mTagLength     = 0;
+    bool mKeyedForEncrypt = false;
+#endif
+};
+
 /**
  * @brief A function that implements AES-CTR encryption/decryption
  *
@@ -1848,6 +1941,14 @@ public:
     virtual CHIP_ERROR MessageDecrypt(const ByteSpan & ciphertext, const ByteSpan & aad, const ByteSpan & nonce,
                                       const ByteSpan & mic, MutableByteSpan & plaintext) const = 0;
 
+    /**
+     * @brief Returns the key used by MessageEncrypt() and MessageDecrypt(), if they are plain AES-CCM with it
+     *
+     * Lets trial decryption pass the keys of several contexts to AES_CCM_decrypt_multi_key() at once.
+     * Contexts that do not expose their key return nullptr, and are only used through MessageDecrypt().
+     */
+    virtual const Aes128KeyHandle * GetMessageKeyHandle() const { return nullptr; }
+
     /**
      * @brief Perform privacy encoding as described in 4.8.2. (Privacy Processing of Outgoing Messages)
      * @param[in] input         Message header to privacy encrypt
@@ -68,6 +68,20 @@ namespace Crypto {
 #define CHIP_CONFIG_CRYPTO_PSA_KEY_ID_END 0x3FFFF
 #endif // CHIP_CONFIG_CRYPTO_PSA_KEY_ID_END
 
+/**
+ * @def CHIP_CONFIG_CRYPTO_PSA_SIGN_WITH_OP_KEYPAIR_IN_BACKGROUND
+ *
+ * @brief
+ *   Let CASE sessions sign with the operational keys held by PSAOperationalKeystore in the background.
+ *
+ * Signing in the background keeps the Matter thread serving other traffic while the signature for Sigma2 or
+ * Sigma3 is made, which matters when the keys live in a slow secure element. This requires the PSA crypto
+ * implementation to be thread-safe, e.g. Mbed TLS built with MBEDTLS_THREADING_C.
+ */
+#ifndef CHIP_CONFIG_CRYPTO_PSA_SIGN_WITH_OP_KEYPAIR_IN_BACKGROUND
+#define CHIP_CONFIG_CRYPTO_PSA_SIGN_WITH_OP_KEYPAIR_IN_BACKGROUND 0
+#endif // CHIP_CONFIG_CRYPTO_PSA_SIGN_WITH_OP_KEYPAIR_IN_BACKGROUND
+
 static_assert(PSA_KEY_ID_USER_MIN <= CHIP_CONFIG_CRYPTO_PSA_KEY_ID_BASE && CHIP_CONFIG_CRYPTO_PSA_KEY_ID_END <= PSA_KEY_ID_USER_MAX,
               "Matter specific PSA key range doesn't fit within PSA allowed range");
 
@@ -45,6 +45,7 @@
 #include <lib/support/BufferWriter.h>
 #include <lib/support/BytesToHex.h>
 #include <lib/support/CHIPArgParser.hpp>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/SafePointerCast.h>
@@ -74,40 +75,80 @@ static bool _isValidTagLength(size_t tag_length)
     return false;
 }
 
-CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
-                           const Aes128KeyHandle & key, const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext,
-                           uint8_t * tag, size_t tag_length)
+static CHIP_ERROR _ccmSetKey(mbedtls_ccm_context & context, const Aes128KeyHandle & key)
 {
-    CHIP_ERROR error = CHIP_NO_ERROR;
-    int result       = 1;
+    // Size of key is expressed in bits, hence the multiplication by 8.
+    const int result = mbedtls_ccm_setkey(&context, MBEDTLS_CIPHER_ID_AES, key.As<Symmetric128BitsKeyByteArray>(),
+                                          sizeof(Symmetric128BitsKeyByteArray) * 8);
+    VerifyOrReturnError(result == 0, CHIP_ERROR_INTERNAL);
 
-    mbedtls_ccm_context context;
-    mbedtls_ccm_init(&context);
+    return CHIP_NO_ERROR;
+}
 
-    VerifyOrExit(plaintext != nullptr || plaintext_length == 0, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(ciphertext != nullptr || plaintext_length == 0, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(nonce != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(nonce_length > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(tag != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(_isValidTagLength(tag_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+static CHIP_ERROR _ccmEncrypt(mbedtls_ccm_context & context, const uint8_t * plaintext, size_t plaintext_length,
+                              const uint8_t * aad, size_t aad_length, const uint8_t * nonce, size_t nonce_length,
+                              uint8_t * ciphertext, uint8_t * tag, size_t tag_length)
+{
+    VerifyOrReturnError(plaintext != nullptr || plaintext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr || plaintext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidTagLength(tag_length), CHIP_ERROR_INVALID_ARGUMENT);
     if (aad_length > 0)
     {
-        VerifyOrExit(aad != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(aad != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     }
 
-    // Size of key is expressed in bits, hence the multiplication by 8.
-    result = mbedtls_ccm_setkey(&context, MBEDTLS_CIPHER_ID_AES, key.As<Symmetric128BitsKeyByteArray>(),
-                                sizeof(Symmetric128BitsKeyByteArray) * 8);
-    VerifyOrExit(result == 0, error = CHIP_ERROR_INTERNAL);
-
     // Encrypt
-    result = mbedtls_ccm_encrypt_and_tag(&context, plaintext_length, Uint8::to_const_uchar(nonce), nonce_length,
-                                         Uint8::to_const_uchar(aad), aad_length, Uint8::to_const_uchar(plaintext),
-                                         Uint8::to_uchar(ciphertext), Uint8::to_uchar(tag), tag_length);
+    const int result = mbedtls_ccm_encrypt_and_tag(&context, plaintext_length, Uint8::to_const_uchar(nonce), nonce_length,
+                                                   Uint8::to_const_uchar(aad), aad_length, Uint8::to_const_uchar(plaintext),
+                                                   Uint8::to_uchar(ciphertext), Uint8::to_uchar(tag), tag_length);
     _log_mbedTLS_error(result);
-    VerifyOrExit(result == 0, error = CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(result == 0, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+static CHIP_ERROR _ccmDecrypt(mbedtls_ccm_context & context, const uint8_t * ciphertext, size_t ciphertext_len, const uint8_t * aad,
+                              size_t aad_len, const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                              uint8_t * plaintext)
+{
+    VerifyOrReturnError(plaintext != nullptr || ciphertext_len == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr || ciphertext_len == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidTagLength(tag_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    if (aad_len > 0)
+    {
+        VerifyOrReturnError(aad != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    // Decrypt
+    const int result = mbedtls_ccm_auth_decrypt(&context, ciphertext_len, Uint8::to_const_uchar(nonce), nonce_length,
+                                                Uint8::to_const_uchar(aad), aad_len, Uint8::to_const_uchar(ciphertext),
+                                                Uint8::to_uchar(plaintext), Uint8::to_const_uchar(tag), tag_length);
+    _log_mbedTLS_error(result);
+    VerifyOrReturnError(result == 0, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                           const Aes128KeyHandle & key, const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext,
+                           uint8_t * tag, size_t tag_length)
+{
+    mbedtls_ccm_context context;
+    mbedtls_ccm_init(&context);
+
+    CHIP_ERROR error = _ccmSetKey(context, key);
+    if (error == CHIP_NO_ERROR)
+    {
+        error =
+            _ccmEncrypt(context, plaintext, plaintext_length, aad, aad_length, nonce, nonce_length, ciphertext, tag, tag_length);
+    }
 
-exit:
     mbedtls_ccm_free(&context);
     return error;
 }
@@ -116,40 +157,75 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_len, co
                            const uint8_t * tag, size_t tag_length, const Aes128KeyHandle & key, const uint8_t * nonce,
                            size_t nonce_length, uint8_t * plaintext)
 {
-    CHIP_ERROR error = CHIP_NO_ERROR;
-    int result       = 1;
-
     mbedtls_ccm_context context;
     mbedtls_ccm_init(&context);
 
-    VerifyOrExit(plaintext != nullptr || ciphertext_len == 0, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(ciphertext != nullptr || ciphertext_len == 0, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(tag != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(_isValidTagLength(tag_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(nonce != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(nonce_length > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
-    if (aad_len > 0)
+    CHIP_ERROR error = _ccmSetKey(context, key);
+    if (error == CHIP_NO_ERROR)
     {
-        VerifyOrExit(aad != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
+        error = _ccmDecrypt(context, ciphertext, ciphertext_len, aad, aad_len, tag, tag_length, nonce, nonce_length, plaintext);
     }
 
-    // Size of key is expressed in bits, hence the multiplication by 8.
-    result = mbedtls_ccm_setkey(&context, MBEDTLS_CIPHER_ID_AES, key.As<Symmetric128BitsKeyByteArray>(),
-                                sizeof(Symmetric128BitsKeyByteArray) * 8);
-    VerifyOrExit(result == 0, error = CHIP_ERROR_INTERNAL);
-
-    // Decrypt
-    result = mbedtls_ccm_auth_decrypt(&context, ciphertext_len, Uint8::to_const_uchar(nonce), nonce_length,
-                                      Uint8::to_const_uchar(aad), aad_len, Uint8::to_const_uchar(ciphertext),
-                                      Uint8::to_uchar(plaintext), Uint8::to_const_uchar(tag), tag_length);
-    _log_mbedTLS_error(result);
-    VerifyOrExit(result == 0, error = CHIP_ERROR_INTERNAL);
-
-exit:
     mbedtls_ccm_free(&context);
     return error;
 }
 
+CHIP_ERROR Aes128CcmContext::Init(const Aes128KeyHandle & key)
+{
+    Release();
+
+    // mbedtls_ccm_setkey() allocates the cipher state and expands the key, which is what the context saves per message.
+    mbedtls_ccm_context * context = Platform::New<mbedtls_ccm_context>();
+    VerifyOrReturnError(context != nullptr, CHIP_ERROR_NO_MEMORY);
+    mbedtls_ccm_init(context);
+
+    CHIP_ERROR error = _ccmSetKey(*context, key);
+    if (error != CHIP_NO_ERROR)
+    {
+        mbedtls_ccm_free(context);
+        Platform::Delete(context);
+        return error;
+    }
+
+    mCipherContext = context;
+    mKey           = &key;
+
+    return CHIP_NO_ERROR;
+}
+
+void Aes128CcmContext::Release()
+{
+    if (mCipherContext != nullptr)
+    {
+        mbedtls_ccm_context * context = static_cast<mbedtls_ccm_context *>(mCipherContext);
+        mbedtls_ccm_free(context);
+        Platform::Delete(context);
+        mCipherContext = nullptr;
+    }
+
+    mKey = nullptr;
+}
+
+CHIP_ERROR Aes128CcmContext::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                     const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag,
+                                     size_t tag_length)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    return _ccmEncrypt(*static_cast<mbedtls_ccm_context *>(mCipherContext), plaintext, plaintext_length, aad, aad_length, nonce,
+                       nonce_length, ciphertext, tag, tag_length);
+}
+
+CHIP_ERROR Aes128CcmContext::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                     const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                                     uint8_t * plaintext)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    return _ccmDecrypt(*static_cast<mbedtls_ccm_context *>(mCipherContext), ciphertext, ciphertext_length, aad, aad_length, tag,
+                       tag_length, nonce, nonce_length, plaintext);
+}
+
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
 {
     // zero data length hash is supported.
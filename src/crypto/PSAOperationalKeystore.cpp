@@ -244,14 +244,17 @@ CHIP_ERROR PSAOperationalKeystore::SignWithOpKeypair(FabricIndex fabricIndex, co
 {
     VerifyOrReturnError(IsValidFabricIndex(fabricIndex), CHIP_ERROR_INVALID_FABRIC_INDEX);
 
+    // The pending keypair is stored under the same key ID as the committed one: sign through a keypair of our own rather
+    // than through mPendingKeypair, which may be released by the Matter thread while signing in the background.
+    PersistentP256Keypair keypair(fabricIndex);
     if (mPendingFabricIndex == fabricIndex)
     {
         VerifyOrReturnError(mIsPendingKeypairActive, CHIP_ERROR_INVALID_FABRIC_INDEX);
-        return mPendingKeypair->ECDSA_sign_msg(message.data(), message.size(), outSignature);
     }
-
-    PersistentP256Keypair keypair(fabricIndex);
-    VerifyOrReturnError(keypair.Exists(), CHIP_ERROR_INVALID_FABRIC_INDEX);
+    else
+    {
+        VerifyOrReturnError(keypair.Exists(), CHIP_ERROR_INVALID_FABRIC_INDEX);
+    }
 
     return keypair.ECDSA_sign_msg(message.data(), message.size(), outSignature);
 }
@@ -36,6 +36,10 @@ public:
     CHIP_ERROR RemoveOpKeypairForFabric(FabricIndex fabricIndex) override;
     CHIP_ERROR MigrateOpKeypairForFabric(FabricIndex fabricIndex, OperationalKeystore & operationalKeystore) const;
     void RevertPendingKeypair() override;
+    bool SupportsSignWithOpKeypairInBackground() const override
+    {
+        return CHIP_CONFIG_CRYPTO_PSA_SIGN_WITH_OP_KEYPAIR_IN_BACKGROUND;
+    }
     CHIP_ERROR SignWithOpKeypair(FabricIndex fabricIndex, const ByteSpan & message,
                                  Crypto::P256ECDSASignature & outSignature) const override;
     Crypto::P256Keypair * AllocateEphemeralKeypairForCASE() override;
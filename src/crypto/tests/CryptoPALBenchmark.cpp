@@ -0,0 +1,288 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  @file
+ *    Measures the CHIPCryptoPAL primitives used by session establishment and message
+ *    encryption, with the crypto backend selected by the build (`chip_crypto`).  Build
+ *    the target once per backend to compare them.
+ *
+ *    One JSON object is printed per measurement, e.g.:
+ *      {"backend":"openssl","op":"aes_ccm_encrypt","bytes":64,"iterations":20000,"ns_per_op":812.4}
+ *
+ *    Usage: crypto-pal-benchmark [iteration-scale]
+ */
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace chip;
+using namespace chip::Crypto;
+
+namespace {
+
+#if CHIP_CRYPTO_PSA
+constexpr char kBackend[] = "psa";
+#elif CHIP_CRYPTO_MBEDTLS
+constexpr char kBackend[] = "mbedtls";
+#elif CHIP_CRYPTO_BORINGSSL
+constexpr char kBackend[] = "boringssl";
+#elif CHIP_CRYPTO_OPENSSL
+constexpr char kBackend[] = "openssl";
+#else
+constexpr char kBackend[] = "platform";
+#endif
+
+constexpr size_t kAesCcmPayloadSizes[] = { 16, 64, 256, 1024 };
+constexpr size_t kHmacMessageSizes[]   = { 64, 1024 };
+constexpr uint32_t kPbkdf2Iterations   = kSpake2p_Min_PBKDF_Iterations;
+
+uint32_t gIterationScale = 1;
+
+// Runs `operation` once untimed, to check it succeeds before timing it, then times
+// `iterations * gIterationScale` runs and prints the result.
+template <typename Operation>
+bool Measure(const char * op, size_t bytes, uint32_t iterations, Operation && operation)
+{
+    CHIP_ERROR err = operation();
+    if (err != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "%s (%u bytes) failed: %" CHIP_ERROR_FORMAT "\n", op, static_cast<unsigned>(bytes), err.Format());
+        return false;
+    }
+
+    iterations *= gIterationScale;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        err = operation();
+        if (err != CHIP_NO_ERROR)
+        {
+            fprintf(stderr, "%s (%u bytes) failed: %" CHIP_ERROR_FORMAT "\n", op, static_cast<unsigned>(bytes), err.Format());
+            return false;
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    printf("{\"backend\":\"%s\",\"op\":\"%s\",\"bytes\":%u,\"iterations\":%" PRIu32 ",\"ns_per_op\":%.1f}\n", kBackend, op,
+           static_cast<unsigned>(bytes), iterations, static_cast<double>(elapsed.count()) / iterations);
+    return true;
+}
+
+bool BenchmarkAesCcm()
+{
+    DefaultSessionKeystore keystore;
+    Symmetric128BitsKeyByteArray keyMaterial;
+    memset(keyMaterial, 0x42, sizeof(keyMaterial));
+
+    Aes128KeyHandle key;
+    if (keystore.CreateKey(keyMaterial, key) != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "Failed to create AES key\n");
+        return false;
+    }
+
+    bool success = true;
+    Aes128CcmContext encryptContext;
+    Aes128CcmContext decryptContext;
+    success = success && encryptContext.Init(key) == CHIP_NO_ERROR && decryptContext.Init(key) == CHIP_NO_ERROR;
+
+    static uint8_t plaintext[1024];
+    static uint8_t ciphertext[1024];
+    uint8_t aad[8]                                 = {};
+    uint8_t nonce[kAES_CCM128_Nonce_Length]        = {};
+    uint8_t tag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES] = {};
+    memset(plaintext, 0x5A, sizeof(plaintext));
+
+    for (size_t size : kAesCcmPayloadSizes)
+    {
+        success = success && Measure("aes_ccm_encrypt", size, 20000, [&] {
+            return AES_CCM_encrypt(plaintext, size, aad, sizeof(aad), key, nonce, sizeof(nonce), ciphertext, tag, sizeof(tag));
+        });
+        success = success && Measure("aes_ccm_decrypt", size, 20000, [&] {
+            return AES_CCM_decrypt(ciphertext, size, aad, sizeof(aad), tag, sizeof(tag), key, nonce, sizeof(nonce), plaintext);
+        });
+        success = success && Measure("aes_ccm_context_encrypt", size, 20000, [&] {
+            return encryptContext.Encrypt(plaintext, size, aad, sizeof(aad), nonce, sizeof(nonce), ciphertext, tag, sizeof(tag));
+        });
+        success = success && Measure("aes_ccm_context_decrypt", size, 20000, [&] {
+            return decryptContext.Decrypt(ciphertext, size, aad, sizeof(aad), tag, sizeof(tag), nonce, sizeof(nonce), plaintext);
+        });
+    }
+
+    encryptContext.Release();
+    decryptContext.Release();
+    keystore.DestroyKey(key);
+    return success;
+}
+
+bool BenchmarkHmacAndHkdf()
+{
+    bool success = true;
+
+    static uint8_t message[1024];
+    uint8_t key[kSHA256_Hash_Length];
+    uint8_t out[kSHA256_Hash_Length];
+    memset(message, 0x5A, sizeof(message));
+    memset(key, 0x42, sizeof(key));
+
+    HMAC_sha hmac;
+    for (size_t size : kHmacMessageSizes)
+    {
+        success = success && Measure("hmac_sha256", size, 20000, [&] {
+            return hmac.HMAC_SHA256(key, sizeof(key), message, size, out, sizeof(out));
+        });
+    }
+
+    // Same shape as the derivation of the I2R, R2I and attestation keys of a session.
+    const uint8_t info[] = { 'S', 'e', 's', 's', 'i', 'o', 'n', 'K', 'e', 'y', 's' };
+    uint8_t salt[32]     = {};
+    uint8_t sessionKeys[3 * sizeof(Symmetric128BitsKeyByteArray)];
+
+    HKDF_sha hkdf;
+    success = success && Measure("hkdf_sha256", sizeof(sessionKeys), 20000, [&] {
+        return hkdf.HKDF_SHA256(key, sizeof(key), salt, sizeof(salt), info, sizeof(info), sessionKeys, sizeof(sessionKeys));
+    });
+
+    return success;
+}
+
+bool BenchmarkP256()
+{
+    bool success = true;
+
+    uint8_t message[256];
+    memset(message, 0x5A, sizeof(message));
+
+    success = success && Measure("p256_keypair_generate", 0, 200, [] {
+        P256Keypair keypair;
+        return keypair.Initialize(ECPKeyTarget::ECDSA);
+    });
+
+    P256Keypair signer;
+    P256ECDSASignature signature;
+    success = success && signer.Initialize(ECPKeyTarget::ECDSA) == CHIP_NO_ERROR;
+    success = success && Measure("ecdsa_p256_sign", sizeof(message), 200, [&] {
+        return signer.ECDSA_sign_msg(message, sizeof(message), signature);
+    });
+    success = success && Measure("ecdsa_p256_verify", sizeof(message), 200, [&] {
+        return signer.Pubkey().ECDSA_validate_msg_signature(message, sizeof(message), signature);
+    });
+
+    P256Keypair local;
+    P256Keypair remote;
+    P256ECDHDerivedSecret secret;
+    success = success && local.Initialize(ECPKeyTarget::ECDH) == CHIP_NO_ERROR;
+    success = success && remote.Initialize(ECPKeyTarget::ECDH) == CHIP_NO_ERROR;
+    success = success && Measure("ecdh_p256", 0, 200, [&] { return local.ECDH_derive_secret(remote.Pubkey(), secret); });
+
+    return success;
+}
+
+bool BenchmarkPasscodeDerivation()
+{
+    bool success = true;
+
+    const uint8_t salt[kSpake2p_Min_PBKDF_Salt_Length] = { 'S', 'P', 'A', 'K', 'E', '2', 'P', ' ',
+                                                          'K', 'e', 'y', ' ', 'S', 'a', 'l', 't' };
+    constexpr uint32_t kSetupPin                       = 20202021;
+    const uint8_t context[]                            = { 'C', 'H', 'I', 'P', ' ', 'P', 'A', 'K', 'E' };
+
+    uint8_t pin[sizeof(kSetupPin)];
+    memcpy(pin, &kSetupPin, sizeof(pin));
+    uint8_t ws[2 * kSpake2p_WS_Length];
+
+    PBKDF2_sha256 pbkdf2;
+    success = success && Measure("pbkdf2_sha256_1000", sizeof(ws), 20, [&] {
+        return pbkdf2.pbkdf2_sha256(pin, sizeof(pin), salt, sizeof(salt), kPbkdf2Iterations, sizeof(ws), ws);
+    });
+
+    // Inputs of both sides of a PASE session, as PASESession derives them.
+    Spake2pVerifier verifier;
+    success = success && verifier.Generate(kPbkdf2Iterations, ByteSpan(salt), kSetupPin) == CHIP_NO_ERROR;
+    success = success &&
+        Spake2pVerifier::ComputeWS(kPbkdf2Iterations, ByteSpan(salt), kSetupPin, ws, static_cast<uint32_t>(sizeof(ws))) ==
+            CHIP_NO_ERROR;
+
+    // One complete exchange per iteration: both rounds and key confirmation on both sides.
+    success = success && Measure("spake2p_exchange", 0, 50, [&] {
+        Spake2p_P256_SHA256_HKDF_HMAC prover;
+        Spake2p_P256_SHA256_HKDF_HMAC verifierSide;
+        uint8_t X[kMAX_Point_Length];
+        uint8_t Y[kMAX_Point_Length];
+        uint8_t proverConfirmation[kMAX_Hash_Length];
+        uint8_t verifierConfirmation[kMAX_Hash_Length];
+        size_t XLen                    = sizeof(X);
+        size_t YLen                    = sizeof(Y);
+        size_t proverConfirmationLen   = sizeof(proverConfirmation);
+        size_t verifierConfirmationLen = sizeof(verifierConfirmation);
+
+        ReturnErrorOnFailure(prover.Init(context, sizeof(context)));
+        ReturnErrorOnFailure(
+            prover.BeginProver(nullptr, 0, nullptr, 0, &ws[0], kSpake2p_WS_Length, &ws[kSpake2p_WS_Length], kSpake2p_WS_Length));
+        ReturnErrorOnFailure(verifierSide.Init(context, sizeof(context)));
+        ReturnErrorOnFailure(verifierSide.BeginVerifier(nullptr, 0, nullptr, 0, verifier.mW0, sizeof(verifier.mW0), verifier.mL,
+                                                        sizeof(verifier.mL)));
+
+        ReturnErrorOnFailure(prover.ComputeRoundOne(nullptr, 0, X, &XLen));
+        ReturnErrorOnFailure(verifierSide.ComputeRoundOne(X, XLen, Y, &YLen));
+        ReturnErrorOnFailure(verifierSide.ComputeRoundTwo(X, XLen, verifierConfirmation, &verifierConfirmationLen));
+        ReturnErrorOnFailure(prover.ComputeRoundTwo(Y, YLen, proverConfirmation, &proverConfirmationLen));
+        ReturnErrorOnFailure(prover.KeyConfirm(verifierConfirmation, verifierConfirmationLen));
+        return verifierSide.KeyConfirm(proverConfirmation, proverConfirmationLen);
+    });
+
+    return success;
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    if (argc > 1)
+    {
+        gIterationScale = static_cast<uint32_t>(strtoul(argv[1], nullptr, 0));
+        if (gIterationScale == 0)
+        {
+            fprintf(stderr, "Usage: %s [iteration-scale]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (Platform::MemoryInit() != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "Failed to initialize memory\n");
+        return EXIT_FAILURE;
+    }
+
+    bool success = BenchmarkAesCcm();
+    success      = BenchmarkHmacAndHkdf() && success;
+    success      = BenchmarkP256() && success;
+    success      = BenchmarkPasscodeDerivation() && success;
+
+    Platform::MemoryShutdown();
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -476,6 +476,105 @@ TEST_F(TestChipCryptoPAL, TestAES_CCM_128DecryptInvalidNonceLen)
     EXPECT_GT(numOfTestsRan, 0);
 }
 
+TEST_F(TestChipCryptoPAL, TestAES_CCM_128ContextTestVectors)
+{
+    HeapChecker heapChecker;
+    int numOfTestVectors = ArraySize(ccm_128_test_vectors);
+    int numOfTestsRan    = 0;
+    for (int vectorIndex = 0; vectorIndex < numOfTestVectors; vectorIndex++)
+    {
+        const ccm_128_test_vector * vector = ccm_128_test_vectors[vectorIndex];
+        if (vector->pt_len > 0 && vector->result == CHIP_NO_ERROR)
+        {
+            numOfTestsRan++;
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_ct;
+            out_ct.Alloc(vector->ct_len);
+            EXPECT_TRUE(out_ct);
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_tag;
+            out_tag.Alloc(vector->tag_len);
+            EXPECT_TRUE(out_tag);
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_pt;
+            out_pt.Alloc(vector->pt_len);
+            EXPECT_TRUE(out_pt);
+
+            TestAesKey key(vector->key, vector->key_len);
+
+            Aes128CcmContext context;
+            EXPECT_EQ(context.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->nonce, vector->nonce_len,
+                                      out_ct.Get(), out_tag.Get(), vector->tag_len),
+                      CHIP_ERROR_INCORRECT_STATE);
+            EXPECT_EQ(context.Init(key.key), CHIP_NO_ERROR);
+
+            // The context is reused across messages, including after a failed authentication.
+            for (int round = 0; round < 2; round++)
+            {
+                EXPECT_EQ(context.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->nonce,
+                                          vector->nonce_len, out_ct.Get(), out_tag.Get(), vector->tag_len),
+                          CHIP_NO_ERROR);
+                EXPECT_EQ(memcmp(out_ct.Get(), vector->ct, vector->ct_len), 0);
+                EXPECT_EQ(memcmp(out_tag.Get(), vector->tag, vector->tag_len), 0);
+
+                out_tag[0] ^= 1;
+                EXPECT_NE(context.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, out_tag.Get(),
+                                          vector->tag_len, vector->nonce, vector->nonce_len, out_pt.Get()),
+                          CHIP_NO_ERROR);
+
+                EXPECT_EQ(context.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag, vector->tag_len,
+                                          vector->nonce, vector->nonce_len, out_pt.Get()),
+                          CHIP_NO_ERROR);
+                EXPECT_EQ(memcmp(out_pt.Get(), vector->pt, vector->pt_len), 0);
+            }
+
+            context.Release();
+            EXPECT_FALSE(context.IsInitialized());
+        }
+    }
+    EXPECT_GT(numOfTestsRan, 0);
+}
+
+TEST_F(TestChipCryptoPAL, TestAES_CCM_128DecryptMultiKey)
+{
+    HeapChecker heapChecker;
+    int numOfTestVectors = ArraySize(ccm_128_test_vectors);
+    int numOfTestsRan    = 0;
+    for (int vectorIndex = 0; vectorIndex < numOfTestVectors; vectorIndex++)
+    {
+        const ccm_128_test_vector * vector = ccm_128_test_vectors[vectorIndex];
+        if (vector->pt_len > 0 && vector->result == CHIP_NO_ERROR)
+        {
+            numOfTestsRan++;
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_pt;
+            out_pt.Alloc(vector->pt_len);
+            EXPECT_TRUE(out_pt);
+
+            uint8_t wrongKeyBytes[Crypto::CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES];
+            memcpy(wrongKeyBytes, vector->key, sizeof(wrongKeyBytes));
+            wrongKeyBytes[0] ^= 1;
+
+            TestAesKey wrongKey(wrongKeyBytes, sizeof(wrongKeyBytes));
+            TestAesKey key(vector->key, vector->key_len);
+
+            // The matching key is found after a failed candidate.
+            const Aes128KeyHandle * keys[] = { &wrongKey.key, &key.key };
+            size_t keyIndex                = 0;
+            EXPECT_EQ(AES_CCM_decrypt_multi_key(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag,
+                                                vector->tag_len, keys, ArraySize(keys), vector->nonce, vector->nonce_len,
+                                                out_pt.Get(), keyIndex),
+                      CHIP_NO_ERROR);
+            EXPECT_EQ(keyIndex, 1u);
+            EXPECT_EQ(memcmp(out_pt.Get(), vector->pt, vector->pt_len), 0);
+
+            // No candidate authenticates the message.
+            const Aes128KeyHandle * wrongKeys[] = { &wrongKey.key };
+            EXPECT_EQ(AES_CCM_decrypt_multi_key(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag,
+                                                vector->tag_len, wrongKeys, ArraySize(wrongKeys), vector->nonce,
+                                                vector->nonce_len, out_pt.Get(), keyIndex),
+                      CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+        }
+    }
+    EXPECT_GT(numOfTestsRan, 0);
+}
+
 TEST_F(TestChipCryptoPAL, TestSensitiveDataBuffer)
 {
     HeapChecker heapChecker;
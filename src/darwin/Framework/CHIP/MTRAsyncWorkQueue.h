@@ -30,6 +30,18 @@ typedef NS_ENUM(NSInteger, MTRAsyncWorkOutcome) {
 /// being cancelled).
 typedef BOOL (^MTRAsyncWorkCompletionBlock)(MTRAsyncWorkOutcome outcome);
 
+/// The priority of a `MTRAsyncWorkItem`.
+///
+/// Work items run in priority order, and in the order they were enqueued for
+/// a given priority: a work item is enqueued after the last queued (not yet
+/// running) work item of the same or a higher priority, ahead of any queued
+/// work item of a lower priority.  Running work items are not affected.
+typedef NS_ENUM(NSInteger, MTRAsyncWorkPriority) {
+    MTRAsyncWorkPriorityLow = -1,
+    MTRAsyncWorkPriorityDefault = 0,
+    MTRAsyncWorkPriorityHigh = 1,
+};
+
 typedef NS_ENUM(NSInteger, MTRBatchingOutcome) {
     MTRNotBatched = 0,
     MTRBatchedPartially, // some work was batched but the source item has work remaining
@@ -132,6 +144,11 @@ MTR_TESTABLE
 /// The work item may or may not have been started already.
 @property (nonatomic, strong, nullable) void (^cancelHandler)(void);
 
+/// The priority of the work item, `MTRAsyncWorkPriorityDefault` unless set.
+///
+/// @see MTRAsyncWorkPriority
+@property (nonatomic) MTRAsyncWorkPriority priority;
+
 @property (nonatomic, readonly) NSUInteger batchingID;
 @property (nonatomic, readonly, nullable) id batchableData;
 @property (nonatomic, readonly, nullable) MTRAsyncWorkBatchingHandler batchingHandler;
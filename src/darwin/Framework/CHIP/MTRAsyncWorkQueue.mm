@@ -65,6 +65,12 @@ MTR_DIRECT_MEMBERS
     _cancelHandler = cancelHandler;
 }
 
+- (void)setPriority:(MTRAsyncWorkPriority)priority
+{
+    [self assertMutable];
+    _priority = priority;
+}
+
 - (void)setBatchingID:(NSUInteger)opaqueBatchingID data:(id)opaqueBatchableData handler:(MTRAsyncWorkBatchingHandler)batchingHandler
 {
     NSParameterAssert(batchingHandler);
@@ -262,7 +268,18 @@ struct ContextSnapshot {
 
     std::lock_guard lock(_lock);
     [item markEnqueued];
-    [_items addObject:item];
+
+    // Queue the item ahead of the queued items of a lower priority.  The
+    // running items are the first _runningWorkItemCount items.
+    NSUInteger index = _items.count;
+    while (index > _runningWorkItemCount && _items[index - 1].priority < item.priority) {
+        index--;
+    }
+    [_items insertObject:item atIndex:index];
+    if (index < _items.count - 1) {
+        MTR_LOG("MTRAsyncWorkQueue<%@> work item [%llu] (priority %ld) queued ahead of %lu lower priority items",
+            context.description, item.uniqueID, static_cast<long>(item.priority), static_cast<unsigned long>(_items.count - 1 - index));
+    }
 
     if (description) {
         // Logging the description once is enough because other log messages
@@ -404,7 +421,7 @@ struct ContextSnapshot {
             case MTRBatchedFully:
                 MTR_LOG("MTRAsyncWorkQueue<%@> fully merged work item [%llu] into %llu",
                     context.description, nextWorkItem.uniqueID, workItem.uniqueID);
-                [_items removeObjectAtIndex:1];
+                [_items removeObjectAtIndex:firstNonRunningItemIndex];
                 continue; // try to batch the next item (if any)
             }
         }
@@ -47,6 +47,7 @@
 #import "lib/core/CHIPError.h"
 #import "lib/core/DataModelTypes.h"
 #import <app/ConcreteAttributePath.h>
+#import <lib/core/TLV.h>
 #import <lib/support/FibonacciUtils.h>
 
 #import <app/AttributePathParams.h>
@@ -91,6 +92,24 @@ typedef void (^MTRDeviceAttributeReportHandler)(NSArray * _Nonnull);
 
 /* END DRAGONS */
 
+// An attribute value decoded from a report, along with the TLV it was decoded from.
+@interface MTRDecodedAttributeValue : NSObject
+@property (nonatomic, readonly) NSData * tlv;
+@property (nonatomic, readonly) MTRDeviceDataValueDictionary value;
+- (instancetype)initWithTLV:(NSData *)tlv value:(MTRDeviceDataValueDictionary)value;
+@end
+
+@implementation MTRDecodedAttributeValue
+- (instancetype)initWithTLV:(NSData *)tlv value:(MTRDeviceDataValueDictionary)value
+{
+    if (self = [super init]) {
+        _tlv = tlv;
+        _value = value;
+    }
+    return self;
+}
+@end
+
 #pragma mark - SubscriptionCallback class declaration
 using namespace chip;
 using namespace chip::app;
@@ -124,9 +143,21 @@ private:
 
     CHIP_ERROR OnResubscriptionNeeded(chip::app::ReadClient * apReadClient, CHIP_ERROR aTerminationCause) override;
 
+    // Decodes a reported attribute value, reusing the value decoded from the
+    // previous report of the attribute if its TLV did not change.
+    NSDictionary * _Nullable DecodeAttributeValue(MTRAttributePath * attributePath, TLV::TLVReader * apData, NSNumber * _Nullable dataVersion);
+
     // Copied from ReadClient and customized for MTRDevice resubscription time reset
     uint32_t ComputeTimeTillNextSubscription();
     uint32_t mResubscriptionNumRetries = 0;
+
+    // Values of larger attributes are decoded from every report.
+    static constexpr size_t kMaxDecodedAttributeTLVLength = 512;
+
+    // Attribute values decoded from the last report of each attribute.  Since
+    // an unchanged value is then the very same object as the one MTRDevice
+    // cached, comparing it with the cache is a pointer comparison.
+    NSMutableDictionary<MTRAttributePath *, MTRDecodedAttributeValue *> * mDecodedAttributeValues = [NSMutableDictionary dictionary];
 };
 
 } // anonymous namespace
@@ -346,11 +377,14 @@ typedef NS_ENUM(NSUInteger, MTRDeviceWorkItemDuplicateTypeID) {
     //  _deviceReportingExcessivelyStartTime tracks when a device starts reporting excessively.
     //  _reportToPersistenceDelayCurrentMultiplier is the current multiplier that is calculated when a
     //      report comes in.
+    //  _reportsSinceClusterDataPersistence counts the reports with cluster data to persist since the
+    //      last write to storage, which coalesces them.
     MTRDeviceStorageBehaviorConfiguration * _storageBehaviorConfiguration;
     NSDate * _Nullable _clusterDataPersistenceFirstScheduledTime;
     NSMutableArray<NSDate *> * _mostRecentReportTimes;
     NSDate * _Nullable _deviceReportingExcessivelyStartTime;
     double _reportToPersistenceDelayCurrentMultiplier;
+    NSUInteger _reportsSinceClusterDataPersistence;
 
     // System time change observer reference
     id _systemTimeChangeObserverToken;
@@ -1573,7 +1607,16 @@ typedef NS_ENUM(NSUInteger, MTRDeviceWorkItemDuplicateTypeID) {
     // storage implementation, which will try to read them later.  Make sure
     // we snapshot the state here instead of handing out live copies.
     NSDictionary<MTRClusterPath *, MTRDeviceClusterData *> * clusterData = [self _clusterDataToPersistSnapshot];
+
+    using namespace chip::Tracing::DarwinFramework;
+    MATTER_LOG_METRIC_BEGIN(kMetricMTRDeviceClusterDataPersist);
     [self._concreteController.controllerDataStore storeClusterData:clusterData forNodeID:_nodeID];
+    MATTER_LOG_METRIC_END(kMetricMTRDeviceClusterDataPersist);
+    MATTER_LOG_METRIC(kMetricMTRDeviceClusterDataPersistClusterCount, static_cast<uint32_t>(clusterData.count));
+    MATTER_LOG_METRIC(kMetricMTRDeviceClusterDataPersistCoalescedReports, static_cast<uint32_t>(_reportsSinceClusterDataPersistence));
+    MATTER_LOG_METRIC(kMetricMTRDeviceClusterDataPersistDelayMultiplier, static_cast<uint32_t>(_reportToPersistenceDelayCurrentMultiplier * 100));
+    _reportsSinceClusterDataPersistence = 0;
+
     for (MTRClusterPath * clusterPath in _clusterDataToPersist) {
         [_persistedClusterData setObject:_clusterDataToPersist[clusterPath] forKey:clusterPath];
         [_persistedClusters addObject:clusterPath];
@@ -1684,6 +1727,8 @@ typedef NS_ENUM(NSUInteger, MTRDeviceWorkItemDuplicateTypeID) {
         return;
     }
 
+    _reportsSinceClusterDataPersistence++;
+
     // If there is no storage behavior configuration, make a default one
     if (!_storageBehaviorConfiguration) {
         _storageBehaviorConfiguration = [[MTRDeviceStorageBehaviorConfiguration alloc] init];
@@ -2891,6 +2936,10 @@ static BOOL AttributeHasChangesOmittedQuality(MTRAttributePath * attributePath)
         uint64_t workItemID = workItem.uniqueID; // capture only the ID, not the work item
         NSNumber * nodeID = [self nodeID];
 
+        // Read-throughs only refresh the cache: let writes and invokes, which
+        // are usually user initiated, go ahead of a backlog of reads.
+        workItem.priority = MTRAsyncWorkPriorityLow;
+
         [workItem setBatchingID:MTRDeviceWorkItemBatchingReadID data:readRequests handler:^(id opaqueDataCurrent, id opaqueDataNext) {
             mtr_hide(self); // don't capture self accidentally
             NSMutableArray<NSArray *> * readRequestsCurrent = opaqueDataCurrent;
@@ -4369,6 +4418,7 @@ void SubscriptionCallback::OnAttributeData(
 
     MTRAttributePath * attributePath = [[MTRAttributePath alloc] initWithPath:aPath];
     if (aStatus.mStatus != Status::Success) {
+        [mDecodedAttributeValues removeObjectForKey:attributePath];
         [mAttributeReports addObject:@ { MTRAttributePathKey : attributePath, MTRErrorKey : [MTRError errorForIMStatus:aStatus] }];
     } else if (apData == nullptr) {
         [mAttributeReports addObject:@ {
@@ -4377,7 +4427,7 @@ void SubscriptionCallback::OnAttributeData(
         }];
     } else {
         NSNumber * dataVersionNumber = aPath.mDataVersion.HasValue() ? @(aPath.mDataVersion.Value()) : nil;
-        NSDictionary * value = MTRDecodeDataValueDictionaryFromCHIPTLV(apData, dataVersionNumber);
+        NSDictionary * value = DecodeAttributeValue(attributePath, apData, dataVersionNumber);
         if (value == nil) {
             MTR_LOG_ERROR("Failed to decode attribute data for path %@", attributePath);
             [mAttributeReports addObject:@ {
@@ -4392,6 +4442,40 @@ void SubscriptionCallback::OnAttributeData(
     QueueInterimReport();
 }
 
+NSDictionary * _Nullable SubscriptionCallback::DecodeAttributeValue(
+    MTRAttributePath * attributePath, TLV::TLVReader * apData, NSNumber * _Nullable dataVersion)
+{
+    uint8_t tlvBuffer[kMaxDecodedAttributeTLVLength];
+    TLV::TLVReader reader;
+    reader.Init(*apData);
+    TLV::TLVWriter writer;
+    writer.Init(tlvBuffer);
+    if (writer.CopyElement(TLV::AnonymousTag(), reader) != CHIP_NO_ERROR || writer.Finalize() != CHIP_NO_ERROR) {
+        [mDecodedAttributeValues removeObjectForKey:attributePath];
+        return MTRDecodeDataValueDictionaryFromCHIPTLV(apData, dataVersion);
+    }
+
+    size_t tlvLength = writer.GetLengthWritten();
+    MTRDecodedAttributeValue * decoded = mDecodedAttributeValues[attributePath];
+    if (decoded == nil || decoded.tlv.length != tlvLength || memcmp(decoded.tlv.bytes, tlvBuffer, tlvLength) != 0) {
+        MTRDeviceDataValueDictionary value = MTRDecodeDataValueDictionaryFromCHIPTLV(apData);
+        if (value == nil) {
+            [mDecodedAttributeValues removeObjectForKey:attributePath];
+            return nil;
+        }
+        decoded = [[MTRDecodedAttributeValue alloc] initWithTLV:[NSData dataWithBytes:tlvBuffer length:tlvLength] value:value];
+        mDecodedAttributeValues[attributePath] = decoded;
+    }
+
+    if (dataVersion == nil) {
+        return decoded.value;
+    }
+
+    NSMutableDictionary * value = [decoded.value mutableCopy];
+    value[MTRDataVersionKey] = dataVersion;
+    return value;
+}
+
 uint32_t SubscriptionCallback::ComputeTimeTillNextSubscription()
 {
     uint32_t maxWaitTimeInMsec = 0;
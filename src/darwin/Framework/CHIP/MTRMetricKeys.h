@@ -94,6 +94,18 @@ constexpr Tracing::MetricKey kMetricUnexpectedCQualityUpdate = "dwnpm_bad_c_attr
 // Setup from darwin MTRDevice for initial subscription to a device
 constexpr Tracing::MetricKey kMetricMTRDeviceInitialSubscriptionSetup = "dwnpm_dev_initial_subscription_setup";
 
+// Tracks the writes of cluster data from darwin MTRDevice to the controller data store
+constexpr Tracing::MetricKey kMetricMTRDeviceClusterDataPersist = "dwnpm_dev_cluster_data_persist";
+
+// Number of clusters written to storage by a cluster data write
+constexpr Tracing::MetricKey kMetricMTRDeviceClusterDataPersistClusterCount = "dwnpm_dev_cluster_data_persist_clusters";
+
+// Number of reports coalesced into a cluster data write
+constexpr Tracing::MetricKey kMetricMTRDeviceClusterDataPersistCoalescedReports = "dwnpm_dev_cluster_data_persist_reports";
+
+// Report to persistence delay multiplier, in percent, in effect for a cluster data write
+constexpr Tracing::MetricKey kMetricMTRDeviceClusterDataPersistDelayMultiplier = "dwnpm_dev_cluster_data_persist_delay_pct";
+
 } // namespace DarwinFramework
 } // namespace Tracing
 } // namespace chip
@@ -281,6 +281,49 @@
     XCTAssertFalse(workItem2ReadyCalled);
 }
 
+- (void)testPriority
+{
+    XCTestExpectation * allItemsRunExpectation = [self expectationWithDescription:@"All work items called"];
+    allItemsRunExpectation.expectedFulfillmentCount = 5;
+
+    MTRAsyncWorkQueue * workQueue = [[MTRAsyncWorkQueue alloc] initWithContext:NSNull.null];
+
+    __block os_unfair_lock orderLock = OS_UNFAIR_LOCK_INIT;
+    NSMutableArray<NSString *> * order = [NSMutableArray array];
+    MTRAsyncWorkItem * (^makeWorkItem)(NSString *, MTRAsyncWorkPriority) = ^(NSString * name, MTRAsyncWorkPriority priority) {
+        MTRAsyncWorkItem * workItem = [[MTRAsyncWorkItem alloc] initWithQueue:dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0)];
+        workItem.priority = priority;
+        workItem.readyHandler = ^(id context, NSInteger retryCount, MTRAsyncWorkCompletionBlock completion) {
+            os_unfair_lock_lock(&orderLock);
+            [order addObject:name];
+            os_unfair_lock_unlock(&orderLock);
+            [allItemsRunExpectation fulfill];
+            completion(MTRAsyncWorkComplete);
+        };
+        return workItem;
+    };
+
+    MTRAsyncWorkItem * workItem0 = [[MTRAsyncWorkItem alloc] initWithQueue:dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0)];
+    workItem0.readyHandler = ^(id context, NSInteger retryCount, MTRAsyncWorkCompletionBlock completion) {
+        // While processing item 0, enqueue items of mixed priorities: they
+        // should run in priority order, in enqueueing order for a given priority.
+        [workQueue enqueueWorkItem:makeWorkItem(@"low1", MTRAsyncWorkPriorityLow)];
+        [workQueue enqueueWorkItem:makeWorkItem(@"low2", MTRAsyncWorkPriorityLow)];
+        [workQueue enqueueWorkItem:makeWorkItem(@"default", MTRAsyncWorkPriorityDefault)];
+        [workQueue enqueueWorkItem:makeWorkItem(@"high1", MTRAsyncWorkPriorityHigh)];
+        [workQueue enqueueWorkItem:makeWorkItem(@"high2", MTRAsyncWorkPriorityHigh)];
+        completion(MTRAsyncWorkComplete);
+    };
+    [workQueue enqueueWorkItem:workItem0];
+
+    [self waitForExpectations:@[ allItemsRunExpectation ] timeout:3];
+
+    os_unfair_lock_lock(&orderLock);
+    NSArray * expectedOrder = @[ @"high1", @"high2", @"default", @"low1", @"low2" ];
+    XCTAssertEqualObjects(order, expectedOrder);
+    os_unfair_lock_unlock(&orderLock);
+}
+
 - (void)testDuplicate
 {
     XCTestExpectation * workItem0ReadyExpectation = [self expectationWithDescription:@"Work item 0 called"];
@@ -447,6 +447,27 @@
 #define CHIP_DEVICE_CONFIG_ENABLE_WIFIPAF 0
 #endif
 
+/**
+ * CHIP_DEVICE_CONFIG_WIFIPAF_MAX_FRAME_SIZE
+ *
+ * The largest message, in bytes, sent in a single Wi-Fi PAF follow-up frame.
+ * The default fits the largest unfragmented Matter message.
+ */
+#ifndef CHIP_DEVICE_CONFIG_WIFIPAF_MAX_FRAME_SIZE
+#define CHIP_DEVICE_CONFIG_WIFIPAF_MAX_FRAME_SIZE 1280
+#endif
+
+/**
+ * CHIP_DEVICE_CONFIG_WIFIPAF_MAX_IN_FLIGHT_FRAMES
+ *
+ * The number of Wi-Fi PAF frames handed to the platform whose transmission
+ * has not completed yet. Messages sent past this limit wait in the send queue
+ * of the transport. 1 sends one frame at a time.
+ */
+#ifndef CHIP_DEVICE_CONFIG_WIFIPAF_MAX_IN_FLIGHT_FRAMES
+#define CHIP_DEVICE_CONFIG_WIFIPAF_MAX_IN_FLIGHT_FRAMES 4
+#endif
+
 // -------------------- WiFi AP Configuration --------------------
 
 /**
@@ -1358,6 +1379,18 @@ static_assert(CHIP_DEVICE_CONFIG_BLE_EXT_ADVERTISING_INTERVAL_MIN <= CHIP_DEVICE
 #define CHIP_DEVICE_CONFIG_EVENT_ID_COUNTER_EPOCH (0x10000)
 #endif
 
+/**
+ *  @def CHIP_DEVICE_CONFIG_EVENT_ID_COUNTER_MAX_EPOCH
+ *
+ *  @brief
+ *    Largest epoch the event id counter grows to while events are logged quickly, so it is persisted less often.
+ *    At most this many event numbers are skipped on a reboot. Set to CHIP_DEVICE_CONFIG_EVENT_ID_COUNTER_EPOCH to keep
+ *    the epoch fixed.
+ */
+#ifndef CHIP_DEVICE_CONFIG_EVENT_ID_COUNTER_MAX_EPOCH
+#define CHIP_DEVICE_CONFIG_EVENT_ID_COUNTER_MAX_EPOCH (0x100000)
+#endif
+
 /**
  * @def CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS
  *
@@ -170,6 +170,19 @@ public:
      */
     CHIP_ERROR Delete(const char * key);
 
+    /**
+     * @brief
+     * Waits until the entries put or deleted before the call are durable.
+     *
+     * Platforms writing their changes in the background return once those are
+     * written; on the others, changes are durable when Put() or Delete()
+     * returns and this does nothing.
+     *
+     * @return CHIP_NO_ERROR the changes are durable.
+     *         CHIP_ERROR_PERSISTED_STORAGE_FAILED failed to write the changes.
+     */
+    CHIP_ERROR Flush();
+
 private:
     using ImplClass = ::chip::DeviceLayer::PersistedStorage::KeyValueStoreManagerImpl;
 
@@ -182,6 +195,9 @@ protected:
     KeyValueStoreManager(const KeyValueStoreManager &)             = delete;
     KeyValueStoreManager(const KeyValueStoreManager &&)            = delete;
     KeyValueStoreManager & operator=(const KeyValueStoreManager &) = delete;
+
+    // Default for the platforms that have nothing to flush, which do not have to implement it.
+    CHIP_ERROR _Flush() { return CHIP_NO_ERROR; }
 };
 
 /**
@@ -233,6 +249,11 @@ inline CHIP_ERROR KeyValueStoreManager::Delete(const char * key)
     return static_cast<ImplClass *>(this)->_Delete(key);
 }
 
+inline CHIP_ERROR KeyValueStoreManager::Flush()
+{
+    return static_cast<ImplClass *>(this)->_Flush();
+}
+
 } // namespace PersistedStorage
 } // namespace DeviceLayer
 } // namespace chip
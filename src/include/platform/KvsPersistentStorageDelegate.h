@@ -103,6 +103,12 @@ public:
         return mKvsManager->Delete(key);
     }
 
+    CHIP_ERROR SyncFlush() override
+    {
+        VerifyOrReturnError(mKvsManager != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        return mKvsManager->Flush();
+    }
+
 protected:
     DeviceLayer::PersistedStorage::KeyValueStoreManager * mKvsManager = nullptr;
 };
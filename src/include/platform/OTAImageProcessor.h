@@ -32,6 +32,19 @@ struct OTAImageProgress
     uint64_t totalFileBytes  = 0;
 };
 
+/**
+ * Point from which an interrupted download can resume, as committed to persistent memory by the image processor.
+ */
+struct OTADownloadCheckpoint
+{
+    static constexpr size_t kDigestLength = 32; // SHA-256
+
+    uint64_t offset                     = 0;  ///< Bytes of the image processed, the download resumes from there
+    uint64_t storedBytes                = 0;  ///< Bytes the processor kept of them, e.g. without the image header
+    uint64_t totalFileBytes             = 0;  ///< As in OTAImageProgress, known once the header was processed
+    uint8_t prefixDigest[kDigestLength] = {}; ///< Digest of the bytes kept, checked before resuming
+};
+
 /**
  * @class OTAImageProcessorInterface
  *
@@ -75,6 +88,28 @@ public:
      */
     virtual CHIP_ERROR ProcessBlock(ByteSpan & block) = 0;
 
+    /**
+     * Called instead of PrepareDownload to resume an interrupted download from a checkpoint given by GetDownloadCheckpoint,
+     * possibly before a reboot. The processor checks what it kept still matches the checkpoint, and the blocks processed next
+     * then start at checkpoint.offset of the image. If it does not match, the processor reports
+     * CHIP_ERROR_INTEGRITY_CHECK_FAILED to OnPreparedForDownload and the download starts over.
+     *
+     * Processors unable to resume return CHIP_ERROR_NOT_IMPLEMENTED.
+     */
+    virtual CHIP_ERROR PrepareDownloadFrom(const OTADownloadCheckpoint & checkpoint) { return CHIP_ERROR_NOT_IMPLEMENTED; }
+
+    /**
+     * Called after processing a block, to get the latest point committed to persistent memory from which the download
+     * could resume. Returns CHIP_ERROR_NOT_IMPLEMENTED if the download cannot resume, e.g. with a compressed payload.
+     */
+    virtual CHIP_ERROR GetDownloadCheckpoint(OTADownloadCheckpoint & checkpoint) { return CHIP_ERROR_NOT_IMPLEMENTED; }
+
+    /**
+     * Called instead of Abort when the download is interrupted but may resume from the last checkpoint: unlike Abort, this
+     * keeps what was committed. This must not be a blocking call.
+     */
+    virtual CHIP_ERROR Suspend() { return Abort(); }
+
     /**
      * Called to check the current download status of the OTA image download.
      */
@@ -272,6 +272,129 @@
 #endif
 #endif // INET_CONFIG_UDP_SOCKET_PKTINFO
 
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_BATCH_IO
+ *
+ *  @brief
+ *    Use recvmmsg() and sendmmsg() to move several UDP datagrams per system
+ *    call in the socket-based implementation of UDP endpoints.
+ *
+ *  @details
+ *    When this flag is set, a readable UDP endpoint drains up to
+ *    #INET_CONFIG_UDP_SOCKET_BATCH_SIZE datagrams into pre-allocated packet
+ *    buffers with a single recvmmsg(), and outgoing datagrams are queued and
+ *    flushed with a single sendmmsg() on the next System::Layer event loop
+ *    iteration (or as soon as the queue is full). Since sends are deferred,
+ *    SendMsg() no longer reports per-datagram transmission errors; these are
+ *    logged when the queue is flushed.
+ *
+ *    This requires recvmmsg() and sendmmsg(), which are only available on Linux.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_BATCH_IO
+#define INET_CONFIG_UDP_SOCKET_BATCH_IO 0
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_IO
+
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_BATCH_SIZE
+ *
+ *  @brief
+ *    The maximum number of datagrams received or sent by a single
+ *    recvmmsg() / sendmmsg() call when #INET_CONFIG_UDP_SOCKET_BATCH_IO is set.
+ *
+ *  @details
+ *    Each listening UDP endpoint keeps this many receive packet buffers
+ *    allocated, so this value trades memory for fewer system calls.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_BATCH_SIZE
+#define INET_CONFIG_UDP_SOCKET_BATCH_SIZE 16
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE
+
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_GSO
+ *
+ *  @brief
+ *    Coalesce queued UDP datagrams into UDP_SEGMENT (generic segmentation
+ *    offload) sends when #INET_CONFIG_UDP_SOCKET_BATCH_IO is set.
+ *
+ *  @details
+ *    When the send queue is flushed, consecutive datagrams to the same peer,
+ *    with the same source and interface, and of the same size (the last one
+ *    may be shorter) are handed to the kernel as a single message, which the
+ *    kernel or the network device splits back into datagrams. This lowers
+ *    the per-datagram cost of bursts such as group fan-out or runs of
+ *    acknowledgements.
+ *
+ *    The endpoint checks at run time that the kernel supports UDP_SEGMENT
+ *    (Linux 4.18 and later), and falls back to sendmmsg() without
+ *    segmentation when it does not, or when the device rejects a segmented
+ *    message.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_GSO
+#define INET_CONFIG_UDP_SOCKET_GSO 0
+#endif // INET_CONFIG_UDP_SOCKET_GSO
+
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_GRO
+ *
+ *  @brief
+ *    Enable UDP_GRO (generic receive offload) on UDP sockets when
+ *    #INET_CONFIG_UDP_SOCKET_BATCH_IO is set.
+ *
+ *  @details
+ *    The kernel may then deliver several datagrams of a peer in a single
+ *    receive buffer, which the endpoint splits back into one PacketBuffer
+ *    per datagram before calling OnMessageReceived().
+ *
+ *    Coalesced datagrams need room: each of the
+ *    #INET_CONFIG_UDP_SOCKET_BATCH_SIZE receive buffers of a listening
+ *    endpoint is then a large (PacketBuffer::kMaxAllocSize) buffer, which
+ *    requires packet buffers allocated from the heap.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_GRO
+#define INET_CONFIG_UDP_SOCKET_GRO 0
+#endif // INET_CONFIG_UDP_SOCKET_GRO
+
+/**
+ *  @def INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS
+ *
+ *  @brief
+ *    Number of additional sockets a Linux UDP endpoint may open to hold IPv6
+ *    multicast group memberships once its own socket reaches the kernel's
+ *    per-socket limit. 0 disables them.
+ *
+ *  @details
+ *    The memberships of a socket are charged to its option memory
+ *    (net.core.optmem_max), so a node joining many groups eventually gets
+ *    ENOMEM, after about 2300 groups with the current default. Joins are then placed on unbound overflow sockets: with
+ *    IPV6_MULTICAST_ALL, which the endpoint sets on its own socket, Linux
+ *    delivers the datagrams of a group joined by any socket of the host to
+ *    every socket bound to the destination port.
+ *
+ *    MLD memberships are per address, so there is no joining a range of
+ *    group addresses at once; each overflow socket holds as many addresses
+ *    as the limit allows.
+ */
+#ifndef INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS
+#define INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS 0
+#endif // INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS
+
+/**
+ *  @def INET_CONFIG_SOCKET_MAX_SEND_IOV
+ *
+ *  @brief
+ *    The maximum number of PacketBuffers of a chain that the socket-based
+ *    endpoints hand to the kernel in a single sendmsg() / sendmmsg() entry.
+ *
+ *  @details
+ *    Chained buffers are sent in place with an iovec array instead of being
+ *    compacted first. A UDP datagram whose buffer chain is longer than this
+ *    is rejected with #CHIP_ERROR_MESSAGE_TOO_LONG; a TCP send queue simply
+ *    takes more than one system call to drain.
+ */
+#ifndef INET_CONFIG_SOCKET_MAX_SEND_IOV
+#define INET_CONFIG_SOCKET_MAX_SEND_IOV 8
+#endif // INET_CONFIG_SOCKET_MAX_SEND_IOV
+
 /**
  *  @def HAVE_SO_BINDTODEVICE
  *
@@ -67,6 +67,31 @@
 namespace chip {
 namespace Inet {
 
+namespace {
+
+// Describe the data of a PacketBuffer chain with at most maxIOVs iovec entries, skipping empty buffers. Returns the number
+// of entries used; outLength is set to the number of bytes they cover, which is less than the total length of the chain
+// if the chain needs more than maxIOVs entries.
+size_t GatherPacketBufferChain(const System::PacketBufferHandle & chain, struct iovec * iov, size_t maxIOVs, size_t & outLength)
+{
+    size_t count = 0;
+    outLength    = 0;
+    for (System::PacketBufferHandle buf = chain.Retain(); !buf.IsNull() && count < maxIOVs; buf.Advance())
+    {
+        if (buf->DataLength() == 0)
+        {
+            continue;
+        }
+        iov[count].iov_base = buf->Start();
+        iov[count].iov_len  = buf->DataLength();
+        outLength += buf->DataLength();
+        count++;
+    }
+    return count;
+}
+
+} // anonymous namespace
+
 CHIP_ERROR TCPEndPointImplSockets::BindImpl(IPAddressType addrType, const IPAddress & addr, uint16_t port, bool reuseAddr)
 {
     CHIP_ERROR res = GetSocket(addrType);
@@ -486,8 +511,23 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
     while (!mSendQueue.IsNull())
     {
         size_t bufLen = mSendQueue->DataLength();
+        ssize_t lenSentRaw;
 
-        ssize_t lenSentRaw = send(mSocket, mSendQueue->Start(), bufLen, sendFlags);
+        if (mSendQueue->HasChainedBuffer())
+        {
+            // Hand as much of the queue to the kernel as fits in one sendmsg(), without compacting the chain.
+            struct iovec sendIOV[INET_CONFIG_SOCKET_MAX_SEND_IOV];
+            struct msghdr msgHeader;
+            memset(&msgHeader, 0, sizeof(msgHeader));
+            msgHeader.msg_iov    = sendIOV;
+            msgHeader.msg_iovlen = GatherPacketBufferChain(mSendQueue, sendIOV, ArraySize(sendIOV), bufLen);
+
+            lenSentRaw = sendmsg(mSocket, &msgHeader, sendFlags);
+        }
+        else
+        {
+            lenSentRaw = send(mSocket, mSendQueue->Start(), bufLen, sendFlags);
+        }
 
         if (lenSentRaw == -1)
         {
@@ -509,21 +549,20 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
         // Mark the connection as being active.
         MarkActive();
 
-        if (lenSent < bufLen)
+        // Free the buffers that were sent completely, along with any empty ones that follow, and trim a partially sent one.
+        mSendQueue.Consume(lenSent);
+        while (!mSendQueue.IsNull() && mSendQueue->DataLength() == 0)
         {
-            mSendQueue->ConsumeHead(lenSent);
+            mSendQueue.FreeHead();
         }
-        else
+
+        if (mSendQueue.IsNull())
         {
-            mSendQueue.FreeHead();
-            if (mSendQueue.IsNull())
+            // Do not wait for ability to write on this endpoint.
+            err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
+            if (err != CHIP_NO_ERROR)
             {
-                // Do not wait for ability to write on this endpoint.
-                err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
-                if (err != CHIP_NO_ERROR)
-                {
-                    break;
-                }
+                break;
             }
         }
 
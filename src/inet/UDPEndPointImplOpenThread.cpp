@@ -54,7 +54,8 @@ void UDPEndPointImplOT::handleUdpReceive(void * aContext, otMessage * aMessage,
     char destStr[Inet::IPAddress::kMaxStringLength];
 #endif
 
-    if (ep->mState == State::kClosed)
+    // Messages received before Listen() are dropped by HandleDataReceived, do not allocate a buffer for them.
+    if (ep->mState != State::kListening)
         return;
 
     if (msgLen > System::PacketBuffer::kMaxSizeWithoutReserve)
@@ -94,6 +95,8 @@ void UDPEndPointImplOT::handleUdpReceive(void * aContext, otMessage * aMessage,
 
 #endif
 
+    // The otMessage cannot be borrowed instead: it belongs to OpenThread, which frees it when this callback returns, and its
+    // payload is spread over the buffers of the OpenThread message pool. This read is the only copy on the way in.
     if (otMessageRead(aMessage, 0, payload->Start(), msgLen) != msgLen)
     {
         ChipLogError(Inet, "Failed to copy OpenThread buffer into System Packet buffer");
@@ -237,10 +240,14 @@ CHIP_ERROR UDPEndPointImplOT::SendMsgImpl(const IPPacketInfo * aPktInfo, System:
     message = otUdpNewMessage(mOTInstance, NULL);
     VerifyOrExit(message != NULL, error = OT_ERROR_NO_BUFS);
 
+    // The message has to be moved into the OpenThread message pool, which owns it until the radio is done with it. This is
+    // the only copy on the way out.
     error = otMessageAppend(message, msg->Start(), static_cast<uint16_t>(msg->DataLength()));
 
     if (error == OT_ERROR_NONE)
     {
+        // Give the buffer back before OpenThread processes the message, which can take a while under the lock.
+        msg   = nullptr;
         error = otUdpSend(mOTInstance, &mSocket, message, &messageInfo);
     }
 
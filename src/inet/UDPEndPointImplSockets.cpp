@@ -26,6 +26,7 @@
 #define __APPLE_USE_RFC_3542
 #include <inet/UDPEndPointImplSockets.h>
 
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/logging/CHIPLogging.h>
@@ -43,6 +44,7 @@
 #include <zephyr/net/socket.h>
 #endif // CHIP_SYSTEM_CONFIG_USE_ZEPHYR_SOCKETS
 
+#include <algorithm>
 #include <cerrno>
 #include <unistd.h>
 #include <utility>
@@ -86,6 +88,43 @@
     "Neither IPV6_DROP_MEMBERSHIP nor IPV6_LEAVE_GROUP are defined which are required for generalized IPv6 multicast group support."
 #endif // IPV6_DROP_MEMBERSHIP
 
+#if INET_CONFIG_UDP_SOCKET_BATCH_IO && !defined(__linux__)
+#error "INET_CONFIG_UDP_SOCKET_BATCH_IO requires recvmmsg() and sendmmsg(), which are only available on Linux."
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_IO && !defined(__linux__)
+
+#if INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS > 0 && !defined(__linux__)
+#error "INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS relies on the IPV6_MULTICAST_ALL delivery of Linux."
+#endif // INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS > 0 && !defined(__linux__)
+
+// Not exposed by older C libraries; the option exists since Linux 4.20, and earlier kernels behave as if it were set.
+#if INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS > 0 && !defined(IPV6_MULTICAST_ALL)
+#define IPV6_MULTICAST_ALL 29
+#endif // INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS > 0 && !defined(IPV6_MULTICAST_ALL)
+
+#if (INET_CONFIG_UDP_SOCKET_GSO || INET_CONFIG_UDP_SOCKET_GRO) && !INET_CONFIG_UDP_SOCKET_BATCH_IO
+#error "INET_CONFIG_UDP_SOCKET_GSO and INET_CONFIG_UDP_SOCKET_GRO require INET_CONFIG_UDP_SOCKET_BATCH_IO."
+#endif // (INET_CONFIG_UDP_SOCKET_GSO || INET_CONFIG_UDP_SOCKET_GRO) && !INET_CONFIG_UDP_SOCKET_BATCH_IO
+
+#if INET_CONFIG_UDP_SOCKET_GRO && CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE != 0
+#error "INET_CONFIG_UDP_SOCKET_GRO requires packet buffers allocated from the heap, for its large receive buffers."
+#endif // INET_CONFIG_UDP_SOCKET_GRO && CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE != 0
+
+#if INET_CONFIG_UDP_SOCKET_GSO || INET_CONFIG_UDP_SOCKET_GRO
+#include <netinet/udp.h>
+
+// Older C libraries do not have the segmentation offload options yet; the endpoint checks at run time whether the kernel
+// has them.
+#ifndef SOL_UDP
+#define SOL_UDP 17
+#endif
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+#endif // INET_CONFIG_UDP_SOCKET_GSO || INET_CONFIG_UDP_SOCKET_GRO
+
 namespace chip {
 namespace Inet {
 
@@ -171,8 +210,290 @@ CHIP_ERROR IPv4Bind(int socket, const IPAddress & address, uint16_t port)
 }
 #endif // INET_CONFIG_ENABLE_IPV4
 
+// Describe the data of a PacketBuffer chain with at most maxIOVs iovec entries, skipping empty buffers. Returns the number
+// of entries used; outLength is set to the number of bytes they cover, which is less than the total length of the chain
+// if the chain needs more than maxIOVs entries.
+size_t GatherPacketBufferChain(const System::PacketBufferHandle & chain, struct iovec * iov, size_t maxIOVs, size_t & outLength)
+{
+    size_t count = 0;
+    outLength    = 0;
+    for (System::PacketBufferHandle buf = chain.Retain(); !buf.IsNull() && count < maxIOVs; buf.Advance())
+    {
+        if (buf->DataLength() == 0)
+        {
+            continue;
+        }
+        iov[count].iov_base = buf->Start();
+        iov[count].iov_len  = buf->DataLength();
+        outLength += buf->DataLength();
+        count++;
+    }
+    return count;
+}
+
+// Fill in the destination address and, if needed, the IP_PKTINFO/IPV6_PKTINFO control message of an outgoing
+// datagram. The caller sets up msgHeader.msg_iov; peerSockAddr and controlData must outlive the send.
+CHIP_ERROR PrepareSendHeader(IPAddressType addrType, InterfaceId boundIntfId, const IPPacketInfo & packetInfo,
+                             SockAddr & peerSockAddr, uint8_t * controlData, size_t controlDataSize, struct msghdr & msgHeader)
+{
+    memset(controlData, 0, controlDataSize);
+
+    // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
+    memset(&peerSockAddr, 0, sizeof(peerSockAddr));
+    msgHeader.msg_name = &peerSockAddr;
+    if (addrType == IPAddressType::kIPv6)
+    {
+        peerSockAddr.in6.sin6_family     = AF_INET6;
+        peerSockAddr.in6.sin6_port       = htons(packetInfo.DestPort);
+        peerSockAddr.in6.sin6_addr       = packetInfo.DestAddress.ToIPv6();
+        InterfaceId::PlatformType intfId = packetInfo.Interface.GetPlatformInterface();
+        VerifyOrReturnError(CanCastTo<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId), CHIP_ERROR_INCORRECT_STATE);
+        peerSockAddr.in6.sin6_scope_id = static_cast<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId);
+        msgHeader.msg_namelen          = sizeof(sockaddr_in6);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        peerSockAddr.in.sin_family = AF_INET;
+        peerSockAddr.in.sin_port   = htons(packetInfo.DestPort);
+        peerSockAddr.in.sin_addr   = packetInfo.DestAddress.ToIPv4();
+        msgHeader.msg_namelen      = sizeof(sockaddr_in);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+
+    // If the endpoint has been bound to a particular interface,
+    // and the caller didn't supply a specific interface to send
+    // on, use the bound interface. This appears to be necessary
+    // for messages to multicast addresses, which under Linux
+    // don't seem to get sent out the correct interface, despite
+    // the socket being bound.
+    InterfaceId intf = packetInfo.Interface;
+    if (!intf.IsPresent())
+    {
+        intf = boundIntfId;
+    }
+
+#if INET_CONFIG_UDP_SOCKET_PKTINFO
+    // If the packet should be sent over a specific interface, or with a specific source
+    // address, construct an IP_PKTINFO/IPV6_PKTINFO "control message" to that effect
+    // add add it to the message header.  If the local OS doesn't support IP_PKTINFO/IPV6_PKTINFO
+    // fail with an error.
+    if (intf.IsPresent() || packetInfo.SrcAddress.Type() != IPAddressType::kAny)
+    {
+#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
+        msgHeader.msg_control    = controlData;
+        msgHeader.msg_controllen = controlDataSize;
+
+        struct cmsghdr * controlHdr      = CMSG_FIRSTHDR(&msgHeader);
+        InterfaceId::PlatformType intfId = intf.GetPlatformInterface();
+
+#if INET_CONFIG_ENABLE_IPV4
+
+        if (addrType == IPAddressType::kIPv4)
+        {
+#if defined(IP_PKTINFO)
+            controlHdr->cmsg_level = IPPROTO_IP;
+            controlHdr->cmsg_type  = IP_PKTINFO;
+            controlHdr->cmsg_len   = CMSG_LEN(sizeof(in_pktinfo));
+
+            auto * pktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<decltype(pktInfo->ipi_ifindex)>(intfId))
+            {
+                return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+            }
+
+            pktInfo->ipi_ifindex  = static_cast<decltype(pktInfo->ipi_ifindex)>(intfId);
+            pktInfo->ipi_spec_dst = packetInfo.SrcAddress.ToIPv4();
+
+            msgHeader.msg_controllen = CMSG_SPACE(sizeof(in_pktinfo));
+#else  // !defined(IP_PKTINFO)
+            return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+#endif // !defined(IP_PKTINFO)
+        }
+
+#endif // INET_CONFIG_ENABLE_IPV4
+
+        if (addrType == IPAddressType::kIPv6)
+        {
+#if defined(IPV6_PKTINFO)
+            controlHdr->cmsg_level = IPPROTO_IPV6;
+            controlHdr->cmsg_type  = IPV6_PKTINFO;
+            controlHdr->cmsg_len   = CMSG_LEN(sizeof(in6_pktinfo));
+
+            auto * pktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<decltype(pktInfo->ipi6_ifindex)>(intfId))
+            {
+                return CHIP_ERROR_UNEXPECTED_EVENT;
+            }
+            pktInfo->ipi6_ifindex = static_cast<decltype(pktInfo->ipi6_ifindex)>(intfId);
+            pktInfo->ipi6_addr    = packetInfo.SrcAddress.ToIPv6();
+
+            msgHeader.msg_controllen = CMSG_SPACE(sizeof(in6_pktinfo));
+#else  // !defined(IPV6_PKTINFO)
+            return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+#endif // !defined(IPV6_PKTINFO)
+        }
+
+#else  // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
+        return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+#endif // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
+    }
+#endif // INET_CONFIG_UDP_SOCKET_PKTINFO
+
+    return CHIP_NO_ERROR;
+}
+
+// Record the length of a datagram received into buffer, and fill in its source and (from the IP_PKTINFO/IPV6_PKTINFO
+// control message) destination information.
+CHIP_ERROR ParseReceivedMessage(struct msghdr & msgHeader, size_t rcvLen, System::PacketBufferHandle & buffer,
+                                IPPacketInfo & packetInfo)
+{
+    VerifyOrReturnError(buffer->AvailableDataLength() >= rcvLen, CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG);
+    buffer->SetDataLength(static_cast<uint16_t>(rcvLen));
+
+    const SockAddr & peerSockAddr = *static_cast<const SockAddr *>(msgHeader.msg_name);
+    if (peerSockAddr.any.sa_family == AF_INET6)
+    {
+        packetInfo.SrcAddress = IPAddress(peerSockAddr.in6.sin6_addr);
+        packetInfo.SrcPort    = ntohs(peerSockAddr.in6.sin6_port);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else if (peerSockAddr.any.sa_family == AF_INET)
+    {
+        packetInfo.SrcAddress = IPAddress(peerSockAddr.in.sin_addr);
+        packetInfo.SrcPort    = ntohs(peerSockAddr.in.sin_port);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
+         controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
+    {
+#if INET_CONFIG_ENABLE_IPV4
+#ifdef IP_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
+        {
+            auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            VerifyOrReturnError(CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex), CHIP_ERROR_INCORRECT_STATE);
+            packetInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
+            packetInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
+            continue;
+        }
+#endif // defined(IP_PKTINFO)
+#endif // INET_CONFIG_ENABLE_IPV4
+
+#ifdef IPV6_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
+        {
+            auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            VerifyOrReturnError(CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex), CHIP_ERROR_INCORRECT_STATE);
+            packetInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
+            packetInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
+            continue;
+        }
+#endif // defined(IPV6_PKTINFO)
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+#if INET_CONFIG_UDP_SOCKET_GSO
+// The limits of a UDP_SEGMENT message: the kernel's UDP_MAX_SEGMENTS, and the largest IPv4 UDP payload.
+constexpr unsigned int kMaxSegments  = 64;
+constexpr size_t kMaxSegmentedLength = 65507;
+
+// Whether two queued datagrams go to the same peer, from the same source and interface, so that they can be segments of
+// one UDP_SEGMENT message.
+bool HaveSameSendPath(const struct msghdr & a, const struct msghdr & b)
+{
+    return a.msg_namelen == b.msg_namelen && memcmp(a.msg_name, b.msg_name, a.msg_namelen) == 0 &&
+        a.msg_controllen == b.msg_controllen &&
+        (a.msg_controllen == 0 || memcmp(a.msg_control, b.msg_control, a.msg_controllen) == 0);
+}
+#endif // INET_CONFIG_UDP_SOCKET_GSO
+
+#if INET_CONFIG_UDP_SOCKET_GRO
+// The size of the datagrams that the kernel coalesced into a received buffer (from the UDP_GRO control message), or 0 if the
+// buffer holds a single datagram.
+size_t GetReceivedSegmentSize(struct msghdr & msgHeader)
+{
+    for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
+         controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
+    {
+        if (controlHdr->cmsg_level == SOL_UDP && controlHdr->cmsg_type == UDP_GRO)
+        {
+            int segmentSize;
+            memcpy(&segmentSize, CMSG_DATA(controlHdr), sizeof(segmentSize));
+            return segmentSize > 0 ? static_cast<size_t>(segmentSize) : 0;
+        }
+    }
+    return 0;
+}
+#endif // INET_CONFIG_UDP_SOCKET_GRO
+
 } // anonymous namespace
 
+#if INET_CONFIG_UDP_SOCKET_BATCH_IO
+struct UDPEndPointImplSockets::BatchState
+{
+    struct ReceiveSlot
+    {
+        System::PacketBufferHandle mBuffer;
+        SockAddr mPeer;
+        struct iovec mIOV;
+        uint8_t mControl[256];
+    };
+
+    struct SendSlot
+    {
+        System::PacketBufferHandle mBuffer;
+        SockAddr mPeer;
+        struct iovec mIOV[INET_CONFIG_SOCKET_MAX_SEND_IOV];
+        uint8_t mControl[64];
+    };
+
+    static_assert(CMSG_SPACE(sizeof(in6_pktinfo)) <= sizeof(SendSlot::mControl),
+                  "SendSlot::mControl is too small for an IPV6_PKTINFO control message");
+
+    // Receive buffers that are not filled by a recvmmsg() stay allocated for the next one.
+    ReceiveSlot mReceive[INET_CONFIG_UDP_SOCKET_BATCH_SIZE];
+    struct mmsghdr mReceiveHeaders[INET_CONFIG_UDP_SOCKET_BATCH_SIZE];
+
+    SendSlot mSend[INET_CONFIG_UDP_SOCKET_BATCH_SIZE];
+    struct mmsghdr mSendHeaders[INET_CONFIG_UDP_SOCKET_BATCH_SIZE];
+    unsigned int mSendCount = 0;
+
+#if INET_CONFIG_UDP_SOCKET_GSO
+    // A run of queued datagrams that SendSegmentedQueue() hands to the kernel as one UDP_SEGMENT message.
+    struct SegmentedSend
+    {
+        unsigned int mFirst;
+        unsigned int mCount;
+        size_t mLength;
+        uint8_t mControl[64];
+    };
+
+    static_assert(CMSG_SPACE(sizeof(in6_pktinfo)) + CMSG_SPACE(sizeof(uint16_t)) <= sizeof(SegmentedSend::mControl),
+                  "SegmentedSend::mControl is too small for an IPV6_PKTINFO and a UDP_SEGMENT control message");
+
+    SegmentedSend mSegmented[INET_CONFIG_UDP_SOCKET_BATCH_SIZE];
+    struct mmsghdr mSegmentedHeaders[INET_CONFIG_UDP_SOCKET_BATCH_SIZE];
+    struct iovec mSegmentedIOV[INET_CONFIG_UDP_SOCKET_BATCH_SIZE * INET_CONFIG_SOCKET_MAX_SEND_IOV];
+
+    // Cleared when the kernel lacks UDP_SEGMENT or the device failed a segmented send.
+    bool mSegmentationOffload = false;
+#endif // INET_CONFIG_UDP_SOCKET_GSO
+
+#if INET_CONFIG_UDP_SOCKET_GRO
+    // Set when the kernel accepted UDP_GRO, so that it may coalesce datagrams into the (then large) receive buffers.
+    bool mReceiveOffload = false;
+#endif // INET_CONFIG_UDP_SOCKET_GRO
+};
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_IO
+
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
 UDPEndPointImplSockets::MulticastGroupHandler UDPEndPointImplSockets::sMulticastGroupHandler;
 #endif // CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
@@ -275,6 +596,11 @@ uint16_t UDPEndPointImplSockets::GetBoundPort() const
 
 CHIP_ERROR UDPEndPointImplSockets::ListenImpl()
 {
+#if INET_CONFIG_UDP_SOCKET_GRO
+    // Enable UDP_GRO before anything is received, since the kernel only coalesces datagrams for sockets that have it.
+    ReturnErrorOnFailure(EnsureBatchState());
+#endif // INET_CONFIG_UDP_SOCKET_GRO
+
     // Wait for ability to read on this endpoint.
     auto * layer = static_cast<System::LayerSockets *>(&GetSystemLayer());
     ReturnErrorOnFailure(layer->SetCallback(mWatch, HandlePendingIO, reinterpret_cast<intptr_t>(this)));
@@ -293,125 +619,49 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     // Ensure the destination address type is compatible with the endpoint address type.
     VerifyOrReturnError(mAddrType == aPktInfo->DestAddress.Type(), CHIP_ERROR_INVALID_ARGUMENT);
 
-    // For now the entire message must fit within a single buffer.
-    VerifyOrReturnError(!msg->HasChainedBuffer(), CHIP_ERROR_MESSAGE_TOO_LONG);
-
-    struct iovec msgIOV;
-    msgIOV.iov_base = msg->Start();
-    msgIOV.iov_len  = msg->DataLength();
-
-#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-    uint8_t controlData[256];
-    memset(controlData, 0, sizeof(controlData));
-#endif // defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
+#if INET_CONFIG_UDP_SOCKET_BATCH_IO
+    ReturnErrorOnFailure(EnsureBatchState());
 
-    struct msghdr msgHeader;
+    // Queue the datagram; FlushSendQueue() hands the whole queue to the kernel with a single sendmmsg().
+    BatchState::SendSlot & slot = mBatch->mSend[mBatch->mSendCount];
+    struct msghdr & msgHeader   = mBatch->mSendHeaders[mBatch->mSendCount].msg_hdr;
     memset(&msgHeader, 0, sizeof(msgHeader));
-    msgHeader.msg_iov    = &msgIOV;
-    msgHeader.msg_iovlen = 1;
 
-    // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
-    SockAddr peerSockAddr;
-    memset(&peerSockAddr, 0, sizeof(peerSockAddr));
-    msgHeader.msg_name = &peerSockAddr;
-    if (mAddrType == IPAddressType::kIPv6)
+    // A buffer chain is sent in place, one iovec per buffer.
+    size_t msgLen        = 0;
+    msgHeader.msg_iov    = slot.mIOV;
+    msgHeader.msg_iovlen = GatherPacketBufferChain(msg, slot.mIOV, ArraySize(slot.mIOV), msgLen);
+    VerifyOrReturnError(msgLen == msg->TotalLength(), CHIP_ERROR_MESSAGE_TOO_LONG);
+
+    ReturnErrorOnFailure(
+        PrepareSendHeader(mAddrType, mBoundIntfId, *aPktInfo, slot.mPeer, slot.mControl, sizeof(slot.mControl), msgHeader));
+    slot.mBuffer = std::move(msg);
+    mBatch->mSendCount++;
+
+    // The first queued datagram schedules a flush for the next event loop iteration, so that everything sent from the
+    // current iteration shares one system call. A full queue, or a failure to schedule, flushes right away.
+    if (mBatch->mSendCount == INET_CONFIG_UDP_SOCKET_BATCH_SIZE ||
+        (mBatch->mSendCount == 1 && GetSystemLayer().StartTimer(System::Clock::kZero, HandleFlushSendQueue, this) != CHIP_NO_ERROR))
     {
-        peerSockAddr.in6.sin6_family     = AF_INET6;
-        peerSockAddr.in6.sin6_port       = htons(aPktInfo->DestPort);
-        peerSockAddr.in6.sin6_addr       = aPktInfo->DestAddress.ToIPv6();
-        InterfaceId::PlatformType intfId = aPktInfo->Interface.GetPlatformInterface();
-        VerifyOrReturnError(CanCastTo<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId), CHIP_ERROR_INCORRECT_STATE);
-        peerSockAddr.in6.sin6_scope_id = static_cast<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId);
-        msgHeader.msg_namelen          = sizeof(sockaddr_in6);
-    }
-#if INET_CONFIG_ENABLE_IPV4
-    else
-    {
-        peerSockAddr.in.sin_family = AF_INET;
-        peerSockAddr.in.sin_port   = htons(aPktInfo->DestPort);
-        peerSockAddr.in.sin_addr   = aPktInfo->DestAddress.ToIPv4();
-        msgHeader.msg_namelen      = sizeof(sockaddr_in);
-    }
-#endif // INET_CONFIG_ENABLE_IPV4
-
-    // If the endpoint has been bound to a particular interface,
-    // and the caller didn't supply a specific interface to send
-    // on, use the bound interface. This appears to be necessary
-    // for messages to multicast addresses, which under Linux
-    // don't seem to get sent out the correct interface, despite
-    // the socket being bound.
-    InterfaceId intf = aPktInfo->Interface;
-    if (!intf.IsPresent())
-    {
-        intf = mBoundIntfId;
+        FlushSendQueue();
     }
+    return CHIP_NO_ERROR;
+#else  // !INET_CONFIG_UDP_SOCKET_BATCH_IO
+    uint8_t controlData[256];
 
-#if INET_CONFIG_UDP_SOCKET_PKTINFO
-    // If the packet should be sent over a specific interface, or with a specific source
-    // address, construct an IP_PKTINFO/IPV6_PKTINFO "control message" to that effect
-    // add add it to the message header.  If the local OS doesn't support IP_PKTINFO/IPV6_PKTINFO
-    // fail with an error.
-    if (intf.IsPresent() || aPktInfo->SrcAddress.Type() != IPAddressType::kAny)
-    {
-#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-        msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
-
-        struct cmsghdr * controlHdr      = CMSG_FIRSTHDR(&msgHeader);
-        InterfaceId::PlatformType intfId = intf.GetPlatformInterface();
-
-#if INET_CONFIG_ENABLE_IPV4
-
-        if (mAddrType == IPAddressType::kIPv4)
-        {
-#if defined(IP_PKTINFO)
-            controlHdr->cmsg_level = IPPROTO_IP;
-            controlHdr->cmsg_type  = IP_PKTINFO;
-            controlHdr->cmsg_len   = CMSG_LEN(sizeof(in_pktinfo));
-
-            auto * pktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-            if (!CanCastTo<decltype(pktInfo->ipi_ifindex)>(intfId))
-            {
-                return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-            }
-
-            pktInfo->ipi_ifindex  = static_cast<decltype(pktInfo->ipi_ifindex)>(intfId);
-            pktInfo->ipi_spec_dst = aPktInfo->SrcAddress.ToIPv4();
-
-            msgHeader.msg_controllen = CMSG_SPACE(sizeof(in_pktinfo));
-#else  // !defined(IP_PKTINFO)
-            return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-#endif // !defined(IP_PKTINFO)
-        }
-
-#endif // INET_CONFIG_ENABLE_IPV4
-
-        if (mAddrType == IPAddressType::kIPv6)
-        {
-#if defined(IPV6_PKTINFO)
-            controlHdr->cmsg_level = IPPROTO_IPV6;
-            controlHdr->cmsg_type  = IPV6_PKTINFO;
-            controlHdr->cmsg_len   = CMSG_LEN(sizeof(in6_pktinfo));
-
-            auto * pktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-            if (!CanCastTo<decltype(pktInfo->ipi6_ifindex)>(intfId))
-            {
-                return CHIP_ERROR_UNEXPECTED_EVENT;
-            }
-            pktInfo->ipi6_ifindex = static_cast<decltype(pktInfo->ipi6_ifindex)>(intfId);
-            pktInfo->ipi6_addr    = aPktInfo->SrcAddress.ToIPv6();
+    // A buffer chain is sent in place, one iovec per buffer.
+    struct iovec msgIOV[INET_CONFIG_SOCKET_MAX_SEND_IOV];
+    size_t msgLen = 0;
 
-            msgHeader.msg_controllen = CMSG_SPACE(sizeof(in6_pktinfo));
-#else  // !defined(IPV6_PKTINFO)
-            return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-#endif // !defined(IPV6_PKTINFO)
-        }
+    struct msghdr msgHeader;
+    memset(&msgHeader, 0, sizeof(msgHeader));
+    msgHeader.msg_iov    = msgIOV;
+    msgHeader.msg_iovlen = GatherPacketBufferChain(msg, msgIOV, ArraySize(msgIOV), msgLen);
+    VerifyOrReturnError(msgLen == msg->TotalLength(), CHIP_ERROR_MESSAGE_TOO_LONG);
 
-#else  // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
-        return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-#endif // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
-    }
-#endif // INET_CONFIG_UDP_SOCKET_PKTINFO
+    SockAddr peerSockAddr;
+    ReturnErrorOnFailure(
+        PrepareSendHeader(mAddrType, mBoundIntfId, *aPktInfo, peerSockAddr, controlData, sizeof(controlData), msgHeader));
 
     // Send IP packet.
     // NOLINTNEXTLINE(clang-analyzer-unix.StdCLibraryFunctions): GetSocket calls ensure mSocket is valid
@@ -423,21 +673,46 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
 
     size_t len = static_cast<size_t>(lenSent);
 
-    if (len != msg->DataLength())
+    if (len != msgLen)
     {
         return CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
     }
     return CHIP_NO_ERROR;
+#endif // !INET_CONFIG_UDP_SOCKET_BATCH_IO
 }
 
 void UDPEndPointImplSockets::CloseImpl()
 {
     if (mSocket != kInvalidSocketFd)
     {
+#if INET_CONFIG_UDP_SOCKET_BATCH_IO
+        // Send whatever is still queued while the socket is open.
+        if (mBatch != nullptr)
+        {
+            GetSystemLayer().CancelTimer(HandleFlushSendQueue, this);
+            FlushSendQueue();
+        }
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_IO
         static_cast<System::LayerSockets *>(&GetSystemLayer())->StopWatchingSocket(&mWatch);
         close(mSocket);
         mSocket = kInvalidSocketFd;
     }
+
+#if INET_CONFIG_UDP_SOCKET_BATCH_IO
+    Platform::Delete(mBatch);
+    mBatch = nullptr;
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_IO
+
+#if INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS > 0
+    for (int & fd : mMulticastOverflowSockets)
+    {
+        if (fd != kInvalidSocketFd)
+        {
+            close(fd);
+            fd = kInvalidSocketFd;
+        }
+    }
+#endif // INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS > 0
 }
 
 void UDPEndPointImplSockets::Free()
@@ -582,6 +857,9 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
         return;
     }
 
+#if INET_CONFIG_UDP_SOCKET_BATCH_IO
+    HandleBatchedReceive();
+#else  // !INET_CONFIG_UDP_SOCKET_BATCH_IO
     CHIP_ERROR lStatus = CHIP_NO_ERROR;
     IPPacketInfo lPacketInfo;
     System::PacketBufferHandle lBuffer;
@@ -619,89 +897,374 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
         {
             lStatus = CHIP_ERROR_POSIX(errno);
         }
-        else if (lBuffer->AvailableDataLength() < static_cast<size_t>(rcvLen))
+        else
         {
-            lStatus = CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG;
+            lStatus = ParseReceivedMessage(msgHeader, static_cast<size_t>(rcvLen), lBuffer, lPacketInfo);
         }
-        else
+    }
+    else
+    {
+        lStatus = CHIP_ERROR_NO_MEMORY;
+    }
+
+    if (lStatus == CHIP_NO_ERROR)
+    {
+        lBuffer.RightSize();
+        OnMessageReceived(this, std::move(lBuffer), &lPacketInfo);
+    }
+    else
+    {
+        if (OnReceiveError != nullptr && lStatus != CHIP_ERROR_POSIX(EAGAIN))
         {
-            lBuffer->SetDataLength(static_cast<uint16_t>(rcvLen));
+            OnReceiveError(this, lStatus, nullptr);
+        }
+    }
+#endif // !INET_CONFIG_UDP_SOCKET_BATCH_IO
+}
 
-            if (lPeerSockAddr.any.sa_family == AF_INET6)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in6.sin6_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
-            }
-#if INET_CONFIG_ENABLE_IPV4
-            else if (lPeerSockAddr.any.sa_family == AF_INET)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in.sin_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
-            }
-#endif // INET_CONFIG_ENABLE_IPV4
-            else
+#if INET_CONFIG_UDP_SOCKET_BATCH_IO
+CHIP_ERROR UDPEndPointImplSockets::EnsureBatchState()
+{
+    if (mBatch == nullptr)
+    {
+        mBatch = Platform::New<BatchState>();
+        VerifyOrReturnError(mBatch != nullptr, CHIP_ERROR_NO_MEMORY);
+
+#if INET_CONFIG_UDP_SOCKET_GSO
+        // Kernels without UDP_SEGMENT ignore its control message, and would send coalesced datagrams as one: check for the
+        // socket option, which came with it, first.
+        int segmentSize              = 0;
+        mBatch->mSegmentationOffload = setsockopt(mSocket, SOL_UDP, UDP_SEGMENT, &segmentSize, sizeof(segmentSize)) == 0;
+#endif // INET_CONFIG_UDP_SOCKET_GSO
+
+#if INET_CONFIG_UDP_SOCKET_GRO
+        constexpr int one       = 1;
+        mBatch->mReceiveOffload = setsockopt(mSocket, SOL_UDP, UDP_GRO, &one, sizeof(one)) == 0;
+#endif // INET_CONFIG_UDP_SOCKET_GRO
+    }
+    return CHIP_NO_ERROR;
+}
+
+void UDPEndPointImplSockets::HandleBatchedReceive()
+{
+    CHIP_ERROR lStatus = EnsureBatchState();
+    unsigned int count = 0;
+
+    size_t bufferSize = System::PacketBuffer::kMaxSizeWithoutReserve;
+#if INET_CONFIG_UDP_SOCKET_GRO
+    if (lStatus == CHIP_NO_ERROR && mBatch->mReceiveOffload)
+    {
+        bufferSize = System::PacketBuffer::kMaxAllocSize;
+    }
+#endif // INET_CONFIG_UDP_SOCKET_GRO
+
+    // Top up the receive buffers and (re)arm their message headers, since recvmmsg() overwrites the name and control lengths.
+    for (; lStatus == CHIP_NO_ERROR && count < INET_CONFIG_UDP_SOCKET_BATCH_SIZE; count++)
+    {
+        BatchState::ReceiveSlot & slot = mBatch->mReceive[count];
+        if (slot.mBuffer.IsNull())
+        {
+            slot.mBuffer = System::PacketBufferHandle::New(bufferSize, 0);
+            if (slot.mBuffer.IsNull())
             {
-                lStatus = CHIP_ERROR_INCORRECT_STATE;
+                break;
             }
         }
 
-        if (lStatus == CHIP_NO_ERROR)
+        slot.mIOV.iov_base = slot.mBuffer->Start();
+        slot.mIOV.iov_len  = slot.mBuffer->AvailableDataLength();
+        memset(&slot.mPeer, 0, sizeof(slot.mPeer));
+
+        struct msghdr & msgHeader = mBatch->mReceiveHeaders[count].msg_hdr;
+        memset(&msgHeader, 0, sizeof(msgHeader));
+        msgHeader.msg_name       = &slot.mPeer;
+        msgHeader.msg_namelen    = sizeof(slot.mPeer);
+        msgHeader.msg_iov        = &slot.mIOV;
+        msgHeader.msg_iovlen     = 1;
+        msgHeader.msg_control    = slot.mControl;
+        msgHeader.msg_controllen = sizeof(slot.mControl);
+    }
+
+    int received = 0;
+    if (lStatus == CHIP_NO_ERROR && count == 0)
+    {
+        lStatus = CHIP_ERROR_NO_MEMORY;
+    }
+    else if (lStatus == CHIP_NO_ERROR)
+    {
+        received = recvmmsg(mSocket, mBatch->mReceiveHeaders, count, MSG_DONTWAIT, nullptr);
+        if (received == -1)
+        {
+            lStatus = CHIP_ERROR_POSIX(errno);
+        }
+    }
+
+    if (lStatus != CHIP_NO_ERROR)
+    {
+        if (OnReceiveError != nullptr && lStatus != CHIP_ERROR_POSIX(EAGAIN))
+        {
+            OnReceiveError(this, lStatus, nullptr);
+        }
+        return;
+    }
+
+    // Take the received datagrams out of mBatch before delivering any of them, since OnMessageReceived() may close this
+    // endpoint, and that releases mBatch.
+    System::PacketBufferHandle buffers[INET_CONFIG_UDP_SOCKET_BATCH_SIZE];
+    IPPacketInfo packetInfos[INET_CONFIG_UDP_SOCKET_BATCH_SIZE];
+    CHIP_ERROR statuses[INET_CONFIG_UDP_SOCKET_BATCH_SIZE];
+#if INET_CONFIG_UDP_SOCKET_GRO
+    size_t segmentSizes[INET_CONFIG_UDP_SOCKET_BATCH_SIZE];
+#endif // INET_CONFIG_UDP_SOCKET_GRO
+
+    for (int i = 0; i < received; i++)
+    {
+        BatchState::ReceiveSlot & slot = mBatch->mReceive[i];
+        struct msghdr & msgHeader      = mBatch->mReceiveHeaders[i].msg_hdr;
+
+        packetInfos[i].Clear();
+        packetInfos[i].DestPort  = mBoundPort;
+        packetInfos[i].Interface = mBoundIntfId;
+
+        statuses[i] = ParseReceivedMessage(msgHeader, mBatch->mReceiveHeaders[i].msg_len, slot.mBuffer, packetInfos[i]);
+#if INET_CONFIG_UDP_SOCKET_GRO
+        segmentSizes[i] = GetReceivedSegmentSize(msgHeader);
+        if (statuses[i] == CHIP_NO_ERROR && segmentSizes[i] != 0 && (msgHeader.msg_flags & MSG_TRUNC))
+        {
+            // Coalesced datagrams that did not fit are lost; drop the one that was cut short with them.
+            const size_t length = slot.mBuffer->DataLength();
+            ChipLogError(Inet, "UDP coalesced receive truncated after %u bytes", static_cast<unsigned>(length));
+            slot.mBuffer->SetDataLength(length - length % segmentSizes[i]);
+        }
+#endif // INET_CONFIG_UDP_SOCKET_GRO
+        if (statuses[i] == CHIP_NO_ERROR)
         {
-            for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
-                 controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
+            buffers[i] = std::move(slot.mBuffer);
+        }
+        else
+        {
+            // Keep the buffer for the next recvmmsg().
+            slot.mBuffer->SetDataLength(0);
+        }
+    }
+
+    // Hold a reference so that an application callback freeing the endpoint does not pull it out from under this loop.
+    Retain();
+    for (int i = 0; i < received && mState == State::kListening; i++)
+    {
+#if INET_CONFIG_UDP_SOCKET_GRO
+        if (statuses[i] == CHIP_NO_ERROR && segmentSizes[i] != 0)
+        {
+            // Split the datagrams that the kernel coalesced; they all share the source and destination information.
+            const uint8_t * data = buffers[i]->Start();
+            size_t remaining     = buffers[i]->DataLength();
+            while (remaining > 0 && mState == State::kListening && OnMessageReceived != nullptr)
             {
-#if INET_CONFIG_ENABLE_IPV4
-#ifdef IP_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
+                const size_t length                = std::min(remaining, segmentSizes[i]);
+                System::PacketBufferHandle segment = System::PacketBufferHandle::NewWithData(data, length, 0, 0);
+                if (segment.IsNull())
                 {
-                    auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
+                    if (OnReceiveError != nullptr)
                     {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
+                        OnReceiveError(this, CHIP_ERROR_NO_MEMORY, nullptr);
                     }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
-                    continue;
+                    break;
                 }
-#endif // defined(IP_PKTINFO)
-#endif // INET_CONFIG_ENABLE_IPV4
+                OnMessageReceived(this, std::move(segment), &packetInfos[i]);
+                data += length;
+                remaining -= length;
+            }
+            continue;
+        }
+#endif // INET_CONFIG_UDP_SOCKET_GRO
 
-#ifdef IPV6_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
+        if (statuses[i] == CHIP_NO_ERROR && OnMessageReceived != nullptr)
+        {
+            buffers[i].RightSize();
+            OnMessageReceived(this, std::move(buffers[i]), &packetInfos[i]);
+        }
+        else if (statuses[i] != CHIP_NO_ERROR && OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, statuses[i], nullptr);
+        }
+    }
+    Release();
+}
+
+void UDPEndPointImplSockets::FlushSendQueue()
+{
+    const unsigned int count = mBatch->mSendCount;
+    unsigned int sent        = 0;
+
+#if INET_CONFIG_UDP_SOCKET_GSO
+    sent = SendSegmentedQueue();
+#endif // INET_CONFIG_UDP_SOCKET_GSO
+
+    while (sent < count)
+    {
+        // NOLINTNEXTLINE(clang-analyzer-unix.StdCLibraryFunctions): a datagram is only queued after GetSocket succeeds
+        const int res = sendmmsg(mSocket, &mBatch->mSendHeaders[sent], count - sent, 0);
+        if (res > 0)
+        {
+            for (unsigned int i = sent; i < sent + static_cast<unsigned int>(res); i++)
+            {
+                if (mBatch->mSendHeaders[i].msg_len != mBatch->mSend[i].mBuffer->TotalLength())
                 {
-                    auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
-                    continue;
+                    ChipLogError(Inet, "UDP batched send truncated: %u of %u bytes", mBatch->mSendHeaders[i].msg_len,
+                                 static_cast<unsigned>(mBatch->mSend[i].mBuffer->TotalLength()));
                 }
-#endif // defined(IPV6_PKTINFO)
             }
+            sent += static_cast<unsigned int>(res);
+        }
+        else if (res == -1 && errno == EINTR)
+        {
+            continue;
+        }
+        else
+        {
+            // sendmmsg() only fails when the first datagram it was given could not be sent; drop that one and carry on with
+            // the rest of the queue.
+            ChipLogError(Inet, "UDP batched send failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+            sent++;
         }
     }
-    else
+
+    for (unsigned int i = 0; i < count; i++)
     {
-        lStatus = CHIP_ERROR_NO_MEMORY;
+        mBatch->mSend[i].mBuffer = nullptr;
     }
+    mBatch->mSendCount = 0;
+}
 
-    if (lStatus == CHIP_NO_ERROR)
+#if INET_CONFIG_UDP_SOCKET_GSO
+// Send the queue with runs of same-size datagrams to one peer coalesced into UDP_SEGMENT messages. Returns the number of
+// queued datagrams handled, which is short of the whole queue when a segmented message was rejected: FlushSendQueue() then
+// sends the rest without segmentation.
+unsigned int UDPEndPointImplSockets::SendSegmentedQueue()
+{
+    BatchState & batch       = *mBatch;
+    const unsigned int count = batch.mSendCount;
+    unsigned int messages    = 0;
+    size_t iovCount          = 0;
+
+    if (!batch.mSegmentationOffload)
     {
-        lBuffer.RightSize();
-        OnMessageReceived(this, std::move(lBuffer), &lPacketInfo);
+        return 0;
     }
-    else
+
+    unsigned int first = 0;
+    while (first < count)
     {
-        if (OnReceiveError != nullptr && lStatus != CHIP_ERROR_POSIX(EAGAIN))
+        BatchState::SegmentedSend & segmented = batch.mSegmented[messages];
+        const struct msghdr & head            = batch.mSendHeaders[first].msg_hdr;
+        const size_t segmentSize              = batch.mSend[first].mBuffer->TotalLength();
+
+        segmented.mFirst  = first;
+        segmented.mCount  = 1;
+        segmented.mLength = segmentSize;
+
+        // Every segment but the last has the size of the first one.
+        for (unsigned int next = first + 1; next < count && segmented.mCount < kMaxSegments; next++)
         {
-            OnReceiveError(this, lStatus, nullptr);
+            const size_t nextSize = batch.mSend[next].mBuffer->TotalLength();
+            if (batch.mSend[next - 1].mBuffer->TotalLength() != segmentSize || nextSize == 0 || nextSize > segmentSize ||
+                segmented.mLength + nextSize > kMaxSegmentedLength || !HaveSameSendPath(head, batch.mSendHeaders[next].msg_hdr))
+            {
+                break;
+            }
+            segmented.mCount++;
+            segmented.mLength += nextSize;
+        }
+
+        struct msghdr & msgHeader = batch.mSegmentedHeaders[messages].msg_hdr;
+        msgHeader                 = head;
+        first += segmented.mCount;
+        messages++;
+        if (segmented.mCount == 1)
+        {
+            continue;
         }
+
+        msgHeader.msg_iov    = &batch.mSegmentedIOV[iovCount];
+        msgHeader.msg_iovlen = 0;
+        for (unsigned int i = segmented.mFirst; i < first; i++)
+        {
+            const struct msghdr & datagram = batch.mSendHeaders[i].msg_hdr;
+            memcpy(&batch.mSegmentedIOV[iovCount], datagram.msg_iov, datagram.msg_iovlen * sizeof(struct iovec));
+            iovCount += datagram.msg_iovlen;
+            msgHeader.msg_iovlen += datagram.msg_iovlen;
+        }
+
+        // Keep the IP_PKTINFO/IPV6_PKTINFO control message of the datagrams, if any, and add the segment size after it.
+        memset(segmented.mControl, 0, sizeof(segmented.mControl));
+        if (head.msg_controllen != 0)
+        {
+            memcpy(segmented.mControl, head.msg_control, head.msg_controllen);
+        }
+        msgHeader.msg_control    = segmented.mControl;
+        msgHeader.msg_controllen = head.msg_controllen + CMSG_SPACE(sizeof(uint16_t));
+
+        auto * controlHdr      = reinterpret_cast<struct cmsghdr *>(&segmented.mControl[head.msg_controllen]);
+        controlHdr->cmsg_level = SOL_UDP;
+        controlHdr->cmsg_type  = UDP_SEGMENT;
+        controlHdr->cmsg_len   = CMSG_LEN(sizeof(uint16_t));
+        const uint16_t gsoSize = static_cast<uint16_t>(segmentSize);
+        memcpy(CMSG_DATA(controlHdr), &gsoSize, sizeof(gsoSize));
+    }
+
+    unsigned int sent = 0;
+    while (sent < messages)
+    {
+        // NOLINTNEXTLINE(clang-analyzer-unix.StdCLibraryFunctions): a datagram is only queued after GetSocket succeeds
+        const int res = sendmmsg(mSocket, &batch.mSegmentedHeaders[sent], messages - sent, 0);
+        if (res > 0)
+        {
+            for (unsigned int i = sent; i < sent + static_cast<unsigned int>(res); i++)
+            {
+                if (batch.mSegmentedHeaders[i].msg_len != batch.mSegmented[i].mLength)
+                {
+                    ChipLogError(Inet, "UDP segmented send truncated: %u of %u bytes", batch.mSegmentedHeaders[i].msg_len,
+                                 static_cast<unsigned>(batch.mSegmented[i].mLength));
+                }
+            }
+            sent += static_cast<unsigned int>(res);
+            continue;
+        }
+
+        const int error = errno;
+        if (res == -1 && error == EINTR)
+        {
+            continue;
+        }
+        if (batch.mSegmented[sent].mCount > 1)
+        {
+            // EIO means the device cannot checksum segmented messages, so stop trying; other failures (e.g. EINVAL for
+            // segments larger than the path MTU) only concern this message.
+            ChipLogDetail(Inet, "UDP segmented send failed, sending without segmentation: %" CHIP_ERROR_FORMAT,
+                          CHIP_ERROR_POSIX(error).Format());
+            batch.mSegmentationOffload = (error != EIO);
+            return batch.mSegmented[sent].mFirst;
+        }
+
+        // As in FlushSendQueue(), drop the datagram that could not be sent and carry on.
+        ChipLogError(Inet, "UDP batched send failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(error).Format());
+        sent++;
+    }
+
+    return count;
+}
+#endif // INET_CONFIG_UDP_SOCKET_GSO
+
+// static
+void UDPEndPointImplSockets::HandleFlushSendQueue(System::Layer * aLayer, void * aAppState)
+{
+    auto * endPoint = static_cast<UDPEndPointImplSockets *>(aAppState);
+    if (endPoint->mBatch != nullptr)
+    {
+        endPoint->FlushSendQueue();
     }
 }
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_IO
 
 #ifdef IPV6_MULTICAST_LOOP
 static CHIP_ERROR SocketsSetMulticastLoopback(int aSocket, bool aLoopback, int aProtocol, int aOption)
@@ -894,13 +1457,79 @@ CHIP_ERROR UDPEndPointImplSockets::IPv6JoinLeaveMulticastGroupImpl(InterfaceId a
     const int command = join ? INET_IPV6_ADD_MEMBERSHIP : INET_IPV6_DROP_MEMBERSHIP;
     if (setsockopt(mSocket, IPPROTO_IPV6, command, &lMulticastRequest, sizeof(lMulticastRequest)) != 0)
     {
+#if INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS > 0
+        // ENOMEM (ENOBUFS on some kernels): the memberships of the socket are at the limit; EADDRNOTAVAIL: not a membership
+        // of the socket.
+        if ((join && (errno == ENOMEM || errno == ENOBUFS)) || (!join && errno == EADDRNOTAVAIL))
+        {
+            return JoinLeaveOverflowMulticastGroup(lMulticastRequest, join);
+        }
+#endif // INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS > 0
         return CHIP_ERROR_POSIX(errno);
     }
+#if INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS > 0
+    if (!join)
+    {
+        // The group may also have been joined on an overflow socket while mSocket was full.
+        JoinLeaveOverflowMulticastGroup(lMulticastRequest, false);
+    }
+#endif // INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS > 0
     return CHIP_NO_ERROR;
 #else
     return CHIP_ERROR_NOT_IMPLEMENTED;
 #endif
 }
 
+#if INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS > 0
+CHIP_ERROR UDPEndPointImplSockets::JoinLeaveOverflowMulticastGroup(const ipv6_mreq & request, bool join)
+{
+    if (!join)
+    {
+        bool left = false;
+        for (int fd : mMulticastOverflowSockets)
+        {
+            if (fd != kInvalidSocketFd && setsockopt(fd, IPPROTO_IPV6, INET_IPV6_DROP_MEMBERSHIP, &request, sizeof(request)) == 0)
+            {
+                left = true;
+            }
+        }
+        return left ? CHIP_NO_ERROR : CHIP_ERROR_POSIX(EADDRNOTAVAIL);
+    }
+
+    // The datagrams of the groups joined elsewhere are delivered to mSocket only with IPV6_MULTICAST_ALL, the default.
+    const int multicastAll = 1;
+    if (setsockopt(mSocket, IPPROTO_IPV6, IPV6_MULTICAST_ALL, &multicastAll, sizeof(multicastAll)) != 0 && errno != ENOPROTOOPT)
+    {
+        return CHIP_ERROR_POSIX(errno);
+    }
+
+    for (int & fd : mMulticastOverflowSockets)
+    {
+        if (fd == kInvalidSocketFd)
+        {
+            // Never bound, so that it receives nothing itself.
+            fd = socket(AF_INET6, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+            if (fd == kInvalidSocketFd)
+            {
+                return CHIP_ERROR_POSIX(errno);
+            }
+        }
+
+        if (setsockopt(fd, IPPROTO_IPV6, INET_IPV6_ADD_MEMBERSHIP, &request, sizeof(request)) == 0)
+        {
+            return CHIP_NO_ERROR;
+        }
+        if (errno != ENOMEM && errno != ENOBUFS)
+        {
+            return CHIP_ERROR_POSIX(errno);
+        }
+    }
+
+    ChipLogError(Inet, "All %u multicast overflow sockets are full",
+                 static_cast<unsigned>(INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS));
+    return CHIP_ERROR_POSIX(ENOMEM);
+}
+#endif // INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS > 0
+
 } // namespace Inet
 } // namespace chip
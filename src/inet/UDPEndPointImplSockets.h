@@ -34,7 +34,14 @@ class UDPEndPointImplSockets : public UDPEndPoint, public EndPointStateSockets
 public:
     UDPEndPointImplSockets(EndPointManager<UDPEndPoint> & endPointManager) :
         UDPEndPoint(endPointManager), mBoundIntfId(InterfaceId::Null())
-    {}
+    {
+#if INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS > 0
+        for (int & fd : mMulticastOverflowSockets)
+        {
+            fd = kInvalidSocketFd;
+        }
+#endif // INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS > 0
+    }
 
     // UDPEndPoint overrides.
     CHIP_ERROR SetMulticastLoopback(IPVersion aIPVersion, bool aLoopback) override;
@@ -61,6 +68,28 @@ private:
     InterfaceId mBoundIntfId;
     uint16_t mBoundPort;
 
+#if INET_CONFIG_UDP_SOCKET_BATCH_IO
+    struct BatchState;
+
+    CHIP_ERROR EnsureBatchState();
+    void HandleBatchedReceive();
+    void FlushSendQueue();
+#if INET_CONFIG_UDP_SOCKET_GSO
+    unsigned int SendSegmentedQueue();
+#endif // INET_CONFIG_UDP_SOCKET_GSO
+    static void HandleFlushSendQueue(System::Layer * aLayer, void * aAppState);
+
+    // Receive buffers and the pending send queue; allocated on first use and released by CloseImpl().
+    BatchState * mBatch = nullptr;
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_IO
+
+#if INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS > 0
+    CHIP_ERROR JoinLeaveOverflowMulticastGroup(const ipv6_mreq & request, bool join);
+
+    // IPv6 multicast memberships that did not fit on mSocket; opened on demand and closed by CloseImpl().
+    int mMulticastOverflowSockets[INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS];
+#endif // INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS > 0
+
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
 public:
     enum class MulticastOperation
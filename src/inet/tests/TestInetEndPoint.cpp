@@ -370,6 +370,225 @@ TEST_F(TestInetEndPoint, TestInetEndPointInternal)
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 }
 
+#if INET_CONFIG_UDP_SOCKET_BATCH_IO
+int batchedReceiveCount = 0;
+
+void HandleBatchedMessageReceived(UDPEndPoint * endPoint, PacketBufferHandle && buffer, const IPPacketInfo * packetInfo)
+{
+    EXPECT_EQ(buffer->DataLength(), 1u);
+    EXPECT_EQ(buffer->Start()[0], static_cast<uint8_t>(batchedReceiveCount));
+    batchedReceiveCount++;
+}
+
+// Send more datagrams than fit in one batch over the loopback interface, and check they all arrive, in order.
+TEST_F(TestInetEndPoint, TestInetUDPBatchedLoopback)
+{
+    constexpr int kNumMessages = 2 * INET_CONFIG_UDP_SOCKET_BATCH_SIZE + 1;
+
+    UDPEndPoint * receiver = nullptr;
+    UDPEndPoint * sender   = nullptr;
+    IPAddress loopback;
+
+    ASSERT_TRUE(IPAddress::FromString("::1", loopback));
+    ASSERT_EQ(gUDP.NewEndPoint(&receiver), CHIP_NO_ERROR);
+    ASSERT_EQ(gUDP.NewEndPoint(&sender), CHIP_NO_ERROR);
+    EXPECT_EQ(receiver->Bind(IPAddressType::kIPv6, loopback, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(receiver->Listen(HandleBatchedMessageReceived, nullptr), CHIP_NO_ERROR);
+    EXPECT_EQ(sender->Bind(IPAddressType::kIPv6, loopback, 0), CHIP_NO_ERROR);
+
+    batchedReceiveCount = 0;
+    for (int i = 0; i < kNumMessages; i++)
+    {
+        PacketBufferHandle buf = PacketBufferHandle::New(1);
+        ASSERT_FALSE(buf.IsNull());
+        buf->Start()[0] = static_cast<uint8_t>(i);
+        buf->SetDataLength(1);
+        EXPECT_EQ(sender->SendTo(loopback, receiver->GetBoundPort(), std::move(buf)), CHIP_NO_ERROR);
+    }
+
+    for (int i = 0; i < 100 && batchedReceiveCount < kNumMessages; i++)
+    {
+        ServiceEvents(10);
+    }
+    EXPECT_EQ(batchedReceiveCount, kNumMessages);
+
+    sender->Free();
+    receiver->Free();
+}
+
+// Datagram sizes of a burst to one peer: runs of equal sizes, each possibly ending with a shorter one, are what UDP_SEGMENT
+// sends and UDP_GRO receives coalesce.
+constexpr size_t kBurstSizes[] = { 40, 40, 40, 7, 40, 60, 60, 1, 1, 1, 1, 90 };
+size_t burstReceiveCount       = 0;
+
+void HandleBurstMessageReceived(UDPEndPoint * endPoint, PacketBufferHandle && buffer, const IPPacketInfo * packetInfo)
+{
+    ASSERT_LT(burstReceiveCount, ArraySize(kBurstSizes));
+    ASSERT_EQ(buffer->DataLength(), kBurstSizes[burstReceiveCount]);
+    for (size_t i = 0; i < buffer->DataLength(); i++)
+    {
+        EXPECT_EQ(buffer->Start()[i], static_cast<uint8_t>(burstReceiveCount));
+    }
+    burstReceiveCount++;
+}
+
+// Send a burst of datagrams of varying sizes over the loopback interface, and check they all arrive intact, in order.
+TEST_F(TestInetEndPoint, TestInetUDPBatchedMixedSizes)
+{
+    UDPEndPoint * receiver = nullptr;
+    UDPEndPoint * sender   = nullptr;
+    IPAddress loopback;
+
+    ASSERT_TRUE(IPAddress::FromString("::1", loopback));
+    ASSERT_EQ(gUDP.NewEndPoint(&receiver), CHIP_NO_ERROR);
+    ASSERT_EQ(gUDP.NewEndPoint(&sender), CHIP_NO_ERROR);
+    EXPECT_EQ(receiver->Bind(IPAddressType::kIPv6, loopback, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(receiver->Listen(HandleBurstMessageReceived, nullptr), CHIP_NO_ERROR);
+    EXPECT_EQ(sender->Bind(IPAddressType::kIPv6, loopback, 0), CHIP_NO_ERROR);
+
+    burstReceiveCount = 0;
+    for (size_t i = 0; i < ArraySize(kBurstSizes); i++)
+    {
+        PacketBufferHandle buf = PacketBufferHandle::New(kBurstSizes[i]);
+        ASSERT_FALSE(buf.IsNull());
+        memset(buf->Start(), static_cast<int>(i), kBurstSizes[i]);
+        buf->SetDataLength(kBurstSizes[i]);
+        EXPECT_EQ(sender->SendTo(loopback, receiver->GetBoundPort(), std::move(buf)), CHIP_NO_ERROR);
+    }
+
+    for (int i = 0; i < 100 && burstReceiveCount < ArraySize(kBurstSizes); i++)
+    {
+        ServiceEvents(10);
+    }
+    EXPECT_EQ(burstReceiveCount, ArraySize(kBurstSizes));
+
+    sender->Free();
+    receiver->Free();
+}
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_IO
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+PacketBufferHandle chainedSendReceived;
+
+void HandleChainedSendReceived(UDPEndPoint * endPoint, PacketBufferHandle && buffer, const IPPacketInfo * packetInfo)
+{
+    chainedSendReceived = std::move(buffer);
+}
+
+// Send a PacketBuffer chain over the loopback interface, and check it arrives as a single datagram.
+TEST_F(TestInetEndPoint, TestInetUDPChainedSend)
+{
+    constexpr size_t kNumBuffers   = 3;
+    constexpr size_t kBufferLength = 10;
+
+    UDPEndPoint * receiver = nullptr;
+    UDPEndPoint * sender   = nullptr;
+    IPAddress loopback;
+
+    ASSERT_TRUE(IPAddress::FromString("::1", loopback));
+    ASSERT_EQ(gUDP.NewEndPoint(&receiver), CHIP_NO_ERROR);
+    ASSERT_EQ(gUDP.NewEndPoint(&sender), CHIP_NO_ERROR);
+    EXPECT_EQ(receiver->Bind(IPAddressType::kIPv6, loopback, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(receiver->Listen(HandleChainedSendReceived, nullptr), CHIP_NO_ERROR);
+    EXPECT_EQ(sender->Bind(IPAddressType::kIPv6, loopback, 0), CHIP_NO_ERROR);
+
+    PacketBufferHandle chain;
+    for (size_t i = 0; i < kNumBuffers; i++)
+    {
+        PacketBufferHandle buf = PacketBufferHandle::New(kBufferLength);
+        ASSERT_FALSE(buf.IsNull());
+        memset(buf->Start(), static_cast<int>(i), kBufferLength);
+        buf->SetDataLength(kBufferLength);
+        chain.AddToEnd(std::move(buf));
+    }
+    EXPECT_TRUE(chain->HasChainedBuffer());
+    EXPECT_EQ(sender->SendTo(loopback, receiver->GetBoundPort(), std::move(chain)), CHIP_NO_ERROR);
+
+    for (int i = 0; i < 100 && chainedSendReceived.IsNull(); i++)
+    {
+        ServiceEvents(10);
+    }
+    ASSERT_FALSE(chainedSendReceived.IsNull());
+    EXPECT_FALSE(chainedSendReceived->HasChainedBuffer());
+    ASSERT_EQ(chainedSendReceived->DataLength(), kNumBuffers * kBufferLength);
+    for (size_t i = 0; i < kNumBuffers * kBufferLength; i++)
+    {
+        EXPECT_EQ(chainedSendReceived->Start()[i], i / kBufferLength);
+    }
+    chainedSendReceived = nullptr;
+
+    sender->Free();
+    receiver->Free();
+}
+
+#if INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS > 0
+size_t multicastReceiveCount = 0;
+
+void HandleMulticastMessageReceived(UDPEndPoint * endPoint, PacketBufferHandle && buffer, const IPPacketInfo * packetInfo)
+{
+    multicastReceiveCount++;
+}
+
+// Join more groups than a single socket may hold, and check the datagrams of the last one still reach the endpoint.
+TEST_F(TestInetEndPoint, TestInetUDPMulticastOverflow)
+{
+    // Above the ~2300 memberships the default net.core.optmem_max allows a socket
+    constexpr uint16_t kNumGroups = 3000;
+
+    InterfaceId interfaceId;
+    for (InterfaceIterator it; it.HasCurrent(); it.Next())
+    {
+        IPAddress linkLocal;
+        if (it.SupportsMulticast() && it.IsUp() && it.GetInterfaceId().GetLinkLocalAddr(&linkLocal) == CHIP_NO_ERROR)
+        {
+            interfaceId = it.GetInterfaceId();
+            break;
+        }
+    }
+    if (!interfaceId.IsPresent())
+    {
+        GTEST_SKIP() << "No multicast capable interface";
+    }
+
+    UDPEndPoint * receiver = nullptr;
+    UDPEndPoint * sender   = nullptr;
+    ASSERT_EQ(gUDP.NewEndPoint(&receiver), CHIP_NO_ERROR);
+    ASSERT_EQ(gUDP.NewEndPoint(&sender), CHIP_NO_ERROR);
+    EXPECT_EQ(receiver->Bind(IPAddressType::kIPv6, IPAddress::Any, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(receiver->Listen(HandleMulticastMessageReceived, nullptr), CHIP_NO_ERROR);
+    EXPECT_EQ(sender->Bind(IPAddressType::kIPv6, IPAddress::Any, 0, interfaceId), CHIP_NO_ERROR);
+    EXPECT_EQ(sender->SetMulticastLoopback(kIPVersion_6, true), CHIP_NO_ERROR);
+
+    IPAddress group;
+    for (uint16_t i = 0; i < kNumGroups; i++)
+    {
+        group = IPAddress::MakeIPv6PrefixMulticast(kIPv6MulticastScope_Site, 64, 0xFD00000000000000, i);
+        ASSERT_EQ(receiver->JoinMulticastGroup(interfaceId, group), CHIP_NO_ERROR) << "group " << i;
+    }
+
+    multicastReceiveCount  = 0;
+    PacketBufferHandle buf = PacketBufferHandle::New(1);
+    ASSERT_FALSE(buf.IsNull());
+    buf->SetDataLength(1);
+    EXPECT_EQ(sender->SendTo(group, receiver->GetBoundPort(), std::move(buf), interfaceId), CHIP_NO_ERROR);
+    for (int i = 0; i < 100 && multicastReceiveCount == 0; i++)
+    {
+        ServiceEvents(10);
+    }
+    EXPECT_EQ(multicastReceiveCount, 1u);
+
+    for (uint16_t i = 0; i < kNumGroups; i++)
+    {
+        group = IPAddress::MakeIPv6PrefixMulticast(kIPv6MulticastScope_Site, 64, 0xFD00000000000000, i);
+        EXPECT_EQ(receiver->LeaveMulticastGroup(interfaceId, group), CHIP_NO_ERROR) << "group " << i;
+    }
+
+    sender->Free();
+    receiver->Free();
+}
+#endif // INET_CONFIG_UDP_MULTICAST_OVERFLOW_SOCKETS > 0
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
 #if !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 // Test the Inet resource limitations.
 TEST_F(TestInetEndPoint, TestInetEndPointLimit)
@@ -16,6 +16,7 @@
  */
 #pragma once
 
+#include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/core/PeerId.h>
 #include <lib/support/IntrusiveList.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
@@ -37,6 +38,10 @@ struct ResolveResult
     bool supportsTcpClient   = false;
     bool isICDOperatingAsLIT = false;
 
+    // The address was known from a previous resolution of the node rather
+    // than received in reply to this lookup, and may be out of date.
+    bool isFromCache = false;
+
     ResolveResult() : address(Transport::Type::kUdp), mrpRemoteConfig(GetDefaultMRPConfig()) {}
 };
 
@@ -105,6 +110,7 @@ public:
     const PeerId & GetPeerId() const { return mPeerId; }
     System::Clock::Milliseconds32 GetMinLookupTime() const { return mMinLookupTimeMs; }
     System::Clock::Milliseconds32 GetMaxLookupTime() const { return mMaxLookupTimeMs; }
+    bool GetUseCachedAddress() const { return mUseCachedAddress; }
 
     /// The minimum lookup time is how much to wait for additional DNSSD
     /// queries even if a reply has already been received or to allow for
@@ -142,6 +148,17 @@ public:
         return *this;
     }
 
+    /// Allows resolvers that remember the addresses of nodes to report the
+    /// last known address of the node right away, without waiting for the
+    /// minimum lookup time nor a DNSSD response.  Such results have
+    /// `isFromCache` set, and callers are expected to do a lookup without
+    /// cached addresses if the cached one turns out to be unreachable.
+    NodeLookupRequest & SetUseCachedAddress(bool value)
+    {
+        mUseCachedAddress = value;
+        return *this;
+    }
+
 private:
     static_assert((CHIP_CONFIG_ADDRESS_RESOLVE_MIN_LOOKUP_TIME_MS) <= (CHIP_CONFIG_ADDRESS_RESOLVE_MAX_LOOKUP_TIME_MS),
                   "AddressResolveMinLookupTime must be equal or less than AddressResolveMaxLookupTime");
@@ -155,6 +172,7 @@ private:
     PeerId mPeerId;
     System::Clock::Milliseconds32 mMinLookupTimeMs{ kMinLookupTimeMsDefault };
     System::Clock::Milliseconds32 mMaxLookupTimeMs{ kMaxLookupTimeMsDefault };
+    bool mUseCachedAddress = false;
 };
 
 /// These things are expected to be defined by the implementation header.
@@ -199,6 +217,13 @@ public:
     /// not change.
     virtual CHIP_ERROR Init(System::Layer * systemLayer) = 0;
 
+    /// Provides the storage in which the resolver may keep the last known
+    /// addresses of nodes across restarts.  Expected to be called after Init.
+    ///
+    /// Returns CHIP_ERROR_NOT_IMPLEMENTED if the resolver does not keep
+    /// addresses.  The storage is released on Shutdown.
+    virtual CHIP_ERROR SetPersistentStorage(PersistentStorageDelegate * storage) { return CHIP_ERROR_NOT_IMPLEMENTED; }
+
     /// Initiate a node lookup for a particular node and use the specified
     /// Lookup handle to keep track of node resolution
     ///
@@ -34,6 +34,7 @@ void NodeLookupHandle::ResetForLookup(System::Clock::Timestamp now, const NodeLo
     mRequestStartTime = now;
     mRequest          = request;
     mResults          = NodeLookupResults();
+    mHasCachedResult  = false;
 }
 
 void NodeLookupHandle::LookupResult(const ResolveResult & result)
@@ -61,10 +62,23 @@ void NodeLookupHandle::LookupResult(const ResolveResult & result)
 #endif
 }
 
+void NodeLookupHandle::CachedLookupResult(const ResolveResult & result)
+{
+    LookupResult(result);
+    mHasCachedResult = true;
+}
+
 System::Clock::Timeout NodeLookupHandle::NextEventTimeout(System::Clock::Timestamp now)
 {
     const System::Clock::Timestamp elapsed = now - mRequestStartTime;
 
+    if (mHasCachedResult && HasLookupResult())
+    {
+        // The last known address of the node is reported without waiting for
+        // the min lookup time.
+        return System::Clock::Timeout::zero();
+    }
+
     if (elapsed < mRequest.GetMinLookupTime())
     {
         return mRequest.GetMinLookupTime() - elapsed;
@@ -103,6 +117,14 @@ NodeLookupAction NodeLookupHandle::NextAction(System::Clock::Timestamp now)
     ChipLogProgress(Discovery, "Checking node lookup status for " ChipLogFormatPeerId " after %lu ms",
                     ChipLogValuePeerId(mRequest.GetPeerId()), static_cast<unsigned long>(elapsed.count()));
 
+    // The last known address of the node is good enough to try, DNSSD results
+    // received in the meantime can still be tried next.
+    if (mHasCachedResult && HasLookupResult())
+    {
+        auto result = TakeLookupResult();
+        return NodeLookupAction::Success(result);
+    }
+
     // We are still within the minimal search time. Wait for more results.
     if (elapsed < mRequest.GetMinLookupTime())
     {
@@ -192,6 +214,23 @@ CHIP_ERROR Resolver::LookupNode(const NodeLookupRequest & request, Impl::NodeLoo
     handle.ResetForLookup(mTimeSource.GetMonotonicTimestamp(), request);
     auto & peerId = request.GetPeerId();
     ReturnErrorOnFailure(Dnssd::Resolver::Instance().ResolveNodeId(peerId));
+
+#if CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
+    ResolveResult cachedResult;
+    if (request.GetUseCachedAddress() && mAddressCache.Lookup(peerId, cachedResult))
+    {
+        handle.CachedLookupResult(cachedResult);
+
+        // The lookup completes as soon as the cached address is reported: keep
+        // DNSSD resolving the node in the background, so that the cache gets
+        // updated if the node has moved.
+        if (mAddressCache.StartRefresh(peerId) && Dnssd::Resolver::Instance().ResolveNodeId(peerId) != CHIP_NO_ERROR)
+        {
+            mAddressCache.EndRefresh(peerId);
+        }
+    }
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
+
     mActiveLookups.PushBack(&handle);
     ReArmTimer();
     ChipLogProgress(Discovery, "Lookup started for " ChipLogFormatPeerId, ChipLogValuePeerId(peerId));
@@ -246,6 +285,14 @@ CHIP_ERROR Resolver::Init(System::Layer * systemLayer)
     return CHIP_NO_ERROR;
 }
 
+#if CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
+CHIP_ERROR Resolver::SetPersistentStorage(PersistentStorageDelegate * storage)
+{
+    VerifyOrReturnError(mSystemLayer != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    return mAddressCache.Init(storage);
+}
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
+
 void Resolver::Shutdown()
 {
     // mSystemLayer is set in ::Init, so if it's null that means the resolver
@@ -274,12 +321,25 @@ void Resolver::Shutdown()
     // internal list of active lookups is empty at this point.
     ReArmTimer();
 
+#if CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
+    PeerId refreshedPeerId;
+    while (mAddressCache.EndAnyRefresh(refreshedPeerId))
+    {
+        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(refreshedPeerId);
+    }
+    mAddressCache.Shutdown();
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
+
     mSystemLayer = nullptr;
     Dnssd::Resolver::Instance().SetOperationalDelegate(nullptr);
 }
 
 void Resolver::OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeData)
 {
+#if CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
+    UpdateAddressCache(nodeData);
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
+
     auto it = mActiveLookups.begin();
     while (it != mActiveLookups.end())
     {
@@ -374,6 +434,10 @@ void Resolver::HandleTimer()
 
 void Resolver::OnOperationalNodeResolutionFailed(const PeerId & peerId, CHIP_ERROR error)
 {
+#if CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
+    EndAddressRefresh(peerId);
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
+
     auto it = mActiveLookups.begin();
     while (it != mActiveLookups.end())
     {
@@ -397,6 +461,67 @@ void Resolver::OnOperationalNodeResolutionFailed(const PeerId & peerId, CHIP_ERR
     ReArmTimer();
 }
 
+#if CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
+void Resolver::UpdateAddressCache(const Dnssd::ResolvedNodeData & nodeData)
+{
+    const PeerId & peerId = nodeData.operationalData.peerId;
+
+    EndAddressRefresh(peerId);
+
+    if (nodeData.operationalData.hasZeroTTL)
+    {
+        // The node is going away, its address cannot be trusted anymore
+        LogErrorOnFailure(mAddressCache.Remove(peerId));
+        return;
+    }
+
+    ResolveResult result;
+    result.address.SetPort(nodeData.resolutionData.port);
+    result.mrpRemoteConfig     = nodeData.resolutionData.GetRemoteMRPConfig();
+    result.supportsTcpClient   = nodeData.resolutionData.supportsTcpClient;
+    result.supportsTcpServer   = nodeData.resolutionData.supportsTcpServer;
+    result.isICDOperatingAsLIT = nodeData.resolutionData.isICDOperatingAsLIT.value_or(false);
+
+    bool found     = false;
+    auto bestScore = Dnssd::IPAddressSorter::IpScore::kInvalid;
+    for (size_t i = 0; i < nodeData.resolutionData.numIPs; i++)
+    {
+        const Inet::IPAddress & address = nodeData.resolutionData.ipAddress[i];
+#if !INET_CONFIG_ENABLE_IPV4
+        if (!address.IsIPv6())
+        {
+            continue;
+        }
+#endif
+        if (address.IsIPv6LinkLocal())
+        {
+            continue;
+        }
+
+        auto score = Dnssd::IPAddressSorter::ScoreIpAddress(address, nodeData.resolutionData.interfaceId);
+        if (!found || (score > bestScore))
+        {
+            found     = true;
+            bestScore = score;
+            result.address.SetIPAddress(address);
+        }
+    }
+
+    if (found)
+    {
+        LogErrorOnFailure(mAddressCache.Update(peerId, result));
+    }
+}
+
+void Resolver::EndAddressRefresh(const PeerId & peerId)
+{
+    if (mAddressCache.EndRefresh(peerId))
+    {
+        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+    }
+}
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
+
 void Resolver::ReArmTimer()
 {
     mSystemLayer->CancelTimer(&OnResolveTimer, static_cast<void *>(this));
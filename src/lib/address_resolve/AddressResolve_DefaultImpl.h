@@ -17,6 +17,7 @@
 #pragma once
 
 #include <lib/address_resolve/AddressResolve.h>
+#include <lib/address_resolve/OperationalAddressCache.h>
 #include <lib/dnssd/IPAddressSorter.h>
 #include <lib/dnssd/Resolver.h>
 #include <system/TimeSource.h>
@@ -136,6 +137,11 @@ public:
     /// Mark that a specific IP address has been found
     void LookupResult(const ResolveResult & result);
 
+    /// Mark that the last known address of the node has been found.
+    ///
+    /// The lookup then completes without waiting for the minimum lookup time.
+    void CachedLookupResult(const ResolveResult & result);
+
     /// Called after timeouts or after a series of IP addresses have been
     /// marked as found.
     ///
@@ -161,6 +167,7 @@ private:
     NodeLookupResults mResults;
     NodeLookupRequest mRequest; // active request to process
     System::Clock::Timestamp mRequestStartTime;
+    bool mHasCachedResult = false;
 };
 
 class Resolver : public ::chip::AddressResolve::Resolver, public Dnssd::OperationalResolveDelegate
@@ -175,6 +182,9 @@ public:
     CHIP_ERROR TryNextResult(Impl::NodeLookupHandle & handle) override;
     CHIP_ERROR CancelLookup(Impl::NodeLookupHandle & handle, FailureCallback cancel_method) override;
     void Shutdown() override;
+#if CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
+    CHIP_ERROR SetPersistentStorage(PersistentStorageDelegate * storage) override;
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
 
     // Dnssd::OperationalResolveDelegate
 
@@ -200,9 +210,22 @@ private:
     /// be used after calling this method.
     void HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current);
 
+#if CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
+    /// Records the best routable address of a resolved node as its last known
+    /// address, and ends any background refresh of that address.
+    void UpdateAddressCache(const Dnssd::ResolvedNodeData & nodeData);
+
+    /// Releases the DNSSD resolution kept running to refresh the cached address
+    /// of the node, if any.
+    void EndAddressRefresh(const PeerId & peerId);
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
+
     System::Layer * mSystemLayer = nullptr;
     Time::TimeSource<Time::Source::kSystem> mTimeSource;
     IntrusiveList<NodeLookupHandle> mActiveLookups;
+#if CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
+    OperationalAddressCache mAddressCache;
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
 };
 
 } // namespace Impl
@@ -0,0 +1,353 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/address_resolve/OperationalAddressCache.h>
+
+#include <lib/address_resolve/AddressResolve.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#if CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
+
+namespace chip {
+namespace AddressResolve {
+
+constexpr TLV::Tag OperationalAddressCache::kCompressedFabricIdTag;
+constexpr TLV::Tag OperationalAddressCache::kNodeIdTag;
+constexpr TLV::Tag OperationalAddressCache::kAddressTag;
+constexpr TLV::Tag OperationalAddressCache::kPortTag;
+constexpr TLV::Tag OperationalAddressCache::kTcpServerTag;
+constexpr TLV::Tag OperationalAddressCache::kTcpClientTag;
+constexpr TLV::Tag OperationalAddressCache::kMrpIdleIntervalTag;
+constexpr TLV::Tag OperationalAddressCache::kMrpActiveIntervalTag;
+constexpr TLV::Tag OperationalAddressCache::kMrpActiveThresholdTag;
+constexpr TLV::Tag OperationalAddressCache::kICDOperatingAsLITTag;
+
+CHIP_ERROR OperationalAddressCache::Init(PersistentStorageDelegate * storage)
+{
+    VerifyOrReturnError(storage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mStorage = storage;
+
+    CHIP_ERROR err = Load();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Discovery, "Dropping unreadable operational address cache: %" CHIP_ERROR_FORMAT, err.Format());
+        mCount = 0;
+        return Clear();
+    }
+    return CHIP_NO_ERROR;
+}
+
+void OperationalAddressCache::Shutdown()
+{
+    mStorage = nullptr;
+    mCount   = 0;
+}
+
+bool OperationalAddressCache::Lookup(const PeerId & peerId, ResolveResult & outResult)
+{
+    size_t index = Find(peerId);
+    VerifyOrReturnValue(index < mCount, false);
+
+    MoveToFront(index);
+
+    const Entry & entry = mEntries[0];
+    outResult           = ResolveResult();
+    outResult.address.SetIPAddress(entry.address);
+    outResult.address.SetPort(entry.port);
+    outResult.supportsTcpServer   = entry.supportsTcpServer;
+    outResult.supportsTcpClient   = entry.supportsTcpClient;
+    outResult.isICDOperatingAsLIT = entry.isICDOperatingAsLIT;
+    outResult.mrpRemoteConfig     = entry.mrpRemoteConfig;
+    outResult.isFromCache         = true;
+    return true;
+}
+
+CHIP_ERROR OperationalAddressCache::Update(const PeerId & peerId, const ResolveResult & result)
+{
+    const Inet::IPAddress & address = result.address.GetIPAddress();
+    VerifyOrReturnError(!address.IsIPv6LinkLocal(), CHIP_ERROR_INVALID_ADDRESS);
+
+    size_t index = Find(peerId);
+    if (index < mCount)
+    {
+        const Entry & entry = mEntries[index];
+        if ((entry.address == address) && (entry.port == result.address.GetPort()) &&
+            (entry.supportsTcpServer == result.supportsTcpServer) && (entry.supportsTcpClient == result.supportsTcpClient) &&
+            (entry.isICDOperatingAsLIT == result.isICDOperatingAsLIT) && (entry.mrpRemoteConfig == result.mrpRemoteConfig))
+        {
+            // Nothing new to store
+            MoveToFront(index);
+            return CHIP_NO_ERROR;
+        }
+    }
+    else if (mCount < kCacheSize)
+    {
+        index           = mCount++;
+        mEntries[index] = Entry();
+    }
+    else
+    {
+        // Replace the least recently used peer
+        index           = mCount - 1;
+        mEntries[index] = Entry();
+    }
+
+    Entry & entry             = mEntries[index];
+    entry.peerId              = peerId;
+    entry.address             = address;
+    entry.port                = result.address.GetPort();
+    entry.supportsTcpServer   = result.supportsTcpServer;
+    entry.supportsTcpClient   = result.supportsTcpClient;
+    entry.isICDOperatingAsLIT = result.isICDOperatingAsLIT;
+    entry.mrpRemoteConfig     = result.mrpRemoteConfig;
+    MoveToFront(index);
+
+    return Save();
+}
+
+CHIP_ERROR OperationalAddressCache::Remove(const PeerId & peerId)
+{
+    size_t index = Find(peerId);
+    VerifyOrReturnError(index < mCount, CHIP_NO_ERROR);
+
+    for (size_t i = index + 1; i < mCount; i++)
+    {
+        mEntries[i - 1] = mEntries[i];
+    }
+    mCount--;
+
+    return Save();
+}
+
+CHIP_ERROR OperationalAddressCache::Clear()
+{
+    mCount = 0;
+    VerifyOrReturnError(mStorage != nullptr, CHIP_NO_ERROR);
+
+    CHIP_ERROR err = mStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::OperationalAddressCache().KeyName());
+    if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        err = CHIP_NO_ERROR;
+    }
+    return err;
+}
+
+bool OperationalAddressCache::StartRefresh(const PeerId & peerId)
+{
+    size_t index = Find(peerId);
+    VerifyOrReturnValue(index < mCount && !mEntries[index].refreshing, false);
+
+    mEntries[index].refreshing = true;
+    return true;
+}
+
+bool OperationalAddressCache::EndRefresh(const PeerId & peerId)
+{
+    size_t index = Find(peerId);
+    VerifyOrReturnValue(index < mCount && mEntries[index].refreshing, false);
+
+    mEntries[index].refreshing = false;
+    return true;
+}
+
+bool OperationalAddressCache::EndAnyRefresh(PeerId & outPeerId)
+{
+    for (size_t i = 0; i < mCount; i++)
+    {
+        if (mEntries[i].refreshing)
+        {
+            mEntries[i].refreshing = false;
+            outPeerId              = mEntries[i].peerId;
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t OperationalAddressCache::Find(const PeerId & peerId) const
+{
+    for (size_t i = 0; i < mCount; i++)
+    {
+        if (mEntries[i].peerId == peerId)
+        {
+            return i;
+        }
+    }
+    return mCount;
+}
+
+void OperationalAddressCache::MoveToFront(size_t index)
+{
+    VerifyOrReturn(index > 0 && index < mCount);
+
+    Entry entry = mEntries[index];
+    for (size_t i = index; i > 0; i--)
+    {
+        mEntries[i] = mEntries[i - 1];
+    }
+    mEntries[0] = entry;
+}
+
+CHIP_ERROR OperationalAddressCache::Save()
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_NO_ERROR);
+
+    Platform::ScopedMemoryBuffer<uint8_t> buf;
+    VerifyOrReturnError(buf.Alloc(MaxStorageSize()), CHIP_ERROR_NO_MEMORY);
+
+    TLV::TLVWriter writer;
+    writer.Init(buf.Get(), MaxStorageSize());
+
+    TLV::TLVType arrayType;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, arrayType));
+
+    for (size_t i = 0; i < mCount; i++)
+    {
+        const Entry & entry = mEntries[i];
+
+        uint8_t address[kAddressSize];
+        uint8_t * p = address;
+        entry.address.WriteAddress(p);
+
+        TLV::TLVType innerType;
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, innerType));
+        ReturnErrorOnFailure(writer.Put(kCompressedFabricIdTag, entry.peerId.GetCompressedFabricId()));
+        ReturnErrorOnFailure(writer.Put(kNodeIdTag, entry.peerId.GetNodeId()));
+        ReturnErrorOnFailure(writer.Put(kAddressTag, ByteSpan(address)));
+        ReturnErrorOnFailure(writer.Put(kPortTag, entry.port));
+        ReturnErrorOnFailure(writer.PutBoolean(kTcpServerTag, entry.supportsTcpServer));
+        ReturnErrorOnFailure(writer.PutBoolean(kTcpClientTag, entry.supportsTcpClient));
+        ReturnErrorOnFailure(writer.Put(kMrpIdleIntervalTag, entry.mrpRemoteConfig.mIdleRetransTimeout.count()));
+        ReturnErrorOnFailure(writer.Put(kMrpActiveIntervalTag, entry.mrpRemoteConfig.mActiveRetransTimeout.count()));
+        ReturnErrorOnFailure(writer.Put(kMrpActiveThresholdTag, entry.mrpRemoteConfig.mActiveThresholdTime.count()));
+        ReturnErrorOnFailure(writer.PutBoolean(kICDOperatingAsLITTag, entry.isICDOperatingAsLIT));
+        ReturnErrorOnFailure(writer.EndContainer(innerType));
+    }
+
+    ReturnErrorOnFailure(writer.EndContainer(arrayType));
+
+    const auto len = writer.GetLengthWritten();
+    VerifyOrReturnError(CanCastTo<uint16_t>(len), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    return mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::OperationalAddressCache().KeyName(), buf.Get(),
+                                     static_cast<uint16_t>(len));
+}
+
+CHIP_ERROR OperationalAddressCache::Load()
+{
+    mCount = 0;
+
+    Platform::ScopedMemoryBuffer<uint8_t> buf;
+    VerifyOrReturnError(CanCastTo<uint16_t>(MaxStorageSize()), CHIP_ERROR_BUFFER_TOO_SMALL);
+    VerifyOrReturnError(buf.Alloc(MaxStorageSize()), CHIP_ERROR_NO_MEMORY);
+
+    uint16_t len   = static_cast<uint16_t>(MaxStorageSize());
+    CHIP_ERROR err = mStorage->SyncGetKeyValue(DefaultStorageKeyAllocator::OperationalAddressCache().KeyName(), buf.Get(), len);
+    if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        return CHIP_NO_ERROR;
+    }
+    ReturnErrorOnFailure(err);
+
+    TLV::ContiguousBufferTLVReader reader;
+    reader.Init(buf.Get(), len);
+
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, TLV::AnonymousTag()));
+    TLV::TLVType arrayType;
+    ReturnErrorOnFailure(reader.EnterContainer(arrayType));
+
+    while ((err = reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag())) == CHIP_NO_ERROR)
+    {
+        // The cache may have been written by a build keeping more peers: the
+        // most recently used ones come first.
+        if (mCount >= kCacheSize)
+        {
+            continue;
+        }
+
+        TLV::TLVType containerType;
+        ReturnErrorOnFailure(reader.EnterContainer(containerType));
+
+        CompressedFabricId compressedFabricId;
+        ReturnErrorOnFailure(reader.Next(kCompressedFabricIdTag));
+        ReturnErrorOnFailure(reader.Get(compressedFabricId));
+
+        NodeId nodeId;
+        ReturnErrorOnFailure(reader.Next(kNodeIdTag));
+        ReturnErrorOnFailure(reader.Get(nodeId));
+
+        ByteSpan address;
+        ReturnErrorOnFailure(reader.Next(kAddressTag));
+        ReturnErrorOnFailure(reader.Get(address));
+        VerifyOrReturnError(address.size() == kAddressSize, CHIP_ERROR_INVALID_TLV_ELEMENT);
+
+        Entry & entry = mEntries[mCount];
+        entry         = Entry();
+        entry.peerId  = PeerId(compressedFabricId, nodeId);
+
+        const uint8_t * p = address.data();
+        Inet::IPAddress::ReadAddress(p, entry.address);
+
+        ReturnErrorOnFailure(reader.Next(kPortTag));
+        ReturnErrorOnFailure(reader.Get(entry.port));
+        ReturnErrorOnFailure(reader.Next(kTcpServerTag));
+        ReturnErrorOnFailure(reader.Get(entry.supportsTcpServer));
+        ReturnErrorOnFailure(reader.Next(kTcpClientTag));
+        ReturnErrorOnFailure(reader.Get(entry.supportsTcpClient));
+
+        uint32_t idleInterval;
+        ReturnErrorOnFailure(reader.Next(kMrpIdleIntervalTag));
+        ReturnErrorOnFailure(reader.Get(idleInterval));
+        uint32_t activeInterval;
+        ReturnErrorOnFailure(reader.Next(kMrpActiveIntervalTag));
+        ReturnErrorOnFailure(reader.Get(activeInterval));
+        uint16_t activeThreshold;
+        ReturnErrorOnFailure(reader.Next(kMrpActiveThresholdTag));
+        ReturnErrorOnFailure(reader.Get(activeThreshold));
+        entry.mrpRemoteConfig.mIdleRetransTimeout   = System::Clock::Milliseconds32(idleInterval);
+        entry.mrpRemoteConfig.mActiveRetransTimeout = System::Clock::Milliseconds32(activeInterval);
+        entry.mrpRemoteConfig.mActiveThresholdTime  = System::Clock::Milliseconds16(activeThreshold);
+
+        ReturnErrorOnFailure(reader.Next(kICDOperatingAsLITTag));
+        ReturnErrorOnFailure(reader.Get(entry.isICDOperatingAsLIT));
+
+        ReturnErrorOnFailure(reader.ExitContainer(containerType));
+        mCount++;
+    }
+
+    if (err != CHIP_END_OF_TLV)
+    {
+        mCount = 0;
+        return err;
+    }
+
+    ReturnErrorOnFailure(reader.ExitContainer(arrayType));
+    return reader.VerifyEndOfContainer();
+}
+
+} // namespace AddressResolve
+} // namespace chip
+
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
@@ -0,0 +1,137 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <inet/IPAddress.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/core/PeerId.h>
+#include <lib/core/TLVCommon.h>
+#include <messaging/ReliableMessageProtocolConfig.h>
+
+#if CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
+
+namespace chip {
+namespace AddressResolve {
+
+struct ResolveResult;
+
+/// Keeps the last known operational address of peers in persistent storage.
+///
+/// The (routable) address, port, TCP support, MRP parameters and ICD operating
+/// mode of a peer are kept, so that CASE to a cached address is timed like CASE
+/// to a freshly resolved one.  The storage is written when any of them changes,
+/// not when the peer is resolved to the same values.
+///
+/// When full, the peer used the least recently is dropped.
+///
+/// Peers can also be marked as refreshing, for the resolver to track the
+/// DNSSD resolutions it keeps running after reporting a cached address.
+class OperationalAddressCache
+{
+public:
+    static constexpr size_t kCacheSize = CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE;
+
+    /// Loads the cached addresses from the storage, which is used until Shutdown.
+    ///
+    /// Unreadable cache contents are dropped rather than reported as an error.
+    CHIP_ERROR Init(PersistentStorageDelegate * storage);
+    void Shutdown();
+
+    /// Fetches the last known address of the peer, with `isFromCache` set.
+    ///
+    /// Returns false if the address of the peer is unknown.
+    bool Lookup(const PeerId & peerId, ResolveResult & outResult);
+
+    /// Records the current address and operating parameters of the peer.
+    ///
+    /// IPv6 link-local addresses are not kept, since they are only valid
+    /// together with the interface they were received on.
+    CHIP_ERROR Update(const PeerId & peerId, const ResolveResult & result);
+
+    CHIP_ERROR Remove(const PeerId & peerId);
+    CHIP_ERROR Clear();
+
+    /// Marks the peer as refreshing.  Returns false if the peer is not cached
+    /// or already refreshing.
+    bool StartRefresh(const PeerId & peerId);
+
+    /// Unmarks the peer as refreshing.  Returns false if it was not refreshing.
+    bool EndRefresh(const PeerId & peerId);
+
+    /// Unmarks any refreshing peer.  Returns false if no peer was refreshing.
+    bool EndAnyRefresh(PeerId & outPeerId);
+
+private:
+    static constexpr TLV::Tag kCompressedFabricIdTag = TLV::ContextTag(1);
+    static constexpr TLV::Tag kNodeIdTag             = TLV::ContextTag(2);
+    static constexpr TLV::Tag kAddressTag            = TLV::ContextTag(3);
+    static constexpr TLV::Tag kPortTag               = TLV::ContextTag(4);
+    static constexpr TLV::Tag kTcpServerTag          = TLV::ContextTag(5);
+    static constexpr TLV::Tag kTcpClientTag          = TLV::ContextTag(6);
+    static constexpr TLV::Tag kMrpIdleIntervalTag    = TLV::ContextTag(7);
+    static constexpr TLV::Tag kMrpActiveIntervalTag  = TLV::ContextTag(8);
+    static constexpr TLV::Tag kMrpActiveThresholdTag = TLV::ContextTag(9);
+    static constexpr TLV::Tag kICDOperatingAsLITTag  = TLV::ContextTag(10);
+
+    static constexpr size_t kAddressSize = 16;
+
+    struct Entry
+    {
+        PeerId peerId;
+        Inet::IPAddress address;
+        uint16_t port                                 = 0;
+        bool supportsTcpServer                        = false;
+        bool supportsTcpClient                        = false;
+        bool isICDOperatingAsLIT                      = false;
+        ReliableMessageProtocolConfig mrpRemoteConfig = GetDefaultMRPConfig();
+        bool refreshing                               = false;
+    };
+
+    static constexpr size_t MaxStorageSize()
+    {
+        return TLV::EstimateStructOverhead(
+            TLV::EstimateStructOverhead(sizeof(uint64_t), sizeof(uint64_t), kAddressSize, sizeof(uint16_t), sizeof(bool),
+                                        sizeof(bool), sizeof(uint32_t), sizeof(uint32_t), sizeof(uint16_t), sizeof(bool)) *
+            kCacheSize);
+    }
+
+    /// Returns the index of the peer in mEntries, or mCount if it is not cached.
+    size_t Find(const PeerId & peerId) const;
+
+    /// Moves the entry at the given index to the front, as the most recently used one.
+    void MoveToFront(size_t index);
+
+    CHIP_ERROR Load();
+    CHIP_ERROR Save();
+
+    PersistentStorageDelegate * mStorage = nullptr;
+
+    // Entries in most recently used first order
+    Entry mEntries[kCacheSize];
+    size_t mCount = 0;
+};
+
+} // namespace AddressResolve
+} // namespace chip
+
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
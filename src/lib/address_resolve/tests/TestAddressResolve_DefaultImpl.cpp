@@ -199,4 +199,46 @@ TEST(TestAddressResolveDefaultImpl, TestLookupResult)
     // Check that the results has been consumed properly.
     EXPECT_FALSE(handle.HasLookupResult());
 }
+
+TEST(TestAddressResolveDefaultImpl, TestCachedLookupResult)
+{
+    using namespace chip::System::Clock::Literals;
+
+    ResolveResult cachedResult;
+    cachedResult.address     = GetAddressWithLowScore();
+    cachedResult.isFromCache = true;
+
+    ResolveResult mediumResult;
+    mediumResult.address = GetAddressWithMediumScore();
+
+    AddressResolve::NodeLookupHandle handle;
+
+    auto now     = System::SystemClock().GetMonotonicTimestamp();
+    auto request = NodeLookupRequest(chip::PeerId(1, 2)).SetMinLookupTime(200_ms32);
+    handle.ResetForLookup(now, request);
+
+    // Regular results wait for the min lookup time
+    handle.LookupResult(mediumResult);
+    EXPECT_EQ(handle.NextEventTimeout(now), 200_ms32);
+    EXPECT_EQ(handle.NextAction(now).Type(), Impl::NodeLookupResult::kKeepSearching);
+
+    // Cached results do not
+    handle.ResetForLookup(now, request);
+    handle.CachedLookupResult(cachedResult);
+    EXPECT_EQ(handle.NextEventTimeout(now), System::Clock::Timeout::zero());
+
+    // The best result is reported first, whether cached or not
+    handle.LookupResult(mediumResult);
+    auto action = handle.NextAction(now);
+    ASSERT_EQ(action.Type(), Impl::NodeLookupResult::kLookupSuccess);
+    EXPECT_EQ(action.ResolveResult().address, mediumResult.address);
+    EXPECT_FALSE(action.ResolveResult().isFromCache);
+
+    if (kNumberOfAvailableSlots > 1)
+    {
+        EXPECT_TRUE(handle.HasLookupResult());
+        EXPECT_TRUE(handle.TakeLookupResult().isFromCache);
+    }
+    EXPECT_FALSE(handle.HasLookupResult());
+}
 } // namespace
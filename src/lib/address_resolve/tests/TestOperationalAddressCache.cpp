@@ -0,0 +1,185 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/address_resolve/AddressResolve.h>
+#include <lib/address_resolve/OperationalAddressCache.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+
+#if CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
+
+using namespace chip;
+using namespace chip::AddressResolve;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+ResolveResult MakeResult(const char * address, uint16_t port)
+{
+    Inet::IPAddress ipAddress;
+    EXPECT_TRUE(Inet::IPAddress::FromString(address, ipAddress));
+
+    ResolveResult result;
+    result.address = Transport::PeerAddress::UDP(ipAddress, port);
+    return result;
+}
+
+class TestOperationalAddressCache : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestOperationalAddressCache, TestPersistence)
+{
+    TestPersistentStorageDelegate storage;
+    const PeerId peer1(0x1234, 1);
+    const PeerId peer2(0x1234, 2);
+
+    {
+        OperationalAddressCache cache;
+        ASSERT_EQ(cache.Init(&storage), CHIP_NO_ERROR);
+
+        ResolveResult result;
+        EXPECT_FALSE(cache.Lookup(peer1, result));
+
+        ResolveResult peer1Result       = MakeResult("fd00::1", 5540);
+        peer1Result.supportsTcpServer   = true;
+        peer1Result.isICDOperatingAsLIT = true;
+        peer1Result.mrpRemoteConfig     = ReliableMessageProtocolConfig(30000_ms32, 300_ms32, 4000_ms16);
+        EXPECT_EQ(cache.Update(peer1, peer1Result), CHIP_NO_ERROR);
+        EXPECT_EQ(cache.Update(peer2, MakeResult("192.168.1.2", 5541)), CHIP_NO_ERROR);
+
+        // Link-local addresses are not kept
+        EXPECT_NE(cache.Update(PeerId(0x1234, 3), MakeResult("fe80::3", 5540)), CHIP_NO_ERROR);
+        EXPECT_FALSE(cache.Lookup(PeerId(0x1234, 3), result));
+
+        // Unchanged addresses are not written again
+        storage.SetRejectWrites(true);
+        EXPECT_EQ(cache.Update(peer1, peer1Result), CHIP_NO_ERROR);
+        storage.SetRejectWrites(false);
+
+        // Changed MRP parameters are written again
+        ResolveResult peer2Result   = MakeResult("192.168.1.2", 5541);
+        peer2Result.mrpRemoteConfig = ReliableMessageProtocolConfig(1000_ms32, 300_ms32);
+        EXPECT_EQ(cache.Update(peer2, peer2Result), CHIP_NO_ERROR);
+
+        cache.Shutdown();
+    }
+
+    EXPECT_TRUE(storage.HasKey(DefaultStorageKeyAllocator::OperationalAddressCache().KeyName()));
+
+    // Addresses are kept across instances
+    OperationalAddressCache cache;
+    ASSERT_EQ(cache.Init(&storage), CHIP_NO_ERROR);
+
+    ResolveResult result;
+    ASSERT_TRUE(cache.Lookup(peer1, result));
+    EXPECT_EQ(result.address, MakeResult("fd00::1", 5540).address);
+    EXPECT_TRUE(result.supportsTcpServer);
+    EXPECT_FALSE(result.supportsTcpClient);
+    EXPECT_TRUE(result.isICDOperatingAsLIT);
+    EXPECT_EQ(result.mrpRemoteConfig.mIdleRetransTimeout, 30000_ms32);
+    EXPECT_EQ(result.mrpRemoteConfig.mActiveRetransTimeout, 300_ms32);
+    EXPECT_EQ(result.mrpRemoteConfig.mActiveThresholdTime, 4000_ms16);
+    EXPECT_TRUE(result.isFromCache);
+
+    ASSERT_TRUE(cache.Lookup(peer2, result));
+    EXPECT_EQ(result.address, MakeResult("192.168.1.2", 5541).address);
+    EXPECT_FALSE(result.isICDOperatingAsLIT);
+    EXPECT_EQ(result.mrpRemoteConfig.mIdleRetransTimeout, 1000_ms32);
+
+    // Changed addresses replace the cached ones
+    EXPECT_EQ(cache.Update(peer2, MakeResult("fd00::2", 5541)), CHIP_NO_ERROR);
+    ASSERT_TRUE(cache.Lookup(peer2, result));
+    EXPECT_EQ(result.address, MakeResult("fd00::2", 5541).address);
+
+    EXPECT_EQ(cache.Remove(peer1), CHIP_NO_ERROR);
+    EXPECT_FALSE(cache.Lookup(peer1, result));
+
+    EXPECT_EQ(cache.Clear(), CHIP_NO_ERROR);
+    EXPECT_FALSE(cache.Lookup(peer2, result));
+    EXPECT_EQ(storage.GetNumKeys(), 0u);
+}
+
+TEST_F(TestOperationalAddressCache, TestLeastRecentlyUsedReplacement)
+{
+    TestPersistentStorageDelegate storage;
+    OperationalAddressCache cache;
+    ASSERT_EQ(cache.Init(&storage), CHIP_NO_ERROR);
+
+    for (NodeId id = 1; id <= OperationalAddressCache::kCacheSize; id++)
+    {
+        EXPECT_EQ(cache.Update(PeerId(1, id), MakeResult("fd00::1", 5540)), CHIP_NO_ERROR);
+    }
+
+    // Node 1 is used again, node 2 is now the least recently used one
+    ResolveResult result;
+    EXPECT_TRUE(cache.Lookup(PeerId(1, 1), result));
+    EXPECT_EQ(cache.Update(PeerId(1, 100), MakeResult("fd00::1", 5540)), CHIP_NO_ERROR);
+
+    EXPECT_TRUE(cache.Lookup(PeerId(1, 100), result));
+    EXPECT_TRUE(cache.Lookup(PeerId(1, 1), result));
+    if (OperationalAddressCache::kCacheSize > 1)
+    {
+        EXPECT_FALSE(cache.Lookup(PeerId(1, 2), result));
+    }
+}
+
+TEST_F(TestOperationalAddressCache, TestUnreadableStorage)
+{
+    TestPersistentStorageDelegate storage;
+    const uint8_t garbage[] = { 0x01, 0x02, 0x03 };
+    ASSERT_EQ(storage.SyncSetKeyValue(DefaultStorageKeyAllocator::OperationalAddressCache().KeyName(), garbage, sizeof(garbage)),
+              CHIP_NO_ERROR);
+
+    OperationalAddressCache cache;
+    EXPECT_EQ(cache.Init(&storage), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.GetNumKeys(), 0u);
+}
+
+TEST_F(TestOperationalAddressCache, TestRefresh)
+{
+    TestPersistentStorageDelegate storage;
+    OperationalAddressCache cache;
+    ASSERT_EQ(cache.Init(&storage), CHIP_NO_ERROR);
+
+    const PeerId peer(1, 1);
+    EXPECT_FALSE(cache.StartRefresh(peer));
+
+    EXPECT_EQ(cache.Update(peer, MakeResult("fd00::1", 5540)), CHIP_NO_ERROR);
+    EXPECT_TRUE(cache.StartRefresh(peer));
+    EXPECT_FALSE(cache.StartRefresh(peer));
+    EXPECT_TRUE(cache.EndRefresh(peer));
+    EXPECT_FALSE(cache.EndRefresh(peer));
+
+    PeerId refreshedPeer;
+    EXPECT_TRUE(cache.StartRefresh(peer));
+    EXPECT_TRUE(cache.EndAnyRefresh(refreshedPeer));
+    EXPECT_EQ(refreshedPeer, peer);
+    EXPECT_FALSE(cache.EndAnyRefresh(refreshedPeer));
+}
+
+} // namespace
+
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE > 0
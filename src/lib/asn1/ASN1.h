@@ -208,9 +208,32 @@ public:
         Init(data, N);
     }
     void InitNullWriter(void);
+
+    /**
+     * Receives, in order, the bytes produced by a writer initialized with InitStreamWriter().
+     */
+    using StreamCallback = void (*)(void * context, const uint8_t * data, size_t len);
+
+    /**
+     * Initialize a writer that produces no output but records the final length of every constructed and
+     * encapsulated element, in the order the elements are started.  Running the same encoding again
+     * through a writer initialized with InitStreamWriter() and the recorded lengths emits the encoding
+     * as a stream, without the buffer DER's length-first layout otherwise requires.
+     *
+     * Encoding fails with ASN1_ERROR_OVERFLOW when more than @p maxLengths elements are started.
+     */
+    void InitLengthRecorder(uint16_t * lengths, size_t maxLengths);
+    size_t GetRecordedLengthCount(void) const { return mLengthCount; }
+
+    /**
+     * Initialize a writer that passes the encoding to @p callback instead of storing it.  @p lengths holds
+     * the element lengths recorded by a length recorder that ran the exact same encoding.
+     */
+    void InitStreamWriter(const uint16_t * lengths, size_t lengthCount, StreamCallback callback, void * context);
+
     size_t GetLengthWritten(void) const;
 
-    bool IsNullWriter() const { return mBuf == nullptr; }
+    bool IsNullWriter() const { return mMode == Mode::kBuffer && mBuf == nullptr; }
 
     CHIP_ERROR PutInteger(int64_t val);
     CHIP_ERROR PutBoolean(bool val);
@@ -236,16 +259,45 @@ public:
 private:
     static constexpr size_t kMaxDeferredLengthDepth = kMaxConstructedAndEncapsulatedTypesDepth;
 
+    enum class Mode : uint8_t
+    {
+        kBuffer,         // Writes to mBuf, or nowhere for a null writer.
+        kLengthRecorder, // Counts bytes and records element lengths into mLengths.
+        kStream,         // Passes bytes to mStreamCallback, taking element lengths from mLengths.
+    };
+
+    // A length field that is only known once the element is complete.
+    union DeferredLength
+    {
+        uint8_t * mLocation; // kBuffer: the reserved length field.
+        struct
+        {
+            uint16_t mValueStart; // Offset of the element's value.
+            uint16_t mLengthSlot; // Index of the element in mLengths.
+        } mStreamed;             // kLengthRecorder and kStream.
+    };
+
     uint8_t * mBuf;
     uint8_t * mBufEnd;
     uint8_t * mWritePoint;
-    uint8_t * mDeferredLengthLocations[kMaxDeferredLengthDepth];
+    DeferredLength mDeferredLengths[kMaxDeferredLengthDepth];
     uint8_t mDeferredLengthCount;
+    Mode mMode;
+
+    // kLengthRecorder and kStream only.
+    uint16_t * mLengths;
+    size_t mMaxLengths;
+    size_t mLengthCount;
+    size_t mStreamOffset;
+    StreamCallback mStreamCallback;
+    void * mStreamContext;
 
+    void ResetState(Mode mode);
     CHIP_ERROR EncodeHead(uint8_t cls, uint8_t tag, bool isConstructed, int32_t len);
     CHIP_ERROR WriteDeferredLength(void);
     static uint8_t BytesForLength(int32_t len);
     static void EncodeLength(uint8_t * buf, uint8_t bytesForLen, int32_t lenToEncode);
+    bool HasSpaceFor(size_t len) const;
     void WriteData(const uint8_t * p, size_t len);
 };
 
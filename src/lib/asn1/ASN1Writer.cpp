@@ -49,24 +49,57 @@ enum
     kUnknownLengthMarker    = 0xFF
 };
 
-void ASN1Writer::Init(uint8_t * buf, size_t maxLen)
+void ASN1Writer::ResetState(Mode mode)
 {
-    mBuf                 = buf;
-    mWritePoint          = buf;
-    mBufEnd              = buf + maxLen;
+    mBuf                 = nullptr;
+    mWritePoint          = nullptr;
+    mBufEnd              = nullptr;
     mDeferredLengthCount = 0;
+    mMode                = mode;
+    mLengths             = nullptr;
+    mMaxLengths          = 0;
+    mLengthCount         = 0;
+    mStreamOffset        = 0;
+    mStreamCallback      = nullptr;
+    mStreamContext       = nullptr;
+}
+
+void ASN1Writer::Init(uint8_t * buf, size_t maxLen)
+{
+    ResetState(Mode::kBuffer);
+    mBuf        = buf;
+    mWritePoint = buf;
+    mBufEnd     = buf + maxLen;
 }
 
 void ASN1Writer::InitNullWriter()
 {
-    mBuf                 = nullptr;
-    mWritePoint          = nullptr;
-    mBufEnd              = nullptr;
-    mDeferredLengthCount = 0;
+    ResetState(Mode::kBuffer);
+}
+
+void ASN1Writer::InitLengthRecorder(uint16_t * lengths, size_t maxLengths)
+{
+    ResetState(Mode::kLengthRecorder);
+    mLengths    = lengths;
+    mMaxLengths = maxLengths;
+}
+
+void ASN1Writer::InitStreamWriter(const uint16_t * lengths, size_t lengthCount, StreamCallback callback, void * context)
+{
+    ResetState(Mode::kStream);
+    // The stream writer only reads the lengths.
+    mLengths        = const_cast<uint16_t *>(lengths);
+    mMaxLengths     = lengthCount;
+    mStreamCallback = callback;
+    mStreamContext  = context;
 }
 
 size_t ASN1Writer::GetLengthWritten() const
 {
+    if (mMode != Mode::kBuffer)
+    {
+        return mStreamOffset;
+    }
     return (mBuf != nullptr) ? static_cast<size_t>(mWritePoint - mBuf) : 0;
 }
 
@@ -98,7 +131,8 @@ CHIP_ERROR ASN1Writer::PutBoolean(bool val)
 
     ReturnErrorOnFailure(EncodeHead(kASN1TagClass_Universal, kASN1UniversalTag_Boolean, false, 1));
 
-    *mWritePoint++ = (val) ? 0xFF : 0;
+    const uint8_t encodedVal = (val) ? 0xFF : 0;
+    WriteData(&encodedVal, 1);
 
     return CHIP_NO_ERROR;
 }
@@ -186,32 +220,34 @@ CHIP_ERROR ASN1Writer::PutBitString(uint32_t val)
 
     ReturnErrorOnFailure(EncodeHead(kASN1TagClass_Universal, kASN1UniversalTag_BitString, false, len));
 
+    uint8_t encodedVal[5];
+
     if (val == 0)
     {
-        mWritePoint[0] = 0;
+        encodedVal[0] = 0;
     }
     else
     {
-        mWritePoint[1] = ReverseBits(static_cast<uint8_t>(val));
+        encodedVal[1] = ReverseBits(static_cast<uint8_t>(val));
         if (len >= 3)
         {
             val >>= 8;
-            mWritePoint[2] = ReverseBits(static_cast<uint8_t>(val));
+            encodedVal[2] = ReverseBits(static_cast<uint8_t>(val));
             if (len >= 4)
             {
                 val >>= 8;
-                mWritePoint[3] = ReverseBits(static_cast<uint8_t>(val));
+                encodedVal[3] = ReverseBits(static_cast<uint8_t>(val));
                 if (len == 5)
                 {
                     val >>= 8;
-                    mWritePoint[4] = ReverseBits(static_cast<uint8_t>(val));
+                    encodedVal[4] = ReverseBits(static_cast<uint8_t>(val));
                 }
             }
         }
-        mWritePoint[0] = static_cast<uint8_t>(7 - HighestBit(val));
+        encodedVal[0] = static_cast<uint8_t>(7 - HighestBit(val));
     }
 
-    mWritePoint += len;
+    WriteData(encodedVal, len);
 
     return CHIP_NO_ERROR;
 }
@@ -222,7 +258,7 @@ CHIP_ERROR ASN1Writer::PutBitString(uint8_t unusedBitCount, const uint8_t * enco
 
     ReturnErrorOnFailure(EncodeHead(kASN1TagClass_Universal, kASN1UniversalTag_BitString, false, encodedBitsLen + 1));
 
-    *mWritePoint++ = unusedBitCount;
+    WriteData(&unusedBitCount, 1);
 
     WriteData(encodedBits, encodedBitsLen);
 
@@ -241,7 +277,7 @@ CHIP_ERROR ASN1Writer::PutBitString(uint8_t unusedBitCount, chip::TLV::TLVReader
     ReturnErrorOnFailure(
         EncodeHead(kASN1TagClass_Universal, kASN1UniversalTag_BitString, false, static_cast<int32_t>(encodedBits.size() + 1)));
 
-    *mWritePoint++ = unusedBitCount;
+    WriteData(&unusedBitCount, 1);
 
     WriteData(encodedBits.data(), encodedBits.size());
 
@@ -279,7 +315,7 @@ CHIP_ERROR ASN1Writer::PutConstructedType(const uint8_t * val, uint16_t valLen)
     VerifyOrReturnError(!IsNullWriter(), CHIP_NO_ERROR);
 
     // Make sure we have enough space to write
-    VerifyOrReturnError((mWritePoint + valLen) <= mBufEnd, ASN1_ERROR_OVERFLOW);
+    VerifyOrReturnError(HasSpaceFor(valLen), ASN1_ERROR_OVERFLOW);
 
     WriteData(val, valLen);
 
@@ -307,8 +343,9 @@ CHIP_ERROR ASN1Writer::StartEncapsulatedType(uint8_t cls, uint8_t tag, bool bitS
     // the unused bit count is always 0.
     if (bitStringEncoding)
     {
-        VerifyOrReturnError(mWritePoint < mBufEnd, ASN1_ERROR_OVERFLOW);
-        *mWritePoint++ = 0;
+        VerifyOrReturnError(HasSpaceFor(1), ASN1_ERROR_OVERFLOW);
+        const uint8_t unusedBitCount = 0;
+        WriteData(&unusedBitCount, 1);
     }
 
     return CHIP_NO_ERROR;
@@ -366,10 +403,50 @@ CHIP_ERROR ASN1Writer::EncodeHead(uint8_t cls, uint8_t tag, bool isConstructed,
     // Note that the calculated total length doesn't overflow because `len` is a signed value (int32_t).
     // Note that if `len` is not kUnknownLength then it is non-negative (`len` >= 0).
     totalLen = 1 + bytesForLen + static_cast<uint32_t>(len != kUnknownLength ? len : 0);
-    VerifyOrReturnError((mWritePoint + totalLen) <= mBufEnd, ASN1_ERROR_OVERFLOW);
+    VerifyOrReturnError(HasSpaceFor(totalLen), ASN1_ERROR_OVERFLOW);
 
     // Write the tag byte.
-    *mWritePoint++ = cls | static_cast<uint8_t>(isConstructed ? 0x20 : 0) | tag;
+    const uint8_t tagByte = cls | static_cast<uint8_t>(isConstructed ? 0x20 : 0) | tag;
+    WriteData(&tagByte, 1);
+
+    // Streaming writers never go back to fill in a length: a length recorder only counts the bytes of the
+    // element, and a stream writer emits the length the length recorder recorded for it.
+    if (mMode != Mode::kBuffer)
+    {
+        const bool isDeferred = (len == kUnknownLength);
+        uint16_t lengthSlot   = 0;
+
+        if (isDeferred)
+        {
+            VerifyOrReturnError(mDeferredLengthCount < kMaxDeferredLengthDepth, ASN1_ERROR_INVALID_STATE);
+            VerifyOrReturnError(mLengthCount < mMaxLengths && CanCastTo<uint16_t>(mLengthCount), ASN1_ERROR_OVERFLOW);
+
+            lengthSlot = static_cast<uint16_t>(mLengthCount++);
+            if (mMode == Mode::kStream)
+            {
+                len         = mLengths[lengthSlot];
+                bytesForLen = BytesForLength(len);
+            }
+        }
+
+        uint8_t encodedLen[5] = {};
+        if (len != kUnknownLength)
+        {
+            EncodeLength(encodedLen, bytesForLen, len);
+        }
+        WriteData(encodedLen, bytesForLen);
+
+        if (isDeferred)
+        {
+            VerifyOrReturnError(CanCastTo<uint16_t>(mStreamOffset), ASN1_ERROR_LENGTH_OVERFLOW);
+
+            auto & deferredLength      = mDeferredLengths[mDeferredLengthCount++].mStreamed;
+            deferredLength.mValueStart = static_cast<uint16_t>(mStreamOffset);
+            deferredLength.mLengthSlot = lengthSlot;
+        }
+
+        return CHIP_NO_ERROR;
+    }
 
     // Encode the length if it is known.
     if (len != kUnknownLength)
@@ -388,8 +465,8 @@ CHIP_ERROR ASN1Writer::EncodeHead(uint8_t cls, uint8_t tag, bool isConstructed,
     {
         VerifyOrReturnError(mDeferredLengthCount < kMaxDeferredLengthDepth, ASN1_ERROR_INVALID_STATE);
 
-        *mWritePoint                                     = kUnknownLengthMarker;
-        mDeferredLengthLocations[mDeferredLengthCount++] = mWritePoint;
+        *mWritePoint                                       = kUnknownLengthMarker;
+        mDeferredLengths[mDeferredLengthCount++].mLocation = mWritePoint;
     }
 
     mWritePoint += bytesForLen;
@@ -403,7 +480,30 @@ CHIP_ERROR ASN1Writer::WriteDeferredLength()
 
     VerifyOrReturnError(mDeferredLengthCount > 0, ASN1_ERROR_INVALID_STATE);
 
-    uint8_t * lenField = mDeferredLengthLocations[mDeferredLengthCount - 1];
+    if (mMode != Mode::kBuffer)
+    {
+        const auto & deferredLength = mDeferredLengths[mDeferredLengthCount - 1].mStreamed;
+        size_t elemLen              = mStreamOffset - deferredLength.mValueStart;
+
+        VerifyOrReturnError(CanCastTo<uint16_t>(elemLen), ASN1_ERROR_LENGTH_OVERFLOW);
+
+        if (mMode == Mode::kLengthRecorder)
+        {
+            // Account for the final size of the length field, which the enclosing elements include.
+            mStreamOffset += BytesForLength(static_cast<int32_t>(elemLen)) - kLengthFieldReserveSize;
+            mLengths[deferredLength.mLengthSlot] = static_cast<uint16_t>(elemLen);
+        }
+        else
+        {
+            // The encoding differs from the one the lengths were recorded for.
+            VerifyOrReturnError(elemLen == mLengths[deferredLength.mLengthSlot], ASN1_ERROR_INVALID_STATE);
+        }
+
+        mDeferredLengthCount--;
+        return CHIP_NO_ERROR;
+    }
+
+    uint8_t * lenField = mDeferredLengths[mDeferredLengthCount - 1].mLocation;
 
     VerifyOrReturnError(*lenField == kUnknownLengthMarker, ASN1_ERROR_INVALID_STATE);
 
@@ -474,10 +574,27 @@ void ASN1Writer::EncodeLength(uint8_t * buf, uint8_t bytesForLen, int32_t lenToE
     }
 }
 
+bool ASN1Writer::HasSpaceFor(size_t len) const
+{
+    return (mMode != Mode::kBuffer) || (len <= static_cast<size_t>(mBufEnd - mWritePoint));
+}
+
 void ASN1Writer::WriteData(const uint8_t * p, size_t len)
 {
-    memcpy(mWritePoint, p, len);
-    mWritePoint += len;
+    switch (mMode)
+    {
+    case Mode::kBuffer:
+        memcpy(mWritePoint, p, len);
+        mWritePoint += len;
+        break;
+    case Mode::kStream:
+        mStreamCallback(mStreamContext, p, len);
+        mStreamOffset += len;
+        break;
+    case Mode::kLengthRecorder:
+        mStreamOffset += len;
+        break;
+    }
 }
 
 } // namespace ASN1
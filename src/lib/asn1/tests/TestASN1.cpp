@@ -318,6 +318,92 @@ TEST(TestASN1, NullWriter)
     EXPECT_EQ(err, CHIP_ERROR_WRONG_TLV_TYPE);
 }
 
+static CHIP_ERROR EncodeASN1LongTestData(ASN1Writer & writer)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    uint8_t longValue[300];
+
+    memset(longValue, 0xA5, sizeof(longValue));
+
+    // Nested elements whose lengths need one, two and three bytes.
+    ASN1_START_SEQUENCE
+    {
+        ASN1_START_SEQUENCE
+        {
+            ASN1_ENCODE_OCTET_STRING(longValue, 10);
+        }
+        ASN1_END_SEQUENCE;
+        ASN1_START_SEQUENCE
+        {
+            ASN1_ENCODE_OCTET_STRING(longValue, 200);
+        }
+        ASN1_END_SEQUENCE;
+        ASN1_START_OCTET_STRING_ENCAPSULATED
+        {
+            ASN1_ENCODE_OCTET_STRING(longValue, sizeof(longValue));
+        }
+        ASN1_END_ENCAPSULATED;
+    }
+    ASN1_END_SEQUENCE;
+
+exit:
+    return err;
+}
+
+struct StreamedOutput
+{
+    uint8_t mBuf[2048];
+    size_t mLength = 0;
+
+    static void Append(void * context, const uint8_t * data, size_t len)
+    {
+        auto * output = static_cast<StreamedOutput *>(context);
+        ASSERT_LE(output->mLength + len, sizeof(output->mBuf));
+        memcpy(output->mBuf + output->mLength, data, len);
+        output->mLength += len;
+    }
+};
+
+TEST(TestASN1, StreamWriter)
+{
+    for (auto encode : { EncodeASN1TestData, EncodeASN1LongTestData })
+    {
+        static uint8_t expected[2048];
+        ASN1Writer bufferWriter;
+        bufferWriter.Init(expected);
+        EXPECT_EQ(encode(bufferWriter), CHIP_NO_ERROR);
+
+        uint16_t lengths[32];
+        ASN1Writer lengthRecorder;
+        lengthRecorder.InitLengthRecorder(lengths, ArraySize(lengths));
+        EXPECT_EQ(encode(lengthRecorder), CHIP_NO_ERROR);
+        EXPECT_EQ(lengthRecorder.GetLengthWritten(), bufferWriter.GetLengthWritten());
+
+        static StreamedOutput output;
+        output.mLength = 0;
+        ASN1Writer streamWriter;
+        streamWriter.InitStreamWriter(lengths, lengthRecorder.GetRecordedLengthCount(), StreamedOutput::Append, &output);
+        EXPECT_EQ(encode(streamWriter), CHIP_NO_ERROR);
+        EXPECT_EQ(streamWriter.GetLengthWritten(), bufferWriter.GetLengthWritten());
+        ASSERT_EQ(output.mLength, bufferWriter.GetLengthWritten());
+        EXPECT_EQ(memcmp(output.mBuf, expected, output.mLength), 0);
+    }
+
+    // Running out of length slots is reported as an overflow.
+    uint16_t lengths[2];
+    ASN1Writer lengthRecorder;
+    lengthRecorder.InitLengthRecorder(lengths, ArraySize(lengths));
+    EXPECT_EQ(EncodeASN1LongTestData(lengthRecorder), ASN1_ERROR_OVERFLOW);
+
+    // A stream writer rejects an encoding that does not match the recorded lengths.
+    lengths[0] = 1;
+    lengths[1] = 1;
+    StreamedOutput output;
+    ASN1Writer streamWriter;
+    streamWriter.InitStreamWriter(lengths, ArraySize(lengths), StreamedOutput::Append, &output);
+    EXPECT_NE(EncodeASN1LongTestData(streamWriter), CHIP_NO_ERROR);
+}
+
 TEST(TestASN1, ASN1UniversalTime)
 {
     struct ASN1TimeTestCase
@@ -163,6 +163,31 @@
 #define CHIP_CONFIG_MEMORY_DEBUG_DMALLOC 0
 #endif // CHIP_CONFIG_MEMORY_DEBUG_DMALLOC
 
+/**
+ *  @def CHIP_CONFIG_MEMORY_TAGGING
+ *
+ *  @brief
+ *    Enable (1) or disable (0) accounting of the memory allocated with
+ *    chip::Platform::MemoryAlloc and friends per subsystem, as set by
+ *    CHIP_MEMORY_TAG_SCOPE. Live bytes, peak bytes and the allocation rate
+ *    of each chip::Platform::MemoryTag are then published by
+ *    chip::System::Stats::PublishMetrics().
+ *
+ *    Each allocation is prefixed by a small header holding its size and
+ *    tag, so this is meant for debugging heap growth of hosts rather than
+ *    for constrained devices.
+ *
+ *  @note This configuration requires #CHIP_CONFIG_MEMORY_MGMT_MALLOC.
+ *
+ */
+#ifndef CHIP_CONFIG_MEMORY_TAGGING
+#define CHIP_CONFIG_MEMORY_TAGGING 0
+#endif // CHIP_CONFIG_MEMORY_TAGGING
+
+#if CHIP_CONFIG_MEMORY_TAGGING && !CHIP_CONFIG_MEMORY_MGMT_MALLOC
+#error "CHIP_CONFIG_MEMORY_TAGGING requires CHIP_CONFIG_MEMORY_MGMT_MALLOC"
+#endif
+
 /**
  *  @def CHIP_CONFIG_GLOBALS_LAZY_INIT
  *
@@ -254,6 +279,42 @@
 #define CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS 16
 #endif // CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS
 
+/**
+ *  @def CHIP_CONFIG_EXCHANGE_CONTEXT_POOL_USE_SLAB
+ *
+ *  @brief
+ *    With CHIP_SYSTEM_CONFIG_POOL_USE_HEAP, allocate the exchange contexts
+ *    in slabs (ObjectPoolMem::kSlab) rather than one by one.
+ *
+ */
+#ifndef CHIP_CONFIG_EXCHANGE_CONTEXT_POOL_USE_SLAB
+#define CHIP_CONFIG_EXCHANGE_CONTEXT_POOL_USE_SLAB 0
+#endif // CHIP_CONFIG_EXCHANGE_CONTEXT_POOL_USE_SLAB
+
+#if CHIP_CONFIG_EXCHANGE_CONTEXT_POOL_USE_SLAB && !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#error "CHIP_CONFIG_EXCHANGE_CONTEXT_POOL_USE_SLAB requires CHIP_SYSTEM_CONFIG_POOL_USE_HEAP"
+#endif
+
+/**
+ *  @def CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS
+ *
+ *  @brief
+ *    Number of hash buckets the exchange manager uses to look up the
+ *    exchange an incoming message belongs to.  Must be a power of two.
+ *
+ *    With a heap-backed exchange pool the number of exchanges is not
+ *    bounded by CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS, so more buckets are
+ *    used by default.
+ *
+ */
+#ifndef CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS 64
+#else
+#define CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS 16
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif // CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS
+
 /**
  *  @def CHIP_CONFIG_MCSP_RECEIVE_TABLE_SIZE
  *
@@ -276,6 +337,20 @@
 #define CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE 32
 #endif // CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE
 
+/**
+ *  @def CHIP_CONFIG_MESSAGE_COUNTER_MAX_WINDOW_SIZE
+ *
+ *  @brief
+ *    Largest message counter window that can be selected at runtime with
+ *    SessionManager::SetMessageCounterWindowSize.  Every peer message counter
+ *    reserves one bit per counter value of this size, rounded up to a power
+ *    of two and to at least 32.
+ *
+ */
+#ifndef CHIP_CONFIG_MESSAGE_COUNTER_MAX_WINDOW_SIZE
+#define CHIP_CONFIG_MESSAGE_COUNTER_MAX_WINDOW_SIZE CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE
+#endif // CHIP_CONFIG_MESSAGE_COUNTER_MAX_WINDOW_SIZE
+
 /**
  *  @def CHIP_CONFIG_DEFAULT_UDP_MTU_SIZE
  *
@@ -383,6 +458,24 @@
 #define CHIP_CONFIG_CERT_MAX_RDN_ATTRIBUTES 5
 #endif // CHIP_CONFIG_CERT_MAX_RDN_ATTRIBUTES
 
+/**
+ *  @def CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE
+ *
+ *  @brief
+ *    The number of recently verified certificate signatures remembered by
+ *    VerifyCertSignature(), so that certificates presented again (e.g. the
+ *    ICAC of a reconnecting peer) skip the ECDSA verification.  Each entry
+ *    costs 32 bytes.  Set to 0 to disable the cache.
+ *
+ *    The cache is guarded by its own mutex, since certificates are also
+ *    validated off the Matter stack lock (e.g. CASESession's Sigma3
+ *    background work).
+ *
+ */
+#ifndef CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE
+#define CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE 4
+#endif // CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE
+
 /**
  *  @def CHIP_ERROR_LOGGING
  *
@@ -450,6 +543,53 @@
 #define CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE 256
 #endif
 
+/**
+ *  @def CHIP_DEFERRED_LOGGING
+ *
+ *  @brief
+ *    If asserted (1), ChipLogProgress() and ChipLogDetail() record their format string and arguments in a binary ring
+ *    buffer instead of formatting the message, see lib/support/logging/DeferredLogging.h.  Set from the
+ *    chip_deferred_logging build argument.
+ */
+#ifndef CHIP_DEFERRED_LOGGING
+#define CHIP_DEFERRED_LOGGING 0
+#endif
+
+#if CHIP_DEFERRED_LOGGING && CHIP_PW_TOKENIZER_LOGGING
+#error "CHIP_DEFERRED_LOGGING and CHIP_PW_TOKENIZER_LOGGING are mutually exclusive"
+#endif
+
+/**
+ *  @def CHIP_CONFIG_DEFERRED_LOG_RECORD_COUNT
+ *
+ *  @brief
+ *    The number of messages the ring buffer of CHIP_DEFERRED_LOGGING holds before overwriting the oldest ones.
+ */
+#ifndef CHIP_CONFIG_DEFERRED_LOG_RECORD_COUNT
+#define CHIP_CONFIG_DEFERRED_LOG_RECORD_COUNT 128
+#endif
+
+/**
+ *  @def CHIP_CONFIG_DEFERRED_LOG_ARGS_SIZE
+ *
+ *  @brief
+ *    The number of bytes available for the encoded arguments of one CHIP_DEFERRED_LOGGING message (at most 255).
+ *    Arguments that do not fit are dropped and the message is marked truncated.
+ */
+#ifndef CHIP_CONFIG_DEFERRED_LOG_ARGS_SIZE
+#define CHIP_CONFIG_DEFERRED_LOG_ARGS_SIZE 48
+#endif
+
+/**
+ *  @def CHIP_CONFIG_DEFERRED_LOG_MAX_STRING_LENGTH
+ *
+ *  @brief
+ *    The number of characters of a string argument copied by CHIP_DEFERRED_LOGGING.
+ */
+#ifndef CHIP_CONFIG_DEFERRED_LOG_MAX_STRING_LENGTH
+#define CHIP_CONFIG_DEFERRED_LOG_MAX_STRING_LENGTH 32
+#endif
+
 /**
  *  @def CHIP_CONFIG_ENABLE_CONDITION_LOGGING
  *
@@ -692,6 +832,38 @@
 #define CHIP_CONFIG_EVENT_LOGGING_VERBOSE_DEBUG_LOGS 1
 #endif
 
+/**
+ * @def CHIP_CONFIG_STAGED_ATTRIBUTE_CHANGES_QUEUE_SIZE
+ *
+ * @brief The number of attribute changes application threads can stage with
+ *        MatterReportingStageAttributeChange before the Matter thread drains
+ *        them. Staging fails with CHIP_ERROR_NO_MEMORY when the queue is full.
+ */
+#ifndef CHIP_CONFIG_STAGED_ATTRIBUTE_CHANGES_QUEUE_SIZE
+#define CHIP_CONFIG_STAGED_ATTRIBUTE_CHANGES_QUEUE_SIZE 16
+#endif
+
+/**
+ * @def CHIP_CONFIG_STAGED_EVENTS_QUEUE_SIZE
+ *
+ * @brief The number of events application threads can stage with StageEvent
+ *        before the Matter thread logs them. Staging fails with
+ *        CHIP_ERROR_NO_MEMORY when the queue is full.
+ */
+#ifndef CHIP_CONFIG_STAGED_EVENTS_QUEUE_SIZE
+#define CHIP_CONFIG_STAGED_EVENTS_QUEUE_SIZE 8
+#endif
+
+/**
+ * @def CHIP_CONFIG_STAGED_EVENT_MAX_DATA_SIZE
+ *
+ * @brief The largest encoded event data that can be staged with StageEvent.
+ *        Each entry of the staged events queue reserves this many bytes.
+ */
+#ifndef CHIP_CONFIG_STAGED_EVENT_MAX_DATA_SIZE
+#define CHIP_CONFIG_STAGED_EVENT_MAX_DATA_SIZE 64
+#endif
+
 /**
  * @def CHIP_CONFIG_ENABLE_ARG_PARSER
  *
@@ -712,6 +884,17 @@
 #define CHIP_CONFIG_ENABLE_ARG_PARSER_VALIDITY_CHECKS 1
 #endif
 
+/**
+ * @def CHIP_CONFIG_ENABLE_SIMD
+ *
+ * @brief Enable the SSE2 (x86) and NEON (AArch64) implementations of the byte
+ *        loops of lib/support (hex and base64 encoding, UTF-8 validation) when the
+ *        compiler targets them. See lib/support/Simd.h.
+ */
+#ifndef CHIP_CONFIG_ENABLE_SIMD
+#define CHIP_CONFIG_ENABLE_SIMD 1
+#endif
+
 /**
  * @def CHIP_CONFIG_UNAUTHENTICATED_CONNECTION_POOL_SIZE
  *
@@ -724,6 +907,64 @@
 #define CHIP_CONFIG_UNAUTHENTICATED_CONNECTION_POOL_SIZE 4
 #endif // CHIP_CONFIG_UNAUTHENTICATED_CONNECTION_POOL_SIZE
 
+/**
+ * @def CHIP_CONFIG_PEER_ADDRESS_RATE_LIMIT_PER_SECOND
+ *
+ * @brief The sustained number of messages per second that the SessionManager accepts
+ * from a source address, before decoding them any further than their fixed header
+ * and before any decryption. This bounds the work a flooding peer can cause, for
+ * example with unauthenticated Sigma1 or PBKDFParamRequest messages, without
+ * affecting other peers. 0 disables the limit.
+ *
+ * @see SessionManager::SetPeerAddressRateLimit()
+ */
+#ifndef CHIP_CONFIG_PEER_ADDRESS_RATE_LIMIT_PER_SECOND
+#define CHIP_CONFIG_PEER_ADDRESS_RATE_LIMIT_PER_SECOND 0
+#endif // CHIP_CONFIG_PEER_ADDRESS_RATE_LIMIT_PER_SECOND
+
+/**
+ * @def CHIP_CONFIG_PEER_ADDRESS_RATE_LIMIT_BURST
+ *
+ * @brief The number of messages a source address may send in a burst above
+ * CHIP_CONFIG_PEER_ADDRESS_RATE_LIMIT_PER_SECOND.
+ */
+#ifndef CHIP_CONFIG_PEER_ADDRESS_RATE_LIMIT_BURST
+#define CHIP_CONFIG_PEER_ADDRESS_RATE_LIMIT_BURST 32
+#endif // CHIP_CONFIG_PEER_ADDRESS_RATE_LIMIT_BURST
+
+/**
+ * @def CHIP_CONFIG_PEER_RATE_LIMITER_TABLE_SIZE
+ *
+ * @brief The number of source addresses whose rate is tracked at once. When more
+ * addresses send messages, the one idle for the longest time is forgotten.
+ */
+#ifndef CHIP_CONFIG_PEER_RATE_LIMITER_TABLE_SIZE
+#define CHIP_CONFIG_PEER_RATE_LIMITER_TABLE_SIZE 16
+#endif // CHIP_CONFIG_PEER_RATE_LIMITER_TABLE_SIZE
+
+/**
+ * @def CHIP_CONFIG_SECURE_SESSION_RATE_LIMIT_PER_SECOND
+ *
+ * @brief The sustained number of messages per second that the SessionManager accepts
+ * on a secure unicast session, checked before the message is decrypted. 0 disables
+ * the limit.
+ *
+ * @see SessionManager::SetSecureSessionRateLimit()
+ */
+#ifndef CHIP_CONFIG_SECURE_SESSION_RATE_LIMIT_PER_SECOND
+#define CHIP_CONFIG_SECURE_SESSION_RATE_LIMIT_PER_SECOND 0
+#endif // CHIP_CONFIG_SECURE_SESSION_RATE_LIMIT_PER_SECOND
+
+/**
+ * @def CHIP_CONFIG_SECURE_SESSION_RATE_LIMIT_BURST
+ *
+ * @brief The number of messages a secure session may receive in a burst above
+ * CHIP_CONFIG_SECURE_SESSION_RATE_LIMIT_PER_SECOND.
+ */
+#ifndef CHIP_CONFIG_SECURE_SESSION_RATE_LIMIT_BURST
+#define CHIP_CONFIG_SECURE_SESSION_RATE_LIMIT_BURST 32
+#endif // CHIP_CONFIG_SECURE_SESSION_RATE_LIMIT_BURST
+
 /**
  * @def CHIP_CONFIG_SECURE_SESSION_REFCOUNT_LOGGING
  *
@@ -747,6 +988,68 @@
 #define CHIP_CONFIG_MAX_FABRICS 16
 #endif // CHIP_CONFIG_MAX_FABRICS
 
+/**
+ *  @def CHIP_CONFIG_FABRIC_TABLE_LAZY_CERT_LOADING
+ *
+ *  @brief
+ *    When enabled, the identity of each fabric (node id, fabric id, CATs, root
+ *    public key and compressed fabric id) is cached in storage next to its
+ *    metadata, and the fabric table is loaded from that cache at boot. The
+ *    operational certificates are then only read when they are used, rather
+ *    than being read and decoded for every fabric when the device starts.
+ *
+ *    Fabrics without a cached identity (e.g. committed by an older firmware)
+ *    are loaded from their certificates, and their cache is written then.
+ */
+#ifndef CHIP_CONFIG_FABRIC_TABLE_LAZY_CERT_LOADING
+#define CHIP_CONFIG_FABRIC_TABLE_LAZY_CERT_LOADING 0
+#endif // CHIP_CONFIG_FABRIC_TABLE_LAZY_CERT_LOADING
+
+/**
+ * @def CHIP_CONFIG_OP_CERT_STORE_CACHE_SIZE
+ *
+ * @brief Number of committed operational certificates (NOC, ICAC or RCAC)
+ * PersistentStorageOpCertStore keeps in memory once read, so that CASE
+ * handshakes and reads of the NOCs and TrustedRootCertificates attributes do
+ * not read them back from storage.  A fabric chain takes up to 3 entries, and
+ * the least recently used one is dropped to make room.  0 disables the cache.
+ */
+#ifndef CHIP_CONFIG_OP_CERT_STORE_CACHE_SIZE
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_OP_CERT_STORE_CACHE_SIZE 6
+#else
+#define CHIP_CONFIG_OP_CERT_STORE_CACHE_SIZE 0
+#endif
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES
+ *
+ * @brief Number of CASE handshakes a CASEServer runs at the same time as a
+ * responder.  Sigma1 messages that arrive while all of them are in progress
+ * are answered with a busy status report.  A peer that already has a
+ * handshake in progress is told to wait for it rather than being given a
+ * second one.
+ *
+ * Each handshake keeps a SecureSession reserved for its next use, which is
+ * accounted for in CHIP_CONFIG_SECURE_SESSION_POOL_SIZE.
+ *
+ * Host unit test builds run two handshakes at the same time, so that the
+ * admission of concurrent handshakes is covered.
+ *
+ */
+#ifndef CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+#define CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES 2
+#else
+#define CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES 1
+#endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
+#endif // CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES
+
+#if CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES < 1
+#error "CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES must be at least 1"
+#endif
+
 /**
  * @def CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
  *
@@ -756,7 +1059,7 @@
  *
  * This is sized by default to cover the sum of the following:
  *  - At least 3 CASE sessions / fabric (Spec Ref: 4.13.2.8)
- *  - 1 reserved slot for CASEServer as a responder.
+ *  - 1 reserved slot per CASEServer responder handshake (CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES).
  *  - 1 reserved slot for PASE.
  *
  *  NOTE: On heap-based platforms, there is no pre-allocation of the pool.
@@ -766,9 +1069,63 @@
  *
  */
 #ifndef CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
-#define CHIP_CONFIG_SECURE_SESSION_POOL_SIZE (CHIP_CONFIG_MAX_FABRICS * 3 + 2)
+#define CHIP_CONFIG_SECURE_SESSION_POOL_SIZE (CHIP_CONFIG_MAX_FABRICS * 3 + CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES + 1)
 #endif // CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
 
+/**
+ * @def CHIP_CONFIG_SECURE_SESSION_POOL_USE_SLAB
+ *
+ * @brief With CHIP_SYSTEM_CONFIG_POOL_USE_HEAP, allocate the secure sessions in slabs
+ * (ObjectPoolMem::kSlab) rather than one by one.
+ */
+#ifndef CHIP_CONFIG_SECURE_SESSION_POOL_USE_SLAB
+#define CHIP_CONFIG_SECURE_SESSION_POOL_USE_SLAB 0
+#endif // CHIP_CONFIG_SECURE_SESSION_POOL_USE_SLAB
+
+#if CHIP_CONFIG_SECURE_SESSION_POOL_USE_SLAB && !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#error "CHIP_CONFIG_SECURE_SESSION_POOL_USE_SLAB requires CHIP_SYSTEM_CONFIG_POOL_USE_HEAP"
+#endif
+
+/**
+ * @def CHIP_CONFIG_SECURE_SESSION_INDEX_BUCKETS
+ *
+ * @brief Number of hash buckets the secure session table uses to look up
+ * a session by its local session ID.  Local session IDs are handed out
+ * sequentially, so they spread evenly over the buckets, and the default
+ * keeps the chains at around 4 sessions in a full table.
+ *
+ */
+#ifndef CHIP_CONFIG_SECURE_SESSION_INDEX_BUCKETS
+#define CHIP_CONFIG_SECURE_SESSION_INDEX_BUCKETS ((CHIP_CONFIG_SECURE_SESSION_POOL_SIZE + 3) / 4)
+#endif // CHIP_CONFIG_SECURE_SESSION_INDEX_BUCKETS
+
+/**
+ * @def CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS
+ *
+ * @brief Number of worker threads that decrypt and authenticate received secure
+ * unicast messages, off the Matter thread.  Message counter checks and dispatch
+ * still happen on the Matter thread, in the order messages were received on each
+ * session.
+ *
+ * Set to 0 (the default) to decrypt messages inline on the Matter thread.
+ * Requires CHIP_SYSTEM_CONFIG_POSIX_LOCKING, and a session keystore that can be
+ * used from several threads.
+ */
+#ifndef CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS
+#define CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS 0
+#endif // CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS
+
+/**
+ * @def CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_QUEUE_SIZE
+ *
+ * @brief Maximum number of received messages that can be waiting for, or being
+ * processed by, each decrypt worker (see CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS).
+ * Messages received while the queue of their worker is full are dropped.
+ */
+#ifndef CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_QUEUE_SIZE
+#define CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_QUEUE_SIZE 16
+#endif // CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_QUEUE_SIZE
+
 /**
  *  @def CHIP_CONFIG_MAX_GROUP_DATA_PEERS
  *
@@ -904,6 +1261,57 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_MAX_REPORTS_IN_FLIGHT 4
 #endif
 
+/**
+ * @def CHIP_IM_REPORT_BUDGET_PER_FABRIC_REPORTS_PER_MINUTE
+ *
+ * @brief The default rate at which BudgetedReportSchedulerImpl lets the subscriptions of a fabric send reports for data
+ *   changes, in reports per minute.  0 removes the limit.
+ */
+#ifndef CHIP_IM_REPORT_BUDGET_PER_FABRIC_REPORTS_PER_MINUTE
+#define CHIP_IM_REPORT_BUDGET_PER_FABRIC_REPORTS_PER_MINUTE 600
+#endif
+
+/**
+ * @def CHIP_IM_REPORT_BUDGET_PER_FABRIC_BURST
+ *
+ * @brief The default number of reports for data changes the subscriptions of a fabric may send back to back once their
+ *   budget has been unused for a while.
+ */
+#ifndef CHIP_IM_REPORT_BUDGET_PER_FABRIC_BURST
+#define CHIP_IM_REPORT_BUDGET_PER_FABRIC_BURST 30
+#endif
+
+/**
+ * @def CHIP_IM_REPORT_BUDGET_PER_PEER_REPORTS_PER_MINUTE
+ *
+ * @brief The default rate at which BudgetedReportSchedulerImpl lets the subscriptions of a single peer node send reports for
+ *   data changes, in reports per minute.  0 removes the limit.
+ */
+#ifndef CHIP_IM_REPORT_BUDGET_PER_PEER_REPORTS_PER_MINUTE
+#define CHIP_IM_REPORT_BUDGET_PER_PEER_REPORTS_PER_MINUTE 120
+#endif
+
+/**
+ * @def CHIP_IM_REPORT_BUDGET_PER_PEER_BURST
+ *
+ * @brief The default number of reports for data changes the subscriptions of a single peer node may send back to back.
+ */
+#ifndef CHIP_IM_REPORT_BUDGET_PER_PEER_BURST
+#define CHIP_IM_REPORT_BUDGET_PER_PEER_BURST 10
+#endif
+
+/**
+ * @def CHIP_IM_MAX_PIPELINED_READS_PER_SESSION
+ *
+ * @brief The default number of read interactions PipelinedReadManager keeps in flight on a single session.
+ *
+ * Publishers only have to support one read interaction per fabric at a time, and answer further ones with Busy
+ * when they run out of ReadHandlers, so this should stay small.
+ */
+#ifndef CHIP_IM_MAX_PIPELINED_READS_PER_SESSION
+#define CHIP_IM_MAX_PIPELINED_READS_PER_SESSION 2
+#endif
+
 /**
  * @def CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS
  *
@@ -922,6 +1330,68 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS (CHIP_IM_MAX_NUM_READS * 9)
 #endif
 
+/**
+ * @def CHIP_IM_SERVER_MAX_CACHED_ATTRIBUTE_PATHS_PER_READ_HANDLER
+ *
+ * @brief The maximum number of expanded attribute paths each ReadHandler keeps in its path expansion cache.
+ *
+ * With a non-zero value, a ReadHandler expands its wildcard attribute paths through the data model provider once, and
+ * later reports walk the cached concrete paths instead.  The cache is allocated from the heap, with one entry per
+ * concrete path, and is rebuilt after the data model reports a change to its endpoints, clusters or attributes.  A
+ * ReadHandler whose paths expand to more entries than this falls back to expanding them for every report.
+ *
+ * Zero disables the cache.
+ */
+#ifndef CHIP_IM_SERVER_MAX_CACHED_ATTRIBUTE_PATHS_PER_READ_HANDLER
+#define CHIP_IM_SERVER_MAX_CACHED_ATTRIBUTE_PATHS_PER_READ_HANDLER 0
+#endif
+
+/**
+ * @def CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE
+ *
+ * @brief The size in bytes of the buffer in which the reporting engine keeps encoded attribute values during one run.
+ *
+ * With a non-zero value, an attribute reported to several ReadHandlers in the same run of the reporting engine is read
+ * and encoded once and copied into the other reports, as long as its cluster data version and the fabric filtering of
+ * the reads match.  Fabric-scoped attributes and attributes that need more than View privilege to read are never shared.
+ * Values that do not fit in the remaining space are read for every ReadHandler as usual.
+ *
+ * Zero disables the cache.
+ */
+#ifndef CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE
+#define CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE 0
+#endif
+
+/**
+ * @def CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_ENTRIES
+ *
+ * @brief The maximum number of attribute values kept in the buffer sized by CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_SIZE.
+ */
+#ifndef CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_ENTRIES
+#define CHIP_IM_SERVER_ENCODED_ATTRIBUTE_CACHE_ENTRIES 32
+#endif
+
+/**
+ * @def CHIP_IM_INTERACTION_ARENA_BLOCK_SIZE
+ *
+ * @brief The size in bytes of the blocks chip::app::InteractionArena carves the scratch buffers of an interaction from.
+ *
+ * Buffers larger than that get a block of their own, which is not kept for reuse.
+ */
+#ifndef CHIP_IM_INTERACTION_ARENA_BLOCK_SIZE
+#define CHIP_IM_INTERACTION_ARENA_BLOCK_SIZE 1024
+#endif
+
+/**
+ * @def CHIP_IM_INTERACTION_ARENA_MAX_FREE_BLOCKS
+ *
+ * @brief The number of released chip::app::InteractionArena blocks kept for the next interactions instead of being
+ *        returned to the heap.
+ */
+#ifndef CHIP_IM_INTERACTION_ARENA_MAX_FREE_BLOCKS
+#define CHIP_IM_INTERACTION_ARENA_MAX_FREE_BLOCKS 8
+#endif
+
 /**
  * @def CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
  *
@@ -959,6 +1429,39 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_MAX_NUM_TIMED_HANDLER 8
 #endif
 
+/**
+ * @def CHIP_IM_SERVER_CLUSTER_STATS_ENTRIES
+ *
+ * @brief The number of clusters (or cluster elements, see CHIP_IM_SERVER_CLUSTER_STATS_PER_ELEMENT) for which the server
+ *        keeps latency and size statistics of its attribute reads, writes, command invokes and reports.
+ *
+ * Operations of clusters beyond this number are only counted as dropped.  Zero disables the statistics.
+ */
+#ifndef CHIP_IM_SERVER_CLUSTER_STATS_ENTRIES
+#define CHIP_IM_SERVER_CLUSTER_STATS_ENTRIES 0
+#endif
+
+/**
+ * @def CHIP_IM_SERVER_CLUSTER_STATS_PER_ELEMENT
+ *
+ * @brief Keep the cluster statistics per attribute and per command, instead of per cluster.
+ */
+#ifndef CHIP_IM_SERVER_CLUSTER_STATS_PER_ELEMENT
+#define CHIP_IM_SERVER_CLUSTER_STATS_PER_ELEMENT 0
+#endif
+
+/**
+ * @def CHIP_IM_SERVER_INTERFACE_REGISTRY_BUCKETS
+ *
+ * @brief The number of hash buckets of the AttributeAccessInterface and CommandHandlerInterface registries, for each of
+ *        their interfaces for one endpoint and for all endpoints.
+ *
+ * Apps registering interfaces per endpoint on many endpoints, such as bridges, should raise it to keep the chains short.
+ */
+#ifndef CHIP_IM_SERVER_INTERFACE_REGISTRY_BUCKETS
+#define CHIP_IM_SERVER_INTERFACE_REGISTRY_BUCKETS 8
+#endif
+
 /**
  * @}
  */
@@ -1041,6 +1544,16 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_DEVICE_MAX_ACTIVE_CASE_CLIENTS 2
 #endif
 
+/**
+ * @def CHIP_CONFIG_BINDING_MANAGER_MAX_CONCURRENT_CONNECTIONS
+ *
+ * @brief Number of connections the BindingManager establishes at the same time to notify unicast bindings.  The notifications to
+ *        the other peers wait for one of these to complete.
+ */
+#ifndef CHIP_CONFIG_BINDING_MANAGER_MAX_CONCURRENT_CONNECTIONS
+#define CHIP_CONFIG_BINDING_MANAGER_MAX_CONCURRENT_CONNECTIONS CHIP_CONFIG_DEVICE_MAX_ACTIVE_CASE_CLIENTS
+#endif
+
 /**
  * @def CHIP_CONFIG_DEVICE_MAX_ACTIVE_DEVICES
  *
@@ -1066,6 +1579,90 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_ENDPOINTS_PER_FABRIC 1
 #endif
 
+/**
+ * @def CHIP_CONFIG_GROUP_COMMAND_ENDPOINT_BATCH_SIZE
+ *
+ * @brief Number of endpoints a group command is dispatched to at once.
+ *
+ * The endpoints of the group are validated, then the command is dispatched to them, in batches of at most this many
+ * endpoints, which lets command handlers process the command for all the endpoints of a batch at once.
+ */
+#ifndef CHIP_CONFIG_GROUP_COMMAND_ENDPOINT_BATCH_SIZE
+#define CHIP_CONFIG_GROUP_COMMAND_ENDPOINT_BATCH_SIZE 8
+#endif
+
+/**
+ * @def CHIP_CONFIG_COMMAND_DISPATCH_TABLE
+ *
+ * @brief Whether the generated ember command dispatch (IMClusterCommandHandler.cpp) uses sorted tables of command
+ *        decoding thunks rather than nested switch statements.
+ *
+ * The tables take less code space than the switch statements, and commands are all found in the same number of steps.
+ */
+#ifndef CHIP_CONFIG_COMMAND_DISPATCH_TABLE
+#define CHIP_CONFIG_COMMAND_DISPATCH_TABLE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_GROUP_DATA_PROVIDER_CACHE_IPK
+ *
+ * @brief Keep each fabric's Identity Protection Key set in memory in
+ * GroupDataProviderImpl once it has been read, so that matching the
+ * destination identifier of a Sigma1 against every fabric does not read
+ * each fabric's key sets back from storage.  Costs one KeySet per fabric.
+ */
+#ifndef CHIP_CONFIG_GROUP_DATA_PROVIDER_CACHE_IPK
+#define CHIP_CONFIG_GROUP_DATA_PROVIDER_CACHE_IPK CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif
+
+/**
+ * @def CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE
+ *
+ * @brief Number of operational group keys GroupDataProviderImpl keeps in
+ * memory, indexed by session id, to match incoming group messages without
+ * reading the group-key mappings and key sets back from storage for each
+ * message.  Every key of every mapped key set takes an entry, of about 40
+ * bytes; with more keys than entries, the storage is read as without the
+ * index.  0 disables the index.
+ */
+#ifndef CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE 32
+#else
+#define CHIP_CONFIG_GROUP_DATA_PROVIDER_SESSION_INDEX_SIZE 0
+#endif
+#endif
+
+/**
+ * @def CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE
+ *
+ * @brief Number of group-endpoint pairs GroupDataProviderImpl keeps in
+ * memory, indexed by fabric and group, so that dispatching a group message
+ * to the endpoints of its group and HasEndpoint() do not walk the groups and
+ * endpoints back from storage.  Each entry takes 6 bytes; with more pairs
+ * than entries, the storage is read as without the index.  0 disables the
+ * index.
+ */
+#ifndef CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE 256
+#else
+#define CHIP_CONFIG_GROUP_DATA_PROVIDER_ENDPOINT_INDEX_SIZE 0
+#endif
+#endif
+
+/**
+ * @def CHIP_CONFIG_GROUP_TRIAL_DECRYPTION_BATCH_SIZE
+ *
+ * @brief Number of candidate group keys that SessionManager passes at once
+ * to AES_CCM_decrypt_multi_key() when trial-decrypting a group message sent
+ * without privacy obfuscation.  GroupDataProviderImpl keeps that many key
+ * contexts alive per group session iterator.  1 disables batching.
+ */
+#ifndef CHIP_CONFIG_GROUP_TRIAL_DECRYPTION_BATCH_SIZE
+#define CHIP_CONFIG_GROUP_TRIAL_DECRYPTION_BATCH_SIZE 4
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_GROUPS_PER_FABRIC
  *
@@ -1116,6 +1713,18 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_NAME_LENGTH 16
 #endif
 
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+ *
+ * Defines the number of recent access control decisions, by subject, endpoint,
+ * cluster and privilege, remembered so that checking the many attributes of a
+ * cluster in a read only evaluates the access control entries once.  0 disables
+ * the cache.
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+#define CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE 8
+#endif
+
 /**
  * @def CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_MAX_ENTRIES_PER_FABRIC
  *
@@ -1176,6 +1785,18 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_ENTRY_ITERATOR_DELEGATE_POOL_SIZE 1
 #endif
 
+/**
+ * @def CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_SUBJECT_INDEX
+ *
+ * Index the access control list of the example access control code by fabric,
+ * auth mode and subject, so that checks only look at the entries whose
+ * subjects can match.  The index takes 16 bytes per subject (or subjectless
+ * entry) the list can hold.
+ */
+#ifndef CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_SUBJECT_INDEX
+#define CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_SUBJECT_INDEX 1
+#endif
+
 /**
  * @def CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_FAST_COPY_SUPPORT
  *
@@ -1237,6 +1858,29 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE (3 * CHIP_CONFIG_MAX_FABRICS)
 #endif
 
+/**
+ * @def CHIP_CONFIG_CASE_SESSION_RESUMPTION_RAM_CACHE_SIZE
+ *
+ * @brief
+ *   Number of session resumption records CachingSessionResumptionStorage
+ *   keeps in RAM in front of its backing storage.
+ */
+#ifndef CHIP_CONFIG_CASE_SESSION_RESUMPTION_RAM_CACHE_SIZE
+#define CHIP_CONFIG_CASE_SESSION_RESUMPTION_RAM_CACHE_SIZE CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE
+#endif
+
+/**
+ * @def CHIP_CONFIG_PASE_VERIFIER_CACHE_SIZE
+ *
+ * @brief
+ *   Number of PASE verifiers PASEVerifierCache keeps in persistent storage,
+ *   so that reopening a commissioning window with the same passcode, salt
+ *   and iteration count does not rerun PBKDF2.
+ */
+#ifndef CHIP_CONFIG_PASE_VERIFIER_CACHE_SIZE
+#define CHIP_CONFIG_PASE_VERIFIER_CACHE_SIZE 2
+#endif
+
 /**
  * @def CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD
  *
@@ -1257,6 +1901,61 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD 512
 #endif /* CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD */
 
+/**
+ * @def CHIP_CONFIG_EVENT_INDEX_ENTRIES_PER_BUFFER
+ *
+ * @brief The number of event positions each event buffer remembers, so that fetching events since a given event number
+ *   starts reading near that event instead of at the oldest event.
+ *
+ * The positions are spread over the buffer, about one per (buffer size / CHIP_CONFIG_EVENT_INDEX_ENTRIES_PER_BUFFER)
+ * bytes of events.  Each entry takes 16 bytes.
+ */
+#ifndef CHIP_CONFIG_EVENT_INDEX_ENTRIES_PER_BUFFER
+#define CHIP_CONFIG_EVENT_INDEX_ENTRIES_PER_BUFFER 4
+#endif
+
+/**
+ * @def CHIP_CONFIG_ENABLE_PERSISTENT_EVENT_LOG
+ *
+ * @brief Enable the persistent event log tier of the server.
+ *
+ * When enabled, events evicted from the most critical event buffer are appended to a log kept in the server's
+ * persistent storage instead of being dropped, and reads of events return them from there, including after a reboot.
+ */
+#ifndef CHIP_CONFIG_ENABLE_PERSISTENT_EVENT_LOG
+#define CHIP_CONFIG_ENABLE_PERSISTENT_EVENT_LOG 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_SERVER_INIT_PROFILING
+ *
+ * @brief Log the time taken by each step of Server::Init(), e.g. loading the fabric table or the access control entries.
+ */
+#ifndef CHIP_CONFIG_SERVER_INIT_PROFILING
+#define CHIP_CONFIG_SERVER_INIT_PROFILING 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_PERSISTENT_EVENT_LOG_SEGMENT_COUNT
+ *
+ * @brief The number of storage entries (segments) the persistent event log is split into.  When all segments are full,
+ *   the oldest one is dropped.
+ */
+#ifndef CHIP_CONFIG_PERSISTENT_EVENT_LOG_SEGMENT_COUNT
+#define CHIP_CONFIG_PERSISTENT_EVENT_LOG_SEGMENT_COUNT 8
+#endif
+
+/**
+ * @def CHIP_CONFIG_PERSISTENT_EVENT_LOG_SEGMENT_SIZE
+ *
+ * @brief The size, in bytes, of a persistent event log segment.  It must be no larger than the largest value the
+ *   persistent storage accepts, and must hold at least one event.  A segment-sized buffer is allocated from the heap
+ *   while events are appended or read.
+ */
+#ifndef CHIP_CONFIG_PERSISTENT_EVENT_LOG_SEGMENT_SIZE
+#define CHIP_CONFIG_PERSISTENT_EVENT_LOG_SEGMENT_SIZE 1024
+#endif
+
 /**
  * @def CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
  *
@@ -1337,6 +2036,31 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_RESUBSCRIBE_WAIT_TIME_MULTIPLIER_MS 10000
 #endif
 
+/**
+ *  @def CHIP_RESUBSCRIBE_COORDINATOR_MAX_CONCURRENT
+ *
+ *  @brief
+ *    The default number of resubscriptions a ResubscriptionCoordinator lets
+ *    re-establish at the same time, across all the peers of a controller.
+ *
+ */
+#ifndef CHIP_RESUBSCRIBE_COORDINATOR_MAX_CONCURRENT
+#define CHIP_RESUBSCRIBE_COORDINATOR_MAX_CONCURRENT 8
+#endif
+
+/**
+ *  @def CHIP_RESUBSCRIBE_COORDINATOR_MAX_JITTER_MS
+ *
+ *  @brief
+ *    The default upper bound of the random delay a ResubscriptionCoordinator
+ *    adds to each scheduled resubscription, so that the subscriptions dropped
+ *    together, e.g. by a controller or network restart, do not retry together.
+ *
+ */
+#ifndef CHIP_RESUBSCRIBE_COORDINATOR_MAX_JITTER_MS
+#define CHIP_RESUBSCRIBE_COORDINATOR_MAX_JITTER_MS 5000
+#endif
+
 /*
  * @def CHIP_CONFIG_MAX_ATTRIBUTE_STORE_ELEMENT_SIZE
  *
@@ -1367,6 +2091,27 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST 0
 #endif // CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST
 
+/*
+ * @def CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+ *
+ * @brief Number of encoded replies the minmdns response sender keeps, per
+ *        interface and query, to answer repeated queries by copying the
+ *        packets sent the last time instead of building them again.
+ *
+ *        Every entry holds the packet buffers of its reply, so the cache is
+ *        only enabled by default on platforms that allocate pools from the
+ *        heap.
+ *        Entries are dropped whenever the advertised services change.
+ *        0 disables the cache.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE 8
+#else
+#define CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE 0
+#endif
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+
 /*
  * @def CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES
  *
@@ -1380,6 +2125,44 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES 2
 #endif // CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES
 
+/*
+ * @def CHIP_CONFIG_MINMDNS_MAX_PENDING_RESOLVE_ATTEMPTS
+ *
+ * @brief Maximum number of resolves, browses and address lookups the minmdns
+ *        resolver retries at the same time.  When full, a new one replaces
+ *        the one that waited the longest.
+ *
+ *        With heap pools, entries are allocated as needed, so controllers
+ *        resolving large numbers of nodes at once only pay for the ones
+ *        actually pending.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_MAX_PENDING_RESOLVE_ATTEMPTS
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_MINMDNS_MAX_PENDING_RESOLVE_ATTEMPTS 1024
+#else
+#define CHIP_CONFIG_MINMDNS_MAX_PENDING_RESOLVE_ATTEMPTS 4
+#endif
+#endif // CHIP_CONFIG_MINMDNS_MAX_PENDING_RESOLVE_ATTEMPTS
+
+/*
+ * @def CHIP_CONFIG_MINMDNS_RESOLVED_NODE_CACHE_SIZE
+ *
+ * @brief Number of operational nodes the minmdns resolver remembers from the
+ *        responses it receives, answers and unsolicited announcements alike,
+ *        for as long as their records live.
+ *
+ *        Resolving a cached node reports the cached data right away, while
+ *        the query refreshing it is sent.  Every entry holds the resolved
+ *        data of a node, including its IP addresses.  0 disables the cache.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_RESOLVED_NODE_CACHE_SIZE
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_MINMDNS_RESOLVED_NODE_CACHE_SIZE 8
+#else
+#define CHIP_CONFIG_MINMDNS_RESOLVED_NODE_CACHE_SIZE 0
+#endif
+#endif // CHIP_CONFIG_MINMDNS_RESOLVED_NODE_CACHE_SIZE
+
 /**
  * def CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS
  *
@@ -1413,6 +2196,75 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_ADDRESS_RESOLVE_MAX_LOOKUP_TIME_MS 45000
 #endif // CHIP_CONFIG_ADDRESS_RESOLVE_MAX_LOOKUP_TIME_MS
 
+/**
+ * @def CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE
+ *
+ * @brief Number of peer operational addresses the default address resolver
+ * keeps in persistent storage, so that CASE to a known peer can start right
+ * away after a restart instead of waiting for DNS-SD.  Only routable (not
+ * IPv6 link-local) addresses are kept, and the least recently used peer is
+ * dropped to make room.  0 disables the cache.
+ */
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE 32
+#else
+#define CHIP_CONFIG_ADDRESS_RESOLVE_PERSISTENT_CACHE_SIZE 0
+#endif
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS
+ *
+ * @brief Time, in milliseconds, after which a CASE handshake to a peer that
+ * has not completed yet is raced by another one to the next address the peer
+ * was resolved to ("happy eyeballs").  Up to two handshakes to a peer are in
+ * progress at the same time, and the first one to complete wins.  Only
+ * useful when CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS is more than 1.  0
+ * (the default) disables the parallel attempts: addresses are tried one after
+ * the other.
+ */
+#ifndef CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS
+#define CHIP_CONFIG_CASE_STAGGERED_ATTEMPT_DELAY_MS 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_WARM_SESSION_PEERS
+ *
+ * @brief Number of peers CASESessionManager can keep a CASE session
+ * established with (see CASESessionManager::AddWarmSessionPeer), so that the
+ * first command to them does not wait for address resolution and CASE.  0
+ * disables warm sessions.
+ */
+#ifndef CHIP_CONFIG_CASE_WARM_SESSION_PEERS
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_CASE_WARM_SESSION_PEERS 16
+#else
+#define CHIP_CONFIG_CASE_WARM_SESSION_PEERS 0
+#endif
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_WARM_SESSION_CHECK_INTERVAL_MS
+ *
+ * @brief Interval, in milliseconds, at which CASESessionManager re-establishes
+ * the sessions with warm peers that were lost.
+ */
+#ifndef CHIP_CONFIG_CASE_WARM_SESSION_CHECK_INTERVAL_MS
+#define CHIP_CONFIG_CASE_WARM_SESSION_CHECK_INTERVAL_MS 30000
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_WARM_SESSION_MAX_HANDSHAKES
+ *
+ * @brief Maximum number of sessions with warm peers CASESessionManager
+ * establishes at once, so that warm sessions leave most of the
+ * OperationalSessionSetup pool to sessions requested on demand.
+ */
+#ifndef CHIP_CONFIG_CASE_WARM_SESSION_MAX_HANDSHAKES
+#define CHIP_CONFIG_CASE_WARM_SESSION_MAX_HANDSHAKES 2
+#endif
+
 /*
  * @def CHIP_CONFIG_NETWORK_COMMISSIONING_DEBUG_TEXT_BUFFER_SIZE
  *
@@ -1423,6 +2275,16 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_NETWORK_COMMISSIONING_DEBUG_TEXT_BUFFER_SIZE 64
 #endif // CHIP_CONFIG_NETWORK_COMMISSIONING_DEBUG_TEXT_BUFFER_SIZE
 
+/*
+ * @def CHIP_CONFIG_NETWORK_COMMISSIONING_MAX_SCAN_RESULTS
+ *
+ * @brief Maximum number of networks in a ScanNetworksResponse. The strongest networks found are kept, and those that do not fit in
+ * the response message are dropped: each Wi-Fi or Thread scan result costs ~60 bytes of TLV.
+ */
+#ifndef CHIP_CONFIG_NETWORK_COMMISSIONING_MAX_SCAN_RESULTS
+#define CHIP_CONFIG_NETWORK_COMMISSIONING_MAX_SCAN_RESULTS 15
+#endif // CHIP_CONFIG_NETWORK_COMMISSIONING_MAX_SCAN_RESULTS
+
 /**
  *  @def CHIP_CONFIG_IM_STATUS_CODE_VERBOSE_FORMAT
  *
@@ -1581,6 +2443,37 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #endif // CHIP_CONFIG_TEST
 #endif // CHIP_CONFIG_MAX_SCENES_TABLE_SIZE
 
+/**
+ * @def CHIP_CONFIG_SCENES_TABLE_INDEX_SIZE
+ *
+ * @brief Number of scene maps, one per fabric and endpoint, the default scene table keeps in RAM so that finding the storage
+ * slot of a scene (e.g. when handling RecallScene) does not read the fabric scene data back from storage. Each map takes about
+ * 4 * CHIP_CONFIG_MAX_SCENES_TABLE_SIZE + 12 bytes. 0 disables the index.
+ */
+#ifndef CHIP_CONFIG_SCENES_TABLE_INDEX_SIZE
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_SCENES_TABLE_INDEX_SIZE 32
+#else
+#define CHIP_CONFIG_SCENES_TABLE_INDEX_SIZE 2
+#endif
+#endif // CHIP_CONFIG_SCENES_TABLE_INDEX_SIZE
+
+/**
+ * @def CHIP_CONFIG_SCENES_TABLE_CACHED_SCENES
+ *
+ * @brief Number of recently used scenes, including their extension field sets, the default scene table keeps in RAM so that
+ * recalling them does not read them back from storage. Each scene takes about
+ * CHIP_CONFIG_SCENES_MAX_CLUSTERS_PER_SCENE * (CHIP_CONFIG_SCENES_MAX_EXTENSION_FIELDSET_SIZE_PER_CLUSTER + 8) + 48 bytes.
+ * 0 disables the cache.
+ */
+#ifndef CHIP_CONFIG_SCENES_TABLE_CACHED_SCENES
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_SCENES_TABLE_CACHED_SCENES 8
+#else
+#define CHIP_CONFIG_SCENES_TABLE_CACHED_SCENES 0
+#endif
+#endif // CHIP_CONFIG_SCENES_TABLE_CACHED_SCENES
+
 /**
  * @def CHIP_CONFIG_SCENES_USE_DEFAULT_HANDLERS
  *
@@ -1632,6 +2525,61 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_SKIP_APP_SPECIFIC_GENERATED_HEADER_INCLUDES 0
 #endif
 
+/**
+ * @def CHIP_CONFIG_ROM_FIXED_ENDPOINT_TABLE
+ *
+ * @brief Controls whether the attribute storage serves the fixed endpoints
+ * straight from the generated constant tables.
+ *
+ * If this is set to true, emberAfEndpointConfigure() does not copy the fixed
+ * endpoint definitions into RAM: only their enabled state, parent endpoint
+ * and tag list are kept there, and the RAM endpoint table is sized for the
+ * dynamic endpoints only.  The device type list of a fixed endpoint can then
+ * not be changed with emberAfSetDeviceTypeList().
+ */
+#ifndef CHIP_CONFIG_ROM_FIXED_ENDPOINT_TABLE
+#define CHIP_CONFIG_ROM_FIXED_ENDPOINT_TABLE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_ATTRIBUTE_STORAGE_PACK_HOT_ATTRIBUTES
+ *
+ * @brief Controls whether the attribute storage packs the frequently accessed
+ * attributes together at the start of the storage of each fixed endpoint.
+ *
+ * If this is set to true, the internally stored attributes listed in
+ * CHIP_CONFIG_ATTRIBUTE_STORAGE_HOT_ATTRIBUTES are laid out first in the
+ * storage of their endpoint, largest first so that they are naturally aligned
+ * without padding, and the other attributes follow in the generated order.
+ * The amount of storage does not change.
+ */
+#ifndef CHIP_CONFIG_ATTRIBUTE_STORAGE_PACK_HOT_ATTRIBUTES
+#define CHIP_CONFIG_ATTRIBUTE_STORAGE_PACK_HOT_ATTRIBUTES 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_ATTRIBUTE_STORAGE_HOT_ATTRIBUTES
+ *
+ * @brief The frequently accessed attributes packed together by
+ * CHIP_CONFIG_ATTRIBUTE_STORAGE_PACK_HOT_ATTRIBUTES, as a comma-separated list
+ * of { cluster id, attribute id } pairs.
+ *
+ * Defaults to the attributes that are reported and changed the most often by
+ * typical devices: OnOff, CurrentLevel and the MeasuredValue of the
+ * measurement clusters.  Applications can replace it with the attributes
+ * found to be hot by profiling them.
+ */
+#ifndef CHIP_CONFIG_ATTRIBUTE_STORAGE_HOT_ATTRIBUTES
+#define CHIP_CONFIG_ATTRIBUTE_STORAGE_HOT_ATTRIBUTES                                                                               \
+    { 0x0006, 0x0000 }, /* On/Off: OnOff */                                                                                        \
+        { 0x0008, 0x0000 }, /* Level Control: CurrentLevel */                                                                      \
+        { 0x0400, 0x0000 }, /* Illuminance Measurement: MeasuredValue */                                                           \
+        { 0x0402, 0x0000 }, /* Temperature Measurement: MeasuredValue */                                                           \
+        { 0x0403, 0x0000 }, /* Pressure Measurement: MeasuredValue */                                                              \
+        { 0x0404, 0x0000 }, /* Flow Measurement: MeasuredValue */                                                                  \
+        { 0x0405, 0x0000 }  /* Relative Humidity Measurement: MeasuredValue */
+#endif
+
 /**
  * @def CHIP_CONFIG_ICD_IDLE_MODE_DURATION_SEC
  *
@@ -1668,6 +2616,17 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_ICD_CLIENTS_SUPPORTED_PER_FABRIC 2
 #endif
 
+/**
+ * @def CHIP_CONFIG_ICD_MONITORING_TABLE_CACHE
+ *
+ * @brief Enables the RAM cache of the ICD monitoring table entries, which saves the ICD from reading the registered clients
+ *        from persistent storage on every wake-up. The cache takes room for CHIP_CONFIG_ICD_CLIENTS_SUPPORTED_PER_FABRIC
+ *        entries on each of CHIP_CONFIG_MAX_FABRICS fabrics.
+ */
+#ifndef CHIP_CONFIG_ICD_MONITORING_TABLE_CACHE
+#define CHIP_CONFIG_ICD_MONITORING_TABLE_CACHE 1
+#endif
+
 /**
  * @def CHIP_CONFIG_CRYPTO_PSA_ICD_MAX_CLIENTS
  *
@@ -1748,6 +2707,18 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION_MAX_RETRY_INTERVAL_SECS (3600 * 6)
 #endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION_MAX_RETRY_INTERVAL_SECS
 
+/**
+ *  @def CHIP_CONFIG_MAX_PARALLEL_SUBSCRIPTION_RESUMPTIONS
+ *
+ *  @brief The number of peers whose persisted subscriptions are resumed at the same time.
+ *
+ *    The subscriptions of a peer share a single CASE session; the peers beyond this limit wait for one of the resumptions in
+ *    flight to complete, instead of all establishing their CASE sessions at once after a reboot.
+ */
+#ifndef CHIP_CONFIG_MAX_PARALLEL_SUBSCRIPTION_RESUMPTIONS
+#define CHIP_CONFIG_MAX_PARALLEL_SUBSCRIPTION_RESUMPTIONS 4
+#endif // CHIP_CONFIG_MAX_PARALLEL_SUBSCRIPTION_RESUMPTIONS
+
 /**
  * @def CHIP_CONFIG_SYNCHRONOUS_REPORTS_ENABLED
  *
@@ -1771,6 +2742,20 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_ICD_CLIENTS_INFO_STORAGE_CONCURRENT_ITERATORS 1
 #endif
 
+/**
+ * @def CHIP_CONFIG_ICD_CLIENT_CHECK_IN_INDEX_WINDOW
+ *
+ * @brief Number of upcoming check-in counters of each ICD client for which DefaultICDClientStorage indexes the check-in nonce
+ *
+ * A check-in message whose nonce is indexed is only decrypted with the keys of the clients it is indexed for, instead of
+ * being tried with the keys of every registered client. Messages that are not indexed, e.g. because the ICD sent check-ins to
+ * other clients in between, are still matched against every client. The index takes about 20 bytes per counter and client
+ * in RAM, it is disabled when this is 0.
+ */
+#ifndef CHIP_CONFIG_ICD_CLIENT_CHECK_IN_INDEX_WINDOW
+#define CHIP_CONFIG_ICD_CLIENT_CHECK_IN_INDEX_WINDOW 4
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_THREAD_NETWORK_DIRECTORY_STORAGE_CAPACITY
  *
@@ -1845,6 +2830,84 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_BDX_LOG_TRANSFERS 5
 #endif // CHIP_CONFIG_MAX_BDX_LOG_TRANSFERS
 
+/**
+ *  @def CHIP_CONFIG_MAX_BDX_LOG_PROVIDER_TRANSFERS
+ *
+ *  @brief
+ *    Maximum number of diagnostic log transfers that the Diagnostic Logs cluster server
+ *    sends over BDX at the same time. Further RetrieveLogsRequest commands asking for BDX
+ *    get a Busy status until one of the transfers ends.
+ *
+ *    The DiagnosticLogsProviderDelegate must support that many log collection sessions
+ *    at once.
+ *
+ */
+#ifndef CHIP_CONFIG_MAX_BDX_LOG_PROVIDER_TRANSFERS
+#define CHIP_CONFIG_MAX_BDX_LOG_PROVIDER_TRANSFERS 1
+#endif // CHIP_CONFIG_MAX_BDX_LOG_PROVIDER_TRANSFERS
+
+/**
+ *  @def CHIP_CONFIG_BDX_MAX_BLOCK_WINDOW
+ *
+ *  @brief
+ *    Maximum number of Blocks a BDX sender keeps in flight in a windowed transfer
+ *    (see bdx::TransferControlFlags::kWindowed). The sender keeps a copy of each
+ *    unacknowledged Block for retransmission, so this also bounds the memory used
+ *    by a windowed transfer to this many Blocks.
+ *
+ */
+#ifndef CHIP_CONFIG_BDX_MAX_BLOCK_WINDOW
+#define CHIP_CONFIG_BDX_MAX_BLOCK_WINDOW 4
+#endif // CHIP_CONFIG_BDX_MAX_BLOCK_WINDOW
+
+#if CHIP_CONFIG_BDX_MAX_BLOCK_WINDOW < 1
+#error "CHIP_CONFIG_BDX_MAX_BLOCK_WINDOW must be at least 1"
+#endif
+
+/**
+ *  @def CHIP_CONFIG_BDX_BLOCK_RETRANSMIT_TIMEOUT
+ *
+ *  @brief
+ *    Time, in milliseconds, after which the sender of a windowed BDX transfer resends
+ *    the oldest unacknowledged Block when nothing has been received from the receiver.
+ *
+ */
+#ifndef CHIP_CONFIG_BDX_BLOCK_RETRANSMIT_TIMEOUT
+#define CHIP_CONFIG_BDX_BLOCK_RETRANSMIT_TIMEOUT 2000
+#endif // CHIP_CONFIG_BDX_BLOCK_RETRANSMIT_TIMEOUT
+
+/**
+ *  @def CHIP_CONFIG_BDX_LARGE_PAYLOAD_MAX_BLOCK_SIZE
+ *
+ *  @brief
+ *    Max BDX Block size used for transfers over sessions that allow large
+ *    payloads (e.g. TCP), instead of the MTU-bound size used over MRP.
+ *
+ *    Blocks this large are sent in large PacketBuffers, so this must leave room
+ *    for the message headers within CHIP_SYSTEM_CONFIG_MAX_LARGE_BUFFER_SIZE_BYTES.
+ */
+#ifndef CHIP_CONFIG_BDX_LARGE_PAYLOAD_MAX_BLOCK_SIZE
+#define CHIP_CONFIG_BDX_LARGE_PAYLOAD_MAX_BLOCK_SIZE 32768
+#endif // CHIP_CONFIG_BDX_LARGE_PAYLOAD_MAX_BLOCK_SIZE
+
+#if CHIP_CONFIG_BDX_LARGE_PAYLOAD_MAX_BLOCK_SIZE > 65535
+#error "CHIP_CONFIG_BDX_LARGE_PAYLOAD_MAX_BLOCK_SIZE must fit the 16-bit BDX Max Block Size field"
+#endif
+
+/**
+ *  @def CHIP_CONFIG_OTA_REQUESTOR_DOWNLOAD_CHECKPOINT_INTERVAL
+ *
+ *  @brief
+ *    Bytes of an OTA image downloaded between the checkpoints persisted by the
+ *    OTA requestor, from which an interrupted download resumes.
+ *
+ *    Each checkpoint is a write to persistent storage: a smaller interval
+ *    downloads less again after an interruption, for more writes.
+ */
+#ifndef CHIP_CONFIG_OTA_REQUESTOR_DOWNLOAD_CHECKPOINT_INTERVAL
+#define CHIP_CONFIG_OTA_REQUESTOR_DOWNLOAD_CHECKPOINT_INTERVAL 16384
+#endif // CHIP_CONFIG_OTA_REQUESTOR_DOWNLOAD_CHECKPOINT_INTERVAL
+
 /**
  *  @def CHIP_CONFIG_TEST_GOOGLETEST
  *
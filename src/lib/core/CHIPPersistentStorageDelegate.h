@@ -110,6 +110,17 @@ public:
         CHIP_ERROR err = SyncGetKeyValue(key, nullptr, size);
         return (err == CHIP_ERROR_BUFFER_TOO_SMALL) || (err == CHIP_NO_ERROR);
     }
+
+    /**
+     * @brief
+     *   Waits until the values set or deleted before the call are durable.
+     *
+     *   Used at the points where the specification requires state to survive a reboot, such as the commit of a
+     *   fail-safe.  Only storage that writes its changes in the background has to override it.
+     *
+     * @return CHIP_NO_ERROR on success, or another CHIP_ERROR value from implementation on failure.
+     */
+    virtual CHIP_ERROR SyncFlush() { return CHIP_NO_ERROR; }
 };
 
 } // namespace chip
@@ -44,6 +44,7 @@ enum class Tag : uint8_t
     kReleaseNotesURL       = 7,
     kImageDigestType       = 8,
     kImageDigest           = 9,
+    kPayloadCompression    = 10,
 };
 
 /// Length of the fixed portion of the Matter OTA image header: FileIdentifier (4B), TotalSize (8B) and HeaderSize (4B)
@@ -175,6 +176,18 @@ CHIP_ERROR OTAImageHeaderParser::DecodeTlv(OTAImageHeader & header)
     ReturnErrorOnFailure(tlvReader.Next(TLV::ContextTag(Tag::kImageDigest)));
     ReturnErrorOnFailure(tlvReader.Get(header.mImageDigest));
 
+    // The payload compression comes last, to be skipped by parsers that do not know about it.
+    header.mPayloadCompression = OTAImagePayloadCompression::kNone;
+    CHIP_ERROR error           = tlvReader.Next();
+    if (error == CHIP_NO_ERROR && tlvReader.GetTag() == TLV::ContextTag(Tag::kPayloadCompression))
+    {
+        ReturnErrorOnFailure(tlvReader.Get(header.mPayloadCompression));
+    }
+    else
+    {
+        VerifyOrReturnError(error == CHIP_NO_ERROR || error == CHIP_END_OF_TLV, error);
+    }
+
     ReturnErrorOnFailure(tlvReader.ExitContainer(outerType));
 
     return CHIP_NO_ERROR;
@@ -45,6 +45,13 @@ enum class OTAImageDigestType : uint8_t
     kSha3_512   = 12,
 };
 
+/// Compression of the payload of a Matter OTA image. The payload size and digest are those of the payload as it is stored.
+enum class OTAImagePayloadCompression : uint8_t
+{
+    kNone = 0,
+    kLz4  = 1, ///< Chunks of LZ4 blocks, see OTAImagePayloadDecompressor
+};
+
 struct OTAImageHeader
 {
     uint16_t mVendorId;
@@ -57,6 +64,7 @@ struct OTAImageHeader
     CharSpan mReleaseNotesURL;
     OTAImageDigestType mImageDigestType;
     ByteSpan mImageDigest;
+    OTAImagePayloadCompression mPayloadCompression;
 };
 
 class OTAImageHeaderParser
@@ -0,0 +1,184 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <lib/core/OTAImagePayloadDecompressor.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/Span.h>
+
+#include <algorithm>
+#include <string.h>
+
+namespace chip {
+
+namespace {
+
+/// Length of the header of a compressed chunk: its size (2B)
+constexpr size_t kChunkHeaderSize = 2;
+
+/// Largest LZ4 block that kOTAImageCompressedChunkSize bytes can compress to
+constexpr size_t kMaxCompressedChunkSize = kOTAImageCompressedChunkSize + kOTAImageCompressedChunkSize / 255 + 16;
+
+/// Length of the shortest LZ4 match, which is not included in the match length stored in a block
+constexpr size_t kLz4MinMatch = 4;
+
+CHIP_ERROR Lz4ReadLength(const uint8_t *& input, const uint8_t * inputEnd, size_t & length)
+{
+    uint8_t byte;
+    do
+    {
+        VerifyOrReturnError(input < inputEnd, CHIP_ERROR_INVALID_ARGUMENT);
+        byte = *input++;
+        length += byte;
+    } while (byte == UINT8_MAX);
+
+    return CHIP_NO_ERROR;
+}
+
+/**
+ * Decompress an LZ4 block, see https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+ *
+ * On success, output is reduced to the decompressed data.
+ */
+CHIP_ERROR Lz4DecompressBlock(ByteSpan block, MutableByteSpan & output)
+{
+    const uint8_t * input    = block.data();
+    const uint8_t * inputEnd = block.data() + block.size();
+    size_t outputLength      = 0;
+
+    while (true)
+    {
+        VerifyOrReturnError(input < inputEnd, CHIP_ERROR_INVALID_ARGUMENT);
+        uint8_t token = *input++;
+
+        size_t literalLength = token >> 4;
+        if (literalLength == 15)
+        {
+            ReturnErrorOnFailure(Lz4ReadLength(input, inputEnd, literalLength));
+        }
+
+        VerifyOrReturnError(literalLength <= static_cast<size_t>(inputEnd - input), CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(literalLength <= output.size() - outputLength, CHIP_ERROR_BUFFER_TOO_SMALL);
+        memcpy(output.data() + outputLength, input, literalLength);
+        input += literalLength;
+        outputLength += literalLength;
+
+        // The last sequence of a block only has literals
+        if (input == inputEnd)
+        {
+            break;
+        }
+
+        VerifyOrReturnError(inputEnd - input >= 2, CHIP_ERROR_INVALID_ARGUMENT);
+        size_t offset = Encoding::LittleEndian::Get16(input);
+        input += 2;
+        VerifyOrReturnError(offset != 0 && offset <= outputLength, CHIP_ERROR_INVALID_ARGUMENT);
+
+        size_t matchLength = token & 0xF;
+        if (matchLength == 15)
+        {
+            ReturnErrorOnFailure(Lz4ReadLength(input, inputEnd, matchLength));
+        }
+        matchLength += kLz4MinMatch;
+
+        // A match may overlap the data it produces, so copy it byte by byte
+        VerifyOrReturnError(matchLength <= output.size() - outputLength, CHIP_ERROR_BUFFER_TOO_SMALL);
+        for (size_t i = 0; i < matchLength; i++, outputLength++)
+        {
+            output[outputLength] = output[outputLength - offset];
+        }
+    }
+
+    output.reduce_size(outputLength);
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+CHIP_ERROR OTAImagePayloadDecompressor::Init(OTAImagePayloadCompression compression)
+{
+    Clear();
+    VerifyOrReturnError(compression == OTAImagePayloadCompression::kLz4, CHIP_ERROR_NOT_IMPLEMENTED);
+    if (!mCompressedBuffer.Alloc(kMaxCompressedChunkSize) || !mOutputBuffer.Alloc(kOTAImageCompressedChunkSize))
+    {
+        Clear();
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    mState = State::kChunkHeader;
+
+    return CHIP_NO_ERROR;
+}
+
+void OTAImagePayloadDecompressor::Clear()
+{
+    mState        = State::kNotInitialized;
+    mChunkSize    = 0;
+    mBufferOffset = 0;
+    mCompressedBuffer.Free();
+    mOutputBuffer.Free();
+}
+
+CHIP_ERROR OTAImagePayloadDecompressor::AccumulateAndDecompress(ByteSpan & buffer, ByteSpan & output)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    if (mState == State::kChunkHeader)
+    {
+        Append(buffer, kChunkHeaderSize - mBufferOffset);
+        VerifyOrReturnError(mBufferOffset == kChunkHeaderSize, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+        mChunkSize = Encoding::LittleEndian::Get16(mCompressedBuffer.Get());
+        if (mChunkSize == 0 || mChunkSize > kMaxCompressedChunkSize)
+        {
+            Clear();
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
+
+        mState        = State::kChunk;
+        mBufferOffset = 0;
+    }
+
+    Append(buffer, mChunkSize - mBufferOffset);
+    VerifyOrReturnError(mBufferOffset == mChunkSize, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    MutableByteSpan decompressed(mOutputBuffer.Get(), kOTAImageCompressedChunkSize);
+    CHIP_ERROR error = Lz4DecompressBlock(ByteSpan(mCompressedBuffer.Get(), mChunkSize), decompressed);
+    if (error != CHIP_NO_ERROR)
+    {
+        Clear();
+        return error == CHIP_ERROR_BUFFER_TOO_SMALL ? CHIP_ERROR_INVALID_ARGUMENT : error;
+    }
+
+    mState        = State::kChunkHeader;
+    mBufferOffset = 0;
+    output        = decompressed;
+
+    return CHIP_NO_ERROR;
+}
+
+void OTAImagePayloadDecompressor::Append(ByteSpan & buffer, size_t numBytes)
+{
+    numBytes = std::min(numBytes, buffer.size());
+    memcpy(&mCompressedBuffer[mBufferOffset], buffer.data(), numBytes);
+    mBufferOffset += numBytes;
+    buffer = buffer.SubSpan(numBytes);
+}
+
+} // namespace chip
@@ -0,0 +1,104 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/OTAImageHeader.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/Span.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+
+/// Maximum number of payload bytes held by a chunk of a compressed Matter OTA image payload
+inline constexpr size_t kOTAImageCompressedChunkSize = 4096;
+
+/**
+ * Decompresses the payload of a Matter OTA image as it downloads.
+ *
+ * A compressed payload is a sequence of chunks, each of them made of a little-endian 16-bit length followed by that many bytes
+ * of a compressed block. A block holds at most kOTAImageCompressedChunkSize bytes of the original payload, so that a requestor
+ * needs no more than a chunk of each to decompress the payload into flash.
+ */
+class OTAImagePayloadDecompressor
+{
+public:
+    /**
+     * @brief Prepare the decompressor for accepting subsequent chunks of a payload compressed as described by the image header.
+     *
+     * The method can be called many times to reset the decompressor state.
+     *
+     * @retval CHIP_ERROR_NOT_IMPLEMENTED  The compression is not supported.
+     */
+    CHIP_ERROR Init(OTAImagePayloadCompression compression);
+
+    /**
+     * @brief Clear all resources associated with the decompressor.
+     */
+    void Clear();
+
+    /**
+     * @brief Returns if the decompressor is ready to accept subsequent payload chunks.
+     */
+    bool IsInitialized() const { return mState != State::kNotInitialized; }
+
+    /**
+     * @brief Returns if the data accepted so far ends in the middle of a chunk.
+     */
+    bool HasPartialChunk() const { return mState == State::kChunk || mBufferOffset != 0; }
+
+    /**
+     * @brief Decompress the next chunk of the payload
+     *
+     * The method takes subsequent parts of the compressed payload and decompresses a chunk when all of it has been provided.
+     * If more data is needed, CHIP_ERROR_BUFFER_TOO_SMALL error is returned. Other error codes indicate that the payload is
+     * invalid.
+     *
+     * @param buffer Byte span containing a subsequent part of the compressed payload. When the method returns CHIP_NO_ERROR,
+     *               the byte span is used to return the part of it that follows the decompressed chunk, which must be passed
+     *               to the next call.
+     * @param output Byte span to return the decompressed data. It points to a buffer of the decompressor, which is only valid
+     *               until the next call.
+     *
+     * @retval CHIP_NO_ERROR                A chunk has been decompressed.
+     * @retval CHIP_ERROR_BUFFER_TOO_SMALL  The provided data does not complete the current chunk. A user is expected to call
+     *                                      the method again when more of the payload is available.
+     * @retval Error code                   The compressed payload is invalid.
+     */
+    CHIP_ERROR AccumulateAndDecompress(ByteSpan & buffer, ByteSpan & output);
+
+private:
+    enum State
+    {
+        kNotInitialized,
+        kChunkHeader,
+        kChunk
+    };
+
+    void Append(ByteSpan & buffer, size_t numBytes);
+
+    State mState         = State::kNotInitialized;
+    size_t mChunkSize    = 0;
+    size_t mBufferOffset = 0;
+    Platform::ScopedMemoryBuffer<uint8_t> mCompressedBuffer;
+    Platform::ScopedMemoryBuffer<uint8_t> mOutputBuffer;
+};
+
+} // namespace chip
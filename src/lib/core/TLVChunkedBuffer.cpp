@@ -0,0 +1,132 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/TLVChunkedBuffer.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/TLVCommon.h>
+
+namespace chip {
+namespace TLV {
+
+TlvChunkedBuffer::TlvChunkedBuffer(uint32_t chunkSize) : mChunkSize(chunkSize > 0 ? chunkSize : kDefaultChunkSize) {}
+
+TlvChunkedBuffer::~TlvChunkedBuffer() = default;
+
+size_t TlvChunkedBuffer::GetLength() const
+{
+    size_t length = 0;
+    for (const auto & chunk : mChunks)
+    {
+        length += chunk.size();
+    }
+    return length;
+}
+
+CHIP_ERROR TlvChunkedBuffer::OnInit(TLVReader & /*reader*/, const uint8_t *& bufStart, uint32_t & bufLen)
+{
+    bufStart = nullptr;
+    bufLen   = 0;
+    GetChunk(0, bufStart, bufLen);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TlvChunkedBuffer::GetNextBuffer(TLVReader & /*reader*/, const uint8_t *& bufStart, uint32_t & bufLen)
+{
+    // bufStart points one byte beyond the data consumed so far, i.e. at the end
+    // of some chunk. Look the chunk up rather than tracking a cursor, so that
+    // copies of a reader can advance independently.
+    bufLen = 0;
+    if (bufStart == nullptr)
+    {
+        // Nothing was written.
+        return CHIP_NO_ERROR;
+    }
+
+    for (size_t i = 0; i < mChunks.size(); i++)
+    {
+        if (!mChunks[i].empty() && mChunks[i].data() + mChunks[i].size() == bufStart)
+        {
+            GetChunk(i + 1, bufStart, bufLen);
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    return CHIP_ERROR_INCORRECT_STATE;
+}
+
+CHIP_ERROR TlvChunkedBuffer::OnInit(TLVWriter & /*writer*/, uint8_t *& bufStart, uint32_t & bufLen)
+{
+    VerifyOrReturnError(mChunks.empty(), CHIP_ERROR_INCORRECT_STATE);
+
+    AppendChunk(bufStart, bufLen);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TlvChunkedBuffer::GetNewBuffer(TLVWriter & /*writer*/, uint8_t *& bufStart, uint32_t & bufLen)
+{
+    VerifyOrReturnError(!mChunks.empty(), CHIP_ERROR_INCORRECT_STATE);
+
+    AppendChunk(bufStart, bufLen);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TlvChunkedBuffer::FinalizeBuffer(TLVWriter & /*writer*/, uint8_t * bufStart, uint32_t bufLen)
+{
+    VerifyOrReturnError(!mChunks.empty(), CHIP_ERROR_INCORRECT_STATE);
+
+    // The writer only ever fills the most recently appended chunk.
+    std::vector<uint8_t> & chunk = mChunks.back();
+    VerifyOrReturnError(chunk.data() == bufStart, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(bufLen <= chunk.size(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    // Shrinking does not reallocate, so the written bytes stay in place.
+    chunk.resize(bufLen);
+
+    return CHIP_NO_ERROR;
+}
+
+void TlvChunkedBuffer::AppendChunk(uint8_t *& bufStart, uint32_t & bufLen)
+{
+    mChunks.emplace_back(mChunkSize);
+    bufStart = mChunks.back().data();
+    bufLen   = mChunkSize;
+}
+
+void TlvChunkedBuffer::GetChunk(size_t index, const uint8_t *& bufStart, uint32_t & bufLen) const
+{
+    // Skip chunks the writer finalized without writing to them.
+    while (index < mChunks.size() && mChunks[index].empty())
+    {
+        index++;
+    }
+
+    // Past the last chunk bufStart is left alone and bufLen stays 0, which
+    // tells the reader that the end of the data was reached.
+    VerifyOrReturn(index < mChunks.size());
+
+    bufStart = mChunks[index].data();
+    bufLen   = static_cast<uint32_t>(mChunks[index].size());
+}
+
+} // namespace TLV
+} // namespace chip
@@ -0,0 +1,80 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/TLVBackingStore.h>
+#include <lib/core/TLVCommon.h>
+
+namespace chip {
+namespace TLV {
+
+// Implementation of TLVBackingStore that keeps the written data in a list of
+// fixed-size chunks. Unlike TlvVectorWriter, growing the encoding only
+// allocates a new chunk: bytes that were already written are never copied
+// again, which keeps large encodes linear.
+//
+// A TLVWriter initialized with this store appends to it; once the writer has
+// been finalized, any number of TLVReaders can be initialized with the same
+// store to read the data back across the chunk boundaries.
+// This class is not thread-safe, it must be constructed, used, and destroyed on
+// a single thread.
+class TlvChunkedBuffer : public TLVBackingStore
+{
+public:
+    static constexpr uint32_t kDefaultChunkSize = 1280;
+
+    TlvChunkedBuffer(uint32_t chunkSize = kDefaultChunkSize);
+    TlvChunkedBuffer(const TlvChunkedBuffer &)             = delete;
+    TlvChunkedBuffer & operator=(const TlvChunkedBuffer &) = delete;
+    ~TlvChunkedBuffer() override;
+
+    // Total number of bytes written by a finalized writer.
+    size_t GetLength() const;
+
+    // Number of chunks holding the written data.
+    size_t GetChunkCount() const { return mChunks.size(); }
+
+    // Releases all chunks, so the store can be used by a new writer.
+    void Clear() { mChunks.clear(); }
+
+    // TLVBackingStore implementation:
+    CHIP_ERROR OnInit(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override;
+    CHIP_ERROR GetNextBuffer(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override;
+    CHIP_ERROR OnInit(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override;
+    CHIP_ERROR GetNewBuffer(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override;
+    CHIP_ERROR FinalizeBuffer(TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen) override;
+
+private:
+    void AppendChunk(uint8_t *& bufStart, uint32_t & bufLen);
+    // Points bufStart and bufLen at the first non-empty chunk at or after index,
+    // if there is one.
+    void GetChunk(size_t index, const uint8_t *& bufStart, uint32_t & bufLen) const;
+
+    // Each chunk is allocated with mChunkSize bytes and shrunk to the number of
+    // bytes actually written when the writer finalizes it. Moving a chunk when
+    // mChunks grows does not move its data, so the pointers handed out to the
+    // writer and readers stay valid.
+    std::vector<std::vector<uint8_t>> mChunks;
+    const uint32_t mChunkSize;
+};
+
+} // namespace TLV
+} // namespace chip
@@ -35,7 +35,9 @@
 #include <lib/support/BufferWriter.h>
 #include <lib/support/CodeUtils.h>
 
+#include <algorithm>
 #include <stdint.h>
+#include <string.h>
 
 namespace chip {
 namespace TLV {
@@ -162,6 +164,36 @@ CHIP_ERROR TLVCircularBuffer::EvictHead()
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR TLVCircularBuffer::MoveHeadTo(TLVCircularBuffer & aDest, uint32_t aLength)
+{
+    VerifyOrReturnError(&aDest != this, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aLength <= mQueueLength && aLength <= aDest.AvailableDataLength(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    while (aLength > 0)
+    {
+        // Copy the largest run that is contiguous in both buffers.
+        uint8_t * destStart;
+        uint32_t destLen;
+        aDest.GetCurrentWritableBuffer(destStart, destLen);
+
+        uint32_t chunkLen = mQueueSize - static_cast<uint32_t>(mQueueHead - mQueue);
+        chunkLen          = std::min(chunkLen, std::min(destLen, aLength));
+
+        memcpy(destStart, mQueueHead, chunkLen);
+        aDest.mQueueLength += chunkLen;
+
+        mQueueHead += chunkLen;
+        if (mQueueHead == mQueue + mQueueSize)
+        {
+            mQueueHead = mQueue;
+        }
+        mQueueLength -= chunkLen;
+        aLength -= chunkLen;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 /**
  * @brief
  *  Implements TLVBackingStore::OnInit(TLVWriter) for circular buffers.
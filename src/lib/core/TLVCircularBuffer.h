@@ -70,6 +70,20 @@ public:
 
     CHIP_ERROR EvictHead();
 
+    /**
+     * @brief
+     *   Move the first bytes of this buffer to the tail of another one, as they are, without decoding or re-encoding them.
+     *
+     *   The moved bytes must hold whole top-level elements, e.g. as measured by the reader passed to
+     *   mProcessEvictedElement, so that both buffers keep starting and ending on element boundaries.
+     *
+     * @param[in] aDest    The buffer receiving the bytes.
+     * @param[in] aLength  The number of bytes to move.
+     *
+     * @retval #CHIP_ERROR_INVALID_ARGUMENT  If this buffer holds fewer bytes, or aDest has less space available.
+     */
+    CHIP_ERROR MoveHeadTo(TLVCircularBuffer & aDest, uint32_t aLength);
+
     // chip::TLV::TLVBackingStore overrides:
     CHIP_ERROR OnInit(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override;
     CHIP_ERROR GetNextBuffer(TLVReader & ioReader, const uint8_t *& outBufStart, uint32_t & outBufLen) override;
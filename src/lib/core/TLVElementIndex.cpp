@@ -0,0 +1,109 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <lib/core/TLVElementIndex.h>
+
+#include <string.h>
+
+#include <lib/core/TLVTypes.h>
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace TLV {
+
+CHIP_ERROR TLVElementIndex::Init(const TLVReader & reader)
+{
+    Reset();
+
+    VerifyOrReturnError(TLVTypeIsContainer(reader.GetType()), CHIP_ERROR_WRONG_TLV_TYPE);
+    VerifyOrReturnError(reader.mBackingStore == nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    TLVReader container;
+    container.Init(reader);
+    ReturnErrorOnFailure(container.OpenContainer(mStart));
+
+    mCursor.Init(mStart);
+    mInitialized = true;
+    return CHIP_NO_ERROR;
+}
+
+void TLVElementIndex::Reset()
+{
+    mOffsets.Free();
+    mCapacity     = 0;
+    mCount        = 0;
+    mFullyIndexed = false;
+    mInitialized  = false;
+}
+
+CHIP_ERROR TLVElementIndex::Get(size_t index, TLVReader & reader)
+{
+    ReturnErrorOnFailure(IndexUpTo(index));
+
+    // Rewind to the head of the element, and read it again.
+    const uint32_t offset = mOffsets[index];
+    reader.Init(mStart);
+    reader.mReadPoint += offset;
+    reader.mLenRead += offset;
+    return reader.Next();
+}
+
+CHIP_ERROR TLVElementIndex::GetCount(size_t & count)
+{
+    CHIP_ERROR err = IndexUpTo(SIZE_MAX);
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    count = mCount;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TLVElementIndex::IndexUpTo(size_t index)
+{
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+
+    while (index >= mCount)
+    {
+        VerifyOrReturnError(!mFullyIndexed, CHIP_END_OF_TLV);
+
+        CHIP_ERROR err = mCursor.Next();
+        if (err == CHIP_END_OF_TLV)
+        {
+            mFullyIndexed = true;
+        }
+        ReturnErrorOnFailure(err);
+
+        if (mCount == mCapacity)
+        {
+            size_t capacity = (mCapacity == 0) ? kInitialCapacity : mCapacity * 2;
+            Platform::ScopedMemoryBuffer<uint32_t> offsets;
+            VerifyOrReturnError(offsets.Alloc(capacity).Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+            if (mCount > 0)
+            {
+                memcpy(offsets.Get(), mOffsets.Get(), mCount * sizeof(uint32_t));
+            }
+            mOffsets  = std::move(offsets);
+            mCapacity = capacity;
+        }
+
+        uint8_t headLen;
+        ReturnErrorOnFailure(mCursor.GetElementHeadLength(headLen));
+        mOffsets[mCount++] = mCursor.mLenRead - headLen - mStart.mLenRead;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+} // namespace TLV
+} // namespace chip
@@ -0,0 +1,91 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/TLVReader.h>
+#include <lib/support/DLLUtil.h>
+#include <lib/support/ScopedBuffer.h>
+
+namespace chip {
+namespace TLV {
+
+/**
+ * Provides random access to the elements of an encoded TLV container.
+ *
+ * The index records where each element of the container starts the first time it is walked past, so reaching
+ * an element that has been reached before, or any element before it, costs a single lookup instead of a walk
+ * from the start of the container. Indexing is lazy: Get(n) only walks as far as element n.
+ *
+ * The container must be in a contiguous buffer (no TLVBackingStore), which must outlive the index and not
+ * change while it is in use.
+ */
+class DLL_EXPORT TLVElementIndex
+{
+public:
+    TLVElementIndex() = default;
+
+    TLVElementIndex(const TLVElementIndex &)             = delete;
+    TLVElementIndex & operator=(const TLVElementIndex &) = delete;
+
+    /**
+     * Prepare to index the container @p reader is positioned on. @p reader is not modified.
+     *
+     * @retval CHIP_ERROR_WRONG_TLV_TYPE     If the reader is not positioned on a container.
+     * @retval CHIP_ERROR_INVALID_ARGUMENT   If the reader reads from a TLVBackingStore.
+     */
+    CHIP_ERROR Init(const TLVReader & reader);
+
+    /**
+     * Forget the container and free the index.
+     */
+    void Reset();
+
+    /**
+     * Position @p reader on element @p index of the container, as if Next() had been called @p index + 1 times on a
+     * reader that had just entered the container. Calling Next() on @p reader then moves on to the following elements.
+     *
+     * @retval CHIP_END_OF_TLV               If the container has @p index elements or fewer.
+     * @retval CHIP_ERROR_NO_MEMORY          If the index could not grow to record the element.
+     * @retval other                         Errors returned by TLVReader::Next() while walking the container.
+     */
+    CHIP_ERROR Get(size_t index, TLVReader & reader);
+
+    /**
+     * Count the elements of the container, indexing all of them.
+     */
+    CHIP_ERROR GetCount(size_t & count);
+
+private:
+    static constexpr size_t kInitialCapacity = 16;
+
+    CHIP_ERROR IndexUpTo(size_t index);
+
+    TLVReader mStart;  // In the container, before its first element.
+    TLVReader mCursor; // On the last element indexed so far.
+    Platform::ScopedMemoryBuffer<uint32_t> mOffsets;
+    size_t mCapacity   = 0;
+    size_t mCount      = 0;
+    bool mFullyIndexed = false;
+    bool mInitialized  = false;
+};
+
+} // namespace TLV
+} // namespace chip
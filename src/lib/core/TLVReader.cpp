@@ -47,7 +47,55 @@ namespace TLV {
 
 using namespace chip::Encoding;
 
-static const uint8_t sTagSizes[] = { 0, 1, 2, 4, 2, 4, 6, 8 };
+static constexpr uint8_t sTagSizes[] = { 0, 1, 2, 4, 2, 4, 6, 8 };
+
+namespace {
+
+/**
+ * What a control byte says about the head of its element, so that ReadElement() can size the head with one lookup.
+ */
+struct ControlByteInfo
+{
+    uint8_t headBytes;     // Control byte, tag and length/value field; 0 if the element type is invalid.
+    uint8_t valOrLenBytes; // Size of the length/value field.
+};
+
+constexpr ControlByteInfo MakeControlByteInfo(uint8_t controlByte)
+{
+    const auto elemType = static_cast<TLVElementType>(controlByte & kTLVTypeMask);
+    if (!IsValidTLVType(elemType))
+    {
+        return ControlByteInfo{ 0, 0 };
+    }
+
+    const uint8_t tagBytes      = sTagSizes[(controlByte & kTLVTagControlMask) >> kTLVTagControlShift];
+    const uint8_t valOrLenBytes = TLVFieldSizeToBytes(GetTLVFieldSize(elemType));
+    return ControlByteInfo{ static_cast<uint8_t>(1 + tagBytes + valOrLenBytes), valOrLenBytes };
+}
+
+struct ControlByteTable
+{
+    constexpr ControlByteTable() : entries()
+    {
+        for (unsigned i = 0; i < 256; i++)
+        {
+            entries[i] = MakeControlByteInfo(static_cast<uint8_t>(i));
+        }
+    }
+
+    ControlByteInfo entries[256];
+};
+
+constexpr ControlByteTable sControlByteTable;
+
+// Context tag 1, UInt32: 1 + 1 + 4.
+static_assert(sControlByteTable.entries[0x26].headBytes == 6);
+// Fully qualified 8 byte tag, UTF8 string with 8 byte length: 1 + 8 + 8.
+static_assert(sControlByteTable.entries[0xF3].headBytes == 17 && sControlByteTable.entries[0xF3].valOrLenBytes == 8);
+// Element type 0x19 is reserved.
+static_assert(sControlByteTable.entries[0x19].headBytes == 0);
+
+} // namespace
 
 TLVReader::TLVReader() :
     ImplicitProfileId(kProfileIdNotSpecified), AppData(nullptr), mElemLenOrVal(0), mBackingStore(nullptr), mReadPoint(nullptr),
@@ -744,46 +792,41 @@ CHIP_ERROR TLVReader::ReadElement()
     ReturnErrorOnFailure(EnsureData(CHIP_END_OF_TLV));
     VerifyOrReturnError(mReadPoint != nullptr, CHIP_ERROR_INVALID_TLV_ELEMENT);
 
-    // Get the element's control byte.
-    mControlByte = *mReadPoint;
-
-    // Extract the element type from the control byte. Fail if it's invalid.
-    TLVElementType elemType = ElementType();
-    VerifyOrReturnError(IsValidTLVType(elemType), CHIP_ERROR_INVALID_TLV_ELEMENT);
-
-    // Extract the tag control from the control byte.
-    TLVTagControl tagControl = static_cast<TLVTagControl>(mControlByte & kTLVTagControlMask);
-
-    // Determine the number of bytes in the element's tag, if any.
-    uint8_t tagBytes = sTagSizes[tagControl >> kTLVTagControlShift];
-
-    // Extract the size of length/value field from the control byte.
-    TLVFieldSize lenOrValFieldSize = GetTLVFieldSize(elemType);
+    // Get the element's control byte, and from it the sizes of the element's 'head'. This includes: the control byte, the
+    // tag bytes (if present), the length bytes (if present), and for elements that don't have a length (e.g. integers), the
+    // value bytes. Fail if the element type is invalid.
+    mControlByte               = *mReadPoint;
+    const ControlByteInfo info = sControlByteTable.entries[*mReadPoint];
+    VerifyOrReturnError(info.headBytes != 0, CHIP_ERROR_INVALID_TLV_ELEMENT);
 
-    // Determine the number of bytes in the length/value field.
-    const uint8_t valOrLenBytes = TLVFieldSizeToBytes(lenOrValFieldSize);
-
-    // Determine the number of bytes in the element's 'head'. This includes: the control byte, the tag bytes (if present), the
-    // length bytes (if present), and for elements that don't have a length (e.g. integers), the value bytes.
-    const uint8_t elemHeadBytes = static_cast<uint8_t>(1 + tagBytes + valOrLenBytes);
+    const uint8_t * p;
 
     // 17 = 1 control byte + 8 tag bytes + 8 length/value bytes
     uint8_t stagingBuf[17];
 
-    // Odd workaround: clang-tidy claims garbage value otherwise as it does not
-    // understand that ReadData initializes stagingBuf
-    stagingBuf[1] = 0;
+    if (mBufEnd - mReadPoint >= info.headBytes)
+    {
+        // Usual case: the head is contiguous in the current input buffer, so parse it in place.
+        p = mReadPoint + 1;
+        mReadPoint += info.headBytes;
+        mLenRead += info.headBytes;
+    }
+    else
+    {
+        // Odd workaround: clang-tidy claims garbage value otherwise as it does not
+        // understand that ReadData initializes stagingBuf
+        stagingBuf[1] = 0;
 
-    // If the head of the element goes past the end of the current input buffer,
-    // we need to read it into the staging buffer to parse it.  Just do that unconditionally,
-    // even if the head does not go past end of current buffer, to save codesize.
-    ReturnErrorOnFailure(ReadData(stagingBuf, elemHeadBytes));
+        // The head of the element goes past the end of the current input buffer, so read it into the staging buffer
+        // to parse it.
+        ReturnErrorOnFailure(ReadData(stagingBuf, info.headBytes));
 
-    // +1 to skip over the control byte
-    const uint8_t * p = stagingBuf + 1;
+        // +1 to skip over the control byte
+        p = stagingBuf + 1;
+    }
 
     // Read the tag field, if present.
-    mElemTag      = ReadTag(tagControl, p);
+    mElemTag      = ReadTag(static_cast<TLVTagControl>(mControlByte & kTLVTagControlMask), p);
     mElemLenOrVal = 0;
 
     // Read the length/value field, if present.
@@ -791,10 +834,10 @@ CHIP_ERROR TLVReader::ReadElement()
     //       the rest 0. Value looks like "<le-byte> <le-byte> ... <le-byte> 0 0 ... 0"
     //       which is the TLV format. HostSwap ensures this becomes a real host value
     //       (should be a NOOP on LE machines, will full-swap on big-endian machines)
-    memcpy(&mElemLenOrVal, p, valOrLenBytes);
+    memcpy(&mElemLenOrVal, p, info.valOrLenBytes);
     LittleEndian::HostSwap(mElemLenOrVal);
 
-    VerifyOrReturnError(!TLVTypeHasLength(elemType) || (mElemLenOrVal <= UINT32_MAX), CHIP_ERROR_NOT_IMPLEMENTED);
+    VerifyOrReturnError(!TLVTypeHasLength(ElementType()) || (mElemLenOrVal <= UINT32_MAX), CHIP_ERROR_NOT_IMPLEMENTED);
 
     return VerifyElement();
 }
@@ -936,34 +979,13 @@ CHIP_ERROR TLVReader::EnsureData(CHIP_ERROR noDataErr)
  */
 CHIP_ERROR TLVReader::GetElementHeadLength(uint8_t & elemHeadBytes) const
 {
-    uint8_t tagBytes;
-    uint8_t valOrLenBytes;
-    TLVTagControl tagControl;
-    TLVFieldSize lenOrValFieldSize;
-    TLVElementType elemType = ElementType();
-
     // Verify element is of valid TLVType.
-    VerifyOrReturnError(IsValidTLVType(elemType), CHIP_ERROR_INVALID_TLV_ELEMENT);
-
-    // Extract the tag control from the control byte.
-    tagControl = static_cast<TLVTagControl>(mControlByte & kTLVTagControlMask);
-
-    // Determine the number of bytes in the element's tag, if any.
-    tagBytes = sTagSizes[tagControl >> kTLVTagControlShift];
-
-    // Extract the size of length/value field from the control byte.
-    lenOrValFieldSize = GetTLVFieldSize(elemType);
-
-    // Determine the number of bytes in the length/value field.
-    valOrLenBytes = TLVFieldSizeToBytes(lenOrValFieldSize);
+    VerifyOrReturnError(ElementType() != TLVElementType::NotSpecified, CHIP_ERROR_INVALID_TLV_ELEMENT);
 
-    // Determine the number of bytes in the element's 'head'. This includes: the
-    // control byte, the tag bytes (if present), the length bytes (if present),
-    // and for elements that don't have a length (e.g. integers), the value
-    // bytes.
-    VerifyOrReturnError(CanCastTo<uint8_t>(1 + tagBytes + valOrLenBytes), CHIP_ERROR_INTERNAL);
-    elemHeadBytes = static_cast<uint8_t>(1 + tagBytes + valOrLenBytes);
+    const ControlByteInfo info = sControlByteTable.entries[static_cast<uint8_t>(mControlByte)];
+    VerifyOrReturnError(info.headBytes != 0, CHIP_ERROR_INVALID_TLV_ELEMENT);
 
+    elemHeadBytes = info.headBytes;
     return CHIP_NO_ERROR;
 }
 
@@ -17,6 +17,7 @@
  */
 #include <lib/core/TLVUpdater.h>
 
+#include <cmath>
 #include <stdint.h>
 #include <string.h>
 
@@ -47,7 +48,10 @@ CHIP_ERROR TLVUpdater::Init(uint8_t * buf, uint32_t dataLen, uint32_t maxLen)
 
     // memmove the buffer data to end of the buffer
     freeLen = maxLen - dataLen;
-    memmove(buf + freeLen, buf, dataLen);
+    if (freeLen > 0)
+    {
+        memmove(buf + freeLen, buf, dataLen);
+    }
 
     // Init reader
     mUpdaterReader.Init(buf + freeLen, dataLen);
@@ -166,8 +170,11 @@ CHIP_ERROR TLVUpdater::Move()
 
     copyLen = static_cast<uint32_t>(elementEnd - mElementStartAddr);
 
-    // Move the element to output TLV
-    memmove(mUpdaterWriter.mWritePoint, mElementStartAddr, copyLen);
+    // Move the element to output TLV. When the updater has no free space, the element is already in place.
+    if (mUpdaterWriter.mWritePoint != mElementStartAddr)
+    {
+        memmove(mUpdaterWriter.mWritePoint, mElementStartAddr, copyLen);
+    }
 
     // Adjust the updater state
     mElementStartAddr += copyLen;
@@ -187,7 +194,10 @@ void TLVUpdater::MoveUntilEnd()
     uint32_t copyLen = static_cast<uint32_t>(buffEnd - mElementStartAddr);
 
     // Move all elements till end to output TLV
-    memmove(mUpdaterWriter.mWritePoint, mElementStartAddr, copyLen);
+    if (mUpdaterWriter.mWritePoint != mElementStartAddr)
+    {
+        memmove(mUpdaterWriter.mWritePoint, mElementStartAddr, copyLen);
+    }
 
     // TODO(#30825): Need to ensure public API is used rather than touching the innards.
     // Adjust the updater state
@@ -240,6 +250,88 @@ CHIP_ERROR TLVUpdater::ExitContainer(TLVType outerContainerType)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR TLVUpdater::ReplaceSignedInPlace(int64_t v)
+{
+    const TLVElementType elemType = mUpdaterReader.ElementType();
+    VerifyOrReturnError(elemType >= TLVElementType::Int8 && elemType <= TLVElementType::Int64, CHIP_ERROR_WRONG_TLV_TYPE);
+
+    const uint8_t width = TLVFieldSizeToBytes(GetTLVFieldSize(elemType));
+    if (width < sizeof(int64_t))
+    {
+        const int64_t limit = static_cast<int64_t>(1) << (width * 8 - 1);
+        VerifyOrReturnError(v >= -limit && v < limit, CHIP_ERROR_BUFFER_TOO_SMALL);
+    }
+
+    OverwriteValueBytes(static_cast<uint64_t>(v), width);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TLVUpdater::ReplaceUnsignedInPlace(uint64_t v)
+{
+    const TLVElementType elemType = mUpdaterReader.ElementType();
+    VerifyOrReturnError(elemType >= TLVElementType::UInt8 && elemType <= TLVElementType::UInt64, CHIP_ERROR_WRONG_TLV_TYPE);
+
+    const uint8_t width = TLVFieldSizeToBytes(GetTLVFieldSize(elemType));
+    VerifyOrReturnError(width == sizeof(uint64_t) || v < (static_cast<uint64_t>(1) << (width * 8)), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    OverwriteValueBytes(v, width);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TLVUpdater::ReplaceInPlace(bool v)
+{
+    const TLVElementType elemType = mUpdaterReader.ElementType();
+    VerifyOrReturnError(elemType == TLVElementType::BooleanFalse || elemType == TLVElementType::BooleanTrue,
+                        CHIP_ERROR_WRONG_TLV_TYPE);
+
+    // A boolean has no value bytes: the value is the element type in the control byte, at the start of the element.
+    const TLVElementType newType = v ? TLVElementType::BooleanTrue : TLVElementType::BooleanFalse;
+    const uint8_t controlByte    = static_cast<uint8_t>((mUpdaterReader.mControlByte & ~kTLVTypeMask) | static_cast<uint8_t>(newType));
+    *const_cast<uint8_t *>(mElementStartAddr) = controlByte;
+    mUpdaterReader.mControlByte                = controlByte;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TLVUpdater::ReplaceInPlace(double v)
+{
+    const TLVElementType elemType = mUpdaterReader.ElementType();
+    if (elemType == TLVElementType::FloatingPointNumber64)
+    {
+        uint64_t bits;
+        memcpy(&bits, &v, sizeof(bits));
+        OverwriteValueBytes(bits, sizeof(bits));
+        return CHIP_NO_ERROR;
+    }
+
+    VerifyOrReturnError(elemType == TLVElementType::FloatingPointNumber32, CHIP_ERROR_WRONG_TLV_TYPE);
+
+    // Only values that survive the round trip through a float fit a 32-bit element.
+    const float f = static_cast<float>(v);
+    VerifyOrReturnError(static_cast<double>(f) == v || std::isnan(v), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    OverwriteValueBytes(bits, sizeof(bits));
+    return CHIP_NO_ERROR;
+}
+
+/**
+ * This is a private method that writes the low @p width bytes of @p v over the value field of the
+ * scalar element the reader is positioned on. The reader has consumed the value field, so it ends
+ * at the current read point.
+ */
+void TLVUpdater::OverwriteValueBytes(uint64_t v, uint8_t width)
+{
+    uint8_t * p = const_cast<uint8_t *>(mUpdaterReader.mReadPoint) - width;
+    for (uint8_t i = 0; i < width; i++)
+    {
+        p[i] = static_cast<uint8_t>(v >> (i * 8));
+    }
+
+    // Keep the reader consistent, so that a Get() returns the new value.
+    mUpdaterReader.mElemLenOrVal = (width == sizeof(uint64_t)) ? v : (v & ((static_cast<uint64_t>(1) << (width * 8)) - 1));
+}
+
 /**
  * This is a private method that adjusts the TLVUpdater's free space count by
  * accounting for the freespace from mElementStartAddr to current read point.
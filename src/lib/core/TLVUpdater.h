@@ -18,6 +18,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <type_traits>
 
 #include <lib/core/CHIPError.h>
 #include <lib/core/TLVReader.h>
@@ -387,8 +388,49 @@ public:
     uint32_t GetLengthWritten() { return mUpdaterWriter.GetLengthWritten(); }
     uint32_t GetRemainingFreeLength() const { return mUpdaterWriter.mRemainingLen; }
 
+    // In-place edits
+
+    /**
+     * Replaces the value of the current element without re-encoding it.
+     *
+     * The TLVUpdater's reader must be positioned on a fixed-width scalar (an integer of the same
+     * signedness, a boolean or a floating point number) by a call to Next(). The value bytes of
+     * the element are overwritten in the input TLV: the element keeps its tag, type and width and
+     * so its encoded size, and the application then calls Move() (or MoveUntilEnd()) to copy it to
+     * the output like any other element it keeps.
+     *
+     * When the updater was initialized with no free space (@p dataLen equal to @p maxLen), the
+     * input and output TLV share the buffer and nothing is actually moved, so a value can be
+     * patched without copying the rest of the encoding.
+     *
+     * @retval #CHIP_NO_ERROR                  If the value was replaced.
+     * @retval #CHIP_ERROR_WRONG_TLV_TYPE      If the reader is not positioned on a scalar of a
+     *                                          compatible type.
+     * @retval #CHIP_ERROR_BUFFER_TOO_SMALL    If the value cannot be represented in the width of
+     *                                          the existing element. The application has to
+     *                                          re-encode the element instead.
+     */
+    template <typename T, std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, int> = 0>
+    CHIP_ERROR ReplaceInPlace(T v)
+    {
+        if constexpr (std::is_signed<T>::value)
+        {
+            return ReplaceSignedInPlace(static_cast<int64_t>(v));
+        }
+        else
+        {
+            return ReplaceUnsignedInPlace(static_cast<uint64_t>(v));
+        }
+    }
+    CHIP_ERROR ReplaceInPlace(bool v);
+    CHIP_ERROR ReplaceInPlace(float v) { return ReplaceInPlace(static_cast<double>(v)); }
+    CHIP_ERROR ReplaceInPlace(double v);
+
 private:
     void AdjustInternalWriterFreeSpace();
+    CHIP_ERROR ReplaceSignedInPlace(int64_t v);
+    CHIP_ERROR ReplaceUnsignedInPlace(uint64_t v);
+    void OverwriteValueBytes(uint64_t v, uint8_t width);
 
     TLVWriter mUpdaterWriter;
     TLVReader mUpdaterReader;
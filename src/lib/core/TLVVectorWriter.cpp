@@ -72,8 +72,6 @@ CHIP_ERROR TlvVectorWriter::TlvVectorBuffer::FinalizeBuffer(TLVWriter & /*writer
     mFinalBuffer.insert(mFinalBuffer.end(), mWritingBuffer.begin(), mWritingBuffer.end());
     mWritingBuffer.resize(0);
 
-    mFinalBuffer.shrink_to_fit();
-
     return CHIP_NO_ERROR;
 }
 
@@ -64,7 +64,7 @@ using namespace chip::Encoding;
 TLVWriter::TLVWriter() :
     ImplicitProfileId(kProfileIdNotSpecified), AppData(nullptr), mBackingStore(nullptr), mBufStart(nullptr), mWritePoint(nullptr),
     mRemainingLen(0), mLenWritten(0), mMaxLen(0), mReservedSize(0), mContainerType(kTLVType_NotSpecified), mInitializationCookie(0),
-    mContainerOpen(false), mCloseContainerReserved(true)
+    mContainerOpen(false), mCloseContainerReserved(true), mSizeOnly(false)
 {}
 
 NO_INLINE void TLVWriter::Init(uint8_t * buf, size_t maxLen)
@@ -82,6 +82,7 @@ NO_INLINE void TLVWriter::Init(uint8_t * buf, size_t maxLen)
     mMaxLen               = actualMaxLen;
     mContainerType        = kTLVType_NotSpecified;
     mReservedSize         = 0;
+    mSizeOnly             = false;
     SetContainerOpen(false);
     SetCloseContainerReserved(true);
 
@@ -89,6 +90,12 @@ NO_INLINE void TLVWriter::Init(uint8_t * buf, size_t maxLen)
     mInitializationCookie = kExpectedInitializationCookie;
 }
 
+void TLVWriter::InitSizeOnly(uint32_t maxLen /* = UINT32_MAX */)
+{
+    Init(nullptr, maxLen);
+    mSizeOnly = true;
+}
+
 CHIP_ERROR TLVWriter::Init(TLVBackingStore & backingStore, uint32_t maxLen /* = UINT32_MAX */)
 {
     // TODO(#30825): Need to ensure a single init path for this complex data.
@@ -506,6 +513,7 @@ CHIP_ERROR TLVWriter::OpenContainer(Tag tag, TLVType containerType, TLVWriter &
     containerWriter.mContainerType = containerType;
     containerWriter.SetContainerOpen(false);
     containerWriter.SetCloseContainerReserved(IsCloseContainerReserved());
+    containerWriter.mSizeOnly             = mSizeOnly;
     containerWriter.ImplicitProfileId     = ImplicitProfileId;
     containerWriter.mInitializationCookie = kExpectedInitializationCookie;
 
@@ -787,6 +795,15 @@ CHIP_ERROR TLVWriter::WriteData(const uint8_t * p, uint32_t len)
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError((mLenWritten + len) <= mMaxLen, CHIP_ERROR_BUFFER_TOO_SMALL);
 
+    if (mSizeOnly)
+    {
+        // Fail where writing into a buffer of mMaxLen bytes would have.
+        VerifyOrReturnError(len <= mRemainingLen, CHIP_ERROR_NO_MEMORY);
+        mRemainingLen -= len;
+        mLenWritten += len;
+        return CHIP_NO_ERROR;
+    }
+
     while (len > 0)
     {
         if (mRemainingLen == 0)
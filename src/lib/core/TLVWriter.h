@@ -132,6 +132,23 @@ public:
      */
     CHIP_ERROR Init(TLVBackingStore & backingStore, uint32_t maxLen = UINT32_MAX);
 
+    /**
+     * Initializes a TLVWriter object to compute the size of an encoding without storing it.
+     *
+     * Everything written is validated and counted exactly as it would be with an output buffer, so that
+     * GetLengthWritten() returns the size the encoding would have, but no data is stored anywhere. This lets
+     * callers size a buffer, or decide whether an element fits, before encoding it for real.
+     *
+     * @param[in]   maxLen  The maximum number of bytes that should be counted; writes past it fail with
+     *                      CHIP_ERROR_BUFFER_TOO_SMALL as they would with an output buffer of that size.
+     */
+    void InitSizeOnly(uint32_t maxLen = UINT32_MAX);
+
+    /**
+     * Returns true if this TLVWriter only computes the size of the encoding (see InitSizeOnly()).
+     */
+    bool IsSizeOnly() const { return mSizeOnly; }
+
     /**
      * Finish the writing of a TLV encoding.
      *
@@ -1254,6 +1271,7 @@ protected:
 private:
     bool mContainerOpen;
     bool mCloseContainerReserved;
+    bool mSizeOnly;
 
 protected:
     bool IsContainerOpen() const { return mContainerOpen; }
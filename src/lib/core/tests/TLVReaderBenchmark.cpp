@@ -0,0 +1,143 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  @file
+ *    Measures how long TLVReader takes to walk an encoding shaped like an Interaction
+ *    Model report: nested structures and arrays of context-tagged integers, booleans
+ *    and strings.
+ *
+ *    Usage: tlv-reader-benchmark [iterations]
+ */
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/CodeUtils.h>
+
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr size_t kNumAttributeReports = 64;
+constexpr uint32_t kDefaultIterations = 20000;
+
+CHIP_ERROR EncodeReport(TLV::TLVWriter & writer)
+{
+    TLV::TLVType report, reports;
+
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, report));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(0), static_cast<uint32_t>(0x12345678)));
+    ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(1), TLV::kTLVType_Array, reports));
+
+    for (size_t i = 0; i < kNumAttributeReports; i++)
+    {
+        TLV::TLVType attributeReport, attributeData, path;
+
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, attributeReport));
+        ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(1), TLV::kTLVType_Structure, attributeData));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(0), static_cast<uint32_t>(i)));
+        ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(1), TLV::kTLVType_List, path));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(2), static_cast<uint16_t>(1)));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(3), static_cast<uint32_t>(0x0006)));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(4), static_cast<uint32_t>(i)));
+        ReturnErrorOnFailure(writer.EndContainer(path));
+        switch (i % 3)
+        {
+        case 0:
+            ReturnErrorOnFailure(writer.PutBoolean(TLV::ContextTag(2), true));
+            break;
+        case 1:
+            ReturnErrorOnFailure(writer.Put(TLV::ContextTag(2), static_cast<int64_t>(-1) - static_cast<int64_t>(i)));
+            break;
+        default:
+            ReturnErrorOnFailure(writer.PutString(TLV::ContextTag(2), "benchmark-label"));
+            break;
+        }
+        ReturnErrorOnFailure(writer.EndContainer(attributeData));
+        ReturnErrorOnFailure(writer.EndContainer(attributeReport));
+    }
+
+    ReturnErrorOnFailure(writer.EndContainer(reports));
+    ReturnErrorOnFailure(writer.PutBoolean(TLV::ContextTag(4), true));
+    ReturnErrorOnFailure(writer.EndContainer(report));
+    return writer.Finalize();
+}
+
+// Visits every element, entering every container, and returns how many elements were read.
+CHIP_ERROR Walk(TLV::TLVReader & reader, uint32_t & elements)
+{
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        elements++;
+        if (TLV::TLVTypeIsContainer(reader.GetType()))
+        {
+            TLV::TLVType containerType;
+            ReturnErrorOnFailure(reader.EnterContainer(containerType));
+            ReturnErrorOnFailure(Walk(reader, elements));
+            ReturnErrorOnFailure(reader.ExitContainer(containerType));
+        }
+    }
+    return err == CHIP_END_OF_TLV ? CHIP_NO_ERROR : err;
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    uint32_t iterations = kDefaultIterations;
+    if (argc > 1)
+    {
+        iterations = static_cast<uint32_t>(strtoul(argv[1], nullptr, 0));
+    }
+
+    uint8_t buffer[4096];
+    TLV::TLVWriter writer;
+    writer.Init(buffer);
+    CHIP_ERROR err = EncodeReport(writer);
+    if (err != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "Failed to encode report: %" CHIP_ERROR_FORMAT "\n", err.Format());
+        return EXIT_FAILURE;
+    }
+
+    uint32_t elements = 0;
+    auto start        = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        TLV::TLVReader reader;
+        reader.Init(buffer, writer.GetLengthWritten());
+        err = Walk(reader, elements);
+        if (err != CHIP_NO_ERROR)
+        {
+            fprintf(stderr, "Failed to read report: %" CHIP_ERROR_FORMAT "\n", err.Format());
+            return EXIT_FAILURE;
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    printf("%" PRIu32 " iterations over %u bytes, %" PRIu32 " elements: %.1f ns/element\n", iterations,
+           static_cast<unsigned>(writer.GetLengthWritten()), elements,
+           elements > 0 ? static_cast<double>(elapsed.count()) / elements : 0.0);
+    return EXIT_SUCCESS;
+}
@@ -70,6 +70,26 @@ const uint8_t kMinOtaImageWithoutVendor[] = { 0x1e, 0xf1, 0xee, 0x1b, 0x44, 0x00
                                               0x42, 0x36, 0x67, 0xdb, 0xb7, 0x3b, 0x6e, 0x15, 0x45, 0x4f, 0x0e, 0xb1, 0xab,
                                               0xd4, 0x59, 0x7f, 0x9a, 0x1b, 0x07, 0x8e, 0x3f, 0x5b, 0x5a, 0x6b, 0xc7, 0x18 };
 
+// Magic: 1beef11e
+// Total Size: 104
+// Header Size: 63
+// Header TLV:
+//   [0] Vendor Id: 57005 (0xdead)
+//   [1] Product Id: 48879 (0xbeef)
+//   [2] Version: 1 (0x1)
+//   [3] Version String: 1.0
+//   [4] Payload Size: 25 (0x19)
+//   [8] Digest Type: 1 (0x1)
+//   [9] Digest: b170f1d6e45c3c73ded799216913e0bb98d5f9ea04bfd61f81501f9df2d7472e
+//   [10] Payload Compression: 1 (0x1)
+const uint8_t kCompressedOtaImage[] = { 0x1e, 0xf1, 0xee, 0x1b, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00,
+                                        0x00, 0x15, 0x25, 0x00, 0xad, 0xde, 0x25, 0x01, 0xef, 0xbe, 0x24, 0x02, 0x01, 0x2c, 0x03,
+                                        0x03, 0x31, 0x2e, 0x30, 0x24, 0x04, 0x19, 0x24, 0x08, 0x01, 0x30, 0x09, 0x20, 0xb1, 0x70,
+                                        0xf1, 0xd6, 0xe4, 0x5c, 0x3c, 0x73, 0xde, 0xd7, 0x99, 0x21, 0x69, 0x13, 0xe0, 0xbb, 0x98,
+                                        0xd5, 0xf9, 0xea, 0x04, 0xbf, 0xd6, 0x1f, 0x81, 0x50, 0x1f, 0x9d, 0xf2, 0xd7, 0x47, 0x2e,
+                                        0x24, 0x0a, 0x01, 0x18, 0x17, 0x00, 0xdf, 0x74, 0x65, 0x73, 0x74, 0x20, 0x70, 0x61, 0x79,
+                                        0x6c, 0x6f, 0x61, 0x64, 0x20, 0x0d, 0x00, 0x01, 0x50, 0x79, 0x6c, 0x6f, 0x61, 0x64 };
+
 class TestOTAImageHeader : public ::testing::Test
 {
 public:
@@ -99,6 +119,21 @@ TEST_F(TestOTAImageHeader, TestHappyPath)
     EXPECT_TRUE(header.mReleaseNotesURL.data_equal("https://rn"_span));
     EXPECT_EQ(header.mImageDigestType, OTAImageDigestType::kSha256);
     EXPECT_EQ(header.mImageDigest.size(), 256u / 8);
+    EXPECT_EQ(header.mPayloadCompression, OTAImagePayloadCompression::kNone);
+}
+
+TEST_F(TestOTAImageHeader, TestPayloadCompression)
+{
+    ByteSpan buffer(kCompressedOtaImage);
+    OTAImageHeader header;
+    OTAImageHeaderParser parser;
+
+    parser.Init();
+    EXPECT_EQ(parser.AccumulateAndDecode(buffer, header), CHIP_NO_ERROR);
+    EXPECT_EQ(buffer.size(), 25u);
+    EXPECT_EQ(header.mPayloadSize, 25u);
+    EXPECT_EQ(header.mImageDigestType, OTAImageDigestType::kSha256);
+    EXPECT_EQ(header.mPayloadCompression, OTAImagePayloadCompression::kLz4);
 }
 
 TEST_F(TestOTAImageHeader, TestEmptyBuffer)
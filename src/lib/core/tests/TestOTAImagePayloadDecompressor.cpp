@@ -0,0 +1,144 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/OTAImagePayloadDecompressor.h>
+#include <lib/core/StringBuilderAdapters.h>
+
+#include <algorithm>
+#include <string>
+
+using namespace chip;
+
+namespace {
+
+// Payload of "test payload test payload test payload" created by ota_image_tool.py with LZ4 compression, followed by a
+// chunk with the literals "abc"
+const uint8_t kCompressedPayload[] = { 0x17, 0x00, 0xdf, 0x74, 0x65, 0x73, 0x74, 0x20, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64,
+                                       0x20, 0x0d, 0x00, 0x01, 0x50, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x04, 0x00, 0x30, 0x61, 0x62,
+                                       0x63 };
+
+const char kPayload[] = "test payload test payload test payloadabc";
+
+std::string ToString(ByteSpan output)
+{
+    return std::string(reinterpret_cast<const char *>(output.data()), output.size());
+}
+
+class TestOTAImagePayloadDecompressor : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestOTAImagePayloadDecompressor, TestHappyPath)
+{
+    ByteSpan buffer(kCompressedPayload);
+    ByteSpan output;
+    OTAImagePayloadDecompressor decompressor;
+
+    EXPECT_EQ(decompressor.Init(OTAImagePayloadCompression::kLz4), CHIP_NO_ERROR);
+    EXPECT_EQ(decompressor.AccumulateAndDecompress(buffer, output), CHIP_NO_ERROR);
+    EXPECT_EQ(ToString(output), "test payload test payload test payload");
+    EXPECT_EQ(buffer.size(), 6u);
+
+    EXPECT_EQ(decompressor.AccumulateAndDecompress(buffer, output), CHIP_NO_ERROR);
+    EXPECT_EQ(ToString(output), "abc");
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_FALSE(decompressor.HasPartialChunk());
+
+    EXPECT_EQ(decompressor.AccumulateAndDecompress(buffer, output), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_TRUE(decompressor.IsInitialized());
+    EXPECT_FALSE(decompressor.HasPartialChunk());
+}
+
+TEST_F(TestOTAImagePayloadDecompressor, TestSmallBlocks)
+{
+    constexpr size_t kPayloadSize = sizeof(kCompressedPayload);
+
+    OTAImagePayloadDecompressor decompressor;
+
+    for (size_t blockSize : { 1u, 3u, 16u })
+    {
+        std::string result;
+        EXPECT_EQ(decompressor.Init(OTAImagePayloadCompression::kLz4), CHIP_NO_ERROR);
+
+        for (size_t offset = 0; offset < kPayloadSize; offset += blockSize)
+        {
+            ByteSpan block(&kCompressedPayload[offset], std::min(kPayloadSize - offset, blockSize));
+            ByteSpan output;
+            CHIP_ERROR error;
+
+            while ((error = decompressor.AccumulateAndDecompress(block, output)) == CHIP_NO_ERROR)
+            {
+                result += ToString(output);
+            }
+
+            EXPECT_EQ(error, CHIP_ERROR_BUFFER_TOO_SMALL);
+            EXPECT_TRUE(block.empty());
+        }
+
+        EXPECT_EQ(result, kPayload);
+        EXPECT_FALSE(decompressor.HasPartialChunk());
+    }
+}
+
+TEST_F(TestOTAImagePayloadDecompressor, TestPartialChunk)
+{
+    ByteSpan buffer(kCompressedPayload, 10);
+    ByteSpan output;
+    OTAImagePayloadDecompressor decompressor;
+
+    EXPECT_EQ(decompressor.Init(OTAImagePayloadCompression::kLz4), CHIP_NO_ERROR);
+    EXPECT_EQ(decompressor.AccumulateAndDecompress(buffer, output), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_TRUE(decompressor.HasPartialChunk());
+}
+
+TEST_F(TestOTAImagePayloadDecompressor, TestUnsupportedCompression)
+{
+    OTAImagePayloadDecompressor decompressor;
+
+    EXPECT_EQ(decompressor.Init(OTAImagePayloadCompression::kNone), CHIP_ERROR_NOT_IMPLEMENTED);
+    EXPECT_FALSE(decompressor.IsInitialized());
+}
+
+TEST_F(TestOTAImagePayloadDecompressor, TestInvalidChunks)
+{
+    // Empty chunk
+    static const uint8_t emptyChunk[] = { 0x00, 0x00 };
+    // Match before the start of the chunk
+    static const uint8_t invalidOffset[] = { 0x04, 0x00, 0x10, 0x61, 0x02, 0x00 };
+    // Match going past kOTAImageCompressedChunkSize
+    static const uint8_t tooLongMatch[] = { 0x15, 0x00, 0x1f, 0x61, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                                            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00 };
+    // Literals going past the end of the chunk
+    static const uint8_t truncatedLiterals[] = { 0x02, 0x00, 0x30, 0x61 };
+
+    for (ByteSpan chunk : { ByteSpan(emptyChunk), ByteSpan(invalidOffset), ByteSpan(tooLongMatch), ByteSpan(truncatedLiterals) })
+    {
+        ByteSpan output;
+        OTAImagePayloadDecompressor decompressor;
+
+        EXPECT_EQ(decompressor.Init(OTAImagePayloadCompression::kLz4), CHIP_NO_ERROR);
+        EXPECT_EQ(decompressor.AccumulateAndDecompress(chunk, output), CHIP_ERROR_INVALID_ARGUMENT);
+        EXPECT_FALSE(decompressor.IsInitialized());
+    }
+}
+
+} // namespace
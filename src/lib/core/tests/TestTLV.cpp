@@ -1589,6 +1589,36 @@ TEST_F(TestTLV, CheckSimpleWriteRead)
     ReadEncoding1(reader);
 }
 
+/**
+ *  Test computing the size of an encoding without writing it
+ */
+TEST_F(TestTLV, CheckSizeOnlyWriter)
+{
+    TLVWriter writer;
+
+    writer.InitSizeOnly();
+    writer.ImplicitProfileId = TestProfile_2;
+    EXPECT_TRUE(writer.IsSizeOnly());
+
+    WriteEncoding1(writer);
+    EXPECT_EQ(writer.GetLengthWritten(), sizeof(Encoding1));
+    EXPECT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+    // Running out of space fails as it would when writing into a buffer of that size.
+    TLVType outerContainerType;
+    writer.InitSizeOnly(10);
+    EXPECT_EQ(writer.StartContainer(AnonymousTag(), kTLVType_Structure, outerContainerType), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.PutString(ContextTag(1), "1234"), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.PutString(ContextTag(2), "5"), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(writer.EndContainer(outerContainerType), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.GetLengthWritten(), 9u);
+
+    // An ordinary Init() leaves size-only mode.
+    uint8_t buf[8];
+    writer.Init(buf);
+    EXPECT_FALSE(writer.IsSizeOnly());
+}
+
 TEST_F(TestTLV, TestIntMinMax)
 {
     CHIP_ERROR err;
@@ -2449,6 +2479,55 @@ TEST_F(TestTLV, CheckCircularTLVBufferEvictStraddlingEvent)
     TestEnd<TLVReader>(reader);
 }
 
+TEST_F(TestTLV, CheckCircularTLVBufferMoveHead)
+{
+    // Move the first 2 elements of a buffer, a 7-byte boolean and an 11-byte Encoding3, to another buffer.  Both buffers
+    // start close to the end of their storage, so that the moved bytes wrap around in each of them.
+    uint8_t backingStore[30];
+    uint8_t backingStore1[30];
+    CircularTLVWriter writer;
+    CircularTLVReader reader;
+
+    TLVCircularBuffer buffer(backingStore, sizeof(backingStore), &(backingStore[20]));
+    TLVCircularBuffer buffer1(backingStore1, sizeof(backingStore1), &(backingStore1[25]));
+    writer.Init(buffer);
+    writer.ImplicitProfileId = TestProfile_2;
+
+    EXPECT_EQ(writer.PutBoolean(ProfileTag(TestProfile_1, 2), true), CHIP_NO_ERROR);
+    WriteEncoding3(writer);
+    WriteEncoding3(writer);
+    EXPECT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+    EXPECT_EQ(buffer.DataLength(), 29u);
+
+    EXPECT_EQ(buffer.MoveHeadTo(buffer1, 30), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(buffer.MoveHeadTo(buffer1, 18), CHIP_NO_ERROR);
+    EXPECT_EQ(buffer.DataLength(), 11u);
+    EXPECT_EQ(buffer1.DataLength(), 18u);
+
+    // The moved elements read back from the destination as they were written.
+    reader.Init(buffer1);
+    reader.ImplicitProfileId = TestProfile_2;
+
+    TestNext<TLVReader>(reader);
+    TEST_GET_NOERROR(reader, kTLVType_Boolean, ProfileTag(TestProfile_1, 2), true);
+    TestNext<TLVReader>(reader);
+    ReadEncoding3(reader);
+    TestEnd<TLVReader>(reader);
+
+    // And the source is left with its last element.
+    reader.Init(buffer);
+    reader.ImplicitProfileId = TestProfile_2;
+
+    TestNext<TLVReader>(reader);
+    ReadEncoding3(reader);
+    TestEnd<TLVReader>(reader);
+
+    // The last element fits in the 12 bytes left in the destination.
+    EXPECT_EQ(buffer.MoveHeadTo(buffer1, 11), CHIP_NO_ERROR);
+    EXPECT_EQ(buffer.DataLength(), 0u);
+    EXPECT_EQ(buffer1.DataLength(), 29u);
+}
+
 TEST_F(TestTLV, CheckCircularTLVBufferEdge)
 {
     TestTLVContext * context = &TestTLV::ctx;
@@ -4008,6 +4087,95 @@ TEST_F(TestTLV, CheckCHIPUpdater)
     WriteDeleteReadTest();
 }
 
+/**
+ *  Test replacing scalars in place with the TLV Updater
+ */
+TEST_F(TestTLV, CheckUpdaterReplaceInPlace)
+{
+    uint8_t buf[64];
+    TLVWriter writer;
+    TLVType outerContainerType;
+
+    writer.Init(buf);
+    EXPECT_EQ(writer.StartContainer(AnonymousTag(), kTLVType_Structure, outerContainerType), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Put(ContextTag(0), static_cast<uint8_t>(10)), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Put(ContextTag(1), static_cast<int16_t>(-300)), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.PutBoolean(ContextTag(2), false), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Put(ContextTag(3), 1.5f), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.PutString(ContextTag(4), "label"), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.EndContainer(outerContainerType), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+    const uint32_t encodedLen = writer.GetLengthWritten();
+
+    // No free space: the updater edits the encoding where it is.
+    TLVUpdater updater;
+    EXPECT_EQ(updater.Init(buf, encodedLen, encodedLen), CHIP_NO_ERROR);
+    EXPECT_EQ(updater.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(updater.EnterContainer(outerContainerType), CHIP_NO_ERROR);
+
+    EXPECT_EQ(updater.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(updater.ReplaceInPlace(static_cast<int8_t>(1)), CHIP_ERROR_WRONG_TLV_TYPE);
+    EXPECT_EQ(updater.ReplaceInPlace(static_cast<uint16_t>(256)), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(updater.ReplaceInPlace(static_cast<uint16_t>(255)), CHIP_NO_ERROR);
+    uint8_t u8;
+    EXPECT_EQ(updater.Get(u8), CHIP_NO_ERROR);
+    EXPECT_EQ(u8, 255u);
+    EXPECT_EQ(updater.Move(), CHIP_NO_ERROR);
+
+    EXPECT_EQ(updater.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(updater.ReplaceInPlace(static_cast<int32_t>(-40000)), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(updater.ReplaceInPlace(static_cast<int32_t>(-32768)), CHIP_NO_ERROR);
+    EXPECT_EQ(updater.Move(), CHIP_NO_ERROR);
+
+    EXPECT_EQ(updater.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(updater.ReplaceInPlace(true), CHIP_NO_ERROR);
+    EXPECT_EQ(updater.Move(), CHIP_NO_ERROR);
+
+    EXPECT_EQ(updater.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(updater.ReplaceInPlace(0.1), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(updater.ReplaceInPlace(-2.25f), CHIP_NO_ERROR);
+    EXPECT_EQ(updater.Move(), CHIP_NO_ERROR);
+
+    EXPECT_EQ(updater.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(updater.ReplaceInPlace(static_cast<uint8_t>(1)), CHIP_ERROR_WRONG_TLV_TYPE);
+
+    updater.MoveUntilEnd();
+    EXPECT_EQ(updater.Finalize(), CHIP_NO_ERROR);
+    EXPECT_EQ(updater.GetLengthWritten(), encodedLen);
+
+    TLVReader reader;
+    reader.Init(buf, encodedLen);
+    EXPECT_EQ(reader.Next(kTLVType_Structure, AnonymousTag()), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.EnterContainer(outerContainerType), CHIP_NO_ERROR);
+
+    EXPECT_EQ(reader.Next(ContextTag(0)), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Get(u8), CHIP_NO_ERROR);
+    EXPECT_EQ(u8, 255u);
+
+    int16_t i16;
+    EXPECT_EQ(reader.Next(ContextTag(1)), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Get(i16), CHIP_NO_ERROR);
+    EXPECT_EQ(i16, -32768);
+
+    bool b;
+    EXPECT_EQ(reader.Next(ContextTag(2)), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Get(b), CHIP_NO_ERROR);
+    EXPECT_TRUE(b);
+
+    float f;
+    EXPECT_EQ(reader.Next(ContextTag(3)), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Get(f), CHIP_NO_ERROR);
+    EXPECT_EQ(f, -2.25f);
+
+    CharSpan label;
+    EXPECT_EQ(reader.Next(ContextTag(4)), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Get(label), CHIP_NO_ERROR);
+    EXPECT_TRUE(label.data_equal(CharSpan::fromCharString("label")));
+
+    EXPECT_EQ(reader.Next(), CHIP_END_OF_TLV);
+    EXPECT_EQ(reader.ExitContainer(outerContainerType), CHIP_NO_ERROR);
+}
+
 /**
  * Test TLV CloseContainer symbol reservations
  */
@@ -0,0 +1,170 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/ErrorStr.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLVChunkedBuffer.h>
+#include <lib/core/TLVCommon.h>
+#include <lib/core/TLVTags.h>
+
+using namespace chip;
+using namespace chip::TLV;
+
+class TestTLVChunkedBuffer : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestTLVChunkedBuffer, InitAndFinalizeWithNoData)
+{
+    TlvChunkedBuffer buffer;
+    TLVWriter writer;
+    TLVReader reader;
+
+    EXPECT_EQ(writer.Init(buffer), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+    EXPECT_EQ(buffer.GetLength(), 0u);
+
+    EXPECT_EQ(reader.Init(buffer), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Next(), CHIP_END_OF_TLV);
+}
+
+TEST_F(TestTLVChunkedBuffer, WriterCannotReuseUnclearedBuffer)
+{
+    TlvChunkedBuffer buffer;
+    TLVWriter writer;
+
+    EXPECT_EQ(writer.Init(buffer), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Put(AnonymousTag(), true), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+    TLVWriter otherWriter;
+    EXPECT_EQ(otherWriter.Init(buffer), CHIP_ERROR_INCORRECT_STATE);
+
+    buffer.Clear();
+    EXPECT_EQ(otherWriter.Init(buffer), CHIP_NO_ERROR);
+}
+
+TEST_F(TestTLVChunkedBuffer, ManySmallDataSpanChunks)
+{
+    static constexpr uint32_t kChunkSize = 64;
+    static constexpr int kCount          = 1000;
+
+    TlvChunkedBuffer buffer(kChunkSize);
+    TLVWriter writer;
+    TLVReader reader;
+
+    EXPECT_EQ(writer.Init(buffer), CHIP_NO_ERROR);
+    for (int i = 0; i < kCount; i++)
+    {
+        EXPECT_EQ(writer.Put(AnonymousTag(), static_cast<uint32_t>(i)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+    EXPECT_EQ(buffer.GetLength(), writer.GetLengthWritten());
+    EXPECT_GT(buffer.GetChunkCount(), 1u);
+
+    EXPECT_EQ(reader.Init(buffer), CHIP_NO_ERROR);
+    for (int i = 0; i < kCount; i++)
+    {
+        EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.GetTag(), AnonymousTag());
+
+        uint32_t value = 0;
+        EXPECT_EQ(reader.Get(value), CHIP_NO_ERROR);
+        EXPECT_EQ(value, static_cast<uint32_t>(i));
+    }
+    EXPECT_EQ(reader.Next(), CHIP_END_OF_TLV);
+    EXPECT_EQ(reader.Next(), CHIP_END_OF_TLV);
+}
+
+TEST_F(TestTLVChunkedBuffer, SingleLargeDataSpansChunks)
+{
+    static constexpr size_t kStringSize = 10000;
+
+    TlvChunkedBuffer buffer;
+    TLVWriter writer;
+    TLVReader reader;
+
+    const std::string bytes(kStringSize, 'a');
+    EXPECT_EQ(writer.Init(buffer), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.PutString(AnonymousTag(), bytes.data()), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+    EXPECT_EQ(buffer.GetChunkCount(), (kStringSize / TlvChunkedBuffer::kDefaultChunkSize) + 1);
+
+    EXPECT_EQ(reader.Init(buffer), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.GetLength(), kStringSize);
+
+    // The value is not contiguous, so it has to be copied out.
+    std::vector<char> value(kStringSize + 1);
+    EXPECT_EQ(reader.GetString(value.data(), static_cast<uint32_t>(value.size())), CHIP_NO_ERROR);
+    EXPECT_EQ(std::string(value.data()), bytes);
+    EXPECT_EQ(reader.Next(), CHIP_END_OF_TLV);
+}
+
+TEST_F(TestTLVChunkedBuffer, CopiedReadersAdvanceIndependently)
+{
+    static constexpr uint32_t kChunkSize = 16;
+
+    TlvChunkedBuffer buffer(kChunkSize);
+    TLVWriter writer;
+    TLVReader reader;
+
+    EXPECT_EQ(writer.Init(buffer), CHIP_NO_ERROR);
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        EXPECT_EQ(writer.Put(AnonymousTag(), i), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+    EXPECT_EQ(reader.Init(buffer), CHIP_NO_ERROR);
+    for (uint32_t i = 0; i < 50; i++)
+    {
+        EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+    }
+
+    TLVReader copy;
+    copy.Init(reader);
+    for (uint32_t i = 50; i < 100; i++)
+    {
+        uint32_t value = 0;
+        EXPECT_EQ(copy.Next(), CHIP_NO_ERROR);
+        EXPECT_EQ(copy.Get(value), CHIP_NO_ERROR);
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_EQ(copy.Next(), CHIP_END_OF_TLV);
+
+    uint32_t value = 0;
+    EXPECT_EQ(reader.Get(value), CHIP_NO_ERROR);
+    EXPECT_EQ(value, 49u);
+    EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Get(value), CHIP_NO_ERROR);
+    EXPECT_EQ(value, 50u);
+}
@@ -0,0 +1,155 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/ErrorStr.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLVElementIndex.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/CHIPMem.h>
+
+using namespace chip;
+using namespace chip::TLV;
+
+namespace {
+
+constexpr uint32_t kNumEntries = 100;
+
+class TestTLVElementIndex : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    // An array of kNumEntries structures { 1: index, 2: [index] }.
+    void SetUp() override
+    {
+        TLVWriter writer;
+        TLVType array, entry, inner;
+
+        writer.Init(mBuffer);
+        ASSERT_EQ(writer.StartContainer(AnonymousTag(), kTLVType_Array, array), CHIP_NO_ERROR);
+        for (uint32_t i = 0; i < kNumEntries; i++)
+        {
+            ASSERT_EQ(writer.StartContainer(AnonymousTag(), kTLVType_Structure, entry), CHIP_NO_ERROR);
+            ASSERT_EQ(writer.Put(ContextTag(1), i), CHIP_NO_ERROR);
+            ASSERT_EQ(writer.StartContainer(ContextTag(2), kTLVType_Array, inner), CHIP_NO_ERROR);
+            ASSERT_EQ(writer.Put(AnonymousTag(), i), CHIP_NO_ERROR);
+            ASSERT_EQ(writer.EndContainer(inner), CHIP_NO_ERROR);
+            ASSERT_EQ(writer.EndContainer(entry), CHIP_NO_ERROR);
+        }
+        ASSERT_EQ(writer.EndContainer(array), CHIP_NO_ERROR);
+        ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+        mLength = writer.GetLengthWritten();
+    }
+
+    static void ExpectEntry(TLVReader & reader, uint32_t expected)
+    {
+        TLVType outer;
+        uint32_t value;
+
+        ASSERT_EQ(reader.GetType(), kTLVType_Structure);
+        ASSERT_EQ(reader.EnterContainer(outer), CHIP_NO_ERROR);
+        ASSERT_EQ(reader.Next(ContextTag(1)), CHIP_NO_ERROR);
+        ASSERT_EQ(reader.Get(value), CHIP_NO_ERROR);
+        EXPECT_EQ(value, expected);
+        ASSERT_EQ(reader.ExitContainer(outer), CHIP_NO_ERROR);
+    }
+
+    uint8_t mBuffer[2048];
+    uint32_t mLength = 0;
+};
+
+TEST_F(TestTLVElementIndex, TestRandomAccess)
+{
+    TLVReader reader;
+    reader.Init(mBuffer, mLength);
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+
+    TLVElementIndex index;
+    ASSERT_EQ(index.Init(reader), CHIP_NO_ERROR);
+
+    // Out of order, both beyond and within the part indexed so far.
+    for (uint32_t i : { 42u, 3u, 99u, 0u, 42u })
+    {
+        TLVReader element;
+        ASSERT_EQ(index.Get(i, element), CHIP_NO_ERROR);
+        ExpectEntry(element, i);
+    }
+
+    // The element readers carry on through the rest of the container.
+    TLVReader element;
+    ASSERT_EQ(index.Get(kNumEntries - 2, element), CHIP_NO_ERROR);
+    ASSERT_EQ(element.Next(), CHIP_NO_ERROR);
+    ExpectEntry(element, kNumEntries - 1);
+    EXPECT_EQ(element.Next(), CHIP_END_OF_TLV);
+
+    EXPECT_EQ(index.Get(kNumEntries, element), CHIP_END_OF_TLV);
+
+    size_t count = 0;
+    EXPECT_EQ(index.GetCount(count), CHIP_NO_ERROR);
+    EXPECT_EQ(count, kNumEntries);
+}
+
+TEST_F(TestTLVElementIndex, TestInvalidUse)
+{
+    TLVElementIndex index;
+    TLVReader element;
+    EXPECT_EQ(index.Get(0, element), CHIP_ERROR_INCORRECT_STATE);
+
+    TLVReader reader;
+    reader.Init(mBuffer, mLength);
+    // Not on an element yet.
+    EXPECT_EQ(index.Init(reader), CHIP_ERROR_WRONG_TLV_TYPE);
+
+    // Not on a container.
+    TLVType outer;
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+    ASSERT_EQ(reader.EnterContainer(outer), CHIP_NO_ERROR);
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+    ASSERT_EQ(reader.EnterContainer(outer), CHIP_NO_ERROR);
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Init(reader), CHIP_ERROR_WRONG_TLV_TYPE);
+}
+
+TEST_F(TestTLVElementIndex, TestEmptyContainer)
+{
+    uint8_t buffer[8];
+    TLVWriter writer;
+    TLVType outer;
+    writer.Init(buffer);
+    ASSERT_EQ(writer.StartContainer(AnonymousTag(), kTLVType_List, outer), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.EndContainer(outer), CHIP_NO_ERROR);
+
+    TLVReader reader;
+    reader.Init(buffer, writer.GetLengthWritten());
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+
+    TLVElementIndex index;
+    ASSERT_EQ(index.Init(reader), CHIP_NO_ERROR);
+
+    TLVReader element;
+    EXPECT_EQ(index.Get(0, element), CHIP_END_OF_TLV);
+    size_t count = 1;
+    EXPECT_EQ(index.GetCount(count), CHIP_NO_ERROR);
+    EXPECT_EQ(count, 0u);
+}
+
+} // namespace
@@ -27,21 +27,20 @@ namespace Minimal {
 constexpr chip::System::Clock::Timeout ActiveResolveAttempts::kMaxRetryDelay;
 
 void ActiveResolveAttempts::Reset()
-
 {
-    for (auto & item : mRetryQueue)
+    while (!mSchedule.Empty())
     {
-        item.attempt.Clear();
+        Release(&*mSchedule.begin());
     }
 }
 
 void ActiveResolveAttempts::Complete(const PeerId & peerId)
 {
-    for (auto & item : mRetryQueue)
+    for (auto & item : mSchedule)
     {
         if (item.attempt.Matches(peerId))
         {
-            item.attempt.Clear();
+            Release(&item);
             return;
         }
     }
@@ -55,7 +54,7 @@ void ActiveResolveAttempts::Complete(const PeerId & peerId)
 
 bool ActiveResolveAttempts::HasBrowseFor(chip::Dnssd::DiscoveryType type) const
 {
-    for (auto & item : mRetryQueue)
+    for (auto & item : mSchedule)
     {
         if (!item.attempt.IsBrowse())
         {
@@ -73,11 +72,11 @@ bool ActiveResolveAttempts::HasBrowseFor(chip::Dnssd::DiscoveryType type) const
 
 void ActiveResolveAttempts::CompleteIpResolution(SerializedQNameIterator targetHostName)
 {
-    for (auto & item : mRetryQueue)
+    for (auto & item : mSchedule)
     {
         if (item.attempt.MatchesIpResolve(targetHostName))
         {
-            item.attempt.Clear();
+            Release(&item);
             return;
         }
     }
@@ -85,11 +84,12 @@ void ActiveResolveAttempts::CompleteIpResolution(SerializedQNameIterator targetH
 
 CHIP_ERROR ActiveResolveAttempts::CompleteAllBrowses()
 {
-    for (auto & item : mRetryQueue)
+    for (auto it = mSchedule.begin(); it != mSchedule.end();)
     {
+        RetryEntry & item = *it++;
         if (item.attempt.IsBrowse())
         {
-            item.attempt.Clear();
+            Release(&item);
         }
     }
 
@@ -98,11 +98,15 @@ CHIP_ERROR ActiveResolveAttempts::CompleteAllBrowses()
 
 void ActiveResolveAttempts::NodeIdResolutionNoLongerNeeded(const PeerId & peerId)
 {
-    for (auto & item : mRetryQueue)
+    for (auto & item : mSchedule)
     {
         if (item.attempt.Matches(peerId))
         {
             item.attempt.ConsumerRemoved();
+            if (item.attempt.IsEmpty())
+            {
+                Release(&item);
+            }
             return;
         }
     }
@@ -125,59 +129,39 @@ void ActiveResolveAttempts::MarkPending(ScheduledAttempt::IpResolve && resolve)
 
 void ActiveResolveAttempts::MarkPending(ScheduledAttempt && attempt)
 {
-    // Strategy when picking the peer id to use:
-    //   1 if a matching peer id is already found, use that one
-    //   2 if an 'unused' entry is found, use that
+    // Strategy when picking the entry to use:
+    //   1 if a matching attempt is already found, use that one
+    //   2 if below capacity, use a new entry
     //   3 otherwise expire the one with the largest nextRetryDelay
     //     or if equal nextRetryDelay, pick the one with the oldest
     //     queryDueTime
 
-    RetryEntry * entryToUse = &mRetryQueue[0];
+    RetryEntry * entryToUse = nullptr;
 
-    for (size_t i = 1; i < kRetryQueueSize; i++)
+    for (auto & item : mSchedule)
     {
-        if (entryToUse->attempt.Matches(attempt))
-        {
-            break; // best match possible
-        }
-
-        RetryEntry * entry = mRetryQueue + i;
-
-        // Rule 1: attempt match always matches
-        if (entry->attempt.Matches(attempt))
+        if (item.attempt.Matches(attempt))
         {
-            entryToUse = entry;
-            continue;
+            entryToUse = &item;
+            break;
         }
+    }
 
-        // Rule 2: select unused entries
-        if (!entryToUse->attempt.IsEmpty() && entry->attempt.IsEmpty())
-        {
-            entryToUse = entry;
-            continue;
-        }
-        if (entryToUse->attempt.IsEmpty())
-        {
-            continue;
-        }
+    if ((entryToUse == nullptr) && (mEntries.Allocated() < mCapacity))
+    {
+        // May still fail if the heap is exhausted, in which case an existing entry is re-used
+        entryToUse = mEntries.CreateObject();
+    }
 
-        // Rule 3: both choices are used (have a defined node id):
-        //    - try to find the one with the largest next delay (oldest request)
-        //    - on same delay, use queryDueTime to determine the oldest request
-        //      (the one with the smallest  due time was issued the longest time
-        //       ago)
-        if (entry->nextRetryDelay > entryToUse->nextRetryDelay)
-        {
-            entryToUse = entry;
-        }
-        else if ((entry->nextRetryDelay == entryToUse->nextRetryDelay) && (entry->queryDueTime < entryToUse->queryDueTime))
+    if (entryToUse == nullptr)
+    {
+        entryToUse = OldestEntry();
+        if (entryToUse == nullptr)
         {
-            entryToUse = entry;
+            ChipLogError(Discovery, "No memory for a pending resolve entry.");
+            return;
         }
-    }
 
-    if ((!entryToUse->attempt.IsEmpty()) && (!entryToUse->attempt.Matches(attempt)))
-    {
         // TODO: node was evicted here, if/when resolution failures are
         // supported this could be a place for error callbacks
         //
@@ -188,61 +172,55 @@ void ActiveResolveAttempts::MarkPending(ScheduledAttempt && attempt)
         ChipLogError(Discovery, "Re-using pending resolve entry before reply was received.");
     }
 
+    if (entryToUse->IsInList())
+    {
+        mSchedule.Remove(entryToUse);
+    }
+
     attempt.WillCoalesceWith(entryToUse->attempt);
     entryToUse->attempt        = attempt;
     entryToUse->queryDueTime   = mClock->GetMonotonicTimestamp();
     entryToUse->nextRetryDelay = System::Clock::Seconds16(1);
+
+    Schedule(entryToUse);
 }
 
 std::optional<System::Clock::Timeout> ActiveResolveAttempts::GetTimeUntilNextExpectedResponse() const
 {
-    std::optional<System::Clock::Timeout> minDelay = std::nullopt;
+    if (mSchedule.Empty())
+    {
+        return std::nullopt;
+    }
 
     chip::System::Clock::Timestamp now = mClock->GetMonotonicTimestamp();
+    const RetryEntry & entry           = *mSchedule.begin();
 
-    for (auto & entry : mRetryQueue)
+    if (now >= entry.queryDueTime)
     {
-        if (entry.attempt.IsEmpty())
-        {
-            continue;
-        }
-
-        if (now >= entry.queryDueTime)
-        {
-            // found an entry that needs processing right now
-            return std::make_optional<System::Clock::Timeout>(0);
-        }
-
-        System::Clock::Timeout entryDelay = entry.queryDueTime - now;
-        if (!minDelay.has_value() || (*minDelay > entryDelay))
-        {
-            minDelay.emplace(entryDelay);
-        }
+        // found an entry that needs processing right now
+        return std::make_optional<System::Clock::Timeout>(0);
     }
 
-    return minDelay;
+    return std::make_optional<System::Clock::Timeout>(entry.queryDueTime - now);
 }
 
 std::optional<ActiveResolveAttempts::ScheduledAttempt> ActiveResolveAttempts::NextScheduled()
 {
     chip::System::Clock::Timestamp now = mClock->GetMonotonicTimestamp();
 
-    for (auto & entry : mRetryQueue)
+    while (!mSchedule.Empty())
     {
-        if (entry.attempt.IsEmpty())
-        {
-            continue; // not a pending item
-        }
+        RetryEntry & entry = *mSchedule.begin();
 
         if (entry.queryDueTime > now)
         {
-            continue; // not yet due
+            break; // not yet due, and neither are the following ones
         }
 
         if (entry.nextRetryDelay > kMaxRetryDelay)
         {
             ChipLogError(Discovery, "Timeout waiting for mDNS resolution.");
-            entry.attempt.Clear();
+            Release(&entry);
             continue;
         }
 
@@ -252,6 +230,9 @@ std::optional<ActiveResolveAttempts::ScheduledAttempt> ActiveResolveAttempts::Ne
         std::optional<ScheduledAttempt> attempt = std::make_optional(entry.attempt);
         entry.attempt.firstSend                 = false;
 
+        mSchedule.Remove(&entry);
+        Schedule(&entry);
+
         return attempt;
     }
 
@@ -260,12 +241,8 @@ std::optional<ActiveResolveAttempts::ScheduledAttempt> ActiveResolveAttempts::Ne
 
 bool ActiveResolveAttempts::ShouldResolveIpAddress(PeerId peerId) const
 {
-    for (auto & item : mRetryQueue)
+    for (auto & item : mSchedule)
     {
-        if (item.attempt.IsEmpty())
-        {
-            continue;
-        }
         if (item.attempt.IsBrowse())
         {
             return true;
@@ -284,15 +261,23 @@ bool ActiveResolveAttempts::ShouldResolveIpAddress(PeerId peerId) const
     return false;
 }
 
-bool ActiveResolveAttempts::IsWaitingForIpResolutionFor(SerializedQNameIterator hostName) const
+bool ActiveResolveAttempts::HasResolveFor(PeerId peerId) const
 {
-    for (auto & entry : mRetryQueue)
+    for (auto & item : mSchedule)
     {
-        if (entry.attempt.IsEmpty())
+        if (item.attempt.IsResolve() && (item.attempt.ResolveData().peerId == peerId))
         {
-            continue; // not a pending item
+            return true;
         }
+    }
 
+    return false;
+}
+
+bool ActiveResolveAttempts::IsWaitingForIpResolutionFor(SerializedQNameIterator hostName) const
+{
+    for (auto & entry : mSchedule)
+    {
         if (!entry.attempt.IsIpResolve())
         {
             continue;
@@ -307,5 +292,48 @@ bool ActiveResolveAttempts::IsWaitingForIpResolutionFor(SerializedQNameIterator
     return false;
 }
 
+void ActiveResolveAttempts::Schedule(RetryEntry * entry)
+{
+    // Retries are due later than most entries: look for the insertion point from the end
+    auto position = mSchedule.end();
+    while (position != mSchedule.begin())
+    {
+        auto previous = position;
+        --previous;
+        if (previous->queryDueTime <= entry->queryDueTime)
+        {
+            break;
+        }
+        position = previous;
+    }
+
+    mSchedule.InsertBefore(position, entry);
+}
+
+void ActiveResolveAttempts::Release(RetryEntry * entry)
+{
+    mSchedule.Remove(entry);
+    mEntries.ReleaseObject(entry);
+}
+
+ActiveResolveAttempts::RetryEntry * ActiveResolveAttempts::OldestEntry()
+{
+    RetryEntry * oldest = nullptr;
+
+    for (auto & entry : mSchedule)
+    {
+        // Try to find the one with the largest next delay (oldest request). On same delay,
+        // use queryDueTime to determine the oldest request (the one with the smallest due
+        // time was issued the longest time ago)
+        if ((oldest == nullptr) || (entry.nextRetryDelay > oldest->nextRetryDelay) ||
+            ((entry.nextRetryDelay == oldest->nextRetryDelay) && (entry.queryDueTime < oldest->queryDueTime)))
+        {
+            oldest = &entry;
+        }
+    }
+
+    return oldest;
+}
+
 } // namespace Minimal
 } // namespace mdns
@@ -17,13 +17,17 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <optional>
 
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/PeerId.h>
 #include <lib/dnssd/Resolver.h>
 #include <lib/dnssd/minimal_mdns/core/HeapQName.h>
+#include <lib/support/IntrusiveList.h>
+#include <lib/support/Pool.h>
 #include <lib/support/Variant.h>
 #include <system/SystemClock.h>
 
@@ -38,10 +42,14 @@ namespace Minimal {
 ///    - figuring out a 'next query time' for items in the list
 ///    - iterating through the 'schedule now' items of the list
 ///
+/// Attempts are allocated from a pool (heap backed when pools use the heap)
+/// and kept in a list sorted by the time their next query is due, so that
+/// scheduling does not scan the attempts that are not due.
+///
 class ActiveResolveAttempts
 {
 public:
-    static constexpr size_t kRetryQueueSize                      = 4;
+    static constexpr size_t kMaxPendingAttempts                  = CHIP_CONFIG_MINMDNS_MAX_PENDING_RESOLVE_ATTEMPTS;
     static constexpr chip::System::Clock::Timeout kMaxRetryDelay = chip::System::Clock::Seconds16(16);
 
     struct ScheduledAttempt
@@ -243,7 +251,12 @@ public:
         bool firstSend = false;
     };
 
-    ActiveResolveAttempts(chip::System::Clock::ClockBase * clock) : mClock(clock) { Reset(); }
+    /// `capacity` is the number of attempts tracked at the same time, at most kMaxPendingAttempts.
+    /// When full, new attempts replace the oldest ones.
+    ActiveResolveAttempts(chip::System::Clock::ClockBase * clock, size_t capacity = kMaxPendingAttempts) :
+        mClock(clock), mCapacity(std::min(capacity, kMaxPendingAttempts))
+    {}
+    ~ActiveResolveAttempts() { Reset(); }
 
     /// Clear out the internal queue
     void Reset();
@@ -279,8 +292,8 @@ public:
     // query logic. This means:
     //  - internal tracking of 'next due time' will updated as 'request sent
     //    now'
-    //  - there is NO sorting implied by this call. Returned value will be
-    //    any peer that needs a new request sent
+    //  - due attempts are returned by increasing due time (in scheduling
+    //    order for attempts due at the same time)
     std::optional<ScheduledAttempt> NextScheduled();
 
     /// Check if any of the pending queries are for the given host name for
@@ -296,8 +309,11 @@ public:
     /// Check if a browse operation is active for the given discovery type
     bool HasBrowseFor(chip::Dnssd::DiscoveryType type) const;
 
+    /// Check if an operational resolve is active for the given peer
+    bool HasResolveFor(chip::PeerId peerId) const;
+
 private:
-    struct RetryEntry
+    struct RetryEntry : public chip::IntrusiveListNodeBase<>
     {
         ScheduledAttempt attempt;
         // When a reply is expected for this item
@@ -314,8 +330,23 @@ private:
         chip::System::Clock::Timeout nextRetryDelay = chip::System::Clock::Seconds16(1);
     };
     void MarkPending(ScheduledAttempt && attempt);
+
+    /// Inserts the entry in the schedule, after the entries due at the same time
+    void Schedule(RetryEntry * entry);
+
+    /// Removes the entry from the schedule and frees it
+    void Release(RetryEntry * entry);
+
+    /// Returns the entry to replace when full: the one with the largest nextRetryDelay
+    /// or, on equal delays, the oldest queryDueTime.
+    RetryEntry * OldestEntry();
+
     chip::System::Clock::ClockBase * mClock;
-    RetryEntry mRetryQueue[kRetryQueueSize];
+    const size_t mCapacity;
+    chip::ObjectPool<RetryEntry, kMaxPendingAttempts> mEntries;
+
+    // All the pending attempts, by increasing queryDueTime
+    chip::IntrusiveList<RetryEntry> mSchedule;
 };
 
 } // namespace Minimal
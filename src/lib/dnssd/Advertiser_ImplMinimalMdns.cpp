@@ -343,6 +343,8 @@ void AdvertiserMinMdns::OnMdnsPacketData(const BytesRange & data, const chip::In
 
 void AdvertiserMinMdns::OnQuery(const QueryData & data)
 {
+    CHIP_MEMORY_TAG_SCOPE(kDnssd);
+
     if (mCurrentSource == nullptr)
     {
         ChipLogError(Discovery, "INTERNAL CONSISTENCY ERROR: missing query source");
@@ -394,6 +396,7 @@ void AdvertiserMinMdns::Shutdown()
     AdvertiseRecords(BroadcastAdvertiseType::kRemovingAll);
 
     GlobalMinimalMdnsServer::Server().Shutdown();
+    mResponseSender.InvalidateResponseCache();
     mIsInitialized = false;
 }
 
@@ -437,6 +440,7 @@ void AdvertiserMinMdns::ClearServices()
 
     mQueryResponderAllocatorCommissionable.Clear();
     mQueryResponderAllocatorCommissioner.Clear();
+    mResponseSender.InvalidateResponseCache();
 }
 
 OperationalQueryAllocator::Allocator * AdvertiserMinMdns::FindOperationalAllocator(const FullQName & qname)
@@ -478,6 +482,9 @@ CHIP_ERROR AdvertiserMinMdns::Advertise(const OperationalAdvertisingParameters &
 {
     VerifyOrReturnError(mIsInitialized, CHIP_ERROR_INCORRECT_STATE);
 
+    // Responders are updated in place: replies cached so far are outdated.
+    mResponseSender.InvalidateResponseCache();
+
     char nameBuffer[Operational::kInstanceNameMaxLength + 1] = "";
 
     // need to set server name
@@ -608,6 +615,9 @@ CHIP_ERROR AdvertiserMinMdns::Advertise(const CommissionAdvertisingParameters &
 {
     VerifyOrReturnError(mIsInitialized, CHIP_ERROR_INCORRECT_STATE);
 
+    // Responders are updated in place: replies cached so far are outdated.
+    mResponseSender.InvalidateResponseCache();
+
     if (params.GetCommissionAdvertiseMode() == CommssionAdvertiseMode::kCommissionableNode)
     {
         mQueryResponderAllocatorCommissionable.Clear();
@@ -24,6 +24,8 @@
 #include <lib/support/CHIPMemString.h>
 #include <tracing/macros.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace Dnssd {
 
@@ -37,6 +39,11 @@ ByteSpan GetSpan(const mdns::Minimal::BytesRange & range)
     return ByteSpan(range.Start(), range.Size());
 }
 
+uint32_t ClampTtl(uint64_t ttl)
+{
+    return static_cast<uint32_t>(std::min<uint64_t>(ttl, UINT32_MAX));
+}
+
 /// Handles filling record data from TXT records.
 ///
 /// Supported records are whatever `FillNodeDataFromTxt` supports.
@@ -145,6 +152,7 @@ CHIP_ERROR IncrementalResolver::InitializeParsing(mdns::Minimal::SerializedQName
     ReturnErrorOnFailure(mRecordName.Set(name));
     ReturnErrorOnFailure(mTargetHostName.Set(srv.GetName()));
     mCommonResolutionData.port = srv.GetPort();
+    mTtlSeconds                = ClampTtl(ttl);
 
     {
         // TODO: Chip code historically seems to assume that the host name is of the
@@ -248,6 +256,7 @@ CHIP_ERROR IncrementalResolver::OnRecord(Inet::InterfaceId interface, const Reso
             MATTER_TRACE_INSTANT("TXT not applicable", "Resolver");
             return CHIP_NO_ERROR;
         }
+        mTtlSeconds = std::min(mTtlSeconds, ClampTtl(data.GetTtlSeconds()));
         return OnTxtRecord(data, packetRange);
     case QType::A: {
         if (data.GetName() != mTargetHostName.Get())
@@ -263,6 +272,7 @@ CHIP_ERROR IncrementalResolver::OnRecord(Inet::InterfaceId interface, const Reso
             return CHIP_ERROR_INVALID_ARGUMENT;
         }
 
+        mTtlSeconds = std::min(mTtlSeconds, ClampTtl(data.GetTtlSeconds()));
         return OnIpAddress(interface, addr);
 #else
 #if CHIP_MINMDNS_HIGH_VERBOSITY
@@ -285,6 +295,7 @@ CHIP_ERROR IncrementalResolver::OnRecord(Inet::InterfaceId interface, const Reso
             return CHIP_ERROR_INVALID_ARGUMENT;
         }
 
+        mTtlSeconds = std::min(mTtlSeconds, ClampTtl(data.GetTtlSeconds()));
         return OnIpAddress(interface, addr);
     }
     case QType::SRV: // SRV handled on creation, ignored for 'additional data'
@@ -0,0 +1,147 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "ResolvedNodeCache.h"
+
+#include <lib/support/CodeUtils.h>
+
+#if CHIP_CONFIG_MINMDNS_RESOLVED_NODE_CACHE_SIZE > 0
+
+using namespace chip;
+
+namespace mdns {
+namespace Minimal {
+
+void ResolvedNodeCache::Insert(const Dnssd::ResolvedNodeData & data, uint32_t ttlSeconds)
+{
+    if (ttlSeconds == 0)
+    {
+        Remove(data.operationalData.peerId);
+        return;
+    }
+
+    const System::Clock::Timestamp now = mClock->GetMonotonicTimestamp();
+    Entry * entry                      = Find(data.operationalData.peerId);
+
+    if (entry == nullptr)
+    {
+        for (auto & candidate : mEntries)
+        {
+            if (!candidate.inUse)
+            {
+                entry = &candidate;
+                break;
+            }
+            if ((entry == nullptr) || (candidate.lastUse < entry->lastUse))
+            {
+                entry = &candidate;
+            }
+        }
+        entry->toReport = false;
+    }
+
+    entry->inUse      = true;
+    entry->ttlSeconds = ttlSeconds;
+    entry->expiry     = now + System::Clock::Seconds32(ttlSeconds);
+    entry->lastUse    = now;
+    entry->data       = data;
+}
+
+const Dnssd::ResolvedNodeData * ResolvedNodeCache::Lookup(const PeerId & peerId)
+{
+    Entry * entry = Find(peerId);
+    VerifyOrReturnValue(entry != nullptr, nullptr);
+
+    entry->lastUse = mClock->GetMonotonicTimestamp();
+    return &entry->data;
+}
+
+void ResolvedNodeCache::Remove(const PeerId & peerId)
+{
+    Entry * entry = Find(peerId);
+    if (entry != nullptr)
+    {
+        *entry = Entry();
+    }
+}
+
+void ResolvedNodeCache::Clear()
+{
+    for (auto & entry : mEntries)
+    {
+        entry = Entry();
+    }
+}
+
+bool ResolvedNodeCache::MarkPendingReport(const PeerId & peerId)
+{
+    Entry * entry = Find(peerId);
+    VerifyOrReturnValue(entry != nullptr, false);
+
+    entry->toReport = true;
+    entry->lastUse  = mClock->GetMonotonicTimestamp();
+    return true;
+}
+
+bool ResolvedNodeCache::TakePendingReport(Dnssd::ResolvedNodeData & outData)
+{
+    Expire();
+
+    for (auto & entry : mEntries)
+    {
+        if (entry.inUse && entry.toReport)
+        {
+            entry.toReport = false;
+            outData        = entry.data;
+            return true;
+        }
+    }
+    return false;
+}
+
+ResolvedNodeCache::Entry * ResolvedNodeCache::Find(const PeerId & peerId)
+{
+    Expire();
+
+    for (auto & entry : mEntries)
+    {
+        if (entry.inUse && (entry.data.operationalData.peerId == peerId))
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void ResolvedNodeCache::Expire()
+{
+    const System::Clock::Timestamp now = mClock->GetMonotonicTimestamp();
+
+    for (auto & entry : mEntries)
+    {
+        if (entry.inUse && (entry.expiry <= now))
+        {
+            entry = Entry();
+        }
+    }
+}
+
+} // namespace Minimal
+} // namespace mdns
+
+#endif // CHIP_CONFIG_MINMDNS_RESOLVED_NODE_CACHE_SIZE > 0
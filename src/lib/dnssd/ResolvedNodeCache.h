@@ -0,0 +1,120 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/PeerId.h>
+#include <lib/dnssd/Types.h>
+#include <system/SystemClock.h>
+
+#if CHIP_CONFIG_MINMDNS_RESOLVED_NODE_CACHE_SIZE > 0
+
+namespace mdns {
+namespace Minimal {
+
+/// Keeps the operational nodes resolved from received mDNS data
+///
+/// Nodes are kept until the shortest TTL of the records (SRV, TXT and
+/// AAAA/A) they were resolved from expires. When full, the node used the
+/// least recently is replaced.
+///
+/// Nodes can be marked for reporting, for the resolver to report cached data
+/// outside of the call that requested it.
+class ResolvedNodeCache
+{
+public:
+    static constexpr size_t kCacheSize = CHIP_CONFIG_MINMDNS_RESOLVED_NODE_CACHE_SIZE;
+
+    ResolvedNodeCache(chip::System::Clock::ClockBase * clock) : mClock(clock) {}
+
+    /// Adds or replaces the data of a node, for the given TTL.
+    ///
+    /// A TTL of 0 ("goodbye" record) removes the node instead.
+    void Insert(const chip::Dnssd::ResolvedNodeData & data, uint32_t ttlSeconds);
+
+    /// Returns the data of the node, or nullptr if the node is not cached (or expired).
+    ///
+    /// The data is valid until the next change of the cache.
+    const chip::Dnssd::ResolvedNodeData * Lookup(const chip::PeerId & peerId);
+
+    void Remove(const chip::PeerId & peerId);
+    void Clear();
+
+    /// Marks the data of the node as to be reported.
+    ///
+    /// Returns false if the node is not cached.
+    bool MarkPendingReport(const chip::PeerId & peerId);
+
+    /// Fetches the data of a node marked as to be reported, and unmarks it.
+    ///
+    /// Returns false when no cached node is marked.
+    bool TakePendingReport(chip::Dnssd::ResolvedNodeData & outData);
+
+    /// Calls `function(data, remainingTtlSeconds)` for every cached node that can be listed
+    /// as a known answer in queries: nodes with more than half of their TTL left (RFC 6762
+    /// section 7.1).
+    template <typename Function>
+    void ForEachKnownAnswer(Function && function)
+    {
+        Expire();
+
+        const chip::System::Clock::Timestamp now = mClock->GetMonotonicTimestamp();
+        for (auto & entry : mEntries)
+        {
+            if (!entry.inUse)
+            {
+                continue;
+            }
+
+            const uint32_t remaining = std::chrono::duration_cast<chip::System::Clock::Seconds32>(entry.expiry - now).count();
+            if (remaining > entry.ttlSeconds / 2)
+            {
+                function(entry.data, remaining);
+            }
+        }
+    }
+
+private:
+    struct Entry
+    {
+        bool inUse                             = false;
+        bool toReport                          = false;
+        uint32_t ttlSeconds                    = 0;
+        chip::System::Clock::Timestamp expiry  = chip::System::Clock::kZero;
+        chip::System::Clock::Timestamp lastUse = chip::System::Clock::kZero;
+        chip::Dnssd::ResolvedNodeData data;
+    };
+
+    /// Returns the valid entry of the node, if any, dropping expired entries on the way.
+    Entry * Find(const chip::PeerId & peerId);
+
+    /// Removes expired entries
+    void Expire();
+
+    chip::System::Clock::ClockBase * mClock;
+    Entry mEntries[kCacheSize];
+};
+
+} // namespace Minimal
+} // namespace mdns
+
+#endif // CHIP_CONFIG_MINMDNS_RESOLVED_NODE_CACHE_SIZE > 0
@@ -21,12 +21,17 @@
 #include <lib/dnssd/ActiveResolveAttempts.h>
 #include <lib/dnssd/IncrementalResolve.h>
 #include <lib/dnssd/MinimalMdnsServer.h>
+#include <lib/dnssd/ResolvedNodeCache.h>
 #include <lib/dnssd/ServiceNaming.h>
 #include <lib/dnssd/minimal_mdns/Logging.h>
 #include <lib/dnssd/minimal_mdns/Parser.h>
 #include <lib/dnssd/minimal_mdns/QueryBuilder.h>
 #include <lib/dnssd/minimal_mdns/RecordData.h>
 #include <lib/dnssd/minimal_mdns/core/FlatAllocatedQName.h>
+#include <lib/dnssd/minimal_mdns/records/IP.h>
+#include <lib/dnssd/minimal_mdns/records/Ptr.h>
+#include <lib/dnssd/minimal_mdns/records/Srv.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CHIPMemString.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <tracing/macros.h>
@@ -43,6 +48,9 @@ namespace {
 constexpr size_t kMdnsMaxPacketSize = 1024;
 constexpr uint16_t kMdnsPort        = 5353;
 
+// Maximum number of due queries processed at once, each batch being sent in as few packets as possible
+constexpr size_t kMaxAggregatedQueries = 8;
+
 using namespace mdns::Minimal;
 
 /// Handles processing of minmdns packet data.
@@ -293,6 +301,12 @@ private:
     System::Layer * mSystemLayer                      = nullptr;
     ActiveResolveAttempts mActiveResolves;
     PacketParser mPacketParser;
+#if CHIP_CONFIG_MINMDNS_RESOLVED_NODE_CACHE_SIZE > 0
+    ResolvedNodeCache mResolvedNodeCache{ &chip::System::SystemClock() };
+
+    /// Reports the cached nodes that ResolveNodeId marked for reporting.
+    static void ReportCachedNodes(System::Layer *, void * self);
+#endif
 
     void SetDiscoveryContext(DiscoveryContext * context);
     void ScheduleIpAddressResolve(SerializedQNameIterator hostName);
@@ -300,6 +314,16 @@ private:
     CHIP_ERROR SendAllPendingQueries();
     CHIP_ERROR ScheduleRetries();
 
+    /// Sends the given attempts that use the given way of sending (`firstSend`), aggregating
+    /// their questions in as few packets as possible.
+    CHIP_ERROR SendQueries(const ActiveResolveAttempts::ScheduledAttempt * attempts, size_t attemptCount, bool firstSend);
+    CHIP_ERROR SendQueryPacket(QueryBuilder & builder, bool firstSend);
+
+#if CHIP_CONFIG_MINMDNS_RESOLVED_NODE_CACHE_SIZE > 0
+    /// Adds the cached answers to the query for the given attempt (known-answer suppression)
+    void AddKnownAnswers(QueryBuilder & builder, const ActiveResolveAttempts::ScheduledAttempt & attempt);
+#endif
+
     /// Prepare a query for the given schedule attempt
     CHIP_ERROR BuildQuery(QueryBuilder & builder, const ActiveResolveAttempts::ScheduledAttempt & attempt);
 
@@ -451,7 +475,8 @@ void MinMdnsResolver::AdvancePendingResolverStates()
         {
             MATTER_TRACE_SCOPE("Active operational delegate call", "MinMdnsResolver");
             ResolvedNodeData nodeResolvedData;
-            CHIP_ERROR err = resolver->Take(nodeResolvedData);
+            const uint32_t ttlSeconds = resolver->GetTtlSeconds();
+            CHIP_ERROR err            = resolver->Take(nodeResolvedData);
 
             if (err != CHIP_NO_ERROR)
             {
@@ -459,6 +484,11 @@ void MinMdnsResolver::AdvancePendingResolverStates()
                 continue;
             }
 
+#if CHIP_CONFIG_MINMDNS_RESOLVED_NODE_CACHE_SIZE > 0
+            // Nodes are cached whether resolved on request or not, e.g. from announcements.
+            mResolvedNodeCache.Insert(nodeResolvedData, ttlSeconds);
+#endif
+
             if (mActiveResolves.HasBrowseFor(chip::Dnssd::DiscoveryType::kOperational))
             {
                 if (mDiscoveryContext != nullptr)
@@ -502,6 +532,7 @@ void MinMdnsResolver::AdvancePendingResolverStates()
 void MinMdnsResolver::OnMdnsPacketData(const BytesRange & data, const chip::Inet::IPPacketInfo * info)
 {
     MATTER_TRACE_SCOPE("Received MDNS Packet", "MinMdnsResolver");
+    CHIP_MEMORY_TAG_SCOPE(kDnssd);
 
     // Fill up any relevant data
     mPacketParser.ParseSrvRecords(data);
@@ -534,6 +565,10 @@ bool MinMdnsResolver::IsInitialized()
 void MinMdnsResolver::Shutdown()
 {
     GlobalMinimalMdnsServer::Instance().ShutdownServer();
+
+#if CHIP_CONFIG_MINMDNS_RESOLVED_NODE_CACHE_SIZE > 0
+    mResolvedNodeCache.Clear();
+#endif
 }
 
 CHIP_ERROR MinMdnsResolver::BuildQuery(QueryBuilder & builder, const ActiveResolveAttempts::ScheduledAttempt::Browse & data,
@@ -665,39 +700,171 @@ CHIP_ERROR MinMdnsResolver::BuildQuery(QueryBuilder & builder, const ActiveResol
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
 
-    VerifyOrReturnError(builder.Ok(), CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(builder.Ok(), CHIP_ERROR_BUFFER_TOO_SMALL);
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR MinMdnsResolver::SendAllPendingQueries()
+#if CHIP_CONFIG_MINMDNS_RESOLVED_NODE_CACHE_SIZE > 0
+void MinMdnsResolver::AddKnownAnswers(QueryBuilder & builder, const ActiveResolveAttempts::ScheduledAttempt & attempt)
 {
-    while (true)
-    {
-        std::optional<ActiveResolveAttempts::ScheduledAttempt> resolve = mActiveResolves.NextScheduled();
+    // Known answers only save responders from sending data again: any that does not fit is
+    // simply left out. TXT records are not listed, as their raw data is not cached.
+    mResolvedNodeCache.ForEachKnownAnswer([&](const ResolvedNodeData & node, uint32_t ttlSeconds) {
+        char nameBuffer[kMaxOperationalServiceNameSize] = "";
+        VerifyOrReturn(MakeInstanceName(nameBuffer, sizeof(nameBuffer), node.operationalData.peerId) == CHIP_NO_ERROR);
+
+        const char * instanceQName[] = { nameBuffer, kOperationalServiceName, kOperationalProtocol, kLocalDomain };
+        const char * hostQName[]     = { node.resolutionData.hostName, kLocalDomain };
+        const FullQName instanceName(instanceQName);
+        const FullQName hostName(hostQName);
+
+        bool addIpAddresses = false;
 
-        if (!resolve.has_value())
+        if (attempt.IsResolve())
+        {
+            VerifyOrReturn(attempt.ResolveData().peerId == node.operationalData.peerId);
+
+            SrvResourceRecord srv(instanceName, hostName, node.resolutionData.port);
+            srv.SetTtl(ttlSeconds);
+            VerifyOrReturn(builder.AddKnownAnswer(srv));
+            addIpAddresses = true;
+        }
+        else if (attempt.IsIpResolve())
         {
-            break;
+            addIpAddresses = (attempt.IpResolveData().hostName.Content() == hostName);
         }
+        else if (attempt.IsBrowse() && (attempt.BrowseData().type == DiscoveryType::kOperational))
+        {
+            const DiscoveryFilter & filter = attempt.BrowseData().filter;
 
-        System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kMdnsMaxPacketSize);
-        VerifyOrReturnError(!buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+            if (filter.type == DiscoveryFilterType::kNone)
+            {
+                const char * serviceQName[] = { kOperationalServiceName, kOperationalProtocol, kLocalDomain };
+                PtrResourceRecord ptr(serviceQName, instanceName);
+                ptr.SetTtl(ttlSeconds);
+                builder.AddKnownAnswer(ptr);
+            }
+            else if ((filter.type == DiscoveryFilterType::kCompressedFabricId) &&
+                     (filter.code == node.operationalData.peerId.GetCompressedFabricId()))
+            {
+                char subtypeStr[Common::kSubTypeMaxLength + 1];
+                VerifyOrReturn(MakeServiceSubtype(subtypeStr, sizeof(subtypeStr), filter) == CHIP_NO_ERROR);
+
+                const char * subtypeQName[] = { subtypeStr, kSubtypeServiceNamePart, kOperationalServiceName, kOperationalProtocol,
+                                                kLocalDomain };
+                PtrResourceRecord ptr(subtypeQName, instanceName);
+                ptr.SetTtl(ttlSeconds);
+                builder.AddKnownAnswer(ptr);
+            }
+        }
 
-        QueryBuilder builder(std::move(buffer));
-        builder.Header().SetMessageId(0);
+        if (!addIpAddresses)
+        {
+            return;
+        }
 
-        ReturnErrorOnFailure(BuildQuery(builder, *resolve));
+        for (size_t i = 0; i < node.resolutionData.numIPs; i++)
+        {
+            IPResourceRecord ip(hostName, node.resolutionData.ipAddress[i]);
+            ip.SetTtl(ttlSeconds);
+            VerifyOrReturn(builder.AddKnownAnswer(ip));
+        }
+    });
+}
+#endif // CHIP_CONFIG_MINMDNS_RESOLVED_NODE_CACHE_SIZE > 0
 
-        if (resolve->firstSend)
+CHIP_ERROR MinMdnsResolver::SendQueryPacket(QueryBuilder & builder, bool firstSend)
+{
+    if (firstSend)
+    {
+        return GlobalMinimalMdnsServer::Server().BroadcastUnicastQuery(builder.ReleasePacket(), kMdnsPort);
+    }
+    return GlobalMinimalMdnsServer::Server().BroadcastSend(builder.ReleasePacket(), kMdnsPort);
+}
+
+CHIP_ERROR MinMdnsResolver::SendQueries(const ActiveResolveAttempts::ScheduledAttempt * attempts, size_t attemptCount,
+                                        bool firstSend)
+{
+    QueryBuilder builder;
+    [[maybe_unused]] size_t packetStart = 0; // first attempt with questions in the current packet
+
+    for (size_t i = 0; i < attemptCount; i++)
+    {
+        if (attempts[i].firstSend != firstSend)
         {
-            ReturnErrorOnFailure(GlobalMinimalMdnsServer::Server().BroadcastUnicastQuery(builder.ReleasePacket(), kMdnsPort));
+            continue;
         }
-        else
+
+        if (!builder.HasPacketBuffer())
         {
-            ReturnErrorOnFailure(GlobalMinimalMdnsServer::Server().BroadcastSend(builder.ReleasePacket(), kMdnsPort));
+            System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kMdnsMaxPacketSize);
+            VerifyOrReturnError(!buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+            builder.Reset(std::move(buffer));
+            builder.Header().SetMessageId(0);
+            packetStart = i;
         }
+
+        CHIP_ERROR err = BuildQuery(builder, attempts[i]);
+        if ((err == CHIP_ERROR_BUFFER_TOO_SMALL) && (builder.Header().GetQueryCount() > 0))
+        {
+            // A failed question leaves the packet unchanged: send the questions that fit (without
+            // known answers, for which there is no room either) and retry in a new packet.
+            ReturnErrorOnFailure(SendQueryPacket(builder, firstSend));
+
+            System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kMdnsMaxPacketSize);
+            VerifyOrReturnError(!buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+            builder.Reset(std::move(buffer));
+            builder.Header().SetMessageId(0);
+            packetStart = i;
+            err         = BuildQuery(builder, attempts[i]);
+        }
+        ReturnErrorOnFailure(err);
     }
 
+    VerifyOrReturnError(builder.HasPacketBuffer(), CHIP_NO_ERROR);
+
+#if CHIP_CONFIG_MINMDNS_RESOLVED_NODE_CACHE_SIZE > 0
+    // Known answers come after all the questions of the packet (RFC 6762 section 7.1)
+    for (size_t i = packetStart; i < attemptCount; i++)
+    {
+        if (attempts[i].firstSend == firstSend)
+        {
+            AddKnownAnswers(builder, attempts[i]);
+        }
+    }
+#endif
+
+    return SendQueryPacket(builder, firstSend);
+}
+
+CHIP_ERROR MinMdnsResolver::SendAllPendingQueries()
+{
+    // Queries due at the same time are aggregated, by batches: all first sends (which request
+    // unicast answers) go in one packet, and all retries (multicast answers) in another one.
+    ActiveResolveAttempts::ScheduledAttempt attempts[kMaxAggregatedQueries];
+    size_t attemptCount;
+
+    do
+    {
+        attemptCount = 0;
+        while (attemptCount < ArraySize(attempts))
+        {
+            std::optional<ActiveResolveAttempts::ScheduledAttempt> resolve = mActiveResolves.NextScheduled();
+
+            if (!resolve.has_value())
+            {
+                break;
+            }
+
+            attempts[attemptCount++] = *resolve;
+        }
+
+        ReturnErrorOnFailure(SendQueries(attempts, attemptCount, /* firstSend = */ true));
+        ReturnErrorOnFailure(SendQueries(attempts, attemptCount, /* firstSend = */ false));
+    } while (attemptCount == ArraySize(attempts));
+
     ExpireIncrementalResolvers();
 
     return ScheduleRetries();
@@ -758,6 +925,16 @@ CHIP_ERROR MinMdnsResolver::ResolveNodeId(const PeerId & peerId)
 {
     mActiveResolves.MarkPending(peerId);
 
+#if CHIP_CONFIG_MINMDNS_RESOLVED_NODE_CACHE_SIZE > 0
+    // Cached data is reported right away, from the event loop as callers expect results after this call.
+    // The query is still sent to refresh the cache, and its answer reported as well.
+    if (mResolvedNodeCache.MarkPendingReport(peerId))
+    {
+        VerifyOrReturnError(mSystemLayer != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        ReturnErrorOnFailure(mSystemLayer->ScheduleWork(&ReportCachedNodes, this));
+    }
+#endif
+
     return SendAllPendingQueries();
 }
 
@@ -788,6 +965,30 @@ void MinMdnsResolver::RetryCallback(System::Layer *, void * self)
     reinterpret_cast<MinMdnsResolver *>(self)->SendAllPendingQueries();
 }
 
+#if CHIP_CONFIG_MINMDNS_RESOLVED_NODE_CACHE_SIZE > 0
+void MinMdnsResolver::ReportCachedNodes(System::Layer *, void * self)
+{
+    MinMdnsResolver * resolver = reinterpret_cast<MinMdnsResolver *>(self);
+    ResolvedNodeData nodeData;
+
+    while (resolver->mResolvedNodeCache.TakePendingReport(nodeData))
+    {
+        // Nodes no longer resolved since being marked are not reported.
+        if (!resolver->mActiveResolves.HasResolveFor(nodeData.operationalData.peerId))
+        {
+            continue;
+        }
+
+        ChipLogProgress(Discovery, "Node ID resolved from cache for " ChipLogFormatPeerId,
+                        ChipLogValuePeerId(nodeData.operationalData.peerId));
+        if (resolver->mOperationalDelegate != nullptr)
+        {
+            resolver->mOperationalDelegate->OnOperationalNodeResolved(nodeData);
+        }
+    }
+}
+#endif
+
 MinMdnsResolver gResolver;
 
 } // namespace
@@ -21,6 +21,7 @@
 
 #include <lib/dnssd/minimal_mdns/Query.h>
 #include <lib/dnssd/minimal_mdns/core/DnsHeader.h>
+#include <lib/dnssd/minimal_mdns/records/ResourceRecord.h>
 
 namespace mdns {
 namespace Minimal {
@@ -28,8 +29,12 @@ namespace Minimal {
 class QueryBuilder
 {
 public:
-    QueryBuilder() : mHeader(nullptr) {}
-    QueryBuilder(chip::System::PacketBufferHandle && packet) : mHeader(nullptr) { Reset(std::move(packet)); }
+    QueryBuilder() : mHeader(nullptr), mEndianOutput(nullptr, 0), mWriter(&mEndianOutput) {}
+    QueryBuilder(chip::System::PacketBufferHandle && packet) :
+        mHeader(nullptr), mEndianOutput(nullptr, 0), mWriter(&mEndianOutput)
+    {
+        Reset(std::move(packet));
+    }
 
     QueryBuilder & Reset(chip::System::PacketBufferHandle && packet)
     {
@@ -40,6 +45,7 @@ public:
         {
             mPacket->SetDataLength(HeaderRef::kSizeBytes);
             mHeader.Clear();
+            mQueryBuildOk = true;
         }
         else
         {
@@ -47,6 +53,8 @@ public:
         }
 
         mHeader.SetFlags(mHeader.GetFlags().SetQuery());
+        mKnownAnswersStarted = false;
+        mKnownAnswersFull    = false;
         return *this;
     }
 
@@ -60,6 +68,12 @@ public:
 
     HeaderRef & Header() { return mHeader; }
 
+    bool HasPacketBuffer() const { return !mPacket.IsNull(); }
+
+    /// Adds a question to the packet.
+    ///
+    /// On failure (e.g. insufficient space), the packet data and header are unchanged,
+    /// so that the packet can still be sent with the questions added so far.
     QueryBuilder & AddQuery(const Query & query)
     {
         if (!mQueryBuildOk)
@@ -81,12 +95,50 @@ public:
         return *this;
     }
 
+    /// Adds a record the querier already knows to the answers of the packet, for responders
+    /// not to send it again (known-answer suppression, RFC 6762 section 7.1).
+    ///
+    /// Known answers follow all the questions: no question can be added after them. Known answers
+    /// are optional, so failing to add one (e.g. insufficient space) leaves the packet as it was,
+    /// still valid, and no other known answer is added afterwards.
+    ///
+    /// Returns true if the record was added.
+    bool AddKnownAnswer(const ResourceRecord & record)
+    {
+        if (!mQueryBuildOk || mKnownAnswersFull)
+        {
+            return false;
+        }
+
+        if (!mKnownAnswersStarted)
+        {
+            mEndianOutput =
+                chip::Encoding::BigEndian::BufferWriter(mPacket->Start(), mPacket->DataLength() + mPacket->AvailableDataLength());
+            mEndianOutput.Skip(mPacket->DataLength());
+            mWriter.Reset();
+            mKnownAnswersStarted = true;
+        }
+
+        if (!record.Append(mHeader, ResourceType::kAnswer, mWriter))
+        {
+            mKnownAnswersFull = true;
+            return false;
+        }
+
+        mPacket->SetDataLength(static_cast<uint16_t>(mEndianOutput.Needed()));
+        return true;
+    }
+
     bool Ok() const { return mQueryBuildOk; }
 
 private:
     chip::System::PacketBufferHandle mPacket;
     HeaderRef mHeader;
-    bool mQueryBuildOk = true;
+    chip::Encoding::BigEndian::BufferWriter mEndianOutput; // known answers output, shared for name compression
+    RecordWriter mWriter;
+    bool mQueryBuildOk        = true;
+    bool mKnownAnswersStarted = false;
+    bool mKnownAnswersFull    = false;
 };
 
 } // namespace Minimal
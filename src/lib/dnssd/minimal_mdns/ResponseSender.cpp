@@ -19,8 +19,11 @@
 
 #include "QueryReplyFilter.h"
 
+#include <lib/support/CodeUtils.h>
 #include <system/SystemClock.h>
 
+#include <string.h>
+
 namespace mdns {
 namespace Minimal {
 
@@ -37,6 +40,11 @@ constexpr uint16_t kMdnsStandardPort = 5353;
 //    the header.
 constexpr uint16_t kPacketSizeBytes = 512;
 
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+// Cached replies include the IP addresses of the interface, which are not tracked: refresh them regularly.
+constexpr chip::System::Clock::Seconds32 kCachedResponseLifetime(10);
+#endif
+
 } // namespace
 namespace Internal {
 
@@ -50,6 +58,64 @@ bool ResponseSendingState::IncludeQuery() const
     return (mSource->SrcPort != kMdnsStandardPort);
 }
 
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
+bool ResponseCacheKey::Set(const QueryData & query, const chip::Inet::IPPacketInfo * source)
+{
+    interfaceId      = source->Interface;
+    addressType      = source->SrcAddress.Type();
+    type             = query.GetType();
+    klass            = query.GetClass();
+    requestedUnicast = query.RequestedUnicastAnswer();
+    includeQuery     = (source->SrcPort != kMdnsStandardPort);
+    nameLength       = 0;
+
+    SerializedQNameIterator it = query.GetName();
+    while (it.Next())
+    {
+        const size_t labelLength = strlen(it.Value());
+        VerifyOrReturnValue(nameLength + 1 + labelLength <= sizeof(name), false);
+
+        name[nameLength++] = static_cast<uint8_t>(labelLength);
+        memcpy(&name[nameLength], it.Value(), labelLength);
+        nameLength += labelLength;
+    }
+    return it.IsValid();
+}
+
+bool ResponseCacheKey::operator==(const ResponseCacheKey & other) const
+{
+    return (interfaceId == other.interfaceId) && (addressType == other.addressType) && (type == other.type) &&
+        (klass == other.klass) && (requestedUnicast == other.requestedUnicast) && (includeQuery == other.includeQuery) &&
+        (nameLength == other.nameLength) && (memcmp(name, other.name, nameLength) == 0);
+}
+
+bool CachedResponse::IsThrottled(chip::System::Clock::Timestamp now) const
+{
+    // According to https://tools.ietf.org/html/rfc6762#section-6  we should multicast at most 1/sec
+    for (size_t i = 0; i < answerCount; i++)
+    {
+        if (answers[i]->lastMulticastTime >= now - chip::System::Clock::Seconds32(1))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CachedResponse::Clear()
+{
+    inUse       = false;
+    answerCount = 0;
+    for (size_t i = 0; i < packetCount; i++)
+    {
+        packets[i] = nullptr;
+    }
+    packetCount = 0;
+}
+
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
 } // namespace Internal
 
 CHIP_ERROR ResponseSender::AddQueryResponder(QueryResponderBase * queryResponder)
@@ -62,12 +128,14 @@ CHIP_ERROR ResponseSender::AddQueryResponder(QueryResponderBase * queryResponder
         if (responder == nullptr || responder == queryResponder)
         {
             responder = queryResponder;
+            InvalidateResponseCache();
             return CHIP_NO_ERROR;
         }
     }
 
 #if CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST
     mResponders.push_back(queryResponder);
+    InvalidateResponseCache();
     return CHIP_NO_ERROR;
 #else
     return CHIP_ERROR_NO_MEMORY;
@@ -84,6 +152,7 @@ CHIP_ERROR ResponseSender::RemoveQueryResponder(QueryResponderBase * queryRespon
 #if CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST
             mResponders.erase(it);
 #endif
+            InvalidateResponseCache();
             return CHIP_NO_ERROR;
         }
     }
@@ -107,6 +176,47 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
 {
     mSendState.Reset(messageId, query, querySource);
 
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+    // Announcements and replies with overridden TTLs are one-off: only the replies to queries are kept.
+    Internal::ResponseCacheKey key;
+    const chip::System::Clock::Timestamp now = chip::System::SystemClock().GetMonotonicTimestamp();
+
+    mCapture = nullptr;
+    if (!query.IsAnnounceBroadcast() && !configuration.GetTtlSecondsOverride().has_value() && key.Set(query, querySource))
+    {
+        Internal::CachedResponse * cached = FindCachedResponse(key, now);
+        if (cached == nullptr)
+        {
+            mCapture = StartCapture(key, now);
+        }
+        else if (mSendState.SendUnicast() || !cached->IsThrottled(now))
+        {
+            return SendCachedResponse(*cached, now);
+        }
+    }
+
+    CHIP_ERROR err = BuildResponse(query, querySource, configuration);
+    if (mCapture != nullptr)
+    {
+        if (err == CHIP_NO_ERROR)
+        {
+            mCapture->inUse = true;
+        }
+        else
+        {
+            mCapture->Clear();
+        }
+        mCapture = nullptr;
+    }
+    return err;
+#else
+    return BuildResponse(query, querySource, configuration);
+#endif
+}
+
+CHIP_ERROR ResponseSender::BuildResponse(const QueryData & query, const chip::Inet::IPPacketInfo * querySource,
+                                         const ResponseConfiguration & configuration)
+{
     if (query.IsAnnounceBroadcast())
     {
         // Deny listing large amount of data
@@ -159,9 +269,49 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
                 if (!mSendState.SendUnicast())
                 {
                     it->lastMulticastTime = kTimeNow;
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+                    if (mCapture != nullptr)
+                    {
+                        if (mCapture->answerCount < ArraySize(mCapture->answers))
+                        {
+                            mCapture->answers[mCapture->answerCount++] = it.GetInternal();
+                        }
+                        else
+                        {
+                            AbortCapture();
+                        }
+                    }
+#endif
                 }
             }
         }
+
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+        if ((mCapture != nullptr) && !mSendState.SendUnicast())
+        {
+            // Answers skipped by the broadcast throttle are missing from this reply, which
+            // then cannot stand for the replies sent once the throttle expires.
+            QueryResponderRecordFilter unthrottledFilter;
+            unthrottledFilter.SetReplyFilter(&queryReplyFilter);
+
+            size_t answerCount = 0;
+            for (auto & responder : mResponders)
+            {
+                if (responder == nullptr)
+                {
+                    continue;
+                }
+                for (auto it = responder->begin(&unthrottledFilter); it != responder->end(); it++)
+                {
+                    answerCount++;
+                }
+            }
+            if (answerCount != mCapture->answerCount)
+            {
+                AbortCapture();
+            }
+        }
+#endif
     }
 
     // send all 'Additional' replies
@@ -204,31 +354,142 @@ CHIP_ERROR ResponseSender::FlushReply()
 
     if (mResponseBuilder.HasResponseRecords())
     {
-        char srcAddressString[chip::Inet::IPAddress::kMaxStringLength];
-        VerifyOrDie(mSendState.GetSourceAddress().ToString(srcAddressString) != nullptr);
+        chip::System::PacketBufferHandle packet = mResponseBuilder.ReleasePacket();
 
-        if (mSendState.SendUnicast())
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+        if (mCapture != nullptr)
         {
+            if (mCapture->packetCount < ArraySize(mCapture->packets))
+            {
+                mCapture->packets[mCapture->packetCount] = packet.CloneData();
+                if (mCapture->packets[mCapture->packetCount].IsNull())
+                {
+                    AbortCapture();
+                }
+                else
+                {
+                    mCapture->packetCount++;
+                }
+            }
+            else
+            {
+                AbortCapture();
+            }
+        }
+#endif
+
+        ReturnErrorOnFailure(SendReply(std::move(packet)));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ResponseSender::SendReply(chip::System::PacketBufferHandle && packet)
+{
+    char srcAddressString[chip::Inet::IPAddress::kMaxStringLength];
+    VerifyOrDie(mSendState.GetSourceAddress().ToString(srcAddressString) != nullptr);
+
+    if (mSendState.SendUnicast())
+    {
 #if CHIP_MINMDNS_HIGH_VERBOSITY
-            ChipLogDetail(Discovery, "Directly sending mDns reply to peer %s on port %d", srcAddressString,
-                          mSendState.GetSourcePort());
+        ChipLogDetail(Discovery, "Directly sending mDns reply to peer %s on port %d", srcAddressString, mSendState.GetSourcePort());
 #endif
-            ReturnErrorOnFailure(mServer->DirectSend(mResponseBuilder.ReleasePacket(), mSendState.GetSourceAddress(),
-                                                     mSendState.GetSourcePort(), mSendState.GetSourceInterfaceId()));
-        }
-        else
-        {
+        return mServer->DirectSend(std::move(packet), mSendState.GetSourceAddress(), mSendState.GetSourcePort(),
+                                   mSendState.GetSourceInterfaceId());
+    }
+
 #if CHIP_MINMDNS_HIGH_VERBOSITY
-            ChipLogDetail(Discovery, "Broadcasting mDns reply for query from %s", srcAddressString);
+    ChipLogDetail(Discovery, "Broadcasting mDns reply for query from %s", srcAddressString);
 #endif
-            ReturnErrorOnFailure(mServer->BroadcastSend(mResponseBuilder.ReleasePacket(), kMdnsStandardPort,
-                                                        mSendState.GetSourceInterfaceId(), mSendState.GetSourceAddress().Type()));
+    return mServer->BroadcastSend(std::move(packet), kMdnsStandardPort, mSendState.GetSourceInterfaceId(),
+                                  mSendState.GetSourceAddress().Type());
+}
+
+void ResponseSender::InvalidateResponseCache()
+{
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+    for (auto & cached : mCache)
+    {
+        cached.Clear();
+    }
+    mCapture = nullptr;
+#endif
+}
+
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
+Internal::CachedResponse * ResponseSender::FindCachedResponse(const Internal::ResponseCacheKey & key,
+                                                              chip::System::Clock::Timestamp now)
+{
+    for (auto & cached : mCache)
+    {
+        if (!cached.inUse)
+        {
+            continue;
+        }
+        if (now - cached.createdAt >= kCachedResponseLifetime)
+        {
+            cached.Clear();
+            continue;
+        }
+        if (cached.key == key)
+        {
+            return &cached;
         }
     }
+    return nullptr;
+}
 
+Internal::CachedResponse * ResponseSender::StartCapture(const Internal::ResponseCacheKey & key, chip::System::Clock::Timestamp now)
+{
+    Internal::CachedResponse * slot = nullptr;
+    for (auto & cached : mCache)
+    {
+        if (!cached.inUse)
+        {
+            slot = &cached;
+            break;
+        }
+        if ((slot == nullptr) || (cached.lastUse < slot->lastUse))
+        {
+            slot = &cached;
+        }
+    }
+
+    slot->Clear();
+    slot->key       = key;
+    slot->createdAt = now;
+    slot->lastUse   = ++mCacheUseCounter;
+    return slot;
+}
+
+void ResponseSender::AbortCapture()
+{
+    mCapture->Clear();
+    mCapture = nullptr;
+}
+
+CHIP_ERROR ResponseSender::SendCachedResponse(Internal::CachedResponse & cached, chip::System::Clock::Timestamp now)
+{
+    cached.lastUse = ++mCacheUseCounter;
+    for (size_t i = 0; i < cached.answerCount; i++)
+    {
+        cached.answers[i]->lastMulticastTime = now;
+    }
+
+    for (size_t i = 0; i < cached.packetCount; i++)
+    {
+        chip::System::PacketBufferHandle packet = cached.packets[i].CloneData();
+        VerifyOrReturnError(!packet.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+        HeaderRef(packet->Start()).SetMessageId(mSendState.GetMessageId());
+        ReturnErrorOnFailure(SendReply(std::move(packet)));
+    }
     return CHIP_NO_ERROR;
 }
 
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
 CHIP_ERROR ResponseSender::PrepareNewReplyPacket()
 {
     chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::New(kPacketSizeBytes);
@@ -119,6 +119,55 @@ private:
     chip::BitFlags<ResponseItemsSent> mSentItems;
 };
 
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
+/// Identifies the queries that get the same reply: same question, received the same way on the same interface.
+struct ResponseCacheKey
+{
+    static constexpr size_t kMaxNameLength = 128;
+
+    chip::Inet::InterfaceId interfaceId;
+    chip::Inet::IPAddressType addressType = chip::Inet::IPAddressType::kUnknown;
+    QType type                            = QType::ANY;
+    QClass klass                          = QClass::ANY;
+    bool requestedUnicast                 = false;
+    bool includeQuery                     = false;
+    uint8_t name[kMaxNameLength]; // query name, as length-prefixed labels
+    size_t nameLength = 0;
+
+    /// Sets the key of the query. Returns false if the query cannot be a key (e.g. its name is too long).
+    bool Set(const QueryData & query, const chip::Inet::IPPacketInfo * source);
+
+    bool operator==(const ResponseCacheKey & other) const;
+};
+
+/// The reply sent for a query, kept to answer the same query again.
+struct CachedResponse
+{
+    static constexpr size_t kMaxAnswers = 8;
+    static constexpr size_t kMaxPackets = 2;
+
+    bool inUse = false;
+    ResponseCacheKey key;
+    chip::System::Clock::Timestamp createdAt = chip::System::Clock::kZero;
+    uint32_t lastUse                         = 0;
+
+    // Answers of a multicast reply, whose broadcast throttle applies to the copies of the reply
+    QueryResponderInfo * answers[kMaxAnswers];
+    size_t answerCount = 0;
+
+    chip::System::PacketBufferHandle packets[kMaxPackets];
+    size_t packetCount = 0;
+
+    /// Check if any answer was multicast too recently for the reply to be multicast again.
+    /// Throttled replies are built again, with the answers that are not throttled.
+    bool IsThrottled(chip::System::Clock::Timestamp now) const;
+
+    void Clear();
+};
+
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
 } // namespace Internal
 
 /// Sends responses to mDNS queries.
@@ -135,6 +184,9 @@ public:
     bool HasQueryResponders() const;
 
     /// Send back the response to a particular query
+    ///
+    /// When CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE is non-zero, replies to queries are kept
+    /// and sent again, without building them, for the same query received the same way.
     CHIP_ERROR Respond(uint16_t messageId, const QueryData & query, const chip::Inet::IPPacketInfo * querySource,
                        const ResponseConfiguration & configuration);
 
@@ -143,11 +195,33 @@ public:
     bool ShouldSend(const Responder &) const override;
     void ResponsesAdded(const Responder &) override;
 
-    void SetServer(ServerBase * server) { mServer = server; }
+    void SetServer(ServerBase * server)
+    {
+        mServer = server;
+        InvalidateResponseCache();
+    }
+
+    /// Drops all the cached replies. Has to be called whenever the data of the
+    /// query responders changes.
+    void InvalidateResponseCache();
 
 private:
+    CHIP_ERROR BuildResponse(const QueryData & query, const chip::Inet::IPPacketInfo * querySource,
+                             const ResponseConfiguration & configuration);
     CHIP_ERROR FlushReply();
     CHIP_ERROR PrepareNewReplyPacket();
+    CHIP_ERROR SendReply(chip::System::PacketBufferHandle && packet);
+
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+    Internal::CachedResponse * FindCachedResponse(const Internal::ResponseCacheKey & key, chip::System::Clock::Timestamp now);
+    Internal::CachedResponse * StartCapture(const Internal::ResponseCacheKey & key, chip::System::Clock::Timestamp now);
+    CHIP_ERROR SendCachedResponse(Internal::CachedResponse & cached, chip::System::Clock::Timestamp now);
+    void AbortCapture();
+
+    Internal::CachedResponse mCache[CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE];
+    Internal::CachedResponse * mCapture = nullptr; // entry recording the reply being built, if any
+    uint32_t mCacheUseCounter           = 0;
+#endif
 
     ServerBase * mServer;
     QueryResponderPtrPool mResponders = {};
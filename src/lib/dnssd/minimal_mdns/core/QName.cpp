@@ -21,6 +21,35 @@
 
 namespace mdns {
 namespace Minimal {
+namespace {
+
+inline uint8_t ToLowerAscii(uint8_t c)
+{
+    return ((c >= 'A') && (c <= 'Z')) ? static_cast<uint8_t>(c - 'A' + 'a') : c;
+}
+
+/// Compares labels of the same length. Names compare case-insensitively, for
+/// ASCII letters only (RFC 4343).
+bool LabelsEqual(const uint8_t * a, const uint8_t * b, size_t length)
+{
+    // Names are usually spelled with the same case by all parties: memcmp is
+    // the (vectorized) fast path, folding case is only needed when it fails.
+    if (memcmp(a, b, length) == 0)
+    {
+        return true;
+    }
+
+    for (size_t i = 0; i < length; i++)
+    {
+        if (ToLowerAscii(a[i]) != ToLowerAscii(b[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
 
 bool SerializedQNameIterator::Next()
 {
@@ -28,6 +57,21 @@ bool SerializedQNameIterator::Next()
 }
 
 bool SerializedQNameIterator::Next(bool followIndirectPointers)
+{
+    const uint8_t * label;
+    uint8_t length;
+
+    if (!NextLabel(followIndirectPointers, label, length))
+    {
+        return false;
+    }
+
+    memcpy(mValue, label, length);
+    mValue[length] = '\0';
+    return true;
+}
+
+bool SerializedQNameIterator::NextLabel(bool followIndirectPointers, const uint8_t *& label, uint8_t & length)
 {
     if (!mIsValid)
     {
@@ -38,7 +82,7 @@ bool SerializedQNameIterator::Next(bool followIndirectPointers)
     {
         assert(mValidData.Contains(mCurrentPosition));
 
-        const uint8_t length = *mCurrentPosition;
+        length = *mCurrentPosition;
         if (*mCurrentPosition == 0)
         {
             // Done with all items
@@ -102,8 +146,7 @@ bool SerializedQNameIterator::Next(bool followIndirectPointers)
                 return false;
             }
 
-            memcpy(mValue, mCurrentPosition + 1, length);
-            mValue[length]   = '\0';
+            label            = mCurrentPosition + 1;
             mCurrentPosition = mCurrentPosition + length + 1;
             return true;
         }
@@ -112,7 +155,10 @@ bool SerializedQNameIterator::Next(bool followIndirectPointers)
 
 const uint8_t * SerializedQNameIterator::FindDataEnd()
 {
-    while (Next(false))
+    const uint8_t * label;
+    uint8_t length;
+
+    while (NextLabel(false, label, length))
     {
         // nothing to do, just advance
     }
@@ -143,32 +189,42 @@ const uint8_t * SerializedQNameIterator::FindDataEnd()
     return nullptr;
 }
 
+// Comparisons walk the labels in place, in the packet, rather than copying
+// them one by one into Value().
+
 bool SerializedQNameIterator::operator==(const FullQName & other) const
 {
     SerializedQNameIterator self = *this; // allow iteration
     size_t idx                   = 0;
+    const uint8_t * label;
+    uint8_t length;
 
-    while ((idx < other.nameCount) && self.Next())
+    while ((idx < other.nameCount) && self.NextLabel(true, label, length))
     {
-        if (strcasecmp(self.Value(), other.names[idx]) != 0)
+        if ((strlen(other.names[idx]) != length) ||
+            !LabelsEqual(label, reinterpret_cast<const uint8_t *>(other.names[idx]), length))
         {
             return false;
         }
         idx++;
     }
 
-    return ((idx == other.nameCount) && !self.Next());
+    return ((idx == other.nameCount) && !self.NextLabel(true, label, length));
 }
 
 bool SerializedQNameIterator::operator==(const SerializedQNameIterator & other) const
 {
     SerializedQNameIterator a = *this; // allow iteration
     SerializedQNameIterator b = other;
+    const uint8_t * labelA;
+    const uint8_t * labelB;
+    uint8_t lengthA;
+    uint8_t lengthB;
 
     while (true)
     {
-        bool hasA = a.Next();
-        bool hasB = b.Next();
+        bool hasA = a.NextLabel(true, labelA, lengthA);
+        bool hasB = b.NextLabel(true, labelB, lengthB);
 
         if (hasA ^ hasB)
         {
@@ -185,7 +241,7 @@ bool SerializedQNameIterator::operator==(const SerializedQNameIterator & other)
             break;
         }
 
-        if (strcasecmp(a.Value(), b.Value()) != 0)
+        if ((lengthA != lengthB) || !LabelsEqual(labelA, labelB, lengthA))
         {
             return false;
         }
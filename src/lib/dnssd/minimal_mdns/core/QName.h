@@ -115,6 +115,10 @@ private:
 
     // Advances to the next element in the sequence
     bool Next(bool followIndirectPointers);
+
+    // Advances to the next element in the sequence without copying it into mValue:
+    // on success, `label` points to the `length` bytes of the element in the packet.
+    bool NextLabel(bool followIndirectPointers, const uint8_t *& label, uint8_t & length);
 };
 
 } // namespace Minimal
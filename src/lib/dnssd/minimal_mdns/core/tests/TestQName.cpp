@@ -298,4 +298,28 @@ TEST(TestQName, SerializedCompare)
     EXPECT_NE(AsSerializedQName(kThisIs), thisIsATestPtr);
 }
 
+TEST(TestQName, LabelLengthAndCaseCompare)
+{
+    static const uint8_t kTestLocal[]  = "\04test\05local\00";
+    static const uint8_t kTestsLocal[] = "\05tests\05local\00";
+    static const uint8_t kSymbols[]    = "\04a_b[\05local\00";
+
+    const QNamePart kTest[]      = { "test", "local" };
+    const QNamePart kTests[]     = { "TESTS", "local" };
+    const QNamePart kTes[]       = { "tes", "local" };
+    const QNamePart kSymbolsLc[] = { "a_b[", "local" };
+    const QNamePart kSymbolsUc[] = { "A_B{", "local" };
+
+    // Labels differing in length only never match
+    EXPECT_EQ(AsSerializedQName(kTestLocal), FullQName(kTest));
+    EXPECT_NE(AsSerializedQName(kTestLocal), FullQName(kTests));
+    EXPECT_NE(AsSerializedQName(kTestLocal), FullQName(kTes));
+    EXPECT_EQ(AsSerializedQName(kTestsLocal), FullQName(kTests));
+    EXPECT_NE(AsSerializedQName(kTestLocal), AsSerializedQName(kTestsLocal));
+
+    // Only ASCII letters are case-insensitive: '[' and '{' differ by the case bit
+    EXPECT_EQ(AsSerializedQName(kSymbols), FullQName(kSymbolsLc));
+    EXPECT_NE(AsSerializedQName(kSymbols), FullQName(kSymbolsUc));
+}
+
 } // namespace
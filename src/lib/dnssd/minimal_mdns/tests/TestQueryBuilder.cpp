@@ -0,0 +1,131 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/dnssd/minimal_mdns/QueryBuilder.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/dnssd/minimal_mdns/Parser.h>
+#include <lib/dnssd/minimal_mdns/records/Ptr.h>
+#include <lib/dnssd/minimal_mdns/records/Srv.h>
+#include <lib/support/CHIPMem.h>
+
+namespace {
+
+using namespace chip;
+using namespace mdns::Minimal;
+
+const QNamePart kServiceName[]  = { "_matter", "_tcp", "local" };
+const QNamePart kInstanceName[] = { "ABCD-1234", "_matter", "_tcp", "local" };
+const QNamePart kHostName[]     = { "abcd", "local" };
+
+class CountingDelegate : public ParserDelegate
+{
+public:
+    void OnHeader(ConstHeaderRef & header) override {}
+    void OnQuery(const QueryData & data) override { mQueries++; }
+    void OnResource(ResourceType type, const ResourceData & data) override
+    {
+        if (type == ResourceType::kAnswer)
+        {
+            mAnswers++;
+            mLastAnswerTtl = data.GetTtlSeconds();
+        }
+    }
+
+    size_t mQueries         = 0;
+    size_t mAnswers         = 0;
+    uint64_t mLastAnswerTtl = 0;
+};
+
+class TestQueryBuilder : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestQueryBuilder, QueriesWithKnownAnswers)
+{
+    QueryBuilder builder(System::PacketBufferHandle::New(512));
+
+    builder.AddQuery(Query(kServiceName).SetType(QType::PTR));
+    builder.AddQuery(Query(kInstanceName).SetType(QType::ANY));
+    EXPECT_TRUE(builder.Ok());
+
+    PtrResourceRecord ptr(kServiceName, kInstanceName);
+    ptr.SetTtl(60);
+    SrvResourceRecord srv(kInstanceName, kHostName, 5540);
+    srv.SetTtl(100);
+    EXPECT_TRUE(builder.AddKnownAnswer(ptr));
+    EXPECT_TRUE(builder.AddKnownAnswer(srv));
+    EXPECT_EQ(builder.Header().GetQueryCount(), 2);
+    EXPECT_EQ(builder.Header().GetAnswerCount(), 2);
+
+    // Questions cannot follow known answers
+    builder.AddQuery(Query(kHostName).SetType(QType::AAAA));
+    EXPECT_FALSE(builder.Ok());
+    EXPECT_EQ(builder.Header().GetQueryCount(), 2);
+
+    System::PacketBufferHandle packet = builder.ReleasePacket();
+    CountingDelegate delegate;
+    EXPECT_TRUE(ParsePacket(BytesRange(packet->Start(), packet->Start() + packet->DataLength()), &delegate));
+    EXPECT_EQ(delegate.mQueries, 2u);
+    EXPECT_EQ(delegate.mAnswers, 2u);
+    EXPECT_EQ(delegate.mLastAnswerTtl, 100u);
+
+    // Builders can be reused
+    builder.Reset(System::PacketBufferHandle::New(512));
+    builder.AddQuery(Query(kHostName).SetType(QType::AAAA));
+    EXPECT_TRUE(builder.Ok());
+    EXPECT_EQ(builder.Header().GetQueryCount(), 1);
+    EXPECT_EQ(builder.Header().GetAnswerCount(), 0);
+}
+
+TEST_F(TestQueryBuilder, KnownAnswersAreOptional)
+{
+    QueryBuilder builder(System::PacketBufferHandle::New(128));
+
+    builder.AddQuery(Query(kServiceName).SetType(QType::PTR));
+    EXPECT_TRUE(builder.Ok());
+
+    // Fill the packet with answers
+    SrvResourceRecord srv(kInstanceName, kHostName, 5540);
+    uint16_t answers = 0;
+    while (builder.AddKnownAnswer(srv))
+    {
+        answers++;
+        ASSERT_LT(answers, 1000);
+    }
+    EXPECT_GT(answers, 0);
+
+    // No more answers once one did not fit, and the packet stays valid
+    PtrResourceRecord ptr(kServiceName, kInstanceName);
+    EXPECT_FALSE(builder.AddKnownAnswer(ptr));
+    EXPECT_TRUE(builder.Ok());
+    EXPECT_EQ(builder.Header().GetAnswerCount(), answers);
+
+    System::PacketBufferHandle packet = builder.ReleasePacket();
+    CountingDelegate delegate;
+    EXPECT_TRUE(ParsePacket(BytesRange(packet->Start(), packet->Start() + packet->DataLength()), &delegate));
+    EXPECT_EQ(delegate.mQueries, 1u);
+    EXPECT_EQ(delegate.mAnswers, answers);
+}
+
+} // namespace
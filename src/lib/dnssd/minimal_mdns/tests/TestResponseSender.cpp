@@ -84,6 +84,24 @@ struct CommonTestElements
     }
 };
 
+class CountingSrvResponder : public SrvResponder
+{
+public:
+    CountingSrvResponder(const SrvResourceRecord & record) : SrvResponder(record) {}
+
+    void AddAllResponses(const chip::Inet::IPPacketInfo * source, ResponderDelegate * delegate,
+                         const ResponseConfiguration & configuration) override
+    {
+        mCalls++;
+        SrvResponder::AddAllResponses(source, delegate, configuration);
+    }
+
+    unsigned GetCalls() const { return mCalls; }
+
+private:
+    unsigned mCalls = 0;
+};
+
 class TestResponseSender : public ::testing::Test
 {
 public:
@@ -350,4 +368,56 @@ TEST_F(TestResponseSender, PtrSrvTxtMultipleRespondersToServiceListing)
     EXPECT_TRUE(common1->server.GetHeaderFound());
 }
 
+TEST_F(TestResponseSender, CachedResponses)
+{
+    CommonTestElements common("test");
+    CountingSrvResponder srvResponder(common.srvRecord);
+    ResponseSender responseSender(&common.server);
+    EXPECT_EQ(responseSender.AddQueryResponder(&common.queryResponder), CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&srvResponder);
+
+    common.recordWriter.WriteQName(common.instance);
+    QueryData queryData = QueryData(QType::SRV, QClass::IN, false, common.requestNameStart, common.requestBytesRange);
+
+    common.server.AddExpectedRecord(&common.srvRecord);
+    EXPECT_EQ(responseSender.Respond(1, queryData, &common.packetInfo, ResponseConfiguration()), CHIP_NO_ERROR);
+    EXPECT_TRUE(common.server.GetSendCalled());
+    EXPECT_TRUE(common.server.GetHeaderFound());
+    EXPECT_EQ(srvResponder.GetCalls(), 1u);
+
+    // The same query gets the same reply, copied from the cache when enabled.
+    constexpr unsigned kCallsPerReply = (CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0) ? 0 : 1;
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    EXPECT_EQ(responseSender.Respond(2, queryData, &common.packetInfo, ResponseConfiguration()), CHIP_NO_ERROR);
+    EXPECT_TRUE(common.server.GetSendCalled());
+    EXPECT_TRUE(common.server.GetHeaderFound());
+    EXPECT_EQ(srvResponder.GetCalls(), 1u + kCallsPerReply);
+
+    // Replies with overridden TTLs are never cached.
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    EXPECT_EQ(responseSender.Respond(3, queryData, &common.packetInfo, ResponseConfiguration().SetTtlSecondsOverride(0)),
+              CHIP_NO_ERROR);
+    EXPECT_TRUE(common.server.GetSendCalled());
+    EXPECT_EQ(srvResponder.GetCalls(), 2u + kCallsPerReply);
+
+    // Invalidating the cache builds the reply again.
+    responseSender.InvalidateResponseCache();
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    EXPECT_EQ(responseSender.Respond(4, queryData, &common.packetInfo, ResponseConfiguration()), CHIP_NO_ERROR);
+    EXPECT_TRUE(common.server.GetSendCalled());
+    EXPECT_TRUE(common.server.GetHeaderFound());
+    EXPECT_EQ(srvResponder.GetCalls(), 3u + kCallsPerReply);
+
+    // Another query is not answered from the cache.
+    QueryData otherQuery = QueryData(QType::ANY, QClass::IN, false, common.requestNameStart, common.requestBytesRange);
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    EXPECT_EQ(responseSender.Respond(5, otherQuery, &common.packetInfo, ResponseConfiguration()), CHIP_NO_ERROR);
+    EXPECT_TRUE(common.server.GetSendCalled());
+    EXPECT_EQ(srvResponder.GetCalls(), 4u + kCallsPerReply);
+}
+
 } // namespace
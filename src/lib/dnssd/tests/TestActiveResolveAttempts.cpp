@@ -19,6 +19,7 @@
 
 #include <lib/core/StringBuilderAdapters.h>
 #include <lib/dnssd/ActiveResolveAttempts.h>
+#include <lib/support/CHIPMem.h>
 
 namespace {
 
@@ -46,7 +47,15 @@ std::optional<ActiveResolveAttempts::ScheduledAttempt> ScheduledBrowse(const Dns
         ActiveResolveAttempts::ScheduledAttempt(filter, type, first));
 }
 
-TEST(TestActiveResolveAttempts, TestSinglePeerAddRemove)
+class TestActiveResolveAttempts : public ::testing::Test
+{
+public:
+    // Attempts are allocated from the heap when pools use it
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestActiveResolveAttempts, TestSinglePeerAddRemove)
 {
     System::Clock::Internal::MockClock mockClock;
     mdns::Minimal::ActiveResolveAttempts attempts(&mockClock);
@@ -89,7 +98,7 @@ TEST(TestActiveResolveAttempts, TestSinglePeerAddRemove)
     EXPECT_FALSE(attempts.NextScheduled().has_value());
 }
 
-TEST(TestActiveResolveAttempts, TestSingleBrowseAddRemove)
+TEST_F(TestActiveResolveAttempts, TestSingleBrowseAddRemove)
 {
     System::Clock::Internal::MockClock mockClock;
     mdns::Minimal::ActiveResolveAttempts attempts(&mockClock);
@@ -133,7 +142,7 @@ TEST(TestActiveResolveAttempts, TestSingleBrowseAddRemove)
     EXPECT_FALSE(attempts.NextScheduled().has_value());
 }
 
-TEST(TestActiveResolveAttempts, TestRescheduleSamePeerId)
+TEST_F(TestActiveResolveAttempts, TestRescheduleSamePeerId)
 {
     System::Clock::Internal::MockClock mockClock;
     mdns::Minimal::ActiveResolveAttempts attempts(&mockClock);
@@ -165,7 +174,7 @@ TEST(TestActiveResolveAttempts, TestRescheduleSamePeerId)
     EXPECT_EQ(attempts.GetTimeUntilNextExpectedResponse(), std::make_optional<Timeout>(1000_ms32));
 }
 
-TEST(TestActiveResolveAttempts, TestRescheduleSameFilter)
+TEST_F(TestActiveResolveAttempts, TestRescheduleSameFilter)
 {
     System::Clock::Internal::MockClock mockClock;
     mdns::Minimal::ActiveResolveAttempts attempts(&mockClock);
@@ -199,11 +208,12 @@ TEST(TestActiveResolveAttempts, TestRescheduleSameFilter)
     EXPECT_EQ(attempts.GetTimeUntilNextExpectedResponse(), std::make_optional<Timeout>(1000_ms32));
 }
 
-TEST(TestActiveResolveAttempts, TestLRU)
+TEST_F(TestActiveResolveAttempts, TestLRU)
 {
     // validates that the LRU logic is working
+    constexpr uint32_t kCapacity = 4;
     System::Clock::Internal::MockClock mockClock;
-    mdns::Minimal::ActiveResolveAttempts attempts(&mockClock);
+    mdns::Minimal::ActiveResolveAttempts attempts(&mockClock, kCapacity);
 
     mockClock.AdvanceMonotonic(334455_ms32);
 
@@ -222,7 +232,7 @@ TEST(TestActiveResolveAttempts, TestLRU)
 
     // at this point, peer 9999 has a delay of 4 seconds. Fill up the rest of the table
 
-    for (uint32_t i = 1; i < mdns::Minimal::ActiveResolveAttempts::kRetryQueueSize; i++)
+    for (uint32_t i = 1; i < kCapacity; i++)
     {
         attempts.MarkPending(MakePeerId(i));
         mockClock.AdvanceMonotonic(1_ms32);
@@ -233,11 +243,10 @@ TEST(TestActiveResolveAttempts, TestLRU)
 
     // +2 because: 1 element skipped, one element is the "current" that has a delay of 1000ms
     EXPECT_EQ(attempts.GetTimeUntilNextExpectedResponse(),
-              std::make_optional<System::Clock::Timeout>(
-                  System::Clock::Milliseconds32(1000 - mdns::Minimal::ActiveResolveAttempts::kRetryQueueSize + 2)));
+              std::make_optional<System::Clock::Timeout>(System::Clock::Milliseconds32(1000 - kCapacity + 2)));
 
     // add another element - this should overwrite peer 9999
-    attempts.MarkPending(MakePeerId(mdns::Minimal::ActiveResolveAttempts::kRetryQueueSize));
+    attempts.MarkPending(MakePeerId(kCapacity));
     mockClock.AdvanceMonotonic(32_s16);
 
     for (std::optional<ActiveResolveAttempts::ScheduledAttempt> s = attempts.NextScheduled(); s.has_value();
@@ -275,7 +284,7 @@ TEST(TestActiveResolveAttempts, TestLRU)
     EXPECT_LT(i, kMaxIterations);
 }
 
-TEST(TestActiveResolveAttempts, TestNextPeerOrdering)
+TEST_F(TestActiveResolveAttempts, TestNextPeerOrdering)
 {
     System::Clock::Internal::MockClock mockClock;
     mdns::Minimal::ActiveResolveAttempts attempts(&mockClock);
@@ -322,15 +331,64 @@ TEST(TestActiveResolveAttempts, TestNextPeerOrdering)
     EXPECT_EQ(attempts.GetTimeUntilNextExpectedResponse(), std::make_optional<Timeout>(400_ms32));
     EXPECT_FALSE(attempts.NextScheduled().has_value());
 
-    // advancing the clock 'too long' will return both other entries, in  reverse order due to how
-    // the internal cache is built
+    // advancing the clock 'too long' will return both other entries, in the order they were due
     mockClock.AdvanceMonotonic(500_ms32);
-    EXPECT_EQ(attempts.NextScheduled(), ScheduledPeer(3, false));
     EXPECT_EQ(attempts.NextScheduled(), ScheduledPeer(2, false));
+    EXPECT_EQ(attempts.NextScheduled(), ScheduledPeer(3, false));
+    EXPECT_FALSE(attempts.NextScheduled().has_value());
+}
+
+TEST_F(TestActiveResolveAttempts, TestManyPendingResolves)
+{
+    // An even number of attempts, within the configured capacity
+    constexpr uint32_t kCount = 2 * (std::min<uint32_t>(200, ActiveResolveAttempts::kMaxPendingAttempts) / 2);
+    System::Clock::Internal::MockClock mockClock;
+    mdns::Minimal::ActiveResolveAttempts attempts(&mockClock, kCount);
+
+    mockClock.AdvanceMonotonic(1234_ms32);
+
+    // A burst of resolves: none of them is lost
+    for (uint32_t i = 1; i <= kCount; i++)
+    {
+        attempts.MarkPending(MakePeerId(i));
+        mockClock.AdvanceMonotonic(1_ms32);
+    }
+    for (uint32_t i = 1; i <= kCount; i++)
+    {
+        EXPECT_EQ(attempts.NextScheduled(), ScheduledPeer(i, true));
+    }
+    EXPECT_FALSE(attempts.NextScheduled().has_value());
+
+    // Completed resolves are not retried, the others keep the usual backoff
+    for (uint32_t i = 1; i <= kCount; i += 2)
+    {
+        attempts.Complete(MakePeerId(i));
+        EXPECT_FALSE(attempts.HasResolveFor(MakePeerId(i)));
+        EXPECT_TRUE(attempts.HasResolveFor(MakePeerId(i + 1)));
+    }
+    EXPECT_EQ(attempts.GetTimeUntilNextExpectedResponse(), std::make_optional<Timeout>(1000_ms32));
+
+    mockClock.AdvanceMonotonic(1000_ms32);
+    for (uint32_t i = 2; i <= kCount; i += 2)
+    {
+        EXPECT_EQ(attempts.NextScheduled(), ScheduledPeer(i, false));
+    }
     EXPECT_FALSE(attempts.NextScheduled().has_value());
+    EXPECT_EQ(attempts.GetTimeUntilNextExpectedResponse(), std::make_optional<Timeout>(2000_ms32));
+
+    // New resolves are sent before the pending retries
+    mockClock.AdvanceMonotonic(10_ms32);
+    attempts.MarkPending(MakePeerId(1));
+    EXPECT_EQ(attempts.GetTimeUntilNextExpectedResponse(), std::make_optional<Timeout>(0_ms32));
+    EXPECT_EQ(attempts.NextScheduled(), ScheduledPeer(1, true));
+    EXPECT_FALSE(attempts.NextScheduled().has_value());
+    EXPECT_EQ(attempts.GetTimeUntilNextExpectedResponse(), std::make_optional<Timeout>(1000_ms32));
+
+    attempts.Reset();
+    EXPECT_FALSE(attempts.GetTimeUntilNextExpectedResponse().has_value());
 }
 
-TEST(TestActiveResolveAttempts, TestCombination)
+TEST_F(TestActiveResolveAttempts, TestCombination)
 {
     System::Clock::Internal::MockClock mockClock;
     mdns::Minimal::ActiveResolveAttempts attempts(&mockClock);
@@ -298,6 +298,9 @@ TEST(TestIncrementalResolve, TestParseOperational)
     // Resolver should have all data
     EXPECT_FALSE(resolver.GetMissingRequiredInformation().HasAny());
 
+    // Data lives as long as its shortest lived record, the SRV one here
+    EXPECT_EQ(resolver.GetTtlSeconds(), 1u);
+
     // At this point taking value should work. Once taken, the resolver is reset.
     ResolvedNodeData nodeData;
     EXPECT_EQ(resolver.Take(nodeData), CHIP_NO_ERROR);
@@ -0,0 +1,171 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/dnssd/ResolvedNodeCache.h>
+
+#if CHIP_CONFIG_MINMDNS_RESOLVED_NODE_CACHE_SIZE > 0
+
+namespace {
+
+using namespace chip;
+using namespace chip::System::Clock::Literals;
+using mdns::Minimal::ResolvedNodeCache;
+
+PeerId MakePeerId(NodeId nodeId)
+{
+    PeerId peerId;
+    return peerId.SetNodeId(nodeId).SetCompressedFabricId(123);
+}
+
+Dnssd::ResolvedNodeData MakeNodeData(NodeId nodeId, uint16_t port)
+{
+    Dnssd::ResolvedNodeData data;
+    data.operationalData.peerId     = MakePeerId(nodeId);
+    data.operationalData.hasZeroTTL = false;
+    data.resolutionData.port        = port;
+    return data;
+}
+
+TEST(TestResolvedNodeCache, TestInsertAndExpire)
+{
+    System::Clock::Internal::MockClock mockClock;
+    ResolvedNodeCache cache(&mockClock);
+
+    mockClock.AdvanceMonotonic(1234_ms32);
+
+    EXPECT_EQ(cache.Lookup(MakePeerId(1)), nullptr);
+
+    cache.Insert(MakeNodeData(1, 5540), 120);
+    const Dnssd::ResolvedNodeData * data = cache.Lookup(MakePeerId(1));
+    ASSERT_NE(data, nullptr);
+    EXPECT_EQ(data->resolutionData.port, 5540);
+    EXPECT_EQ(cache.Lookup(MakePeerId(2)), nullptr);
+
+    // Newer data replaces the cached one
+    cache.Insert(MakeNodeData(1, 5541), 10);
+    data = cache.Lookup(MakePeerId(1));
+    ASSERT_NE(data, nullptr);
+    EXPECT_EQ(data->resolutionData.port, 5541);
+
+    // Data is dropped once its TTL expires
+    mockClock.AdvanceMonotonic(9999_ms32);
+    EXPECT_NE(cache.Lookup(MakePeerId(1)), nullptr);
+    mockClock.AdvanceMonotonic(1_ms32);
+    EXPECT_EQ(cache.Lookup(MakePeerId(1)), nullptr);
+
+    // Goodbye (TTL 0) records remove the node
+    cache.Insert(MakeNodeData(2, 5540), 120);
+    EXPECT_NE(cache.Lookup(MakePeerId(2)), nullptr);
+    cache.Insert(MakeNodeData(2, 5540), 0);
+    EXPECT_EQ(cache.Lookup(MakePeerId(2)), nullptr);
+
+    cache.Insert(MakeNodeData(3, 5540), 120);
+    cache.Clear();
+    EXPECT_EQ(cache.Lookup(MakePeerId(3)), nullptr);
+}
+
+TEST(TestResolvedNodeCache, TestLeastRecentlyUsedReplacement)
+{
+    System::Clock::Internal::MockClock mockClock;
+    ResolvedNodeCache cache(&mockClock);
+
+    for (NodeId id = 1; id <= ResolvedNodeCache::kCacheSize; id++)
+    {
+        mockClock.AdvanceMonotonic(1_ms32);
+        cache.Insert(MakeNodeData(id, 5540), 120);
+    }
+
+    // Node 1 is used again, node 2 is now the least recently used one
+    mockClock.AdvanceMonotonic(1_ms32);
+    EXPECT_NE(cache.Lookup(MakePeerId(1)), nullptr);
+
+    mockClock.AdvanceMonotonic(1_ms32);
+    cache.Insert(MakeNodeData(100, 5540), 120);
+
+    EXPECT_NE(cache.Lookup(MakePeerId(100)), nullptr);
+    EXPECT_NE(cache.Lookup(MakePeerId(1)), nullptr);
+    if (ResolvedNodeCache::kCacheSize > 1)
+    {
+        EXPECT_EQ(cache.Lookup(MakePeerId(2)), nullptr);
+    }
+}
+
+TEST(TestResolvedNodeCache, TestPendingReports)
+{
+    System::Clock::Internal::MockClock mockClock;
+    ResolvedNodeCache cache(&mockClock);
+    Dnssd::ResolvedNodeData data;
+
+    EXPECT_FALSE(cache.MarkPendingReport(MakePeerId(1)));
+    EXPECT_FALSE(cache.TakePendingReport(data));
+
+    cache.Insert(MakeNodeData(1, 5540), 120);
+    cache.Insert(MakeNodeData(2, 5541), 1);
+    EXPECT_TRUE(cache.MarkPendingReport(MakePeerId(1)));
+    EXPECT_TRUE(cache.MarkPendingReport(MakePeerId(2)));
+
+    // Expired nodes are not reported
+    mockClock.AdvanceMonotonic(1000_ms32);
+
+    EXPECT_TRUE(cache.TakePendingReport(data));
+    EXPECT_EQ(data.operationalData.peerId, MakePeerId(1));
+    EXPECT_EQ(data.resolutionData.port, 5540);
+    EXPECT_FALSE(cache.TakePendingReport(data));
+
+    // Reported nodes stay cached
+    EXPECT_NE(cache.Lookup(MakePeerId(1)), nullptr);
+}
+
+TEST(TestResolvedNodeCache, TestKnownAnswers)
+{
+    System::Clock::Internal::MockClock mockClock;
+    ResolvedNodeCache cache(&mockClock);
+
+    cache.Insert(MakeNodeData(1, 5540), 120);
+    cache.Insert(MakeNodeData(2, 5541), 10);
+
+    size_t count                 = 0;
+    uint32_t remainingTtlSeconds = 0;
+
+    auto collect = [&](const Dnssd::ResolvedNodeData & data, uint32_t ttlSeconds) {
+        count++;
+        if (data.operationalData.peerId == MakePeerId(1))
+        {
+            remainingTtlSeconds = ttlSeconds;
+        }
+    };
+
+    cache.ForEachKnownAnswer(collect);
+    EXPECT_EQ(count, 2u);
+    EXPECT_EQ(remainingTtlSeconds, 120u);
+
+    // Nodes with half of their TTL left or less are not known answers anymore, but stay cached
+    mockClock.AdvanceMonotonic(5000_ms32);
+    count = 0;
+    cache.ForEachKnownAnswer(collect);
+    EXPECT_EQ(count, 1u);
+    EXPECT_EQ(remainingTtlSeconds, 115u);
+    EXPECT_NE(cache.Lookup(MakePeerId(2)), nullptr);
+}
+
+} // namespace
+
+#endif // CHIP_CONFIG_MINMDNS_RESOLVED_NODE_CACHE_SIZE > 0
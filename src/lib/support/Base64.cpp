@@ -24,14 +24,19 @@
 
 #include "Base64.h"
 
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Simd.h>
+
 #include <ctype.h>
 #include <stdint.h>
 
 namespace chip {
 
+namespace {
+
 // Convert a value in the range 0..63 to its equivalent base64 character.
 // Return '=' for any value >= 64.
-static char Base64ValToChar(uint8_t val)
+constexpr char Base64ValToChar(uint8_t val)
 {
     if (val < 26)
         return static_cast<char>('A' + val);
@@ -49,7 +54,7 @@ static char Base64ValToChar(uint8_t val)
 }
 
 // Convert a base64 character to a value in the range 0..63, or UINT8_MAX if the character is invalid.
-static uint8_t Base64CharToVal(uint8_t c)
+constexpr uint8_t Base64CharToVal(uint8_t c)
 {
     if (c == 43)
         return 62;
@@ -72,7 +77,7 @@ static uint8_t Base64CharToVal(uint8_t c)
 
 // Convert a value in the range 0..63 to its equivalent base64url character (see RFC-4648, section 5).
 // Return '=' for any value >= 64.
-static char Base64URLValToChar(uint8_t val)
+constexpr char Base64URLValToChar(uint8_t val)
 {
     if (val < 26)
         return static_cast<char>('A' + val);
@@ -90,7 +95,7 @@ static char Base64URLValToChar(uint8_t val)
 }
 
 // Convert a base64url character to a value in the range 0..63, or UINT8_MAX if the character is invalid.
-static uint8_t Base64URLCharToVal(uint8_t c)
+constexpr uint8_t Base64URLCharToVal(uint8_t c)
 {
     if (c == 45)
         return 62;
@@ -111,6 +116,214 @@ static uint8_t Base64URLCharToVal(uint8_t c)
     return UINT8_MAX;
 }
 
+using Base64ValToCharTable = char[64];
+using Base64CharToValTable = uint8_t[256];
+
+struct Base64Alphabet
+{
+    Base64ValToCharTable valToChar;
+    Base64CharToValTable charToVal;
+};
+
+constexpr Base64Alphabet MakeBase64Alphabet(char (*valToCharFunct)(uint8_t), uint8_t (*charToValFunct)(uint8_t))
+{
+    Base64Alphabet alphabet = {};
+    for (uint8_t val = 0; val < 64; val++)
+    {
+        alphabet.valToChar[val] = valToCharFunct(val);
+    }
+    for (unsigned c = 0; c < 256; c++)
+    {
+        alphabet.charToVal[c] = charToValFunct(static_cast<uint8_t>(c));
+    }
+    return alphabet;
+}
+
+constexpr Base64Alphabet kBase64Alphabet    = MakeBase64Alphabet(Base64ValToChar, Base64CharToVal);
+constexpr Base64Alphabet kBase64URLAlphabet = MakeBase64Alphabet(Base64URLValToChar, Base64URLCharToVal);
+
+// Encode the leading whole vectors of 48 bytes and return the number of bytes encoded.
+uint16_t Base64EncodeVectors(const uint8_t * in, uint16_t inLen, char * out, const Base64Alphabet & alphabet)
+{
+    uint16_t encoded = 0;
+
+#if CHIP_SIMD_NEON
+    constexpr uint16_t kBlockSize = 3 * Simd::kVectorSize;
+
+    const uint8_t * chars = reinterpret_cast<const uint8_t *>(alphabet.valToChar);
+    uint8x16x4_t table;
+    table.val[0]          = vld1q_u8(chars);
+    table.val[1]          = vld1q_u8(chars + 16);
+    table.val[2]          = vld1q_u8(chars + 32);
+    table.val[3]          = vld1q_u8(chars + 48);
+    const uint8x16_t mask = vdupq_n_u8(0x3F);
+
+    for (; inLen - encoded >= kBlockSize; encoded = static_cast<uint16_t>(encoded + kBlockSize))
+    {
+        // Byte i of each register holds byte i of 16 consecutive groups of 3 bytes, and respectively of 4 characters.
+        const uint8x16x3_t bytes = vld3q_u8(in + encoded);
+        uint8x16x4_t vals;
+        vals.val[0] = vshrq_n_u8(bytes.val[0], 2);
+        vals.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(bytes.val[0], 4), vshrq_n_u8(bytes.val[1], 4)), mask);
+        vals.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(bytes.val[1], 2), vshrq_n_u8(bytes.val[2], 6)), mask);
+        vals.val[3] = vandq_u8(bytes.val[2], mask);
+        for (auto & val : vals.val)
+        {
+            val = vqtbl4q_u8(table, val);
+        }
+        vst4q_u8(reinterpret_cast<uint8_t *>(out + encoded / 3 * 4), vals);
+    }
+#else
+    IgnoreUnusedVariable(in);
+    IgnoreUnusedVariable(inLen);
+    IgnoreUnusedVariable(out);
+    IgnoreUnusedVariable(alphabet);
+#endif
+
+    return encoded;
+}
+
+// Table-driven variant of the generic Base64Encode below, for the standard alphabets.
+uint16_t Base64EncodeWithTable(const uint8_t * in, uint16_t inLen, char * out, const Base64Alphabet & alphabet)
+{
+    const char * valToChar = alphabet.valToChar;
+    char * outStart        = out;
+
+    uint16_t encoded = Base64EncodeVectors(in, inLen, out, alphabet);
+    in += encoded;
+    out += encoded / 3 * 4;
+    inLen = static_cast<uint16_t>(inLen - encoded);
+
+    for (; inLen >= 3; inLen = static_cast<uint16_t>(inLen - 3))
+    {
+        const uint32_t group = static_cast<uint32_t>(in[0] << 16 | in[1] << 8 | in[2]);
+        out[0]               = valToChar[(group >> 18) & 0x3F];
+        out[1]               = valToChar[(group >> 12) & 0x3F];
+        out[2]               = valToChar[(group >> 6) & 0x3F];
+        out[3]               = valToChar[group & 0x3F];
+        in += 3;
+        out += 4;
+    }
+
+    if (inLen > 0)
+    {
+        const uint8_t second = (inLen > 1) ? in[1] : 0;
+        out[0]               = valToChar[in[0] >> 2];
+        out[1]               = valToChar[((in[0] << 4) | (second >> 4)) & 0x3F];
+        out[2]               = (inLen > 1) ? valToChar[(second << 2) & 0x3F] : '=';
+        out[3]               = '=';
+        out += 4;
+    }
+
+    return static_cast<uint16_t>(out - outStart);
+}
+
+// Table-driven variant of the generic Base64Decode below, for the standard alphabets: groups of 4 valid
+// characters are decoded from the table and the generic implementation handles the end of the input.
+uint16_t Base64DecodeWithTable(const char * in, uint16_t inLen, uint8_t * out, const Base64Alphabet & alphabet,
+                               Base64CharToValFunct charToValFunct)
+{
+    const uint8_t * charToVal = alphabet.charToVal;
+    uint8_t * outStart        = out;
+
+    for (; inLen >= 4; inLen = static_cast<uint16_t>(inLen - 4))
+    {
+        const uint8_t a = charToVal[static_cast<uint8_t>(in[0])];
+        const uint8_t b = charToVal[static_cast<uint8_t>(in[1])];
+        const uint8_t c = charToVal[static_cast<uint8_t>(in[2])];
+        const uint8_t d = charToVal[static_cast<uint8_t>(in[3])];
+
+        // Invalid characters, including padding, map to UINT8_MAX
+        if ((a | b | c | d) & 0xC0)
+        {
+            break;
+        }
+
+        // Reads of the group are done before its writes, which trail them, so decoding in place works.
+        out[0] = static_cast<uint8_t>((a << 2) | (b >> 4));
+        out[1] = static_cast<uint8_t>((b << 4) | (c >> 2));
+        out[2] = static_cast<uint8_t>((c << 6) | d);
+        in += 4;
+        out += 3;
+    }
+
+    const uint16_t remaining = Base64Decode(in, inLen, out, charToValFunct);
+    if (remaining == UINT16_MAX)
+    {
+        return UINT16_MAX;
+    }
+    return static_cast<uint16_t>(out - outStart + remaining);
+}
+
+// Encode with 32-bit lengths by splitting the input in chunks that encodeChunk can handle.
+template <typename EncodeChunk>
+uint32_t Base64Encode32Chunks(const uint8_t * in, uint32_t inLen, char * out, EncodeChunk encodeChunk)
+{
+    uint32_t outLen = 0;
+
+    // Maximum number of input bytes to convert to base-64 in a single call to Base64Encode.
+    // Number is the largest multiple of 3 bytes where the resulting number of base-64 characters
+    // fits within a uint16_t.
+    enum
+    {
+        kMaxConvert = (UINT16_MAX / 4) * 3
+    };
+
+    while (true)
+    {
+        uint16_t inChunkLen = (inLen > kMaxConvert) ? static_cast<uint16_t>(kMaxConvert) : static_cast<uint16_t>(inLen);
+
+        uint16_t outChunkLen = encodeChunk(in, inChunkLen, out);
+
+        inLen -= inChunkLen;
+        outLen += outChunkLen;
+
+        if (inLen == 0)
+            break;
+
+        in += inChunkLen;
+        out += outChunkLen;
+    }
+
+    return outLen;
+}
+
+// Decode with 32-bit lengths by splitting the input in chunks that decodeChunk can handle.
+template <typename DecodeChunk>
+uint32_t Base64Decode32Chunks(const char * in, uint32_t inLen, uint8_t * out, DecodeChunk decodeChunk)
+{
+    uint32_t outLen = 0;
+
+    // Maximum number of base-64 characters to convert in a single call to Base64Decode.
+    // Number is the largest multiple of 4 characters that fits in a uint16_t.
+    enum
+    {
+        kMaxConvert = (UINT16_MAX / 4) * 4
+    };
+
+    while (true)
+    {
+        uint16_t inChunkLen = (inLen > kMaxConvert) ? static_cast<uint16_t>(kMaxConvert) : static_cast<uint16_t>(inLen);
+
+        uint16_t outChunkLen = decodeChunk(in, inChunkLen, out);
+        if (outChunkLen == UINT16_MAX)
+            return UINT32_MAX;
+
+        inLen -= inChunkLen;
+        outLen += outChunkLen;
+
+        if (inLen == 0)
+            break;
+
+        in += inChunkLen;
+        out += outChunkLen;
+    }
+
+    return outLen;
+}
+
+} // namespace
+
 uint16_t Base64Encode(const uint8_t * in, uint16_t inLen, char * out, Base64ValToCharFunct valToCharFunct)
 {
     char * outStart = out;
@@ -153,48 +366,26 @@ uint16_t Base64Encode(const uint8_t * in, uint16_t inLen, char * out, Base64ValT
 
 uint16_t Base64Encode(const uint8_t * in, uint16_t inLen, char * out)
 {
-    return Base64Encode(in, inLen, out, Base64ValToChar);
+    return Base64EncodeWithTable(in, inLen, out, kBase64Alphabet);
 }
 
 uint16_t Base64URLEncode(const uint8_t * in, uint16_t inLen, char * out)
 {
-    return Base64Encode(in, inLen, out, Base64URLValToChar);
+    return Base64EncodeWithTable(in, inLen, out, kBase64URLAlphabet);
 }
 
 uint32_t Base64Encode32(const uint8_t * in, uint32_t inLen, char * out, Base64ValToCharFunct valToCharFunct)
 {
-    uint32_t outLen = 0;
-
-    // Maximum number of input bytes to convert to base-64 in a single call to Base64Encode.
-    // Number is the largest multiple of 3 bytes where the resulting number of base-64 characters
-    // fits within a uint16_t.
-    enum
-    {
-        kMaxConvert = (UINT16_MAX / 4) * 3
-    };
-
-    while (true)
-    {
-        uint16_t inChunkLen = (inLen > kMaxConvert) ? static_cast<uint16_t>(kMaxConvert) : static_cast<uint16_t>(inLen);
-
-        uint16_t outChunkLen = Base64Encode(in, inChunkLen, out, valToCharFunct);
-
-        inLen -= inChunkLen;
-        outLen += outChunkLen;
-
-        if (inLen == 0)
-            break;
-
-        in += inChunkLen;
-        out += outChunkLen;
-    }
-
-    return outLen;
+    return Base64Encode32Chunks(in, inLen, out, [valToCharFunct](const uint8_t * chunk, uint16_t chunkLen, char * chunkOut) {
+        return Base64Encode(chunk, chunkLen, chunkOut, valToCharFunct);
+    });
 }
 
 uint32_t Base64Encode32(const uint8_t * in, uint32_t inLen, char * out)
 {
-    return Base64Encode32(in, inLen, out, Base64ValToChar);
+    return Base64Encode32Chunks(in, inLen, out, [](const uint8_t * chunk, uint16_t chunkLen, char * chunkOut) {
+        return Base64EncodeWithTable(chunk, chunkLen, chunkOut, kBase64Alphabet);
+    });
 }
 
 uint16_t Base64Decode(const char * in, uint16_t inLen, uint8_t * out, Base64CharToValFunct charToValFunct)
@@ -247,49 +438,26 @@ fail:
 
 uint16_t Base64Decode(const char * in, uint16_t inLen, uint8_t * out)
 {
-    return Base64Decode(in, inLen, out, Base64CharToVal);
+    return Base64DecodeWithTable(in, inLen, out, kBase64Alphabet, Base64CharToVal);
 }
 
 uint16_t Base64URLDecode(const char * in, uint16_t inLen, uint8_t * out)
 {
-    return Base64Decode(in, inLen, out, Base64URLCharToVal);
+    return Base64DecodeWithTable(in, inLen, out, kBase64URLAlphabet, Base64URLCharToVal);
 }
 
 uint32_t Base64Decode32(const char * in, uint32_t inLen, uint8_t * out, Base64CharToValFunct charToValFunct)
 {
-    uint32_t outLen = 0;
-
-    // Maximum number of base-64 characters to convert in a single call to Base64Decode.
-    // Number is the largest multiple of 4 characters that fits in a uint16_t.
-    enum
-    {
-        kMaxConvert = (UINT16_MAX / 4) * 4
-    };
-
-    while (true)
-    {
-        uint16_t inChunkLen = (inLen > kMaxConvert) ? static_cast<uint16_t>(kMaxConvert) : static_cast<uint16_t>(inLen);
-
-        uint16_t outChunkLen = Base64Decode(in, inChunkLen, out, charToValFunct);
-        if (outChunkLen == UINT16_MAX)
-            return UINT32_MAX;
-
-        inLen -= inChunkLen;
-        outLen += outChunkLen;
-
-        if (inLen == 0)
-            break;
-
-        in += inChunkLen;
-        out += outChunkLen;
-    }
-
-    return outLen;
+    return Base64Decode32Chunks(in, inLen, out, [charToValFunct](const char * chunk, uint16_t chunkLen, uint8_t * chunkOut) {
+        return Base64Decode(chunk, chunkLen, chunkOut, charToValFunct);
+    });
 }
 
 uint32_t Base64Decode32(const char * in, uint32_t inLen, uint8_t * out)
 {
-    return Base64Decode32(in, inLen, out, Base64CharToVal);
+    return Base64Decode32Chunks(in, inLen, out, [](const char * chunk, uint16_t chunkLen, uint8_t * chunkOut) {
+        return Base64DecodeWithTable(chunk, chunkLen, chunkOut, kBase64Alphabet, Base64CharToVal);
+    });
 }
 
 } // namespace chip
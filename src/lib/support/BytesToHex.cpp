@@ -18,6 +18,7 @@
 #include "BytesToHex.h"
 #include <lib/core/CHIPEncoding.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/Simd.h>
 
 #include <cstring>
 #include <stdio.h>
@@ -26,16 +27,56 @@ namespace Encoding {
 
 namespace {
 
-char NibbleToHex(uint8_t nibble, bool uppercase)
+constexpr char kLowercaseHexDigits[] = "0123456789abcdef";
+constexpr char kUppercaseHexDigits[] = "0123456789ABCDEF";
+
+/// Converts the leading whole vectors of src_bytes to hex and returns the number of bytes converted.
+size_t BytesToHexVectors(const uint8_t * src_bytes, size_t src_size, char * dest_hex, bool uppercase)
 {
-    char x = static_cast<char>(nibble & 0xFu);
+    size_t converted = 0;
+
+#if CHIP_SIMD_SSE2
+    // digit = nibble + '0', plus the distance from '9' + 1 to the first letter for nibbles above 9
+    const __m128i lowNibble    = _mm_set1_epi8(0x0F);
+    const __m128i nine         = _mm_set1_epi8(9);
+    const __m128i zero         = _mm_set1_epi8('0');
+    const __m128i letterOffset = _mm_set1_epi8(static_cast<char>((uppercase ? 'A' : 'a') - '0' - 10));
+
+    auto toDigits = [&](__m128i nibbles) {
+        return _mm_add_epi8(_mm_add_epi8(nibbles, zero), _mm_and_si128(_mm_cmpgt_epi8(nibbles, nine), letterOffset));
+    };
+
+    for (; converted + Simd::kVectorSize <= src_size; converted += Simd::kVectorSize)
+    {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src_bytes + converted));
+        const __m128i high  = toDigits(_mm_and_si128(_mm_srli_epi16(bytes, 4), lowNibble));
+        const __m128i low   = toDigits(_mm_and_si128(bytes, lowNibble));
+
+        __m128i * out = reinterpret_cast<__m128i *>(dest_hex + 2 * converted);
+        _mm_storeu_si128(out, _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi8(high, low));
+    }
+#elif CHIP_SIMD_NEON
+    const uint8x16_t digits    = vld1q_u8(reinterpret_cast<const uint8_t *>(uppercase ? kUppercaseHexDigits : kLowercaseHexDigits));
+    const uint8x16_t lowNibble = vdupq_n_u8(0x0F);
 
-    if (x >= 10)
+    for (; converted + Simd::kVectorSize <= src_size; converted += Simd::kVectorSize)
     {
-        return static_cast<char>((x - 10) + (uppercase ? 'A' : 'a'));
+        const uint8x16_t bytes = vld1q_u8(src_bytes + converted);
+        uint8x16x2_t hex;
+        hex.val[0] = vqtbl1q_u8(digits, vshrq_n_u8(bytes, 4));
+        hex.val[1] = vqtbl1q_u8(digits, vandq_u8(bytes, lowNibble));
+        // Interleaves the high and low digits of each byte
+        vst2q_u8(reinterpret_cast<uint8_t *>(dest_hex + 2 * converted), hex);
     }
+#else
+    IgnoreUnusedVariable(src_bytes);
+    IgnoreUnusedVariable(src_size);
+    IgnoreUnusedVariable(dest_hex);
+    IgnoreUnusedVariable(uppercase);
+#endif
 
-    return static_cast<char>(x + '0');
+    return converted;
 }
 
 CHIP_ERROR MakeU8FromAsciiHex(const char * src, const size_t srcLen, uint8_t * val, BitFlags<HexFlags> flags)
@@ -123,12 +164,14 @@ CHIP_ERROR BytesToHex(const uint8_t * src_bytes, size_t src_size, char * dest_he
         return CHIP_ERROR_BUFFER_TOO_SMALL;
     }
 
-    bool uppercase = flags.Has(HexFlags::kUppercase);
-    char * cursor  = dest_hex;
-    for (size_t byte_idx = 0; byte_idx < src_size; ++byte_idx)
+    bool uppercase      = flags.Has(HexFlags::kUppercase);
+    const char * digits = uppercase ? kUppercaseHexDigits : kLowercaseHexDigits;
+    size_t byte_idx     = BytesToHexVectors(src_bytes, src_size, dest_hex, uppercase);
+    char * cursor       = dest_hex + 2 * byte_idx;
+    for (; byte_idx < src_size; ++byte_idx)
     {
-        *cursor++ = NibbleToHex((src_bytes[byte_idx] >> 4) & 0xFu, uppercase);
-        *cursor++ = NibbleToHex((src_bytes[byte_idx] >> 0) & 0xFu, uppercase);
+        *cursor++ = digits[(src_bytes[byte_idx] >> 4) & 0xFu];
+        *cursor++ = digits[(src_bytes[byte_idx] >> 0) & 0xFu];
     }
 
     if (nul_terminate)
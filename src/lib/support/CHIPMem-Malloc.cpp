@@ -29,6 +29,14 @@
 
 #include <stdlib.h>
 
+#if CHIP_CONFIG_MEMORY_TAGGING
+#include <lib/support/TypeTraits.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#endif // CHIP_CONFIG_MEMORY_TAGGING
+
 #ifndef NDEBUG
 #include <atomic>
 #include <cstdio>
@@ -68,6 +76,95 @@ static void VerifyInitialized(const char * func)
 
 #endif
 
+#if CHIP_CONFIG_MEMORY_TAGGING
+
+namespace {
+
+// Prefixes every allocation, so that frees can be accounted to the tag of the allocation
+struct alignas(std::max_align_t) AllocationHeader
+{
+    size_t size;
+    MemoryTag tag;
+};
+
+struct TagCounters
+{
+    std::atomic<size_t> liveBytes{ 0 };
+    std::atomic<size_t> peakBytes{ 0 };
+    std::atomic<uint32_t> allocations{ 0 };
+};
+
+TagCounters sTagCounters[to_underlying(MemoryTag::kCount)];
+thread_local MemoryTag sCurrentTag = MemoryTag::kUntagged;
+
+void AccountAllocation(MemoryTag tag, size_t size)
+{
+    TagCounters & counters = sTagCounters[to_underlying(tag)];
+    const size_t live      = counters.liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+
+    size_t peak = counters.peakBytes.load(std::memory_order_relaxed);
+    while (peak < live && !counters.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+    {
+    }
+    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AccountFree(MemoryTag tag, size_t size)
+{
+    sTagCounters[to_underlying(tag)].liveBytes.fetch_sub(size, std::memory_order_relaxed);
+}
+
+AllocationHeader * HeaderOf(void * p)
+{
+    return static_cast<AllocationHeader *>(p) - 1;
+}
+
+void * TagAllocation(void * block, size_t size)
+{
+    if (block == nullptr)
+    {
+        return nullptr;
+    }
+
+    AllocationHeader * header = static_cast<AllocationHeader *>(block);
+    header->size              = size;
+    header->tag               = sCurrentTag;
+    AccountAllocation(header->tag, size);
+    return header + 1;
+}
+
+} // namespace
+
+MemoryTagStatistics GetMemoryTagStatistics(MemoryTag tag)
+{
+    const TagCounters & counters = sTagCounters[to_underlying(tag)];
+    return MemoryTagStatistics{ counters.liveBytes.load(std::memory_order_relaxed),
+                                counters.peakBytes.load(std::memory_order_relaxed),
+                                counters.allocations.load(std::memory_order_relaxed) };
+}
+
+void ResetMemoryTagPeaks()
+{
+    for (TagCounters & counters : sTagCounters)
+    {
+        counters.peakBytes.store(counters.liveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+MemoryTag GetCurrentMemoryTag()
+{
+    return sCurrentTag;
+}
+
+MemoryTag SetCurrentMemoryTag(MemoryTag tag)
+{
+    MemoryTag previous = sCurrentTag;
+    sCurrentTag        = tag;
+    return previous;
+}
+
+#endif // CHIP_CONFIG_MEMORY_TAGGING
+
 CHIP_ERROR MemoryAllocatorInit(void * buf, size_t bufSize)
 {
     // Logging can use Memory::Alloc, so we can't use logging with our
@@ -93,32 +190,95 @@ void MemoryAllocatorShutdown()
 void * MemoryAlloc(size_t size)
 {
     VERIFY_INITIALIZED();
+#if CHIP_CONFIG_MEMORY_TAGGING
+    if (size > SIZE_MAX - sizeof(AllocationHeader))
+    {
+        return nullptr;
+    }
+    return TagAllocation(malloc(sizeof(AllocationHeader) + size), size);
+#else
     return malloc(size);
+#endif // CHIP_CONFIG_MEMORY_TAGGING
 }
 
 void * MemoryCalloc(size_t num, size_t size)
 {
     VERIFY_INITIALIZED();
+#if CHIP_CONFIG_MEMORY_TAGGING
+    if (size != 0 && num > (SIZE_MAX - sizeof(AllocationHeader)) / size)
+    {
+        return nullptr;
+    }
+    return TagAllocation(calloc(1, sizeof(AllocationHeader) + num * size), num * size);
+#else
     return calloc(num, size);
+#endif // CHIP_CONFIG_MEMORY_TAGGING
 }
 
 void * MemoryRealloc(void * p, size_t size)
 {
     VERIFY_INITIALIZED();
     VERIFY_POINTER(p);
+#if CHIP_CONFIG_MEMORY_TAGGING
+    if (p == nullptr)
+    {
+        return MemoryAlloc(size);
+    }
+    if (size > SIZE_MAX - sizeof(AllocationHeader))
+    {
+        return nullptr;
+    }
+
+    AllocationHeader * header = HeaderOf(p);
+    const size_t oldSize      = header->size;
+    const MemoryTag tag       = header->tag;
+
+    header = static_cast<AllocationHeader *>(realloc(header, sizeof(AllocationHeader) + size));
+    if (header == nullptr)
+    {
+        return nullptr;
+    }
+
+    // The reallocated block stays with its original owner
+    header->size = size;
+    AccountFree(tag, oldSize);
+    AccountAllocation(tag, size);
+    return header + 1;
+#else
     return realloc(p, size);
+#endif // CHIP_CONFIG_MEMORY_TAGGING
 }
 
 void MemoryFree(void * p)
 {
     VERIFY_INITIALIZED();
     VERIFY_POINTER(p);
+#if CHIP_CONFIG_MEMORY_TAGGING
+    if (p == nullptr)
+    {
+        return;
+    }
+
+    AllocationHeader * header = HeaderOf(p);
+    AccountFree(header->tag, header->size);
+    free(header);
+#else
     free(p);
+#endif // CHIP_CONFIG_MEMORY_TAGGING
 }
 
 bool MemoryInternalCheckPointer(const void * p, size_t min_size)
 {
 #if CHIP_CONFIG_MEMORY_DEBUG_DMALLOC
+#if CHIP_CONFIG_MEMORY_TAGGING
+    // dmalloc knows of the blocks including their header
+    if (p == nullptr)
+    {
+        return false;
+    }
+    p = static_cast<const AllocationHeader *>(p) - 1;
+    min_size += sizeof(AllocationHeader);
+#endif // CHIP_CONFIG_MEMORY_TAGGING
     return CanCastTo<int>(min_size) && (p != nullptr) &&
         (dmalloc_verify_pnt(__FILE__, __LINE__, __func__, p, 1, static_cast<int>(min_size)) == MALLOC_VERIFY_NOERROR);
 #else  // CHIP_CONFIG_MEMORY_DEBUG_DMALLOC
@@ -54,6 +54,28 @@ CHIP_ERROR MemoryInit(void * buf, size_t bufSize)
     return err;
 }
 
+const char * MemoryTagName(MemoryTag tag)
+{
+    switch (tag)
+    {
+    case MemoryTag::kUntagged:
+        return "untagged";
+    case MemoryTag::kInteractionModel:
+        return "im";
+    case MemoryTag::kTransport:
+        return "transport";
+    case MemoryTag::kDnssd:
+        return "dnssd";
+    case MemoryTag::kCredentials:
+        return "credentials";
+    case MemoryTag::kController:
+        return "controller";
+    case MemoryTag::kCount:
+        break;
+    }
+    return "unknown";
+}
+
 void MemoryShutdown()
 {
     if ((memoryInitializationCount > 0) && (--memoryInitializationCount == 0))
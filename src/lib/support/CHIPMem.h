@@ -25,6 +25,7 @@
 #pragma once
 
 #include <lib/core/CHIPError.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 #include <memory>
@@ -234,5 +235,83 @@ inline bool MemoryDebugCheckPointer(const void * p, size_t min_size = 0)
 #endif // CHIP_CONFIG_MEMORY_DEBUG_CHECKS
 }
 
+/**
+ * Subsystems that the memory allocations may be accounted to, see #CHIP_CONFIG_MEMORY_TAGGING.
+ */
+enum class MemoryTag : uint8_t
+{
+    kUntagged,
+    kInteractionModel,
+    kTransport,
+    kDnssd,
+    kCredentials,
+    kController,
+
+    kCount
+};
+
+/**
+ * Memory usage of the allocations made under a MemoryTag.
+ */
+struct MemoryTagStatistics
+{
+    size_t liveBytes;     ///< Bytes currently allocated, excluding the allocator overhead.
+    size_t peakBytes;     ///< Highest value of liveBytes so far.
+    uint32_t allocations; ///< Number of successful allocations and reallocations so far.
+};
+
+/**
+ * Returns a short lower-case name of the tag, usable in metric keys.
+ */
+const char * MemoryTagName(MemoryTag tag);
+
+#if CHIP_CONFIG_MEMORY_TAGGING
+
+/**
+ * The memory usage of @p tag. Allocations keep the tag that was current when they were first made,
+ * including across MemoryRealloc.
+ */
+MemoryTagStatistics GetMemoryTagStatistics(MemoryTag tag);
+
+/**
+ * Resets the peak bytes of every tag to their live bytes.
+ */
+void ResetMemoryTagPeaks();
+
+/**
+ * The tag of the allocations made by the current thread.
+ */
+MemoryTag GetCurrentMemoryTag();
+
+/**
+ * Sets the tag of the allocations made by the current thread and returns the previous one.
+ */
+MemoryTag SetCurrentMemoryTag(MemoryTag tag);
+
+/**
+ * Accounts the allocations made by the current thread in its scope to a tag, restoring the previous one
+ * when it ends. Scopes nest, so that the innermost subsystem gets the allocations.
+ */
+class ScopedMemoryTag
+{
+public:
+    explicit ScopedMemoryTag(MemoryTag tag) : mPrevious(SetCurrentMemoryTag(tag)) {}
+    ~ScopedMemoryTag() { SetCurrentMemoryTag(mPrevious); }
+
+    ScopedMemoryTag(const ScopedMemoryTag &)             = delete;
+    ScopedMemoryTag & operator=(const ScopedMemoryTag &) = delete;
+
+private:
+    MemoryTag mPrevious;
+};
+
+#define CHIP_MEMORY_TAG_SCOPE(tag) ::chip::Platform::ScopedMemoryTag _chipMemoryTagScope(::chip::Platform::MemoryTag::tag)
+
+#else // CHIP_CONFIG_MEMORY_TAGGING
+
+#define CHIP_MEMORY_TAG_SCOPE(tag)
+
+#endif // CHIP_CONFIG_MEMORY_TAGGING
+
 } // namespace Platform
 } // namespace chip
@@ -101,6 +101,7 @@ public:
     static StorageKeyName FabricRCAC(FabricIndex fabric) { return StorageKeyName::Formatted("f/%x/r", fabric); }
     static StorageKeyName FabricMetadata(FabricIndex fabric) { return StorageKeyName::Formatted("f/%x/m", fabric); }
     static StorageKeyName FabricOpKey(FabricIndex fabric) { return StorageKeyName::Formatted("f/%x/o", fabric); }
+    static StorageKeyName FabricIdentity(FabricIndex fabric) { return StorageKeyName::Formatted("f/%x/id", fabric); }
 
     // Fail-safe handling
     static StorageKeyName FailSafeCommitMarkerKey() { return StorageKeyName::FromConst("g/fs/c"); }
@@ -122,6 +123,15 @@ public:
         return StorageKeyName::Formatted("g/s/%s", resumptionIdBase64);
     }
 
+    // PASE verifier cache
+    static StorageKeyName PASEVerifierCacheEntry(size_t index)
+    {
+        return StorageKeyName::Formatted("g/pvc/%x", static_cast<unsigned>(index));
+    }
+
+    // Operational addresses of peers, kept by the address resolver
+    static StorageKeyName OperationalAddressCache() { return StorageKeyName::FromConst("g/oac"); }
+
     // Access Control
     static StorageKeyName AccessControlAclEntry(FabricIndex fabric, size_t index)
     {
@@ -209,10 +219,18 @@ public:
     static StorageKeyName OTAUpdateToken() { return StorageKeyName::FromConst("g/o/ut"); }
     static StorageKeyName OTACurrentUpdateState() { return StorageKeyName::FromConst("g/o/us"); }
     static StorageKeyName OTATargetVersion() { return StorageKeyName::FromConst("g/o/tv"); }
+    static StorageKeyName OTADownloadCheckpoint() { return StorageKeyName::FromConst("g/o/dc"); }
 
     // Event number counter.
     static StorageKeyName IMEventNumber() { return StorageKeyName::FromConst("g/im/ec"); }
 
+    // Persistent event log
+    static StorageKeyName PersistentEventLogIndex() { return StorageKeyName::FromConst("g/im/el/i"); }
+    static StorageKeyName PersistentEventLogSegment(size_t index)
+    {
+        return StorageKeyName::Formatted("g/im/el/s/%x", static_cast<unsigned>(index));
+    }
+
     // Subscription resumption
     static StorageKeyName SubscriptionResumption(size_t index)
     {
@@ -256,6 +274,14 @@ public:
     // when new fabric is created, this list needs to be updated,
     // when client init DefaultICDClientStorage, this table needs to be loaded.
     static StorageKeyName ICDFabricList() { return StorageKeyName::FromConst("g/icdfl"); }
+
+    // ClusterStateCacheSnapshot is only used by ClusterStateCache
+    // Stores the cached cluster state of a node, to resubscribe with DataVersionFilters after a controller restart.
+    static StorageKeyName ClusterStateCacheSnapshot(FabricIndex fabric, NodeId nodeId)
+    {
+        return StorageKeyName::Formatted("f/%x/csc/%08" PRIX32 "%08" PRIX32, fabric, static_cast<uint32_t>(nodeId >> 32),
+                                         static_cast<uint32_t>(nodeId));
+    }
 };
 
 } // namespace chip
@@ -42,6 +42,9 @@ public:
 
     void operator()() const { mLambdaProxy(mLambdaBody); }
 
+    // Identifies the type of the lambda, e.g. when profiling.
+    const void * GetFunction() const { return reinterpret_cast<const void *>(mLambdaProxy); }
+
 private:
     using LambdaStorage = std::aligned_storage_t<CHIP_CONFIG_LAMBDA_EVENT_SIZE, CHIP_CONFIG_LAMBDA_EVENT_ALIGN>;
     void (*mLambdaProxy)(const LambdaStorage & body);
@@ -0,0 +1,171 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  @file
+ *    A bounded queue which any number of threads can stage values into without taking a lock, drained in batches by
+ *    one consumer thread, e.g. the Matter thread.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+
+namespace chip {
+
+/**
+ * Bounded multi-producer, single-consumer queue of N values of type T.
+ *
+ * Each cell carries a sequence number: a producer claims an enqueue position with a CAS once the cell for it has been
+ * released by the consumer, fills the cell in place, and publishes it by advancing its sequence number. The sequence
+ * numbers are stored relative to the index of their cell, so that a zero-initialized ring is empty: a ring with static
+ * storage duration is then usable before any constructor runs, from any thread.
+ *
+ * Pushes also coalesce the wake-ups of the consumer: only the first push after the consumer found the ring empty asks
+ * its caller to wake the consumer, which keeps draining until then anyway.
+ */
+template <typename T, size_t N>
+class LockFreeStagingRing
+{
+public:
+    static_assert(N > 0, "The ring must hold at least one value");
+    static_assert(std::is_trivially_copyable<T>::value, "Values are filled in place and copied out of the ring");
+
+    constexpr LockFreeStagingRing() = default;
+
+    /**
+     * Stage a value. May be called from any thread.
+     *
+     * @param[in]  fill       Called with the claimed cell. Once it returns, the value is published: if it returns an
+     *                        error, the value is skipped by the consumer.
+     * @param[out] needsWake  Whether the caller must wake the consumer up, e.g. by scheduling the drain.
+     *
+     * @retval CHIP_ERROR_NO_MEMORY if the ring is full.
+     * @retval the error returned by fill otherwise.
+     */
+    template <typename Filler>
+    CHIP_ERROR Push(Filler && fill, bool & needsWake)
+    {
+        needsWake  = false;
+        size_t pos = mEnqueuePos.load(std::memory_order_relaxed);
+        Cell * cell;
+
+        for (;;)
+        {
+            cell                = &mCells[pos % N];
+            const size_t seq    = cell->mSequence.load(std::memory_order_acquire) + pos % N;
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+            if (diff == 0)
+            {
+                if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // The consumer has not released this cell from the previous lap yet: the ring is full.
+                return CHIP_ERROR_NO_MEMORY;
+            }
+            else
+            {
+                pos = mEnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        CHIP_ERROR err = fill(cell->mValue);
+        cell->mValid   = (err == CHIP_NO_ERROR);
+        cell->mSequence.store(pos + 1 - pos % N, std::memory_order_release);
+
+        // This must come after the value is published: the consumer re-checks the ring after clearing the flag.
+        needsWake = !mWakePending.exchange(true);
+        return err;
+    }
+
+    /**
+     * Hand every staged value to visit, in order. Must only be called from the consumer thread.
+     *
+     * Values staged while draining are drained too. Once the ring is found empty, the next push asks for a wake-up again.
+     */
+    template <typename Visitor>
+    void Drain(Visitor && visit)
+    {
+        DrainPublished(visit);
+
+        // The ring looked empty: re-arm the wake-up, then look again to pick up any value whose producer saw the
+        // wake-up still pending and so did not ask for one.
+        mWakePending.store(false);
+        DrainPublished(visit);
+    }
+
+    /**
+     * Re-arm the wake-up, for a consumer which failed to schedule the drain it was asked for. Values already staged are
+     * drained when the next push wakes the consumer.
+     */
+    void CancelWake() { mWakePending.store(false); }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> mSequence{ 0 };
+        bool mValid = false;
+        T mValue    = {};
+    };
+
+    template <typename Visitor>
+    void DrainPublished(Visitor & visit)
+    {
+        for (;;)
+        {
+            Cell & cell = mCells[mDequeuePos % N];
+
+            // A claimed cell whose producer has not published it yet also reads as empty, and holds back the cells behind
+            // it; that producer's own push asks for a wake-up if needed.
+            if (cell.mSequence.load(std::memory_order_acquire) + mDequeuePos % N != mDequeuePos + 1)
+            {
+                return;
+            }
+
+            const bool valid = cell.mValid;
+            T value          = cell.mValue;
+            cell.mSequence.store(mDequeuePos + N - mDequeuePos % N, std::memory_order_release);
+            mDequeuePos++;
+
+            if (valid)
+            {
+                visit(value);
+            }
+        }
+    }
+
+    Cell mCells[N];
+    std::atomic<size_t> mEnqueuePos{ 0 };
+    size_t mDequeuePos = 0; // Only touched by the consumer.
+    std::atomic<bool> mWakePending{ false };
+
+    LockFreeStagingRing(const LockFreeStagingRing &)             = delete;
+    LockFreeStagingRing & operator=(const LockFreeStagingRing &) = delete;
+};
+
+} // namespace chip
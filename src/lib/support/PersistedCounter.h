@@ -56,6 +56,8 @@ namespace chip {
  *   - Output: 200, 201, 202, ...., 299, 300, 301, 302 <reboot/reinit>
  *   - Output: 400, 401 ...
  *
+ * A counter advancing quickly can let the epoch grow, see SetMaxEpoch, so it is persisted less often.
+ *
  */
 template <typename T>
 class PersistedCounter : public MonotonicallyIncreasingCounter<T>
@@ -111,6 +113,18 @@ public:
         return MonotonicallyIncreasingCounter<T>::Init(startValue);
     }
 
+    /**
+     *  @brief
+     *    Let the epoch grow, up to aMaxEpoch, while the counter advances quickly.
+     *
+     *  Each time the counter exhausts an epoch, the next one is twice as large, so a counter advanced often within a boot
+     *  writes to storage less and less often. The epoch is back to the one given to Init on the next boot, the values
+     *  skipped on a reboot being at most aMaxEpoch.
+     *
+     *  @param[in] aMaxEpoch  Largest epoch, no larger than the one given to Init to keep the epoch fixed.
+     */
+    void SetMaxEpoch(T aMaxEpoch) { mMaxEpoch = aMaxEpoch; }
+
     /**
      *  @brief Increment the counter by N and write to persisted storage if we've completed the current epoch.
      *
@@ -170,6 +184,12 @@ public:
 private:
     CHIP_ERROR PersistAndVerifyNextEpochStart(T refEpoch)
     {
+        // The previous epoch was exhausted within this boot: make the next one larger.
+        if (mEpoch < mMaxEpoch)
+        {
+            mEpoch = (mEpoch > mMaxEpoch / 2) ? mMaxEpoch : static_cast<T>(mEpoch * 2);
+        }
+
         // Value advanced past the previously persisted "start point".
         // Ensure that a new starting point is persisted.
         ReturnErrorOnFailure(PersistNextEpochStart(static_cast<T>(refEpoch + mEpoch)));
@@ -279,6 +299,7 @@ private:
     PersistentStorageDelegate * mStorage = nullptr; // start value is stored here
     StorageKeyName mKey;
     T mEpoch     = 0; // epoch modulus value
+    T mMaxEpoch  = 0; // largest epoch the counter may grow to
     T mNextEpoch = 0; // next epoch start
 };
 
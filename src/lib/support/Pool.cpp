@@ -20,6 +20,8 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/Pool.h>
 
+#include <algorithm>
+
 namespace chip {
 
 #if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
@@ -51,35 +53,55 @@ void HeapObjectPoolExitHandling::ExitHandler()
 
 namespace internal {
 
+namespace {
+
+/// Index of the lowest bit set in a non-zero word
+inline size_t LowestSetBit(unsigned long value)
+{
+    return static_cast<size_t>(__builtin_ctzl(value));
+}
+
+} // namespace
+
 StaticAllocatorBitmap::StaticAllocatorBitmap(void * storage, std::atomic<tBitChunkType> * usage, size_t capacity,
                                              size_t elementSize) :
     StaticAllocatorBase(capacity),
-    mElements(storage), mElementSize(elementSize), mUsage(usage)
+    mElements(storage), mElementSize(elementSize), mUsage(usage), mWordCount((capacity + kBitChunkSize - 1) / kBitChunkSize)
 {
-    for (size_t word = 0; word * kBitChunkSize < Capacity(); ++word)
+    for (size_t word = 0; word < mWordCount; ++word)
     {
         mUsage[word].store(0);
     }
 }
 
+StaticAllocatorBitmap::tBitChunkType StaticAllocatorBitmap::ValidBits(size_t word) const
+{
+    const size_t bits = Capacity() - word * kBitChunkSize;
+    return bits >= kBitChunkSize ? ~tBitChunkType(0) : (kBit1 << bits) - 1;
+}
+
 void * StaticAllocatorBitmap::Allocate()
 {
-    for (size_t word = 0; word * kBitChunkSize < Capacity(); ++word)
+    // Start from the word of the last freed slot, which is likely to have room
+    const size_t hint = mFreeWordHint.load(std::memory_order_relaxed);
+
+    for (size_t i = 0; i < mWordCount; ++i)
     {
-        auto & usage = mUsage[word];
-        auto value   = usage.load(std::memory_order_relaxed);
-        for (size_t offset = 0; offset < kBitChunkSize && offset + word * kBitChunkSize < Capacity(); ++offset)
+        const size_t word  = (hint + i) % mWordCount;
+        auto & usage       = mUsage[word];
+        auto value         = usage.load(std::memory_order_relaxed);
+        tBitChunkType free = ~value & ValidBits(word);
+
+        while (free != 0)
         {
-            if ((value & (kBit1 << offset)) == 0)
+            const size_t offset = LowestSetBit(free);
+            // On failure, value is updated with the current usage of the word
+            if (usage.compare_exchange_weak(value, value | (kBit1 << offset)))
             {
-                if (usage.compare_exchange_strong(value, value | (kBit1 << offset)))
-                {
-                    IncreaseUsage();
-                    return At(word * kBitChunkSize + offset);
-                }
-
-                value = usage.load(std::memory_order_relaxed); // if there is a race, update new usage
+                IncreaseUsage();
+                return At(word * kBitChunkSize + offset);
             }
+            free = ~value & ValidBits(word);
         }
     }
     return nullptr;
@@ -96,6 +118,7 @@ void StaticAllocatorBitmap::Deallocate(void * element)
 
     auto value = mUsage[word].fetch_and(~(kBit1 << offset));
     VerifyOrDie((value & (kBit1 << offset)) != 0); // assert fail when free an unused slot
+    mFreeWordHint.store(word, std::memory_order_relaxed);
     DecreaseUsage();
 }
 
@@ -111,17 +134,13 @@ size_t StaticAllocatorBitmap::IndexOf(void * element)
 
 Loop StaticAllocatorBitmap::ForEachActiveObjectInner(void * context, Lambda lambda)
 {
-    for (size_t word = 0; word * kBitChunkSize < Capacity(); ++word)
+    for (size_t word = 0; word < mWordCount; ++word)
     {
-        auto & usage = mUsage[word];
-        auto value   = usage.load(std::memory_order_relaxed);
-        for (size_t offset = 0; offset < kBitChunkSize && offset + word * kBitChunkSize < Capacity(); ++offset)
+        // Visit the set bits only, lowest first, skipping empty words at once
+        for (auto value = mUsage[word].load(std::memory_order_relaxed); value != 0; value &= value - 1)
         {
-            if ((value & (kBit1 << offset)) != 0)
-            {
-                if (lambda(context, At(word * kBitChunkSize + offset)) == Loop::Break)
-                    return Loop::Break;
-            }
+            if (lambda(context, At(word * kBitChunkSize + LowestSetBit(value))) == Loop::Break)
+                return Loop::Break;
         }
     }
     return Loop::Finish;
@@ -129,41 +148,29 @@ Loop StaticAllocatorBitmap::ForEachActiveObjectInner(void * context, Lambda lamb
 
 size_t StaticAllocatorBitmap::FirstActiveIndex()
 {
-    size_t idx = 0;
-    for (size_t word = 0; word * kBitChunkSize < Capacity(); ++word)
-    {
-        auto & usage = mUsage[word];
-        auto value   = usage.load(std::memory_order_relaxed);
-        for (size_t offset = 0; offset < kBitChunkSize && offset + word * kBitChunkSize < Capacity(); ++offset)
-        {
-            if ((value & (kBit1 << offset)) != 0)
-            {
-                return idx;
-            }
-            idx++;
-        }
-    }
-    VerifyOrDie(idx == mCapacity);
-    return mCapacity;
+    return NextActiveIndexFrom(0);
 }
 
 size_t StaticAllocatorBitmap::NextActiveIndexAfter(size_t start)
 {
-    size_t idx = 0;
-    for (size_t word = 0; word * kBitChunkSize < Capacity(); ++word)
+    return start >= mCapacity ? mCapacity : NextActiveIndexFrom(start + 1);
+}
+
+size_t StaticAllocatorBitmap::NextActiveIndexFrom(size_t index)
+{
+    for (size_t word = index / kBitChunkSize; word < mWordCount; ++word)
     {
-        auto & usage = mUsage[word];
-        auto value   = usage.load(std::memory_order_relaxed);
-        for (size_t offset = 0; offset < kBitChunkSize && offset + word * kBitChunkSize < Capacity(); ++offset)
+        auto value = mUsage[word].load(std::memory_order_relaxed);
+        if (word == index / kBitChunkSize)
         {
-            if (((value & (kBit1 << offset)) != 0) && (start < idx))
-            {
-                return idx;
-            }
-            idx++;
+            // Ignore the slots before index
+            value &= ~((kBit1 << (index % kBitChunkSize)) - 1);
+        }
+        if (value != 0)
+        {
+            return word * kBitChunkSize + LowestSetBit(value);
         }
     }
-    VerifyOrDie(idx == mCapacity);
     return mCapacity;
 }
 
@@ -225,6 +232,267 @@ void HeapObjectList::CleanupDeferredReleases()
     mHaveDeferredNodeRemovals = false;
 }
 
+struct SlabAllocator::Slab
+{
+    Slab * next;
+    Slab * prev;
+    Slab * nextAvailable;
+    Slab * prevAvailable;
+    uint64_t usage; // bit i is set when slot i holds an object
+};
+
+namespace {
+
+constexpr size_t kMaxSlotsPerSlab = 64;
+
+constexpr size_t RoundUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// Slot layout: the owning slab, then the element
+size_t SlotAlignment(size_t elementAlignment)
+{
+    return std::max(elementAlignment, alignof(SlabAllocator::Slab *));
+}
+
+size_t ElementOffset(size_t elementAlignment)
+{
+    return RoundUp(sizeof(SlabAllocator::Slab *), elementAlignment);
+}
+
+size_t SlotSize(size_t elementSize, size_t elementAlignment)
+{
+    return RoundUp(ElementOffset(elementAlignment) + elementSize, SlotAlignment(elementAlignment));
+}
+
+size_t ComputeSlotsPerSlab(size_t slotsOffset, size_t slotSize)
+{
+    const size_t room = CHIP_SYSTEM_CONFIG_POOL_SLAB_SIZE > slotsOffset ? CHIP_SYSTEM_CONFIG_POOL_SLAB_SIZE - slotsOffset : 0;
+    return std::min(kMaxSlotsPerSlab, std::max<size_t>(1, room / slotSize));
+}
+
+/// Usage of a slab whose slots are all in use
+uint64_t FullUsage(size_t slotsPerSlab)
+{
+    return slotsPerSlab == kMaxSlotsPerSlab ? ~uint64_t(0) : (uint64_t(1) << slotsPerSlab) - 1;
+}
+
+inline size_t LowestSetBit64(uint64_t value)
+{
+    return static_cast<size_t>(__builtin_ctzll(value));
+}
+
+} // namespace
+
+SlabAllocator::SlabAllocator(size_t elementSize, size_t elementAlignment) :
+    mElementOffset(ElementOffset(elementAlignment)), mSlotSize(SlotSize(elementSize, elementAlignment)),
+    mSlotsOffset(RoundUp(sizeof(Slab), SlotAlignment(elementAlignment))),
+    mSlotsPerSlab(ComputeSlotsPerSlab(mSlotsOffset, mSlotSize))
+{}
+
+SlabAllocator::~SlabAllocator()
+{
+    // Leaked objects, if ignored on exit, remain valid
+    VerifyOrReturn(mAllocated == 0);
+
+    while (mSlabs != nullptr)
+    {
+        Slab * next = mSlabs->next;
+        Platform::MemoryFree(mSlabs);
+        mSlabs = next;
+    }
+}
+
+uint8_t * SlabAllocator::SlotAt(const Slab * slab, size_t index) const
+{
+    return reinterpret_cast<uint8_t *>(const_cast<Slab *>(slab)) + mSlotsOffset + index * mSlotSize;
+}
+
+SlabAllocator::Slab * SlabAllocator::AllocateSlab()
+{
+    Slab * slab = static_cast<Slab *>(Platform::MemoryAlloc(mSlotsOffset + mSlotsPerSlab * mSlotSize));
+    VerifyOrReturnValue(slab != nullptr, nullptr);
+
+    slab->usage         = 0;
+    slab->next          = nullptr;
+    slab->prev          = mLastSlab;
+    slab->prevAvailable = nullptr;
+    slab->nextAvailable = mAvailableSlabs;
+
+    for (size_t i = 0; i < mSlotsPerSlab; i++)
+    {
+        *reinterpret_cast<Slab **>(SlotAt(slab, i)) = slab;
+    }
+
+    if (mLastSlab != nullptr)
+    {
+        mLastSlab->next = slab;
+    }
+    else
+    {
+        mSlabs = slab;
+    }
+    mLastSlab = slab;
+
+    if (mAvailableSlabs != nullptr)
+    {
+        mAvailableSlabs->prevAvailable = slab;
+    }
+    mAvailableSlabs = slab;
+
+    mSlabCount++;
+    return slab;
+}
+
+void SlabAllocator::FreeSlab(Slab * slab)
+{
+    // Only empty slabs are freed, and they are always available
+    (slab->prev != nullptr ? slab->prev->next : mSlabs)   = slab->next;
+    (slab->next != nullptr ? slab->next->prev : mLastSlab) = slab->prev;
+    (slab->prevAvailable != nullptr ? slab->prevAvailable->nextAvailable : mAvailableSlabs) = slab->nextAvailable;
+    if (slab->nextAvailable != nullptr)
+    {
+        slab->nextAvailable->prevAvailable = slab->prevAvailable;
+    }
+
+    Platform::MemoryFree(slab);
+    mSlabCount--;
+}
+
+void * SlabAllocator::Allocate()
+{
+    Slab * slab = mAvailableSlabs != nullptr ? mAvailableSlabs : AllocateSlab();
+    VerifyOrReturnValue(slab != nullptr, nullptr);
+
+    const size_t index = LowestSetBit64(~slab->usage);
+    slab->usage |= uint64_t(1) << index;
+
+    if (slab->usage == FullUsage(mSlotsPerSlab))
+    {
+        // Full: no longer available
+        mAvailableSlabs = slab->nextAvailable;
+        if (mAvailableSlabs != nullptr)
+        {
+            mAvailableSlabs->prevAvailable = nullptr;
+        }
+        slab->nextAvailable = nullptr;
+    }
+
+    IncreaseUsage();
+    return SlotAt(slab, index) + mElementOffset;
+}
+
+void SlabAllocator::Deallocate(void * element)
+{
+    uint8_t * slot = static_cast<uint8_t *>(element) - mElementOffset;
+    Slab * slab    = *reinterpret_cast<Slab **>(slot);
+
+    const std::ptrdiff_t offset = slot - SlotAt(slab, 0);
+    VerifyOrDie(offset >= 0 && static_cast<size_t>(offset) % mSlotSize == 0);
+    const size_t index = static_cast<size_t>(offset) / mSlotSize;
+    VerifyOrDie(index < mSlotsPerSlab);
+
+    const uint64_t bit = uint64_t(1) << index;
+    VerifyOrDie((slab->usage & bit) != 0); // assert fail when free an unused slot
+
+    const bool wasFull = (slab->usage == FullUsage(mSlotsPerSlab));
+    slab->usage &= ~bit;
+    DecreaseUsage();
+
+    if (wasFull)
+    {
+        slab->prevAvailable = nullptr;
+        slab->nextAvailable = mAvailableSlabs;
+        if (mAvailableSlabs != nullptr)
+        {
+            mAvailableSlabs->prevAvailable = slab;
+        }
+        mAvailableSlabs = slab;
+    }
+
+    if (slab->usage == 0)
+    {
+        // Iterators may still point into the slab
+        if (mIterationDepth == 0)
+        {
+            FreeSlab(slab);
+        }
+        else
+        {
+            mHaveDeferredRemoval = true;
+        }
+    }
+}
+
+void SlabAllocator::CleanupDeferredReleases()
+{
+    if (mIterationDepth != 0 || !mHaveDeferredRemoval)
+    {
+        return;
+    }
+
+    for (Slab * slab = mSlabs; slab != nullptr;)
+    {
+        Slab * next = slab->next;
+        if (slab->usage == 0)
+        {
+            FreeSlab(slab);
+        }
+        slab = next;
+    }
+
+    mHaveDeferredRemoval = false;
+}
+
+SlabAllocator::Position SlabAllocator::FirstInUseFrom(Slab * slab, size_t index) const
+{
+    for (; slab != nullptr; slab = slab->next, index = 0)
+    {
+        const uint64_t usage = index < kMaxSlotsPerSlab ? slab->usage & ~((uint64_t(1) << index) - 1) : 0;
+        if (usage != 0)
+        {
+            return Position{ slab, LowestSetBit64(usage) };
+        }
+    }
+    return Position();
+}
+
+SlabAllocator::Position SlabAllocator::First() const
+{
+    return FirstInUseFrom(mSlabs, 0);
+}
+
+SlabAllocator::Position SlabAllocator::NextAfter(Position position) const
+{
+    VerifyOrReturnValue(position.slab != nullptr, Position());
+    return FirstInUseFrom(position.slab, position.index + 1);
+}
+
+void * SlabAllocator::At(Position position) const
+{
+    return SlotAt(position.slab, position.index) + mElementOffset;
+}
+
+Loop SlabAllocator::ForEachActiveObjectInner(void * context, Lambda lambda)
+{
+    BeginIteration();
+    Loop result = Loop::Finish;
+
+    // The usage of the slab is read again after each call, as the lambda may release objects
+    for (Position position = First(); position.slab != nullptr; position = NextAfter(position))
+    {
+        if (lambda(context, At(position)) == Loop::Break)
+        {
+            result = Loop::Break;
+            break;
+        }
+    }
+
+    EndIteration();
+    return result;
+}
+
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
 } // namespace internal
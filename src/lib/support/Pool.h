@@ -45,10 +45,11 @@ namespace internal {
 class Statistics
 {
 public:
-    Statistics() : mAllocated(0), mHighWaterMark(0) {}
+    Statistics() : mAllocated(0), mHighWaterMark(0), mAllocationFailures(0) {}
 
     size_t Allocated() const { return mAllocated; }
     size_t HighWaterMark() const { return mHighWaterMark; }
+    size_t AllocationFailures() const { return mAllocationFailures; }
     void IncreaseUsage()
     {
         if (++mAllocated > mHighWaterMark)
@@ -57,10 +58,12 @@ public:
         }
     }
     void DecreaseUsage() { --mAllocated; }
+    void RecordAllocationFailure() { ++mAllocationFailures; }
 
 protected:
     size_t mAllocated;
     size_t mHighWaterMark;
+    size_t mAllocationFailures;
 };
 
 class StaticAllocatorBase : public Statistics
@@ -113,9 +116,19 @@ protected:
     }
 
 private:
+    /// Returns the first active index at or after `index`, or mCapacity.
+    size_t NextActiveIndexFrom(size_t index);
+
+    /// Mask of the bits of `word` that map to slots of the pool.
+    tBitChunkType ValidBits(size_t word) const;
+
     void * mElements;
     const size_t mElementSize;
     std::atomic<tBitChunkType> * mUsage;
+    const size_t mWordCount;
+
+    /// Word of the last freed slot, where Allocate() starts looking for a free slot.
+    std::atomic<size_t> mFreeWordHint{ 0 };
 
     /// allow accessing direct At() calls
     template <class T>
@@ -183,6 +196,85 @@ struct HeapObjectList : HeapObjectListNode
     bool mHaveDeferredNodeRemovals = false;
 };
 
+/**
+ * Type-erased allocator of SlabObjectPool: objects live in slots of heap-allocated slabs of
+ * CHIP_SYSTEM_CONFIG_POOL_SLAB_SIZE bytes, each with a bitmap of its slots in use.
+ *
+ * Every slot starts with a pointer to its slab, so that releasing an object is O(1). Slabs that
+ * become empty while the pool is being iterated are freed once the outermost iteration completes.
+ */
+class SlabAllocator : public Statistics
+{
+public:
+    struct Slab;
+
+    /// A slot of a slab. The end of the pool has a null slab.
+    struct Position
+    {
+        Slab * slab  = nullptr;
+        size_t index = 0;
+    };
+
+    SlabAllocator(size_t elementSize, size_t elementAlignment);
+    ~SlabAllocator();
+
+    /// Returns the first slot in use, or the end.
+    Position First() const;
+
+    /// Returns the first slot in use after `position`, or the end.
+    Position NextAfter(Position position) const;
+
+    void * At(Position position) const;
+
+    /// Number of objects a slab holds.
+    size_t SlotsPerSlab() const { return mSlotsPerSlab; }
+
+    /// Number of allocated slabs.
+    size_t SlabCount() const { return mSlabCount; }
+
+    using Lambda = Loop (*)(void *, void *);
+    Loop ForEachActiveObjectInner(void * context, Lambda lambda);
+    Loop ForEachActiveObjectInner(void * context, Loop lambda(void * context, const void * object)) const
+    {
+        return const_cast<SlabAllocator *>(this)->ForEachActiveObjectInner(context, reinterpret_cast<Lambda>(lambda));
+    }
+
+    /// While an iteration is in progress, empty slabs are kept, so that the iterated slots remain valid.
+    void BeginIteration() { ++mIterationDepth; }
+    void EndIteration()
+    {
+        --mIterationDepth;
+        CleanupDeferredReleases();
+    }
+
+protected:
+    void * Allocate();
+    void Deallocate(void * element);
+
+private:
+    SlabAllocator(const SlabAllocator &)             = delete;
+    SlabAllocator & operator=(const SlabAllocator &) = delete;
+
+    uint8_t * SlotAt(const Slab * slab, size_t index) const;
+    Position FirstInUseFrom(Slab * slab, size_t index) const;
+    Slab * AllocateSlab();
+    void FreeSlab(Slab * slab);
+    void CleanupDeferredReleases();
+
+    const size_t mElementOffset; // from the start of a slot
+    const size_t mSlotSize;
+    const size_t mSlotsOffset; // from the start of a slab
+    const size_t mSlotsPerSlab;
+
+    Slab * mSlabs          = nullptr; // all slabs, in allocation order
+    Slab * mLastSlab       = nullptr;
+    Slab * mAvailableSlabs = nullptr; // slabs with at least one free slot
+    size_t mSlabCount      = 0;
+
+    size_t mIterationDepth    = 0;
+    bool mHaveDeferredRemoval = false;
+};
+
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
 } // namespace internal
@@ -275,6 +367,7 @@ public:
         T * element = static_cast<T *>(Allocate());
         if (element != nullptr)
             return new (element) T(std::forward<Args>(args)...);
+        RecordAllocationFailure();
         return nullptr;
     }
 
@@ -506,7 +599,9 @@ public:
                 IncreaseUsage();
                 return object;
             }
+            Platform::Delete(object);
         }
+        RecordAllocationFailure();
         return nullptr;
     }
 
@@ -605,6 +700,190 @@ private:
     internal::HeapObjectList mObjects;
 };
 
+/**
+ * A class template used for allocating objects from the heap, in slabs of several objects.
+ *
+ * Compared to HeapObjectPool, objects that are allocated together are close in memory, iteration
+ * walks the slabs in order, and creating or releasing an object does not search any list.
+ *
+ *  @tparam     T   type to be allocated.
+ */
+template <class T>
+class SlabObjectPool : public internal::SlabAllocator, public HeapObjectPoolExitHandling
+{
+public:
+    static_assert(alignof(T) <= alignof(std::max_align_t), "SlabObjectPool does not support over-aligned types");
+
+    SlabObjectPool() : SlabAllocator(sizeof(T), alignof(T)) {}
+    ~SlabObjectPool()
+    {
+#if __SANITIZE_ADDRESS__
+        // Free all remaining objects so that ASAN can catch specific use-after-free cases.
+        ReleaseAll();
+#else  // __SANITIZE_ADDRESS__
+        if (!sIgnoringLeaksOnExit)
+        {
+            // Verify that no live objects remain, to prevent potential use-after-free.
+            VerifyOrDieWithObject(Allocated() == 0, this);
+        }
+#endif // __SANITIZE_ADDRESS__
+    }
+
+    /// Provides iteration over active objects in the pool.
+    ///
+    /// Objects may be released while an iterator is active: their slab is then kept until the last
+    /// active iterator is destroyed.
+    class ActiveObjectIterator
+    {
+    public:
+        using value_type = T;
+        using pointer    = T *;
+        using reference  = T &;
+
+        ActiveObjectIterator() {}
+        ActiveObjectIterator(const ActiveObjectIterator & other) : mPosition(other.mPosition), mAllocator(other.mAllocator)
+        {
+            if (mAllocator != nullptr)
+            {
+                mAllocator->BeginIteration();
+            }
+        }
+
+        ActiveObjectIterator & operator=(const ActiveObjectIterator & other)
+        {
+            if (other.mAllocator != nullptr)
+            {
+                other.mAllocator->BeginIteration();
+            }
+            if (mAllocator != nullptr)
+            {
+                mAllocator->EndIteration();
+            }
+            mPosition  = other.mPosition;
+            mAllocator = other.mAllocator;
+            return *this;
+        }
+
+        ~ActiveObjectIterator()
+        {
+            if (mAllocator != nullptr)
+            {
+                mAllocator->EndIteration();
+            }
+        }
+
+        bool operator==(const ActiveObjectIterator & other) const
+        {
+            // All end iterators compare equal, including default constructed ones
+            return (mPosition.slab == other.mPosition.slab) &&
+                ((mPosition.slab == nullptr) || (mPosition.index == other.mPosition.index));
+        }
+        bool operator!=(const ActiveObjectIterator & other) const { return !(*this == other); }
+        ActiveObjectIterator & operator++()
+        {
+            mPosition = mAllocator->NextAfter(mPosition);
+            return *this;
+        }
+        T * operator*() const { return static_cast<T *>(mAllocator->At(mPosition)); }
+
+    protected:
+        friend class SlabObjectPool<T>;
+
+        explicit ActiveObjectIterator(internal::SlabAllocator::Position position, internal::SlabAllocator * allocator) :
+            mPosition(position), mAllocator(allocator)
+        {
+            mAllocator->BeginIteration();
+        }
+
+    private:
+        internal::SlabAllocator::Position mPosition;
+        internal::SlabAllocator * mAllocator = nullptr;
+    };
+
+    ActiveObjectIterator begin() { return ActiveObjectIterator(First(), this); }
+    ActiveObjectIterator end() { return ActiveObjectIterator(Position(), this); }
+
+    template <typename... Args>
+    T * CreateObject(Args &&... args)
+    {
+        void * element = Allocate();
+        if (element != nullptr)
+        {
+            return new (element) T(std::forward<Args>(args)...);
+        }
+        RecordAllocationFailure();
+        return nullptr;
+    }
+
+    /*
+     * These methods exist purely to line up with the static allocator version, see HeapObjectPool.
+     */
+    size_t Capacity() const { return SIZE_MAX; }
+    bool Exhausted() const { return false; }
+
+    void ReleaseObject(T * object)
+    {
+        if (object != nullptr)
+        {
+            object->~T();
+            Deallocate(object);
+        }
+    }
+
+    void ReleaseAll() { ForEachActiveObjectInner(this, ReleaseObject); }
+
+    /**
+     * @brief
+     *   Run a functor for each active object in the pool
+     *
+     *  @param     function A functor of type `Loop (*)(T*)`.
+     *                      Return Loop::Break to break the iteration.
+     *                      The only modification the functor is allowed to make
+     *                      to the pool before returning is releasing the
+     *                      object that was passed to the functor.  Any other
+     *                      desired changes need to be made after iteration
+     *                      completes.
+     *  @return    Loop     Returns Break if some call to the functor returned
+     *                      Break.  Otherwise returns Finish.
+     */
+    template <typename Function>
+    Loop ForEachActiveObject(Function && function)
+    {
+        static_assert(std::is_same<Loop, decltype(function(std::declval<T *>()))>::value,
+                      "The function must take T* and return Loop");
+        internal::LambdaProxy<T, Function> proxy(std::forward<Function>(function));
+        return ForEachActiveObjectInner(&proxy, &internal::LambdaProxy<T, Function>::Call);
+    }
+    template <typename Function>
+    Loop ForEachActiveObject(Function && function) const
+    {
+        static_assert(std::is_same<Loop, decltype(function(std::declval<const T *>()))>::value,
+                      "The function must take const T* and return Loop");
+        internal::LambdaProxy<const T, Function> proxy(std::forward<Function>(function));
+        return ForEachActiveObjectInner(&proxy, &internal::LambdaProxy<const T, Function>::ConstCall);
+    }
+
+    void DumpToLog() const
+    {
+        ChipLogError(Support, "SlabObjectPool: %lu allocated in %lu slabs", static_cast<unsigned long>(Allocated()),
+                     static_cast<unsigned long>(SlabCount()));
+        if constexpr (IsDumpable<T>::value)
+        {
+            ForEachActiveObject([](const T * object) {
+                object->DumpToLog();
+                return Loop::Continue;
+            });
+        }
+    }
+
+private:
+    static Loop ReleaseObject(void * context, void * object)
+    {
+        static_cast<SlabObjectPool *>(context)->ReleaseObject(static_cast<T *>(object));
+        return Loop::Continue;
+    }
+};
+
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
 /**
@@ -623,6 +902,12 @@ enum class ObjectPoolMem
      * For this case, the ObjectPool size parameter is ignored.
      */
     kHeap,
+    /**
+     * Allocate objects from the heap in slabs of several objects, see SlabObjectPool.
+     *
+     * For this case, the ObjectPool size parameter is ignored.
+     */
+    kSlab,
     kDefault = kHeap
 #else  // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
     kDefault = kInline
@@ -658,6 +943,17 @@ template <typename T, size_t N>
 class ObjectPool<T, N, ObjectPoolMem::kHeap> : public HeapObjectPool<T>
 {
 };
+
+template <typename T>
+struct ObjectPoolIterator<T, ObjectPoolMem::kSlab>
+{
+    using Type = typename SlabObjectPool<T>::ActiveObjectIterator;
+};
+
+template <typename T, size_t N>
+class ObjectPool<T, N, ObjectPoolMem::kSlab> : public SlabObjectPool<T>
+{
+};
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
 } // namespace chip
@@ -0,0 +1,59 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Compile-time selection of the vector instruction set used by the byte
+ *      loops of lib/support.
+ *
+ *      Only instruction sets that are part of the baseline of their architecture
+ *      are used (SSE2 on x86-64, NEON on AArch64), so that no runtime detection is
+ *      needed. Every vectorized loop has a scalar implementation, which is the only
+ *      one built on other targets or when CHIP_CONFIG_ENABLE_SIMD is 0.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+
+#include <stddef.h>
+
+#if CHIP_CONFIG_ENABLE_SIMD && (defined(__SSE2__) || defined(_M_X64))
+#define CHIP_SIMD_SSE2 1
+#include <emmintrin.h>
+#else
+#define CHIP_SIMD_SSE2 0
+#endif
+
+#if CHIP_CONFIG_ENABLE_SIMD && defined(__ARM_NEON) && defined(__aarch64__)
+#define CHIP_SIMD_NEON 1
+#include <arm_neon.h>
+#else
+#define CHIP_SIMD_NEON 0
+#endif
+
+#define CHIP_SIMD (CHIP_SIMD_SSE2 || CHIP_SIMD_NEON)
+
+namespace chip {
+namespace Simd {
+
+/// Number of bytes of a vector register, for both SSE2 and NEON
+constexpr size_t kVectorSize = 16;
+
+} // namespace Simd
+} // namespace chip
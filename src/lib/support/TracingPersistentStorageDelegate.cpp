@@ -0,0 +1,236 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/TracingPersistentStorageDelegate.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+#include <inttypes.h>
+
+namespace chip {
+
+namespace {
+
+struct KeyFamily
+{
+    const char * mName;
+    // Key pattern of DefaultStorageKeyAllocator, where '*' is any non-empty path component and a trailing "**" is
+    // anything, slashes included.
+    const char * mPattern;
+};
+
+constexpr KeyFamily kKeyFamilies[] = {
+    { "FabricIndexInfo", "g/fidx" },
+    { "FabricNOC", "f/*/n" },
+    { "FabricICAC", "f/*/i" },
+    { "FabricRCAC", "f/*/r" },
+    { "FabricMetadata", "f/*/m" },
+    { "FabricOpKey", "f/*/o" },
+    { "FailSafeCommitMarkerKey", "g/fs/c" },
+    { "FailSafeNetworkConfig", "g/fs/n" },
+    { "LastKnownGoodTimeKey", "g/lkgt" },
+    { "FabricSession", "f/*/s/*" },
+    { "SessionResumptionIndex", "g/sri" },
+    // Base64 resumption ids may contain slashes.
+    { "SessionResumption", "g/s/**" },
+    { "PASEVerifierCacheEntry", "g/pvc/*" },
+    { "OperationalAddressCache", "g/oac" },
+    { "AccessControlAclEntry", "f/*/ac/0/*" },
+    { "AccessControlExtensionEntry", "f/*/ac/1" },
+    { "GroupDataCounter", "g/gdc" },
+    { "GroupControlCounter", "g/gcc" },
+    { "ICDCheckInCounter", "g/icd/cic" },
+    { "UserLabelLengthKey", "g/userlbl/*" },
+    { "UserLabelIndexKey", "g/userlbl/*/*" },
+    { "GroupFabricList", "g/gfl" },
+    { "FabricGroups", "f/*/g" },
+    { "FabricGroup", "f/*/g/*" },
+    { "FabricGroupKey", "f/*/gk/*" },
+    { "FabricGroupEndpoint", "f/*/g/*/e/*" },
+    { "FabricKeyset", "f/*/k/*" },
+    { "AttributeValue", "g/a/*/*/*" },
+    { "SafeAttributeValue", "g/sa/*/*/*" },
+    { "BindingTable", "g/bt" },
+    { "BindingTableEntry", "g/bt/*" },
+    { "ICDManagementTableEntry", "f/*/icd/*" },
+    { "ThreadNetworkDirectoryIndex", "g/tnd/i" },
+    { "ThreadNetworkDirectoryDataset", "g/tnd/n/*" },
+    { "OTADefaultProviders", "g/o/dp" },
+    { "OTACurrentProvider", "g/o/cp" },
+    { "OTAUpdateToken", "g/o/ut" },
+    { "OTACurrentUpdateState", "g/o/us" },
+    { "OTATargetVersion", "g/o/tv" },
+    { "IMEventNumber", "g/im/ec" },
+    { "PersistentEventLogIndex", "g/im/el/i" },
+    { "PersistentEventLogSegment", "g/im/el/s/*" },
+    { "SubscriptionResumption", "g/su/*" },
+    { "SubscriptionResumptionMaxCount", "g/sum" },
+    { "EndpointSceneCountKey", "g/scc/e/*" },
+    { "FabricSceneDataKey", "f/*/e/*/sc" },
+    { "FabricSceneKey", "f/*/e/*/sc/*" },
+    { "TSTrustedTimeSource", "g/ts/tts" },
+    { "TSDefaultNTP", "g/ts/dntp" },
+    { "TSTimeZone", "g/ts/tz" },
+    { "TSDSTOffset", "g/ts/dsto" },
+    { "FabricICDClientInfoCounter", "f/*/icdc" },
+    { "ICDClientInfoKey", "f/*/icdk" },
+    { "ICDFabricList", "g/icdfl" },
+};
+
+static_assert(ArraySize(kKeyFamilies) + 1 == TracingPersistentStorageDelegate::kNumKeyFamilies,
+              "kNumKeyFamilies has to count the families of the table, and Other");
+
+bool MatchesPattern(const char * key, const char * pattern)
+{
+    while (*pattern != '\0')
+    {
+        if (pattern[0] == '*' && pattern[1] == '*')
+        {
+            return *key != '\0';
+        }
+
+        if (*pattern == '*')
+        {
+            VerifyOrReturnValue(*key != '\0' && *key != '/', false);
+            while (*key != '\0' && *key != '/')
+            {
+                key++;
+            }
+        }
+        else
+        {
+            VerifyOrReturnValue(*key == *pattern, false);
+            key++;
+        }
+        pattern++;
+    }
+    return *key == '\0';
+}
+
+} // namespace
+
+CHIP_ERROR TracingPersistentStorageDelegate::SyncGetKeyValue(const char * key, void * buffer, uint16_t & size)
+{
+    System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+    CHIP_ERROR err                      = mStorage.SyncGetKeyValue(key, buffer, size);
+
+    FamilyStats & stats = mStats[GetKeyFamily(key)];
+    if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        stats.mMisses++;
+    }
+    Record(stats.mReads, (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND) ? CHIP_NO_ERROR : err,
+           (err == CHIP_NO_ERROR) ? size : 0, start);
+    return err;
+}
+
+CHIP_ERROR TracingPersistentStorageDelegate::SyncSetKeyValue(const char * key, const void * value, uint16_t size)
+{
+    System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+    CHIP_ERROR err                      = mStorage.SyncSetKeyValue(key, value, size);
+
+    Record(mStats[GetKeyFamily(key)].mWrites, err, size, start);
+    return err;
+}
+
+CHIP_ERROR TracingPersistentStorageDelegate::SyncDeleteKeyValue(const char * key)
+{
+    System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+    CHIP_ERROR err                      = mStorage.SyncDeleteKeyValue(key);
+
+    FamilyStats & stats = mStats[GetKeyFamily(key)];
+    if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        stats.mMisses++;
+    }
+    Record(stats.mDeletes, (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND) ? CHIP_NO_ERROR : err, 0, start);
+    return err;
+}
+
+bool TracingPersistentStorageDelegate::SyncDoesKeyExist(const char * key)
+{
+    System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+    bool exists                         = mStorage.SyncDoesKeyExist(key);
+
+    FamilyStats & stats = mStats[GetKeyFamily(key)];
+    if (!exists)
+    {
+        stats.mMisses++;
+    }
+    Record(stats.mReads, CHIP_NO_ERROR, 0, start);
+    return exists;
+}
+
+size_t TracingPersistentStorageDelegate::GetKeyFamily(const char * key)
+{
+    VerifyOrReturnValue(key != nullptr, ArraySize(kKeyFamilies));
+
+    for (size_t i = 0; i < ArraySize(kKeyFamilies); i++)
+    {
+        if (MatchesPattern(key, kKeyFamilies[i].mPattern))
+        {
+            return i;
+        }
+    }
+    return ArraySize(kKeyFamilies);
+}
+
+const char * TracingPersistentStorageDelegate::GetKeyFamilyName(size_t family)
+{
+    return (family < ArraySize(kKeyFamilies)) ? kKeyFamilies[family].mName : "Other";
+}
+
+void TracingPersistentStorageDelegate::ResetStats()
+{
+    std::fill(std::begin(mStats), std::end(mStats), FamilyStats());
+}
+
+void TracingPersistentStorageDelegate::LogStats() const
+{
+    for (size_t i = 0; i < kNumKeyFamilies; i++)
+    {
+        const FamilyStats & stats = mStats[i];
+        if (stats.GetAccessCount() == 0)
+        {
+            continue;
+        }
+
+        ChipLogProgress(Support,
+                        "%s: %" PRIu32 " reads (%" PRIu32 " misses) of %" PRIu64 " B in %" PRIu64 " us, %" PRIu32
+                        " writes of %" PRIu64 " B in %" PRIu64 " us, %" PRIu32 " deletes in %" PRIu64 " us",
+                        GetKeyFamilyName(i), stats.mReads.mCount, stats.mMisses, stats.mReads.mTotalBytes,
+                        stats.mReads.mTotalDuration.count(), stats.mWrites.mCount, stats.mWrites.mTotalBytes,
+                        stats.mWrites.mTotalDuration.count(), stats.mDeletes.mCount, stats.mDeletes.mTotalDuration.count());
+    }
+}
+
+void TracingPersistentStorageDelegate::Record(OperationStats & stats, CHIP_ERROR err, size_t bytes,
+                                              System::Clock::Microseconds64 start)
+{
+    System::Clock::Microseconds64 duration = System::SystemClock().GetMonotonicMicroseconds64() - start;
+
+    stats.mCount++;
+    stats.mErrors += (err == CHIP_NO_ERROR) ? 0 : 1;
+    stats.mTotalBytes += bytes;
+    stats.mTotalDuration += duration;
+    stats.mMaxDuration = std::max(stats.mMaxDuration, duration);
+}
+
+} // namespace chip
@@ -0,0 +1,93 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <system/SystemClock.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+
+/**
+ * Decorator of a PersistentStorageDelegate that accounts for the accesses to the decorated storage, per family of keys.
+ *
+ * The families are those of DefaultStorageKeyAllocator, named after its methods: "FabricNOC" counts the accesses to all
+ * the "f/<fabric>/n" keys, for instance.  Keys of no known family are counted as "Other".  Counting is meant for
+ * diagnostics and benchmarks, which show where the storage traffic of a workload goes; the statistics are not
+ * synchronized, so the delegate has to be used from a single thread, like any PersistentStorageDelegate.
+ */
+class TracingPersistentStorageDelegate : public PersistentStorageDelegate
+{
+public:
+    struct OperationStats
+    {
+        uint32_t mCount      = 0; ///< Number of calls
+        uint32_t mErrors     = 0; ///< Calls that failed, not counting reads of missing keys
+        uint64_t mTotalBytes = 0; ///< Bytes of the values read or written
+        System::Clock::Microseconds64 mTotalDuration{ 0 };
+        System::Clock::Microseconds64 mMaxDuration{ 0 };
+    };
+
+    struct FamilyStats
+    {
+        OperationStats mReads;
+        OperationStats mWrites;
+        OperationStats mDeletes;
+        uint32_t mMisses = 0; ///< Reads and deletes of keys that are not stored
+
+        uint32_t GetAccessCount() const { return mReads.mCount + mWrites.mCount + mDeletes.mCount; }
+    };
+
+    /// Number of families, including "Other", which is the last one.
+    static constexpr size_t kNumKeyFamilies = 55;
+
+    explicit TracingPersistentStorageDelegate(PersistentStorageDelegate & storage) : mStorage(storage) {}
+
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override;
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override;
+    CHIP_ERROR SyncDeleteKeyValue(const char * key) override;
+    bool SyncDoesKeyExist(const char * key) override;
+    CHIP_ERROR SyncFlush() override { return mStorage.SyncFlush(); }
+
+    /**
+     * Returns the index, below kNumKeyFamilies, of the family the key belongs to.
+     */
+    static size_t GetKeyFamily(const char * key);
+    static const char * GetKeyFamilyName(size_t family);
+
+    const FamilyStats & GetFamilyStats(size_t family) const { return mStats[family]; }
+    const FamilyStats & GetFamilyStats(const char * key) const { return mStats[GetKeyFamily(key)]; }
+
+    void ResetStats();
+
+    /**
+     * Log the statistics of the families that were accessed.
+     */
+    void LogStats() const;
+
+private:
+    void Record(OperationStats & stats, CHIP_ERROR err, size_t bytes, System::Clock::Microseconds64 start);
+
+    PersistentStorageDelegate & mStorage;
+    FamilyStats mStats[kNumKeyFamilies];
+};
+
+} // namespace chip
@@ -43,4 +43,10 @@ CHIP_ERROR JsonToTlv(const std::string & jsonString, TLV::TLVWriter & writer);
  */
 CHIP_ERROR ConvertTlvTag(uint32_t tagNumber, TLV::Tag & tag);
 
+/*
+ * Same as above, but tag numbers that map to an implicit profile tag use implicitProfileId, which should be the
+ * ImplicitProfileId of the TLVWriter the tag is written with.
+ */
+CHIP_ERROR ConvertTlvTag(uint32_t tagNumber, TLV::Tag & tag, uint32_t implicitProfileId);
+
 } // namespace chip
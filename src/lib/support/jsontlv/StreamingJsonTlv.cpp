@@ -0,0 +1,1204 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <string>
+
+#include <lib/support/Base64.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/jsontlv/ElementTypes.h>
+#include <lib/support/jsontlv/JsonToTlv.h>
+#include <lib/support/jsontlv/StreamingJsonTlv.h>
+
+namespace chip {
+
+namespace {
+
+// Same temporary implicit profile as JsonToTlv() and TlvToJson(): it is never encoded, but is needed to tell
+// implicit profile tags apart.
+constexpr uint32_t kTemporaryImplicitProfileId = 0xFF01;
+
+// Deeper documents are rejected as if they could not be parsed, which bounds the recursion below.
+constexpr size_t kMaxNestingDepth = 32;
+
+// Longest number token converted to a floating point value.
+constexpr size_t kMaxNumberLength = 64;
+
+// Longest element name containing escape sequences (names without escapes are parsed in place).
+constexpr size_t kMaxEscapedNameLength = 128;
+
+// Number of input bytes base64-encoded per output chunk; a multiple of 3 so that only the last chunk is padded.
+constexpr size_t kBase64ChunkLength = 48;
+
+bool Matches(CharSpan str, const char * literal)
+{
+    return str.data_equal(CharSpan::fromCharString(literal));
+}
+
+bool StartsWith(CharSpan str, const char * prefix)
+{
+    size_t prefixLength = strlen(prefix);
+    return str.size() >= prefixLength && memcmp(str.data(), prefix, prefixLength) == 0;
+}
+
+bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+bool ParseHex4(CharSpan str, size_t position, uint32_t & value)
+{
+    VerifyOrReturnValue(position + 4 <= str.size(), false);
+    value = 0;
+    for (size_t i = position; i < position + 4; i++)
+    {
+        char c = str.data()[i];
+        uint32_t digit;
+        if (IsDigit(c))
+        {
+            digit = static_cast<uint32_t>(c - '0');
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            digit = static_cast<uint32_t>(c - 'a' + 10);
+        }
+        else if (c >= 'A' && c <= 'F')
+        {
+            digit = static_cast<uint32_t>(c - 'A' + 10);
+        }
+        else
+        {
+            return false;
+        }
+        value = (value << 4) | digit;
+    }
+    return true;
+}
+
+/*
+ * Decodes the body of a JSON string (the text between the quotes) into UTF-8. out may be null, to only validate
+ * the escape sequences and compute decodedLength.
+ */
+CHIP_ERROR DecodeJsonString(CharSpan body, char * out, size_t & decodedLength)
+{
+    size_t length = 0;
+    auto emit     = [&](uint32_t byte) {
+        if (out != nullptr)
+        {
+            out[length] = static_cast<char>(byte);
+        }
+        length++;
+    };
+
+    for (size_t i = 0; i < body.size(); i++)
+    {
+        char c = body.data()[i];
+        if (c != '\\')
+        {
+            emit(static_cast<uint8_t>(c));
+            continue;
+        }
+
+        VerifyOrReturnError(++i < body.size(), CHIP_ERROR_INTERNAL);
+        switch (body.data()[i])
+        {
+        case '"':
+        case '\\':
+        case '/':
+            emit(static_cast<uint8_t>(body.data()[i]));
+            break;
+        case 'b':
+            emit('\b');
+            break;
+        case 'f':
+            emit('\f');
+            break;
+        case 'n':
+            emit('\n');
+            break;
+        case 'r':
+            emit('\r');
+            break;
+        case 't':
+            emit('\t');
+            break;
+        case 'u': {
+            uint32_t codePoint;
+            VerifyOrReturnError(ParseHex4(body, i + 1, codePoint), CHIP_ERROR_INTERNAL);
+            i += 4;
+            if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+            {
+                // A high surrogate must be followed by an escaped low surrogate.
+                uint32_t lowSurrogate;
+                VerifyOrReturnError(i + 2 < body.size() && body.data()[i + 1] == '\\' && body.data()[i + 2] == 'u',
+                                    CHIP_ERROR_INTERNAL);
+                VerifyOrReturnError(ParseHex4(body, i + 3, lowSurrogate), CHIP_ERROR_INTERNAL);
+                VerifyOrReturnError(lowSurrogate >= 0xDC00 && lowSurrogate <= 0xDFFF, CHIP_ERROR_INTERNAL);
+                i += 6;
+                codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+            }
+            else
+            {
+                VerifyOrReturnError(codePoint < 0xDC00 || codePoint > 0xDFFF, CHIP_ERROR_INTERNAL);
+            }
+
+            if (codePoint < 0x80)
+            {
+                emit(codePoint);
+            }
+            else if (codePoint < 0x800)
+            {
+                emit(0xC0 | (codePoint >> 6));
+                emit(0x80 | (codePoint & 0x3F));
+            }
+            else if (codePoint < 0x10000)
+            {
+                emit(0xE0 | (codePoint >> 12));
+                emit(0x80 | ((codePoint >> 6) & 0x3F));
+                emit(0x80 | (codePoint & 0x3F));
+            }
+            else
+            {
+                emit(0xF0 | (codePoint >> 18));
+                emit(0x80 | ((codePoint >> 12) & 0x3F));
+                emit(0x80 | ((codePoint >> 6) & 0x3F));
+                emit(0x80 | (codePoint & 0x3F));
+            }
+            break;
+        }
+        default:
+            return CHIP_ERROR_INTERNAL;
+        }
+    }
+
+    decodedLength = length;
+    return CHIP_NO_ERROR;
+}
+
+struct JsonString
+{
+    CharSpan body; // Text between the quotes, escape sequences included.
+    bool hasEscapes      = false;
+    size_t decodedLength = 0;
+};
+
+/*
+ * Holds the decoded value of a JSON string: the input text itself when it has no escape sequences, a
+ * heap copy otherwise.
+ */
+class DecodedString
+{
+public:
+    CHIP_ERROR Init(const JsonString & string)
+    {
+        if (!string.hasEscapes)
+        {
+            mValue = string.body;
+            return CHIP_NO_ERROR;
+        }
+
+        // Allocate at least one byte, so that an empty decoded string is not mistaken for an allocation failure.
+        VerifyOrReturnError(mBuffer.Alloc(string.decodedLength + 1), CHIP_ERROR_NO_MEMORY);
+        size_t length;
+        ReturnErrorOnFailure(DecodeJsonString(string.body, mBuffer.Get(), length));
+        mValue = CharSpan(mBuffer.Get(), length);
+        return CHIP_NO_ERROR;
+    }
+
+    CharSpan Get() const { return mValue; }
+
+private:
+    Platform::ScopedMemoryBuffer<char> mBuffer;
+    CharSpan mValue;
+};
+
+/*
+ * Splits JSON text into tokens, without building any representation of the document.
+ *
+ * Syntax errors are reported as CHIP_ERROR_INTERNAL, as JsonToTlv() does when jsoncpp fails to parse its input.
+ * Comments are skipped like whitespace, since jsoncpp accepts them too.
+ */
+class JsonTokenizer
+{
+public:
+    explicit JsonTokenizer(CharSpan json) : mJson(json) {}
+
+    size_t GetPosition() const { return mPosition; }
+    void SetPosition(size_t position) { mPosition = position; }
+
+    // Skips whitespace and comments, and returns the next character, or '\0' at the end of the text.
+    char Peek()
+    {
+        while (mPosition < mJson.size())
+        {
+            char c = mJson.data()[mPosition];
+            if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+            {
+                mPosition++;
+            }
+            else if (c == '/' && mPosition + 1 < mJson.size() && mJson.data()[mPosition + 1] == '/')
+            {
+                while (mPosition < mJson.size() && mJson.data()[mPosition] != '\n')
+                {
+                    mPosition++;
+                }
+            }
+            else if (c == '/' && mPosition + 1 < mJson.size() && mJson.data()[mPosition + 1] == '*')
+            {
+                mPosition += 2;
+                while (mPosition < mJson.size() &&
+                       !(mJson.data()[mPosition] == '*' && mPosition + 1 < mJson.size() && mJson.data()[mPosition + 1] == '/'))
+                {
+                    mPosition++;
+                }
+                mPosition = (mPosition < mJson.size()) ? mPosition + 2 : mPosition;
+            }
+            else
+            {
+                return c;
+            }
+        }
+        return '\0';
+    }
+
+    // Consumes the next character if it is c.
+    bool Consume(char c)
+    {
+        VerifyOrReturnValue(Peek() == c, false);
+        mPosition++;
+        return true;
+    }
+
+    CHIP_ERROR Expect(char c) { return Consume(c) ? CHIP_NO_ERROR : CHIP_ERROR_INTERNAL; }
+
+    CHIP_ERROR ExpectEnd()
+    {
+        Peek();
+        return (mPosition == mJson.size()) ? CHIP_NO_ERROR : CHIP_ERROR_INTERNAL;
+    }
+
+    CHIP_ERROR ReadString(JsonString & string)
+    {
+        ReturnErrorOnFailure(Expect('"'));
+
+        size_t start      = mPosition;
+        string.hasEscapes = false;
+        while (mPosition < mJson.size() && mJson.data()[mPosition] != '"')
+        {
+            if (mJson.data()[mPosition] == '\\')
+            {
+                string.hasEscapes = true;
+                mPosition++;
+            }
+            mPosition++;
+        }
+        VerifyOrReturnError(mPosition < mJson.size(), CHIP_ERROR_INTERNAL);
+
+        string.body = mJson.SubSpan(start, mPosition - start);
+        mPosition++;
+        return DecodeJsonString(string.body, nullptr, string.decodedLength);
+    }
+
+    // Reads a number token; isInteger tells whether it has neither a fraction nor an exponent.
+    CHIP_ERROR ReadNumber(CharSpan & number, bool & isInteger)
+    {
+        Peek();
+        size_t start = mPosition;
+
+        Skip('-');
+        if (!Skip('0'))
+        {
+            VerifyOrReturnError(SkipDigits(), CHIP_ERROR_INTERNAL);
+        }
+
+        isInteger = true;
+        if (Skip('.'))
+        {
+            isInteger = false;
+            VerifyOrReturnError(SkipDigits(), CHIP_ERROR_INTERNAL);
+        }
+        if (Skip('e') || Skip('E'))
+        {
+            isInteger = false;
+            if (!Skip('+'))
+            {
+                Skip('-');
+            }
+            VerifyOrReturnError(SkipDigits(), CHIP_ERROR_INTERNAL);
+        }
+
+        number = mJson.SubSpan(start, mPosition - start);
+        return CHIP_NO_ERROR;
+    }
+
+    // Reads one of the true, false and null literals.
+    CHIP_ERROR ReadLiteral(const char * literal)
+    {
+        Peek();
+        size_t length = strlen(literal);
+        VerifyOrReturnError(StartsWith(mJson.SubSpan(mPosition), literal), CHIP_ERROR_INTERNAL);
+        mPosition += length;
+        return CHIP_NO_ERROR;
+    }
+
+    // Reads and validates any value, including nested objects and arrays.
+    CHIP_ERROR SkipValue(size_t depth)
+    {
+        VerifyOrReturnError(depth <= kMaxNestingDepth, CHIP_ERROR_INTERNAL);
+
+        switch (Peek())
+        {
+        case '{':
+            mPosition++;
+            VerifyOrReturnError(!Consume('}'), CHIP_NO_ERROR);
+            do
+            {
+                JsonString name;
+                ReturnErrorOnFailure(ReadString(name));
+                ReturnErrorOnFailure(Expect(':'));
+                ReturnErrorOnFailure(SkipValue(depth + 1));
+            } while (Consume(','));
+            return Expect('}');
+        case '[':
+            mPosition++;
+            VerifyOrReturnError(!Consume(']'), CHIP_NO_ERROR);
+            do
+            {
+                ReturnErrorOnFailure(SkipValue(depth + 1));
+            } while (Consume(','));
+            return Expect(']');
+        case '"': {
+            JsonString string;
+            return ReadString(string);
+        }
+        case 't':
+            return ReadLiteral("true");
+        case 'f':
+            return ReadLiteral("false");
+        case 'n':
+            return ReadLiteral("null");
+        default: {
+            CharSpan number;
+            bool isInteger;
+            return ReadNumber(number, isInteger);
+        }
+        }
+    }
+
+private:
+    bool Skip(char c)
+    {
+        VerifyOrReturnValue(mPosition < mJson.size() && mJson.data()[mPosition] == c, false);
+        mPosition++;
+        return true;
+    }
+
+    bool SkipDigits()
+    {
+        size_t start = mPosition;
+        while (mPosition < mJson.size() && IsDigit(mJson.data()[mPosition]))
+        {
+            mPosition++;
+        }
+        return mPosition > start;
+    }
+
+    CharSpan mJson;
+    size_t mPosition = 0;
+};
+
+CHIP_ERROR JsonTypeStrToTlvType(CharSpan elementType, ElementTypeContext & type)
+{
+    static const struct
+    {
+        const char * name;
+        TLV::TLVType tlvType;
+        bool isDouble;
+    } kTypes[] = {
+        { kElementTypeInt, TLV::kTLVType_SignedInteger, false },
+        { kElementTypeUInt, TLV::kTLVType_UnsignedInteger, false },
+        { kElementTypeBool, TLV::kTLVType_Boolean, false },
+        { kElementTypeFloat, TLV::kTLVType_FloatingPointNumber, false },
+        { kElementTypeDouble, TLV::kTLVType_FloatingPointNumber, true },
+        { kElementTypeBytes, TLV::kTLVType_ByteString, false },
+        { kElementTypeString, TLV::kTLVType_UTF8String, false },
+        { kElementTypeNull, TLV::kTLVType_Null, false },
+        { kElementTypeStruct, TLV::kTLVType_Structure, false },
+        { kElementTypeArray, TLV::kTLVType_Array, false },
+    };
+
+    for (const auto & entry : kTypes)
+    {
+        if (Matches(elementType, entry.name))
+        {
+            type.tlvType  = entry.tlvType;
+            type.isDouble = entry.isDouble;
+            return CHIP_NO_ERROR;
+        }
+    }
+    return CHIP_ERROR_INVALID_ARGUMENT;
+}
+
+struct StructMember
+{
+    CharSpan name; // As written in the JSON text, escape sequences included.
+    TLV::Tag tag = TLV::AnonymousTag();
+    ElementTypeContext type;
+    ElementTypeContext subType;
+    size_t valuePosition = 0;
+};
+
+// Same order as JsonToTlv(): context tags first, then common profile tags, each by tag number. Members with the
+// same tag number keep the order of their names, as they come out of a Json::Value.
+bool IsBefore(const StructMember & a, const StructMember & b)
+{
+    if (TLV::IsContextTag(a.tag) != TLV::IsContextTag(b.tag))
+    {
+        return TLV::IsContextTag(a.tag);
+    }
+    if (TLV::TagNumFromTag(a.tag) != TLV::TagNumFromTag(b.tag))
+    {
+        return TLV::TagNumFromTag(a.tag) < TLV::TagNumFromTag(b.tag);
+    }
+
+    int order = memcmp(a.name.data(), b.name.data(), std::min(a.name.size(), b.name.size()));
+    return (order != 0) ? (order < 0) : (a.name.size() < b.name.size());
+}
+
+/*
+ * Parses a "[field_name:]tag_number:type" element name, where an ARRAY type is followed by "-" and the type of
+ * its elements ("?" for an empty array).
+ */
+CHIP_ERROR ParseElementName(CharSpan name, uint32_t implicitProfileId, StructMember & member)
+{
+    CharSpan fields[3];
+    size_t fieldCount = 0;
+    size_t fieldStart = 0;
+    for (size_t i = 0; i <= name.size(); i++)
+    {
+        if (i == name.size() || name.data()[i] == ':')
+        {
+            VerifyOrReturnError(fieldCount < ArraySize(fields), CHIP_ERROR_INVALID_ARGUMENT);
+            fields[fieldCount++] = name.SubSpan(fieldStart, i - fieldStart);
+            fieldStart           = i + 1;
+        }
+    }
+    VerifyOrReturnError(fieldCount >= 2, CHIP_ERROR_INVALID_ARGUMENT);
+
+    CharSpan tagField  = fields[fieldCount - 2];
+    CharSpan typeField = fields[fieldCount - 1];
+
+    uint32_t tagNumber = 0;
+    const char * end   = tagField.data() + tagField.size();
+    auto result        = std::from_chars(tagField.data(), end, tagNumber, 10);
+    VerifyOrReturnError(result.ec == std::errc() && result.ptr == end, CHIP_ERROR_INVALID_ARGUMENT);
+    ReturnErrorOnFailure(ConvertTlvTag(tagNumber, member.tag, implicitProfileId));
+
+    static const char kArrayPrefix[] = "ARRAY-";
+    if (StartsWith(typeField, kArrayPrefix))
+    {
+        CharSpan subType    = typeField.SubSpan(strlen(kArrayPrefix));
+        member.type.tlvType = TLV::kTLVType_Array;
+        if (Matches(subType, kElementTypeEmpty))
+        {
+            member.subType.tlvType = TLV::kTLVType_NotSpecified;
+            return CHIP_NO_ERROR;
+        }
+        return JsonTypeStrToTlvType(subType, member.subType);
+    }
+
+    ReturnErrorOnFailure(JsonTypeStrToTlvType(typeField, member.type));
+    // A bare ARRAY does not say what its elements are.
+    VerifyOrReturnError(member.type.tlvType != TLV::kTLVType_Array, CHIP_ERROR_INVALID_ARGUMENT);
+    return CHIP_NO_ERROR;
+}
+
+/*
+ * Writes TLV for JSON text as it tokenizes it.
+ *
+ * TLV structure members must be written in tag order, so each JSON object is read twice: a first pass records
+ * where the value of every member starts, and a second pass encodes the values in sorted order. The first pass
+ * over the top-level object also validates the whole document, so a syntax error is always reported before
+ * any semantic one, like JsonToTlv() does.
+ */
+class JsonToTlvEncoder
+{
+public:
+    JsonToTlvEncoder(CharSpan json, TLV::TLVWriter & writer) : mTokenizer(json), mWriter(writer) {}
+
+    CHIP_ERROR Encode()
+    {
+        // The top level element must be a JSON object, encoded as an anonymous structure.
+        if (mTokenizer.Peek() != '{')
+        {
+            ReturnErrorOnFailure(mTokenizer.SkipValue(0));
+            ReturnErrorOnFailure(mTokenizer.ExpectEnd());
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
+
+        ReturnErrorOnFailure(EncodeStructure(TLV::AnonymousTag(), 0));
+        return mTokenizer.ExpectEnd();
+    }
+
+private:
+    CHIP_ERROR EncodeElement(TLV::Tag tag, const ElementTypeContext & type, const ElementTypeContext & subType, size_t depth)
+    {
+        char next = mTokenizer.Peek();
+
+        switch (type.tlvType)
+        {
+        case TLV::kTLVType_UnsignedInteger: {
+            uint64_t v = 0;
+            ReturnErrorOnFailure(ReadInteger(v));
+            return mWriter.Put(tag, v);
+        }
+
+        case TLV::kTLVType_SignedInteger: {
+            int64_t v = 0;
+            ReturnErrorOnFailure(ReadInteger(v));
+            return mWriter.Put(tag, v);
+        }
+
+        case TLV::kTLVType_Boolean: {
+            VerifyOrReturnError(next == 't' || next == 'f', CHIP_ERROR_INVALID_ARGUMENT);
+            ReturnErrorOnFailure(mTokenizer.ReadLiteral(next == 't' ? "true" : "false"));
+            return mWriter.PutBoolean(tag, next == 't');
+        }
+
+        case TLV::kTLVType_FloatingPointNumber: {
+            double v = 0;
+            ReturnErrorOnFailure(ReadFloatingPoint(v));
+            return type.isDouble ? mWriter.Put(tag, v) : mWriter.Put(tag, static_cast<float>(v));
+        }
+
+        case TLV::kTLVType_ByteString: {
+            VerifyOrReturnError(next == '"', CHIP_ERROR_INVALID_ARGUMENT);
+            JsonString string;
+            DecodedString encoded;
+            ReturnErrorOnFailure(mTokenizer.ReadString(string));
+            ReturnErrorOnFailure(encoded.Init(string));
+
+            size_t encodedLen = encoded.Get().size();
+            VerifyOrReturnError(CanCastTo<uint16_t>(encodedLen), CHIP_ERROR_INVALID_ARGUMENT);
+
+            // Check if the length is a multiple of 4 as strict padding is required.
+            VerifyOrReturnError(encodedLen % 4 == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+            Platform::ScopedMemoryBuffer<uint8_t> byteString;
+            byteString.Alloc(BASE64_MAX_DECODED_LEN(static_cast<uint16_t>(encodedLen)) + 1);
+            VerifyOrReturnError(byteString.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
+            auto decodedLen = Base64Decode(encoded.Get().data(), static_cast<uint16_t>(encodedLen), byteString.Get());
+            VerifyOrReturnError(decodedLen < UINT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+            return mWriter.PutBytes(tag, byteString.Get(), decodedLen);
+        }
+
+        case TLV::kTLVType_UTF8String: {
+            VerifyOrReturnError(next == '"', CHIP_ERROR_INVALID_ARGUMENT);
+            JsonString string;
+            DecodedString value;
+            ReturnErrorOnFailure(mTokenizer.ReadString(string));
+            ReturnErrorOnFailure(value.Init(string));
+            VerifyOrReturnError(CanCastTo<uint32_t>(value.Get().size()), CHIP_ERROR_INVALID_ARGUMENT);
+            return mWriter.PutString(tag, value.Get().data(), static_cast<uint32_t>(value.Get().size()));
+        }
+
+        case TLV::kTLVType_Null: {
+            VerifyOrReturnError(next == 'n', CHIP_ERROR_INVALID_ARGUMENT);
+            ReturnErrorOnFailure(mTokenizer.ReadLiteral("null"));
+            return mWriter.PutNull(tag);
+        }
+
+        case TLV::kTLVType_Structure: {
+            VerifyOrReturnError(next == '{', CHIP_ERROR_INVALID_ARGUMENT);
+            return EncodeStructure(tag, depth);
+        }
+
+        case TLV::kTLVType_Array: {
+            VerifyOrReturnError(next == '[', CHIP_ERROR_INVALID_ARGUMENT);
+            return EncodeArray(tag, subType, depth);
+        }
+
+        default:
+            return CHIP_ERROR_INVALID_TLV_ELEMENT;
+        }
+    }
+
+    CHIP_ERROR EncodeStructure(TLV::Tag tag, size_t depth)
+    {
+        Platform::ScopedMemoryBuffer<StructMember> members;
+        size_t memberCount = 0;
+        size_t capacity    = 0;
+        // Keep validating the syntax of the remaining members after a bad element name.
+        CHIP_ERROR nameError = CHIP_NO_ERROR;
+
+        ReturnErrorOnFailure(mTokenizer.Expect('{'));
+        if (!mTokenizer.Consume('}'))
+        {
+            do
+            {
+                StructMember member;
+                JsonString name;
+                ReturnErrorOnFailure(mTokenizer.ReadString(name));
+                ReturnErrorOnFailure(mTokenizer.Expect(':'));
+                mTokenizer.Peek();
+                member.name          = name.body;
+                member.valuePosition = mTokenizer.GetPosition();
+                ReturnErrorOnFailure(mTokenizer.SkipValue(depth + 1));
+
+                CHIP_ERROR err = ParseMemberName(name, member);
+                if (err != CHIP_NO_ERROR)
+                {
+                    nameError = (nameError == CHIP_NO_ERROR) ? err : nameError;
+                    continue;
+                }
+
+                if (memberCount == capacity)
+                {
+                    Platform::ScopedMemoryBuffer<StructMember> grown;
+                    size_t newCapacity = (capacity == 0) ? 8 : capacity * 2;
+                    VerifyOrReturnError(grown.Calloc(newCapacity), CHIP_ERROR_NO_MEMORY);
+                    for (size_t i = 0; i < memberCount; i++)
+                    {
+                        grown[i] = members[i];
+                    }
+                    members  = std::move(grown);
+                    capacity = newCapacity;
+                }
+
+                // Insertion sort: members are usually already in tag order.
+                size_t position = memberCount++;
+                while (position > 0 && IsBefore(member, members[position - 1]))
+                {
+                    members[position] = members[position - 1];
+                    position--;
+                }
+                members[position] = member;
+            } while (mTokenizer.Consume(','));
+            ReturnErrorOnFailure(mTokenizer.Expect('}'));
+        }
+        ReturnErrorOnFailure(nameError);
+
+        size_t end = mTokenizer.GetPosition();
+        TLV::TLVType containerType;
+        ReturnErrorOnFailure(mWriter.StartContainer(tag, TLV::kTLVType_Structure, containerType));
+        for (size_t i = 0; i < memberCount; i++)
+        {
+            mTokenizer.SetPosition(members[i].valuePosition);
+            ReturnErrorOnFailure(EncodeElement(members[i].tag, members[i].type, members[i].subType, depth + 1));
+        }
+        mTokenizer.SetPosition(end);
+        return mWriter.EndContainer(containerType);
+    }
+
+    CHIP_ERROR EncodeArray(TLV::Tag tag, const ElementTypeContext & subType, size_t depth)
+    {
+        TLV::TLVType containerType;
+        ReturnErrorOnFailure(mTokenizer.Expect('['));
+        ReturnErrorOnFailure(mWriter.StartContainer(tag, TLV::kTLVType_Array, containerType));
+
+        if (!mTokenizer.Consume(']'))
+        {
+            VerifyOrReturnError(subType.tlvType != TLV::kTLVType_NotSpecified, CHIP_ERROR_INVALID_ARGUMENT);
+            do
+            {
+                ReturnErrorOnFailure(EncodeElement(TLV::AnonymousTag(), subType, ElementTypeContext(), depth + 1));
+            } while (mTokenizer.Consume(','));
+            ReturnErrorOnFailure(mTokenizer.Expect(']'));
+        }
+
+        return mWriter.EndContainer(containerType);
+    }
+
+    CHIP_ERROR ParseMemberName(const JsonString & name, StructMember & member)
+    {
+        if (!name.hasEscapes)
+        {
+            return ParseElementName(name.body, mWriter.ImplicitProfileId, member);
+        }
+
+        char buffer[kMaxEscapedNameLength];
+        size_t length;
+        VerifyOrReturnError(name.decodedLength <= sizeof(buffer), CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(DecodeJsonString(name.body, buffer, length));
+        return ParseElementName(CharSpan(buffer, length), mWriter.ImplicitProfileId, member);
+    }
+
+    // Reads an integer given either as a JSON number or as a decimal string.
+    template <typename T>
+    CHIP_ERROR ReadInteger(T & value)
+    {
+        char next = mTokenizer.Peek();
+        CharSpan digits;
+        if (next == '"')
+        {
+            JsonString string;
+            ReturnErrorOnFailure(mTokenizer.ReadString(string));
+            VerifyOrReturnError(!string.hasEscapes, CHIP_ERROR_INVALID_ARGUMENT);
+            digits = string.body;
+        }
+        else if (next == '-' || IsDigit(next))
+        {
+            bool isInteger;
+            ReturnErrorOnFailure(mTokenizer.ReadNumber(digits, isInteger));
+            VerifyOrReturnError(isInteger, CHIP_ERROR_INVALID_ARGUMENT);
+        }
+        else
+        {
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
+
+        const char * end = digits.data() + digits.size();
+        auto result      = std::from_chars(digits.data(), end, value, 10);
+        VerifyOrReturnError(result.ec == std::errc() && result.ptr == end, CHIP_ERROR_INVALID_ARGUMENT);
+        return CHIP_NO_ERROR;
+    }
+
+    // Reads a JSON number, or one of the "Infinity" and "-Infinity" strings.
+    CHIP_ERROR ReadFloatingPoint(double & value)
+    {
+        char next = mTokenizer.Peek();
+        if (next == '"')
+        {
+            JsonString string;
+            ReturnErrorOnFailure(mTokenizer.ReadString(string));
+            if (Matches(string.body, kFloatingPointPositiveInfinity))
+            {
+                value = std::numeric_limits<double>::infinity();
+            }
+            else if (Matches(string.body, kFloatingPointNegativeInfinity))
+            {
+                value = -std::numeric_limits<double>::infinity();
+            }
+            else
+            {
+                return CHIP_ERROR_INVALID_ARGUMENT;
+            }
+            return CHIP_NO_ERROR;
+        }
+
+        VerifyOrReturnError(next == '-' || IsDigit(next), CHIP_ERROR_INVALID_ARGUMENT);
+
+        CharSpan number;
+        bool isInteger;
+        ReturnErrorOnFailure(mTokenizer.ReadNumber(number, isInteger));
+
+        // strtod needs a terminated string.
+        char buffer[kMaxNumberLength + 1];
+        VerifyOrReturnError(number.size() <= kMaxNumberLength, CHIP_ERROR_INVALID_ARGUMENT);
+        memcpy(buffer, number.data(), number.size());
+        buffer[number.size()] = '\0';
+        value                 = strtod(buffer, nullptr);
+        return CHIP_NO_ERROR;
+    }
+
+    JsonTokenizer mTokenizer;
+    TLV::TLVWriter & mWriter;
+};
+
+/*
+ * Appends JSON text for the TLV elements it is handed, with the same validation as TlvToJson().
+ */
+class TlvToJsonEncoder
+{
+public:
+    explicit TlvToJsonEncoder(std::string & json) : mJson(json) {}
+
+    /*
+     * Given a TLVReader positioned at TLV structure this function:
+     *   - enters structure
+     *   - appends all elements of a structure as members of a JSON object
+     *   - exits structure
+     */
+    CHIP_ERROR EncodeStructure(TLV::TLVReader & reader)
+    {
+        CHIP_ERROR err;
+        TLV::TLVType containerType;
+        bool first = true;
+
+        ReturnErrorOnFailure(reader.EnterContainer(containerType));
+        mJson += '{';
+
+        while ((err = reader.Next()) == CHIP_NO_ERROR)
+        {
+            TLV::Tag tag = reader.GetTag();
+            VerifyOrReturnError(TLV::IsContextTag(tag) || TLV::IsProfileTag(tag), CHIP_ERROR_INVALID_TLV_TAG);
+
+            if (TLV::IsProfileTag(tag) && TLV::VendorIdFromTag(tag) == 0)
+            {
+                VerifyOrReturnError(TLV::TagNumFromTag(tag) > UINT8_MAX, CHIP_ERROR_INVALID_TLV_TAG);
+            }
+
+            if (!first)
+            {
+                mJson += ',';
+            }
+            first = false;
+
+            ReturnErrorOnFailure(AppendElementName(reader));
+            mJson += ':';
+            ReturnErrorOnFailure(EncodeValue(reader));
+        }
+
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+        mJson += '}';
+        return reader.ExitContainer(containerType);
+    }
+
+private:
+    static ElementTypeContext GetElementType(TLV::TLVReader & reader)
+    {
+        ElementTypeContext type;
+        type.tlvType = reader.GetType();
+        if (type.tlvType == TLV::kTLVType_FloatingPointNumber)
+        {
+            type.isDouble = reader.IsElementDouble();
+        }
+        return type;
+    }
+
+    static const char * GetJsonElementStrFromType(const ElementTypeContext & ctx)
+    {
+        switch (ctx.tlvType)
+        {
+        case TLV::kTLVType_UnsignedInteger:
+            return kElementTypeUInt;
+        case TLV::kTLVType_SignedInteger:
+            return kElementTypeInt;
+        case TLV::kTLVType_Boolean:
+            return kElementTypeBool;
+        case TLV::kTLVType_FloatingPointNumber:
+            return ctx.isDouble ? kElementTypeDouble : kElementTypeFloat;
+        case TLV::kTLVType_ByteString:
+            return kElementTypeBytes;
+        case TLV::kTLVType_UTF8String:
+            return kElementTypeString;
+        case TLV::kTLVType_Null:
+            return kElementTypeNull;
+        case TLV::kTLVType_Structure:
+            return kElementTypeStruct;
+        case TLV::kTLVType_Array:
+            return kElementTypeArray;
+        default:
+            return kElementTypeEmpty;
+        }
+    }
+
+    /*
+     * Appends the quoted 'TagNumber:ElementType-SubElementType' name of the element the reader is positioned on.
+     * For an array, the type of its elements comes from its first element.
+     */
+    CHIP_ERROR AppendElementName(TLV::TLVReader & reader)
+    {
+        TLV::Tag tag       = reader.GetTag();
+        uint32_t tagNumber = TLV::TagNumFromTag(tag);
+        if (TLV::IsProfileTag(tag) && TLV::ProfileIdFromTag(tag) != reader.ImplicitProfileId)
+        {
+            tagNumber |= static_cast<uint32_t>(TLV::VendorIdFromTag(tag)) << 16;
+        }
+
+        ElementTypeContext type = GetElementType(reader);
+        mJson += '"';
+        AppendNumber(tagNumber);
+        mJson += ':';
+        mJson += GetJsonElementStrFromType(type);
+
+        if (type.tlvType == TLV::kTLVType_Array)
+        {
+            ElementTypeContext subType;
+            TLV::TLVReader peek;
+            TLV::TLVType containerType;
+            peek.Init(reader);
+            ReturnErrorOnFailure(peek.EnterContainer(containerType));
+            CHIP_ERROR err = peek.Next();
+            if (err == CHIP_NO_ERROR)
+            {
+                subType = GetElementType(peek);
+            }
+            else
+            {
+                VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+            }
+            mJson += '-';
+            mJson += GetJsonElementStrFromType(subType);
+        }
+
+        mJson += '"';
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR EncodeValue(TLV::TLVReader & reader)
+    {
+        switch (reader.GetType())
+        {
+        case TLV::kTLVType_UnsignedInteger: {
+            uint64_t v;
+            ReturnErrorOnFailure(reader.Get(v));
+            AppendNumber(v, !CanCastTo<uint32_t>(v));
+            break;
+        }
+
+        case TLV::kTLVType_SignedInteger: {
+            int64_t v;
+            ReturnErrorOnFailure(reader.Get(v));
+            AppendNumber(v, !CanCastTo<int32_t>(v));
+            break;
+        }
+
+        case TLV::kTLVType_Boolean: {
+            bool v;
+            ReturnErrorOnFailure(reader.Get(v));
+            mJson += v ? "true" : "false";
+            break;
+        }
+
+        case TLV::kTLVType_FloatingPointNumber: {
+            double v;
+            ReturnErrorOnFailure(reader.Get(v));
+            if (v == std::numeric_limits<double>::infinity())
+            {
+                AppendString(CharSpan::fromCharString(kFloatingPointPositiveInfinity));
+            }
+            else if (v == -std::numeric_limits<double>::infinity())
+            {
+                AppendString(CharSpan::fromCharString(kFloatingPointNegativeInfinity));
+            }
+            else if (std::isnan(v))
+            {
+                // JSON has no representation for NaN; jsoncpp writes null as well.
+                mJson += "null";
+            }
+            else
+            {
+                // 17 significant digits, like jsoncpp, so that the value reads back unchanged. Also like jsoncpp,
+                // keep a decimal point so that the value still reads as a floating point number.
+                char buffer[32];
+                snprintf(buffer, sizeof(buffer), "%.17g", v);
+                mJson += buffer;
+                if (strpbrk(buffer, ".e") == nullptr)
+                {
+                    mJson += ".0";
+                }
+            }
+            break;
+        }
+
+        case TLV::kTLVType_ByteString: {
+            ByteSpan span;
+            ReturnErrorOnFailure(reader.Get(span));
+
+            // Encode in chunks, rather than allocating the whole base64 string.
+            char chunk[BASE64_ENCODED_LEN(kBase64ChunkLength)];
+            mJson += '"';
+            while (!span.empty())
+            {
+                size_t length   = std::min(span.size(), kBase64ChunkLength);
+                auto encodedLen = Base64Encode(span.data(), static_cast<uint16_t>(length), chunk);
+                mJson.append(chunk, encodedLen);
+                span = span.SubSpan(length);
+            }
+            mJson += '"';
+            break;
+        }
+
+        case TLV::kTLVType_UTF8String: {
+            CharSpan span;
+            ReturnErrorOnFailure(reader.Get(span));
+            AppendString(span);
+            break;
+        }
+
+        case TLV::kTLVType_Null: {
+            mJson += "null";
+            break;
+        }
+
+        case TLV::kTLVType_Structure: {
+            ReturnErrorOnFailure(EncodeStructure(reader));
+            break;
+        }
+
+        case TLV::kTLVType_Array: {
+            CHIP_ERROR err;
+            ElementTypeContext firstType;
+            TLV::TLVType containerType;
+            bool first = true;
+
+            ReturnErrorOnFailure(reader.EnterContainer(containerType));
+            mJson += '[';
+
+            while ((err = reader.Next()) == CHIP_NO_ERROR)
+            {
+                VerifyOrReturnError(reader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
+                VerifyOrReturnError(reader.GetType() != TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
+
+                ElementTypeContext type = GetElementType(reader);
+                if (first)
+                {
+                    firstType = type;
+                }
+                else
+                {
+                    VerifyOrReturnError(firstType.tlvType == type.tlvType && firstType.isDouble == type.isDouble,
+                                        CHIP_ERROR_INVALID_TLV_ELEMENT);
+                    mJson += ',';
+                }
+                first = false;
+
+                ReturnErrorOnFailure(EncodeValue(reader));
+            }
+
+            VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+            mJson += ']';
+            ReturnErrorOnFailure(reader.ExitContainer(containerType));
+            break;
+        }
+
+        default:
+            return CHIP_ERROR_INVALID_TLV_ELEMENT;
+        }
+
+        return CHIP_NO_ERROR;
+    }
+
+    template <typename T>
+    void AppendNumber(T value, bool quoted = false)
+    {
+        char buffer[24];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        if (quoted)
+        {
+            mJson += '"';
+        }
+        mJson.append(buffer, static_cast<size_t>(result.ptr - buffer));
+        if (quoted)
+        {
+            mJson += '"';
+        }
+    }
+
+    void AppendString(CharSpan value)
+    {
+        static const char kHexDigits[] = "0123456789abcdef";
+
+        mJson += '"';
+        size_t runStart = 0;
+        for (size_t i = 0; i < value.size(); i++)
+        {
+            uint8_t c = static_cast<uint8_t>(value.data()[i]);
+            if (c != '"' && c != '\\' && c >= 0x20)
+            {
+                continue;
+            }
+
+            mJson.append(value.data() + runStart, i - runStart);
+            runStart = i + 1;
+            switch (c)
+            {
+            case '"':
+                mJson += "\\\"";
+                break;
+            case '\\':
+                mJson += "\\\\";
+                break;
+            case '\n':
+                mJson += "\\n";
+                break;
+            case '\r':
+                mJson += "\\r";
+                break;
+            case '\t':
+                mJson += "\\t";
+                break;
+            default:
+                mJson += "\\u00";
+                mJson += kHexDigits[c >> 4];
+                mJson += kHexDigits[c & 0xF];
+                break;
+            }
+        }
+        mJson.append(value.data() + runStart, value.size() - runStart);
+        mJson += '"';
+    }
+
+    std::string & mJson;
+};
+
+} // namespace
+
+CHIP_ERROR StreamJsonToTlv(CharSpan json, MutableByteSpan & tlv)
+{
+    TLV::TLVWriter writer;
+    writer.Init(tlv);
+    writer.ImplicitProfileId = kTemporaryImplicitProfileId;
+    ReturnErrorOnFailure(StreamJsonToTlv(json, writer));
+    ReturnErrorOnFailure(writer.Finalize());
+    tlv.reduce_size(writer.GetLengthWritten());
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR StreamJsonToTlv(CharSpan json, TLV::TLVWriter & writer)
+{
+    // See JsonToTlv(): tags that are neither context nor vendor tags are encoded with a temporary implicit profile.
+    if (writer.ImplicitProfileId == TLV::kProfileIdNotSpecified)
+    {
+        writer.ImplicitProfileId = kTemporaryImplicitProfileId;
+    }
+
+    JsonToTlvEncoder encoder(json, writer);
+    return encoder.Encode();
+}
+
+CHIP_ERROR StreamTlvToJson(const ByteSpan & tlv, std::string & jsonString)
+{
+    TLV::TLVReader reader;
+    reader.Init(tlv);
+    reader.ImplicitProfileId = kTemporaryImplicitProfileId;
+
+    ReturnErrorOnFailure(reader.Next());
+    return StreamTlvToJson(reader, jsonString);
+}
+
+CHIP_ERROR StreamTlvToJson(TLV::TLVReader & reader, std::string & jsonString)
+{
+    // The top level element must be a TLV Structure of Anonymous type.
+    VerifyOrReturnError(reader.GetType() == TLV::kTLVType_Structure, CHIP_ERROR_WRONG_TLV_TYPE);
+    VerifyOrReturnError(reader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
+
+    // During json conversion, a implicit profile ID is required
+    uint32_t oldImplicitProfileId = reader.ImplicitProfileId;
+    reader.ImplicitProfileId      = kTemporaryImplicitProfileId;
+
+    jsonString.clear();
+    TlvToJsonEncoder encoder(jsonString);
+    CHIP_ERROR err = encoder.EncodeStructure(reader);
+
+    reader.ImplicitProfileId = oldImplicitProfileId;
+    return err;
+}
+
+} // namespace chip
@@ -0,0 +1,64 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/TLV.h>
+#include <lib/support/Span.h>
+#include <string>
+
+namespace chip {
+
+/*
+ * Streaming counterparts of JsonToTlv() and TlvToJson(), for the same JSON format (see README.md).
+ *
+ * Rather than building a Json::Value tree of the whole payload, these tokenize the JSON text (or walk the TLV
+ * reader) and write the other representation as they go. Working memory is bounded by the nesting depth of
+ * the payload, the number of members of the structures being converted and the largest escaped string or byte
+ * string value; the output itself is the only allocation that grows with the payload.
+ */
+
+/*
+ * Given a JSON object that represents TLV, this function writes the corresponding TLV bytes into the provided buffer.
+ * The size of tlv will be adjusted to the size of the actual data written to the buffer.
+ *
+ * Returns the same errors as JsonToTlv(): CHIP_ERROR_INTERNAL if the JSON text cannot be parsed, and
+ * CHIP_ERROR_INVALID_ARGUMENT if an element name or value does not follow the format.
+ */
+CHIP_ERROR StreamJsonToTlv(CharSpan json, MutableByteSpan & tlv);
+
+/*
+ * Given a JSON object that represents TLV, this function makes encode calls on the given TLVWriter to encode the corresponding TLV
+ * bytes.
+ */
+CHIP_ERROR StreamJsonToTlv(CharSpan json, TLV::TLVWriter & writer);
+
+/*
+ * Given a TLVReader positioned at a particular cluster data payload, this function converts the TLV data into
+ * compact JSON text. Members are written in TLV order.
+ *
+ * NOTE: Like TlvToJson(), this only accepts data model payloads for events/commands/attributes. The content of
+ * jsonString is unspecified if an error is returned.
+ */
+CHIP_ERROR StreamTlvToJson(TLV::TLVReader & reader, std::string & jsonString);
+
+/*
+ * Given a TLV encoded byte array, this function converts it into JSON text.
+ */
+CHIP_ERROR StreamTlvToJson(const ByteSpan & tlv, std::string & jsonString);
+
+} // namespace chip
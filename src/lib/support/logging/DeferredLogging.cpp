@@ -0,0 +1,380 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "DeferredLogging.h"
+
+#include <lib/support/logging/TextOnlyLogging.h>
+
+#include <algorithm>
+#include <atomic>
+#include <string.h>
+
+namespace chip {
+namespace Logging {
+
+static_assert(CHIP_CONFIG_DEFERRED_LOG_RECORD_COUNT > 0, "The deferred log ring buffer must hold at least one record");
+static_assert(CHIP_CONFIG_DEFERRED_LOG_ARGS_SIZE > 0 && CHIP_CONFIG_DEFERRED_LOG_ARGS_SIZE <= UINT8_MAX,
+              "The arguments length of a deferred log record is a single byte");
+
+namespace {
+
+constexpr uint8_t kMagic[] = { 'M', 'T', 'R', 'L' };
+
+/// Number of wire bytes of a record before its arguments
+constexpr size_t kRecordHeaderWireSize = 16;
+
+/// Number of serialized bytes logged per line by DumpToLog
+constexpr size_t kLogBytesPerLine = 32;
+
+struct Record
+{
+    const char * format;
+    uint8_t module;
+    uint8_t category;
+    uint8_t flags;
+    uint8_t argsLength;
+    uint8_t args[CHIP_CONFIG_DEFERRED_LOG_ARGS_SIZE];
+};
+
+/// Ring buffer slot. The sequence number is written last, so that a reader can
+/// detect a record that is being overwritten.
+struct RecordSlot
+{
+    std::atomic<uint32_t> sequence{ 0 }; // record sequence number + 1, 0 while empty or being written
+    Record record;
+};
+
+RecordSlot sSlots[CHIP_CONFIG_DEFERRED_LOG_RECORD_COUNT];
+std::atomic<uint32_t> sNextSequence{ 0 };
+
+void PutLittleEndian(uint8_t * out, uint64_t value, size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        out[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+/// Appends arguments to the args of a record, marking it truncated once one does not fit.
+class ArgumentEncoder
+{
+public:
+    explicit ArgumentEncoder(Record & record) : mRecord(record) {}
+
+    void PutValue(const DeferredLogArgument & arg)
+    {
+        using Type = DeferredLogArgument::Type;
+
+        switch (arg.GetType())
+        {
+        case Type::kInt32:
+        case Type::kUInt32:
+            Put(arg.GetType(), arg.GetUnsigned(), sizeof(uint32_t));
+            break;
+        case Type::kInt64:
+        case Type::kUInt64:
+            Put(arg.GetType(), arg.GetUnsigned(), sizeof(uint64_t));
+            break;
+        case Type::kDouble: {
+            double value = arg.GetDouble();
+            uint64_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            Put(Type::kDouble, bits, sizeof(bits));
+            break;
+        }
+        case Type::kPointer:
+            Put(Type::kPointer, reinterpret_cast<uintptr_t>(arg.GetPointer()), sizeof(uint64_t));
+            break;
+        case Type::kString:
+            // Not printed with %s: only the address is meaningful.
+            Put(Type::kPointer, reinterpret_cast<uintptr_t>(arg.GetString()), sizeof(uint64_t));
+            break;
+        case Type::kNone:
+            break;
+        }
+    }
+
+    void PutString(const char * str, size_t maxLength)
+    {
+        if (str == nullptr)
+        {
+            str = "(null)";
+        }
+
+        const size_t length = strnlen(str, std::min<size_t>(maxLength, CHIP_CONFIG_DEFERRED_LOG_MAX_STRING_LENGTH));
+        if (!Reserve(2 + length))
+        {
+            return;
+        }
+        mRecord.args[mRecord.argsLength++] = static_cast<uint8_t>(DeferredLogArgument::Type::kString);
+        mRecord.args[mRecord.argsLength++] = static_cast<uint8_t>(length);
+        memcpy(&mRecord.args[mRecord.argsLength], str, length);
+        mRecord.argsLength = static_cast<uint8_t>(mRecord.argsLength + length);
+    }
+
+private:
+    bool Reserve(size_t size)
+    {
+        if ((mRecord.flags & DeferredLog::kFlagTruncated) || size > sizeof(mRecord.args) - mRecord.argsLength)
+        {
+            mRecord.flags |= DeferredLog::kFlagTruncated;
+            return false;
+        }
+        return true;
+    }
+
+    void Put(DeferredLogArgument::Type type, uint64_t value, size_t size)
+    {
+        if (!Reserve(1 + size))
+        {
+            return;
+        }
+        mRecord.args[mRecord.argsLength++] = static_cast<uint8_t>(type);
+        PutLittleEndian(&mRecord.args[mRecord.argsLength], value, size);
+        mRecord.argsLength = static_cast<uint8_t>(mRecord.argsLength + size);
+    }
+
+    Record & mRecord;
+};
+
+bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+/// Encodes the arguments in the order of the conversions of the format, which is what the host decoder walks:
+/// strings printed with %s are copied, up to their precision, and everything else is kept as a raw value.
+void EncodeArguments(Record & record, const char * format, const DeferredLogArgument * args, size_t count)
+{
+    ArgumentEncoder encoder(record);
+    size_t next = 0;
+
+    for (const char * p = strchr(format, '%'); p != nullptr && next < count; p = strchr(p, '%'))
+    {
+        p++;
+        if (*p == '%')
+        {
+            p++;
+            continue;
+        }
+
+        while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0')
+        {
+            p++;
+        }
+
+        if (*p == '*')
+        {
+            encoder.PutValue(args[next++]);
+            p++;
+        }
+        while (IsDigit(*p))
+        {
+            p++;
+        }
+
+        size_t precision = SIZE_MAX;
+        if (*p == '.')
+        {
+            p++;
+            if (*p == '*')
+            {
+                if (next < count)
+                {
+                    const DeferredLogArgument & arg = args[next++];
+                    if ((arg.GetType() == DeferredLogArgument::Type::kInt32 && arg.GetSigned() >= 0) ||
+                        arg.GetType() == DeferredLogArgument::Type::kUInt32)
+                    {
+                        precision = static_cast<size_t>(arg.GetUnsigned());
+                    }
+                    encoder.PutValue(arg);
+                }
+                p++;
+            }
+            else
+            {
+                precision = 0;
+                while (IsDigit(*p))
+                {
+                    precision = precision * 10 + static_cast<size_t>(*p - '0');
+                    p++;
+                }
+            }
+        }
+
+        while (*p == 'h' || *p == 'l' || *p == 'L' || *p == 'q' || *p == 'j' || *p == 'z' || *p == 't')
+        {
+            p++;
+        }
+
+        if (*p == '\0' || next >= count)
+        {
+            break;
+        }
+
+        const DeferredLogArgument & arg = args[next++];
+        if (*p == 's' && arg.GetType() == DeferredLogArgument::Type::kString)
+        {
+            encoder.PutString(arg.GetString(), precision);
+        }
+        else if (*p == 's' && arg.GetType() == DeferredLogArgument::Type::kPointer)
+        {
+            encoder.PutString(static_cast<const char *>(arg.GetPointer()), precision);
+        }
+        else
+        {
+            encoder.PutValue(arg);
+        }
+        p++;
+    }
+}
+
+class LogDumpWriter : public DeferredLogWriter
+{
+public:
+    CHIP_ERROR Write(const uint8_t * data, size_t length) override
+    {
+        static constexpr char kHexDigits[] = "0123456789ABCDEF";
+
+        while (length > 0)
+        {
+            const size_t lineLength = std::min(length, kLogBytesPerLine);
+            char hex[kLogBytesPerLine * 2 + 1];
+
+            for (size_t i = 0; i < lineLength; i++)
+            {
+                hex[2 * i]     = kHexDigits[data[i] >> 4];
+                hex[2 * i + 1] = kHexDigits[data[i] & 0xF];
+            }
+            hex[2 * lineLength] = '\0';
+
+            // Logged as text whatever the category, so the dump does not end up in the ring buffer itself.
+            Log(kLogModule_Support, kLogCategory_Progress, "%s%s", DeferredLog::kLogLinePrefix, hex);
+            data += lineLength;
+            length -= lineLength;
+        }
+
+        return CHIP_NO_ERROR;
+    }
+};
+
+} // namespace
+
+void AppendDeferredLog(uint8_t module, uint8_t category, const char * format, const DeferredLogArgument * args, size_t count)
+{
+    Record record;
+    record.format     = format;
+    record.module     = module;
+    record.category   = category;
+    record.flags      = 0;
+    record.argsLength = 0;
+    EncodeArguments(record, format, args, count);
+
+    const uint32_t sequence = sNextSequence.fetch_add(1, std::memory_order_relaxed);
+    RecordSlot & slot       = sSlots[sequence % CHIP_CONFIG_DEFERRED_LOG_RECORD_COUNT];
+
+    slot.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.record.format     = record.format;
+    slot.record.module     = record.module;
+    slot.record.category   = record.category;
+    slot.record.flags      = record.flags;
+    slot.record.argsLength = record.argsLength;
+    memcpy(slot.record.args, record.args, record.argsLength);
+
+    slot.sequence.store(sequence + 1, std::memory_order_release);
+}
+
+namespace DeferredLog {
+
+const char kAnchor[] = "MatterDeferredLogAnchor";
+
+CHIP_ERROR Dump(DeferredLogWriter & writer)
+{
+    const uint32_t nextSequence = sNextSequence.load(std::memory_order_acquire);
+
+    uint8_t header[kHeaderWireSize];
+    memcpy(header, kMagic, sizeof(kMagic));
+    header[4] = kFormatVersion;
+    header[5] = static_cast<uint8_t>(CHIP_CONFIG_DEFERRED_LOG_ARGS_SIZE);
+    header[6] = 0;
+    header[7] = 0;
+    PutLittleEndian(&header[8], nextSequence, sizeof(uint32_t));
+    PutLittleEndian(&header[12], reinterpret_cast<uintptr_t>(kAnchor), sizeof(uint64_t));
+    CHIP_ERROR err = writer.Write(header, sizeof(header));
+
+    constexpr uint32_t kSlotCount = CHIP_CONFIG_DEFERRED_LOG_RECORD_COUNT;
+    const uint32_t firstSequence  = nextSequence > kSlotCount ? nextSequence - kSlotCount : 0;
+    for (uint32_t sequence = firstSequence; sequence != nextSequence && err == CHIP_NO_ERROR; sequence++)
+    {
+        const RecordSlot & slot = sSlots[sequence % kSlotCount];
+
+        if (slot.sequence.load(std::memory_order_acquire) != sequence + 1)
+        {
+            continue;
+        }
+
+        uint8_t buffer[kRecordHeaderWireSize + CHIP_CONFIG_DEFERRED_LOG_ARGS_SIZE];
+        const Record & record   = slot.record;
+        const size_t argsLength = std::min<size_t>(record.argsLength, sizeof(record.args));
+        PutLittleEndian(&buffer[0], sequence, sizeof(uint32_t));
+        PutLittleEndian(&buffer[4], reinterpret_cast<uintptr_t>(record.format), sizeof(uint64_t));
+        buffer[12] = record.module;
+        buffer[13] = record.category;
+        buffer[14] = record.flags;
+        buffer[15] = static_cast<uint8_t>(argsLength);
+        memcpy(&buffer[kRecordHeaderWireSize], record.args, argsLength);
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        // Skip records overwritten while they were copied
+        if (slot.sequence.load(std::memory_order_relaxed) != sequence + 1)
+        {
+            continue;
+        }
+
+        err = writer.Write(buffer, kRecordHeaderWireSize + argsLength);
+    }
+
+    return err;
+}
+
+CHIP_ERROR DumpToLog()
+{
+    LogDumpWriter writer;
+    return Dump(writer);
+}
+
+void Clear()
+{
+    for (auto & slot : sSlots)
+    {
+        slot.sequence.store(0, std::memory_order_relaxed);
+    }
+    sNextSequence.store(0, std::memory_order_release);
+}
+
+uint32_t RecordsWritten()
+{
+    return sNextSequence.load(std::memory_order_relaxed);
+}
+
+} // namespace DeferredLog
+
+} // namespace Logging
+} // namespace chip
@@ -0,0 +1,176 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Deferred formatting of log messages (CHIP_DEFERRED_LOGGING).
+ *
+ *      In this mode ChipLogProgress() and ChipLogDetail() do not format their
+ *      message: they record the address of the format string and the raw
+ *      arguments, strings copied, in a ring buffer of fixed-size records.
+ *      Errors and automation logs are still formatted and logged right away.
+ *
+ *      The ring buffer is dumped on demand, as bytes or as hex lines logged
+ *      with the kLogLinePrefix prefix, and decoded on a host from the firmware
+ *      image using scripts/tools/decode_deferred_logs.py.
+ *
+ *      Dump format (little-endian):
+ *        - header:  "MTRL", version (1B), CHIP_CONFIG_DEFERRED_LOG_ARGS_SIZE (1B), reserved (2B),
+ *                   number of records ever written (4B), address of kAnchor (8B)
+ *        - records: sequence number (4B), format string address (8B),
+ *                   module (1B), category (1B), flags (1B), arguments length (1B),
+ *                   arguments
+ *
+ *      Each argument is a DeferredLogArgument::Type byte followed by its value:
+ *      4 or 8 bytes for numbers and pointers, a length byte and the characters
+ *      for strings.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/logging/Constants.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace chip {
+namespace Logging {
+
+/**
+ * An argument of a deferred log message, captured with its type.
+ */
+class DeferredLogArgument
+{
+public:
+    enum class Type : uint8_t
+    {
+        kNone    = 0,
+        kInt32   = 1,
+        kUInt32  = 2,
+        kInt64   = 3,
+        kUInt64  = 4,
+        kDouble  = 5,
+        kPointer = 6,
+        kString  = 7,
+    };
+
+    constexpr DeferredLogArgument() : mType(Type::kNone), mUnsigned(0) {}
+
+    template <typename T, std::enable_if_t<std::is_integral<T>::value, int> = 0>
+    constexpr DeferredLogArgument(T value) :
+        mType(std::is_signed<T>::value ? (sizeof(T) > sizeof(int32_t) ? Type::kInt64 : Type::kInt32)
+                                       : (sizeof(T) > sizeof(uint32_t) ? Type::kUInt64 : Type::kUInt32)),
+        mUnsigned(std::is_signed<T>::value ? static_cast<uint64_t>(static_cast<int64_t>(value)) : static_cast<uint64_t>(value))
+    {}
+
+    template <typename T, std::enable_if_t<std::is_enum<T>::value, int> = 0>
+    constexpr DeferredLogArgument(T value) : DeferredLogArgument(static_cast<std::underlying_type_t<T>>(value))
+    {}
+
+    template <typename T, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+    constexpr DeferredLogArgument(T value) : mType(Type::kDouble), mDouble(static_cast<double>(value))
+    {}
+
+    constexpr DeferredLogArgument(const char * value) : mType(Type::kString), mString(value) {}
+    constexpr DeferredLogArgument(const void * value) : mType(Type::kPointer), mPointer(value) {}
+    constexpr DeferredLogArgument(std::nullptr_t) : mType(Type::kPointer), mPointer(nullptr) {}
+
+    template <typename T, std::enable_if_t<std::is_function<T>::value, int> = 0>
+    DeferredLogArgument(T * value) : mType(Type::kPointer), mPointer(reinterpret_cast<const void *>(value))
+    {}
+
+    Type GetType() const { return mType; }
+    int64_t GetSigned() const { return mSigned; }
+    uint64_t GetUnsigned() const { return mUnsigned; }
+    double GetDouble() const { return mDouble; }
+    const void * GetPointer() const { return mPointer; }
+    const char * GetString() const { return mString; }
+
+private:
+    Type mType;
+    union
+    {
+        int64_t mSigned;
+        uint64_t mUnsigned;
+        double mDouble;
+        const void * mPointer;
+        const char * mString;
+    };
+};
+
+/**
+ * Record a log message in the deferred log ring buffer.
+ *
+ * @param[in] format  The printf-style format, which must outlive the ring buffer (i.e. a string literal).
+ */
+void AppendDeferredLog(uint8_t module, uint8_t category, const char * format, const DeferredLogArgument * args, size_t count);
+
+template <typename... Args>
+inline void LogDeferred(uint8_t module, uint8_t category, const char * format, const Args &... args)
+{
+    const DeferredLogArgument arguments[] = { DeferredLogArgument(args)..., DeferredLogArgument() };
+    AppendDeferredLog(module, category, format, arguments, sizeof...(Args));
+}
+
+/// Whether messages of a category are deferred rather than formatted right away.
+constexpr bool IsDeferredCategory(uint8_t category)
+{
+    return category == kLogCategory_Progress || category == kLogCategory_Detail;
+}
+
+/// Receives the serialized content of the deferred log ring buffer in successive pieces
+class DeferredLogWriter
+{
+public:
+    virtual ~DeferredLogWriter() = default;
+
+    virtual CHIP_ERROR Write(const uint8_t * data, size_t length) = 0;
+};
+
+namespace DeferredLog {
+
+constexpr uint8_t kFormatVersion = 1;
+constexpr size_t kHeaderWireSize = 20;
+constexpr char kLogLinePrefix[]  = "dlog\t";
+
+/// Flag of a record whose arguments did not all fit in CHIP_CONFIG_DEFERRED_LOG_ARGS_SIZE bytes
+constexpr uint8_t kFlagTruncated = 0x01;
+
+/// A string placed in the firmware image and whose address is part of the dump, so that the host
+/// can relocate the format string addresses of position-independent images.
+extern const char kAnchor[];
+
+/// Serialize the records of the ring buffer, oldest first, to the given writer
+CHIP_ERROR Dump(DeferredLogWriter & writer);
+
+/// Serialize the records of the ring buffer to formatted logging as hex lines prefixed with kLogLinePrefix
+CHIP_ERROR DumpToLog();
+
+/// Discard all records. Records being written concurrently are dropped as well.
+void Clear();
+
+/// Total number of records written, including the ones that have been overwritten
+uint32_t RecordsWritten();
+
+} // namespace DeferredLog
+
+} // namespace Logging
+} // namespace chip
@@ -55,6 +55,10 @@
 #include "pw_tokenizer/tokenize.h"
 #endif
 
+#if CHIP_DEFERRED_LOGGING
+#include <lib/support/logging/DeferredLogging.h>
+#endif
+
 /**
  *   @namespace chip::Logging
  *
@@ -460,6 +464,23 @@ void HandleTokenizedLog(uint32_t levels, pw_tokenizer_Token token, pw_tokenizer_
                                                 PW_TOKENIZER_ARG_TYPES(__VA_ARGS__) PW_COMMA_ARGS(__VA_ARGS__));                   \
         }                                                                                                                          \
     } while (0)
+#elif CHIP_DEFERRED_LOGGING
+// Both branches are compiled, so the format is still checked against the arguments by Log().
+#define ChipInternalLogImpl(MOD, CAT, MSG, ...)                                                                                    \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        if (chip::Logging::IsCategoryEnabled(CAT))                                                                                 \
+        {                                                                                                                          \
+            if (chip::Logging::IsDeferredCategory(CAT))                                                                            \
+            {                                                                                                                      \
+                chip::Logging::LogDeferred(chip::Logging::kLogModule_##MOD, CAT, MSG, ##__VA_ARGS__);                              \
+            }                                                                                                                      \
+            else                                                                                                                   \
+            {                                                                                                                      \
+                chip::Logging::Log(chip::Logging::kLogModule_##MOD, CAT, MSG, ##__VA_ARGS__);                                      \
+            }                                                                                                                      \
+        }                                                                                                                          \
+    } while (0)
 #else // CHIP_PW_TOKENIZER_LOGGING
 #define ChipInternalLogImpl(MOD, CAT, MSG, ...)                                                                                    \
     do                                                                                                                             \
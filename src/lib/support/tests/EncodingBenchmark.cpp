@@ -0,0 +1,162 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  @file
+ *    Measures the byte loops of lib/support over payloads of various sizes:
+ *      - base64 encode/decode, with the standard alphabet and with conversion functions
+ *      - hex encoding
+ *      - UTF-8 validation of ASCII and of mixed text
+ *
+ *    Each measurement is printed on a single line of space-separated key=value pairs,
+ *    starting with "BENCHMARK", so that results can be collected and compared across runs,
+ *    for instance with CHIP_CONFIG_ENABLE_SIMD set to 0 and 1.
+ *    Usage: encoding-benchmark [--gtest_filter=EncodingBenchmark.<Scenario>]
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/support/Base64.h>
+#include <lib/support/BytesToHex.h>
+#include <lib/support/Simd.h>
+#include <lib/support/Span.h>
+#include <lib/support/utf8.h>
+
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+using namespace chip;
+
+namespace {
+
+constexpr size_t kPayloadSizes[] = { 64, 1024, 16384 };
+
+// Roughly the same number of bytes is processed for each payload size
+constexpr size_t kBytesPerScenario = 64 * 1024 * 1024;
+
+class Stopwatch
+{
+public:
+    Stopwatch() : mStart(std::chrono::steady_clock::now()) {}
+
+    double ElapsedMicroseconds() const
+    {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - mStart).count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point mStart;
+};
+
+void PrintResult(const char * scenario, size_t payloadSize, uint32_t operations, double elapsedUs)
+{
+    printf("BENCHMARK scenario=%s simd=%d size=%u operations=%" PRIu32 " ns_per_op=%.1f mb_per_s=%.1f\n", scenario, CHIP_SIMD,
+           static_cast<unsigned>(payloadSize), operations, operations > 0 ? elapsedUs * 1000 / operations : 0.0,
+           elapsedUs > 0 ? static_cast<double>(operations) * static_cast<double>(payloadSize) / elapsedUs : 0.0);
+}
+
+template <typename Operation>
+void Measure(const char * scenario, size_t payloadSize, Operation operation)
+{
+    const uint32_t operations = static_cast<uint32_t>(kBytesPerScenario / payloadSize);
+    volatile size_t sink      = 0;
+
+    Stopwatch stopwatch;
+    for (uint32_t i = 0; i < operations; i++)
+    {
+        sink = sink + operation();
+    }
+    PrintResult(scenario, payloadSize, operations, stopwatch.ElapsedMicroseconds());
+}
+
+std::vector<uint8_t> MakePayload(size_t size)
+{
+    std::vector<uint8_t> payload(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        payload[i] = static_cast<uint8_t>(i * 193 + 17);
+    }
+    return payload;
+}
+
+char ReferenceValToChar(uint8_t val)
+{
+    static const char kAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    return val < 64 ? kAlphabet[val] : '=';
+}
+
+TEST(EncodingBenchmark, Base64)
+{
+    for (size_t size : kPayloadSizes)
+    {
+        const std::vector<uint8_t> payload = MakePayload(size);
+        std::vector<char> encoded(BASE64_ENCODED_LEN(size));
+        std::vector<uint8_t> decoded(size);
+        const uint32_t length = static_cast<uint32_t>(size);
+
+        Measure("base64_encode", size, [&] { return Base64Encode32(payload.data(), length, encoded.data()); });
+        Measure("base64_encode_funct", size,
+                [&] { return Base64Encode32(payload.data(), length, encoded.data(), ReferenceValToChar); });
+
+        const uint32_t encodedLength = static_cast<uint32_t>(encoded.size());
+        Measure("base64_decode", size, [&] { return Base64Decode32(encoded.data(), encodedLength, decoded.data()); });
+        ASSERT_EQ(memcmp(decoded.data(), payload.data(), size), 0);
+    }
+}
+
+TEST(EncodingBenchmark, BytesToHex)
+{
+    for (size_t size : kPayloadSizes)
+    {
+        const std::vector<uint8_t> payload = MakePayload(size);
+        std::vector<char> hex(2 * size);
+
+        Measure("bytes_to_hex", size, [&] {
+            return Encoding::BytesToHex(payload.data(), size, hex.data(), hex.size(), Encoding::HexFlags::kUppercase) ==
+                CHIP_NO_ERROR;
+        });
+    }
+}
+
+TEST(EncodingBenchmark, Utf8)
+{
+    for (size_t size : kPayloadSizes)
+    {
+        std::vector<char> ascii(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            ascii[i] = static_cast<char>('a' + i % 26);
+        }
+        ASSERT_TRUE(Utf8::IsValid(CharSpan(ascii.data(), size)));
+        Measure("utf8_ascii", size, [&] { return Utf8::IsValid(CharSpan(ascii.data(), size)); });
+
+        // A 2-byte sequence every 16 characters
+        std::vector<char> mixed = ascii;
+        for (size_t i = 0; i + 1 < size; i += 16)
+        {
+            mixed[i]     = static_cast<char>(0xC3);
+            mixed[i + 1] = static_cast<char>(0xA9);
+        }
+        ASSERT_TRUE(Utf8::IsValid(CharSpan(mixed.data(), size)));
+        Measure("utf8_mixed", size, [&] { return Utf8::IsValid(CharSpan(mixed.data(), size)); });
+    }
+}
+
+} // namespace
@@ -0,0 +1,124 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/Base64.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <string.h>
+
+namespace {
+
+using namespace chip;
+
+// Reference alphabet, for the implementation that takes conversion functions
+char ValToChar(uint8_t val)
+{
+    static const char kAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    return val < 64 ? kAlphabet[val] : '=';
+}
+
+uint8_t CharToVal(uint8_t c)
+{
+    static const char kAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    const char * found            = (c != 0) ? strchr(kAlphabet, c) : nullptr;
+    return found != nullptr ? static_cast<uint8_t>(found - kAlphabet) : UINT8_MAX;
+}
+
+TEST(TestBase64, TestKnownVectors)
+{
+    // RFC 4648 section 10
+    const char * vectors[][2] = {
+        { "", "" },           { "f", "Zg==" },         { "fo", "Zm8=" },         { "foo", "Zm9v" },
+        { "foob", "Zm9vYg==" }, { "fooba", "Zm9vYmE=" }, { "foobar", "Zm9vYmFy" },
+    };
+
+    for (const auto & vector : vectors)
+    {
+        const uint16_t length = static_cast<uint16_t>(strlen(vector[0]));
+        char encoded[16];
+        uint8_t decoded[16];
+
+        uint16_t encodedLength = Base64Encode(reinterpret_cast<const uint8_t *>(vector[0]), length, encoded);
+        ASSERT_EQ(encodedLength, strlen(vector[1]));
+        EXPECT_EQ(memcmp(encoded, vector[1], encodedLength), 0);
+
+        uint16_t decodedLength = Base64Decode(vector[1], encodedLength, decoded);
+        ASSERT_EQ(decodedLength, length);
+        EXPECT_EQ(memcmp(decoded, vector[0], length), 0);
+    }
+
+    const uint8_t urlBytes[] = { 0xFB, 0xFF, 0xBF };
+    char encoded[4];
+    EXPECT_EQ(Base64URLEncode(urlBytes, sizeof(urlBytes), encoded), 4u);
+    EXPECT_EQ(memcmp(encoded, "-_-_", 4), 0);
+    EXPECT_EQ(Base64Encode(urlBytes, sizeof(urlBytes), encoded), 4u);
+    EXPECT_EQ(memcmp(encoded, "+/+/", 4), 0);
+}
+
+TEST(TestBase64, TestMatchesGenericImplementation)
+{
+    uint8_t bytes[300];
+    for (size_t i = 0; i < sizeof(bytes); i++)
+    {
+        bytes[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+
+    // Lengths around the vectorized blocks and every padding case
+    for (uint16_t length = 0; length <= sizeof(bytes); length++)
+    {
+        char encoded[BASE64_ENCODED_LEN(sizeof(bytes))];
+        char expected[BASE64_ENCODED_LEN(sizeof(bytes))];
+
+        uint16_t encodedLength = Base64Encode(bytes, length, encoded);
+        ASSERT_EQ(Base64Encode(bytes, length, expected, ValToChar), encodedLength);
+        ASSERT_EQ(encodedLength, BASE64_ENCODED_LEN(length));
+        EXPECT_EQ(memcmp(encoded, expected, encodedLength), 0);
+        EXPECT_EQ(Base64Encode32(bytes, length, encoded), encodedLength);
+        EXPECT_EQ(memcmp(encoded, expected, encodedLength), 0);
+
+        uint8_t decoded[sizeof(bytes)];
+        ASSERT_EQ(Base64Decode(encoded, encodedLength, decoded), length);
+        EXPECT_EQ(memcmp(decoded, bytes, length), 0);
+        ASSERT_EQ(Base64Decode(encoded, encodedLength, decoded, CharToVal), length);
+        EXPECT_EQ(memcmp(decoded, bytes, length), 0);
+        ASSERT_EQ(Base64Decode32(encoded, encodedLength, decoded), length);
+        EXPECT_EQ(memcmp(decoded, bytes, length), 0);
+
+        // In place
+        ASSERT_EQ(Base64Decode(encoded, encodedLength, reinterpret_cast<uint8_t *>(encoded)), length);
+        EXPECT_EQ(memcmp(encoded, bytes, length), 0);
+    }
+}
+
+TEST(TestBase64, TestDecodeErrors)
+{
+    uint8_t decoded[64];
+
+    // An invalid character after groups that decode fine
+    EXPECT_EQ(Base64Decode("Zm9vYmFyZm9v*mFy", 16, decoded), UINT16_MAX);
+    EXPECT_EQ(Base64URLDecode("Zm9vYmFy+m9v", 12, decoded), UINT16_MAX);
+    EXPECT_EQ(Base64Decode("Zm9vYmFyZ", 9, decoded), UINT16_MAX);
+
+    // Decoding stops at padding and at the first space or control character
+    EXPECT_EQ(Base64Decode("Zm9vYg==Zm9v", 12, decoded), 4u);
+    EXPECT_EQ(Base64Decode("Zm9vYmFy Zm9v", 13, decoded), 6u);
+    EXPECT_EQ(Base64Decode("Zm9vYmFy\0Zm9v", 13, decoded), 6u);
+}
+
+} // namespace
@@ -212,6 +212,37 @@ TEST(TestBytesToHex, TestBytesToHexErrors)
     }
 }
 
+TEST(TestBytesToHex, TestBytesToHexLongInputs)
+{
+    // Covers every byte value, at every offset of the vectorized blocks and in the scalar tail.
+    uint8_t src[256 + 7];
+    for (size_t i = 0; i < sizeof(src); i++)
+    {
+        src[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+
+    for (size_t length = 0; length <= sizeof(src); length += 13)
+    {
+        char dest[(sizeof(src) * 2) + 1];
+        char expected[(sizeof(src) * 2) + 1];
+
+        for (size_t i = 0; i < length; i++)
+        {
+            snprintf(&expected[2 * i], 3, "%02x", src[i]);
+        }
+        EXPECT_EQ(BytesToHex(src, length, dest, sizeof(dest), HexFlags::kNullTerminate), CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(dest, expected, 2 * length), 0);
+        EXPECT_EQ(dest[2 * length], '\0');
+
+        for (size_t i = 0; i < length; i++)
+        {
+            snprintf(&expected[2 * i], 3, "%02X", src[i]);
+        }
+        EXPECT_EQ(BytesToHex(src, length, dest, 2 * length, HexFlags::kUppercase), CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(dest, expected, 2 * length), 0);
+    }
+}
+
 TEST(TestBytesToHex, TestBytesToHexUint64)
 {
     // Different values in each byte and each nibble should let us know if the conversion is correct.
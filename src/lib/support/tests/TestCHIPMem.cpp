@@ -170,3 +170,50 @@ TEST_F(TestCHIPMem, TestMemAlloc_SharedPtr)
     EXPECT_EQ(otherInstanceConstructorCalled, 1);
     EXPECT_EQ(otherInstanceDestructorCalled, 0);
 }
+
+#if CHIP_CONFIG_MEMORY_TAGGING
+TEST_F(TestCHIPMem, TestMemAlloc_Tagging)
+{
+    const MemoryTagStatistics before = GetMemoryTagStatistics(MemoryTag::kTransport);
+    void * untagged                  = MemoryAlloc(16);
+    ASSERT_NE(untagged, nullptr);
+
+    void * p = nullptr;
+    {
+        CHIP_MEMORY_TAG_SCOPE(kTransport);
+        EXPECT_EQ(GetCurrentMemoryTag(), MemoryTag::kTransport);
+
+        p = MemoryAlloc(100);
+        ASSERT_NE(p, nullptr);
+
+        {
+            // Scopes nest, the innermost getting the allocations
+            CHIP_MEMORY_TAG_SCOPE(kDnssd);
+            EXPECT_EQ(GetCurrentMemoryTag(), MemoryTag::kDnssd);
+        }
+        EXPECT_EQ(GetCurrentMemoryTag(), MemoryTag::kTransport);
+    }
+    EXPECT_EQ(GetCurrentMemoryTag(), MemoryTag::kUntagged);
+
+    MemoryTagStatistics stats = GetMemoryTagStatistics(MemoryTag::kTransport);
+    EXPECT_EQ(stats.liveBytes, before.liveBytes + 100);
+    EXPECT_EQ(stats.allocations, before.allocations + 1);
+
+    // A reallocation stays with the tag of the original allocation
+    p = MemoryRealloc(p, 300);
+    ASSERT_NE(p, nullptr);
+    stats = GetMemoryTagStatistics(MemoryTag::kTransport);
+    EXPECT_EQ(stats.liveBytes, before.liveBytes + 300);
+    EXPECT_GE(stats.peakBytes, before.liveBytes + 300);
+
+    MemoryFree(p);
+    stats = GetMemoryTagStatistics(MemoryTag::kTransport);
+    EXPECT_EQ(stats.liveBytes, before.liveBytes);
+    EXPECT_GE(stats.peakBytes, before.liveBytes + 300);
+
+    ResetMemoryTagPeaks();
+    EXPECT_EQ(GetMemoryTagStatistics(MemoryTag::kTransport).peakBytes, before.liveBytes);
+
+    MemoryFree(untagged);
+}
+#endif // CHIP_CONFIG_MEMORY_TAGGING
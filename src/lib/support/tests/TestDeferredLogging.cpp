@@ -0,0 +1,201 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/logging/CHIPLogging.h>
+#include <lib/support/logging/DeferredLogging.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <cinttypes>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Logging;
+
+using Type = DeferredLogArgument::Type;
+
+class VectorWriter : public DeferredLogWriter
+{
+public:
+    CHIP_ERROR Write(const uint8_t * data, size_t length) override
+    {
+        mBytes.insert(mBytes.end(), data, data + length);
+        return CHIP_NO_ERROR;
+    }
+
+    std::vector<uint8_t> mBytes;
+};
+
+uint64_t GetLittleEndian(const uint8_t * in, size_t size)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        value |= static_cast<uint64_t>(in[i]) << (8 * i);
+    }
+    return value;
+}
+
+struct DecodedRecord
+{
+    uint32_t sequence;
+    const char * format;
+    uint8_t module;
+    uint8_t category;
+    uint8_t flags;
+    std::vector<uint8_t> args;
+};
+
+std::vector<DecodedRecord> DumpRecords()
+{
+    VectorWriter writer;
+    EXPECT_EQ(DeferredLog::Dump(writer), CHIP_NO_ERROR);
+
+    std::vector<DecodedRecord> records;
+    const std::vector<uint8_t> & bytes = writer.mBytes;
+    EXPECT_GE(bytes.size(), DeferredLog::kHeaderWireSize);
+    EXPECT_EQ(memcmp(bytes.data(), "MTRL", 4), 0);
+    EXPECT_EQ(bytes[4], DeferredLog::kFormatVersion);
+    EXPECT_EQ(GetLittleEndian(&bytes[12], 8), reinterpret_cast<uintptr_t>(DeferredLog::kAnchor));
+
+    size_t offset = DeferredLog::kHeaderWireSize;
+    while (offset + 16 <= bytes.size())
+    {
+        DecodedRecord record;
+        record.sequence = static_cast<uint32_t>(GetLittleEndian(&bytes[offset], 4));
+        record.format   = reinterpret_cast<const char *>(static_cast<uintptr_t>(GetLittleEndian(&bytes[offset + 4], 8)));
+        record.module   = bytes[offset + 12];
+        record.category = bytes[offset + 13];
+        record.flags    = bytes[offset + 14];
+        size_t length   = bytes[offset + 15];
+        record.args.assign(bytes.begin() + static_cast<std::ptrdiff_t>(offset + 16),
+                           bytes.begin() + static_cast<std::ptrdiff_t>(offset + 16 + length));
+        records.push_back(record);
+        offset += 16 + length;
+    }
+    EXPECT_EQ(offset, bytes.size());
+    return records;
+}
+
+class TestDeferredLogging : public ::testing::Test
+{
+public:
+    void SetUp() override { DeferredLog::Clear(); }
+};
+
+TEST_F(TestDeferredLogging, TestArgumentEncoding)
+{
+    static const char kFormat[] = "int=%d u8=%u u64=%" PRIu64 " ptr=%p str=%s";
+    int dummy;
+
+    LogDeferred(kLogModule_Test, kLogCategory_Progress, kFormat, -2, static_cast<uint8_t>(7), static_cast<uint64_t>(1) << 40,
+                static_cast<void *>(&dummy), "hello");
+
+    std::vector<DecodedRecord> records = DumpRecords();
+    ASSERT_EQ(records.size(), 1u);
+
+    const DecodedRecord & record = records[0];
+    EXPECT_EQ(record.sequence, 0u);
+    EXPECT_EQ(record.format, kFormat);
+    EXPECT_EQ(record.module, kLogModule_Test);
+    EXPECT_EQ(record.category, kLogCategory_Progress);
+    EXPECT_EQ(record.flags, 0);
+
+    const uint8_t * p = record.args.data();
+    EXPECT_EQ(p[0], static_cast<uint8_t>(Type::kInt32));
+    EXPECT_EQ(static_cast<int32_t>(GetLittleEndian(p + 1, 4)), -2);
+    p += 5;
+    EXPECT_EQ(p[0], static_cast<uint8_t>(Type::kUInt32));
+    EXPECT_EQ(GetLittleEndian(p + 1, 4), 7u);
+    p += 5;
+    EXPECT_EQ(p[0], static_cast<uint8_t>(Type::kUInt64));
+    EXPECT_EQ(GetLittleEndian(p + 1, 8), static_cast<uint64_t>(1) << 40);
+    p += 9;
+    EXPECT_EQ(p[0], static_cast<uint8_t>(Type::kPointer));
+    EXPECT_EQ(GetLittleEndian(p + 1, 8), reinterpret_cast<uintptr_t>(&dummy));
+    p += 9;
+    EXPECT_EQ(p[0], static_cast<uint8_t>(Type::kString));
+    ASSERT_EQ(p[1], 5u);
+    EXPECT_EQ(memcmp(p + 2, "hello", 5), 0);
+    p += 7;
+    EXPECT_EQ(p, record.args.data() + record.args.size());
+}
+
+TEST_F(TestDeferredLogging, TestStringPrecision)
+{
+    // The characters past the precision are neither read nor copied.
+    const char notTerminated[] = { 'a', 'b', 'c', 'd' };
+    LogDeferred(kLogModule_Test, kLogCategory_Detail, "%.*s|%.2s|%s", 3, notTerminated, "xyz", nullptr);
+
+    std::vector<DecodedRecord> records = DumpRecords();
+    ASSERT_EQ(records.size(), 1u);
+
+    const std::vector<uint8_t> & args = records[0].args;
+    const uint8_t expected[]          = {
+        static_cast<uint8_t>(Type::kInt32), 3, 0, 0, 0, static_cast<uint8_t>(Type::kString), 3, 'a', 'b', 'c',
+        static_cast<uint8_t>(Type::kString), 2, 'x', 'y', static_cast<uint8_t>(Type::kString), 6, '(', 'n', 'u', 'l', 'l', ')',
+    };
+    ASSERT_EQ(args.size(), sizeof(expected));
+    EXPECT_EQ(memcmp(args.data(), expected, sizeof(expected)), 0);
+}
+
+TEST_F(TestDeferredLogging, TestTruncation)
+{
+    char longString[CHIP_CONFIG_DEFERRED_LOG_ARGS_SIZE + 1];
+    memset(longString, 'x', sizeof(longString) - 1);
+    longString[sizeof(longString) - 1] = '\0';
+
+    LogDeferred(kLogModule_Test, kLogCategory_Progress, "%u %s %s %s", 1u, longString, longString, longString);
+
+    std::vector<DecodedRecord> records = DumpRecords();
+    ASSERT_EQ(records.size(), 1u);
+    EXPECT_EQ(records[0].flags, DeferredLog::kFlagTruncated);
+    EXPECT_LE(records[0].args.size(), static_cast<size_t>(CHIP_CONFIG_DEFERRED_LOG_ARGS_SIZE));
+    EXPECT_EQ(records[0].args[0], static_cast<uint8_t>(Type::kUInt32));
+}
+
+TEST_F(TestDeferredLogging, TestRingBufferWraps)
+{
+    for (uint32_t i = 0; i < CHIP_CONFIG_DEFERRED_LOG_RECORD_COUNT + 3; i++)
+    {
+        LogDeferred(kLogModule_Test, kLogCategory_Progress, "%u", i);
+    }
+    EXPECT_EQ(DeferredLog::RecordsWritten(), static_cast<uint32_t>(CHIP_CONFIG_DEFERRED_LOG_RECORD_COUNT + 3));
+
+    std::vector<DecodedRecord> records = DumpRecords();
+    ASSERT_EQ(records.size(), static_cast<size_t>(CHIP_CONFIG_DEFERRED_LOG_RECORD_COUNT));
+    EXPECT_EQ(records.front().sequence, 3u);
+    EXPECT_EQ(GetLittleEndian(&records.front().args[1], 4), 3u);
+    EXPECT_EQ(records.back().sequence, static_cast<uint32_t>(CHIP_CONFIG_DEFERRED_LOG_RECORD_COUNT + 2));
+}
+
+TEST_F(TestDeferredLogging, TestOnlyProgressAndDetailAreDeferred)
+{
+    ChipLogProgress(Test, "deferred %d", 1);
+    ChipLogDetail(Test, "deferred %d", 2);
+    ChipLogError(Test, "formatted %d", 3);
+
+#if CHIP_PROGRESS_LOGGING && CHIP_DETAIL_LOGGING
+    EXPECT_EQ(DeferredLog::RecordsWritten(), 2u);
+#endif
+}
+
+} // namespace
@@ -25,6 +25,7 @@
 #include <app/data-model/Encode.h>
 #include <lib/core/StringBuilderAdapters.h>
 #include <lib/support/jsontlv/JsonToTlv.h>
+#include <lib/support/jsontlv/StreamingJsonTlv.h>
 #include <lib/support/jsontlv/TextFormat.h>
 #include <lib/support/jsontlv/TlvToJson.h>
 
@@ -100,6 +101,34 @@ void CheckValidConversion(const std::string & jsonOriginal, const ByteSpan & tlv
         PrintSpan("TLV Encoding Provided as Input for Reference:     ", tlvEncoding);
         PrintSpan("TLV Encoding Generated from Json Expected String: ", tlvEncodingLocal);
     }
+
+    // The streaming converters must agree with the DOM based ones.
+    tlvEncodingLocal = MutableByteSpan(buf);
+    err              = StreamJsonToTlv(CharSpan(jsonOriginal.data(), jsonOriginal.size()), tlvEncodingLocal);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    match = tlvEncodingLocal.data_equal(tlvEncoding);
+    EXPECT_TRUE(match);
+    if (!match)
+    {
+        printf("ERROR: Streamed TLV Encoding Doesn't Match!\n");
+        PrintSpan("TLV Encoding Provided as Input for Reference:     ", tlvEncoding);
+        PrintSpan("TLV Encoding Streamed from Json Input String:     ", tlvEncodingLocal);
+    }
+
+    std::string streamedJsonString;
+    err = StreamTlvToJson(tlvEncoding, streamedJsonString);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    auto compactStreamedString = PrettyPrintJsonString(streamedJsonString);
+    match                      = (compactStreamedString == compactExpectedString);
+    EXPECT_TRUE(match);
+    if (!match)
+    {
+        printf("ERROR: Streamed Json String Doesn't Match!\n");
+        printf("Expected Json String:\n%s\n", compactExpectedString.c_str());
+        printf("Streamed Json String:\n%s\n", compactStreamedString.c_str());
+    }
 }
 
 // Boolean true
@@ -1699,6 +1728,7 @@ TEST_F(TestJsonToTlvToJson, TestConverter_TlvToJson_ErrorCases)
         std::string jsonString;
         err = TlvToJson(testCase.nEncodedTlv, jsonString);
         EXPECT_EQ(err, testCase.mExpectedResult);
+        EXPECT_EQ(StreamTlvToJson(testCase.nEncodedTlv, jsonString), testCase.mExpectedResult);
     }
 }
 
@@ -1817,6 +1847,10 @@ TEST_F(TestJsonToTlvToJson, TestConverter_JsonToTlv_ErrorCases)
         MutableByteSpan tlvSpan(buf);
         err = JsonToTlv(testCase.mJsonString, tlvSpan);
         EXPECT_EQ(err, testCase.mExpectedResult);
+
+        MutableByteSpan streamedTlvSpan(buf);
+        CharSpan jsonSpan(testCase.mJsonString.data(), testCase.mJsonString.size());
+        EXPECT_EQ(StreamJsonToTlv(jsonSpan, streamedTlvSpan), testCase.mExpectedResult);
 #if CHIP_CONFIG_ERROR_FORMAT_AS_STRING
         if (err != testCase.mExpectedResult)
         {
@@ -1862,4 +1896,57 @@ TEST_F(TestJsonToTlvToJson, TestConverter_Struct_MEITags)
     ByteSpan tlvSpan(buf, writer.GetLengthWritten());
     CheckValidConversion(jsonString, tlvSpan, jsonString);
 }
+
+// Streaming conversion of members out of tag order and of strings with escape sequences.
+TEST_F(TestJsonToTlvToJson, TestConverter_Streaming_UnsortedMembersAndEscapes)
+{
+    uint8_t buf[256];
+    TLV::TLVWriter writer;
+    TLV::TLVType containerType;
+    TLV::TLVType containerType2;
+
+    writer.Init(buf);
+    writer.ImplicitProfileId = kImplicitProfileId;
+    EXPECT_EQ(CHIP_NO_ERROR, writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, containerType));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.PutString(TLV::ContextTag(1), "a\"b\\c\n\xC3\xA9\xF0\x9F\x98\x80"));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.StartContainer(TLV::ContextTag(2), TLV::kTLVType_Structure, containerType2));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.Put(TLV::ContextTag(0), static_cast<uint64_t>(7)));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.PutBoolean(TLV::ContextTag(5), false));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.EndContainer(containerType2));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.Put(TLV::ProfileTag(kImplicitProfileId, 1000), static_cast<int64_t>(-5)));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.EndContainer(containerType));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.Finalize());
+    ByteSpan tlvSpan(buf, writer.GetLengthWritten());
+
+    std::string jsonString = "{\n"
+                             "   \"1000:INT\" : -5, // comments are skipped\n"
+                             "   \"2:STRUCT\" : { \"5:BOOL\" : false, \"0:UINT\" : \"7\" },\n"
+                             "   \"str:1:STRING\" : \"a\\\"b\\\\c\\n\\u00e9\\ud83d\\ude00\"\n"
+                             "}\n";
+
+    uint8_t outBuf[256];
+    TLV::TLVWriter streamWriter;
+    streamWriter.Init(outBuf);
+    streamWriter.ImplicitProfileId = kImplicitProfileId;
+    EXPECT_EQ(CHIP_NO_ERROR, StreamJsonToTlv(CharSpan(jsonString.data(), jsonString.size()), streamWriter));
+    EXPECT_EQ(CHIP_NO_ERROR, streamWriter.Finalize());
+    EXPECT_TRUE(tlvSpan.data_equal(ByteSpan(outBuf, streamWriter.GetLengthWritten())));
+
+    // Members are written in TLV order, and string contents are escaped.
+    TLV::TLVReader reader;
+    std::string streamedJsonString;
+    reader.Init(tlvSpan);
+    reader.ImplicitProfileId = kImplicitProfileId;
+    EXPECT_EQ(CHIP_NO_ERROR, reader.Next());
+    EXPECT_EQ(CHIP_NO_ERROR, StreamTlvToJson(reader, streamedJsonString));
+    EXPECT_EQ(streamedJsonString,
+              "{\"1:STRING\":\"a\\\"b\\\\c\\n\xC3\xA9\xF0\x9F\x98\x80\",\"2:STRUCT\":{\"0:UINT\":7,\"5:BOOL\":false},"
+              "\"1000:INT\":-5}");
+
+    // Malformed JSON is reported like JsonToTlv() does.
+    MutableByteSpan tlvOut(outBuf);
+    EXPECT_EQ(CHIP_ERROR_INTERNAL, StreamJsonToTlv(CharSpan::fromCharString("{ \"1:STRING\" : \"unterminated }"), tlvOut));
+    tlvOut = MutableByteSpan(outBuf);
+    EXPECT_EQ(CHIP_ERROR_INTERNAL, StreamJsonToTlv(CharSpan::fromCharString("{ \"1:UINT\" : 1 } trailing"), tlvOut));
+}
 } // namespace
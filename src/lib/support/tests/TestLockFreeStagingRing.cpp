@@ -0,0 +1,121 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/LockFreeStagingRing.h>
+
+#include <vector>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+
+namespace {
+
+using namespace chip;
+
+using TestRing = LockFreeStagingRing<uint32_t, 4>;
+
+// Staged values must be usable before any constructor runs.
+TestRing sStaticRing;
+
+CHIP_ERROR Stage(TestRing & ring, uint32_t value, bool & needsWake)
+{
+    return ring.Push(
+        [value](uint32_t & cell) {
+            cell = value;
+            return CHIP_NO_ERROR;
+        },
+        needsWake);
+}
+
+std::vector<uint32_t> DrainAll(TestRing & ring)
+{
+    std::vector<uint32_t> drained;
+    ring.Drain([&drained](const uint32_t & value) { drained.push_back(value); });
+    return drained;
+}
+
+TEST(TestLockFreeStagingRing, TestPushAndDrainInOrder)
+{
+    bool needsWake = false;
+
+    // Several laps around the ring keep the values in order.
+    for (uint32_t lap = 0; lap < 3; lap++)
+    {
+        for (uint32_t i = 0; i < 3; i++)
+        {
+            EXPECT_EQ(Stage(sStaticRing, lap * 10 + i, needsWake), CHIP_NO_ERROR);
+        }
+
+        std::vector<uint32_t> expected = { lap * 10, lap * 10 + 1, lap * 10 + 2 };
+        EXPECT_EQ(DrainAll(sStaticRing), expected);
+        EXPECT_TRUE(DrainAll(sStaticRing).empty());
+    }
+}
+
+TEST(TestLockFreeStagingRing, TestFullRing)
+{
+    TestRing ring;
+    bool needsWake = false;
+
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(Stage(ring, i, needsWake), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(Stage(ring, 4, needsWake), CHIP_ERROR_NO_MEMORY);
+    EXPECT_FALSE(needsWake);
+
+    EXPECT_EQ(DrainAll(ring).size(), 4u);
+    EXPECT_EQ(Stage(ring, 5, needsWake), CHIP_NO_ERROR);
+    EXPECT_EQ(DrainAll(ring), std::vector<uint32_t>{ 5 });
+}
+
+TEST(TestLockFreeStagingRing, TestWakeCoalescing)
+{
+    TestRing ring;
+    bool needsWake = false;
+
+    EXPECT_EQ(Stage(ring, 1, needsWake), CHIP_NO_ERROR);
+    EXPECT_TRUE(needsWake);
+    EXPECT_EQ(Stage(ring, 2, needsWake), CHIP_NO_ERROR);
+    EXPECT_FALSE(needsWake);
+
+    DrainAll(ring);
+    EXPECT_EQ(Stage(ring, 3, needsWake), CHIP_NO_ERROR);
+    EXPECT_TRUE(needsWake);
+
+    // A consumer that could not be woken up is asked again by the next push.
+    ring.CancelWake();
+    EXPECT_EQ(Stage(ring, 4, needsWake), CHIP_NO_ERROR);
+    EXPECT_TRUE(needsWake);
+    EXPECT_EQ(DrainAll(ring), (std::vector<uint32_t>{ 3, 4 }));
+}
+
+TEST(TestLockFreeStagingRing, TestFailedFillIsSkipped)
+{
+    TestRing ring;
+    bool needsWake = false;
+
+    EXPECT_EQ(Stage(ring, 1, needsWake), CHIP_NO_ERROR);
+    EXPECT_EQ(ring.Push([](uint32_t &) { return CHIP_ERROR_BUFFER_TOO_SMALL; }, needsWake), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(Stage(ring, 3, needsWake), CHIP_NO_ERROR);
+
+    EXPECT_EQ(DrainAll(ring), (std::vector<uint32_t>{ 1, 3 }));
+}
+
+} // namespace
@@ -244,4 +244,44 @@ TEST(TestPersistedCounter, TestAdvanceByRollover)
     EXPECT_EQ(currentEpoch, storedValue);
 }
 
+TEST(TestPersistedCounter, TestAdaptiveEpoch)
+{
+    chip::TestPersistentStorageDelegate storage;
+    chip::PersistedCounter<uint64_t> counter, counter2;
+
+    uint64_t storedValue = 0;
+    uint16_t size        = sizeof(storedValue);
+
+    EXPECT_EQ(counter.Init(&storage, chip::DefaultStorageKeyAllocator::IMEventNumber(), 0x100), CHIP_NO_ERROR);
+    counter.SetMaxEpoch(0x400);
+
+    // Each exhausted epoch doubles the next one, up to the max epoch: 0x200, 0x400, then 0x400 again.
+    const uint64_t expectedNextEpochs[] = { 0x300, 0x700, 0xB00, 0xF00 };
+    for (uint64_t expected : expectedNextEpochs)
+    {
+        while (counter.GetValue() + 1 < expected)
+        {
+            uint64_t previous = counter.GetValue();
+            EXPECT_EQ(counter.Advance(), CHIP_NO_ERROR);
+            EXPECT_EQ(counter.GetValue(), previous + 1);
+        }
+
+        size = sizeof(storedValue);
+        EXPECT_EQ(storage.SyncGetKeyValue(chip::DefaultStorageKeyAllocator::IMEventNumber().KeyName(), &storedValue, size),
+                  CHIP_NO_ERROR);
+        storedValue = Encoding::LittleEndian::HostSwap<uint64_t>(storedValue);
+        EXPECT_EQ(storedValue, expected);
+    }
+
+    // The next boot starts from the last persisted value, with the epoch given to Init.
+    EXPECT_EQ(counter2.Init(&storage, chip::DefaultStorageKeyAllocator::IMEventNumber(), 0x100), CHIP_NO_ERROR);
+    EXPECT_EQ(counter2.GetValue(), 0xF00ULL);
+
+    size = sizeof(storedValue);
+    EXPECT_EQ(storage.SyncGetKeyValue(chip::DefaultStorageKeyAllocator::IMEventNumber().KeyName(), &storedValue, size),
+              CHIP_NO_ERROR);
+    storedValue = Encoding::LittleEndian::HostSwap<uint64_t>(storedValue);
+    EXPECT_EQ(storedValue, 0x1000ULL);
+}
+
 } // namespace
@@ -23,7 +23,10 @@
  *
  */
 
+#include <algorithm>
+#include <iterator>
 #include <set>
+#include <vector>
 
 #include <pw_unit_test/framework.h>
 
@@ -77,6 +80,11 @@ TEST_F(TestPool, TestReleaseNullDynamic)
 {
     TestReleaseNull<uint32_t, 10, ObjectPoolMem::kHeap>();
 }
+
+TEST_F(TestPool, TestReleaseNullSlab)
+{
+    TestReleaseNull<uint32_t, 10, ObjectPoolMem::kSlab>();
+}
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
 template <typename T, size_t N, ObjectPoolMem P>
@@ -129,6 +137,7 @@ TEST_F(TestPool, TestCreateReleaseObjectStatic)
     EXPECT_EQ(GetNumObjectsInUse(pool), kSize);
     EXPECT_EQ(pool.Allocated(), kSize);
     EXPECT_TRUE(pool.Exhausted());
+    EXPECT_EQ(pool.AllocationFailures(), 1u);
 
     pool.ReleaseObject(obj[55]);
     EXPECT_EQ(GetNumObjectsInUse(pool), kSize - 1);
@@ -144,6 +153,8 @@ TEST_F(TestPool, TestCreateReleaseObjectStatic)
     EXPECT_EQ(GetNumObjectsInUse(pool), kSize);
     EXPECT_EQ(pool.Allocated(), kSize);
     EXPECT_TRUE(pool.Exhausted());
+    EXPECT_EQ(pool.AllocationFailures(), 2u);
+    EXPECT_EQ(pool.HighWaterMark(), kSize);
 
     pool.ReleaseAll();
 }
@@ -153,6 +164,11 @@ TEST_F(TestPool, TestCreateReleaseObjectDynamic)
 {
     TestCreateReleaseObject<uint32_t, 100, ObjectPoolMem::kHeap>();
 }
+
+TEST_F(TestPool, TestCreateReleaseObjectSlab)
+{
+    TestCreateReleaseObject<uint32_t, 100, ObjectPoolMem::kSlab>();
+}
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
 template <ObjectPoolMem P>
@@ -216,6 +232,11 @@ TEST_F(TestPool, TestCreateReleaseStructDynamic)
 {
     TestCreateReleaseStruct<ObjectPoolMem::kHeap>();
 }
+
+TEST_F(TestPool, TestCreateReleaseStructSlab)
+{
+    TestCreateReleaseStruct<ObjectPoolMem::kSlab>();
+}
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
 template <ObjectPoolMem P>
@@ -481,8 +502,70 @@ TEST_F(TestPool, TestForEachActiveObjectDynamic)
 {
     TestForEachActiveObject<ObjectPoolMem::kHeap>();
 }
+
+TEST_F(TestPool, TestForEachActiveObjectSlab)
+{
+    TestForEachActiveObject<ObjectPoolMem::kSlab>();
+}
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
+TEST_F(TestPool, TestSparseMultiWordStatic)
+{
+    // Spans several bitmap words, with a partial last one
+    constexpr size_t kSize          = 200;
+    constexpr size_t kKeptIndexes[] = { 0, 63, 64, 65, 130, 199 };
+
+    struct S
+    {
+        S(size_t id) : mId(id) {}
+        size_t mId;
+    };
+
+    ObjectPool<S, kSize, ObjectPoolMem::kInline> pool;
+    S * objArray[kSize];
+    for (size_t i = 0; i < kSize; ++i)
+    {
+        objArray[i] = pool.CreateObject(i);
+        ASSERT_NE(objArray[i], nullptr);
+    }
+    EXPECT_EQ(pool.CreateObject(kSize), nullptr);
+
+    for (size_t i = 0; i < kSize; ++i)
+    {
+        if (std::find(std::begin(kKeptIndexes), std::end(kKeptIndexes), i) == std::end(kKeptIndexes))
+        {
+            pool.ReleaseObject(objArray[i]);
+            objArray[i] = nullptr;
+        }
+    }
+
+    // Both ways of iterating visit the active objects only, in slot order
+    std::vector<size_t> visited;
+    pool.ForEachActiveObject([&visited](S * object) {
+        visited.push_back(object->mId);
+        return Loop::Continue;
+    });
+    EXPECT_EQ(visited, std::vector<size_t>(std::begin(kKeptIndexes), std::end(kKeptIndexes)));
+
+    visited.clear();
+    for (auto object : pool)
+    {
+        visited.push_back(object->mId);
+    }
+    EXPECT_EQ(visited, std::vector<size_t>(std::begin(kKeptIndexes), std::end(kKeptIndexes)));
+
+    // Freed slots of every word are reused until the pool is full again
+    for (size_t i = 0; i < kSize - ArraySize(kKeptIndexes); ++i)
+    {
+        EXPECT_NE(pool.CreateObject(kSize + i), nullptr);
+    }
+    EXPECT_EQ(pool.CreateObject(kSize), nullptr);
+    EXPECT_EQ(pool.Allocated(), kSize);
+
+    pool.ReleaseAll();
+    EXPECT_EQ(GetNumObjectsInUse(pool), 0u);
+}
+
 template <ObjectPoolMem P>
 void TestPoolInterface()
 {
@@ -544,6 +627,76 @@ TEST_F(TestPool, TestPoolInterfaceDynamic)
 {
     TestPoolInterface<ObjectPoolMem::kHeap>();
 }
+
+TEST_F(TestPool, TestPoolInterfaceSlab)
+{
+    TestPoolInterface<ObjectPoolMem::kSlab>();
+}
+
+TEST_F(TestPool, TestSlabReuseAndRelease)
+{
+    struct Big
+    {
+        Big(size_t id) : mId(id) {}
+        size_t mId;
+        uint8_t mPayload[500];
+    };
+
+    SlabObjectPool<Big> pool;
+    const size_t perSlab = pool.SlotsPerSlab();
+    ASSERT_GE(perSlab, 1u);
+    ASSERT_LE(perSlab, 64u);
+
+    // Objects fill a slab before the next one is allocated
+    std::vector<Big *> objects;
+    for (size_t i = 0; i < 3 * perSlab; ++i)
+    {
+        objects.push_back(pool.CreateObject(i));
+        ASSERT_NE(objects.back(), nullptr);
+        EXPECT_EQ(pool.SlabCount(), i / perSlab + 1);
+    }
+
+    // Iteration visits the objects in creation order when none was released
+    size_t expected = 0;
+    for (auto object : pool)
+    {
+        EXPECT_EQ(object->mId, expected++);
+    }
+    EXPECT_EQ(expected, 3 * perSlab);
+
+    // A released slot is reused before any new slab
+    pool.ReleaseObject(objects[perSlab]);
+    Big * reused = pool.CreateObject(perSlab);
+    EXPECT_EQ(reused, objects[perSlab]);
+    EXPECT_EQ(pool.SlabCount(), 3u);
+
+    // Emptying a slab while iterating keeps it until the iteration completes
+    pool.ForEachActiveObject([&](Big * object) {
+        if (object->mId >= perSlab && object->mId < 2 * perSlab)
+        {
+            pool.ReleaseObject(object);
+            EXPECT_EQ(pool.SlabCount(), 3u);
+        }
+        return Loop::Continue;
+    });
+    EXPECT_EQ(pool.SlabCount(), 2u);
+    EXPECT_EQ(pool.Allocated(), 2 * perSlab);
+
+    {
+        auto it = pool.begin();
+        for (size_t i = 0; i < perSlab; ++i)
+        {
+            pool.ReleaseObject(objects[i]);
+        }
+        EXPECT_EQ(pool.SlabCount(), 2u);
+    }
+    EXPECT_EQ(pool.SlabCount(), 1u);
+
+    pool.ReleaseAll();
+    EXPECT_EQ(pool.Allocated(), 0u);
+    EXPECT_EQ(pool.SlabCount(), 0u);
+    EXPECT_EQ(pool.HighWaterMark(), 3 * perSlab);
+}
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
 } // namespace
@@ -0,0 +1,107 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <string.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/TracingPersistentStorageDelegate.h>
+
+using namespace chip;
+
+namespace {
+
+size_t FamilyOf(const StorageKeyName & key)
+{
+    return TracingPersistentStorageDelegate::GetKeyFamily(key.KeyName());
+}
+
+const char * FamilyNameOf(const StorageKeyName & key)
+{
+    return TracingPersistentStorageDelegate::GetKeyFamilyName(FamilyOf(key));
+}
+
+TEST(TestTracingPersistentStorageDelegate, TestKeyFamilies)
+{
+    EXPECT_STREQ(FamilyNameOf(DefaultStorageKeyAllocator::FabricNOC(1)), "FabricNOC");
+    EXPECT_EQ(FamilyOf(DefaultStorageKeyAllocator::FabricNOC(1)), FamilyOf(DefaultStorageKeyAllocator::FabricNOC(0xfe)));
+    EXPECT_STREQ(FamilyNameOf(DefaultStorageKeyAllocator::FabricSession(2, 0x1122334455667788)), "FabricSession");
+    EXPECT_STREQ(FamilyNameOf(DefaultStorageKeyAllocator::SessionResumption("ab/+cd==")), "SessionResumption");
+    EXPECT_STREQ(FamilyNameOf(DefaultStorageKeyAllocator::AccessControlAclEntry(1, 3)), "AccessControlAclEntry");
+    EXPECT_STREQ(FamilyNameOf(DefaultStorageKeyAllocator::FabricGroup(1, 0x101)), "FabricGroup");
+    EXPECT_STREQ(FamilyNameOf(DefaultStorageKeyAllocator::FabricGroupEndpoint(1, 0x101, 2)), "FabricGroupEndpoint");
+    EXPECT_STREQ(FamilyNameOf(DefaultStorageKeyAllocator::UserLabelIndexKey(1, 4)), "UserLabelIndexKey");
+    EXPECT_STREQ(FamilyNameOf(DefaultStorageKeyAllocator::AttributeValue(1, 6, 0)), "AttributeValue");
+    EXPECT_STREQ(FamilyNameOf(DefaultStorageKeyAllocator::SubscriptionResumption(5)), "SubscriptionResumption");
+    EXPECT_STREQ(FamilyNameOf(DefaultStorageKeyAllocator::SubscriptionResumptionMaxCount()), "SubscriptionResumptionMaxCount");
+
+    constexpr size_t kOther = TracingPersistentStorageDelegate::kNumKeyFamilies - 1;
+    EXPECT_EQ(TracingPersistentStorageDelegate::GetKeyFamily("vendor/key"), kOther);
+    EXPECT_EQ(TracingPersistentStorageDelegate::GetKeyFamily("f//n"), kOther);
+    EXPECT_STREQ(TracingPersistentStorageDelegate::GetKeyFamilyName(kOther), "Other");
+}
+
+TEST(TestTracingPersistentStorageDelegate, TestStats)
+{
+    TestPersistentStorageDelegate storage;
+    TracingPersistentStorageDelegate tracing(storage);
+    const uint8_t value[] = { 1, 2, 3, 4 };
+    uint8_t buffer[8];
+    uint16_t size;
+
+    StorageKeyName noc1 = DefaultStorageKeyAllocator::FabricNOC(1);
+    StorageKeyName noc2 = DefaultStorageKeyAllocator::FabricNOC(2);
+    EXPECT_EQ(tracing.SyncSetKeyValue(noc1.KeyName(), value, sizeof(value)), CHIP_NO_ERROR);
+    EXPECT_EQ(tracing.SyncSetKeyValue(noc2.KeyName(), value, 2), CHIP_NO_ERROR);
+
+    size = sizeof(buffer);
+    EXPECT_EQ(tracing.SyncGetKeyValue(noc1.KeyName(), buffer, size), CHIP_NO_ERROR);
+    size = 1;
+    EXPECT_EQ(tracing.SyncGetKeyValue(noc1.KeyName(), buffer, size), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_TRUE(tracing.SyncDoesKeyExist(noc2.KeyName()));
+    EXPECT_EQ(tracing.SyncDeleteKeyValue(noc2.KeyName()), CHIP_NO_ERROR);
+    EXPECT_EQ(tracing.SyncDeleteKeyValue(noc2.KeyName()), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    size = sizeof(buffer);
+    EXPECT_EQ(tracing.SyncGetKeyValue(noc2.KeyName(), buffer, size), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    // The accesses went through to the decorated storage
+    EXPECT_TRUE(storage.SyncDoesKeyExist(noc1.KeyName()));
+    EXPECT_FALSE(storage.SyncDoesKeyExist(noc2.KeyName()));
+
+    const TracingPersistentStorageDelegate::FamilyStats & stats = tracing.GetFamilyStats(noc1.KeyName());
+    EXPECT_EQ(stats.mWrites.mCount, 2u);
+    EXPECT_EQ(stats.mWrites.mTotalBytes, 6u);
+    EXPECT_EQ(stats.mReads.mCount, 4u);
+    EXPECT_EQ(stats.mReads.mTotalBytes, sizeof(value));
+    EXPECT_EQ(stats.mReads.mErrors, 1u);
+    EXPECT_EQ(stats.mDeletes.mCount, 2u);
+    EXPECT_EQ(stats.mDeletes.mErrors, 0u);
+    EXPECT_EQ(stats.mMisses, 2u);
+    EXPECT_EQ(stats.GetAccessCount(), 8u);
+    EXPECT_EQ(tracing.GetFamilyStats(DefaultStorageKeyAllocator::FabricICAC(1).KeyName()).GetAccessCount(), 0u);
+
+    tracing.LogStats();
+    tracing.ResetStats();
+    EXPECT_EQ(tracing.GetFamilyStats(noc1.KeyName()).GetAccessCount(), 0u);
+}
+
+} // namespace
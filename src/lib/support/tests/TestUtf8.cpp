@@ -18,6 +18,8 @@
  */
 
 #include <functional>
+#include <string.h>
+#include <string>
 
 #include <pw_unit_test/framework.h>
 
@@ -168,4 +170,32 @@ TEST(TestUtf8, TestInvalidStrings)
     TEST_INVALID_BYTES(0xfc, 0x80, 0x80, 0x80, 0x80, 0x80);
 }
 
+TEST(TestUtf8, TestLongStrings)
+{
+    // Long enough to go through the ASCII fast path, with the multi-byte sequences at every offset around its blocks
+    const std::string ascii(70, 'a');
+    const char * sequences[] = { "\xC2\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80" };
+
+    EXPECT_TRUE(Utf8::IsValid(CharSpan(ascii.data(), ascii.size())));
+
+    for (size_t offset = 0; offset <= ascii.size(); offset++)
+    {
+        for (const char * sequence : sequences)
+        {
+            std::string valid = ascii;
+            valid.insert(offset, sequence);
+            EXPECT_TRUE(Utf8::IsValid(CharSpan(valid.data(), valid.size())));
+
+            // Missing its last byte
+            std::string truncated = ascii;
+            truncated.insert(offset, sequence, strlen(sequence) - 1);
+            EXPECT_FALSE(Utf8::IsValid(CharSpan(truncated.data(), truncated.size())));
+        }
+
+        std::string invalid = ascii;
+        invalid[offset % ascii.size()] = static_cast<char>(0xFF);
+        EXPECT_FALSE(Utf8::IsValid(CharSpan(invalid.data(), invalid.size())));
+    }
+}
+
 } // namespace
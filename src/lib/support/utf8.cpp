@@ -17,6 +17,11 @@
  */
 #include "utf8.h"
 
+#include <lib/support/Simd.h>
+
+#include <stdint.h>
+#include <string.h>
+
 namespace chip {
 namespace Utf8 {
 
@@ -166,19 +171,68 @@ ParserState NextState(ParserState state, uint8_t value)
     }
 }
 
+/// Returns the number of leading bytes known to be ASCII. The bytes are checked a vector, then a word, at a time,
+/// so the last few ASCII bytes of the run may not be counted: they are left to the caller.
+size_t AsciiPrefixLength(const uint8_t * data, size_t length)
+{
+    size_t offset = 0;
+
+#if CHIP_SIMD_SSE2
+    for (; offset + Simd::kVectorSize <= length; offset += Simd::kVectorSize)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + offset));
+        if (_mm_movemask_epi8(block) != 0)
+        {
+            break;
+        }
+    }
+#elif CHIP_SIMD_NEON
+    for (; offset + Simd::kVectorSize <= length; offset += Simd::kVectorSize)
+    {
+        if (vmaxvq_u8(vld1q_u8(data + offset)) >= 0x80)
+        {
+            break;
+        }
+    }
+#endif
+
+    constexpr size_t kHighBits = static_cast<size_t>(UINT64_C(0x8080808080808080));
+    for (; offset + sizeof(size_t) <= length; offset += sizeof(size_t))
+    {
+        size_t word;
+        memcpy(&word, data + offset, sizeof(word));
+        if ((word & kHighBits) != 0)
+        {
+            break;
+        }
+    }
+
+    return offset;
+}
+
 } // namespace
 
 bool IsValid(CharSpan span)
 {
     ParserState state = ParserState::kFirstByte;
 
-    const char * data    = span.data();
+    const uint8_t * data = reinterpret_cast<const uint8_t *>(span.data());
     const size_t kLength = span.size();
 
     // Every byte should be valid
     for (size_t i = 0; i < kLength; i++)
     {
-        state = NextState(state, static_cast<uint8_t>(data[i]));
+        // Runs of ASCII characters, the bulk of most strings, are valid whatever their content
+        if (state == ParserState::kFirstByte && data[i] <= 0x7F)
+        {
+            i += AsciiPrefixLength(data + i, kLength - i);
+            if (i == kLength)
+            {
+                break;
+            }
+        }
+
+        state = NextState(state, data[i]);
 
         if (state == ParserState::kInvalid)
         {
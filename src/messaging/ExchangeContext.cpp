@@ -42,6 +42,7 @@
 #include <platform/LockTracker.h>
 #include <protocols/Protocols.h>
 #include <protocols/secure_channel/Constants.h>
+#include <tracing/macros.h>
 
 using namespace chip::Encoding;
 using namespace chip::Inet;
@@ -101,6 +102,11 @@ CHIP_ERROR ExchangeContext::SendMessage(Protocols::Id protocolId, uint8_t msgTyp
     // Don't let method get called on a freed object.
     VerifyOrDie(mExchangeMgr != nullptr && GetReferenceCount() > 0);
 
+    if (!isStandaloneAck)
+    {
+        LogExchangeEvent(Tracing::ExchangeEventType::kMessageSend);
+    }
+
     // we hold the exchange context here in case the entity that
     // originally generated it tries to close it as a result of
     // an error arising below. at the end, we have to close it.
@@ -330,6 +336,7 @@ ExchangeContext::ExchangeContext(ExchangeManager * em, uint16_t ExchangeId, cons
     ChipLogDetail(ExchangeManager, "ec++ id: " ChipLogFormatExchange, ChipLogValueExchange(this));
 #endif
     SYSTEM_STATS_INCREMENT(chip::System::Stats::kExchangeMgr_NumContexts);
+    LogExchangeEvent(Tracing::ExchangeEventType::kAllocated);
 }
 
 ExchangeContext::~ExchangeContext()
@@ -341,6 +348,8 @@ ExchangeContext::~ExchangeContext()
     //
     VerifyOrDieWithObject(mFlags.Has(Flags::kFlagClosed), this);
 
+    LogExchangeEvent(Tracing::ExchangeEventType::kClosed);
+
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
     // TODO(#33075) : Add check for group context to not a req since it serves no purpose
     app::ICDNotifier::GetInstance().NotifyActiveRequestWithdrawal(app::ICDListener::KeepActiveFlag::kExchangeContextOpen);
@@ -359,6 +368,11 @@ ExchangeContext::~ExchangeContext()
     SYSTEM_STATS_DECREMENT(chip::System::Stats::kExchangeMgr_NumContexts);
 }
 
+void ExchangeContext::LogExchangeEvent(Tracing::ExchangeEventType type, System::Clock::Microseconds64 duration) const
+{
+    MATTER_LOG_EXCHANGE_EVENT(type, mExchangeId, IsInitiator(), mSession ? mSession.operator->() : nullptr, duration);
+}
+
 bool ExchangeContext::MatchExchange(const SessionHandle & session, const PacketHeader & packetHeader,
                                     const PayloadHeader & payloadHeader)
 {
@@ -614,7 +628,10 @@ CHIP_ERROR ExchangeContext::HandleMessage(uint32_t messageCounter, const Payload
 
         if (mDelegate != nullptr)
         {
-            return mDelegate->OnMessageReceived(this, payloadHeader, std::move(msgBuf));
+            const auto processingStart = Tracing::ExchangeStageStart();
+            CHIP_ERROR err             = mDelegate->OnMessageReceived(this, payloadHeader, std::move(msgBuf));
+            LogExchangeEvent(Tracing::ExchangeEventType::kMessageProcessed, Tracing::ExchangeStageDuration(processingStart));
+            return err;
         }
     }
 
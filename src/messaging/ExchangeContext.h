@@ -26,6 +26,7 @@
 #include <lib/core/ReferenceCounted.h>
 #include <lib/support/BitFlags.h>
 #include <lib/support/DLLUtil.h>
+#include <lib/support/Pool.h>
 #include <lib/support/ReferenceCountedHandle.h>
 #include <lib/support/TypeTraits.h>
 #include <messaging/ExchangeDelegate.h>
@@ -33,6 +34,7 @@
 #include <messaging/ReliableMessageContext.h>
 #include <protocols/Protocols.h>
 #include <transport/SessionManager.h>
+#include <transport/TracingStructs.h>
 
 namespace chip {
 
@@ -167,6 +169,12 @@ public:
 
     uint16_t GetExchangeId() const { return mExchangeId; }
 
+    /**
+     * Report a stage of this exchange to the tracing backends, see Tracing::ExchangeEventType.
+     */
+    void LogExchangeEvent(Tracing::ExchangeEventType type,
+                          System::Clock::Microseconds64 duration = System::Clock::Microseconds64(0)) const;
+
     /*
      * In order to use reference counting (see refCount below) we use a hold/free paradigm where users of the exchange
      * can hold onto it while it's out of their direct control to make sure it isn't closed before everyone's ready.
@@ -265,6 +273,11 @@ private:
     ExchangeSessionHolder mSession; // The connection state
     uint16_t mExchangeId;           // Assigned exchange ID.
 
+    // Exchange manager index bookkeeping: the bucket this exchange was filed under, which is kept because the
+    // session it was hashed with may be released before the exchange is, and the next exchange in that bucket.
+    uint16_t mIndexBucket          = 0;
+    ExchangeContext * mNextInIndex = nullptr;
+
     /**
      *  Track whether we are now expecting a response to a message sent via this exchange (because that
      *  message had the kExpectResponse flag set in its sendFlags).
@@ -323,5 +336,12 @@ private:
     }
 };
 
+/// Pool of the exchange contexts of an ExchangeManager, see CHIP_CONFIG_EXCHANGE_CONTEXT_POOL_USE_SLAB.
+#if CHIP_CONFIG_EXCHANGE_CONTEXT_POOL_USE_SLAB
+using ExchangeContextPool = ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS, ObjectPoolMem::kSlab>;
+#else
+using ExchangeContextPool = ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS>;
+#endif // CHIP_CONFIG_EXCHANGE_CONTEXT_POOL_USE_SLAB
+
 } // namespace Messaging
 } // namespace chip
@@ -0,0 +1,165 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  This file defines SendAndReceive(), an awaitable that sends a message on an exchange and suspends the calling
+ *  chip::System::Task until the response arrives, for example:
+ *
+ *      Messaging::ExchangeResponse response = co_await Messaging::SendAndReceive(ec, MsgType::Request, std::move(request));
+ *      CoReturnErrorOnFailure(response.error);
+ *
+ *  The usual exchange rules apply once the response has been delivered: the exchange closes itself when the coroutine
+ *  next suspends, unless it has sent another message expecting a response or called WillSendMessage() first.
+ *
+ *  Only available when CHIP_SYSTEM_HAS_COROUTINES is set (see system/SystemCoroutine.h).
+ */
+
+#pragma once
+
+#include <system/SystemCoroutine.h>
+
+#if CHIP_SYSTEM_HAS_COROUTINES
+
+#include <lib/support/TypeTraits.h>
+#include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeDelegate.h>
+#include <protocols/Protocols.h>
+#include <system/SystemPacketBuffer.h>
+#include <transport/raw/MessageHeader.h>
+
+#include <coroutine>
+#include <utility>
+
+namespace chip {
+namespace Messaging {
+
+/**
+ * The outcome of SendAndReceive(). When error is CHIP_NO_ERROR, payloadHeader and payload hold the response.
+ */
+struct ExchangeResponse
+{
+    CHIP_ERROR error = CHIP_NO_ERROR;
+    PayloadHeader payloadHeader;
+    System::PacketBufferHandle payload;
+};
+
+/**
+ * Awaitable returned by SendAndReceive().
+ *
+ * While suspended, it stands in as the delegate of the exchange; the previous delegate is restored before the
+ * coroutine is resumed.
+ */
+class SendAndReceiveAwaitable : public ExchangeDelegate
+{
+public:
+    SendAndReceiveAwaitable(ExchangeContext * ec, Protocols::Id protocolId, uint8_t msgType, System::PacketBufferHandle && payload,
+                            const SendFlags & sendFlags) :
+        mExchange(ec),
+        mProtocolId(protocolId), mMsgType(msgType), mSendFlags(sendFlags)
+    {
+        mResponse.payload = std::move(payload);
+        mSendFlags.Set(SendMessageFlags::kExpectResponse);
+    }
+
+    bool await_ready() const { return false; }
+    bool await_suspend(std::coroutine_handle<> handle)
+    {
+        mHandle           = handle;
+        mPreviousDelegate = mExchange->GetDelegate();
+        mExchange->SetDelegate(this);
+        mResponse.error = mExchange->SendMessage(mProtocolId, mMsgType, std::move(mResponse.payload), mSendFlags);
+        if (mResponse.error != CHIP_NO_ERROR)
+        {
+            mExchange->SetDelegate(mPreviousDelegate);
+            return false;
+        }
+        return true;
+    }
+    ExchangeResponse await_resume() { return std::move(mResponse); }
+
+    // ExchangeDelegate
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && payload) override
+    {
+        mResponse.payloadHeader = payloadHeader;
+        mResponse.payload       = std::move(payload);
+        Complete(CHIP_NO_ERROR);
+        return CHIP_NO_ERROR;
+    }
+    void OnResponseTimeout(ExchangeContext * ec) override { Complete(CHIP_ERROR_TIMEOUT); }
+    void OnExchangeClosing(ExchangeContext * ec) override
+    {
+        ExchangeDelegate * previous = mPreviousDelegate;
+        Complete(CHIP_ERROR_CONNECTION_ABORTED);
+        if (previous != nullptr)
+        {
+            previous->OnExchangeClosing(ec);
+        }
+    }
+    ExchangeMessageDispatch & GetMessageDispatch() override
+    {
+        return mPreviousDelegate != nullptr ? mPreviousDelegate->GetMessageDispatch() : ExchangeDelegate::GetMessageDispatch();
+    }
+
+private:
+    void Complete(CHIP_ERROR error)
+    {
+        mResponse.error = error;
+        mExchange->SetDelegate(mPreviousDelegate);
+        // Resuming may destroy this awaitable, so it must be the last thing done.
+        std::coroutine_handle<> handle = mHandle;
+        handle.resume();
+    }
+
+    ExchangeContext * mExchange;
+    ExchangeDelegate * mPreviousDelegate = nullptr;
+    Protocols::Id mProtocolId;
+    uint8_t mMsgType;
+    SendFlags mSendFlags;
+    std::coroutine_handle<> mHandle;
+    ExchangeResponse mResponse;
+};
+
+/**
+ * Send a message on @p ec and suspend the calling coroutine until the response arrives.
+ *
+ * `co_await SendAndReceive(...)` yields an ExchangeResponse whose error is the SendMessage() failure (without
+ * suspending), CHIP_ERROR_TIMEOUT if no response arrived in time, or CHIP_ERROR_CONNECTION_ABORTED if the exchange
+ * closed while waiting.
+ */
+inline SendAndReceiveAwaitable SendAndReceive(ExchangeContext * ec, Protocols::Id protocolId, uint8_t msgType,
+                                              System::PacketBufferHandle && payload,
+                                              const SendFlags & sendFlags = SendFlags(SendMessageFlags::kNone))
+{
+    return SendAndReceiveAwaitable(ec, protocolId, msgType, std::move(payload), sendFlags);
+}
+
+/**
+ * A strongly-message-typed version of SendAndReceive.
+ */
+template <typename MessageType, typename = std::enable_if_t<std::is_enum<MessageType>::value>>
+SendAndReceiveAwaitable SendAndReceive(ExchangeContext * ec, MessageType msgType, System::PacketBufferHandle && payload,
+                                       const SendFlags & sendFlags = SendFlags(SendMessageFlags::kNone))
+{
+    return SendAndReceiveAwaitable(ec, Protocols::MessageTypeTraits<MessageType>::ProtocolId(), to_underlying(msgType),
+                                   std::move(payload), sendFlags);
+}
+
+} // namespace Messaging
+} // namespace chip
+
+#endif // CHIP_SYSTEM_HAS_COROUTINES
@@ -73,6 +73,11 @@ CHIP_ERROR ExchangeManager::Init(SessionManager * sessionManager)
         // initialization and the case when the consumer shuts us down and
         // then re-initializes without removing registered handlers.
         handler.Reset();
+        handler.NextInIndex = nullptr;
+    }
+    for (auto & bucket : mUMHandlerIndex)
+    {
+        bucket = nullptr;
     }
 
     sessionManager->SetMessageDelegate(this);
@@ -81,6 +86,7 @@ CHIP_ERROR ExchangeManager::Init(SessionManager * sessionManager)
     sessionManager->SetConnectionDelegate(this);
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
     mReliableMessageMgr.Init(sessionManager->SystemLayer());
+    mContextPoolStats.Register(mContextPool);
 
     mState = State::kState_Initialized;
 
@@ -92,6 +98,7 @@ void ExchangeManager::Shutdown()
     VerifyOrReturn(mState != State::kState_NotInitialized);
 
     mReliableMessageMgr.Shutdown();
+    mContextPoolStats.Unregister();
 
     if (mSessionManager != nullptr)
     {
@@ -115,7 +122,81 @@ ExchangeContext * ExchangeManager::NewContext(const SessionHandle & session, Exc
         // Disallow creating exchange on an inactive session
         return nullptr;
     }
-    return mContextPool.CreateObject(this, mNextExchangeId++, session, isInitiator, delegate);
+    return CreateContext(mNextExchangeId++, session, isInitiator, delegate);
+}
+
+void ExchangeManager::ReleaseContext(ExchangeContext * ec)
+{
+    for (ExchangeContext ** link = &mExchangeIndex[ec->mIndexBucket]; *link != nullptr; link = &(*link)->mNextInIndex)
+    {
+        if (*link == ec)
+        {
+            *link = ec->mNextInIndex;
+            break;
+        }
+    }
+
+    mContextPool.ReleaseObject(ec);
+}
+
+uint16_t ExchangeManager::ExchangeIndexBucket(uint16_t exchangeId, bool isInitiator, const Transport::Session * session)
+{
+    // Multiplicative (Fibonacci) hashing; the upper half of the product mixes in every bit of the key.
+    uint32_t key = (static_cast<uint32_t>(exchangeId) << 1) | (isInitiator ? 1u : 0u);
+    key ^= static_cast<uint32_t>(reinterpret_cast<uintptr_t>(session) >> 3);
+    return static_cast<uint16_t>(((key * 2654435769u) >> 16) & (CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS - 1));
+}
+
+size_t ExchangeManager::UMHandlerIndexBucket(Protocols::Id protocolId, int16_t msgType)
+{
+    uint32_t key = protocolId.ToFullyQualifiedSpecForm() ^ (static_cast<uint32_t>(static_cast<uint16_t>(msgType)) << 8);
+    return ((key * 2654435769u) >> 16) % CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS;
+}
+
+ExchangeContext * ExchangeManager::CreateContext(uint16_t exchangeId, const SessionHandle & session, bool isInitiator,
+                                                 ExchangeDelegate * delegate, bool isEphemeralExchange)
+{
+    ExchangeContext * ec = mContextPool.CreateObject(this, exchangeId, session, isInitiator, delegate, isEphemeralExchange);
+    VerifyOrReturnValue(ec != nullptr, nullptr);
+
+    // An exchange's session never changes once it is created (it can only be released), so the session the exchange
+    // is filed under is the only one it can ever match.
+    ec->mIndexBucket                 = ExchangeIndexBucket(exchangeId, isInitiator, session.operator->());
+    ec->mNextInIndex                 = mExchangeIndex[ec->mIndexBucket];
+    mExchangeIndex[ec->mIndexBucket] = ec;
+
+    return ec;
+}
+
+ExchangeContext * ExchangeManager::FindExchange(const SessionHandle & session, const PacketHeader & packetHeader,
+                                                const PayloadHeader & payloadHeader)
+{
+    // A message sent by an initiator belongs to a responder exchange, and vice versa.
+    const uint16_t bucket = ExchangeIndexBucket(payloadHeader.GetExchangeID(), !payloadHeader.IsInitiator(), session.operator->());
+
+    for (ExchangeContext * ec = mExchangeIndex[bucket]; ec != nullptr; ec = ec->mNextInIndex)
+    {
+        if (ec->MatchExchange(session, packetHeader, payloadHeader))
+        {
+            return ec;
+        }
+    }
+
+    return nullptr;
+}
+
+ExchangeManager::UnsolicitedMessageHandlerSlot * ExchangeManager::FindUMH(Protocols::Id protocolId, int16_t msgType)
+{
+    for (UnsolicitedMessageHandlerSlot * umh = mUMHandlerIndex[UMHandlerIndexBucket(protocolId, msgType)]; umh != nullptr;
+         umh = umh->NextInIndex)
+    {
+        if (umh->Matches(protocolId, msgType))
+        {
+            return umh;
+        }
+    }
+
+    return nullptr;
 }
 
 CHIP_ERROR ExchangeManager::RegisterUnsolicitedMessageHandlerForProtocol(Protocols::Id protocolId,
@@ -142,28 +223,35 @@ CHIP_ERROR ExchangeManager::UnregisterUnsolicitedMessageHandlerForType(Protocols
 
 CHIP_ERROR ExchangeManager::RegisterUMH(Protocols::Id protocolId, int16_t msgType, UnsolicitedMessageHandler * handler)
 {
-    UnsolicitedMessageHandlerSlot * selected = nullptr;
+    // A null handler would leave an indexed slot looking free.
+    VerifyOrReturnError(handler != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    UnsolicitedMessageHandlerSlot * selected = FindUMH(protocolId, msgType);
+    if (selected != nullptr)
+    {
+        selected->Handler = handler;
+        return CHIP_NO_ERROR;
+    }
 
     for (auto & umh : UMHandlerPool)
     {
         if (!umh.IsInUse())
         {
-            if (selected == nullptr)
-                selected = &umh;
-        }
-        else if (umh.Matches(protocolId, msgType))
-        {
-            umh.Handler = handler;
-            return CHIP_NO_ERROR;
+            selected = &umh;
+            break;
         }
     }
 
     if (selected == nullptr)
         return CHIP_ERROR_TOO_MANY_UNSOLICITED_MESSAGE_HANDLERS;
 
+    UnsolicitedMessageHandlerSlot *& bucket = mUMHandlerIndex[UMHandlerIndexBucket(protocolId, msgType)];
+
     selected->Handler     = handler;
     selected->ProtocolId  = protocolId;
     selected->MessageType = msgType;
+    selected->NextInIndex = bucket;
+    bucket                = selected;
 
     SYSTEM_STATS_INCREMENT(chip::System::Stats::kExchangeMgr_NumUMHandlers);
 
@@ -172,11 +260,15 @@ CHIP_ERROR ExchangeManager::RegisterUMH(Protocols::Id protocolId, int16_t msgTyp
 
 CHIP_ERROR ExchangeManager::UnregisterUMH(Protocols::Id protocolId, int16_t msgType)
 {
-    for (auto & umh : UMHandlerPool)
+    for (UnsolicitedMessageHandlerSlot ** link = &mUMHandlerIndex[UMHandlerIndexBucket(protocolId, msgType)]; *link != nullptr;
+         link = &(*link)->NextInIndex)
     {
-        if (umh.IsInUse() && umh.Matches(protocolId, msgType))
+        UnsolicitedMessageHandlerSlot * umh = *link;
+        if (umh->Matches(protocolId, msgType))
         {
-            umh.Reset();
+            *link            = umh->NextInIndex;
+            umh->NextInIndex = nullptr;
+            umh->Reset();
             SYSTEM_STATS_DECREMENT(chip::System::Stats::kExchangeMgr_NumUMHandlers);
             return CHIP_NO_ERROR;
         }
@@ -262,23 +354,14 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
     if (!packetHeader.IsGroupSession())
     {
         // Search for an existing exchange that the message applies to. If a match is found...
-        bool found = false;
-        mContextPool.ForEachActiveObject([&](auto * ec) {
-            if (ec->MatchExchange(session, packetHeader, payloadHeader))
-            {
-                ChipLogDetail(ExchangeManager, "Found matching exchange: " ChipLogFormatExchange ", Delegate: %p",
-                              ChipLogValueExchange(ec), ec->GetDelegate());
-
-                // Matched ExchangeContext; send to message handler.
-                ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, msgFlags, std::move(msgBuf));
-                found = true;
-                return Loop::Break;
-            }
-            return Loop::Continue;
-        });
-
-        if (found)
+        ExchangeContext * ec = FindExchange(session, packetHeader, payloadHeader);
+        if (ec != nullptr)
         {
+            ChipLogDetail(ExchangeManager, "Found matching exchange: " ChipLogFormatExchange ", Delegate: %p",
+                          ChipLogValueExchange(ec), ec->GetDelegate());
+
+            // Matched ExchangeContext; send to message handler.
+            ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, msgFlags, std::move(msgBuf));
             return;
         }
     }
@@ -303,21 +386,10 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
     {
         // Search for an unsolicited message handler that can handle the message. Prefer handlers that can explicitly
         // handle the message type over handlers that handle all messages for a profile.
-        matchingUMH = nullptr;
-
-        for (auto & umh : UMHandlerPool)
+        matchingUMH = FindUMH(payloadHeader.GetProtocolID(), payloadHeader.GetMessageType());
+        if (matchingUMH == nullptr)
         {
-            if (umh.IsInUse() && payloadHeader.HasProtocol(umh.ProtocolId))
-            {
-                if (umh.MessageType == payloadHeader.GetMessageType())
-                {
-                    matchingUMH = &umh;
-                    break;
-                }
-
-                if (umh.MessageType == kAnyMessageType)
-                    matchingUMH = &umh;
-            }
+            matchingUMH = FindUMH(payloadHeader.GetProtocolID(), kAnyMessageType);
         }
     }
     // Discard the message if it isn't marked as being sent by an initiator and the message does not need to send
@@ -353,7 +425,7 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
             return;
         }
 
-        ExchangeContext * ec = mContextPool.CreateObject(this, payloadHeader.GetExchangeID(), session, false, delegate);
+        ExchangeContext * ec = CreateContext(payloadHeader.GetExchangeID(), session, false, delegate);
 
         if (ec == nullptr)
         {
@@ -405,8 +477,8 @@ void ExchangeManager::SendStandaloneAckIfNeeded(const PacketHeader & packetHeade
     // If rcvd msg is from initiator then this exchange is created as not Initiator.
     // If rcvd msg is not from initiator then this exchange is created as Initiator.
     // Create a EphemeralExchange to generate a StandaloneAck
-    ExchangeContext * ec = mContextPool.CreateObject(this, payloadHeader.GetExchangeID(), session, !payloadHeader.IsInitiator(),
-                                                     nullptr, true /* IsEphemeralExchange */);
+    ExchangeContext * ec = CreateContext(payloadHeader.GetExchangeID(), session, !payloadHeader.IsInitiator(), nullptr,
+                                         true /* IsEphemeralExchange */);
 
     if (ec == nullptr)
     {
@@ -32,6 +32,7 @@
 #include <messaging/ExchangeContext.h>
 #include <messaging/ReliableMessageMgr.h>
 #include <protocols/Protocols.h>
+#include <system/SystemStats.h>
 #include <transport/SessionManager.h>
 
 namespace chip {
@@ -108,7 +109,7 @@ public:
      */
     ExchangeContext * NewContext(const SessionHandle & session, ExchangeDelegate * delegate, bool isInitiator = true);
 
-    void ReleaseContext(ExchangeContext * ec) { mContextPool.ReleaseObject(ec); }
+    void ReleaseContext(ExchangeContext * ec);
 
     /**
      *  Register an unsolicited message handler for a given protocol identifier. This handler would be
@@ -120,6 +121,7 @@ public:
      *
      *  @retval #CHIP_ERROR_TOO_MANY_UNSOLICITED_MESSAGE_HANDLERS If the unsolicited message handler pool
      *                                                             is full and a new one cannot be allocated.
+     *  @retval #CHIP_ERROR_INVALID_ARGUMENT If handler is null.
      *  @retval #CHIP_NO_ERROR On success.
      */
     CHIP_ERROR RegisterUnsolicitedMessageHandlerForProtocol(Protocols::Id protocolId, UnsolicitedMessageHandler * handler);
@@ -135,6 +137,7 @@ public:
      *
      *  @retval #CHIP_ERROR_TOO_MANY_UNSOLICITED_MESSAGE_HANDLERS If the unsolicited message handler pool
      *                                                             is full and a new one cannot be allocated.
+     *  @retval #CHIP_ERROR_INVALID_ARGUMENT If handler is null.
      *  @retval #CHIP_NO_ERROR On success.
      */
     CHIP_ERROR RegisterUnsolicitedMessageHandlerForType(Protocols::Id protocolId, uint8_t msgType,
@@ -228,21 +231,43 @@ private:
         int16_t MessageType;
 
         UnsolicitedMessageHandler * Handler;
+
+        // Next in-use slot in the same mUMHandlerIndex bucket.
+        UnsolicitedMessageHandlerSlot * NextInIndex = nullptr;
     };
 
+    static_assert((CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS & (CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS - 1)) == 0,
+                  "CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS must be a power of two");
+    static_assert(CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS <= UINT16_MAX + 1, "Exchange index buckets must fit in 16 bits");
+
     uint16_t mNextExchangeId;
     uint16_t mNextKeyId;
     State mState;
 
     FabricIndex mFabricIndex = 0;
 
-    ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> mContextPool;
+    ExchangeContextPool mContextPool;
+    System::Stats::PoolStatistics mContextPoolStats{ SYSTEM_STATS_METRIC_KEYS("exchange_pool") };
 
     SessionManager * mSessionManager;
     ReliableMessageMgr mReliableMessageMgr;
 
     UnsolicitedMessageHandlerSlot UMHandlerPool[CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS];
 
+    // Hash indexes over the active exchanges, keyed by (exchange id, initiator, session), and over the in-use
+    // handler slots, keyed by (protocol, message type), so that dispatching a message does not scan the pools.
+    ExchangeContext * mExchangeIndex[CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS]                          = {};
+    UnsolicitedMessageHandlerSlot * mUMHandlerIndex[CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS] = {};
+
+    static uint16_t ExchangeIndexBucket(uint16_t exchangeId, bool isInitiator, const Transport::Session * session);
+    static size_t UMHandlerIndexBucket(Protocols::Id protocolId, int16_t msgType);
+
+    ExchangeContext * CreateContext(uint16_t exchangeId, const SessionHandle & session, bool isInitiator,
+                                    ExchangeDelegate * delegate, bool isEphemeralExchange = false);
+    ExchangeContext * FindExchange(const SessionHandle & session, const PacketHeader & packetHeader,
+                                   const PayloadHeader & payloadHeader);
+    UnsolicitedMessageHandlerSlot * FindUMH(Protocols::Id protocolId, int16_t msgType);
+
     CHIP_ERROR RegisterUMH(Protocols::Id protocolId, int16_t msgType, UnsolicitedMessageHandler * handler);
     CHIP_ERROR UnregisterUMH(Protocols::Id protocolId, int16_t msgType);
 
@@ -21,12 +21,14 @@
  *
  */
 
+#include <algorithm>
 #include <errno.h>
 #include <inttypes.h>
 
 #include <app/icd/server/ICDServerConfig.h>
 #include <lib/support/BitFlags.h>
 #include <lib/support/CHIPFaultInjection.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <messaging/ErrorCategory.h>
@@ -51,7 +53,7 @@ namespace Messaging {
 System::Clock::Timeout ReliableMessageMgr::sAdditionalMRPBackoffTime = CHIP_CONFIG_MRP_RETRY_INTERVAL_SENDER_BOOST;
 
 ReliableMessageMgr::RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) :
-    ec(*rc->GetExchangeContext()), nextRetransTime(0), sendCount(0)
+    ec(*rc->GetExchangeContext()), nextRetransTime(0), firstSendTime(0), sendCount(0), queueIndex(kNotQueued)
 {
     ec->SetWaitingForAck(true);
 }
@@ -61,7 +63,7 @@ ReliableMessageMgr::RetransTableEntry::~RetransTableEntry()
     ec->SetWaitingForAck(false);
 }
 
-ReliableMessageMgr::ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool) :
+ReliableMessageMgr::ReliableMessageMgr(ExchangeContextPool & contextPool) :
     mContextPool(contextPool), mSystemLayer(nullptr)
 {}
 
@@ -70,6 +72,7 @@ ReliableMessageMgr::~ReliableMessageMgr() {}
 void ReliableMessageMgr::Init(chip::System::Layer * systemLayer)
 {
     mSystemLayer = systemLayer;
+    mRetransTableStats.Register(mRetransTable);
 }
 
 void ReliableMessageMgr::Shutdown()
@@ -77,11 +80,13 @@ void ReliableMessageMgr::Shutdown()
     StopTimer();
 
     // Clear the retransmit table
+    mRetransQueue.Clear();
     mRetransTable.ForEachActiveObject([&](auto * entry) {
         mRetransTable.ReleaseObject(entry);
         return Loop::Continue;
     });
 
+    mRetransTableStats.Unregister();
     mSystemLayer = nullptr;
 }
 
@@ -122,11 +127,11 @@ void ReliableMessageMgr::ExecuteActions()
         }
     });
 
-    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime > now)
-            return Loop::Continue;
-
+    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired, earliest first. Every entry
+    // handled here is either released or rescheduled past now, so it leaves the top of the queue.
+    RetransTableEntry * entry = nullptr;
+    while ((entry = mRetransQueue.Earliest()) != nullptr && entry->nextRetransTime <= now)
+    {
         VerifyOrDie(!entry->retainedBuf.IsNull());
 
         // Don't check whether the session in the exchange is valid, because when the session is released, the retrans entry is
@@ -168,9 +173,9 @@ void ReliableMessageMgr::ExecuteActions()
             }
 
             // Do not StartTimer, we will schedule the timer at the end of the timer handler.
-            mRetransTable.ReleaseObject(entry);
+            ReleaseRetransEntry(*entry);
 
-            return Loop::Continue;
+            continue;
         }
 
         entry->sendCount++;
@@ -181,12 +186,11 @@ void ReliableMessageMgr::ExecuteActions()
                         entry->sendCount, ChipLogValueExchange(&entry->ec.Get()), session->SessionIdForLogging(), messageCounter,
                         Transport::GetSessionTypeString(session), fabricIndex, ChipLogValueX64(destination));
         MATTER_LOG_METRIC(Tracing::kMetricDeviceRMPRetryCount, entry->sendCount);
+        entry->ec->LogExchangeEvent(Tracing::ExchangeEventType::kRetransmit);
 
         CalculateNextRetransTime(*entry);
         SendFromRetransTable(entry);
-
-        return Loop::Continue;
-    });
+    }
 
     TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
 }
@@ -219,6 +223,15 @@ CHIP_ERROR ReliableMessageMgr::AddToRetransTable(ReliableMessageContext * rc, Re
         return CHIP_ERROR_RETRANS_TABLE_FULL;
     }
 
+    // Make sure the entry can be queued once its retransmission is scheduled.
+    CHIP_ERROR err = mRetransQueue.Reserve(mRetransTable.Allocated());
+    if (err != CHIP_NO_ERROR)
+    {
+        mRetransTable.ReleaseObject(*rEntry);
+        *rEntry = nullptr;
+        return err;
+    }
+
     return CHIP_NO_ERROR;
 }
 
@@ -285,6 +298,7 @@ System::Clock::Timeout ReliableMessageMgr::GetBackoff(System::Clock::Timeout bas
 
 void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
 {
+    entry->firstSendTime = System::SystemClock().GetMonotonicTimestamp();
     CalculateNextRetransTime(*entry);
     StartTimer();
 }
@@ -295,6 +309,10 @@ bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, ui
     mRetransTable.ForEachActiveObject([&](auto * entry) {
         if (entry->ec->GetReliableMessageContext() == rc && entry->retainedBuf.GetMessageCounter() == ackMessageCounter)
         {
+            RecordRoundTripTime(*entry);
+            entry->ec->LogExchangeEvent(Tracing::ExchangeEventType::kAckReceived,
+                                        System::SystemClock().GetMonotonicTimestamp() - entry->firstSendTime);
+
             // Clear the entry from the retransmision table.
             ClearRetransTable(*entry);
 
@@ -379,7 +397,7 @@ void ReliableMessageMgr::ClearRetransTable(ReliableMessageContext * rc)
 
 void ReliableMessageMgr::ClearRetransTable(RetransTableEntry & entry)
 {
-    mRetransTable.ReleaseObject(&entry);
+    ReleaseRetransEntry(entry);
     // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
     StartTimer();
 }
@@ -397,13 +415,11 @@ void ReliableMessageMgr::StartTimer()
     });
 
     // When do we need to next wake up for ReliableMessageProtocol retransmit?
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime < nextWakeTime)
-        {
-            nextWakeTime = entry->nextRetransTime;
-        }
-        return Loop::Continue;
-    });
+    const RetransTableEntry * earliest = mRetransQueue.Earliest();
+    if (earliest != nullptr && earliest->nextRetransTime < nextWakeTime)
+    {
+        nextWakeTime = earliest->nextRetransTime;
+    }
 
     StopTimer();
 
@@ -491,8 +507,24 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
         baseTimeout = sessionHandle->GetMRPBaseTimeout();
     }
 
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT
+    // Only shorten the timeout for a peer known to be awake: an idle peer may be asleep for its whole idle interval.
+    if (sessionHandle->IsSecureSession() && sessionHandle->AsSecureSession()->IsPeerActive())
+    {
+        const auto & estimator = sessionHandle->AsSecureSession()->GetRoundTripTimeEstimator();
+        if (estimator.HasSample())
+        {
+            System::Clock::Timeout measuredTimeout = estimator.GetRetransmissionTimeout();
+            measuredTimeout = std::max<System::Clock::Timeout>(measuredTimeout, CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT);
+            baseTimeout     = std::min(baseTimeout, measuredTimeout);
+            MATTER_LOG_METRIC(Tracing::kMetricDeviceRMPAdaptiveRetransTimeout, baseTimeout.count());
+        }
+    }
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT
+
     System::Clock::Timeout backoff = ReliableMessageMgr::GetBackoff(baseTimeout, entry.sendCount);
     entry.nextRetransTime          = System::SystemClock().GetMonotonicTimestamp() + backoff;
+    mRetransQueue.Schedule(entry);
 
 #if CHIP_PROGRESS_LOGGING
     const auto config       = sessionHandle->GetRemoteMRPConfig();
@@ -522,6 +554,141 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
 #endif // CHIP_PROGRESS_LOGGING
 }
 
+void ReliableMessageMgr::RecordRoundTripTime(RetransTableEntry & entry)
+{
+    // Karn's algorithm: the acknowledgment of a retransmitted message can't be told apart from the one of an earlier
+    // transmission, so only messages that were sent once are measured.
+    VerifyOrReturn(entry.sendCount == 0);
+    VerifyOrReturn(entry.ec->HasSessionHandle() && entry.ec->GetSessionHandle()->IsSecureSession());
+
+    const auto rtt = std::chrono::duration_cast<System::Clock::Milliseconds32>(System::SystemClock().GetMonotonicTimestamp() -
+                                                                               entry.firstSendTime);
+    entry.ec->GetSessionHandle()->AsSecureSession()->GetRoundTripTimeEstimator().AddSample(rtt);
+    MATTER_LOG_METRIC(Tracing::kMetricDeviceRMPRoundTripTime, rtt.count());
+}
+
+void ReliableMessageMgr::ReleaseRetransEntry(RetransTableEntry & entry)
+{
+    mRetransQueue.Remove(entry);
+    mRetransTable.ReleaseObject(&entry);
+}
+
+CHIP_ERROR ReliableMessageMgr::RetransQueue::Reserve(size_t count)
+{
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    if (count > mCapacity)
+    {
+        const size_t capacity = std::max<size_t>({ count, mCapacity * 2, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE });
+        auto * entries = static_cast<RetransTableEntry **>(Platform::MemoryRealloc(mEntries, capacity * sizeof(*mEntries)));
+        VerifyOrReturnError(entries != nullptr, CHIP_ERROR_NO_MEMORY);
+        mEntries  = entries;
+        mCapacity = capacity;
+    }
+#else
+    VerifyOrReturnError(count <= CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE, CHIP_ERROR_RETRANS_TABLE_FULL);
+#endif
+    return CHIP_NO_ERROR;
+}
+
+void ReliableMessageMgr::RetransQueue::Schedule(RetransTableEntry & entry)
+{
+    if (entry.queueIndex == RetransTableEntry::kNotQueued)
+    {
+        VerifyOrDie(mSize < Capacity());
+        Place(&entry, mSize++);
+        SiftUp(entry.queueIndex);
+    }
+    else if (!SiftUp(entry.queueIndex))
+    {
+        SiftDown(entry.queueIndex);
+    }
+}
+
+void ReliableMessageMgr::RetransQueue::Remove(RetransTableEntry & entry)
+{
+    if (entry.queueIndex == RetransTableEntry::kNotQueued)
+    {
+        return;
+    }
+
+    // Fill the hole with the last entry, and move that to its place.
+    const size_t index = entry.queueIndex;
+    entry.queueIndex   = RetransTableEntry::kNotQueued;
+    mSize--;
+    if (index < mSize)
+    {
+        Place(mEntries[mSize], index);
+        if (!SiftUp(index))
+        {
+            SiftDown(index);
+        }
+    }
+}
+
+void ReliableMessageMgr::RetransQueue::Clear()
+{
+    for (size_t i = 0; i < mSize; i++)
+    {
+        mEntries[i]->queueIndex = RetransTableEntry::kNotQueued;
+    }
+    mSize = 0;
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    Platform::MemoryFree(mEntries);
+    mEntries  = nullptr;
+    mCapacity = 0;
+#endif
+}
+
+void ReliableMessageMgr::RetransQueue::Place(RetransTableEntry * entry, size_t index)
+{
+    mEntries[index]   = entry;
+    entry->queueIndex = index;
+}
+
+// Moves the entry at index towards the top while it is due earlier than its parent; returns whether it moved.
+bool ReliableMessageMgr::RetransQueue::SiftUp(size_t index)
+{
+    RetransTableEntry * entry = mEntries[index];
+    const size_t start        = index;
+    while (index > 0)
+    {
+        const size_t parent = (index - 1) / 2;
+        if (!(entry->nextRetransTime < mEntries[parent]->nextRetransTime))
+        {
+            break;
+        }
+        Place(mEntries[parent], index);
+        index = parent;
+    }
+    Place(entry, index);
+    return index != start;
+}
+
+// Moves the entry at index towards the bottom while one of its children is due earlier.
+void ReliableMessageMgr::RetransQueue::SiftDown(size_t index)
+{
+    RetransTableEntry * entry = mEntries[index];
+    while (true)
+    {
+        size_t child = 2 * index + 1;
+        if (child >= mSize)
+        {
+            break;
+        }
+        if (child + 1 < mSize && mEntries[child + 1]->nextRetransTime < mEntries[child]->nextRetransTime)
+        {
+            child++;
+        }
+        if (!(mEntries[child]->nextRetransTime < entry->nextRetransTime))
+        {
+            break;
+        }
+        Place(mEntries[child], index);
+        index = child;
+    }
+    Place(entry, index);
+}
+
 #if CHIP_CONFIG_TEST
 int ReliableMessageMgr::TestGetCountRetransTable()
 {
@@ -34,6 +34,7 @@
 #include <messaging/ReliableMessageProtocolConfig.h>
 #include <system/SystemLayer.h>
 #include <system/SystemPacketBuffer.h>
+#include <system/SystemStats.h>
 #include <transport/SessionUpdateDelegate.h>
 #include <transport/raw/MessageHeader.h>
 
@@ -64,11 +65,16 @@ public:
         ExchangeHandle ec;                        /**< The context for the stored CHIP message. */
         EncryptedPacketBufferHandle retainedBuf;  /**< The packet buffer holding the CHIP message. */
         System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
+        System::Clock::Timestamp firstSendTime;   /**< When the message was first sent, to measure the round trip time. */
         uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
                                                        including both successfully and failure send. */
+        size_t queueIndex;                        /**< The position of the entry in the retransmission queue,
+                                                       or kNotQueued if no retransmission is scheduled. */
+
+        static constexpr size_t kNotQueued = SIZE_MAX;
     };
 
-    ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool);
+    ReliableMessageMgr(ExchangeContextPool & contextPool);
     ~ReliableMessageMgr();
 
     void Init(chip::System::Layer * systemLayer);
@@ -230,7 +236,61 @@ private:
      */
     void CalculateNextRetransTime(RetransTableEntry & entry);
 
-    ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & mContextPool;
+    /**
+     * Feed the time the entry took to be acknowledged to the round trip time estimator of its session.
+     */
+    void RecordRoundTripTime(RetransTableEntry & entry);
+
+    /**
+     * Remove an entry from the retransmission queue and release it, without restarting the timer.
+     */
+    void ReleaseRetransEntry(RetransTableEntry & entry);
+
+    /**
+     * The retransmission table entries that have a retransmission scheduled, kept as a binary min-heap on
+     * nextRetransTime.  The next expiry is at the top, and scheduling, rescheduling or removing an entry
+     * is O(log n) in the number of entries.
+     */
+    class RetransQueue
+    {
+    public:
+        RetransQueue() = default;
+        ~RetransQueue() { Clear(); }
+
+        /**
+         * Make room for count entries, so that Schedule() cannot fail.
+         */
+        CHIP_ERROR Reserve(size_t count);
+
+        RetransTableEntry * Earliest() const { return mSize > 0 ? mEntries[0] : nullptr; }
+
+        /**
+         * Add an entry to the queue, or move it to its new place after its nextRetransTime changed.
+         */
+        void Schedule(RetransTableEntry & entry);
+        void Remove(RetransTableEntry & entry);
+        void Clear();
+
+    private:
+        void Place(RetransTableEntry * entry, size_t index);
+        bool SiftUp(size_t index);
+        void SiftDown(size_t index);
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        // The table is not bounded when pools are on the heap, so neither is the queue.
+        size_t Capacity() const { return mCapacity; }
+
+        RetransTableEntry ** mEntries = nullptr;
+        size_t mCapacity              = 0;
+#else
+        size_t Capacity() const { return CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE; }
+
+        RetransTableEntry * mEntries[CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE];
+#endif
+        size_t mSize = 0;
+    };
+
+    ExchangeContextPool & mContextPool;
     chip::System::Layer * mSystemLayer;
 
     /* Placeholder function to run a function for all exchanges */
@@ -247,6 +307,8 @@ private:
 
     // ReliableMessageProtocol Global tables for timer context
     ObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTable;
+    System::Stats::PoolStatistics mRetransTableStats{ SYSTEM_STATS_METRIC_KEYS("retrans_table") };
+    RetransQueue mRetransQueue;
 
     SessionUpdateDelegate * mSessionUpdateDelegate = nullptr;
 
@@ -183,6 +183,34 @@ namespace chip {
 #endif
 #endif // CHIP_CONFIG_MRP_RETRY_INTERVAL_SENDER_BOOST
 
+/**
+ *  @def CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT
+ *
+ *  @brief
+ *    When enabled, the base retransmission timeout for a secure session whose
+ *    peer is active is computed from the round trip time measured on that
+ *    session (RFC 6298), rather than taken from the peer's SAI/SII.
+ *
+ *  The computed timeout is never longer than the one the peer advertised, nor
+ *  shorter than CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT.  Peers that are
+ *  idle keep their advertised idle interval, since they may be asleep.
+ */
+#ifndef CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT
+#define CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT 0
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT
+
+/**
+ *  @def CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT
+ *
+ *  @brief
+ *    The shortest base retransmission timeout CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT
+ *    may compute, so that an unusually fast measurement does not cause spurious
+ *    retransmissions.
+ */
+#ifndef CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT
+#define CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT (100_ms32)
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT
+
 inline constexpr System::Clock::Milliseconds32 kDefaultActiveTime = System::Clock::Milliseconds16(4000);
 
 /**
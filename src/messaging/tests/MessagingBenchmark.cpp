@@ -0,0 +1,364 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  @file
+ *    Measures the messaging and transport hot paths over the loopback transport of
+ *    LoopbackMessagingContext:
+ *      - packet and payload header encode/decode
+ *      - secure session encrypt/decrypt
+ *      - exchange allocate/release and message dispatch
+ *      - MRP retransmission table operations with many messages in flight
+ *      - PacketBuffer allocation
+ *
+ *    Each measurement is printed on a single line of space-separated key=value pairs,
+ *    starting with "BENCHMARK", so that results can be collected and compared across runs.
+ *    Usage: messaging-benchmark [--gtest_filter=MessagingBenchmark.<Scenario>]
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/CHIPCore.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeMgr.h>
+#include <messaging/ReliableMessageMgr.h>
+#include <messaging/ReliableMessageProtocolConfig.h>
+#include <messaging/tests/MessagingContext.h>
+#include <protocols/Protocols.h>
+#include <system/SystemPacketBuffer.h>
+#include <transport/CryptoContext.h>
+#include <transport/SecureMessageCodec.h>
+#include <transport/SecureSession.h>
+#include <transport/raw/MessageHeader.h>
+
+#include <algorithm>
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+using namespace chip;
+using namespace chip::Messaging;
+
+namespace {
+
+constexpr uint32_t kHeaderIterations       = 100000;
+constexpr uint32_t kCryptoIterations       = 10000;
+constexpr uint32_t kExchangeIterations     = 2000;
+constexpr uint32_t kRetransTableRounds     = 200;
+constexpr uint32_t kRetransTableScans      = 100;
+constexpr uint32_t kPacketBufferIterations = 100000;
+constexpr size_t kCryptoPayloadSizes[]     = { 64, 512, 1024 };
+constexpr size_t kPacketBufferSizes[]      = { 0, 256, System::PacketBuffer::kMaxSize };
+
+enum : uint8_t
+{
+    kMsgType_Benchmark = 1,
+};
+
+// Use a protocol that has no handler in the messaging layer itself
+const Protocols::Id kBenchmarkProtocolId = Protocols::BDX::Id;
+
+class Stopwatch
+{
+public:
+    Stopwatch() : mStart(std::chrono::steady_clock::now()) {}
+
+    double ElapsedMicroseconds() const
+    {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - mStart).count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point mStart;
+};
+
+void PrintResult(const char * scenario, const char * parameters, uint32_t operations, double elapsedUs)
+{
+    printf("BENCHMARK scenario=%s %s operations=%" PRIu32 " ns_per_op=%.1f ops_per_s=%.0f\n", scenario, parameters, operations,
+           operations > 0 ? elapsedUs * 1000 / operations : 0.0, elapsedUs > 0 ? operations * 1e6 / elapsedUs : 0.0);
+}
+
+/// Counts the messages received on exchanges it is the delegate of, and accepts every unsolicited message
+class CountingDelegate : public UnsolicitedMessageHandler, public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override
+    {
+        newDelegate = this;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        mReceivedCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+
+    uint32_t mReceivedCount = 0;
+};
+
+class MessagingBenchmark : public chip::Test::LoopbackMessagingContext
+{
+public:
+    static void SetUpTestSuite()
+    {
+        LoopbackMessagingContext::SetUpTestSuite();
+
+        // Logging of every message would dominate the measurements
+        chip::Logging::SetLogFilter(chip::Logging::kLogCategory_Error);
+    }
+
+    void TearDown() override
+    {
+        GetLoopback().Reset();
+        LoopbackMessagingContext::TearDown();
+    }
+};
+
+TEST_F(MessagingBenchmark, HeaderCodec)
+{
+    PacketHeader packetHeader;
+    packetHeader.SetSessionId(0x1234)
+        .SetSessionType(Header::SessionType::kUnicastSession)
+        .SetSourceNodeId(static_cast<NodeId>(0x0102030405060708))
+        .SetDestinationNodeId(static_cast<NodeId>(0x1112131415161718));
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetMessageType(kBenchmarkProtocolId, kMsgType_Benchmark).SetExchangeID(0x4321).SetInitiator(true);
+    payloadHeader.SetAckMessageCounter(0x55667788);
+
+    uint8_t buffer[64];
+    uint16_t packetHeaderSize  = 0;
+    uint16_t payloadHeaderSize = 0;
+
+    {
+        Stopwatch stopwatch;
+        for (uint32_t i = 0; i < kHeaderIterations; i++)
+        {
+            packetHeader.SetMessageCounter(i);
+            ASSERT_EQ(packetHeader.Encode(buffer, sizeof(buffer), &packetHeaderSize), CHIP_NO_ERROR);
+            ASSERT_EQ(payloadHeader.Encode(&buffer[packetHeaderSize], sizeof(buffer) - packetHeaderSize, &payloadHeaderSize),
+                      CHIP_NO_ERROR);
+        }
+        PrintResult("header_encode", "", kHeaderIterations, stopwatch.ElapsedMicroseconds());
+    }
+
+    {
+        Stopwatch stopwatch;
+        for (uint32_t i = 0; i < kHeaderIterations; i++)
+        {
+            PacketHeader decodedPacketHeader;
+            PayloadHeader decodedPayloadHeader;
+            uint16_t decodeSize = 0;
+
+            ASSERT_EQ(decodedPacketHeader.Decode(buffer, packetHeaderSize + payloadHeaderSize, &decodeSize), CHIP_NO_ERROR);
+            ASSERT_EQ(decodedPayloadHeader.Decode(&buffer[decodeSize], payloadHeaderSize, &decodeSize), CHIP_NO_ERROR);
+        }
+        PrintResult("header_decode", "", kHeaderIterations, stopwatch.ElapsedMicroseconds());
+    }
+}
+
+TEST_F(MessagingBenchmark, SessionCrypto)
+{
+    // The loopback sessions of both nodes share their keys, so Alice can decrypt what Bob encrypts
+    SessionHandle bobToAlice = GetSessionBobToAlice();
+    SessionHandle aliceToBob = GetSessionAliceToBob();
+    const CryptoContext & bobContext   = bobToAlice->AsSecureSession()->GetCryptoContext();
+    const CryptoContext & aliceContext = aliceToBob->AsSecureSession()->GetCryptoContext();
+
+    for (size_t payloadSize : kCryptoPayloadSizes)
+    {
+        double encryptUs = 0;
+        double decryptUs = 0;
+
+        for (uint32_t i = 0; i < kCryptoIterations; i++)
+        {
+            System::PacketBufferHandle buffer = System::PacketBufferHandle::New(payloadSize);
+            ASSERT_FALSE(buffer.IsNull());
+            memset(buffer->Start(), 0xA5, payloadSize);
+            buffer->SetDataLength(payloadSize);
+
+            PacketHeader packetHeader;
+            packetHeader.SetSessionId(bobToAlice->AsSecureSession()->GetPeerSessionId())
+                .SetSessionType(Header::SessionType::kUnicastSession)
+                .SetMessageCounter(i);
+
+            PayloadHeader payloadHeader;
+            payloadHeader.SetMessageType(kBenchmarkProtocolId, kMsgType_Benchmark).SetExchangeID(1).SetInitiator(true);
+
+            // PASE sessions use the undefined node ID in their nonces
+            CryptoContext::NonceStorage nonce;
+            ASSERT_EQ(CryptoContext::BuildNonce(nonce, packetHeader.GetSecurityFlags(), i, kUndefinedNodeId), CHIP_NO_ERROR);
+
+            Stopwatch encryptStopwatch;
+            ASSERT_EQ(SecureMessageCodec::Encrypt(bobContext, nonce, payloadHeader, packetHeader, buffer), CHIP_NO_ERROR);
+            encryptUs += encryptStopwatch.ElapsedMicroseconds();
+
+            PayloadHeader decryptedPayloadHeader;
+            Stopwatch decryptStopwatch;
+            ASSERT_EQ(SecureMessageCodec::Decrypt(aliceContext, nonce, decryptedPayloadHeader, packetHeader, buffer),
+                      CHIP_NO_ERROR);
+            decryptUs += decryptStopwatch.ElapsedMicroseconds();
+
+            ASSERT_EQ(buffer->DataLength(), payloadSize);
+        }
+
+        char parameters[32];
+        snprintf(parameters, sizeof(parameters), "payload=%u", static_cast<unsigned>(payloadSize));
+        PrintResult("session_encrypt", parameters, kCryptoIterations, encryptUs);
+        PrintResult("session_decrypt", parameters, kCryptoIterations, decryptUs);
+    }
+}
+
+TEST_F(MessagingBenchmark, ExchangeLifecycle)
+{
+    CountingDelegate delegate;
+
+    {
+        Stopwatch stopwatch;
+        for (uint32_t i = 0; i < kExchangeIterations; i++)
+        {
+            ExchangeContext * ec = NewExchangeToAlice(&delegate);
+            ASSERT_NE(ec, nullptr);
+            ec->Close();
+        }
+        PrintResult("exchange_allocate_release", "", kExchangeIterations, stopwatch.ElapsedMicroseconds());
+    }
+
+    ASSERT_EQ(GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(kBenchmarkProtocolId, kMsgType_Benchmark, &delegate),
+              CHIP_NO_ERROR);
+
+    {
+        // A full round: allocate, send, encrypt, deliver, decrypt, dispatch to the responder, acknowledge and release
+        Stopwatch stopwatch;
+        for (uint32_t i = 0; i < kExchangeIterations; i++)
+        {
+            ExchangeContext * ec = NewExchangeToAlice(&delegate);
+            ASSERT_NE(ec, nullptr);
+            ASSERT_EQ(ec->SendMessage(kBenchmarkProtocolId, kMsgType_Benchmark, System::PacketBufferHandle::New(32)),
+                      CHIP_NO_ERROR);
+            DrainAndServiceIO();
+            ASSERT_EQ(delegate.mReceivedCount, i + 1);
+        }
+        PrintResult("exchange_dispatch", "", kExchangeIterations, stopwatch.ElapsedMicroseconds());
+    }
+
+    EXPECT_EQ(GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(kBenchmarkProtocolId, kMsgType_Benchmark),
+              CHIP_NO_ERROR);
+    DrainAndServiceIO();
+}
+
+TEST_F(MessagingBenchmark, RetransTable)
+{
+    constexpr size_t kMaxInFlight = std::min<size_t>(CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS);
+    const size_t inFlightCounts[] = { 1, std::max<size_t>(kMaxInFlight / 2, 1), kMaxInFlight };
+
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    CountingDelegate delegate;
+
+    // Messages are never delivered, so that they stay in the retransmission table until their exchange is aborted
+    GetLoopback().mNumMessagesToDrop = chip::Test::LoopbackTransport::kUnlimitedMessageCount;
+
+    for (size_t inFlight : inFlightCounts)
+    {
+        ExchangeContext * exchanges[kMaxInFlight];
+        double insertUs = 0;
+        double scanUs   = 0;
+        double removeUs = 0;
+
+        for (uint32_t round = 0; round < kRetransTableRounds; round++)
+        {
+            Stopwatch insertStopwatch;
+            for (size_t i = 0; i < inFlight; i++)
+            {
+                exchanges[i] = NewExchangeToAlice(&delegate);
+                ASSERT_NE(exchanges[i], nullptr);
+                ASSERT_EQ(exchanges[i]->SendMessage(kBenchmarkProtocolId, kMsgType_Benchmark, System::PacketBufferHandle::New(32),
+                                                    SendFlags(SendMessageFlags::kExpectResponse)),
+                          CHIP_NO_ERROR);
+            }
+            insertUs += insertStopwatch.ElapsedMicroseconds();
+            ASSERT_EQ(rm->TestGetCountRetransTable(), static_cast<int>(inFlight));
+
+            Stopwatch scanStopwatch;
+            for (uint32_t i = 0; i < kRetransTableScans; i++)
+            {
+                rm->ExecuteActions();
+            }
+            scanUs += scanStopwatch.ElapsedMicroseconds();
+
+            Stopwatch removeStopwatch;
+            for (size_t i = 0; i < inFlight; i++)
+            {
+                exchanges[i]->Abort();
+            }
+            removeUs += removeStopwatch.ElapsedMicroseconds();
+            ASSERT_EQ(rm->TestGetCountRetransTable(), 0);
+        }
+
+        char parameters[32];
+        snprintf(parameters, sizeof(parameters), "in_flight=%u", static_cast<unsigned>(inFlight));
+        const uint32_t messages = kRetransTableRounds * static_cast<uint32_t>(inFlight);
+        PrintResult("retrans_table_insert", parameters, messages, insertUs);
+        PrintResult("retrans_table_scan", parameters, kRetransTableRounds * kRetransTableScans, scanUs);
+        PrintResult("retrans_table_remove", parameters, messages, removeUs);
+    }
+
+    GetLoopback().mNumMessagesToDrop = 0;
+}
+
+TEST_F(MessagingBenchmark, PacketBufferAllocation)
+{
+    for (size_t size : kPacketBufferSizes)
+    {
+        char parameters[32];
+        snprintf(parameters, sizeof(parameters), "size=%u", static_cast<unsigned>(size));
+
+        {
+            Stopwatch stopwatch;
+            for (uint32_t i = 0; i < kPacketBufferIterations; i++)
+            {
+                System::PacketBufferHandle buffer = System::PacketBufferHandle::New(size);
+                ASSERT_FALSE(buffer.IsNull());
+            }
+            PrintResult("packet_buffer_new", parameters, kPacketBufferIterations, stopwatch.ElapsedMicroseconds());
+        }
+
+        {
+            System::PacketBufferHandle original = System::PacketBufferHandle::New(size);
+            ASSERT_FALSE(original.IsNull());
+            original->SetDataLength(size);
+
+            Stopwatch stopwatch;
+            for (uint32_t i = 0; i < kPacketBufferIterations; i++)
+            {
+                System::PacketBufferHandle clone = original.CloneData();
+                ASSERT_FALSE(clone.IsNull());
+            }
+            PrintResult("packet_buffer_clone", parameters, kPacketBufferIterations, stopwatch.ElapsedMicroseconds());
+        }
+    }
+}
+
+} // namespace
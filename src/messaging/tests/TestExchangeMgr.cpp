@@ -226,6 +226,77 @@ TEST_F(TestExchangeMgr, CheckUmhRegistrationTest)
     EXPECT_NE(err, CHIP_NO_ERROR);
 }
 
+TEST_F(TestExchangeMgr, CheckUmhDispatchPrefersMessageType)
+{
+    CHIP_ERROR err;
+    MockAppDelegate mockSolicitedAppDelegate;
+    MockAppDelegate mockProtocolAppDelegate;
+    MockAppDelegate mockTypeAppDelegate;
+
+    err = GetExchangeManager().RegisterUnsolicitedMessageHandlerForProtocol(Protocols::BDX::Id, &mockProtocolAppDelegate);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    err = GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1, &mockTypeAppDelegate);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    // The handler for the message type wins over the handler for the whole protocol.
+    ExchangeContext * ec1 = NewExchangeToAlice(&mockSolicitedAppDelegate);
+    ec1->SendMessage(Protocols::BDX::Id, kMsgType_TEST1, System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                     SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+    DrainAndServiceIO();
+    EXPECT_TRUE(mockTypeAppDelegate.IsOnMessageReceivedCalled);
+    EXPECT_FALSE(mockProtocolAppDelegate.IsOnMessageReceivedCalled);
+
+    // Other message types of the protocol fall back to the protocol handler.
+    mockTypeAppDelegate.IsOnMessageReceivedCalled = false;
+    ec1 = NewExchangeToAlice(&mockSolicitedAppDelegate);
+    ec1->SendMessage(Protocols::BDX::Id, kMsgType_TEST2, System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                     SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+    DrainAndServiceIO();
+    EXPECT_FALSE(mockTypeAppDelegate.IsOnMessageReceivedCalled);
+    EXPECT_TRUE(mockProtocolAppDelegate.IsOnMessageReceivedCalled);
+
+    err = GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    err = GetExchangeManager().UnregisterUnsolicitedMessageHandlerForProtocol(Protocols::BDX::Id);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+}
+
+TEST_F(TestExchangeMgr, CheckUmhPoolExhaustion)
+{
+    MockAppDelegate mockAppDelegate;
+
+    EXPECT_EQ(GetExchangeManager().RegisterUnsolicitedMessageHandlerForProtocol(Protocols::BDX::Id, nullptr),
+              CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Other handlers may already be registered by the messaging context, so fill whatever is left of the pool.
+    uint8_t registered = 0;
+    CHIP_ERROR err     = CHIP_NO_ERROR;
+    while (err == CHIP_NO_ERROR && registered < CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS)
+    {
+        err = GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::Echo::Id, registered, &mockAppDelegate);
+        if (err == CHIP_NO_ERROR)
+        {
+            registered++;
+        }
+    }
+    ASSERT_GT(registered, 0);
+
+    EXPECT_EQ(GetExchangeManager().RegisterUnsolicitedMessageHandlerForProtocol(Protocols::Echo::Id, &mockAppDelegate),
+              CHIP_ERROR_TOO_MANY_UNSOLICITED_MESSAGE_HANDLERS);
+
+    // Re-registering an existing handler does not need a free slot.
+    EXPECT_EQ(GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::Echo::Id, 0, &mockAppDelegate),
+              CHIP_NO_ERROR);
+
+    for (uint8_t i = 0; i < registered; i++)
+    {
+        EXPECT_EQ(GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::Echo::Id, i), CHIP_NO_ERROR);
+    }
+    EXPECT_NE(GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::Echo::Id, 0), CHIP_NO_ERROR);
+}
+
 TEST_F(TestExchangeMgr, CheckExchangeMessages)
 {
     CHIP_ERROR err;
@@ -363,6 +363,59 @@ TEST_F(TestReliableMessageProtocol, CheckAddClearRetrans)
     exchange->Close();
 }
 
+/**
+ * Tests that clearing the retransmission that is due first keeps the other ones scheduled.
+ */
+TEST_F(TestReliableMessageProtocol, CheckClearEarliestRetrans)
+{
+    MockAppDelegate mockSender(*this);
+    ExchangeContext * first  = NewExchangeToAlice(&mockSender);
+    ExchangeContext * second = NewExchangeToAlice(&mockSender);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+
+    first->GetSessionHandle()->AsSecureSession()->SetRemoteSessionParameters(ReliableMessageProtocolConfig({
+        64_ms32, // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+        64_ms32, // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+    }));
+
+    // Drop both initial messages
+    auto & loopback               = GetLoopback();
+    loopback.mSentMessageCount    = 0;
+    loopback.mNumMessagesToDrop   = 2;
+    loopback.mDroppedMessageCount = 0;
+
+    for (ExchangeContext * exchange : { first, second })
+    {
+        chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        EXPECT_FALSE(buffer.IsNull());
+        EXPECT_EQ(exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer), SendMessageFlags::kExpectResponse),
+                  CHIP_NO_ERROR);
+    }
+    DrainAndServiceIO();
+
+    EXPECT_EQ(loopback.mDroppedMessageCount, 2u);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 2);
+
+    // The first message was sent first, so its retransmission is due first.
+    rm->ClearRetransTable(first->GetReliableMessageContext());
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 1);
+
+    // The second message is still retransmitted, and acknowledged this time.
+    GetIOContext().DriveIOUntil(1000_ms32, [&] { return loopback.mSentMessageCount >= 3; });
+    DrainAndServiceIO();
+
+    EXPECT_GE(loopback.mSentMessageCount, 3u);
+    EXPECT_EQ(loopback.mDroppedMessageCount, 2u);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+
+    first->Close();
+    second->Close();
+}
+
 /**
  * Tests MRP retransmission logic with the following scenario:
  *
@@ -28,26 +28,118 @@ namespace chip {
 namespace DeviceLayer {
 namespace Internal {
 
-void DeviceSafeQueue::Push(const ChipDeviceEvent & event)
+// The ring is a bounded multi-producer queue where each cell carries a sequence number: a producer claims an
+// enqueue position with a CAS once the cell for it has been released by the consumer, fills the cell, and then
+// publishes it by advancing its sequence number.
+
+DeviceSafeQueue::DeviceSafeQueue()
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-    mEventQueue.push(event);
+    for (size_t i = 0; i < kRingSize; i++)
+    {
+        mRing[i].mSequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool DeviceSafeQueue::Push(const ChipDeviceEvent & event)
+{
+    // Once events have overflowed, keep using the overflow queue until the consumer has drained it, so that the
+    // events of any one producer are popped in order.
+    if (mOverflowCount.load(std::memory_order_acquire) != 0 || !TryPushRing(event))
+    {
+        std::unique_lock<std::mutex> lock(mOverflowLock);
+        mOverflowQueue.push(event);
+        mOverflowCount.fetch_add(1, std::memory_order_release);
+    }
+
+    // This must come after the event is published: the consumer re-checks the queue after clearing the flag.
+    return !mWakePending.exchange(true);
+}
+
+bool DeviceSafeQueue::PopFront(ChipDeviceEvent & event)
+{
+    if (TryPop(event))
+    {
+        return true;
+    }
+
+    // The queue looked empty: re-arm the wake-up, then look again to pick up any event whose producer saw the
+    // wake-up still pending and so did not signal.
+    mWakePending.exchange(false);
+    return TryPop(event);
 }
 
-bool DeviceSafeQueue::Empty()
+bool DeviceSafeQueue::TryPushRing(const ChipDeviceEvent & event)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-    return mEventQueue.empty();
+    size_t pos = mEnqueuePos.load(std::memory_order_relaxed);
+    Cell * cell;
+
+    for (;;)
+    {
+        cell                = &mRing[pos % kRingSize];
+        const size_t seq    = cell->mSequence.load(std::memory_order_acquire);
+        const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+        if (diff == 0)
+        {
+            if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The consumer has not released this cell from the previous lap yet: the ring is full.
+            return false;
+        }
+        else
+        {
+            pos = mEnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->mEvent = event;
+    cell->mSequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool DeviceSafeQueue::TryPopRing(ChipDeviceEvent & event)
+{
+    Cell & cell = mRing[mDequeuePos % kRingSize];
+
+    // A claimed cell whose producer has not published it yet also reads as empty, and holds back the cells
+    // behind it; that producer's own Push() wakes the consumer if needed.
+    if (cell.mSequence.load(std::memory_order_acquire) != mDequeuePos + 1)
+    {
+        return false;
+    }
+
+    event = cell.mEvent;
+    cell.mSequence.store(mDequeuePos + kRingSize, std::memory_order_release);
+    mDequeuePos++;
+    return true;
 }
 
-ChipDeviceEvent DeviceSafeQueue::PopFront()
+bool DeviceSafeQueue::TryPop(ChipDeviceEvent & event)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
+    // Anything in the ring was pushed before the overflow queue started to fill, or after it was last drained,
+    // so the ring goes first.
+    if (TryPopRing(event))
+    {
+        return true;
+    }
 
-    const ChipDeviceEvent event = mEventQueue.front();
-    mEventQueue.pop();
+    // If a producer is still filling the cell at the head of the ring, wait for it rather than skipping ahead to the
+    // overflow queue, which may hold later events of the producers behind it.
+    if (mEnqueuePos.load(std::memory_order_acquire) != mDequeuePos || mOverflowCount.load(std::memory_order_acquire) == 0)
+    {
+        return false;
+    }
 
-    return event;
+    std::unique_lock<std::mutex> lock(mOverflowLock);
+    event = mOverflowQueue.front();
+    mOverflowQueue.pop();
+    mOverflowCount.fetch_sub(1, std::memory_order_release);
+    return true;
 }
 
 } // namespace Internal
@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <mutex>
 #include <queue>
 
@@ -39,24 +40,60 @@ namespace Internal {
  *  @class DeviceSafeQueue
  *
  *  @brief
- *      This class represents a thread-safe message queue implemented with C++ Standard Library, the message queue
- *      is used by the CHIP event loop to hold incoming messages. Each message is sequentially dequeued, decoded,
- *      and then an action is performed.
+ *      This class represents a thread-safe message queue, used by the CHIP event loop to hold incoming messages.
+ *      Each message is sequentially dequeued, decoded, and then an action is performed.
  *
+ *      Any number of threads may push, but only the CHIP event loop thread may pop. Events go into a lock-free
+ *      ring of CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE entries; only when that is full do they spill into a
+ *      mutex-protected overflow queue, so the queue stays unbounded and FIFO per producer thread.
+ *
+ *      Push() also coalesces wake-ups: it only asks the caller to wake the consumer for the first event pushed
+ *      after the consumer found the queue empty, since the consumer keeps popping until then anyway.
  */
 class DeviceSafeQueue
 {
 public:
-    DeviceSafeQueue()  = default;
+    DeviceSafeQueue();
     ~DeviceSafeQueue() = default;
 
-    void Push(const ChipDeviceEvent & event);
-    bool Empty();
-    ChipDeviceEvent PopFront();
+    /**
+     * Add an event at the back of the queue. May be called from any thread.
+     *
+     * @return true if the caller must wake up the consumer, false if a wake-up is already pending.
+     */
+    bool Push(const ChipDeviceEvent & event);
+
+    /**
+     * Remove the event at the front of the queue. Must only be called from the consumer thread.
+     *
+     * @return false if the queue is empty. This re-arms the wake-up reported by Push().
+     */
+    bool PopFront(ChipDeviceEvent & event);
 
 private:
-    std::queue<ChipDeviceEvent> mEventQueue;
-    std::mutex mEventQueueLock;
+    static constexpr size_t kRingSize = CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE;
+    static_assert(kRingSize > 0, "CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE must be positive");
+
+    struct Cell
+    {
+        // Equals the enqueue position the cell is free for, or that position + 1 once it holds an event.
+        std::atomic<size_t> mSequence;
+        ChipDeviceEvent mEvent;
+    };
+
+    bool TryPushRing(const ChipDeviceEvent & event);
+    bool TryPopRing(ChipDeviceEvent & event);
+    bool TryPop(ChipDeviceEvent & event);
+
+    Cell mRing[kRingSize];
+    std::atomic<size_t> mEnqueuePos{ 0 };
+    size_t mDequeuePos = 0; // Only touched by the consumer.
+
+    std::queue<ChipDeviceEvent> mOverflowQueue;
+    std::mutex mOverflowLock;
+    std::atomic<size_t> mOverflowCount{ 0 };
+
+    std::atomic<bool> mWakePending{ false };
 
     DeviceSafeQueue(const DeviceSafeQueue &)             = delete;
     DeviceSafeQueue & operator=(const DeviceSafeQueue &) = delete;
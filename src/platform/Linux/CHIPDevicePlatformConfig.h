@@ -54,6 +54,27 @@
 // These are configuration options that are unique to Linux platforms.
 // These can be overridden by the application as needed.
 
+/**
+ * CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STORAGE
+ *
+ * Keep the KVS of KeyValueStoreManagerImpl in an append-only log file (ChipLinuxLogStorage) instead of an INI file
+ * rewritten on every change.  Meant for controllers persisting the state of many nodes.  The formats are not
+ * compatible: the KVS file path has to change along with this setting.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STORAGE
+#define CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STORAGE 0
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STORAGE
+
+/**
+ * CHIP_DEVICE_CONFIG_LINUX_DIAGNOSTIC_SAMPLING_INTERVAL_MS
+ *
+ * Interval at which DiagnosticDataProviderImpl samples the interface statistics and the ethtool and wireless ioctls.
+ * The network diagnostics attributes read in between are served from the last sample.  0 samples on every read.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_DIAGNOSTIC_SAMPLING_INTERVAL_MS
+#define CHIP_DEVICE_CONFIG_LINUX_DIAGNOSTIC_SAMPLING_INTERVAL_MS 1000
+#endif // CHIP_DEVICE_CONFIG_LINUX_DIAGNOSTIC_SAMPLING_INTERVAL_MS
+
 // ========== Platform-specific Configuration Overrides =========
 
 #ifndef CHIP_DEVICE_CONFIG_CHIP_TASK_STACK_SIZE
@@ -0,0 +1,373 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Provides an implementation of a key-value store kept in an
+ *          append-only log file on Linux platforms.
+ *
+ *          The log starts with an 8 byte magic, and is followed by records of:
+ *
+ *          - CRC32 of the rest of the record, 4 bytes
+ *          - Record type, 1 byte
+ *          - Key length, 2 bytes
+ *          - Value length, 4 bytes, 0 for deletions
+ *          - Key, and value
+ *
+ *          with integers in little endian.
+ */
+
+#include <platform/Linux/CHIPLinuxLogStorage.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TemporaryFileStream.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+namespace {
+
+constexpr uint8_t kLogMagic[]      = { 'C', 'H', 'I', 'P', 'K', 'V', 'L', '1' };
+constexpr size_t kRecordHeaderSize = 4 + 1 + 2 + 4;
+
+uint32_t Crc32(const uint8_t * data, size_t len)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < len; i++)
+    {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+CHIP_ERROR WriteAll(int fd, const uint8_t * data, size_t len)
+{
+    while (len > 0)
+    {
+        ssize_t written = write(fd, data, len);
+        if (written < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(written > 0, CHIP_ERROR_WRITE_FAILED);
+        data += written;
+        len -= static_cast<size_t>(written);
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+size_t ChipLinuxLogStorage::RecordSize(const std::string & key, size_t valueLen)
+{
+    return kRecordHeaderSize + key.size() + valueLen;
+}
+
+CHIP_ERROR ChipLinuxLogStorage::Init(const char * logFile)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    if (mInitialized)
+    {
+        ChipLogError(DeviceLayer, "ChipLinuxLogStorage::Init: Attempt to re-initialize with KVS log file: %s",
+                     StringOrNullMarker(logFile));
+        return CHIP_NO_ERROR;
+    }
+
+    VerifyOrReturnError(logFile != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    ChipLogDetail(DeviceLayer, "ChipLinuxLogStorage::Init: Using KVS log file: %s", logFile);
+
+    mLogPath = logFile;
+    mLogFd   = FileDescriptor(open(logFile, O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, S_IRUSR | S_IWUSR));
+    VerifyOrReturnError(mLogFd.Get() != -1, CHIP_ERROR_OPEN_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to open KVS log %s: %s", logFile, strerror(errno)));
+
+    ReturnErrorOnFailure(LoadLog());
+    mInitialized = true;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxLogStorage::LoadLog()
+{
+    struct stat st;
+    VerifyOrReturnError(fstat(mLogFd.Get(), &st) == 0, CHIP_ERROR_READ_FAILED);
+
+    std::vector<uint8_t> log(static_cast<size_t>(st.st_size));
+    size_t loaded = 0;
+    while (loaded < log.size())
+    {
+        ssize_t rv = pread(mLogFd.Get(), log.data() + loaded, log.size() - loaded, static_cast<off_t>(loaded));
+        if (rv < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(rv > 0, CHIP_ERROR_READ_FAILED);
+        loaded += static_cast<size_t>(rv);
+    }
+
+    mValues.clear();
+    mLiveSize = 0;
+
+    if (log.empty())
+    {
+        ReturnErrorOnFailure(WriteAll(mLogFd.Get(), kLogMagic, sizeof(kLogMagic)));
+        mLogSize = sizeof(kLogMagic);
+        return CHIP_NO_ERROR;
+    }
+
+    VerifyOrReturnError(log.size() >= sizeof(kLogMagic) && memcmp(log.data(), kLogMagic, sizeof(kLogMagic)) == 0,
+                        CHIP_ERROR_INTEGRITY_CHECK_FAILED,
+                        ChipLogError(DeviceLayer, "%s is not a KVS log", mLogPath.c_str()));
+
+    size_t offset = sizeof(kLogMagic);
+    while (log.size() - offset >= kRecordHeaderSize)
+    {
+        const uint8_t * record = log.data() + offset;
+        uint8_t type           = record[4];
+        size_t keyLen          = Encoding::LittleEndian::Get16(record + 5);
+        size_t valueLen        = Encoding::LittleEndian::Get32(record + 7);
+
+        if (valueLen > log.size() - offset - kRecordHeaderSize - keyLen || keyLen > log.size() - offset - kRecordHeaderSize)
+        {
+            break;
+        }
+
+        size_t recordLen = kRecordHeaderSize + keyLen + valueLen;
+        if (Encoding::LittleEndian::Get32(record) != Crc32(record + 4, recordLen - 4))
+        {
+            break;
+        }
+
+        std::string key(reinterpret_cast<const char *>(record + kRecordHeaderSize), keyLen);
+        auto existing = mValues.find(key);
+        if (existing != mValues.end())
+        {
+            mLiveSize -= RecordSize(existing->first, existing->second.size());
+            mValues.erase(existing);
+        }
+
+        if (type == to_underlying(RecordType::kPut))
+        {
+            const uint8_t * value = record + kRecordHeaderSize + keyLen;
+            mValues.emplace(key, std::vector<uint8_t>(value, value + valueLen));
+            mLiveSize += recordLen;
+        }
+
+        offset += recordLen;
+    }
+
+    if (offset != log.size())
+    {
+        // Later appends would otherwise follow the torn record, and be lost at the next load.
+        ChipLogError(DeviceLayer, "Dropping %u bytes of torn records at the end of %s", static_cast<unsigned>(log.size() - offset),
+                     mLogPath.c_str());
+        VerifyOrReturnError(ftruncate(mLogFd.Get(), static_cast<off_t>(offset)) == 0, CHIP_ERROR_WRITE_FAILED);
+    }
+
+    mLogSize = offset;
+    ChipLogDetail(DeviceLayer, "Loaded %u keys from %s", static_cast<unsigned>(mValues.size()), mLogPath.c_str());
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxLogStorage::EncodeRecord(RecordType type, const std::string & key, const uint8_t * value, size_t valueLen,
+                                             std::vector<uint8_t> & outLog)
+{
+    VerifyOrReturnError(key.size() <= UINT16_MAX && valueLen <= UINT32_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+
+    size_t start = outLog.size();
+    outLog.resize(start + RecordSize(key, valueLen));
+    uint8_t * record = outLog.data() + start;
+
+    Encoding::LittleEndian::BufferWriter writer(record + 4, outLog.size() - start - 4);
+    writer.Put8(to_underlying(type)).Put16(static_cast<uint16_t>(key.size())).Put32(static_cast<uint32_t>(valueLen));
+    writer.Put(key.data(), key.size());
+    if (valueLen > 0)
+    {
+        writer.Put(value, valueLen);
+    }
+    VerifyOrReturnError(writer.Fit(), CHIP_ERROR_INTERNAL);
+    Encoding::LittleEndian::Put32(record, Crc32(record + 4, writer.Needed()));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxLogStorage::AppendRecord(RecordType type, const std::string & key, const uint8_t * value, size_t valueLen)
+{
+    std::vector<uint8_t> record;
+    ReturnErrorOnFailure(EncodeRecord(type, key, value, valueLen, record));
+
+    CHIP_ERROR err = WriteAll(mLogFd.Get(), record.data(), record.size());
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to append to KVS log %s: %s", mLogPath.c_str(), strerror(errno));
+        // Drop what was written of the record, so that the next appends are not lost behind it.
+        if (ftruncate(mLogFd.Get(), static_cast<off_t>(mLogSize)) != 0)
+        {
+            ChipLogError(DeviceLayer, "Failed to truncate KVS log %s: %s", mLogPath.c_str(), strerror(errno));
+        }
+        return err;
+    }
+
+    mLogSize += record.size();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxLogStorage::ReadValueBin(const char * key, uint8_t * buf, size_t bufSize, size_t & outLen)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    auto it = mValues.find(key);
+    VerifyOrReturnError(it != mValues.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+    outLen = it->second.size();
+    VerifyOrReturnError(outLen <= bufSize, CHIP_ERROR_BUFFER_TOO_SMALL);
+    if (outLen > 0)
+    {
+        memcpy(buf, it->second.data(), outLen);
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxLogStorage::WriteValueBin(const char * key, const uint8_t * data, size_t dataLen)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(data != nullptr || dataLen == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::string keyStr(key);
+    ReturnErrorOnFailure(AppendRecord(RecordType::kPut, keyStr, data, dataLen));
+
+    auto existing = mValues.find(keyStr);
+    if (existing != mValues.end())
+    {
+        mLiveSize -= RecordSize(keyStr, existing->second.size());
+        existing->second.assign(data, data + dataLen);
+    }
+    else
+    {
+        mValues.emplace(keyStr, std::vector<uint8_t>(data, data + dataLen));
+    }
+    mLiveSize += RecordSize(keyStr, dataLen);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxLogStorage::ClearValue(const char * key)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+
+    auto it = mValues.find(key);
+    VerifyOrReturnError(it != mValues.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+    ReturnErrorOnFailure(AppendRecord(RecordType::kDelete, it->first, nullptr, 0));
+    mLiveSize -= RecordSize(it->first, it->second.size());
+    mValues.erase(it);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxLogStorage::ClearAll()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+
+    mValues.clear();
+    mLiveSize = 0;
+    return CompactLocked();
+}
+
+bool ChipLinuxLogStorage::HasValue(const char * key)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    return mValues.find(key) != mValues.end();
+}
+
+CHIP_ERROR ChipLinuxLogStorage::Commit()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+
+    if (mLogSize > kMinCompactionLogSize && mLogSize > 2 * (sizeof(kLogMagic) + mLiveSize))
+    {
+        return CompactLocked();
+    }
+
+    VerifyOrReturnError(fdatasync(mLogFd.Get()) == 0, CHIP_ERROR_WRITE_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to sync KVS log %s: %s", mLogPath.c_str(), strerror(errno)));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxLogStorage::Compact()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    return CompactLocked();
+}
+
+CHIP_ERROR ChipLinuxLogStorage::CompactLocked()
+{
+    // Same crash safety as ChipLinuxStorageIni::CommitConfig(): the new log replaces the old one once complete.
+    TemporaryFileStream tmpFile(mLogPath + "-XXXXXX");
+    VerifyOrReturnError(
+        tmpFile.IsOpen(), CHIP_ERROR_OPEN_FAILED,
+        ChipLogError(DeviceLayer, "Failed to create temp file %s: %s", tmpFile.GetFileName().c_str(), strerror(errno)));
+
+    std::vector<uint8_t> log(kLogMagic, kLogMagic + sizeof(kLogMagic));
+    log.reserve(sizeof(kLogMagic) + mLiveSize);
+    for (const auto & entry : mValues)
+    {
+        ReturnErrorOnFailure(EncodeRecord(RecordType::kPut, entry.first, entry.second.data(), entry.second.size(), log));
+    }
+
+    tmpFile.write(reinterpret_cast<const char *>(log.data()), static_cast<std::streamsize>(log.size()));
+    VerifyOrReturnError(
+        tmpFile.good() && tmpFile.DataSync(), CHIP_ERROR_WRITE_FAILED,
+        ChipLogError(DeviceLayer, "Failed to write temp file %s: %s", tmpFile.GetFileName().c_str(), strerror(errno)));
+
+    // Opened before the rename, so that appends never go to the old log once it is replaced.
+    FileDescriptor logFd(open(tmpFile.GetFileName().c_str(), O_RDWR | O_APPEND | O_CLOEXEC));
+    VerifyOrReturnError(logFd.Get() != -1, CHIP_ERROR_OPEN_FAILED);
+
+    int rv = rename(tmpFile.GetFileName().c_str(), mLogPath.c_str());
+    VerifyOrReturnError(rv == 0, CHIP_ERROR_WRITE_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to rename %s to %s: %s", tmpFile.GetFileName().c_str(),
+                                     mLogPath.c_str(), strerror(errno)));
+
+    ChipLogDetail(DeviceLayer, "Compacted KVS log %s from %u to %u bytes", mLogPath.c_str(), static_cast<unsigned>(mLogSize),
+                  static_cast<unsigned>(log.size()));
+    mLogFd   = std::move(logFd);
+    mLogSize = log.size();
+    return CHIP_NO_ERROR;
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -0,0 +1,117 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *         This file defines a key-value store kept in an append-only log file, for
+ *         KeyValueStoreManagerImpl when CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STORAGE
+ *         is enabled.
+ *
+ *         Each write or deletion appends a checksummed record to the log, instead
+ *         of rewriting the whole file as ChipLinuxStorage does, so the cost of a
+ *         change does not depend on the size of the store.  The current value of
+ *         each key is kept in memory.  Once most of the log is made of
+ *         overwritten and deleted records, the live records are written to a new
+ *         log which replaces the old one.
+ *
+ *         A record torn by a crash or power loss is dropped, along with anything
+ *         after it, when the log is loaded.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/FileDescriptor.h>
+
+#include <map>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+class ChipLinuxLogStorage
+{
+public:
+    /// The log is compacted once it is larger than this and more than twice the size of its live records.
+    static constexpr size_t kMinCompactionLogSize = 64 * 1024;
+
+    /**
+     * Open the log file, creating it if needed, and load its records.
+     */
+    CHIP_ERROR Init(const char * logFile);
+
+    /**
+     * Same contract as ChipLinuxStorage::ReadValueBin(): returns CHIP_ERROR_BUFFER_TOO_SMALL, with the size of the
+     * value in outLen, if bufSize is too small.
+     */
+    CHIP_ERROR ReadValueBin(const char * key, uint8_t * buf, size_t bufSize, size_t & outLen);
+    CHIP_ERROR WriteValueBin(const char * key, const uint8_t * data, size_t dataLen);
+    CHIP_ERROR ClearValue(const char * key);
+    CHIP_ERROR ClearAll();
+    bool HasValue(const char * key);
+
+    /**
+     * Make the appended records durable, and compact the log if most of it is garbage.
+     */
+    CHIP_ERROR Commit();
+
+    /**
+     * Records are durable once committed: there is nothing to wait for.
+     */
+    CHIP_ERROR Flush() { return CHIP_NO_ERROR; }
+
+    /**
+     * Replace the log by one holding only the live records.
+     */
+    CHIP_ERROR Compact();
+
+    size_t GetLogSize() const { return mLogSize; }
+    size_t GetLiveSize() const { return mLiveSize; }
+
+private:
+    enum class RecordType : uint8_t
+    {
+        kPut    = 1,
+        kDelete = 2,
+    };
+
+    static size_t RecordSize(const std::string & key, size_t valueLen);
+    static CHIP_ERROR EncodeRecord(RecordType type, const std::string & key, const uint8_t * value, size_t valueLen,
+                                   std::vector<uint8_t> & outLog);
+
+    CHIP_ERROR LoadLog();
+    CHIP_ERROR AppendRecord(RecordType type, const std::string & key, const uint8_t * value, size_t valueLen);
+    CHIP_ERROR CompactLocked();
+
+    std::mutex mLock;
+    std::string mLogPath;
+    FileDescriptor mLogFd;
+    std::map<std::string, std::vector<uint8_t>> mValues;
+    size_t mLogSize   = 0;
+    size_t mLiveSize  = 0;
+    bool mInitialized = false;
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -23,6 +23,7 @@
  *
  */
 
+#include <algorithm>
 #include <errno.h>
 #include <fstream>
 #include <inttypes.h>
@@ -47,7 +48,11 @@ ChipLinuxStorage::ChipLinuxStorage()
     mDirty = false;
 }
 
-ChipLinuxStorage::~ChipLinuxStorage() {}
+ChipLinuxStorage::~ChipLinuxStorage()
+{
+    StopCommitThread();
+    Flush();
+}
 
 CHIP_ERROR ChipLinuxStorage::Init(const char * configFile)
 {
@@ -337,7 +342,14 @@ CHIP_ERROR ChipLinuxStorage::Commit()
     {
         mLock.lock();
 
-        retval = ChipLinuxStorageIni::CommitConfig(mConfigPath);
+        if (mCommitMode == CommitMode::kSync)
+        {
+            retval = ChipLinuxStorageIni::CommitConfig(mConfigPath);
+        }
+        else if (!mCommitPending)
+        {
+            SchedulePendingCommit(mCommitWindow);
+        }
 
         mLock.unlock();
     }
@@ -349,6 +361,105 @@ CHIP_ERROR ChipLinuxStorage::Commit()
     return retval;
 }
 
+CHIP_ERROR ChipLinuxStorage::SetCommitMode(CommitMode mode, System::Clock::Milliseconds32 window)
+{
+    VerifyOrReturnError(mode == CommitMode::kGroupCommit || window == System::Clock::kZero, CHIP_ERROR_INVALID_ARGUMENT);
+
+    StopCommitThread();
+    ReturnErrorOnFailure(Flush());
+
+    mLock.lock();
+    mCommitMode       = mode;
+    mCommitWindow     = window;
+    mStopCommitThread = false;
+    mLock.unlock();
+
+    if (mode != CommitMode::kSync)
+    {
+        mCommitThread = std::thread(&ChipLinuxStorage::CommitThreadMain, this);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorage::Flush()
+{
+    // Snapshots are taken and written in order, so that a write never replaces the file with older settings.
+    std::lock_guard<std::mutex> commitLock(mCommitLock);
+    std::string config;
+
+    mLock.lock();
+    bool pending = mCommitPending;
+    if (pending)
+    {
+        config         = ChipLinuxStorageIni::GenerateConfig();
+        mCommitPending = false;
+    }
+    mLock.unlock();
+
+    VerifyOrReturnError(pending, CHIP_NO_ERROR);
+
+    CHIP_ERROR retval = ChipLinuxStorageIni::WriteConfig(mConfigPath, config);
+    if (retval != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to write deferred settings to %s, will retry: %" CHIP_ERROR_FORMAT, mConfigPath.c_str(),
+                     retval.Format());
+
+        mLock.lock();
+        if (!mCommitPending)
+        {
+            // Without a delay, the asynchronous mode would retry in a loop.
+            SchedulePendingCommit(std::max<std::chrono::steady_clock::duration>(mCommitWindow, std::chrono::seconds(1)));
+        }
+        mLock.unlock();
+    }
+
+    return retval;
+}
+
+// Called with mLock held.
+void ChipLinuxStorage::SchedulePendingCommit(std::chrono::steady_clock::duration delay)
+{
+    mCommitPending  = true;
+    mCommitDeadline = std::chrono::steady_clock::now() + delay;
+    mCommitCondition.notify_one();
+}
+
+void ChipLinuxStorage::CommitThreadMain()
+{
+    std::unique_lock<std::mutex> lock(mLock);
+    while (!mStopCommitThread)
+    {
+        if (!mCommitPending)
+        {
+            mCommitCondition.wait(lock);
+            continue;
+        }
+
+        // Changes committed meanwhile join the pending write.
+        if (mCommitCondition.wait_until(lock, mCommitDeadline, [this] { return mStopCommitThread; }))
+        {
+            break;
+        }
+
+        lock.unlock();
+        Flush();
+        lock.lock();
+    }
+}
+
+void ChipLinuxStorage::StopCommitThread()
+{
+    VerifyOrReturn(mCommitThread.joinable());
+
+    mLock.lock();
+    mStopCommitThread = true;
+    mCommitCondition.notify_one();
+    mLock.unlock();
+
+    mCommitThread.join();
+}
+
 } // namespace Internal
 } // namespace DeviceLayer
 } // namespace chip
@@ -29,13 +29,22 @@
  *
  *         ChipLinuxStorage wraps the storage class ChipLinuxStorageIni with mutex.
  *
+ *         Commit() writes the whole file.  The group commit and asynchronous
+ *         commit modes write it from a background thread instead, once for
+ *         all the changes made within a window, and Flush() is the durability
+ *         barrier of those modes.
+ *
  */
 
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
 #include <mutex>
 #include <platform/Linux/CHIPLinuxStorageIni.h>
 #include <string>
+#include <system/SystemClock.h>
+#include <thread>
 
 #ifndef FATCONFDIR
 #define FATCONFDIR "/tmp"
@@ -66,6 +75,13 @@ namespace Internal {
 class ChipLinuxStorage : private ChipLinuxStorageIni
 {
 public:
+    enum class CommitMode : uint8_t
+    {
+        kSync,        ///< Commit() writes the file before returning.
+        kGroupCommit, ///< Commit() returns at once, the file is written a window after the first uncommitted change.
+        kAsync,       ///< Commit() returns at once, the file is written as soon as possible.
+    };
+
     ChipLinuxStorage();
     ~ChipLinuxStorage();
 
@@ -87,11 +103,38 @@ public:
     CHIP_ERROR Commit();
     bool HasValue(const char * key);
 
+    /**
+     * Select when Commit() writes the file.  The default is CommitMode::kSync.
+     *
+     * @param[in] mode    The commit mode.
+     * @param[in] window  For CommitMode::kGroupCommit, how long changes wait for others to be written with them.
+     */
+    CHIP_ERROR SetCommitMode(CommitMode mode, System::Clock::Milliseconds32 window = System::Clock::kZero);
+
+    /**
+     * Write the changes committed but not written yet, if any, before returning.
+     */
+    CHIP_ERROR Flush();
+
 private:
+    void CommitThreadMain();
+    void StopCommitThread();
+    void SchedulePendingCommit(std::chrono::steady_clock::duration delay);
+
     std::mutex mLock;
     bool mDirty;
     std::string mConfigPath;
     bool mInitialized = false;
+
+    // Deferred commits, see CommitMode.  mLock protects the state, mCommitLock serializes the file writes.
+    std::mutex mCommitLock;
+    std::condition_variable mCommitCondition;
+    std::thread mCommitThread;
+    CommitMode mCommitMode = CommitMode::kSync;
+    std::chrono::steady_clock::duration mCommitWindow{};
+    std::chrono::steady_clock::time_point mCommitDeadline;
+    bool mCommitPending    = false;
+    bool mStopCommitThread = false;
 };
 
 } // namespace Internal
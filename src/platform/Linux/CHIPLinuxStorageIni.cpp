@@ -24,6 +24,7 @@
  */
 
 #include <fstream>
+#include <sstream>
 #include <string>
 #include <unistd.h>
 
@@ -91,13 +92,25 @@ CHIP_ERROR ChipLinuxStorageIni::AddConfig(const std::string & configFile)
 // 2. Sync'ing the temp file to commit updated data
 // 3. Using rename() to overwrite the existing file
 CHIP_ERROR ChipLinuxStorageIni::CommitConfig(const std::string & configFile)
+{
+    return WriteConfig(configFile, GenerateConfig());
+}
+
+std::string ChipLinuxStorageIni::GenerateConfig()
+{
+    std::ostringstream config;
+    mConfigStore.generate(config);
+    return config.str();
+}
+
+CHIP_ERROR ChipLinuxStorageIni::WriteConfig(const std::string & configFile, const std::string & config)
 {
     TemporaryFileStream tmpFile(configFile + "-XXXXXX");
     VerifyOrReturnError(
         tmpFile.IsOpen(), CHIP_ERROR_OPEN_FAILED,
         ChipLogError(DeviceLayer, "Failed to create temp file %s: %s", tmpFile.GetFileName().c_str(), strerror(errno)));
 
-    mConfigStore.generate(tmpFile);
+    tmpFile << config;
     VerifyOrReturnError(
         tmpFile.DataSync(), CHIP_ERROR_WRITE_FAILED,
         ChipLogError(DeviceLayer, "Failed to sync temp file %s: %s", tmpFile.GetFileName().c_str(), strerror(errno)));
@@ -42,6 +42,9 @@ public:
     CHIP_ERROR Init();
     CHIP_ERROR AddConfig(const std::string & configFile);
     CHIP_ERROR CommitConfig(const std::string & configFile);
+    // CommitConfig() in two steps, so that the file can be written without holding on the settings.
+    std::string GenerateConfig();
+    static CHIP_ERROR WriteConfig(const std::string & configFile, const std::string & config);
     CHIP_ERROR GetUInt16Value(const char * key, uint16_t & val);
     CHIP_ERROR GetUIntValue(const char * key, uint32_t & val);
     CHIP_ERROR GetUInt64Value(const char * key, uint64_t & val);
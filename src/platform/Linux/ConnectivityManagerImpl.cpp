@@ -165,6 +165,7 @@ void ConnectivityManagerImpl::_OnPlatformEvent(const ChipDeviceEvent * event)
         break;
     case DeviceEventType::kCHIPoWiFiPAFConnected:
         ChipLogProgress(DeviceLayer, "WiFi-PAF: event: kCHIPoWiFiPAFConnected");
+        _GetWiFiPAF()->OnWiFiPAFConnected();
         if (mOnPafSubscribeComplete != nullptr)
         {
             mOnPafSubscribeComplete(mAppState);
@@ -823,7 +824,8 @@ const char srv_name[] = "_matterc._udp";
     NAN-USD Service Protocol Type: ref: Table 58 of Wi-Fi Aware Specificaiton
 */
 #define MAX_PAF_PUBLISH_SSI_BUFLEN 512
-#define MAX_PAF_TX_SSI_BUFLEN 2048
+// The follow-up frame is passed to wpa_supplicant as hex, after its addressing arguments
+#define MAX_PAF_TX_SSI_BUFLEN (2 * CHIP_DEVICE_CONFIG_WIFIPAF_MAX_FRAME_SIZE + 128)
 #define NAN_SRV_PROTO_MATTER 3
 #define NAM_PUBLISH_PERIOD 300u
 #define NAN_PUBLISH_SSI_TAG " ssi="
@@ -1399,6 +1401,7 @@ void ConnectivityManagerImpl::OnDiscoveryResult(gboolean success, GVariant * dis
     else
     {
         GetWiFiPAF()->SetWiFiPAFState(Transport::WiFiPAFBase::State::kInitialized);
+        DeviceLayer::SystemLayer().ScheduleLambda([this]() { GetWiFiPAF()->OnWiFiPAFConnectionError(CHIP_ERROR_TIMEOUT); });
         if (mOnPafSubscribeError != nullptr)
         {
             mOnPafSubscribeError(mAppState, CHIP_ERROR_TIMEOUT);
@@ -1531,7 +1534,7 @@ CHIP_ERROR ConnectivityManagerImpl::_WiFiPAFCancelConnect()
 
 CHIP_ERROR ConnectivityManagerImpl::_WiFiPAFSend(System::PacketBufferHandle && msgBuf)
 {
-    ChipLogProgress(Controller, "WiFi-PAF: sending PAF Follow-up packets, (%lu)", msgBuf->DataLength());
+    ChipLogDetail(Controller, "WiFi-PAF: sending PAF Follow-up packets, (%lu)", msgBuf->DataLength());
     CHIP_ERROR ret = CHIP_NO_ERROR;
 
     if (msgBuf.IsNull())
@@ -1556,23 +1559,54 @@ CHIP_ERROR ConnectivityManagerImpl::_WiFiPAFSend(System::PacketBufferHandle && m
 
     // ================================================================================================================
     //  Send the packets
-    GAutoPtr<GError> err;
     gchar args[MAX_PAF_TX_SSI_BUFLEN];
 
     snprintf(args, sizeof(args), "handle=%u req_instance_id=%u address=%02x:%02x:%02x:%02x:%02x:%02x ssi=", mpaf_info.subscribe_id,
              mpaf_info.peer_publish_id, mpaf_info.peer_addr[0], mpaf_info.peer_addr[1], mpaf_info.peer_addr[2],
              mpaf_info.peer_addr[3], mpaf_info.peer_addr[4], mpaf_info.peer_addr[5]);
 
-    ChipLogProgress(Controller, "===> %s(), (%lu, %u)", __FUNCTION__, (strlen(args) + msgBuf->DataLength()), MAX_PAF_TX_SSI_BUFLEN)
-        VerifyOrReturnError((strlen(args) + msgBuf->DataLength() < MAX_PAF_TX_SSI_BUFLEN), CHIP_ERROR_BUFFER_TOO_SMALL);
+    VerifyOrReturnError((strlen(args) + msgBuf->DataLength() * 2 < MAX_PAF_TX_SSI_BUFLEN), CHIP_ERROR_BUFFER_TOO_SMALL);
 
     ret = chip::Encoding::BytesToUppercaseHexString(msgBuf->Start(), msgBuf->DataLength(), &args[strlen(args)],
                                                     MAX_PAF_TX_SSI_BUFLEN - strlen(args));
     VerifyOrReturnError(ret == CHIP_NO_ERROR, ret);
-    ChipLogProgress(DeviceLayer, "WiFi-PAF: ssi: [%s]", args);
-    wpa_fi_w1_wpa_supplicant1_interface_call_nantransmit_sync(mWpaSupplicant.iface, args, nullptr, &err.GetReceiver());
-    ChipLogProgress(Controller, "WiFi-PAF: Outbound message (%lu) done", msgBuf->DataLength());
-    return ret;
+    ChipLogDetail(DeviceLayer, "WiFi-PAF: ssi: [%s]", args);
+
+    // Start the transmission without waiting for wpa_supplicant to complete it, so that the transport can hand the next
+    // frames over in the meantime. D-Bus keeps the calls in order. The completion is reported to the transport with
+    // WiFiPAFBase::OnWiFiPAFMessageSent().
+    struct TransmitContext
+    {
+        ConnectivityManagerImpl * self;
+        const gchar * args;
+    } context = { this, args };
+
+    return PlatformMgrImpl().GLibMatterContextInvokeSync(
+        +[](TransmitContext * ctx) {
+            wpa_fi_w1_wpa_supplicant1_interface_call_nantransmit(
+                ctx->self->mWpaSupplicant.iface, ctx->args, nullptr,
+                reinterpret_cast<GAsyncReadyCallback>(
+                    +[](GObject * sourceObject, GAsyncResult * res, ConnectivityManagerImpl * self) {
+                        return self->OnNanTransmitDone(res);
+                    }),
+                ctx->self);
+            return CHIP_NO_ERROR;
+        },
+        &context);
+}
+
+void ConnectivityManagerImpl::OnNanTransmitDone(GAsyncResult * res)
+{
+    GAutoPtr<GError> err;
+    CHIP_ERROR result = CHIP_NO_ERROR;
+
+    if (!wpa_fi_w1_wpa_supplicant1_interface_call_nantransmit_finish(mWpaSupplicant.iface, res, &err.GetReceiver()))
+    {
+        ChipLogError(DeviceLayer, "WiFi-PAF: nan-transmit failed: %s", err ? err->message : "unknown error");
+        result = CHIP_ERROR_SENDING_BLOCKED;
+    }
+
+    DeviceLayer::SystemLayer().ScheduleLambda([this, result]() { GetWiFiPAF()->OnWiFiPAFMessageSent(result); });
 }
 
 #endif // CHIP_DEVICE_CONFIG_ENABLE_WIFIPAF
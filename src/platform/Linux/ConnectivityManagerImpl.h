@@ -146,6 +146,7 @@ public:
     CHIP_ERROR _WiFiPAFCancelConnect();
     void OnDiscoveryResult(gboolean success, GVariant * obj);
     void OnNanReceive(GVariant * obj);
+    void OnNanTransmitDone(GAsyncResult * res);
     void OnNanSubscribeTerminated(gint term_subscribe_id, gint reason);
     CHIP_ERROR _WiFiPAFSend(chip::System::PacketBufferHandle && msgBuf);
     Transport::WiFiPAFBase * _GetWiFiPAF();
@@ -56,162 +56,11 @@ using namespace ::chip::app::Clusters::GeneralDiagnostics;
 
 namespace {
 
-enum class EthernetStatsCountType
-{
-    kEthPacketRxCount,
-    kEthPacketTxCount,
-    kEthTxErrCount,
-    kEthCollisionCount,
-    kEthOverrunCount
-};
-
-enum class WiFiStatsCountType
-{
-    kWiFiUnicastPacketRxCount,
-    kWiFiUnicastPacketTxCount,
-    kWiFiMulticastPacketRxCount,
-    kWiFiMulticastPacketTxCount,
-    kWiFiOverrunCount
-};
-
 #if defined(__GLIBC__)
 // Static variable to store the maximum heap size
 static size_t maxHeapHighWatermark = 0;
 #endif
 
-CHIP_ERROR GetEthernetStatsCount(EthernetStatsCountType type, uint64_t & count)
-{
-    CHIP_ERROR err          = CHIP_ERROR_READ_FAILED;
-    struct ifaddrs * ifaddr = nullptr;
-
-    if (getifaddrs(&ifaddr) == -1)
-    {
-        ChipLogError(DeviceLayer, "Failed to get network interfaces");
-    }
-    else
-    {
-        struct ifaddrs * ifa = nullptr;
-
-        // Walk through linked list, maintaining head pointer so we can free list later.
-        for (ifa = ifaddr; ifa != nullptr; ifa = ifa->ifa_next)
-        {
-            if (ConnectivityUtils::GetInterfaceConnectionType(ifa->ifa_name) == InterfaceTypeEnum::kEthernet)
-            {
-                ChipLogProgress(DeviceLayer, "Found the primary Ethernet interface:%s", StringOrNullMarker(ifa->ifa_name));
-                break;
-            }
-        }
-
-        if (ifa != nullptr)
-        {
-            if (ifa->ifa_addr->sa_family == AF_PACKET && ifa->ifa_data != nullptr)
-            {
-                struct rtnl_link_stats * stats = (struct rtnl_link_stats *) ifa->ifa_data;
-                switch (type)
-                {
-                case EthernetStatsCountType::kEthPacketRxCount:
-                    count = stats->rx_packets;
-                    err   = CHIP_NO_ERROR;
-                    break;
-                case EthernetStatsCountType::kEthPacketTxCount:
-                    count = stats->tx_packets;
-                    err   = CHIP_NO_ERROR;
-                    break;
-                case EthernetStatsCountType::kEthTxErrCount:
-                    count = stats->tx_errors;
-                    err   = CHIP_NO_ERROR;
-                    break;
-                case EthernetStatsCountType::kEthCollisionCount:
-                    count = stats->collisions;
-                    err   = CHIP_NO_ERROR;
-                    break;
-                case EthernetStatsCountType::kEthOverrunCount:
-                    count = stats->rx_over_errors;
-                    err   = CHIP_NO_ERROR;
-                    break;
-                default:
-                    ChipLogError(DeviceLayer, "Unknown Ethernet statistic metric type");
-                    break;
-                }
-            }
-        }
-
-        freeifaddrs(ifaddr);
-    }
-
-    return err;
-}
-
-#if CHIP_DEVICE_CONFIG_ENABLE_WIFI
-CHIP_ERROR GetWiFiStatsCount(WiFiStatsCountType type, uint64_t & count)
-{
-    CHIP_ERROR err          = CHIP_ERROR_READ_FAILED;
-    struct ifaddrs * ifaddr = nullptr;
-
-    if (getifaddrs(&ifaddr) == -1)
-    {
-        ChipLogError(DeviceLayer, "Failed to get network interfaces");
-    }
-    else
-    {
-        struct ifaddrs * ifa = nullptr;
-
-        // Walk through linked list, maintaining head pointer so we can free list later.
-        for (ifa = ifaddr; ifa != nullptr; ifa = ifa->ifa_next)
-        {
-            if (ConnectivityUtils::GetInterfaceConnectionType(ifa->ifa_name) == InterfaceTypeEnum::kWiFi)
-            {
-                ChipLogProgress(DeviceLayer, "Found the primary WiFi interface:%s", StringOrNullMarker(ifa->ifa_name));
-                break;
-            }
-        }
-
-        if (ifa != nullptr)
-        {
-            if (ifa->ifa_addr->sa_family == AF_PACKET && ifa->ifa_data != nullptr)
-            {
-                // The usecase of this function is embedded devices,on which we can interact with the WiFi
-                // driver to get the accurate number of muticast and unicast packets accurately.
-                // On Linux simulation, we can only get the total packets received, the total bytes transmitted,
-                // the multicast packets received and receiver ring buff overflow.
-
-                struct rtnl_link_stats * stats = (struct rtnl_link_stats *) ifa->ifa_data;
-                switch (type)
-                {
-                case WiFiStatsCountType::kWiFiUnicastPacketRxCount:
-                    count = stats->rx_packets;
-                    err   = CHIP_NO_ERROR;
-                    break;
-                case WiFiStatsCountType::kWiFiUnicastPacketTxCount:
-                    count = stats->tx_packets;
-                    err   = CHIP_NO_ERROR;
-                    break;
-                case WiFiStatsCountType::kWiFiMulticastPacketRxCount:
-                    count = stats->multicast;
-                    err   = CHIP_NO_ERROR;
-                    break;
-                case WiFiStatsCountType::kWiFiMulticastPacketTxCount:
-                    count = 0;
-                    err   = CHIP_NO_ERROR;
-                    break;
-                case WiFiStatsCountType::kWiFiOverrunCount:
-                    count = stats->rx_over_errors;
-                    err   = CHIP_NO_ERROR;
-                    break;
-                default:
-                    ChipLogError(DeviceLayer, "Unknown WiFi statistic metric type");
-                    break;
-                }
-            }
-        }
-
-        freeifaddrs(ifaddr);
-    }
-
-    return err;
-}
-#endif // #if CHIP_DEVICE_CONFIG_ENABLE_WIFI
-
 } // namespace
 
 namespace chip {
@@ -531,6 +380,80 @@ void DiagnosticDataProviderImpl::ReleaseNetworkInterfaces(NetworkInterface * net
     }
 }
 
+template <typename T, typename Sampler>
+CHIP_ERROR DiagnosticDataProviderImpl::ReadSample(Sample<T> & sample, T & value, Sampler sampler)
+{
+    constexpr System::Clock::Milliseconds32 kSamplingInterval(CHIP_DEVICE_CONFIG_LINUX_DIAGNOSTIC_SAMPLING_INTERVAL_MS);
+
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    if (!sample.valid || now - sample.time >= kSamplingInterval)
+    {
+        sample.error = sampler(sample.value);
+        sample.time  = now;
+        sample.valid = true;
+    }
+
+    ReturnErrorOnFailure(sample.error);
+    value = sample.value;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DiagnosticDataProviderImpl::SampleInterfaceStats(InterfaceTypeEnum type, InterfaceStats & stats)
+{
+    CHIP_ERROR err          = CHIP_ERROR_READ_FAILED;
+    struct ifaddrs * ifaddr = nullptr;
+
+    if (getifaddrs(&ifaddr) == -1)
+    {
+        ChipLogError(DeviceLayer, "Failed to get network interfaces");
+    }
+    else
+    {
+        struct ifaddrs * ifa = nullptr;
+
+        // Walk through linked list, maintaining head pointer so we can free list later.
+        for (ifa = ifaddr; ifa != nullptr; ifa = ifa->ifa_next)
+        {
+            if (ConnectivityUtils::GetInterfaceConnectionType(ifa->ifa_name) == type)
+            {
+                ChipLogDetail(DeviceLayer, "Found the primary %s interface:%s",
+                              (type == InterfaceTypeEnum::kWiFi) ? "WiFi" : "Ethernet", StringOrNullMarker(ifa->ifa_name));
+                break;
+            }
+        }
+
+        if (ifa != nullptr)
+        {
+            if (ifa->ifa_addr->sa_family == AF_PACKET && ifa->ifa_data != nullptr)
+            {
+                // On Wi-Fi, the usecase of the statistics is embedded devices, on which we can interact with the WiFi
+                // driver to get the accurate number of muticast and unicast packets accurately.
+                // On Linux simulation, we can only get the total packets received, the total bytes transmitted,
+                // the multicast packets received and receiver ring buff overflow.
+                struct rtnl_link_stats * linkStats = (struct rtnl_link_stats *) ifa->ifa_data;
+
+                stats.rxPackets    = linkStats->rx_packets;
+                stats.txPackets    = linkStats->tx_packets;
+                stats.txErrors     = linkStats->tx_errors;
+                stats.collisions   = linkStats->collisions;
+                stats.rxOverErrors = linkStats->rx_over_errors;
+                stats.multicast    = linkStats->multicast;
+                err                = CHIP_NO_ERROR;
+            }
+        }
+
+        freeifaddrs(ifaddr);
+    }
+
+    return err;
+}
+
+CHIP_ERROR DiagnosticDataProviderImpl::GetEthernetStats(InterfaceStats & stats)
+{
+    return ReadSample(mEthStats, stats,
+                      [](InterfaceStats & value) { return SampleInterfaceStats(InterfaceTypeEnum::kEthernet, value); });
+}
+
 CHIP_ERROR DiagnosticDataProviderImpl::GetEthPHYRate(app::Clusters::EthernetNetworkDiagnostics::PHYRateEnum & pHYRate)
 {
     if (ConnectivityMgrImpl().GetEthernetIfName() == nullptr)
@@ -538,7 +461,9 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetEthPHYRate(app::Clusters::EthernetNetw
         return CHIP_ERROR_READ_FAILED;
     }
 
-    return ConnectivityUtils::GetEthPHYRate(ConnectivityMgrImpl().GetEthernetIfName(), pHYRate);
+    return ReadSample(mEthPHYRate, pHYRate, [](app::Clusters::EthernetNetworkDiagnostics::PHYRateEnum & value) {
+        return ConnectivityUtils::GetEthPHYRate(ConnectivityMgrImpl().GetEthernetIfName(), value);
+    });
 }
 
 CHIP_ERROR DiagnosticDataProviderImpl::GetEthFullDuplex(bool & fullDuplex)
@@ -548,7 +473,9 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetEthFullDuplex(bool & fullDuplex)
         return CHIP_ERROR_READ_FAILED;
     }
 
-    return ConnectivityUtils::GetEthFullDuplex(ConnectivityMgrImpl().GetEthernetIfName(), fullDuplex);
+    return ReadSample(mEthFullDuplex, fullDuplex, [](bool & value) {
+        return ConnectivityUtils::GetEthFullDuplex(ConnectivityMgrImpl().GetEthernetIfName(), value);
+    });
 }
 
 CHIP_ERROR DiagnosticDataProviderImpl::GetEthTimeSinceReset(uint64_t & timeSinceReset)
@@ -558,9 +485,10 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetEthTimeSinceReset(uint64_t & timeSince
 
 CHIP_ERROR DiagnosticDataProviderImpl::GetEthPacketRxCount(uint64_t & packetRxCount)
 {
-    uint64_t count;
+    InterfaceStats stats;
 
-    ReturnErrorOnFailure(GetEthernetStatsCount(EthernetStatsCountType::kEthPacketRxCount, count));
+    ReturnErrorOnFailure(GetEthernetStats(stats));
+    const uint64_t count = stats.rxPackets;
     VerifyOrReturnError(count >= mEthPacketRxCount, CHIP_ERROR_INVALID_INTEGER_VALUE);
 
     packetRxCount = count - mEthPacketRxCount;
@@ -570,9 +498,10 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetEthPacketRxCount(uint64_t & packetRxCo
 
 CHIP_ERROR DiagnosticDataProviderImpl::GetEthPacketTxCount(uint64_t & packetTxCount)
 {
-    uint64_t count;
+    InterfaceStats stats;
 
-    ReturnErrorOnFailure(GetEthernetStatsCount(EthernetStatsCountType::kEthPacketTxCount, count));
+    ReturnErrorOnFailure(GetEthernetStats(stats));
+    const uint64_t count = stats.txPackets;
     VerifyOrReturnError(count >= mEthPacketTxCount, CHIP_ERROR_INVALID_INTEGER_VALUE);
 
     packetTxCount = count - mEthPacketTxCount;
@@ -582,9 +511,10 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetEthPacketTxCount(uint64_t & packetTxCo
 
 CHIP_ERROR DiagnosticDataProviderImpl::GetEthTxErrCount(uint64_t & txErrCount)
 {
-    uint64_t count;
+    InterfaceStats stats;
 
-    ReturnErrorOnFailure(GetEthernetStatsCount(EthernetStatsCountType::kEthTxErrCount, count));
+    ReturnErrorOnFailure(GetEthernetStats(stats));
+    const uint64_t count = stats.txErrors;
     VerifyOrReturnError(count >= mEthTxErrCount, CHIP_ERROR_INVALID_INTEGER_VALUE);
 
     txErrCount = count - mEthTxErrCount;
@@ -594,9 +524,10 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetEthTxErrCount(uint64_t & txErrCount)
 
 CHIP_ERROR DiagnosticDataProviderImpl::GetEthCollisionCount(uint64_t & collisionCount)
 {
-    uint64_t count;
+    InterfaceStats stats;
 
-    ReturnErrorOnFailure(GetEthernetStatsCount(EthernetStatsCountType::kEthCollisionCount, count));
+    ReturnErrorOnFailure(GetEthernetStats(stats));
+    const uint64_t count = stats.collisions;
     VerifyOrReturnError(count >= mEthCollisionCount, CHIP_ERROR_INVALID_INTEGER_VALUE);
 
     collisionCount = count - mEthCollisionCount;
@@ -606,9 +537,10 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetEthCollisionCount(uint64_t & collision
 
 CHIP_ERROR DiagnosticDataProviderImpl::GetEthOverrunCount(uint64_t & overrunCount)
 {
-    uint64_t count;
+    InterfaceStats stats;
 
-    ReturnErrorOnFailure(GetEthernetStatsCount(EthernetStatsCountType::kEthOverrunCount, count));
+    ReturnErrorOnFailure(GetEthernetStats(stats));
+    const uint64_t count = stats.rxOverErrors;
     VerifyOrReturnError(count >= mEthOverrunCount, CHIP_ERROR_INVALID_INTEGER_VALUE);
 
     overrunCount = count - mEthOverrunCount;
@@ -618,49 +550,35 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetEthOverrunCount(uint64_t & overrunCoun
 
 CHIP_ERROR DiagnosticDataProviderImpl::ResetEthNetworkDiagnosticsCounts()
 {
-    CHIP_ERROR err          = CHIP_ERROR_READ_FAILED;
-    struct ifaddrs * ifaddr = nullptr;
+    InterfaceStats stats;
 
-    if (getifaddrs(&ifaddr) == -1)
-    {
-        ChipLogError(DeviceLayer, "Failed to get network interfaces");
-    }
-    else
-    {
-        struct ifaddrs * ifa = nullptr;
+    // The counts are reset from the current values rather than from the last sample.
+    mEthStats.Invalidate();
+    ReturnErrorOnFailure(GetEthernetStats(stats));
 
-        // Walk through linked list, maintaining head pointer so we can free list later.
-        for (ifa = ifaddr; ifa != nullptr; ifa = ifa->ifa_next)
-        {
-            if (ConnectivityUtils::GetInterfaceConnectionType(ifa->ifa_name) == InterfaceTypeEnum::kEthernet)
-            {
-                ChipLogProgress(DeviceLayer, "Found the primary Ethernet interface:%s", StringOrNullMarker(ifa->ifa_name));
-                break;
-            }
-        }
+    mEthPacketRxCount  = stats.rxPackets;
+    mEthPacketTxCount  = stats.txPackets;
+    mEthTxErrCount     = stats.txErrors;
+    mEthCollisionCount = stats.collisions;
+    mEthOverrunCount   = stats.rxOverErrors;
 
-        if (ifa != nullptr)
-        {
-            if (ifa->ifa_addr->sa_family == AF_PACKET && ifa->ifa_data != nullptr)
-            {
-                struct rtnl_link_stats * stats = (struct rtnl_link_stats *) ifa->ifa_data;
-
-                mEthPacketRxCount  = stats->rx_packets;
-                mEthPacketTxCount  = stats->tx_packets;
-                mEthTxErrCount     = stats->tx_errors;
-                mEthCollisionCount = stats->collisions;
-                mEthOverrunCount   = stats->rx_over_errors;
-                err                = CHIP_NO_ERROR;
-            }
-        }
+    return CHIP_NO_ERROR;
+}
 
-        freeifaddrs(ifaddr);
-    }
+#if CHIP_DEVICE_CONFIG_ENABLE_WIFI
+CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiStats(InterfaceStats & stats)
+{
+    return ReadSample(mWiFiStats, stats,
+                      [](InterfaceStats & value) { return SampleInterfaceStats(InterfaceTypeEnum::kWiFi, value); });
+}
 
-    return err;
+CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiRawBeaconLostCount(uint32_t & beaconLostCount)
+{
+    return ReadSample(mWiFiBeaconLostCount, beaconLostCount, [](uint32_t & value) {
+        return ConnectivityUtils::GetWiFiBeaconLostCount(ConnectivityMgrImpl().GetWiFiIfName(), value);
+    });
 }
 
-#if CHIP_DEVICE_CONFIG_ENABLE_WIFI
 CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiChannelNumber(uint16_t & channelNumber)
 {
     if (ConnectivityMgrImpl().GetWiFiIfName() == nullptr)
@@ -668,7 +586,9 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiChannelNumber(uint16_t & channelNu
         return CHIP_ERROR_READ_FAILED;
     }
 
-    return ConnectivityUtils::GetWiFiChannelNumber(ConnectivityMgrImpl().GetWiFiIfName(), channelNumber);
+    return ReadSample(mWiFiChannelNumber, channelNumber, [](uint16_t & value) {
+        return ConnectivityUtils::GetWiFiChannelNumber(ConnectivityMgrImpl().GetWiFiIfName(), value);
+    });
 }
 
 CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiRssi(int8_t & rssi)
@@ -678,7 +598,8 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiRssi(int8_t & rssi)
         return CHIP_ERROR_READ_FAILED;
     }
 
-    return ConnectivityUtils::GetWiFiRssi(ConnectivityMgrImpl().GetWiFiIfName(), rssi);
+    return ReadSample(mWiFiRssi, rssi,
+                      [](int8_t & value) { return ConnectivityUtils::GetWiFiRssi(ConnectivityMgrImpl().GetWiFiIfName(), value); });
 }
 
 CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiBeaconLostCount(uint32_t & beaconLostCount)
@@ -690,7 +611,7 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiBeaconLostCount(uint32_t & beaconL
         return CHIP_ERROR_READ_FAILED;
     }
 
-    ReturnErrorOnFailure(ConnectivityUtils::GetWiFiBeaconLostCount(ConnectivityMgrImpl().GetWiFiIfName(), count));
+    ReturnErrorOnFailure(GetWiFiRawBeaconLostCount(count));
     VerifyOrReturnError(count >= mBeaconLostCount, CHIP_ERROR_INVALID_INTEGER_VALUE);
     beaconLostCount = count - mBeaconLostCount;
 
@@ -704,14 +625,17 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiCurrentMaxRate(uint64_t & currentM
         return CHIP_ERROR_READ_FAILED;
     }
 
-    return ConnectivityUtils::GetWiFiCurrentMaxRate(ConnectivityMgrImpl().GetWiFiIfName(), currentMaxRate);
+    return ReadSample(mWiFiCurrentMaxRate, currentMaxRate, [](uint64_t & value) {
+        return ConnectivityUtils::GetWiFiCurrentMaxRate(ConnectivityMgrImpl().GetWiFiIfName(), value);
+    });
 }
 
 CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiPacketMulticastRxCount(uint32_t & packetMulticastRxCount)
 {
-    uint64_t count;
+    InterfaceStats stats;
 
-    ReturnErrorOnFailure(GetWiFiStatsCount(WiFiStatsCountType::kWiFiMulticastPacketRxCount, count));
+    ReturnErrorOnFailure(GetWiFiStats(stats));
+    uint64_t count = stats.multicast;
     VerifyOrReturnError(count >= mPacketMulticastRxCount, CHIP_ERROR_INVALID_INTEGER_VALUE);
 
     count -= mPacketMulticastRxCount;
@@ -724,9 +648,11 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiPacketMulticastRxCount(uint32_t &
 
 CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiPacketMulticastTxCount(uint32_t & packetMulticastTxCount)
 {
-    uint64_t count;
+    InterfaceStats stats;
 
-    ReturnErrorOnFailure(GetWiFiStatsCount(WiFiStatsCountType::kWiFiMulticastPacketTxCount, count));
+    // The multicast packets sent are not counted on Linux.
+    ReturnErrorOnFailure(GetWiFiStats(stats));
+    uint64_t count = 0;
     VerifyOrReturnError(count >= mPacketMulticastTxCount, CHIP_ERROR_INVALID_INTEGER_VALUE);
 
     count -= mPacketMulticastTxCount;
@@ -739,9 +665,10 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiPacketMulticastTxCount(uint32_t &
 
 CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiPacketUnicastRxCount(uint32_t & packetUnicastRxCount)
 {
-    uint64_t count;
+    InterfaceStats stats;
 
-    ReturnErrorOnFailure(GetWiFiStatsCount(WiFiStatsCountType::kWiFiUnicastPacketRxCount, count));
+    ReturnErrorOnFailure(GetWiFiStats(stats));
+    uint64_t count = stats.rxPackets;
     VerifyOrReturnError(count >= mPacketUnicastRxCount, CHIP_ERROR_INVALID_INTEGER_VALUE);
 
     count -= mPacketUnicastRxCount;
@@ -754,9 +681,10 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiPacketUnicastRxCount(uint32_t & pa
 
 CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiPacketUnicastTxCount(uint32_t & packetUnicastTxCount)
 {
-    uint64_t count;
+    InterfaceStats stats;
 
-    ReturnErrorOnFailure(GetWiFiStatsCount(WiFiStatsCountType::kWiFiUnicastPacketTxCount, count));
+    ReturnErrorOnFailure(GetWiFiStats(stats));
+    uint64_t count = stats.txPackets;
     VerifyOrReturnError(count >= mPacketUnicastTxCount, CHIP_ERROR_INVALID_INTEGER_VALUE);
 
     count -= mPacketUnicastTxCount;
@@ -769,9 +697,10 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiPacketUnicastTxCount(uint32_t & pa
 
 CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiOverrunCount(uint64_t & overrunCount)
 {
-    uint64_t count;
+    InterfaceStats stats;
 
-    ReturnErrorOnFailure(GetWiFiStatsCount(WiFiStatsCountType::kWiFiOverrunCount, count));
+    ReturnErrorOnFailure(GetWiFiStats(stats));
+    uint64_t count = stats.rxOverErrors;
     VerifyOrReturnError(count >= mOverrunCount, CHIP_ERROR_INVALID_INTEGER_VALUE);
 
     overrunCount = count - mOverrunCount;
@@ -791,49 +720,23 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiBeaconRxCount(uint32_t & beaconRxC
 
 CHIP_ERROR DiagnosticDataProviderImpl::ResetWiFiNetworkDiagnosticsCounts()
 {
-    CHIP_ERROR err          = CHIP_ERROR_READ_FAILED;
-    struct ifaddrs * ifaddr = nullptr;
+    InterfaceStats stats;
 
-    ReturnErrorOnFailure(GetWiFiBeaconLostCount(mBeaconLostCount));
+    VerifyOrReturnError(ConnectivityMgrImpl().GetWiFiIfName() != nullptr, CHIP_ERROR_READ_FAILED);
 
-    if (getifaddrs(&ifaddr) == -1)
-    {
-        ChipLogError(DeviceLayer, "Failed to get network interfaces");
-    }
-    else
-    {
-        struct ifaddrs * ifa = nullptr;
+    // The counts are reset from the current values rather than from the last sample.
+    mWiFiBeaconLostCount.Invalidate();
+    mWiFiStats.Invalidate();
+    ReturnErrorOnFailure(GetWiFiRawBeaconLostCount(mBeaconLostCount));
+    ReturnErrorOnFailure(GetWiFiStats(stats));
 
-        // Walk through linked list, maintaining head pointer so we can free list later.
-        for (ifa = ifaddr; ifa != nullptr; ifa = ifa->ifa_next)
-        {
-            if (ConnectivityUtils::GetInterfaceConnectionType(ifa->ifa_name) == InterfaceTypeEnum::kWiFi)
-            {
-                ChipLogProgress(DeviceLayer, "Found the primary WiFi interface:%s", StringOrNullMarker(ifa->ifa_name));
-                break;
-            }
-        }
+    mPacketMulticastRxCount = static_cast<uint32_t>(stats.multicast);
+    mPacketMulticastTxCount = 0;
+    mPacketUnicastRxCount   = static_cast<uint32_t>(stats.rxPackets);
+    mPacketUnicastTxCount   = static_cast<uint32_t>(stats.txPackets);
+    mOverrunCount           = stats.rxOverErrors;
 
-        if (ifa != nullptr)
-        {
-            if (ifa->ifa_addr->sa_family == AF_PACKET && ifa->ifa_data != nullptr)
-            {
-                struct rtnl_link_stats * stats = (struct rtnl_link_stats *) ifa->ifa_data;
-
-                mPacketMulticastRxCount = stats->multicast;
-                mPacketMulticastTxCount = 0;
-                mPacketUnicastRxCount   = stats->rx_packets;
-                mPacketUnicastTxCount   = stats->tx_packets;
-                mOverrunCount           = stats->rx_over_errors;
-
-                err = CHIP_NO_ERROR;
-            }
-        }
-
-        freeifaddrs(ifaddr);
-    }
-
-    return err;
+    return CHIP_NO_ERROR;
 }
 #endif // CHIP_DEVICE_CONFIG_ENABLE_WIFI
 
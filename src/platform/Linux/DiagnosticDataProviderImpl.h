@@ -25,6 +25,7 @@
 #include <memory>
 
 #include <platform/DiagnosticDataProvider.h>
+#include <system/SystemClock.h>
 
 namespace chip {
 namespace DeviceLayer {
@@ -90,6 +91,51 @@ public:
 #endif
 
 private:
+    struct InterfaceStats
+    {
+        uint64_t rxPackets    = 0;
+        uint64_t txPackets    = 0;
+        uint64_t txErrors     = 0;
+        uint64_t collisions   = 0;
+        uint64_t rxOverErrors = 0;
+        uint64_t multicast    = 0;
+    };
+
+    /// Last sample of a diagnostic source, served to the reads until CHIP_DEVICE_CONFIG_LINUX_DIAGNOSTIC_SAMPLING_INTERVAL_MS
+    /// elapse.
+    template <typename T>
+    struct Sample
+    {
+        T value{};
+        CHIP_ERROR error = CHIP_NO_ERROR;
+        System::Clock::Timestamp time;
+        bool valid = false;
+
+        void Invalidate() { valid = false; }
+    };
+
+    template <typename T, typename Sampler>
+    static CHIP_ERROR ReadSample(Sample<T> & sample, T & value, Sampler sampler);
+
+    static CHIP_ERROR SampleInterfaceStats(app::Clusters::GeneralDiagnostics::InterfaceTypeEnum type, InterfaceStats & stats);
+
+    CHIP_ERROR GetEthernetStats(InterfaceStats & stats);
+
+    Sample<InterfaceStats> mEthStats;
+    Sample<app::Clusters::EthernetNetworkDiagnostics::PHYRateEnum> mEthPHYRate;
+    Sample<bool> mEthFullDuplex;
+
+#if CHIP_DEVICE_CONFIG_ENABLE_WIFI
+    CHIP_ERROR GetWiFiStats(InterfaceStats & stats);
+    CHIP_ERROR GetWiFiRawBeaconLostCount(uint32_t & beaconLostCount);
+
+    Sample<InterfaceStats> mWiFiStats;
+    Sample<uint16_t> mWiFiChannelNumber;
+    Sample<int8_t> mWiFiRssi;
+    Sample<uint32_t> mWiFiBeaconLostCount;
+    Sample<uint64_t> mWiFiCurrentMaxRate;
+#endif
+
     uint64_t mEthPacketRxCount  = 0;
     uint64_t mEthPacketTxCount  = 0;
     uint64_t mEthTxErrCount     = 0;
@@ -837,10 +837,102 @@ void MdnsAvahi::FreeResolveContext(size_t handle)
     }
 }
 
+CHIP_ERROR MdnsAvahi::StartAvahiResolver(ResolveContext & context)
+{
+    context.mResolver = avahi_service_resolver_new(mClient, context.mInterface, context.mTransport, context.mName,
+                                                   context.mFullType.c_str(), nullptr, context.mAddressType,
+                                                   static_cast<AvahiLookupFlags>(0), HandleResolve,
+                                                   reinterpret_cast<void *>(context.mNumber));
+    // Otherwise the resolver will be freed with the context
+    return context.mResolver == nullptr ? CHIP_ERROR_INTERNAL : CHIP_NO_ERROR;
+}
+
+bool MdnsAvahi::HasRunningDuplicate(const ResolveContext & context) const
+{
+    return std::any_of(mAllocatedResolves.begin(), mAllocatedResolves.end(), [&context](const ResolveContext * other) {
+        return other != &context && other->mResolver != nullptr && other->IsSameResolve(context);
+    });
+}
+
+size_t MdnsAvahi::RunningResolveCount() const
+{
+    return static_cast<size_t>(std::count_if(mAllocatedResolves.begin(), mAllocatedResolves.end(),
+                                             [](const ResolveContext * ctx) { return ctx->mResolver != nullptr; }));
+}
+
+void MdnsAvahi::StartWaitingResolves()
+{
+    std::vector<size_t> failedHandles;
+    size_t runningResolves = RunningResolveCount();
+
+    for (ResolveContext * context : mAllocatedResolves)
+    {
+        if (runningResolves >= kMaxConcurrentResolves)
+        {
+            break;
+        }
+        if (context->mResolver != nullptr || HasRunningDuplicate(*context))
+        {
+            continue;
+        }
+
+        if (StartAvahiResolver(*context) == CHIP_NO_ERROR)
+        {
+            runningResolves++;
+        }
+        else
+        {
+            failedHandles.push_back(context->mNumber);
+        }
+    }
+
+    // Callbacks may start or stop resolves, so they are only invoked once done with the list.
+    for (size_t handle : failedHandles)
+    {
+        ResolveContext * context = ResolveContextForHandle(handle);
+        if (context != nullptr)
+        {
+            ChipLogError(DeviceLayer, "Avahi resolve failed to start");
+            context->mCallback(context->mContext, nullptr, Span<Inet::IPAddress>(), CHIP_ERROR_INTERNAL);
+            FreeResolveContext(handle);
+        }
+    }
+}
+
+void MdnsAvahi::CompleteResolve(size_t handle, const DnssdService * result, Span<Inet::IPAddress> addresses, CHIP_ERROR error)
+{
+    std::vector<size_t> handles;
+    ResolveContext * context = ResolveContextForHandle(handle);
+    VerifyOrReturn(context != nullptr);
+
+    handles.push_back(handle);
+    for (ResolveContext * other : mAllocatedResolves)
+    {
+        if (other != context && other->mResolver == nullptr && other->IsSameResolve(*context))
+        {
+            handles.push_back(other->mNumber);
+        }
+    }
+
+    for (size_t h : handles)
+    {
+        // Previous callbacks may have stopped the resolve
+        ResolveContext * ctx = ResolveContextForHandle(h);
+        if (ctx != nullptr)
+        {
+            ctx->mCallback(ctx->mContext, const_cast<DnssdService *>(result), addresses, error);
+            FreeResolveContext(h);
+        }
+    }
+
+    StartWaitingResolves();
+}
+
 void MdnsAvahi::StopResolve(const char * name)
 {
-    auto truncate_end = std::remove_if(mAllocatedResolves.begin(), mAllocatedResolves.end(),
-                                       [name](ResolveContext * ctx) { return strcmp(ctx->mName, name) == 0; });
+    // Unlike remove_if, stable_partition keeps the removed contexts in the list, to be freed.
+    auto truncate_end = std::stable_partition(mAllocatedResolves.begin(), mAllocatedResolves.end(),
+                                              [name](ResolveContext * ctx) { return strcmp(ctx->mName, name) != 0; });
 
     for (auto it = truncate_end; it != mAllocatedResolves.end(); it++)
     {
@@ -849,6 +941,8 @@ void MdnsAvahi::StopResolve(const char * name)
     }
 
     mAllocatedResolves.erase(truncate_end, mAllocatedResolves.end());
+
+    StartWaitingResolves();
 }
 
 CHIP_ERROR MdnsAvahi::Resolve(const char * name, const char * type, DnssdServiceProtocol protocol, Inet::IPAddressType addressType,
@@ -858,7 +952,8 @@ CHIP_ERROR MdnsAvahi::Resolve(const char * name, const char * type, DnssdService
     AvahiIfIndex avahiInterface     = static_cast<AvahiIfIndex>(interface.GetPlatformInterface());
     ResolveContext * resolveContext = AllocateResolveContext();
     CHIP_ERROR error                = CHIP_NO_ERROR;
-    resolveContext->mInstance       = this;
+    VerifyOrReturnError(resolveContext != nullptr, CHIP_ERROR_NO_MEMORY);
+    resolveContext->mInstance = this;
     resolveContext->mCallback       = callback;
     resolveContext->mContext        = context;
 
@@ -873,17 +968,24 @@ CHIP_ERROR MdnsAvahi::Resolve(const char * name, const char * type, DnssdService
     resolveContext->mAddressType = ToAvahiProtocol(addressType);
     resolveContext->mFullType    = GetFullType(type, protocol);
 
-    AvahiServiceResolver * resolver =
-        avahi_service_resolver_new(mClient, avahiInterface, resolveContext->mTransport, name, resolveContext->mFullType.c_str(),
-                                   nullptr, resolveContext->mAddressType, static_cast<AvahiLookupFlags>(0), HandleResolve,
-                                   reinterpret_cast<void *>(resolveContext->mNumber));
-    // Otherwise the resolver will be freed in the callback
-    if (resolver == nullptr)
+    // Browsing reports a service once per protocol it is seen on, so the same service is
+    // often resolved several times at once: such resolves share the result of the first one.
+    if (HasRunningDuplicate(*resolveContext))
+    {
+        ChipLogProgress(DeviceLayer, "Avahi resolve: waiting for resolve in progress of %s", resolveContext->mName);
+        return CHIP_NO_ERROR;
+    }
+    if (RunningResolveCount() >= kMaxConcurrentResolves)
     {
-        error = CHIP_ERROR_INTERNAL;
-        chip::Platform::Delete(resolveContext);
+        ChipLogProgress(DeviceLayer, "Avahi resolve: queued %s", resolveContext->mName);
+        return CHIP_NO_ERROR;
+    }
+
+    error = StartAvahiResolver(*resolveContext);
+    if (error != CHIP_NO_ERROR)
+    {
+        FreeResolveContext(resolveContext->mNumber);
     }
-    resolveContext->mResolver = resolver;
 
     return error;
 }
@@ -910,20 +1012,17 @@ void MdnsAvahi::HandleResolve(AvahiServiceResolver * resolver, AvahiIfIndex inte
         {
             ChipLogProgress(DeviceLayer, "Re-trying resolve");
             avahi_service_resolver_free(resolver);
-            context->mResolver = avahi_service_resolver_new(
-                context->mInstance->mClient, context->mInterface, context->mTransport, context->mName, context->mFullType.c_str(),
-                nullptr, context->mAddressType, static_cast<AvahiLookupFlags>(0), HandleResolve, userdata);
-            if (context->mResolver == nullptr)
+            context->mResolver = nullptr;
+            if (sInstance.StartAvahiResolver(*context) != CHIP_NO_ERROR)
             {
                 ChipLogError(DeviceLayer, "Avahi resolve failed on retry");
-                context->mCallback(context->mContext, nullptr, Span<Inet::IPAddress>(), CHIP_ERROR_INTERNAL);
-                sInstance.FreeResolveContext(handle);
+                sInstance.CompleteResolve(handle, nullptr, Span<Inet::IPAddress>(), CHIP_ERROR_INTERNAL);
             }
             return;
         }
         ChipLogError(DeviceLayer, "Avahi resolve failed");
-        context->mCallback(context->mContext, nullptr, Span<Inet::IPAddress>(), CHIP_ERROR_INTERNAL);
-        break;
+        sInstance.CompleteResolve(handle, nullptr, Span<Inet::IPAddress>(), CHIP_ERROR_INTERNAL);
+        return;
     case AVAHI_RESOLVER_FOUND:
         DnssdService result = {};
 
@@ -1000,16 +1099,14 @@ void MdnsAvahi::HandleResolve(AvahiServiceResolver * resolver, AvahiIfIndex inte
 
         if (result_err == CHIP_NO_ERROR)
         {
-            context->mCallback(context->mContext, &result, Span<Inet::IPAddress>(&ipAddress, 1), CHIP_NO_ERROR);
+            sInstance.CompleteResolve(handle, &result, Span<Inet::IPAddress>(&ipAddress, 1), CHIP_NO_ERROR);
         }
         else
         {
-            context->mCallback(context->mContext, nullptr, Span<Inet::IPAddress>(), result_err);
+            sInstance.CompleteResolve(handle, nullptr, Span<Inet::IPAddress>(), result_err);
         }
         break;
     }
-
-    sInstance.FreeResolveContext(handle);
 }
 
 CHIP_ERROR ChipDnssdInit(DnssdAsyncReturnCallback initCallback, DnssdAsyncReturnCallback errorCallback, void * context)
@@ -150,7 +150,14 @@ private:
         AvahiProtocol mAddressType;
         std::string mFullType;
         uint8_t mAttempts                = 0;
-        AvahiServiceResolver * mResolver = nullptr;
+        AvahiServiceResolver * mResolver = nullptr; // nullptr while waiting for a resolver slot or a duplicate
+
+        /// Whether both contexts resolve the same service, so that one resolver can serve both
+        bool IsSameResolve(const ResolveContext & other) const
+        {
+            return mInterface == other.mInterface && mTransport == other.mTransport && mAddressType == other.mAddressType &&
+                strcmp(mName, other.mName) == 0 && mFullType == other.mFullType;
+        }
 
         ~ResolveContext()
         {
@@ -172,6 +179,20 @@ private:
     void FreeResolveContext(size_t handle);
     void FreeResolveContext(const char * name);
 
+    /// Creates the Avahi resolver of the context
+    CHIP_ERROR StartAvahiResolver(ResolveContext & context);
+
+    /// Whether another context resolving the same service has a running resolver
+    bool HasRunningDuplicate(const ResolveContext & context) const;
+    size_t RunningResolveCount() const;
+
+    /// Starts the resolvers of waiting contexts, as slots are available
+    void StartWaitingResolves();
+
+    /// Reports the outcome of a resolve to its context and to the contexts waiting for the same
+    /// service, then frees them all.
+    void CompleteResolve(size_t handle, const DnssdService * result, Span<Inet::IPAddress> addresses, CHIP_ERROR error);
+
     static void HandleClientState(AvahiClient * client, AvahiClientState state, void * context);
     void HandleClientState(AvahiClient * client, AvahiClientState state);
 
@@ -196,6 +217,10 @@ private:
     Poller mPoller;
     static constexpr size_t kMaxBrowseRetries = 4;
 
+    // Resolves beyond this many wait for a running one to complete, so that discovering many
+    // services does not create as many resolvers at once in avahi-daemon.
+    static constexpr size_t kMaxConcurrentResolves = 8;
+
     // Handling of allocated resolves
     size_t mResolveCount = 0;
     std::list<ResolveContext *> mAllocatedResolves;
@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <platform/CHIPDeviceConfig.h>
+#include <platform/Linux/CHIPLinuxLogStorage.h>
 #include <platform/Linux/CHIPLinuxStorage.h>
 
 namespace chip {
@@ -41,9 +43,25 @@ public:
     CHIP_ERROR _Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size = nullptr, size_t offset = 0);
     CHIP_ERROR _Delete(const char * key);
     CHIP_ERROR _Put(const char * key, const void * value, size_t value_size);
+    CHIP_ERROR _Flush() { return mStorage.Flush(); }
+
+#if !CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STORAGE
+    /**
+     * Select when the changes are written to the file, see ChipLinuxStorage::SetCommitMode().
+     */
+    CHIP_ERROR SetCommitMode(DeviceLayer::Internal::ChipLinuxStorage::CommitMode mode,
+                             System::Clock::Milliseconds32 window = System::Clock::kZero)
+    {
+        return mStorage.SetCommitMode(mode, window);
+    }
+#endif
 
 private:
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STORAGE
+    DeviceLayer::Internal::ChipLinuxLogStorage mStorage;
+#else
     DeviceLayer::Internal::ChipLinuxStorage mStorage;
+#endif
 
     // ===== Members for internal use by the following friends.
     friend KeyValueStoreManager & KeyValueStoreMgr();
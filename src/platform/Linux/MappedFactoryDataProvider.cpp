@@ -0,0 +1,350 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <platform/Linux/MappedFactoryDataProvider.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceError.h>
+#include <system/SystemError.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace chip {
+namespace DeviceLayer {
+
+using namespace chip::Encoding;
+
+namespace {
+
+CHIP_ERROR LoadKeypairFromRaw(ByteSpan privateKey, ByteSpan publicKey, Crypto::P256Keypair & keypair)
+{
+    Crypto::P256SerializedKeypair serializedKeypair;
+    ReturnErrorOnFailure(serializedKeypair.SetLength(privateKey.size() + publicKey.size()));
+    memcpy(serializedKeypair.Bytes(), publicKey.data(), publicKey.size());
+    memcpy(serializedKeypair.Bytes() + publicKey.size(), privateKey.data(), privateKey.size());
+    return keypair.Deserialize(serializedKeypair);
+}
+
+} // namespace
+
+MappedFactoryDataProvider::~MappedFactoryDataProvider()
+{
+    Shutdown();
+}
+
+CHIP_ERROR MappedFactoryDataProvider::Init(const char * path, const Crypto::P256PublicKey * signingKey)
+{
+    VerifyOrReturnError(path != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_POSIX(errno));
+
+    struct stat st;
+    void * data    = MAP_FAILED;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    if (fstat(fd, &st) != 0)
+    {
+        err = CHIP_ERROR_POSIX(errno);
+    }
+    else if (st.st_size < static_cast<off_t>(kHeaderLength + kDigestLength))
+    {
+        err = CHIP_ERROR_INVALID_FILE_IDENTIFIER;
+    }
+    else
+    {
+        data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            err = CHIP_ERROR_POSIX(errno);
+        }
+    }
+    // The mapping outlives the descriptor.
+    close(fd);
+    ReturnErrorOnFailure(err);
+
+    mData       = static_cast<const uint8_t *>(data);
+    mSize       = static_cast<size_t>(st.st_size);
+    mEntryCount = LittleEndian::Get16(mData + 6);
+
+    err = Validate(signingKey);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Invalid factory data in %s: %" CHIP_ERROR_FORMAT, path, err.Format());
+        Shutdown();
+    }
+    return err;
+}
+
+void MappedFactoryDataProvider::Shutdown()
+{
+    VerifyOrReturn(IsInitialized());
+    munmap(const_cast<uint8_t *>(mData), mSize);
+    mData       = nullptr;
+    mSize       = 0;
+    mEntryCount = 0;
+}
+
+CHIP_ERROR MappedFactoryDataProvider::Validate(const Crypto::P256PublicKey * signingKey) const
+{
+    VerifyOrReturnError(LittleEndian::Get32(mData) == kMagic, CHIP_ERROR_INVALID_FILE_IDENTIFIER);
+    VerifyOrReturnError(mData[4] == kVersion, CHIP_ERROR_VERSION_MISMATCH);
+
+    const bool isSigned        = (mData[5] & kFlagSigned) != 0;
+    const size_t contentLength = LittleEndian::Get32(mData + 8);
+    const size_t trailerLength = kDigestLength + (isSigned ? kSignatureLength : 0);
+    VerifyOrReturnError(contentLength >= kHeaderLength + mEntryCount * kEntryLength, CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+    VerifyOrReturnError(contentLength <= mSize && mSize - contentLength >= trailerLength, CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+
+    const uint8_t * entry = mData + kHeaderLength;
+    for (uint16_t i = 0; i < mEntryCount; i++, entry += kEntryLength)
+    {
+        const size_t length = LittleEndian::Get16(entry + 2);
+        const size_t offset = LittleEndian::Get32(entry + 4);
+        VerifyOrReturnError(offset >= kHeaderLength + mEntryCount * kEntryLength, CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+        VerifyOrReturnError(offset <= contentLength && length <= contentLength - offset, CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+    }
+
+    uint8_t digest[kDigestLength];
+    ReturnErrorOnFailure(Crypto::Hash_SHA256(mData, contentLength, digest));
+    VerifyOrReturnError(memcmp(digest, mData + contentLength, kDigestLength) == 0, CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+
+    if (signingKey != nullptr)
+    {
+        VerifyOrReturnError(isSigned, CHIP_ERROR_INVALID_SIGNATURE);
+        Crypto::P256ECDSASignature signature;
+        memcpy(signature.Bytes(), mData + contentLength + kDigestLength, kSignatureLength);
+        ReturnErrorOnFailure(signature.SetLength(kSignatureLength));
+        ReturnErrorOnFailure(signingKey->ECDSA_validate_msg_signature(mData, contentLength, signature));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MappedFactoryDataProvider::GetField(FactoryDataTag tag, ByteSpan & value) const
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_UNINITIALIZED);
+
+    const uint8_t * entry = mData + kHeaderLength;
+    for (uint16_t i = 0; i < mEntryCount; i++, entry += kEntryLength)
+    {
+        if (LittleEndian::Get16(entry) == to_underlying(tag))
+        {
+            value = ByteSpan(mData + LittleEndian::Get32(entry + 4), LittleEndian::Get16(entry + 2));
+            return CHIP_NO_ERROR;
+        }
+    }
+    return CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND;
+}
+
+CHIP_ERROR MappedFactoryDataProvider::CopyField(FactoryDataTag tag, MutableByteSpan & out) const
+{
+    ByteSpan value;
+    ReturnErrorOnFailure(GetField(tag, value));
+    return CopySpanToMutableSpan(value, out);
+}
+
+CHIP_ERROR MappedFactoryDataProvider::CopyString(FactoryDataTag tag, char * buf, size_t bufSize) const
+{
+    ByteSpan value;
+    CHIP_ERROR err = GetField(tag, value);
+    VerifyOrReturnError(err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND, CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND);
+    ReturnErrorOnFailure(err);
+    VerifyOrReturnError(bufSize > value.size(), CHIP_ERROR_BUFFER_TOO_SMALL);
+    memcpy(buf, value.data(), value.size());
+    buf[value.size()] = '\0';
+    return CHIP_NO_ERROR;
+}
+
+template <typename T>
+CHIP_ERROR MappedFactoryDataProvider::GetInteger(FactoryDataTag tag, T & value) const
+{
+    ByteSpan field;
+    ReturnErrorOnFailure(GetField(tag, field));
+    VerifyOrReturnError(field.size() == sizeof(T), CHIP_ERROR_INVALID_INTEGER_VALUE);
+    T raw;
+    memcpy(&raw, field.data(), sizeof(T));
+    value = LittleEndian::HostSwap<T>(raw);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MappedFactoryDataProvider::GetCertificationDeclaration(MutableByteSpan & outBuffer)
+{
+    return CopyField(FactoryDataTag::kCertificationDeclaration, outBuffer);
+}
+
+CHIP_ERROR MappedFactoryDataProvider::GetFirmwareInformation(MutableByteSpan & outBuffer)
+{
+    CHIP_ERROR err = CopyField(FactoryDataTag::kFirmwareInformation, outBuffer);
+    if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        // The firmware information is optional
+        outBuffer.reduce_size(0);
+        return CHIP_NO_ERROR;
+    }
+    return err;
+}
+
+CHIP_ERROR MappedFactoryDataProvider::GetDeviceAttestationCert(MutableByteSpan & outBuffer)
+{
+    return CopyField(FactoryDataTag::kDacCert, outBuffer);
+}
+
+CHIP_ERROR MappedFactoryDataProvider::GetProductAttestationIntermediateCert(MutableByteSpan & outBuffer)
+{
+    return CopyField(FactoryDataTag::kPaiCert, outBuffer);
+}
+
+CHIP_ERROR MappedFactoryDataProvider::SignWithDeviceAttestationKey(const ByteSpan & messageToSign, MutableByteSpan & outSignBuffer)
+{
+    Crypto::P256ECDSASignature signature;
+    Crypto::P256Keypair keypair;
+
+    VerifyOrReturnError(!outSignBuffer.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!messageToSign.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(outSignBuffer.size() >= signature.Capacity(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    ByteSpan privateKey;
+    ByteSpan publicKey;
+    ReturnErrorOnFailure(GetField(FactoryDataTag::kDacPrivateKey, privateKey));
+    ReturnErrorOnFailure(GetField(FactoryDataTag::kDacPublicKey, publicKey));
+
+    ReturnErrorOnFailure(LoadKeypairFromRaw(privateKey, publicKey, keypair));
+    ReturnErrorOnFailure(keypair.ECDSA_sign_msg(messageToSign.data(), messageToSign.size(), signature));
+
+    return CopySpanToMutableSpan(ByteSpan{ signature.ConstBytes(), signature.Length() }, outSignBuffer);
+}
+
+CHIP_ERROR MappedFactoryDataProvider::GetSetupDiscriminator(uint16_t & setupDiscriminator)
+{
+    return GetInteger(FactoryDataTag::kSetupDiscriminator, setupDiscriminator);
+}
+
+CHIP_ERROR MappedFactoryDataProvider::SetSetupDiscriminator(uint16_t setupDiscriminator)
+{
+    // The factory data is read-only
+    return CHIP_ERROR_NOT_IMPLEMENTED;
+}
+
+CHIP_ERROR MappedFactoryDataProvider::GetSpake2pIterationCount(uint32_t & iterationCount)
+{
+    return GetInteger(FactoryDataTag::kSpake2pIterationCount, iterationCount);
+}
+
+CHIP_ERROR MappedFactoryDataProvider::GetSpake2pSalt(MutableByteSpan & saltBuf)
+{
+    return CopyField(FactoryDataTag::kSpake2pSalt, saltBuf);
+}
+
+CHIP_ERROR MappedFactoryDataProvider::GetSpake2pVerifier(MutableByteSpan & verifierBuf, size_t & verifierLen)
+{
+    ByteSpan verifier;
+    ReturnErrorOnFailure(GetField(FactoryDataTag::kSpake2pVerifier, verifier));
+    verifierLen = verifier.size();
+    return CopySpanToMutableSpan(verifier, verifierBuf);
+}
+
+CHIP_ERROR MappedFactoryDataProvider::GetSetupPasscode(uint32_t & setupPasscode)
+{
+    // Production factory data may only hold the verifier
+    CHIP_ERROR err = GetInteger(FactoryDataTag::kSetupPasscode, setupPasscode);
+    return (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND) ? CHIP_ERROR_NOT_IMPLEMENTED : err;
+}
+
+CHIP_ERROR MappedFactoryDataProvider::SetSetupPasscode(uint32_t setupPasscode)
+{
+    // The factory data is read-only
+    return CHIP_ERROR_NOT_IMPLEMENTED;
+}
+
+CHIP_ERROR MappedFactoryDataProvider::GetVendorName(char * buf, size_t bufSize)
+{
+    return CopyString(FactoryDataTag::kVendorName, buf, bufSize);
+}
+
+CHIP_ERROR MappedFactoryDataProvider::GetVendorId(uint16_t & vendorId)
+{
+    return GetInteger(FactoryDataTag::kVendorId, vendorId);
+}
+
+CHIP_ERROR MappedFactoryDataProvider::GetProductName(char * buf, size_t bufSize)
+{
+    return CopyString(FactoryDataTag::kProductName, buf, bufSize);
+}
+
+CHIP_ERROR MappedFactoryDataProvider::GetProductId(uint16_t & productId)
+{
+    return GetInteger(FactoryDataTag::kProductId, productId);
+}
+
+CHIP_ERROR MappedFactoryDataProvider::GetPartNumber(char * buf, size_t bufSize)
+{
+    return CopyString(FactoryDataTag::kPartNumber, buf, bufSize);
+}
+
+CHIP_ERROR MappedFactoryDataProvider::GetProductURL(char * buf, size_t bufSize)
+{
+    return CopyString(FactoryDataTag::kProductURL, buf, bufSize);
+}
+
+CHIP_ERROR MappedFactoryDataProvider::GetProductLabel(char * buf, size_t bufSize)
+{
+    return CopyString(FactoryDataTag::kProductLabel, buf, bufSize);
+}
+
+CHIP_ERROR MappedFactoryDataProvider::GetSerialNumber(char * buf, size_t bufSize)
+{
+    return CopyString(FactoryDataTag::kSerialNumber, buf, bufSize);
+}
+
+CHIP_ERROR MappedFactoryDataProvider::GetManufacturingDate(uint16_t & year, uint8_t & month, uint8_t & day)
+{
+    ByteSpan date;
+    ReturnErrorOnFailure(GetField(FactoryDataTag::kManufacturingDate, date));
+    VerifyOrReturnError(date.size() == sizeof(uint16_t) + 2 * sizeof(uint8_t), CHIP_ERROR_INVALID_ARGUMENT);
+    year  = LittleEndian::Get16(date.data());
+    month = date[2];
+    day   = date[3];
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MappedFactoryDataProvider::GetHardwareVersion(uint16_t & hardwareVersion)
+{
+    return GetInteger(FactoryDataTag::kHardwareVersion, hardwareVersion);
+}
+
+CHIP_ERROR MappedFactoryDataProvider::GetHardwareVersionString(char * buf, size_t bufSize)
+{
+    return CopyString(FactoryDataTag::kHardwareVersionString, buf, bufSize);
+}
+
+CHIP_ERROR MappedFactoryDataProvider::GetRotatingDeviceIdUniqueId(MutableByteSpan & uniqueIdSpan)
+{
+    return CopyField(FactoryDataTag::kRotatingDeviceIdUniqueId, uniqueIdSpan);
+}
+
+} // namespace DeviceLayer
+} // namespace chip
@@ -0,0 +1,156 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Factory data provider serving the attestation credentials, commissionable data and device instance info of a
+ *          Linux device from a single read-only file, mapped in memory.
+ *
+ *          The file is laid out as, all integers being little-endian:
+ *
+ *            header    magic (uint32, 'MFD1'), version (uint8, 1), flags (uint8), entry count (uint16),
+ *                      content length (uint32): length of the header, index and fields
+ *            index     for each field: tag (uint16, FactoryDataTag), length (uint16), offset from the start of the file (uint32)
+ *            fields    the values, integers being stored on their own size
+ *            digest    SHA-256 of the content
+ *            signature present when kFlagSigned is set: raw P-256 ECDSA signature of the content
+ *
+ *          The fields are served from the mapping, so GetField gives spans that stay valid as long as the provider.
+ */
+
+#pragma once
+
+#include <credentials/DeviceAttestationCredsProvider.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/support/Span.h>
+#include <platform/CommissionableDataProvider.h>
+#include <platform/DeviceInstanceInfoProvider.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace DeviceLayer {
+
+enum class FactoryDataTag : uint16_t
+{
+    kCertificationDeclaration = 0x0001,
+    kFirmwareInformation      = 0x0002,
+    kDacCert                  = 0x0003,
+    kPaiCert                  = 0x0004,
+    kDacPrivateKey            = 0x0005,
+    kDacPublicKey             = 0x0006,
+
+    kSetupDiscriminator    = 0x0100,
+    kSetupPasscode         = 0x0101,
+    kSpake2pIterationCount = 0x0102,
+    kSpake2pSalt           = 0x0103,
+    kSpake2pVerifier       = 0x0104,
+
+    kVendorName               = 0x0200,
+    kVendorId                 = 0x0201,
+    kProductName              = 0x0202,
+    kProductId                = 0x0203,
+    kPartNumber               = 0x0204,
+    kProductURL               = 0x0205,
+    kProductLabel             = 0x0206,
+    kSerialNumber             = 0x0207,
+    kManufacturingDate        = 0x0208, // year (uint16), month (uint8), day (uint8)
+    kHardwareVersion          = 0x0209,
+    kHardwareVersionString    = 0x020A,
+    kRotatingDeviceIdUniqueId = 0x020B,
+};
+
+class MappedFactoryDataProvider : public Credentials::DeviceAttestationCredentialsProvider,
+                                  public CommissionableDataProvider,
+                                  public DeviceInstanceInfoProvider
+{
+public:
+    static constexpr uint32_t kMagic         = 0x3144464D; // 'MFD1'
+    static constexpr uint8_t kVersion        = 1;
+    static constexpr uint8_t kFlagSigned     = 0x01;
+    static constexpr size_t kHeaderLength    = 12;
+    static constexpr size_t kEntryLength     = 8;
+    static constexpr size_t kDigestLength    = Crypto::kSHA256_Hash_Length;
+    static constexpr size_t kSignatureLength = Crypto::kP256_ECDSA_Signature_Length_Raw;
+
+    MappedFactoryDataProvider() = default;
+    ~MappedFactoryDataProvider() override;
+
+    MappedFactoryDataProvider(const MappedFactoryDataProvider &)             = delete;
+    MappedFactoryDataProvider & operator=(const MappedFactoryDataProvider &) = delete;
+
+    /**
+     * Maps the factory data file and checks its header, index and digest.
+     *
+     * @param path            path of the factory data file
+     * @param signingKey      when given, the file must be signed by this key
+     */
+    CHIP_ERROR Init(const char * path, const Crypto::P256PublicKey * signingKey = nullptr);
+    void Shutdown();
+
+    bool IsInitialized() const { return mData != nullptr; }
+
+    /// Gives the value of a field, pointing into the mapping. Returns CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND if the
+    /// file has no such field.
+    CHIP_ERROR GetField(FactoryDataTag tag, ByteSpan & value) const;
+
+    // ===== Members functions that implement the DeviceAttestationCredentialsProvider
+    CHIP_ERROR GetCertificationDeclaration(MutableByteSpan & outBuffer) override;
+    CHIP_ERROR GetFirmwareInformation(MutableByteSpan & outBuffer) override;
+    CHIP_ERROR GetDeviceAttestationCert(MutableByteSpan & outBuffer) override;
+    CHIP_ERROR GetProductAttestationIntermediateCert(MutableByteSpan & outBuffer) override;
+    CHIP_ERROR SignWithDeviceAttestationKey(const ByteSpan & messageToSign, MutableByteSpan & outSignBuffer) override;
+
+    // ===== Members functions that implement the CommissionableDataProvider
+    CHIP_ERROR GetSetupDiscriminator(uint16_t & setupDiscriminator) override;
+    CHIP_ERROR SetSetupDiscriminator(uint16_t setupDiscriminator) override;
+    CHIP_ERROR GetSpake2pIterationCount(uint32_t & iterationCount) override;
+    CHIP_ERROR GetSpake2pSalt(MutableByteSpan & saltBuf) override;
+    CHIP_ERROR GetSpake2pVerifier(MutableByteSpan & verifierBuf, size_t & verifierLen) override;
+    CHIP_ERROR GetSetupPasscode(uint32_t & setupPasscode) override;
+    CHIP_ERROR SetSetupPasscode(uint32_t setupPasscode) override;
+
+    // ===== Members functions that implement the DeviceInstanceInfoProvider
+    CHIP_ERROR GetVendorName(char * buf, size_t bufSize) override;
+    CHIP_ERROR GetVendorId(uint16_t & vendorId) override;
+    CHIP_ERROR GetProductName(char * buf, size_t bufSize) override;
+    CHIP_ERROR GetProductId(uint16_t & productId) override;
+    CHIP_ERROR GetPartNumber(char * buf, size_t bufSize) override;
+    CHIP_ERROR GetProductURL(char * buf, size_t bufSize) override;
+    CHIP_ERROR GetProductLabel(char * buf, size_t bufSize) override;
+    CHIP_ERROR GetSerialNumber(char * buf, size_t bufSize) override;
+    CHIP_ERROR GetManufacturingDate(uint16_t & year, uint8_t & month, uint8_t & day) override;
+    CHIP_ERROR GetHardwareVersion(uint16_t & hardwareVersion) override;
+    CHIP_ERROR GetHardwareVersionString(char * buf, size_t bufSize) override;
+    CHIP_ERROR GetRotatingDeviceIdUniqueId(MutableByteSpan & uniqueIdSpan) override;
+
+private:
+    CHIP_ERROR Validate(const Crypto::P256PublicKey * signingKey) const;
+    CHIP_ERROR CopyField(FactoryDataTag tag, MutableByteSpan & out) const;
+    CHIP_ERROR CopyString(FactoryDataTag tag, char * buf, size_t bufSize) const;
+    template <typename T>
+    CHIP_ERROR GetInteger(FactoryDataTag tag, T & value) const;
+
+    const uint8_t * mData = nullptr;
+    size_t mSize          = 0;
+    uint16_t mEntryCount  = 0;
+};
+
+} // namespace DeviceLayer
+} // namespace chip
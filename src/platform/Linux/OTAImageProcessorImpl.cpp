@@ -21,10 +21,21 @@
 
 #include "OTAImageProcessorImpl.h"
 
+#include <algorithm>
+#include <string.h>
 #include <sys/stat.h>
+#include <unistd.h>
 
 namespace chip {
 
+static_assert(OTADownloadCheckpoint::kDigestLength == Crypto::kSHA256_Hash_Length, "Checkpoints hold a SHA-256 digest");
+
+OTAImageProcessorImpl::~OTAImageProcessorImpl()
+{
+    StopWriteThread(true);
+    ReleaseBlock();
+}
+
 CHIP_ERROR OTAImageProcessorImpl::PrepareDownload()
 {
     if (mImageFile == nullptr)
@@ -63,11 +74,18 @@ CHIP_ERROR OTAImageProcessorImpl::Abort()
 
 CHIP_ERROR OTAImageProcessorImpl::ProcessBlock(ByteSpan & block)
 {
-    if (!mOfs.is_open() || !mOfs.good())
+    if (!mWriteThread.joinable())
     {
         return CHIP_ERROR_INTERNAL;
     }
 
+    {
+        std::lock_guard<std::mutex> lock(mWriteLock);
+        ReturnErrorOnFailure(mWriteError);
+        // The next block is only fetched once a buffer is free for it.
+        VerifyOrReturnError(mNumQueuedBlocks < kNumBlockBuffers, CHIP_ERROR_BUSY);
+    }
+
     // Store block data for HandleProcessBlock to access
     CHIP_ERROR err = SetBlock(block);
     if (err != CHIP_NO_ERROR)
@@ -79,6 +97,39 @@ CHIP_ERROR OTAImageProcessorImpl::ProcessBlock(ByteSpan & block)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR OTAImageProcessorImpl::PrepareDownloadFrom(const OTADownloadCheckpoint & checkpoint)
+{
+    if (mImageFile == nullptr)
+    {
+        ChipLogError(SoftwareUpdate, "Invalid output image file supplied");
+        return CHIP_ERROR_INTERNAL;
+    }
+
+    mResumeFrom = checkpoint;
+    DeviceLayer::PlatformMgr().ScheduleWork(HandlePrepareDownloadFrom, reinterpret_cast<intptr_t>(this));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageProcessorImpl::GetDownloadCheckpoint(OTADownloadCheckpoint & checkpoint)
+{
+    std::lock_guard<std::mutex> lock(mWriteLock);
+    VerifyOrReturnError(mHasCheckpoint, CHIP_ERROR_NOT_FOUND);
+    checkpoint = mCheckpoint;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageProcessorImpl::Suspend()
+{
+    if (mImageFile == nullptr)
+    {
+        ChipLogError(SoftwareUpdate, "Invalid output image file supplied");
+        return CHIP_ERROR_INTERNAL;
+    }
+
+    DeviceLayer::PlatformMgr().ScheduleWork(HandleSuspend, reinterpret_cast<intptr_t>(this));
+    return CHIP_NO_ERROR;
+}
+
 bool OTAImageProcessorImpl::IsFirstImageRun()
 {
     OTARequestorInterface * requestor = chip::GetRequestorInstance();
@@ -130,14 +181,92 @@ void OTAImageProcessorImpl::HandlePrepareDownload(intptr_t context)
     imageProcessor->mParams.downloadedBytes = 0;
     imageProcessor->mParams.totalFileBytes  = 0;
     imageProcessor->mHeaderParser.Init();
-    imageProcessor->mOfs.open(imageProcessor->mImageFile, std::ofstream::out | std::ofstream::ate | std::ofstream::app);
-    if (!imageProcessor->mOfs.good())
+    imageProcessor->StopWriteThread(true);
+    imageProcessor->mPayloadDecompressor.Clear();
+    imageProcessor->mWritten       = OTADownloadCheckpoint();
+    imageProcessor->mHasCheckpoint = false;
+
+    CHIP_ERROR error = imageProcessor->mWrittenDigest.Begin();
+    if (error == CHIP_NO_ERROR)
     {
-        imageProcessor->mDownloader->OnPreparedForDownload(CHIP_ERROR_OPEN_FAILED);
+        error = imageProcessor->StartWriting();
+    }
+    imageProcessor->mDownloader->OnPreparedForDownload(error);
+}
+
+void OTAImageProcessorImpl::HandlePrepareDownloadFrom(intptr_t context)
+{
+    auto * imageProcessor = reinterpret_cast<OTAImageProcessorImpl *>(context);
+    VerifyOrReturn(imageProcessor != nullptr && imageProcessor->mDownloader != nullptr);
+
+    imageProcessor->StopWriteThread(true);
+    imageProcessor->mPayloadDecompressor.Clear();
+    imageProcessor->mOfs.close();
+
+    const OTADownloadCheckpoint & checkpoint = imageProcessor->mResumeFrom;
+    CHIP_ERROR error                         = imageProcessor->RestoreCheckpoint(checkpoint);
+    if (error != CHIP_NO_ERROR)
+    {
+        ChipLogError(SoftwareUpdate, "Cannot resume the download to %s: %" CHIP_ERROR_FORMAT, imageProcessor->mImageFile,
+                     error.Format());
+        imageProcessor->mDownloader->OnPreparedForDownload(CHIP_ERROR_INTEGRITY_CHECK_FAILED);
         return;
     }
 
-    imageProcessor->mDownloader->OnPreparedForDownload(CHIP_NO_ERROR);
+    // The header was processed before the checkpoint, the blocks downloaded next are payload.
+    imageProcessor->mHeaderParser.Clear();
+    imageProcessor->mParams.downloadedBytes = checkpoint.storedBytes;
+    imageProcessor->mParams.totalFileBytes  = checkpoint.totalFileBytes;
+    imageProcessor->mWritten                = checkpoint;
+    imageProcessor->mCheckpoint             = checkpoint;
+    imageProcessor->mHasCheckpoint          = true;
+
+    imageProcessor->mDownloader->OnPreparedForDownload(imageProcessor->StartWriting());
+}
+
+CHIP_ERROR OTAImageProcessorImpl::StartWriting()
+{
+    mOfs.close();
+    mOfs.clear();
+    mOfs.open(mImageFile, std::ofstream::out | std::ofstream::ate | std::ofstream::app);
+    VerifyOrReturnError(mOfs.good(), CHIP_ERROR_OPEN_FAILED);
+
+    mFirstQueuedBlock    = 0;
+    mNumQueuedBlocks     = 0;
+    mFetchDeferred       = false;
+    mStopWriteThread     = false;
+    mDiscardQueuedBlocks = false;
+    mWriteError          = CHIP_NO_ERROR;
+    mWriteThread         = std::thread(&OTAImageProcessorImpl::WriteThreadMain, this);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageProcessorImpl::RestoreCheckpoint(const OTADownloadCheckpoint & checkpoint)
+{
+    struct stat st;
+    VerifyOrReturnError(stat(mImageFile, &st) == 0, CHIP_ERROR_OPEN_FAILED);
+    VerifyOrReturnError(static_cast<uint64_t>(st.st_size) >= checkpoint.storedBytes, CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    VerifyOrReturnError(truncate(mImageFile, static_cast<off_t>(checkpoint.storedBytes)) == 0, CHIP_ERROR_WRITE_FAILED);
+
+    std::ifstream ifs(mImageFile, std::ifstream::in | std::ifstream::binary);
+    VerifyOrReturnError(ifs.good(), CHIP_ERROR_OPEN_FAILED);
+    ReturnErrorOnFailure(mWrittenDigest.Begin());
+
+    uint8_t buffer[1024];
+    for (uint64_t remaining = checkpoint.storedBytes; remaining > 0;)
+    {
+        size_t size = static_cast<size_t>(std::min<uint64_t>(remaining, sizeof(buffer)));
+        ifs.read(reinterpret_cast<char *>(buffer), static_cast<std::streamsize>(size));
+        VerifyOrReturnError(ifs.good(), CHIP_ERROR_READ_FAILED);
+        ReturnErrorOnFailure(mWrittenDigest.AddData(ByteSpan(buffer, size)));
+        remaining -= size;
+    }
+
+    uint8_t digestBuffer[Crypto::kSHA256_Hash_Length];
+    MutableByteSpan digest(digestBuffer);
+    ReturnErrorOnFailure(mWrittenDigest.GetDigest(digest));
+    VerifyOrReturnError(digest.data_equal(ByteSpan(checkpoint.prefixDigest)), CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    return CHIP_NO_ERROR;
 }
 
 void OTAImageProcessorImpl::HandleFinalize(intptr_t context)
@@ -148,9 +277,25 @@ void OTAImageProcessorImpl::HandleFinalize(intptr_t context)
         return;
     }
 
+    // Wait for the last blocks to be written
+    imageProcessor->StopWriteThread(false);
     imageProcessor->mOfs.close();
     imageProcessor->ReleaseBlock();
 
+    if (imageProcessor->mWriteError == CHIP_NO_ERROR && imageProcessor->mPayloadDecompressor.HasPartialChunk())
+    {
+        imageProcessor->mWriteError = CHIP_ERROR_INVALID_ARGUMENT;
+    }
+    imageProcessor->mPayloadDecompressor.Clear();
+
+    if (imageProcessor->mWriteError != CHIP_NO_ERROR)
+    {
+        ChipLogError(SoftwareUpdate, "Failed to write OTA image to %s: %" CHIP_ERROR_FORMAT, imageProcessor->mImageFile,
+                     imageProcessor->mWriteError.Format());
+        unlink(imageProcessor->mImageFile);
+        return;
+    }
+
     ChipLogProgress(SoftwareUpdate, "OTA image downloaded to %s", imageProcessor->mImageFile);
 }
 
@@ -180,11 +325,25 @@ void OTAImageProcessorImpl::HandleAbort(intptr_t context)
         return;
     }
 
+    imageProcessor->StopWriteThread(true);
+    imageProcessor->mPayloadDecompressor.Clear();
     imageProcessor->mOfs.close();
     unlink(imageProcessor->mImageFile);
     imageProcessor->ReleaseBlock();
 }
 
+void OTAImageProcessorImpl::HandleSuspend(intptr_t context)
+{
+    auto * imageProcessor = reinterpret_cast<OTAImageProcessorImpl *>(context);
+    VerifyOrReturn(imageProcessor != nullptr);
+
+    // Unlike HandleAbort, keep the file for the download to resume from the last checkpoint
+    imageProcessor->StopWriteThread(true);
+    imageProcessor->mPayloadDecompressor.Clear();
+    imageProcessor->mOfs.close();
+    imageProcessor->ReleaseBlock();
+}
+
 void OTAImageProcessorImpl::HandleProcessBlock(intptr_t context)
 {
     auto * imageProcessor = reinterpret_cast<OTAImageProcessorImpl *>(context);
@@ -199,8 +358,14 @@ void OTAImageProcessorImpl::HandleProcessBlock(intptr_t context)
         return;
     }
 
-    ByteSpan block   = imageProcessor->mBlock;
-    CHIP_ERROR error = imageProcessor->ProcessHeader(block);
+    std::unique_lock<std::mutex> lock(imageProcessor->mWriteLock);
+    BlockBuffer & nextBlock =
+        imageProcessor->mBlocks[(imageProcessor->mFirstQueuedBlock + imageProcessor->mNumQueuedBlocks) % kNumBlockBuffers];
+    lock.unlock();
+
+    ByteSpan block    = nextBlock.data;
+    size_t imageBytes = block.size();
+    CHIP_ERROR error  = imageProcessor->ProcessHeader(block);
     if (error != CHIP_NO_ERROR)
     {
         ChipLogError(SoftwareUpdate, "Image does not contain a valid header");
@@ -208,16 +373,140 @@ void OTAImageProcessorImpl::HandleProcessBlock(intptr_t context)
         return;
     }
 
-    if (!imageProcessor->mOfs.write(reinterpret_cast<const char *>(block.data()), static_cast<std::streamsize>(block.size())))
+    imageProcessor->mParams.downloadedBytes += block.size();
+
+    // Hand the block over to the write thread, and download the next one meanwhile if the other buffer is free.
+    lock.lock();
+    nextBlock.data       = block;
+    nextBlock.imageBytes = imageBytes;
+    nextBlock.resumable  = !imageProcessor->mHeaderParser.IsInitialized();
+    imageProcessor->mNumQueuedBlocks++;
+    imageProcessor->mWriteCondition.notify_one();
+    imageProcessor->mFetchDeferred = (imageProcessor->mNumQueuedBlocks == kNumBlockBuffers);
+    bool fetchNow                  = !imageProcessor->mFetchDeferred;
+    lock.unlock();
+
+    if (fetchNow)
     {
-        imageProcessor->mDownloader->EndDownload(CHIP_ERROR_WRITE_FAILED);
+        imageProcessor->mDownloader->FetchNextData();
+    }
+}
+
+void OTAImageProcessorImpl::HandleBlockWritten(intptr_t context)
+{
+    auto * imageProcessor = reinterpret_cast<OTAImageProcessorImpl *>(context);
+    VerifyOrReturn(imageProcessor != nullptr && imageProcessor->mDownloader != nullptr);
+
+    std::unique_lock<std::mutex> lock(imageProcessor->mWriteLock);
+    CHIP_ERROR error = imageProcessor->mWriteError;
+    lock.unlock();
+
+    if (error != CHIP_NO_ERROR)
+    {
+        imageProcessor->mDownloader->EndDownload(error);
         return;
     }
 
-    imageProcessor->mParams.downloadedBytes += block.size();
     imageProcessor->mDownloader->FetchNextData();
 }
 
+void OTAImageProcessorImpl::WriteThreadMain()
+{
+    std::unique_lock<std::mutex> lock(mWriteLock);
+    while (!mDiscardQueuedBlocks && (mNumQueuedBlocks > 0 || !mStopWriteThread))
+    {
+        if (mNumQueuedBlocks == 0)
+        {
+            mWriteCondition.wait(lock);
+            continue;
+        }
+
+        ByteSpan block    = mBlocks[mFirstQueuedBlock].data;
+        size_t imageBytes = mBlocks[mFirstQueuedBlock].imageBytes;
+        bool resumable    = mBlocks[mFirstQueuedBlock].resumable;
+        bool writeFailed  = (mWriteError != CHIP_NO_ERROR);
+        lock.unlock();
+        CHIP_ERROR error = writeFailed ? CHIP_NO_ERROR : WriteBlock(block);
+        bool committed   = !writeFailed && error == CHIP_NO_ERROR && CommitBlock(imageBytes, resumable);
+        lock.lock();
+
+        if (committed)
+        {
+            mCheckpoint    = mWritten;
+            mHasCheckpoint = true;
+        }
+
+        mFirstQueuedBlock = (mFirstQueuedBlock + 1) % kNumBlockBuffers;
+        mNumQueuedBlocks--;
+
+        // Once a write failed, the following blocks are dropped and the download ends.
+        if (error != CHIP_NO_ERROR && mWriteError == CHIP_NO_ERROR)
+        {
+            mWriteError    = error;
+            mFetchDeferred = true;
+        }
+
+        // Resume the download that waited for a free buffer, or end it
+        if (mFetchDeferred)
+        {
+            mFetchDeferred = false;
+            DeviceLayer::PlatformMgr().ScheduleWork(HandleBlockWritten, reinterpret_cast<intptr_t>(this));
+        }
+    }
+}
+
+CHIP_ERROR OTAImageProcessorImpl::WriteBlock(ByteSpan block)
+{
+    // Blocks that only held the header are empty; they come before the decompressor is set up.
+    VerifyOrReturnError(!block.empty(), CHIP_NO_ERROR);
+
+    if (!mPayloadDecompressor.IsInitialized())
+    {
+        mOfs.write(reinterpret_cast<const char *>(block.data()), static_cast<std::streamsize>(block.size()));
+        VerifyOrReturnError(mOfs.good(), CHIP_ERROR_WRITE_FAILED);
+        mWritten.storedBytes += block.size();
+        return mWrittenDigest.AddData(block);
+    }
+
+    ByteSpan output;
+    CHIP_ERROR error;
+    while ((error = mPayloadDecompressor.AccumulateAndDecompress(block, output)) == CHIP_NO_ERROR)
+    {
+        mOfs.write(reinterpret_cast<const char *>(output.data()), static_cast<std::streamsize>(output.size()));
+        VerifyOrReturnError(mOfs.good(), CHIP_ERROR_WRITE_FAILED);
+    }
+
+    // The rest of the block is kept by the decompressor until the next block completes the chunk.
+    return (error == CHIP_ERROR_BUFFER_TOO_SMALL) ? CHIP_NO_ERROR : error;
+}
+
+bool OTAImageProcessorImpl::CommitBlock(size_t imageBytes, bool resumable)
+{
+    mWritten.offset += imageBytes;
+
+    // The decompressor may keep part of a block, so only the download of an uncompressed payload can resume.
+    VerifyOrReturnValue(resumable && !mPayloadDecompressor.IsInitialized(), false);
+
+    MutableByteSpan digest(mWritten.prefixDigest);
+    mOfs.flush();
+    VerifyOrReturnValue(mOfs.good() && mWrittenDigest.GetDigest(digest) == CHIP_NO_ERROR, false);
+    mWritten.totalFileBytes = mParams.totalFileBytes;
+    return true;
+}
+
+void OTAImageProcessorImpl::StopWriteThread(bool discardQueuedBlocks)
+{
+    VerifyOrReturn(mWriteThread.joinable());
+
+    mWriteLock.lock();
+    mStopWriteThread     = true;
+    mDiscardQueuedBlocks = discardQueuedBlocks;
+    mWriteCondition.notify_one();
+    mWriteLock.unlock();
+
+    mWriteThread.join();
+}
+
 CHIP_ERROR OTAImageProcessorImpl::ProcessHeader(ByteSpan & block)
 {
     if (mHeaderParser.IsInitialized())
@@ -231,6 +520,11 @@ CHIP_ERROR OTAImageProcessorImpl::ProcessHeader(ByteSpan & block)
 
         mParams.totalFileBytes = header.mPayloadSize;
         mHeaderParser.Clear();
+
+        if (header.mPayloadCompression != OTAImagePayloadCompression::kNone)
+        {
+            ReturnErrorOnFailure(mPayloadDecompressor.Init(header.mPayloadCompression));
+        }
     }
 
     return CHIP_NO_ERROR;
@@ -238,41 +532,47 @@ CHIP_ERROR OTAImageProcessorImpl::ProcessHeader(ByteSpan & block)
 
 CHIP_ERROR OTAImageProcessorImpl::SetBlock(ByteSpan & block)
 {
+    // The write thread does not touch the buffer after the queued blocks.
+    mWriteLock.lock();
+    BlockBuffer & nextBlock = mBlocks[(mFirstQueuedBlock + mNumQueuedBlocks) % kNumBlockBuffers];
+    mWriteLock.unlock();
+
+    nextBlock.data = ByteSpan();
     if (block.empty())
     {
-        ReleaseBlock();
         return CHIP_NO_ERROR;
     }
-    if (mBlock.size() < block.size())
+    if (nextBlock.buffer.size() < block.size())
     {
-        if (!mBlock.empty())
+        if (!nextBlock.buffer.empty())
         {
-            ReleaseBlock();
+            chip::Platform::MemoryFree(nextBlock.buffer.data());
+            nextBlock.buffer = MutableByteSpan();
         }
         uint8_t * mBlock_ptr = static_cast<uint8_t *>(chip::Platform::MemoryAlloc(block.size()));
         if (mBlock_ptr == nullptr)
         {
             return CHIP_ERROR_NO_MEMORY;
         }
-        mBlock = MutableByteSpan(mBlock_ptr, block.size());
-    }
-    CHIP_ERROR err = CopySpanToMutableSpan(block, mBlock);
-    if (err != CHIP_NO_ERROR)
-    {
-        ChipLogError(SoftwareUpdate, "Cannot copy block data: %" CHIP_ERROR_FORMAT, err.Format());
-        return err;
+        nextBlock.buffer = MutableByteSpan(mBlock_ptr, block.size());
     }
+    memcpy(nextBlock.buffer.data(), block.data(), block.size());
+    nextBlock.data = ByteSpan(nextBlock.buffer.data(), block.size());
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR OTAImageProcessorImpl::ReleaseBlock()
 {
-    if (mBlock.data() != nullptr)
+    for (auto & block : mBlocks)
     {
-        chip::Platform::MemoryFree(mBlock.data());
-    }
+        if (block.buffer.data() != nullptr)
+        {
+            chip::Platform::MemoryFree(block.buffer.data());
+        }
 
-    mBlock = MutableByteSpan();
+        block.buffer = MutableByteSpan();
+        block.data   = ByteSpan();
+    }
     return CHIP_NO_ERROR;
 }
 
@@ -19,26 +19,47 @@
 #pragma once
 
 #include <app/clusters/ota-requestor/OTADownloader.h>
+#include <crypto/CHIPCryptoPAL.h>
 #include <lib/core/OTAImageHeader.h>
+#include <lib/core/OTAImagePayloadDecompressor.h>
 #include <platform/CHIPDeviceLayer.h>
 #include <platform/OTAImageProcessor.h>
 
+#include <condition_variable>
 #include <fstream>
+#include <mutex>
+#include <thread>
 
 namespace chip {
 
 // Full file path to where the new image will be executed from post-download
 static char kImageExecPath[] = "/tmp/ota.update";
 
+/**
+ * Writes the downloaded image to a file.
+ *
+ * Blocks are double-buffered: each one is written to the file by a worker thread while the next one downloads. The next block
+ * is only fetched from the downloader once a buffer is free for it, so at most one block waits for the block being written.
+ *
+ * A compressed payload is decompressed by the worker thread as it writes it.
+ *
+ * An interrupted download of an uncompressed payload can resume: the worker thread flushes the file after each block, and keeps
+ * the SHA-256 of what it wrote for the checkpoint, checked against the file before resuming.
+ */
 class OTAImageProcessorImpl : public OTAImageProcessorInterface
 {
 public:
+    ~OTAImageProcessorImpl();
+
     //////////// OTAImageProcessorInterface Implementation ///////////////
     CHIP_ERROR PrepareDownload() override;
     CHIP_ERROR Finalize() override;
     CHIP_ERROR Apply() override;
     CHIP_ERROR Abort() override;
     CHIP_ERROR ProcessBlock(ByteSpan & block) override;
+    CHIP_ERROR PrepareDownloadFrom(const OTADownloadCheckpoint & checkpoint) override;
+    CHIP_ERROR GetDownloadCheckpoint(OTADownloadCheckpoint & checkpoint) override;
+    CHIP_ERROR Suspend() override;
     bool IsFirstImageRun() override;
     CHIP_ERROR ConfirmCurrentImage() override;
 
@@ -48,27 +69,89 @@ public:
 private:
     //////////// Actual handlers for the OTAImageProcessorInterface ///////////////
     static void HandlePrepareDownload(intptr_t context);
+    static void HandlePrepareDownloadFrom(intptr_t context);
+    static void HandleSuspend(intptr_t context);
     static void HandleFinalize(intptr_t context);
     static void HandleApply(intptr_t context);
     static void HandleAbort(intptr_t context);
     static void HandleProcessBlock(intptr_t context);
+    static void HandleBlockWritten(intptr_t context);
 
     CHIP_ERROR ProcessHeader(ByteSpan & block);
 
     /**
-     * Called to allocate memory for mBlock if necessary and set it to block
+     * Open the file to append the downloaded blocks to, and start the write thread.
+     */
+    CHIP_ERROR StartWriting();
+
+    /**
+     * Called to check the file holds the bytes of the checkpoint to resume from, dropping the ones written after it, and to
+     * carry on with their SHA-256.
+     */
+    CHIP_ERROR RestoreCheckpoint(const OTADownloadCheckpoint & checkpoint);
+
+    /**
+     * Called to allocate memory for the free block buffer if necessary and set it to block
      */
     CHIP_ERROR SetBlock(ByteSpan & block);
 
     /**
-     * Called to release allocated memory for mBlock
+     * Called to release allocated memory for the block buffers
      */
     CHIP_ERROR ReleaseBlock();
 
+    void WriteThreadMain();
+
+    /**
+     * Called by the write thread to write a block of the payload to the file, decompressing it if needed.
+     */
+    CHIP_ERROR WriteBlock(ByteSpan block);
+
+    /**
+     * Called by the write thread once a block was written, returns whether the download can resume after it.
+     */
+    bool CommitBlock(size_t imageBytes, bool resumable);
+
+    /**
+     * Stop the write thread, after it has written the queued blocks unless discardQueuedBlocks is set.
+     */
+    void StopWriteThread(bool discardQueuedBlocks);
+
+    static constexpr size_t kNumBlockBuffers = 2;
+
+    struct BlockBuffer
+    {
+        MutableByteSpan buffer;
+        ByteSpan data;             ///< Part of buffer to write to the file
+        size_t imageBytes = 0;     ///< Bytes of the image the block held, including those of the header
+        bool resumable    = false; ///< Whether the download can resume after the block, i.e. the header was processed
+    };
+
     std::ofstream mOfs;
-    MutableByteSpan mBlock;
     OTADownloader * mDownloader;
+
+    // Blocks queued for the write thread are mBlocks[mFirstQueuedBlock] onwards; the next block downloads in the buffer after
+    // them. mWriteLock protects the state below, mOfs and mPayloadDecompressor belong to the write thread while it runs.
+    BlockBuffer mBlocks[kNumBlockBuffers];
+    std::mutex mWriteLock;
+    std::condition_variable mWriteCondition;
+    std::thread mWriteThread;
+    size_t mFirstQueuedBlock  = 0;
+    size_t mNumQueuedBlocks   = 0;
+    bool mFetchDeferred       = false;
+    bool mStopWriteThread     = false;
+    bool mDiscardQueuedBlocks = false;
+    CHIP_ERROR mWriteError    = CHIP_NO_ERROR;
+    OTADownloadCheckpoint mCheckpoint; ///< Last point the write thread committed to the file
+    bool mHasCheckpoint = false;
+
+    // Progress of the write thread, and digest of the bytes it wrote to the file, owned by the write thread while it runs
+    OTADownloadCheckpoint mWritten;
+    Crypto::Hash_SHA256_stream mWrittenDigest;
+    OTADownloadCheckpoint mResumeFrom;
+
     OTAImageHeaderParser mHeaderParser;
+    OTAImagePayloadDecompressor mPayloadDecompressor;
     const char * mImageFile = nullptr;
 };
 
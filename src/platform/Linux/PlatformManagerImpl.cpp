@@ -31,6 +31,10 @@
 #include <linux/rtnetlink.h>
 #include <net/if.h>
 #include <netinet/in.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
 #include <unistd.h>
 
 #include <mutex>
@@ -54,6 +58,54 @@ PlatformManagerImpl PlatformManagerImpl::sInstance;
 
 namespace {
 
+// Applies scheduling options to the calling thread, logging the options that could not be applied.
+void ApplyThreadScheduling(const char * threadName, const PlatformManagerImpl::ThreadSchedulingOptions & options)
+{
+    int err;
+
+    if (options.cpuAffinityMask != 0)
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        for (unsigned int cpu = 0; cpu < 64 && cpu < CPU_SETSIZE; cpu++)
+        {
+            if (options.cpuAffinityMask & (1ull << cpu))
+            {
+                CPU_SET(cpu, &cpuSet);
+            }
+        }
+
+        err = pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+        if (err != 0)
+        {
+            ChipLogError(DeviceLayer, "Failed to set the CPU affinity of the %s thread: %" CHIP_ERROR_FORMAT, threadName,
+                         CHIP_ERROR_POSIX(err).Format());
+        }
+    }
+
+    if (options.fifoPriority > 0)
+    {
+        sched_param param    = {};
+        param.sched_priority = options.fifoPriority;
+
+        err = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+        if (err != 0)
+        {
+            ChipLogError(DeviceLayer, "Failed to set the SCHED_FIFO priority of the %s thread: %" CHIP_ERROR_FORMAT, threadName,
+                         CHIP_ERROR_POSIX(err).Format());
+        }
+    }
+    else if (options.niceValue != 0)
+    {
+        // On Linux, the nice value applies to the thread whose id is given, rather than to the whole process.
+        if (setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), options.niceValue) != 0)
+        {
+            ChipLogError(DeviceLayer, "Failed to set the nice value of the %s thread: %" CHIP_ERROR_FORMAT, threadName,
+                         CHIP_ERROR_POSIX(errno).Format());
+        }
+    }
+}
+
 #if CHIP_DEVICE_CONFIG_WITH_GLIB_MAIN_LOOP
 void * GLibMainLoopThread(void * userData)
 {
@@ -215,6 +267,7 @@ CHIP_ERROR PlatformManagerImpl::_InitChipStack()
             idleSource,
             [](void * userData_) {
                 auto * data = reinterpret_cast<GLibMatterContextInvokeData *>(userData_);
+                ApplyThreadScheduling("GLib", PlatformMgrImpl().mGLibThreadScheduling);
                 std::unique_lock<std::mutex> lock_(PlatformMgrImpl().mGLibMainLoopCallbackIndirectionMutex);
                 data->mDone = true;
                 data->mDoneCond.notify_one();
@@ -249,6 +302,12 @@ CHIP_ERROR PlatformManagerImpl::_InitChipStack()
     return CHIP_NO_ERROR;
 }
 
+void PlatformManagerImpl::_RunEventLoop()
+{
+    ApplyThreadScheduling("Matter", mEventLoopThreadScheduling);
+    Internal::GenericPlatformManagerImpl_POSIX<PlatformManagerImpl>::_RunEventLoop();
+}
+
 void PlatformManagerImpl::_Shutdown()
 {
     uint64_t upTime = 0;
@@ -318,6 +377,22 @@ void PlatformManagerImpl::_GLibMatterContextInvokeSync(LambdaBridge && bridge)
     lock.lock();
     invokeData.mDoneCond.wait(lock, [&invokeData]() { return invokeData.mDone; });
 }
+
+CHIP_ERROR PlatformManagerImpl::_GLibMatterContextInvokeAsync(LambdaBridge && bridge)
+{
+    auto * invokeBridge = Platform::New<LambdaBridge>(std::move(bridge));
+    VerifyOrReturnError(invokeBridge != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    g_main_context_invoke_full(
+        g_main_loop_get_context(mGLibMainLoop), G_PRIORITY_HIGH_IDLE,
+        [](void * userData_) {
+            (*static_cast<LambdaBridge *>(userData_))();
+            return G_SOURCE_REMOVE;
+        },
+        invokeBridge, [](void * userData_) { Platform::Delete(static_cast<LambdaBridge *>(userData_)); });
+
+    return CHIP_NO_ERROR;
+}
 #endif // CHIP_DEVICE_CONFIG_WITH_GLIB_MAIN_LOOP
 
 } // namespace DeviceLayer
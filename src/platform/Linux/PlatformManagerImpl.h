@@ -55,8 +55,36 @@ class PlatformManagerImpl final : public PlatformManager, public Internal::Gener
 public:
     // ===== Platform-specific members that may be accessed directly by the application.
 
+    /**
+     * Scheduling of a thread of the platform manager, applied by the thread itself when it starts.
+     */
+    struct ThreadSchedulingOptions
+    {
+        /// Bit mask of the CPUs the thread may run on, 0 to leave the affinity of the thread unchanged.
+        uint64_t cpuAffinityMask = 0;
+        /// Priority of the thread in the SCHED_FIFO real time policy (1 to 99), 0 to keep the default policy.
+        int fifoPriority = 0;
+        /// Nice value of the thread (-20 to 19) when it keeps the default policy.
+        int niceValue = 0;
+    };
+
+    /**
+     * @brief Set the scheduling of the thread running the Matter event loop.
+     *
+     * Must be called before the event loop is run, by StartEventLoopTask() or RunEventLoop(). Scheduling options
+     * the process lacks the privileges for (e.g. CAP_SYS_NICE for SCHED_FIFO) are logged and ignored.
+     */
+    void SetEventLoopThreadScheduling(const ThreadSchedulingOptions & options) { mEventLoopThreadScheduling = options; }
+
 #if CHIP_DEVICE_CONFIG_WITH_GLIB_MAIN_LOOP
 
+    /**
+     * @brief Set the scheduling of the thread running the Matter GLib main loop.
+     *
+     * Must be called before InitChipStack(), which starts the GLib main loop thread.
+     */
+    void SetGLibThreadScheduling(const ThreadSchedulingOptions & options) { mGLibThreadScheduling = options; }
+
     /**
      * @brief Invoke a function on the Matter GLib context.
      *
@@ -87,6 +115,25 @@ public:
         return context.returnValue;
     }
 
+    /**
+     * @brief Invoke a function on the Matter GLib context without waiting for it to be executed.
+     *
+     * The function is scheduled on the GLib thread, or executed right away when called from the GLib
+     * thread itself. The user data must stay valid until the function is executed.
+     *
+     * @param[in] function The function to call.
+     * @param[in] userData User data to pass to the function.
+     * @returns CHIP_ERROR_NO_MEMORY if the invocation could not be scheduled, CHIP_NO_ERROR otherwise.
+     */
+    template <typename T>
+    CHIP_ERROR GLibMatterContextInvokeAsync(void (*func)(T *), T * userData)
+    {
+        LambdaBridge bridge;
+        bridge.Initialize([func, userData]() { func(userData); });
+
+        return _GLibMatterContextInvokeAsync(std::move(bridge));
+    }
+
     unsigned int GLibMatterContextAttachSource(GSource * source)
     {
         VerifyOrDie(mGLibMainLoop != nullptr);
@@ -101,6 +148,7 @@ private:
     // ===== Methods that implement the PlatformManager abstract interface.
 
     CHIP_ERROR _InitChipStack();
+    void _RunEventLoop();
     void _Shutdown();
 
     // ===== Members for internal use by the following friends.
@@ -111,6 +159,8 @@ private:
 
     System::Clock::Timestamp mStartTime = System::Clock::kZero;
 
+    ThreadSchedulingOptions mEventLoopThreadScheduling;
+
     static PlatformManagerImpl sInstance;
 
 #if CHIP_DEVICE_CONFIG_WITH_GLIB_MAIN_LOOP
@@ -134,6 +184,13 @@ private:
      */
     void _GLibMatterContextInvokeSync(LambdaBridge && bridge);
 
+    /**
+     * @brief Schedule a function on the Matter GLib context.
+     *
+     * @note Use the GLibMatterContextInvokeAsync() template function instead of this one.
+     */
+    CHIP_ERROR _GLibMatterContextInvokeAsync(LambdaBridge && bridge);
+
     // XXX: Mutex for guarding access to glib main event loop callback indirection
     //      synchronization primitives. This is a workaround to suppress TSAN warnings.
     //      TSAN does not know that from the thread synchronization perspective the
@@ -146,6 +203,8 @@ private:
     GMainLoop * mGLibMainLoop     = nullptr;
     GThread * mGLibMainLoopThread = nullptr;
 
+    ThreadSchedulingOptions mGLibThreadScheduling;
+
 #endif // CHIP_DEVICE_CONFIG_WITH_GLIB_MAIN_LOOP
 };
 
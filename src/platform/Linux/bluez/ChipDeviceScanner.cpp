@@ -165,9 +165,19 @@ void ChipDeviceScanner::OnDeviceAdded(BluezDevice1 & device)
 void ChipDeviceScanner::OnDevicePropertyChanged(BluezDevice1 & device, GVariant * changedProps,
                                                 const char * const * invalidatedProps)
 {
+    // Most property changes of a device being scanned are RSSI updates, ignore
+    // everything but the service data which carries the CHIP identification info.
+    GAutoPtr<GVariant> serviceData(g_variant_lookup_value(changedProps, "ServiceData", nullptr));
+    VerifyOrReturn(serviceData != nullptr);
+
     ReportDevice(device);
 }
 
+void ChipDeviceScanner::OnDeviceRemoved(BluezDevice1 & device)
+{
+    mReportedDevices.erase(g_dbus_proxy_get_object_path(reinterpret_cast<GDBusProxy *>(&device)));
+}
+
 void ChipDeviceScanner::ReportDevice(BluezDevice1 & device)
 {
     VerifyOrReturn(strcmp(bluez_device1_get_adapter(&device),
@@ -181,6 +191,19 @@ void ChipDeviceScanner::ReportDevice(BluezDevice1 & device)
         return;
     }
 
+    // Do not report the same advertisement of a device more than once per scan.
+    const char * devicePath = g_dbus_proxy_get_object_path(reinterpret_cast<GDBusProxy *>(&device));
+    auto it                 = mReportedDevices.find(devicePath);
+    if (it != mReportedDevices.end())
+    {
+        VerifyOrReturn(memcmp(&it->second, &deviceInfo, sizeof(deviceInfo)) != 0);
+        it->second = deviceInfo;
+    }
+    else
+    {
+        mReportedDevices.emplace(devicePath, deviceInfo);
+    }
+
     mDelegate->OnDeviceScanned(device, deviceInfo);
 }
 
@@ -209,6 +232,8 @@ CHIP_ERROR ChipDeviceScanner::StartScanImpl()
     CHIP_ERROR err = mObjectManager.SubscribeDeviceNotifications(mAdapter.get(), this);
     ReturnErrorOnFailure(err);
 
+    mReportedDevices.clear();
+
     ChipLogProgress(Ble, "BLE removing known devices");
     for (BluezObject & object : mObjectManager.GetObjects())
     {
@@ -225,9 +250,13 @@ CHIP_ERROR ChipDeviceScanner::StartScanImpl()
     // The function requires that devices advertise its services' UUIDs in UUID16/32/128 fields
     // while the Matter specification requires only FLAGS (0x01) and SERVICE_DATA_16 (0x16) fields
     // in the advertisement packets.
+    //
+    // Let BlueZ drop repeated advertisements with unchanged data instead, so that we do not get
+    // a PropertiesChanged signal for every advertisement received from every device around.
     GVariantBuilder filterBuilder;
     g_variant_builder_init(&filterBuilder, G_VARIANT_TYPE("a{sv}"));
     g_variant_builder_add(&filterBuilder, "{sv}", "Transport", g_variant_new_string("le"));
+    g_variant_builder_add(&filterBuilder, "{sv}", "DuplicateData", g_variant_new_boolean(FALSE));
     GVariant * filter = g_variant_builder_end(&filterBuilder);
 
     GAutoPtr<GError> error;
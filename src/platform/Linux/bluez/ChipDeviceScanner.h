@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <string>
+#include <unordered_map>
+
 #include <platform/CHIPDeviceConfig.h>
 
 #include <glib.h>
@@ -84,7 +87,7 @@ public:
     /// Members that implement virtual methods on BluezObjectManagerAdapterNotificationsDelegate
     void OnDeviceAdded(BluezDevice1 & device) override;
     void OnDevicePropertyChanged(BluezDevice1 & device, GVariant * changedProps, const char * const * invalidatedProps) override;
-    void OnDeviceRemoved(BluezDevice1 & device) override {}
+    void OnDeviceRemoved(BluezDevice1 & device) override;
 
 private:
     enum class ChipDeviceScannerState
@@ -110,6 +113,11 @@ private:
     ChipDeviceScannerDelegate * mDelegate = nullptr;
     ChipDeviceScannerState mScannerState  = ChipDeviceScannerState::UNINITIALIZED;
     GAutoPtr<GCancellable> mCancellable;
+
+    /// Identification info last reported for each device during the current scan, keyed
+    /// by D-Bus object path, so that unchanged advertisements are not reported again.
+    /// Only accessed on the GLib thread.
+    std::unordered_map<std::string, chip::Ble::ChipBLEDeviceIdentificationInfo> mReportedDevices;
 };
 
 } // namespace Internal
@@ -0,0 +1,347 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  @file
+ *    Replays the storage accesses of commissioning, CASE session resumption and
+ *    subscription persistence against the Linux key-value store backends, and
+ *    reports how long each workload took and which key families it touched.
+ *
+ *    The keys and value sizes are those of DefaultStorageKeyAllocator and of the
+ *    modules using them; the values themselves are filler.
+ *
+ *    Usage: storage-benchmark [iterations] [directory]
+ */
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/TracingPersistentStorageDelegate.h>
+#include <platform/Linux/CHIPLinuxLogStorage.h>
+#include <platform/Linux/CHIPLinuxStorage.h>
+
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <unistd.h>
+
+using namespace chip;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+constexpr uint32_t kDefaultIterations   = 20;
+constexpr uint8_t kNumFabrics           = 5;
+constexpr size_t kMaxResumptionSessions = 16;
+constexpr size_t kNumSubscriptions      = 10;
+constexpr System::Clock::Milliseconds32 kGroupCommitWindow(10);
+
+// Sizes of the values written by the SDK modules owning the keys.
+constexpr uint16_t kCertSize              = 400;
+constexpr uint16_t kOpKeySize             = 140;
+constexpr uint16_t kFabricMetadataSize    = 48;
+constexpr uint16_t kFabricIndexInfoSize   = 2 + kNumFabrics * 2;
+constexpr uint16_t kAclEntrySize          = 64;
+constexpr uint16_t kSessionSize           = 96;
+constexpr uint16_t kResumptionLinkSize    = 24;
+constexpr uint16_t kResumptionIndexSize   = kMaxResumptionSessions * 12;
+constexpr uint16_t kSubscriptionSize      = 220;
+constexpr uint16_t kMaxSubscriptionsSize  = 4;
+constexpr uint16_t kLastKnownGoodTimeSize = 8;
+
+uint8_t sValue[kCertSize];
+uint8_t sReadBuffer[kCertSize];
+
+/**
+ * PersistentStorageDelegate over one of the storage classes of the Linux KVS, with the error mapping of
+ * KeyValueStoreManagerImpl.
+ */
+template <typename Storage>
+class LinuxStorageDelegate : public PersistentStorageDelegate
+{
+public:
+    Storage & GetStorage() { return mStorage; }
+
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override
+    {
+        size_t readSize;
+        CHIP_ERROR err = mStorage.ReadValueBin(key, static_cast<uint8_t *>(buffer), size, readSize);
+        VerifyOrReturnError(err != CHIP_ERROR_KEY_NOT_FOUND, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+        size = static_cast<uint16_t>(readSize);
+        return err;
+    }
+
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override
+    {
+        ReturnErrorOnFailure(mStorage.WriteValueBin(key, static_cast<const uint8_t *>(value), size));
+        return mStorage.Commit();
+    }
+
+    CHIP_ERROR SyncDeleteKeyValue(const char * key) override
+    {
+        CHIP_ERROR err = mStorage.ClearValue(key);
+        VerifyOrReturnError(err != CHIP_ERROR_KEY_NOT_FOUND, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+        ReturnErrorOnFailure(err);
+        return mStorage.Commit();
+    }
+
+    CHIP_ERROR SyncFlush() override { return mStorage.Flush(); }
+
+private:
+    Storage mStorage;
+};
+
+CHIP_ERROR Write(PersistentStorageDelegate & storage, const StorageKeyName & key, uint16_t size)
+{
+    return storage.SyncSetKeyValue(key.KeyName(), sValue, size);
+}
+
+CHIP_ERROR Read(PersistentStorageDelegate & storage, const StorageKeyName & key)
+{
+    uint16_t size  = sizeof(sReadBuffer);
+    CHIP_ERROR err = storage.SyncGetKeyValue(key.KeyName(), sReadBuffer, size);
+    return (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND) ? CHIP_NO_ERROR : err;
+}
+
+CHIP_ERROR Delete(PersistentStorageDelegate & storage, const StorageKeyName & key)
+{
+    CHIP_ERROR err = storage.SyncDeleteKeyValue(key.KeyName());
+    return (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND) ? CHIP_NO_ERROR : err;
+}
+
+// AddNOC and CommissioningComplete of each fabric, as done by FabricTable, the op cert store and the keystore,
+// followed by the removal of the fabrics.
+CHIP_ERROR ReplayCommissioning(PersistentStorageDelegate & storage)
+{
+    ReturnErrorOnFailure(Read(storage, DefaultStorageKeyAllocator::FabricIndexInfo()));
+    ReturnErrorOnFailure(Read(storage, DefaultStorageKeyAllocator::LastKnownGoodTimeKey()));
+
+    for (FabricIndex fabric = 1; fabric <= kNumFabrics; fabric++)
+    {
+        ReturnErrorOnFailure(Write(storage, DefaultStorageKeyAllocator::FailSafeCommitMarkerKey(), 4));
+        ReturnErrorOnFailure(Write(storage, DefaultStorageKeyAllocator::FabricOpKey(fabric), kOpKeySize));
+        ReturnErrorOnFailure(Write(storage, DefaultStorageKeyAllocator::FabricRCAC(fabric), kCertSize));
+        ReturnErrorOnFailure(Write(storage, DefaultStorageKeyAllocator::FabricICAC(fabric), kCertSize));
+        ReturnErrorOnFailure(Write(storage, DefaultStorageKeyAllocator::FabricNOC(fabric), kCertSize));
+        ReturnErrorOnFailure(Write(storage, DefaultStorageKeyAllocator::FabricMetadata(fabric), kFabricMetadataSize));
+        ReturnErrorOnFailure(Write(storage, DefaultStorageKeyAllocator::LastKnownGoodTimeKey(), kLastKnownGoodTimeSize));
+        ReturnErrorOnFailure(Write(storage, DefaultStorageKeyAllocator::FabricIndexInfo(), kFabricIndexInfoSize));
+        ReturnErrorOnFailure(Write(storage, DefaultStorageKeyAllocator::AccessControlAclEntry(fabric, 0), kAclEntrySize));
+        ReturnErrorOnFailure(storage.SyncFlush());
+        ReturnErrorOnFailure(Delete(storage, DefaultStorageKeyAllocator::FailSafeCommitMarkerKey()));
+        ReturnErrorOnFailure(Read(storage, DefaultStorageKeyAllocator::FabricNOC(fabric)));
+    }
+
+    for (FabricIndex fabric = 1; fabric <= kNumFabrics; fabric++)
+    {
+        ReturnErrorOnFailure(Delete(storage, DefaultStorageKeyAllocator::FabricNOC(fabric)));
+        ReturnErrorOnFailure(Delete(storage, DefaultStorageKeyAllocator::FabricICAC(fabric)));
+        ReturnErrorOnFailure(Delete(storage, DefaultStorageKeyAllocator::FabricRCAC(fabric)));
+        ReturnErrorOnFailure(Delete(storage, DefaultStorageKeyAllocator::FabricOpKey(fabric)));
+        ReturnErrorOnFailure(Delete(storage, DefaultStorageKeyAllocator::FabricMetadata(fabric)));
+        ReturnErrorOnFailure(Delete(storage, DefaultStorageKeyAllocator::AccessControlAclEntry(fabric, 0)));
+        ReturnErrorOnFailure(Write(storage, DefaultStorageKeyAllocator::FabricIndexInfo(), kFabricIndexInfoSize));
+    }
+    return CHIP_NO_ERROR;
+}
+
+// Sessions established and resumed by SimpleSessionResumptionStorage, which evicts the oldest entry once full.
+CHIP_ERROR ReplayCaseResumption(PersistentStorageDelegate & storage)
+{
+    char resumptionId[8];
+
+    for (size_t session = 0; session < 2 * kMaxResumptionSessions; session++)
+    {
+        FabricIndex fabric = static_cast<FabricIndex>(1 + session % kNumFabrics);
+        NodeId node        = 0x1000 + session;
+
+        ReturnErrorOnFailure(Read(storage, DefaultStorageKeyAllocator::SessionResumptionIndex()));
+        ReturnErrorOnFailure(Read(storage, DefaultStorageKeyAllocator::FabricSession(fabric, node)));
+        if (session >= kMaxResumptionSessions)
+        {
+            size_t evicted = session - kMaxResumptionSessions;
+            snprintf(resumptionId, sizeof(resumptionId), "r%04x", static_cast<unsigned>(evicted));
+            ReturnErrorOnFailure(Delete(
+                storage, DefaultStorageKeyAllocator::FabricSession(static_cast<FabricIndex>(1 + evicted % kNumFabrics),
+                                                                   0x1000 + evicted)));
+            ReturnErrorOnFailure(Delete(storage, DefaultStorageKeyAllocator::SessionResumption(resumptionId)));
+        }
+
+        snprintf(resumptionId, sizeof(resumptionId), "r%04x", static_cast<unsigned>(session));
+        ReturnErrorOnFailure(Write(storage, DefaultStorageKeyAllocator::FabricSession(fabric, node), kSessionSize));
+        ReturnErrorOnFailure(Write(storage, DefaultStorageKeyAllocator::SessionResumption(resumptionId), kResumptionLinkSize));
+        ReturnErrorOnFailure(Write(storage, DefaultStorageKeyAllocator::SessionResumptionIndex(), kResumptionIndexSize));
+
+        // A later resumption of the session looks it up by resumption id.
+        ReturnErrorOnFailure(Read(storage, DefaultStorageKeyAllocator::SessionResumption(resumptionId)));
+        ReturnErrorOnFailure(Read(storage, DefaultStorageKeyAllocator::FabricSession(fabric, node)));
+    }
+    return CHIP_NO_ERROR;
+}
+
+// Subscriptions saved by SimpleSubscriptionResumptionStorage as they are established, read back on boot to resume
+// them, then torn down.
+CHIP_ERROR ReplaySubscriptionPersistence(PersistentStorageDelegate & storage)
+{
+    ReturnErrorOnFailure(Read(storage, DefaultStorageKeyAllocator::SubscriptionResumptionMaxCount()));
+    ReturnErrorOnFailure(Write(storage, DefaultStorageKeyAllocator::SubscriptionResumptionMaxCount(), kMaxSubscriptionsSize));
+
+    for (size_t index = 0; index < kNumSubscriptions; index++)
+    {
+        ReturnErrorOnFailure(Write(storage, DefaultStorageKeyAllocator::SubscriptionResumption(index), kSubscriptionSize));
+    }
+    for (size_t index = 0; index < kNumSubscriptions; index++)
+    {
+        ReturnErrorOnFailure(Read(storage, DefaultStorageKeyAllocator::SubscriptionResumption(index)));
+    }
+    for (size_t index = 0; index < kNumSubscriptions; index++)
+    {
+        ReturnErrorOnFailure(Delete(storage, DefaultStorageKeyAllocator::SubscriptionResumption(index)));
+    }
+    return CHIP_NO_ERROR;
+}
+
+struct Workload
+{
+    const char * mName;
+    CHIP_ERROR (*mReplay)(PersistentStorageDelegate & storage);
+};
+
+constexpr Workload kWorkloads[] = {
+    { "commissioning", ReplayCommissioning },
+    { "case-resumption", ReplayCaseResumption },
+    { "subscription-persistence", ReplaySubscriptionPersistence },
+};
+
+bool RunWorkloads(const char * backend, PersistentStorageDelegate & storage, uint32_t iterations)
+{
+    TracingPersistentStorageDelegate tracing(storage);
+
+    for (const Workload & workload : kWorkloads)
+    {
+        tracing.ResetStats();
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; i++)
+        {
+            CHIP_ERROR err = workload.mReplay(tracing);
+            if (err != CHIP_NO_ERROR)
+            {
+                fprintf(stderr, "%s: %s failed: %" CHIP_ERROR_FORMAT "\n", backend, workload.mName, err.Format());
+                return false;
+            }
+        }
+        CHIP_ERROR err = tracing.SyncFlush();
+        if (err != CHIP_NO_ERROR)
+        {
+            fprintf(stderr, "%s: %s failed to flush: %" CHIP_ERROR_FORMAT "\n", backend, workload.mName, err.Format());
+            return false;
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        uint32_t accesses = 0;
+        for (size_t family = 0; family < TracingPersistentStorageDelegate::kNumKeyFamilies; family++)
+        {
+            accesses += tracing.GetFamilyStats(family).GetAccessCount();
+        }
+        printf("%-14s %-26s %8" PRIu32 " accesses %10.1f us/iteration %8.1f us/access\n", backend, workload.mName, accesses,
+               static_cast<double>(elapsed.count()) / iterations,
+               accesses > 0 ? static_cast<double>(elapsed.count()) / accesses : 0.0);
+
+        for (size_t family = 0; family < TracingPersistentStorageDelegate::kNumKeyFamilies; family++)
+        {
+            const TracingPersistentStorageDelegate::FamilyStats & stats = tracing.GetFamilyStats(family);
+            if (stats.GetAccessCount() == 0)
+            {
+                continue;
+            }
+
+            uint64_t totalUs = (stats.mReads.mTotalDuration + stats.mWrites.mTotalDuration + stats.mDeletes.mTotalDuration).count();
+            printf("    %-32s %6" PRIu32 " R %6" PRIu32 " W %6" PRIu32 " D %10" PRIu64 " B written %10" PRIu64 " us\n",
+                   TracingPersistentStorageDelegate::GetKeyFamilyName(family), stats.mReads.mCount, stats.mWrites.mCount,
+                   stats.mDeletes.mCount, stats.mWrites.mTotalBytes, totalUs);
+        }
+    }
+    return true;
+}
+
+CHIP_ERROR Open(ChipLinuxStorage & storage, const std::string & path, ChipLinuxStorage::CommitMode mode)
+{
+    ReturnErrorOnFailure(storage.Init(path.c_str()));
+    return storage.SetCommitMode(mode,
+                                 (mode == ChipLinuxStorage::CommitMode::kGroupCommit) ? kGroupCommitWindow : System::Clock::kZero);
+}
+
+CHIP_ERROR Open(ChipLinuxLogStorage & storage, const std::string & path, ChipLinuxStorage::CommitMode mode)
+{
+    return storage.Init(path.c_str());
+}
+
+template <typename Storage>
+bool RunFileBackend(const char * backend, const std::string & path, uint32_t iterations,
+                    ChipLinuxStorage::CommitMode mode = ChipLinuxStorage::CommitMode::kSync)
+{
+    unlink(path.c_str());
+
+    bool success;
+    {
+        LinuxStorageDelegate<Storage> storage;
+        CHIP_ERROR err = Open(storage.GetStorage(), path, mode);
+        if (err != CHIP_NO_ERROR)
+        {
+            fprintf(stderr, "%s: failed to open %s: %" CHIP_ERROR_FORMAT "\n", backend, path.c_str(), err.Format());
+            return false;
+        }
+        success = RunWorkloads(backend, storage, iterations);
+    }
+
+    unlink(path.c_str());
+    return success;
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    uint32_t iterations   = (argc > 1) ? static_cast<uint32_t>(strtoul(argv[1], nullptr, 0)) : kDefaultIterations;
+    std::string directory = (argc > 2) ? argv[2] : "/tmp";
+
+    if (Platform::MemoryInit() != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "Failed to initialize memory\n");
+        return EXIT_FAILURE;
+    }
+
+    TestPersistentStorageDelegate memory;
+    bool success = RunWorkloads("memory", memory, iterations);
+    success      = success && RunFileBackend<ChipLinuxStorage>("ini", directory + "/chip_storage_benchmark.ini", iterations);
+    success      = success &&
+        RunFileBackend<ChipLinuxStorage>("ini-group", directory + "/chip_storage_benchmark.ini", iterations,
+                                         ChipLinuxStorage::CommitMode::kGroupCommit);
+    success = success &&
+        RunFileBackend<ChipLinuxStorage>("ini-async", directory + "/chip_storage_benchmark.ini", iterations,
+                                         ChipLinuxStorage::CommitMode::kAsync);
+    success = success && RunFileBackend<ChipLinuxLogStorage>("log", directory + "/chip_storage_benchmark.kvl", iterations);
+
+    Platform::MemoryShutdown();
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,200 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <platform/Linux/CHIPLinuxLogStorage.h>
+
+#include <algorithm>
+#include <string>
+
+using namespace chip;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+const char kLogPath[] = "/tmp/chip_test_kvs_log";
+
+size_t FileSize(const char * path)
+{
+    struct stat st;
+    return (stat(path, &st) == 0) ? static_cast<size_t>(st.st_size) : 0;
+}
+
+struct TestChipLinuxLogStorage : public ::testing::Test
+{
+    void SetUp() override { unlink(kLogPath); }
+    void TearDown() override { unlink(kLogPath); }
+};
+
+TEST_F(TestChipLinuxLogStorage, TestReadWriteAndReload)
+{
+    const uint8_t kValue1[] = { 1, 2, 3 };
+    const uint8_t kValue2[] = { 4, 5 };
+    uint8_t buf[8];
+    size_t len = 0;
+
+    {
+        ChipLinuxLogStorage storage;
+        EXPECT_EQ(storage.Init(kLogPath), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.ReadValueBin("a", buf, sizeof(buf), len), CHIP_ERROR_KEY_NOT_FOUND);
+        EXPECT_EQ(storage.ClearValue("a"), CHIP_ERROR_KEY_NOT_FOUND);
+
+        EXPECT_EQ(storage.WriteValueBin("a", kValue1, sizeof(kValue1)), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValueBin("b", kValue1, sizeof(kValue1)), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValueBin("a", kValue2, sizeof(kValue2)), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValueBin("empty", nullptr, 0), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.ClearValue("b"), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+
+        // Too small a buffer reports the size of the value
+        EXPECT_EQ(storage.ReadValueBin("a", nullptr, 0, len), CHIP_ERROR_BUFFER_TOO_SMALL);
+        EXPECT_EQ(len, sizeof(kValue2));
+        EXPECT_EQ(storage.ReadValueBin("a", buf, sizeof(buf), len), CHIP_NO_ERROR);
+        EXPECT_EQ(len, sizeof(kValue2));
+        EXPECT_EQ(memcmp(buf, kValue2, len), 0);
+    }
+
+    // Only the last records of the keys count once loaded again
+    ChipLinuxLogStorage storage;
+    EXPECT_EQ(storage.Init(kLogPath), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.ReadValueBin("a", buf, sizeof(buf), len), CHIP_NO_ERROR);
+    EXPECT_EQ(len, sizeof(kValue2));
+    EXPECT_EQ(memcmp(buf, kValue2, len), 0);
+    EXPECT_FALSE(storage.HasValue("b"));
+    EXPECT_TRUE(storage.HasValue("empty"));
+    EXPECT_EQ(storage.ReadValueBin("empty", buf, sizeof(buf), len), CHIP_NO_ERROR);
+    EXPECT_EQ(len, 0u);
+    EXPECT_EQ(storage.GetLogSize(), FileSize(kLogPath));
+}
+
+TEST_F(TestChipLinuxLogStorage, TestTornRecordRecovery)
+{
+    const uint8_t kValue[] = { 1, 2, 3, 4 };
+    uint8_t buf[8];
+    size_t len = 0;
+    size_t goodSize;
+
+    {
+        ChipLinuxLogStorage storage;
+        EXPECT_EQ(storage.Init(kLogPath), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValueBin("kept", kValue, sizeof(kValue)), CHIP_NO_ERROR);
+        goodSize = storage.GetLogSize();
+        EXPECT_EQ(storage.WriteValueBin("torn", kValue, sizeof(kValue)), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+    }
+
+    // Simulate a power loss in the middle of the last append
+    ASSERT_EQ(truncate(kLogPath, static_cast<off_t>(FileSize(kLogPath) - 2)), 0);
+
+    {
+        ChipLinuxLogStorage storage;
+        EXPECT_EQ(storage.Init(kLogPath), CHIP_NO_ERROR);
+        EXPECT_TRUE(storage.HasValue("kept"));
+        EXPECT_FALSE(storage.HasValue("torn"));
+        EXPECT_EQ(FileSize(kLogPath), goodSize);
+
+        // Records appended after recovery are not lost behind the torn one
+        EXPECT_EQ(storage.WriteValueBin("after", kValue, sizeof(kValue)), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+    }
+
+    {
+        ChipLinuxLogStorage storage;
+        EXPECT_EQ(storage.Init(kLogPath), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.ReadValueBin("after", buf, sizeof(buf), len), CHIP_NO_ERROR);
+        EXPECT_EQ(len, sizeof(kValue));
+    }
+
+    // Corrupted contents are dropped as well
+    FILE * file = fopen(kLogPath, "r+b");
+    ASSERT_NE(file, nullptr);
+    fseek(file, -1, SEEK_END);
+    fputc(0xFF, file);
+    fclose(file);
+
+    ChipLinuxLogStorage storage;
+    EXPECT_EQ(storage.Init(kLogPath), CHIP_NO_ERROR);
+    EXPECT_TRUE(storage.HasValue("kept"));
+    EXPECT_FALSE(storage.HasValue("after"));
+}
+
+TEST_F(TestChipLinuxLogStorage, TestCompaction)
+{
+    uint8_t value[256] = {};
+    uint8_t buf[sizeof(value)];
+    size_t len = 0;
+
+    ChipLinuxLogStorage storage;
+    EXPECT_EQ(storage.Init(kLogPath), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.WriteValueBin("other", value, 16), CHIP_NO_ERROR);
+
+    // Rewriting the same key keeps growing the log until it is compacted
+    size_t maxLogSize = 0;
+    for (unsigned i = 0; i < 2 * ChipLinuxLogStorage::kMinCompactionLogSize / sizeof(value); i++)
+    {
+        value[0] = static_cast<uint8_t>(i);
+        EXPECT_EQ(storage.WriteValueBin("counter", value, sizeof(value)), CHIP_NO_ERROR);
+        maxLogSize = std::max(maxLogSize, storage.GetLogSize());
+        EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+    }
+    EXPECT_GT(maxLogSize, ChipLinuxLogStorage::kMinCompactionLogSize);
+    EXPECT_LE(maxLogSize, ChipLinuxLogStorage::kMinCompactionLogSize + 2 * sizeof(value));
+    EXPECT_LT(storage.GetLogSize(), maxLogSize);
+    EXPECT_EQ(storage.GetLogSize(), FileSize(kLogPath));
+
+    // Appends after compaction go to the new log
+    EXPECT_EQ(storage.WriteValueBin("last", value, 1), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.Compact(), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.WriteValueBin("after", value, 1), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+
+    ChipLinuxLogStorage reloaded;
+    EXPECT_EQ(reloaded.Init(kLogPath), CHIP_NO_ERROR);
+    EXPECT_EQ(reloaded.ReadValueBin("counter", buf, sizeof(buf), len), CHIP_NO_ERROR);
+    EXPECT_EQ(len, sizeof(value));
+    EXPECT_EQ(memcmp(buf, value, len), 0);
+    EXPECT_TRUE(reloaded.HasValue("other"));
+    EXPECT_TRUE(reloaded.HasValue("last"));
+    EXPECT_TRUE(reloaded.HasValue("after"));
+    EXPECT_EQ(reloaded.GetLiveSize(), storage.GetLiveSize());
+
+    // ClearAll leaves an empty log
+    EXPECT_EQ(reloaded.ClearAll(), CHIP_NO_ERROR);
+    EXPECT_FALSE(reloaded.HasValue("counter"));
+    EXPECT_EQ(reloaded.GetLiveSize(), 0u);
+}
+
+TEST_F(TestChipLinuxLogStorage, TestRejectsOtherFiles)
+{
+    FILE * file = fopen(kLogPath, "wb");
+    ASSERT_NE(file, nullptr);
+    fputs("[DEFAULT]\n", file);
+    fclose(file);
+
+    ChipLinuxLogStorage storage;
+    EXPECT_NE(storage.Init(kLogPath), CHIP_NO_ERROR);
+}
+
+} // namespace
@@ -0,0 +1,101 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <unistd.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <platform/Linux/CHIPLinuxStorage.h>
+
+#include <chrono>
+#include <thread>
+
+using namespace chip;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+const char kConfigPath[] = "/tmp/chip_test_kvs_ini";
+
+// Whether the file, as written so far, holds the key.
+bool FileHasValue(const char * key)
+{
+    ChipLinuxStorage reader;
+    return (reader.Init(kConfigPath) == CHIP_NO_ERROR) && reader.HasValue(key);
+}
+
+struct TestChipLinuxStorage : public ::testing::Test
+{
+    void SetUp() override { unlink(kConfigPath); }
+    void TearDown() override { unlink(kConfigPath); }
+};
+
+TEST_F(TestChipLinuxStorage, TestGroupCommit)
+{
+    ChipLinuxStorage storage;
+    ASSERT_EQ(storage.Init(kConfigPath), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.SetCommitMode(ChipLinuxStorage::CommitMode::kAsync, System::Clock::Milliseconds32(10)),
+              CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(storage.SetCommitMode(ChipLinuxStorage::CommitMode::kGroupCommit, System::Clock::Milliseconds32(60000)),
+              CHIP_NO_ERROR);
+
+    // Commits within the window are not written yet
+    EXPECT_EQ(storage.WriteValue("a", static_cast<uint32_t>(1)), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.WriteValue("b", static_cast<uint32_t>(2)), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+    EXPECT_TRUE(storage.HasValue("b"));
+    EXPECT_FALSE(FileHasValue("a"));
+
+    // The barrier writes them all
+    EXPECT_EQ(storage.Flush(), CHIP_NO_ERROR);
+    EXPECT_TRUE(FileHasValue("a"));
+    EXPECT_TRUE(FileHasValue("b"));
+    EXPECT_EQ(storage.Flush(), CHIP_NO_ERROR);
+
+    // Going back to synchronous commits writes what is pending
+    EXPECT_EQ(storage.ClearValue("a"), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.SetCommitMode(ChipLinuxStorage::CommitMode::kSync), CHIP_NO_ERROR);
+    EXPECT_FALSE(FileHasValue("a"));
+}
+
+TEST_F(TestChipLinuxStorage, TestAsyncCommit)
+{
+    {
+        ChipLinuxStorage storage;
+        ASSERT_EQ(storage.Init(kConfigPath), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.SetCommitMode(ChipLinuxStorage::CommitMode::kAsync), CHIP_NO_ERROR);
+
+        EXPECT_EQ(storage.WriteValue("a", static_cast<uint32_t>(1)), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+        for (int i = 0; i < 200 && !FileHasValue("a"); i++)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        EXPECT_TRUE(FileHasValue("a"));
+
+        // Pending changes are written when the storage goes away
+        EXPECT_EQ(storage.WriteValue("b", static_cast<uint32_t>(2)), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+    }
+    EXPECT_TRUE(FileHasValue("b"));
+}
+
+} // namespace
@@ -0,0 +1,272 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/core/CHIPSafeCasts.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <platform/CHIPDeviceError.h>
+#include <platform/Linux/MappedFactoryDataProvider.h>
+
+#include <vector>
+
+using namespace chip;
+using namespace chip::DeviceLayer;
+
+namespace {
+
+const char kFactoryDataPath[] = "/tmp/chip_test_factory_data";
+
+const uint8_t kDac[]  = { 0x30, 0x01, 0x02, 0x03 };
+const uint8_t kSalt[] = { 's', 'a', 'l', 't', 's', 'a', 'l', 't', 's', 'a', 'l', 't', 's', 'a', 'l', 't' };
+
+class FactoryDataBuilder
+{
+public:
+    void Add(FactoryDataTag tag, ByteSpan value) { mFields.push_back({ tag, std::vector<uint8_t>(value.begin(), value.end()) }); }
+    void Add(FactoryDataTag tag, const char * value) { Add(tag, ByteSpan(Uint8::from_const_char(value), strlen(value))); }
+    void AddU16(FactoryDataTag tag, uint16_t value)
+    {
+        uint8_t buf[sizeof(value)];
+        Encoding::LittleEndian::Put16(buf, value);
+        Add(tag, ByteSpan(buf));
+    }
+    void AddU32(FactoryDataTag tag, uint32_t value)
+    {
+        uint8_t buf[sizeof(value)];
+        Encoding::LittleEndian::Put32(buf, value);
+        Add(tag, ByteSpan(buf));
+    }
+
+    std::vector<uint8_t> Build(Crypto::P256Keypair * signer = nullptr) const
+    {
+        const size_t indexEnd = MappedFactoryDataProvider::kHeaderLength + mFields.size() * MappedFactoryDataProvider::kEntryLength;
+        size_t contentLength  = indexEnd;
+        for (const auto & field : mFields)
+        {
+            contentLength += field.value.size();
+        }
+
+        std::vector<uint8_t> blob(contentLength + MappedFactoryDataProvider::kDigestLength);
+        Encoding::LittleEndian::Put32(&blob[0], MappedFactoryDataProvider::kMagic);
+        blob[4] = MappedFactoryDataProvider::kVersion;
+        blob[5] = (signer != nullptr) ? MappedFactoryDataProvider::kFlagSigned : 0;
+        Encoding::LittleEndian::Put16(&blob[6], static_cast<uint16_t>(mFields.size()));
+        Encoding::LittleEndian::Put32(&blob[8], static_cast<uint32_t>(contentLength));
+
+        size_t offset = indexEnd;
+        for (size_t i = 0; i < mFields.size(); i++)
+        {
+            uint8_t * entry = &blob[MappedFactoryDataProvider::kHeaderLength + i * MappedFactoryDataProvider::kEntryLength];
+            Encoding::LittleEndian::Put16(entry, to_underlying(mFields[i].tag));
+            Encoding::LittleEndian::Put16(entry + 2, static_cast<uint16_t>(mFields[i].value.size()));
+            Encoding::LittleEndian::Put32(entry + 4, static_cast<uint32_t>(offset));
+            memcpy(&blob[offset], mFields[i].value.data(), mFields[i].value.size());
+            offset += mFields[i].value.size();
+        }
+
+        EXPECT_EQ(Crypto::Hash_SHA256(blob.data(), contentLength, &blob[contentLength]), CHIP_NO_ERROR);
+        if (signer != nullptr)
+        {
+            Crypto::P256ECDSASignature signature;
+            EXPECT_EQ(signer->ECDSA_sign_msg(blob.data(), contentLength, signature), CHIP_NO_ERROR);
+            blob.insert(blob.end(), signature.ConstBytes(), signature.ConstBytes() + signature.Length());
+        }
+        return blob;
+    }
+
+private:
+    struct Field
+    {
+        FactoryDataTag tag;
+        std::vector<uint8_t> value;
+    };
+    std::vector<Field> mFields;
+};
+
+void WriteFile(const std::vector<uint8_t> & blob)
+{
+    FILE * file = fopen(kFactoryDataPath, "wb");
+    ASSERT_NE(file, nullptr);
+    EXPECT_EQ(fwrite(blob.data(), 1, blob.size(), file), blob.size());
+    fclose(file);
+}
+
+struct TestMappedFactoryDataProvider : public ::testing::Test
+{
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+    void SetUp() override { unlink(kFactoryDataPath); }
+    void TearDown() override { unlink(kFactoryDataPath); }
+};
+
+TEST_F(TestMappedFactoryDataProvider, TestReadFields)
+{
+    FactoryDataBuilder builder;
+    builder.Add(FactoryDataTag::kDacCert, ByteSpan(kDac));
+    builder.Add(FactoryDataTag::kSpake2pSalt, ByteSpan(kSalt));
+    builder.AddU16(FactoryDataTag::kSetupDiscriminator, 3840);
+    builder.AddU32(FactoryDataTag::kSpake2pIterationCount, 1000);
+    builder.AddU16(FactoryDataTag::kVendorId, 0xFFF1);
+    builder.Add(FactoryDataTag::kSerialNumber, "SN-0001");
+    const uint8_t date[] = { 0xE8, 0x07, 6, 15 };
+    builder.Add(FactoryDataTag::kManufacturingDate, ByteSpan(date));
+    WriteFile(builder.Build());
+
+    MappedFactoryDataProvider provider;
+    ASSERT_EQ(provider.Init(kFactoryDataPath), CHIP_NO_ERROR);
+
+    uint8_t buf[32];
+    MutableByteSpan dac(buf);
+    EXPECT_EQ(provider.GetDeviceAttestationCert(dac), CHIP_NO_ERROR);
+    EXPECT_TRUE(dac.data_equal(ByteSpan(kDac)));
+
+    MutableByteSpan tooSmall(buf, sizeof(kSalt) - 1);
+    EXPECT_EQ(provider.GetSpake2pSalt(tooSmall), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    // Fields are served from the mapping
+    ByteSpan salt;
+    EXPECT_EQ(provider.GetField(FactoryDataTag::kSpake2pSalt, salt), CHIP_NO_ERROR);
+    EXPECT_TRUE(salt.data_equal(ByteSpan(kSalt)));
+    ByteSpan saltAgain;
+    EXPECT_EQ(provider.GetField(FactoryDataTag::kSpake2pSalt, saltAgain), CHIP_NO_ERROR);
+    EXPECT_EQ(salt.data(), saltAgain.data());
+
+    uint16_t discriminator = 0;
+    EXPECT_EQ(provider.GetSetupDiscriminator(discriminator), CHIP_NO_ERROR);
+    EXPECT_EQ(discriminator, 3840);
+    EXPECT_EQ(provider.SetSetupDiscriminator(1), CHIP_ERROR_NOT_IMPLEMENTED);
+
+    uint32_t iterationCount = 0;
+    EXPECT_EQ(provider.GetSpake2pIterationCount(iterationCount), CHIP_NO_ERROR);
+    EXPECT_EQ(iterationCount, 1000u);
+
+    uint32_t passcode = 0;
+    EXPECT_EQ(provider.GetSetupPasscode(passcode), CHIP_ERROR_NOT_IMPLEMENTED);
+
+    uint16_t vendorId = 0;
+    EXPECT_EQ(provider.GetVendorId(vendorId), CHIP_NO_ERROR);
+    EXPECT_EQ(vendorId, 0xFFF1);
+
+    char serial[8];
+    EXPECT_EQ(provider.GetSerialNumber(serial, sizeof(serial)), CHIP_NO_ERROR);
+    EXPECT_STREQ(serial, "SN-0001");
+    EXPECT_EQ(provider.GetSerialNumber(serial, strlen("SN-0001")), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(provider.GetProductLabel(serial, sizeof(serial)), CHIP_DEVICE_ERROR_CONFIG_NOT_FOUND);
+
+    uint16_t year = 0;
+    uint8_t month = 0;
+    uint8_t day   = 0;
+    EXPECT_EQ(provider.GetManufacturingDate(year, month, day), CHIP_NO_ERROR);
+    EXPECT_EQ(year, 2024);
+    EXPECT_EQ(month, 6);
+    EXPECT_EQ(day, 15);
+
+    MutableByteSpan firmwareInformation(buf);
+    EXPECT_EQ(provider.GetFirmwareInformation(firmwareInformation), CHIP_NO_ERROR);
+    EXPECT_TRUE(firmwareInformation.empty());
+}
+
+TEST_F(TestMappedFactoryDataProvider, TestSignWithDeviceAttestationKey)
+{
+    Crypto::P256Keypair dacKeypair;
+    ASSERT_EQ(dacKeypair.Initialize(Crypto::ECPKeyTarget::ECDSA), CHIP_NO_ERROR);
+    Crypto::P256SerializedKeypair serialized;
+    ASSERT_EQ(dacKeypair.Serialize(serialized), CHIP_NO_ERROR);
+
+    const ByteSpan publicKey(serialized.ConstBytes(), Crypto::kP256_PublicKey_Length);
+    FactoryDataBuilder builder;
+    builder.Add(FactoryDataTag::kDacPublicKey, publicKey);
+    builder.Add(FactoryDataTag::kDacPrivateKey,
+                ByteSpan(serialized.ConstBytes() + publicKey.size(), serialized.Length() - publicKey.size()));
+    WriteFile(builder.Build());
+
+    MappedFactoryDataProvider provider;
+    ASSERT_EQ(provider.Init(kFactoryDataPath), CHIP_NO_ERROR);
+
+    const uint8_t message[] = { 1, 2, 3, 4 };
+    uint8_t signatureBuf[Crypto::kP256_ECDSA_Signature_Length_Raw];
+    MutableByteSpan signatureSpan(signatureBuf);
+    ASSERT_EQ(provider.SignWithDeviceAttestationKey(ByteSpan(message), signatureSpan), CHIP_NO_ERROR);
+
+    Crypto::P256ECDSASignature signature;
+    memcpy(signature.Bytes(), signatureSpan.data(), signatureSpan.size());
+    ASSERT_EQ(signature.SetLength(signatureSpan.size()), CHIP_NO_ERROR);
+    EXPECT_EQ(dacKeypair.Pubkey().ECDSA_validate_msg_signature(message, sizeof(message), signature), CHIP_NO_ERROR);
+}
+
+TEST_F(TestMappedFactoryDataProvider, TestIntegrity)
+{
+    FactoryDataBuilder builder;
+    builder.Add(FactoryDataTag::kDacCert, ByteSpan(kDac));
+
+    MappedFactoryDataProvider provider;
+    EXPECT_NE(provider.Init(kFactoryDataPath), CHIP_NO_ERROR);
+
+    std::vector<uint8_t> blob = builder.Build();
+    blob[blob.size() - MappedFactoryDataProvider::kDigestLength - 1] ^= 0xFF;
+    WriteFile(blob);
+    EXPECT_EQ(provider.Init(kFactoryDataPath), CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    EXPECT_FALSE(provider.IsInitialized());
+
+    // An index pointing out of the content
+    blob = builder.Build();
+    Encoding::LittleEndian::Put32(&blob[MappedFactoryDataProvider::kHeaderLength + 4], static_cast<uint32_t>(blob.size()));
+    WriteFile(blob);
+    EXPECT_EQ(provider.Init(kFactoryDataPath), CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+
+    blob = builder.Build();
+    blob[0] ^= 0xFF;
+    WriteFile(blob);
+    EXPECT_EQ(provider.Init(kFactoryDataPath), CHIP_ERROR_INVALID_FILE_IDENTIFIER);
+}
+
+TEST_F(TestMappedFactoryDataProvider, TestSignature)
+{
+    Crypto::P256Keypair signer;
+    ASSERT_EQ(signer.Initialize(Crypto::ECPKeyTarget::ECDSA), CHIP_NO_ERROR);
+    Crypto::P256Keypair otherSigner;
+    ASSERT_EQ(otherSigner.Initialize(Crypto::ECPKeyTarget::ECDSA), CHIP_NO_ERROR);
+
+    FactoryDataBuilder builder;
+    builder.Add(FactoryDataTag::kDacCert, ByteSpan(kDac));
+
+    MappedFactoryDataProvider provider;
+
+    // Signature required, but not present
+    WriteFile(builder.Build());
+    EXPECT_EQ(provider.Init(kFactoryDataPath, &signer.Pubkey()), CHIP_ERROR_INVALID_SIGNATURE);
+
+    WriteFile(builder.Build(&otherSigner));
+    EXPECT_NE(provider.Init(kFactoryDataPath, &signer.Pubkey()), CHIP_NO_ERROR);
+
+    WriteFile(builder.Build(&signer));
+    EXPECT_EQ(provider.Init(kFactoryDataPath, &signer.Pubkey()), CHIP_NO_ERROR);
+    ByteSpan dac;
+    EXPECT_EQ(provider.GetField(FactoryDataTag::kDacCert, dac), CHIP_NO_ERROR);
+    EXPECT_TRUE(dac.data_equal(ByteSpan(kDac)));
+}
+
+} // namespace
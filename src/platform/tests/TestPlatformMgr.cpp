@@ -29,6 +29,10 @@
 #include <string.h>
 
 #include <atomic>
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+#include <thread>
+#include <vector>
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
 
 #include <pw_unit_test/framework.h>
 
@@ -205,6 +209,49 @@ TEST_F(TestPlatformMgr, RunEventLoopStopBeforeSleep)
     PlatformMgr().Shutdown();
 }
 
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+static std::atomic<int> sWorkRan{ 0 };
+
+// Post more work items than the event queue holds from several threads at once, and check none are lost.
+TEST_F(TestPlatformMgr, ScheduleWorkFromManyThreads)
+{
+    constexpr int kNumThreads     = 4;
+    constexpr int kItemsPerThread = 5 * CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE;
+    constexpr int kTotalWorkItems = kNumThreads * kItemsPerThread;
+    std::atomic<int> scheduleFailures{ 0 };
+    sWorkRan = 0;
+
+    EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+    EXPECT_EQ(PlatformMgr().StartEventLoopTask(), CHIP_NO_ERROR);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kNumThreads; i++)
+    {
+        threads.emplace_back([&] {
+            for (int j = 0; j < kItemsPerThread; j++)
+            {
+                if (PlatformMgr().ScheduleWork([](intptr_t) { sWorkRan++; }) != CHIP_NO_ERROR)
+                {
+                    scheduleFailures++;
+                }
+            }
+        });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(scheduleFailures, 0);
+
+    for (size_t t = 0; sWorkRan != kTotalWorkItems && t < 1000; t++)
+        chip::test_utils::SleepMillis(1);
+    EXPECT_EQ(sWorkRan, kTotalWorkItems);
+
+    EXPECT_EQ(PlatformMgr().StopEventLoopTask(), CHIP_NO_ERROR);
+    PlatformMgr().Shutdown();
+}
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
+
 TEST_F(TestPlatformMgr, TryLockChipStack)
 {
     bool locked = PlatformMgr().TryLockChipStack();
@@ -58,6 +58,10 @@ enum class TransferControlFlags : uint8_t
     kSenderDrive   = (1U << 4),
     kReceiverDrive = (1U << 5),
     kAsync         = (1U << 6),
+    // Bit reserved by the BDX specification, used to propose (in TransferInit) and accept (in Accept) a Sender Drive
+    // transfer with several Blocks in flight, see TransferSession. Peers that do not know it ignore it in TransferInit and
+    // never set it in Accept, so such transfers fall back to one Block at a time.
+    kWindowed = (1U << 7),
 };
 
 enum class RangeControlFlags : uint8_t
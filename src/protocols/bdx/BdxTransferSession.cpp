@@ -6,6 +6,7 @@
 
 #include <protocols/bdx/BdxTransferSession.h>
 
+#include <lib/core/CHIPEncoding.h>
 #include <lib/support/BufferReader.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/TypeTraits.h>
@@ -20,7 +21,25 @@
 #include <type_traits>
 
 namespace {
-constexpr uint8_t kBdxVersion = 0; ///< The version of this implementation of the BDX spec
+constexpr uint8_t kBdxVersion       = 0; ///< The version of this implementation of the BDX spec
+constexpr uint16_t kBlockCounterSize = sizeof(uint32_t);
+
+/**
+ * @brief
+ *   Allocate a new PacketBuffer with room for the message headers and footer.
+ *
+ *   Blocks negotiated over a session that allows large payloads (e.g. TCP) may not fit in a regular buffer, in which case a
+ *   large buffer is allocated.
+ */
+::chip::System::PacketBufferHandle NewMessageBuffer(size_t msgDataSize)
+{
+    using namespace ::chip;
+    if (msgDataSize > System::PacketBuffer::kMaxSize - MessagePacketBuffer::kMaxFooterSize)
+    {
+        return System::PacketBufferHandle::New(msgDataSize + MessagePacketBuffer::kMaxFooterSize);
+    }
+    return MessagePacketBuffer::New(msgDataSize);
+}
 
 /**
  * @brief
@@ -29,7 +48,7 @@ constexpr uint8_t kBdxVersion = 0; ///< The version of this implementation of th
 CHIP_ERROR WriteToPacketBuffer(const ::chip::bdx::BdxMessage & msgStruct, ::chip::System::PacketBufferHandle & msgBuf)
 {
     size_t msgDataSize = msgStruct.MessageSize();
-    ::chip::Encoding::LittleEndian::PacketBufferWriter bbuf(chip::MessagePacketBuffer::New(msgDataSize), msgDataSize);
+    ::chip::Encoding::LittleEndian::PacketBufferWriter bbuf(NewMessageBuffer(msgDataSize), msgDataSize);
     if (bbuf.IsNull())
     {
         return CHIP_ERROR_NO_MEMORY;
@@ -82,6 +101,11 @@ void TransferSession::PollOutput(OutputEvent & event, System::Clock::Timestamp c
         return;
     }
 
+    if (mPendingOutput == OutputEventType::kNone && PrepareBlockRetransmission(event, curTime))
+    {
+        return;
+    }
+
     switch (mPendingOutput)
     {
     case OutputEventType::kNone:
@@ -94,8 +118,9 @@ void TransferSession::PollOutput(OutputEvent & event, System::Clock::Timestamp c
         event = OutputEvent::StatusReportEvent(OutputEventType::kStatusReceived, mStatusReportData);
         break;
     case OutputEventType::kMsgToSend:
-        event             = OutputEvent::MsgToSendEvent(mMsgTypeData, std::move(mPendingMsgHandle));
-        mTimeoutStartTime = curTime;
+        event                = OutputEvent::MsgToSendEvent(mMsgTypeData, std::move(mPendingMsgHandle));
+        mTimeoutStartTime    = curTime;
+        mRetransmitStartTime = curTime;
         break;
     case OutputEventType::kInitReceived:
         event = OutputEvent::TransferInitEvent(mTransferRequestData, std::move(mPendingMsgHandle));
@@ -197,6 +222,15 @@ CHIP_ERROR TransferSession::WaitForTransfer(TransferRole role, BitFlags<Transfer
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR TransferSession::SetMaxSupportedBlockSize(uint16_t maxBlockSize)
+{
+    VerifyOrReturnError(mState == TransferState::kAwaitingInitMsg, CHIP_ERROR_INCORRECT_STATE);
+
+    mMaxSupportedBlockSize = maxBlockSize;
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData)
 {
     MessageType msgType;
@@ -213,13 +247,16 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
 
     mTransferMaxBlockSize = acceptData.MaxBlockSize;
 
+    // Only Sender Drive transfers may be windowed
+    mWindowed = mWindowed && (acceptData.ControlMode == TransferControlFlags::kSenderDrive);
+
     if (mRole == TransferRole::kSender)
     {
         mStartOffset    = acceptData.StartOffset;
         mTransferLength = acceptData.Length;
 
         ReceiveAccept acceptMsg;
-        acceptMsg.TransferCtlFlags.Set(acceptData.ControlMode);
+        acceptMsg.TransferCtlFlags.Set(acceptData.ControlMode).Set(TransferControlFlags::kWindowed, mWindowed);
         acceptMsg.Version        = mTransferVersion;
         acceptMsg.MaxBlockSize   = acceptData.MaxBlockSize;
         acceptMsg.StartOffset    = acceptData.StartOffset;
@@ -238,7 +275,7 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
     else
     {
         SendAccept acceptMsg;
-        acceptMsg.TransferCtlFlags.Set(acceptData.ControlMode);
+        acceptMsg.TransferCtlFlags.Set(acceptData.ControlMode).Set(TransferControlFlags::kWindowed, mWindowed);
         acceptMsg.Version        = mTransferVersion;
         acceptMsg.MaxBlockSize   = acceptData.MaxBlockSize;
         acceptMsg.Metadata       = acceptData.Metadata;
@@ -332,15 +369,18 @@ CHIP_ERROR TransferSession::PrepareBlockQueryWithSkip(const uint64_t & bytesToSk
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
+bool TransferSession::CanPrepareBlock() const
 {
-    VerifyOrReturnError(mState == TransferState::kTransferInProgress, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(mRole == TransferRole::kSender, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnValue(mRole == TransferRole::kSender && mState == TransferState::kTransferInProgress, false);
+    VerifyOrReturnValue(mPendingOutput == OutputEventType::kNone, false);
+    return mWindowed ? IsBlockWindowOpen() : !mAwaitingResponse;
+}
 
+CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
+{
     // Verify non-zero data is provided and is no longer than MaxBlockSize (BlockEOF may contain 0 length data)
-    VerifyOrReturnError((inData.Data != nullptr) && (inData.Length <= mTransferMaxBlockSize), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(inData.Data != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    ReturnErrorOnFailure(VerifyCanPrepareBlock(inData.Length));
 
     DataBlock blockMsg;
     blockMsg.BlockCounter = mNextBlockNum;
@@ -349,7 +389,59 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
 
     ReturnErrorOnFailure(WriteToPacketBuffer(blockMsg, mPendingMsgHandle));
 
-    const MessageType msgType = inData.IsEof ? MessageType::BlockEOF : MessageType::Block;
+    return EmitPreparedBlock(blockMsg, inData.IsEof);
+}
+
+System::PacketBufferHandle TransferSession::AllocateBlockBuffer() const
+{
+    VerifyOrReturnValue(mTransferMaxBlockSize > 0, System::PacketBufferHandle());
+    return System::PacketBufferHandle::New(mTransferMaxBlockSize + MessagePacketBuffer::kMaxFooterSize,
+                                           System::PacketBuffer::kDefaultHeaderReserve + kBlockCounterSize);
+}
+
+CHIP_ERROR TransferSession::PrepareBlock(System::PacketBufferHandle && blockData, bool isEof)
+{
+    VerifyOrReturnError(!blockData.IsNull() && !blockData->HasChainedBuffer(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(blockData->ReservedSize() >= System::PacketBuffer::kDefaultHeaderReserve + kBlockCounterSize,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(blockData->AvailableDataLength() >= MessagePacketBuffer::kMaxFooterSize, CHIP_ERROR_INVALID_ARGUMENT);
+    ReturnErrorOnFailure(VerifyCanPrepareBlock(blockData->DataLength()));
+
+    DataBlock blockMsg;
+    blockMsg.BlockCounter = mNextBlockNum;
+    blockMsg.Data         = blockData->Start();
+    blockMsg.DataLength   = blockData->DataLength();
+
+    // Write the Block counter in front of the data, in the room reserved by AllocateBlockBuffer().
+    uint8_t * msgStart = blockData->Start() - kBlockCounterSize;
+    blockData->SetStart(msgStart);
+    Encoding::LittleEndian::Put32(msgStart, mNextBlockNum);
+    mPendingMsgHandle = std::move(blockData);
+
+    return EmitPreparedBlock(blockMsg, isEof);
+}
+
+CHIP_ERROR TransferSession::VerifyCanPrepareBlock(size_t dataLength) const
+{
+    VerifyOrReturnError(mState == TransferState::kTransferInProgress, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mRole == TransferRole::kSender, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mWindowed ? IsBlockWindowOpen() : !mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(dataLength <= mTransferMaxBlockSize, CHIP_ERROR_INVALID_ARGUMENT);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TransferSession::EmitPreparedBlock(const DataBlock & blockMsg, bool isEof)
+{
+    if (mWindowed)
+    {
+        // Keep a copy for retransmission: the message layer encrypts the sent one in place.
+        System::PacketBufferHandle blockCopy = mPendingMsgHandle.CloneData();
+        VerifyOrReturnError(!blockCopy.IsNull(), CHIP_ERROR_NO_MEMORY);
+        mUnackedBlocks[mNextBlockNum % CHIP_CONFIG_BDX_MAX_BLOCK_WINDOW] = std::move(blockCopy);
+    }
+
+    const MessageType msgType = isEof ? MessageType::BlockEOF : MessageType::Block;
 
 #if CHIP_AUTOMATION_LOGGING
     ChipLogAutomation("Sending BDX Message");
@@ -442,6 +534,17 @@ void TransferSession::Reset()
     mTimeoutStartTime       = System::Clock::kZero;
     mShouldInitTimeoutStart = true;
     mAwaitingResponse       = false;
+
+    mWindowed = false;
+    for (auto & block : mUnackedBlocks)
+    {
+        block = nullptr;
+    }
+    mOldestUnackedBlockNum  = 0;
+    mNextRetransmitBlockNum = 0;
+    mNumBlocksToRetransmit  = 0;
+    mRetransmitStartTime    = System::Clock::kZero;
+    mRetransmitRequested    = false;
 }
 
 CHIP_ERROR TransferSession::HandleMessageReceived(const PayloadHeader & payloadHeader, System::PacketBufferHandle msg,
@@ -453,7 +556,8 @@ CHIP_ERROR TransferSession::HandleMessageReceived(const PayloadHeader & payloadH
     {
         ReturnErrorOnFailure(HandleBdxMessage(payloadHeader, std::move(msg)));
 
-        mTimeoutStartTime = curTime;
+        mTimeoutStartTime    = curTime;
+        mRetransmitStartTime = curTime;
     }
     else if (payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport))
     {
@@ -659,13 +763,29 @@ void TransferSession::HandleSendAccept(System::PacketBufferHandle msgData)
 void TransferSession::HandleBlockQuery(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
-    VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    VerifyOrReturn(mState == TransferState::kTransferInProgress || (mWindowed && mState == TransferState::kAwaitingEOFAck),
+                   PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
     BlockQuery query;
     const CHIP_ERROR err = query.Parse(std::move(msgData));
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
 
+    if (mWindowed)
+    {
+        // In a windowed transfer, a BlockQuery reports the first Block the receiver is missing, all the previous ones
+        // having been received. Ignore late queries for Blocks that have been acknowledged since.
+        VerifyOrReturn(static_cast<int32_t>(query.BlockCounter - mOldestUnackedBlockNum) >= 0);
+        const uint32_t numMissingBlocks = mNextBlockNum - query.BlockCounter;
+        VerifyOrReturn(numMissingBlocks <= GetNumBlocksInFlight(), PrepareStatusReport(StatusCode::kBadBlockCounter));
+
+        // The receiver drops the Blocks following a missing one, so resend all of them.
+        ReleaseAckedBlocks(query.BlockCounter);
+        mNextRetransmitBlockNum = query.BlockCounter;
+        mNumBlocksToRetransmit  = numMissingBlocks;
+        return;
+    }
+
     VerifyOrReturn(query.BlockCounter == mNextBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
 
     mPendingOutput = OutputEventType::kQueryReceived;
@@ -704,13 +824,19 @@ void TransferSession::HandleBlockQueryWithSkip(System::PacketBufferHandle msgDat
 void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kReceiver, PrepareStatusReport(StatusCode::kUnexpectedMessage));
-    VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
-    VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    VerifyOrReturn(mState == TransferState::kTransferInProgress || mWindowed, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    VerifyOrReturn(mAwaitingResponse || mWindowed, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
     Block blockMsg;
     const CHIP_ERROR err = blockMsg.Parse(msgData.Retain());
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
 
+    if (mWindowed && (mState != TransferState::kTransferInProgress || blockMsg.BlockCounter != mLastQueryNum))
+    {
+        HandleOutOfOrderBlock(blockMsg.BlockCounter);
+        return;
+    }
+
     VerifyOrReturn(blockMsg.BlockCounter == mLastQueryNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
     VerifyOrReturn((blockMsg.DataLength > 0) && (blockMsg.DataLength <= mTransferMaxBlockSize),
                    PrepareStatusReport(StatusCode::kBadMessageContents));
@@ -732,7 +858,16 @@ void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
     mNumBytesProcessed += blockMsg.DataLength;
     mLastBlockNum = blockMsg.BlockCounter;
 
-    mAwaitingResponse = false;
+    if (mWindowed)
+    {
+        // More Blocks may already be in flight: expect the next one right away.
+        mLastQueryNum        = blockMsg.BlockCounter + 1;
+        mRetransmitRequested = false;
+    }
+    else
+    {
+        mAwaitingResponse = false;
+    }
 
 #if CHIP_AUTOMATION_LOGGING
     blockMsg.LogMessage(MessageType::Block);
@@ -742,13 +877,19 @@ void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
 void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kReceiver, PrepareStatusReport(StatusCode::kUnexpectedMessage));
-    VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
-    VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    VerifyOrReturn(mState == TransferState::kTransferInProgress || mWindowed, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    VerifyOrReturn(mAwaitingResponse || mWindowed, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
     BlockEOF blockEOFMsg;
     const CHIP_ERROR err = blockEOFMsg.Parse(msgData.Retain());
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
 
+    if (mWindowed && (mState != TransferState::kTransferInProgress || blockEOFMsg.BlockCounter != mLastQueryNum))
+    {
+        HandleOutOfOrderBlock(blockEOFMsg.BlockCounter);
+        return;
+    }
+
     VerifyOrReturn(blockEOFMsg.BlockCounter == mLastQueryNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
     VerifyOrReturn(blockEOFMsg.DataLength <= mTransferMaxBlockSize, PrepareStatusReport(StatusCode::kBadMessageContents));
 
@@ -774,12 +915,20 @@ void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
 void TransferSession::HandleBlockAck(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
-    VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
-    VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    VerifyOrReturn(mState == TransferState::kTransferInProgress || (mWindowed && mState == TransferState::kAwaitingEOFAck),
+                   PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    VerifyOrReturn(mAwaitingResponse || mWindowed, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
     BlockAck ackMsg;
     const CHIP_ERROR err = ackMsg.Parse(std::move(msgData));
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
+
+    if (mWindowed)
+    {
+        HandleWindowedBlockAck(ackMsg.BlockCounter);
+        return;
+    }
+
     VerifyOrReturn(ackMsg.BlockCounter == mLastBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
 
     mPendingOutput = OutputEventType::kAckReceived;
@@ -804,6 +953,11 @@ void TransferSession::HandleBlockAckEOF(System::PacketBufferHandle msgData)
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
     VerifyOrReturn(ackMsg.BlockCounter == mLastBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
 
+    if (mWindowed)
+    {
+        ReleaseAckedBlocks(mNextBlockNum);
+    }
+
     mPendingOutput = OutputEventType::kAckEOFReceived;
 
     mAwaitingResponse = false;
@@ -827,7 +981,9 @@ void TransferSession::ResolveTransferControlOptions(const BitFlags<TransferContr
 
     // Ensure there are options supported by both nodes. Async gets priority.
     // If there is only one common option, choose that one. Otherwise the application must pick.
-    const BitFlags<TransferControlFlags> commonOpts(proposed & mSuppportedXferOpts);
+    BitFlags<TransferControlFlags> commonOpts(proposed & mSuppportedXferOpts);
+    mWindowed = commonOpts.Has(TransferControlFlags::kWindowed);
+    commonOpts.Clear(TransferControlFlags::kWindowed);
     if (!commonOpts.HasAny())
     {
         PrepareStatusReport(StatusCode::kTransferMethodNotSupported);
@@ -849,17 +1005,19 @@ void TransferSession::ResolveTransferControlOptions(const BitFlags<TransferContr
 CHIP_ERROR TransferSession::VerifyProposedMode(const BitFlags<TransferControlFlags> & proposed)
 {
     TransferControlFlags mode;
+    BitFlags<TransferControlFlags> proposedModes(proposed);
+    proposedModes.Clear(TransferControlFlags::kWindowed);
 
     // Must specify only one mode in Accept messages
-    if (proposed.HasOnly(TransferControlFlags::kAsync))
+    if (proposedModes.HasOnly(TransferControlFlags::kAsync))
     {
         mode = TransferControlFlags::kAsync;
     }
-    else if (proposed.HasOnly(TransferControlFlags::kReceiverDrive))
+    else if (proposedModes.HasOnly(TransferControlFlags::kReceiverDrive))
     {
         mode = TransferControlFlags::kReceiverDrive;
     }
-    else if (proposed.HasOnly(TransferControlFlags::kSenderDrive))
+    else if (proposedModes.HasOnly(TransferControlFlags::kSenderDrive))
     {
         mode = TransferControlFlags::kSenderDrive;
     }
@@ -869,10 +1027,13 @@ CHIP_ERROR TransferSession::VerifyProposedMode(const BitFlags<TransferControlFla
         return CHIP_ERROR_INTERNAL;
     }
 
-    // Verify the proposed mode is supported by this instance
-    if (mSuppportedXferOpts.Has(mode))
+    // Verify the proposed mode is supported by this instance, and that a windowed transfer was proposed if accepted
+    const bool windowed = proposed.Has(TransferControlFlags::kWindowed);
+    if (mSuppportedXferOpts.Has(mode) &&
+        (!windowed || (mSuppportedXferOpts.Has(TransferControlFlags::kWindowed) && mode == TransferControlFlags::kSenderDrive)))
     {
         mControlMode = mode;
+        mWindowed    = windowed;
     }
     else
     {
@@ -915,6 +1076,112 @@ bool TransferSession::IsTransferLengthDefinite() const
     return (mTransferLength > 0);
 }
 
+bool TransferSession::IsBlockWindowOpen() const
+{
+    // Retransmissions go first, so that the receiver, which drops the Blocks following a missing one, gets them in order.
+    return (GetNumBlocksInFlight() < CHIP_CONFIG_BDX_MAX_BLOCK_WINDOW) && (mNumBlocksToRetransmit == 0);
+}
+
+void TransferSession::HandleWindowedBlockAck(uint32_t blockCounter)
+{
+    // Acknowledgements are cumulative. Ignore late ones, for Blocks that have been acknowledged since.
+    VerifyOrReturn(static_cast<int32_t>(blockCounter - mOldestUnackedBlockNum) >= 0);
+    VerifyOrReturn(blockCounter - mOldestUnackedBlockNum < GetNumBlocksInFlight(),
+                   PrepareStatusReport(StatusCode::kBadBlockCounter));
+
+    ReleaseAckedBlocks(blockCounter + 1);
+
+    // Once the BlockEOF has been sent, there is nothing more for the application to do until the BlockAckEOF.
+    VerifyOrReturn(mState == TransferState::kTransferInProgress);
+    mPendingOutput = OutputEventType::kAckReceived;
+}
+
+void TransferSession::HandleOutOfOrderBlock(uint32_t blockCounter)
+{
+    const bool isAhead = static_cast<int32_t>(blockCounter - mLastQueryNum) > 0;
+
+    if (mState == TransferState::kTransferInProgress && isAhead)
+    {
+        // The Block expected next was lost. Drop this one, and ask the sender once to resend from the missing Block.
+        VerifyOrReturn(!mRetransmitRequested);
+
+        BlockQuery queryMsg;
+        queryMsg.BlockCounter = mLastQueryNum;
+        VerifyOrReturn(WriteToPacketBuffer(queryMsg, mPendingMsgHandle) == CHIP_NO_ERROR);
+
+        mRetransmitRequested = true;
+        PrepareOutgoingMessageEvent(MessageType::BlockQuery, mPendingOutput, mMsgTypeData);
+    }
+    else if (mState == TransferState::kTransferInProgress)
+    {
+        // A retransmission of a Block that was already received, the acknowledgement of which was lost or is late:
+        // acknowledge it again.
+        CounterMessage ackMsg;
+        ackMsg.BlockCounter = mLastBlockNum;
+        VerifyOrReturn(WriteToPacketBuffer(ackMsg, mPendingMsgHandle) == CHIP_NO_ERROR);
+
+        PrepareOutgoingMessageEvent(MessageType::BlockAck, mPendingOutput, mMsgTypeData);
+    }
+    else
+    {
+        // Retransmissions may still arrive after the BlockEOF was received, ignore them.
+        VerifyOrReturn(!isAhead && (mState == TransferState::kReceivedEOF || mState == TransferState::kTransferDone),
+                       PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    }
+}
+
+bool TransferSession::PrepareBlockRetransmission(OutputEvent & event, System::Clock::Timestamp curTime)
+{
+    VerifyOrReturnValue(mWindowed && mRole == TransferRole::kSender, false);
+    VerifyOrReturnValue(mState == TransferState::kTransferInProgress || mState == TransferState::kAwaitingEOFAck, false);
+    VerifyOrReturnValue(GetNumBlocksInFlight() > 0, false);
+
+    if (mNumBlocksToRetransmit == 0)
+    {
+        // Nothing heard from the receiver for a while: resend the oldest Block in flight, the receiver then either
+        // acknowledges it or reports the first Block it is missing.
+        const System::Clock::Timeout retransmitTimeout = System::Clock::Milliseconds32(CHIP_CONFIG_BDX_BLOCK_RETRANSMIT_TIMEOUT);
+        VerifyOrReturnValue(curTime - mRetransmitStartTime >= retransmitTimeout, false);
+        mNextRetransmitBlockNum = mOldestUnackedBlockNum;
+        mNumBlocksToRetransmit  = 1;
+    }
+
+    const uint32_t blockNum              = mNextRetransmitBlockNum;
+    System::PacketBufferHandle blockCopy = mUnackedBlocks[blockNum % CHIP_CONFIG_BDX_MAX_BLOCK_WINDOW].CloneData();
+    VerifyOrReturnValue(!blockCopy.IsNull(), false, ChipLogError(BDX, "Not enough memory to retransmit Block %" PRIu32, blockNum));
+
+    mNextRetransmitBlockNum++;
+    mNumBlocksToRetransmit--;
+    mRetransmitStartTime = curTime;
+
+    const MessageType msgType =
+        (mState == TransferState::kAwaitingEOFAck && blockNum == mLastBlockNum) ? MessageType::BlockEOF : MessageType::Block;
+    MessageTypeData msgTypeData;
+    msgTypeData.ProtocolId  = Protocols::MessageTypeTraits<MessageType>::ProtocolId();
+    msgTypeData.MessageType = to_underlying(msgType);
+
+    event = OutputEvent::MsgToSendEvent(msgTypeData, std::move(blockCopy));
+    return true;
+}
+
+void TransferSession::ReleaseAckedBlocks(uint32_t nextUnackedBlockNum)
+{
+    while (mOldestUnackedBlockNum != nextUnackedBlockNum)
+    {
+        mUnackedBlocks[mOldestUnackedBlockNum % CHIP_CONFIG_BDX_MAX_BLOCK_WINDOW] = nullptr;
+        mOldestUnackedBlockNum++;
+
+        // No need to resend it anymore
+        if (mNumBlocksToRetransmit > 0 && mNextRetransmitBlockNum == mOldestUnackedBlockNum - 1)
+        {
+            mNextRetransmitBlockNum++;
+            mNumBlocksToRetransmit--;
+        }
+    }
+
+    mAwaitingResponse = (GetNumBlocksInFlight() > 0);
+}
+
 const char * TransferSession::OutputEvent::ToString(OutputEventType outputEventType)
 {
     switch (outputEventType)
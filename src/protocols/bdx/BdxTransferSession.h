@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/CHIPError.h>
 #include <protocols/bdx/BdxMessages.h>
 #include <system/SystemClock.h>
@@ -217,6 +218,18 @@ public:
     CHIP_ERROR WaitForTransfer(TransferRole role, BitFlags<TransferControlFlags> xferControlOpts, uint16_t maxBlockSize,
                                System::Clock::Timeout timeout);
 
+    /**
+     * @brief
+     *   Change the max Block size given to WaitForTransfer(). Meant for responders that learn, along with the TransferInit
+     *   message, that the transfer runs over a session that allows large payloads (see Transport::Session::AllowsLargePayload()).
+     *   Must be called before that TransferInit message is handled.
+     *
+     * @param maxBlockSize The max Block size that this object supports.
+     *
+     * @return CHIP_ERROR_INCORRECT_STATE if this object is not waiting for a TransferInit message.
+     */
+    CHIP_ERROR SetMaxSupportedBlockSize(uint16_t maxBlockSize);
+
     /**
      * @brief
      *   Indicate that all transfer parameters are acceptable and prepare a SendAccept or ReceiveAccept message (depending on role).
@@ -263,6 +276,11 @@ public:
      * @brief
      *   Prepare a Block message. The Block counter will be populated automatically.
      *
+     *   In a windowed transfer (see IsWindowed()), Blocks may be prepared until the window is full instead of waiting for each
+     *   of them to be acknowledged: see CanPrepareBlock(). The TransferSession keeps a copy of the unacknowledged Blocks and
+     *   emits their retransmissions itself via PollOutput(), either when the receiver reports a missing Block or after
+     *   CHIP_CONFIG_BDX_BLOCK_RETRANSMIT_TIMEOUT without any message from the receiver.
+     *
      * @param inData Contains data for filling out the Block message
      *
      * @return CHIP_ERROR The result of the preparation of a Block message. May also indicate if the TransferSession object
@@ -270,6 +288,31 @@ public:
      */
     CHIP_ERROR PrepareBlock(const BlockData & inData);
 
+    /**
+     * @brief
+     *   Allocate a buffer for the data of the next Block, to be filled by the caller (e.g. read directly from the image or log
+     *   source) and handed back through PrepareBlock(System::PacketBufferHandle &&, bool). This avoids the copy of the data made
+     *   by PrepareBlock(const BlockData &), which matters for the large Blocks used over sessions that allow large payloads.
+     *
+     *   The buffer has room for GetTransferBlockSize() bytes of data, and reserves room for the Block counter in front of them.
+     *
+     * @return The buffer, or a null handle if no transfer has been negotiated or if no memory is available.
+     */
+    System::PacketBufferHandle AllocateBlockBuffer() const;
+
+    /**
+     * @brief
+     *   Prepare a Block message from a buffer obtained with AllocateBlockBuffer(), without copying its data. The Block counter
+     *   will be populated automatically.
+     *
+     * @param blockData Buffer holding the data of the Block, starting at Start(). Ownership is taken by the TransferSession.
+     * @param isEof     Whether this is the last Block of the transfer
+     *
+     * @return CHIP_ERROR The result of the preparation of a Block message. May also indicate if the TransferSession object
+     *                    is unable to handle this request.
+     */
+    CHIP_ERROR PrepareBlock(System::PacketBufferHandle && blockData, bool isEof);
+
     /**
      * @brief
      *   Prepare a BlockAck message. The Block counter will be populated automatically.
@@ -318,6 +361,25 @@ public:
     uint16_t GetTransferBlockSize() const { return mTransferMaxBlockSize; }
     uint32_t GetNextBlockNum() const { return mNextBlockNum; }
     uint32_t GetNextQueryNum() const { return mNextQueryNum; }
+
+    /**
+     * @brief
+     *   Whether the transfer was negotiated as windowed: a Sender Drive transfer where the sender keeps up to
+     *   CHIP_CONFIG_BDX_MAX_BLOCK_WINDOW Blocks in flight, proposed with TransferControlFlags::kWindowed in the TransferInit
+     *   and accepted with it in the Accept message. Both peers must include kWindowed in their supported options.
+     *
+     *   Blocks are acknowledged at the BDX level in such transfers, so they should be sent without requesting a message layer
+     *   acknowledgement (Messaging::SendMessageFlags::kNoAutoRequestAck), which would only allow one of them in flight on the
+     *   exchange.
+     */
+    bool IsWindowed() const { return mWindowed; }
+
+    /**
+     * @brief
+     *   Whether PrepareBlock() may be called now: the next Block is expected (or, in a windowed transfer, the window is not full)
+     *   and there is no pending output.
+     */
+    bool CanPrepareBlock() const;
     size_t GetNumBytesProcessed() const { return mNumBytesProcessed; }
     const uint8_t * GetFileDesignator(uint16_t & fileDesignatorLen) const
     {
@@ -370,6 +432,17 @@ private:
     void PrepareStatusReport(StatusCode code);
     bool IsTransferLengthDefinite() const;
 
+    CHIP_ERROR VerifyCanPrepareBlock(size_t dataLength) const;
+    CHIP_ERROR EmitPreparedBlock(const DataBlock & blockMsg, bool isEof);
+
+    // Windowed transfer support, see IsWindowed()
+    uint32_t GetNumBlocksInFlight() const { return mNextBlockNum - mOldestUnackedBlockNum; }
+    bool IsBlockWindowOpen() const;
+    void HandleWindowedBlockAck(uint32_t blockCounter);
+    void HandleOutOfOrderBlock(uint32_t blockCounter);
+    bool PrepareBlockRetransmission(OutputEvent & event, System::Clock::Timestamp curTime);
+    void ReleaseAckedBlocks(uint32_t nextUnackedBlockNum);
+
     OutputEventType mPendingOutput = OutputEventType::kNone;
     TransferState mState           = TransferState::kUnitialized;
     TransferRole mRole;
@@ -405,6 +478,19 @@ private:
     System::Clock::Timestamp mTimeoutStartTime = System::Clock::kZero;
     bool mShouldInitTimeoutStart               = true;
     bool mAwaitingResponse                     = false;
+
+    // Used by windowed transfers
+    bool mWindowed = false;
+    // Sender: copies of the Blocks in flight, indexed by BlockCounter modulo the window size. Blocks from
+    // mOldestUnackedBlockNum to mNextBlockNum are unacknowledged, and mNumBlocksToRetransmit of them, from
+    // mNextRetransmitBlockNum, are to be retransmitted.
+    System::PacketBufferHandle mUnackedBlocks[CHIP_CONFIG_BDX_MAX_BLOCK_WINDOW];
+    uint32_t mOldestUnackedBlockNum               = 0;
+    uint32_t mNextRetransmitBlockNum              = 0;
+    uint32_t mNumBlocksToRetransmit               = 0;
+    System::Clock::Timestamp mRetransmitStartTime = System::Clock::kZero;
+    // Receiver: a BlockQuery for the missing Block mLastQueryNum has been sent.
+    bool mRetransmitRequested = false;
 };
 
 } // namespace bdx
@@ -52,6 +52,12 @@ CHIP_ERROR TransferFacilitator::OnMessageReceived(chip::Messaging::ExchangeConte
     if (mExchangeCtx == nullptr)
     {
         mExchangeCtx = ec;
+
+        // A Responder learns here which session the transfer runs over: allow larger Blocks if it carries large payloads.
+        if (mLargePayloadMaxBlockSize > 0 && ec->HasSessionHandle() && ec->GetSessionHandle()->AllowsLargePayload())
+        {
+            LogErrorOnFailure(mTransfer.SetMaxSupportedBlockSize(mLargePayloadMaxBlockSize));
+        }
     }
 
     ChipLogDetail(BDX, "%s: message " ChipLogFormatMessageType " protocol " ChipLogFormatProtocolId, __FUNCTION__,
@@ -99,6 +99,7 @@ protected:
     Messaging::ExchangeContext * mExchangeCtx;
     System::Layer * mSystemLayer;
     System::Clock::Timeout mPollFreq;
+    uint16_t mLargePayloadMaxBlockSize = 0;
     static constexpr System::Clock::Timeout kDefaultPollFreq    = System::Clock::Milliseconds32(500);
     static constexpr System::Clock::Timeout kImmediatePollDelay = System::Clock::Milliseconds32(1);
 };
@@ -125,6 +126,16 @@ public:
     CHIP_ERROR PrepareForTransfer(System::Layer * layer, TransferRole role, BitFlags<TransferControlFlags> xferControlOpts,
                                   uint16_t maxBlockSize, System::Clock::Timeout timeout,
                                   System::Clock::Timeout pollFreq = TransferFacilitator::kDefaultPollFreq);
+
+    /**
+     * Set the max Block size to support, instead of the one given to PrepareForTransfer(), when the transfer request arrives on a
+     * session that allows large payloads (e.g. TCP). Such Blocks are not bound by the MTU, so for instance
+     * CHIP_CONFIG_BDX_LARGE_PAYLOAD_MAX_BLOCK_SIZE lets a transfer approach the link speed. 0, the default, keeps the size given to
+     * PrepareForTransfer() on all sessions.
+     *
+     * @param[in] maxBlockSize The supported maximum size of BDX Block data over sessions that allow large payloads
+     */
+    void SetLargePayloadMaxBlockSize(uint16_t maxBlockSize) { mLargePayloadMaxBlockSize = maxBlockSize; }
 };
 
 /**
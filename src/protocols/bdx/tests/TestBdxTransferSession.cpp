@@ -530,6 +530,191 @@ TEST_F(TestBdxTransferSession, TestInitiatingSenderSenderDrive)
     SendAndVerifyBlockAck(initiatingSender, respondingReceiver, outEvent, true);
 }
 
+// Helper method for negotiating a Sender Drive transfer between an initiating sender and a responding receiver, where the sender
+// proposes a windowed transfer.
+void NegotiateSenderDriveTransfer(TransferSession & initiatingSender, TransferSession & respondingReceiver,
+                                  BitFlags<TransferControlFlags> receiverOpts)
+{
+    TransferSession::OutputEvent outEvent;
+    uint16_t transferBlockSize     = 10;
+    System::Clock::Timeout timeout = System::Clock::Seconds16(24);
+
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags =
+        BitFlags<TransferControlFlags>(TransferControlFlags::kSenderDrive, TransferControlFlags::kWindowed);
+    initOptions.MaxBlockSize   = transferBlockSize;
+    char testFileDes[9]        = { "test.txt" };
+    initOptions.FileDesLength  = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator = reinterpret_cast<uint8_t *>(testFileDes);
+
+    SendAndVerifyTransferInit(outEvent, timeout, initiatingSender, TransferRole::kSender, initOptions, respondingReceiver,
+                              receiverOpts, transferBlockSize);
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = TransferControlFlags::kSenderDrive;
+    acceptData.MaxBlockSize = transferBlockSize;
+
+    SendAndVerifyAcceptMsg(outEvent, respondingReceiver, TransferRole::kReceiver, acceptData, initiatingSender, initOptions);
+}
+
+// Helper method for preparing a Block and returning the message to send.
+void PrepareAndVerifyBlock(TransferSession & sender, TransferSession::OutputEvent & outEvent, bool isEof)
+{
+    uint8_t fakeData[10] = { 0 };
+
+    TransferSession::BlockData blockData;
+    blockData.Data   = fakeData;
+    blockData.Length = sizeof(fakeData);
+    blockData.IsEof  = isEof;
+
+    EXPECT_TRUE(sender.CanPrepareBlock());
+    EXPECT_EQ(sender.PrepareBlock(blockData), CHIP_NO_ERROR);
+    sender.PollOutput(outEvent, kNoAdvanceTime);
+    VerifyBdxMessageToSend(outEvent, isEof ? MessageType::BlockEOF : MessageType::Block);
+}
+
+// Helper method for passing a Block to a receiver and verifying that it is received with the expected counter.
+void ReceiveAndVerifyBlock(TransferSession & receiver, TransferSession::OutputEvent & blockEvent, uint32_t expectedBlockCounter)
+{
+    TransferSession::OutputEvent outEvent;
+    EXPECT_EQ(AttachHeaderAndSend(blockEvent.msgTypeData, std::move(blockEvent.MsgData), receiver), CHIP_NO_ERROR);
+    receiver.PollOutput(outEvent, kNoAdvanceTime);
+    EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kBlockReceived);
+    EXPECT_EQ(outEvent.blockdata.BlockCounter, expectedBlockCounter);
+    VerifyNoMoreOutput(receiver);
+}
+
+// Test a windowed transfer: several Blocks in flight, the loss of one of them, and the loss of the BlockEOF.
+TEST_F(TestBdxTransferSession, TestWindowedSenderDrive)
+{
+    static_assert(CHIP_CONFIG_BDX_MAX_BLOCK_WINDOW >= 3, "This test loses the second of three Blocks in flight");
+    constexpr uint32_t kWindow = CHIP_CONFIG_BDX_MAX_BLOCK_WINDOW;
+
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingSender;
+    TransferSession respondingReceiver;
+
+    BitFlags<TransferControlFlags> receiverOpts(TransferControlFlags::kSenderDrive, TransferControlFlags::kWindowed);
+    NegotiateSenderDriveTransfer(initiatingSender, respondingReceiver, receiverOpts);
+    EXPECT_TRUE(initiatingSender.IsWindowed());
+    EXPECT_TRUE(respondingReceiver.IsWindowed());
+
+    // Fill the window without waiting for any acknowledgement
+    TransferSession::OutputEvent blocks[kWindow];
+    for (auto & block : blocks)
+    {
+        PrepareAndVerifyBlock(initiatingSender, block, false);
+    }
+    EXPECT_FALSE(initiatingSender.CanPrepareBlock());
+    VerifyNoMoreOutput(initiatingSender);
+
+    // Lose Block 1: the receiver asks for it once, and drops the following Blocks
+    ReceiveAndVerifyBlock(respondingReceiver, blocks[0], 0);
+    EXPECT_EQ(AttachHeaderAndSend(blocks[2].msgTypeData, std::move(blocks[2].MsgData), respondingReceiver), CHIP_NO_ERROR);
+    respondingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+    VerifyBdxMessageToSend(outEvent, MessageType::BlockQuery);
+    VerifyNoMoreOutput(respondingReceiver);
+    for (uint32_t i = 3; i < kWindow; i++)
+    {
+        EXPECT_EQ(AttachHeaderAndSend(blocks[i].msgTypeData, std::move(blocks[i].MsgData), respondingReceiver), CHIP_NO_ERROR);
+        VerifyNoMoreOutput(respondingReceiver);
+    }
+
+    // The sender resends all the Blocks from the missing one, before any new Block
+    EXPECT_EQ(AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), initiatingSender), CHIP_NO_ERROR);
+    EXPECT_FALSE(initiatingSender.CanPrepareBlock());
+    for (uint32_t i = 1; i < kWindow; i++)
+    {
+        initiatingSender.PollOutput(blocks[i], kNoAdvanceTime);
+        VerifyBdxMessageToSend(blocks[i], MessageType::Block);
+    }
+    VerifyNoMoreOutput(initiatingSender);
+    EXPECT_TRUE(initiatingSender.CanPrepareBlock());
+
+    for (uint32_t i = 1; i < kWindow; i++)
+    {
+        ReceiveAndVerifyBlock(respondingReceiver, blocks[i], i);
+    }
+
+    // A single BlockAck acknowledges all of them
+    SendAndVerifyBlockAck(initiatingSender, respondingReceiver, outEvent, false);
+
+    // Lose the BlockEOF: the sender resends it once nothing was received for the retransmit timeout
+    PrepareAndVerifyBlock(initiatingSender, outEvent, true);
+    VerifyNoMoreOutput(initiatingSender);
+    initiatingSender.PollOutput(outEvent, System::Clock::Milliseconds32(CHIP_CONFIG_BDX_BLOCK_RETRANSMIT_TIMEOUT));
+    VerifyBdxMessageToSend(outEvent, MessageType::BlockEOF);
+    ReceiveAndVerifyBlock(respondingReceiver, outEvent, kWindow);
+
+    SendAndVerifyBlockAck(initiatingSender, respondingReceiver, outEvent, true);
+}
+
+// Test that a windowed transfer proposed to a peer that does not support it falls back to one Block at a time.
+TEST_F(TestBdxTransferSession, TestWindowedNotSupportedByPeer)
+{
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingSender;
+    TransferSession respondingReceiver;
+
+    BitFlags<TransferControlFlags> receiverOpts(TransferControlFlags::kSenderDrive);
+    NegotiateSenderDriveTransfer(initiatingSender, respondingReceiver, receiverOpts);
+    EXPECT_FALSE(initiatingSender.IsWindowed());
+    EXPECT_FALSE(respondingReceiver.IsWindowed());
+
+    SendAndVerifyArbitraryBlock(initiatingSender, respondingReceiver, outEvent, false, 0);
+    EXPECT_FALSE(initiatingSender.CanPrepareBlock());
+    SendAndVerifyBlockAck(initiatingSender, respondingReceiver, outEvent, false);
+    EXPECT_TRUE(initiatingSender.CanPrepareBlock());
+}
+
+// Test that Blocks prepared in place in a buffer from AllocateBlockBuffer() are received with the expected counter and data.
+TEST_F(TestBdxTransferSession, TestPrepareBlockInPlace)
+{
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingSender;
+    TransferSession respondingReceiver;
+
+    // Nothing to allocate for until the transfer is negotiated.
+    EXPECT_TRUE(initiatingSender.AllocateBlockBuffer().IsNull());
+
+    BitFlags<TransferControlFlags> receiverOpts(TransferControlFlags::kSenderDrive);
+    NegotiateSenderDriveTransfer(initiatingSender, respondingReceiver, receiverOpts);
+
+    const uint16_t blockSize = initiatingSender.GetTransferBlockSize();
+    for (uint32_t blockNum = 0; blockNum < 2; blockNum++)
+    {
+        const bool isEof                    = (blockNum == 1);
+        const size_t dataLength             = isEof ? blockSize / 2 : blockSize;
+        System::PacketBufferHandle blockBuf = initiatingSender.AllocateBlockBuffer();
+        ASSERT_FALSE(blockBuf.IsNull());
+        ASSERT_GE(blockBuf->AvailableDataLength(), blockSize);
+        memset(blockBuf->Start(), static_cast<int>(0xA0 + blockNum), dataLength);
+        blockBuf->SetDataLength(dataLength);
+
+        EXPECT_EQ(initiatingSender.PrepareBlock(std::move(blockBuf), isEof), CHIP_NO_ERROR);
+        initiatingSender.PollOutput(outEvent, kNoAdvanceTime);
+        VerifyBdxMessageToSend(outEvent, isEof ? MessageType::BlockEOF : MessageType::Block);
+
+        EXPECT_EQ(AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), respondingReceiver), CHIP_NO_ERROR);
+        respondingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+        EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kBlockReceived);
+        EXPECT_EQ(outEvent.blockdata.BlockCounter, blockNum);
+        EXPECT_EQ(outEvent.blockdata.IsEof, isEof);
+        ASSERT_EQ(outEvent.blockdata.Length, dataLength);
+        for (size_t i = 0; i < dataLength; i++)
+        {
+            EXPECT_EQ(outEvent.blockdata.Data[i], 0xA0 + blockNum);
+        }
+
+        SendAndVerifyBlockAck(initiatingSender, respondingReceiver, outEvent, isEof);
+    }
+
+    // A buffer without room in front of its data for the Block counter is rejected.
+    System::PacketBufferHandle noReserve = System::PacketBufferHandle::New(blockSize, 0);
+    ASSERT_FALSE(noReserve.IsNull());
+    EXPECT_EQ(initiatingSender.PrepareBlock(std::move(noReserve), false), CHIP_ERROR_INVALID_ARGUMENT);
+}
+
 // Test that calls to AcceptTransfer() with bad parameters result in an error.
 TEST_F(TestBdxTransferSession, TestBadAcceptMessageFields)
 {
@@ -25,6 +25,8 @@
 #include <tracing/macros.h>
 #include <transport/SessionManager.h>
 
+#include <algorithm>
+
 using namespace ::chip::Inet;
 using namespace ::chip::Transport;
 using namespace ::chip::Credentials;
@@ -47,24 +49,39 @@ CHIP_ERROR CASEServer::ListenForSessionEstablishment(Messaging::ExchangeManager
     mExchangeManager           = exchangeManager;
     mGroupDataProvider         = responderGroupDataProvider;
 
-    // Set up the group state provider that persists across all handshakes.
-    GetSession().SetGroupDataProvider(mGroupDataProvider);
-
     ChipLogProgress(Inet, "CASE Server enabling CASE session setups");
     mExchangeManager->RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1, this);
 
-    PrepareForSessionEstablishment();
+    for (auto & slot : mHandshakes)
+    {
+        slot.mServer = this;
+
+        // Set up the group state provider that persists across all handshakes.
+        slot.mSession.SetGroupDataProvider(mGroupDataProvider);
+
+        PrepareForSessionEstablishment(slot);
+    }
 
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR CASEServer::InitCASEHandshake(Messaging::ExchangeContext * ec)
+size_t CASEServer::GetActiveHandshakeCount() const
+{
+    size_t count = 0;
+    for (const auto & slot : mHandshakes)
+    {
+        count += slot.IsBusy() ? 1 : 0;
+    }
+    return count;
+}
+
+CHIP_ERROR CASEServer::InitCASEHandshake(Messaging::ExchangeContext * ec, HandshakeSlot & slot)
 {
     MATTER_TRACE_SCOPE("InitCASEHandshake", "CASEServer");
     VerifyOrReturnError(ec != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
     // Hand over the exchange context to the CASE session.
-    ec->SetDelegate(&GetSession());
+    ec->SetDelegate(&slot.mSession);
 
     return CHIP_NO_ERROR;
 }
@@ -76,72 +93,118 @@ CHIP_ERROR CASEServer::OnUnsolicitedMessageReceived(const PayloadHeader & payloa
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR CASEServer::OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
-                                         System::PacketBufferHandle && payload)
+CASEServer::HandshakeSlot * CASEServer::AdmitHandshake(const Transport::PeerAddress & peerAddress)
 {
-    MATTER_TRACE_SCOPE("OnMessageReceived", "CASEServer");
+    // Invoke watchdog to fix any stuck handshakes, so that their slots can be reused.
+    for (auto & slot : mHandshakes)
+    {
+        if (slot.IsBusy())
+        {
+            slot.mSession.InvokeBackgroundWorkWatchdog();
+        }
+    }
 
-    bool busy = GetSession().GetState() != CASESession::State::kInitialized;
-    CHIP_FAULT_INJECT(FaultInjection::kFault_CASEServerBusy, busy = true);
-    if (busy)
+    HandshakeSlot * admitted = nullptr;
+    for (auto & slot : mHandshakes)
     {
-        // We are in the middle of CASE handshake
+        if (!slot.IsBusy())
+        {
+            admitted = (admitted == nullptr) ? &slot : admitted;
+            continue;
+        }
 
-        // Invoke watchdog to fix any stuck handshakes
-        bool watchdogFired = GetSession().InvokeBackgroundWorkWatchdog();
-        if (!watchdogFired)
+        // One handshake per peer at a time, so that a peer resending Sigma1 cannot take the slots other peers are
+        // waiting for.
+        if (slot.mPeerAddress == peerAddress)
         {
-            // Handshake wasn't stuck, send the busy status report and let the existing handshake continue.
+            return nullptr;
+        }
+    }
+
+    return admitted;
+}
+
+System::Clock::Milliseconds16 CASEServer::ComputeBusyWaitTime(const Transport::PeerAddress & peerAddress)
+{
+    // A successful CASE handshake can take several seconds and some may time out (30 seconds or more).
 
-            // A successful CASE handshake can take several seconds and some may time out (30 seconds or more).
+    // For now, setting minimum wait time to 5000 milliseconds if we
+    // have no other information.
+    constexpr System::Clock::Milliseconds16 kDefaultWaitTime(5000);
 
-            System::Clock::Milliseconds16 delay = System::Clock::kZero;
-            if (GetSession().GetState() == CASESession::State::kSentSigma2)
+    bool found                          = false;
+    System::Clock::Milliseconds16 delay = System::Clock::Milliseconds16::max();
+    for (auto & slot : mHandshakes)
+    {
+        if (!slot.IsBusy())
+        {
+            continue;
+        }
+
+        System::Clock::Milliseconds16 slotDelay = kDefaultWaitTime;
+        if (slot.mSession.GetState() == CASESession::State::kSentSigma2)
+        {
+            // The delay should be however long we think it will take for
+            // that to time out.
+            auto sigma2Timeout = CASESession::ComputeSigma2ResponseTimeout(slot.mSession.GetRemoteMRPConfig());
+            if (sigma2Timeout < System::Clock::Milliseconds16::max())
             {
-                // The delay should be however long we think it will take for
-                // that to time out.
-                auto sigma2Timeout = CASESession::ComputeSigma2ResponseTimeout(GetSession().GetRemoteMRPConfig());
-                if (sigma2Timeout < System::Clock::Milliseconds16::max())
-                {
-                    delay = std::chrono::duration_cast<System::Clock::Milliseconds16>(sigma2Timeout);
-                }
-                else
-                {
-                    // Avoid overflow issues, just wait for as long as we can to
-                    // get close to our expected Sigma2 timeout.
-                    delay = System::Clock::Milliseconds16::max();
-                }
+                slotDelay = std::chrono::duration_cast<System::Clock::Milliseconds16>(sigma2Timeout);
             }
             else
             {
-                // For now, setting minimum wait time to 5000 milliseconds if we
-                // have no other information.
-                delay = System::Clock::Milliseconds16(5000);
-            }
-            CHIP_ERROR err = SendBusyStatusReport(ec, delay);
-            if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Inet, "Failed to send the busy status report, err:%" CHIP_ERROR_FORMAT, err.Format());
+                // Avoid overflow issues, just wait for as long as we can to
+                // get close to our expected Sigma2 timeout.
+                slotDelay = System::Clock::Milliseconds16::max();
             }
-            return err;
         }
+
+        if (slot.mPeerAddress == peerAddress)
+        {
+            return slotDelay;
+        }
+
+        found = true;
+        delay = std::min(delay, slotDelay);
     }
 
+    return found ? delay : kDefaultWaitTime;
+}
+
+CHIP_ERROR CASEServer::OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                         System::PacketBufferHandle && payload)
+{
+    MATTER_TRACE_SCOPE("OnMessageReceived", "CASEServer");
+
     if (!ec->GetSessionHandle()->IsUnauthenticatedSession())
     {
         ChipLogError(Inet, "CASE Server received Sigma1 message %s EC %p", "over encrypted session. Ignoring.", ec);
         return CHIP_ERROR_INCORRECT_STATE;
     }
 
+    const Transport::PeerAddress peerAddress = ec->GetSessionHandle()->AsUnauthenticatedSession()->GetPeerAddress();
+
+    HandshakeSlot * slot = AdmitHandshake(peerAddress);
+    CHIP_FAULT_INJECT(FaultInjection::kFault_CASEServerBusy, slot = nullptr);
+    if (slot == nullptr)
+    {
+        // All handshakes we can take are in progress, send the busy status report and let them continue.
+        CHIP_ERROR err = SendBusyStatusReport(ec, ComputeBusyWaitTime(peerAddress));
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Inet, "Failed to send the busy status report, err:%" CHIP_ERROR_FORMAT, err.Format());
+        }
+        return err;
+    }
+
     ChipLogProgress(Inet, "CASE Server received Sigma1 message %s EC %p", ". Starting handshake.", ec);
 
-    CHIP_ERROR err = InitCASEHandshake(ec);
-    SuccessOrExit(err);
+    slot->mPeerAddress = peerAddress;
 
-    // TODO - Enable multiple concurrent CASE session establishment
-    // https://github.com/project-chip/connectedhomeip/issues/8342
+    CHIP_ERROR err = InitCASEHandshake(ec, *slot);
+    SuccessOrExit(err);
 
-    err = GetSession().OnMessageReceived(ec, payloadHeader, std::move(payload));
+    err = slot->mSession.OnMessageReceived(ec, payloadHeader, std::move(payload));
     SuccessOrExit(err);
 
 exit:
@@ -150,9 +213,10 @@ exit:
     return err;
 }
 
-void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyEstablishedPeer)
+void CASEServer::PrepareForSessionEstablishment(HandshakeSlot & slot, const ScopedNodeId & previouslyEstablishedPeer)
 {
-    GetSession().Clear();
+    slot.mSession.Clear();
+    slot.mPeerAddress = Transport::PeerAddress::Uninitialized();
 
     //
     // This releases our reference to a previously pinned session. If that was a successfully established session and is now
@@ -163,7 +227,7 @@ void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyE
     // de-allocated since no one else is holding onto this session. This will mean that when we get to allocating a session below,
     // we'll at least have one free session available in the session table, and won't need to evict an arbitrary session.
     //
-    mPinnedSecureSession.ClearValue();
+    slot.mPinnedSecureSession.ClearValue();
 
     //
     // Indicate to the underlying CASE session to prepare for session establishment requests coming its way. This will
@@ -181,9 +245,9 @@ void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyE
     // TODO(#17568): Once session eviction is actually in place, this call should NEVER fail and if so, is a logic bug.
     // Dying here on failure is even more appropriate then.
     //
-    VerifyOrDie(GetSession().PrepareForSessionEstablishment(*mSessionManager, mFabrics, mSessionResumptionStorage,
-                                                            mCertificateValidityPolicy, this, previouslyEstablishedPeer,
-                                                            GetLocalMRPConfig()) == CHIP_NO_ERROR);
+    VerifyOrDie(slot.mSession.PrepareForSessionEstablishment(*mSessionManager, mFabrics, mSessionResumptionStorage,
+                                                             mCertificateValidityPolicy, &slot, previouslyEstablishedPeer,
+                                                             GetLocalMRPConfig()) == CHIP_NO_ERROR);
 
     //
     // PairingSession::mSecureSessionHolder is a weak-reference. If MarkForEviction is called on this session, the session is
@@ -195,36 +259,36 @@ void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyE
     //
     // Let's create a SessionHandle strong-reference to it to keep it resident.
     //
-    mPinnedSecureSession = GetSession().CopySecureSession();
+    slot.mPinnedSecureSession = slot.mSession.CopySecureSession();
 
     //
     // If we've gotten this far, it means we have successfully allocated a SecureSession to back our next attempt. If we haven't,
     // there is a bug somewhere and we should raise attention to it by dying.
     //
-    VerifyOrDie(mPinnedSecureSession.HasValue());
+    VerifyOrDie(slot.mPinnedSecureSession.HasValue());
 }
 
-void CASEServer::OnSessionEstablishmentError(CHIP_ERROR err)
+void CASEServer::HandshakeSlot::OnSessionEstablishmentError(CHIP_ERROR err)
 {
     MATTER_TRACE_SCOPE("OnSessionEstablishmentError", "CASEServer");
     ChipLogError(Inet, "CASE Session establishment failed: %" CHIP_ERROR_FORMAT, err.Format());
 
     MATTER_TRACE_SCOPE("CASEFail", "CASESession");
-    PrepareForSessionEstablishment();
+    mServer->PrepareForSessionEstablishment(*this);
 }
 
-void CASEServer::OnSessionEstablished(const SessionHandle & session)
+void CASEServer::HandshakeSlot::OnSessionEstablished(const SessionHandle & session)
 {
     MATTER_TRACE_SCOPE("OnSessionEstablished", "CASEServer");
     ChipLogProgress(Inet, "CASE Session established to peer: " ChipLogFormatScopedNodeId,
                     ChipLogValueScopedNodeId(session->GetPeer()));
-    PrepareForSessionEstablishment(session->GetPeer());
+    mServer->PrepareForSessionEstablishment(*this, session->GetPeer());
 }
 
 CHIP_ERROR CASEServer::SendBusyStatusReport(Messaging::ExchangeContext * ec, System::Clock::Milliseconds16 minimumWaitTime)
 {
     MATTER_TRACE_SCOPE("SendBusyStatusReport", "CASEServer");
-    ChipLogProgress(Inet, "Already in the middle of CASE handshake, sending busy status report");
+    ChipLogProgress(Inet, "Cannot start another CASE handshake, sending busy status report");
 
     System::PacketBufferHandle handle = Protocols::SecureChannel::StatusReport::MakeBusyStatusReportMessage(minimumWaitTime);
     VerifyOrReturnError(!handle.IsNull(), CHIP_ERROR_NO_MEMORY);
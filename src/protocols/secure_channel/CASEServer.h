@@ -23,21 +23,20 @@
 #include <messaging/ExchangeMgr.h>
 #include <protocols/secure_channel/CASESession.h>
 #include <system/SystemClock.h>
+#include <transport/raw/PeerAddress.h>
 
 namespace chip {
 
-class CASEServer : public SessionEstablishmentDelegate,
-                   public Messaging::UnsolicitedMessageHandler,
-                   public Messaging::ExchangeDelegate
+class CASEServer : public Messaging::UnsolicitedMessageHandler, public Messaging::ExchangeDelegate
 {
 public:
     CASEServer() {}
     ~CASEServer() override { Shutdown(); }
 
     /*
-     * This method will shutdown this object, releasing the strong reference to the pinned SecureSession object.
-     * It will also unregister the unsolicited handler and clear out the session object (which will release the weak
-     * reference through the underlying SessionHolder).
+     * This method will shutdown this object, releasing the strong references to the pinned SecureSession objects.
+     * It will also unregister the unsolicited handler and clear out the session objects (which will release the weak
+     * references through the underlying SessionHolders).
      *
      */
     void Shutdown()
@@ -48,8 +47,11 @@ public:
             mExchangeManager = nullptr;
         }
 
-        GetSession().Clear();
-        mPinnedSecureSession.ClearValue();
+        for (auto & slot : mHandshakes)
+        {
+            slot.mSession.Clear();
+            slot.mPinnedSecureSession.ClearValue();
+        }
     }
 
     CHIP_ERROR ListenForSessionEstablishment(Messaging::ExchangeManager * exchangeManager, SessionManager * sessionManager,
@@ -57,10 +59,6 @@ public:
                                              Credentials::CertificateValidityPolicy * policy,
                                              Credentials::GroupDataProvider * responderGroupDataProvider);
 
-    //////////// SessionEstablishmentDelegate Implementation ///////////////
-    void OnSessionEstablishmentError(CHIP_ERROR error) override;
-    void OnSessionEstablished(const SessionHandle & session) override;
-
     //// UnsolicitedMessageHandler Implementation ////
     CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override;
 
@@ -68,48 +66,83 @@ public:
     CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
                                  System::PacketBufferHandle && payload) override;
     void OnResponseTimeout(Messaging::ExchangeContext * ec) override {}
-    Messaging::ExchangeMessageDispatch & GetMessageDispatch() override { return GetSession().GetMessageDispatch(); }
+    Messaging::ExchangeMessageDispatch & GetMessageDispatch() override { return mHandshakes[0].mSession.GetMessageDispatch(); }
 
-    CASESession & GetSession() { return mPairingSession; }
+    /**
+     * Number of handshakes currently in progress.
+     */
+    size_t GetActiveHandshakeCount() const;
 
 private:
+    //
+    // One responder handshake. The slot is the delegate of its CASESession, which tells the server which
+    // handshake finished.
+    //
+    class HandshakeSlot : public SessionEstablishmentDelegate
+    {
+    public:
+        //////////// SessionEstablishmentDelegate Implementation ///////////////
+        void OnSessionEstablishmentError(CHIP_ERROR error) override;
+        void OnSessionEstablished(const SessionHandle & session) override;
+
+        bool IsBusy() const { return mSession.GetState() != CASESession::State::kInitialized; }
+
+        CASEServer * mServer = nullptr;
+        CASESession mSession;
+
+        //
+        // When we're in the process of establishing a session, this is used
+        // to maintain an additional, strong reference to the underlying SecureSession.
+        // This is because the existing reference in PairingSession is a weak one
+        // (i.e a SessionHolder) and can lose its reference if the session is evicted
+        // for any reason.
+        //
+        // This initially points to a session that is not yet active. Upon activation, it
+        // transfers ownership of the session to the SecureSessionManager and this reference
+        // is released before simultaneously acquiring ownership of a new SecureSession.
+        //
+        Optional<SessionHandle> mPinnedSecureSession;
+
+        // Where the Sigma1 of the handshake in progress came from.
+        Transport::PeerAddress mPeerAddress;
+    };
+
     Messaging::ExchangeManager * mExchangeManager                       = nullptr;
     SessionResumptionStorage * mSessionResumptionStorage                = nullptr;
     Credentials::CertificateValidityPolicy * mCertificateValidityPolicy = nullptr;
 
-    //
-    // When we're in the process of establishing a session, this is used
-    // to maintain an additional, strong reference to the underlying SecureSession.
-    // This is because the existing reference in PairingSession is a weak one
-    // (i.e a SessionHolder) and can lose its reference if the session is evicted
-    // for any reason.
-    //
-    // This initially points to a session that is not yet active. Upon activation, it
-    // transfers ownership of the session to the SecureSessionManager and this reference
-    // is released before simultaneously acquiring ownership of a new SecureSession.
-    //
-    Optional<SessionHandle> mPinnedSecureSession;
-
-    CASESession mPairingSession;
+    HandshakeSlot mHandshakes[CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES];
     SessionManager * mSessionManager = nullptr;
 
     FabricTable * mFabrics                              = nullptr;
     Credentials::GroupDataProvider * mGroupDataProvider = nullptr;
 
-    CHIP_ERROR InitCASEHandshake(Messaging::ExchangeContext * ec);
+    CHIP_ERROR InitCASEHandshake(Messaging::ExchangeContext * ec, HandshakeSlot & slot);
+
+    /*
+     * Pick the slot for a handshake requested by peerAddress, or nullptr if the peer has to wait:
+     * either because it already has a handshake in progress, or because all slots are busy.
+     */
+    HandshakeSlot * AdmitHandshake(const Transport::PeerAddress & peerAddress);
+
+    /*
+     * How long peerAddress should wait before sending Sigma1 again: until its own handshake is done if it
+     * has one, otherwise until the first slot is expected to free up.
+     */
+    System::Clock::Milliseconds16 ComputeBusyWaitTime(const Transport::PeerAddress & peerAddress);
 
     /*
      * This will clean up any state from a previous session establishment
-     * attempt (if any) and setup the machinery to listen for and handle
+     * attempt (if any) in the slot and setup the machinery to listen for and handle
      * any session handshakes there-after.
      *
      * If a session had previously been established successfully, previouslyEstablishedPeer
      * should be set to the scoped node-id of the peer associated with that session.
      *
      */
-    void PrepareForSessionEstablishment(const ScopedNodeId & previouslyEstablishedPeer = ScopedNodeId());
+    void PrepareForSessionEstablishment(HandshakeSlot & slot, const ScopedNodeId & previouslyEstablishedPeer = ScopedNodeId());
 
-    // If we are in the middle of handshake and receive a Sigma1 then respond with Busy status code.
+    // If all handshake slots are in use and we receive a Sigma1 then respond with Busy status code.
     // @param[in] ec              Exchange Context
     // @param[in] minimumWaitTime Minimum wait time reported to client before it can attempt to resend sigma1
     //
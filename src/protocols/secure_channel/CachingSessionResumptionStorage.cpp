@@ -0,0 +1,270 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <protocols/secure_channel/CachingSessionResumptionStorage.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+
+namespace chip {
+
+void CachingSessionResumptionStorage::Entry::Clear()
+{
+    mNode = ScopedNodeId();
+    mResumptionId.fill(0);
+    mSharedSecret = Crypto::P256ECDHDerivedSecret();
+    mPeerCATs     = kUndefinedCATs;
+    mLastUsed     = 0;
+    mDirty        = false;
+}
+
+CHIP_ERROR CachingSessionResumptionStorage::Init(SessionResumptionStorage * backingStorage, System::Layer * systemLayer,
+                                                 System::Clock::Timeout writeBehindDelay)
+{
+    VerifyOrReturnError(backingStorage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mBackingStorage == nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    mBackingStorage   = backingStorage;
+    mSystemLayer      = systemLayer;
+    mWriteBehindDelay = writeBehindDelay;
+    return CHIP_NO_ERROR;
+}
+
+void CachingSessionResumptionStorage::Shutdown()
+{
+    VerifyOrReturn(mBackingStorage != nullptr);
+
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(OnWriteBehindTimer, this);
+    }
+
+    CHIP_ERROR err = Flush();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SecureChannel, "Unable to flush session resumption cache on shutdown: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    for (auto & entry : mEntries)
+    {
+        entry.Clear();
+    }
+    mBackingStorage = nullptr;
+    mSystemLayer    = nullptr;
+}
+
+CHIP_ERROR CachingSessionResumptionStorage::Flush()
+{
+    VerifyOrReturnError(mBackingStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_ERROR stickyErr = CHIP_NO_ERROR;
+    for (auto & entry : mEntries)
+    {
+        if (entry.IsUsed() && entry.mDirty)
+        {
+            CHIP_ERROR err = WriteBack(entry);
+            stickyErr      = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
+        }
+    }
+    return stickyErr;
+}
+
+CHIP_ERROR CachingSessionResumptionStorage::FindByScopedNodeId(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
+                                                               Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)
+{
+    VerifyOrReturnError(mBackingStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    Entry * entry = FindEntry(node);
+    if (entry == nullptr)
+    {
+        ReturnErrorOnFailure(mBackingStorage->FindByScopedNodeId(node, resumptionId, sharedSecret, peerCATs));
+        entry = AllocateEntry();
+        VerifyOrReturnError(entry != nullptr, CHIP_NO_ERROR);
+        Store(*entry, node, resumptionId, sharedSecret, peerCATs, /* dirty = */ false);
+        return CHIP_NO_ERROR;
+    }
+
+    Touch(*entry);
+    resumptionId = entry->mResumptionId;
+    sharedSecret = entry->mSharedSecret;
+    peerCATs     = entry->mPeerCATs;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CachingSessionResumptionStorage::FindByResumptionId(ConstResumptionIdView resumptionId, ScopedNodeId & node,
+                                                               Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)
+{
+    VerifyOrReturnError(mBackingStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    Entry * entry = FindEntry(resumptionId);
+    if (entry == nullptr)
+    {
+        ReturnErrorOnFailure(mBackingStorage->FindByResumptionId(resumptionId, node, sharedSecret, peerCATs));
+        // The cached entry for this node carries a newer resumption ID than the backing storage.
+        VerifyOrReturnError(FindEntry(node) == nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+        entry = AllocateEntry();
+        VerifyOrReturnError(entry != nullptr, CHIP_NO_ERROR);
+        Store(*entry, node, resumptionId, sharedSecret, peerCATs, /* dirty = */ false);
+        return CHIP_NO_ERROR;
+    }
+
+    Touch(*entry);
+    node         = entry->mNode;
+    sharedSecret = entry->mSharedSecret;
+    peerCATs     = entry->mPeerCATs;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CachingSessionResumptionStorage::Save(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                                                 const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs)
+{
+    VerifyOrReturnError(mBackingStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    Entry * entry = FindEntry(node);
+    if (entry == nullptr)
+    {
+        entry = AllocateEntry();
+    }
+    if (entry == nullptr)
+    {
+        // Nothing could be evicted; write through.
+        return mBackingStorage->Save(node, resumptionId, sharedSecret, peerCATs);
+    }
+
+    Store(*entry, node, resumptionId, sharedSecret, peerCATs, /* dirty = */ true);
+    ScheduleFlush();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CachingSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
+{
+    VerifyOrReturnError(mBackingStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    for (auto & entry : mEntries)
+    {
+        if (entry.IsUsed() && entry.mNode.GetFabricIndex() == fabricIndex)
+        {
+            entry.Clear();
+        }
+    }
+    return mBackingStorage->DeleteAll(fabricIndex);
+}
+
+CachingSessionResumptionStorage::Entry * CachingSessionResumptionStorage::FindEntry(const ScopedNodeId & node)
+{
+    for (auto & entry : mEntries)
+    {
+        if (entry.IsUsed() && entry.mNode == node)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+CachingSessionResumptionStorage::Entry * CachingSessionResumptionStorage::FindEntry(ConstResumptionIdView resumptionId)
+{
+    for (auto & entry : mEntries)
+    {
+        if (entry.IsUsed() &&
+            std::equal(entry.mResumptionId.begin(), entry.mResumptionId.end(), resumptionId.begin(), resumptionId.end()))
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+CachingSessionResumptionStorage::Entry * CachingSessionResumptionStorage::AllocateEntry()
+{
+    Entry * victim = nullptr;
+    for (auto & entry : mEntries)
+    {
+        if (!entry.IsUsed())
+        {
+            return &entry;
+        }
+        if (victim == nullptr || entry.mLastUsed < victim->mLastUsed)
+        {
+            victim = &entry;
+        }
+    }
+
+    VerifyOrReturnValue(victim != nullptr, nullptr);
+    if (victim->mDirty)
+    {
+        // Resumption is best effort: if the write-back fails the record is lost and the peer falls back to a full CASE handshake.
+        CHIP_ERROR err = WriteBack(*victim);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(SecureChannel,
+                         "Unable to write back evicted session resumption record for node " ChipLogFormatX64
+                         ": %" CHIP_ERROR_FORMAT,
+                         ChipLogValueX64(victim->mNode.GetNodeId()), err.Format());
+        }
+    }
+    victim->Clear();
+    return victim;
+}
+
+void CachingSessionResumptionStorage::Store(Entry & entry, const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                                            const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs,
+                                            bool dirty)
+{
+    entry.mNode = node;
+    std::copy(resumptionId.begin(), resumptionId.end(), entry.mResumptionId.begin());
+    entry.mSharedSecret = sharedSecret;
+    entry.mPeerCATs     = peerCATs;
+    entry.mDirty        = entry.mDirty || dirty;
+    Touch(entry);
+}
+
+CHIP_ERROR CachingSessionResumptionStorage::WriteBack(Entry & entry)
+{
+    ReturnErrorOnFailure(mBackingStorage->Save(entry.mNode, ConstResumptionIdView(entry.mResumptionId), entry.mSharedSecret,
+                                               entry.mPeerCATs));
+    entry.mDirty = false;
+    return CHIP_NO_ERROR;
+}
+
+void CachingSessionResumptionStorage::ScheduleFlush()
+{
+    VerifyOrReturn(mSystemLayer != nullptr);
+    VerifyOrReturn(!mSystemLayer->IsTimerActive(OnWriteBehindTimer, this));
+
+    CHIP_ERROR err = mSystemLayer->StartTimer(mWriteBehindDelay, OnWriteBehindTimer, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        // Without a timer, write through instead of leaving the record in RAM indefinitely.
+        ChipLogError(SecureChannel, "Unable to schedule session resumption write-behind: %" CHIP_ERROR_FORMAT, err.Format());
+        OnWriteBehindTimer(mSystemLayer, this);
+    }
+}
+
+void CachingSessionResumptionStorage::OnWriteBehindTimer(System::Layer *, void * context)
+{
+    auto * self    = static_cast<CachingSessionResumptionStorage *>(context);
+    CHIP_ERROR err = self->Flush();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SecureChannel, "Unable to flush session resumption cache: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+} // namespace chip
@@ -0,0 +1,111 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <protocols/secure_channel/SessionResumptionStorage.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+namespace chip {
+
+/**
+ * @brief A RAM-resident LRU cache in front of another SessionResumptionStorage.
+ *
+ *   Lookups are answered from memory when possible; misses are forwarded to
+ *   the backing storage and the result is kept.  Saves only update memory and
+ *   mark the entry dirty.  Dirty entries are written to the backing storage
+ *   when they are evicted, when Flush() is called, on Shutdown(), and, if a
+ *   system layer was given to Init(), after the write-behind delay has
+ *   elapsed since the first unflushed Save.
+ *
+ *   A resumption record that is lost because of a power failure before it was
+ *   flushed only costs the peer a full CASE handshake on its next connection.
+ *
+ *   While an entry for a node is cached, the cache is authoritative for that
+ *   node: stale records left in the backing storage under a previous
+ *   resumption ID are not returned.
+ */
+class CachingSessionResumptionStorage : public SessionResumptionStorage
+{
+public:
+    static constexpr System::Clock::Timeout kDefaultWriteBehindDelay = System::Clock::Seconds16(5);
+
+    // The backing storage must outlive this object, since destruction flushes dirty entries to it.
+    ~CachingSessionResumptionStorage() override { Shutdown(); }
+
+    /**
+     * @param backingStorage the storage to read misses from and to flush dirty entries to
+     * @param systemLayer if not null, used to schedule write-behind flushes
+     * @param writeBehindDelay delay between the first unflushed Save and the scheduled flush
+     */
+    CHIP_ERROR Init(SessionResumptionStorage * backingStorage, System::Layer * systemLayer = nullptr,
+                    System::Clock::Timeout writeBehindDelay = kDefaultWriteBehindDelay);
+
+    /**
+     * Flush all dirty entries, cancel any pending flush and drop the cache.
+     */
+    void Shutdown();
+
+    /**
+     * Write every dirty entry to the backing storage.  Entries that fail to be
+     * written stay dirty; the first error is returned.
+     */
+    CHIP_ERROR Flush();
+
+    CHIP_ERROR FindByScopedNodeId(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
+                                  Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs) override;
+    CHIP_ERROR FindByResumptionId(ConstResumptionIdView resumptionId, ScopedNodeId & node,
+                                  Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs) override;
+    CHIP_ERROR Save(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                    const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs) override;
+    CHIP_ERROR DeleteAll(FabricIndex fabricIndex) override;
+
+private:
+    struct Entry
+    {
+        ScopedNodeId mNode;
+        ResumptionIdStorage mResumptionId;
+        Crypto::P256ECDHDerivedSecret mSharedSecret;
+        CATValues mPeerCATs;
+        uint32_t mLastUsed = 0;
+        bool mDirty        = false;
+
+        bool IsUsed() const { return mNode.GetFabricIndex() != kUndefinedFabricIndex; }
+        void Clear();
+    };
+
+    Entry * FindEntry(const ScopedNodeId & node);
+    Entry * FindEntry(ConstResumptionIdView resumptionId);
+    Entry * AllocateEntry();
+    void Store(Entry & entry, const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+               const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs, bool dirty);
+    void Touch(Entry & entry) { entry.mLastUsed = ++mUseCounter; }
+    CHIP_ERROR WriteBack(Entry & entry);
+    void ScheduleFlush();
+
+    static void OnWriteBehindTimer(System::Layer * systemLayer, void * context);
+
+    SessionResumptionStorage * mBackingStorage = nullptr;
+    System::Layer * mSystemLayer               = nullptr;
+    System::Clock::Timeout mWriteBehindDelay   = kDefaultWriteBehindDelay;
+    uint32_t mUseCounter                       = 0;
+    Entry mEntries[CHIP_CONFIG_CASE_SESSION_RESUMPTION_RAM_CACHE_SIZE];
+};
+
+} // namespace chip
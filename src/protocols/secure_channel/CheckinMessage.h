@@ -102,7 +102,6 @@ public:
     static constexpr uint16_t kMinPayloadSize =
         Crypto::CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES + sizeof(CounterType) + Crypto::CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES;
 
-private:
     /**
      * @brief Generate the Nonce for the Check-In message
      *
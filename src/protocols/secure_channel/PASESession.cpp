@@ -131,14 +131,19 @@ CHIP_ERROR PASESession::Init(SessionManager & sessionManager, uint32_t setupCode
 }
 
 CHIP_ERROR PASESession::GeneratePASEVerifier(Spake2pVerifier & verifier, uint32_t pbkdf2IterCount, const ByteSpan & salt,
-                                             bool useRandomPIN, uint32_t & setupPINCode)
+                                             bool useRandomPIN, uint32_t & setupPINCode, PASEVerifierCache * verifierCache)
 {
     MATTER_TRACE_SCOPE("GeneratePASEVerifier", "PASESession");
 
     if (useRandomPIN)
     {
+        // A fresh PIN cannot have been cached, and will not be asked for again.
         ReturnErrorOnFailure(SetupPayload::generateRandomSetupPin(setupPINCode));
     }
+    else if (verifierCache != nullptr)
+    {
+        return verifierCache->GetOrGenerate(pbkdf2IterCount, salt, setupPINCode, verifier);
+    }
 
     return verifier.Generate(pbkdf2IterCount, salt, setupPINCode);
 }
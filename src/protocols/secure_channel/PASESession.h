@@ -35,6 +35,7 @@
 #include <messaging/ExchangeDelegate.h>
 #include <messaging/ExchangeMessageDispatch.h>
 #include <protocols/secure_channel/Constants.h>
+#include <protocols/secure_channel/PASEVerifierCache.h>
 #include <protocols/secure_channel/PairingSession.h>
 #include <protocols/secure_channel/SessionEstablishmentExchangeDispatch.h>
 #include <system/SystemPacketBuffer.h>
@@ -119,11 +120,13 @@ public:
      * @param salt            Salt to be used for SPAKE2P operation
      * @param useRandomPIN    Generate a random setup PIN, if true. Else, use the provided PIN
      * @param setupPIN        Provided setup PIN (if useRandomPIN is false), or the generated PIN
+     * @param verifierCache   If not null, used to reuse a verifier previously generated for the same
+     *                        provided PIN, salt and iteration count instead of rerunning PBKDF2
      *
      * @return CHIP_ERROR      The result of PASE verifier generation
      */
     static CHIP_ERROR GeneratePASEVerifier(Crypto::Spake2pVerifier & verifier, uint32_t pbkdf2IterCount, const ByteSpan & salt,
-                                           bool useRandomPIN, uint32_t & setupPIN);
+                                           bool useRandomPIN, uint32_t & setupPIN, PASEVerifierCache * verifierCache = nullptr);
 
     /**
      * @brief
@@ -0,0 +1,227 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <protocols/secure_channel/PASEVerifierCache.h>
+
+#include <lib/core/CHIPSafeCasts.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <string.h>
+
+namespace chip {
+
+using namespace Crypto;
+
+namespace {
+constexpr char kPasscodeTagContext[] = "CHIP PASE Verifier Cache";
+} // namespace
+
+constexpr TLV::Tag PASEVerifierCache::kIterationCountTag;
+constexpr TLV::Tag PASEVerifierCache::kSaltTag;
+constexpr TLV::Tag PASEVerifierCache::kPasscodeTagTag;
+constexpr TLV::Tag PASEVerifierCache::kVerifierTag;
+
+CHIP_ERROR PASEVerifierCache::Init(PersistentStorageDelegate * storage)
+{
+    VerifyOrReturnError(storage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    mStorage  = storage;
+    mNextSlot = 0;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PASEVerifierCache::ComputePasscodeTag(uint32_t pbkdf2IterCount, const ByteSpan & salt, uint32_t setupPINCode,
+                                                 uint8_t (&tag)[kPasscodeTagLength])
+{
+    uint8_t parameters[2 * sizeof(uint32_t)];
+    Encoding::LittleEndian::BufferWriter writer(parameters, sizeof(parameters));
+    writer.Put32(pbkdf2IterCount).Put32(setupPINCode);
+    VerifyOrReturnError(writer.Fit(), CHIP_ERROR_INTERNAL);
+
+    uint8_t digest[kSHA256_Hash_Length];
+    MutableByteSpan digestSpan(digest);
+
+    Hash_SHA256_stream hash;
+    ReturnErrorOnFailure(hash.Begin());
+    ReturnErrorOnFailure(hash.AddData(ByteSpan(Uint8::from_const_char(kPasscodeTagContext), strlen(kPasscodeTagContext))));
+    ReturnErrorOnFailure(hash.AddData(salt));
+    ReturnErrorOnFailure(hash.AddData(ByteSpan(parameters)));
+    ReturnErrorOnFailure(hash.Finish(digestSpan));
+
+    memcpy(tag, digest, sizeof(tag));
+    ClearSecretData(digest);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PASEVerifierCache::LoadEntry(size_t index, Entry & entry)
+{
+    uint8_t buf[kMaxEntrySize];
+    uint16_t len = static_cast<uint16_t>(sizeof(buf));
+    ReturnErrorOnFailure(mStorage->SyncGetKeyValue(DefaultStorageKeyAllocator::PASEVerifierCacheEntry(index).KeyName(), buf, len));
+
+    TLV::ContiguousBufferTLVReader reader;
+    reader.Init(buf, len);
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()));
+    TLV::TLVType containerType;
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+
+    ReturnErrorOnFailure(reader.Next(kIterationCountTag));
+    ReturnErrorOnFailure(reader.Get(entry.iterationCount));
+
+    ByteSpan salt;
+    ReturnErrorOnFailure(reader.Next(kSaltTag));
+    ReturnErrorOnFailure(reader.Get(salt));
+    VerifyOrReturnError(salt.size() <= sizeof(entry.saltBuffer), CHIP_ERROR_INVALID_TLV_ELEMENT);
+    memcpy(entry.saltBuffer, salt.data(), salt.size());
+    entry.saltLength = salt.size();
+
+    ByteSpan passcodeTag;
+    ReturnErrorOnFailure(reader.Next(kPasscodeTagTag));
+    ReturnErrorOnFailure(reader.Get(passcodeTag));
+    VerifyOrReturnError(passcodeTag.size() == sizeof(entry.passcodeTag), CHIP_ERROR_INVALID_TLV_ELEMENT);
+    memcpy(entry.passcodeTag, passcodeTag.data(), passcodeTag.size());
+
+    ByteSpan verifier;
+    ReturnErrorOnFailure(reader.Next(kVerifierTag));
+    ReturnErrorOnFailure(reader.Get(verifier));
+    VerifyOrReturnError(verifier.size() == sizeof(entry.verifier), CHIP_ERROR_INVALID_TLV_ELEMENT);
+    memcpy(entry.verifier, verifier.data(), verifier.size());
+
+    ReturnErrorOnFailure(reader.ExitContainer(containerType));
+    return reader.VerifyEndOfContainer();
+}
+
+CHIP_ERROR PASEVerifierCache::SaveEntry(size_t index, const Entry & entry)
+{
+    uint8_t buf[kMaxEntrySize];
+    TLV::TLVWriter writer;
+    writer.Init(buf);
+
+    TLV::TLVType containerType;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, containerType));
+    ReturnErrorOnFailure(writer.Put(kIterationCountTag, entry.iterationCount));
+    ReturnErrorOnFailure(writer.Put(kSaltTag, ByteSpan(entry.saltBuffer, entry.saltLength)));
+    ReturnErrorOnFailure(writer.Put(kPasscodeTagTag, ByteSpan(entry.passcodeTag)));
+    ReturnErrorOnFailure(writer.Put(kVerifierTag, ByteSpan(entry.verifier)));
+    ReturnErrorOnFailure(writer.EndContainer(containerType));
+
+    const auto len = writer.GetLengthWritten();
+    VerifyOrReturnError(CanCastTo<uint16_t>(len), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    return mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::PASEVerifierCacheEntry(index).KeyName(), buf,
+                                     static_cast<uint16_t>(len));
+}
+
+CHIP_ERROR PASEVerifierCache::Find(uint32_t pbkdf2IterCount, const ByteSpan & salt, uint32_t setupPINCode,
+                                   Spake2pVerifier & verifier)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    uint8_t passcodeTag[kPasscodeTagLength];
+    ReturnErrorOnFailure(ComputePasscodeTag(pbkdf2IterCount, salt, setupPINCode, passcodeTag));
+
+    for (size_t i = 0; i < kMaxEntries; i++)
+    {
+        Entry entry;
+        if (LoadEntry(i, entry) != CHIP_NO_ERROR || !entry.Matches(pbkdf2IterCount, salt))
+        {
+            continue;
+        }
+
+        // Salts are random, so at most one entry matches; a different passcode is a miss.
+        VerifyOrReturnError(memcmp(entry.passcodeTag, passcodeTag, sizeof(passcodeTag)) == 0, CHIP_ERROR_NOT_FOUND);
+        return verifier.Deserialize(ByteSpan(entry.verifier));
+    }
+
+    return CHIP_ERROR_NOT_FOUND;
+}
+
+CHIP_ERROR PASEVerifierCache::Store(uint32_t pbkdf2IterCount, const ByteSpan & salt, uint32_t setupPINCode,
+                                    const Spake2pVerifier & verifier)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(salt.size() <= kSpake2p_Max_PBKDF_Salt_Length, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Entry entry;
+    entry.iterationCount = pbkdf2IterCount;
+    memcpy(entry.saltBuffer, salt.data(), salt.size());
+    entry.saltLength = salt.size();
+    ReturnErrorOnFailure(ComputePasscodeTag(pbkdf2IterCount, salt, setupPINCode, entry.passcodeTag));
+    MutableByteSpan verifierSpan(entry.verifier);
+    ReturnErrorOnFailure(verifier.Serialize(verifierSpan));
+
+    size_t freeSlot = kMaxEntries;
+    for (size_t i = 0; i < kMaxEntries; i++)
+    {
+        Entry existing;
+        CHIP_ERROR err = LoadEntry(i, existing);
+        if (err == CHIP_NO_ERROR && existing.Matches(pbkdf2IterCount, salt))
+        {
+            return SaveEntry(i, entry);
+        }
+        if (err != CHIP_NO_ERROR && freeSlot == kMaxEntries)
+        {
+            freeSlot = i;
+        }
+    }
+
+    if (freeSlot == kMaxEntries)
+    {
+        freeSlot  = mNextSlot;
+        mNextSlot = (mNextSlot + 1) % kMaxEntries;
+    }
+    return SaveEntry(freeSlot, entry);
+}
+
+CHIP_ERROR PASEVerifierCache::GetOrGenerate(uint32_t pbkdf2IterCount, const ByteSpan & salt, uint32_t setupPINCode,
+                                            Spake2pVerifier & verifier)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_ERROR err = Find(pbkdf2IterCount, salt, setupPINCode, verifier);
+    VerifyOrReturnError(err != CHIP_NO_ERROR, CHIP_NO_ERROR);
+
+    ReturnErrorOnFailure(verifier.Generate(pbkdf2IterCount, salt, setupPINCode));
+
+    // Failing to cache the verifier only costs the next caller a PBKDF2 run.
+    err = Store(pbkdf2IterCount, salt, setupPINCode, verifier);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SecureChannel, "Failed to cache PASE verifier: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PASEVerifierCache::Clear()
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    for (size_t i = 0; i < kMaxEntries; i++)
+    {
+        CHIP_ERROR err = mStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::PASEVerifierCacheEntry(i).KeyName());
+        VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND, err);
+    }
+    mNextSlot = 0;
+    return CHIP_NO_ERROR;
+}
+
+} // namespace chip
@@ -0,0 +1,108 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/core/TLV.h>
+#include <lib/support/Span.h>
+
+namespace chip {
+
+/**
+ * @brief A small persisted cache of PASE verifiers, keyed by PBKDF2 salt and iteration count.
+ *
+ *   Generating a verifier runs PBKDF2 with the configured iteration count,
+ *   which takes hundreds of milliseconds on constrained SoCs.  Reopening a
+ *   commissioning window with the same passcode, salt and iteration count can
+ *   reuse the verifier stored here instead.
+ *
+ *   Each entry also records a tag derived from the passcode, so that a lookup
+ *   with a different passcode misses.  The tag is a plain hash and the stored
+ *   verifier already allows an offline passcode search, so the storage must be
+ *   protected like the rest of the device's secrets.
+ */
+class PASEVerifierCache
+{
+public:
+    static constexpr size_t kPasscodeTagLength = 16;
+    static constexpr size_t kMaxEntries        = CHIP_CONFIG_PASE_VERIFIER_CACHE_SIZE;
+
+    CHIP_ERROR Init(PersistentStorageDelegate * storage);
+
+    /**
+     * Find the verifier for the given passcode, salt and iteration count.
+     *
+     * @return CHIP_ERROR_NOT_FOUND if no entry matches.
+     */
+    CHIP_ERROR Find(uint32_t pbkdf2IterCount, const ByteSpan & salt, uint32_t setupPINCode, Crypto::Spake2pVerifier & verifier);
+
+    /**
+     * Store a verifier.  An existing entry for the same salt and iteration count is
+     * replaced; otherwise a free slot is used, or the slots are reused in turn.
+     */
+    CHIP_ERROR Store(uint32_t pbkdf2IterCount, const ByteSpan & salt, uint32_t setupPINCode,
+                     const Crypto::Spake2pVerifier & verifier);
+
+    /**
+     * Find the verifier, or generate it with PBKDF2 and store it.
+     */
+    CHIP_ERROR GetOrGenerate(uint32_t pbkdf2IterCount, const ByteSpan & salt, uint32_t setupPINCode,
+                             Crypto::Spake2pVerifier & verifier);
+
+    /**
+     * Remove all entries.
+     */
+    CHIP_ERROR Clear();
+
+private:
+    static constexpr TLV::Tag kIterationCountTag = TLV::ContextTag(1);
+    static constexpr TLV::Tag kSaltTag           = TLV::ContextTag(2);
+    static constexpr TLV::Tag kPasscodeTagTag    = TLV::ContextTag(3);
+    static constexpr TLV::Tag kVerifierTag       = TLV::ContextTag(4);
+
+    static constexpr size_t kMaxEntrySize =
+        TLV::EstimateStructOverhead(sizeof(uint32_t), Crypto::kSpake2p_Max_PBKDF_Salt_Length, kPasscodeTagLength,
+                                    Crypto::kSpake2p_VerifierSerialized_Length);
+
+    struct Entry
+    {
+        uint32_t iterationCount;
+        uint8_t saltBuffer[Crypto::kSpake2p_Max_PBKDF_Salt_Length];
+        size_t saltLength;
+        uint8_t passcodeTag[kPasscodeTagLength];
+        Crypto::Spake2pVerifierSerialized verifier;
+
+        bool Matches(uint32_t pbkdf2IterCount, const ByteSpan & salt) const
+        {
+            return iterationCount == pbkdf2IterCount && ByteSpan(saltBuffer, saltLength).data_equal(salt);
+        }
+    };
+
+    static CHIP_ERROR ComputePasscodeTag(uint32_t pbkdf2IterCount, const ByteSpan & salt, uint32_t setupPINCode,
+                                         uint8_t (&tag)[kPasscodeTagLength]);
+
+    CHIP_ERROR LoadEntry(size_t index, Entry & entry);
+    CHIP_ERROR SaveEntry(size_t index, const Entry & entry);
+
+    PersistentStorageDelegate * mStorage = nullptr;
+    size_t mNextSlot                     = 0;
+};
+
+} // namespace chip
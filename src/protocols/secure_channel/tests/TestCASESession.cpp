@@ -21,6 +21,7 @@
  *      This file implements unit tests for the CASESession implementation.
  */
 
+#include <algorithm>
 #include <stdarg.h>
 
 #include <pw_unit_test/framework.h>
@@ -158,6 +159,8 @@ public:
         mNumPairingComplete++;
     }
 
+    void OnResponderBusy(System::Clock::Milliseconds16 requestedDelay) override { mBusyDelay = requestedDelay; }
+
     SessionHolder & GetSessionHolder() { return mSession; }
 
     SessionHolder mSession;
@@ -166,6 +169,8 @@ public:
     uint32_t mNumPairingErrors   = 0;
     uint32_t mNumPairingComplete = 0;
     uint32_t mNumBusyResponses   = 0;
+
+    System::Clock::Milliseconds16 mBusyDelay = System::Clock::Milliseconds16(0);
 };
 
 class TestOperationalKeystore : public chip::Crypto::OperationalKeystore
@@ -545,6 +550,9 @@ TEST_F(TestCASESession, SecurePairingHandshakeServerTest)
 
     EXPECT_EQ(holder->GetPeer(), (chip::ScopedNodeId{ Node01_01, gCommissionerFabricIndex }));
 
+    // The responder slot is ready for the next handshake.
+    EXPECT_EQ(gPairingServer.GetActiveHandshakeCount(), 0u);
+
     auto * pairingCommissioner1 = chip::Platform::New<CASESession>();
     pairingCommissioner1->SetGroupDataProvider(&gCommissionerGroupDataProvider);
     ExchangeContext * contextCommissioner1 = NewUnauthenticatedExchangeToBob(pairingCommissioner1);
@@ -593,10 +601,9 @@ TEST_F(TestCASESession, ClientReceivesBusyTest)
 
     ServiceEvents();
 
-    // We should have one full handshake and one Sigma1 + Busy + ack.  If that
-    // ever changes (e.g. because our server starts supporting multiple parallel
-    // handshakes), this test needs to be fixed so that the server is still
-    // responding BUSY to the client.
+    // We should have one full handshake and one Sigma1 + Busy + ack.  Both
+    // clients come from the same peer address, and the server only runs one
+    // handshake per peer at a time, however many it can run in parallel.
     EXPECT_EQ(loopback.mSentMessageCount, sTestCaseMessageCount + 3);
     EXPECT_EQ(delegateCommissioner1.mNumPairingComplete, 1u);
     EXPECT_EQ(delegateCommissioner2.mNumPairingComplete, 0u);
@@ -610,6 +617,82 @@ TEST_F(TestCASESession, ClientReceivesBusyTest)
     gPairingServer.Shutdown();
 }
 
+#if CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES > 1
+TEST_F(TestCASESession, ConcurrentHandshakesTest)
+{
+    constexpr size_t kMaxHandshakes = CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES;
+
+    // Initiators send their Sigma1 in index order, each from an address of its own, except for
+    // kSamePeer which comes from the address of the first one.  All the others but the last one,
+    // kAllSlotsTaken, fit in the handshake slots.
+    constexpr size_t kSamePeer      = 1;
+    constexpr size_t kAllSlotsTaken = kMaxHandshakes + 1;
+    constexpr size_t kInitiators    = kMaxHandshakes + 2;
+
+    auto isAdmitted = [](size_t i) { return i != kSamePeer && i != kAllSlotsTaken; };
+
+    TemporarySessionManager sessionManager(*this);
+    TestCASESecurePairingDelegate delegates[kInitiators];
+    CASESession initiators[kInitiators];
+
+    EXPECT_EQ(gPairingServer.ListenForSessionEstablishment(&GetExchangeManager(), &GetSecureSessionManager(), &gDeviceFabrics,
+                                                           nullptr, nullptr, &gDeviceGroupDataProvider),
+              CHIP_NO_ERROR);
+
+    for (size_t i = 0; i < kInitiators; i++)
+    {
+        // The loopback transport delivers a message as coming from the port next to the one it was sent to.
+        Transport::PeerAddress address = GetBobAddress();
+        address.SetPort(static_cast<uint16_t>(address.GetPort() + 2 * (i == kSamePeer ? 0 : i)));
+
+        auto session =
+            GetSecureSessionManager().CreateUnauthenticatedSession(address, GetLocalMRPConfig().ValueOr(GetDefaultMRPConfig()));
+        ASSERT_TRUE(session.HasValue());
+        ExchangeContext * context = GetExchangeManager().NewContext(session.Value(), &initiators[i]);
+
+        initiators[i].SetGroupDataProvider(&gCommissionerGroupDataProvider);
+        EXPECT_EQ(initiators[i].EstablishSession(sessionManager, &gCommissionerFabrics,
+                                                 ScopedNodeId{ Node01_01, gCommissionerFabricIndex }, context, nullptr, nullptr,
+                                                 &delegates[i], NullOptional),
+                  CHIP_NO_ERROR);
+    }
+
+    // Deliver the Sigma1 messages, which the responder answers right away, but leave the handling
+    // of the Sigma3 messages, which runs as background work, for later.
+    DrainAndServiceIO();
+
+    EXPECT_EQ(gPairingServer.GetActiveHandshakeCount(), kMaxHandshakes);
+
+    // A second Sigma1 from a peer with a handshake in progress is answered with busy, even though
+    // a slot is still free, and so is a Sigma1 from a new peer once all slots are taken.  Both are
+    // asked to wait for as long as a Sigma2 that was just sent can take to time out.
+    const System::Clock::Milliseconds16 expectedBusyDelay =
+        std::chrono::duration_cast<System::Clock::Milliseconds16>(std::min<System::Clock::Timeout>(
+            CASESession::ComputeSigma2ResponseTimeout(GetDefaultMRPConfig()), System::Clock::Milliseconds16::max()));
+    for (size_t i = 0; i < kInitiators; i++)
+    {
+        EXPECT_EQ(delegates[i].mNumBusyResponses, isAdmitted(i) ? 0u : 1u);
+        EXPECT_EQ(delegates[i].mNumPairingErrors, isAdmitted(i) ? 0u : 1u);
+        if (!isAdmitted(i))
+        {
+            EXPECT_EQ(delegates[i].mBusyDelay, expectedBusyDelay);
+        }
+    }
+
+    ServiceEvents();
+
+    // The admitted handshakes complete, and free their slots.
+    for (size_t i = 0; i < kInitiators; i++)
+    {
+        EXPECT_EQ(delegates[i].mNumPairingComplete, isAdmitted(i) ? 1u : 0u);
+        EXPECT_EQ(delegates[i].mNumPairingErrors, isAdmitted(i) ? 0u : 1u);
+    }
+    EXPECT_EQ(gPairingServer.GetActiveHandshakeCount(), 0u);
+
+    gPairingServer.Shutdown();
+}
+#endif // CHIP_CONFIG_CASE_SERVER_MAX_HANDSHAKES > 1
+
 struct Sigma1Params
 {
     // Purposefully not using constants like kSigmaParamRandomNumberSize that
@@ -0,0 +1,158 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <protocols/secure_channel/CachingSessionResumptionStorage.h>
+#include <protocols/secure_channel/SimpleSessionResumptionStorage.h>
+
+namespace {
+
+using namespace chip;
+
+struct ResumptionRecord
+{
+    SessionResumptionStorage::ResumptionIdStorage resumptionId;
+    Crypto::P256ECDHDerivedSecret sharedSecret;
+    ScopedNodeId node;
+    CATValues cats = kUndefinedCATs;
+};
+
+void MakeRecord(ResumptionRecord & record, uint8_t seed, FabricIndex fabricIndex)
+{
+    record.resumptionId.fill(seed);
+    record.sharedSecret.SetLength(record.sharedSecret.Capacity());
+    memset(record.sharedSecret.Bytes(), seed, record.sharedSecret.Length());
+    record.node           = ScopedNodeId(static_cast<NodeId>(seed + 1), fabricIndex);
+    record.cats.values[0] = static_cast<CASEAuthTag>(seed);
+}
+
+void ExpectFound(SessionResumptionStorage & storage, const ResumptionRecord & record)
+{
+    SessionResumptionStorage::ResumptionIdStorage resumptionId;
+    Crypto::P256ECDHDerivedSecret sharedSecret;
+    ScopedNodeId node;
+    CATValues cats;
+
+    EXPECT_EQ(storage.FindByScopedNodeId(record.node, resumptionId, sharedSecret, cats), CHIP_NO_ERROR);
+    EXPECT_EQ(resumptionId, record.resumptionId);
+    EXPECT_EQ(cats, record.cats);
+    ASSERT_EQ(sharedSecret.Length(), record.sharedSecret.Length());
+    EXPECT_EQ(memcmp(sharedSecret.ConstBytes(), record.sharedSecret.ConstBytes(), sharedSecret.Length()), 0);
+
+    EXPECT_EQ(storage.FindByResumptionId(record.resumptionId, node, sharedSecret, cats), CHIP_NO_ERROR);
+    EXPECT_EQ(node, record.node);
+    EXPECT_EQ(cats, record.cats);
+}
+
+TEST(TestCachingSessionResumptionStorage, TestWriteBehind)
+{
+    TestPersistentStorageDelegate persistentStorage;
+    SimpleSessionResumptionStorage backingStorage;
+    CachingSessionResumptionStorage cache;
+    EXPECT_EQ(backingStorage.Init(&persistentStorage), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Init(&backingStorage), CHIP_NO_ERROR);
+
+    ResumptionRecord record;
+    MakeRecord(record, 1, 1);
+
+    // Saving only touches RAM.
+    EXPECT_EQ(cache.Save(record.node, record.resumptionId, record.sharedSecret, record.cats), CHIP_NO_ERROR);
+    EXPECT_EQ(persistentStorage.GetNumKeys(), 0u);
+    ExpectFound(cache, record);
+
+    // Flushing writes the record to the backing storage.
+    EXPECT_EQ(cache.Flush(), CHIP_NO_ERROR);
+    EXPECT_NE(persistentStorage.GetNumKeys(), 0u);
+    ExpectFound(backingStorage, record);
+
+    // A second cache over the same backing storage reads the record back on a miss.
+    CachingSessionResumptionStorage otherCache;
+    EXPECT_EQ(otherCache.Init(&backingStorage), CHIP_NO_ERROR);
+    ExpectFound(otherCache, record);
+}
+
+TEST(TestCachingSessionResumptionStorage, TestStaleResumptionId)
+{
+    TestPersistentStorageDelegate persistentStorage;
+    SimpleSessionResumptionStorage backingStorage;
+    CachingSessionResumptionStorage cache;
+    EXPECT_EQ(backingStorage.Init(&persistentStorage), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Init(&backingStorage), CHIP_NO_ERROR);
+
+    ResumptionRecord oldRecord;
+    MakeRecord(oldRecord, 1, 1);
+    EXPECT_EQ(backingStorage.Save(oldRecord.node, oldRecord.resumptionId, oldRecord.sharedSecret, oldRecord.cats),
+              CHIP_NO_ERROR);
+
+    // Resume with a new resumption ID for the same node without flushing.
+    ResumptionRecord newRecord;
+    MakeRecord(newRecord, 2, 1);
+    newRecord.node = oldRecord.node;
+    EXPECT_EQ(cache.Save(newRecord.node, newRecord.resumptionId, newRecord.sharedSecret, newRecord.cats), CHIP_NO_ERROR);
+
+    // The old resumption ID must not resolve through the backing storage anymore.
+    ScopedNodeId node;
+    Crypto::P256ECDHDerivedSecret sharedSecret;
+    CATValues cats;
+    EXPECT_EQ(cache.FindByResumptionId(oldRecord.resumptionId, node, sharedSecret, cats), CHIP_ERROR_KEY_NOT_FOUND);
+    ExpectFound(cache, newRecord);
+}
+
+TEST(TestCachingSessionResumptionStorage, TestEvictionAndDeleteAll)
+{
+    TestPersistentStorageDelegate persistentStorage;
+    SimpleSessionResumptionStorage backingStorage;
+    CachingSessionResumptionStorage cache;
+    EXPECT_EQ(backingStorage.Init(&persistentStorage), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Init(&backingStorage), CHIP_NO_ERROR);
+
+    // One record more than the cache holds; the least recently used one is written back when evicted.
+    ResumptionRecord records[CHIP_CONFIG_CASE_SESSION_RESUMPTION_RAM_CACHE_SIZE + 1];
+    for (size_t i = 0; i < ArraySize(records); ++i)
+    {
+        MakeRecord(records[i], static_cast<uint8_t>(i + 1), static_cast<FabricIndex>(i % 2 + 1));
+        EXPECT_EQ(cache.Save(records[i].node, records[i].resumptionId, records[i].sharedSecret, records[i].cats),
+                  CHIP_NO_ERROR);
+    }
+    ExpectFound(backingStorage, records[0]);
+    for (auto & record : records)
+    {
+        ExpectFound(cache, record);
+    }
+
+    // Deleting a fabric drops both cached and stored records for it.
+    EXPECT_EQ(cache.DeleteAll(1), CHIP_NO_ERROR);
+    for (auto & record : records)
+    {
+        SessionResumptionStorage::ResumptionIdStorage resumptionId;
+        Crypto::P256ECDHDerivedSecret sharedSecret;
+        CATValues cats;
+        if (record.node.GetFabricIndex() == 1)
+        {
+            EXPECT_NE(cache.FindByScopedNodeId(record.node, resumptionId, sharedSecret, cats), CHIP_NO_ERROR);
+        }
+        else
+        {
+            ExpectFound(cache, record);
+        }
+    }
+}
+
+} // namespace
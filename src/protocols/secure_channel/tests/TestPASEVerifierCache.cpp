@@ -0,0 +1,115 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <protocols/secure_channel/PASEVerifierCache.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Crypto;
+
+constexpr uint32_t kIterations = kSpake2p_Min_PBKDF_Iterations;
+constexpr uint32_t kSetupPIN   = 20202021;
+
+void MakeSalt(uint8_t (&salt)[kSpake2p_Min_PBKDF_Salt_Length], uint8_t seed)
+{
+    memset(salt, seed, sizeof(salt));
+}
+
+bool VerifiersEqual(const Spake2pVerifier & a, const Spake2pVerifier & b)
+{
+    return memcmp(a.mW0, b.mW0, sizeof(a.mW0)) == 0 && memcmp(a.mL, b.mL, sizeof(a.mL)) == 0;
+}
+
+TEST(TestPASEVerifierCache, TestGetOrGenerate)
+{
+    TestPersistentStorageDelegate storage;
+    PASEVerifierCache cache;
+    ASSERT_EQ(cache.Init(&storage), CHIP_NO_ERROR);
+
+    uint8_t salt[kSpake2p_Min_PBKDF_Salt_Length];
+    MakeSalt(salt, 1);
+
+    Spake2pVerifier verifier;
+    EXPECT_EQ(cache.Find(kIterations, ByteSpan(salt), kSetupPIN, verifier), CHIP_ERROR_NOT_FOUND);
+
+    Spake2pVerifier expected;
+    ASSERT_EQ(expected.Generate(kIterations, ByteSpan(salt), kSetupPIN), CHIP_NO_ERROR);
+
+    ASSERT_EQ(cache.GetOrGenerate(kIterations, ByteSpan(salt), kSetupPIN, verifier), CHIP_NO_ERROR);
+    EXPECT_TRUE(VerifiersEqual(verifier, expected));
+    EXPECT_EQ(storage.GetNumKeys(), 1u);
+
+    // A second cache over the same storage finds the persisted entry.
+    PASEVerifierCache reloaded;
+    ASSERT_EQ(reloaded.Init(&storage), CHIP_NO_ERROR);
+    Spake2pVerifier found;
+    ASSERT_EQ(reloaded.Find(kIterations, ByteSpan(salt), kSetupPIN, found), CHIP_NO_ERROR);
+    EXPECT_TRUE(VerifiersEqual(found, expected));
+
+    // Any change to the passcode, salt or iteration count misses.
+    EXPECT_EQ(reloaded.Find(kIterations, ByteSpan(salt), kSetupPIN + 1, found), CHIP_ERROR_NOT_FOUND);
+    EXPECT_EQ(reloaded.Find(kIterations + 1, ByteSpan(salt), kSetupPIN, found), CHIP_ERROR_NOT_FOUND);
+    MakeSalt(salt, 2);
+    EXPECT_EQ(reloaded.Find(kIterations, ByteSpan(salt), kSetupPIN, found), CHIP_ERROR_NOT_FOUND);
+
+    EXPECT_EQ(reloaded.Clear(), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.GetNumKeys(), 0u);
+}
+
+TEST(TestPASEVerifierCache, TestReplacement)
+{
+    TestPersistentStorageDelegate storage;
+    PASEVerifierCache cache;
+    ASSERT_EQ(cache.Init(&storage), CHIP_NO_ERROR);
+
+    // The verifier contents do not matter to the cache.
+    Spake2pVerifier verifier;
+    memset(verifier.mW0, 0x11, sizeof(verifier.mW0));
+    memset(verifier.mL, 0x22, sizeof(verifier.mL));
+
+    uint8_t salt[kSpake2p_Min_PBKDF_Salt_Length];
+    Spake2pVerifier found;
+
+    // A new passcode for the same salt replaces the entry.
+    MakeSalt(salt, 1);
+    EXPECT_EQ(cache.Store(kIterations, ByteSpan(salt), kSetupPIN, verifier), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Store(kIterations, ByteSpan(salt), kSetupPIN + 1, verifier), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.GetNumKeys(), 1u);
+    EXPECT_EQ(cache.Find(kIterations, ByteSpan(salt), kSetupPIN, found), CHIP_ERROR_NOT_FOUND);
+    EXPECT_EQ(cache.Find(kIterations, ByteSpan(salt), kSetupPIN + 1, found), CHIP_NO_ERROR);
+
+    // Once all slots are used, the slots are reused in turn.
+    for (uint8_t i = 2; i <= PASEVerifierCache::kMaxEntries + 1; i++)
+    {
+        MakeSalt(salt, i);
+        EXPECT_EQ(cache.Store(kIterations, ByteSpan(salt), kSetupPIN, verifier), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(storage.GetNumKeys(), PASEVerifierCache::kMaxEntries);
+
+    MakeSalt(salt, 1);
+    EXPECT_EQ(cache.Find(kIterations, ByteSpan(salt), kSetupPIN + 1, found), CHIP_ERROR_NOT_FOUND);
+    MakeSalt(salt, static_cast<uint8_t>(PASEVerifierCache::kMaxEntries + 1));
+    EXPECT_EQ(cache.Find(kIterations, ByteSpan(salt), kSetupPIN, found), CHIP_NO_ERROR);
+    EXPECT_TRUE(VerifiersEqual(found, verifier));
+}
+
+} // namespace
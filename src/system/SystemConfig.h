@@ -273,6 +273,17 @@
 #define CHIP_SYSTEM_CONFIG_POOL_USE_HEAP 0
 #endif /* CHIP_SYSTEM_CONFIG_POOL_USE_HEAP */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_POOL_SLAB_SIZE
+ *
+ *  @brief
+ *      Size in bytes of the slabs of the pools that use ObjectPoolMem::kSlab (with
+ *      CHIP_SYSTEM_CONFIG_POOL_USE_HEAP). A slab holds at least one and at most 64 objects.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_POOL_SLAB_SIZE
+#define CHIP_SYSTEM_CONFIG_POOL_SLAB_SIZE 4096
+#endif /* CHIP_SYSTEM_CONFIG_POOL_SLAB_SIZE */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_NO_LOCKING
  *
@@ -375,6 +386,58 @@
 #define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE 15
 #endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE
+ *
+ *  @brief
+ *      This is the number of small packet buffers, of CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY bytes each, kept
+ *      in addition to the CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE full-size buffers of the BSD sockets configuration.
+ *
+ *      Allocations that fit are served from the smallest size class with a free buffer, so short messages such as
+ *      standalone acknowledgements and status reports do not hold a full-size buffer. Zero (0) disables the class.
+ *      Only applies when CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE is not zero.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY
+ *
+ *  @brief
+ *      The size, including the protocol header reserve, of small packet buffers.
+ *      See CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY 128
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE
+ *
+ *  @brief
+ *      This is the number of medium packet buffers, of CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_CAPACITY bytes each.
+ *      See CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_CAPACITY
+ *
+ *  @brief
+ *      The size, including the protocol header reserve, of medium packet buffers.
+ *      See CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_CAPACITY
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_CAPACITY 512
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_CAPACITY */
+
+#if CHIP_SYSTEM_CONFIG_USE_LWIP && (CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE || CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE)
+#error "Packet buffer size classes are not available on LwIP-based platforms; configure LwIP pbuf pools instead."
+#endif
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_LWIP_PBUF_RAM
  *
@@ -512,6 +575,87 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_NUM_TIMERS 32
 #endif /* CHIP_SYSTEM_CONFIG_NUM_TIMERS */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+ *
+ *  @brief
+ *      Use a hierarchical timing wheel (chip::System::TimerWheel) instead of a sorted list (chip::System::TimerList)
+ *      to hold the pending timers of the select() and epoll() based System::Layer implementations.
+ *
+ *  Starting and cancelling a timer is O(n) in the number of pending timers with the sorted list, and O(1) on average
+ *  with the timing wheel, at the cost of a few kilobytes of fixed RAM. This is worthwhile for systems that keep
+ *  hundreds or thousands of timers pending, such as bridges.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+#define CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL 0
+#endif /* CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS
+ *
+ *  @brief
+ *      Number of buckets of the hash index used by chip::System::TimerWheel to find timers by callback and
+ *      application state. Must be a power of two.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS
+#define CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS 128
+#endif /* CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS
+ *
+ *  @brief
+ *      This is the maximum number of ready events retrieved by a single epoll_wait() call in the epoll-based
+ *      System::Layer implementation. Any further ready sockets are reported on the next event loop iteration.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS
+#define CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS 32
+#endif /* CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_NUM_COROUTINE_FRAMES
+ *
+ *  @brief
+ *      Number of fixed-size frames in the pool that chip::System::Task coroutines are allocated from. Coroutines
+ *      whose frame does not fit, or that start while the pool is exhausted, fall back to chip::Platform::MemoryAlloc.
+ *      Only used when building with C++20 coroutine support.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_NUM_COROUTINE_FRAMES
+#define CHIP_SYSTEM_CONFIG_NUM_COROUTINE_FRAMES 8
+#endif /* CHIP_SYSTEM_CONFIG_NUM_COROUTINE_FRAMES */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_COROUTINE_FRAME_SIZE
+ *
+ *  @brief
+ *      Size in bytes of each frame of the chip::System::Task coroutine frame pool.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_COROUTINE_FRAME_SIZE
+#define CHIP_SYSTEM_CONFIG_COROUTINE_FRAME_SIZE 512
+#endif /* CHIP_SYSTEM_CONFIG_COROUTINE_FRAME_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_SLOW_CALLBACK_THRESHOLD_MS
+ *
+ *  @brief
+ *      Timer, socket and device event callbacks dispatched by the event loop that run for longer than this many
+ *      milliseconds are logged, reported as a metric event, and kept in Stats::GetSlowCallbacks().
+ *      Set to 0 to disable timing callbacks.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_SLOW_CALLBACK_THRESHOLD_MS
+#define CHIP_SYSTEM_CONFIG_SLOW_CALLBACK_THRESHOLD_MS 0
+#endif /* CHIP_SYSTEM_CONFIG_SLOW_CALLBACK_THRESHOLD_MS */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_NUM_SLOW_CALLBACKS
+ *
+ *  @brief
+ *      Number of the slowest callbacks kept by Stats::GetSlowCallbacks().
+ */
+#ifndef CHIP_SYSTEM_CONFIG_NUM_SLOW_CALLBACKS
+#define CHIP_SYSTEM_CONFIG_NUM_SLOW_CALLBACKS 4
+#endif /* CHIP_SYSTEM_CONFIG_NUM_SLOW_CALLBACKS */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
  *
@@ -0,0 +1,103 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  This file implements the frame pool of the chip::System::Task coroutine type.
+ */
+
+#include <system/SystemCoroutine.h>
+
+#if CHIP_SYSTEM_HAS_COROUTINES
+
+#include <lib/support/CHIPMem.h>
+
+namespace chip {
+namespace System {
+
+namespace {
+
+union CoroutineFrame
+{
+    CoroutineFrame * mNext;
+    alignas(std::max_align_t) uint8_t mBytes[CHIP_SYSTEM_CONFIG_COROUTINE_FRAME_SIZE];
+};
+
+CoroutineFrame sFrames[CHIP_SYSTEM_CONFIG_NUM_COROUTINE_FRAMES];
+CoroutineFrame * sFreeFrames = nullptr;
+size_t sFramesNeverAllocated = CHIP_SYSTEM_CONFIG_NUM_COROUTINE_FRAMES;
+
+bool IsPooledFrame(const void * frame)
+{
+    const auto * p = static_cast<const CoroutineFrame *>(frame);
+    return p >= &sFrames[0] && p < &sFrames[CHIP_SYSTEM_CONFIG_NUM_COROUTINE_FRAMES];
+}
+
+} // anonymous namespace
+
+size_t CoroutineFramePool::sInUse           = 0;
+size_t CoroutineFramePool::sHighWaterMark   = 0;
+size_t CoroutineFramePool::sHeapAllocations = 0;
+
+void * CoroutineFramePool::Allocate(size_t size)
+{
+    CoroutineFrame * frame = nullptr;
+
+    if (size <= sizeof(CoroutineFrame))
+    {
+        if (sFreeFrames != nullptr)
+        {
+            frame       = sFreeFrames;
+            sFreeFrames = frame->mNext;
+        }
+        else if (sFramesNeverAllocated > 0)
+        {
+            // Hand out untouched frames first, so that the pool needs no initialization.
+            frame = &sFrames[CHIP_SYSTEM_CONFIG_NUM_COROUTINE_FRAMES - sFramesNeverAllocated--];
+        }
+    }
+
+    if (frame == nullptr)
+    {
+        sHeapAllocations++;
+        return Platform::MemoryAlloc(size);
+    }
+
+    if (++sInUse > sHighWaterMark)
+    {
+        sHighWaterMark = sInUse;
+    }
+    return frame;
+}
+
+void CoroutineFramePool::Release(void * frame)
+{
+    if (!IsPooledFrame(frame))
+    {
+        Platform::MemoryFree(frame);
+        return;
+    }
+
+    auto * pooled = static_cast<CoroutineFrame *>(frame);
+    pooled->mNext = sFreeFrames;
+    sFreeFrames   = pooled;
+    sInUse--;
+}
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_HAS_COROUTINES
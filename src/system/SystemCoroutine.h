@@ -0,0 +1,271 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  This file defines an optional C++20 coroutine layer on top of chip::System::Layer:
+ *
+ *   - chip::System::Task, the return type of a coroutine that produces a CHIP_ERROR, and
+ *   - chip::System::Sleep(), an awaitable that suspends a Task for a given time.
+ *
+ *  For example:
+ *
+ *      System::Task Blink(System::Layer & layer)
+ *      {
+ *          for (int i = 0; i < 3; i++)
+ *          {
+ *              Toggle();
+ *              CoReturnErrorOnFailure(co_await System::Sleep(layer, System::Clock::Milliseconds32(500)));
+ *          }
+ *          co_return CHIP_NO_ERROR;
+ *      }
+ *
+ *  Task frames are allocated from a fixed pool of CHIP_SYSTEM_CONFIG_NUM_COROUTINE_FRAMES frames (see
+ *  CoroutineFramePool), so that the allocation cost of coroutine-based code can be observed in one place.
+ *
+ *  Everything here is only available when the translation unit is compiled with coroutine support (C++20);
+ *  CHIP_SYSTEM_HAS_COROUTINES tells whether it is. Tasks must be started and resumed with the CHIP stack lock held;
+ *  the awaitables here resume them from System::Layer callbacks, which satisfies that.
+ */
+
+#pragma once
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && __has_include(<coroutine>)
+#define CHIP_SYSTEM_HAS_COROUTINES 1
+#else
+#define CHIP_SYSTEM_HAS_COROUTINES 0
+#endif
+
+#if CHIP_SYSTEM_HAS_COROUTINES
+
+// Include configuration headers
+#include <system/SystemConfig.h>
+
+// Include dependent headers
+#include <lib/core/CHIPError.h>
+#include <lib/support/CodeUtils.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+#include <coroutine>
+#include <cstddef>
+
+/**
+ *  @def CoReturnErrorOnFailure(expr)
+ *
+ *  @brief
+ *    The coroutine counterpart of ReturnErrorOnFailure(): co_returns the error code if the expression returns an error.
+ *
+ *  Example usage:
+ *
+ *  @code
+ *    CoReturnErrorOnFailure(co_await System::Sleep(layer, delay));
+ *  @endcode
+ *
+ *  @param[in]  expr        An expression to be tested.
+ */
+#define CoReturnErrorOnFailure(expr)                                                                                               \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        auto __err = (expr);                                                                                                       \
+        if (!::chip::ChipError::IsSuccess(__err))                                                                                  \
+        {                                                                                                                          \
+            co_return __err;                                                                                                       \
+        }                                                                                                                          \
+    } while (false)
+
+namespace chip {
+namespace System {
+
+/**
+ * The allocator for Task coroutine frames.
+ *
+ * Frames of up to CHIP_SYSTEM_CONFIG_COROUTINE_FRAME_SIZE bytes come from a fixed pool; larger frames, and frames
+ * requested while the pool is exhausted, come from chip::Platform::MemoryAlloc and are counted as heap allocations.
+ */
+class CoroutineFramePool
+{
+public:
+    static void * Allocate(size_t size);
+    static void Release(void * frame);
+
+    /// Number of pooled frames currently in use.
+    static size_t InUse() { return sInUse; }
+    /// Largest number of pooled frames that have been in use at once.
+    static size_t HighWaterMark() { return sHighWaterMark; }
+    /// Number of frames that had to be allocated from the heap.
+    static size_t HeapAllocations() { return sHeapAllocations; }
+
+private:
+    static size_t sInUse;
+    static size_t sHighWaterMark;
+    static size_t sHeapAllocations;
+};
+
+/**
+ * The return type of a coroutine that eventually produces a CHIP_ERROR.
+ *
+ * A Task starts running as soon as it is called, up to its first suspension point. Another Task can then
+ * `co_await` it to suspend until it completes and obtain its result. A Task that is not awaited keeps running
+ * after its Task object is destroyed, and frees itself when it completes.
+ *
+ * If no frame can be allocated, the coroutine does not run at all and awaiting the Task yields CHIP_ERROR_NO_MEMORY.
+ */
+class [[nodiscard]] Task
+{
+public:
+    class promise_type
+    {
+    public:
+        Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        static Task get_return_object_on_allocation_failure() { return Task(nullptr); }
+
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        auto final_suspend() noexcept { return FinalAwaiter{}; }
+
+        void return_value(CHIP_ERROR result) { mResult = result; }
+        void unhandled_exception() { chipDie(); }
+
+        static void * operator new(size_t size) noexcept { return CoroutineFramePool::Allocate(size); }
+        static void operator delete(void * frame) { CoroutineFramePool::Release(frame); }
+
+    private:
+        friend class Task;
+
+        struct FinalAwaiter
+        {
+            bool await_ready() noexcept { return false; }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept
+            {
+                promise_type & promise = handle.promise();
+                promise.mDone          = true;
+                if (promise.mContinuation)
+                {
+                    return promise.mContinuation;
+                }
+                if (promise.mDetached)
+                {
+                    handle.destroy();
+                }
+                return std::noop_coroutine();
+            }
+            void await_resume() noexcept {}
+        };
+
+        CHIP_ERROR mResult = CHIP_NO_ERROR;
+        std::coroutine_handle<> mContinuation;
+        bool mDone     = false;
+        bool mDetached = false;
+    };
+
+    Task(Task && other) : mHandle(other.mHandle) { other.mHandle = nullptr; }
+    Task & operator=(Task && other)
+    {
+        if (this != &other)
+        {
+            Reset();
+            mHandle       = other.mHandle;
+            other.mHandle = nullptr;
+        }
+        return *this;
+    }
+    ~Task() { Reset(); }
+
+    /// Whether the coroutine has run to completion (or never started for lack of memory).
+    bool IsDone() const { return !mHandle || mHandle.promise().mDone; }
+
+    /// The result of a completed Task.
+    CHIP_ERROR Result() const { return mHandle ? mHandle.promise().mResult : CHIP_ERROR_NO_MEMORY; }
+
+    auto operator co_await() &&
+    {
+        struct Awaiter
+        {
+            std::coroutine_handle<promise_type> mHandle;
+
+            bool await_ready() const { return !mHandle || mHandle.promise().mDone; }
+            void await_suspend(std::coroutine_handle<> continuation) { mHandle.promise().mContinuation = continuation; }
+            CHIP_ERROR await_resume() const { return mHandle ? mHandle.promise().mResult : CHIP_ERROR_NO_MEMORY; }
+        };
+        return Awaiter{ mHandle };
+    }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> handle) : mHandle(handle) {}
+
+    void Reset()
+    {
+        if (mHandle)
+        {
+            if (mHandle.promise().mDone)
+            {
+                mHandle.destroy();
+            }
+            else
+            {
+                mHandle.promise().mDetached = true;
+            }
+            mHandle = nullptr;
+        }
+    }
+
+    Task(const Task &)             = delete;
+    Task & operator=(const Task &) = delete;
+
+    std::coroutine_handle<promise_type> mHandle;
+};
+
+/**
+ * Awaitable returned by Sleep().
+ */
+class SleepAwaitable
+{
+public:
+    SleepAwaitable(Layer & layer, Clock::Timeout delay) : mLayer(layer), mDelay(delay) {}
+    ~SleepAwaitable() { mLayer.CancelTimer(HandleTimer, this); }
+
+    bool await_ready() const { return false; }
+    bool await_suspend(std::coroutine_handle<> handle)
+    {
+        mHandle = handle;
+        mError  = mLayer.StartTimer(mDelay, HandleTimer, this);
+        return mError == CHIP_NO_ERROR;
+    }
+    CHIP_ERROR await_resume() const { return mError; }
+
+private:
+    static void HandleTimer(Layer *, void * aAppState) { static_cast<SleepAwaitable *>(aAppState)->mHandle.resume(); }
+
+    Layer & mLayer;
+    Clock::Timeout mDelay;
+    std::coroutine_handle<> mHandle;
+    CHIP_ERROR mError = CHIP_NO_ERROR;
+};
+
+/**
+ * Suspend the calling coroutine for (at least) @p delay, using a System::Layer timer.
+ *
+ * `co_await Sleep(...)` yields CHIP_NO_ERROR after the delay, or, without suspending, the error from StartTimer().
+ */
+inline SleepAwaitable Sleep(Layer & layer, Clock::Timeout delay)
+{
+    return SleepAwaitable(layer, delay);
+}
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_HAS_COROUTINES
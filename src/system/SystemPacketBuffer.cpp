@@ -68,6 +68,60 @@ namespace System {
 
 PacketBuffer::BufferPoolElement PacketBuffer::sBufferPool[CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE];
 
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE > 0
+static_assert(CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY < PacketBuffer::kMaxSizeWithoutReserve,
+              "CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY must be less than the full packet buffer size");
+PacketBuffer::SizedPoolElement<CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY>
+    PacketBuffer::sSmallBufferPool[CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE];
+#endif
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE > 0
+static_assert(CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_CAPACITY < PacketBuffer::kMaxSizeWithoutReserve,
+              "CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_CAPACITY must be less than the full packet buffer size");
+PacketBuffer::SizedPoolElement<CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_CAPACITY>
+    PacketBuffer::sMediumBufferPool[CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE];
+#endif
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE > 0 && CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE > 0
+static_assert(CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY < CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_CAPACITY,
+              "CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY must be less than CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_CAPACITY");
+#endif
+
+PacketBuffer * PacketBuffer::sSizeClassFreeList[PacketBuffer::kSizeClassFull];
+
+namespace {
+
+template <typename Element, size_t N>
+pbuf * BuildSizeClassFreeList(Element (&aPool)[N], uint8_t aSizeClass)
+{
+    pbuf * lHead = nullptr;
+
+    for (Element & element : aPool)
+    {
+        pbuf * lCursor      = &element.Header;
+        lCursor->next       = lHead;
+        lCursor->ref        = 0;
+        lCursor->size_class = aSizeClass;
+        lHead               = lCursor;
+    }
+
+    return lHead;
+}
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+// Statistics entries of the size classes below kSizeClassFull, in the same order.
+constexpr int kSizeClassStats[] = {
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE > 0
+    Stats::kSystemLayer_NumSmallPacketBufs,
+#endif
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE > 0
+    Stats::kSystemLayer_NumMediumPacketBufs,
+#endif
+};
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+
+} // namespace
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+
 PacketBuffer * PacketBuffer::sFreeList = PacketBuffer::BuildFreeList();
 
 #if !CHIP_SYSTEM_CONFIG_NO_LOCKING
@@ -94,9 +148,19 @@ PacketBuffer * PacketBuffer::BuildFreeList()
         pbuf * lCursor = &sBufferPool[i].Header;
         lCursor->next  = lHead;
         lCursor->ref   = 0;
-        lHead          = lCursor;
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+        lCursor->size_class = kSizeClassFull;
+#endif
+        lHead = lCursor;
     }
 
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE > 0
+    sSizeClassFreeList[kSizeClassSmall] = static_cast<PacketBuffer *>(BuildSizeClassFreeList(sSmallBufferPool, kSizeClassSmall));
+#endif
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE > 0
+    sSizeClassFreeList[kSizeClassMedium] = static_cast<PacketBuffer *>(BuildSizeClassFreeList(sMediumBufferPool, kSizeClassMedium));
+#endif
+
 #if !CHIP_SYSTEM_CONFIG_NO_LOCKING
     Mutex::Init(sBufferPoolMutex);
 #endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
@@ -508,6 +572,68 @@ void PacketBuffer::AddRef()
 #endif // !CHIP_SYSTEM_CONFIG_USE_LWIP
 }
 
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+
+PacketBuffer * PacketBuffer::AllocateFromPool(size_t aAllocSize, uint8_t aSizeClassLimit)
+{
+    PacketBuffer * lPacket = nullptr;
+
+    LOCK_BUF_POOL();
+
+    for (uint8_t sizeClass = 0; sizeClass < aSizeClassLimit; sizeClass++)
+    {
+        PacketBuffer *& freeList = FreeList(sizeClass);
+        if (freeList != nullptr && (sizeClass == kSizeClassFull || aAllocSize <= kSizeClassCapacity[sizeClass]))
+        {
+            lPacket  = freeList;
+            freeList = lPacket->ChainedBuffer();
+            if (sizeClass != kSizeClassFull)
+            {
+                SYSTEM_STATS_INCREMENT(kSizeClassStats[sizeClass]);
+            }
+            break;
+        }
+    }
+
+    UNLOCK_BUF_POOL();
+
+    return lPacket;
+}
+
+void PacketBufferHandle::InternalRightSize()
+{
+    // Require a single buffer with no other references.
+    if ((mBuffer == nullptr) || mBuffer->HasChainedBuffer() || (mBuffer->ref != 1))
+    {
+        return;
+    }
+
+    // Move the contents to a buffer of a smaller size class, if one fits and is available.
+    const uint8_t * const start   = mBuffer->ReserveStart();
+    const uint8_t * const payload = mBuffer->Start();
+    const size_t usedSize         = static_cast<size_t>(payload - start + static_cast<ptrdiff_t>(mBuffer->len));
+    PacketBuffer * newBuffer      = PacketBuffer::AllocateFromPool(usedSize, mBuffer->size_class);
+    if (newBuffer == nullptr)
+    {
+        return;
+    }
+
+    SYSTEM_STATS_INCREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
+
+    uint8_t * const newStart = newBuffer->ReserveStart();
+    newBuffer->next          = nullptr;
+    newBuffer->payload       = newStart + (payload - start);
+    newBuffer->tot_len       = mBuffer->tot_len;
+    newBuffer->len           = mBuffer->len;
+    newBuffer->ref           = 1;
+    memcpy(newStart, start, usedSize);
+
+    PacketBuffer::Free(mBuffer);
+    mBuffer = newBuffer;
+}
+
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+
 PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aReservedSize)
 {
     // Sanity check for kStructureSize to ensure that it matches the PacketBuffer size.
@@ -604,16 +730,19 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
         Mutex::Init(sBufferPoolMutex);
     }
 #endif
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+    lPacket = PacketBuffer::AllocateFromPool(lAllocSize, PacketBuffer::kNumSizeClasses);
+#else
     LOCK_BUF_POOL();
 
     lPacket = PacketBuffer::sFreeList;
     if (lPacket != nullptr)
     {
         PacketBuffer::sFreeList = lPacket->ChainedBuffer();
-        SYSTEM_STATS_INCREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
     }
 
     UNLOCK_BUF_POOL();
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
 
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
     // sumOfSizes is essentially (kStructureSize + lAllocSize) which we already
@@ -628,6 +757,7 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
     if (lPacket == nullptr)
     {
         ChipLogError(chipSystemLayer, "PacketBuffer: pool EMPTY.");
+        SYSTEM_STATS_ALLOCATION_FAILURE(chip::System::Stats::kSystemLayer_NumPacketBufs);
         return PacketBufferHandle();
     }
 
@@ -664,6 +794,28 @@ PacketBufferHandle PacketBufferHandle::NewWithData(const void * aData, size_t aD
     return buffer;
 }
 
+PacketBufferHandle PacketBufferHandle::NewReusing(PacketBufferHandle && aBuffer, size_t aAvailableSize, uint16_t aReservedSize)
+{
+    PacketBufferHandle buffer = std::move(aBuffer);
+    if (buffer.IsNull() || !buffer->HasSoleOwnership() || buffer->HasChainedBuffer() ||
+        static_cast<uint64_t>(aAvailableSize) + aReservedSize > buffer->AllocSize())
+    {
+        buffer = nullptr;
+        return New(aAvailableSize, aReservedSize);
+    }
+#if CHIP_SYSTEM_CONFIG_USE_LWIP
+    if (!(PBUF_STRUCT_DATA_CONTIGUOUS(buffer.mBuffer)))
+    {
+        buffer = nullptr;
+        return New(aAvailableSize, aReservedSize);
+    }
+#endif
+
+    buffer.mBuffer->payload = buffer.mBuffer->ReserveStart() + aReservedSize;
+    buffer.mBuffer->len = buffer.mBuffer->tot_len = 0;
+    return buffer;
+}
+
 /**
  * Free all packet buffers in a chain.
  *
@@ -702,7 +854,15 @@ void PacketBuffer::Free(PacketBuffer * aPacket)
             ::chip::Platform::MemoryDebugCheckPointer(aPacket, aPacket->alloc_size + kStructureSize);
 #endif
             aPacket->Clear();
-#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+            if (aPacket->size_class != kSizeClassFull)
+            {
+                SYSTEM_STATS_DECREMENT(kSizeClassStats[aPacket->size_class]);
+            }
+            PacketBuffer *& freeList = FreeList(aPacket->size_class);
+            aPacket->next            = freeList;
+            freeList                 = aPacket;
+#elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
             aPacket->next = sFreeList;
             sFreeList     = aPacket;
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
@@ -60,6 +60,9 @@ struct pbuf
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
     size_t alloc_size;
 #endif
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+    uint8_t size_class;
+#endif
 };
 #endif // !CHIP_SYSTEM_CONFIG_USE_LWIP
 
@@ -168,7 +171,9 @@ public:
      */
     size_t AllocSize() const
     {
-#if CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_STANDARD_POOL || CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+        return kSizeClassCapacity[this->size_class];
+#elif CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_STANDARD_POOL || CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
         return kMaxSizeWithoutReserve;
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
         return this->alloc_size;
@@ -387,6 +392,54 @@ private:
     static PacketBuffer * BuildFreeList();
 #endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL || defined(DOXYGEN)
 
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+    // Size classes of the internal pool, in increasing order of capacity.
+    enum SizeClass : uint8_t
+    {
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE > 0
+        kSizeClassSmall,
+#endif
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE > 0
+        kSizeClassMedium,
+#endif
+        kSizeClassFull,
+        kNumSizeClasses
+    };
+    static constexpr size_t kSizeClassCapacity[kNumSizeClasses] = {
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE > 0
+        CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY,
+#endif
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE > 0
+        CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_CAPACITY,
+#endif
+        kMaxSizeWithoutReserve,
+    };
+
+    template <size_t kCapacity>
+    union SizedPoolElement
+    {
+        pbuf Header;
+        uint8_t Block[PacketBuffer::kStructureSize + kCapacity];
+    };
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE > 0
+    static SizedPoolElement<CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_CAPACITY>
+        sSmallBufferPool[CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE];
+#endif
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE > 0
+    static SizedPoolElement<CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_CAPACITY>
+        sMediumBufferPool[CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE];
+#endif
+    // Free lists of the size classes below kSizeClassFull, which uses sFreeList. Built by BuildFreeList().
+    static PacketBuffer * sSizeClassFreeList[kSizeClassFull];
+    static PacketBuffer *& FreeList(uint8_t aSizeClass)
+    {
+        return (aSizeClass == kSizeClassFull) ? sFreeList : sSizeClassFreeList[aSizeClass];
+    }
+    // Take a buffer of at least aAllocSize bytes from the smallest size class below aSizeClassLimit that has one.
+    // The full-size class accepts any request.
+    static PacketBuffer * AllocateFromPool(size_t aAllocSize, uint8_t aSizeClassLimit);
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+
 #if CHIP_SYSTEM_PACKETBUFFER_HAS_CHECK
     static void InternalCheck(const PacketBuffer * buffer);
 #endif
@@ -651,6 +704,23 @@ public:
     static PacketBufferHandle NewWithData(const void * aData, size_t aDataSize, size_t aAdditionalSize = 0,
                                           uint16_t aReservedSize = PacketBuffer::kDefaultHeaderReserve);
 
+    /**
+     * Allocates a packet buffer for a new message, using a buffer whose contents are no longer needed, e.g. the request being
+     * responded to, to build the response in place.
+     *
+     *  \a aBuffer is emptied and returned when it is solely owned, unchained, and large enough for \a aAvailableSize octets after
+     *  \a aReservedSize reserved ones. Otherwise it is released before a new buffer is allocated, so that the two are never held
+     *  at once.
+     *
+     *  @param[in]  aBuffer         Buffer to reuse, may be null.
+     *  @param[in]  aAvailableSize  Minimum number of octets to for application data (at `Start()`).
+     *  @param[in]  aReservedSize   Number of octets to reserve for protocol headers (before `Start()`).
+     *
+     *  @return     On success, a PacketBufferHandle to an empty buffer. On fail, \c nullptr.
+     */
+    static PacketBufferHandle NewReusing(PacketBufferHandle && aBuffer, size_t aAvailableSize,
+                                         uint16_t aReservedSize = PacketBuffer::kDefaultHeaderReserve);
+
     /**
      * Creates a copy of a packet buffer (or chain).
      *
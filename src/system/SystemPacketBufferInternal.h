@@ -49,6 +49,18 @@
 #define CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL 0
 #endif
 
+/**
+ * CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+ *
+ * True if the internal pool has small or medium buffers in addition to full-size buffers.
+ */
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL &&                                                                                     \
+    (CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE > 0 || CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE > 0)
+#define CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES 1
+#else
+#define CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES 0
+#endif
+
 /**
  * CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_POOL
  *
@@ -100,7 +112,8 @@
  *
  * True if RightSize() has a nontrivial implementation.
  */
-#if CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_CUSTOM_POOL || CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_CUSTOM_POOL || CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP ||                                   \
+    CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
 #define CHIP_SYSTEM_PACKETBUFFER_HAS_RIGHTSIZE 1
 #else
 #define CHIP_SYSTEM_PACKETBUFFER_HAS_RIGHTSIZE 0
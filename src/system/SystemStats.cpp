@@ -28,9 +28,15 @@
 // Include module header
 #include <system/SystemStats.h>
 
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
+#include <lib/support/TypeTraits.h>
+#include <lib/support/logging/CHIPLogging.h>
 #include <platform/LockTracker.h>
+#include <tracing/metric_event.h>
 
+#include <algorithm>
 #include <string.h>
 
 namespace chip {
@@ -44,6 +50,12 @@ static const Label sStatsStrings[chip::System::Stats::kNumEntries] = {
 #undef LWIP_PBUF_MEMPOOL
 #else
     "Packet Buffers",
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE > 0 && CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE > 0
+    "Small packet buffers",
+#endif
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE > 0 && CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE > 0
+    "Medium packet buffers",
+#endif
 #endif
     "Timers",
 #if INET_CONFIG_NUM_TCP_ENDPOINTS
@@ -57,8 +69,97 @@ static const Label sStatsStrings[chip::System::Stats::kNumEntries] = {
     "Platform events",
 };
 
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+static const PoolStatistics::MetricKeys sStatsMetricKeys[chip::System::Stats::kNumEntries] = {
+#if CHIP_SYSTEM_CONFIG_USE_LWIP && CHIP_SYSTEM_CONFIG_LWIP_PBUF_FROM_CUSTOM_POOL
+#define LWIP_PBUF_MEMPOOL(name, num, payload, desc) SYSTEM_STATS_METRIC_KEYS("pbuf_" desc),
+#include "lwippools.h"
+#undef LWIP_PBUF_MEMPOOL
+#else
+    SYSTEM_STATS_METRIC_KEYS("packet_buffers"),
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE > 0 && CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE > 0
+    SYSTEM_STATS_METRIC_KEYS("small_packet_buffers"),
+#endif
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE > 0 && CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE > 0
+    SYSTEM_STATS_METRIC_KEYS("medium_packet_buffers"),
+#endif
+#endif
+    SYSTEM_STATS_METRIC_KEYS("timers"),
+#if INET_CONFIG_NUM_TCP_ENDPOINTS
+    SYSTEM_STATS_METRIC_KEYS("tcp_endpoints"),
+#endif
+#if INET_CONFIG_NUM_UDP_ENDPOINTS
+    SYSTEM_STATS_METRIC_KEYS("udp_endpoints"),
+#endif
+    SYSTEM_STATS_METRIC_KEYS("exchange_contexts"),
+    SYSTEM_STATS_METRIC_KEYS("unsolicited_message_handlers"),
+    SYSTEM_STATS_METRIC_KEYS("platform_events"),
+};
+
+// Bucket i is keyed by its lower bound, in milliseconds.
+static const char * const sDispatchLatencyMetricKeys[LatencyHistogram::kNumBuckets] = {
+    "sys_dispatch_latency_ms_0",   "sys_dispatch_latency_ms_1",   "sys_dispatch_latency_ms_2",   "sys_dispatch_latency_ms_4",
+    "sys_dispatch_latency_ms_8",   "sys_dispatch_latency_ms_16",  "sys_dispatch_latency_ms_32",  "sys_dispatch_latency_ms_64",
+    "sys_dispatch_latency_ms_128", "sys_dispatch_latency_ms_256", "sys_dispatch_latency_ms_512", "sys_dispatch_latency_ms_1024",
+};
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+
+#if CHIP_CONFIG_MEMORY_TAGGING
+#define SYSTEM_STATS_MEMORY_TAG_METRIC_KEYS(name)                                                                                  \
+    {                                                                                                                              \
+        "mem_" name "_live_bytes", "mem_" name "_peak_bytes", "mem_" name "_allocs_per_s"                                          \
+    }
+
+struct MemoryTagMetricKeys
+{
+    const char * liveBytes;
+    const char * peakBytes;
+    const char * allocationRate;
+};
+
+// Indexed by Platform::MemoryTag
+static const MemoryTagMetricKeys sMemoryTagMetricKeys[] = {
+    SYSTEM_STATS_MEMORY_TAG_METRIC_KEYS("untagged"),    SYSTEM_STATS_MEMORY_TAG_METRIC_KEYS("im"),
+    SYSTEM_STATS_MEMORY_TAG_METRIC_KEYS("transport"),   SYSTEM_STATS_MEMORY_TAG_METRIC_KEYS("dnssd"),
+    SYSTEM_STATS_MEMORY_TAG_METRIC_KEYS("credentials"), SYSTEM_STATS_MEMORY_TAG_METRIC_KEYS("controller"),
+};
+static_assert(ArraySize(sMemoryTagMetricKeys) == to_underlying(Platform::MemoryTag::kCount),
+              "Every memory tag needs metric keys");
+
+// Allocation counts at the previous PublishMetrics(), to report allocation rates
+static uint32_t sPublishedAllocations[ArraySize(sMemoryTagMetricKeys)];
+static Clock::Timestamp sPublishedAllocationsTime;
+
+static void PublishMemoryTagMetrics()
+{
+    const Clock::Timestamp now = SystemClock().GetMonotonicTimestamp();
+    const uint64_t elapsedMs   = (now - sPublishedAllocationsTime).count();
+
+    for (uint8_t i = 0; i < ArraySize(sMemoryTagMetricKeys); i++)
+    {
+        const Platform::MemoryTagStatistics stats = Platform::GetMemoryTagStatistics(static_cast<Platform::MemoryTag>(i));
+
+        MATTER_LOG_METRIC(sMemoryTagMetricKeys[i].liveBytes, static_cast<uint32_t>(std::min<size_t>(stats.liveBytes, UINT32_MAX)));
+        MATTER_LOG_METRIC(sMemoryTagMetricKeys[i].peakBytes, static_cast<uint32_t>(std::min<size_t>(stats.peakBytes, UINT32_MAX)));
+        // Nothing to report until a previous publication gives a time reference
+        if (sPublishedAllocationsTime.count() != 0 && elapsedMs > 0)
+        {
+            MATTER_LOG_METRIC(sMemoryTagMetricKeys[i].allocationRate,
+                              static_cast<uint32_t>((stats.allocations - sPublishedAllocations[i]) * 1000ull / elapsedMs));
+        }
+        sPublishedAllocations[i] = stats.allocations;
+    }
+    sPublishedAllocationsTime = now;
+}
+#endif // CHIP_CONFIG_MEMORY_TAGGING
+
 count_t sResourcesInUse[kNumEntries];
 count_t sHighWatermarks[kNumEntries];
+uint32_t sAllocationFailures[kNumEntries];
+LatencyHistogram sDispatchLatency;
+SlowCallbacks sSlowCallbacks;
+
+PoolStatistics * PoolStatistics::sFirst = nullptr;
 
 const Label * GetStrings()
 {
@@ -75,6 +176,123 @@ count_t * GetHighWatermarks()
     return sHighWatermarks;
 }
 
+uint32_t * GetAllocationFailures()
+{
+    return sAllocationFailures;
+}
+
+LatencyHistogram & GetDispatchLatency()
+{
+    return sDispatchLatency;
+}
+
+void LatencyHistogram::Record(Clock::Milliseconds64 latency)
+{
+    size_t bucket = 0;
+    for (uint64_t ms = latency.count(); ms > 0 && bucket < kNumBuckets - 1; ms >>= 1)
+    {
+        bucket++;
+    }
+    mBuckets[bucket]++;
+}
+
+void LatencyHistogram::Reset()
+{
+    memset(mBuckets, 0, sizeof(mBuckets));
+}
+
+SlowCallbacks & GetSlowCallbacks()
+{
+    return sSlowCallbacks;
+}
+
+void SlowCallbacks::Record(const void * callback, Clock::Milliseconds64 duration)
+{
+    VerifyOrReturn(CHIP_SYSTEM_CONFIG_SLOW_CALLBACK_THRESHOLD_MS != 0 &&
+                   duration.count() > CHIP_SYSTEM_CONFIG_SLOW_CALLBACK_THRESHOLD_MS);
+
+    const uint32_t durationMs = Clock::Milliseconds32(duration).count();
+    ChipLogError(chipSystemLayer, "Slow callback %p: %" PRIu32 " ms", callback, durationMs);
+    MATTER_LOG_METRIC(Tracing::kMetricSystemSlowCallback, durationMs);
+
+    // Keep the entries sorted, slowest first.
+    size_t index = kNumEntries;
+    while (index > 0 && mEntries[index - 1].durationMs < durationMs)
+    {
+        if (index < kNumEntries)
+        {
+            mEntries[index] = mEntries[index - 1];
+        }
+        index--;
+    }
+    if (index < kNumEntries)
+    {
+        mEntries[index] = { callback, durationMs };
+    }
+}
+
+void SlowCallbacks::Reset()
+{
+    memset(mEntries, 0, sizeof(mEntries));
+}
+
+void PoolStatistics::Register(const internal::Statistics & pool)
+{
+    VerifyOrReturn(mPool == nullptr);
+    mPool  = &pool;
+    mNext  = sFirst;
+    sFirst = this;
+}
+
+void PoolStatistics::Unregister()
+{
+    VerifyOrReturn(mPool != nullptr);
+
+    for (PoolStatistics ** link = &sFirst; *link != nullptr; link = &(*link)->mNext)
+    {
+        if (*link == this)
+        {
+            *link = mNext;
+            break;
+        }
+    }
+    mPool = nullptr;
+    mNext = nullptr;
+}
+
+void PublishMetrics()
+{
+    assertChipStackLockedByCurrentThread();
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    SYSTEM_STATS_UPDATE_LWIP_PBUF_COUNTS();
+
+    for (int i = 0; i < kNumEntries; i++)
+    {
+        MATTER_LOG_METRIC(sStatsMetricKeys[i].inUse, static_cast<int32_t>(sResourcesInUse[i]));
+        MATTER_LOG_METRIC(sStatsMetricKeys[i].highWatermark, static_cast<int32_t>(sHighWatermarks[i]));
+        MATTER_LOG_METRIC(sStatsMetricKeys[i].allocationFailures, sAllocationFailures[i]);
+    }
+
+    for (size_t i = 0; i < LatencyHistogram::kNumBuckets; i++)
+    {
+        MATTER_LOG_METRIC(sDispatchLatencyMetricKeys[i], sDispatchLatency.GetCount(i));
+    }
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+
+    for (const PoolStatistics * pool = PoolStatistics::First(); pool != nullptr; pool = pool->GetNext())
+    {
+        MATTER_LOG_METRIC(pool->GetMetricKeys().inUse, static_cast<uint32_t>(pool->GetPool()->Allocated()));
+        MATTER_LOG_METRIC(pool->GetMetricKeys().highWatermark, static_cast<uint32_t>(pool->GetPool()->HighWaterMark()));
+        MATTER_LOG_METRIC(pool->GetMetricKeys().allocationFailures,
+                          static_cast<uint32_t>(pool->GetPool()->AllocationFailures()));
+    }
+
+#if CHIP_CONFIG_MEMORY_TAGGING
+    PublishMemoryTagMetrics();
+#endif // CHIP_CONFIG_MEMORY_TAGGING
+}
+
 void UpdateSnapshot(Snapshot & aSnapshot)
 {
     memcpy(&aSnapshot.mResourcesInUse, &sResourcesInUse, sizeof(aSnapshot.mResourcesInUse));
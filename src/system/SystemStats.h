@@ -31,6 +31,8 @@
 
 // Include dependent headers
 #include <lib/support/DLLUtil.h>
+#include <lib/support/Pool.h>
+#include <system/SystemClock.h>
 
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
 #include <lwip/init.h>
@@ -54,6 +56,12 @@ enum
 #undef LWIP_PBUF_MEMPOOL
 #else
     kSystemLayer_NumPacketBufs,
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE > 0 && CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE > 0
+    kSystemLayer_NumSmallPacketBufs,
+#endif
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE > 0 && CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE > 0
+    kSystemLayer_NumMediumPacketBufs,
+#endif
 #endif
     kSystemLayer_NumTimers,
 #if INET_CONFIG_NUM_TCP_ENDPOINTS
@@ -93,10 +101,150 @@ void UpdateLwipPbufCounts(void);
 typedef const char * Label;
 const Label * GetStrings();
 
+/**
+ * Number of allocation failures for each entry, for the entries whose owner reports them.
+ */
+uint32_t * GetAllocationFailures();
+
+/**
+ * Histogram of event loop dispatch latencies, in milliseconds.
+ *
+ * Bucket 0 counts latencies below 1 ms, bucket i counts latencies in [2^(i-1), 2^i) ms, and the last bucket also
+ * counts anything longer.
+ */
+class LatencyHistogram
+{
+public:
+    static constexpr size_t kNumBuckets = 12;
+
+    void Record(Clock::Milliseconds64 latency);
+    uint32_t GetCount(size_t bucket) const { return mBuckets[bucket]; }
+    void Reset();
+
+private:
+    uint32_t mBuckets[kNumBuckets] = {};
+};
+
+/**
+ * How late System::Layer runs expired timers and scheduled work, relative to when they became due.
+ */
+LatencyHistogram & GetDispatchLatency();
+
+/**
+ * Keeps the slowest callbacks dispatched by the event loop, see CHIP_SYSTEM_CONFIG_SLOW_CALLBACK_THRESHOLD_MS.
+ */
+class SlowCallbacks
+{
+public:
+    static constexpr size_t kNumEntries = CHIP_SYSTEM_CONFIG_NUM_SLOW_CALLBACKS;
+
+    struct Entry
+    {
+        const void * callback; ///< Address of the callback function, or nullptr if not known.
+        uint32_t durationMs;
+    };
+
+    /**
+     * Account for a callback that ran for @p duration; callbacks that exceed the threshold are logged, reported as
+     * a kMetricSystemSlowCallback metric event, and kept if they are among the slowest.
+     */
+    void Record(const void * callback, Clock::Milliseconds64 duration);
+
+    /// The slowest callbacks so far, slowest first. Unused entries have a duration of 0.
+    const Entry & GetEntry(size_t index) const { return mEntries[index]; }
+    void Reset();
+
+private:
+    Entry mEntries[kNumEntries] = {};
+};
+
+SlowCallbacks & GetSlowCallbacks();
+
+/**
+ * Times the enclosing scope, i.e. the dispatch of a callback, and records it in GetSlowCallbacks().
+ */
+class ScopedCallbackTimer
+{
+public:
+    ScopedCallbackTimer(const void * callback) : mCallback(callback), mStart(SystemClock().GetMonotonicTimestamp()) {}
+    ~ScopedCallbackTimer() { GetSlowCallbacks().Record(mCallback, SystemClock().GetMonotonicTimestamp() - mStart); }
+
+private:
+    const void * mCallback;
+    Clock::Timestamp mStart;
+};
+
+/**
+ * Registration of an ObjectPool whose usage should be reported by PublishMetrics().
+ *
+ * The owner of the pool keeps one of these next to it, and calls Register() when initialized and Unregister() when
+ * shut down.
+ */
+class PoolStatistics
+{
+public:
+    struct MetricKeys
+    {
+        const char * inUse;
+        const char * highWatermark;
+        const char * allocationFailures;
+    };
+
+    constexpr PoolStatistics(const MetricKeys & keys) : mKeys(keys) {}
+    ~PoolStatistics() { Unregister(); }
+
+    void Register(const internal::Statistics & pool);
+    void Unregister();
+
+    const MetricKeys & GetMetricKeys() const { return mKeys; }
+    const internal::Statistics * GetPool() const { return mPool; }
+    const PoolStatistics * GetNext() const { return mNext; }
+
+    /// The first registered pool, to iterate through all of them with GetNext().
+    static const PoolStatistics * First() { return sFirst; }
+
+private:
+    PoolStatistics(const PoolStatistics &)             = delete;
+    PoolStatistics & operator=(const PoolStatistics &) = delete;
+
+    static PoolStatistics * sFirst;
+
+    const MetricKeys mKeys;
+    const internal::Statistics * mPool = nullptr;
+    PoolStatistics * mNext             = nullptr;
+};
+
+/**
+ * Emit all statistics, including the usage of every registered pool and the dispatch latency histogram, as metric
+ * events to the tracing backends.
+ *
+ * With #CHIP_CONFIG_MEMORY_TAGGING, the live and peak heap bytes of every chip::Platform::MemoryTag are emitted
+ * too, as well as their allocations per second since the previous call.
+ */
+void PublishMetrics();
+
 } // namespace Stats
 } // namespace System
 } // namespace chip
 
+/**
+ *  @def SYSTEM_STATS_METRIC_KEYS(name)
+ *
+ *  @brief
+ *    The PoolStatistics::MetricKeys under which PublishMetrics() reports the statistics of @p name, a string literal.
+ */
+#define SYSTEM_STATS_METRIC_KEYS(name)                                                                                             \
+    {                                                                                                                              \
+        "sys_" name "_in_use", "sys_" name "_high_watermark", "sys_" name "_alloc_failures"                                        \
+    }
+
+#if CHIP_SYSTEM_CONFIG_SLOW_CALLBACK_THRESHOLD_MS
+#define SYSTEM_STATS_TIME_CALLBACK(callback)                                                                                       \
+    ::chip::System::Stats::ScopedCallbackTimer _systemStatsCallbackTimer(reinterpret_cast<const void *>(callback))
+#else // CHIP_SYSTEM_CONFIG_SLOW_CALLBACK_THRESHOLD_MS
+#define SYSTEM_STATS_TIME_CALLBACK(callback)
+#endif // CHIP_SYSTEM_CONFIG_SLOW_CALLBACK_THRESHOLD_MS
+
 #if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
 
 #define SYSTEM_STATS_INCREMENT(entry)                                                                                              \
@@ -137,6 +285,18 @@ const Label * GetStrings();
         chip::System::Stats::GetResourcesInUse()[entry] = 0;                                                                       \
     } while (0)
 
+#define SYSTEM_STATS_ALLOCATION_FAILURE(entry)                                                                                     \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        chip::System::Stats::GetAllocationFailures()[entry]++;                                                                     \
+    } while (0)
+
+#define SYSTEM_STATS_RECORD_DISPATCH_LATENCY(latency)                                                                              \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        chip::System::Stats::GetDispatchLatency().Record(latency);                                                                 \
+    } while (0)
+
 #if CHIP_SYSTEM_CONFIG_USE_LWIP && LWIP_STATS && MEMP_STATS
 #define SYSTEM_STATS_UPDATE_LWIP_PBUF_COUNTS()                                                                                     \
     do                                                                                                                             \
@@ -166,6 +326,10 @@ const Label * GetStrings();
 
 #define SYSTEM_STATS_RESET(entry)
 
+#define SYSTEM_STATS_ALLOCATION_FAILURE(entry)
+
+#define SYSTEM_STATS_RECORD_DISPATCH_LATENCY(latency)
+
 #define SYSTEM_STATS_UPDATE_LWIP_PBUF_COUNTS()
 
 #define SYSTEM_STATS_TEST_IN_USE(entry, expected) (true)
@@ -178,5 +178,402 @@ Clock::Timeout TimerList::GetRemainingTime(TimerCompleteCallback aOnComplete, vo
     return Clock::kZero;
 }
 
+namespace {
+
+unsigned LowestSetBit(uint64_t mask)
+{
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_ctzll(mask));
+#else
+    unsigned bit = 0;
+    while ((mask & 1) == 0)
+    {
+        mask >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+// Returns the first timer with the earliest expiration time in a chain of timers.
+TimerList::Node * EarliestInChain(TimerList::Node * timer)
+{
+    TimerList::Node * earliest = timer;
+    for (; timer != nullptr; timer = timer->mNextTimer)
+    {
+        if (timer->AwakenTime() < earliest->AwakenTime())
+        {
+            earliest = timer;
+        }
+    }
+    return earliest;
+}
+
+} // namespace
+
+size_t TimerWheel::BucketIndex(TimerCompleteCallback onComplete, void * appState)
+{
+    uint64_t hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(onComplete)) ^
+        (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(appState)) << 1);
+    hash *= UINT64_C(0x9E3779B97F4A7C15);
+    return static_cast<size_t>(hash >> 32) & (kHashBuckets - 1);
+}
+
+void TimerWheel::Clear()
+{
+    memset(mSlots, 0, sizeof(mSlots));
+    memset(mOccupied, 0, sizeof(mOccupied));
+    memset(mBuckets, 0, sizeof(mBuckets));
+    mOverflow      = nullptr;
+    mCount         = 0;
+    mEarliest      = nullptr;
+    mEarliestValid = true;
+}
+
+void TimerWheel::Insert(Node * timer)
+{
+    const uint64_t ticks = Ticks(timer);
+    uint8_t level        = 0;
+    uint8_t slot         = static_cast<uint8_t>(SlotIndex(mNow, 0));
+
+    if (ticks > mNow)
+    {
+        // The level is the one containing the most significant bit in which the expiration time and the
+        // current time of the wheel differ.
+        const uint64_t diff = ticks ^ mNow;
+        while (level < kLevels && (diff >> ((level + 1u) * kSlotBits)) != 0)
+        {
+            level++;
+        }
+        slot = static_cast<uint8_t>((level < kLevels) ? SlotIndex(ticks, level) : 0);
+    }
+    // else the timer is already due, and is kept in the current slot.
+
+    timer->mLevel     = level;
+    timer->mSlot      = slot;
+    timer->mNextTimer = nullptr;
+    Node *& head      = SlotHead(level, slot);
+    if (head == nullptr)
+    {
+        timer->mPrevTimer = timer;
+        head              = timer;
+    }
+    else
+    {
+        Node * tail       = head->mPrevTimer;
+        tail->mNextTimer  = timer;
+        timer->mPrevTimer = tail;
+        head->mPrevTimer  = timer;
+    }
+    if (level < kLevels)
+    {
+        mOccupied[level] |= (UINT64_C(1) << slot);
+    }
+}
+
+void TimerWheel::Unlink(Node * timer)
+{
+    Node *& head = SlotHead(timer->mLevel, timer->mSlot);
+    Node * next  = static_cast<Node *>(timer->mNextTimer);
+
+    if (timer == head)
+    {
+        head = next;
+        if (next != nullptr)
+        {
+            next->mPrevTimer = timer->mPrevTimer;
+        }
+    }
+    else
+    {
+        timer->mPrevTimer->mNextTimer = next;
+        if (next != nullptr)
+        {
+            next->mPrevTimer = timer->mPrevTimer;
+        }
+        else
+        {
+            head->mPrevTimer = timer->mPrevTimer;
+        }
+    }
+
+    if (head == nullptr && timer->mLevel < kLevels)
+    {
+        mOccupied[timer->mLevel] &= ~(UINT64_C(1) << timer->mSlot);
+    }
+    timer->mNextTimer = nullptr;
+    timer->mPrevTimer = nullptr;
+}
+
+TimerWheel::Node * TimerWheel::DetachSlot(uint8_t level, uint8_t slot)
+{
+    Node *& head = SlotHead(level, slot);
+    Node * timer = head;
+    head         = nullptr;
+    if (level < kLevels)
+    {
+        mOccupied[level] &= ~(UINT64_C(1) << slot);
+    }
+    return timer;
+}
+
+void TimerWheel::Forget(Node * timer)
+{
+    Node ** link = &mBuckets[BucketIndex(timer->GetCallback().GetOnComplete(), timer->GetCallback().GetAppState())];
+    while (*link != timer)
+    {
+        link = &(*link)->mNextInBucket;
+    }
+    *link                = timer->mNextInBucket;
+    timer->mNextInBucket = nullptr;
+    timer->mLevel        = kNotInWheel;
+    mCount--;
+
+    if (timer == mEarliest)
+    {
+        mEarliestValid = false;
+    }
+}
+
+TimerWheel::Node * TimerWheel::Add(Node * timer)
+{
+    VerifyOrDie(timer->mLevel == kNotInWheel);
+
+    Insert(timer);
+    Node *& bucket       = mBuckets[BucketIndex(timer->GetCallback().GetOnComplete(), timer->GetCallback().GetAppState())];
+    timer->mNextInBucket = bucket;
+    bucket               = timer;
+    mCount++;
+
+    if (mEarliestValid && (mEarliest == nullptr || timer->AwakenTime() < mEarliest->AwakenTime()))
+    {
+        mEarliest = timer;
+    }
+    return Earliest();
+}
+
+TimerWheel::Node * TimerWheel::Remove(Node * remove)
+{
+    if (remove != nullptr && remove->mLevel != kNotInWheel)
+    {
+        Unlink(remove);
+        Forget(remove);
+    }
+    return Earliest();
+}
+
+TimerWheel::Node * TimerWheel::Remove(TimerCompleteCallback onComplete, void * appState)
+{
+    Node * timer = FindInBucket(onComplete, appState);
+    if (timer != nullptr)
+    {
+        Unlink(timer);
+        Forget(timer);
+    }
+    return timer;
+}
+
+TimerWheel::Node * TimerWheel::PopEarliest()
+{
+    Node * earliest = Earliest();
+    if (earliest != nullptr)
+    {
+        Unlink(earliest);
+        Forget(earliest);
+    }
+    return earliest;
+}
+
+TimerWheel::Node * TimerWheel::Earliest()
+{
+    if (!mEarliestValid)
+    {
+        mEarliest      = FindEarliest();
+        mEarliestValid = true;
+    }
+    return mEarliest;
+}
+
+TimerWheel::Node * TimerWheel::FindEarliest()
+{
+    // Every timer in a level expires before any timer in the levels above it, and occupied slots of a level are
+    // never behind the current time, so the earliest timer is in the first occupied slot of the lowest level.
+    for (uint8_t level = 0; level < kLevels; level++)
+    {
+        if (mOccupied[level] != 0)
+        {
+            const unsigned slot = LowestSetBit(mOccupied[level]);
+            Node * head         = mSlots[level][slot];
+            if (level == 0 && slot != SlotIndex(mNow, 0))
+            {
+                // All timers in other level 0 slots expire at the same time.
+                return head;
+            }
+            return static_cast<Node *>(EarliestInChain(head));
+        }
+    }
+    return static_cast<Node *>(EarliestInChain(mOverflow));
+}
+
+TimerWheel::Node * TimerWheel::FindInBucket(TimerCompleteCallback onComplete, void * appState)
+{
+    // Buckets are in reverse order of addition; on equal expiration times, prefer the timer added first, as
+    // TimerList does.
+    Node * found = nullptr;
+    for (Node * timer = mBuckets[BucketIndex(onComplete, appState)]; timer != nullptr; timer = timer->mNextInBucket)
+    {
+        if (timer->GetCallback().GetOnComplete() == onComplete && timer->GetCallback().GetAppState() == appState &&
+            (found == nullptr || !(found->AwakenTime() < timer->AwakenTime())))
+        {
+            found = timer;
+        }
+    }
+    return found;
+}
+
+void TimerWheel::AdvanceTo(uint64_t ticks)
+{
+    // Callers guarantee that no timer expiring before `ticks` remains, so the only timers that need to move are
+    // those in the slots that `ticks` falls into, which are redistributed to lower levels.
+    const bool wrapped = (ticks >> kWheelBits) != (mNow >> kWheelBits);
+    mNow               = ticks;
+
+    if (wrapped)
+    {
+        for (Node * timer = DetachSlot(kOverflowLevel, 0); timer != nullptr;)
+        {
+            Node * next = static_cast<Node *>(timer->mNextTimer);
+            Insert(timer);
+            timer = next;
+        }
+    }
+
+    for (uint8_t level = kLevels - 1; level > 0; level--)
+    {
+        const uint8_t slot = static_cast<uint8_t>(SlotIndex(ticks, level));
+        for (Node * timer = DetachSlot(level, slot); timer != nullptr;)
+        {
+            Node * next = static_cast<Node *>(timer->mNextTimer);
+            Insert(timer);
+            timer = next;
+        }
+    }
+}
+
+TimerList TimerWheel::ExtractEarlier(Clock::Timestamp t)
+{
+    const uint64_t limit = t.count();
+    TimerList out;
+    TimerList::Node * tail = nullptr;
+    auto append            = [&out, &tail](TimerList::Node * timer) {
+        timer->mNextTimer = nullptr;
+        if (tail == nullptr)
+        {
+            out.mEarliestTimer = timer;
+        }
+        else
+        {
+            tail->mNextTimer = timer;
+        }
+        tail = timer;
+    };
+
+    mEarliestValid = false;
+
+    while (mCount > 0)
+    {
+        uint8_t level = 0;
+        while (level < kLevels && mOccupied[level] == 0)
+        {
+            level++;
+        }
+
+        if (level == kOverflowLevel)
+        {
+            const uint64_t earliest = Ticks(static_cast<Node *>(EarliestInChain(mOverflow)));
+            if (earliest >= limit)
+            {
+                break;
+            }
+            AdvanceTo(earliest);
+            continue;
+        }
+
+        const uint8_t slot = static_cast<uint8_t>(LowestSetBit(mOccupied[level]));
+        if (level == 0 && slot == SlotIndex(mNow, 0))
+        {
+            // The current slot may hold timers that were added already due, in any order.
+            TimerList due;
+            for (Node * timer = mSlots[0][slot]; timer != nullptr;)
+            {
+                Node * next = static_cast<Node *>(timer->mNextTimer);
+                if (Ticks(timer) < limit)
+                {
+                    Unlink(timer);
+                    Forget(timer);
+                    due.Add(timer);
+                }
+                timer = next;
+            }
+            while (!due.Empty())
+            {
+                append(due.PopEarliest());
+            }
+            if (mSlots[0][slot] != nullptr)
+            {
+                break;
+            }
+            continue;
+        }
+
+        // Start of the time range covered by the slot.
+        const unsigned shift   = level * kSlotBits;
+        const uint64_t lowMask = (UINT64_C(1) << (shift + kSlotBits)) - 1;
+        const uint64_t start   = (mNow & ~lowMask) | (static_cast<uint64_t>(slot) << shift);
+        if (start >= limit)
+        {
+            break;
+        }
+
+        if (level == 0)
+        {
+            for (Node * timer = DetachSlot(0, slot); timer != nullptr;)
+            {
+                Node * next = static_cast<Node *>(timer->mNextTimer);
+                Forget(timer);
+                timer->mPrevTimer = nullptr;
+                append(timer);
+                timer = next;
+            }
+        }
+        else
+        {
+            AdvanceTo(start);
+        }
+    }
+
+    if (limit > mNow)
+    {
+        AdvanceTo(limit);
+    }
+
+    return out;
+}
+
+Clock::Timeout TimerWheel::GetRemainingTime(TimerCompleteCallback onComplete, void * appState)
+{
+    Node * timer = FindInBucket(onComplete, appState);
+    if (timer != nullptr)
+    {
+        Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+
+        if (currentTime < timer->AwakenTime())
+        {
+            return Clock::Timeout(timer->AwakenTime() - currentTime);
+        }
+    }
+    return Clock::kZero;
+}
+
 } // namespace System
 } // namespace chip
@@ -186,9 +186,146 @@ public:
     Clock::Timeout GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState);
 
 private:
+    friend class TimerWheel;
     Node * mEarliestTimer;
 };
 
+/**
+ * Hierarchical timing wheel of `Timer`s, offering the same operations as TimerList.
+ *
+ * Timers are kept in kLevels levels of kSlotsPerLevel slots each. Level 0 slots are one millisecond wide, and each
+ * slot of level N covers a whole revolution of level N-1. A timer is placed in the lowest level whose slot
+ * distinguishes its expiration time from the current time of the wheel, and moves down one or more levels when
+ * the wheel reaches its slot, so each timer is touched at most kLevels times between being added and expiring.
+ *
+ * Timers are also indexed by callback and application state, so that adding and removing a timer are O(1)
+ * on average regardless of the number of pending timers.
+ */
+class TimerWheel
+{
+public:
+    class Node : public TimerList::Node
+    {
+    public:
+        Node(Layer & systemLayer, System::Clock::Timestamp awakenTime, TimerCompleteCallback onComplete, void * appState) :
+            TimerList::Node(systemLayer, awakenTime, onComplete, appState)
+        {}
+
+    private:
+        friend class TimerWheel;
+        // Previous timer in the same slot; the first timer of a slot points at the last one.
+        Node * mPrevTimer    = nullptr;
+        Node * mNextInBucket = nullptr;
+        uint8_t mLevel       = kNotInWheel;
+        uint8_t mSlot        = 0;
+    };
+
+    TimerWheel() { Clear(); }
+
+    /**
+     * Add a timer to the wheel
+     *
+     * @return  The new earliest timer in the wheel. If this is the newly added timer, that implies it is earlier
+     *          than any existing timer.
+     */
+    Node * Add(Node * timer);
+
+    /**
+     * Remove the given timer from the wheel, if present. It is not an error for the timer not to be present.
+     *
+     * @return  The new earliest timer in the wheel, or nullptr if the wheel is empty.
+     */
+    Node * Remove(Node * remove);
+
+    /**
+     * Remove the earliest timer with the given properties, if present. It is not an error for no such timer to be present.
+     *
+     * @return  The removed timer, or nullptr if the wheel contains no matching timer.
+     */
+    Node * Remove(TimerCompleteCallback onComplete, void * appState);
+
+    /**
+     * Remove and return the earliest timer in the wheel.
+     *
+     * @return  The earliest timer, or nullptr if the wheel is empty.
+     */
+    Node * PopEarliest();
+
+    /**
+     * Get the earliest timer in the wheel.
+     *
+     * @return  The earliest timer, or nullptr if there are no timers.
+     */
+    Node * Earliest();
+
+    /**
+     * Test whether there are any timers.
+     */
+    bool Empty() const { return mCount == 0; }
+
+    /**
+     * Remove and return all timers that expire before the given time @a t, ordered by expiration time.
+     */
+    TimerList ExtractEarlier(Clock::Timestamp t);
+
+    /**
+     * Remove all timers.
+     */
+    void Clear();
+
+    /**
+     * Find the earliest timer with the given properties, if present, and return its remaining time
+     *
+     * @return The remaining time on this particular timer or 0 if not found.
+     */
+    Clock::Timeout GetRemainingTime(TimerCompleteCallback onComplete, void * appState);
+
+private:
+    static constexpr unsigned kSlotBits      = 6;
+    static constexpr unsigned kSlotsPerLevel = 1u << kSlotBits;
+    static constexpr unsigned kLevels        = 6;
+    static constexpr unsigned kWheelBits     = kSlotBits * kLevels;
+    // Marks timers that are too far in the future for the wheel and are kept in mOverflow instead.
+    static constexpr uint8_t kOverflowLevel = kLevels;
+    static constexpr uint8_t kNotInWheel    = UINT8_MAX;
+    static constexpr size_t kHashBuckets    = CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS;
+    static_assert(kSlotsPerLevel == 64, "Slot occupancy is tracked in 64-bit masks");
+    static_assert((kHashBuckets & (kHashBuckets - 1)) == 0, "CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS must be a power of two");
+
+    static uint64_t Ticks(const Node * timer) { return timer->AwakenTime().count(); }
+    static unsigned SlotIndex(uint64_t ticks, unsigned level) { return (ticks >> (level * kSlotBits)) & (kSlotsPerLevel - 1); }
+    static size_t BucketIndex(TimerCompleteCallback onComplete, void * appState);
+
+    Node *& SlotHead(uint8_t level, uint8_t slot) { return (level == kOverflowLevel) ? mOverflow : mSlots[level][slot]; }
+    void Insert(Node * timer);
+    void Unlink(Node * timer);
+    Node * DetachSlot(uint8_t level, uint8_t slot);
+    void Forget(Node * timer);
+    Node * FindEarliest();
+    Node * FindInBucket(TimerCompleteCallback onComplete, void * appState);
+    void AdvanceTo(uint64_t ticks);
+
+    Node * mSlots[kLevels][kSlotsPerLevel];
+    uint64_t mOccupied[kLevels];
+    Node * mOverflow;
+    Node * mBuckets[kHashBuckets];
+    // Time of the wheel, in ticks. All timers expire at or after this time, except for timers that were added
+    // already overdue, which are kept in the current level 0 slot.
+    uint64_t mNow = 0;
+    size_t mCount;
+    Node * mEarliest;
+    bool mEarliestValid;
+};
+
+/**
+ * Container used by System::Layer implementations for pending timers.
+ */
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+using TimerStore = TimerWheel;
+#else
+using TimerStore = TimerList;
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+
 /**
  * ObjectPool wrapper that keeps System Timer statistics.
  */
@@ -204,6 +341,11 @@ public:
     Timer * Create(Layer & systemLayer, System::Clock::Timestamp awakenTime, TimerCompleteCallback onComplete, void * appState)
     {
         Timer * timer = mTimerPool.CreateObject(systemLayer, awakenTime, onComplete, appState);
+        if (timer == nullptr)
+        {
+            SYSTEM_STATS_ALLOCATION_FAILURE(Stats::kSystemLayer_NumTimers);
+            return nullptr;
+        }
         SYSTEM_STATS_INCREMENT(Stats::kSystemLayer_NumTimers);
         return timer;
     }
@@ -228,11 +370,19 @@ public:
 
     /**
      * Release a timer to the pool and invoke its callback.
+     *
+     * With statistics enabled, this also records how late the callback runs in Stats::GetDispatchLatency(), and with
+     * CHIP_SYSTEM_CONFIG_SLOW_CALLBACK_THRESHOLD_MS set, how long it runs in Stats::GetSlowCallbacks().
      */
     void Invoke(Timer * timer)
     {
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+        const Clock::Timestamp now = SystemClock().GetMonotonicTimestamp();
+        SYSTEM_STATS_RECORD_DISPATCH_LATENCY(now > timer->AwakenTime() ? now - timer->AwakenTime() : Clock::Milliseconds64(0));
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
         typename Timer::Callback callback = timer->GetCallback();
         Release(timer);
+        SYSTEM_STATS_TIME_CALLBACK(callback.GetOnComplete());
         callback.Invoke();
     }
 
@@ -0,0 +1,135 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/ErrorStr.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <system/SystemConfig.h>
+#include <system/SystemCoroutine.h>
+#include <system/SystemLayerImpl.h>
+
+#if CHIP_SYSTEM_HAS_COROUTINES && CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
+using namespace chip;
+using namespace chip::System;
+
+namespace {
+
+class TestSystemCoroutine : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+        ASSERT_EQ(sLayer.Init(), CHIP_NO_ERROR);
+    }
+
+    static void TearDownTestSuite()
+    {
+        sLayer.Shutdown();
+        Platform::MemoryShutdown();
+    }
+
+    static void ServiceEventsUntil(const Task & task)
+    {
+        for (int i = 0; i < 1000 && !task.IsDone(); i++)
+        {
+            sLayer.PrepareEvents();
+            sLayer.WaitForEvents();
+            sLayer.HandleEvents();
+        }
+    }
+
+    static LayerImpl sLayer;
+};
+
+LayerImpl TestSystemCoroutine::sLayer;
+
+Task SleepTwice(Layer & layer, int & wakeups)
+{
+    for (int i = 0; i < 2; i++)
+    {
+        CoReturnErrorOnFailure(co_await Sleep(layer, Clock::Milliseconds32(1)));
+        wakeups++;
+    }
+    co_return CHIP_NO_ERROR;
+}
+
+Task SleepAndFail(Layer & layer)
+{
+    CoReturnErrorOnFailure(co_await Sleep(layer, Clock::kZero));
+    co_return CHIP_ERROR_INTERNAL;
+}
+
+Task AwaitBoth(Layer & layer, int & wakeups)
+{
+    CoReturnErrorOnFailure(co_await SleepTwice(layer, wakeups));
+    co_return co_await SleepAndFail(layer);
+}
+
+TEST_F(TestSystemCoroutine, TestSleep)
+{
+    int wakeups = 0;
+    Task task   = SleepTwice(sLayer, wakeups);
+
+    // The task runs up to its first suspension point immediately.
+    EXPECT_FALSE(task.IsDone());
+    EXPECT_EQ(wakeups, 0);
+    EXPECT_EQ(CoroutineFramePool::InUse(), 1u);
+
+    ServiceEventsUntil(task);
+    EXPECT_TRUE(task.IsDone());
+    EXPECT_EQ(task.Result(), CHIP_NO_ERROR);
+    EXPECT_EQ(wakeups, 2);
+}
+
+TEST_F(TestSystemCoroutine, TestAwaitTask)
+{
+    int wakeups = 0;
+    Task task   = AwaitBoth(sLayer, wakeups);
+
+    ServiceEventsUntil(task);
+    EXPECT_TRUE(task.IsDone());
+    EXPECT_EQ(task.Result(), CHIP_ERROR_INTERNAL);
+    EXPECT_EQ(wakeups, 2);
+}
+
+TEST_F(TestSystemCoroutine, TestDetachedTask)
+{
+    int wakeups = 0;
+    {
+        // Dropping the Task does not stop the coroutine; its frame is freed when it completes.
+        Task task = SleepTwice(sLayer, wakeups);
+    }
+    EXPECT_EQ(CoroutineFramePool::InUse(), 1u);
+
+    for (int i = 0; i < 1000 && CoroutineFramePool::InUse() != 0; i++)
+    {
+        sLayer.PrepareEvents();
+        sLayer.WaitForEvents();
+        sLayer.HandleEvents();
+    }
+    EXPECT_EQ(wakeups, 2);
+    EXPECT_EQ(CoroutineFramePool::InUse(), 0u);
+    EXPECT_EQ(CoroutineFramePool::HeapAllocations(), 0u);
+}
+
+} // namespace
+
+#endif // CHIP_SYSTEM_HAS_COROUTINES && CHIP_SYSTEM_CONFIG_USE_SOCKETS
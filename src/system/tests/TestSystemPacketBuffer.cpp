@@ -23,6 +23,7 @@
  *      structure for network packet buffer management.
  */
 
+#include <algorithm>
 #include <errno.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -192,6 +193,7 @@ public:
     void CheckRead();
     void CheckSetDataLength();
     void CheckSetStart();
+    void CheckSizeClasses();
 };
 
 /**
@@ -1595,6 +1597,88 @@ TEST_F_FROM_FIXTURE(TestSystemPacketBuffer, CheckHandleRightSize)
 #endif // CHIP_SYSTEM_PACKETBUFFER_HAS_RIGHTSIZE
 }
 
+TEST_F_FROM_FIXTURE(TestSystemPacketBuffer, CheckSizeClasses)
+{
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+    constexpr size_t kSmallest       = PacketBuffer::kSizeClassCapacity[0];
+    constexpr size_t kNumSmallerBufs =
+        CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_POOL_SIZE + CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_POOL_SIZE;
+
+    // A short allocation comes from the smallest size class.
+    PacketBufferHandle handle = PacketBufferHandle::New(kSmallest, 0);
+    ASSERT_FALSE(handle.IsNull());
+    EXPECT_EQ(handle.mBuffer->size_class, 0);
+    EXPECT_EQ(handle->AllocSize(), kSmallest);
+    EXPECT_EQ(handle->AvailableDataLength(), kSmallest);
+
+    // An allocation that does not fit the smaller classes comes from the full-size class.
+    PacketBufferHandle full = PacketBufferHandle::New(PacketBuffer::kMaxSizeWithoutReserve, 0);
+    ASSERT_FALSE(full.IsNull());
+    EXPECT_EQ(full.mBuffer->size_class, PacketBuffer::kSizeClassFull);
+    EXPECT_EQ(full->AllocSize(), PacketBuffer::kMaxSizeWithoutReserve);
+
+    // RightSize() moves short contents to a smaller class.
+    static const char kPayload[] = "Joy!";
+    memcpy(full->Start(), kPayload, sizeof kPayload);
+    full->SetDataLength(sizeof kPayload);
+    full.RightSize();
+    EXPECT_EQ(full.mBuffer->size_class, 0);
+    EXPECT_EQ(full->DataLength(), sizeof kPayload);
+    EXPECT_EQ(memcmp(full->Start(), kPayload, sizeof kPayload), 0);
+
+    handle = nullptr;
+    full   = nullptr;
+
+    // When the smaller classes are exhausted, allocations fall back to larger ones.
+    PacketBufferHandle held[kNumSmallerBufs];
+    for (auto & h : held)
+    {
+        h = PacketBufferHandle::New(1, 0);
+        ASSERT_FALSE(h.IsNull());
+        EXPECT_NE(h.mBuffer->size_class, PacketBuffer::kSizeClassFull);
+    }
+    handle = PacketBufferHandle::New(1, 0);
+    ASSERT_FALSE(handle.IsNull());
+    EXPECT_EQ(handle.mBuffer->size_class, PacketBuffer::kSizeClassFull);
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_SIZE_CLASSES
+}
+
+TEST_F(TestSystemPacketBuffer, CheckHandleNewReusing)
+{
+    static const char kPayload[] = "request";
+
+    // A solely owned buffer that is large enough is emptied and reused.
+    PacketBufferHandle request = PacketBufferHandle::NewWithData(kPayload, sizeof kPayload, 0, 0);
+    ASSERT_FALSE(request.IsNull());
+    const size_t allocSize        = request->AllocSize();
+    const PacketBuffer * original = request.operator->();
+    const uint16_t reserve        = static_cast<uint16_t>(std::min<size_t>(allocSize / 2, PacketBuffer::kDefaultHeaderReserve));
+
+    PacketBufferHandle response = PacketBufferHandle::NewReusing(std::move(request), allocSize - reserve, reserve);
+    EXPECT_TRUE(request.IsNull());
+    ASSERT_FALSE(response.IsNull());
+    EXPECT_EQ(response.operator->(), original);
+    EXPECT_EQ(response->DataLength(), 0u);
+    EXPECT_EQ(response->TotalLength(), 0u);
+    EXPECT_EQ(response->ReservedSize(), reserve);
+    EXPECT_EQ(response->AvailableDataLength(), allocSize - reserve);
+
+    // A buffer that is shared, or too small, is replaced.
+    PacketBufferHandle shared = response.Retain();
+    response                  = PacketBufferHandle::NewReusing(std::move(response), 1, 0);
+    ASSERT_FALSE(response.IsNull());
+    EXPECT_NE(response.operator->(), shared.operator->());
+    EXPECT_TRUE(shared.HasSoleOwnership());
+
+    response = PacketBufferHandle::NewReusing(std::move(shared), allocSize + 1, 0);
+    EXPECT_TRUE(shared.IsNull());
+
+    // A null buffer is allocated.
+    response = PacketBufferHandle::NewReusing(PacketBufferHandle(), 1);
+    ASSERT_FALSE(response.IsNull());
+    EXPECT_GE(response->AvailableDataLength(), 1u);
+}
+
 TEST_F_FROM_FIXTURE(TestSystemPacketBuffer, CheckHandleCloneData)
 {
     uint8_t lPayload[2 * PacketBuffer::kMaxAllocSize];
@@ -0,0 +1,113 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/support/Pool.h>
+#include <system/SystemStats.h>
+
+using namespace chip;
+using namespace chip::System;
+
+namespace {
+
+TEST(TestSystemStats, TestLatencyHistogram)
+{
+    Stats::LatencyHistogram histogram;
+
+    histogram.Record(Clock::Milliseconds64(0));
+    histogram.Record(Clock::Milliseconds64(1));
+    histogram.Record(Clock::Milliseconds64(2));
+    histogram.Record(Clock::Milliseconds64(3));
+    histogram.Record(Clock::Milliseconds64(100));
+    histogram.Record(Clock::Milliseconds64(1u << 20));
+
+    EXPECT_EQ(histogram.GetCount(0), 1u);
+    EXPECT_EQ(histogram.GetCount(1), 1u);
+    EXPECT_EQ(histogram.GetCount(2), 2u);
+    EXPECT_EQ(histogram.GetCount(7), 1u);
+    EXPECT_EQ(histogram.GetCount(Stats::LatencyHistogram::kNumBuckets - 1), 1u);
+
+    histogram.Reset();
+    for (size_t i = 0; i < Stats::LatencyHistogram::kNumBuckets; i++)
+    {
+        EXPECT_EQ(histogram.GetCount(i), 0u);
+    }
+}
+
+TEST(TestSystemStats, TestPoolRegistration)
+{
+    ObjectPool<uint32_t, 2, ObjectPoolMem::kInline> pool;
+    Stats::PoolStatistics first(SYSTEM_STATS_METRIC_KEYS("first"));
+
+    {
+        Stats::PoolStatistics second(SYSTEM_STATS_METRIC_KEYS("second"));
+
+        first.Register(pool);
+        second.Register(pool);
+        EXPECT_EQ(Stats::PoolStatistics::First(), &second);
+        EXPECT_EQ(second.GetNext(), &first);
+        EXPECT_STREQ(first.GetMetricKeys().highWatermark, "sys_first_high_watermark");
+    }
+
+    // Destroying a registration unregisters it.
+    EXPECT_EQ(Stats::PoolStatistics::First(), &first);
+    EXPECT_EQ(first.GetNext(), nullptr);
+
+    uint32_t * a = pool.CreateObject();
+    uint32_t * b = pool.CreateObject();
+    EXPECT_EQ(pool.CreateObject(), nullptr);
+    EXPECT_EQ(first.GetPool()->Allocated(), 2u);
+    EXPECT_EQ(first.GetPool()->AllocationFailures(), 1u);
+
+    pool.ReleaseObject(a);
+    pool.ReleaseObject(b);
+    EXPECT_EQ(first.GetPool()->HighWaterMark(), 2u);
+
+    first.Unregister();
+    EXPECT_EQ(Stats::PoolStatistics::First(), nullptr);
+}
+
+#if CHIP_SYSTEM_CONFIG_SLOW_CALLBACK_THRESHOLD_MS
+TEST(TestSystemStats, TestSlowCallbacks)
+{
+    constexpr uint32_t kThreshold = CHIP_SYSTEM_CONFIG_SLOW_CALLBACK_THRESHOLD_MS;
+    Stats::SlowCallbacks slowCallbacks;
+    int callbacks[Stats::SlowCallbacks::kNumEntries + 1];
+
+    // Callbacks within the threshold are not kept.
+    slowCallbacks.Record(&callbacks[0], Clock::Milliseconds64(kThreshold));
+    EXPECT_EQ(slowCallbacks.GetEntry(0).durationMs, 0u);
+
+    for (uint32_t i = 0; i <= Stats::SlowCallbacks::kNumEntries; i++)
+    {
+        slowCallbacks.Record(&callbacks[i], Clock::Milliseconds64(kThreshold + 1 + i));
+    }
+
+    // Slowest first, and the fastest one fell off the end.
+    for (uint32_t i = 0; i < Stats::SlowCallbacks::kNumEntries; i++)
+    {
+        EXPECT_EQ(slowCallbacks.GetEntry(i).callback, &callbacks[Stats::SlowCallbacks::kNumEntries - i]);
+        EXPECT_EQ(slowCallbacks.GetEntry(i).durationMs, kThreshold + 1 + Stats::SlowCallbacks::kNumEntries - i);
+    }
+
+    slowCallbacks.Reset();
+    EXPECT_EQ(slowCallbacks.GetEntry(0).callback, nullptr);
+}
+#endif // CHIP_SYSTEM_CONFIG_SLOW_CALLBACK_THRESHOLD_MS
+
+} // namespace
@@ -564,6 +564,115 @@ TEST_F(TestSystemTimer, CheckTimerPool)
     EXPECT_TRUE(SYSTEM_STATS_TEST_HIGH_WATER_MARK(Stats::kSystemLayer_NumTimers, 4));
 }
 
+TEST_F(TestSystemTimer, CheckTimerWheel)
+{
+    using Timer = TimerWheel::Node;
+    struct TestState
+    {
+        static void First(Layer * layer, void * state) {}
+        static void Second(Layer * layer, void * state) {}
+    };
+    int appState[3];
+
+    // Expiration times in several levels of the wheel and beyond it, including equal ones.
+    constexpr uint64_t kFar      = UINT64_C(1) << 40;
+    const uint64_t awakenTimes[] = { 5, 0, 63, 64, 65, 4095, 4096, 100000, 5, 64, kFar + 1, kFar, 262143, 262144, 17, kFar + 1 };
+    constexpr size_t kNumTimers  = ArraySize(awakenTimes);
+    Timer * timers[kNumTimers];
+
+    TimerPool<Timer> pool;
+    TimerWheel wheel;
+    EXPECT_EQ(wheel.Remove(nullptr), nullptr);
+    EXPECT_EQ(wheel.Remove(nullptr, nullptr), nullptr);
+    EXPECT_EQ(wheel.PopEarliest(), nullptr);
+    EXPECT_EQ(wheel.Earliest(), nullptr);
+    EXPECT_TRUE(wheel.Empty());
+    EXPECT_TRUE(wheel.ExtractEarlier(Clock::Timestamp(1)).Empty());
+
+    for (size_t i = 0; i < kNumTimers; i++)
+    {
+        TimerCompleteCallback onComplete = (i % 2) ? TestState::Second : TestState::First;
+        timers[i]                        = pool.Create(mLayer, Clock::Timestamp(awakenTimes[i]), onComplete, &appState[i % 3]);
+        ASSERT_NE(timers[i], nullptr);
+        wheel.Add(timers[i]);
+    }
+    EXPECT_FALSE(wheel.Empty());
+    EXPECT_EQ(wheel.Earliest(), timers[1]);
+
+    // Expected expiration order: by time, then by order of addition.
+    size_t expected[kNumTimers];
+    size_t numExpected = 0;
+    for (size_t i = 0; i < kNumTimers; i++)
+    {
+        size_t j = numExpected++;
+        for (; j > 0 && awakenTimes[i] < awakenTimes[expected[j - 1]]; j--)
+        {
+            expected[j] = expected[j - 1];
+        }
+        expected[j] = i;
+    }
+
+    // Removing by callback and state takes the earliest matching timer, and the first added on equal times.
+    EXPECT_EQ(wheel.Remove(TestState::Second, &appState[1]), timers[1]); // matches 1, 7, 13
+    EXPECT_EQ(wheel.Remove(TestState::First, &appState[2]), timers[8]);  // matches 2, 8, 14
+    EXPECT_EQ(wheel.Remove(TestState::First, &appState[1]), timers[4]);  // matches 4, 10
+    EXPECT_EQ(wheel.Remove(TestState::First, &appState[1]), timers[10]);
+    EXPECT_EQ(wheel.Remove(TestState::First, &appState[1]), nullptr);
+    EXPECT_EQ(wheel.GetRemainingTime(TestState::First, &appState[1]), Clock::kZero);
+    EXPECT_EQ(wheel.Earliest(), timers[0]);
+    EXPECT_EQ(wheel.Remove(timers[2]), timers[0]);
+    EXPECT_EQ(wheel.Remove(timers[2]), timers[0]);
+    const size_t removedTimers[] = { 1, 8, 4, 10, 2 };
+    for (size_t removed : removedTimers)
+    {
+        size_t k = 0;
+        for (size_t j = 0; j < numExpected; j++)
+        {
+            if (expected[j] != removed)
+            {
+                expected[k++] = expected[j];
+            }
+        }
+        numExpected = k;
+    }
+
+    size_t numExtracted        = 0;
+    const uint64_t extractAt[] = { 1, 6, 64, 65, 66, 5000, 262144, 300000, kFar, kFar + 2 };
+    for (uint64_t t : extractAt)
+    {
+        TimerList early = wheel.ExtractEarlier(Clock::Timestamp(t));
+        for (TimerList::Node * timer = early.PopEarliest(); timer != nullptr; timer = early.PopEarliest())
+        {
+            ASSERT_LT(numExtracted, numExpected);
+            EXPECT_EQ(timer, timers[expected[numExtracted]]);
+            EXPECT_LT(timer->AwakenTime(), Clock::Timestamp(t));
+            numExtracted++;
+        }
+        if (!wheel.Empty())
+        {
+            EXPECT_GE(wheel.Earliest()->AwakenTime(), Clock::Timestamp(t));
+        }
+    }
+    EXPECT_EQ(numExtracted, numExpected);
+    EXPECT_TRUE(wheel.Empty());
+
+    // A timer that is already due is returned first, even though the wheel has moved past it.
+    wheel.Add(timers[3]);
+    wheel.Add(timers[0]);
+    EXPECT_EQ(wheel.Earliest(), timers[0]);
+    EXPECT_EQ(wheel.PopEarliest(), timers[0]);
+    TimerList early = wheel.ExtractEarlier(Clock::Timestamp(kFar + 3));
+    EXPECT_EQ(early.PopEarliest(), timers[3]);
+    EXPECT_EQ(early.PopEarliest(), nullptr);
+
+    wheel.Add(timers[0]);
+    wheel.Clear();
+    EXPECT_TRUE(wheel.Empty());
+    EXPECT_EQ(wheel.Earliest(), nullptr);
+
+    pool.ReleaseAll();
+}
+
 TEST_F(TestSystemTimer, ExtendTimerToTest)
 {
     if (!LayerEvents<LayerImpl>::HasServiceEvents())
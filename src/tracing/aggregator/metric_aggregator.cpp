@@ -0,0 +1,250 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <tracing/aggregator/metric_aggregator.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <tracing/metric_event.h>
+
+#include <algorithm>
+#include <mutex>
+
+namespace chip {
+namespace Tracing {
+namespace Aggregator {
+
+namespace {
+
+/// Index of the bucket counting a sample: 0 for samples <= 0, otherwise the bit length of the sample
+size_t BucketIndex(int64_t value)
+{
+    size_t index = 0;
+    for (uint64_t remaining = value > 0 ? static_cast<uint64_t>(value) : 0; remaining != 0; remaining >>= 1)
+    {
+        index++;
+    }
+    return std::min(index, MetricAggregate::kBucketCount - 1);
+}
+
+/// Largest sample counted by a bucket
+int64_t BucketUpperBound(size_t index)
+{
+    return index == 0 ? 0 : static_cast<int64_t>((uint64_t(1) << index) - 1);
+}
+
+} // namespace
+
+int64_t MetricAggregate::Percentile(uint8_t percent) const
+{
+    VerifyOrReturnValue(count > 0, 0);
+
+    // Rank of the sample at the given percentile, rounded up, in [1, count]
+    const uint64_t rank = std::max<uint64_t>(1, (static_cast<uint64_t>(std::min<uint8_t>(percent, 100)) * count + 99) / 100);
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBucketCount; i++)
+    {
+        seen += buckets[i];
+        if (seen >= rank)
+        {
+            return std::clamp(BucketUpperBound(i), min, max);
+        }
+    }
+
+    return max;
+}
+
+void MetricAggregatorBase::Open()
+{
+    LogErrorOnFailure(System::Mutex::Init(mLock));
+    std::lock_guard<System::Mutex> lock(mLock);
+    ResetLocked();
+}
+
+void MetricAggregatorBase::Close()
+{
+    StopPeriodicSnapshots();
+}
+
+void MetricAggregatorBase::LogMetricEvent(const MetricEvent & event)
+{
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    Slot * slot = FindOrAllocateSlot(event.key());
+    if (slot == nullptr)
+    {
+        mDroppedEvents++;
+        return;
+    }
+
+    MetricAggregate & aggregate = slot->aggregate;
+
+    if (event.ValueType() == MetricEvent::Value::Type::kChipErrorCode &&
+        ChipError(event.ValueErrorCode()) != CHIP_NO_ERROR)
+    {
+        aggregate.errorCount++;
+    }
+
+    switch (event.type())
+    {
+    case MetricEvent::Type::kBeginEvent:
+        slot->beginTime = now;
+        slot->hasBegin  = true;
+        break;
+    case MetricEvent::Type::kEndEvent:
+        // The duration of the operation is the sample, whether it succeeded or not
+        if (slot->hasBegin)
+        {
+            AddSample(aggregate, static_cast<int64_t>((now - slot->beginTime).count()));
+            slot->hasBegin = false;
+        }
+        break;
+    case MetricEvent::Type::kInstantEvent:
+        switch (event.ValueType())
+        {
+        case MetricEvent::Value::Type::kInt32:
+            AddSample(aggregate, event.ValueInt32());
+            break;
+        case MetricEvent::Value::Type::kUInt32:
+            AddSample(aggregate, event.ValueUInt32());
+            break;
+        case MetricEvent::Value::Type::kChipErrorCode:
+        case MetricEvent::Value::Type::kUndefined:
+            // Occurrences without a value are counted as zero samples
+            AddSample(aggregate, 0);
+            break;
+        }
+        break;
+    }
+}
+
+void MetricAggregatorBase::Snapshot(SnapshotDelegate & delegate, bool reset)
+{
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    for (size_t i = 0; i < mSlotCount; i++)
+    {
+        const MetricAggregate & aggregate = mSlots[i].aggregate;
+        if (aggregate.key != nullptr && (aggregate.count > 0 || aggregate.errorCount > 0))
+        {
+            delegate.OnMetricSnapshot(aggregate);
+        }
+    }
+
+    delegate.OnSnapshotDone(now - mWindowStart, mDroppedEvents);
+
+    if (reset)
+    {
+        ResetLocked();
+        mWindowStart = now;
+    }
+}
+
+void MetricAggregatorBase::Reset()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+    ResetLocked();
+}
+
+CHIP_ERROR MetricAggregatorBase::StartPeriodicSnapshots(System::Layer & layer, System::Clock::Timeout interval,
+                                                        SnapshotDelegate & delegate)
+{
+    VerifyOrReturnError(interval > System::Clock::kZero, CHIP_ERROR_INVALID_ARGUMENT);
+
+    StopPeriodicSnapshots();
+    ReturnErrorOnFailure(layer.StartTimer(interval, OnSnapshotTimer, this));
+
+    mSystemLayer      = &layer;
+    mSnapshotDelegate = &delegate;
+    mSnapshotInterval = interval;
+
+    return CHIP_NO_ERROR;
+}
+
+void MetricAggregatorBase::StopPeriodicSnapshots()
+{
+    VerifyOrReturn(mSystemLayer != nullptr);
+
+    mSystemLayer->CancelTimer(OnSnapshotTimer, this);
+    mSystemLayer      = nullptr;
+    mSnapshotDelegate = nullptr;
+}
+
+void MetricAggregatorBase::OnSnapshotTimer(System::Layer * layer, void * context)
+{
+    auto * self = static_cast<MetricAggregatorBase *>(context);
+    VerifyOrReturn(self->mSnapshotDelegate != nullptr);
+
+    self->Snapshot(*self->mSnapshotDelegate, /* reset = */ true);
+    LogErrorOnFailure(layer->StartTimer(self->mSnapshotInterval, OnSnapshotTimer, self));
+}
+
+MetricAggregatorBase::Slot * MetricAggregatorBase::FindOrAllocateSlot(MetricKey key)
+{
+    Slot * freeSlot = nullptr;
+
+    // Metric keys are constant strings, compare them by address first
+    for (size_t i = 0; i < mSlotCount; i++)
+    {
+        MetricKey slotKey = mSlots[i].aggregate.key;
+        if (slotKey == nullptr)
+        {
+            freeSlot = (freeSlot == nullptr) ? &mSlots[i] : freeSlot;
+            continue;
+        }
+        if (slotKey == key || strcmp(slotKey, key) == 0)
+        {
+            return &mSlots[i];
+        }
+    }
+
+    VerifyOrReturnValue(freeSlot != nullptr, nullptr);
+    freeSlot->aggregate.key = key;
+    return freeSlot;
+}
+
+void MetricAggregatorBase::ResetLocked()
+{
+    // Keep the keys, so that a metric keeps its slot and a pending begin event is not lost
+    for (size_t i = 0; i < mSlotCount; i++)
+    {
+        MetricAggregate & aggregate = mSlots[i].aggregate;
+        MetricKey key               = aggregate.key;
+        aggregate                   = MetricAggregate();
+        aggregate.key               = key;
+    }
+
+    mDroppedEvents = 0;
+    mWindowStart   = System::SystemClock().GetMonotonicTimestamp();
+}
+
+void MetricAggregatorBase::AddSample(MetricAggregate & aggregate, int64_t value)
+{
+    aggregate.min = (aggregate.count == 0) ? value : std::min(aggregate.min, value);
+    aggregate.max = (aggregate.count == 0) ? value : std::max(aggregate.max, value);
+    aggregate.sum += value;
+    aggregate.count++;
+    aggregate.buckets[BucketIndex(value)]++;
+}
+
+} // namespace Aggregator
+} // namespace Tracing
+} // namespace chip
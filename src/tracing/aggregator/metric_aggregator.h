@@ -0,0 +1,150 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+#include <system/SystemMutex.h>
+#include <tracing/backend.h>
+#include <tracing/metric_keys.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace Tracing {
+namespace Aggregator {
+
+/// Aggregated values of a single metric key.
+///
+/// Samples are the values of instant metric events and, for metrics logged with
+/// MATTER_LOG_METRIC_BEGIN/END, the time between the two events in milliseconds.
+///
+/// The histogram uses power-of-two buckets: bucket 0 counts samples <= 0 and bucket
+/// i > 0 counts samples in [2^(i-1), 2^i).
+struct MetricAggregate
+{
+    static constexpr size_t kBucketCount = 33;
+
+    MetricKey key                  = nullptr;
+    uint32_t count                 = 0; // number of samples
+    uint32_t errorCount            = 0; // number of events reporting a CHIP_ERROR other than CHIP_NO_ERROR
+    int64_t sum                    = 0;
+    int64_t min                    = 0;
+    int64_t max                    = 0;
+    uint32_t buckets[kBucketCount] = {};
+
+    /// Returns an upper bound of the given percentile (0-100) of the samples,
+    /// i.e. the upper limit of the bucket it falls into, clamped to the maximum.
+    int64_t Percentile(uint8_t percent) const;
+
+    /// Returns the average of the samples, rounded towards zero, or 0 without samples
+    int64_t Mean() const { return count == 0 ? 0 : sum / static_cast<int64_t>(count); }
+};
+
+/// Receives snapshots of the aggregated metrics
+class SnapshotDelegate
+{
+public:
+    virtual ~SnapshotDelegate() = default;
+
+    /// Called for each metric that received events since it was last reset
+    virtual void OnMetricSnapshot(const MetricAggregate & aggregate) = 0;
+
+    /// Called once all metrics of a snapshot have been reported, with the time since the aggregates were
+    /// last reset and the number of events dropped because there was no room for their key
+    virtual void OnSnapshotDone(System::Clock::Milliseconds64 windowDuration, uint32_t droppedEvents) {}
+};
+
+/// A Backend that aggregates metric events into per-key counters and histograms
+/// instead of logging every occurrence, so that fleet telemetry may ingest
+/// percentiles (e.g. of the CASE session establishment or DNS-SD resolve time).
+///
+/// Tracing and data logging events other than metrics are ignored.
+///
+/// THREAD SAFETY:
+///   Events may be recorded from any thread: the aggregates are protected by a mutex,
+///   which is held while a snapshot is reported to the delegate.
+class MetricAggregatorBase : public ::chip::Tracing::Backend
+{
+public:
+    void Open() override;
+    void Close() override;
+
+    void LogMetricEvent(const MetricEvent & event) override;
+
+    /// Report the current aggregates to the delegate, and reset them if requested
+    void Snapshot(SnapshotDelegate & delegate, bool reset = false);
+
+    /// Reset all aggregates
+    void Reset();
+
+    /// Report and reset the aggregates every interval, from the given system layer.
+    /// Must be called with the Matter stack lock held.
+    CHIP_ERROR StartPeriodicSnapshots(System::Layer & layer, System::Clock::Timeout interval, SnapshotDelegate & delegate);
+
+    /// Stop the periodic snapshots. Must be called with the Matter stack lock held.
+    void StopPeriodicSnapshots();
+
+protected:
+    /// Aggregation state of a metric key
+    struct Slot
+    {
+        MetricAggregate aggregate;
+        System::Clock::Timestamp beginTime;
+        bool hasBegin = false;
+    };
+
+    MetricAggregatorBase(Slot * slots, size_t slotCount) : mSlots(slots), mSlotCount(slotCount) {}
+
+private:
+    static void OnSnapshotTimer(System::Layer * layer, void * context);
+
+    Slot * FindOrAllocateSlot(MetricKey key);
+    void ResetLocked();
+    static void AddSample(MetricAggregate & aggregate, int64_t value);
+
+    Slot * mSlots;
+    size_t mSlotCount;
+    uint32_t mDroppedEvents = 0;
+    System::Clock::Timestamp mWindowStart{ 0 };
+    System::Mutex mLock;
+
+    System::Layer * mSystemLayer         = nullptr;
+    SnapshotDelegate * mSnapshotDelegate = nullptr;
+    System::Clock::Timeout mSnapshotInterval{ 0 };
+};
+
+/// Metric aggregator with storage for kMaxMetrics metric keys. Events of further keys
+/// are counted as dropped.
+template <size_t kMaxMetrics = 32>
+class MetricAggregator : public MetricAggregatorBase
+{
+public:
+    static_assert(kMaxMetrics > 0, "The aggregator must hold at least one metric");
+
+    MetricAggregator() : MetricAggregatorBase(mSlotStorage, kMaxMetrics) {}
+
+private:
+    Slot mSlotStorage[kMaxMetrics];
+};
+
+} // namespace Aggregator
+} // namespace Tracing
+} // namespace chip
@@ -70,6 +70,7 @@ public:
     virtual void LogNodeLookup(NodeLookupInfo &) { TraceInstant("Lookup", "DNSSD"); }
     virtual void LogNodeDiscovered(NodeDiscoveredInfo &) { TraceInstant("Node Discovered", "DNSSD"); }
     virtual void LogNodeDiscoveryFailed(NodeDiscoveryFailedInfo &) { TraceInstant("Discovery Failed", "DNSSD"); }
+    virtual void LogExchangeEvent(ExchangeEventInfo &) { TraceInstant("Exchange Event", "Messaging"); }
     virtual void LogMetricEvent(const MetricEvent &) { TraceInstant("Metric Event", "Metric"); }
 };
 
@@ -0,0 +1,267 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <tracing/binary/binary_tracing.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/BytesToHex.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TypeTraits.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+#include <tracing/metric_event.h>
+#include <transport/TracingStructs.h>
+
+#include <algorithm>
+#include <string.h>
+
+namespace chip {
+namespace Tracing {
+namespace Binary {
+
+namespace {
+
+constexpr uint8_t kMagic[] = { 'M', 'T', 'R', 'B' };
+
+/// Longest string that can be serialized, as its length is stored on a single byte
+constexpr size_t kMaxStringLength = UINT8_MAX;
+
+/// Number of serialized bytes logged per line by DumpToLog
+constexpr size_t kLogBytesPerLine = 32;
+
+class LogDumpWriter : public DumpWriter
+{
+public:
+    CHIP_ERROR Write(ByteSpan data) override
+    {
+        while (!data.empty())
+        {
+            const size_t length = std::min(data.size(), kLogBytesPerLine);
+            char hex[kLogBytesPerLine * 2 + 1];
+
+            ReturnErrorOnFailure(Encoding::BytesToUppercaseHexString(data.data(), length, hex, sizeof(hex)));
+            ChipLogProgress(Automation, "%s%s", BinaryBackendBase::kLogLinePrefix, hex);
+            data = data.SubSpan(length);
+        }
+
+        return CHIP_NO_ERROR;
+    }
+};
+
+} // namespace
+
+void BinaryBackendBase::TraceBegin(const char * label, const char * group)
+{
+    Append(RecordType::kBegin, Intern(label), Intern(group));
+}
+
+void BinaryBackendBase::TraceEnd(const char * label, const char * group)
+{
+    Append(RecordType::kEnd, Intern(label), Intern(group));
+}
+
+void BinaryBackendBase::TraceInstant(const char * label, const char * group)
+{
+    Append(RecordType::kInstant, Intern(label), Intern(group));
+}
+
+void BinaryBackendBase::TraceCounter(const char * label)
+{
+    Append(RecordType::kCounter, Intern(label), kNoStringId);
+}
+
+void BinaryBackendBase::LogMetricEvent(const MetricEvent & event)
+{
+    RecordType type = RecordType::kMetricInstant;
+    switch (event.type())
+    {
+    case MetricEvent::Type::kBeginEvent:
+        type = RecordType::kMetricBegin;
+        break;
+    case MetricEvent::Type::kEndEvent:
+        type = RecordType::kMetricEnd;
+        break;
+    case MetricEvent::Type::kInstantEvent:
+        type = RecordType::kMetricInstant;
+        break;
+    }
+
+    uint32_t value = 0;
+    switch (event.ValueType())
+    {
+    case MetricEvent::Value::Type::kInt32:
+        value = static_cast<uint32_t>(event.ValueInt32());
+        break;
+    case MetricEvent::Value::Type::kUInt32:
+        value = event.ValueUInt32();
+        break;
+    case MetricEvent::Value::Type::kChipErrorCode:
+        value = event.ValueErrorCode();
+        break;
+    case MetricEvent::Value::Type::kUndefined:
+        break;
+    }
+
+    Append(type, Intern(event.key()), kNoStringId, to_underlying(event.ValueType()), value);
+}
+
+void BinaryBackendBase::LogExchangeEvent(ExchangeEventInfo & info)
+{
+    const uint32_t durationUs = static_cast<uint32_t>(std::min<uint64_t>(info.duration.count(), UINT32_MAX));
+    const char * role         = info.isInitiator ? "Initiator" : "Responder";
+
+    Append(RecordType::kExchange, Intern(ExchangeEventTypeToString(info.type)), Intern(role),
+           to_underlying(MetricEvent::Value::Type::kUInt32), durationUs, info.exchangeId);
+}
+
+uint16_t BinaryBackendBase::Intern(const char * str)
+{
+    VerifyOrReturnValue(str != nullptr, kNoStringId);
+
+    // Strings are constant, so their address identifies them. Open addressing keeps
+    // the lookup lock-free: a slot never changes once claimed.
+    const size_t start = static_cast<size_t>((reinterpret_cast<uintptr_t>(str) >> 2) % mStringCount);
+
+    for (size_t i = 0; i < mStringCount; i++)
+    {
+        const size_t index               = (start + i) % mStringCount;
+        const char * expected            = nullptr;
+        std::atomic<const char *> & slot = mStrings[index];
+
+        if (slot.load(std::memory_order_acquire) == str ||
+            slot.compare_exchange_strong(expected, str, std::memory_order_acq_rel, std::memory_order_acquire) ||
+            expected == str)
+        {
+            return static_cast<uint16_t>(index + 1);
+        }
+    }
+
+    // Table full: the event is still recorded, but without its string
+    return kNoStringId;
+}
+
+void BinaryBackendBase::Append(RecordType type, uint16_t labelId, uint16_t groupId, uint8_t valueType, uint32_t value,
+                               uint16_t exchangeId)
+{
+    const uint32_t sequence = mNextSequence.fetch_add(1, std::memory_order_relaxed);
+    RecordSlot & slot       = mSlots[sequence % mSlotCount];
+
+    slot.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.record.timestampUs = static_cast<uint32_t>(System::SystemClock().GetMonotonicMicroseconds64().count());
+    slot.record.labelId     = labelId;
+    slot.record.groupId     = groupId;
+    slot.record.type        = type;
+    slot.record.valueType   = valueType;
+    slot.record.exchangeId  = exchangeId;
+    slot.record.value       = value;
+
+    slot.sequence.store(sequence + 1, std::memory_order_release);
+}
+
+CHIP_ERROR BinaryBackendBase::Dump(DumpWriter & writer) const
+{
+    const uint32_t nextSequence = mNextSequence.load(std::memory_order_acquire);
+
+    uint16_t stringCount = 0;
+    for (size_t i = 0; i < mStringCount; i++)
+    {
+        stringCount = static_cast<uint16_t>(stringCount + (mStrings[i].load(std::memory_order_acquire) != nullptr ? 1 : 0));
+    }
+
+    uint8_t header[kHeaderWireSize];
+    memcpy(header, kMagic, sizeof(kMagic));
+    header[4] = kFormatVersion;
+    header[5] = static_cast<uint8_t>(kRecordWireSize);
+    Encoding::LittleEndian::Put16(&header[6], stringCount);
+    Encoding::LittleEndian::Put32(&header[8], nextSequence);
+    ReturnErrorOnFailure(writer.Write(ByteSpan(header)));
+
+    // Write at most the strings that were counted. When tracing concurrently, a string
+    // interned meanwhile may take the place of a counted one and its records are then
+    // decoded without a name.
+    for (size_t i = 0; i < mStringCount && stringCount > 0; i++)
+    {
+        const char * str = mStrings[i].load(std::memory_order_acquire);
+        if (str == nullptr)
+        {
+            continue;
+        }
+
+        const size_t length = std::min(strlen(str), kMaxStringLength);
+        uint8_t stringHeader[3];
+        Encoding::LittleEndian::Put16(&stringHeader[0], static_cast<uint16_t>(i + 1));
+        stringHeader[2] = static_cast<uint8_t>(length);
+        ReturnErrorOnFailure(writer.Write(ByteSpan(stringHeader)));
+        ReturnErrorOnFailure(writer.Write(ByteSpan(reinterpret_cast<const uint8_t *>(str), length)));
+        stringCount--;
+    }
+
+    const uint32_t firstSequence = nextSequence > mSlotCount ? static_cast<uint32_t>(nextSequence - mSlotCount) : 0;
+    for (uint32_t sequence = firstSequence; sequence != nextSequence; sequence++)
+    {
+        const RecordSlot & slot = mSlots[sequence % mSlotCount];
+
+        if (slot.sequence.load(std::memory_order_acquire) != sequence + 1)
+        {
+            continue;
+        }
+
+        Record record = slot.record;
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        // Skip records overwritten while they were copied
+        if (slot.sequence.load(std::memory_order_relaxed) != sequence + 1)
+        {
+            continue;
+        }
+
+        uint8_t buffer[kRecordWireSize];
+        Encoding::LittleEndian::Put32(&buffer[0], sequence);
+        Encoding::LittleEndian::Put32(&buffer[4], record.timestampUs);
+        Encoding::LittleEndian::Put16(&buffer[8], record.labelId);
+        Encoding::LittleEndian::Put16(&buffer[10], record.groupId);
+        buffer[12] = to_underlying(record.type);
+        buffer[13] = record.valueType;
+        Encoding::LittleEndian::Put16(&buffer[14], record.exchangeId);
+        Encoding::LittleEndian::Put32(&buffer[16], record.value);
+        ReturnErrorOnFailure(writer.Write(ByteSpan(buffer)));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BinaryBackendBase::DumpToLog() const
+{
+    LogDumpWriter writer;
+    return Dump(writer);
+}
+
+void BinaryBackendBase::Clear()
+{
+    for (size_t i = 0; i < mSlotCount; i++)
+    {
+        mSlots[i].sequence.store(0, std::memory_order_relaxed);
+    }
+    mNextSequence.store(0, std::memory_order_release);
+}
+
+} // namespace Binary
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,159 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/Span.h>
+#include <tracing/backend.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace Tracing {
+namespace Binary {
+
+/// Type of an event stored by the binary backend
+enum class RecordType : uint8_t
+{
+    kBegin         = 0,
+    kEnd           = 1,
+    kInstant       = 2,
+    kCounter       = 3,
+    kMetricBegin   = 4,
+    kMetricEnd     = 5,
+    kMetricInstant = 6,
+    kExchange      = 7,
+};
+
+/// Fixed-size event stored in the ring buffer of the binary backend.
+///
+/// Strings are not copied: labels, groups and metric keys are constant strings,
+/// so they are interned by address and referred to by their ID.
+struct Record
+{
+    uint32_t timestampUs; // lower 32 bits of the monotonic time in microseconds
+    uint16_t labelId;     // label, metric key or exchange stage
+    uint16_t groupId;     // group, "Initiator"/"Responder" for exchanges, or kNoStringId for counters and metrics
+    RecordType type;
+    uint8_t valueType;   // MetricEvent::Value::Type for metrics
+    uint16_t exchangeId; // exchange ID for exchanges
+    uint32_t value;      // metric value, or duration of an exchange stage in microseconds
+};
+
+/// Ring buffer slot. The sequence number is written last, so that a reader can
+/// detect a record that is being overwritten.
+struct RecordSlot
+{
+    std::atomic<uint32_t> sequence{ 0 }; // record sequence number + 1, 0 while empty or being written
+    Record record;
+};
+
+/// Receives the serialized content of a binary backend in successive pieces
+class DumpWriter
+{
+public:
+    virtual ~DumpWriter() = default;
+
+    virtual CHIP_ERROR Write(ByteSpan data) = 0;
+};
+
+/// A Backend that stores events as fixed-size binary records in a ring buffer.
+///
+/// Recording an event does not format nor copy any string, so the backend is cheap
+/// enough to stay enabled in production builds. The buffer is dumped on demand
+/// (e.g. from a shell command or an RPC) and decoded on a host using
+/// scripts/tools/decode_binary_trace.py.
+///
+/// Serialized format (little-endian):
+///   - header:  "MTRB", version (1B), record size (1B), string count (2B),
+///              number of records ever written (4B)
+///   - strings: ID (2B), length (1B), characters
+///   - records: sequence number (4B), Record fields in declaration order (16B)
+///
+/// Records are written oldest first. When the buffer wraps, the oldest records are
+/// overwritten and missing sequence numbers tell how many events were lost.
+///
+/// THREAD SAFETY:
+///   Events may be recorded concurrently from any thread without locking: writers
+///   claim a slot with an atomic increment and intern strings with compare-exchange.
+///   Records being overwritten while a dump is in progress are skipped.
+class BinaryBackendBase : public ::chip::Tracing::Backend
+{
+public:
+    static constexpr uint16_t kNoStringId   = 0;
+    static constexpr uint8_t kFormatVersion = 1;
+    static constexpr size_t kRecordWireSize = 20;
+    static constexpr size_t kHeaderWireSize = 12;
+    static constexpr char kLogLinePrefix[]  = "btrace\t";
+
+    void TraceBegin(const char * label, const char * group) override;
+    void TraceEnd(const char * label, const char * group) override;
+    void TraceInstant(const char * label, const char * group) override;
+    void TraceCounter(const char * label) override;
+    void LogMetricEvent(const MetricEvent & event) override;
+    void LogExchangeEvent(ExchangeEventInfo & info) override;
+
+    /// Serialize the strings and records to the given writer
+    CHIP_ERROR Dump(DumpWriter & writer) const;
+
+    /// Serialize the strings and records to chip logging as hex lines prefixed with kLogLinePrefix
+    CHIP_ERROR DumpToLog() const;
+
+    /// Discard all records. Records being written concurrently are dropped as well.
+    void Clear();
+
+    /// Total number of records written, including the ones that have been overwritten
+    uint32_t RecordsWritten() const { return mNextSequence.load(std::memory_order_relaxed); }
+
+protected:
+    BinaryBackendBase(RecordSlot * slots, size_t slotCount, std::atomic<const char *> * strings, size_t stringCount) :
+        mSlots(slots), mSlotCount(slotCount), mStrings(strings), mStringCount(stringCount)
+    {}
+
+private:
+    uint16_t Intern(const char * str);
+    void Append(RecordType type, uint16_t labelId, uint16_t groupId, uint8_t valueType = 0, uint32_t value = 0,
+                uint16_t exchangeId = 0);
+
+    RecordSlot * mSlots;
+    size_t mSlotCount;
+    std::atomic<const char *> * mStrings;
+    size_t mStringCount;
+    std::atomic<uint32_t> mNextSequence{ 0 };
+};
+
+/// Binary backend with storage for kRecordCount records and kStringCount interned strings
+template <size_t kRecordCount, size_t kStringCount = 128>
+class BinaryBackend : public BinaryBackendBase
+{
+public:
+    static_assert(kRecordCount > 0, "The ring buffer must hold at least one record");
+    static_assert(kStringCount > 0 && kStringCount < UINT16_MAX, "String IDs are 16-bit and 0 is reserved");
+
+    BinaryBackend() : BinaryBackendBase(mSlotStorage, kRecordCount, mStringStorage, kStringCount) {}
+
+private:
+    RecordSlot mSlotStorage[kRecordCount];
+    std::atomic<const char *> mStringStorage[kStringCount] = {};
+};
+
+} // namespace Binary
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,95 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <tracing/binary/shell_commands.h>
+
+#include <lib/shell/Engine.h>
+#include <lib/shell/SubShellCommand.h>
+#include <lib/shell/streamer.h>
+#include <lib/support/BytesToHex.h>
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace Tracing {
+namespace Binary {
+
+namespace {
+
+using namespace chip::Shell;
+
+/// Number of serialized bytes printed per line
+constexpr size_t kBytesPerLine = 32;
+
+BinaryBackendBase * gBackend = nullptr;
+
+class StreamerDumpWriter : public DumpWriter
+{
+public:
+    CHIP_ERROR Write(ByteSpan data) override
+    {
+        while (!data.empty())
+        {
+            const size_t length = std::min(data.size(), kBytesPerLine);
+            char hex[kBytesPerLine * 2 + 1];
+
+            ReturnErrorOnFailure(Encoding::BytesToUppercaseHexString(data.data(), length, hex, sizeof(hex)));
+            streamer_printf(streamer_get(), "%s%s\r\n", BinaryBackendBase::kLogLinePrefix, hex);
+            data = data.SubSpan(length);
+        }
+
+        return CHIP_NO_ERROR;
+    }
+};
+
+CHIP_ERROR DumpHandler(int argc, char ** argv)
+{
+    VerifyOrReturnError(gBackend != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(argc == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    StreamerDumpWriter writer;
+    return gBackend->Dump(writer);
+}
+
+CHIP_ERROR ClearHandler(int argc, char ** argv)
+{
+    VerifyOrReturnError(gBackend != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(argc == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    gBackend->Clear();
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+void RegisterShellCommands(BinaryBackendBase & backend)
+{
+    static constexpr Command subCommands[] = { { &DumpHandler, "dump", "Print the binary trace records as hex lines" },
+                                               { &ClearHandler, "clear", "Discard the binary trace records" } };
+
+    static constexpr Command traceCommand = { &SubShellCommand<ArraySize(subCommands), subCommands>, "trace",
+                                              "Binary tracing commands" };
+
+    gBackend = &backend;
+    Engine::Root().RegisterCommands(&traceCommand, 1);
+}
+
+} // namespace Binary
+} // namespace Tracing
+} // namespace chip
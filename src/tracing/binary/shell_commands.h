@@ -0,0 +1,36 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <tracing/binary/binary_tracing.h>
+
+namespace chip {
+namespace Tracing {
+namespace Binary {
+
+/// Register the "trace" shell command operating on the given backend:
+///   - "trace dump" prints the serialized records as hex lines that
+///     scripts/tools/decode_binary_trace.py decodes
+///   - "trace clear" discards all records
+///
+/// The backend must outlive the shell.
+void RegisterShellCommands(BinaryBackendBase & backend);
+
+} // namespace Binary
+} // namespace Tracing
+} // namespace chip
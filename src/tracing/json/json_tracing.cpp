@@ -378,6 +378,23 @@ void JsonBackend::LogMessageReceived(MessageReceivedInfo & info)
     OutputValue(value);
 }
 
+void JsonBackend::LogExchangeEvent(ExchangeEventInfo & info)
+{
+    ::Json::Value value;
+
+    value["event"]       = "ExchangeEvent";
+    value["stage"]       = ExchangeEventTypeToString(info.type);
+    value["exchange_id"] = info.exchangeId;
+    value["initiator"]   = info.isInitiator;
+    value["duration_us"] = static_cast<::Json::UInt64>(info.duration.count());
+    if (info.session != nullptr)
+    {
+        value["session_id"] = info.session->SessionIdForLogging();
+    }
+
+    OutputValue(value);
+}
+
 void JsonBackend::LogNodeLookup(NodeLookupInfo & info)
 {
     ::Json::Value value;
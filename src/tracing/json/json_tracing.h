@@ -58,6 +58,7 @@ public:
     void LogNodeLookup(NodeLookupInfo &) override;
     void LogNodeDiscovered(NodeDiscoveredInfo &) override;
     void LogNodeDiscoveryFailed(NodeDiscoveryFailedInfo &) override;
+    void LogExchangeEvent(ExchangeEventInfo &) override;
     void LogMetricEvent(const MetricEvent &) override;
     void Close() override { CloseFile(); }
 
@@ -27,6 +27,7 @@ struct MessageReceivedInfo;
 struct NodeLookupInfo;
 struct NodeDiscoveredInfo;
 struct NodeDiscoveryFailedInfo;
+struct ExchangeEventInfo;
 class MetricEvent;
 
 } // namespace Tracing
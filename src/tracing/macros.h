@@ -71,6 +71,13 @@
         ::chip::Tracing::Internal::LogNodeDiscoveryFailed(_trace_data);                                                            \
     } while (false)
 
+#define MATTER_LOG_EXCHANGE_EVENT(...)                                                                                             \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        ::chip::Tracing::ExchangeEventInfo _trace_data{ __VA_ARGS__ };                                                             \
+        ::chip::Tracing::Internal::LogExchangeEvent(_trace_data);                                                                  \
+    } while (false)
+
 #else // MATTER_TRACING_ENABLED
 
 #define _MATTER_TRACE_DISABLE(...)                                                                                                 \
@@ -91,4 +98,6 @@
 #define MATTER_LOG_NODE_DISCOVERED(...) _MATTER_TRACE_DISABLE(__VA_ARGS__)
 #define MATTER_LOG_NODE_DISCOVERY_FAILED(...) _MATTER_TRACE_DISABLE(__VA_ARGS__)
 
+#define MATTER_LOG_EXCHANGE_EVENT(...) _MATTER_TRACE_DISABLE(__VA_ARGS__)
+
 #endif // MATTER_TRACING_ENABLED
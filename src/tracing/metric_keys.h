@@ -75,8 +75,63 @@ constexpr MetricKey kMetricDeviceCASESessionSigmaFinished = "core_dev_case_sessi
 // MRP Retry Counter
 constexpr MetricKey kMetricDeviceRMPRetryCount = "core_dev_rmp_retry_count";
 
+// MRP round trip time measured from an acknowledgment, in milliseconds
+constexpr MetricKey kMetricDeviceRMPRoundTripTime = "core_dev_rmp_rtt";
+
+// MRP base retransmission timeout computed from the measured round trip time, in milliseconds
+constexpr MetricKey kMetricDeviceRMPAdaptiveRetransTimeout = "core_dev_rmp_adaptive_retrans_timeout";
+
 // Subscription setup
 constexpr MetricKey kMetricDeviceSubscriptionSetup = "core_dev_subscription_setup";
 
+// Resumption of the persisted subscriptions, from the first peer queued until the last one completes
+constexpr MetricKey kMetricDeviceSubscriptionResumption = "core_dev_subscription_resumption";
+
+// Number of persisted subscriptions resumed on the CASE session established with a peer
+constexpr MetricKey kMetricDeviceSubscriptionResumptionResumedCount = "core_dev_subscription_resumption_resumed_ctr";
+
+// Number of persisted subscriptions of a peer that failed to resume
+constexpr MetricKey kMetricDeviceSubscriptionResumptionFailedCount = "core_dev_subscription_resumption_failed_ctr";
+
+// Cluster whose interaction model statistics follow, see chip::app::ClusterStatistics::PublishMetrics()
+constexpr MetricKey kMetricIMClusterStatsCluster = "im_cluster_stats_cluster";
+
+// Attribute or command of the cluster whose statistics follow, or 0xFFFFFFFF for the statistics of the whole cluster
+constexpr MetricKey kMetricIMClusterStatsElement = "im_cluster_stats_element";
+
+// Number of operations dropped from the cluster statistics, because all their entries were in use
+constexpr MetricKey kMetricIMClusterStatsDropped = "im_cluster_stats_dropped_ctr";
+
+// Number of attribute values written by a flush of the write-behind attribute persistence provider
+constexpr MetricKey kMetricAttributePersistenceFlushedWrites = "app_attr_persistence_flushed_writes";
+
+// Number of attribute writes the write-behind persistence provider coalesced with a pending write, since startup
+constexpr MetricKey kMetricAttributePersistenceCoalescedWrites = "app_attr_persistence_coalesced_writes_ctr";
+
+// Number of attribute writes the write-behind persistence provider could not hold back, since startup
+constexpr MetricKey kMetricAttributePersistenceWriteThroughs = "app_attr_persistence_write_throughs_ctr";
+
+// Trigger of the ICD ActiveMode period that just ended, see chip::app::ICDManager::ActiveModeTrigger. The metrics of the period
+// and the totals of its trigger follow.
+constexpr MetricKey kMetricICDActiveModeTrigger = "icd_active_mode_trigger";
+
+// Length of the ICD ActiveMode period that just ended, in milliseconds
+constexpr MetricKey kMetricICDActiveModeDuration = "icd_active_mode_duration";
+
+// Number of times the ICD ActiveMode period that just ended was extended
+constexpr MetricKey kMetricICDActiveModeExtensions = "icd_active_mode_extensions";
+
+// Number of ICD ActiveMode periods started by the trigger, since startup
+constexpr MetricKey kMetricICDActiveModeTriggerActivations = "icd_active_mode_trigger_activations_ctr";
+
+// Number of times the trigger extended an ICD ActiveMode period, since startup
+constexpr MetricKey kMetricICDActiveModeTriggerExtensions = "icd_active_mode_trigger_extensions_ctr";
+
+// ICD ActiveMode time of the periods started by the trigger, since startup, in milliseconds
+constexpr MetricKey kMetricICDActiveModeTriggerTime = "icd_active_mode_trigger_time_ctr";
+
+// Event loop callback that ran longer than CHIP_SYSTEM_CONFIG_SLOW_CALLBACK_THRESHOLD_MS, in milliseconds
+constexpr MetricKey kMetricSystemSlowCallback = "sys_slow_callback";
+
 } // namespace Tracing
 } // namespace chip
@@ -74,6 +74,17 @@ void PerfettoBackend::LogMessageSend(MessageSendInfo & info)
     );
 }
 
+void PerfettoBackend::LogExchangeEvent(ExchangeEventInfo & info)
+{
+    TRACE_EVENT_INSTANT(                               //
+        "Matter", "Exchange Event",                    //
+        "stage", ExchangeEventTypeToString(info.type), //
+        "exchange_id", info.exchangeId,                //
+        "initiator", info.isInitiator,                 //
+        "duration_us", info.duration.count()           //
+    );
+}
+
 void PerfettoBackend::LogNodeLookup(NodeLookupInfo & info)
 {
     TRACE_EVENT_INSTANT(                                                          //
@@ -44,6 +44,7 @@ public:
     void LogNodeLookup(NodeLookupInfo &) override;
     void LogNodeDiscovered(NodeDiscoveredInfo &) override;
     void LogNodeDiscoveryFailed(NodeDiscoveryFailedInfo &) override;
+    void LogExchangeEvent(ExchangeEventInfo &) override;
     void LogMetricEvent(const MetricEvent &) override;
 };
 
@@ -124,6 +124,14 @@ void LogNodeDiscoveryFailed(::chip::Tracing::NodeDiscoveryFailedInfo & info)
     }
 }
 
+void LogExchangeEvent(::chip::Tracing::ExchangeEventInfo & info)
+{
+    for (auto & backend : gTracingBackends)
+    {
+        backend.LogExchangeEvent(info);
+    }
+}
+
 void LogMetricEvent(const ::chip::Tracing::MetricEvent & event)
 {
     for (auto & backend : gTracingBackends)
@@ -83,6 +83,7 @@ void LogMessageReceived(::chip::Tracing::MessageReceivedInfo & info);
 void LogNodeLookup(::chip::Tracing::NodeLookupInfo & info);
 void LogNodeDiscovered(::chip::Tracing::NodeDiscoveredInfo & info);
 void LogNodeDiscoveryFailed(::chip::Tracing::NodeDiscoveryFailedInfo & info);
+void LogExchangeEvent(::chip::Tracing::ExchangeEventInfo & info);
 void LogMetricEvent(const ::chip::Tracing::MetricEvent & event);
 
 } // namespace Internal
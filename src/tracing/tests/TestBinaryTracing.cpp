@@ -0,0 +1,212 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <tracing/binary/binary_tracing.h>
+#include <tracing/metric_event.h>
+#include <transport/TracingStructs.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Tracing;
+using namespace chip::Tracing::Binary;
+
+namespace {
+
+class VectorDumpWriter : public DumpWriter
+{
+public:
+    CHIP_ERROR Write(ByteSpan data) override
+    {
+        mData.insert(mData.end(), data.begin(), data.end());
+        return CHIP_NO_ERROR;
+    }
+
+    std::vector<uint8_t> mData;
+};
+
+struct DecodedRecord
+{
+    uint32_t sequence;
+    std::string label;
+    std::string group;
+    RecordType type;
+    uint8_t valueType;
+    uint16_t exchangeId;
+    uint32_t value;
+};
+
+struct DecodedTrace
+{
+    uint32_t recordsWritten = 0;
+    std::vector<DecodedRecord> records;
+};
+
+DecodedTrace Decode(const std::vector<uint8_t> & data)
+{
+    DecodedTrace trace;
+    std::map<uint16_t, std::string> strings;
+
+    EXPECT_GE(data.size(), BinaryBackendBase::kHeaderWireSize);
+    EXPECT_EQ(std::string(data.begin(), data.begin() + 4), "MTRB");
+    EXPECT_EQ(data[4], BinaryBackendBase::kFormatVersion);
+    EXPECT_EQ(data[5], BinaryBackendBase::kRecordWireSize);
+
+    const uint16_t stringCount = Encoding::LittleEndian::Get16(&data[6]);
+    trace.recordsWritten       = Encoding::LittleEndian::Get32(&data[8]);
+
+    size_t offset = BinaryBackendBase::kHeaderWireSize;
+    for (uint16_t i = 0; i < stringCount; i++)
+    {
+        const uint16_t id    = Encoding::LittleEndian::Get16(&data[offset]);
+        const uint8_t length = data[offset + 2];
+        strings[id]          = std::string(data.begin() + static_cast<long>(offset + 3),
+                                           data.begin() + static_cast<long>(offset + 3 + length));
+        offset += 3u + length;
+    }
+
+    EXPECT_EQ((data.size() - offset) % BinaryBackendBase::kRecordWireSize, 0u);
+    for (; offset < data.size(); offset += BinaryBackendBase::kRecordWireSize)
+    {
+        DecodedRecord record;
+        record.sequence   = Encoding::LittleEndian::Get32(&data[offset]);
+        record.label      = strings[Encoding::LittleEndian::Get16(&data[offset + 8])];
+        record.group      = strings[Encoding::LittleEndian::Get16(&data[offset + 10])];
+        record.type       = static_cast<RecordType>(data[offset + 12]);
+        record.valueType  = data[offset + 13];
+        record.exchangeId = Encoding::LittleEndian::Get16(&data[offset + 14]);
+        record.value      = Encoding::LittleEndian::Get32(&data[offset + 16]);
+        trace.records.push_back(record);
+    }
+
+    return trace;
+}
+
+DecodedTrace DumpAndDecode(const BinaryBackendBase & backend)
+{
+    VectorDumpWriter writer;
+    EXPECT_EQ(backend.Dump(writer), CHIP_NO_ERROR);
+    return Decode(writer.mData);
+}
+
+TEST(TestBinaryTracing, TestRecords)
+{
+    BinaryBackend<16> backend;
+
+    backend.TraceBegin("A", "Group");
+    backend.TraceInstant("B", "Group");
+    backend.TraceEnd("A", "Group");
+    backend.TraceCounter("C");
+    backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, "metric", CHIP_ERROR_INTERNAL));
+    backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, "metric", int32_t(-1)));
+
+    DecodedTrace trace = DumpAndDecode(backend);
+    EXPECT_EQ(trace.recordsWritten, 6u);
+    ASSERT_EQ(trace.records.size(), 6u);
+
+    const RecordType expectedTypes[] = { RecordType::kBegin,   RecordType::kInstant,   RecordType::kEnd,
+                                         RecordType::kCounter, RecordType::kMetricEnd, RecordType::kMetricInstant };
+    const char * expectedLabels[]    = { "A", "B", "A", "C", "metric", "metric" };
+    const char * expectedGroups[]    = { "Group", "Group", "Group", "", "", "" };
+
+    for (size_t i = 0; i < trace.records.size(); i++)
+    {
+        EXPECT_EQ(trace.records[i].sequence, i);
+        EXPECT_EQ(trace.records[i].type, expectedTypes[i]);
+        EXPECT_EQ(trace.records[i].label, expectedLabels[i]);
+        EXPECT_EQ(trace.records[i].group, expectedGroups[i]);
+    }
+
+    EXPECT_EQ(trace.records[4].valueType, to_underlying(MetricEvent::Value::Type::kChipErrorCode));
+    EXPECT_EQ(trace.records[4].value, CHIP_ERROR_INTERNAL.AsInteger());
+    EXPECT_EQ(trace.records[5].valueType, to_underlying(MetricEvent::Value::Type::kInt32));
+    EXPECT_EQ(trace.records[5].value, UINT32_MAX);
+}
+
+TEST(TestBinaryTracing, TestExchangeEvents)
+{
+    BinaryBackend<4> backend;
+
+    ExchangeEventInfo allocated{ ExchangeEventType::kAllocated, 0x1234, true, nullptr, System::Clock::Microseconds64(0) };
+    ExchangeEventInfo decrypted{ ExchangeEventType::kDecrypt, 0x1234, false, nullptr, System::Clock::Microseconds64(250) };
+    backend.LogExchangeEvent(allocated);
+    backend.LogExchangeEvent(decrypted);
+
+    DecodedTrace trace = DumpAndDecode(backend);
+    ASSERT_EQ(trace.records.size(), 2u);
+
+    EXPECT_EQ(trace.records[0].type, RecordType::kExchange);
+    EXPECT_EQ(trace.records[0].label, "Allocated");
+    EXPECT_EQ(trace.records[0].group, "Initiator");
+    EXPECT_EQ(trace.records[0].exchangeId, 0x1234);
+    EXPECT_EQ(trace.records[0].value, 0u);
+
+    EXPECT_EQ(trace.records[1].label, "Decrypt");
+    EXPECT_EQ(trace.records[1].group, "Responder");
+    EXPECT_EQ(trace.records[1].exchangeId, 0x1234);
+    EXPECT_EQ(trace.records[1].value, 250u);
+}
+
+TEST(TestBinaryTracing, TestWrapAround)
+{
+    static const char * kLabels[] = { "0", "1", "2", "3", "4", "5", "6", "7", "8", "9" };
+    BinaryBackend<4> backend;
+
+    for (const char * label : kLabels)
+    {
+        backend.TraceInstant(label, "Group");
+    }
+
+    // Only the newest records are kept
+    DecodedTrace trace = DumpAndDecode(backend);
+    EXPECT_EQ(trace.recordsWritten, 10u);
+    ASSERT_EQ(trace.records.size(), 4u);
+
+    for (size_t i = 0; i < trace.records.size(); i++)
+    {
+        EXPECT_EQ(trace.records[i].sequence, 6 + i);
+        EXPECT_EQ(trace.records[i].label, kLabels[6 + i]);
+    }
+
+    backend.Clear();
+    trace = DumpAndDecode(backend);
+    EXPECT_EQ(trace.recordsWritten, 0u);
+    EXPECT_TRUE(trace.records.empty());
+}
+
+TEST(TestBinaryTracing, TestStringTableFull)
+{
+    BinaryBackend<4, 1> backend;
+
+    backend.TraceCounter("A");
+    backend.TraceInstant("B", "Group");
+
+    // Events are still recorded when their strings cannot be interned
+    DecodedTrace trace = DumpAndDecode(backend);
+    ASSERT_EQ(trace.records.size(), 2u);
+    EXPECT_EQ(trace.records[0].label, "A");
+    EXPECT_EQ(trace.records[1].type, RecordType::kInstant);
+    EXPECT_EQ(trace.records[1].label, "");
+    EXPECT_EQ(trace.records[1].group, "");
+}
+
+} // namespace
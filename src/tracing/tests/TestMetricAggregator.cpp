@@ -0,0 +1,231 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <system/SystemClock.h>
+#include <tracing/aggregator/metric_aggregator.h>
+#include <tracing/metric_event.h>
+
+#include <map>
+#include <string>
+
+using namespace chip;
+using namespace chip::Tracing;
+using namespace chip::Tracing::Aggregator;
+
+namespace {
+
+constexpr MetricKey kMetricA = "test_metric_a";
+constexpr MetricKey kMetricB = "test_metric_b";
+constexpr MetricKey kMetricC = "test_metric_c";
+
+class CollectingDelegate : public SnapshotDelegate
+{
+public:
+    void OnMetricSnapshot(const MetricAggregate & aggregate) override { mAggregates[aggregate.key] = aggregate; }
+
+    void OnSnapshotDone(System::Clock::Milliseconds64 windowDuration, uint32_t droppedEvents) override
+    {
+        mWindowDuration = windowDuration;
+        mDroppedEvents  = droppedEvents;
+        mSnapshotCount++;
+    }
+
+    std::map<std::string, MetricAggregate> mAggregates;
+    System::Clock::Milliseconds64 mWindowDuration{ 0 };
+    uint32_t mDroppedEvents = 0;
+    uint32_t mSnapshotCount = 0;
+};
+
+class TestMetricAggregator : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        mRealClock = &System::SystemClock();
+        System::Clock::Internal::SetSystemClockForTesting(&mMockClock);
+    }
+    void TearDown() override { System::Clock::Internal::SetSystemClockForTesting(mRealClock); }
+
+protected:
+    System::Clock::Internal::MockClock mMockClock;
+    System::Clock::ClockBase * mRealClock = nullptr;
+};
+
+TEST_F(TestMetricAggregator, TestInstantSamples)
+{
+    MetricAggregator<> aggregator;
+    CollectingDelegate delegate;
+    aggregator.Open();
+
+    for (uint32_t value = 1; value <= 100; value++)
+    {
+        aggregator.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kMetricA, value));
+    }
+    aggregator.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kMetricB, int32_t(-5)));
+
+    aggregator.Snapshot(delegate);
+    ASSERT_EQ(delegate.mAggregates.size(), 2u);
+
+    const MetricAggregate & a = delegate.mAggregates[kMetricA];
+    EXPECT_EQ(a.count, 100u);
+    EXPECT_EQ(a.errorCount, 0u);
+    EXPECT_EQ(a.sum, 5050);
+    EXPECT_EQ(a.min, 1);
+    EXPECT_EQ(a.max, 100);
+    EXPECT_EQ(a.Mean(), 50);
+
+    // Percentiles are the upper bounds of the log2 buckets, clamped to the samples' range
+    EXPECT_EQ(a.Percentile(0), 1);
+    EXPECT_EQ(a.Percentile(50), 63);
+    EXPECT_EQ(a.Percentile(90), 100);
+    EXPECT_EQ(a.Percentile(100), 100);
+
+    const MetricAggregate & b = delegate.mAggregates[kMetricB];
+    EXPECT_EQ(b.count, 1u);
+    EXPECT_EQ(b.min, -5);
+    EXPECT_EQ(b.max, -5);
+    EXPECT_EQ(b.buckets[0], 1u);
+    EXPECT_EQ(b.Percentile(50), -5);
+
+    aggregator.Close();
+}
+
+TEST_F(TestMetricAggregator, TestDurations)
+{
+    MetricAggregator<> aggregator;
+    CollectingDelegate delegate;
+    aggregator.Open();
+
+    // An end event without a begin event is not a sample
+    aggregator.LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, kMetricA));
+
+    aggregator.LogMetricEvent(MetricEvent(MetricEvent::Type::kBeginEvent, kMetricA));
+    mMockClock.AdvanceMonotonic(System::Clock::Milliseconds64(250));
+    aggregator.LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, kMetricA, CHIP_NO_ERROR));
+
+    aggregator.LogMetricEvent(MetricEvent(MetricEvent::Type::kBeginEvent, kMetricA));
+    mMockClock.AdvanceMonotonic(System::Clock::Milliseconds64(750));
+    aggregator.LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, kMetricA, CHIP_ERROR_TIMEOUT));
+
+    aggregator.Snapshot(delegate);
+
+    const MetricAggregate & a = delegate.mAggregates[kMetricA];
+    EXPECT_EQ(a.count, 2u);
+    EXPECT_EQ(a.errorCount, 1u);
+    EXPECT_EQ(a.min, 250);
+    EXPECT_EQ(a.max, 750);
+    EXPECT_EQ(a.Mean(), 500);
+    EXPECT_EQ(delegate.mWindowDuration, System::Clock::Milliseconds64(1000));
+
+    aggregator.Close();
+}
+
+TEST_F(TestMetricAggregator, TestErrors)
+{
+    MetricAggregator<> aggregator;
+    CollectingDelegate delegate;
+    aggregator.Open();
+
+    aggregator.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kMetricA, CHIP_ERROR_NO_MEMORY));
+    aggregator.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kMetricA, CHIP_NO_ERROR));
+    aggregator.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kMetricA));
+
+    aggregator.Snapshot(delegate);
+
+    const MetricAggregate & a = delegate.mAggregates[kMetricA];
+    EXPECT_EQ(a.count, 3u);
+    EXPECT_EQ(a.errorCount, 1u);
+    EXPECT_EQ(a.sum, 0);
+
+    aggregator.Close();
+}
+
+TEST_F(TestMetricAggregator, TestDroppedKeys)
+{
+    MetricAggregator<2> aggregator;
+    CollectingDelegate delegate;
+    aggregator.Open();
+
+    aggregator.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kMetricA, uint32_t(1)));
+    aggregator.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kMetricB, uint32_t(2)));
+    aggregator.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kMetricC, uint32_t(3)));
+    aggregator.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kMetricC, uint32_t(4)));
+
+    // Keys are matched by content, not only by address
+    std::string keyA(kMetricA);
+    aggregator.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, keyA.c_str(), uint32_t(5)));
+
+    aggregator.Snapshot(delegate);
+
+    EXPECT_EQ(delegate.mAggregates.size(), 2u);
+    EXPECT_EQ(delegate.mAggregates[kMetricA].count, 2u);
+    EXPECT_EQ(delegate.mAggregates[kMetricB].count, 1u);
+    EXPECT_EQ(delegate.mDroppedEvents, 2u);
+
+    aggregator.Close();
+}
+
+TEST_F(TestMetricAggregator, TestSnapshotReset)
+{
+    MetricAggregator<> aggregator;
+    aggregator.Open();
+
+    aggregator.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kMetricA, uint32_t(10)));
+    aggregator.LogMetricEvent(MetricEvent(MetricEvent::Type::kBeginEvent, kMetricB));
+    mMockClock.AdvanceMonotonic(System::Clock::Milliseconds64(100));
+
+    {
+        CollectingDelegate delegate;
+        aggregator.Snapshot(delegate, /* reset = */ true);
+        EXPECT_EQ(delegate.mAggregates.size(), 1u);
+        EXPECT_EQ(delegate.mWindowDuration, System::Clock::Milliseconds64(100));
+    }
+
+    {
+        // Metrics without events since the reset are not reported
+        CollectingDelegate delegate;
+        aggregator.Snapshot(delegate);
+        EXPECT_TRUE(delegate.mAggregates.empty());
+        EXPECT_EQ(delegate.mSnapshotCount, 1u);
+        EXPECT_EQ(delegate.mWindowDuration, System::Clock::Milliseconds64(0));
+    }
+
+    // An operation pending across a reset is accounted to the next window
+    mMockClock.AdvanceMonotonic(System::Clock::Milliseconds64(20));
+    aggregator.LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, kMetricB));
+
+    {
+        CollectingDelegate delegate;
+        aggregator.Snapshot(delegate);
+        EXPECT_EQ(delegate.mAggregates.size(), 1u);
+        EXPECT_EQ(delegate.mAggregates[kMetricB].count, 1u);
+        EXPECT_EQ(delegate.mAggregates[kMetricB].min, 120);
+    }
+
+    aggregator.Reset();
+    {
+        CollectingDelegate delegate;
+        aggregator.Snapshot(delegate);
+        EXPECT_TRUE(delegate.mAggregates.empty());
+    }
+
+    aggregator.Close();
+}
+
+} // namespace
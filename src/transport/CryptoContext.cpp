@@ -38,8 +38,6 @@ namespace chip {
 
 namespace {
 
-constexpr size_t kMaxAADLen = 128;
-
 /* Session Establish Key Info */
 constexpr uint8_t SEKeysInfo[] = { 0x53, 0x65, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x4b, 0x65, 0x79, 0x73 };
 
@@ -55,6 +53,9 @@ CryptoContext::CryptoContext() : mKeyAvailable(false) {}
 
 CryptoContext::~CryptoContext()
 {
+    mEncryptionCipher.Release();
+    mDecryptionCipher.Release();
+
     if (mKeystore)
     {
         mKeystore->DestroyKey(mEncryptionKey);
@@ -86,6 +87,7 @@ CHIP_ERROR CryptoContext::InitFromSecret(SessionKeystore & keystore, const ByteS
     mKeyAvailable = true;
     mSessionRole  = role;
     mKeystore     = &keystore;
+    InitCiphers();
 
     return CHIP_NO_ERROR;
 }
@@ -111,6 +113,7 @@ CHIP_ERROR CryptoContext::InitFromSecret(Crypto::SessionKeystore & keystore, con
     mKeyAvailable = true;
     mSessionRole  = role;
     mKeystore     = &keystore;
+    InitCiphers();
 
     return CHIP_NO_ERROR;
 }
@@ -150,6 +153,14 @@ CHIP_ERROR CryptoContext::InitTestMode(Crypto::SessionKeystore & keystore, Crypt
 }
 #endif // CHIP_CONFIG_SECURITY_TEST_MODE
 
+void CryptoContext::InitCiphers()
+{
+    // Keep the AES-CCM state for as long as the keys, so that messages skip the cipher setup. Should that fail, messages
+    // go through the one-shot AES_CCM_encrypt/decrypt instead.
+    (void) mEncryptionCipher.Init(mEncryptionKey);
+    (void) mDecryptionCipher.Init(mDecryptionKey);
+}
+
 CHIP_ERROR CryptoContext::BuildNonce(NonceView nonce, uint8_t securityFlags, uint32_t messageCounter, NodeId nodeId)
 {
     Encoding::LittleEndian::BufferWriter bbuf(nonce.data(), nonce.size());
@@ -220,8 +231,16 @@ CHIP_ERROR CryptoContext::Encrypt(const uint8_t * input, size_t input_length, ui
     else
     {
         VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
-        ReturnErrorOnFailure(
-            AES_CCM_encrypt(input, input_length, AAD, aadLen, mEncryptionKey, nonce.data(), nonce.size(), output, tag, taglen));
+        if (mEncryptionCipher.IsInitialized())
+        {
+            ReturnErrorOnFailure(
+                mEncryptionCipher.Encrypt(input, input_length, AAD, aadLen, nonce.data(), nonce.size(), output, tag, taglen));
+        }
+        else
+        {
+            ReturnErrorOnFailure(AES_CCM_encrypt(input, input_length, AAD, aadLen, mEncryptionKey, nonce.data(), nonce.size(),
+                                                 output, tag, taglen));
+        }
     }
 
     mac.SetTag(&header, tag, taglen);
@@ -255,8 +274,16 @@ CHIP_ERROR CryptoContext::Decrypt(const uint8_t * input, size_t input_length, ui
     else
     {
         VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
-        ReturnErrorOnFailure(
-            AES_CCM_decrypt(input, input_length, AAD, aadLen, tag, taglen, mDecryptionKey, nonce.data(), nonce.size(), output));
+        if (mDecryptionCipher.IsInitialized())
+        {
+            ReturnErrorOnFailure(
+                mDecryptionCipher.Decrypt(input, input_length, AAD, aadLen, tag, taglen, nonce.data(), nonce.size(), output));
+        }
+        else
+        {
+            ReturnErrorOnFailure(AES_CCM_decrypt(input, input_length, AAD, aadLen, tag, taglen, mDecryptionKey, nonce.data(),
+                                                 nonce.size(), output));
+        }
     }
     return CHIP_NO_ERROR;
 }
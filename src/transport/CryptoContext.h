@@ -115,6 +115,14 @@ public:
     /** @brief Build a Nonce buffer using given parameters for encrypt or decrypt. */
     static CHIP_ERROR BuildPrivacyNonce(NonceView nonce, uint16_t sessionId, const MessageAuthenticationCode & mac);
 
+    /** @brief Maximum length of the additional authenticated data built by GetAdditionalAuthData(). */
+    static constexpr size_t kMaxAADLen = 128;
+
+    // Use unencrypted header as additional authenticated data (AAD) during encryption and decryption.
+    // The encryption operations includes AAD when message authentication tag is generated. This tag
+    // is used at the time of decryption to integrity check the received data.
+    static CHIP_ERROR GetAdditionalAuthData(const PacketHeader & header, uint8_t * aad, uint16_t & len);
+
     /**
      * @brief
      *   Encrypt the input data using keys established in the secure channel
@@ -169,20 +177,20 @@ public:
 
 private:
     CHIP_ERROR InitTestMode(Crypto::SessionKeystore & keystore, Crypto::Aes128KeyHandle & i2rKey, Crypto::Aes128KeyHandle & r2iKey);
+    void InitCiphers();
 
     SessionRole mSessionRole;
 
     bool mKeyAvailable;
     Crypto::Aes128KeyHandle mEncryptionKey;
     Crypto::Aes128KeyHandle mDecryptionKey;
+    // Cipher state bound to the keys above. Encrypt() and Decrypt() are const, but running a message through the cipher
+    // updates its state.
+    mutable Crypto::Aes128CcmContext mEncryptionCipher;
+    mutable Crypto::Aes128CcmContext mDecryptionCipher;
     Crypto::AttestationChallenge mAttestationChallenge;
     Crypto::SessionKeystore * mKeystore       = nullptr;
     Crypto::SymmetricKeyContext * mKeyContext = nullptr;
-
-    // Use unencrypted header as additional authenticated data (AAD) during encryption and decryption.
-    // The encryption operations includes AAD when message authentication tag is generated. This tag
-    // is used at the time of decryption to integrity check the received data.
-    static CHIP_ERROR GetAdditionalAuthData(const PacketHeader & header, uint8_t * aad, uint16_t & len);
 };
 
 } // namespace chip
@@ -0,0 +1,233 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  @file
+ *    This file implements DecryptWorkerPool.
+ */
+
+#include <transport/DecryptWorkerPool.h>
+
+#if CHIP_TRANSPORT_HAS_DECRYPT_WORKER_POOL
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <transport/SecureMessageCodec.h>
+#include <transport/SecureSession.h>
+#include <transport/TracingStructs.h>
+
+namespace chip {
+namespace Transport {
+
+bool DecryptWorkerPool::JobQueue::Push(DecryptJob * job)
+{
+    size_t tail = mTail.load(std::memory_order_relaxed);
+    size_t next = (tail + 1) % (kQueueSize + 1);
+    if (next == mHead.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+    mJobs[tail] = job;
+    // Sequentially consistent, so that the consumer cannot go to sleep without seeing this job (see WorkerMain).
+    mTail.store(next, std::memory_order_seq_cst);
+    return true;
+}
+
+bool DecryptWorkerPool::JobQueue::Pop(DecryptJob *& job)
+{
+    size_t head = mHead.load(std::memory_order_relaxed);
+    if (head == mTail.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+    job = mJobs[head];
+    mHead.store((head + 1) % (kQueueSize + 1), std::memory_order_release);
+    return true;
+}
+
+bool DecryptWorkerPool::JobQueue::IsEmpty() const
+{
+    return mHead.load(std::memory_order_relaxed) == mTail.load(std::memory_order_seq_cst);
+}
+
+CHIP_ERROR DecryptWorkerPool::Init(System::Layer & systemLayer, Delegate & delegate)
+{
+    VerifyOrReturnError(mDelegate == nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    mSystemLayer = &systemLayer;
+    mDelegate    = &delegate;
+    mDrainScheduled.store(false);
+
+    for (Worker & worker : mWorkers)
+    {
+        worker.mPool = this;
+        worker.mStop.store(false);
+        int err = pthread_create(&worker.mThread, nullptr, WorkerMain, &worker);
+        if (err != 0)
+        {
+            ChipLogError(Inet, "Failed to start decrypt worker: %d", err);
+            Shutdown();
+            return CHIP_ERROR_POSIX(err);
+        }
+        worker.mStarted = true;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void DecryptWorkerPool::Shutdown()
+{
+    VerifyOrReturn(mDelegate != nullptr);
+
+    for (Worker & worker : mWorkers)
+    {
+        if (worker.mStarted)
+        {
+            pthread_mutex_lock(&worker.mLock);
+            worker.mStop.store(true);
+            pthread_cond_signal(&worker.mWake);
+            pthread_mutex_unlock(&worker.mLock);
+            pthread_join(worker.mThread, nullptr);
+            worker.mStarted = false;
+        }
+
+        // The workers are gone, so their queues can be emptied from here.
+        DecryptJob * job;
+        while (worker.mPending.Pop(job) || worker.mCompleted.Pop(job))
+        {
+            mJobPool.ReleaseObject(job);
+        }
+        worker.mOutstanding = 0;
+    }
+
+    mDelegate    = nullptr;
+    mSystemLayer = nullptr;
+}
+
+CHIP_ERROR DecryptWorkerPool::Submit(const SessionHandle & session, const PacketHeader & packetHeader,
+                                     const CryptoContext::NonceStorage & nonce, const PeerAddress & peerAddress,
+                                     System::PacketBufferHandle && msg)
+{
+    VerifyOrReturnError(mDelegate != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    // Hand back what is already decrypted first, which also frees up queue space.
+    DrainCompletedJobs();
+    VerifyOrReturnError(mDelegate != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    // Messages of a session always go to the same worker, which keeps them in order.
+    Worker & worker = mWorkers[packetHeader.GetSessionId() % kWorkerCount];
+    VerifyOrReturnError(worker.mOutstanding < kQueueSize, CHIP_ERROR_NO_MEMORY);
+
+    DecryptJob * job = mJobPool.CreateObject(session, packetHeader, nonce, peerAddress, std::move(msg));
+    VerifyOrReturnError(job != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    // Cannot fail: at most kQueueSize jobs are outstanding per worker.
+    bool queued = worker.mPending.Push(job);
+    VerifyOrDie(queued);
+    worker.mOutstanding++;
+
+    Wake(worker);
+    return CHIP_NO_ERROR;
+}
+
+void DecryptWorkerPool::Wake(Worker & worker)
+{
+    if (worker.mSleeping.load())
+    {
+        pthread_mutex_lock(&worker.mLock);
+        pthread_cond_signal(&worker.mWake);
+        pthread_mutex_unlock(&worker.mLock);
+    }
+}
+
+void DecryptWorkerPool::ScheduleDrain()
+{
+    // Called on a worker thread; one scheduled drain hands back the jobs of all workers.
+    if (!mDrainScheduled.exchange(true))
+    {
+        if (mSystemLayer->ScheduleLambda([this] { DrainCompletedJobs(); }) != CHIP_NO_ERROR)
+        {
+            // The next Submit() drains instead.
+            mDrainScheduled.store(false);
+        }
+    }
+}
+
+void DecryptWorkerPool::DrainCompletedJobs()
+{
+    mDrainScheduled.store(false);
+
+    for (Worker & worker : mWorkers)
+    {
+        DecryptJob * job;
+        while (mDelegate != nullptr && worker.mCompleted.Pop(job))
+        {
+            worker.mOutstanding--;
+            mDelegate->OnMessageDecrypted(*job);
+            mJobPool.ReleaseObject(job);
+        }
+    }
+}
+
+void * DecryptWorkerPool::WorkerMain(void * arg)
+{
+    Worker & worker = *static_cast<Worker *>(arg);
+
+    while (true)
+    {
+        DecryptJob * job;
+        if (worker.mPending.Pop(job))
+        {
+            // The session handle keeps the session and its keys alive. The message buffer belongs to the job, and is only
+            // modified in place here.
+            const CryptoContext & context = job->session->AsSecureSession()->GetCryptoContext();
+            const auto decryptStart       = Tracing::ExchangeStageStart();
+
+            job->result = SecureMessageCodec::Decrypt(context, job->nonce, job->payloadHeader, job->packetHeader, job->msg);
+
+            job->decryptDuration = Tracing::ExchangeStageDuration(decryptStart);
+
+            bool completed = worker.mCompleted.Push(job);
+            VerifyOrDie(completed);
+            worker.mPool->ScheduleDrain();
+            continue;
+        }
+
+        // Announce that we are going to sleep before checking the queue one last time, so that Submit() either sees
+        // mSleeping or its job is seen here.
+        pthread_mutex_lock(&worker.mLock);
+        worker.mSleeping.store(true);
+        while (!worker.mStop.load() && worker.mPending.IsEmpty())
+        {
+            pthread_cond_wait(&worker.mWake, &worker.mLock);
+        }
+        worker.mSleeping.store(false);
+        pthread_mutex_unlock(&worker.mLock);
+
+        if (worker.mStop.load())
+        {
+            break;
+        }
+    }
+
+    return nullptr;
+}
+
+} // namespace Transport
+} // namespace chip
+
+#endif // CHIP_TRANSPORT_HAS_DECRYPT_WORKER_POOL
@@ -0,0 +1,194 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  @file
+ *    This file defines DecryptWorkerPool, which decrypts received secure unicast
+ *    messages on worker threads (see CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS).
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <system/SystemConfig.h>
+
+#if CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+
+#if !CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#error "CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS requires CHIP_SYSTEM_CONFIG_POSIX_LOCKING"
+#endif
+
+#if CHIP_SYSTEM_CONFIG_USE_LWIP
+// SecureMessageCodec::Decrypt copies LwIP buffers, and buffers may only be allocated on the Matter thread.
+#error "CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS is not supported with CHIP_SYSTEM_CONFIG_USE_LWIP"
+#endif
+
+#endif // CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+
+/**
+ * DecryptWorkerPool is available wherever it can run, whether SessionManager uses it or not, so that it can be unit
+ * tested in the default configuration.
+ */
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !CHIP_SYSTEM_CONFIG_USE_LWIP
+#define CHIP_TRANSPORT_HAS_DECRYPT_WORKER_POOL 1
+#else
+#define CHIP_TRANSPORT_HAS_DECRYPT_WORKER_POOL 0
+#endif
+
+#if CHIP_TRANSPORT_HAS_DECRYPT_WORKER_POOL
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/Pool.h>
+#include <system/SystemLayer.h>
+#include <system/SystemPacketBuffer.h>
+#include <transport/CryptoContext.h>
+#include <transport/Session.h>
+#include <transport/raw/MessageHeader.h>
+#include <transport/raw/PeerAddress.h>
+
+#include <atomic>
+#include <pthread.h>
+#include <stddef.h>
+
+namespace chip {
+namespace Transport {
+
+/**
+ * A received secure unicast message on its way through a DecryptWorkerPool.
+ *
+ * The session handle keeps the session, and therefore its keys, alive while the message is decrypted. It is
+ * only ever copied and released on the Matter thread.
+ */
+struct DecryptJob
+{
+    DecryptJob(const SessionHandle & aSession, const PacketHeader & aPacketHeader, const CryptoContext::NonceStorage & aNonce,
+               const PeerAddress & aPeerAddress, System::PacketBufferHandle && aMsg) :
+        // SessionHandle cannot be copied, so take another reference on the same session.
+        session(*aSession.operator->()),
+        packetHeader(aPacketHeader), nonce(aNonce), peerAddress(aPeerAddress), msg(std::move(aMsg))
+    {}
+
+    SessionHandle session;
+    PacketHeader packetHeader;
+    CryptoContext::NonceStorage nonce;
+    PeerAddress peerAddress;
+    System::PacketBufferHandle msg;
+
+    // Filled in by the worker.
+    PayloadHeader payloadHeader;
+    CHIP_ERROR result = CHIP_NO_ERROR;
+    System::Clock::Microseconds64 decryptDuration{ 0 }; // only measured when tracing is enabled
+};
+
+/**
+ * Decrypts secure unicast messages (SecureMessageCodec::Decrypt) on a fixed set of worker threads, and hands
+ * them back to the Matter thread through the Delegate.
+ *
+ * Each session is served by a single worker, through a pair of single-producer single-consumer queues, so messages
+ * of a session are handed back in the order they were submitted. All methods must be called on the Matter thread.
+ */
+class DecryptWorkerPool
+{
+public:
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() = default;
+
+        /**
+         * Called on the Matter thread for every submitted message, once job.result tells whether it was decrypted
+         * and authenticated. The job is released when this returns.
+         */
+        virtual void OnMessageDecrypted(DecryptJob & job) = 0;
+    };
+
+    DecryptWorkerPool() = default;
+    ~DecryptWorkerPool() { Shutdown(); }
+
+    CHIP_ERROR Init(System::Layer & systemLayer, Delegate & delegate);
+
+    /**
+     * Stop the workers. Messages that were not handed back yet are dropped.
+     */
+    void Shutdown();
+
+    /**
+     * Queue a message for decryption.
+     *
+     * @retval CHIP_ERROR_INCORRECT_STATE  If the pool is not initialized.
+     * @retval CHIP_ERROR_NO_MEMORY        If the queue of the worker serving the session is full.
+     */
+    CHIP_ERROR Submit(const SessionHandle & session, const PacketHeader & packetHeader, const CryptoContext::NonceStorage & nonce,
+                      const PeerAddress & peerAddress, System::PacketBufferHandle && msg);
+
+    // Without CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS, the pool is only used by tests.
+    static constexpr size_t kWorkerCount =
+        (CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0) ? CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS : 2;
+
+    // Messages that can be queued to, or processed by, each worker.
+    static constexpr size_t kQueueSize = CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_QUEUE_SIZE;
+
+private:
+
+    /**
+     * Lock-free ring buffer with one producer thread and one consumer thread.
+     */
+    class JobQueue
+    {
+    public:
+        bool Push(DecryptJob * job);
+        bool Pop(DecryptJob *& job);
+        bool IsEmpty() const;
+
+    private:
+        DecryptJob * mJobs[kQueueSize + 1]; // One slot is always left empty to tell a full queue from an empty one.
+        std::atomic<size_t> mHead{ 0 };
+        std::atomic<size_t> mTail{ 0 };
+    };
+
+    struct Worker
+    {
+        DecryptWorkerPool * mPool = nullptr;
+        pthread_t mThread;
+        bool mStarted = false;
+
+        JobQueue mPending;       // Matter thread -> worker
+        JobQueue mCompleted;     // worker -> Matter thread
+        size_t mOutstanding = 0; // Jobs in either queue or being decrypted; only used on the Matter thread.
+
+        pthread_mutex_t mLock = PTHREAD_MUTEX_INITIALIZER;
+        pthread_cond_t mWake  = PTHREAD_COND_INITIALIZER;
+        std::atomic<bool> mSleeping{ false };
+        std::atomic<bool> mStop{ false };
+    };
+
+    static void * WorkerMain(void * worker);
+    static void Wake(Worker & worker);
+    void ScheduleDrain();
+    void DrainCompletedJobs();
+
+    System::Layer * mSystemLayer = nullptr;
+    Delegate * mDelegate         = nullptr;
+    Worker mWorkers[kWorkerCount];
+    ObjectPool<DecryptJob, kWorkerCount * kQueueSize, ObjectPoolMem::kInline> mJobPool;
+    std::atomic<bool> mDrainScheduled{ false };
+};
+
+} // namespace Transport
+} // namespace chip
+
+#endif // CHIP_TRANSPORT_HAS_DECRYPT_WORKER_POOL
@@ -25,6 +25,8 @@
 
 #include <crypto/RandUtils.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace Transport {
 
@@ -305,13 +307,16 @@ CHIP_ERROR GroupOutgoingCounters::Init(chip::PersistentStorageDelegate * storage
         mGroupDataCounter = temp;
     }
 
-    temp = mGroupControlCounter + GROUP_MSG_COUNTER_MIN_INCREMENT;
-    size = static_cast<uint16_t>(sizeof(temp));
-    ReturnErrorOnFailure(mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::GroupControlCounter().KeyName(), &temp, size));
+    mGroupControlIncrement = GROUP_MSG_COUNTER_MIN_INCREMENT;
+    mGroupControlLimit     = mGroupControlCounter + mGroupControlIncrement;
+    size                   = static_cast<uint16_t>(sizeof(mGroupControlLimit));
+    ReturnErrorOnFailure(
+        mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::GroupControlCounter().KeyName(), &mGroupControlLimit, size));
 
-    temp = mGroupDataCounter + GROUP_MSG_COUNTER_MIN_INCREMENT;
+    mGroupDataIncrement = GROUP_MSG_COUNTER_MIN_INCREMENT;
+    mGroupDataLimit     = mGroupDataCounter + mGroupDataIncrement;
 
-    return mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::GroupDataCounter().KeyName(), &temp, size);
+    return mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::GroupDataCounter().KeyName(), &mGroupDataLimit, size);
 }
 
 uint32_t GroupOutgoingCounters::GetCounter(bool isControl)
@@ -321,35 +326,25 @@ uint32_t GroupOutgoingCounters::GetCounter(bool isControl)
 
 CHIP_ERROR GroupOutgoingCounters::IncrementCounter(bool isControl)
 {
-    uint32_t temp  = 0;
-    uint16_t size  = static_cast<uint16_t>(sizeof(uint32_t));
-    uint32_t value = 0;
-
-    StorageKeyName key = StorageKeyName::Uninitialized();
+    uint32_t & counter   = isControl ? mGroupControlCounter : mGroupDataCounter;
+    uint32_t & limit     = isControl ? mGroupControlLimit : mGroupDataLimit;
+    uint32_t & increment = isControl ? mGroupControlIncrement : mGroupDataIncrement;
+    StorageKeyName key   = isControl ? DefaultStorageKeyAllocator::GroupControlCounter()
+                                     : DefaultStorageKeyAllocator::GroupDataCounter();
 
-    if (isControl)
-    {
-        mGroupControlCounter++;
-        key   = DefaultStorageKeyAllocator::GroupControlCounter();
-        value = mGroupControlCounter;
-    }
-    else
-    {
-        mGroupDataCounter++;
-        key   = DefaultStorageKeyAllocator::GroupDataCounter();
-        value = mGroupDataCounter;
-    }
+    counter++;
 
     if (mStorage == nullptr)
     {
         return CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND;
     }
 
-    ReturnErrorOnFailure(mStorage->SyncGetKeyValue(key.KeyName(), &temp, size));
-    if (temp == value)
+    if (counter == limit)
     {
-        temp = value + GROUP_MSG_COUNTER_MIN_INCREMENT;
-        return mStorage->SyncSetKeyValue(key.KeyName(), &temp, sizeof(uint32_t));
+        // The previous reservation was used up within this boot: reserve a larger one, so a busy sender writes less often.
+        increment = std::min<uint32_t>(increment * 2, GROUP_MSG_COUNTER_MAX_INCREMENT);
+        limit     = counter + increment;
+        return mStorage->SyncSetKeyValue(key.KeyName(), &limit, sizeof(uint32_t));
     }
     return CHIP_NO_ERROR;
 }
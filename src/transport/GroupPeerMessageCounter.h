@@ -32,6 +32,8 @@
 #include <transport/PeerMessageCounter.h>
 
 #define GROUP_MSG_COUNTER_MIN_INCREMENT 1000
+// Largest number of counter values reserved at once by a busy sender, and skipped on a reboot.
+#define GROUP_MSG_COUNTER_MAX_INCREMENT (16 * GROUP_MSG_COUNTER_MIN_INCREMENT)
 
 namespace chip {
 namespace Transport {
@@ -91,6 +93,12 @@ protected:
     uint32_t mGroupDataCounter                 = 0;
     uint32_t mGroupControlCounter              = 0;
     chip::PersistentStorageDelegate * mStorage = nullptr;
+
+    // Counter values persisted as the next start, and number of values reserved when they were persisted
+    uint32_t mGroupDataLimit        = 0;
+    uint32_t mGroupControlLimit     = 0;
+    uint32_t mGroupDataIncrement    = GROUP_MSG_COUNTER_MIN_INCREMENT;
+    uint32_t mGroupControlIncrement = GROUP_MSG_COUNTER_MIN_INCREMENT;
 };
 
 } // namespace Transport
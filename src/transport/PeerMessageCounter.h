@@ -21,19 +21,36 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <array>
-#include <bitset>
+#include <stdint.h>
 
 #include <lib/support/Span.h>
 
 namespace chip {
 namespace Transport {
 
+namespace Internal {
+
+// The smallest power of two that is at least windowSize, starting from capacity.
+constexpr uint32_t MessageCounterWindowCapacity(uint32_t windowSize, uint32_t capacity)
+{
+    return (capacity >= windowSize) ? capacity : MessageCounterWindowCapacity(windowSize, capacity * 2);
+}
+
+} // namespace Internal
+
 class PeerMessageCounter
 {
 public:
     static constexpr size_t kChallengeSize      = 8;
     static constexpr uint32_t kInitialSyncValue = 0;
+    static constexpr uint16_t kMaxWindowSize    = CHIP_CONFIG_MESSAGE_COUNTER_MAX_WINDOW_SIZE;
+
+    static_assert(CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE >= 1 &&
+                      CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE <= CHIP_CONFIG_MESSAGE_COUNTER_MAX_WINDOW_SIZE,
+                  "The default message counter window must fit in CHIP_CONFIG_MESSAGE_COUNTER_MAX_WINDOW_SIZE");
+    static_assert(CHIP_CONFIG_MESSAGE_COUNTER_MAX_WINDOW_SIZE <= 0x8000, "Message counter windows are limited to 32768");
 
     PeerMessageCounter() : mStatus(Status::NotSynced) {}
     ~PeerMessageCounter() { Reset(); }
@@ -54,6 +71,26 @@ public:
         mStatus = Status::NotSynced;
     }
 
+    /**
+     * Set how many counter values behind the max counter are tracked, and so accepted if they have not been seen yet.
+     * Larger windows tolerate more reordering, for example over multi-path networks.  The size is clamped to
+     * [1, kMaxWindowSize] and survives Reset() and resynchronization.
+     *
+     * When the window grows, the counter values that join it are treated as already seen: they used to be before the
+     * window, and whether they were received was not tracked.
+     */
+    void SetWindowSize(uint16_t windowSize)
+    {
+        windowSize = std::min(std::max<uint16_t>(windowSize, 1), kMaxWindowSize);
+        if (windowSize > mWindowSize && mStatus == Status::Synced)
+        {
+            AssignWindowBits(mSynced.mMaxCounter - windowSize, static_cast<uint32_t>(windowSize - mWindowSize), true);
+        }
+        mWindowSize = windowSize;
+    }
+
+    uint16_t GetWindowSize() const { return mWindowSize; }
+
     bool IsSynchronizing() { return mStatus == Status::SyncInProcess; }
     bool IsSynchronized() { return mStatus == Status::Synced; }
 
@@ -82,7 +119,7 @@ public:
         mStatus = Status::Synced;
         new (&mSynced) Synced();
         mSynced.mMaxCounter = counter;
-        mSynced.mWindow.reset(); // reset all bits, accept all packets in the window
+        ClearWindow(); // reset all bits, accept all packets in the window
         return CHIP_NO_ERROR;
     }
 
@@ -190,7 +227,7 @@ public:
         mStatus = Status::Synced;
         new (&mSynced) Synced();
         mSynced.mMaxCounter = value;
-        mSynced.mWindow.reset();
+        ClearWindow();
     }
 
     uint32_t GetCounter() const { return mSynced.mMaxCounter; }
@@ -258,7 +295,7 @@ private:
         }
 
         uint32_t offset = mSynced.mMaxCounter - counter;
-        if (offset <= CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE)
+        if (offset <= mWindowSize)
         {
             return Position::InWindow;
         }
@@ -277,8 +314,7 @@ private:
         case Position::FutureCounter:
             return CHIP_NO_ERROR;
         case Position::InWindow: {
-            uint32_t offset = mSynced.mMaxCounter - counter;
-            if (mSynced.mWindow.test(offset - 1))
+            if (TestWindowBit(counter))
             {
                 return CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED;
             }
@@ -302,8 +338,7 @@ private:
         case Position::MaxCounter:
             return CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED;
         case Position::InWindow: {
-            uint32_t offset = mSynced.mMaxCounter - counter;
-            if (mSynced.mWindow.test(offset - 1))
+            if (TestWindowBit(counter))
             {
                 return CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED;
             }
@@ -339,8 +374,7 @@ private:
         switch (position)
         {
         case Position::InWindow: {
-            uint32_t offset = mSynced.mMaxCounter - counter;
-            mSynced.mWindow.set(offset - 1);
+            AssignWindowBits(counter, 1, true);
             break;
         }
         case Position::MaxCounter: {
@@ -348,23 +382,58 @@ private:
             break;
         }
         default: {
-            // Since we are committing, this becomes a new max-counter value.
-            uint32_t shift      = counter - mSynced.mMaxCounter;
-            mSynced.mMaxCounter = counter;
-            if (shift > CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE)
+            // Since we are committing, this becomes a new max-counter value.  The old max counter is now in the
+            // window and was seen; the values in between join the window unseen.  Nothing has to be shifted:
+            // the slots they take over belonged to the values that just left the window.
+            uint32_t shift = counter - mSynced.mMaxCounter;
+            if (shift > mWindowSize)
             {
-                mSynced.mWindow.reset();
+                ClearWindow();
             }
             else
             {
-                mSynced.mWindow <<= shift;
-                mSynced.mWindow.set(shift - 1);
+                AssignWindowBits(mSynced.mMaxCounter, 1, true);
+                AssignWindowBits(mSynced.mMaxCounter + 1, shift - 1, false);
             }
+            mSynced.mMaxCounter = counter;
             break;
         }
         }
     }
 
+    using WindowWord                       = uint32_t;
+    static constexpr uint32_t kBitsPerWord = 32;
+
+    // The window is a ring of bits indexed by counter value modulo its capacity, so that moving the max counter only
+    // touches the bits of the values joining the window, however large the window is.  The capacity is a power of
+    // two, so that the ring stays contiguous when the counter wraps around 2^32.
+    static constexpr uint32_t kWindowCapacity = Internal::MessageCounterWindowCapacity(kMaxWindowSize, kBitsPerWord);
+    static constexpr uint32_t kWindowWords    = kWindowCapacity / kBitsPerWord;
+
+    bool TestWindowBit(uint32_t counter) const
+    {
+        uint32_t slot = counter & (kWindowCapacity - 1);
+        return ((mSynced.mWindow[slot / kBitsPerWord] >> (slot % kBitsPerWord)) & 1) != 0;
+    }
+
+    // Set or clear the bits of the count counter values starting at first, a word at a time.
+    void AssignWindowBits(uint32_t first, uint32_t count, bool value)
+    {
+        while (count > 0)
+        {
+            uint32_t slot     = first & (kWindowCapacity - 1);
+            uint32_t bit      = slot % kBitsPerWord;
+            uint32_t n        = std::min(count, kBitsPerWord - bit);
+            WindowWord mask   = (n == kBitsPerWord) ? ~WindowWord(0) : static_cast<WindowWord>(((1u << n) - 1) << bit);
+            WindowWord & word = mSynced.mWindow[slot / kBitsPerWord];
+            word              = value ? (word | mask) : (word & ~mask);
+            first += n;
+            count -= n;
+        }
+    }
+
+    void ClearWindow() { mSynced.mWindow.fill(0); }
+
     enum class Status
     {
         NotSynced,     // No state associated
@@ -380,17 +449,20 @@ private:
     struct Synced
     {
         /*
-         *  Past <--                --> Future
-         *          MaxCounter - 1
-         *                 |
-         *                 v
-         *  | <-- mWindow -->|
-         *  |[n]|  ...   |[0]|
+         *  Past <--                          --> Future
+         *  MaxCounter - WindowSize    MaxCounter - 1
+         *            |                      |
+         *            v                      v
+         *            | <----- mWindow ----> |
+         *
+         *  Counter value c is tracked by bit (c % kWindowCapacity) of mWindow.
          */
         uint32_t mMaxCounter = 0; // The most recent counter we have seen
-        std::bitset<CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE> mWindow;
+        std::array<WindowWord, kWindowWords> mWindow{};
     };
 
+    uint16_t mWindowSize = CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE;
+
     // We should use std::variant here when migrated to C++17
     union
     {
@@ -0,0 +1,105 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <transport/PeerRateLimiter.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace Transport {
+
+static_assert(CHIP_CONFIG_PEER_RATE_LIMITER_TABLE_SIZE > 0, "The peer rate limiter needs at least one entry");
+
+bool TokenBucket::TryConsume(const RateLimit & limit, System::Clock::Timestamp now)
+{
+    if (!limit.IsEnabled())
+    {
+        return true;
+    }
+
+    const uint64_t capacity = static_cast<uint64_t>(std::max<uint32_t>(limit.mBurst, 1)) * kScale;
+    if (!mStarted)
+    {
+        mScaledTokens = capacity;
+        mStarted      = true;
+    }
+    else if (now > mLastUpdate)
+    {
+        // Past capacity milliseconds the bucket is full whatever the rate, which also keeps the product from overflowing.
+        const uint64_t elapsedMs = std::min<uint64_t>((now - mLastUpdate).count(), capacity);
+        mScaledTokens            = std::min(capacity, mScaledTokens + elapsedMs * limit.mRatePerSecond);
+    }
+    mLastUpdate = now;
+
+    if (mScaledTokens < kScale)
+    {
+        return false;
+    }
+    mScaledTokens -= kScale;
+    return true;
+}
+
+void PeerRateLimiter::SetLimit(const RateLimit & limit)
+{
+    mLimit = limit;
+    for (auto & entry : mEntries)
+    {
+        entry.mTransportType = Type::kUndefined;
+    }
+}
+
+bool PeerRateLimiter::Admit(const PeerAddress & peer, System::Clock::Timestamp now)
+{
+    if (!mLimit.IsEnabled())
+    {
+        return true;
+    }
+
+    if (FindOrAllocate(peer).mBucket.TryConsume(mLimit, now))
+    {
+        return true;
+    }
+    mDroppedCount++;
+    return false;
+}
+
+PeerRateLimiter::Entry & PeerRateLimiter::FindOrAllocate(const PeerAddress & peer)
+{
+    Entry * victim = &mEntries[0];
+    for (auto & entry : mEntries)
+    {
+        if (entry.mTransportType == peer.GetTransportType() && entry.mAddress == peer.GetIPAddress())
+        {
+            return entry;
+        }
+
+        // Prefer an unused entry, then the least recently used one.
+        if (victim->mTransportType != Type::kUndefined &&
+            (entry.mTransportType == Type::kUndefined || entry.mBucket.GetLastUpdate() < victim->mBucket.GetLastUpdate()))
+        {
+            victim = &entry;
+        }
+    }
+
+    victim->mAddress       = peer.GetIPAddress();
+    victim->mTransportType = peer.GetTransportType();
+    victim->mBucket.Reset();
+    return *victim;
+}
+
+} // namespace Transport
+} // namespace chip
@@ -0,0 +1,108 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <inet/IPAddress.h>
+#include <lib/core/CHIPConfig.h>
+#include <system/SystemClock.h>
+#include <transport/raw/PeerAddress.h>
+
+namespace chip {
+namespace Transport {
+
+/**
+ * The rate at which messages are admitted: a sustained mRatePerSecond, with bursts of up to mBurst messages.
+ * A rate of 0 admits everything.
+ */
+struct RateLimit
+{
+    uint32_t mRatePerSecond = 0;
+    uint32_t mBurst         = 0;
+
+    bool IsEnabled() const { return mRatePerSecond != 0; }
+};
+
+/**
+ * A token bucket: it fills up at the rate of a RateLimit, up to its burst, and each admitted message takes a token.
+ *
+ * Tokens are counted in thousandths, so that a rate in tokens per second is exactly a rate in thousandths per millisecond.
+ */
+class TokenBucket
+{
+public:
+    /**
+     * Take a token, after adding the ones accrued since the previous call.  A bucket starts full.
+     *
+     * @return false, and take nothing, if the bucket is empty.
+     */
+    bool TryConsume(const RateLimit & limit, System::Clock::Timestamp now);
+
+    System::Clock::Timestamp GetLastUpdate() const { return mLastUpdate; }
+
+    void Reset() { mStarted = false; }
+
+private:
+    static constexpr uint64_t kScale = 1000;
+
+    uint64_t mScaledTokens               = 0;
+    System::Clock::Timestamp mLastUpdate = System::Clock::kZero;
+    bool mStarted                        = false;
+};
+
+/**
+ * Rate limits received messages per source address, with a token bucket for each of the last
+ * CHIP_CONFIG_PEER_RATE_LIMITER_TABLE_SIZE addresses seen.  When the table is full, the address that sent nothing for the
+ * longest time gives its bucket up to the new one.
+ *
+ * Addresses are compared without their port, which a flooding peer can change at will.
+ */
+class PeerRateLimiter
+{
+public:
+    explicit PeerRateLimiter(const RateLimit & limit = RateLimit()) : mLimit(limit) {}
+
+    /// Change the limit; every address starts over with a full bucket.
+    void SetLimit(const RateLimit & limit);
+    const RateLimit & GetLimit() const { return mLimit; }
+
+    /**
+     * Whether a message from the given peer is admitted.  Refused messages are counted in GetDroppedCount().
+     */
+    bool Admit(const PeerAddress & peer, System::Clock::Timestamp now);
+
+    uint32_t GetDroppedCount() const { return mDroppedCount; }
+
+private:
+    struct Entry
+    {
+        Inet::IPAddress mAddress;
+        Type mTransportType = Type::kUndefined;
+        TokenBucket mBucket;
+    };
+
+    Entry & FindOrAllocate(const PeerAddress & peer);
+
+    Entry mEntries[CHIP_CONFIG_PEER_RATE_LIMITER_TABLE_SIZE];
+    RateLimit mLimit;
+    uint32_t mDroppedCount = 0;
+};
+
+} // namespace Transport
+} // namespace chip
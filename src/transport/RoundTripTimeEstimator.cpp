@@ -0,0 +1,54 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <transport/RoundTripTimeEstimator.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace Transport {
+
+void RoundTripTimeEstimator::AddSample(System::Clock::Milliseconds32 rtt)
+{
+    const uint32_t sample = std::min(rtt.count(), kMaxSampleMs);
+
+    if (!mHasSample)
+    {
+        // RFC 6298 (2.2): SRTT <- R, RTTVAR <- R/2
+        mScaledSmoothedRtt  = sample << 3;
+        mScaledRttVariation = sample << 1;
+        mHasSample          = true;
+        return;
+    }
+
+    // RFC 6298 (2.3), with RTTVAR updated from the previous SRTT:
+    //   RTTVAR <- 3/4 * RTTVAR + 1/4 * |SRTT - R|
+    //   SRTT   <- 7/8 * SRTT + 1/8 * R
+    const uint32_t smoothedRtt = mScaledSmoothedRtt >> 3;
+    const uint32_t deviation   = (smoothedRtt > sample) ? smoothedRtt - sample : sample - smoothedRtt;
+    mScaledRttVariation        = mScaledRttVariation - (mScaledRttVariation >> 2) + deviation;
+    mScaledSmoothedRtt         = mScaledSmoothedRtt - (mScaledSmoothedRtt >> 3) + sample;
+}
+
+System::Clock::Milliseconds32 RoundTripTimeEstimator::GetRetransmissionTimeout() const
+{
+    // 4 * RTTVAR is the scaled variation itself.
+    return System::Clock::Milliseconds32((mScaledSmoothedRtt >> 3) + std::max<uint32_t>(1, mScaledRttVariation));
+}
+
+} // namespace Transport
+} // namespace chip
@@ -0,0 +1,77 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <system/SystemClock.h>
+
+namespace chip {
+namespace Transport {
+
+/**
+ * Tracks the round trip time to a peer the way RFC 6298 does for TCP: a smoothed round trip time (SRTT)
+ * and its variation (RTTVAR), from which a retransmission timeout is derived.
+ *
+ * The values are kept scaled (SRTT * 8 and RTTVAR * 4), so that the 1/8 and 1/4 gains of RFC 6298 are
+ * applied with integer arithmetic and without losing precision to truncation.
+ */
+class RoundTripTimeEstimator
+{
+public:
+    /**
+     * Add a round trip time measurement.  Per Karn's algorithm, callers must only measure messages that
+     * were not retransmitted.
+     */
+    void AddSample(System::Clock::Milliseconds32 rtt);
+
+    void Reset()
+    {
+        mScaledSmoothedRtt  = 0;
+        mScaledRttVariation = 0;
+        mHasSample          = false;
+    }
+
+    bool HasSample() const { return mHasSample; }
+
+    System::Clock::Milliseconds32 GetSmoothedRoundTripTime() const
+    {
+        return System::Clock::Milliseconds32(mScaledSmoothedRtt >> 3);
+    }
+    System::Clock::Milliseconds32 GetRoundTripTimeVariation() const
+    {
+        return System::Clock::Milliseconds32(mScaledRttVariation >> 2);
+    }
+
+    /**
+     * The retransmission timeout of RFC 6298 section 2, SRTT + max(G, 4 * RTTVAR), with a 1ms clock
+     * granularity G and without the 1 second floor, which is for the caller to choose.
+     */
+    System::Clock::Milliseconds32 GetRetransmissionTimeout() const;
+
+private:
+    // Measurements above this are clamped, so that the scaled values cannot overflow.
+    static constexpr uint32_t kMaxSampleMs = UINT32_MAX >> 4;
+
+    uint32_t mScaledSmoothedRtt  = 0; // SRTT * 8, in milliseconds
+    uint32_t mScaledRttVariation = 0; // RTTVAR * 4, in milliseconds
+    bool mHasSample              = false;
+};
+
+} // namespace Transport
+} // namespace chip
@@ -203,6 +203,12 @@ bool SecureSession::IsCommissioningSession() const
     return false;
 }
 
+void SecureSession::MarkActive()
+{
+    mLastActivityTime = System::SystemClock().GetMonotonicTimestamp();
+    mTable.MarkActive(this);
+}
+
 void SecureSession::Retain()
 {
 #if CHIP_CONFIG_SECURE_SESSION_REFCOUNT_LOGGING
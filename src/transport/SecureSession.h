@@ -24,8 +24,11 @@
 #include <app/util/basic-types.h>
 #include <ble/Ble.h>
 #include <lib/core/ReferenceCounted.h>
+#include <lib/support/IntrusiveList.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 #include <transport/CryptoContext.h>
+#include <transport/PeerRateLimiter.h>
+#include <transport/RoundTripTimeEstimator.h>
 #include <transport/Session.h>
 #include <transport/SessionMessageCounter.h>
 #include <transport/raw/PeerAddress.h>
@@ -40,6 +43,9 @@ public:
     static void Release(SecureSession * entry);
 };
 
+/// Sessions of a SecureSessionTable, least recently active first
+using SecureSessionActivityList = IntrusiveList<SecureSession, IntrusiveMode::AutoUnlink>;
+
 /**
  * Defines state of a peer connection at a transport layer.
  *
@@ -53,7 +59,9 @@ public:
  *     last used. Inactive connections can expire.
  *   - CryptoContext contains the encryption context of a connection
  */
-class SecureSession : public Session, public ReferenceCounted<SecureSession, SecureSessionDeleter, 0, uint16_t>
+class SecureSession : public Session,
+                      public ReferenceCounted<SecureSession, SecureSessionDeleter, 0, uint16_t>,
+                      public IntrusiveListNodeBase<IntrusiveMode::AutoUnlink>
 {
 public:
     /**
@@ -239,7 +247,7 @@ public:
 
     System::Clock::Timestamp GetLastActivityTime() const { return mLastActivityTime; }
     System::Clock::Timestamp GetLastPeerActivityTime() const { return mLastPeerActivityTime; }
-    void MarkActive() { mLastActivityTime = System::SystemClock().GetMonotonicTimestamp(); }
+    void MarkActive();
     void MarkActiveRx()
     {
         mLastPeerActivityTime = System::SystemClock().GetMonotonicTimestamp();
@@ -274,6 +282,13 @@ public:
 
     SessionMessageCounter & GetSessionMessageCounter() { return mSessionMessageCounter; }
 
+    /// Round trip time to the peer, measured by the ReliableMessageMgr from acknowledgment timing.
+    RoundTripTimeEstimator & GetRoundTripTimeEstimator() { return mRoundTripTime; }
+    const RoundTripTimeEstimator & GetRoundTripTimeEstimator() const { return mRoundTripTime; }
+
+    /// Admission of received messages, checked by the SessionManager before decryption.
+    TokenBucket & GetReceiveRateLimiter() { return mReceiveRateLimiter; }
+
     // This should be a private API, only meant to be called by SecureSessionTable
     // Session holders to this session may shift to the target session regarding SessionDelegate::GetNewSessionHandlingPolicy.
     // It requires that the target sessoin is also a CASE session, having the same peer and CATs as this session.
@@ -330,6 +345,7 @@ private:
     void MoveToState(State targetState);
 
     friend class SecureSessionDeleter;
+    friend class SecureSessionTable;
     friend class TestSecureSessionTable;
 
     SecureSessionTable & mTable;
@@ -342,6 +358,9 @@ private:
     const uint16_t mLocalSessionId;
     uint16_t mPeerSessionId = 0;
 
+    // Next session in the same bucket of the owning SecureSessionTable's local session ID index.
+    SecureSession * mNextInTable = nullptr;
+
     PeerAddress mPeerAddress;
 
     /// Timestamp of last tx or rx. @see SessionTimestamp in the spec
@@ -353,6 +372,8 @@ private:
     SessionParameters mRemoteSessionParams;
     CryptoContext mCryptoContext;
     SessionMessageCounter mSessionMessageCounter;
+    RoundTripTimeEstimator mRoundTripTime;
+    TokenBucket mReceiveRateLimiter;
 };
 
 } // namespace Transport
@@ -52,8 +52,8 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSessionForTest(Secure
         }
     }
 
-    SecureSession * result = mEntries.CreateObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs,
-                                                   peerSessionId, fabricIndex, config);
+    SecureSession * result = AddToIndex(mEntries.CreateObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId,
+                                                              peerCATs, peerSessionId, fabricIndex, config));
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
@@ -73,7 +73,7 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSession(SecureSession
     //
     if (mEntries.Allocated() < GetMaxSessionTableSize())
     {
-        allocated = mEntries.CreateObject(*this, secureSessionType, sessionId.Value());
+        allocated = AddToIndex(mEntries.CreateObject(*this, secureSessionType, sessionId.Value()));
     }
     else
     {
@@ -139,7 +139,12 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
     //
     // This will be used by the session eviction algorithm later.
     //
-    ForEachSession([&index, &sortableSessions, this](auto * session) {
+    // The sessions are gathered least recently active first. The sort is stable, so this already is the order on Key6, and
+    // sessions that tie on the other keys are not moved around, even when their activity timestamps are equal.
+    //
+    for (SecureSession & entry : mActivityList)
+    {
+        SecureSession * session                      = &entry;
         sortableSessions[index].mSession             = session;
         sortableSessions[index].mNumMatchingOnFabric = 0;
         sortableSessions[index].mNumMatchingOnPeer   = 0;
@@ -162,8 +167,7 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
         });
 
         index++;
-        return Loop::Continue;
-    });
+    }
 
     auto sortableSessionSpan = Span<SortableSession>(sortableSessions, mEntries.Allocated());
     EvictionPolicyContext policyContext(sortableSessionSpan, sessionEvictionHint);
@@ -216,7 +220,7 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
         if (newCount < prevCount)
         {
             ChipLogProgress(SecureChannel, "Successfully evicted a session!");
-            auto * retSession = mEntries.CreateObject(*this, secureSessionType, localSessionId);
+            auto * retSession = AddToIndex(mEntries.CreateObject(*this, secureSessionType, localSessionId));
             VerifyOrDie(session != nullptr);
             return retSession;
         }
@@ -337,67 +341,59 @@ void SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionC
     });
 }
 
-Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t localSessionId)
+SecureSession * SecureSessionTable::AddToIndex(SecureSession * session)
 {
-    SecureSession * result = nullptr;
-    mEntries.ForEachActiveObject([&](auto session) {
-        if (session->GetLocalSessionId() == localSessionId)
-        {
-            result = session;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
-    return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
+    VerifyOrReturnValue(session != nullptr, nullptr);
+
+    SecureSession *& bucket = IndexBucket(session->GetLocalSessionId());
+    session->mNextInTable   = bucket;
+    bucket                  = session;
+    mActivityList.PushBack(session);
+    return session;
 }
 
-Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
+void SecureSessionTable::RemoveFromIndex(SecureSession * session)
 {
-    uint16_t candidate_base = 0;
-    uint64_t candidate_mask = 0;
-    for (uint32_t i = 0; i <= kMaxSessionID; i += 64)
+    for (SecureSession ** link = &IndexBucket(session->GetLocalSessionId()); *link != nullptr; link = &(*link)->mNextInTable)
     {
-        // candidate_base is the base session ID we are searching from.
-        // We have a 64-bit mask anchored at this ID and iterate over the
-        // whole session table, setting bits in the mask for in-use IDs.
-        // If we can iterate through the entire session table and have
-        // any bits clear in the mask, we have available session IDs.
-        candidate_base = static_cast<uint16_t>(i + mNextSessionId);
-        candidate_mask = 0;
+        if (*link == session)
         {
-            uint16_t shift = static_cast<uint16_t>(kUnsecuredSessionId - candidate_base);
-            if (shift <= 63)
-            {
-                candidate_mask |= (1ULL << shift); // kUnsecuredSessionId is never available
-            }
+            *link                 = session->mNextInTable;
+            session->mNextInTable = nullptr;
+            return;
         }
-        mEntries.ForEachActiveObject([&](auto session) {
-            uint16_t shift = static_cast<uint16_t>(session->GetLocalSessionId() - candidate_base);
-            if (shift <= 63)
-            {
-                candidate_mask |= (1ULL << shift);
-            }
-            if (candidate_mask == UINT64_MAX)
-            {
-                return Loop::Break; // No bits clear means this bucket is full.
-            }
-            return Loop::Continue;
-        });
-        if (candidate_mask != UINT64_MAX)
+    }
+}
+
+SecureSession * SecureSessionTable::FindInIndex(uint16_t localSessionId) const
+{
+    for (SecureSession * session = mIndex[localSessionId % CHIP_CONFIG_SECURE_SESSION_INDEX_BUCKETS]; session != nullptr;
+         session = session->mNextInTable)
+    {
+        if (session->GetLocalSessionId() == localSessionId)
         {
-            break; // Any bit clear means we have an available ID in this bucket.
+            return session;
         }
     }
-    if (candidate_mask != UINT64_MAX)
+    return nullptr;
+}
+
+Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t localSessionId)
+{
+    SecureSession * result = FindInIndex(localSessionId);
+    return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
+}
+
+Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
+{
+    uint16_t candidate = mNextSessionId;
+    for (uint32_t i = 0; i <= kMaxSessionID; i++, candidate++)
     {
-        uint16_t offset = 0;
-        while (candidate_mask & 1)
+        // kUnsecuredSessionId is never available.
+        if (candidate != kUnsecuredSessionId && FindInIndex(candidate) == nullptr)
         {
-            candidate_mask >>= 1;
-            ++offset;
+            return MakeOptional<uint16_t>(candidate);
         }
-        uint16_t available = static_cast<uint16_t>(candidate_base + offset);
-        return MakeOptional<uint16_t>(available);
     }
 
     return NullOptional;
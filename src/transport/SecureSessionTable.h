@@ -20,6 +20,7 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/Pool.h>
 #include <lib/support/SortUtils.h>
+#include <system/SystemStats.h>
 #include <system/TimeSource.h>
 #include <transport/SecureSession.h>
 
@@ -41,7 +42,11 @@ class SecureSessionTable
 public:
     ~SecureSessionTable() { mEntries.ReleaseAll(); }
 
-    void Init() { mNextSessionId = chip::Crypto::GetRandU16(); }
+    void Init()
+    {
+        mNextSessionId = chip::Crypto::GetRandU16();
+        mEntriesStats.Register(mEntries);
+    }
 
     /**
      * Allocate a new secure session out of the internal resource pool.
@@ -76,7 +81,19 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> CreateNewSecureSession(SecureSession::Type secureSessionType, ScopedNodeId sessionEvictionHint);
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    void ReleaseSession(SecureSession * session)
+    {
+        RemoveFromIndex(session);
+        mEntries.ReleaseObject(session);
+    }
+
+    // Move the session to the most recently active end of the activity list, from SecureSession::MarkActive.
+    // This is an internal API, using raw pointer to a session is allowed here.
+    void MarkActive(SecureSession * session)
+    {
+        session->Unlink();
+        mActivityList.PushBack(session);
+    }
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -227,7 +244,8 @@ private:
      *           over active, healthy ones, over those are currently in the process of establishment.
      *
      *    Key6:  Sessions that have a less recent activity time are placed ahead of those with a more recent activity time. This
-     *           is the canonical sorting criteria for basic LRU.
+     *           is the canonical sorting criteria for basic LRU. The sessions are handed to the policy in this order already
+     *           (see mActivityList), which also orders those with equal activity times.
      *
      */
     void DefaultEvictionPolicy(EvictionPolicyContext & evictionContext);
@@ -243,21 +261,37 @@ private:
     /**
      * Find an available session ID that is unused in the secure session table.
      *
-     * The search algorithm iterates over the session ID space in the outer loop
-     * and the session table in the inner loop to locate an available session ID
-     * from the starting mNextSessionId clue.
-     *
-     * The outer-loop considers 64 session IDs in each iteration to give a
-     * runtime complexity of O(CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE^2/64).  Speed up could be
-     * achieved with a sorted session table or additional storage.
+     * Session IDs are probed in the local session ID index, starting from the
+     * mNextSessionId clue.  At most one probe per session in the table can hit
+     * an ID in use, so this is O(table size) in the worst case and a single
+     * probe in the common case of sequentially allocated IDs.
      *
      * @return an unused session ID if any is found, else NullOptional
      */
     CHECK_RETURN_VALUE
     Optional<uint16_t> FindUnusedSessionId();
 
+    // Index over mEntries by local session ID, chained through SecureSession::mNextInTable.  Every session
+    // created out of mEntries must be passed to AddToIndex, which also appends it to mActivityList.
+    SecureSession * AddToIndex(SecureSession * session);
+    void RemoveFromIndex(SecureSession * session);
+    SecureSession * FindInIndex(uint16_t localSessionId) const;
+
+    SecureSession *& IndexBucket(uint16_t localSessionId)
+    {
+        return mIndex[localSessionId % CHIP_CONFIG_SECURE_SESSION_INDEX_BUCKETS];
+    }
+
     bool mRunningEvictionLogic = false;
+    // Declared before the pool, the entries referencing it
+    SecureSessionActivityList mActivityList;
+#if CHIP_CONFIG_SECURE_SESSION_POOL_USE_SLAB
+    ObjectPool<SecureSession, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE, ObjectPoolMem::kSlab> mEntries;
+#else
     ObjectPool<SecureSession, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mEntries;
+#endif // CHIP_CONFIG_SECURE_SESSION_POOL_USE_SLAB
+    SecureSession * mIndex[CHIP_CONFIG_SECURE_SESSION_INDEX_BUCKETS] = {};
+    System::Stats::PoolStatistics mEntriesStats{ SYSTEM_STATS_METRIC_KEYS("secure_sessions") };
 
     size_t GetMaxSessionTableSize() const
     {
@@ -35,6 +35,7 @@
 #include <inttypes.h>
 #include <lib/core/CHIPKeyIds.h>
 #include <lib/core/Global.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/logging/CHIPLogging.h>
@@ -69,6 +70,7 @@ public:
 
     Releasable * operator->() { return mIter; }
     const Releasable * operator->() const { return mIter; }
+    Releasable & operator*() { return *mIter; }
 
     bool IsNull() const { return mIter == nullptr; }
 
@@ -147,6 +149,10 @@ CHIP_ERROR SessionManager::Init(System::Layer * systemLayer, TransportMgrBase *
 
     mTransportMgr->SetSessionManager(this);
 
+#if CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+    ReturnErrorOnFailure(mDecryptWorkers.Init(*systemLayer, *this));
+#endif // CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     mConnCompleteCb = nullptr;
     mConnClosedCb   = nullptr;
@@ -166,6 +172,11 @@ void SessionManager::Shutdown()
     // Ensure that we don't create new sessions as we iterate our session table.
     mState = State::kNotReady;
 
+#if CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+    // Drop messages still being decrypted; they hold references to our sessions.
+    mDecryptWorkers.Shutdown();
+#endif // CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+
     // Just in case some consumer forgot to do it, expire all our secure
     // sessions.  Note that this stands a good chance of crashing with a
     // null-deref if there are in fact any secure sessions left, since they will
@@ -194,6 +205,36 @@ void SessionManager::FabricRemoved(FabricIndex fabricIndex)
     gGroupPeerTable->FabricRemoved(fabricIndex);
 }
 
+CHIP_ERROR SessionManager::SetMessageCounterWindowSize(Transport::Session::SessionType sessionType, uint16_t windowSize)
+{
+    VerifyOrReturnError(windowSize >= 1 && windowSize <= Transport::PeerMessageCounter::kMaxWindowSize,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    switch (sessionType)
+    {
+    case Transport::Session::SessionType::kUnauthenticated:
+        mUnauthenticatedCounterWindowSize = windowSize;
+        return CHIP_NO_ERROR;
+    case Transport::Session::SessionType::kSecure:
+        mSecureCounterWindowSize = windowSize;
+        return CHIP_NO_ERROR;
+    case Transport::Session::SessionType::kGroupIncoming:
+        mGroupCounterWindowSize = windowSize;
+        return CHIP_NO_ERROR;
+    default:
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+}
+
+void SessionManager::SetSecureSessionRateLimit(const Transport::RateLimit & limit)
+{
+    mSecureSessionRateLimit = limit;
+    mSecureSessions.ForEachSession([](auto session) {
+        session->GetReceiveRateLimiter().Reset();
+        return Loop::Continue;
+    });
+}
+
 CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, PayloadHeader & payloadHeader,
                                           System::PacketBufferHandle && message, EncryptedPacketBufferHandle & preparedMessage)
 {
@@ -260,9 +301,13 @@ CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, P
         packetHeader.SetSessionId(keyContext->GetKeyHash());
         CryptoContext::NonceStorage nonce;
         CryptoContext::BuildNonce(nonce, packetHeader.GetSecurityFlags(), packetHeader.GetMessageCounter(), sourceNodeId);
+        const auto encryptStart = Tracing::ExchangeStageStart();
+
         CHIP_ERROR err = SecureMessageCodec::Encrypt(CryptoContext(keyContext), nonce, payloadHeader, packetHeader, message);
         keyContext->Release();
         ReturnErrorOnFailure(err);
+        MATTER_LOG_EXCHANGE_EVENT(Tracing::ExchangeEventType::kEncrypt, payloadHeader.GetExchangeID(), payloadHeader.IsInitiator(),
+                                  sessionHandle.operator->(), Tracing::ExchangeStageDuration(encryptStart));
 
 #if CHIP_PROGRESS_LOGGING
         destination = NodeIdFromGroupId(groupSession->GetGroupId());
@@ -296,7 +341,10 @@ CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, P
         sourceNodeId = session->GetLocalScopedNodeId().GetNodeId();
         CryptoContext::BuildNonce(nonce, packetHeader.GetSecurityFlags(), messageCounter, sourceNodeId);
 
+        const auto encryptStart = Tracing::ExchangeStageStart();
         ReturnErrorOnFailure(SecureMessageCodec::Encrypt(session->GetCryptoContext(), nonce, payloadHeader, packetHeader, message));
+        MATTER_LOG_EXCHANGE_EVENT(Tracing::ExchangeEventType::kEncrypt, payloadHeader.GetExchangeID(), payloadHeader.IsInitiator(),
+                                  session, Tracing::ExchangeStageDuration(encryptStart));
 
 #if CHIP_PROGRESS_LOGGING
         destination = session->GetPeerNodeId();
@@ -656,6 +704,8 @@ CHIP_ERROR SessionManager::InjectCaseSessionWithTestKey(SessionHolder & sessionH
 void SessionManager::OnMessageReceived(const PeerAddress & peerAddress, System::PacketBufferHandle && msg,
                                        Transport::MessageTransportContext * ctxt)
 {
+    CHIP_MEMORY_TAG_SCOPE(kTransport);
+
     PacketHeader partialPacketHeader;
 
     CHIP_ERROR err = partialPacketHeader.DecodeFixed(msg);
@@ -665,6 +715,12 @@ void SessionManager::OnMessageReceived(const PeerAddress & peerAddress, System::
         return;
     }
 
+    if (!mPeerAddressRateLimiter.Admit(peerAddress, System::SystemClock().GetMonotonicTimestamp()))
+    {
+        MATTER_TRACE_COUNTER("PeerAddressRateLimited");
+        return;
+    }
+
     if (partialPacketHeader.IsEncrypted())
     {
         if (partialPacketHeader.IsGroupSession())
@@ -876,6 +932,7 @@ void SessionManager::UnauthenticatedMessageDispatch(const PacketHeader & partial
     ReturnOnFailure(payloadHeader.DecodeAndConsume(msg));
 
     // Verify message counter
+    unsecuredSession->GetPeerMessageCounter().SetWindowSize(mUnauthenticatedCounterWindowSize);
     CHIP_ERROR err = unsecuredSession->GetPeerMessageCounter().VerifyUnencrypted(packetHeader.GetMessageCounter());
     if (err == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED)
     {
@@ -912,8 +969,6 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
 {
     MATTER_TRACE_SCOPE("Secure Unicast Message Dispatch", "SessionManager");
 
-    CHIP_ERROR err = CHIP_NO_ERROR;
-
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     if (peerAddress.GetTransportType() == Transport::Type::kTcp && ctxt->conn == nullptr)
     {
@@ -929,7 +984,14 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
         return;
     }
 
-    Transport::SecureSession * secureSession  = session.Value()->AsSecureSession();
+    Transport::SecureSession * secureSession = session.Value()->AsSecureSession();
+    if (!secureSession->GetReceiveRateLimiter().TryConsume(mSecureSessionRateLimit, System::SystemClock().GetMonotonicTimestamp()))
+    {
+        mSessionRateLimitedMessageCount++;
+        MATTER_TRACE_COUNTER("SessionRateLimited");
+        return;
+    }
+
     Transport::PeerAddress mutablePeerAddress = peerAddress;
     CorrectPeerAddressInterfaceID(mutablePeerAddress);
     if (secureSession->GetPeerAddress() != mutablePeerAddress)
@@ -957,8 +1019,6 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
     }
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
-    PayloadHeader payloadHeader;
-
     // Drop secure unicast messages with privacy enabled.
     if (partialPacketHeader.HasPrivacyFlag())
     {
@@ -969,8 +1029,6 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
     PacketHeader packetHeader;
     ReturnOnFailure(packetHeader.DecodeAndConsume(msg));
 
-    SessionMessageDelegate::DuplicateMessage isDuplicate = SessionMessageDelegate::DuplicateMessage::No;
-
     if (msg.IsNull())
     {
         ChipLogError(Inet, "Secure transport received Unicast NULL packet, discarding");
@@ -997,14 +1055,67 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
     CryptoContext::BuildNonce(nonce, packetHeader.GetSecurityFlags(), packetHeader.GetMessageCounter(),
                               secureSession->GetSecureSessionType() == SecureSession::Type::kCASE ? secureSession->GetPeerNodeId()
                                                                                                   : kUndefinedNodeId);
+
+#if CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+    // Decryption continues on a worker thread, and dispatch in OnMessageDecrypted().
+    CHIP_ERROR err = mDecryptWorkers.Submit(session.Value(), packetHeader, nonce, peerAddress, std::move(msg));
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Secure transport could not queue message for decryption, discarding: %" CHIP_ERROR_FORMAT,
+                     err.Format());
+    }
+#else
+    PayloadHeader payloadHeader;
+    const auto decryptStart = Tracing::ExchangeStageStart();
     if (SecureMessageCodec::Decrypt(secureSession->GetCryptoContext(), nonce, payloadHeader, packetHeader, msg) != CHIP_NO_ERROR)
     {
         ChipLogError(Inet, "Secure transport received message, but failed to decode/authenticate it, discarding");
         return;
     }
+    MATTER_LOG_EXCHANGE_EVENT(Tracing::ExchangeEventType::kDecrypt, payloadHeader.GetExchangeID(), payloadHeader.IsInitiator(),
+                              secureSession, Tracing::ExchangeStageDuration(decryptStart));
+
+    SecureUnicastMessageDecrypted(session.Value(), packetHeader, payloadHeader, peerAddress, std::move(msg));
+#endif // CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+}
+
+#if CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+void SessionManager::OnMessageDecrypted(Transport::DecryptJob & job)
+{
+    VerifyOrReturn(mState == State::kInitialized);
+
+    // The session may have changed state while the message was being decrypted.
+    Transport::SecureSession * secureSession = job.session->AsSecureSession();
+    if (!secureSession->IsDefunct() && !secureSession->IsActiveSession() && !secureSession->IsPendingEviction())
+    {
+        ChipLogError(Inet, "Secure transport received message on a session in an invalid state (state = '%s')",
+                     secureSession->GetStateStr());
+        return;
+    }
+
+    if (job.result != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Secure transport received message, but failed to decode/authenticate it, discarding");
+        return;
+    }
+    MATTER_LOG_EXCHANGE_EVENT(Tracing::ExchangeEventType::kDecrypt, job.payloadHeader.GetExchangeID(),
+                              job.payloadHeader.IsInitiator(), secureSession, job.decryptDuration);
+
+    SecureUnicastMessageDecrypted(job.session, job.packetHeader, job.payloadHeader, job.peerAddress, std::move(job.msg));
+}
+#endif // CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+
+void SessionManager::SecureUnicastMessageDecrypted(const SessionHandle & session, const PacketHeader & packetHeader,
+                                                   const PayloadHeader & payloadHeader, const Transport::PeerAddress & peerAddress,
+                                                   System::PacketBufferHandle && msg)
+{
+    Transport::SecureSession * secureSession             = session->AsSecureSession();
+    SessionMessageDelegate::DuplicateMessage isDuplicate = SessionMessageDelegate::DuplicateMessage::No;
 
-    err =
-        secureSession->GetSessionMessageCounter().GetPeerMessageCounter().VerifyEncryptedUnicast(packetHeader.GetMessageCounter());
+    Transport::PeerMessageCounter & peerCounter = secureSession->GetSessionMessageCounter().GetPeerMessageCounter();
+    peerCounter.SetWindowSize(mSecureCounterWindowSize);
+
+    CHIP_ERROR err = peerCounter.VerifyEncryptedUnicast(packetHeader.GetMessageCounter());
     if (err == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED)
     {
         ChipLogDetail(Inet,
@@ -1031,7 +1142,7 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
 
     if (isDuplicate == SessionMessageDelegate::DuplicateMessage::No)
     {
-        secureSession->GetSessionMessageCounter().GetPeerMessageCounter().CommitEncryptedUnicast(packetHeader.GetMessageCounter());
+        peerCounter.CommitEncryptedUnicast(packetHeader.GetMessageCounter());
     }
 
     if (mCB != nullptr)
@@ -1047,7 +1158,7 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
             secureSession->SetCaseCommissioningSessionStatus(secureSession->GetFabricIndex() ==
                                                              mFabricTable->GetPendingNewFabricIndex());
         }
-        mCB->OnMessageReceived(packetHeader, payloadHeader, session.Value(), isDuplicate, std::move(msg));
+        mCB->OnMessageReceived(packetHeader, payloadHeader, session, isDuplicate, std::move(msg));
     }
     else
     {
@@ -1110,6 +1221,128 @@ static bool GroupKeyDecryptAttempt(const PacketHeader & partialPacketHeader, Pac
     return decrypted;
 }
 
+#if CHIP_CONFIG_GROUP_TRIAL_DECRYPTION_BATCH_SIZE > 1
+/**
+ * Helper function to trial-decrypt a groupcast message sent without privacy obfuscation,
+ * passing several candidate group keys to each AES_CCM_decrypt_multi_key() call.
+ *
+ * The packet header is in the clear, so it is decoded, and the nonce and AAD are built, once for
+ * all candidates.  The ciphertext is left intact between attempts, so the message is not cloned
+ * for each key.
+ *
+ * @param[out] packetHeaderCopy The decoded packet header
+ * @param[out] payloadHeader The payload header of the decrypted message
+ * @param[in,out] msg The received message, replaced with the decrypted message on success
+ * @param[in] mac The MAC of the message
+ * @param[in] iter The group sessions matching the session ID of the message
+ * @param[in] liveSessions Number of the most recent sessions returned by iter that stay usable
+ * @param[out] groupContext The group session whose key decrypted the message
+ *
+ * @return true if the message was decrypted successfully
+ * @return false if the message could not be decrypted
+ */
+static bool GroupKeyBatchDecryptAttempt(PacketHeader & packetHeaderCopy, PayloadHeader & payloadHeader,
+                                        System::PacketBufferHandle & msg, const MessageAuthenticationCode & mac,
+                                        Credentials::GroupDataProvider::GroupSessionIterator & iter, size_t liveSessions,
+                                        Credentials::GroupDataProvider::GroupSession & groupContext)
+{
+    constexpr size_t kBatchSize = CHIP_CONFIG_GROUP_TRIAL_DECRYPTION_BATCH_SIZE;
+    const size_t batchSize      = std::min(kBatchSize, liveSessions);
+
+    if (packetHeaderCopy.DecodeAndConsume(msg) != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Failed to decode Groupcast packet header. Discarding.");
+        return false;
+    }
+
+    GroupId groupId     = packetHeaderCopy.GetDestinationGroupId().Value();
+    const size_t tagLen = packetHeaderCopy.MICTagLength();
+    VerifyOrReturnValue(msg->DataLength() > tagLen, false);
+    const uint8_t * ciphertext = msg->Start();
+    const size_t len           = msg->DataLength() - tagLen;
+
+    System::PacketBufferHandle plainMsg = System::PacketBufferHandle::New(len);
+    VerifyOrReturnValue(!plainMsg.IsNull(), false, ChipLogError(Inet, "Failed to allocate Groupcast message buffer. Discarding."));
+    uint8_t * plaintext = plainMsg->Start();
+
+    CryptoContext::NonceStorage nonce;
+    VerifyOrReturnValue(CryptoContext::BuildNonce(nonce, packetHeaderCopy.GetSecurityFlags(), packetHeaderCopy.GetMessageCounter(),
+                                                  packetHeaderCopy.GetSourceNodeId().Value()) == CHIP_NO_ERROR,
+                        false);
+    uint8_t aad[CryptoContext::kMaxAADLen];
+    uint16_t aadLen = sizeof(aad);
+    VerifyOrReturnValue(CryptoContext::GetAdditionalAuthData(packetHeaderCopy, aad, aadLen) == CHIP_NO_ERROR, false);
+
+    Credentials::GroupDataProvider::GroupSession candidates[kBatchSize];
+    const Crypto::Aes128KeyHandle * keys[kBatchSize];
+    size_t count = 0;
+    // Number of calls to Next() since, and including, the one that returned candidates[0].
+    size_t callsSinceFirstCandidate = 0;
+    bool decrypted                  = false;
+
+    auto tryCandidates = [&]() {
+        size_t keyIndex = 0;
+        decrypted       = count > 0 &&
+            Crypto::AES_CCM_decrypt_multi_key(ciphertext, len, aad, aadLen, mac.GetTag(), tagLen, keys, count, nonce.data(),
+                                              nonce.size(), plaintext, keyIndex) == CHIP_NO_ERROR;
+        if (decrypted)
+        {
+            groupContext = candidates[keyIndex];
+        }
+        count = 0;
+    };
+
+    Credentials::GroupDataProvider::GroupSession session;
+    while (!decrypted)
+    {
+        // Another call to Next() would invalidate the key of the first candidate.
+        if (count > 0 && callsSinceFirstCandidate == batchSize)
+        {
+            tryCandidates();
+            continue;
+        }
+
+        if (!iter.Next(session))
+        {
+            tryCandidates();
+            break;
+        }
+        callsSinceFirstCandidate++;
+
+        // Optimization to reduce number of decryption attempts
+        if (session.group_id != groupId)
+        {
+            continue;
+        }
+
+        const Crypto::Aes128KeyHandle * key = session.keyContext->GetMessageKeyHandle();
+        if (key == nullptr)
+        {
+            CryptoContext context(session.keyContext);
+            if (context.Decrypt(ciphertext, len, plaintext, nonce, packetHeaderCopy, mac) == CHIP_NO_ERROR)
+            {
+                groupContext = session;
+                decrypted    = true;
+            }
+            continue;
+        }
+
+        if (count == 0)
+        {
+            callsSinceFirstCandidate = 1;
+        }
+        candidates[count] = session;
+        keys[count++]     = key;
+    }
+
+    VerifyOrReturnValue(decrypted, false);
+
+    plainMsg->SetDataLength(len);
+    msg = std::move(plainMsg);
+    return payloadHeader.DecodeAndConsume(msg) == CHIP_NO_ERROR;
+}
+#endif // CHIP_CONFIG_GROUP_TRIAL_DECRYPTION_BATCH_SIZE > 1
+
 void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPacketHeader,
                                                 const Transport::PeerAddress & peerAddress, System::PacketBufferHandle && msg)
 {
@@ -1158,7 +1391,18 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
     VerifyOrReturn(taglen == footerLen);
 
     bool decrypted = false;
-    while (!decrypted && iter->Next(groupContext))
+    bool batched   = false;
+#if CHIP_CONFIG_GROUP_TRIAL_DECRYPTION_BATCH_SIZE > 1
+    // Without privacy obfuscation, the packet header is the same for all candidate keys, so they can be tried in batches.
+    const size_t liveSessions = groups->GetLiveGroupSessionCount();
+    if (!partialPacketHeader.HasPrivacyFlag() && liveSessions > 1)
+    {
+        batched   = true;
+        decrypted = GroupKeyBatchDecryptAttempt(packetHeaderCopy, payloadHeader, msg, mac, *iter, liveSessions, groupContext);
+        msgCopy   = std::move(msg);
+    }
+#endif // CHIP_CONFIG_GROUP_TRIAL_DECRYPTION_BATCH_SIZE > 1
+    while (!batched && !decrypted && iter->Next(groupContext))
     {
         CryptoContext context(groupContext.keyContext);
         msgCopy = msg.CloneData();
@@ -1225,6 +1469,8 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
         gGroupPeerTable->FindOrAddPeer(groupContext.fabric_index, packetHeaderCopy.GetSourceNodeId().Value(),
                                        packetHeaderCopy.IsSecureSessionControlMsg(), counter))
     {
+        counter->SetWindowSize(mGroupCounterWindowSize);
+
         if (Credentials::GroupDataProvider::SecurityPolicy::kTrustFirst == groupContext.security_policy)
         {
             err = counter->VerifyOrTrustFirstGroup(packetHeaderCopy.GetMessageCounter());
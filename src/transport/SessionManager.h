@@ -38,9 +38,11 @@
 #include <messaging/ReliableMessageProtocolConfig.h>
 #include <protocols/secure_channel/Constants.h>
 #include <transport/CryptoContext.h>
+#include <transport/DecryptWorkerPool.h>
 #include <transport/GroupPeerMessageCounter.h>
 #include <transport/GroupSession.h>
 #include <transport/MessageCounterManagerInterface.h>
+#include <transport/PeerRateLimiter.h>
 #include <transport/SecureSessionTable.h>
 #include <transport/Session.h>
 #include <transport/SessionDelegate.h>
@@ -143,7 +145,11 @@ private:
     EncryptedPacketBufferHandle(PacketBufferHandle && aBuffer) : PacketBufferHandle(std::move(aBuffer)) {}
 };
 
-class DLL_EXPORT SessionManager : public TransportMgrDelegate, public FabricTable::Delegate
+class DLL_EXPORT SessionManager : public TransportMgrDelegate,
+#if CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+                                  private Transport::DecryptWorkerPool::Delegate,
+#endif // CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+                                  public FabricTable::Delegate
 {
 public:
     SessionManager();
@@ -177,6 +183,43 @@ public:
     void SetConnectionDelegate(SessionConnectionDelegate * cb) { mConnDelegate = cb; }
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
+    /**
+     * @brief
+     *   Set the message counter window used for received messages on sessions of the given type: how many counter
+     *   values behind the highest one received are still accepted, if not already seen.  Larger windows drop fewer
+     *   reordered messages, for example over multi-path networks.  Existing sessions pick up the new size with their
+     *   next received message.
+     *
+     * @retval #CHIP_ERROR_INVALID_ARGUMENT if sessionType does not receive messages, or windowSize is 0 or larger than
+     *                                      CHIP_CONFIG_MESSAGE_COUNTER_MAX_WINDOW_SIZE.
+     */
+    CHIP_ERROR SetMessageCounterWindowSize(Transport::Session::SessionType sessionType, uint16_t windowSize);
+
+    /**
+     * @brief
+     *   Limit the rate of messages accepted from each source address, whatever their kind.  The limit is applied right
+     *   after the fixed part of the packet header is decoded, so that a flooding peer costs neither session lookups nor
+     *   decryption.  Dropped messages are counted in the "PeerAddressRateLimited" tracing counter.
+     *
+     *   Defaults to CHIP_CONFIG_PEER_ADDRESS_RATE_LIMIT_PER_SECOND and CHIP_CONFIG_PEER_ADDRESS_RATE_LIMIT_BURST.
+     */
+    void SetPeerAddressRateLimit(const Transport::RateLimit & limit) { mPeerAddressRateLimiter.SetLimit(limit); }
+
+    /**
+     * @brief
+     *   Limit the rate of messages accepted on each secure unicast session, checked before decryption.  Dropped messages
+     *   are counted in the "SessionRateLimited" tracing counter.  Existing sessions start over with a full bucket.
+     *
+     *   Defaults to CHIP_CONFIG_SECURE_SESSION_RATE_LIMIT_PER_SECOND and CHIP_CONFIG_SECURE_SESSION_RATE_LIMIT_BURST.
+     */
+    void SetSecureSessionRateLimit(const Transport::RateLimit & limit);
+
+    /// The number of received messages dropped by the source address and secure session rate limits.
+    uint32_t GetRateLimitedMessageCount() const
+    {
+        return mPeerAddressRateLimiter.GetDroppedCount() + mSessionRateLimitedMessageCount;
+    }
+
     // Test-only: create a session on the fly.
     CHIP_ERROR InjectPaseSessionWithTestKey(SessionHolder & sessionHolder, uint16_t localSessionId, NodeId peerNodeId,
                                             uint16_t peerSessionId, FabricIndex fabricIndex,
@@ -255,17 +298,10 @@ public:
     template <typename Function>
     CHIP_ERROR ForEachMatchingSessionOnLogicalFabric(const ScopedNodeId & node, Function && function)
     {
-        Crypto::P256PublicKey targetPubKey;
-
         auto * targetFabric = mFabricTable->FindFabricWithIndex(node.GetFabricIndex());
         VerifyOrReturnError(targetFabric != nullptr, CHIP_ERROR_INVALID_FABRIC_INDEX);
 
-        auto err = targetFabric->FetchRootPubkey(targetPubKey);
-        VerifyOrDie(err == CHIP_NO_ERROR);
-
         mSecureSessions.ForEachSession([&](auto * session) {
-            Crypto::P256PublicKey comparePubKey;
-
             //
             // It's entirely possible to either come across a PASE session OR, a CASE session
             // that has yet to be activated (i.e a CASEServer holding onto a SecureSession object
@@ -279,11 +315,7 @@ public:
             auto * compareFabric = mFabricTable->FindFabricWithIndex(session->GetFabricIndex());
             VerifyOrDie(compareFabric != nullptr);
 
-            err = compareFabric->FetchRootPubkey(comparePubKey);
-            VerifyOrDie(err == CHIP_NO_ERROR);
-
-            if (comparePubKey.Matches(targetPubKey) && targetFabric->GetFabricId() == compareFabric->GetFabricId() &&
-                session->GetPeerNodeId() == node.GetNodeId())
+            if (targetFabric->IsSameLogicalFabric(*compareFabric) && session->GetPeerNodeId() == node.GetNodeId())
             {
                 function(session);
             }
@@ -307,17 +339,10 @@ public:
     template <typename Function>
     CHIP_ERROR ForEachMatchingSessionOnLogicalFabric(FabricIndex fabricIndex, Function && function)
     {
-        Crypto::P256PublicKey targetPubKey;
-
         auto * targetFabric = mFabricTable->FindFabricWithIndex(fabricIndex);
         VerifyOrReturnError(targetFabric != nullptr, CHIP_ERROR_INVALID_FABRIC_INDEX);
 
-        auto err = targetFabric->FetchRootPubkey(targetPubKey);
-        VerifyOrDie(err == CHIP_NO_ERROR);
-
         mSecureSessions.ForEachSession([&](auto * session) {
-            Crypto::P256PublicKey comparePubKey;
-
             //
             // It's entirely possible to either come across a PASE session OR, a CASE session
             // that has yet to be activated (i.e a CASEServer holding onto a SecureSession object
@@ -331,10 +356,7 @@ public:
             auto * compareFabric = mFabricTable->FindFabricWithIndex(session->GetFabricIndex());
             VerifyOrDie(compareFabric != nullptr);
 
-            err = compareFabric->FetchRootPubkey(comparePubKey);
-            VerifyOrDie(err == CHIP_NO_ERROR);
-
-            if (comparePubKey.Matches(targetPubKey) && targetFabric->GetFabricId() == compareFabric->GetFabricId())
+            if (targetFabric->IsSameLogicalFabric(*compareFabric))
             {
                 function(session);
             }
@@ -579,6 +601,23 @@ private:
 
     GlobalUnencryptedMessageCounter mGlobalUnencryptedMessageCounter;
 
+    uint16_t mUnauthenticatedCounterWindowSize = CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE;
+    uint16_t mSecureCounterWindowSize          = CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE;
+    uint16_t mGroupCounterWindowSize           = CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE;
+
+    Transport::PeerRateLimiter mPeerAddressRateLimiter{ Transport::RateLimit{ CHIP_CONFIG_PEER_ADDRESS_RATE_LIMIT_PER_SECOND,
+                                                                              CHIP_CONFIG_PEER_ADDRESS_RATE_LIMIT_BURST } };
+    Transport::RateLimit mSecureSessionRateLimit{ CHIP_CONFIG_SECURE_SESSION_RATE_LIMIT_PER_SECOND,
+                                                  CHIP_CONFIG_SECURE_SESSION_RATE_LIMIT_BURST };
+    uint32_t mSessionRateLimitedMessageCount = 0;
+
+#if CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+    Transport::DecryptWorkerPool mDecryptWorkers;
+
+    // DecryptWorkerPool::Delegate
+    void OnMessageDecrypted(Transport::DecryptJob & job) override;
+#endif // CHIP_CONFIG_SECURE_MESSAGE_DECRYPT_WORKERS > 0
+
     /**
      * @brief Parse, decrypt, validate, and dispatch a secure unicast message.
      *
@@ -592,6 +631,19 @@ private:
     void SecureUnicastMessageDispatch(const PacketHeader & partialPacketHeader, const Transport::PeerAddress & peerAddress,
                                       System::PacketBufferHandle && msg, Transport::MessageTransportContext * ctxt = nullptr);
 
+    /**
+     * @brief Validate the message counter of, and dispatch, a decrypted secure unicast message.
+     *
+     * @param session The session the message was received on.
+     * @param packetHeader The fully decoded PacketHeader of the message.
+     * @param payloadHeader The PayloadHeader recovered from the message.
+     * @param peerAddress The PeerAddress of the message as provided by the receiving Transport Endpoint.
+     * @param msg The decrypted message payload.
+     */
+    void SecureUnicastMessageDecrypted(const SessionHandle & session, const PacketHeader & packetHeader,
+                                       const PayloadHeader & payloadHeader, const Transport::PeerAddress & peerAddress,
+                                       System::PacketBufferHandle && msg);
+
     /**
      * @brief Parse, decrypt, validate, and dispatch a secure group message.
      *
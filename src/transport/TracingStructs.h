@@ -17,6 +17,8 @@
 #pragma once
 
 #include <lib/support/Span.h>
+#include <matter/tracing/build_config.h>
+#include <system/SystemClock.h>
 #include <transport/Session.h>
 #include <transport/raw/MessageHeader.h>
 #include <transport/raw/PeerAddress.h>
@@ -61,5 +63,76 @@ struct MessageReceivedInfo
     const chip::ByteSpan payload;
 };
 
+/// Stages of an exchange, keyed by exchange ID and session so that a backend can follow a single
+/// interaction across the messaging layers.
+///
+/// Stages with a duration cover the time spent in them, ending when the event is logged. The time
+/// between the other stages is spent queueing or on the network.
+enum class ExchangeEventType : uint8_t
+{
+    kAllocated,        // An exchange context has been created
+    kMessageSend,      // A message is handed to the exchange for sending
+    kEncrypt,          // A message has been encrypted (duration: encryption)
+    kRetransmit,       // An unacknowledged message is sent again
+    kAckReceived,      // A message has been acknowledged (duration: since it was first sent)
+    kDecrypt,          // A received message has been decrypted (duration: decryption)
+    kMessageProcessed, // The exchange delegate has processed a received message (duration: processing)
+    kClosed,           // The exchange context has been released
+};
+
+/// An exchange went through a stage
+struct ExchangeEventInfo
+{
+    ExchangeEventType type;
+    uint16_t exchangeId;
+    bool isInitiator;
+    const Transport::Session * session;
+    System::Clock::Microseconds64 duration;
+};
+
+inline const char * ExchangeEventTypeToString(ExchangeEventType type)
+{
+    switch (type)
+    {
+    case ExchangeEventType::kAllocated:
+        return "Allocated";
+    case ExchangeEventType::kMessageSend:
+        return "MessageSend";
+    case ExchangeEventType::kEncrypt:
+        return "Encrypt";
+    case ExchangeEventType::kRetransmit:
+        return "Retransmit";
+    case ExchangeEventType::kAckReceived:
+        return "AckReceived";
+    case ExchangeEventType::kDecrypt:
+        return "Decrypt";
+    case ExchangeEventType::kMessageProcessed:
+        return "MessageProcessed";
+    case ExchangeEventType::kClosed:
+        return "Closed";
+    }
+    return "UNKNOWN";
+}
+
+/// Returns the start time of an exchange stage. The clock is only read when tracing is enabled.
+inline System::Clock::Microseconds64 ExchangeStageStart()
+{
+#if MATTER_TRACING_ENABLED
+    return System::SystemClock().GetMonotonicMicroseconds64();
+#else
+    return System::Clock::Microseconds64(0);
+#endif
+}
+
+/// Returns the time spent in an exchange stage that began at the given start time
+inline System::Clock::Microseconds64 ExchangeStageDuration(System::Clock::Microseconds64 start)
+{
+#if MATTER_TRACING_ENABLED
+    return System::SystemClock().GetMonotonicMicroseconds64() - start;
+#else
+    return System::Clock::Microseconds64(0);
+#endif
+}
+
 } // namespace Tracing
 } // namespace chip
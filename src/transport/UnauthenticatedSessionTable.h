@@ -20,6 +20,7 @@
 #include <lib/core/CHIPError.h>
 #include <lib/core/ReferenceCounted.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/IntrusiveList.h>
 #include <lib/support/Pool.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 #include <system/SystemConfig.h>
@@ -31,11 +32,18 @@
 namespace chip {
 namespace Transport {
 
+class UnauthenticatedSession;
+
+/// Sessions of an UnauthenticatedSessionTable, least recently active first
+using UnauthenticatedSessionActivityList = IntrusiveList<UnauthenticatedSession, IntrusiveMode::AutoUnlink>;
+
 /**
  * @brief
  *   An UnauthenticatedSession stores the binding of TransportAddress, and message counters.
  */
-class UnauthenticatedSession : public Session, public ReferenceCounted<UnauthenticatedSession, UnauthenticatedSession, 0>
+class UnauthenticatedSession : public Session,
+                               public ReferenceCounted<UnauthenticatedSession, UnauthenticatedSession, 0>,
+                               public IntrusiveListNodeBase<IntrusiveMode::AutoUnlink>
 {
 public:
     enum class SessionRole
@@ -46,12 +54,14 @@ public:
 
 protected:
     UnauthenticatedSession(SessionRole sessionRole, NodeId ephemeralInitiatorNodeID, const Transport::PeerAddress & peerAddress,
-                           const ReliableMessageProtocolConfig & config) :
+                           const ReliableMessageProtocolConfig & config, UnauthenticatedSessionActivityList & activityList) :
         mEphemeralInitiatorNodeId(ephemeralInitiatorNodeID),
         mSessionRole(sessionRole), mPeerAddress(peerAddress), mLastActivityTime(System::SystemClock().GetMonotonicTimestamp()),
         mLastPeerActivityTime(System::Clock::kZero), // Start at zero to default to IDLE state
-        mRemoteSessionParams(config)
-    {}
+        mRemoteSessionParams(config), mActivityList(activityList)
+    {
+        mActivityList.PushBack(this);
+    }
     ~UnauthenticatedSession() override { VerifyOrDie(GetReferenceCount() == 0); }
 
 public:
@@ -62,7 +72,13 @@ public:
 
     System::Clock::Timestamp GetLastActivityTime() const { return mLastActivityTime; }
     System::Clock::Timestamp GetLastPeerActivityTime() const { return mLastPeerActivityTime; }
-    void MarkActive() { mLastActivityTime = System::SystemClock().GetMonotonicTimestamp(); }
+    void MarkActive()
+    {
+        mLastActivityTime = System::SystemClock().GetMonotonicTimestamp();
+        // Move to the most recently active end, which keeps the list sorted by mLastActivityTime.
+        Unlink();
+        mActivityList.PushBack(this);
+    }
     void MarkActiveRx()
     {
         mLastPeerActivityTime = System::SystemClock().GetMonotonicTimestamp();
@@ -189,6 +205,7 @@ private:
     System::Clock::Timestamp mLastPeerActivityTime; ///< Timestamp of last rx
     SessionParameters mRemoteSessionParams;
     PeerMessageCounter mPeerMessageCounter;
+    UnauthenticatedSessionActivityList & mActivityList;
 };
 
 template <size_t kMaxSessionCount>
@@ -203,7 +220,7 @@ public:
     UnauthenticatedSessionPoolEntry(SessionRole sessionRole, NodeId ephemeralInitiatorNodeID,
                                     const Transport::PeerAddress & peerAddress, const ReliableMessageProtocolConfig & config,
                                     UnauthenticatedSessionTable<kMaxSessionCount> & sessionTable) :
-        UnauthenticatedSession(sessionRole, ephemeralInitiatorNodeID, peerAddress, config)
+        UnauthenticatedSession(sessionRole, ephemeralInitiatorNodeID, peerAddress, config, sessionTable.mActivityList)
 #if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
         ,
         mSessionTable(sessionTable)
@@ -226,6 +243,9 @@ private:
  *
  *   The UnauthenticatedSession entries are rotated using LRU, but entry can be hold by using SessionHandle or
  *   SessionHolder, which increase the reference count by 1. If the reference count is not 0, the entry won't be pruned.
+ *
+ *   The entries are kept in a list ordered by activity, so that the least recently used one is found without scanning
+ *   the pool.
  */
 template <size_t kMaxSessionCount>
 class UnauthenticatedSessionTable
@@ -241,6 +261,7 @@ public:
         // that we don't hit fatal asserts in our pool destructor.
         mEntries.ReleaseAll();
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        mActivityList.Clear();
     }
 
     /**
@@ -297,6 +318,8 @@ public:
     }
 
 private:
+    friend class TestUnauthenticatedSessionTable;
+
     using EntryType = detail::UnauthenticatedSessionPoolEntry<kMaxSessionCount>;
     friend EntryType;
 
@@ -359,23 +382,22 @@ private:
 
     EntryType * FindLeastRecentUsedEntry()
     {
-        EntryType * result                  = nullptr;
-        System::Clock::Timestamp oldestTime = System::Clock::Timestamp(std::numeric_limits<System::Clock::Timestamp::rep>::max());
-
-        mEntries.ForEachActiveObject([&](EntryType * entry) {
-            if (entry->GetReferenceCount() == 0 && entry->GetLastActivityTime() < oldestTime)
+        // Only the sessions held by a SessionHandle or a SessionHolder are skipped, so this is usually the first entry.
+        for (UnauthenticatedSession & entry : mActivityList)
+        {
+            if (entry.GetReferenceCount() == 0)
             {
-                result     = entry;
-                oldestTime = entry->GetLastActivityTime();
+                return static_cast<EntryType *>(&entry);
             }
-            return Loop::Continue;
-        });
+        }
 
-        return result;
+        return nullptr;
     }
 
     void ReleaseEntry(EntryType * entry) { mEntries.ReleaseObject(entry); }
 
+    // Declared before the pool, the entries referencing it
+    UnauthenticatedSessionActivityList mActivityList;
     ObjectPool<EntryType, kMaxSessionCount> mEntries;
 };
 
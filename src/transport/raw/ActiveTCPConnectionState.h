@@ -27,6 +27,7 @@
 #include <inet/InetInterface.h>
 #include <inet/TCPEndPoint.h>
 #include <lib/core/CHIPCore.h>
+#include <system/SystemClock.h>
 #include <transport/raw/PeerAddress.h>
 #include <transport/raw/TCPConfig.h>
 
@@ -97,6 +98,13 @@ struct ActiveTCPConnectionState
     // corresponding application.
     AppTCPConnectionCallbackCtxt * mAppState = nullptr;
 
+    // Time of the last message sent or received on the connection.
+    System::Clock::Timestamp mLastActivityTime = System::Clock::kZero;
+
+    // Next connection in the same bucket of the peer address index of the
+    // transport while in use, next free connection otherwise.
+    ActiveTCPConnectionState * mNext = nullptr;
+
     // KeepAlive interval in seconds
     uint16_t mTCPKeepAliveIntervalSecs = CHIP_CONFIG_TCP_KEEPALIVE_INTERVAL_SECS;
     uint16_t mTCPMaxNumKeepAliveProbes = CHIP_CONFIG_MAX_TCP_KEEPALIVE_PROBES;
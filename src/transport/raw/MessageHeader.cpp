@@ -87,6 +87,17 @@ constexpr uint8_t kMsgFlagsMask = 0x07;
 /// Shift to convert to/from a masked version 8bit value to a 4bit version.
 constexpr int kVersionShift = 4;
 
+/// Message flags that must be clear for PacketHeader::DecodeSecureUnicast: version 0, no node IDs
+constexpr uint8_t kSecureUnicastMsgFlagsMask = kVersionMask | kMsgFlagsMask;
+
+/// Security flags that must be clear for PacketHeader::DecodeSecureUnicast: unicast session, no message extensions
+constexpr uint8_t kSecureUnicastSecFlagsMask =
+    to_underlying(Header::SecFlagValues::kMsgExtensionFlag) | Header::SecFlagMask::kSessionTypeMask;
+
+/// Exchange flags that must be clear for PayloadHeader::DecodeCommonProtocol
+constexpr uint8_t kCommonProtocolExFlagsMask = to_underlying(Header::ExFlagValues::kExchangeFlag_VendorIdPresent) |
+    to_underlying(Header::ExFlagValues::kExchangeFlag_SecuredExtension);
+
 } // namespace
 
 uint16_t PacketHeader::EncodeSizeBytes() const
@@ -161,8 +172,35 @@ CHIP_ERROR PacketHeader::DecodeFixed(const System::PacketBufferHandle & buf)
     return DecodeFixedCommon(reader);
 }
 
+bool PacketHeader::DecodeSecureUnicast(const uint8_t * const data, size_t size, uint16_t * decode_len)
+{
+    static_assert(kMsgHeaderVersion == 0, "A header with another version would not match kSecureUnicastMsgFlagsMask");
+
+    if (size < kFixedUnencryptedHeaderSizeBytes || (data[0] & kSecureUnicastMsgFlagsMask) != 0 ||
+        (data[3] & kSecureUnicastSecFlagsMask) != 0)
+    {
+        return false;
+    }
+
+    SetMessageFlags(data[0]);
+    mSessionId = LittleEndian::Get16(&data[1]);
+    SetSecurityFlags(data[3]);
+    mMessageCounter = LittleEndian::Get32(&data[4]);
+    mSourceNodeId.ClearValue();
+    mDestinationNodeId.ClearValue();
+    mDestinationGroupId.ClearValue();
+
+    *decode_len = static_cast<uint16_t>(kFixedUnencryptedHeaderSizeBytes);
+    return true;
+}
+
 CHIP_ERROR PacketHeader::Decode(const uint8_t * const data, size_t size, uint16_t * decode_len)
 {
+    if (DecodeSecureUnicast(data, size, decode_len))
+    {
+        return CHIP_NO_ERROR;
+    }
+
     CHIP_ERROR err = CHIP_NO_ERROR;
     LittleEndian::Reader reader(data, size);
     // TODO: De-uint16-ify everything related to this library
@@ -247,8 +285,44 @@ CHIP_ERROR PacketHeader::DecodeAndConsume(const System::PacketBufferHandle & buf
     return CHIP_NO_ERROR;
 }
 
+bool PayloadHeader::DecodeCommonProtocol(const uint8_t * const data, size_t size, uint16_t * decode_len)
+{
+    if (size < kEncryptedHeaderSizeBytes || (data[0] & kCommonProtocolExFlagsMask) != 0)
+    {
+        return false;
+    }
+
+    mExchangeFlags.SetRaw(data[0]);
+    const bool hasAck       = mExchangeFlags.Has(Header::ExFlagValues::kExchangeFlag_AckMsg);
+    const size_t headerSize = kEncryptedHeaderSizeBytes + (hasAck ? kAckMessageCounterSizeBytes : 0);
+    if (size < headerSize)
+    {
+        return false;
+    }
+
+    mMessageType = data[1];
+    mExchangeID  = LittleEndian::Get16(&data[2]);
+    mProtocolID  = Protocols::Id(VendorId::Common, LittleEndian::Get16(&data[4]));
+    if (hasAck)
+    {
+        mAckMessageCounter.SetValue(LittleEndian::Get32(&data[kEncryptedHeaderSizeBytes]));
+    }
+    else
+    {
+        mAckMessageCounter.ClearValue();
+    }
+
+    *decode_len = static_cast<uint16_t>(headerSize);
+    return true;
+}
+
 CHIP_ERROR PayloadHeader::Decode(const uint8_t * const data, size_t size, uint16_t * decode_len)
 {
+    if (DecodeCommonProtocol(data, size, decode_len))
+    {
+        return CHIP_NO_ERROR;
+    }
+
     CHIP_ERROR err = CHIP_NO_ERROR;
     LittleEndian::Reader reader(data, size);
     uint8_t header;
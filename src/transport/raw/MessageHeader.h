@@ -498,6 +498,15 @@ private:
      */
     CHIP_ERROR DecodeFixedCommon(Encoding::LittleEndian::Reader & reader);
 
+    /**
+     * Decodes, from fixed offsets, a header that has the layout of almost all secure traffic:
+     * unicast session, no source or destination node ID and no message extensions.
+     *
+     * @return true if the header has that layout and was decoded, false if Decode must
+     *         parse it field by field.
+     */
+    bool DecodeSecureUnicast(const uint8_t * data, size_t size, uint16_t * decode_size);
+
     /// Represents the current encode/decode header version (4 bits)
     static constexpr uint8_t kMsgHeaderVersion = 0x00;
 
@@ -738,6 +747,14 @@ private:
 
     constexpr bool HaveVendorId() const { return mExchangeFlags.Has(Header::ExFlagValues::kExchangeFlag_VendorIdPresent); }
 
+    /**
+     * Decodes, from fixed offsets, a header without vendor ID nor secured extensions.
+     *
+     * @return true if the header has that layout and was decoded, false if Decode must
+     *         parse it field by field.
+     */
+    bool DecodeCommonProtocol(const uint8_t * data, size_t size, uint16_t * decode_size);
+
     /// Packet type (application data, security control packets, e.g. pairing,
     /// configuration, rekey etc)
     uint8_t mMessageType = 0;
@@ -51,6 +51,15 @@ constexpr uint32_t kMaxTCPMessageSize =
 
 constexpr int kListenBacklogSize = 2;
 
+// The interface is ignored, as it may not have been provided in the PeerAddress during
+// connection establishment. The IP address and port are the necessary and sufficient set
+// of parameters for searching through the connections.
+bool IsConnectedTo(const ActiveTCPConnectionState & connection, const PeerAddress & address)
+{
+    return connection.IsConnected() && connection.mPeerAddr.GetIPAddress() == address.GetIPAddress() &&
+        connection.mPeerAddr.GetPort() == address.GetPort();
+}
+
 } // namespace
 
 TCPBase::~TCPBase()
@@ -128,44 +137,126 @@ void TCPBase::Close()
     mState = TCPState::kNotReady;
 }
 
-ActiveTCPConnectionState * TCPBase::AllocateConnection()
+void TCPBase::InitConnectionPool()
 {
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    mFreeConnections = nullptr;
+    for (size_t i = mActiveConnectionsSize; i > 0; i--)
     {
-        if (!mActiveConnections[i].InUse())
-        {
-            return &mActiveConnections[i];
-        }
+        ActiveTCPConnectionState * connection = &mActiveConnections[i - 1];
+        connection->Init(nullptr, PeerAddress::Uninitialized());
+        connection->mNext       = mFreeConnections;
+        mFreeConnections        = connection;
+        mConnectionIndex[i - 1] = nullptr;
     }
+}
 
-    return nullptr;
+ActiveTCPConnectionState ** TCPBase::GetConnectionIndexBucket(const PeerAddress & addr) const
+{
+    // FNV-1a, a word at a time, of the IP address and port.
+    uint32_t hash = 2166136261u;
+    for (uint32_t word : addr.GetIPAddress().Addr)
+    {
+        hash = (hash ^ word) * 16777619u;
+    }
+    hash = (hash ^ addr.GetPort()) * 16777619u;
+
+    return &mConnectionIndex[hash % mActiveConnectionsSize];
 }
 
-// Find an ActiveTCPConnectionState corresponding to a peer address
-ActiveTCPConnectionState * TCPBase::FindActiveConnection(const PeerAddress & address)
+void TCPBase::AddToConnectionIndex(ActiveTCPConnectionState * connection)
 {
-    if (address.GetTransportType() != Type::kTcp)
+    ActiveTCPConnectionState ** bucket = GetConnectionIndexBucket(connection->mPeerAddr);
+    connection->mNext                  = *bucket;
+    *bucket                            = connection;
+}
+
+void TCPBase::RemoveFromConnectionIndex(ActiveTCPConnectionState * connection)
+{
+    ActiveTCPConnectionState ** link = GetConnectionIndexBucket(connection->mPeerAddr);
+    while (*link != nullptr && *link != connection)
+    {
+        link = &(*link)->mNext;
+    }
+
+    if (*link == connection)
+    {
+        *link             = connection->mNext;
+        connection->mNext = nullptr;
+    }
+}
+
+ActiveTCPConnectionState * TCPBase::AllocateConnection()
+{
+    // Closing the evicted connection calls back into the upper layers, which may
+    // take the connection it released.
+    if (mFreeConnections == nullptr && (!EvictIdleConnection() || mFreeConnections == nullptr))
     {
         return nullptr;
     }
 
+    ActiveTCPConnectionState * connection = mFreeConnections;
+    mFreeConnections                      = connection->mNext;
+    connection->mNext                     = nullptr;
+    return connection;
+}
+
+void TCPBase::ReleaseConnection(ActiveTCPConnectionState * connection)
+{
+    RemoveFromConnectionIndex(connection);
+    connection->Free();
+    connection->mNext = mFreeConnections;
+    mFreeConnections  = connection;
+}
+
+bool TCPBase::EvictIdleConnection()
+{
+    VerifyOrReturnValue(mMinIdleTimeForEviction != System::Clock::kZero, false);
+
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    ActiveTCPConnectionState * oldest  = nullptr;
+
     for (size_t i = 0; i < mActiveConnectionsSize; i++)
     {
-        if (!mActiveConnections[i].IsConnected())
+        ActiveTCPConnectionState * connection = &mActiveConnections[i];
+
+        // A connection with data still to be sent, or a partially received message, is not idle.
+        if (!connection->IsConnected() || connection->mEndPoint->PendingSendLength() > 0 || !connection->mReceived.IsNull() ||
+            now - connection->mLastActivityTime < mMinIdleTimeForEviction)
         {
             continue;
         }
-        Inet::IPAddress addr;
-        uint16_t port;
-        mActiveConnections[i].mEndPoint->GetPeerInfo(&addr, &port);
 
-        if ((addr == address.GetIPAddress()) && (port == address.GetPort()))
+        if (oldest == nullptr || connection->mLastActivityTime < oldest->mLastActivityTime)
         {
-            return &mActiveConnections[i];
+            oldest = connection;
         }
     }
 
-    return nullptr;
+    VerifyOrReturnValue(oldest != nullptr, false);
+
+    char addrStr[Transport::PeerAddress::kMaxToStringSize];
+    oldest->mPeerAddr.ToString(addrStr);
+    ChipLogProgress(Inet, "Evicting idle connection with peer %s.", addrStr);
+
+    CloseConnectionInternal(oldest, CHIP_NO_ERROR, SuppressCallback::No);
+    return true;
+}
+
+// Find an ActiveTCPConnectionState corresponding to a peer address
+ActiveTCPConnectionState * TCPBase::FindActiveConnection(const PeerAddress & address)
+{
+    if (address.GetTransportType() != Type::kTcp)
+    {
+        return nullptr;
+    }
+
+    ActiveTCPConnectionState * connection = *GetConnectionIndexBucket(address);
+    while (connection != nullptr && !IsConnectedTo(*connection, address))
+    {
+        connection = connection->mNext;
+    }
+
+    return connection;
 }
 
 // Find the ActiveTCPConnectionState for a given TCPEndPoint
@@ -223,6 +314,12 @@ CHIP_ERROR TCPBase::SendMessage(const Transport::PeerAddress & address, System::
 
     if (connection != nullptr)
     {
+        // Apply backpressure to the sender rather than queueing without bound on a slow connection.
+        const size_t pendingLength = connection->mEndPoint->PendingSendLength();
+        VerifyOrReturnError(pendingLength == 0 || pendingLength + msgBuf->TotalLength() <= CHIP_CONFIG_TCP_MAX_PENDING_SEND_BYTES,
+                            CHIP_ERROR_BUSY);
+
+        connection->mLastActivityTime = System::SystemClock().GetMonotonicTimestamp();
         return connection->mEndPoint->Send(std::move(msgBuf));
     }
 
@@ -248,18 +345,28 @@ CHIP_ERROR TCPBase::StartConnect(const PeerAddress & addr, Transport::AppTCPConn
     activeConnection = AllocateConnection();
     VerifyOrReturnError(activeConnection != nullptr, CHIP_ERROR_NO_MEMORY);
     activeConnection->Init(endPoint, addr);
-    activeConnection->mAppState        = appState;
-    activeConnection->mConnectionState = TCPState::kConnecting;
+    activeConnection->mAppState         = appState;
+    activeConnection->mConnectionState  = TCPState::kConnecting;
+    activeConnection->mLastActivityTime = System::SystemClock().GetMonotonicTimestamp();
+    AddToConnectionIndex(activeConnection);
+
+    // The endpoint is now freed along with the connection.
+    endPointHolder.release();
+
     // Set the return value of the peer connection state to the allocated
     // connection.
     *outPeerConnState = activeConnection;
 
-    ReturnErrorOnFailure(endPoint->Connect(addr.GetIPAddress(), addr.GetPort(), addr.GetInterface()));
+    CHIP_ERROR err = endPoint->Connect(addr.GetIPAddress(), addr.GetPort(), addr.GetInterface());
+    if (err != CHIP_NO_ERROR)
+    {
+        ReleaseConnection(activeConnection);
+        *outPeerConnState = nullptr;
+        return err;
+    }
 
     mUsedEndPointCount++;
 
-    endPointHolder.release();
-
     return CHIP_NO_ERROR;
 #else
     return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
@@ -271,6 +378,7 @@ CHIP_ERROR TCPBase::SendAfterConnect(const PeerAddress & addr, System::PacketBuf
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     // This will initiate a connection to the specified peer
     bool alreadyConnecting = false;
+    bool queueFull         = false;
 
     // Iterate through the ENTIRE array. If a pending packet for
     // the address already exists, this means a connection is pending and
@@ -280,7 +388,11 @@ CHIP_ERROR TCPBase::SendAfterConnect(const PeerAddress & addr, System::PacketBuf
         {
             // same destination exists.
             alreadyConnecting = true;
-            pending->mPacketBuffer->AddToEnd(std::move(msg));
+            queueFull = pending->mPacketBuffer->TotalLength() + msg->TotalLength() > CHIP_CONFIG_TCP_MAX_PENDING_SEND_BYTES;
+            if (!queueFull)
+            {
+                pending->mPacketBuffer->AddToEnd(std::move(msg));
+            }
             return Loop::Break;
         }
         return Loop::Continue;
@@ -289,18 +401,15 @@ CHIP_ERROR TCPBase::SendAfterConnect(const PeerAddress & addr, System::PacketBuf
     // If already connecting, buffer was just enqueued for more sending
     if (alreadyConnecting)
     {
-        return CHIP_NO_ERROR;
+        return queueFull ? CHIP_ERROR_BUSY : CHIP_NO_ERROR;
     }
 
-    // Ensures sufficient active connections size exist
-    VerifyOrReturnError(mUsedEndPointCount < mActiveConnectionsSize, CHIP_ERROR_NO_MEMORY);
-
+    // StartConnect() fails if no connection is left, even after evicting an idle one.
     Transport::ActiveTCPConnectionState * peerConnState = nullptr;
     ReturnErrorOnFailure(StartConnect(addr, nullptr, &peerConnState));
 
     // enqueue the packet once the connection succeeds
     VerifyOrReturnError(mPendingPackets.CreateObject(addr, std::move(msg)) != nullptr, CHIP_ERROR_NO_MEMORY);
-    mUsedEndPointCount++;
 
     return CHIP_NO_ERROR;
 #else
@@ -313,6 +422,7 @@ CHIP_ERROR TCPBase::ProcessReceivedBuffer(Inet::TCPEndPoint * endPoint, const Pe
 {
     ActiveTCPConnectionState * state = FindActiveConnection(endPoint);
     VerifyOrReturnError(state != nullptr, CHIP_ERROR_INTERNAL);
+    state->mLastActivityTime = System::SystemClock().GetMonotonicTimestamp();
     state->mReceived.AddToEnd(std::move(buffer));
 
     while (!state->mReceived.IsNull())
@@ -428,7 +538,7 @@ void TCPBase::CloseConnectionInternal(ActiveTCPConnectionState * connection, CHI
             }
         }
 
-        connection->Free();
+        ReleaseConnection(connection);
         mUsedEndPointCount--;
     }
 }
@@ -482,7 +592,8 @@ void TCPBase::HandleTCPEndPointConnectComplete(Inet::TCPEndPoint * endPoint, CHI
         VerifyOrDie(activeConnection != nullptr);
 
         // Set to Connected state
-        activeConnection->mConnectionState = TCPState::kConnected;
+        activeConnection->mConnectionState  = TCPState::kConnected;
+        activeConnection->mLastActivityTime = System::SystemClock().GetMonotonicTimestamp();
 
         // Disable TCP Nagle buffering by setting TCP_NODELAY socket option to true.
         // This is to expedite transmission of payload data and not rely on the
@@ -523,7 +634,17 @@ void TCPBase::HandleTCPEndPointConnectComplete(Inet::TCPEndPoint * endPoint, CHI
     else
     {
         ChipLogError(Inet, "Connection establishment with %s encountered an error: %" CHIP_ERROR_FORMAT, addrStr, err.Format());
-        endPoint->Free();
+
+        // Return the connection to the pool along with its endpoint.
+        activeConnection = tcp->FindInUseConnection(endPoint);
+        if (activeConnection != nullptr)
+        {
+            tcp->ReleaseConnection(activeConnection);
+        }
+        else
+        {
+            endPoint->Free();
+        }
         tcp->mUsedEndPointCount--;
     }
 }
@@ -561,10 +682,9 @@ void TCPBase::HandleIncomingConnection(Inet::TCPEndPoint * listenEndPoint, Inet:
     endPoint->GetInterfaceId(&interfaceId);
     PeerAddress addr = PeerAddress::TCP(ipAddress, port, interfaceId);
 
-    if (tcp->mUsedEndPointCount < tcp->mActiveConnectionsSize)
+    activeConnection = tcp->AllocateConnection();
+    if (activeConnection != nullptr)
     {
-        activeConnection = tcp->AllocateConnection();
-
         endPoint->mAppState          = listenEndPoint->mAppState;
         endPoint->OnDataReceived     = HandleTCPEndPointDataReceived;
         endPoint->OnDataSent         = nullptr;
@@ -575,8 +695,10 @@ void TCPBase::HandleIncomingConnection(Inet::TCPEndPoint * listenEndPoint, Inet:
 
         // Update state for the active connection
         activeConnection->Init(endPoint, addr);
+        tcp->AddToConnectionIndex(activeConnection);
         tcp->mUsedEndPointCount++;
-        activeConnection->mConnectionState = TCPState::kConnected;
+        activeConnection->mConnectionState  = TCPState::kConnected;
+        activeConnection->mLastActivityTime = System::SystemClock().GetMonotonicTimestamp();
 
         // Set the TCPKeepalive configurations on the received connection
         endPoint->EnableKeepAlive(activeConnection->mTCPKeepAliveIntervalSecs, activeConnection->mTCPMaxNumKeepAliveProbes);
@@ -610,8 +732,6 @@ CHIP_ERROR TCPBase::TCPConnect(const PeerAddress & address, Transport::AppTCPCon
     // Verify that PeerAddress AddressType is TCP
     VerifyOrReturnError(address.GetTransportType() == Transport::Type::kTcp, CHIP_ERROR_INVALID_ARGUMENT);
 
-    VerifyOrReturnError(mUsedEndPointCount < mActiveConnectionsSize, CHIP_ERROR_NO_MEMORY);
-
     char addrStr[Transport::PeerAddress::kMaxToStringSize];
     address.ToString(addrStr);
     ChipLogProgress(Inet, "Connecting to peer %s.", addrStr);
@@ -623,26 +743,22 @@ CHIP_ERROR TCPBase::TCPConnect(const PeerAddress & address, Transport::AppTCPCon
 
 void TCPBase::TCPDisconnect(const PeerAddress & address)
 {
+    VerifyOrReturn(address.GetTransportType() == Type::kTcp);
+
     // Closes an existing connection
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    ActiveTCPConnectionState * connection = *GetConnectionIndexBucket(address);
+    while (connection != nullptr)
     {
-        if (mActiveConnections[i].IsConnected())
+        // Closing the connection unlinks it from the bucket.
+        ActiveTCPConnectionState * next = connection->mNext;
+        if (IsConnectedTo(*connection, address))
         {
-            const Inet::IPAddress & ipAddress = mActiveConnections[i].mPeerAddr.GetIPAddress();
-            uint16_t port                     = mActiveConnections[i].mPeerAddr.GetPort();
-
-            // Ignoring the InterfaceID in the check as it may not have been provided in
-            // the PeerAddress during connection establishment. The IPAddress and Port
-            // are the necessary and sufficient set of parameters for searching
-            // through the connections.
-            if (ipAddress == address.GetIPAddress() && port == address.GetPort() && address.GetTransportType() == Type::kTcp)
-            {
-                // NOTE: this leaves the socket in TIME_WAIT.
-                // Calling Abort() would clean it since SO_LINGER would be set to 0,
-                // however this seems not to be useful.
-                CloseConnectionInternal(&mActiveConnections[i], CHIP_NO_ERROR, SuppressCallback::Yes);
-            }
+            // NOTE: this leaves the socket in TIME_WAIT.
+            // Calling Abort() would clean it since SO_LINGER would be set to 0,
+            // however this seems not to be useful.
+            CloseConnectionInternal(connection, CHIP_NO_ERROR, SuppressCallback::Yes);
         }
+        connection = next;
     }
 }
 
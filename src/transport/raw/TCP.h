@@ -118,10 +118,12 @@ protected:
 
 public:
     using PendingPacketPoolType = PoolInterface<PendingPacket, const PeerAddress &, System::PacketBufferHandle &&>;
-    TCPBase(ActiveTCPConnectionState * activeConnectionsBuffer, size_t bufferSize, PendingPacketPoolType & packetBuffers) :
-        mActiveConnections(activeConnectionsBuffer), mActiveConnectionsSize(bufferSize), mPendingPackets(packetBuffers)
+    TCPBase(ActiveTCPConnectionState * activeConnectionsBuffer, ActiveTCPConnectionState ** connectionIndexBuffer,
+            size_t bufferSize, PendingPacketPoolType & packetBuffers) :
+        mActiveConnections(activeConnectionsBuffer), mConnectionIndex(connectionIndexBuffer), mActiveConnectionsSize(bufferSize),
+        mPendingPackets(packetBuffers)
     {
-        // activeConnectionsBuffer must be initialized by the caller.
+        // The buffers must be initialized by the caller, using InitConnectionPool().
     }
     ~TCPBase() override;
 
@@ -144,6 +146,14 @@ public:
      */
     void SetConnectTimeout(const uint32_t connTimeoutMsecs) { mConnectTimeout = connTimeoutMsecs; }
 
+    /**
+     * Set the minimum time without traffic after which an established connection
+     * may be closed to make room for a new one when all the connections are in use.
+     *
+     * A zero value disables eviction.
+     */
+    void SetMinIdleTimeForEviction(System::Clock::Seconds16 minIdleTime) { mMinIdleTimeForEviction = minIdleTime; }
+
     /**
      * Close the open endpoint without destroying the object
      */
@@ -203,16 +213,43 @@ public:
      */
     void CloseActiveConnections();
 
+protected:
+    /**
+     * Reset the connections and the peer address index, and chain all the connections
+     * in the free list.
+     */
+    void InitConnectionPool();
+
 private:
     // Allow tests to access private members.
     template <size_t kActiveConnectionsSize, size_t kPendingPacketSize>
     friend class TCPBaseTestAccess;
 
     /**
-     * Allocate an unused connection from the pool
+     * Allocate an unused connection from the pool, evicting an idle connection
+     * if none is left. The connection is added to the peer address index once
+     * its peer address is set.
      *
      */
     ActiveTCPConnectionState * AllocateConnection();
+
+    /**
+     * Free the endpoint of a connection, and return the connection to the pool.
+     */
+    void ReleaseConnection(ActiveTCPConnectionState * connection);
+
+    /**
+     * Close the established connection that has been idle for the longest time, if it
+     * has been idle for at least mMinIdleTimeForEviction.
+     *
+     * @return whether a connection was closed.
+     */
+    bool EvictIdleConnection();
+
+    ActiveTCPConnectionState ** GetConnectionIndexBucket(const PeerAddress & addr) const;
+    void AddToConnectionIndex(ActiveTCPConnectionState * connection);
+    void RemoveFromConnectionIndex(ActiveTCPConnectionState * connection);
+
     /**
      * Find an active connection to the given peer or return nullptr if
      * no active connection exists.
@@ -306,13 +343,23 @@ private:
     // giving up.
     uint32_t mConnectTimeout = CHIP_CONFIG_TCP_CONNECT_TIMEOUT_MSECS;
 
+    // The minimum idle time of a connection evicted when the pool is exhausted.
+    System::Clock::Seconds16 mMinIdleTimeForEviction{ CHIP_CONFIG_TCP_MIN_IDLE_TIME_FOR_EVICTION_SECS };
+
     // Number of active and 'pending connection' endpoints
     size_t mUsedEndPointCount = 0;
 
     // Currently active connections
     ActiveTCPConnectionState * mActiveConnections;
+
+    // Hash table of the connections in use keyed by peer IP address and port, chained
+    // through ActiveTCPConnectionState::mNext, with as many buckets as connections.
+    ActiveTCPConnectionState ** mConnectionIndex;
     const size_t mActiveConnectionsSize;
 
+    // Unused connections, chained through ActiveTCPConnectionState::mNext
+    ActiveTCPConnectionState * mFreeConnections = nullptr;
+
     // Data to be sent when connections succeed
     PendingPacketPoolType & mPendingPackets;
 };
@@ -321,18 +368,13 @@ template <size_t kActiveConnectionsSize, size_t kPendingPacketSize>
 class TCP : public TCPBase
 {
 public:
-    TCP() : TCPBase(mConnectionsBuffer, kActiveConnectionsSize, mPendingPackets)
-    {
-        for (size_t i = 0; i < kActiveConnectionsSize; ++i)
-        {
-            mConnectionsBuffer[i].Init(nullptr, PeerAddress::Uninitialized());
-        }
-    }
+    TCP() : TCPBase(mConnectionsBuffer, mConnectionIndexBuffer, kActiveConnectionsSize, mPendingPackets) { InitConnectionPool(); }
 
     ~TCP() override { mPendingPackets.ReleaseAll(); }
 
 private:
     ActiveTCPConnectionState mConnectionsBuffer[kActiveConnectionsSize];
+    ActiveTCPConnectionState * mConnectionIndexBuffer[kActiveConnectionsSize];
     PoolImpl<PendingPacket, kPendingPacketSize, ObjectPoolMem::kInline, PendingPacketPoolType::Interface> mPendingPackets;
 };
 
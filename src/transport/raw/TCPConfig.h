@@ -63,6 +63,36 @@ namespace chip {
 #define CHIP_CONFIG_MAX_TCP_PENDING_PACKETS 4
 #endif
 
+/**
+ *  @def CHIP_CONFIG_TCP_MAX_PENDING_SEND_BYTES
+ *
+ *  @brief
+ *    Maximum number of bytes queued for sending on a single TCP
+ *    connection, including the packets waiting for the connection
+ *    to be established. A message that would exceed it is rejected
+ *    with CHIP_ERROR_BUSY, unless nothing is queued yet.
+ *
+ */
+#ifndef CHIP_CONFIG_TCP_MAX_PENDING_SEND_BYTES
+#define CHIP_CONFIG_TCP_MAX_PENDING_SEND_BYTES (64 * 1024)
+#endif // CHIP_CONFIG_TCP_MAX_PENDING_SEND_BYTES
+
+/**
+ *  @def CHIP_CONFIG_TCP_MIN_IDLE_TIME_FOR_EVICTION_SECS
+ *
+ *  @brief
+ *    Minimum time (in seconds) without traffic after which an
+ *    established TCP connection may be closed to make room for a
+ *    new one when all the connections are in use. The least
+ *    recently used connection is evicted first.
+ *
+ *    0 disables eviction: new connections are refused instead.
+ *
+ */
+#ifndef CHIP_CONFIG_TCP_MIN_IDLE_TIME_FOR_EVICTION_SECS
+#define CHIP_CONFIG_TCP_MIN_IDLE_TIME_FOR_EVICTION_SECS (0)
+#endif // CHIP_CONFIG_TCP_MIN_IDLE_TIME_FOR_EVICTION_SECS
+
 /**
  *  @def CHIP_CONFIG_TCP_CONNECT_TIMEOUT_MSECS
  *
@@ -34,6 +34,13 @@ using namespace chip::System;
 namespace chip {
 namespace Transport {
 
+namespace {
+
+constexpr size_t kMaxFramesInFlight = CHIP_DEVICE_CONFIG_WIFIPAF_MAX_IN_FLIGHT_FRAMES;
+static_assert(kMaxFramesInFlight > 0, "At least one Wi-Fi PAF frame must be in flight");
+
+} // namespace
+
 WiFiPAFBase::~WiFiPAFBase()
 {
     ClearState();
@@ -42,6 +49,7 @@ WiFiPAFBase::~WiFiPAFBase()
 void WiFiPAFBase::ClearState()
 {
     mState = State::kNotReady;
+    ClearPendingPackets();
 }
 
 CHIP_ERROR WiFiPAFBase::Init(const WiFiPAFListenParameters & param)
@@ -81,9 +89,18 @@ CHIP_ERROR WiFiPAFBase::SendMessage(const Transport::PeerAddress & address, Syst
 {
     VerifyOrReturnError(address.GetTransportType() == Type::kWiFiPAF, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(mState != State::kNotReady, CHIP_ERROR_INCORRECT_STATE);
-    DeviceLayer::ConnectivityMgr().WiFiPAFSend(std::move(msgBuf));
+    VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(msgBuf->TotalLength() <= CHIP_DEVICE_CONFIG_WIFIPAF_MAX_FRAME_SIZE, CHIP_ERROR_MESSAGE_TOO_LONG);
 
-    return CHIP_NO_ERROR;
+    // Messages queued earlier go first.
+    if (mState == State::kConnected && mPendingPacketsCount == 0 && mFramesInFlight < kMaxFramesInFlight)
+    {
+        ReturnErrorOnFailure(DeviceLayer::ConnectivityMgr().WiFiPAFSend(std::move(msgBuf)));
+        mFramesInFlight++;
+        return CHIP_NO_ERROR;
+    }
+
+    return SendAfterConnect(std::move(msgBuf));
 }
 
 void WiFiPAFBase::OnWiFiPAFMessageReceived(System::PacketBufferHandle && buffer)
@@ -92,21 +109,67 @@ void WiFiPAFBase::OnWiFiPAFMessageReceived(System::PacketBufferHandle && buffer)
     return;
 }
 
+void WiFiPAFBase::OnWiFiPAFConnected()
+{
+    ChipLogDetail(Inet, "WiFi-PAF: connected, %u queued messages", static_cast<unsigned>(mPendingPacketsCount));
+    SendPendingPackets();
+}
+
+void WiFiPAFBase::OnWiFiPAFConnectionError(CHIP_ERROR err)
+{
+    ChipLogDetail(Inet, "WiFi-PAF: connection error: %" CHIP_ERROR_FORMAT, err.Format());
+    ClearPendingPackets();
+}
+
+void WiFiPAFBase::OnWiFiPAFMessageSent(CHIP_ERROR err)
+{
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "WiFi-PAF: transmission failed: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+    if (mFramesInFlight > 0)
+    {
+        mFramesInFlight--;
+    }
+    SendPendingPackets();
+}
+
 CHIP_ERROR WiFiPAFBase::SendAfterConnect(System::PacketBufferHandle && msg)
 {
-    CHIP_ERROR err = CHIP_ERROR_NO_MEMORY;
+    VerifyOrReturnError(mPendingPacketsCount < mPendingPacketsSize, CHIP_ERROR_NO_MEMORY);
 
-    for (size_t i = 0; i < mPendingPacketsSize; i++)
+    mPendingPackets[(mPendingPacketsHead + mPendingPacketsCount) % mPendingPacketsSize] = std::move(msg);
+    mPendingPacketsCount++;
+
+    return CHIP_NO_ERROR;
+}
+
+void WiFiPAFBase::SendPendingPackets()
+{
+    while (mState == State::kConnected && mPendingPacketsCount > 0 && mFramesInFlight < kMaxFramesInFlight)
     {
-        if (mPendingPackets[i].IsNull())
+        System::PacketBufferHandle msg = std::move(mPendingPackets[mPendingPacketsHead]);
+        mPendingPacketsHead            = (mPendingPacketsHead + 1) % mPendingPacketsSize;
+        mPendingPacketsCount--;
+
+        CHIP_ERROR err = DeviceLayer::ConnectivityMgr().WiFiPAFSend(std::move(msg));
+        if (err != CHIP_NO_ERROR)
         {
-            mPendingPackets[i] = std::move(msg);
-            err                = CHIP_NO_ERROR;
-            break;
+            ChipLogError(Inet, "Deferred sending failed: %" CHIP_ERROR_FORMAT, err.Format());
+            continue;
         }
+        mFramesInFlight++;
     }
+}
 
-    return err;
+void WiFiPAFBase::ClearPendingPackets()
+{
+    for (size_t i = 0; i < mPendingPacketsSize; i++)
+    {
+        mPendingPackets[i] = nullptr;
+    }
+    mPendingPacketsHead  = 0;
+    mPendingPacketsCount = 0;
 }
 
 } // namespace Transport
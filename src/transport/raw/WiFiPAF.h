@@ -68,6 +68,12 @@ public:
      * @param param        Wi-Fi-PAF configuration parameters for this transport
      */
     CHIP_ERROR Init(const WiFiPAFListenParameters & param);
+
+    /**
+     * Sends a message, or queues it when the link is still being set up or when
+     * CHIP_DEVICE_CONFIG_WIFIPAF_MAX_IN_FLIGHT_FRAMES frames are already being transmitted.
+     * Queued messages are sent in order.
+     */
     CHIP_ERROR SendMessage(const Transport::PeerAddress & address, System::PacketBufferHandle && msgBuf) override;
     bool CanSendToPeer(const Transport::PeerAddress & address) override
     {
@@ -77,6 +83,24 @@ public:
     void SetWiFiPAFState(State state) { mState = state; };
     State GetWiFiPAFState() { return mState; };
 
+    /**
+     * Called by the platform, in the Matter context, once the link with the peer is set up:
+     * sends the messages queued in the meantime.
+     */
+    void OnWiFiPAFConnected();
+
+    /**
+     * Called by the platform, in the Matter context, when the link with the peer could not be set up
+     * or was lost: drops the queued messages.
+     */
+    void OnWiFiPAFConnectionError(CHIP_ERROR err);
+
+    /**
+     * Called by the platform, in the Matter context, when the transmission of a frame handed to
+     * ConnectivityManager::WiFiPAFSend() completed: sends the next queued message.
+     */
+    void OnWiFiPAFMessageSent(CHIP_ERROR err);
+
 private:
     void ClearState();
     /**
@@ -84,10 +108,17 @@ private:
      * @param msg - what buffer to send once a connection has been established.
      */
     CHIP_ERROR SendAfterConnect(System::PacketBufferHandle && msg);
+    void SendPendingPackets();
+    void ClearPendingPackets();
+
     State mState = State::kNotReady;
 
-    System::PacketBufferHandle * mPendingPackets;
-    size_t mPendingPacketsSize;
+    // FIFO of the messages waiting for the link or for a transmission to complete
+    System::PacketBufferHandle * mPendingPackets = nullptr;
+    size_t mPendingPacketsSize                   = 0;
+    size_t mPendingPacketsHead                   = 0;
+    size_t mPendingPacketsCount                  = 0;
+    size_t mFramesInFlight                       = 0;
 };
 
 template <size_t kPendingPacketSize>
@@ -39,6 +39,25 @@ public:
     }
     static Inet::TCPEndPoint * GetEndpoint(void * state) { return static_cast<ActiveTCPConnectionState *>(state)->mEndPoint; }
 
+    static size_t GetConnectedCount(TCPImpl & tcp)
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < tcp.mActiveConnectionsSize; i++)
+        {
+            count += tcp.mActiveConnections[i].IsConnected() ? 1 : 0;
+        }
+        return count;
+    }
+
+    // Move the last activity of all the connections back in time.
+    static void AgeConnections(TCPImpl & tcp, System::Clock::Timeout age)
+    {
+        for (size_t i = 0; i < tcp.mActiveConnectionsSize; i++)
+        {
+            tcp.mActiveConnections[i].mLastActivityTime -= age;
+        }
+    }
+
     static CHIP_ERROR ProcessReceivedBuffer(TCPImpl & tcp, Inet::TCPEndPoint * endPoint, const PeerAddress & peerAddress,
                                             System::PacketBufferHandle && buffer)
     {
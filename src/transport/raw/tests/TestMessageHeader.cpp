@@ -218,6 +218,55 @@ TEST(TestMessageHeader, TestPayloadHeaderEncodeDecode)
     EXPECT_EQ(header.GetProtocolID(), Protocols::Id(VendorId::Common, 1221));
 }
 
+TEST(TestMessageHeader, TestSecureUnicastHeaderDecode)
+{
+    // The layout decoded from fixed offsets: unicast session, no node IDs, no message extensions
+    const uint8_t packetHeader[] = { 0x00, 0x34, 0x12, 0xC0, 0x78, 0x56, 0x34, 0x12 };
+    PacketHeader header;
+    uint16_t decodeLen;
+
+    // Values from a previous decode are not kept
+    header.SetSourceNodeId(1).SetDestinationNodeId(2);
+    EXPECT_EQ(header.Decode(packetHeader, &decodeLen), CHIP_NO_ERROR);
+    EXPECT_EQ(decodeLen, sizeof(packetHeader));
+    EXPECT_EQ(header.GetSessionId(), 0x1234);
+    EXPECT_EQ(header.GetMessageCounter(), 0x12345678u);
+    EXPECT_EQ(header.GetSessionType(), Header::SessionType::kUnicastSession);
+    EXPECT_TRUE(header.HasPrivacyFlag());
+    EXPECT_TRUE(header.IsSecureSessionControlMsg());
+    EXPECT_FALSE(header.GetSourceNodeId().HasValue());
+    EXPECT_FALSE(header.GetDestinationNodeId().HasValue());
+    EXPECT_FALSE(header.GetDestinationGroupId().HasValue());
+
+    EXPECT_EQ(header.Decode(packetHeader, sizeof(packetHeader) - 1, &decodeLen), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    // Any other version is still rejected
+    const uint8_t otherVersion[] = { 0x10, 0x34, 0x12, 0x00, 0x78, 0x56, 0x34, 0x12 };
+    EXPECT_EQ(header.Decode(otherVersion, &decodeLen), CHIP_ERROR_VERSION_MISMATCH);
+
+    // Without and with an acknowledged message counter
+    const uint8_t payloadHeader[] = { 0x05, 0x08, 0x22, 0x11, 0x01, 0x00, 0xDD, 0xCC, 0xBB, 0xAA };
+    PayloadHeader payload;
+    payload.SetMessageType(Protocols::Id(VendorId::TestVendor1, 4567), 221).SetAckMessageCounter(5);
+
+    EXPECT_EQ(payload.Decode(payloadHeader, 6, &decodeLen), CHIP_NO_ERROR);
+    EXPECT_EQ(decodeLen, 6);
+    EXPECT_EQ(payload.GetMessageType(), 0x08);
+    EXPECT_EQ(payload.GetExchangeID(), 0x1122);
+    EXPECT_EQ(payload.GetProtocolID(), Protocols::Id(VendorId::Common, 1));
+    EXPECT_TRUE(payload.IsInitiator());
+    EXPECT_TRUE(payload.NeedsAck());
+    EXPECT_FALSE(payload.GetAckMessageCounter().HasValue());
+
+    const uint8_t ackPayloadHeader[] = { 0x02, 0x08, 0x22, 0x11, 0x01, 0x00, 0xDD, 0xCC, 0xBB, 0xAA };
+    EXPECT_EQ(payload.Decode(ackPayloadHeader, &decodeLen), CHIP_NO_ERROR);
+    EXPECT_EQ(decodeLen, sizeof(ackPayloadHeader));
+    EXPECT_FALSE(payload.IsInitiator());
+    EXPECT_EQ(payload.GetAckMessageCounter(), Optional<uint32_t>::Value(0xAABBCCDD));
+
+    EXPECT_EQ(payload.Decode(ackPayloadHeader, sizeof(ackPayloadHeader) - 1, &decodeLen), CHIP_ERROR_BUFFER_TOO_SMALL);
+}
+
 TEST(TestMessageHeader, TestPacketHeaderEncodeDecodeBounds)
 {
     PacketHeader header;
@@ -609,6 +609,46 @@ TEST_F(TestTCP, HandleConnCloseCalledTest6)
     HandleConnCloseTest(addr);
 }
 
+TEST_F(TestTCP, EvictIdleConnectionTest)
+{
+    TCPImpl tcp;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    MockTransportMgrDelegate gMockTransportMgrDelegate(mIOContext);
+    gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr);
+
+    // Each connection to self takes two connections of the pool: the outgoing one and the incoming one.
+    Transport::PeerAddress lPeerAddress = Transport::PeerAddress::TCP(addr, gChipTCPPort);
+    for (size_t i = 1; i <= kMaxTcpActiveConnectionCount / 2; i++)
+    {
+        Transport::ActiveTCPConnectionState * connState = nullptr;
+        EXPECT_EQ(tcp.TCPConnect(lPeerAddress, &gAppTCPConnCbCtxt, &connState), CHIP_NO_ERROR);
+        mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(5),
+                                 [&tcp, i]() { return TestAccess::GetConnectedCount(tcp) == 2 * i; });
+        ASSERT_EQ(TestAccess::GetConnectedCount(tcp), 2 * i);
+    }
+
+    // By default, new connections are refused once the pool is exhausted.
+    Transport::ActiveTCPConnectionState * connState = nullptr;
+    EXPECT_EQ(tcp.TCPConnect(lPeerAddress, &gAppTCPConnCbCtxt, &connState), CHIP_ERROR_NO_MEMORY);
+
+    // Connections that have not been idle for long enough are kept.
+    tcp.SetMinIdleTimeForEviction(System::Clock::Seconds16(60));
+    EXPECT_EQ(tcp.TCPConnect(lPeerAddress, &gAppTCPConnCbCtxt, &connState), CHIP_ERROR_NO_MEMORY);
+    EXPECT_FALSE(gMockTransportMgrDelegate.mHandleConnectionCloseCalled);
+
+    // An idle connection is closed to make room for the new one.
+    TestAccess::AgeConnections(tcp, System::Clock::Seconds16(120));
+    EXPECT_EQ(tcp.TCPConnect(lPeerAddress, &gAppTCPConnCbCtxt, &connState), CHIP_NO_ERROR);
+    EXPECT_NE(connState, nullptr);
+    EXPECT_TRUE(gMockTransportMgrDelegate.mHandleConnectionCloseCalled);
+
+    tcp.CloseActiveConnections();
+    EXPECT_FALSE(tcp.HasActiveConnections());
+}
+
 TEST_F(TestTCP, CheckProcessReceivedBuffer)
 {
     TCPImpl tcp;
@@ -0,0 +1,304 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the DecryptWorkerPool implementation.
+ */
+
+#include <vector>
+
+#include <pw_unit_test/framework.h>
+
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/core/CHIPCore.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CodeUtils.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <transport/DecryptWorkerPool.h>
+#include <transport/SecureMessageCodec.h>
+#include <transport/SecureSessionTable.h>
+#include <transport/raw/MessageHeader.h>
+
+#if CHIP_TRANSPORT_HAS_DECRYPT_WORKER_POOL
+
+namespace chip {
+namespace Transport {
+
+namespace {
+
+using namespace System::Clock::Literals;
+
+constexpr NodeId kLocalNodeId       = 0x1234;
+constexpr NodeId kPeerNodeId        = 0x5678;
+constexpr FabricIndex kFabricIndex  = 1;
+constexpr uint16_t kFirstSessionId  = 1;
+constexpr uint16_t kSecondSessionId = 2;
+
+constexpr System::Clock::Timeout kTimeout = 5000_ms32;
+
+struct DecryptedMessage
+{
+    uint16_t sessionId;
+    uint32_t messageCounter;
+    uint16_t exchangeId;
+    CHIP_ERROR result;
+};
+
+class TestDecryptDelegate : public DecryptWorkerPool::Delegate
+{
+public:
+    void OnMessageDecrypted(DecryptJob & job) override
+    {
+        mMessages.push_back({ job.session->AsSecureSession()->GetLocalSessionId(), job.packetHeader.GetMessageCounter(),
+                              job.payloadHeader.GetExchangeID(), job.result });
+        if (mMessages.size() == mExpectedCount)
+        {
+            DeviceLayer::PlatformMgr().StopEventLoopTask();
+        }
+    }
+
+    std::vector<DecryptedMessage> mMessages;
+    size_t mExpectedCount = 0;
+};
+
+} // namespace
+
+class TestDecryptWorkerPool : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR);
+        ASSERT_EQ(DeviceLayer::PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+    }
+    static void TearDownTestSuite()
+    {
+        DeviceLayer::PlatformMgr().Shutdown();
+        chip::Platform::MemoryShutdown();
+    }
+
+    void SetUp() override
+    {
+        mSessionTable.Init();
+
+        // Messages are encrypted as the peer would, with the initiator keys matching the responder keys of the sessions.
+        ASSERT_EQ(mPeerContext.InitFromSecret(mSessionKeystore, TestSecret(), ByteSpan(),
+                                              CryptoContext::SessionInfoType::kSessionEstablishment,
+                                              CryptoContext::SessionRole::kInitiator),
+                  CHIP_NO_ERROR);
+
+        ASSERT_EQ(mPool.Init(DeviceLayer::SystemLayer(), mDelegate), CHIP_NO_ERROR);
+    }
+
+    void TearDown() override
+    {
+        mPool.Shutdown();
+        // Let a drain scheduled by a worker before it stopped run while the pool is still around.
+        RunEventLoopFor(10_ms32);
+        mSessionTable.ForEachSession([](SecureSession * session) {
+            session->MarkForEviction();
+            return Loop::Continue;
+        });
+    }
+
+protected:
+    static ByteSpan TestSecret()
+    {
+        return ByteSpan(reinterpret_cast<const uint8_t *>(CHIP_CONFIG_TEST_SHARED_SECRET_VALUE),
+                        CHIP_CONFIG_TEST_SHARED_SECRET_LENGTH);
+    }
+
+    Optional<SessionHandle> NewSession(uint16_t localSessionId)
+    {
+        Optional<SessionHandle> session =
+            mSessionTable.CreateNewSecureSessionForTest(SecureSession::Type::kCASE, localSessionId, kLocalNodeId, kPeerNodeId,
+                                                        CATValues{}, localSessionId, kFabricIndex, GetDefaultMRPConfig());
+        if (session.HasValue())
+        {
+            VerifyOrDie(session.Value()->AsSecureSession()->GetCryptoContext().InitFromSecret(
+                            mSessionKeystore, TestSecret(), ByteSpan(), CryptoContext::SessionInfoType::kSessionEstablishment,
+                            CryptoContext::SessionRole::kResponder) == CHIP_NO_ERROR);
+        }
+        return session;
+    }
+
+    // Encrypts a message for the session, and submits it the way SessionManager does, without its packet header.
+    CHIP_ERROR Submit(const SessionHandle & session, uint32_t messageCounter, bool tamper = false)
+    {
+        PacketHeader packetHeader;
+        packetHeader.SetSessionId(session->AsSecureSession()->GetLocalSessionId()).SetMessageCounter(messageCounter);
+
+        // The exchange ID tells the messages apart once decrypted.
+        PayloadHeader payloadHeader;
+        payloadHeader.SetExchangeID(static_cast<uint16_t>(messageCounter));
+
+        const uint8_t payload[] = { 0x01, 0x02, 0x03, 0x04 };
+        auto msg = System::PacketBufferHandle::NewWithData(payload, sizeof(payload), Crypto::CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES);
+        VerifyOrReturnError(!msg.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+        CryptoContext::NonceStorage nonce;
+        ReturnErrorOnFailure(CryptoContext::BuildNonce(nonce, packetHeader.GetSecurityFlags(), messageCounter, kPeerNodeId));
+        ReturnErrorOnFailure(SecureMessageCodec::Encrypt(mPeerContext, nonce, payloadHeader, packetHeader, msg));
+        if (tamper)
+        {
+            msg->Start()[0] ^= 0xFF;
+        }
+
+        return mPool.Submit(session, packetHeader, nonce, PeerAddress::UDP(Inet::IPAddress::Any), std::move(msg));
+    }
+
+    // Runs the event loop until the delegate got expectedCount messages, or the timeout expires.
+    void RunEventLoopUntilDecrypted(size_t expectedCount)
+    {
+        mDelegate.mExpectedCount = expectedCount;
+        if (mDelegate.mMessages.size() >= expectedCount)
+        {
+            return;
+        }
+
+        auto onTimeout = [](System::Layer *, void *) { DeviceLayer::PlatformMgr().StopEventLoopTask(); };
+        EXPECT_EQ(DeviceLayer::SystemLayer().StartTimer(kTimeout, onTimeout, nullptr), CHIP_NO_ERROR);
+        DeviceLayer::PlatformMgr().RunEventLoop();
+        DeviceLayer::SystemLayer().CancelTimer(onTimeout, nullptr);
+    }
+
+    // Runs the event loop for a little while, to hand back whatever was scheduled.
+    void RunEventLoopFor(System::Clock::Timeout duration)
+    {
+        auto onTimeout = [](System::Layer *, void *) { DeviceLayer::PlatformMgr().StopEventLoopTask(); };
+        EXPECT_EQ(DeviceLayer::SystemLayer().StartTimer(duration, onTimeout, nullptr), CHIP_NO_ERROR);
+        DeviceLayer::PlatformMgr().RunEventLoop();
+    }
+
+    Crypto::DefaultSessionKeystore mSessionKeystore;
+    SecureSessionTable mSessionTable;
+    CryptoContext mPeerContext;
+    TestDecryptDelegate mDelegate;
+    DecryptWorkerPool mPool;
+};
+
+TEST_F(TestDecryptWorkerPool, MessagesOfASessionStayInOrder)
+{
+    Optional<SessionHandle> firstSession  = NewSession(kFirstSessionId);
+    Optional<SessionHandle> secondSession = NewSession(kSecondSessionId);
+    ASSERT_TRUE(firstSession.HasValue());
+    ASSERT_TRUE(secondSession.HasValue());
+
+    // Fill the queues of both workers, with a message that fails authentication in the middle of the first session.
+    constexpr uint32_t kTamperedCounter = DecryptWorkerPool::kQueueSize / 2;
+    for (uint32_t counter = 0; counter < DecryptWorkerPool::kQueueSize; counter++)
+    {
+        EXPECT_EQ(Submit(firstSession.Value(), counter, counter == kTamperedCounter), CHIP_NO_ERROR);
+        EXPECT_EQ(Submit(secondSession.Value(), counter), CHIP_NO_ERROR);
+    }
+
+    RunEventLoopUntilDecrypted(2 * DecryptWorkerPool::kQueueSize);
+    ASSERT_EQ(mDelegate.mMessages.size(), 2 * DecryptWorkerPool::kQueueSize);
+
+    uint32_t nextCounter[] = { 0, 0 };
+    for (const DecryptedMessage & message : mDelegate.mMessages)
+    {
+        ASSERT_TRUE(message.sessionId == kFirstSessionId || message.sessionId == kSecondSessionId);
+        uint32_t & expectedCounter = nextCounter[message.sessionId - kFirstSessionId];
+        EXPECT_EQ(message.messageCounter, expectedCounter);
+        expectedCounter++;
+
+        if (message.sessionId == kFirstSessionId && message.messageCounter == kTamperedCounter)
+        {
+            EXPECT_NE(message.result, CHIP_NO_ERROR);
+        }
+        else
+        {
+            EXPECT_EQ(message.result, CHIP_NO_ERROR);
+            EXPECT_EQ(message.exchangeId, message.messageCounter);
+        }
+    }
+    EXPECT_EQ(nextCounter[0], DecryptWorkerPool::kQueueSize);
+    EXPECT_EQ(nextCounter[1], DecryptWorkerPool::kQueueSize);
+
+    // Once handed back, the queues have room again.
+    EXPECT_EQ(Submit(firstSession.Value(), DecryptWorkerPool::kQueueSize), CHIP_NO_ERROR);
+    RunEventLoopUntilDecrypted(2 * DecryptWorkerPool::kQueueSize + 1);
+    EXPECT_EQ(mDelegate.mMessages.size(), 2 * DecryptWorkerPool::kQueueSize + 1);
+}
+
+TEST_F(TestDecryptWorkerPool, SessionReleasedWhileDecrypting)
+{
+    Optional<SessionHandle> session = NewSession(kFirstSessionId);
+    ASSERT_TRUE(session.HasValue());
+
+    EXPECT_EQ(Submit(session.Value(), 1), CHIP_NO_ERROR);
+
+    // Evict the session, and drop the last handle outside of the pool.
+    session.Value()->AsSecureSession()->MarkForEviction();
+    session.ClearValue();
+
+    // The pending message keeps the session, and its keys, alive until it is handed back.
+    EXPECT_TRUE(mSessionTable.FindSecureSessionByLocalKey(kFirstSessionId).HasValue());
+
+    RunEventLoopUntilDecrypted(1);
+    ASSERT_EQ(mDelegate.mMessages.size(), 1u);
+    EXPECT_EQ(mDelegate.mMessages[0].sessionId, kFirstSessionId);
+    EXPECT_EQ(mDelegate.mMessages[0].result, CHIP_NO_ERROR);
+    EXPECT_EQ(mDelegate.mMessages[0].exchangeId, 1u);
+
+    // Released along with the job.
+    EXPECT_FALSE(mSessionTable.FindSecureSessionByLocalKey(kFirstSessionId).HasValue());
+}
+
+TEST_F(TestDecryptWorkerPool, ShutdownWithQueuedMessages)
+{
+    Optional<SessionHandle> session = NewSession(kFirstSessionId);
+    ASSERT_TRUE(session.HasValue());
+
+    for (uint32_t counter = 0; counter < DecryptWorkerPool::kQueueSize; counter++)
+    {
+        EXPECT_EQ(Submit(session.Value(), counter), CHIP_NO_ERROR);
+    }
+
+    // Submit() hands back messages the workers are done with, so only count the ones still queued at shutdown.
+    size_t handedBack = mDelegate.mMessages.size();
+    mPool.Shutdown();
+    EXPECT_EQ(Submit(session.Value(), DecryptWorkerPool::kQueueSize), CHIP_ERROR_INCORRECT_STATE);
+
+    // A drain scheduled by a worker before it stopped does not reach the delegate.
+    RunEventLoopFor(100_ms32);
+    EXPECT_EQ(mDelegate.mMessages.size(), handedBack);
+
+    // The dropped messages released the session.
+    session.Value()->AsSecureSession()->MarkForEviction();
+    session.ClearValue();
+    EXPECT_FALSE(mSessionTable.FindSecureSessionByLocalKey(kFirstSessionId).HasValue());
+
+    // The pool can be started again.
+    session = NewSession(kFirstSessionId);
+    ASSERT_TRUE(session.HasValue());
+    ASSERT_EQ(mPool.Init(DeviceLayer::SystemLayer(), mDelegate), CHIP_NO_ERROR);
+    EXPECT_EQ(Submit(session.Value(), 1), CHIP_NO_ERROR);
+
+    RunEventLoopUntilDecrypted(handedBack + 1);
+    ASSERT_EQ(mDelegate.mMessages.size(), handedBack + 1);
+    EXPECT_EQ(mDelegate.mMessages.back().result, CHIP_NO_ERROR);
+    EXPECT_EQ(mDelegate.mMessages.back().exchangeId, 1u);
+}
+
+} // namespace Transport
+} // namespace chip
+
+#endif // CHIP_TRANSPORT_HAS_DECRYPT_WORKER_POOL
@@ -21,6 +21,7 @@
  *      This file implements unit tests for the SessionManager implementation.
  */
 
+#include <algorithm>
 #include <errno.h>
 
 #include <pw_unit_test/framework.h>
@@ -64,6 +65,7 @@ public:
 
         // Always Update storage for Test purposes
         temp = value + GROUP_MSG_COUNTER_MIN_INCREMENT;
+        (isControl ? mGroupControlLimit : mGroupDataLimit) = temp;
         mStorage->SyncSetKeyValue(key.KeyName(), &temp, sizeof(uint32_t));
     }
 };
@@ -455,4 +457,44 @@ TEST(TestGroupMessageCounter, GroupMessageCounterTest)
     EXPECT_EQ(groupCientCounter5.GetCounter(false), (UINT32_MAX + GROUP_MSG_COUNTER_MIN_INCREMENT));
 }
 
+TEST(TestGroupMessageCounter, GroupMessageCounterReservationGrows)
+{
+    chip::TestPersistentStorageDelegate delegate;
+    TestGroupOutgoingCounters groupCientCounter;
+    EXPECT_EQ(groupCientCounter.Init(&delegate), CHIP_NO_ERROR);
+
+    uint32_t start      = groupCientCounter.GetCounter(false);
+    uint32_t storedNext = 0;
+    uint16_t size       = static_cast<uint16_t>(sizeof(storedNext));
+
+    // Each reservation used up within a boot doubles the next one, up to GROUP_MSG_COUNTER_MAX_INCREMENT.
+    uint32_t increment = GROUP_MSG_COUNTER_MIN_INCREMENT;
+    uint32_t limit     = start + increment;
+    for (int i = 0; i < 6; i++)
+    {
+        while (groupCientCounter.GetCounter(false) != limit)
+        {
+            EXPECT_EQ(groupCientCounter.IncrementCounter(false), CHIP_NO_ERROR);
+        }
+        increment = std::min<uint32_t>(increment * 2, GROUP_MSG_COUNTER_MAX_INCREMENT);
+        limit += increment;
+
+        size = static_cast<uint16_t>(sizeof(storedNext));
+        EXPECT_EQ(delegate.SyncGetKeyValue(DefaultStorageKeyAllocator::GroupDataCounter().KeyName(), &storedNext, size),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(storedNext, limit);
+    }
+    EXPECT_EQ(increment, (uint32_t) GROUP_MSG_COUNTER_MAX_INCREMENT);
+
+    // The control counter reserves values on its own.
+    size = static_cast<uint16_t>(sizeof(storedNext));
+    EXPECT_EQ(delegate.SyncGetKeyValue(DefaultStorageKeyAllocator::GroupControlCounter().KeyName(), &storedNext, size),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(storedNext, groupCientCounter.GetCounter(true) + GROUP_MSG_COUNTER_MIN_INCREMENT);
+
+    // A reboot resumes from the last reservation.
+    TestGroupOutgoingCounters groupCientCounter2(&delegate);
+    EXPECT_EQ(groupCientCounter2.GetCounter(false), limit);
+}
+
 } // namespace
@@ -459,4 +459,81 @@ TEST(TestPeerMessageCounter, UnencryptedOutOfWindow)
     }
 }
 
+TEST(TestPeerMessageCounter, GroupWindowSizeTest)
+{
+    const uint16_t windowSizes[] = { 1, 7, 8, 9, chip::Transport::PeerMessageCounter::kMaxWindowSize };
+    for (auto windowSize : windowSizes)
+    {
+        for (auto n : counterValuesArray)
+        {
+            chip::Transport::PeerMessageCounter counter;
+            counter.SetWindowSize(windowSize);
+            EXPECT_EQ(counter.GetWindowSize(), windowSize);
+            EXPECT_EQ(counter.VerifyOrTrustFirstGroup(n), CHIP_NO_ERROR);
+            counter.CommitGroup(n);
+
+            // 1. Counter values up to windowSize behind N are accepted, older ones are not.
+            for (uint32_t k = 1; k <= windowSize; k++)
+            {
+                EXPECT_EQ(counter.VerifyGroup(n - k), CHIP_NO_ERROR);
+            }
+            EXPECT_EQ(counter.VerifyGroup(n - windowSize - 1), CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+
+            // 2. A burst N + 1 .. N + windowSize arrives in reverse order: all of it is accepted, once.
+            for (uint32_t k = windowSize; k >= 1; k--)
+            {
+                EXPECT_EQ(counter.VerifyGroup(n + k), CHIP_NO_ERROR);
+                counter.CommitGroup(n + k);
+            }
+            for (uint32_t k = 0; k <= windowSize; k++)
+            {
+                EXPECT_EQ(counter.VerifyGroup(n + k), CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+            }
+
+            // 3. Jumping exactly windowSize ahead keeps only the old max counter in the window, as seen.
+            uint32_t max = n + windowSize;
+            EXPECT_EQ(counter.VerifyGroup(max + windowSize), CHIP_NO_ERROR);
+            counter.CommitGroup(max + windowSize);
+            EXPECT_EQ(counter.VerifyGroup(max), CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+            for (uint32_t k = 1; k < windowSize; k++)
+            {
+                EXPECT_EQ(counter.VerifyGroup(max + k), CHIP_NO_ERROR);
+            }
+        }
+    }
+}
+
+TEST(TestPeerMessageCounter, WindowGrowthTest)
+{
+    for (auto n : counterValuesArray)
+    {
+        chip::Transport::PeerMessageCounter counter;
+        counter.SetWindowSize(8);
+        EXPECT_EQ(counter.VerifyOrTrustFirstGroup(n), CHIP_NO_ERROR);
+        counter.CommitGroup(n);
+        counter.CommitGroup(n - 3);
+
+        // Counter values that join the window when it grows were not tracked, so they count as seen.  Values that
+        // were already in the window keep their state.
+        counter.SetWindowSize(16);
+        for (uint32_t k = 1; k <= 8; k++)
+        {
+            EXPECT_EQ(counter.VerifyGroup(n - k), (k == 3) ? CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED : CHIP_NO_ERROR);
+        }
+        for (uint32_t k = 9; k <= 17; k++)
+        {
+            EXPECT_EQ(counter.VerifyGroup(n - k), CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+        }
+
+        // Shrinking the window rejects what falls out of it.
+        counter.SetWindowSize(2);
+        EXPECT_EQ(counter.VerifyGroup(n - 2), CHIP_NO_ERROR);
+        EXPECT_EQ(counter.VerifyGroup(n - 3), CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+
+        // Out of range sizes are clamped.
+        counter.SetWindowSize(0);
+        EXPECT_EQ(counter.GetWindowSize(), 1);
+    }
+}
+
 } // namespace
@@ -0,0 +1,119 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <transport/PeerRateLimiter.h>
+
+#include <stdio.h>
+
+using namespace chip;
+using namespace chip::System::Clock::Literals;
+using namespace chip::Transport;
+
+namespace {
+
+PeerAddress MakePeer(const char * address, uint16_t port = CHIP_PORT)
+{
+    Inet::IPAddress ipAddress;
+    EXPECT_TRUE(Inet::IPAddress::FromString(address, ipAddress));
+    return PeerAddress::UDP(ipAddress, port);
+}
+
+TEST(TestPeerRateLimiter, TokenBucketBurstAndRefill)
+{
+    const RateLimit limit{ /* mRatePerSecond = */ 10, /* mBurst = */ 3 };
+    TokenBucket bucket;
+
+    // A bucket starts full.
+    EXPECT_TRUE(bucket.TryConsume(limit, 1000_ms64));
+    EXPECT_TRUE(bucket.TryConsume(limit, 1000_ms64));
+    EXPECT_TRUE(bucket.TryConsume(limit, 1000_ms64));
+    EXPECT_FALSE(bucket.TryConsume(limit, 1000_ms64));
+
+    // At 10 per second, a token takes 100ms to accrue.
+    EXPECT_FALSE(bucket.TryConsume(limit, 1099_ms64));
+    EXPECT_TRUE(bucket.TryConsume(limit, 1100_ms64));
+    EXPECT_FALSE(bucket.TryConsume(limit, 1100_ms64));
+
+    // Refills stop at the burst size.
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_TRUE(bucket.TryConsume(limit, 100000_ms64));
+    }
+    EXPECT_FALSE(bucket.TryConsume(limit, 100000_ms64));
+
+    bucket.Reset();
+    EXPECT_TRUE(bucket.TryConsume(limit, 100000_ms64));
+}
+
+TEST(TestPeerRateLimiter, DisabledLimitAdmitsEverything)
+{
+    TokenBucket bucket;
+    PeerRateLimiter limiter;
+    const PeerAddress peer = MakePeer("fe80::1");
+
+    for (int i = 0; i < 100; i++)
+    {
+        EXPECT_TRUE(bucket.TryConsume(RateLimit(), 0_ms64));
+        EXPECT_TRUE(limiter.Admit(peer, 0_ms64));
+    }
+    EXPECT_EQ(limiter.GetDroppedCount(), 0u);
+}
+
+TEST(TestPeerRateLimiter, PeersAreLimitedIndependently)
+{
+    PeerRateLimiter limiter(RateLimit{ /* mRatePerSecond = */ 1, /* mBurst = */ 2 });
+    const PeerAddress flooder = MakePeer("fe80::1");
+    const PeerAddress other   = MakePeer("fe80::2");
+
+    EXPECT_TRUE(limiter.Admit(flooder, 0_ms64));
+    EXPECT_TRUE(limiter.Admit(flooder, 0_ms64));
+    EXPECT_FALSE(limiter.Admit(flooder, 0_ms64));
+
+    // Changing the source port does not help.
+    EXPECT_FALSE(limiter.Admit(MakePeer("fe80::1", 1234), 0_ms64));
+
+    EXPECT_TRUE(limiter.Admit(other, 0_ms64));
+    EXPECT_TRUE(limiter.Admit(other, 0_ms64));
+    EXPECT_EQ(limiter.GetDroppedCount(), 2u);
+
+    // A new limit starts every address over.
+    limiter.SetLimit(RateLimit{ 1, 1 });
+    EXPECT_TRUE(limiter.Admit(flooder, 0_ms64));
+    EXPECT_FALSE(limiter.Admit(flooder, 0_ms64));
+}
+
+TEST(TestPeerRateLimiter, LeastRecentlyUsedAddressIsForgotten)
+{
+    PeerRateLimiter limiter(RateLimit{ /* mRatePerSecond = */ 1, /* mBurst = */ 1 });
+    const PeerAddress first = MakePeer("fe80::1");
+
+    EXPECT_TRUE(limiter.Admit(first, 1_ms64));
+    EXPECT_FALSE(limiter.Admit(first, 1_ms64));
+
+    // Filling the table with other addresses, all more recent, evicts the first one, which then starts over.
+    for (unsigned i = 0; i < CHIP_CONFIG_PEER_RATE_LIMITER_TABLE_SIZE; i++)
+    {
+        char address[Inet::IPAddress::kMaxStringLength];
+        snprintf(address, sizeof(address), "fe80::1:%x", i);
+        EXPECT_TRUE(limiter.Admit(MakePeer(address), 2_ms64));
+    }
+    EXPECT_TRUE(limiter.Admit(first, 2_ms64));
+}
+
+} // namespace
@@ -0,0 +1,73 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <transport/RoundTripTimeEstimator.h>
+
+using namespace chip;
+using namespace chip::System::Clock::Literals;
+using namespace chip::Transport;
+
+namespace {
+
+TEST(TestRoundTripTimeEstimator, FirstSample)
+{
+    RoundTripTimeEstimator estimator;
+    EXPECT_FALSE(estimator.HasSample());
+
+    estimator.AddSample(100_ms32);
+    EXPECT_TRUE(estimator.HasSample());
+    EXPECT_EQ(estimator.GetSmoothedRoundTripTime(), 100_ms32);
+    EXPECT_EQ(estimator.GetRoundTripTimeVariation(), 50_ms32);
+    EXPECT_EQ(estimator.GetRetransmissionTimeout(), 300_ms32);
+
+    estimator.Reset();
+    EXPECT_FALSE(estimator.HasSample());
+}
+
+TEST(TestRoundTripTimeEstimator, Smoothing)
+{
+    RoundTripTimeEstimator estimator;
+    estimator.AddSample(100_ms32);
+
+    // RTTVAR = 3/4 * 50 + 1/4 * |100 - 180| = 57.5, SRTT = 7/8 * 100 + 1/8 * 180 = 110
+    estimator.AddSample(180_ms32);
+    EXPECT_EQ(estimator.GetSmoothedRoundTripTime(), 110_ms32);
+    EXPECT_EQ(estimator.GetRoundTripTimeVariation(), 57_ms32);
+    EXPECT_EQ(estimator.GetRetransmissionTimeout(), 340_ms32);
+
+    // A steady round trip time converges, and its variation decays.
+    for (int i = 0; i < 100; i++)
+    {
+        estimator.AddSample(20_ms32);
+    }
+    EXPECT_EQ(estimator.GetSmoothedRoundTripTime(), 20_ms32);
+    EXPECT_EQ(estimator.GetRoundTripTimeVariation(), 0_ms32);
+    // 4 * RTTVAR keeps the last few milliseconds that integer decay cannot remove.
+    EXPECT_LE(estimator.GetRetransmissionTimeout(), 23_ms32);
+}
+
+TEST(TestRoundTripTimeEstimator, LargeSamples)
+{
+    RoundTripTimeEstimator estimator;
+    estimator.AddSample(System::Clock::Milliseconds32(UINT32_MAX));
+    estimator.AddSample(System::Clock::Milliseconds32(UINT32_MAX));
+    EXPECT_GT(estimator.GetRetransmissionTimeout(), estimator.GetSmoothedRoundTripTime());
+}
+
+} // namespace
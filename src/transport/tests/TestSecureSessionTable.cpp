@@ -43,6 +43,8 @@ public:
     static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
 
     void ValidateSessionSorting();
+    void ValidateEvictionOnEqualActivityTimes();
+    void ValidateLocalSessionIdIndex();
 
 private:
     struct SessionParameters
@@ -461,5 +463,80 @@ TEST_F(TestSecureSessionTable, ValidateSessionSorting)
     ValidateSessionSorting();
 }
 
+void TestSecureSessionTable::ValidateEvictionOnEqualActivityTimes()
+{
+    //
+    // Sessions that tie on all the other keys, and were last active within the same clock tick, are evicted in the order
+    // they were last active in.
+    //
+    std::vector<SessionParameters> sessionParamList = {
+        { { 1, kFabric1 }, System::Clock::Timestamp(1), SecureSession::State::kActive },
+        { { 2, kFabric1 }, System::Clock::Timestamp(1), SecureSession::State::kActive },
+        { { 3, kFabric1 }, System::Clock::Timestamp(1), SecureSession::State::kActive },
+    };
+
+    CreateSessionTable(sessionParamList);
+
+    // Move the first session to the most recently active end, without touching its activity time.
+    mSessionTable->MarkActive(mSessionList[0]->mSessionHolder->AsSecureSession());
+
+    AllocateSession(ScopedNodeId(4, kFabric2), sessionParamList, 1);
+    EXPECT_FALSE(mSessionList[0]->mSessionReleased);
+    EXPECT_FALSE(mSessionList[2]->mSessionReleased);
+}
+
+TEST_F(TestSecureSessionTable, ValidateEvictionOnEqualActivityTimes)
+{
+    ValidateEvictionOnEqualActivityTimes();
+}
+
+void TestSecureSessionTable::ValidateLocalSessionIdIndex()
+{
+    SecureSessionTable table;
+    table.Init();
+
+    // Start right before the end of the session ID space, so that allocation wraps around and skips
+    // kUnsecuredSessionId.
+    table.mNextSessionId = static_cast<uint16_t>(kMaxSessionID - 1);
+
+    // Allocate more sessions than there are index buckets, so that some of them share a bucket.
+    constexpr size_t kNumSessions = CHIP_CONFIG_SECURE_SESSION_INDEX_BUCKETS + 3;
+    Optional<SessionHandle> sessions[kNumSessions];
+    for (auto & session : sessions)
+    {
+        session = table.CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+        ASSERT_TRUE(session.HasValue());
+    }
+
+    EXPECT_EQ(sessions[0].Value()->AsSecureSession()->GetLocalSessionId(), kMaxSessionID - 1);
+    EXPECT_EQ(sessions[1].Value()->AsSecureSession()->GetLocalSessionId(), kMaxSessionID);
+    EXPECT_EQ(sessions[2].Value()->AsSecureSession()->GetLocalSessionId(), 1);
+
+    for (const auto & session : sessions)
+    {
+        auto found = table.FindSecureSessionByLocalKey(session.Value()->AsSecureSession()->GetLocalSessionId());
+        ASSERT_TRUE(found.HasValue());
+        EXPECT_EQ(found.Value(), session.Value());
+    }
+    EXPECT_FALSE(table.FindSecureSessionByLocalKey(kUnsecuredSessionId).HasValue());
+    EXPECT_FALSE(table.FindSecureSessionByLocalKey(static_cast<uint16_t>(kNumSessions)).HasValue());
+
+    // Releasing a session drops it from the index and makes its ID available again.
+    uint16_t releasedId = sessions[1].Value()->AsSecureSession()->GetLocalSessionId();
+    sessions[1].ClearValue();
+    EXPECT_FALSE(table.FindSecureSessionByLocalKey(releasedId).HasValue());
+    EXPECT_TRUE(table.FindSecureSessionByLocalKey(sessions[0].Value()->AsSecureSession()->GetLocalSessionId()).HasValue());
+
+    table.mNextSessionId = static_cast<uint16_t>(kMaxSessionID - 1);
+    auto unused          = table.FindUnusedSessionId();
+    ASSERT_TRUE(unused.HasValue());
+    EXPECT_EQ(unused.Value(), releasedId);
+}
+
+TEST_F(TestSecureSessionTable, ValidateLocalSessionIdIndex)
+{
+    ValidateLocalSessionIdIndex();
+}
+
 } // namespace Transport
 } // namespace chip
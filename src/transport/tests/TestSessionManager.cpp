@@ -144,6 +144,25 @@ TEST_F(TestSessionManager, CheckSimpleInitTest)
                                   &fabricTableHolder.GetFabricTable(), sessionKeystore));
 }
 
+TEST_F(TestSessionManager, CheckMessageCounterWindowSizeTest)
+{
+    SessionManager sessionManager;
+
+    EXPECT_EQ(sessionManager.SetMessageCounterWindowSize(Session::SessionType::kSecure, 1), CHIP_NO_ERROR);
+    EXPECT_EQ(sessionManager.SetMessageCounterWindowSize(Session::SessionType::kGroupIncoming,
+                                                         Transport::PeerMessageCounter::kMaxWindowSize),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(sessionManager.SetMessageCounterWindowSize(Session::SessionType::kUnauthenticated,
+                                                         CHIP_CONFIG_MESSAGE_COUNTER_WINDOW_SIZE),
+              CHIP_NO_ERROR);
+
+    EXPECT_EQ(sessionManager.SetMessageCounterWindowSize(Session::SessionType::kSecure, 0), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(sessionManager.SetMessageCounterWindowSize(Session::SessionType::kSecure,
+                                                         Transport::PeerMessageCounter::kMaxWindowSize + 1),
+              CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(sessionManager.SetMessageCounterWindowSize(Session::SessionType::kGroupOutgoing, 1), CHIP_ERROR_INVALID_ARGUMENT);
+}
+
 TEST_F(TestSessionManager, CheckMessageOverPaseTest)
 {
     uint16_t payload_len = sizeof(PAYLOAD);
@@ -340,6 +359,83 @@ TEST_F(TestSessionManager, SendEncryptedPacketTest)
     sessionManager.Shutdown();
 }
 
+TEST_F(TestSessionManager, SecureSessionRateLimitTest)
+{
+    TestSessMgrCallback callback;
+    callback.LargeMessageSent = false;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    FabricTableHolder fabricTableHolder;
+    SessionManager sessionManager;
+    secure_channel::MessageCounterManager gMessageCounterManager;
+    chip::TestPersistentStorageDelegate deviceStorage;
+    chip::Crypto::DefaultSessionKeystore sessionKeystore;
+    FabricTable & fabricTable    = fabricTableHolder.GetFabricTable();
+    FabricIndex aliceFabricIndex = kUndefinedFabricIndex;
+    FabricIndex bobFabricIndex   = kUndefinedFabricIndex;
+
+    EXPECT_EQ(CHIP_NO_ERROR, fabricTableHolder.Init());
+    EXPECT_EQ(CHIP_NO_ERROR,
+              sessionManager.Init(&mContext.GetSystemLayer(), &mContext.GetTransportMgr(), &gMessageCounterManager, &deviceStorage,
+                                  &fabricTableHolder.GetFabricTable(), sessionKeystore));
+
+    sessionManager.SetMessageDelegate(&callback);
+
+    Transport::PeerAddress peer(Transport::PeerAddress::UDP(addr, CHIP_PORT));
+
+    err =
+        fabricTable.AddNewFabricForTestIgnoringCollisions(GetRootACertAsset().mCert, GetIAA1CertAsset().mCert,
+                                                          GetNodeA1CertAsset().mCert, GetNodeA1CertAsset().mKey, &aliceFabricIndex);
+    EXPECT_EQ(CHIP_NO_ERROR, err);
+
+    err = fabricTable.AddNewFabricForTestIgnoringCollisions(GetRootACertAsset().mCert, GetIAA1CertAsset().mCert,
+                                                            GetNodeA2CertAsset().mCert, GetNodeA2CertAsset().mKey, &bobFabricIndex);
+    EXPECT_EQ(CHIP_NO_ERROR, err);
+
+    SessionHolder aliceToBobSession;
+    err = sessionManager.InjectPaseSessionWithTestKey(aliceToBobSession, 2,
+                                                      fabricTable.FindFabricWithIndex(bobFabricIndex)->GetNodeId(), 1,
+                                                      aliceFabricIndex, peer, CryptoContext::SessionRole::kInitiator);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    SessionHolder bobToAliceSession;
+    err = sessionManager.InjectPaseSessionWithTestKey(bobToAliceSession, 1,
+                                                      fabricTable.FindFabricWithIndex(aliceFabricIndex)->GetNodeId(), 2,
+                                                      bobFabricIndex, peer, CryptoContext::SessionRole::kResponder);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    // A burst of 2, refilled far slower than the test runs.
+    sessionManager.SetSecureSessionRateLimit(Transport::RateLimit{ /* mRatePerSecond = */ 1, /* mBurst = */ 2 });
+    callback.ReceiveHandlerCallCount = 0;
+
+    for (int i = 0; i < 4; i++)
+    {
+        chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        ASSERT_FALSE(buffer.IsNull());
+
+        PayloadHeader payloadHeader;
+        payloadHeader.SetExchangeID(0);
+        payloadHeader.SetMessageType(chip::Protocols::Echo::MsgType::EchoRequest);
+        payloadHeader.SetInitiator(true);
+
+        EncryptedPacketBufferHandle preparedMessage;
+        err = sessionManager.PrepareMessage(aliceToBobSession.Get().Value(), payloadHeader, std::move(buffer), preparedMessage);
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+
+        err = sessionManager.SendPreparedMessage(aliceToBobSession.Get().Value(), preparedMessage);
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+    }
+
+    mContext.DrainAndServiceIO();
+    EXPECT_EQ(callback.ReceiveHandlerCallCount, 2);
+    EXPECT_EQ(sessionManager.GetRateLimitedMessageCount(), 2u);
+
+    sessionManager.Shutdown();
+}
+
 TEST_F(TestSessionManager, SendBadEncryptedPacketTest)
 {
     uint16_t payload_len = sizeof(PAYLOAD);
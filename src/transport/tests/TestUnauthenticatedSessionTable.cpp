@@ -0,0 +1,150 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the UnauthenticatedSessionTable implementation.
+ */
+
+#include <vector>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/CHIPCore.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <transport/UnauthenticatedSessionTable.h>
+
+namespace chip {
+namespace Transport {
+
+class TestUnauthenticatedSessionTable : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+protected:
+    static constexpr size_t kTableSize = 4;
+
+    using Table = UnauthenticatedSessionTable<kTableSize>;
+
+    static const PeerAddress & Address()
+    {
+        static const PeerAddress address = PeerAddress::UDP(Inet::IPAddress::Any);
+        return address;
+    }
+
+    static Optional<SessionHandle> AllocInitiator(Table & table, NodeId ephemeralInitiatorNodeId)
+    {
+        return table.AllocInitiator(ephemeralInitiatorNodeId, Address(), GetDefaultMRPConfig());
+    }
+
+    static bool HasInitiator(Table & table, NodeId ephemeralInitiatorNodeId)
+    {
+        return table.FindInitiator(ephemeralInitiatorNodeId, Address()).HasValue();
+    }
+
+    static void MarkActive(const Optional<SessionHandle> & session) { session.Value()->AsUnauthenticatedSession()->MarkActive(); }
+
+    // Node IDs of the sessions in the table, least recently active first.
+    static std::vector<NodeId> ActivityOrder(Table & table)
+    {
+        std::vector<NodeId> order;
+        for (UnauthenticatedSession & session : table.mActivityList)
+        {
+            order.push_back(session.GetEphemeralInitiatorNodeID());
+        }
+        return order;
+    }
+
+    static UnauthenticatedSession * LeastRecentlyUsed(Table & table) { return table.FindLeastRecentUsedEntry(); }
+};
+
+TEST_F(TestUnauthenticatedSessionTable, MarkActiveMovesSessionToMostRecent)
+{
+    Table table;
+    Optional<SessionHandle> sessions[] = { AllocInitiator(table, 1), AllocInitiator(table, 2), AllocInitiator(table, 3),
+                                           AllocInitiator(table, 4) };
+    for (const auto & session : sessions)
+    {
+        ASSERT_TRUE(session.HasValue());
+    }
+    EXPECT_EQ(ActivityOrder(table), (std::vector<NodeId>{ 1, 2, 3, 4 }));
+
+    MarkActive(sessions[1]);
+    MarkActive(sessions[0]);
+    EXPECT_EQ(ActivityOrder(table), (std::vector<NodeId>{ 3, 4, 2, 1 }));
+
+    sessions[2].Value()->AsUnauthenticatedSession()->MarkActiveRx();
+    EXPECT_EQ(ActivityOrder(table), (std::vector<NodeId>{ 4, 2, 1, 3 }));
+
+    // Sessions that are held are never evicted.
+    EXPECT_EQ(LeastRecentlyUsed(table), nullptr);
+
+    sessions[1].ClearValue();
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    // The released session went back to the heap, and left the list.
+    EXPECT_EQ(ActivityOrder(table), (std::vector<NodeId>{ 4, 1, 3 }));
+#else
+    // The released session stays around, as the first one to reuse.
+    EXPECT_EQ(ActivityOrder(table), (std::vector<NodeId>{ 4, 2, 1, 3 }));
+    ASSERT_NE(LeastRecentlyUsed(table), nullptr);
+    EXPECT_EQ(LeastRecentlyUsed(table)->GetEphemeralInitiatorNodeID(), 2u);
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+}
+
+#if !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+TEST_F(TestUnauthenticatedSessionTable, FullTableEvictsLeastRecentlyUsed)
+{
+    Table table;
+    {
+        Optional<SessionHandle> sessions[] = { AllocInitiator(table, 1), AllocInitiator(table, 2), AllocInitiator(table, 3),
+                                               AllocInitiator(table, 4) };
+        MarkActive(sessions[0]);
+        MarkActive(sessions[2]);
+    }
+    EXPECT_EQ(ActivityOrder(table), (std::vector<NodeId>{ 2, 4, 1, 3 }));
+
+    // The table is full: the least recently active session makes room.
+    Optional<SessionHandle> fifth = AllocInitiator(table, 5);
+    ASSERT_TRUE(fifth.HasValue());
+    EXPECT_FALSE(HasInitiator(table, 2));
+    EXPECT_EQ(ActivityOrder(table), (std::vector<NodeId>{ 4, 1, 3, 5 }));
+
+    // Held sessions are skipped, whatever their activity.
+    Optional<SessionHandle> fourth = table.FindInitiator(4, Address());
+    ASSERT_TRUE(fourth.HasValue());
+    Optional<SessionHandle> sixth = AllocInitiator(table, 6);
+    ASSERT_TRUE(sixth.HasValue());
+    EXPECT_TRUE(HasInitiator(table, 4));
+    EXPECT_FALSE(HasInitiator(table, 1));
+    EXPECT_EQ(ActivityOrder(table), (std::vector<NodeId>{ 4, 3, 5, 6 }));
+
+    // Allocation fails once every session is held.
+    Optional<SessionHandle> third = table.FindInitiator(3, Address());
+    ASSERT_TRUE(third.HasValue());
+    EXPECT_FALSE(AllocInitiator(table, 7).HasValue());
+    EXPECT_EQ(ActivityOrder(table), (std::vector<NodeId>{ 4, 3, 5, 6 }));
+}
+
+#endif // !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+} // namespace Transport
+} // namespace chip
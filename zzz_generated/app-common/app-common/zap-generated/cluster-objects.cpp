@@ -77,6 +77,52 @@ private:
     TLV::TLVReader & mReader;
 };
 
+// One field of a cluster object: its context tag, and how to decode it into the object.
+struct StructFieldDecoder
+{
+    uint8_t contextTag;
+    CHIP_ERROR (*decode)(TLV::TLVReader & reader, void * object);
+};
+
+template <typename T, auto Member>
+CHIP_ERROR DecodeStructField(TLV::TLVReader & reader, void * object)
+{
+    return DataModel::Decode(reader, static_cast<T *>(object)->*Member);
+}
+
+// Tracks the next field of a cluster object to decode, given its fields in canonical (encoding) order. Encoders
+// write fields in that order, skipping absent optional ones, so a field found at or after the expected one is
+// decoded from the table. Anything else (fields out of order, duplicates, unknown tags) is left to the Decode()
+// method's own match on the context tag.
+class InOrderFieldDecoder
+{
+public:
+    template <size_t N>
+    constexpr InOrderFieldDecoder(const StructFieldDecoder (&fields)[N]) : mFields(fields), mCount(N)
+    {}
+
+    bool FindNext(uint8_t contextTag)
+    {
+        for (size_t field = mNext; field < mCount; field++)
+        {
+            if (mFields[field].contextTag == contextTag)
+            {
+                mNext = field;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Only valid after FindNext() returned true.
+    CHIP_ERROR DecodeNext(TLV::TLVReader & reader, void * object) { return mFields[mNext++].decode(reader, object); }
+
+private:
+    const StructFieldDecoder * mFields;
+    size_t mCount;
+    size_t mNext = 0;
+};
+
 // Structs shared across multiple clusters.
 namespace Structs {
 
@@ -91,6 +137,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMfgCode), &detail::DecodeStructField<DecodableType, &DecodableType::mfgCode> },
+        { to_underlying(Fields::kValue), &detail::DecodeStructField<DecodableType, &DecodableType::value> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -103,7 +155,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMfgCode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMfgCode))
         {
             err = DataModel::Decode(reader, mfgCode);
         }
@@ -133,6 +189,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kLabel), &detail::DecodeStructField<DecodableType, &DecodableType::label> },
+        { to_underlying(Fields::kMode), &detail::DecodeStructField<DecodableType, &DecodableType::mode> },
+        { to_underlying(Fields::kModeTags), &detail::DecodeStructField<DecodableType, &DecodableType::modeTags> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -145,7 +208,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kLabel))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kLabel))
         {
             err = DataModel::Decode(reader, label);
         }
@@ -184,6 +251,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kRangeMin), &detail::DecodeStructField<DecodableType, &DecodableType::rangeMin> },
+        { to_underlying(Fields::kRangeMax), &detail::DecodeStructField<DecodableType, &DecodableType::rangeMax> },
+        { to_underlying(Fields::kPercentMax), &detail::DecodeStructField<DecodableType, &DecodableType::percentMax> },
+        { to_underlying(Fields::kPercentMin), &detail::DecodeStructField<DecodableType, &DecodableType::percentMin> },
+        { to_underlying(Fields::kPercentTypical), &detail::DecodeStructField<DecodableType, &DecodableType::percentTypical> },
+        { to_underlying(Fields::kFixedMax), &detail::DecodeStructField<DecodableType, &DecodableType::fixedMax> },
+        { to_underlying(Fields::kFixedMin), &detail::DecodeStructField<DecodableType, &DecodableType::fixedMin> },
+        { to_underlying(Fields::kFixedTypical), &detail::DecodeStructField<DecodableType, &DecodableType::fixedTypical> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -196,7 +275,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kRangeMin))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kRangeMin))
         {
             err = DataModel::Decode(reader, rangeMin);
         }
@@ -252,6 +335,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMeasurementType), &detail::DecodeStructField<DecodableType, &DecodableType::measurementType> },
+        { to_underlying(Fields::kMeasured), &detail::DecodeStructField<DecodableType, &DecodableType::measured> },
+        { to_underlying(Fields::kMinMeasuredValue), &detail::DecodeStructField<DecodableType, &DecodableType::minMeasuredValue> },
+        { to_underlying(Fields::kMaxMeasuredValue), &detail::DecodeStructField<DecodableType, &DecodableType::maxMeasuredValue> },
+        { to_underlying(Fields::kAccuracyRanges), &detail::DecodeStructField<DecodableType, &DecodableType::accuracyRanges> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -264,7 +356,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMeasurementType))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMeasurementType))
         {
             err = DataModel::Decode(reader, measurementType);
         }
@@ -305,6 +401,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kDeviceType), &detail::DecodeStructField<DecodableType, &DecodableType::deviceType> },
+        { to_underlying(Fields::kRevision), &detail::DecodeStructField<DecodableType, &DecodableType::revision> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -317,7 +419,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kDeviceType))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kDeviceType))
         {
             err = DataModel::Decode(reader, deviceType);
         }
@@ -346,6 +452,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCatalogVendorID), &detail::DecodeStructField<DecodableType, &DecodableType::catalogVendorID> },
+        { to_underlying(Fields::kApplicationID), &detail::DecodeStructField<DecodableType, &DecodableType::applicationID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -358,7 +470,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCatalogVendorID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCatalogVendorID))
         {
             err = DataModel::Decode(reader, catalogVendorID);
         }
@@ -388,6 +504,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kErrorStateID), &detail::DecodeStructField<DecodableType, &DecodableType::errorStateID> },
+        { to_underlying(Fields::kErrorStateLabel), &detail::DecodeStructField<DecodableType, &DecodableType::errorStateLabel> },
+        { to_underlying(Fields::kErrorStateDetails), &detail::DecodeStructField<DecodableType, &DecodableType::errorStateDetails> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -400,7 +523,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kErrorStateID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kErrorStateID))
         {
             err = DataModel::Decode(reader, errorStateID);
         }
@@ -435,6 +562,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kUrls), &detail::DecodeStructField<DecodableType, &DecodableType::urls> },
+        { to_underlying(Fields::kUsername), &detail::DecodeStructField<DecodableType, &DecodableType::username> },
+        { to_underlying(Fields::kCredential), &detail::DecodeStructField<DecodableType, &DecodableType::credential> },
+        { to_underlying(Fields::kCaid), &detail::DecodeStructField<DecodableType, &DecodableType::caid> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -447,7 +582,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kUrls))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kUrls))
         {
             err = DataModel::Decode(reader, urls);
         }
@@ -484,6 +623,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kLabel), &detail::DecodeStructField<DecodableType, &DecodableType::label> },
+        { to_underlying(Fields::kValue), &detail::DecodeStructField<DecodableType, &DecodableType::value> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -496,7 +641,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kLabel))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kLabel))
         {
             err = DataModel::Decode(reader, label);
         }
@@ -525,6 +674,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kOperationalStateID),
+          &detail::DecodeStructField<DecodableType, &DecodableType::operationalStateID> },
+        { to_underlying(Fields::kOperationalStateLabel),
+          &detail::DecodeStructField<DecodableType, &DecodableType::operationalStateLabel> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -537,7 +694,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kOperationalStateID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kOperationalStateID))
         {
             err = DataModel::Decode(reader, operationalStateID);
         }
@@ -568,6 +729,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kX1), &detail::DecodeStructField<DecodableType, &DecodableType::x1> },
+        { to_underlying(Fields::kY1), &detail::DecodeStructField<DecodableType, &DecodableType::y1> },
+        { to_underlying(Fields::kX2), &detail::DecodeStructField<DecodableType, &DecodableType::x2> },
+        { to_underlying(Fields::kY2), &detail::DecodeStructField<DecodableType, &DecodableType::y2> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -580,7 +749,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kX1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kX1))
         {
             err = DataModel::Decode(reader, x1);
         }
@@ -622,6 +795,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kId), &detail::DecodeStructField<DecodableType, &DecodableType::id> },
+        { to_underlying(Fields::kPeerNodeID), &detail::DecodeStructField<DecodableType, &DecodableType::peerNodeID> },
+        { to_underlying(Fields::kPeerFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::peerFabricIndex> },
+        { to_underlying(Fields::kStreamType), &detail::DecodeStructField<DecodableType, &DecodableType::streamType> },
+        { to_underlying(Fields::kVideoStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::videoStreamID> },
+        { to_underlying(Fields::kAudioStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::audioStreamID> },
+        { to_underlying(Fields::kMetadataOptions), &detail::DecodeStructField<DecodableType, &DecodableType::metadataOptions> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -634,7 +818,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kId))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kId))
         {
             err = DataModel::Decode(reader, id);
         }
@@ -690,6 +878,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+        { to_underlying(Fields::kMyBitmap), &detail::DecodeStructField<DecodableType, &DecodableType::myBitmap> },
+        { to_underlying(Fields::kMyEnum), &detail::DecodeStructField<DecodableType, &DecodableType::myEnum> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -702,7 +897,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kName))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kName))
         {
             err = DataModel::Decode(reader, name);
         }
@@ -736,6 +935,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kLocationName), &detail::DecodeStructField<DecodableType, &DecodableType::locationName> },
+        { to_underlying(Fields::kFloorNumber), &detail::DecodeStructField<DecodableType, &DecodableType::floorNumber> },
+        { to_underlying(Fields::kAreaType), &detail::DecodeStructField<DecodableType, &DecodableType::areaType> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -748,7 +954,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kLocationName))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kLocationName))
         {
             err = DataModel::Decode(reader, locationName);
         }
@@ -781,6 +991,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAttributeID), &detail::DecodeStructField<DecodableType, &DecodableType::attributeID> },
+        { to_underlying(Fields::kStatusCode), &detail::DecodeStructField<DecodableType, &DecodableType::statusCode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -793,7 +1009,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAttributeID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAttributeID))
         {
             err = DataModel::Decode(reader, attributeID);
         }
@@ -827,6 +1047,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kIdentifyTime), &detail::DecodeStructField<DecodableType, &DecodableType::identifyTime> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -839,7 +1064,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kIdentifyTime))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kIdentifyTime))
         {
             err = DataModel::Decode(reader, identifyTime);
         }
@@ -862,6 +1091,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kEffectIdentifier), &detail::DecodeStructField<DecodableType, &DecodableType::effectIdentifier> },
+        { to_underlying(Fields::kEffectVariant), &detail::DecodeStructField<DecodableType, &DecodableType::effectVariant> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -874,7 +1109,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kEffectIdentifier))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kEffectIdentifier))
         {
             err = DataModel::Decode(reader, effectIdentifier);
         }
@@ -934,6 +1173,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kGroupID), &detail::DecodeStructField<DecodableType, &DecodableType::groupID> },
+        { to_underlying(Fields::kGroupName), &detail::DecodeStructField<DecodableType, &DecodableType::groupName> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -946,7 +1191,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kGroupID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kGroupID))
         {
             err = DataModel::Decode(reader, groupID);
         }
@@ -973,6 +1222,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kGroupID), &detail::DecodeStructField<DecodableType, &DecodableType::groupID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -985,7 +1240,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -1011,6 +1270,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kGroupID), &detail::DecodeStructField<DecodableType, &DecodableType::groupID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -1023,7 +1287,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kGroupID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kGroupID))
         {
             err = DataModel::Decode(reader, groupID);
         }
@@ -1047,6 +1315,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kGroupID), &detail::DecodeStructField<DecodableType, &DecodableType::groupID> },
+        { to_underlying(Fields::kGroupName), &detail::DecodeStructField<DecodableType, &DecodableType::groupName> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -1059,7 +1334,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -1089,6 +1368,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kGroupList), &detail::DecodeStructField<DecodableType, &DecodableType::groupList> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -1101,7 +1385,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kGroupList))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kGroupList))
         {
             err = DataModel::Decode(reader, groupList);
         }
@@ -1124,6 +1412,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCapacity), &detail::DecodeStructField<DecodableType, &DecodableType::capacity> },
+        { to_underlying(Fields::kGroupList), &detail::DecodeStructField<DecodableType, &DecodableType::groupList> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -1136,7 +1430,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCapacity))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCapacity))
         {
             err = DataModel::Decode(reader, capacity);
         }
@@ -1162,6 +1460,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kGroupID), &detail::DecodeStructField<DecodableType, &DecodableType::groupID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -1174,7 +1477,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kGroupID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kGroupID))
         {
             err = DataModel::Decode(reader, groupID);
         }
@@ -1197,6 +1504,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kGroupID), &detail::DecodeStructField<DecodableType, &DecodableType::groupID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -1209,7 +1522,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -1256,6 +1573,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kGroupID), &detail::DecodeStructField<DecodableType, &DecodableType::groupID> },
+        { to_underlying(Fields::kGroupName), &detail::DecodeStructField<DecodableType, &DecodableType::groupName> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -1268,7 +1591,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kGroupID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kGroupID))
         {
             err = DataModel::Decode(reader, groupID);
         }
@@ -1386,6 +1713,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kEffectIdentifier), &detail::DecodeStructField<DecodableType, &DecodableType::effectIdentifier> },
+        { to_underlying(Fields::kEffectVariant), &detail::DecodeStructField<DecodableType, &DecodableType::effectVariant> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -1398,7 +1731,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kEffectIdentifier))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kEffectIdentifier))
         {
             err = DataModel::Decode(reader, effectIdentifier);
         }
@@ -1446,6 +1783,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kOnOffControl), &detail::DecodeStructField<DecodableType, &DecodableType::onOffControl> },
+        { to_underlying(Fields::kOnTime), &detail::DecodeStructField<DecodableType, &DecodableType::onTime> },
+        { to_underlying(Fields::kOffWaitTime), &detail::DecodeStructField<DecodableType, &DecodableType::offWaitTime> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -1458,7 +1802,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kOnOffControl))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kOnOffControl))
         {
             err = DataModel::Decode(reader, onOffControl);
         }
@@ -1530,6 +1878,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kLevel), &detail::DecodeStructField<DecodableType, &DecodableType::level> },
+        { to_underlying(Fields::kTransitionTime), &detail::DecodeStructField<DecodableType, &DecodableType::transitionTime> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -1542,7 +1898,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kLevel))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kLevel))
         {
             err = DataModel::Decode(reader, level);
         }
@@ -1579,6 +1939,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMoveMode), &detail::DecodeStructField<DecodableType, &DecodableType::moveMode> },
+        { to_underlying(Fields::kRate), &detail::DecodeStructField<DecodableType, &DecodableType::rate> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -1591,7 +1959,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMoveMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMoveMode))
         {
             err = DataModel::Decode(reader, moveMode);
         }
@@ -1629,6 +2001,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStepMode), &detail::DecodeStructField<DecodableType, &DecodableType::stepMode> },
+        { to_underlying(Fields::kStepSize), &detail::DecodeStructField<DecodableType, &DecodableType::stepSize> },
+        { to_underlying(Fields::kTransitionTime), &detail::DecodeStructField<DecodableType, &DecodableType::transitionTime> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -1641,7 +2022,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStepMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStepMode))
         {
             err = DataModel::Decode(reader, stepMode);
         }
@@ -1680,6 +2065,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -1692,7 +2083,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kOptionsMask))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kOptionsMask))
         {
             err = DataModel::Decode(reader, optionsMask);
         }
@@ -1721,6 +2116,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kLevel), &detail::DecodeStructField<DecodableType, &DecodableType::level> },
+        { to_underlying(Fields::kTransitionTime), &detail::DecodeStructField<DecodableType, &DecodableType::transitionTime> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -1733,7 +2136,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kLevel))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kLevel))
         {
             err = DataModel::Decode(reader, level);
         }
@@ -1770,6 +2177,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMoveMode), &detail::DecodeStructField<DecodableType, &DecodableType::moveMode> },
+        { to_underlying(Fields::kRate), &detail::DecodeStructField<DecodableType, &DecodableType::rate> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -1782,7 +2197,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMoveMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMoveMode))
         {
             err = DataModel::Decode(reader, moveMode);
         }
@@ -1820,6 +2239,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStepMode), &detail::DecodeStructField<DecodableType, &DecodableType::stepMode> },
+        { to_underlying(Fields::kStepSize), &detail::DecodeStructField<DecodableType, &DecodableType::stepSize> },
+        { to_underlying(Fields::kTransitionTime), &detail::DecodeStructField<DecodableType, &DecodableType::transitionTime> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -1832,7 +2260,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStepMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStepMode))
         {
             err = DataModel::Decode(reader, stepMode);
         }
@@ -1871,6 +2303,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -1883,7 +2321,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kOptionsMask))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kOptionsMask))
         {
             err = DataModel::Decode(reader, optionsMask);
         }
@@ -1909,6 +2351,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kFrequency), &detail::DecodeStructField<DecodableType, &DecodableType::frequency> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -1921,7 +2368,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kFrequency))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kFrequency))
         {
             err = DataModel::Decode(reader, frequency);
         }
@@ -2031,6 +2482,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMfgCode), &detail::DecodeStructField<DecodableType, &DecodableType::mfgCode> },
+        { to_underlying(Fields::kNamespaceID), &detail::DecodeStructField<DecodableType, &DecodableType::namespaceID> },
+        { to_underlying(Fields::kTag), &detail::DecodeStructField<DecodableType, &DecodableType::tag> },
+        { to_underlying(Fields::kLabel), &detail::DecodeStructField<DecodableType, &DecodableType::label> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -2043,7 +2502,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMfgCode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMfgCode))
         {
             err = DataModel::Decode(reader, mfgCode);
         }
@@ -2139,6 +2602,15 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNode), &detail::DecodeStructField<DecodableType, &DecodableType::node> },
+        { to_underlying(Fields::kGroup), &detail::DecodeStructField<DecodableType, &DecodableType::group> },
+        { to_underlying(Fields::kEndpoint), &detail::DecodeStructField<DecodableType, &DecodableType::endpoint> },
+        { to_underlying(Fields::kCluster), &detail::DecodeStructField<DecodableType, &DecodableType::cluster> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -2151,7 +2623,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNode))
         {
             err = DataModel::Decode(reader, node);
         }
@@ -2224,6 +2700,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kType), &detail::DecodeStructField<DecodableType, &DecodableType::type> },
+        { to_underlying(Fields::kId), &detail::DecodeStructField<DecodableType, &DecodableType::id> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -2236,7 +2718,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kType))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kType))
         {
             err = DataModel::Decode(reader, type);
         }
@@ -2266,6 +2752,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kEndpoint), &detail::DecodeStructField<DecodableType, &DecodableType::endpoint> },
+        { to_underlying(Fields::kCluster), &detail::DecodeStructField<DecodableType, &DecodableType::cluster> },
+        { to_underlying(Fields::kRestrictions), &detail::DecodeStructField<DecodableType, &DecodableType::restrictions> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -2278,7 +2771,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kEndpoint))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kEndpoint))
         {
             err = DataModel::Decode(reader, endpoint);
         }
@@ -2339,6 +2836,14 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kEndpoint), &detail::DecodeStructField<DecodableType, &DecodableType::endpoint> },
+        { to_underlying(Fields::kCluster), &detail::DecodeStructField<DecodableType, &DecodableType::cluster> },
+        { to_underlying(Fields::kRestrictions), &detail::DecodeStructField<DecodableType, &DecodableType::restrictions> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -2351,7 +2856,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kEndpoint))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kEndpoint))
         {
             err = DataModel::Decode(reader, endpoint);
         }
@@ -2389,6 +2898,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCluster), &detail::DecodeStructField<DecodableType, &DecodableType::cluster> },
+        { to_underlying(Fields::kEndpoint), &detail::DecodeStructField<DecodableType, &DecodableType::endpoint> },
+        { to_underlying(Fields::kDeviceType), &detail::DecodeStructField<DecodableType, &DecodableType::deviceType> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -2401,7 +2917,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCluster))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCluster))
         {
             err = DataModel::Decode(reader, cluster);
         }
@@ -2466,6 +2986,15 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPrivilege), &detail::DecodeStructField<DecodableType, &DecodableType::privilege> },
+        { to_underlying(Fields::kAuthMode), &detail::DecodeStructField<DecodableType, &DecodableType::authMode> },
+        { to_underlying(Fields::kSubjects), &detail::DecodeStructField<DecodableType, &DecodableType::subjects> },
+        { to_underlying(Fields::kTargets), &detail::DecodeStructField<DecodableType, &DecodableType::targets> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -2478,7 +3007,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPrivilege))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPrivilege))
         {
             err = DataModel::Decode(reader, privilege);
         }
@@ -2539,6 +3072,12 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kData), &detail::DecodeStructField<DecodableType, &DecodableType::data> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -2551,7 +3090,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kData))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kData))
         {
             err = DataModel::Decode(reader, data);
         }
@@ -2581,6 +3124,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArl), &detail::DecodeStructField<DecodableType, &DecodableType::arl> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -2593,7 +3141,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArl))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArl))
         {
             err = DataModel::Decode(reader, arl);
         }
@@ -2615,6 +3167,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kToken), &detail::DecodeStructField<DecodableType, &DecodableType::token> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -2627,7 +3184,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kToken))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kToken))
         {
             err = DataModel::Decode(reader, token);
         }
@@ -2692,6 +3253,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAdminNodeID), &detail::DecodeStructField<DecodableType, &DecodableType::adminNodeID> },
+        { to_underlying(Fields::kAdminPasscodeID), &detail::DecodeStructField<DecodableType, &DecodableType::adminPasscodeID> },
+        { to_underlying(Fields::kChangeType), &detail::DecodeStructField<DecodableType, &DecodableType::changeType> },
+        { to_underlying(Fields::kLatestValue), &detail::DecodeStructField<DecodableType, &DecodableType::latestValue> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -2704,7 +3274,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAdminNodeID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAdminNodeID))
         {
             err = DataModel::Decode(reader, adminNodeID);
         }
@@ -2747,6 +3321,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAdminNodeID), &detail::DecodeStructField<DecodableType, &DecodableType::adminNodeID> },
+        { to_underlying(Fields::kAdminPasscodeID), &detail::DecodeStructField<DecodableType, &DecodableType::adminPasscodeID> },
+        { to_underlying(Fields::kChangeType), &detail::DecodeStructField<DecodableType, &DecodableType::changeType> },
+        { to_underlying(Fields::kLatestValue), &detail::DecodeStructField<DecodableType, &DecodableType::latestValue> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -2759,7 +3342,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAdminNodeID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAdminNodeID))
         {
             err = DataModel::Decode(reader, adminNodeID);
         }
@@ -2801,6 +3388,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kToken), &detail::DecodeStructField<DecodableType, &DecodableType::token> },
+        { to_underlying(Fields::kInstruction), &detail::DecodeStructField<DecodableType, &DecodableType::instruction> },
+        { to_underlying(Fields::kARLRequestFlowUrl), &detail::DecodeStructField<DecodableType, &DecodableType::ARLRequestFlowUrl> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -2813,7 +3408,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kToken))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kToken))
         {
             err = DataModel::Decode(reader, token);
         }
@@ -2858,6 +3457,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kActionID), &detail::DecodeStructField<DecodableType, &DecodableType::actionID> },
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+        { to_underlying(Fields::kType), &detail::DecodeStructField<DecodableType, &DecodableType::type> },
+        { to_underlying(Fields::kEndpointListID), &detail::DecodeStructField<DecodableType, &DecodableType::endpointListID> },
+        { to_underlying(Fields::kSupportedCommands), &detail::DecodeStructField<DecodableType, &DecodableType::supportedCommands> },
+        { to_underlying(Fields::kState), &detail::DecodeStructField<DecodableType, &DecodableType::state> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -2870,7 +3479,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kActionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kActionID))
         {
             err = DataModel::Decode(reader, actionID);
         }
@@ -2917,6 +3530,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kEndpointListID), &detail::DecodeStructField<DecodableType, &DecodableType::endpointListID> },
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+        { to_underlying(Fields::kType), &detail::DecodeStructField<DecodableType, &DecodableType::type> },
+        { to_underlying(Fields::kEndpoints), &detail::DecodeStructField<DecodableType, &DecodableType::endpoints> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -2929,7 +3550,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kEndpointListID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kEndpointListID))
         {
             err = DataModel::Decode(reader, endpointListID);
         }
@@ -2968,6 +3593,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kActionID), &detail::DecodeStructField<DecodableType, &DecodableType::actionID> },
+        { to_underlying(Fields::kInvokeID), &detail::DecodeStructField<DecodableType, &DecodableType::invokeID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -2980,7 +3611,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kActionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kActionID))
         {
             err = DataModel::Decode(reader, actionID);
         }
@@ -3008,6 +3643,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kActionID), &detail::DecodeStructField<DecodableType, &DecodableType::actionID> },
+        { to_underlying(Fields::kInvokeID), &detail::DecodeStructField<DecodableType, &DecodableType::invokeID> },
+        { to_underlying(Fields::kTransitionTime), &detail::DecodeStructField<DecodableType, &DecodableType::transitionTime> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -3020,7 +3662,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kActionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kActionID))
         {
             err = DataModel::Decode(reader, actionID);
         }
@@ -3051,6 +3697,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kActionID), &detail::DecodeStructField<DecodableType, &DecodableType::actionID> },
+        { to_underlying(Fields::kInvokeID), &detail::DecodeStructField<DecodableType, &DecodableType::invokeID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -3063,7 +3715,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kActionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kActionID))
         {
             err = DataModel::Decode(reader, actionID);
         }
@@ -3091,6 +3747,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kActionID), &detail::DecodeStructField<DecodableType, &DecodableType::actionID> },
+        { to_underlying(Fields::kInvokeID), &detail::DecodeStructField<DecodableType, &DecodableType::invokeID> },
+        { to_underlying(Fields::kDuration), &detail::DecodeStructField<DecodableType, &DecodableType::duration> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -3103,7 +3766,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kActionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kActionID))
         {
             err = DataModel::Decode(reader, actionID);
         }
@@ -3134,6 +3801,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kActionID), &detail::DecodeStructField<DecodableType, &DecodableType::actionID> },
+        { to_underlying(Fields::kInvokeID), &detail::DecodeStructField<DecodableType, &DecodableType::invokeID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -3146,7 +3819,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kActionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kActionID))
         {
             err = DataModel::Decode(reader, actionID);
         }
@@ -3173,6 +3850,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kActionID), &detail::DecodeStructField<DecodableType, &DecodableType::actionID> },
+        { to_underlying(Fields::kInvokeID), &detail::DecodeStructField<DecodableType, &DecodableType::invokeID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -3185,7 +3868,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kActionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kActionID))
         {
             err = DataModel::Decode(reader, actionID);
         }
@@ -3213,6 +3900,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kActionID), &detail::DecodeStructField<DecodableType, &DecodableType::actionID> },
+        { to_underlying(Fields::kInvokeID), &detail::DecodeStructField<DecodableType, &DecodableType::invokeID> },
+        { to_underlying(Fields::kDuration), &detail::DecodeStructField<DecodableType, &DecodableType::duration> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -3225,7 +3919,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kActionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kActionID))
         {
             err = DataModel::Decode(reader, actionID);
         }
@@ -3256,6 +3954,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kActionID), &detail::DecodeStructField<DecodableType, &DecodableType::actionID> },
+        { to_underlying(Fields::kInvokeID), &detail::DecodeStructField<DecodableType, &DecodableType::invokeID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -3268,7 +3972,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kActionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kActionID))
         {
             err = DataModel::Decode(reader, actionID);
         }
@@ -3295,6 +4003,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kActionID), &detail::DecodeStructField<DecodableType, &DecodableType::actionID> },
+        { to_underlying(Fields::kInvokeID), &detail::DecodeStructField<DecodableType, &DecodableType::invokeID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -3307,7 +4021,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kActionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kActionID))
         {
             err = DataModel::Decode(reader, actionID);
         }
@@ -3335,6 +4053,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kActionID), &detail::DecodeStructField<DecodableType, &DecodableType::actionID> },
+        { to_underlying(Fields::kInvokeID), &detail::DecodeStructField<DecodableType, &DecodableType::invokeID> },
+        { to_underlying(Fields::kDuration), &detail::DecodeStructField<DecodableType, &DecodableType::duration> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -3347,7 +4072,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kActionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kActionID))
         {
             err = DataModel::Decode(reader, actionID);
         }
@@ -3378,6 +4107,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kActionID), &detail::DecodeStructField<DecodableType, &DecodableType::actionID> },
+        { to_underlying(Fields::kInvokeID), &detail::DecodeStructField<DecodableType, &DecodableType::invokeID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -3390,7 +4125,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kActionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kActionID))
         {
             err = DataModel::Decode(reader, actionID);
         }
@@ -3418,6 +4157,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kActionID), &detail::DecodeStructField<DecodableType, &DecodableType::actionID> },
+        { to_underlying(Fields::kInvokeID), &detail::DecodeStructField<DecodableType, &DecodableType::invokeID> },
+        { to_underlying(Fields::kDuration), &detail::DecodeStructField<DecodableType, &DecodableType::duration> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -3430,7 +4176,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kActionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kActionID))
         {
             err = DataModel::Decode(reader, actionID);
         }
@@ -3493,6 +4243,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kActionID), &detail::DecodeStructField<DecodableType, &DecodableType::actionID> },
+        { to_underlying(Fields::kInvokeID), &detail::DecodeStructField<DecodableType, &DecodableType::invokeID> },
+        { to_underlying(Fields::kNewState), &detail::DecodeStructField<DecodableType, &DecodableType::newState> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -3505,7 +4262,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kActionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kActionID))
         {
             err = DataModel::Decode(reader, actionID);
         }
@@ -3539,6 +4300,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kActionID), &detail::DecodeStructField<DecodableType, &DecodableType::actionID> },
+        { to_underlying(Fields::kInvokeID), &detail::DecodeStructField<DecodableType, &DecodableType::invokeID> },
+        { to_underlying(Fields::kNewState), &detail::DecodeStructField<DecodableType, &DecodableType::newState> },
+        { to_underlying(Fields::kError), &detail::DecodeStructField<DecodableType, &DecodableType::error> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -3551,7 +4320,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kActionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kActionID))
         {
             err = DataModel::Decode(reader, actionID);
         }
@@ -3592,6 +4365,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCaseSessionsPerFabric),
+          &detail::DecodeStructField<DecodableType, &DecodableType::caseSessionsPerFabric> },
+        { to_underlying(Fields::kSubscriptionsPerFabric),
+          &detail::DecodeStructField<DecodableType, &DecodableType::subscriptionsPerFabric> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -3604,7 +4385,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCaseSessionsPerFabric))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCaseSessionsPerFabric))
         {
             err = DataModel::Decode(reader, caseSessionsPerFabric);
         }
@@ -3633,6 +4418,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kFinish), &detail::DecodeStructField<DecodableType, &DecodableType::finish> },
+        { to_underlying(Fields::kPrimaryColor), &detail::DecodeStructField<DecodableType, &DecodableType::primaryColor> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -3645,7 +4436,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kFinish))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kFinish))
         {
             err = DataModel::Decode(reader, finish);
         }
@@ -3766,6 +4561,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSoftwareVersion), &detail::DecodeStructField<DecodableType, &DecodableType::softwareVersion> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -3778,7 +4578,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSoftwareVersion))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSoftwareVersion))
         {
             err = DataModel::Decode(reader, softwareVersion);
         }
@@ -3822,6 +4626,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -3834,7 +4643,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kFabricIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kFabricIndex))
         {
             err = DataModel::Decode(reader, fabricIndex);
         }
@@ -3857,6 +4670,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kReachableNewValue), &detail::DecodeStructField<DecodableType, &DecodableType::reachableNewValue> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -3869,7 +4687,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kReachableNewValue))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kReachableNewValue))
         {
             err = DataModel::Decode(reader, reachableNewValue);
         }
@@ -3904,6 +4726,21 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kVendorID), &detail::DecodeStructField<DecodableType, &DecodableType::vendorID> },
+        { to_underlying(Fields::kProductID), &detail::DecodeStructField<DecodableType, &DecodableType::productID> },
+        { to_underlying(Fields::kSoftwareVersion), &detail::DecodeStructField<DecodableType, &DecodableType::softwareVersion> },
+        { to_underlying(Fields::kProtocolsSupported),
+          &detail::DecodeStructField<DecodableType, &DecodableType::protocolsSupported> },
+        { to_underlying(Fields::kHardwareVersion), &detail::DecodeStructField<DecodableType, &DecodableType::hardwareVersion> },
+        { to_underlying(Fields::kLocation), &detail::DecodeStructField<DecodableType, &DecodableType::location> },
+        { to_underlying(Fields::kRequestorCanConsent),
+          &detail::DecodeStructField<DecodableType, &DecodableType::requestorCanConsent> },
+        { to_underlying(Fields::kMetadataForProvider),
+          &detail::DecodeStructField<DecodableType, &DecodableType::metadataForProvider> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -3916,7 +4753,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kVendorID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kVendorID))
         {
             err = DataModel::Decode(reader, vendorID);
         }
@@ -3973,6 +4814,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kDelayedActionTime), &detail::DecodeStructField<DecodableType, &DecodableType::delayedActionTime> },
+        { to_underlying(Fields::kImageURI), &detail::DecodeStructField<DecodableType, &DecodableType::imageURI> },
+        { to_underlying(Fields::kSoftwareVersion), &detail::DecodeStructField<DecodableType, &DecodableType::softwareVersion> },
+        { to_underlying(Fields::kSoftwareVersionString),
+          &detail::DecodeStructField<DecodableType, &DecodableType::softwareVersionString> },
+        { to_underlying(Fields::kUpdateToken), &detail::DecodeStructField<DecodableType, &DecodableType::updateToken> },
+        { to_underlying(Fields::kUserConsentNeeded), &detail::DecodeStructField<DecodableType, &DecodableType::userConsentNeeded> },
+        { to_underlying(Fields::kMetadataForRequestor),
+          &detail::DecodeStructField<DecodableType, &DecodableType::metadataForRequestor> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -3985,7 +4840,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -4036,6 +4895,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kUpdateToken), &detail::DecodeStructField<DecodableType, &DecodableType::updateToken> },
+        { to_underlying(Fields::kNewVersion), &detail::DecodeStructField<DecodableType, &DecodableType::newVersion> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -4048,7 +4913,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kUpdateToken))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kUpdateToken))
         {
             err = DataModel::Decode(reader, updateToken);
         }
@@ -4075,6 +4944,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAction), &detail::DecodeStructField<DecodableType, &DecodableType::action> },
+        { to_underlying(Fields::kDelayedActionTime), &detail::DecodeStructField<DecodableType, &DecodableType::delayedActionTime> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -4087,7 +4962,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAction))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAction))
         {
             err = DataModel::Decode(reader, action);
         }
@@ -4114,6 +4993,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kUpdateToken), &detail::DecodeStructField<DecodableType, &DecodableType::updateToken> },
+        { to_underlying(Fields::kSoftwareVersion), &detail::DecodeStructField<DecodableType, &DecodableType::softwareVersion> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -4126,7 +5011,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kUpdateToken))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kUpdateToken))
         {
             err = DataModel::Decode(reader, updateToken);
         }
@@ -4199,6 +5088,13 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kProviderNodeID), &detail::DecodeStructField<DecodableType, &DecodableType::providerNodeID> },
+        { to_underlying(Fields::kEndpoint), &detail::DecodeStructField<DecodableType, &DecodableType::endpoint> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -4211,7 +5107,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kProviderNodeID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kProviderNodeID))
         {
             err = DataModel::Decode(reader, providerNodeID);
         }
@@ -4249,6 +5149,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kProviderNodeID), &detail::DecodeStructField<DecodableType, &DecodableType::providerNodeID> },
+        { to_underlying(Fields::kVendorID), &detail::DecodeStructField<DecodableType, &DecodableType::vendorID> },
+        { to_underlying(Fields::kAnnouncementReason),
+          &detail::DecodeStructField<DecodableType, &DecodableType::announcementReason> },
+        { to_underlying(Fields::kMetadataForNode), &detail::DecodeStructField<DecodableType, &DecodableType::metadataForNode> },
+        { to_underlying(Fields::kEndpoint), &detail::DecodeStructField<DecodableType, &DecodableType::endpoint> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -4261,7 +5171,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kProviderNodeID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kProviderNodeID))
         {
             err = DataModel::Decode(reader, providerNodeID);
         }
@@ -4335,6 +5249,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPreviousState), &detail::DecodeStructField<DecodableType, &DecodableType::previousState> },
+        { to_underlying(Fields::kNewState), &detail::DecodeStructField<DecodableType, &DecodableType::newState> },
+        { to_underlying(Fields::kReason), &detail::DecodeStructField<DecodableType, &DecodableType::reason> },
+        { to_underlying(Fields::kTargetSoftwareVersion),
+          &detail::DecodeStructField<DecodableType, &DecodableType::targetSoftwareVersion> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -4347,7 +5270,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPreviousState))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPreviousState))
         {
             err = DataModel::Decode(reader, previousState);
         }
@@ -4383,6 +5310,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSoftwareVersion), &detail::DecodeStructField<DecodableType, &DecodableType::softwareVersion> },
+        { to_underlying(Fields::kProductID), &detail::DecodeStructField<DecodableType, &DecodableType::productID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -4395,7 +5328,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSoftwareVersion))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSoftwareVersion))
         {
             err = DataModel::Decode(reader, softwareVersion);
         }
@@ -4425,6 +5362,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSoftwareVersion), &detail::DecodeStructField<DecodableType, &DecodableType::softwareVersion> },
+        { to_underlying(Fields::kBytesDownloaded), &detail::DecodeStructField<DecodableType, &DecodableType::bytesDownloaded> },
+        { to_underlying(Fields::kProgressPercent), &detail::DecodeStructField<DecodableType, &DecodableType::progressPercent> },
+        { to_underlying(Fields::kPlatformCode), &detail::DecodeStructField<DecodableType, &DecodableType::platformCode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -4437,7 +5382,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSoftwareVersion))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSoftwareVersion))
         {
             err = DataModel::Decode(reader, softwareVersion);
         }
@@ -4604,6 +5553,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCurrent), &detail::DecodeStructField<DecodableType, &DecodableType::current> },
+        { to_underlying(Fields::kPrevious), &detail::DecodeStructField<DecodableType, &DecodableType::previous> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -4616,7 +5571,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCurrent))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCurrent))
         {
             err = DataModel::Decode(reader, current);
         }
@@ -4645,6 +5604,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCurrent), &detail::DecodeStructField<DecodableType, &DecodableType::current> },
+        { to_underlying(Fields::kPrevious), &detail::DecodeStructField<DecodableType, &DecodableType::previous> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -4657,7 +5622,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCurrent))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCurrent))
         {
             err = DataModel::Decode(reader, current);
         }
@@ -4686,6 +5655,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCurrent), &detail::DecodeStructField<DecodableType, &DecodableType::current> },
+        { to_underlying(Fields::kPrevious), &detail::DecodeStructField<DecodableType, &DecodableType::previous> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -4698,7 +5673,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCurrent))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCurrent))
         {
             err = DataModel::Decode(reader, current);
         }
@@ -4817,6 +5796,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCurrent), &detail::DecodeStructField<DecodableType, &DecodableType::current> },
+        { to_underlying(Fields::kPrevious), &detail::DecodeStructField<DecodableType, &DecodableType::previous> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -4829,7 +5814,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCurrent))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCurrent))
         {
             err = DataModel::Decode(reader, current);
         }
@@ -4857,6 +5846,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCurrent), &detail::DecodeStructField<DecodableType, &DecodableType::current> },
+        { to_underlying(Fields::kPrevious), &detail::DecodeStructField<DecodableType, &DecodableType::previous> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -4869,7 +5864,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCurrent))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCurrent))
         {
             err = DataModel::Decode(reader, current);
         }
@@ -4897,6 +5896,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCurrent), &detail::DecodeStructField<DecodableType, &DecodableType::current> },
+        { to_underlying(Fields::kPrevious), &detail::DecodeStructField<DecodableType, &DecodableType::previous> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -4909,7 +5914,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCurrent))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCurrent))
         {
             err = DataModel::Decode(reader, current);
         }
@@ -4942,6 +5951,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kFailSafeExpiryLengthSeconds),
+          &detail::DecodeStructField<DecodableType, &DecodableType::failSafeExpiryLengthSeconds> },
+        { to_underlying(Fields::kMaxCumulativeFailsafeSeconds),
+          &detail::DecodeStructField<DecodableType, &DecodableType::maxCumulativeFailsafeSeconds> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -4954,7 +5971,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kFailSafeExpiryLengthSeconds))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kFailSafeExpiryLengthSeconds))
         {
             err = DataModel::Decode(reader, failSafeExpiryLengthSeconds);
         }
@@ -4985,6 +6006,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kExpiryLengthSeconds),
+          &detail::DecodeStructField<DecodableType, &DecodableType::expiryLengthSeconds> },
+        { to_underlying(Fields::kBreadcrumb), &detail::DecodeStructField<DecodableType, &DecodableType::breadcrumb> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -4997,7 +6025,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kExpiryLengthSeconds))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kExpiryLengthSeconds))
         {
             err = DataModel::Decode(reader, expiryLengthSeconds);
         }
@@ -5024,6 +6056,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kErrorCode), &detail::DecodeStructField<DecodableType, &DecodableType::errorCode> },
+        { to_underlying(Fields::kDebugText), &detail::DecodeStructField<DecodableType, &DecodableType::debugText> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -5036,7 +6074,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kErrorCode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kErrorCode))
         {
             err = DataModel::Decode(reader, errorCode);
         }
@@ -5064,6 +6106,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNewRegulatoryConfig),
+          &detail::DecodeStructField<DecodableType, &DecodableType::newRegulatoryConfig> },
+        { to_underlying(Fields::kCountryCode), &detail::DecodeStructField<DecodableType, &DecodableType::countryCode> },
+        { to_underlying(Fields::kBreadcrumb), &detail::DecodeStructField<DecodableType, &DecodableType::breadcrumb> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -5076,7 +6126,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNewRegulatoryConfig))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNewRegulatoryConfig))
         {
             err = DataModel::Decode(reader, newRegulatoryConfig);
         }
@@ -5107,6 +6161,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kErrorCode), &detail::DecodeStructField<DecodableType, &DecodableType::errorCode> },
+        { to_underlying(Fields::kDebugText), &detail::DecodeStructField<DecodableType, &DecodableType::debugText> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -5119,7 +6179,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kErrorCode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kErrorCode))
         {
             err = DataModel::Decode(reader, errorCode);
         }
@@ -5166,6 +6230,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kErrorCode), &detail::DecodeStructField<DecodableType, &DecodableType::errorCode> },
+        { to_underlying(Fields::kDebugText), &detail::DecodeStructField<DecodableType, &DecodableType::debugText> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -5178,7 +6248,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kErrorCode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kErrorCode))
         {
             err = DataModel::Decode(reader, errorCode);
         }
@@ -5205,6 +6279,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kTCVersion), &detail::DecodeStructField<DecodableType, &DecodableType::TCVersion> },
+        { to_underlying(Fields::kTCUserResponse), &detail::DecodeStructField<DecodableType, &DecodableType::TCUserResponse> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -5217,7 +6297,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kTCVersion))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kTCVersion))
         {
             err = DataModel::Decode(reader, TCVersion);
         }
@@ -5243,6 +6327,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kErrorCode), &detail::DecodeStructField<DecodableType, &DecodableType::errorCode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -5255,7 +6344,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kErrorCode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kErrorCode))
         {
             err = DataModel::Decode(reader, errorCode);
         }
@@ -5329,6 +6422,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNetworkID), &detail::DecodeStructField<DecodableType, &DecodableType::networkID> },
+        { to_underlying(Fields::kConnected), &detail::DecodeStructField<DecodableType, &DecodableType::connected> },
+        { to_underlying(Fields::kNetworkIdentifier), &detail::DecodeStructField<DecodableType, &DecodableType::networkIdentifier> },
+        { to_underlying(Fields::kClientIdentifier), &detail::DecodeStructField<DecodableType, &DecodableType::clientIdentifier> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -5341,7 +6442,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNetworkID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNetworkID))
         {
             err = DataModel::Decode(reader, networkID);
         }
@@ -5384,6 +6489,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPanId), &detail::DecodeStructField<DecodableType, &DecodableType::panId> },
+        { to_underlying(Fields::kExtendedPanId), &detail::DecodeStructField<DecodableType, &DecodableType::extendedPanId> },
+        { to_underlying(Fields::kNetworkName), &detail::DecodeStructField<DecodableType, &DecodableType::networkName> },
+        { to_underlying(Fields::kChannel), &detail::DecodeStructField<DecodableType, &DecodableType::channel> },
+        { to_underlying(Fields::kVersion), &detail::DecodeStructField<DecodableType, &DecodableType::version> },
+        { to_underlying(Fields::kExtendedAddress), &detail::DecodeStructField<DecodableType, &DecodableType::extendedAddress> },
+        { to_underlying(Fields::kRssi), &detail::DecodeStructField<DecodableType, &DecodableType::rssi> },
+        { to_underlying(Fields::kLqi), &detail::DecodeStructField<DecodableType, &DecodableType::lqi> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -5396,7 +6513,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPanId))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPanId))
         {
             err = DataModel::Decode(reader, panId);
         }
@@ -5453,6 +6574,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSecurity), &detail::DecodeStructField<DecodableType, &DecodableType::security> },
+        { to_underlying(Fields::kSsid), &detail::DecodeStructField<DecodableType, &DecodableType::ssid> },
+        { to_underlying(Fields::kBssid), &detail::DecodeStructField<DecodableType, &DecodableType::bssid> },
+        { to_underlying(Fields::kChannel), &detail::DecodeStructField<DecodableType, &DecodableType::channel> },
+        { to_underlying(Fields::kWiFiBand), &detail::DecodeStructField<DecodableType, &DecodableType::wiFiBand> },
+        { to_underlying(Fields::kRssi), &detail::DecodeStructField<DecodableType, &DecodableType::rssi> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -5465,7 +6596,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSecurity))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSecurity))
         {
             err = DataModel::Decode(reader, security);
         }
@@ -5512,6 +6647,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSsid), &detail::DecodeStructField<DecodableType, &DecodableType::ssid> },
+        { to_underlying(Fields::kBreadcrumb), &detail::DecodeStructField<DecodableType, &DecodableType::breadcrumb> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -5524,7 +6665,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSsid))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSsid))
         {
             err = DataModel::Decode(reader, ssid);
         }
@@ -5553,6 +6698,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNetworkingStatus), &detail::DecodeStructField<DecodableType, &DecodableType::networkingStatus> },
+        { to_underlying(Fields::kDebugText), &detail::DecodeStructField<DecodableType, &DecodableType::debugText> },
+        { to_underlying(Fields::kWiFiScanResults), &detail::DecodeStructField<DecodableType, &DecodableType::wiFiScanResults> },
+        { to_underlying(Fields::kThreadScanResults), &detail::DecodeStructField<DecodableType, &DecodableType::threadScanResults> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -5565,7 +6718,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNetworkingStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNetworkingStatus))
         {
             err = DataModel::Decode(reader, networkingStatus);
         }
@@ -5604,6 +6761,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSsid), &detail::DecodeStructField<DecodableType, &DecodableType::ssid> },
+        { to_underlying(Fields::kCredentials), &detail::DecodeStructField<DecodableType, &DecodableType::credentials> },
+        { to_underlying(Fields::kBreadcrumb), &detail::DecodeStructField<DecodableType, &DecodableType::breadcrumb> },
+        { to_underlying(Fields::kNetworkIdentity), &detail::DecodeStructField<DecodableType, &DecodableType::networkIdentity> },
+        { to_underlying(Fields::kClientIdentifier), &detail::DecodeStructField<DecodableType, &DecodableType::clientIdentifier> },
+        { to_underlying(Fields::kPossessionNonce), &detail::DecodeStructField<DecodableType, &DecodableType::possessionNonce> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -5616,7 +6783,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSsid))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSsid))
         {
             err = DataModel::Decode(reader, ssid);
         }
@@ -5659,6 +6830,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kOperationalDataset),
+          &detail::DecodeStructField<DecodableType, &DecodableType::operationalDataset> },
+        { to_underlying(Fields::kBreadcrumb), &detail::DecodeStructField<DecodableType, &DecodableType::breadcrumb> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -5671,7 +6849,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kOperationalDataset))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kOperationalDataset))
         {
             err = DataModel::Decode(reader, operationalDataset);
         }
@@ -5698,6 +6880,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNetworkID), &detail::DecodeStructField<DecodableType, &DecodableType::networkID> },
+        { to_underlying(Fields::kBreadcrumb), &detail::DecodeStructField<DecodableType, &DecodableType::breadcrumb> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -5710,7 +6898,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNetworkID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNetworkID))
         {
             err = DataModel::Decode(reader, networkID);
         }
@@ -5740,6 +6932,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNetworkingStatus), &detail::DecodeStructField<DecodableType, &DecodableType::networkingStatus> },
+        { to_underlying(Fields::kDebugText), &detail::DecodeStructField<DecodableType, &DecodableType::debugText> },
+        { to_underlying(Fields::kNetworkIndex), &detail::DecodeStructField<DecodableType, &DecodableType::networkIndex> },
+        { to_underlying(Fields::kClientIdentity), &detail::DecodeStructField<DecodableType, &DecodableType::clientIdentity> },
+        { to_underlying(Fields::kPossessionSignature),
+          &detail::DecodeStructField<DecodableType, &DecodableType::possessionSignature> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -5752,7 +6954,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNetworkingStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNetworkingStatus))
         {
             err = DataModel::Decode(reader, networkingStatus);
         }
@@ -5791,6 +6997,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNetworkID), &detail::DecodeStructField<DecodableType, &DecodableType::networkID> },
+        { to_underlying(Fields::kBreadcrumb), &detail::DecodeStructField<DecodableType, &DecodableType::breadcrumb> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -5803,7 +7015,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNetworkID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNetworkID))
         {
             err = DataModel::Decode(reader, networkID);
         }
@@ -5831,6 +7047,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNetworkingStatus), &detail::DecodeStructField<DecodableType, &DecodableType::networkingStatus> },
+        { to_underlying(Fields::kDebugText), &detail::DecodeStructField<DecodableType, &DecodableType::debugText> },
+        { to_underlying(Fields::kErrorValue), &detail::DecodeStructField<DecodableType, &DecodableType::errorValue> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -5843,7 +7066,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNetworkingStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNetworkingStatus))
         {
             err = DataModel::Decode(reader, networkingStatus);
         }
@@ -5875,6 +7102,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNetworkID), &detail::DecodeStructField<DecodableType, &DecodableType::networkID> },
+        { to_underlying(Fields::kNetworkIndex), &detail::DecodeStructField<DecodableType, &DecodableType::networkIndex> },
+        { to_underlying(Fields::kBreadcrumb), &detail::DecodeStructField<DecodableType, &DecodableType::breadcrumb> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -5887,7 +7121,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNetworkID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNetworkID))
         {
             err = DataModel::Decode(reader, networkID);
         }
@@ -5918,6 +7156,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kKeyIdentifier), &detail::DecodeStructField<DecodableType, &DecodableType::keyIdentifier> },
+        { to_underlying(Fields::kPossessionNonce), &detail::DecodeStructField<DecodableType, &DecodableType::possessionNonce> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -5930,7 +7174,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kKeyIdentifier))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kKeyIdentifier))
         {
             err = DataModel::Decode(reader, keyIdentifier);
         }
@@ -5957,6 +7205,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kIdentity), &detail::DecodeStructField<DecodableType, &DecodableType::identity> },
+        { to_underlying(Fields::kPossessionSignature),
+          &detail::DecodeStructField<DecodableType, &DecodableType::possessionSignature> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -5969,7 +7224,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kIdentity))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kIdentity))
         {
             err = DataModel::Decode(reader, identity);
         }
@@ -6048,6 +7307,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kIntent), &detail::DecodeStructField<DecodableType, &DecodableType::intent> },
+        { to_underlying(Fields::kRequestedProtocol), &detail::DecodeStructField<DecodableType, &DecodableType::requestedProtocol> },
+        { to_underlying(Fields::kTransferFileDesignator),
+          &detail::DecodeStructField<DecodableType, &DecodableType::transferFileDesignator> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -6060,7 +7327,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kIntent))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kIntent))
         {
             err = DataModel::Decode(reader, intent);
         }
@@ -6093,6 +7364,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kLogContent), &detail::DecodeStructField<DecodableType, &DecodableType::logContent> },
+        { to_underlying(Fields::kUTCTimeStamp), &detail::DecodeStructField<DecodableType, &DecodableType::UTCTimeStamp> },
+        { to_underlying(Fields::kTimeSinceBoot), &detail::DecodeStructField<DecodableType, &DecodableType::timeSinceBoot> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -6105,7 +7384,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -6175,6 +7458,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+        { to_underlying(Fields::kIsOperational), &detail::DecodeStructField<DecodableType, &DecodableType::isOperational> },
+        { to_underlying(Fields::kOffPremiseServicesReachableIPv4),
+          &detail::DecodeStructField<DecodableType, &DecodableType::offPremiseServicesReachableIPv4> },
+        { to_underlying(Fields::kOffPremiseServicesReachableIPv6),
+          &detail::DecodeStructField<DecodableType, &DecodableType::offPremiseServicesReachableIPv6> },
+        { to_underlying(Fields::kHardwareAddress), &detail::DecodeStructField<DecodableType, &DecodableType::hardwareAddress> },
+        { to_underlying(Fields::kIPv4Addresses), &detail::DecodeStructField<DecodableType, &DecodableType::IPv4Addresses> },
+        { to_underlying(Fields::kIPv6Addresses), &detail::DecodeStructField<DecodableType, &DecodableType::IPv6Addresses> },
+        { to_underlying(Fields::kType), &detail::DecodeStructField<DecodableType, &DecodableType::type> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -6187,7 +7484,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kName))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kName))
         {
             err = DataModel::Decode(reader, name);
         }
@@ -6242,6 +7543,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kEnableKey), &detail::DecodeStructField<DecodableType, &DecodableType::enableKey> },
+        { to_underlying(Fields::kEventTrigger), &detail::DecodeStructField<DecodableType, &DecodableType::eventTrigger> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -6254,7 +7561,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kEnableKey))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kEnableKey))
         {
             err = DataModel::Decode(reader, enableKey);
         }
@@ -6301,6 +7612,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSystemTimeMs), &detail::DecodeStructField<DecodableType, &DecodableType::systemTimeMs> },
+        { to_underlying(Fields::kPosixTimeMs), &detail::DecodeStructField<DecodableType, &DecodableType::posixTimeMs> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -6313,7 +7630,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSystemTimeMs))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSystemTimeMs))
         {
             err = DataModel::Decode(reader, systemTimeMs);
         }
@@ -6341,6 +7662,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kEnableKey), &detail::DecodeStructField<DecodableType, &DecodableType::enableKey> },
+        { to_underlying(Fields::kValue), &detail::DecodeStructField<DecodableType, &DecodableType::value> },
+        { to_underlying(Fields::kCount), &detail::DecodeStructField<DecodableType, &DecodableType::count> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -6353,7 +7681,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kEnableKey))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kEnableKey))
         {
             err = DataModel::Decode(reader, enableKey);
         }
@@ -6383,6 +7715,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPayload), &detail::DecodeStructField<DecodableType, &DecodableType::payload> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -6395,7 +7732,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPayload))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPayload))
         {
             err = DataModel::Decode(reader, payload);
         }
@@ -6461,6 +7802,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCurrent), &detail::DecodeStructField<DecodableType, &DecodableType::current> },
+        { to_underlying(Fields::kPrevious), &detail::DecodeStructField<DecodableType, &DecodableType::previous> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -6473,7 +7820,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCurrent))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCurrent))
         {
             err = DataModel::Decode(reader, current);
         }
@@ -6501,6 +7852,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCurrent), &detail::DecodeStructField<DecodableType, &DecodableType::current> },
+        { to_underlying(Fields::kPrevious), &detail::DecodeStructField<DecodableType, &DecodableType::previous> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -6513,7 +7870,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCurrent))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCurrent))
         {
             err = DataModel::Decode(reader, current);
         }
@@ -6541,6 +7902,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCurrent), &detail::DecodeStructField<DecodableType, &DecodableType::current> },
+        { to_underlying(Fields::kPrevious), &detail::DecodeStructField<DecodableType, &DecodableType::previous> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -6553,7 +7920,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCurrent))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCurrent))
         {
             err = DataModel::Decode(reader, current);
         }
@@ -6580,6 +7951,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kBootReason), &detail::DecodeStructField<DecodableType, &DecodableType::bootReason> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -6592,7 +7968,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kBootReason))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kBootReason))
         {
             err = DataModel::Decode(reader, bootReason);
         }
@@ -6624,6 +8004,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kId), &detail::DecodeStructField<DecodableType, &DecodableType::id> },
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+        { to_underlying(Fields::kStackFreeCurrent), &detail::DecodeStructField<DecodableType, &DecodableType::stackFreeCurrent> },
+        { to_underlying(Fields::kStackFreeMinimum), &detail::DecodeStructField<DecodableType, &DecodableType::stackFreeMinimum> },
+        { to_underlying(Fields::kStackSize), &detail::DecodeStructField<DecodableType, &DecodableType::stackSize> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -6636,7 +8025,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kId))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kId))
         {
             err = DataModel::Decode(reader, id);
         }
@@ -6733,6 +8126,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kId), &detail::DecodeStructField<DecodableType, &DecodableType::id> },
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+        { to_underlying(Fields::kFaultRecording), &detail::DecodeStructField<DecodableType, &DecodableType::faultRecording> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -6745,7 +8145,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kId))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kId))
         {
             err = DataModel::Decode(reader, id);
         }
@@ -6794,6 +8198,24 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kExtAddress), &detail::DecodeStructField<DecodableType, &DecodableType::extAddress> },
+        { to_underlying(Fields::kAge), &detail::DecodeStructField<DecodableType, &DecodableType::age> },
+        { to_underlying(Fields::kRloc16), &detail::DecodeStructField<DecodableType, &DecodableType::rloc16> },
+        { to_underlying(Fields::kLinkFrameCounter), &detail::DecodeStructField<DecodableType, &DecodableType::linkFrameCounter> },
+        { to_underlying(Fields::kMleFrameCounter), &detail::DecodeStructField<DecodableType, &DecodableType::mleFrameCounter> },
+        { to_underlying(Fields::kLqi), &detail::DecodeStructField<DecodableType, &DecodableType::lqi> },
+        { to_underlying(Fields::kAverageRssi), &detail::DecodeStructField<DecodableType, &DecodableType::averageRssi> },
+        { to_underlying(Fields::kLastRssi), &detail::DecodeStructField<DecodableType, &DecodableType::lastRssi> },
+        { to_underlying(Fields::kFrameErrorRate), &detail::DecodeStructField<DecodableType, &DecodableType::frameErrorRate> },
+        { to_underlying(Fields::kMessageErrorRate), &detail::DecodeStructField<DecodableType, &DecodableType::messageErrorRate> },
+        { to_underlying(Fields::kRxOnWhenIdle), &detail::DecodeStructField<DecodableType, &DecodableType::rxOnWhenIdle> },
+        { to_underlying(Fields::kFullThreadDevice), &detail::DecodeStructField<DecodableType, &DecodableType::fullThreadDevice> },
+        { to_underlying(Fields::kFullNetworkData), &detail::DecodeStructField<DecodableType, &DecodableType::fullNetworkData> },
+        { to_underlying(Fields::kIsChild), &detail::DecodeStructField<DecodableType, &DecodableType::isChild> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -6806,7 +8228,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kExtAddress))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kExtAddress))
         {
             err = DataModel::Decode(reader, extAddress);
         }
@@ -6893,6 +8319,29 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kActiveTimestampPresent),
+          &detail::DecodeStructField<DecodableType, &DecodableType::activeTimestampPresent> },
+        { to_underlying(Fields::kPendingTimestampPresent),
+          &detail::DecodeStructField<DecodableType, &DecodableType::pendingTimestampPresent> },
+        { to_underlying(Fields::kMasterKeyPresent), &detail::DecodeStructField<DecodableType, &DecodableType::masterKeyPresent> },
+        { to_underlying(Fields::kNetworkNamePresent),
+          &detail::DecodeStructField<DecodableType, &DecodableType::networkNamePresent> },
+        { to_underlying(Fields::kExtendedPanIdPresent),
+          &detail::DecodeStructField<DecodableType, &DecodableType::extendedPanIdPresent> },
+        { to_underlying(Fields::kMeshLocalPrefixPresent),
+          &detail::DecodeStructField<DecodableType, &DecodableType::meshLocalPrefixPresent> },
+        { to_underlying(Fields::kDelayPresent), &detail::DecodeStructField<DecodableType, &DecodableType::delayPresent> },
+        { to_underlying(Fields::kPanIdPresent), &detail::DecodeStructField<DecodableType, &DecodableType::panIdPresent> },
+        { to_underlying(Fields::kChannelPresent), &detail::DecodeStructField<DecodableType, &DecodableType::channelPresent> },
+        { to_underlying(Fields::kPskcPresent), &detail::DecodeStructField<DecodableType, &DecodableType::pskcPresent> },
+        { to_underlying(Fields::kSecurityPolicyPresent),
+          &detail::DecodeStructField<DecodableType, &DecodableType::securityPolicyPresent> },
+        { to_underlying(Fields::kChannelMaskPresent),
+          &detail::DecodeStructField<DecodableType, &DecodableType::channelMaskPresent> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -6905,7 +8354,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kActiveTimestampPresent))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kActiveTimestampPresent))
         {
             err = DataModel::Decode(reader, activeTimestampPresent);
         }
@@ -6982,6 +8435,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kExtAddress), &detail::DecodeStructField<DecodableType, &DecodableType::extAddress> },
+        { to_underlying(Fields::kRloc16), &detail::DecodeStructField<DecodableType, &DecodableType::rloc16> },
+        { to_underlying(Fields::kRouterId), &detail::DecodeStructField<DecodableType, &DecodableType::routerId> },
+        { to_underlying(Fields::kNextHop), &detail::DecodeStructField<DecodableType, &DecodableType::nextHop> },
+        { to_underlying(Fields::kPathCost), &detail::DecodeStructField<DecodableType, &DecodableType::pathCost> },
+        { to_underlying(Fields::kLQIIn), &detail::DecodeStructField<DecodableType, &DecodableType::LQIIn> },
+        { to_underlying(Fields::kLQIOut), &detail::DecodeStructField<DecodableType, &DecodableType::LQIOut> },
+        { to_underlying(Fields::kAge), &detail::DecodeStructField<DecodableType, &DecodableType::age> },
+        { to_underlying(Fields::kAllocated), &detail::DecodeStructField<DecodableType, &DecodableType::allocated> },
+        { to_underlying(Fields::kLinkEstablished), &detail::DecodeStructField<DecodableType, &DecodableType::linkEstablished> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -6994,7 +8461,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kExtAddress))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kExtAddress))
         {
             err = DataModel::Decode(reader, extAddress);
         }
@@ -7055,6 +8526,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kRotationTime), &detail::DecodeStructField<DecodableType, &DecodableType::rotationTime> },
+        { to_underlying(Fields::kFlags), &detail::DecodeStructField<DecodableType, &DecodableType::flags> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -7067,7 +8544,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kRotationTime))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kRotationTime))
         {
             err = DataModel::Decode(reader, rotationTime);
         }
@@ -7268,6 +8749,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kConnectionStatus), &detail::DecodeStructField<DecodableType, &DecodableType::connectionStatus> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -7280,7 +8766,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kConnectionStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kConnectionStatus))
         {
             err = DataModel::Decode(reader, connectionStatus);
         }
@@ -7304,6 +8794,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCurrent), &detail::DecodeStructField<DecodableType, &DecodableType::current> },
+        { to_underlying(Fields::kPrevious), &detail::DecodeStructField<DecodableType, &DecodableType::previous> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -7316,7 +8812,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCurrent))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCurrent))
         {
             err = DataModel::Decode(reader, current);
         }
@@ -7419,6 +8919,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kReasonCode), &detail::DecodeStructField<DecodableType, &DecodableType::reasonCode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -7431,7 +8936,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kReasonCode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kReasonCode))
         {
             err = DataModel::Decode(reader, reasonCode);
         }
@@ -7455,6 +8964,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAssociationFailureCause),
+          &detail::DecodeStructField<DecodableType, &DecodableType::associationFailureCause> },
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -7467,7 +8983,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAssociationFailureCause))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAssociationFailureCause))
         {
             err = DataModel::Decode(reader, associationFailureCause);
         }
@@ -7494,6 +9014,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kConnectionStatus), &detail::DecodeStructField<DecodableType, &DecodableType::connectionStatus> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -7506,7 +9031,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kConnectionStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kConnectionStatus))
         {
             err = DataModel::Decode(reader, connectionStatus);
         }
@@ -7603,6 +9132,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kOffset), &detail::DecodeStructField<DecodableType, &DecodableType::offset> },
+        { to_underlying(Fields::kValidStarting), &detail::DecodeStructField<DecodableType, &DecodableType::validStarting> },
+        { to_underlying(Fields::kValidUntil), &detail::DecodeStructField<DecodableType, &DecodableType::validUntil> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -7615,7 +9151,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kOffset))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kOffset))
         {
             err = DataModel::Decode(reader, offset);
         }
@@ -7648,6 +9188,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNodeID), &detail::DecodeStructField<DecodableType, &DecodableType::nodeID> },
+        { to_underlying(Fields::kEndpoint), &detail::DecodeStructField<DecodableType, &DecodableType::endpoint> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -7660,7 +9206,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNodeID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNodeID))
         {
             err = DataModel::Decode(reader, nodeID);
         }
@@ -7690,6 +9240,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kOffset), &detail::DecodeStructField<DecodableType, &DecodableType::offset> },
+        { to_underlying(Fields::kValidAt), &detail::DecodeStructField<DecodableType, &DecodableType::validAt> },
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -7702,7 +9259,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kOffset))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kOffset))
         {
             err = DataModel::Decode(reader, offset);
         }
@@ -7736,6 +9297,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+        { to_underlying(Fields::kNodeID), &detail::DecodeStructField<DecodableType, &DecodableType::nodeID> },
+        { to_underlying(Fields::kEndpoint), &detail::DecodeStructField<DecodableType, &DecodableType::endpoint> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -7748,7 +9316,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kFabricIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kFabricIndex))
         {
             err = DataModel::Decode(reader, fabricIndex);
         }
@@ -7784,6 +9356,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kUTCTime), &detail::DecodeStructField<DecodableType, &DecodableType::UTCTime> },
+        { to_underlying(Fields::kGranularity), &detail::DecodeStructField<DecodableType, &DecodableType::granularity> },
+        { to_underlying(Fields::kTimeSource), &detail::DecodeStructField<DecodableType, &DecodableType::timeSource> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -7796,7 +9375,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kUTCTime))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kUTCTime))
         {
             err = DataModel::Decode(reader, UTCTime);
         }
@@ -7826,6 +9409,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kTrustedTimeSource), &detail::DecodeStructField<DecodableType, &DecodableType::trustedTimeSource> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -7838,7 +9426,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kTrustedTimeSource))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kTrustedTimeSource))
         {
             err = DataModel::Decode(reader, trustedTimeSource);
         }
@@ -7860,6 +9452,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kTimeZone), &detail::DecodeStructField<DecodableType, &DecodableType::timeZone> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -7872,7 +9469,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kTimeZone))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kTimeZone))
         {
             err = DataModel::Decode(reader, timeZone);
         }
@@ -7894,6 +9495,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kDSTOffsetRequired), &detail::DecodeStructField<DecodableType, &DecodableType::DSTOffsetRequired> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -7906,7 +9512,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kDSTOffsetRequired))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kDSTOffsetRequired))
         {
             err = DataModel::Decode(reader, DSTOffsetRequired);
         }
@@ -7928,6 +9538,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kDSTOffset), &detail::DecodeStructField<DecodableType, &DecodableType::DSTOffset> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -7940,7 +9555,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kDSTOffset))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kDSTOffset))
         {
             err = DataModel::Decode(reader, DSTOffset);
         }
@@ -7962,6 +9581,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kDefaultNTP), &detail::DecodeStructField<DecodableType, &DecodableType::defaultNTP> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -7974,7 +9598,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kDefaultNTP))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kDefaultNTP))
         {
             err = DataModel::Decode(reader, defaultNTP);
         }
@@ -8068,6 +9696,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kDSTOffsetActive), &detail::DecodeStructField<DecodableType, &DecodableType::DSTOffsetActive> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -8080,7 +9713,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kDSTOffsetActive))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kDSTOffsetActive))
         {
             err = DataModel::Decode(reader, DSTOffsetActive);
         }
@@ -8104,6 +9741,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kOffset), &detail::DecodeStructField<DecodableType, &DecodableType::offset> },
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -8116,7 +9759,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kOffset))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kOffset))
         {
             err = DataModel::Decode(reader, offset);
         }
@@ -8191,6 +9838,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kFinish), &detail::DecodeStructField<DecodableType, &DecodableType::finish> },
+        { to_underlying(Fields::kPrimaryColor), &detail::DecodeStructField<DecodableType, &DecodableType::primaryColor> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -8203,7 +9856,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kFinish))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kFinish))
         {
             err = DataModel::Decode(reader, finish);
         }
@@ -8234,6 +9891,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStayActiveDuration),
+          &detail::DecodeStructField<DecodableType, &DecodableType::stayActiveDuration> },
+        { to_underlying(Fields::kTimeoutMs), &detail::DecodeStructField<DecodableType, &DecodableType::timeoutMs> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -8246,7 +9910,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStayActiveDuration))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStayActiveDuration))
         {
             err = DataModel::Decode(reader, stayActiveDuration);
         }
@@ -8331,6 +9999,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSoftwareVersion), &detail::DecodeStructField<DecodableType, &DecodableType::softwareVersion> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -8343,7 +10016,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSoftwareVersion))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSoftwareVersion))
         {
             err = DataModel::Decode(reader, softwareVersion);
         }
@@ -8408,6 +10085,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kReachableNewValue), &detail::DecodeStructField<DecodableType, &DecodableType::reachableNewValue> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -8420,7 +10102,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kReachableNewValue))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kReachableNewValue))
         {
             err = DataModel::Decode(reader, reachableNewValue);
         }
@@ -8443,6 +10129,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPromisedActiveDuration),
+          &detail::DecodeStructField<DecodableType, &DecodableType::promisedActiveDuration> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -8455,7 +10147,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPromisedActiveDuration))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPromisedActiveDuration))
         {
             err = DataModel::Decode(reader, promisedActiveDuration);
         }
@@ -8513,6 +10209,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNewPosition), &detail::DecodeStructField<DecodableType, &DecodableType::newPosition> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -8525,7 +10226,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNewPosition))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNewPosition))
         {
             err = DataModel::Decode(reader, newPosition);
         }
@@ -8548,6 +10253,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNewPosition), &detail::DecodeStructField<DecodableType, &DecodableType::newPosition> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -8560,7 +10270,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNewPosition))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNewPosition))
         {
             err = DataModel::Decode(reader, newPosition);
         }
@@ -8583,6 +10297,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNewPosition), &detail::DecodeStructField<DecodableType, &DecodableType::newPosition> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -8595,7 +10314,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNewPosition))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNewPosition))
         {
             err = DataModel::Decode(reader, newPosition);
         }
@@ -8618,6 +10341,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPreviousPosition), &detail::DecodeStructField<DecodableType, &DecodableType::previousPosition> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -8630,7 +10358,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPreviousPosition))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPreviousPosition))
         {
             err = DataModel::Decode(reader, previousPosition);
         }
@@ -8653,6 +10385,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPreviousPosition), &detail::DecodeStructField<DecodableType, &DecodableType::previousPosition> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -8665,7 +10402,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPreviousPosition))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPreviousPosition))
         {
             err = DataModel::Decode(reader, previousPosition);
         }
@@ -8690,6 +10431,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNewPosition), &detail::DecodeStructField<DecodableType, &DecodableType::newPosition> },
+        { to_underlying(Fields::kCurrentNumberOfPressesCounted),
+          &detail::DecodeStructField<DecodableType, &DecodableType::currentNumberOfPressesCounted> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -8702,7 +10450,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNewPosition))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNewPosition))
         {
             err = DataModel::Decode(reader, newPosition);
         }
@@ -8731,6 +10483,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPreviousPosition), &detail::DecodeStructField<DecodableType, &DecodableType::previousPosition> },
+        { to_underlying(Fields::kTotalNumberOfPressesCounted),
+          &detail::DecodeStructField<DecodableType, &DecodableType::totalNumberOfPressesCounted> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -8743,7 +10502,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPreviousPosition))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPreviousPosition))
         {
             err = DataModel::Decode(reader, previousPosition);
         }
@@ -8779,6 +10542,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCommissioningTimeout),
+          &detail::DecodeStructField<DecodableType, &DecodableType::commissioningTimeout> },
+        { to_underlying(Fields::kPAKEPasscodeVerifier),
+          &detail::DecodeStructField<DecodableType, &DecodableType::PAKEPasscodeVerifier> },
+        { to_underlying(Fields::kDiscriminator), &detail::DecodeStructField<DecodableType, &DecodableType::discriminator> },
+        { to_underlying(Fields::kIterations), &detail::DecodeStructField<DecodableType, &DecodableType::iterations> },
+        { to_underlying(Fields::kSalt), &detail::DecodeStructField<DecodableType, &DecodableType::salt> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -8791,7 +10565,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCommissioningTimeout))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCommissioningTimeout))
         {
             err = DataModel::Decode(reader, commissioningTimeout);
         }
@@ -8829,6 +10607,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCommissioningTimeout),
+          &detail::DecodeStructField<DecodableType, &DecodableType::commissioningTimeout> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -8841,7 +10625,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCommissioningTimeout))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCommissioningTimeout))
         {
             err = DataModel::Decode(reader, commissioningTimeout);
         }
@@ -8939,6 +10727,16 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kRootPublicKey), &detail::DecodeStructField<DecodableType, &DecodableType::rootPublicKey> },
+        { to_underlying(Fields::kVendorID), &detail::DecodeStructField<DecodableType, &DecodableType::vendorID> },
+        { to_underlying(Fields::kFabricID), &detail::DecodeStructField<DecodableType, &DecodableType::fabricID> },
+        { to_underlying(Fields::kNodeID), &detail::DecodeStructField<DecodableType, &DecodableType::nodeID> },
+        { to_underlying(Fields::kLabel), &detail::DecodeStructField<DecodableType, &DecodableType::label> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -8951,7 +10749,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kRootPublicKey))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kRootPublicKey))
         {
             err = DataModel::Decode(reader, rootPublicKey);
         }
@@ -9020,6 +10822,13 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNoc), &detail::DecodeStructField<DecodableType, &DecodableType::noc> },
+        { to_underlying(Fields::kIcac), &detail::DecodeStructField<DecodableType, &DecodableType::icac> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -9032,7 +10841,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNoc))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNoc))
         {
             err = DataModel::Decode(reader, noc);
         }
@@ -9066,6 +10879,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAttestationNonce), &detail::DecodeStructField<DecodableType, &DecodableType::attestationNonce> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -9078,7 +10896,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAttestationNonce))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAttestationNonce))
         {
             err = DataModel::Decode(reader, attestationNonce);
         }
@@ -9101,6 +10923,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAttestationElements),
+          &detail::DecodeStructField<DecodableType, &DecodableType::attestationElements> },
+        { to_underlying(Fields::kAttestationSignature),
+          &detail::DecodeStructField<DecodableType, &DecodableType::attestationSignature> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -9113,7 +10943,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAttestationElements))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAttestationElements))
         {
             err = DataModel::Decode(reader, attestationElements);
         }
@@ -9139,6 +10973,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCertificateType), &detail::DecodeStructField<DecodableType, &DecodableType::certificateType> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -9151,7 +10990,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCertificateType))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCertificateType))
         {
             err = DataModel::Decode(reader, certificateType);
         }
@@ -9173,6 +11016,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCertificate), &detail::DecodeStructField<DecodableType, &DecodableType::certificate> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -9185,7 +11033,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCertificate))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCertificate))
         {
             err = DataModel::Decode(reader, certificate);
         }
@@ -9208,6 +11060,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCSRNonce), &detail::DecodeStructField<DecodableType, &DecodableType::CSRNonce> },
+        { to_underlying(Fields::kIsForUpdateNOC), &detail::DecodeStructField<DecodableType, &DecodableType::isForUpdateNOC> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -9220,7 +11078,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCSRNonce))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCSRNonce))
         {
             err = DataModel::Decode(reader, CSRNonce);
         }
@@ -9247,6 +11109,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNOCSRElements), &detail::DecodeStructField<DecodableType, &DecodableType::NOCSRElements> },
+        { to_underlying(Fields::kAttestationSignature),
+          &detail::DecodeStructField<DecodableType, &DecodableType::attestationSignature> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -9259,7 +11128,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNOCSRElements))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNOCSRElements))
         {
             err = DataModel::Decode(reader, NOCSRElements);
         }
@@ -9289,6 +11162,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNOCValue), &detail::DecodeStructField<DecodableType, &DecodableType::NOCValue> },
+        { to_underlying(Fields::kICACValue), &detail::DecodeStructField<DecodableType, &DecodableType::ICACValue> },
+        { to_underlying(Fields::kIPKValue), &detail::DecodeStructField<DecodableType, &DecodableType::IPKValue> },
+        { to_underlying(Fields::kCaseAdminSubject), &detail::DecodeStructField<DecodableType, &DecodableType::caseAdminSubject> },
+        { to_underlying(Fields::kAdminVendorId), &detail::DecodeStructField<DecodableType, &DecodableType::adminVendorId> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -9301,7 +11183,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNOCValue))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNOCValue))
         {
             err = DataModel::Decode(reader, NOCValue);
         }
@@ -9340,6 +11226,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNOCValue), &detail::DecodeStructField<DecodableType, &DecodableType::NOCValue> },
+        { to_underlying(Fields::kICACValue), &detail::DecodeStructField<DecodableType, &DecodableType::ICACValue> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -9352,7 +11244,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNOCValue))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNOCValue))
         {
             err = DataModel::Decode(reader, NOCValue);
         }
@@ -9380,6 +11276,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatusCode), &detail::DecodeStructField<DecodableType, &DecodableType::statusCode> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+        { to_underlying(Fields::kDebugText), &detail::DecodeStructField<DecodableType, &DecodableType::debugText> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -9392,7 +11295,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatusCode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatusCode))
         {
             err = DataModel::Decode(reader, statusCode);
         }
@@ -9422,6 +11329,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kLabel), &detail::DecodeStructField<DecodableType, &DecodableType::label> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -9434,7 +11346,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kLabel))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kLabel))
         {
             err = DataModel::Decode(reader, label);
         }
@@ -9456,6 +11372,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -9468,7 +11389,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kFabricIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kFabricIndex))
         {
             err = DataModel::Decode(reader, fabricIndex);
         }
@@ -9490,6 +11415,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kRootCACertificate), &detail::DecodeStructField<DecodableType, &DecodableType::rootCACertificate> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -9502,7 +11432,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kRootCACertificate))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kRootCACertificate))
         {
             err = DataModel::Decode(reader, rootCACertificate);
         }
@@ -9584,6 +11518,14 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kGroupId), &detail::DecodeStructField<DecodableType, &DecodableType::groupId> },
+        { to_underlying(Fields::kEndpoints), &detail::DecodeStructField<DecodableType, &DecodableType::endpoints> },
+        { to_underlying(Fields::kGroupName), &detail::DecodeStructField<DecodableType, &DecodableType::groupName> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -9596,7 +11538,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kGroupId))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kGroupId))
         {
             err = DataModel::Decode(reader, groupId);
         }
@@ -9650,6 +11596,13 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kGroupId), &detail::DecodeStructField<DecodableType, &DecodableType::groupId> },
+        { to_underlying(Fields::kGroupKeySetID), &detail::DecodeStructField<DecodableType, &DecodableType::groupKeySetID> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -9662,7 +11615,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kGroupId))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kGroupId))
         {
             err = DataModel::Decode(reader, groupId);
         }
@@ -9701,6 +11658,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kGroupKeySetID), &detail::DecodeStructField<DecodableType, &DecodableType::groupKeySetID> },
+        { to_underlying(Fields::kGroupKeySecurityPolicy),
+          &detail::DecodeStructField<DecodableType, &DecodableType::groupKeySecurityPolicy> },
+        { to_underlying(Fields::kEpochKey0), &detail::DecodeStructField<DecodableType, &DecodableType::epochKey0> },
+        { to_underlying(Fields::kEpochStartTime0), &detail::DecodeStructField<DecodableType, &DecodableType::epochStartTime0> },
+        { to_underlying(Fields::kEpochKey1), &detail::DecodeStructField<DecodableType, &DecodableType::epochKey1> },
+        { to_underlying(Fields::kEpochStartTime1), &detail::DecodeStructField<DecodableType, &DecodableType::epochStartTime1> },
+        { to_underlying(Fields::kEpochKey2), &detail::DecodeStructField<DecodableType, &DecodableType::epochKey2> },
+        { to_underlying(Fields::kEpochStartTime2), &detail::DecodeStructField<DecodableType, &DecodableType::epochStartTime2> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -9713,7 +11683,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kGroupKeySetID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kGroupKeySetID))
         {
             err = DataModel::Decode(reader, groupKeySetID);
         }
@@ -9767,6 +11741,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kGroupKeySet), &detail::DecodeStructField<DecodableType, &DecodableType::groupKeySet> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -9779,7 +11758,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kGroupKeySet))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kGroupKeySet))
         {
             err = DataModel::Decode(reader, groupKeySet);
         }
@@ -9801,6 +11784,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kGroupKeySetID), &detail::DecodeStructField<DecodableType, &DecodableType::groupKeySetID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -9813,7 +11801,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kGroupKeySetID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kGroupKeySetID))
         {
             err = DataModel::Decode(reader, groupKeySetID);
         }
@@ -9835,6 +11827,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kGroupKeySet), &detail::DecodeStructField<DecodableType, &DecodableType::groupKeySet> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -9847,7 +11844,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kGroupKeySet))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kGroupKeySet))
         {
             err = DataModel::Decode(reader, groupKeySet);
         }
@@ -9869,6 +11870,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kGroupKeySetID), &detail::DecodeStructField<DecodableType, &DecodableType::groupKeySetID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -9881,7 +11887,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kGroupKeySetID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kGroupKeySetID))
         {
             err = DataModel::Decode(reader, groupKeySetID);
         }
@@ -9923,6 +11933,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kGroupKeySetIDs), &detail::DecodeStructField<DecodableType, &DecodableType::groupKeySetIDs> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -9935,7 +11950,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kGroupKeySetIDs))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kGroupKeySetIDs))
         {
             err = DataModel::Decode(reader, groupKeySetIDs);
         }
@@ -10166,6 +12185,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStateValue), &detail::DecodeStructField<DecodableType, &DecodableType::stateValue> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -10178,7 +12202,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStateValue))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStateValue))
         {
             err = DataModel::Decode(reader, stateValue);
         }
@@ -10235,6 +12263,14 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCheckInNodeID), &detail::DecodeStructField<DecodableType, &DecodableType::checkInNodeID> },
+        { to_underlying(Fields::kMonitoredSubject), &detail::DecodeStructField<DecodableType, &DecodableType::monitoredSubject> },
+        { to_underlying(Fields::kClientType), &detail::DecodeStructField<DecodableType, &DecodableType::clientType> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -10247,7 +12283,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCheckInNodeID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCheckInNodeID))
         {
             err = DataModel::Decode(reader, checkInNodeID);
         }
@@ -10289,6 +12329,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCheckInNodeID), &detail::DecodeStructField<DecodableType, &DecodableType::checkInNodeID> },
+        { to_underlying(Fields::kMonitoredSubject), &detail::DecodeStructField<DecodableType, &DecodableType::monitoredSubject> },
+        { to_underlying(Fields::kKey), &detail::DecodeStructField<DecodableType, &DecodableType::key> },
+        { to_underlying(Fields::kVerificationKey), &detail::DecodeStructField<DecodableType, &DecodableType::verificationKey> },
+        { to_underlying(Fields::kClientType), &detail::DecodeStructField<DecodableType, &DecodableType::clientType> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -10301,7 +12350,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCheckInNodeID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCheckInNodeID))
         {
             err = DataModel::Decode(reader, checkInNodeID);
         }
@@ -10339,6 +12392,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kICDCounter), &detail::DecodeStructField<DecodableType, &DecodableType::ICDCounter> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -10351,7 +12409,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kICDCounter))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kICDCounter))
         {
             err = DataModel::Decode(reader, ICDCounter);
         }
@@ -10374,6 +12436,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCheckInNodeID), &detail::DecodeStructField<DecodableType, &DecodableType::checkInNodeID> },
+        { to_underlying(Fields::kVerificationKey), &detail::DecodeStructField<DecodableType, &DecodableType::verificationKey> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -10386,7 +12454,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCheckInNodeID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCheckInNodeID))
         {
             err = DataModel::Decode(reader, checkInNodeID);
         }
@@ -10412,6 +12484,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStayActiveDuration),
+          &detail::DecodeStructField<DecodableType, &DecodableType::stayActiveDuration> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -10424,7 +12502,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStayActiveDuration))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStayActiveDuration))
         {
             err = DataModel::Decode(reader, stayActiveDuration);
         }
@@ -10446,6 +12528,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPromisedActiveDuration),
+          &detail::DecodeStructField<DecodableType, &DecodableType::promisedActiveDuration> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -10458,7 +12546,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPromisedActiveDuration))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPromisedActiveDuration))
         {
             err = DataModel::Decode(reader, promisedActiveDuration);
         }
@@ -10529,6 +12621,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNewTime), &detail::DecodeStructField<DecodableType, &DecodableType::newTime> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -10541,7 +12638,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNewTime))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNewTime))
         {
             err = DataModel::Decode(reader, newTime);
         }
@@ -10583,6 +12684,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAdditionalTime), &detail::DecodeStructField<DecodableType, &DecodableType::additionalTime> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -10595,7 +12701,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAdditionalTime))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAdditionalTime))
         {
             err = DataModel::Decode(reader, additionalTime);
         }
@@ -10617,6 +12727,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kTimeReduction), &detail::DecodeStructField<DecodableType, &DecodableType::timeReduction> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -10629,7 +12744,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kTimeReduction))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kTimeReduction))
         {
             err = DataModel::Decode(reader, timeReduction);
         }
@@ -10767,6 +12886,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCommandResponseState),
+          &detail::DecodeStructField<DecodableType, &DecodableType::commandResponseState> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -10779,7 +12904,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCommandResponseState))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCommandResponseState))
         {
             err = DataModel::Decode(reader, commandResponseState);
         }
@@ -10838,6 +12967,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kErrorState), &detail::DecodeStructField<DecodableType, &DecodableType::errorState> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -10850,7 +12984,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kErrorState))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kErrorState))
         {
             err = DataModel::Decode(reader, errorState);
         }
@@ -10875,6 +13013,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCompletionErrorCode),
+          &detail::DecodeStructField<DecodableType, &DecodableType::completionErrorCode> },
+        { to_underlying(Fields::kTotalOperationalTime),
+          &detail::DecodeStructField<DecodableType, &DecodableType::totalOperationalTime> },
+        { to_underlying(Fields::kPausedTime), &detail::DecodeStructField<DecodableType, &DecodableType::pausedTime> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -10887,7 +13034,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCompletionErrorCode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCompletionErrorCode))
         {
             err = DataModel::Decode(reader, completionErrorCode);
         }
@@ -10924,6 +13075,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNewMode), &detail::DecodeStructField<DecodableType, &DecodableType::newMode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -10936,7 +13092,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNewMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNewMode))
         {
             err = DataModel::Decode(reader, newMode);
         }
@@ -10959,6 +13119,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kStatusText), &detail::DecodeStructField<DecodableType, &DecodableType::statusText> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -10971,7 +13137,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -11067,6 +13237,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMfgCode), &detail::DecodeStructField<DecodableType, &DecodableType::mfgCode> },
+        { to_underlying(Fields::kValue), &detail::DecodeStructField<DecodableType, &DecodableType::value> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -11079,7 +13255,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMfgCode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMfgCode))
         {
             err = DataModel::Decode(reader, mfgCode);
         }
@@ -11109,6 +13289,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kLabel), &detail::DecodeStructField<DecodableType, &DecodableType::label> },
+        { to_underlying(Fields::kMode), &detail::DecodeStructField<DecodableType, &DecodableType::mode> },
+        { to_underlying(Fields::kSemanticTags), &detail::DecodeStructField<DecodableType, &DecodableType::semanticTags> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -11121,7 +13308,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kLabel))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kLabel))
         {
             err = DataModel::Decode(reader, label);
         }
@@ -11155,6 +13346,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNewMode), &detail::DecodeStructField<DecodableType, &DecodableType::newMode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -11167,7 +13363,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNewMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNewMode))
         {
             err = DataModel::Decode(reader, newMode);
         }
@@ -11231,6 +13431,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNewMode), &detail::DecodeStructField<DecodableType, &DecodableType::newMode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -11243,7 +13448,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNewMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNewMode))
         {
             err = DataModel::Decode(reader, newMode);
         }
@@ -11266,6 +13475,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kStatusText), &detail::DecodeStructField<DecodableType, &DecodableType::statusText> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -11278,7 +13493,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -11342,6 +13561,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNewMode), &detail::DecodeStructField<DecodableType, &DecodableType::newMode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -11354,7 +13578,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNewMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNewMode))
         {
             err = DataModel::Decode(reader, newMode);
         }
@@ -11377,6 +13605,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kStatusText), &detail::DecodeStructField<DecodableType, &DecodableType::statusText> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -11389,7 +13623,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -11489,6 +13727,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNewMode), &detail::DecodeStructField<DecodableType, &DecodableType::newMode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -11501,7 +13744,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNewMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNewMode))
         {
             err = DataModel::Decode(reader, newMode);
         }
@@ -11524,6 +13771,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kStatusText), &detail::DecodeStructField<DecodableType, &DecodableType::statusText> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -11536,7 +13789,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -11596,6 +13853,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNewMode), &detail::DecodeStructField<DecodableType, &DecodableType::newMode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -11608,7 +13870,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNewMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNewMode))
         {
             err = DataModel::Decode(reader, newMode);
         }
@@ -11631,6 +13897,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kStatusText), &detail::DecodeStructField<DecodableType, &DecodableType::statusText> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -11643,7 +13915,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -11703,6 +13979,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kTargetTemperature), &detail::DecodeStructField<DecodableType, &DecodableType::targetTemperature> },
+        { to_underlying(Fields::kTargetTemperatureLevel),
+          &detail::DecodeStructField<DecodableType, &DecodableType::targetTemperatureLevel> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -11715,7 +13998,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kTargetTemperature))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kTargetTemperature))
         {
             err = DataModel::Decode(reader, targetTemperature);
         }
@@ -11815,6 +14102,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kActive), &detail::DecodeStructField<DecodableType, &DecodableType::active> },
+        { to_underlying(Fields::kInactive), &detail::DecodeStructField<DecodableType, &DecodableType::inactive> },
+        { to_underlying(Fields::kState), &detail::DecodeStructField<DecodableType, &DecodableType::state> },
+        { to_underlying(Fields::kMask), &detail::DecodeStructField<DecodableType, &DecodableType::mask> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -11827,7 +14122,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kActive))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kActive))
         {
             err = DataModel::Decode(reader, active);
         }
@@ -11868,6 +14167,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNewMode), &detail::DecodeStructField<DecodableType, &DecodableType::newMode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -11880,7 +14184,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNewMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNewMode))
         {
             err = DataModel::Decode(reader, newMode);
         }
@@ -11903,6 +14211,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kStatusText), &detail::DecodeStructField<DecodableType, &DecodableType::statusText> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -11915,7 +14229,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -12079,6 +14397,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAlarmSeverityLevel),
+          &detail::DecodeStructField<DecodableType, &DecodableType::alarmSeverityLevel> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -12091,7 +14415,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAlarmSeverityLevel))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAlarmSeverityLevel))
         {
             err = DataModel::Decode(reader, alarmSeverityLevel);
         }
@@ -12114,6 +14442,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAlarmSeverityLevel),
+          &detail::DecodeStructField<DecodableType, &DecodableType::alarmSeverityLevel> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -12126,7 +14460,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAlarmSeverityLevel))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAlarmSeverityLevel))
         {
             err = DataModel::Decode(reader, alarmSeverityLevel);
         }
@@ -12149,6 +14487,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAlarmSeverityLevel),
+          &detail::DecodeStructField<DecodableType, &DecodableType::alarmSeverityLevel> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -12161,7 +14505,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAlarmSeverityLevel))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAlarmSeverityLevel))
         {
             err = DataModel::Decode(reader, alarmSeverityLevel);
         }
@@ -12289,6 +14637,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAlarmSeverityLevel),
+          &detail::DecodeStructField<DecodableType, &DecodableType::alarmSeverityLevel> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -12301,7 +14655,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAlarmSeverityLevel))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAlarmSeverityLevel))
         {
             err = DataModel::Decode(reader, alarmSeverityLevel);
         }
@@ -12324,6 +14682,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAlarmSeverityLevel),
+          &detail::DecodeStructField<DecodableType, &DecodableType::alarmSeverityLevel> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -12336,7 +14700,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAlarmSeverityLevel))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAlarmSeverityLevel))
         {
             err = DataModel::Decode(reader, alarmSeverityLevel);
         }
@@ -12385,6 +14753,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAlarms), &detail::DecodeStructField<DecodableType, &DecodableType::alarms> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -12397,7 +14770,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAlarms))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAlarms))
         {
             err = DataModel::Decode(reader, alarms);
         }
@@ -12419,6 +14796,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMask), &detail::DecodeStructField<DecodableType, &DecodableType::mask> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -12431,7 +14813,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMask))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMask))
         {
             err = DataModel::Decode(reader, mask);
         }
@@ -12489,6 +14875,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kActive), &detail::DecodeStructField<DecodableType, &DecodableType::active> },
+        { to_underlying(Fields::kInactive), &detail::DecodeStructField<DecodableType, &DecodableType::inactive> },
+        { to_underlying(Fields::kState), &detail::DecodeStructField<DecodableType, &DecodableType::state> },
+        { to_underlying(Fields::kMask), &detail::DecodeStructField<DecodableType, &DecodableType::mask> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -12501,7 +14895,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kActive))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kActive))
         {
             err = DataModel::Decode(reader, active);
         }
@@ -12578,6 +14976,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCookMode), &detail::DecodeStructField<DecodableType, &DecodableType::cookMode> },
+        { to_underlying(Fields::kCookTime), &detail::DecodeStructField<DecodableType, &DecodableType::cookTime> },
+        { to_underlying(Fields::kPowerSetting), &detail::DecodeStructField<DecodableType, &DecodableType::powerSetting> },
+        { to_underlying(Fields::kWattSettingIndex), &detail::DecodeStructField<DecodableType, &DecodableType::wattSettingIndex> },
+        { to_underlying(Fields::kStartAfterSetting), &detail::DecodeStructField<DecodableType, &DecodableType::startAfterSetting> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -12590,7 +14997,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCookMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCookMode))
         {
             err = DataModel::Decode(reader, cookMode);
         }
@@ -12628,6 +15039,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kTimeToAdd), &detail::DecodeStructField<DecodableType, &DecodableType::timeToAdd> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -12640,7 +15056,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kTimeToAdd))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kTimeToAdd))
         {
             err = DataModel::Decode(reader, timeToAdd);
         }
@@ -12790,6 +15210,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCommandResponseState),
+          &detail::DecodeStructField<DecodableType, &DecodableType::commandResponseState> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -12802,7 +15228,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCommandResponseState))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCommandResponseState))
         {
             err = DataModel::Decode(reader, commandResponseState);
         }
@@ -12861,6 +15291,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kErrorState), &detail::DecodeStructField<DecodableType, &DecodableType::errorState> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -12873,7 +15308,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kErrorState))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kErrorState))
         {
             err = DataModel::Decode(reader, errorState);
         }
@@ -12898,6 +15337,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCompletionErrorCode),
+          &detail::DecodeStructField<DecodableType, &DecodableType::completionErrorCode> },
+        { to_underlying(Fields::kTotalOperationalTime),
+          &detail::DecodeStructField<DecodableType, &DecodableType::totalOperationalTime> },
+        { to_underlying(Fields::kPausedTime), &detail::DecodeStructField<DecodableType, &DecodableType::pausedTime> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -12910,7 +15358,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCompletionErrorCode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCompletionErrorCode))
         {
             err = DataModel::Decode(reader, completionErrorCode);
         }
@@ -12987,6 +15439,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCommandResponseState),
+          &detail::DecodeStructField<DecodableType, &DecodableType::commandResponseState> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -12999,7 +15457,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCommandResponseState))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCommandResponseState))
         {
             err = DataModel::Decode(reader, commandResponseState);
         }
@@ -13078,6 +15540,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kErrorState), &detail::DecodeStructField<DecodableType, &DecodableType::errorState> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -13090,7 +15557,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kErrorState))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kErrorState))
         {
             err = DataModel::Decode(reader, errorState);
         }
@@ -13115,6 +15586,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCompletionErrorCode),
+          &detail::DecodeStructField<DecodableType, &DecodableType::completionErrorCode> },
+        { to_underlying(Fields::kTotalOperationalTime),
+          &detail::DecodeStructField<DecodableType, &DecodableType::totalOperationalTime> },
+        { to_underlying(Fields::kPausedTime), &detail::DecodeStructField<DecodableType, &DecodableType::pausedTime> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -13127,7 +15607,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCompletionErrorCode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCompletionErrorCode))
         {
             err = DataModel::Decode(reader, completionErrorCode);
         }
@@ -13171,6 +15655,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAttributeID), &detail::DecodeStructField<DecodableType, &DecodableType::attributeID> },
+        { to_underlying(Fields::kValueUnsigned8), &detail::DecodeStructField<DecodableType, &DecodableType::valueUnsigned8> },
+        { to_underlying(Fields::kValueSigned8), &detail::DecodeStructField<DecodableType, &DecodableType::valueSigned8> },
+        { to_underlying(Fields::kValueUnsigned16), &detail::DecodeStructField<DecodableType, &DecodableType::valueUnsigned16> },
+        { to_underlying(Fields::kValueSigned16), &detail::DecodeStructField<DecodableType, &DecodableType::valueSigned16> },
+        { to_underlying(Fields::kValueUnsigned32), &detail::DecodeStructField<DecodableType, &DecodableType::valueUnsigned32> },
+        { to_underlying(Fields::kValueSigned32), &detail::DecodeStructField<DecodableType, &DecodableType::valueSigned32> },
+        { to_underlying(Fields::kValueUnsigned64), &detail::DecodeStructField<DecodableType, &DecodableType::valueUnsigned64> },
+        { to_underlying(Fields::kValueSigned64), &detail::DecodeStructField<DecodableType, &DecodableType::valueSigned64> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -13183,7 +15680,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAttributeID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAttributeID))
         {
             err = DataModel::Decode(reader, attributeID);
         }
@@ -13240,6 +15741,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kClusterID), &detail::DecodeStructField<DecodableType, &DecodableType::clusterID> },
+        { to_underlying(Fields::kAttributeValueList),
+          &detail::DecodeStructField<DecodableType, &DecodableType::attributeValueList> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -13252,7 +15760,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kClusterID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kClusterID))
         {
             err = DataModel::Decode(reader, clusterID);
         }
@@ -13311,6 +15823,16 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSceneCount), &detail::DecodeStructField<DecodableType, &DecodableType::sceneCount> },
+        { to_underlying(Fields::kCurrentScene), &detail::DecodeStructField<DecodableType, &DecodableType::currentScene> },
+        { to_underlying(Fields::kCurrentGroup), &detail::DecodeStructField<DecodableType, &DecodableType::currentGroup> },
+        { to_underlying(Fields::kSceneValid), &detail::DecodeStructField<DecodableType, &DecodableType::sceneValid> },
+        { to_underlying(Fields::kRemainingCapacity), &detail::DecodeStructField<DecodableType, &DecodableType::remainingCapacity> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -13323,7 +15845,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSceneCount))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSceneCount))
         {
             err = DataModel::Decode(reader, sceneCount);
         }
@@ -13373,6 +15899,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kGroupID), &detail::DecodeStructField<DecodableType, &DecodableType::groupID> },
+        { to_underlying(Fields::kSceneID), &detail::DecodeStructField<DecodableType, &DecodableType::sceneID> },
+        { to_underlying(Fields::kTransitionTime), &detail::DecodeStructField<DecodableType, &DecodableType::transitionTime> },
+        { to_underlying(Fields::kSceneName), &detail::DecodeStructField<DecodableType, &DecodableType::sceneName> },
+        { to_underlying(Fields::kExtensionFieldSets),
+          &detail::DecodeStructField<DecodableType, &DecodableType::extensionFieldSets> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -13385,7 +15921,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kGroupID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kGroupID))
         {
             err = DataModel::Decode(reader, groupID);
         }
@@ -13425,6 +15965,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kGroupID), &detail::DecodeStructField<DecodableType, &DecodableType::groupID> },
+        { to_underlying(Fields::kSceneID), &detail::DecodeStructField<DecodableType, &DecodableType::sceneID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -13437,7 +15984,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -13468,6 +16019,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kGroupID), &detail::DecodeStructField<DecodableType, &DecodableType::groupID> },
+        { to_underlying(Fields::kSceneID), &detail::DecodeStructField<DecodableType, &DecodableType::sceneID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -13480,7 +16037,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kGroupID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kGroupID))
         {
             err = DataModel::Decode(reader, groupID);
         }
@@ -13511,6 +16072,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kGroupID), &detail::DecodeStructField<DecodableType, &DecodableType::groupID> },
+        { to_underlying(Fields::kSceneID), &detail::DecodeStructField<DecodableType, &DecodableType::sceneID> },
+        { to_underlying(Fields::kTransitionTime), &detail::DecodeStructField<DecodableType, &DecodableType::transitionTime> },
+        { to_underlying(Fields::kSceneName), &detail::DecodeStructField<DecodableType, &DecodableType::sceneName> },
+        { to_underlying(Fields::kExtensionFieldSets),
+          &detail::DecodeStructField<DecodableType, &DecodableType::extensionFieldSets> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -13523,7 +16095,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -13566,6 +16142,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kGroupID), &detail::DecodeStructField<DecodableType, &DecodableType::groupID> },
+        { to_underlying(Fields::kSceneID), &detail::DecodeStructField<DecodableType, &DecodableType::sceneID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -13578,7 +16160,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kGroupID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kGroupID))
         {
             err = DataModel::Decode(reader, groupID);
         }
@@ -13606,6 +16192,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kGroupID), &detail::DecodeStructField<DecodableType, &DecodableType::groupID> },
+        { to_underlying(Fields::kSceneID), &detail::DecodeStructField<DecodableType, &DecodableType::sceneID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -13618,7 +16211,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -13648,6 +16245,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kGroupID), &detail::DecodeStructField<DecodableType, &DecodableType::groupID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -13660,7 +16262,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kGroupID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kGroupID))
         {
             err = DataModel::Decode(reader, groupID);
         }
@@ -13683,6 +16289,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kGroupID), &detail::DecodeStructField<DecodableType, &DecodableType::groupID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -13695,7 +16307,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -13722,6 +16338,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kGroupID), &detail::DecodeStructField<DecodableType, &DecodableType::groupID> },
+        { to_underlying(Fields::kSceneID), &detail::DecodeStructField<DecodableType, &DecodableType::sceneID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -13734,7 +16356,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kGroupID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kGroupID))
         {
             err = DataModel::Decode(reader, groupID);
         }
@@ -13762,6 +16388,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kGroupID), &detail::DecodeStructField<DecodableType, &DecodableType::groupID> },
+        { to_underlying(Fields::kSceneID), &detail::DecodeStructField<DecodableType, &DecodableType::sceneID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -13774,7 +16407,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -13806,6 +16443,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kGroupID), &detail::DecodeStructField<DecodableType, &DecodableType::groupID> },
+        { to_underlying(Fields::kSceneID), &detail::DecodeStructField<DecodableType, &DecodableType::sceneID> },
+        { to_underlying(Fields::kTransitionTime), &detail::DecodeStructField<DecodableType, &DecodableType::transitionTime> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -13818,7 +16462,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kGroupID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kGroupID))
         {
             err = DataModel::Decode(reader, groupID);
         }
@@ -13848,6 +16496,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kGroupID), &detail::DecodeStructField<DecodableType, &DecodableType::groupID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -13860,7 +16513,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kGroupID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kGroupID))
         {
             err = DataModel::Decode(reader, groupID);
         }
@@ -13885,6 +16542,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kCapacity), &detail::DecodeStructField<DecodableType, &DecodableType::capacity> },
+        { to_underlying(Fields::kGroupID), &detail::DecodeStructField<DecodableType, &DecodableType::groupID> },
+        { to_underlying(Fields::kSceneList), &detail::DecodeStructField<DecodableType, &DecodableType::sceneList> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -13897,7 +16562,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -13935,6 +16604,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMode), &detail::DecodeStructField<DecodableType, &DecodableType::mode> },
+        { to_underlying(Fields::kGroupIdentifierFrom),
+          &detail::DecodeStructField<DecodableType, &DecodableType::groupIdentifierFrom> },
+        { to_underlying(Fields::kSceneIdentifierFrom),
+          &detail::DecodeStructField<DecodableType, &DecodableType::sceneIdentifierFrom> },
+        { to_underlying(Fields::kGroupIdentifierTo), &detail::DecodeStructField<DecodableType, &DecodableType::groupIdentifierTo> },
+        { to_underlying(Fields::kSceneIdentifierTo), &detail::DecodeStructField<DecodableType, &DecodableType::sceneIdentifierTo> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -13947,7 +16627,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMode))
         {
             err = DataModel::Decode(reader, mode);
         }
@@ -13987,6 +16671,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kGroupIdentifierFrom),
+          &detail::DecodeStructField<DecodableType, &DecodableType::groupIdentifierFrom> },
+        { to_underlying(Fields::kSceneIdentifierFrom),
+          &detail::DecodeStructField<DecodableType, &DecodableType::sceneIdentifierFrom> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -13999,7 +16692,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -14065,6 +16762,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kProductIdentifierType),
+          &detail::DecodeStructField<DecodableType, &DecodableType::productIdentifierType> },
+        { to_underlying(Fields::kProductIdentifierValue),
+          &detail::DecodeStructField<DecodableType, &DecodableType::productIdentifierValue> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -14077,7 +16782,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kProductIdentifierType))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kProductIdentifierType))
         {
             err = DataModel::Decode(reader, productIdentifierType);
         }
@@ -14169,6 +16878,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kProductIdentifierType),
+          &detail::DecodeStructField<DecodableType, &DecodableType::productIdentifierType> },
+        { to_underlying(Fields::kProductIdentifierValue),
+          &detail::DecodeStructField<DecodableType, &DecodableType::productIdentifierValue> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -14181,7 +16898,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kProductIdentifierType))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kProductIdentifierType))
         {
             err = DataModel::Decode(reader, productIdentifierType);
         }
@@ -14272,6 +16993,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAlarmsToSuppress), &detail::DecodeStructField<DecodableType, &DecodableType::alarmsToSuppress> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -14284,7 +17010,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAlarmsToSuppress))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAlarmsToSuppress))
         {
             err = DataModel::Decode(reader, alarmsToSuppress);
         }
@@ -14306,6 +17036,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAlarmsToEnableDisable),
+          &detail::DecodeStructField<DecodableType, &DecodableType::alarmsToEnableDisable> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -14318,7 +17054,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAlarmsToEnableDisable))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAlarmsToEnableDisable))
         {
             err = DataModel::Decode(reader, alarmsToEnableDisable);
         }
@@ -14382,6 +17122,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAlarmsActive), &detail::DecodeStructField<DecodableType, &DecodableType::alarmsActive> },
+        { to_underlying(Fields::kAlarmsSuppressed), &detail::DecodeStructField<DecodableType, &DecodableType::alarmsSuppressed> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -14394,7 +17140,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAlarmsActive))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAlarmsActive))
         {
             err = DataModel::Decode(reader, alarmsActive);
         }
@@ -14421,6 +17171,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSensorFault), &detail::DecodeStructField<DecodableType, &DecodableType::sensorFault> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -14433,7 +17188,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSensorFault))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSensorFault))
         {
             err = DataModel::Decode(reader, sensorFault);
         }
@@ -14462,6 +17221,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kOpenDuration), &detail::DecodeStructField<DecodableType, &DecodableType::openDuration> },
+        { to_underlying(Fields::kTargetLevel), &detail::DecodeStructField<DecodableType, &DecodableType::targetLevel> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -14474,7 +17239,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kOpenDuration))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kOpenDuration))
         {
             err = DataModel::Decode(reader, openDuration);
         }
@@ -14568,6 +17337,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kValveState), &detail::DecodeStructField<DecodableType, &DecodableType::valveState> },
+        { to_underlying(Fields::kValveLevel), &detail::DecodeStructField<DecodableType, &DecodableType::valveLevel> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -14580,7 +17355,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kValveState))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kValveState))
         {
             err = DataModel::Decode(reader, valveState);
         }
@@ -14607,6 +17386,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kValveFault), &detail::DecodeStructField<DecodableType, &DecodableType::valveFault> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -14619,7 +17403,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kValveFault))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kValveFault))
         {
             err = DataModel::Decode(reader, valveFault);
         }
@@ -14648,6 +17436,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kOrder), &detail::DecodeStructField<DecodableType, &DecodableType::order> },
+        { to_underlying(Fields::kMeasurement), &detail::DecodeStructField<DecodableType, &DecodableType::measurement> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -14660,7 +17454,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kOrder))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kOrder))
         {
             err = DataModel::Decode(reader, order);
         }
@@ -14698,6 +17496,21 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMeasurementType), &detail::DecodeStructField<DecodableType, &DecodableType::measurementType> },
+        { to_underlying(Fields::kMin), &detail::DecodeStructField<DecodableType, &DecodableType::min> },
+        { to_underlying(Fields::kMax), &detail::DecodeStructField<DecodableType, &DecodableType::max> },
+        { to_underlying(Fields::kStartTimestamp), &detail::DecodeStructField<DecodableType, &DecodableType::startTimestamp> },
+        { to_underlying(Fields::kEndTimestamp), &detail::DecodeStructField<DecodableType, &DecodableType::endTimestamp> },
+        { to_underlying(Fields::kMinTimestamp), &detail::DecodeStructField<DecodableType, &DecodableType::minTimestamp> },
+        { to_underlying(Fields::kMaxTimestamp), &detail::DecodeStructField<DecodableType, &DecodableType::maxTimestamp> },
+        { to_underlying(Fields::kStartSystime), &detail::DecodeStructField<DecodableType, &DecodableType::startSystime> },
+        { to_underlying(Fields::kEndSystime), &detail::DecodeStructField<DecodableType, &DecodableType::endSystime> },
+        { to_underlying(Fields::kMinSystime), &detail::DecodeStructField<DecodableType, &DecodableType::minSystime> },
+        { to_underlying(Fields::kMaxSystime), &detail::DecodeStructField<DecodableType, &DecodableType::maxSystime> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -14710,7 +17523,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMeasurementType))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMeasurementType))
         {
             err = DataModel::Decode(reader, measurementType);
         }
@@ -14838,6 +17655,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kRanges), &detail::DecodeStructField<DecodableType, &DecodableType::ranges> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -14850,7 +17672,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kRanges))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kRanges))
         {
             err = DataModel::Decode(reader, ranges);
         }
@@ -14881,6 +17707,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kImportedResetTimestamp),
+          &detail::DecodeStructField<DecodableType, &DecodableType::importedResetTimestamp> },
+        { to_underlying(Fields::kExportedResetTimestamp),
+          &detail::DecodeStructField<DecodableType, &DecodableType::exportedResetTimestamp> },
+        { to_underlying(Fields::kImportedResetSystime),
+          &detail::DecodeStructField<DecodableType, &DecodableType::importedResetSystime> },
+        { to_underlying(Fields::kExportedResetSystime),
+          &detail::DecodeStructField<DecodableType, &DecodableType::exportedResetSystime> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -14893,7 +17731,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kImportedResetTimestamp))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kImportedResetTimestamp))
         {
             err = DataModel::Decode(reader, importedResetTimestamp);
         }
@@ -14933,6 +17775,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kEnergy), &detail::DecodeStructField<DecodableType, &DecodableType::energy> },
+        { to_underlying(Fields::kStartTimestamp), &detail::DecodeStructField<DecodableType, &DecodableType::startTimestamp> },
+        { to_underlying(Fields::kEndTimestamp), &detail::DecodeStructField<DecodableType, &DecodableType::endTimestamp> },
+        { to_underlying(Fields::kStartSystime), &detail::DecodeStructField<DecodableType, &DecodableType::startSystime> },
+        { to_underlying(Fields::kEndSystime), &detail::DecodeStructField<DecodableType, &DecodableType::endSystime> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -14945,7 +17796,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kEnergy))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kEnergy))
         {
             err = DataModel::Decode(reader, energy);
         }
@@ -15024,6 +17879,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kEnergyImported), &detail::DecodeStructField<DecodableType, &DecodableType::energyImported> },
+        { to_underlying(Fields::kEnergyExported), &detail::DecodeStructField<DecodableType, &DecodableType::energyExported> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -15036,7 +17897,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kEnergyImported))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kEnergyImported))
         {
             err = DataModel::Decode(reader, energyImported);
         }
@@ -15064,6 +17929,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kEnergyImported), &detail::DecodeStructField<DecodableType, &DecodableType::energyImported> },
+        { to_underlying(Fields::kEnergyExported), &detail::DecodeStructField<DecodableType, &DecodableType::energyExported> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -15076,7 +17947,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kEnergyImported))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kEnergyImported))
         {
             err = DataModel::Decode(reader, energyImported);
         }
@@ -15113,6 +17988,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kDuration), &detail::DecodeStructField<DecodableType, &DecodableType::duration> },
+        { to_underlying(Fields::kOneShot), &detail::DecodeStructField<DecodableType, &DecodableType::oneShot> },
+        { to_underlying(Fields::kEmergencyBoost), &detail::DecodeStructField<DecodableType, &DecodableType::emergencyBoost> },
+        { to_underlying(Fields::kTemporarySetpoint), &detail::DecodeStructField<DecodableType, &DecodableType::temporarySetpoint> },
+        { to_underlying(Fields::kTargetPercentage), &detail::DecodeStructField<DecodableType, &DecodableType::targetPercentage> },
+        { to_underlying(Fields::kTargetReheat), &detail::DecodeStructField<DecodableType, &DecodableType::targetReheat> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -15125,7 +18010,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kDuration))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kDuration))
         {
             err = DataModel::Decode(reader, duration);
         }
@@ -15171,6 +18060,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kBoostInfo), &detail::DecodeStructField<DecodableType, &DecodableType::boostInfo> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -15183,7 +18077,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kBoostInfo))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kBoostInfo))
         {
             err = DataModel::Decode(reader, boostInfo);
         }
@@ -15262,6 +18160,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kBoostInfo), &detail::DecodeStructField<DecodableType, &DecodableType::boostInfo> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -15274,7 +18177,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kBoostInfo))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kBoostInfo))
         {
             err = DataModel::Decode(reader, boostInfo);
         }
@@ -15323,6 +18230,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kHeatingSource), &detail::DecodeStructField<DecodableType, &DecodableType::heatingSource> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -15335,7 +18247,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kHeatingSource))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kHeatingSource))
         {
             err = DataModel::Decode(reader, heatingSource);
         }
@@ -15359,6 +18275,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPowerSavings), &detail::DecodeStructField<DecodableType, &DecodableType::powerSavings> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -15371,7 +18292,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPowerSavings))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPowerSavings))
         {
             err = DataModel::Decode(reader, powerSavings);
         }
@@ -15395,6 +18320,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kDutyCycle), &detail::DecodeStructField<DecodableType, &DecodableType::dutyCycle> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -15407,7 +18337,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kDutyCycle))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kDutyCycle))
         {
             err = DataModel::Decode(reader, dutyCycle);
         }
@@ -15431,6 +18365,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kLoadAdjustment), &detail::DecodeStructField<DecodableType, &DecodableType::loadAdjustment> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -15443,7 +18382,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kLoadAdjustment))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kLoadAdjustment))
         {
             err = DataModel::Decode(reader, loadAdjustment);
         }
@@ -15470,6 +18413,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCoolingTempOffset), &detail::DecodeStructField<DecodableType, &DecodableType::coolingTempOffset> },
+        { to_underlying(Fields::kHeatingtTempOffset),
+          &detail::DecodeStructField<DecodableType, &DecodableType::heatingtTempOffset> },
+        { to_underlying(Fields::kCoolingTempSetpoint),
+          &detail::DecodeStructField<DecodableType, &DecodableType::coolingTempSetpoint> },
+        { to_underlying(Fields::kHeatingTempSetpoint),
+          &detail::DecodeStructField<DecodableType, &DecodableType::heatingTempSetpoint> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -15482,7 +18436,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCoolingTempOffset))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCoolingTempOffset))
         {
             err = DataModel::Decode(reader, coolingTempOffset);
         }
@@ -15524,6 +18482,21 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kDuration), &detail::DecodeStructField<DecodableType, &DecodableType::duration> },
+        { to_underlying(Fields::kControl), &detail::DecodeStructField<DecodableType, &DecodableType::control> },
+        { to_underlying(Fields::kTemperatureControl),
+          &detail::DecodeStructField<DecodableType, &DecodableType::temperatureControl> },
+        { to_underlying(Fields::kAverageLoadControl),
+          &detail::DecodeStructField<DecodableType, &DecodableType::averageLoadControl> },
+        { to_underlying(Fields::kDutyCycleControl), &detail::DecodeStructField<DecodableType, &DecodableType::dutyCycleControl> },
+        { to_underlying(Fields::kPowerSavingsControl),
+          &detail::DecodeStructField<DecodableType, &DecodableType::powerSavingsControl> },
+        { to_underlying(Fields::kHeatingSourceControl),
+          &detail::DecodeStructField<DecodableType, &DecodableType::heatingSourceControl> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -15536,7 +18509,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kDuration))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kDuration))
         {
             err = DataModel::Decode(reader, duration);
         }
@@ -15591,6 +18568,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kEventID), &detail::DecodeStructField<DecodableType, &DecodableType::eventID> },
+        { to_underlying(Fields::kProgramID), &detail::DecodeStructField<DecodableType, &DecodableType::programID> },
+        { to_underlying(Fields::kControl), &detail::DecodeStructField<DecodableType, &DecodableType::control> },
+        { to_underlying(Fields::kDeviceClass), &detail::DecodeStructField<DecodableType, &DecodableType::deviceClass> },
+        { to_underlying(Fields::kEnrollmentGroup), &detail::DecodeStructField<DecodableType, &DecodableType::enrollmentGroup> },
+        { to_underlying(Fields::kCriticality), &detail::DecodeStructField<DecodableType, &DecodableType::criticality> },
+        { to_underlying(Fields::kStartTime), &detail::DecodeStructField<DecodableType, &DecodableType::startTime> },
+        { to_underlying(Fields::kTransitions), &detail::DecodeStructField<DecodableType, &DecodableType::transitions> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -15603,7 +18592,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kEventID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kEventID))
         {
             err = DataModel::Decode(reader, eventID);
         }
@@ -15659,6 +18652,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kProgramID), &detail::DecodeStructField<DecodableType, &DecodableType::programID> },
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+        { to_underlying(Fields::kEnrollmentGroup), &detail::DecodeStructField<DecodableType, &DecodableType::enrollmentGroup> },
+        { to_underlying(Fields::kRandomStartMinutes),
+          &detail::DecodeStructField<DecodableType, &DecodableType::randomStartMinutes> },
+        { to_underlying(Fields::kRandomDurationMinutes),
+          &detail::DecodeStructField<DecodableType, &DecodableType::randomDurationMinutes> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -15671,7 +18675,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kProgramID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kProgramID))
         {
             err = DataModel::Decode(reader, programID);
         }
@@ -15713,6 +18721,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kLoadControlProgram),
+          &detail::DecodeStructField<DecodableType, &DecodableType::loadControlProgram> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -15725,7 +18739,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kLoadControlProgram))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kLoadControlProgram))
         {
             err = DataModel::Decode(reader, loadControlProgram);
         }
@@ -15747,6 +18765,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kLoadControlProgramID),
+          &detail::DecodeStructField<DecodableType, &DecodableType::loadControlProgramID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -15759,7 +18783,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kLoadControlProgramID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kLoadControlProgramID))
         {
             err = DataModel::Decode(reader, loadControlProgramID);
         }
@@ -15781,6 +18809,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kEvent), &detail::DecodeStructField<DecodableType, &DecodableType::event> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -15793,7 +18826,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kEvent))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kEvent))
         {
             err = DataModel::Decode(reader, event);
         }
@@ -15816,6 +18853,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kEventID), &detail::DecodeStructField<DecodableType, &DecodableType::eventID> },
+        { to_underlying(Fields::kCancelControl), &detail::DecodeStructField<DecodableType, &DecodableType::cancelControl> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -15828,7 +18871,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kEventID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kEventID))
         {
             err = DataModel::Decode(reader, eventID);
         }
@@ -15924,6 +18971,24 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kEventID), &detail::DecodeStructField<DecodableType, &DecodableType::eventID> },
+        { to_underlying(Fields::kTransitionIndex), &detail::DecodeStructField<DecodableType, &DecodableType::transitionIndex> },
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kCriticality), &detail::DecodeStructField<DecodableType, &DecodableType::criticality> },
+        { to_underlying(Fields::kControl), &detail::DecodeStructField<DecodableType, &DecodableType::control> },
+        { to_underlying(Fields::kTemperatureControl),
+          &detail::DecodeStructField<DecodableType, &DecodableType::temperatureControl> },
+        { to_underlying(Fields::kAverageLoadControl),
+          &detail::DecodeStructField<DecodableType, &DecodableType::averageLoadControl> },
+        { to_underlying(Fields::kDutyCycleControl), &detail::DecodeStructField<DecodableType, &DecodableType::dutyCycleControl> },
+        { to_underlying(Fields::kPowerSavingsControl),
+          &detail::DecodeStructField<DecodableType, &DecodableType::powerSavingsControl> },
+        { to_underlying(Fields::kHeatingSourceControl),
+          &detail::DecodeStructField<DecodableType, &DecodableType::heatingSourceControl> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -15936,7 +19001,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kEventID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kEventID))
         {
             err = DataModel::Decode(reader, eventID);
         }
@@ -16001,6 +19070,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMessageResponseID), &detail::DecodeStructField<DecodableType, &DecodableType::messageResponseID> },
+        { to_underlying(Fields::kLabel), &detail::DecodeStructField<DecodableType, &DecodableType::label> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -16013,7 +19088,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMessageResponseID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMessageResponseID))
         {
             err = DataModel::Decode(reader, messageResponseID);
         }
@@ -16047,6 +19126,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMessageID), &detail::DecodeStructField<DecodableType, &DecodableType::messageID> },
+        { to_underlying(Fields::kPriority), &detail::DecodeStructField<DecodableType, &DecodableType::priority> },
+        { to_underlying(Fields::kMessageControl), &detail::DecodeStructField<DecodableType, &DecodableType::messageControl> },
+        { to_underlying(Fields::kStartTime), &detail::DecodeStructField<DecodableType, &DecodableType::startTime> },
+        { to_underlying(Fields::kDuration), &detail::DecodeStructField<DecodableType, &DecodableType::duration> },
+        { to_underlying(Fields::kMessageText), &detail::DecodeStructField<DecodableType, &DecodableType::messageText> },
+        { to_underlying(Fields::kResponses), &detail::DecodeStructField<DecodableType, &DecodableType::responses> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -16059,7 +19149,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMessageID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMessageID))
         {
             err = DataModel::Decode(reader, messageID);
         }
@@ -16115,6 +19209,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMessageID), &detail::DecodeStructField<DecodableType, &DecodableType::messageID> },
+        { to_underlying(Fields::kPriority), &detail::DecodeStructField<DecodableType, &DecodableType::priority> },
+        { to_underlying(Fields::kMessageControl), &detail::DecodeStructField<DecodableType, &DecodableType::messageControl> },
+        { to_underlying(Fields::kStartTime), &detail::DecodeStructField<DecodableType, &DecodableType::startTime> },
+        { to_underlying(Fields::kDuration), &detail::DecodeStructField<DecodableType, &DecodableType::duration> },
+        { to_underlying(Fields::kMessageText), &detail::DecodeStructField<DecodableType, &DecodableType::messageText> },
+        { to_underlying(Fields::kResponses), &detail::DecodeStructField<DecodableType, &DecodableType::responses> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -16127,7 +19232,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMessageID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMessageID))
         {
             err = DataModel::Decode(reader, messageID);
         }
@@ -16173,6 +19282,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMessageIDs), &detail::DecodeStructField<DecodableType, &DecodableType::messageIDs> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -16185,7 +19299,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMessageIDs))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMessageIDs))
         {
             err = DataModel::Decode(reader, messageIDs);
         }
@@ -16236,6 +19354,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMessageID), &detail::DecodeStructField<DecodableType, &DecodableType::messageID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -16248,7 +19371,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMessageID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMessageID))
         {
             err = DataModel::Decode(reader, messageID);
         }
@@ -16271,6 +19398,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMessageID), &detail::DecodeStructField<DecodableType, &DecodableType::messageID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -16283,7 +19415,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMessageID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMessageID))
         {
             err = DataModel::Decode(reader, messageID);
         }
@@ -16309,6 +19445,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMessageID), &detail::DecodeStructField<DecodableType, &DecodableType::messageID> },
+        { to_underlying(Fields::kResponseID), &detail::DecodeStructField<DecodableType, &DecodableType::responseID> },
+        { to_underlying(Fields::kReply), &detail::DecodeStructField<DecodableType, &DecodableType::reply> },
+        { to_underlying(Fields::kFutureMessagesPreference),
+          &detail::DecodeStructField<DecodableType, &DecodableType::futureMessagesPreference> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -16321,7 +19466,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMessageID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMessageID))
         {
             err = DataModel::Decode(reader, messageID);
         }
@@ -16364,6 +19513,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCostType), &detail::DecodeStructField<DecodableType, &DecodableType::costType> },
+        { to_underlying(Fields::kValue), &detail::DecodeStructField<DecodableType, &DecodableType::value> },
+        { to_underlying(Fields::kDecimalPoints), &detail::DecodeStructField<DecodableType, &DecodableType::decimalPoints> },
+        { to_underlying(Fields::kCurrency), &detail::DecodeStructField<DecodableType, &DecodableType::currency> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -16376,7 +19533,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCostType))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCostType))
         {
             err = DataModel::Decode(reader, costType);
         }
@@ -16415,6 +19576,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMinPower), &detail::DecodeStructField<DecodableType, &DecodableType::minPower> },
+        { to_underlying(Fields::kMaxPower), &detail::DecodeStructField<DecodableType, &DecodableType::maxPower> },
+        { to_underlying(Fields::kMinDuration), &detail::DecodeStructField<DecodableType, &DecodableType::minDuration> },
+        { to_underlying(Fields::kMaxDuration), &detail::DecodeStructField<DecodableType, &DecodableType::maxDuration> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -16427,7 +19596,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMinPower))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMinPower))
         {
             err = DataModel::Decode(reader, minPower);
         }
@@ -16464,6 +19637,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPowerAdjustCapability),
+          &detail::DecodeStructField<DecodableType, &DecodableType::powerAdjustCapability> },
+        { to_underlying(Fields::kCause), &detail::DecodeStructField<DecodableType, &DecodableType::cause> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -16476,7 +19656,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPowerAdjustCapability))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPowerAdjustCapability))
         {
             err = DataModel::Decode(reader, powerAdjustCapability);
         }
@@ -16521,6 +19705,33 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMinDuration), &detail::DecodeStructField<DecodableType, &DecodableType::minDuration> },
+        { to_underlying(Fields::kMaxDuration), &detail::DecodeStructField<DecodableType, &DecodableType::maxDuration> },
+        { to_underlying(Fields::kDefaultDuration), &detail::DecodeStructField<DecodableType, &DecodableType::defaultDuration> },
+        { to_underlying(Fields::kElapsedSlotTime), &detail::DecodeStructField<DecodableType, &DecodableType::elapsedSlotTime> },
+        { to_underlying(Fields::kRemainingSlotTime), &detail::DecodeStructField<DecodableType, &DecodableType::remainingSlotTime> },
+        { to_underlying(Fields::kSlotIsPausable), &detail::DecodeStructField<DecodableType, &DecodableType::slotIsPausable> },
+        { to_underlying(Fields::kMinPauseDuration), &detail::DecodeStructField<DecodableType, &DecodableType::minPauseDuration> },
+        { to_underlying(Fields::kMaxPauseDuration), &detail::DecodeStructField<DecodableType, &DecodableType::maxPauseDuration> },
+        { to_underlying(Fields::kManufacturerESAState),
+          &detail::DecodeStructField<DecodableType, &DecodableType::manufacturerESAState> },
+        { to_underlying(Fields::kNominalPower), &detail::DecodeStructField<DecodableType, &DecodableType::nominalPower> },
+        { to_underlying(Fields::kMinPower), &detail::DecodeStructField<DecodableType, &DecodableType::minPower> },
+        { to_underlying(Fields::kMaxPower), &detail::DecodeStructField<DecodableType, &DecodableType::maxPower> },
+        { to_underlying(Fields::kNominalEnergy), &detail::DecodeStructField<DecodableType, &DecodableType::nominalEnergy> },
+        { to_underlying(Fields::kCosts), &detail::DecodeStructField<DecodableType, &DecodableType::costs> },
+        { to_underlying(Fields::kMinPowerAdjustment),
+          &detail::DecodeStructField<DecodableType, &DecodableType::minPowerAdjustment> },
+        { to_underlying(Fields::kMaxPowerAdjustment),
+          &detail::DecodeStructField<DecodableType, &DecodableType::maxPowerAdjustment> },
+        { to_underlying(Fields::kMinDurationAdjustment),
+          &detail::DecodeStructField<DecodableType, &DecodableType::minDurationAdjustment> },
+        { to_underlying(Fields::kMaxDurationAdjustment),
+          &detail::DecodeStructField<DecodableType, &DecodableType::maxDurationAdjustment> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -16533,7 +19744,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMinDuration))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMinDuration))
         {
             err = DataModel::Decode(reader, minDuration);
         }
@@ -16633,6 +19848,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kForecastID), &detail::DecodeStructField<DecodableType, &DecodableType::forecastID> },
+        { to_underlying(Fields::kActiveSlotNumber), &detail::DecodeStructField<DecodableType, &DecodableType::activeSlotNumber> },
+        { to_underlying(Fields::kStartTime), &detail::DecodeStructField<DecodableType, &DecodableType::startTime> },
+        { to_underlying(Fields::kEndTime), &detail::DecodeStructField<DecodableType, &DecodableType::endTime> },
+        { to_underlying(Fields::kEarliestStartTime), &detail::DecodeStructField<DecodableType, &DecodableType::earliestStartTime> },
+        { to_underlying(Fields::kLatestEndTime), &detail::DecodeStructField<DecodableType, &DecodableType::latestEndTime> },
+        { to_underlying(Fields::kIsPausable), &detail::DecodeStructField<DecodableType, &DecodableType::isPausable> },
+        { to_underlying(Fields::kSlots), &detail::DecodeStructField<DecodableType, &DecodableType::slots> },
+        { to_underlying(Fields::kForecastUpdateReason),
+          &detail::DecodeStructField<DecodableType, &DecodableType::forecastUpdateReason> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -16645,7 +19874,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kForecastID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kForecastID))
         {
             err = DataModel::Decode(reader, forecastID);
         }
@@ -16705,6 +19938,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStartTime), &detail::DecodeStructField<DecodableType, &DecodableType::startTime> },
+        { to_underlying(Fields::kDuration), &detail::DecodeStructField<DecodableType, &DecodableType::duration> },
+        { to_underlying(Fields::kNominalPower), &detail::DecodeStructField<DecodableType, &DecodableType::nominalPower> },
+        { to_underlying(Fields::kMaximumEnergy), &detail::DecodeStructField<DecodableType, &DecodableType::maximumEnergy> },
+        { to_underlying(Fields::kLoadControl), &detail::DecodeStructField<DecodableType, &DecodableType::loadControl> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -16717,7 +19959,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStartTime))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStartTime))
         {
             err = DataModel::Decode(reader, startTime);
         }
@@ -16759,6 +20005,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSlotIndex), &detail::DecodeStructField<DecodableType, &DecodableType::slotIndex> },
+        { to_underlying(Fields::kNominalPower), &detail::DecodeStructField<DecodableType, &DecodableType::nominalPower> },
+        { to_underlying(Fields::kDuration), &detail::DecodeStructField<DecodableType, &DecodableType::duration> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -16771,7 +20024,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSlotIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSlotIndex))
         {
             err = DataModel::Decode(reader, slotIndex);
         }
@@ -16807,6 +20064,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPower), &detail::DecodeStructField<DecodableType, &DecodableType::power> },
+        { to_underlying(Fields::kDuration), &detail::DecodeStructField<DecodableType, &DecodableType::duration> },
+        { to_underlying(Fields::kCause), &detail::DecodeStructField<DecodableType, &DecodableType::cause> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -16819,7 +20083,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPower))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPower))
         {
             err = DataModel::Decode(reader, power);
         }
@@ -16870,6 +20138,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kRequestedStartTime),
+          &detail::DecodeStructField<DecodableType, &DecodableType::requestedStartTime> },
+        { to_underlying(Fields::kCause), &detail::DecodeStructField<DecodableType, &DecodableType::cause> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -16882,7 +20157,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kRequestedStartTime))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kRequestedStartTime))
         {
             err = DataModel::Decode(reader, requestedStartTime);
         }
@@ -16909,6 +20188,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kDuration), &detail::DecodeStructField<DecodableType, &DecodableType::duration> },
+        { to_underlying(Fields::kCause), &detail::DecodeStructField<DecodableType, &DecodableType::cause> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -16921,7 +20206,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kDuration))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kDuration))
         {
             err = DataModel::Decode(reader, duration);
         }
@@ -16969,6 +20258,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kForecastID), &detail::DecodeStructField<DecodableType, &DecodableType::forecastID> },
+        { to_underlying(Fields::kSlotAdjustments), &detail::DecodeStructField<DecodableType, &DecodableType::slotAdjustments> },
+        { to_underlying(Fields::kCause), &detail::DecodeStructField<DecodableType, &DecodableType::cause> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -16981,7 +20277,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kForecastID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kForecastID))
         {
             err = DataModel::Decode(reader, forecastID);
         }
@@ -17012,6 +20312,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kConstraints), &detail::DecodeStructField<DecodableType, &DecodableType::constraints> },
+        { to_underlying(Fields::kCause), &detail::DecodeStructField<DecodableType, &DecodableType::cause> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -17024,7 +20330,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kConstraints))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kConstraints))
         {
             err = DataModel::Decode(reader, constraints);
         }
@@ -17134,6 +20444,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCause), &detail::DecodeStructField<DecodableType, &DecodableType::cause> },
+        { to_underlying(Fields::kDuration), &detail::DecodeStructField<DecodableType, &DecodableType::duration> },
+        { to_underlying(Fields::kEnergyUse), &detail::DecodeStructField<DecodableType, &DecodableType::energyUse> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -17146,7 +20463,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCause))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCause))
         {
             err = DataModel::Decode(reader, cause);
         }
@@ -17198,6 +20519,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCause), &detail::DecodeStructField<DecodableType, &DecodableType::cause> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -17210,7 +20536,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCause))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCause))
         {
             err = DataModel::Decode(reader, cause);
         }
@@ -17240,6 +20570,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kTargetTimeMinutesPastMidnight),
+          &detail::DecodeStructField<DecodableType, &DecodableType::targetTimeMinutesPastMidnight> },
+        { to_underlying(Fields::kTargetSoC), &detail::DecodeStructField<DecodableType, &DecodableType::targetSoC> },
+        { to_underlying(Fields::kAddedEnergy), &detail::DecodeStructField<DecodableType, &DecodableType::addedEnergy> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -17252,7 +20590,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kTargetTimeMinutesPastMidnight))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kTargetTimeMinutesPastMidnight))
         {
             err = DataModel::Decode(reader, targetTimeMinutesPastMidnight);
         }
@@ -17285,6 +20627,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kDayOfWeekForSequence),
+          &detail::DecodeStructField<DecodableType, &DecodableType::dayOfWeekForSequence> },
+        { to_underlying(Fields::kChargingTargets), &detail::DecodeStructField<DecodableType, &DecodableType::chargingTargets> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -17297,7 +20646,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kDayOfWeekForSequence))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kDayOfWeekForSequence))
         {
             err = DataModel::Decode(reader, dayOfWeekForSequence);
         }
@@ -17327,6 +20680,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kChargingTargetSchedules),
+          &detail::DecodeStructField<DecodableType, &DecodableType::chargingTargetSchedules> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -17339,7 +20698,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kChargingTargetSchedules))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kChargingTargetSchedules))
         {
             err = DataModel::Decode(reader, chargingTargetSchedules);
         }
@@ -17383,6 +20746,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kChargingEnabledUntil),
+          &detail::DecodeStructField<DecodableType, &DecodableType::chargingEnabledUntil> },
+        { to_underlying(Fields::kMinimumChargeCurrent),
+          &detail::DecodeStructField<DecodableType, &DecodableType::minimumChargeCurrent> },
+        { to_underlying(Fields::kMaximumChargeCurrent),
+          &detail::DecodeStructField<DecodableType, &DecodableType::maximumChargeCurrent> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -17395,7 +20768,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kChargingEnabledUntil))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kChargingEnabledUntil))
         {
             err = DataModel::Decode(reader, chargingEnabledUntil);
         }
@@ -17426,6 +20803,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kDischargingEnabledUntil),
+          &detail::DecodeStructField<DecodableType, &DecodableType::dischargingEnabledUntil> },
+        { to_underlying(Fields::kMaximumDischargeCurrent),
+          &detail::DecodeStructField<DecodableType, &DecodableType::maximumDischargeCurrent> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -17438,7 +20823,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kDischargingEnabledUntil))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kDischargingEnabledUntil))
         {
             err = DataModel::Decode(reader, dischargingEnabledUntil);
         }
@@ -17484,6 +20873,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kChargingTargetSchedules),
+          &detail::DecodeStructField<DecodableType, &DecodableType::chargingTargetSchedules> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -17496,7 +20891,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kChargingTargetSchedules))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kChargingTargetSchedules))
         {
             err = DataModel::Decode(reader, chargingTargetSchedules);
         }
@@ -17629,6 +21028,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSessionID), &detail::DecodeStructField<DecodableType, &DecodableType::sessionID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -17641,7 +21045,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSessionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSessionID))
         {
             err = DataModel::Decode(reader, sessionID);
         }
@@ -17668,6 +21076,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSessionID), &detail::DecodeStructField<DecodableType, &DecodableType::sessionID> },
+        { to_underlying(Fields::kState), &detail::DecodeStructField<DecodableType, &DecodableType::state> },
+        { to_underlying(Fields::kSessionDuration), &detail::DecodeStructField<DecodableType, &DecodableType::sessionDuration> },
+        { to_underlying(Fields::kSessionEnergyCharged),
+          &detail::DecodeStructField<DecodableType, &DecodableType::sessionEnergyCharged> },
+        { to_underlying(Fields::kSessionEnergyDischarged),
+          &detail::DecodeStructField<DecodableType, &DecodableType::sessionEnergyDischarged> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -17680,7 +21099,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSessionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSessionID))
         {
             err = DataModel::Decode(reader, sessionID);
         }
@@ -17722,6 +21145,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSessionID), &detail::DecodeStructField<DecodableType, &DecodableType::sessionID> },
+        { to_underlying(Fields::kState), &detail::DecodeStructField<DecodableType, &DecodableType::state> },
+        { to_underlying(Fields::kMaximumCurrent), &detail::DecodeStructField<DecodableType, &DecodableType::maximumCurrent> },
+        { to_underlying(Fields::kMaximumDischargeCurrent),
+          &detail::DecodeStructField<DecodableType, &DecodableType::maximumDischargeCurrent> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -17734,7 +21166,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSessionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSessionID))
         {
             err = DataModel::Decode(reader, sessionID);
         }
@@ -17773,6 +21209,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSessionID), &detail::DecodeStructField<DecodableType, &DecodableType::sessionID> },
+        { to_underlying(Fields::kState), &detail::DecodeStructField<DecodableType, &DecodableType::state> },
+        { to_underlying(Fields::kReason), &detail::DecodeStructField<DecodableType, &DecodableType::reason> },
+        { to_underlying(Fields::kEnergyTransferred), &detail::DecodeStructField<DecodableType, &DecodableType::energyTransferred> },
+        { to_underlying(Fields::kEnergyDischarged), &detail::DecodeStructField<DecodableType, &DecodableType::energyDischarged> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -17785,7 +21230,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSessionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSessionID))
         {
             err = DataModel::Decode(reader, sessionID);
         }
@@ -17827,6 +21276,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSessionID), &detail::DecodeStructField<DecodableType, &DecodableType::sessionID> },
+        { to_underlying(Fields::kState), &detail::DecodeStructField<DecodableType, &DecodableType::state> },
+        { to_underlying(Fields::kFaultStatePreviousState),
+          &detail::DecodeStructField<DecodableType, &DecodableType::faultStatePreviousState> },
+        { to_underlying(Fields::kFaultStateCurrentState),
+          &detail::DecodeStructField<DecodableType, &DecodableType::faultStateCurrentState> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -17839,7 +21298,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSessionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSessionID))
         {
             err = DataModel::Decode(reader, sessionID);
         }
@@ -17874,6 +21337,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kUid), &detail::DecodeStructField<DecodableType, &DecodableType::uid> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -17886,7 +21354,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kUid))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kUid))
         {
             err = DataModel::Decode(reader, uid);
         }
@@ -17915,6 +21387,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStep), &detail::DecodeStructField<DecodableType, &DecodableType::step> },
+        { to_underlying(Fields::kLabel), &detail::DecodeStructField<DecodableType, &DecodableType::label> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -17927,7 +21405,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStep))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStep))
         {
             err = DataModel::Decode(reader, step);
         }
@@ -18028,6 +21510,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNewMode), &detail::DecodeStructField<DecodableType, &DecodableType::newMode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -18040,7 +21527,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNewMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNewMode))
         {
             err = DataModel::Decode(reader, newMode);
         }
@@ -18063,6 +21554,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kStatusText), &detail::DecodeStructField<DecodableType, &DecodableType::statusText> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -18075,7 +21572,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -18135,6 +21636,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNewMode), &detail::DecodeStructField<DecodableType, &DecodableType::newMode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -18147,7 +21653,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNewMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNewMode))
         {
             err = DataModel::Decode(reader, newMode);
         }
@@ -18170,6 +21680,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kStatusText), &detail::DecodeStructField<DecodableType, &DecodableType::statusText> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -18182,7 +21698,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -18242,6 +21762,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNewMode), &detail::DecodeStructField<DecodableType, &DecodableType::newMode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -18254,7 +21779,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNewMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNewMode))
         {
             err = DataModel::Decode(reader, newMode);
         }
@@ -18277,6 +21806,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kStatusText), &detail::DecodeStructField<DecodableType, &DecodableType::statusText> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -18289,7 +21824,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -18349,6 +21888,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCredentialType), &detail::DecodeStructField<DecodableType, &DecodableType::credentialType> },
+        { to_underlying(Fields::kCredentialIndex), &detail::DecodeStructField<DecodableType, &DecodableType::credentialIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -18361,7 +21906,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCredentialType))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCredentialType))
         {
             err = DataModel::Decode(reader, credentialType);
         }
@@ -18391,6 +21940,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPINCode), &detail::DecodeStructField<DecodableType, &DecodableType::PINCode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -18403,7 +21957,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPINCode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPINCode))
         {
             err = DataModel::Decode(reader, PINCode);
         }
@@ -18425,6 +21983,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPINCode), &detail::DecodeStructField<DecodableType, &DecodableType::PINCode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -18437,7 +22000,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPINCode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPINCode))
         {
             err = DataModel::Decode(reader, PINCode);
         }
@@ -18460,6 +22027,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kTimeout), &detail::DecodeStructField<DecodableType, &DecodableType::timeout> },
+        { to_underlying(Fields::kPINCode), &detail::DecodeStructField<DecodableType, &DecodableType::PINCode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -18472,7 +22045,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kTimeout))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kTimeout))
         {
             err = DataModel::Decode(reader, timeout);
         }
@@ -18504,6 +22081,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kWeekDayIndex), &detail::DecodeStructField<DecodableType, &DecodableType::weekDayIndex> },
+        { to_underlying(Fields::kUserIndex), &detail::DecodeStructField<DecodableType, &DecodableType::userIndex> },
+        { to_underlying(Fields::kDaysMask), &detail::DecodeStructField<DecodableType, &DecodableType::daysMask> },
+        { to_underlying(Fields::kStartHour), &detail::DecodeStructField<DecodableType, &DecodableType::startHour> },
+        { to_underlying(Fields::kStartMinute), &detail::DecodeStructField<DecodableType, &DecodableType::startMinute> },
+        { to_underlying(Fields::kEndHour), &detail::DecodeStructField<DecodableType, &DecodableType::endHour> },
+        { to_underlying(Fields::kEndMinute), &detail::DecodeStructField<DecodableType, &DecodableType::endMinute> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -18516,7 +22104,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kWeekDayIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kWeekDayIndex))
         {
             err = DataModel::Decode(reader, weekDayIndex);
         }
@@ -18563,6 +22155,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kWeekDayIndex), &detail::DecodeStructField<DecodableType, &DecodableType::weekDayIndex> },
+        { to_underlying(Fields::kUserIndex), &detail::DecodeStructField<DecodableType, &DecodableType::userIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -18575,7 +22173,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kWeekDayIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kWeekDayIndex))
         {
             err = DataModel::Decode(reader, weekDayIndex);
         }
@@ -18608,6 +22210,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kWeekDayIndex), &detail::DecodeStructField<DecodableType, &DecodableType::weekDayIndex> },
+        { to_underlying(Fields::kUserIndex), &detail::DecodeStructField<DecodableType, &DecodableType::userIndex> },
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kDaysMask), &detail::DecodeStructField<DecodableType, &DecodableType::daysMask> },
+        { to_underlying(Fields::kStartHour), &detail::DecodeStructField<DecodableType, &DecodableType::startHour> },
+        { to_underlying(Fields::kStartMinute), &detail::DecodeStructField<DecodableType, &DecodableType::startMinute> },
+        { to_underlying(Fields::kEndHour), &detail::DecodeStructField<DecodableType, &DecodableType::endHour> },
+        { to_underlying(Fields::kEndMinute), &detail::DecodeStructField<DecodableType, &DecodableType::endMinute> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -18620,7 +22234,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kWeekDayIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kWeekDayIndex))
         {
             err = DataModel::Decode(reader, weekDayIndex);
         }
@@ -18671,6 +22289,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kWeekDayIndex), &detail::DecodeStructField<DecodableType, &DecodableType::weekDayIndex> },
+        { to_underlying(Fields::kUserIndex), &detail::DecodeStructField<DecodableType, &DecodableType::userIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -18683,7 +22307,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kWeekDayIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kWeekDayIndex))
         {
             err = DataModel::Decode(reader, weekDayIndex);
         }
@@ -18712,6 +22340,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kYearDayIndex), &detail::DecodeStructField<DecodableType, &DecodableType::yearDayIndex> },
+        { to_underlying(Fields::kUserIndex), &detail::DecodeStructField<DecodableType, &DecodableType::userIndex> },
+        { to_underlying(Fields::kLocalStartTime), &detail::DecodeStructField<DecodableType, &DecodableType::localStartTime> },
+        { to_underlying(Fields::kLocalEndTime), &detail::DecodeStructField<DecodableType, &DecodableType::localEndTime> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -18724,7 +22360,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kYearDayIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kYearDayIndex))
         {
             err = DataModel::Decode(reader, yearDayIndex);
         }
@@ -18759,6 +22399,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kYearDayIndex), &detail::DecodeStructField<DecodableType, &DecodableType::yearDayIndex> },
+        { to_underlying(Fields::kUserIndex), &detail::DecodeStructField<DecodableType, &DecodableType::userIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -18771,7 +22417,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kYearDayIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kYearDayIndex))
         {
             err = DataModel::Decode(reader, yearDayIndex);
         }
@@ -18801,6 +22451,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kYearDayIndex), &detail::DecodeStructField<DecodableType, &DecodableType::yearDayIndex> },
+        { to_underlying(Fields::kUserIndex), &detail::DecodeStructField<DecodableType, &DecodableType::userIndex> },
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kLocalStartTime), &detail::DecodeStructField<DecodableType, &DecodableType::localStartTime> },
+        { to_underlying(Fields::kLocalEndTime), &detail::DecodeStructField<DecodableType, &DecodableType::localEndTime> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -18813,7 +22472,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kYearDayIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kYearDayIndex))
         {
             err = DataModel::Decode(reader, yearDayIndex);
         }
@@ -18852,6 +22515,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kYearDayIndex), &detail::DecodeStructField<DecodableType, &DecodableType::yearDayIndex> },
+        { to_underlying(Fields::kUserIndex), &detail::DecodeStructField<DecodableType, &DecodableType::userIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -18864,7 +22533,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kYearDayIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kYearDayIndex))
         {
             err = DataModel::Decode(reader, yearDayIndex);
         }
@@ -18893,6 +22566,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kHolidayIndex), &detail::DecodeStructField<DecodableType, &DecodableType::holidayIndex> },
+        { to_underlying(Fields::kLocalStartTime), &detail::DecodeStructField<DecodableType, &DecodableType::localStartTime> },
+        { to_underlying(Fields::kLocalEndTime), &detail::DecodeStructField<DecodableType, &DecodableType::localEndTime> },
+        { to_underlying(Fields::kOperatingMode), &detail::DecodeStructField<DecodableType, &DecodableType::operatingMode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -18905,7 +22586,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kHolidayIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kHolidayIndex))
         {
             err = DataModel::Decode(reader, holidayIndex);
         }
@@ -18939,6 +22624,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kHolidayIndex), &detail::DecodeStructField<DecodableType, &DecodableType::holidayIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -18951,7 +22641,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kHolidayIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kHolidayIndex))
         {
             err = DataModel::Decode(reader, holidayIndex);
         }
@@ -18977,6 +22671,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kHolidayIndex), &detail::DecodeStructField<DecodableType, &DecodableType::holidayIndex> },
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kLocalStartTime), &detail::DecodeStructField<DecodableType, &DecodableType::localStartTime> },
+        { to_underlying(Fields::kLocalEndTime), &detail::DecodeStructField<DecodableType, &DecodableType::localEndTime> },
+        { to_underlying(Fields::kOperatingMode), &detail::DecodeStructField<DecodableType, &DecodableType::operatingMode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -18989,7 +22692,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kHolidayIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kHolidayIndex))
         {
             err = DataModel::Decode(reader, holidayIndex);
         }
@@ -19027,6 +22734,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kHolidayIndex), &detail::DecodeStructField<DecodableType, &DecodableType::holidayIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -19039,7 +22751,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kHolidayIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kHolidayIndex))
         {
             err = DataModel::Decode(reader, holidayIndex);
         }
@@ -19067,6 +22783,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kOperationType), &detail::DecodeStructField<DecodableType, &DecodableType::operationType> },
+        { to_underlying(Fields::kUserIndex), &detail::DecodeStructField<DecodableType, &DecodableType::userIndex> },
+        { to_underlying(Fields::kUserName), &detail::DecodeStructField<DecodableType, &DecodableType::userName> },
+        { to_underlying(Fields::kUserUniqueID), &detail::DecodeStructField<DecodableType, &DecodableType::userUniqueID> },
+        { to_underlying(Fields::kUserStatus), &detail::DecodeStructField<DecodableType, &DecodableType::userStatus> },
+        { to_underlying(Fields::kUserType), &detail::DecodeStructField<DecodableType, &DecodableType::userType> },
+        { to_underlying(Fields::kCredentialRule), &detail::DecodeStructField<DecodableType, &DecodableType::credentialRule> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -19079,7 +22806,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kOperationType))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kOperationType))
         {
             err = DataModel::Decode(reader, operationType);
         }
@@ -19125,6 +22856,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kUserIndex), &detail::DecodeStructField<DecodableType, &DecodableType::userIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -19137,7 +22873,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kUserIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kUserIndex))
         {
             err = DataModel::Decode(reader, userIndex);
         }
@@ -19168,6 +22908,22 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kUserIndex), &detail::DecodeStructField<DecodableType, &DecodableType::userIndex> },
+        { to_underlying(Fields::kUserName), &detail::DecodeStructField<DecodableType, &DecodableType::userName> },
+        { to_underlying(Fields::kUserUniqueID), &detail::DecodeStructField<DecodableType, &DecodableType::userUniqueID> },
+        { to_underlying(Fields::kUserStatus), &detail::DecodeStructField<DecodableType, &DecodableType::userStatus> },
+        { to_underlying(Fields::kUserType), &detail::DecodeStructField<DecodableType, &DecodableType::userType> },
+        { to_underlying(Fields::kCredentialRule), &detail::DecodeStructField<DecodableType, &DecodableType::credentialRule> },
+        { to_underlying(Fields::kCredentials), &detail::DecodeStructField<DecodableType, &DecodableType::credentials> },
+        { to_underlying(Fields::kCreatorFabricIndex),
+          &detail::DecodeStructField<DecodableType, &DecodableType::creatorFabricIndex> },
+        { to_underlying(Fields::kLastModifiedFabricIndex),
+          &detail::DecodeStructField<DecodableType, &DecodableType::lastModifiedFabricIndex> },
+        { to_underlying(Fields::kNextUserIndex), &detail::DecodeStructField<DecodableType, &DecodableType::nextUserIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -19180,7 +22936,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kUserIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kUserIndex))
         {
             err = DataModel::Decode(reader, userIndex);
         }
@@ -19238,6 +22998,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kUserIndex), &detail::DecodeStructField<DecodableType, &DecodableType::userIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -19250,7 +23015,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kUserIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kUserIndex))
         {
             err = DataModel::Decode(reader, userIndex);
         }
@@ -19277,6 +23046,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kOperationType), &detail::DecodeStructField<DecodableType, &DecodableType::operationType> },
+        { to_underlying(Fields::kCredential), &detail::DecodeStructField<DecodableType, &DecodableType::credential> },
+        { to_underlying(Fields::kCredentialData), &detail::DecodeStructField<DecodableType, &DecodableType::credentialData> },
+        { to_underlying(Fields::kUserIndex), &detail::DecodeStructField<DecodableType, &DecodableType::userIndex> },
+        { to_underlying(Fields::kUserStatus), &detail::DecodeStructField<DecodableType, &DecodableType::userStatus> },
+        { to_underlying(Fields::kUserType), &detail::DecodeStructField<DecodableType, &DecodableType::userType> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -19289,7 +23068,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kOperationType))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kOperationType))
         {
             err = DataModel::Decode(reader, operationType);
         }
@@ -19333,6 +23116,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kUserIndex), &detail::DecodeStructField<DecodableType, &DecodableType::userIndex> },
+        { to_underlying(Fields::kNextCredentialIndex),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nextCredentialIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -19345,7 +23136,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -19375,6 +23170,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCredential), &detail::DecodeStructField<DecodableType, &DecodableType::credential> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -19387,7 +23187,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCredential))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCredential))
         {
             err = DataModel::Decode(reader, credential);
         }
@@ -19414,6 +23218,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCredentialExists), &detail::DecodeStructField<DecodableType, &DecodableType::credentialExists> },
+        { to_underlying(Fields::kUserIndex), &detail::DecodeStructField<DecodableType, &DecodableType::userIndex> },
+        { to_underlying(Fields::kCreatorFabricIndex),
+          &detail::DecodeStructField<DecodableType, &DecodableType::creatorFabricIndex> },
+        { to_underlying(Fields::kLastModifiedFabricIndex),
+          &detail::DecodeStructField<DecodableType, &DecodableType::lastModifiedFabricIndex> },
+        { to_underlying(Fields::kNextCredentialIndex),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nextCredentialIndex> },
+        { to_underlying(Fields::kCredentialData), &detail::DecodeStructField<DecodableType, &DecodableType::credentialData> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -19426,7 +23243,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCredentialExists))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCredentialExists))
         {
             err = DataModel::Decode(reader, credentialExists);
         }
@@ -19468,6 +23289,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCredential), &detail::DecodeStructField<DecodableType, &DecodableType::credential> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -19480,7 +23306,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCredential))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCredential))
         {
             err = DataModel::Decode(reader, credential);
         }
@@ -19502,6 +23332,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPINCode), &detail::DecodeStructField<DecodableType, &DecodableType::PINCode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -19514,7 +23349,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPINCode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPINCode))
         {
             err = DataModel::Decode(reader, PINCode);
         }
@@ -19539,6 +23378,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSigningKey), &detail::DecodeStructField<DecodableType, &DecodableType::signingKey> },
+        { to_underlying(Fields::kVerificationKey), &detail::DecodeStructField<DecodableType, &DecodableType::verificationKey> },
+        { to_underlying(Fields::kGroupIdentifier), &detail::DecodeStructField<DecodableType, &DecodableType::groupIdentifier> },
+        { to_underlying(Fields::kGroupResolvingKey), &detail::DecodeStructField<DecodableType, &DecodableType::groupResolvingKey> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -19551,7 +23398,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSigningKey))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSigningKey))
         {
             err = DataModel::Decode(reader, signingKey);
         }
@@ -19720,6 +23571,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAlarmCode), &detail::DecodeStructField<DecodableType, &DecodableType::alarmCode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -19732,7 +23588,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAlarmCode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAlarmCode))
         {
             err = DataModel::Decode(reader, alarmCode);
         }
@@ -19755,6 +23615,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kDoorState), &detail::DecodeStructField<DecodableType, &DecodableType::doorState> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -19767,7 +23632,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kDoorState))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kDoorState))
         {
             err = DataModel::Decode(reader, doorState);
         }
@@ -19795,6 +23664,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kLockOperationType), &detail::DecodeStructField<DecodableType, &DecodableType::lockOperationType> },
+        { to_underlying(Fields::kOperationSource), &detail::DecodeStructField<DecodableType, &DecodableType::operationSource> },
+        { to_underlying(Fields::kUserIndex), &detail::DecodeStructField<DecodableType, &DecodableType::userIndex> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+        { to_underlying(Fields::kSourceNode), &detail::DecodeStructField<DecodableType, &DecodableType::sourceNode> },
+        { to_underlying(Fields::kCredentials), &detail::DecodeStructField<DecodableType, &DecodableType::credentials> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -19807,7 +23686,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kLockOperationType))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kLockOperationType))
         {
             err = DataModel::Decode(reader, lockOperationType);
         }
@@ -19856,6 +23739,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kLockOperationType), &detail::DecodeStructField<DecodableType, &DecodableType::lockOperationType> },
+        { to_underlying(Fields::kOperationSource), &detail::DecodeStructField<DecodableType, &DecodableType::operationSource> },
+        { to_underlying(Fields::kOperationError), &detail::DecodeStructField<DecodableType, &DecodableType::operationError> },
+        { to_underlying(Fields::kUserIndex), &detail::DecodeStructField<DecodableType, &DecodableType::userIndex> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+        { to_underlying(Fields::kSourceNode), &detail::DecodeStructField<DecodableType, &DecodableType::sourceNode> },
+        { to_underlying(Fields::kCredentials), &detail::DecodeStructField<DecodableType, &DecodableType::credentials> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -19868,7 +23762,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kLockOperationType))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kLockOperationType))
         {
             err = DataModel::Decode(reader, lockOperationType);
         }
@@ -19921,6 +23819,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kLockDataType), &detail::DecodeStructField<DecodableType, &DecodableType::lockDataType> },
+        { to_underlying(Fields::kDataOperationType), &detail::DecodeStructField<DecodableType, &DecodableType::dataOperationType> },
+        { to_underlying(Fields::kOperationSource), &detail::DecodeStructField<DecodableType, &DecodableType::operationSource> },
+        { to_underlying(Fields::kUserIndex), &detail::DecodeStructField<DecodableType, &DecodableType::userIndex> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+        { to_underlying(Fields::kSourceNode), &detail::DecodeStructField<DecodableType, &DecodableType::sourceNode> },
+        { to_underlying(Fields::kDataIndex), &detail::DecodeStructField<DecodableType, &DecodableType::dataIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -19933,7 +23842,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kLockDataType))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kLockDataType))
         {
             err = DataModel::Decode(reader, lockDataType);
         }
@@ -20045,6 +23958,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kLiftValue), &detail::DecodeStructField<DecodableType, &DecodableType::liftValue> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -20057,7 +23975,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kLiftValue))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kLiftValue))
         {
             err = DataModel::Decode(reader, liftValue);
         }
@@ -20079,6 +24001,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kLiftPercent100thsValue),
+          &detail::DecodeStructField<DecodableType, &DecodableType::liftPercent100thsValue> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -20091,7 +24019,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kLiftPercent100thsValue))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kLiftPercent100thsValue))
         {
             err = DataModel::Decode(reader, liftPercent100thsValue);
         }
@@ -20113,6 +24045,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kTiltValue), &detail::DecodeStructField<DecodableType, &DecodableType::tiltValue> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -20125,7 +24062,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kTiltValue))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kTiltValue))
         {
             err = DataModel::Decode(reader, tiltValue);
         }
@@ -20147,6 +24088,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kTiltPercent100thsValue),
+          &detail::DecodeStructField<DecodableType, &DecodableType::tiltPercent100thsValue> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -20159,7 +24106,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kTiltPercent100thsValue))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kTiltPercent100thsValue))
         {
             err = DataModel::Decode(reader, tiltPercent100thsValue);
         }
@@ -20255,6 +24206,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kLandmarkTag), &detail::DecodeStructField<DecodableType, &DecodableType::landmarkTag> },
+        { to_underlying(Fields::kRelativePositionTag),
+          &detail::DecodeStructField<DecodableType, &DecodableType::relativePositionTag> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -20267,7 +24225,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kLandmarkTag))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kLandmarkTag))
         {
             err = DataModel::Decode(reader, landmarkTag);
         }
@@ -20296,6 +24258,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kLocationInfo), &detail::DecodeStructField<DecodableType, &DecodableType::locationInfo> },
+        { to_underlying(Fields::kLandmarkInfo), &detail::DecodeStructField<DecodableType, &DecodableType::landmarkInfo> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -20308,7 +24276,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kLocationInfo))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kLocationInfo))
         {
             err = DataModel::Decode(reader, locationInfo);
         }
@@ -20338,6 +24310,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAreaID), &detail::DecodeStructField<DecodableType, &DecodableType::areaID> },
+        { to_underlying(Fields::kMapID), &detail::DecodeStructField<DecodableType, &DecodableType::mapID> },
+        { to_underlying(Fields::kAreaInfo), &detail::DecodeStructField<DecodableType, &DecodableType::areaInfo> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -20350,7 +24329,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAreaID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAreaID))
         {
             err = DataModel::Decode(reader, areaID);
         }
@@ -20383,6 +24366,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMapID), &detail::DecodeStructField<DecodableType, &DecodableType::mapID> },
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -20395,7 +24384,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMapID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMapID))
         {
             err = DataModel::Decode(reader, mapID);
         }
@@ -20426,6 +24419,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAreaID), &detail::DecodeStructField<DecodableType, &DecodableType::areaID> },
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kTotalOperationalTime),
+          &detail::DecodeStructField<DecodableType, &DecodableType::totalOperationalTime> },
+        { to_underlying(Fields::kEstimatedTime), &detail::DecodeStructField<DecodableType, &DecodableType::estimatedTime> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -20438,7 +24440,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAreaID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAreaID))
         {
             err = DataModel::Decode(reader, areaID);
         }
@@ -20476,6 +24482,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNewAreas), &detail::DecodeStructField<DecodableType, &DecodableType::newAreas> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -20488,7 +24499,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNewAreas))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNewAreas))
         {
             err = DataModel::Decode(reader, newAreas);
         }
@@ -20511,6 +24526,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kStatusText), &detail::DecodeStructField<DecodableType, &DecodableType::statusText> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -20523,7 +24544,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -20549,6 +24574,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSkippedArea), &detail::DecodeStructField<DecodableType, &DecodableType::skippedArea> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -20561,7 +24591,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSkippedArea))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSkippedArea))
         {
             err = DataModel::Decode(reader, skippedArea);
         }
@@ -20584,6 +24618,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kStatusText), &detail::DecodeStructField<DecodableType, &DecodableType::statusText> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -20596,7 +24636,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -21100,6 +25144,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kDayOfWeek), &detail::DecodeStructField<DecodableType, &DecodableType::dayOfWeek> },
+        { to_underlying(Fields::kTransitionTime), &detail::DecodeStructField<DecodableType, &DecodableType::transitionTime> },
+        { to_underlying(Fields::kPresetHandle), &detail::DecodeStructField<DecodableType, &DecodableType::presetHandle> },
+        { to_underlying(Fields::kSystemMode), &detail::DecodeStructField<DecodableType, &DecodableType::systemMode> },
+        { to_underlying(Fields::kCoolingSetpoint), &detail::DecodeStructField<DecodableType, &DecodableType::coolingSetpoint> },
+        { to_underlying(Fields::kHeatingSetpoint), &detail::DecodeStructField<DecodableType, &DecodableType::heatingSetpoint> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -21112,7 +25166,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kDayOfWeek))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kDayOfWeek))
         {
             err = DataModel::Decode(reader, dayOfWeek);
         }
@@ -21161,6 +25219,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kScheduleHandle), &detail::DecodeStructField<DecodableType, &DecodableType::scheduleHandle> },
+        { to_underlying(Fields::kSystemMode), &detail::DecodeStructField<DecodableType, &DecodableType::systemMode> },
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+        { to_underlying(Fields::kPresetHandle), &detail::DecodeStructField<DecodableType, &DecodableType::presetHandle> },
+        { to_underlying(Fields::kTransitions), &detail::DecodeStructField<DecodableType, &DecodableType::transitions> },
+        { to_underlying(Fields::kBuiltIn), &detail::DecodeStructField<DecodableType, &DecodableType::builtIn> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -21173,7 +25241,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kScheduleHandle))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kScheduleHandle))
         {
             err = DataModel::Decode(reader, scheduleHandle);
         }
@@ -21222,6 +25294,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPresetHandle), &detail::DecodeStructField<DecodableType, &DecodableType::presetHandle> },
+        { to_underlying(Fields::kPresetScenario), &detail::DecodeStructField<DecodableType, &DecodableType::presetScenario> },
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+        { to_underlying(Fields::kCoolingSetpoint), &detail::DecodeStructField<DecodableType, &DecodableType::coolingSetpoint> },
+        { to_underlying(Fields::kHeatingSetpoint), &detail::DecodeStructField<DecodableType, &DecodableType::heatingSetpoint> },
+        { to_underlying(Fields::kBuiltIn), &detail::DecodeStructField<DecodableType, &DecodableType::builtIn> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -21234,7 +25316,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPresetHandle))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPresetHandle))
         {
             err = DataModel::Decode(reader, presetHandle);
         }
@@ -21280,6 +25366,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPresetScenario), &detail::DecodeStructField<DecodableType, &DecodableType::presetScenario> },
+        { to_underlying(Fields::kNumberOfPresets), &detail::DecodeStructField<DecodableType, &DecodableType::numberOfPresets> },
+        { to_underlying(Fields::kPresetTypeFeatures),
+          &detail::DecodeStructField<DecodableType, &DecodableType::presetTypeFeatures> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -21292,7 +25386,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPresetScenario))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPresetScenario))
         {
             err = DataModel::Decode(reader, presetScenario);
         }
@@ -21326,6 +25424,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSystemMode), &detail::DecodeStructField<DecodableType, &DecodableType::systemMode> },
+        { to_underlying(Fields::kNumberOfSchedules), &detail::DecodeStructField<DecodableType, &DecodableType::numberOfSchedules> },
+        { to_underlying(Fields::kScheduleTypeFeatures),
+          &detail::DecodeStructField<DecodableType, &DecodableType::scheduleTypeFeatures> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -21338,7 +25444,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSystemMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSystemMode))
         {
             err = DataModel::Decode(reader, systemMode);
         }
@@ -21372,6 +25482,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kTransitionTime), &detail::DecodeStructField<DecodableType, &DecodableType::transitionTime> },
+        { to_underlying(Fields::kHeatSetpoint), &detail::DecodeStructField<DecodableType, &DecodableType::heatSetpoint> },
+        { to_underlying(Fields::kCoolSetpoint), &detail::DecodeStructField<DecodableType, &DecodableType::coolSetpoint> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -21384,7 +25501,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kTransitionTime))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kTransitionTime))
         {
             err = DataModel::Decode(reader, transitionTime);
         }
@@ -21419,6 +25540,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMode), &detail::DecodeStructField<DecodableType, &DecodableType::mode> },
+        { to_underlying(Fields::kAmount), &detail::DecodeStructField<DecodableType, &DecodableType::amount> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -21431,7 +25558,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMode))
         {
             err = DataModel::Decode(reader, mode);
         }
@@ -21460,6 +25591,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNumberOfTransitionsForSequence),
+          &detail::DecodeStructField<DecodableType, &DecodableType::numberOfTransitionsForSequence> },
+        { to_underlying(Fields::kDayOfWeekForSequence),
+          &detail::DecodeStructField<DecodableType, &DecodableType::dayOfWeekForSequence> },
+        { to_underlying(Fields::kModeForSequence), &detail::DecodeStructField<DecodableType, &DecodableType::modeForSequence> },
+        { to_underlying(Fields::kTransitions), &detail::DecodeStructField<DecodableType, &DecodableType::transitions> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -21472,7 +25613,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNumberOfTransitionsForSequence))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNumberOfTransitionsForSequence))
         {
             err = DataModel::Decode(reader, numberOfTransitionsForSequence);
         }
@@ -21509,6 +25654,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNumberOfTransitionsForSequence),
+          &detail::DecodeStructField<DecodableType, &DecodableType::numberOfTransitionsForSequence> },
+        { to_underlying(Fields::kDayOfWeekForSequence),
+          &detail::DecodeStructField<DecodableType, &DecodableType::dayOfWeekForSequence> },
+        { to_underlying(Fields::kModeForSequence), &detail::DecodeStructField<DecodableType, &DecodableType::modeForSequence> },
+        { to_underlying(Fields::kTransitions), &detail::DecodeStructField<DecodableType, &DecodableType::transitions> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -21521,7 +25676,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNumberOfTransitionsForSequence))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNumberOfTransitionsForSequence))
         {
             err = DataModel::Decode(reader, numberOfTransitionsForSequence);
         }
@@ -21556,6 +25715,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kDaysToReturn), &detail::DecodeStructField<DecodableType, &DecodableType::daysToReturn> },
+        { to_underlying(Fields::kModeToReturn), &detail::DecodeStructField<DecodableType, &DecodableType::modeToReturn> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -21568,7 +25733,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kDaysToReturn))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kDaysToReturn))
         {
             err = DataModel::Decode(reader, daysToReturn);
         }
@@ -21614,6 +25783,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kScheduleHandle), &detail::DecodeStructField<DecodableType, &DecodableType::scheduleHandle> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -21626,7 +25800,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kScheduleHandle))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kScheduleHandle))
         {
             err = DataModel::Decode(reader, scheduleHandle);
         }
@@ -21648,6 +25826,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPresetHandle), &detail::DecodeStructField<DecodableType, &DecodableType::presetHandle> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -21660,7 +25843,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPresetHandle))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPresetHandle))
         {
             err = DataModel::Decode(reader, presetHandle);
         }
@@ -21684,6 +25871,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatusCode), &detail::DecodeStructField<DecodableType, &DecodableType::statusCode> },
+        { to_underlying(Fields::kAttributeStatus), &detail::DecodeStructField<DecodableType, &DecodableType::attributeStatus> },
+        { to_underlying(Fields::kTimeout), &detail::DecodeStructField<DecodableType, &DecodableType::timeout> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -21696,7 +25890,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatusCode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatusCode))
         {
             err = DataModel::Decode(reader, statusCode);
         }
@@ -21728,6 +25926,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kRequestType), &detail::DecodeStructField<DecodableType, &DecodableType::requestType> },
+        { to_underlying(Fields::kAttributeRequests), &detail::DecodeStructField<DecodableType, &DecodableType::attributeRequests> },
+        { to_underlying(Fields::kTimeout), &detail::DecodeStructField<DecodableType, &DecodableType::timeout> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -21740,7 +25945,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kRequestType))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kRequestType))
         {
             err = DataModel::Decode(reader, requestType);
         }
@@ -21921,6 +26130,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kDirection), &detail::DecodeStructField<DecodableType, &DecodableType::direction> },
+        { to_underlying(Fields::kWrap), &detail::DecodeStructField<DecodableType, &DecodableType::wrap> },
+        { to_underlying(Fields::kLowestOff), &detail::DecodeStructField<DecodableType, &DecodableType::lowestOff> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -21933,7 +26149,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kDirection))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kDirection))
         {
             err = DataModel::Decode(reader, direction);
         }
@@ -22054,6 +26274,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kHue), &detail::DecodeStructField<DecodableType, &DecodableType::hue> },
+        { to_underlying(Fields::kDirection), &detail::DecodeStructField<DecodableType, &DecodableType::direction> },
+        { to_underlying(Fields::kTransitionTime), &detail::DecodeStructField<DecodableType, &DecodableType::transitionTime> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -22066,7 +26295,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kHue))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kHue))
         {
             err = DataModel::Decode(reader, hue);
         }
@@ -22107,6 +26340,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMoveMode), &detail::DecodeStructField<DecodableType, &DecodableType::moveMode> },
+        { to_underlying(Fields::kRate), &detail::DecodeStructField<DecodableType, &DecodableType::rate> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -22119,7 +26360,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMoveMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMoveMode))
         {
             err = DataModel::Decode(reader, moveMode);
         }
@@ -22157,6 +26402,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStepMode), &detail::DecodeStructField<DecodableType, &DecodableType::stepMode> },
+        { to_underlying(Fields::kStepSize), &detail::DecodeStructField<DecodableType, &DecodableType::stepSize> },
+        { to_underlying(Fields::kTransitionTime), &detail::DecodeStructField<DecodableType, &DecodableType::transitionTime> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -22169,7 +26423,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStepMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStepMode))
         {
             err = DataModel::Decode(reader, stepMode);
         }
@@ -22210,6 +26468,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSaturation), &detail::DecodeStructField<DecodableType, &DecodableType::saturation> },
+        { to_underlying(Fields::kTransitionTime), &detail::DecodeStructField<DecodableType, &DecodableType::transitionTime> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -22222,7 +26488,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSaturation))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSaturation))
         {
             err = DataModel::Decode(reader, saturation);
         }
@@ -22259,6 +26529,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMoveMode), &detail::DecodeStructField<DecodableType, &DecodableType::moveMode> },
+        { to_underlying(Fields::kRate), &detail::DecodeStructField<DecodableType, &DecodableType::rate> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -22271,7 +26549,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMoveMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMoveMode))
         {
             err = DataModel::Decode(reader, moveMode);
         }
@@ -22309,6 +26591,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStepMode), &detail::DecodeStructField<DecodableType, &DecodableType::stepMode> },
+        { to_underlying(Fields::kStepSize), &detail::DecodeStructField<DecodableType, &DecodableType::stepSize> },
+        { to_underlying(Fields::kTransitionTime), &detail::DecodeStructField<DecodableType, &DecodableType::transitionTime> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -22321,7 +26612,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStepMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStepMode))
         {
             err = DataModel::Decode(reader, stepMode);
         }
@@ -22363,6 +26658,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kHue), &detail::DecodeStructField<DecodableType, &DecodableType::hue> },
+        { to_underlying(Fields::kSaturation), &detail::DecodeStructField<DecodableType, &DecodableType::saturation> },
+        { to_underlying(Fields::kTransitionTime), &detail::DecodeStructField<DecodableType, &DecodableType::transitionTime> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -22375,7 +26679,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kHue))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kHue))
         {
             err = DataModel::Decode(reader, hue);
         }
@@ -22417,6 +26725,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kColorX), &detail::DecodeStructField<DecodableType, &DecodableType::colorX> },
+        { to_underlying(Fields::kColorY), &detail::DecodeStructField<DecodableType, &DecodableType::colorY> },
+        { to_underlying(Fields::kTransitionTime), &detail::DecodeStructField<DecodableType, &DecodableType::transitionTime> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -22429,7 +26746,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kColorX))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kColorX))
         {
             err = DataModel::Decode(reader, colorX);
         }
@@ -22470,6 +26791,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kRateX), &detail::DecodeStructField<DecodableType, &DecodableType::rateX> },
+        { to_underlying(Fields::kRateY), &detail::DecodeStructField<DecodableType, &DecodableType::rateY> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -22482,7 +26811,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kRateX))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kRateX))
         {
             err = DataModel::Decode(reader, rateX);
         }
@@ -22520,6 +26853,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStepX), &detail::DecodeStructField<DecodableType, &DecodableType::stepX> },
+        { to_underlying(Fields::kStepY), &detail::DecodeStructField<DecodableType, &DecodableType::stepY> },
+        { to_underlying(Fields::kTransitionTime), &detail::DecodeStructField<DecodableType, &DecodableType::transitionTime> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -22532,7 +26874,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStepX))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStepX))
         {
             err = DataModel::Decode(reader, stepX);
         }
@@ -22573,6 +26919,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kColorTemperatureMireds),
+          &detail::DecodeStructField<DecodableType, &DecodableType::colorTemperatureMireds> },
+        { to_underlying(Fields::kTransitionTime), &detail::DecodeStructField<DecodableType, &DecodableType::transitionTime> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -22585,7 +26940,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kColorTemperatureMireds))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kColorTemperatureMireds))
         {
             err = DataModel::Decode(reader, colorTemperatureMireds);
         }
@@ -22623,6 +26982,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kEnhancedHue), &detail::DecodeStructField<DecodableType, &DecodableType::enhancedHue> },
+        { to_underlying(Fields::kDirection), &detail::DecodeStructField<DecodableType, &DecodableType::direction> },
+        { to_underlying(Fields::kTransitionTime), &detail::DecodeStructField<DecodableType, &DecodableType::transitionTime> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -22635,7 +27003,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kEnhancedHue))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kEnhancedHue))
         {
             err = DataModel::Decode(reader, enhancedHue);
         }
@@ -22676,6 +27048,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMoveMode), &detail::DecodeStructField<DecodableType, &DecodableType::moveMode> },
+        { to_underlying(Fields::kRate), &detail::DecodeStructField<DecodableType, &DecodableType::rate> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -22688,7 +27068,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMoveMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMoveMode))
         {
             err = DataModel::Decode(reader, moveMode);
         }
@@ -22726,6 +27110,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStepMode), &detail::DecodeStructField<DecodableType, &DecodableType::stepMode> },
+        { to_underlying(Fields::kStepSize), &detail::DecodeStructField<DecodableType, &DecodableType::stepSize> },
+        { to_underlying(Fields::kTransitionTime), &detail::DecodeStructField<DecodableType, &DecodableType::transitionTime> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -22738,7 +27131,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStepMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStepMode))
         {
             err = DataModel::Decode(reader, stepMode);
         }
@@ -22780,6 +27177,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kEnhancedHue), &detail::DecodeStructField<DecodableType, &DecodableType::enhancedHue> },
+        { to_underlying(Fields::kSaturation), &detail::DecodeStructField<DecodableType, &DecodableType::saturation> },
+        { to_underlying(Fields::kTransitionTime), &detail::DecodeStructField<DecodableType, &DecodableType::transitionTime> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -22792,7 +27198,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kEnhancedHue))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kEnhancedHue))
         {
             err = DataModel::Decode(reader, enhancedHue);
         }
@@ -22836,6 +27246,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kUpdateFlags), &detail::DecodeStructField<DecodableType, &DecodableType::updateFlags> },
+        { to_underlying(Fields::kAction), &detail::DecodeStructField<DecodableType, &DecodableType::action> },
+        { to_underlying(Fields::kDirection), &detail::DecodeStructField<DecodableType, &DecodableType::direction> },
+        { to_underlying(Fields::kTime), &detail::DecodeStructField<DecodableType, &DecodableType::time> },
+        { to_underlying(Fields::kStartHue), &detail::DecodeStructField<DecodableType, &DecodableType::startHue> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -22848,7 +27269,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kUpdateFlags))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kUpdateFlags))
         {
             err = DataModel::Decode(reader, updateFlags);
         }
@@ -22895,6 +27320,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -22907,7 +27338,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kOptionsMask))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kOptionsMask))
         {
             err = DataModel::Decode(reader, optionsMask);
         }
@@ -22938,6 +27373,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMoveMode), &detail::DecodeStructField<DecodableType, &DecodableType::moveMode> },
+        { to_underlying(Fields::kRate), &detail::DecodeStructField<DecodableType, &DecodableType::rate> },
+        { to_underlying(Fields::kColorTemperatureMinimumMireds),
+          &detail::DecodeStructField<DecodableType, &DecodableType::colorTemperatureMinimumMireds> },
+        { to_underlying(Fields::kColorTemperatureMaximumMireds),
+          &detail::DecodeStructField<DecodableType, &DecodableType::colorTemperatureMaximumMireds> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -22950,7 +27397,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMoveMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMoveMode))
         {
             err = DataModel::Decode(reader, moveMode);
         }
@@ -22998,6 +27449,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStepMode), &detail::DecodeStructField<DecodableType, &DecodableType::stepMode> },
+        { to_underlying(Fields::kStepSize), &detail::DecodeStructField<DecodableType, &DecodableType::stepSize> },
+        { to_underlying(Fields::kTransitionTime), &detail::DecodeStructField<DecodableType, &DecodableType::transitionTime> },
+        { to_underlying(Fields::kColorTemperatureMinimumMireds),
+          &detail::DecodeStructField<DecodableType, &DecodableType::colorTemperatureMinimumMireds> },
+        { to_underlying(Fields::kColorTemperatureMaximumMireds),
+          &detail::DecodeStructField<DecodableType, &DecodableType::colorTemperatureMaximumMireds> },
+        { to_underlying(Fields::kOptionsMask), &detail::DecodeStructField<DecodableType, &DecodableType::optionsMask> },
+        { to_underlying(Fields::kOptionsOverride), &detail::DecodeStructField<DecodableType, &DecodableType::optionsOverride> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -23010,7 +27474,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStepMode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStepMode))
         {
             err = DataModel::Decode(reader, stepMode);
         }
@@ -23439,6 +27907,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kHoldTimeMin), &detail::DecodeStructField<DecodableType, &DecodableType::holdTimeMin> },
+        { to_underlying(Fields::kHoldTimeMax), &detail::DecodeStructField<DecodableType, &DecodableType::holdTimeMax> },
+        { to_underlying(Fields::kHoldTimeDefault), &detail::DecodeStructField<DecodableType, &DecodableType::holdTimeDefault> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -23451,7 +27926,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kHoldTimeMin))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kHoldTimeMin))
         {
             err = DataModel::Decode(reader, holdTimeMin);
         }
@@ -23537,6 +28016,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kOccupancy), &detail::DecodeStructField<DecodableType, &DecodableType::occupancy> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -23549,7 +28033,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kOccupancy))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kOccupancy))
         {
             err = DataModel::Decode(reader, occupancy);
         }
@@ -24097,6 +28585,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPassphrase), &detail::DecodeStructField<DecodableType, &DecodableType::passphrase> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -24109,7 +28602,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPassphrase))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPassphrase))
         {
             err = DataModel::Decode(reader, passphrase);
         }
@@ -24204,6 +28701,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kDataset), &detail::DecodeStructField<DecodableType, &DecodableType::dataset> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -24216,7 +28718,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kDataset))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kDataset))
         {
             err = DataModel::Decode(reader, dataset);
         }
@@ -24239,6 +28745,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kActiveDataset), &detail::DecodeStructField<DecodableType, &DecodableType::activeDataset> },
+        { to_underlying(Fields::kBreadcrumb), &detail::DecodeStructField<DecodableType, &DecodableType::breadcrumb> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -24251,7 +28763,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kActiveDataset))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kActiveDataset))
         {
             err = DataModel::Decode(reader, activeDataset);
         }
@@ -24277,6 +28793,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPendingDataset), &detail::DecodeStructField<DecodableType, &DecodableType::pendingDataset> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -24289,7 +28810,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPendingDataset))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPendingDataset))
         {
             err = DataModel::Decode(reader, pendingDataset);
         }
@@ -24355,6 +28880,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kExtendedPanID), &detail::DecodeStructField<DecodableType, &DecodableType::extendedPanID> },
+        { to_underlying(Fields::kNetworkName), &detail::DecodeStructField<DecodableType, &DecodableType::networkName> },
+        { to_underlying(Fields::kChannel), &detail::DecodeStructField<DecodableType, &DecodableType::channel> },
+        { to_underlying(Fields::kActiveTimestamp), &detail::DecodeStructField<DecodableType, &DecodableType::activeTimestamp> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -24367,7 +28900,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kExtendedPanID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kExtendedPanID))
         {
             err = DataModel::Decode(reader, extendedPanID);
         }
@@ -24405,6 +28942,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kOperationalDataset),
+          &detail::DecodeStructField<DecodableType, &DecodableType::operationalDataset> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -24417,7 +28960,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kOperationalDataset))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kOperationalDataset))
         {
             err = DataModel::Decode(reader, operationalDataset);
         }
@@ -24439,6 +28986,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kExtendedPanID), &detail::DecodeStructField<DecodableType, &DecodableType::extendedPanID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -24451,7 +29003,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kExtendedPanID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kExtendedPanID))
         {
             err = DataModel::Decode(reader, extendedPanID);
         }
@@ -24473,6 +29029,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kExtendedPanID), &detail::DecodeStructField<DecodableType, &DecodableType::extendedPanID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -24485,7 +29046,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kExtendedPanID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kExtendedPanID))
         {
             err = DataModel::Decode(reader, extendedPanID);
         }
@@ -24507,6 +29072,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kOperationalDataset),
+          &detail::DecodeStructField<DecodableType, &DecodableType::operationalDataset> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -24519,7 +29090,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kOperationalDataset))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kOperationalDataset))
         {
             err = DataModel::Decode(reader, operationalDataset);
         }
@@ -24609,6 +29184,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+        { to_underlying(Fields::kRole), &detail::DecodeStructField<DecodableType, &DecodableType::role> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -24621,7 +29202,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kName))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kName))
         {
             err = DataModel::Decode(reader, name);
         }
@@ -24650,6 +29235,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCategory), &detail::DecodeStructField<DecodableType, &DecodableType::category> },
+        { to_underlying(Fields::kSubCategory), &detail::DecodeStructField<DecodableType, &DecodableType::subCategory> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -24662,7 +29253,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCategory))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCategory))
         {
             err = DataModel::Decode(reader, category);
         }
@@ -24691,6 +29286,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSeason), &detail::DecodeStructField<DecodableType, &DecodableType::season> },
+        { to_underlying(Fields::kEpisode), &detail::DecodeStructField<DecodableType, &DecodableType::episode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -24703,7 +29304,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSeason))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSeason))
         {
             err = DataModel::Decode(reader, season);
         }
@@ -24737,6 +29342,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMajorNumber), &detail::DecodeStructField<DecodableType, &DecodableType::majorNumber> },
+        { to_underlying(Fields::kMinorNumber), &detail::DecodeStructField<DecodableType, &DecodableType::minorNumber> },
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+        { to_underlying(Fields::kCallSign), &detail::DecodeStructField<DecodableType, &DecodableType::callSign> },
+        { to_underlying(Fields::kAffiliateCallSign), &detail::DecodeStructField<DecodableType, &DecodableType::affiliateCallSign> },
+        { to_underlying(Fields::kIdentifier), &detail::DecodeStructField<DecodableType, &DecodableType::identifier> },
+        { to_underlying(Fields::kType), &detail::DecodeStructField<DecodableType, &DecodableType::type> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -24749,7 +29365,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMajorNumber))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMajorNumber))
         {
             err = DataModel::Decode(reader, majorNumber);
         }
@@ -24815,6 +29435,30 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kIdentifier), &detail::DecodeStructField<DecodableType, &DecodableType::identifier> },
+        { to_underlying(Fields::kChannel), &detail::DecodeStructField<DecodableType, &DecodableType::channel> },
+        { to_underlying(Fields::kStartTime), &detail::DecodeStructField<DecodableType, &DecodableType::startTime> },
+        { to_underlying(Fields::kEndTime), &detail::DecodeStructField<DecodableType, &DecodableType::endTime> },
+        { to_underlying(Fields::kTitle), &detail::DecodeStructField<DecodableType, &DecodableType::title> },
+        { to_underlying(Fields::kSubtitle), &detail::DecodeStructField<DecodableType, &DecodableType::subtitle> },
+        { to_underlying(Fields::kDescription), &detail::DecodeStructField<DecodableType, &DecodableType::description> },
+        { to_underlying(Fields::kAudioLanguages), &detail::DecodeStructField<DecodableType, &DecodableType::audioLanguages> },
+        { to_underlying(Fields::kRatings), &detail::DecodeStructField<DecodableType, &DecodableType::ratings> },
+        { to_underlying(Fields::kThumbnailUrl), &detail::DecodeStructField<DecodableType, &DecodableType::thumbnailUrl> },
+        { to_underlying(Fields::kPosterArtUrl), &detail::DecodeStructField<DecodableType, &DecodableType::posterArtUrl> },
+        { to_underlying(Fields::kDvbiUrl), &detail::DecodeStructField<DecodableType, &DecodableType::dvbiUrl> },
+        { to_underlying(Fields::kReleaseDate), &detail::DecodeStructField<DecodableType, &DecodableType::releaseDate> },
+        { to_underlying(Fields::kParentalGuidanceText),
+          &detail::DecodeStructField<DecodableType, &DecodableType::parentalGuidanceText> },
+        { to_underlying(Fields::kRecordingFlag), &detail::DecodeStructField<DecodableType, &DecodableType::recordingFlag> },
+        { to_underlying(Fields::kSeriesInfo), &detail::DecodeStructField<DecodableType, &DecodableType::seriesInfo> },
+        { to_underlying(Fields::kCategoryList), &detail::DecodeStructField<DecodableType, &DecodableType::categoryList> },
+        { to_underlying(Fields::kCastList), &detail::DecodeStructField<DecodableType, &DecodableType::castList> },
+        { to_underlying(Fields::kExternalIDList), &detail::DecodeStructField<DecodableType, &DecodableType::externalIDList> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -24827,7 +29471,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kIdentifier))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kIdentifier))
         {
             err = DataModel::Decode(reader, identifier);
         }
@@ -24925,6 +29573,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kLimit), &detail::DecodeStructField<DecodableType, &DecodableType::limit> },
+        { to_underlying(Fields::kAfter), &detail::DecodeStructField<DecodableType, &DecodableType::after> },
+        { to_underlying(Fields::kBefore), &detail::DecodeStructField<DecodableType, &DecodableType::before> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -24937,7 +29592,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kLimit))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kLimit))
         {
             err = DataModel::Decode(reader, limit);
         }
@@ -24970,6 +29629,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPreviousToken), &detail::DecodeStructField<DecodableType, &DecodableType::previousToken> },
+        { to_underlying(Fields::kNextToken), &detail::DecodeStructField<DecodableType, &DecodableType::nextToken> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -24982,7 +29647,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPreviousToken))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPreviousToken))
         {
             err = DataModel::Decode(reader, previousToken);
         }
@@ -25011,6 +29680,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+        { to_underlying(Fields::kValue), &detail::DecodeStructField<DecodableType, &DecodableType::value> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -25023,7 +29698,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kName))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kName))
         {
             err = DataModel::Decode(reader, name);
         }
@@ -25054,6 +29733,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kOperatorName), &detail::DecodeStructField<DecodableType, &DecodableType::operatorName> },
+        { to_underlying(Fields::kLineupName), &detail::DecodeStructField<DecodableType, &DecodableType::lineupName> },
+        { to_underlying(Fields::kPostalCode), &detail::DecodeStructField<DecodableType, &DecodableType::postalCode> },
+        { to_underlying(Fields::kLineupInfoType), &detail::DecodeStructField<DecodableType, &DecodableType::lineupInfoType> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -25066,7 +29753,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kOperatorName))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kOperatorName))
         {
             err = DataModel::Decode(reader, operatorName);
         }
@@ -25104,6 +29795,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMatch), &detail::DecodeStructField<DecodableType, &DecodableType::match> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -25116,7 +29812,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMatch))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMatch))
         {
             err = DataModel::Decode(reader, match);
         }
@@ -25139,6 +29839,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kData), &detail::DecodeStructField<DecodableType, &DecodableType::data> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -25151,7 +29857,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -25178,6 +29888,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMajorNumber), &detail::DecodeStructField<DecodableType, &DecodableType::majorNumber> },
+        { to_underlying(Fields::kMinorNumber), &detail::DecodeStructField<DecodableType, &DecodableType::minorNumber> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -25190,7 +29906,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMajorNumber))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMajorNumber))
         {
             err = DataModel::Decode(reader, majorNumber);
         }
@@ -25216,6 +29936,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCount), &detail::DecodeStructField<DecodableType, &DecodableType::count> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -25228,7 +29953,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCount))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCount))
         {
             err = DataModel::Decode(reader, count);
         }
@@ -25256,6 +29985,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStartTime), &detail::DecodeStructField<DecodableType, &DecodableType::startTime> },
+        { to_underlying(Fields::kEndTime), &detail::DecodeStructField<DecodableType, &DecodableType::endTime> },
+        { to_underlying(Fields::kChannelList), &detail::DecodeStructField<DecodableType, &DecodableType::channelList> },
+        { to_underlying(Fields::kPageToken), &detail::DecodeStructField<DecodableType, &DecodableType::pageToken> },
+        { to_underlying(Fields::kRecordingFlag), &detail::DecodeStructField<DecodableType, &DecodableType::recordingFlag> },
+        { to_underlying(Fields::kExternalIDList), &detail::DecodeStructField<DecodableType, &DecodableType::externalIDList> },
+        { to_underlying(Fields::kData), &detail::DecodeStructField<DecodableType, &DecodableType::data> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -25268,7 +30008,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStartTime))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStartTime))
         {
             err = DataModel::Decode(reader, startTime);
         }
@@ -25315,6 +30059,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPaging), &detail::DecodeStructField<DecodableType, &DecodableType::paging> },
+        { to_underlying(Fields::kProgramList), &detail::DecodeStructField<DecodableType, &DecodableType::programList> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -25327,7 +30077,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPaging))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPaging))
         {
             err = DataModel::Decode(reader, paging);
         }
@@ -25356,6 +30110,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kProgramIdentifier), &detail::DecodeStructField<DecodableType, &DecodableType::programIdentifier> },
+        { to_underlying(Fields::kShouldRecordSeries),
+          &detail::DecodeStructField<DecodableType, &DecodableType::shouldRecordSeries> },
+        { to_underlying(Fields::kExternalIDList), &detail::DecodeStructField<DecodableType, &DecodableType::externalIDList> },
+        { to_underlying(Fields::kData), &detail::DecodeStructField<DecodableType, &DecodableType::data> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -25368,7 +30131,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kProgramIdentifier))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kProgramIdentifier))
         {
             err = DataModel::Decode(reader, programIdentifier);
         }
@@ -25405,6 +30172,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kProgramIdentifier), &detail::DecodeStructField<DecodableType, &DecodableType::programIdentifier> },
+        { to_underlying(Fields::kShouldRecordSeries),
+          &detail::DecodeStructField<DecodableType, &DecodableType::shouldRecordSeries> },
+        { to_underlying(Fields::kExternalIDList), &detail::DecodeStructField<DecodableType, &DecodableType::externalIDList> },
+        { to_underlying(Fields::kData), &detail::DecodeStructField<DecodableType, &DecodableType::data> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -25417,7 +30193,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kProgramIdentifier))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kProgramIdentifier))
         {
             err = DataModel::Decode(reader, programIdentifier);
         }
@@ -25487,6 +30267,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kIdentifier), &detail::DecodeStructField<DecodableType, &DecodableType::identifier> },
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -25499,7 +30285,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kIdentifier))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kIdentifier))
         {
             err = DataModel::Decode(reader, identifier);
         }
@@ -25530,6 +30320,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kTarget), &detail::DecodeStructField<DecodableType, &DecodableType::target> },
+        { to_underlying(Fields::kData), &detail::DecodeStructField<DecodableType, &DecodableType::data> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -25542,7 +30338,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kTarget))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kTarget))
         {
             err = DataModel::Decode(reader, target);
         }
@@ -25569,6 +30369,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kData), &detail::DecodeStructField<DecodableType, &DecodableType::data> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -25581,7 +30387,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -25638,6 +30448,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kTargetList), &detail::DecodeStructField<DecodableType, &DecodableType::targetList> },
+        { to_underlying(Fields::kCurrentTarget), &detail::DecodeStructField<DecodableType, &DecodableType::currentTarget> },
+        { to_underlying(Fields::kData), &detail::DecodeStructField<DecodableType, &DecodableType::data> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -25650,7 +30467,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kTargetList))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kTargetList))
         {
             err = DataModel::Decode(reader, targetList);
         }
@@ -25687,6 +30508,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kLanguageCode), &detail::DecodeStructField<DecodableType, &DecodableType::languageCode> },
+        { to_underlying(Fields::kDisplayName), &detail::DecodeStructField<DecodableType, &DecodableType::displayName> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -25699,7 +30526,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kLanguageCode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kLanguageCode))
         {
             err = DataModel::Decode(reader, languageCode);
         }
@@ -25728,6 +30559,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kId), &detail::DecodeStructField<DecodableType, &DecodableType::id> },
+        { to_underlying(Fields::kTrackAttributes), &detail::DecodeStructField<DecodableType, &DecodableType::trackAttributes> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -25740,7 +30577,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kId))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kId))
         {
             err = DataModel::Decode(reader, id);
         }
@@ -25769,6 +30610,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kUpdatedAt), &detail::DecodeStructField<DecodableType, &DecodableType::updatedAt> },
+        { to_underlying(Fields::kPosition), &detail::DecodeStructField<DecodableType, &DecodableType::position> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -25781,7 +30628,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kUpdatedAt))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kUpdatedAt))
         {
             err = DataModel::Decode(reader, updatedAt);
         }
@@ -25931,6 +30782,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAudioAdvanceUnmuted),
+          &detail::DecodeStructField<DecodableType, &DecodableType::audioAdvanceUnmuted> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -25943,7 +30800,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAudioAdvanceUnmuted))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAudioAdvanceUnmuted))
         {
             err = DataModel::Decode(reader, audioAdvanceUnmuted);
         }
@@ -25965,6 +30826,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAudioAdvanceUnmuted),
+          &detail::DecodeStructField<DecodableType, &DecodableType::audioAdvanceUnmuted> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -25977,7 +30844,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAudioAdvanceUnmuted))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAudioAdvanceUnmuted))
         {
             err = DataModel::Decode(reader, audioAdvanceUnmuted);
         }
@@ -25999,6 +30870,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kDeltaPositionMilliseconds),
+          &detail::DecodeStructField<DecodableType, &DecodableType::deltaPositionMilliseconds> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -26011,7 +30888,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kDeltaPositionMilliseconds))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kDeltaPositionMilliseconds))
         {
             err = DataModel::Decode(reader, deltaPositionMilliseconds);
         }
@@ -26033,6 +30914,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kDeltaPositionMilliseconds),
+          &detail::DecodeStructField<DecodableType, &DecodableType::deltaPositionMilliseconds> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -26045,7 +30932,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kDeltaPositionMilliseconds))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kDeltaPositionMilliseconds))
         {
             err = DataModel::Decode(reader, deltaPositionMilliseconds);
         }
@@ -26068,6 +30959,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kData), &detail::DecodeStructField<DecodableType, &DecodableType::data> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -26080,7 +30977,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -26106,6 +31007,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPosition), &detail::DecodeStructField<DecodableType, &DecodableType::position> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -26118,7 +31024,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPosition))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPosition))
         {
             err = DataModel::Decode(reader, position);
         }
@@ -26141,6 +31051,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kTrackID), &detail::DecodeStructField<DecodableType, &DecodableType::trackID> },
+        { to_underlying(Fields::kAudioOutputIndex), &detail::DecodeStructField<DecodableType, &DecodableType::audioOutputIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -26153,7 +31069,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kTrackID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kTrackID))
         {
             err = DataModel::Decode(reader, trackID);
         }
@@ -26179,6 +31099,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kTrackID), &detail::DecodeStructField<DecodableType, &DecodableType::trackID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -26191,7 +31116,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kTrackID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kTrackID))
         {
             err = DataModel::Decode(reader, trackID);
         }
@@ -26288,6 +31217,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCurrentState), &detail::DecodeStructField<DecodableType, &DecodableType::currentState> },
+        { to_underlying(Fields::kStartTime), &detail::DecodeStructField<DecodableType, &DecodableType::startTime> },
+        { to_underlying(Fields::kDuration), &detail::DecodeStructField<DecodableType, &DecodableType::duration> },
+        { to_underlying(Fields::kSampledPosition), &detail::DecodeStructField<DecodableType, &DecodableType::sampledPosition> },
+        { to_underlying(Fields::kPlaybackSpeed), &detail::DecodeStructField<DecodableType, &DecodableType::playbackSpeed> },
+        { to_underlying(Fields::kSeekRangeEnd), &detail::DecodeStructField<DecodableType, &DecodableType::seekRangeEnd> },
+        { to_underlying(Fields::kSeekRangeStart), &detail::DecodeStructField<DecodableType, &DecodableType::seekRangeStart> },
+        { to_underlying(Fields::kData), &detail::DecodeStructField<DecodableType, &DecodableType::data> },
+        { to_underlying(Fields::kAudioAdvanceUnmuted),
+          &detail::DecodeStructField<DecodableType, &DecodableType::audioAdvanceUnmuted> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -26300,7 +31243,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCurrentState))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCurrentState))
         {
             err = DataModel::Decode(reader, currentState);
         }
@@ -26363,6 +31310,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kIndex), &detail::DecodeStructField<DecodableType, &DecodableType::index> },
+        { to_underlying(Fields::kInputType), &detail::DecodeStructField<DecodableType, &DecodableType::inputType> },
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+        { to_underlying(Fields::kDescription), &detail::DecodeStructField<DecodableType, &DecodableType::description> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -26375,7 +31330,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kIndex))
         {
             err = DataModel::Decode(reader, index);
         }
@@ -26413,6 +31372,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kIndex), &detail::DecodeStructField<DecodableType, &DecodableType::index> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -26425,7 +31389,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kIndex))
         {
             err = DataModel::Decode(reader, index);
         }
@@ -26488,6 +31456,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kIndex), &detail::DecodeStructField<DecodableType, &DecodableType::index> },
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -26500,7 +31474,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kIndex))
         {
             err = DataModel::Decode(reader, index);
         }
@@ -26608,6 +31586,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kKeyCode), &detail::DecodeStructField<DecodableType, &DecodableType::keyCode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -26620,7 +31603,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kKeyCode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kKeyCode))
         {
             err = DataModel::Decode(reader, keyCode);
         }
@@ -26642,6 +31629,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -26654,7 +31646,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -26707,6 +31703,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kWidth), &detail::DecodeStructField<DecodableType, &DecodableType::width> },
+        { to_underlying(Fields::kHeight), &detail::DecodeStructField<DecodableType, &DecodableType::height> },
+        { to_underlying(Fields::kMetric), &detail::DecodeStructField<DecodableType, &DecodableType::metric> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -26719,7 +31722,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kWidth))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kWidth))
         {
             err = DataModel::Decode(reader, width);
         }
@@ -26753,6 +31760,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kLanguageCode), &detail::DecodeStructField<DecodableType, &DecodableType::languageCode> },
+        { to_underlying(Fields::kCharacteristics), &detail::DecodeStructField<DecodableType, &DecodableType::characteristics> },
+        { to_underlying(Fields::kAudioOutputIndex), &detail::DecodeStructField<DecodableType, &DecodableType::audioOutputIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -26765,7 +31779,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kLanguageCode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kLanguageCode))
         {
             err = DataModel::Decode(reader, languageCode);
         }
@@ -26799,6 +31817,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPlaybackPosition), &detail::DecodeStructField<DecodableType, &DecodableType::playbackPosition> },
+        { to_underlying(Fields::kTextTrack), &detail::DecodeStructField<DecodableType, &DecodableType::textTrack> },
+        { to_underlying(Fields::kAudioTracks), &detail::DecodeStructField<DecodableType, &DecodableType::audioTracks> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -26811,7 +31836,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPlaybackPosition))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPlaybackPosition))
         {
             err = DataModel::Decode(reader, playbackPosition);
         }
@@ -26844,6 +31873,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+        { to_underlying(Fields::kValue), &detail::DecodeStructField<DecodableType, &DecodableType::value> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -26856,7 +31891,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kName))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kName))
         {
             err = DataModel::Decode(reader, name);
         }
@@ -26886,6 +31925,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kType), &detail::DecodeStructField<DecodableType, &DecodableType::type> },
+        { to_underlying(Fields::kValue), &detail::DecodeStructField<DecodableType, &DecodableType::value> },
+        { to_underlying(Fields::kExternalIDList), &detail::DecodeStructField<DecodableType, &DecodableType::externalIDList> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -26898,7 +31944,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kType))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kType))
         {
             err = DataModel::Decode(reader, type);
         }
@@ -26930,6 +31980,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kParameterList), &detail::DecodeStructField<DecodableType, &DecodableType::parameterList> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -26942,7 +31997,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kParameterList))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kParameterList))
         {
             err = DataModel::Decode(reader, parameterList);
         }
@@ -26968,6 +32027,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kImageURL), &detail::DecodeStructField<DecodableType, &DecodableType::imageURL> },
+        { to_underlying(Fields::kColor), &detail::DecodeStructField<DecodableType, &DecodableType::color> },
+        { to_underlying(Fields::kSize), &detail::DecodeStructField<DecodableType, &DecodableType::size> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -26980,7 +32046,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kImageURL))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kImageURL))
         {
             err = DataModel::Decode(reader, imageURL);
         }
@@ -27017,6 +32087,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kProviderName), &detail::DecodeStructField<DecodableType, &DecodableType::providerName> },
+        { to_underlying(Fields::kBackground), &detail::DecodeStructField<DecodableType, &DecodableType::background> },
+        { to_underlying(Fields::kLogo), &detail::DecodeStructField<DecodableType, &DecodableType::logo> },
+        { to_underlying(Fields::kProgressBar), &detail::DecodeStructField<DecodableType, &DecodableType::progressBar> },
+        { to_underlying(Fields::kSplash), &detail::DecodeStructField<DecodableType, &DecodableType::splash> },
+        { to_underlying(Fields::kWaterMark), &detail::DecodeStructField<DecodableType, &DecodableType::waterMark> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -27029,7 +32109,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kProviderName))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kProviderName))
         {
             err = DataModel::Decode(reader, providerName);
         }
@@ -27079,6 +32163,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSearch), &detail::DecodeStructField<DecodableType, &DecodableType::search> },
+        { to_underlying(Fields::kAutoPlay), &detail::DecodeStructField<DecodableType, &DecodableType::autoPlay> },
+        { to_underlying(Fields::kData), &detail::DecodeStructField<DecodableType, &DecodableType::data> },
+        { to_underlying(Fields::kPlaybackPreferences),
+          &detail::DecodeStructField<DecodableType, &DecodableType::playbackPreferences> },
+        { to_underlying(Fields::kUseCurrentContext), &detail::DecodeStructField<DecodableType, &DecodableType::useCurrentContext> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -27091,7 +32185,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSearch))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSearch))
         {
             err = DataModel::Decode(reader, search);
         }
@@ -27131,6 +32229,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kContentURL), &detail::DecodeStructField<DecodableType, &DecodableType::contentURL> },
+        { to_underlying(Fields::kDisplayString), &detail::DecodeStructField<DecodableType, &DecodableType::displayString> },
+        { to_underlying(Fields::kBrandingInformation),
+          &detail::DecodeStructField<DecodableType, &DecodableType::brandingInformation> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -27143,7 +32249,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kContentURL))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kContentURL))
         {
             err = DataModel::Decode(reader, contentURL);
         }
@@ -27174,6 +32284,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kData), &detail::DecodeStructField<DecodableType, &DecodableType::data> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -27186,7 +32302,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -27247,6 +32367,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kIndex), &detail::DecodeStructField<DecodableType, &DecodableType::index> },
+        { to_underlying(Fields::kOutputType), &detail::DecodeStructField<DecodableType, &DecodableType::outputType> },
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -27259,7 +32386,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kIndex))
         {
             err = DataModel::Decode(reader, index);
         }
@@ -27293,6 +32424,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kIndex), &detail::DecodeStructField<DecodableType, &DecodableType::index> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -27305,7 +32441,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kIndex))
         {
             err = DataModel::Decode(reader, index);
         }
@@ -27328,6 +32468,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kIndex), &detail::DecodeStructField<DecodableType, &DecodableType::index> },
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -27340,7 +32486,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kIndex))
         {
             err = DataModel::Decode(reader, index);
         }
@@ -27400,6 +32550,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kApplication), &detail::DecodeStructField<DecodableType, &DecodableType::application> },
+        { to_underlying(Fields::kEndpoint), &detail::DecodeStructField<DecodableType, &DecodableType::endpoint> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -27412,7 +32568,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kApplication))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kApplication))
         {
             err = DataModel::Decode(reader, application);
         }
@@ -27443,6 +32603,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kApplication), &detail::DecodeStructField<DecodableType, &DecodableType::application> },
+        { to_underlying(Fields::kData), &detail::DecodeStructField<DecodableType, &DecodableType::data> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -27455,7 +32621,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kApplication))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kApplication))
         {
             err = DataModel::Decode(reader, application);
         }
@@ -27481,6 +32651,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kApplication), &detail::DecodeStructField<DecodableType, &DecodableType::application> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -27493,7 +32668,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kApplication))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kApplication))
         {
             err = DataModel::Decode(reader, application);
         }
@@ -27515,6 +32694,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kApplication), &detail::DecodeStructField<DecodableType, &DecodableType::application> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -27527,7 +32711,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kApplication))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kApplication))
         {
             err = DataModel::Decode(reader, application);
         }
@@ -27550,6 +32738,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kData), &detail::DecodeStructField<DecodableType, &DecodableType::data> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -27562,7 +32756,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -27666,6 +32864,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kTempAccountIdentifier),
+          &detail::DecodeStructField<DecodableType, &DecodableType::tempAccountIdentifier> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -27678,7 +32882,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kTempAccountIdentifier))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kTempAccountIdentifier))
         {
             err = DataModel::Decode(reader, tempAccountIdentifier);
         }
@@ -27700,6 +32908,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSetupPIN), &detail::DecodeStructField<DecodableType, &DecodableType::setupPIN> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -27712,7 +32925,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSetupPIN))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSetupPIN))
         {
             err = DataModel::Decode(reader, setupPIN);
         }
@@ -27736,6 +32953,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kTempAccountIdentifier),
+          &detail::DecodeStructField<DecodableType, &DecodableType::tempAccountIdentifier> },
+        { to_underlying(Fields::kSetupPIN), &detail::DecodeStructField<DecodableType, &DecodableType::setupPIN> },
+        { to_underlying(Fields::kNode), &detail::DecodeStructField<DecodableType, &DecodableType::node> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -27748,7 +32973,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kTempAccountIdentifier))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kTempAccountIdentifier))
         {
             err = DataModel::Decode(reader, tempAccountIdentifier);
         }
@@ -27778,6 +33007,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNode), &detail::DecodeStructField<DecodableType, &DecodableType::node> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -27790,7 +33024,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNode))
         {
             err = DataModel::Decode(reader, node);
         }
@@ -27837,6 +33075,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNode), &detail::DecodeStructField<DecodableType, &DecodableType::node> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -27849,7 +33092,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNode))
         {
             err = DataModel::Decode(reader, node);
         }
@@ -27878,6 +33125,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kRatingName), &detail::DecodeStructField<DecodableType, &DecodableType::ratingName> },
+        { to_underlying(Fields::kRatingNameDesc), &detail::DecodeStructField<DecodableType, &DecodableType::ratingNameDesc> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -27890,7 +33143,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kRatingName))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kRatingName))
         {
             err = DataModel::Decode(reader, ratingName);
         }
@@ -27921,6 +33178,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kOldPIN), &detail::DecodeStructField<DecodableType, &DecodableType::oldPIN> },
+        { to_underlying(Fields::kNewPIN), &detail::DecodeStructField<DecodableType, &DecodableType::newPIN> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -27933,7 +33196,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kOldPIN))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kOldPIN))
         {
             err = DataModel::Decode(reader, oldPIN);
         }
@@ -27979,6 +33246,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPINCode), &detail::DecodeStructField<DecodableType, &DecodableType::PINCode> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -27991,7 +33263,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPINCode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPINCode))
         {
             err = DataModel::Decode(reader, PINCode);
         }
@@ -28054,6 +33330,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPINCode), &detail::DecodeStructField<DecodableType, &DecodableType::PINCode> },
+        { to_underlying(Fields::kBonusTime), &detail::DecodeStructField<DecodableType, &DecodableType::bonusTime> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -28066,7 +33348,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPINCode))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPINCode))
         {
             err = DataModel::Decode(reader, PINCode);
         }
@@ -28092,6 +33378,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kScreenTime), &detail::DecodeStructField<DecodableType, &DecodableType::screenTime> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -28104,7 +33395,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kScreenTime))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kScreenTime))
         {
             err = DataModel::Decode(reader, screenTime);
         }
@@ -28166,6 +33461,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kRating), &detail::DecodeStructField<DecodableType, &DecodableType::rating> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -28178,7 +33478,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kRating))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kRating))
         {
             err = DataModel::Decode(reader, rating);
         }
@@ -28200,6 +33504,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kRating), &detail::DecodeStructField<DecodableType, &DecodableType::rating> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -28212,7 +33521,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kRating))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kRating))
         {
             err = DataModel::Decode(reader, rating);
         }
@@ -28302,6 +33615,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kData), &detail::DecodeStructField<DecodableType, &DecodableType::data> },
+        { to_underlying(Fields::kEncodingHint), &detail::DecodeStructField<DecodableType, &DecodableType::encodingHint> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -28314,7 +33633,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kData))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kData))
         {
             err = DataModel::Decode(reader, data);
         }
@@ -28342,6 +33665,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStatus), &detail::DecodeStructField<DecodableType, &DecodableType::status> },
+        { to_underlying(Fields::kData), &detail::DecodeStructField<DecodableType, &DecodableType::data> },
+        { to_underlying(Fields::kEncodingHint), &detail::DecodeStructField<DecodableType, &DecodableType::encodingHint> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -28354,7 +33684,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStatus))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStatus))
         {
             err = DataModel::Decode(reader, status);
         }
@@ -28414,6 +33748,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kX), &detail::DecodeStructField<DecodableType, &DecodableType::x> },
+        { to_underlying(Fields::kY), &detail::DecodeStructField<DecodableType, &DecodableType::y> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -28426,7 +33766,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kX))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kX))
         {
             err = DataModel::Decode(reader, x);
         }
@@ -28457,6 +33801,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+        { to_underlying(Fields::kUse), &detail::DecodeStructField<DecodableType, &DecodableType::use> },
+        { to_underlying(Fields::kVertices), &detail::DecodeStructField<DecodableType, &DecodableType::vertices> },
+        { to_underlying(Fields::kColor), &detail::DecodeStructField<DecodableType, &DecodableType::color> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -28469,7 +33821,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kName))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kName))
         {
             err = DataModel::Decode(reader, name);
         }
@@ -28507,6 +33863,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kZoneID), &detail::DecodeStructField<DecodableType, &DecodableType::zoneID> },
+        { to_underlying(Fields::kZoneType), &detail::DecodeStructField<DecodableType, &DecodableType::zoneType> },
+        { to_underlying(Fields::kZoneSource), &detail::DecodeStructField<DecodableType, &DecodableType::zoneSource> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -28519,7 +33882,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kZoneID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kZoneID))
         {
             err = DataModel::Decode(reader, zoneID);
         }
@@ -28555,6 +33922,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kInitialDuration), &detail::DecodeStructField<DecodableType, &DecodableType::initialDuration> },
+        { to_underlying(Fields::kAugmentationDuration),
+          &detail::DecodeStructField<DecodableType, &DecodableType::augmentationDuration> },
+        { to_underlying(Fields::kMaxDuration), &detail::DecodeStructField<DecodableType, &DecodableType::maxDuration> },
+        { to_underlying(Fields::kBlindDuration), &detail::DecodeStructField<DecodableType, &DecodableType::blindDuration> },
+        { to_underlying(Fields::kSensitivity), &detail::DecodeStructField<DecodableType, &DecodableType::sensitivity> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -28567,7 +33944,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kInitialDuration))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kInitialDuration))
         {
             err = DataModel::Decode(reader, initialDuration);
         }
@@ -28609,6 +33990,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kZone), &detail::DecodeStructField<DecodableType, &DecodableType::zone> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -28621,7 +34007,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kZone))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kZone))
         {
             err = DataModel::Decode(reader, zone);
         }
@@ -28643,6 +34033,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kZoneID), &detail::DecodeStructField<DecodableType, &DecodableType::zoneID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -28655,7 +34050,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kZoneID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kZoneID))
         {
             err = DataModel::Decode(reader, zoneID);
         }
@@ -28678,6 +34077,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kZoneID), &detail::DecodeStructField<DecodableType, &DecodableType::zoneID> },
+        { to_underlying(Fields::kZone), &detail::DecodeStructField<DecodableType, &DecodableType::zone> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -28690,7 +34095,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kZoneID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kZoneID))
         {
             err = DataModel::Decode(reader, zoneID);
         }
@@ -28716,6 +34125,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kZoneID), &detail::DecodeStructField<DecodableType, &DecodableType::zoneID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -28728,7 +34142,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kZoneID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kZoneID))
         {
             err = DataModel::Decode(reader, zoneID);
         }
@@ -28750,6 +34168,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kZones), &detail::DecodeStructField<DecodableType, &DecodableType::zones> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -28762,7 +34185,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kZones))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kZones))
         {
             err = DataModel::Decode(reader, zones);
         }
@@ -28784,6 +34211,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kZoneID), &detail::DecodeStructField<DecodableType, &DecodableType::zoneID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -28796,7 +34228,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kZoneID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kZoneID))
         {
             err = DataModel::Decode(reader, zoneID);
         }
@@ -28852,6 +34288,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kZones), &detail::DecodeStructField<DecodableType, &DecodableType::zones> },
+        { to_underlying(Fields::kReason), &detail::DecodeStructField<DecodableType, &DecodableType::reason> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -28864,7 +34306,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kZones))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kZones))
         {
             err = DataModel::Decode(reader, zones);
         }
@@ -28892,6 +34338,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kZones), &detail::DecodeStructField<DecodableType, &DecodableType::zones> },
+        { to_underlying(Fields::kReason), &detail::DecodeStructField<DecodableType, &DecodableType::reason> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -28904,7 +34356,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kZones))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kZones))
         {
             err = DataModel::Decode(reader, zones);
         }
@@ -28937,6 +34393,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kWidth), &detail::DecodeStructField<DecodableType, &DecodableType::width> },
+        { to_underlying(Fields::kHeight), &detail::DecodeStructField<DecodableType, &DecodableType::height> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -28949,7 +34411,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kWidth))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kWidth))
         {
             err = DataModel::Decode(reader, width);
         }
@@ -28990,6 +34456,24 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kVideoStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::videoStreamID> },
+        { to_underlying(Fields::kStreamType), &detail::DecodeStructField<DecodableType, &DecodableType::streamType> },
+        { to_underlying(Fields::kVideoCodec), &detail::DecodeStructField<DecodableType, &DecodableType::videoCodec> },
+        { to_underlying(Fields::kMinFrameRate), &detail::DecodeStructField<DecodableType, &DecodableType::minFrameRate> },
+        { to_underlying(Fields::kMaxFrameRate), &detail::DecodeStructField<DecodableType, &DecodableType::maxFrameRate> },
+        { to_underlying(Fields::kMinResolution), &detail::DecodeStructField<DecodableType, &DecodableType::minResolution> },
+        { to_underlying(Fields::kMaxResolution), &detail::DecodeStructField<DecodableType, &DecodableType::maxResolution> },
+        { to_underlying(Fields::kMinBitRate), &detail::DecodeStructField<DecodableType, &DecodableType::minBitRate> },
+        { to_underlying(Fields::kMaxBitRate), &detail::DecodeStructField<DecodableType, &DecodableType::maxBitRate> },
+        { to_underlying(Fields::kMinFragmentLen), &detail::DecodeStructField<DecodableType, &DecodableType::minFragmentLen> },
+        { to_underlying(Fields::kMaxFragmentLen), &detail::DecodeStructField<DecodableType, &DecodableType::maxFragmentLen> },
+        { to_underlying(Fields::kWatermarkEnabled), &detail::DecodeStructField<DecodableType, &DecodableType::watermarkEnabled> },
+        { to_underlying(Fields::kOSDEnabled), &detail::DecodeStructField<DecodableType, &DecodableType::OSDEnabled> },
+        { to_underlying(Fields::kReferenceCount), &detail::DecodeStructField<DecodableType, &DecodableType::referenceCount> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -29002,7 +34486,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kVideoStreamID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kVideoStreamID))
         {
             err = DataModel::Decode(reader, videoStreamID);
         }
@@ -29085,6 +34573,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSnapshotStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::snapshotStreamID> },
+        { to_underlying(Fields::kImageCodec), &detail::DecodeStructField<DecodableType, &DecodableType::imageCodec> },
+        { to_underlying(Fields::kFrameRate), &detail::DecodeStructField<DecodableType, &DecodableType::frameRate> },
+        { to_underlying(Fields::kBitRate), &detail::DecodeStructField<DecodableType, &DecodableType::bitRate> },
+        { to_underlying(Fields::kMinResolution), &detail::DecodeStructField<DecodableType, &DecodableType::minResolution> },
+        { to_underlying(Fields::kMaxResolution), &detail::DecodeStructField<DecodableType, &DecodableType::maxResolution> },
+        { to_underlying(Fields::kQuality), &detail::DecodeStructField<DecodableType, &DecodableType::quality> },
+        { to_underlying(Fields::kReferenceCount), &detail::DecodeStructField<DecodableType, &DecodableType::referenceCount> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -29097,7 +34597,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSnapshotStreamID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSnapshotStreamID))
         {
             err = DataModel::Decode(reader, snapshotStreamID);
         }
@@ -29151,6 +34655,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kResolution), &detail::DecodeStructField<DecodableType, &DecodableType::resolution> },
+        { to_underlying(Fields::kMaxFrameRate), &detail::DecodeStructField<DecodableType, &DecodableType::maxFrameRate> },
+        { to_underlying(Fields::kImageCodec), &detail::DecodeStructField<DecodableType, &DecodableType::imageCodec> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -29163,7 +34674,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kResolution))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kResolution))
         {
             err = DataModel::Decode(reader, resolution);
         }
@@ -29197,6 +34712,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCodec), &detail::DecodeStructField<DecodableType, &DecodableType::codec> },
+        { to_underlying(Fields::kResolution), &detail::DecodeStructField<DecodableType, &DecodableType::resolution> },
+        { to_underlying(Fields::kMinBitRate), &detail::DecodeStructField<DecodableType, &DecodableType::minBitRate> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -29209,7 +34731,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCodec))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCodec))
         {
             err = DataModel::Decode(reader, codec);
         }
@@ -29244,6 +34770,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMaxNumberOfChannels),
+          &detail::DecodeStructField<DecodableType, &DecodableType::maxNumberOfChannels> },
+        { to_underlying(Fields::kSupportedCodecs), &detail::DecodeStructField<DecodableType, &DecodableType::supportedCodecs> },
+        { to_underlying(Fields::kSupportedSampleRates),
+          &detail::DecodeStructField<DecodableType, &DecodableType::supportedSampleRates> },
+        { to_underlying(Fields::kSupportedBitDepths),
+          &detail::DecodeStructField<DecodableType, &DecodableType::supportedBitDepths> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -29256,7 +34793,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMaxNumberOfChannels))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMaxNumberOfChannels))
         {
             err = DataModel::Decode(reader, maxNumberOfChannels);
         }
@@ -29299,6 +34840,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAudioStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::audioStreamID> },
+        { to_underlying(Fields::kStreamType), &detail::DecodeStructField<DecodableType, &DecodableType::streamType> },
+        { to_underlying(Fields::kAudioCodec), &detail::DecodeStructField<DecodableType, &DecodableType::audioCodec> },
+        { to_underlying(Fields::kChannelCount), &detail::DecodeStructField<DecodableType, &DecodableType::channelCount> },
+        { to_underlying(Fields::kSampleRate), &detail::DecodeStructField<DecodableType, &DecodableType::sampleRate> },
+        { to_underlying(Fields::kBitRate), &detail::DecodeStructField<DecodableType, &DecodableType::bitRate> },
+        { to_underlying(Fields::kBitDepth), &detail::DecodeStructField<DecodableType, &DecodableType::bitDepth> },
+        { to_underlying(Fields::kReferenceCount), &detail::DecodeStructField<DecodableType, &DecodableType::referenceCount> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -29311,7 +34864,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAudioStreamID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAudioStreamID))
         {
             err = DataModel::Decode(reader, audioStreamID);
         }
@@ -29367,6 +34924,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSensorWidth), &detail::DecodeStructField<DecodableType, &DecodableType::sensorWidth> },
+        { to_underlying(Fields::kSensorHeight), &detail::DecodeStructField<DecodableType, &DecodableType::sensorHeight> },
+        { to_underlying(Fields::kHDRCapable), &detail::DecodeStructField<DecodableType, &DecodableType::HDRCapable> },
+        { to_underlying(Fields::kMaxFPS), &detail::DecodeStructField<DecodableType, &DecodableType::maxFPS> },
+        { to_underlying(Fields::kMaxHDRFPS), &detail::DecodeStructField<DecodableType, &DecodableType::maxHDRFPS> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -29379,7 +34945,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSensorWidth))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSensorWidth))
         {
             err = DataModel::Decode(reader, sensorWidth);
         }
@@ -29426,6 +34996,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStreamType), &detail::DecodeStructField<DecodableType, &DecodableType::streamType> },
+        { to_underlying(Fields::kAudioCodec), &detail::DecodeStructField<DecodableType, &DecodableType::audioCodec> },
+        { to_underlying(Fields::kChannelCount), &detail::DecodeStructField<DecodableType, &DecodableType::channelCount> },
+        { to_underlying(Fields::kSampleRate), &detail::DecodeStructField<DecodableType, &DecodableType::sampleRate> },
+        { to_underlying(Fields::kBitRate), &detail::DecodeStructField<DecodableType, &DecodableType::bitRate> },
+        { to_underlying(Fields::kBitDepth), &detail::DecodeStructField<DecodableType, &DecodableType::bitDepth> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -29438,7 +35018,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStreamType))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStreamType))
         {
             err = DataModel::Decode(reader, streamType);
         }
@@ -29480,6 +35064,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAudioStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::audioStreamID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -29492,7 +35081,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAudioStreamID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAudioStreamID))
         {
             err = DataModel::Decode(reader, audioStreamID);
         }
@@ -29514,6 +35107,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAudioStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::audioStreamID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -29526,7 +35124,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAudioStreamID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAudioStreamID))
         {
             err = DataModel::Decode(reader, audioStreamID);
         }
@@ -29559,6 +35161,22 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStreamType), &detail::DecodeStructField<DecodableType, &DecodableType::streamType> },
+        { to_underlying(Fields::kVideoCodec), &detail::DecodeStructField<DecodableType, &DecodableType::videoCodec> },
+        { to_underlying(Fields::kMinFrameRate), &detail::DecodeStructField<DecodableType, &DecodableType::minFrameRate> },
+        { to_underlying(Fields::kMaxFrameRate), &detail::DecodeStructField<DecodableType, &DecodableType::maxFrameRate> },
+        { to_underlying(Fields::kMinResolution), &detail::DecodeStructField<DecodableType, &DecodableType::minResolution> },
+        { to_underlying(Fields::kMaxResolution), &detail::DecodeStructField<DecodableType, &DecodableType::maxResolution> },
+        { to_underlying(Fields::kMinBitRate), &detail::DecodeStructField<DecodableType, &DecodableType::minBitRate> },
+        { to_underlying(Fields::kMaxBitRate), &detail::DecodeStructField<DecodableType, &DecodableType::maxBitRate> },
+        { to_underlying(Fields::kMinFragmentLen), &detail::DecodeStructField<DecodableType, &DecodableType::minFragmentLen> },
+        { to_underlying(Fields::kMaxFragmentLen), &detail::DecodeStructField<DecodableType, &DecodableType::maxFragmentLen> },
+        { to_underlying(Fields::kWatermarkEnabled), &detail::DecodeStructField<DecodableType, &DecodableType::watermarkEnabled> },
+        { to_underlying(Fields::kOSDEnabled), &detail::DecodeStructField<DecodableType, &DecodableType::OSDEnabled> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -29571,7 +35189,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStreamType))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStreamType))
         {
             err = DataModel::Decode(reader, streamType);
         }
@@ -29637,6 +35259,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kVideoStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::videoStreamID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -29649,7 +35276,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kVideoStreamID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kVideoStreamID))
         {
             err = DataModel::Decode(reader, videoStreamID);
         }
@@ -29674,6 +35305,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kVideoStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::videoStreamID> },
+        { to_underlying(Fields::kResolution), &detail::DecodeStructField<DecodableType, &DecodableType::resolution> },
+        { to_underlying(Fields::kWatermarkEnabled), &detail::DecodeStructField<DecodableType, &DecodableType::watermarkEnabled> },
+        { to_underlying(Fields::kOSDEnabled), &detail::DecodeStructField<DecodableType, &DecodableType::OSDEnabled> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -29686,7 +35325,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kVideoStreamID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kVideoStreamID))
         {
             err = DataModel::Decode(reader, videoStreamID);
         }
@@ -29720,6 +35363,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kVideoStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::videoStreamID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -29732,7 +35380,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kVideoStreamID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kVideoStreamID))
         {
             err = DataModel::Decode(reader, videoStreamID);
         }
@@ -29759,6 +35411,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kImageCodec), &detail::DecodeStructField<DecodableType, &DecodableType::imageCodec> },
+        { to_underlying(Fields::kMaxFrameRate), &detail::DecodeStructField<DecodableType, &DecodableType::maxFrameRate> },
+        { to_underlying(Fields::kBitRate), &detail::DecodeStructField<DecodableType, &DecodableType::bitRate> },
+        { to_underlying(Fields::kMinResolution), &detail::DecodeStructField<DecodableType, &DecodableType::minResolution> },
+        { to_underlying(Fields::kMaxResolution), &detail::DecodeStructField<DecodableType, &DecodableType::maxResolution> },
+        { to_underlying(Fields::kQuality), &detail::DecodeStructField<DecodableType, &DecodableType::quality> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -29771,7 +35433,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kImageCodec))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kImageCodec))
         {
             err = DataModel::Decode(reader, imageCodec);
         }
@@ -29813,6 +35479,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSnapshotStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::snapshotStreamID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -29825,7 +35496,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSnapshotStreamID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSnapshotStreamID))
         {
             err = DataModel::Decode(reader, snapshotStreamID);
         }
@@ -29847,6 +35522,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSnapshotStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::snapshotStreamID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -29859,7 +35539,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSnapshotStreamID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSnapshotStreamID))
         {
             err = DataModel::Decode(reader, snapshotStreamID);
         }
@@ -29881,6 +35565,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStreamPriorities), &detail::DecodeStructField<DecodableType, &DecodableType::streamPriorities> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -29893,7 +35582,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStreamPriorities))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStreamPriorities))
         {
             err = DataModel::Decode(reader, streamPriorities);
         }
@@ -29916,6 +35609,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSnapshotStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::snapshotStreamID> },
+        { to_underlying(Fields::kRequestedResolution),
+          &detail::DecodeStructField<DecodableType, &DecodableType::requestedResolution> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -29928,7 +35628,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSnapshotStreamID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSnapshotStreamID))
         {
             err = DataModel::Decode(reader, snapshotStreamID);
         }
@@ -29956,6 +35660,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kData), &detail::DecodeStructField<DecodableType, &DecodableType::data> },
+        { to_underlying(Fields::kImageCodec), &detail::DecodeStructField<DecodableType, &DecodableType::imageCodec> },
+        { to_underlying(Fields::kResolution), &detail::DecodeStructField<DecodableType, &DecodableType::resolution> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -29968,7 +35679,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kData))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kData))
         {
             err = DataModel::Decode(reader, data);
         }
@@ -30115,6 +35830,21 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kVideoStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::videoStreamID> },
+        { to_underlying(Fields::kStreamType), &detail::DecodeStructField<DecodableType, &DecodableType::streamType> },
+        { to_underlying(Fields::kVideoCodec), &detail::DecodeStructField<DecodableType, &DecodableType::videoCodec> },
+        { to_underlying(Fields::kMinFrameRate), &detail::DecodeStructField<DecodableType, &DecodableType::minFrameRate> },
+        { to_underlying(Fields::kMaxFrameRate), &detail::DecodeStructField<DecodableType, &DecodableType::maxFrameRate> },
+        { to_underlying(Fields::kMinResolution), &detail::DecodeStructField<DecodableType, &DecodableType::minResolution> },
+        { to_underlying(Fields::kMaxResolution), &detail::DecodeStructField<DecodableType, &DecodableType::maxResolution> },
+        { to_underlying(Fields::kMinBitRate), &detail::DecodeStructField<DecodableType, &DecodableType::minBitRate> },
+        { to_underlying(Fields::kMaxBitRate), &detail::DecodeStructField<DecodableType, &DecodableType::maxBitRate> },
+        { to_underlying(Fields::kMinFragmentLen), &detail::DecodeStructField<DecodableType, &DecodableType::minFragmentLen> },
+        { to_underlying(Fields::kMaxFragmentLen), &detail::DecodeStructField<DecodableType, &DecodableType::maxFragmentLen> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -30127,7 +35857,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kVideoStreamID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kVideoStreamID))
         {
             err = DataModel::Decode(reader, videoStreamID);
         }
@@ -30196,6 +35930,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kAudioStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::audioStreamID> },
+        { to_underlying(Fields::kStreamType), &detail::DecodeStructField<DecodableType, &DecodableType::streamType> },
+        { to_underlying(Fields::kAudioCodec), &detail::DecodeStructField<DecodableType, &DecodableType::audioCodec> },
+        { to_underlying(Fields::kChannelCount), &detail::DecodeStructField<DecodableType, &DecodableType::channelCount> },
+        { to_underlying(Fields::kSampleRate), &detail::DecodeStructField<DecodableType, &DecodableType::sampleRate> },
+        { to_underlying(Fields::kBitRate), &detail::DecodeStructField<DecodableType, &DecodableType::bitRate> },
+        { to_underlying(Fields::kBitDepth), &detail::DecodeStructField<DecodableType, &DecodableType::bitDepth> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -30208,7 +35953,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kAudioStreamID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kAudioStreamID))
         {
             err = DataModel::Decode(reader, audioStreamID);
         }
@@ -30261,6 +36010,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSnapshotStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::snapshotStreamID> },
+        { to_underlying(Fields::kImageCodec), &detail::DecodeStructField<DecodableType, &DecodableType::imageCodec> },
+        { to_underlying(Fields::kFrameRate), &detail::DecodeStructField<DecodableType, &DecodableType::frameRate> },
+        { to_underlying(Fields::kBitRate), &detail::DecodeStructField<DecodableType, &DecodableType::bitRate> },
+        { to_underlying(Fields::kMinResolution), &detail::DecodeStructField<DecodableType, &DecodableType::minResolution> },
+        { to_underlying(Fields::kMaxResolution), &detail::DecodeStructField<DecodableType, &DecodableType::maxResolution> },
+        { to_underlying(Fields::kQuality), &detail::DecodeStructField<DecodableType, &DecodableType::quality> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -30273,7 +36033,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSnapshotStreamID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSnapshotStreamID))
         {
             err = DataModel::Decode(reader, snapshotStreamID);
         }
@@ -30331,6 +36095,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kStreamType), &detail::DecodeStructField<DecodableType, &DecodableType::streamType> },
+        { to_underlying(Fields::kVideoStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::videoStreamID> },
+        { to_underlying(Fields::kAudioStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::audioStreamID> },
+        { to_underlying(Fields::kICEServers), &detail::DecodeStructField<DecodableType, &DecodableType::ICEServers> },
+        { to_underlying(Fields::kICETransportPolicy),
+          &detail::DecodeStructField<DecodableType, &DecodableType::ICETransportPolicy> },
+        { to_underlying(Fields::kMetadataOptions), &detail::DecodeStructField<DecodableType, &DecodableType::metadataOptions> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -30343,7 +36118,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kStreamType))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kStreamType))
         {
             err = DataModel::Decode(reader, streamType);
         }
@@ -30388,6 +36167,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kWebRTCSessionID), &detail::DecodeStructField<DecodableType, &DecodableType::webRTCSessionID> },
+        { to_underlying(Fields::kDeferredOffer), &detail::DecodeStructField<DecodableType, &DecodableType::deferredOffer> },
+        { to_underlying(Fields::kVideoStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::videoStreamID> },
+        { to_underlying(Fields::kAudioStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::audioStreamID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -30400,7 +36187,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
         {
             err = DataModel::Decode(reader, webRTCSessionID);
         }
@@ -30441,6 +36232,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kWebRTCSessionID), &detail::DecodeStructField<DecodableType, &DecodableType::webRTCSessionID> },
+        { to_underlying(Fields::kSdp), &detail::DecodeStructField<DecodableType, &DecodableType::sdp> },
+        { to_underlying(Fields::kStreamType), &detail::DecodeStructField<DecodableType, &DecodableType::streamType> },
+        { to_underlying(Fields::kVideoStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::videoStreamID> },
+        { to_underlying(Fields::kAudioStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::audioStreamID> },
+        { to_underlying(Fields::kICEServers), &detail::DecodeStructField<DecodableType, &DecodableType::ICEServers> },
+        { to_underlying(Fields::kICETransportPolicy),
+          &detail::DecodeStructField<DecodableType, &DecodableType::ICETransportPolicy> },
+        { to_underlying(Fields::kMetadataOptions), &detail::DecodeStructField<DecodableType, &DecodableType::metadataOptions> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -30453,7 +36257,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
         {
             err = DataModel::Decode(reader, webRTCSessionID);
         }
@@ -30505,6 +36313,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kWebRTCSessionID), &detail::DecodeStructField<DecodableType, &DecodableType::webRTCSessionID> },
+        { to_underlying(Fields::kVideoStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::videoStreamID> },
+        { to_underlying(Fields::kAudioStreamID), &detail::DecodeStructField<DecodableType, &DecodableType::audioStreamID> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -30517,7 +36332,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
         {
             err = DataModel::Decode(reader, webRTCSessionID);
         }
@@ -30548,6 +36367,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kWebRTCSessionID), &detail::DecodeStructField<DecodableType, &DecodableType::webRTCSessionID> },
+        { to_underlying(Fields::kSdp), &detail::DecodeStructField<DecodableType, &DecodableType::sdp> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -30560,7 +36385,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
         {
             err = DataModel::Decode(reader, webRTCSessionID);
         }
@@ -30587,6 +36416,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kWebRTCSessionID), &detail::DecodeStructField<DecodableType, &DecodableType::webRTCSessionID> },
+        { to_underlying(Fields::kICECandidate), &detail::DecodeStructField<DecodableType, &DecodableType::ICECandidate> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -30599,7 +36434,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
         {
             err = DataModel::Decode(reader, webRTCSessionID);
         }
@@ -30626,6 +36465,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kWebRTCSessionID), &detail::DecodeStructField<DecodableType, &DecodableType::webRTCSessionID> },
+        { to_underlying(Fields::kReason), &detail::DecodeStructField<DecodableType, &DecodableType::reason> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -30638,7 +36483,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
         {
             err = DataModel::Decode(reader, webRTCSessionID);
         }
@@ -30699,6 +36548,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kWebRTCSessionID), &detail::DecodeStructField<DecodableType, &DecodableType::webRTCSessionID> },
+        { to_underlying(Fields::kSdp), &detail::DecodeStructField<DecodableType, &DecodableType::sdp> },
+        { to_underlying(Fields::kICEServers), &detail::DecodeStructField<DecodableType, &DecodableType::ICEServers> },
+        { to_underlying(Fields::kICETransportPolicy),
+          &detail::DecodeStructField<DecodableType, &DecodableType::ICETransportPolicy> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -30711,7 +36569,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
         {
             err = DataModel::Decode(reader, webRTCSessionID);
         }
@@ -30746,6 +36608,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kWebRTCSessionID), &detail::DecodeStructField<DecodableType, &DecodableType::webRTCSessionID> },
+        { to_underlying(Fields::kSdp), &detail::DecodeStructField<DecodableType, &DecodableType::sdp> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -30758,7 +36626,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
         {
             err = DataModel::Decode(reader, webRTCSessionID);
         }
@@ -30785,6 +36657,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kWebRTCSessionID), &detail::DecodeStructField<DecodableType, &DecodableType::webRTCSessionID> },
+        { to_underlying(Fields::kICECandidate), &detail::DecodeStructField<DecodableType, &DecodableType::ICECandidate> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -30797,7 +36675,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
         {
             err = DataModel::Decode(reader, webRTCSessionID);
         }
@@ -30824,6 +36706,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kWebRTCSessionID), &detail::DecodeStructField<DecodableType, &DecodableType::webRTCSessionID> },
+        { to_underlying(Fields::kReason), &detail::DecodeStructField<DecodableType, &DecodableType::reason> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -30836,7 +36724,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
         {
             err = DataModel::Decode(reader, webRTCSessionID);
         }
@@ -30894,6 +36786,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kChimeID), &detail::DecodeStructField<DecodableType, &DecodableType::chimeID> },
+        { to_underlying(Fields::kName), &detail::DecodeStructField<DecodableType, &DecodableType::name> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -30906,7 +36804,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kChimeID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kChimeID))
         {
             err = DataModel::Decode(reader, chimeID);
         }
@@ -31036,6 +36938,20 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kDeviceName), &detail::DecodeStructField<DecodableType, &DecodableType::deviceName> },
+        { to_underlying(Fields::kDeviceNameLastEdit),
+          &detail::DecodeStructField<DecodableType, &DecodableType::deviceNameLastEdit> },
+        { to_underlying(Fields::kBridgedEndpoint), &detail::DecodeStructField<DecodableType, &DecodableType::bridgedEndpoint> },
+        { to_underlying(Fields::kOriginalEndpoint), &detail::DecodeStructField<DecodableType, &DecodableType::originalEndpoint> },
+        { to_underlying(Fields::kDeviceTypes), &detail::DecodeStructField<DecodableType, &DecodableType::deviceTypes> },
+        { to_underlying(Fields::kUniqueLocationIDs), &detail::DecodeStructField<DecodableType, &DecodableType::uniqueLocationIDs> },
+        { to_underlying(Fields::kUniqueLocationIDsLastEdit),
+          &detail::DecodeStructField<DecodableType, &DecodableType::uniqueLocationIDsLastEdit> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -31048,7 +36964,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kDeviceName))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kDeviceName))
         {
             err = DataModel::Decode(reader, deviceName);
         }
@@ -31129,6 +37049,16 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kUniqueLocationID), &detail::DecodeStructField<DecodableType, &DecodableType::uniqueLocationID> },
+        { to_underlying(Fields::kLocationDescriptor),
+          &detail::DecodeStructField<DecodableType, &DecodableType::locationDescriptor> },
+        { to_underlying(Fields::kLocationDescriptorLastEdit),
+          &detail::DecodeStructField<DecodableType, &DecodableType::locationDescriptorLastEdit> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -31141,7 +37071,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kUniqueLocationID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kUniqueLocationID))
         {
             err = DataModel::Decode(reader, uniqueLocationID);
         }
@@ -31214,6 +37148,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kRequestID), &detail::DecodeStructField<DecodableType, &DecodableType::requestID> },
+        { to_underlying(Fields::kVendorID), &detail::DecodeStructField<DecodableType, &DecodableType::vendorID> },
+        { to_underlying(Fields::kProductID), &detail::DecodeStructField<DecodableType, &DecodableType::productID> },
+        { to_underlying(Fields::kLabel), &detail::DecodeStructField<DecodableType, &DecodableType::label> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -31226,7 +37168,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kRequestID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kRequestID))
         {
             err = DataModel::Decode(reader, requestID);
         }
@@ -31261,6 +37207,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kRequestID), &detail::DecodeStructField<DecodableType, &DecodableType::requestID> },
+        { to_underlying(Fields::kResponseTimeoutSeconds),
+          &detail::DecodeStructField<DecodableType, &DecodableType::responseTimeoutSeconds> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -31273,7 +37226,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kRequestID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kRequestID))
         {
             err = DataModel::Decode(reader, requestID);
         }
@@ -31303,6 +37260,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCommissioningTimeout),
+          &detail::DecodeStructField<DecodableType, &DecodableType::commissioningTimeout> },
+        { to_underlying(Fields::kPAKEPasscodeVerifier),
+          &detail::DecodeStructField<DecodableType, &DecodableType::PAKEPasscodeVerifier> },
+        { to_underlying(Fields::kDiscriminator), &detail::DecodeStructField<DecodableType, &DecodableType::discriminator> },
+        { to_underlying(Fields::kIterations), &detail::DecodeStructField<DecodableType, &DecodableType::iterations> },
+        { to_underlying(Fields::kSalt), &detail::DecodeStructField<DecodableType, &DecodableType::salt> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -31315,7 +37283,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCommissioningTimeout))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCommissioningTimeout))
         {
             err = DataModel::Decode(reader, commissioningTimeout);
         }
@@ -31383,6 +37355,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kRequestID), &detail::DecodeStructField<DecodableType, &DecodableType::requestID> },
+        { to_underlying(Fields::kClientNodeID), &detail::DecodeStructField<DecodableType, &DecodableType::clientNodeID> },
+        { to_underlying(Fields::kStatusCode), &detail::DecodeStructField<DecodableType, &DecodableType::statusCode> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -31395,7 +37375,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kRequestID))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kRequestID))
         {
             err = DataModel::Decode(reader, requestID);
         }
@@ -31443,6 +37427,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kA), &detail::DecodeStructField<DecodableType, &DecodableType::a> },
+        { to_underlying(Fields::kB), &detail::DecodeStructField<DecodableType, &DecodableType::b> },
+        { to_underlying(Fields::kC), &detail::DecodeStructField<DecodableType, &DecodableType::c> },
+        { to_underlying(Fields::kD), &detail::DecodeStructField<DecodableType, &DecodableType::d> },
+        { to_underlying(Fields::kE), &detail::DecodeStructField<DecodableType, &DecodableType::e> },
+        { to_underlying(Fields::kF), &detail::DecodeStructField<DecodableType, &DecodableType::f> },
+        { to_underlying(Fields::kG), &detail::DecodeStructField<DecodableType, &DecodableType::g> },
+        { to_underlying(Fields::kH), &detail::DecodeStructField<DecodableType, &DecodableType::h> },
+        { to_underlying(Fields::kI), &detail::DecodeStructField<DecodableType, &DecodableType::i> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -31455,7 +37452,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kA))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kA))
         {
             err = DataModel::Decode(reader, a);
         }
@@ -31556,6 +37557,25 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kFabricSensitiveInt8u),
+          &detail::DecodeStructField<DecodableType, &DecodableType::fabricSensitiveInt8u> },
+        { to_underlying(Fields::kOptionalFabricSensitiveInt8u),
+          &detail::DecodeStructField<DecodableType, &DecodableType::optionalFabricSensitiveInt8u> },
+        { to_underlying(Fields::kNullableFabricSensitiveInt8u),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableFabricSensitiveInt8u> },
+        { to_underlying(Fields::kNullableOptionalFabricSensitiveInt8u),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableOptionalFabricSensitiveInt8u> },
+        { to_underlying(Fields::kFabricSensitiveCharString),
+          &detail::DecodeStructField<DecodableType, &DecodableType::fabricSensitiveCharString> },
+        { to_underlying(Fields::kFabricSensitiveStruct),
+          &detail::DecodeStructField<DecodableType, &DecodableType::fabricSensitiveStruct> },
+        { to_underlying(Fields::kFabricSensitiveInt8uList),
+          &detail::DecodeStructField<DecodableType, &DecodableType::fabricSensitiveInt8uList> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -31568,7 +37588,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kFabricSensitiveInt8u))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kFabricSensitiveInt8u))
         {
             err = DataModel::Decode(reader, fabricSensitiveInt8u);
         }
@@ -31631,6 +37655,26 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNullableInt), &detail::DecodeStructField<DecodableType, &DecodableType::nullableInt> },
+        { to_underlying(Fields::kOptionalInt), &detail::DecodeStructField<DecodableType, &DecodableType::optionalInt> },
+        { to_underlying(Fields::kNullableOptionalInt),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableOptionalInt> },
+        { to_underlying(Fields::kNullableString), &detail::DecodeStructField<DecodableType, &DecodableType::nullableString> },
+        { to_underlying(Fields::kOptionalString), &detail::DecodeStructField<DecodableType, &DecodableType::optionalString> },
+        { to_underlying(Fields::kNullableOptionalString),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableOptionalString> },
+        { to_underlying(Fields::kNullableStruct), &detail::DecodeStructField<DecodableType, &DecodableType::nullableStruct> },
+        { to_underlying(Fields::kOptionalStruct), &detail::DecodeStructField<DecodableType, &DecodableType::optionalStruct> },
+        { to_underlying(Fields::kNullableOptionalStruct),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableOptionalStruct> },
+        { to_underlying(Fields::kNullableList), &detail::DecodeStructField<DecodableType, &DecodableType::nullableList> },
+        { to_underlying(Fields::kOptionalList), &detail::DecodeStructField<DecodableType, &DecodableType::optionalList> },
+        { to_underlying(Fields::kNullableOptionalList),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableOptionalList> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -31643,7 +37687,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNullableInt))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNullableInt))
         {
             err = DataModel::Decode(reader, nullableInt);
         }
@@ -31714,6 +37762,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kA), &detail::DecodeStructField<DecodableType, &DecodableType::a> },
+        { to_underlying(Fields::kB), &detail::DecodeStructField<DecodableType, &DecodableType::b> },
+        { to_underlying(Fields::kC), &detail::DecodeStructField<DecodableType, &DecodableType::c> },
+        { to_underlying(Fields::kD), &detail::DecodeStructField<DecodableType, &DecodableType::d> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -31726,7 +37782,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kA))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kA))
         {
             err = DataModel::Decode(reader, a);
         }
@@ -31768,6 +37828,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kA), &detail::DecodeStructField<DecodableType, &DecodableType::a> },
+        { to_underlying(Fields::kB), &detail::DecodeStructField<DecodableType, &DecodableType::b> },
+        { to_underlying(Fields::kC), &detail::DecodeStructField<DecodableType, &DecodableType::c> },
+        { to_underlying(Fields::kD), &detail::DecodeStructField<DecodableType, &DecodableType::d> },
+        { to_underlying(Fields::kE), &detail::DecodeStructField<DecodableType, &DecodableType::e> },
+        { to_underlying(Fields::kF), &detail::DecodeStructField<DecodableType, &DecodableType::f> },
+        { to_underlying(Fields::kG), &detail::DecodeStructField<DecodableType, &DecodableType::g> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -31780,7 +37851,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kA))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kA))
         {
             err = DataModel::Decode(reader, a);
         }
@@ -31828,6 +37903,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kA), &detail::DecodeStructField<DecodableType, &DecodableType::a> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -31840,7 +37920,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kA))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kA))
         {
             err = DataModel::Decode(reader, a);
         }
@@ -31865,6 +37949,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kMember1), &detail::DecodeStructField<DecodableType, &DecodableType::member1> },
+        { to_underlying(Fields::kMember2), &detail::DecodeStructField<DecodableType, &DecodableType::member2> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -31877,7 +37967,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kMember1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kMember1))
         {
             err = DataModel::Decode(reader, member1);
         }
@@ -31927,6 +38021,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kReturnValue), &detail::DecodeStructField<DecodableType, &DecodableType::returnValue> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -31939,7 +38038,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kReturnValue))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kReturnValue))
         {
             err = DataModel::Decode(reader, returnValue);
         }
@@ -31981,6 +38084,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kReturnValue), &detail::DecodeStructField<DecodableType, &DecodableType::returnValue> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -31993,7 +38101,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kReturnValue))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kReturnValue))
         {
             err = DataModel::Decode(reader, returnValue);
         }
@@ -32035,6 +38147,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kReturnValue), &detail::DecodeStructField<DecodableType, &DecodableType::returnValue> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -32047,7 +38164,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kReturnValue))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kReturnValue))
         {
             err = DataModel::Decode(reader, returnValue);
         }
@@ -32094,6 +38215,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+        { to_underlying(Fields::kArg2), &detail::DecodeStructField<DecodableType, &DecodableType::arg2> },
+        { to_underlying(Fields::kArg3), &detail::DecodeStructField<DecodableType, &DecodableType::arg3> },
+        { to_underlying(Fields::kArg4), &detail::DecodeStructField<DecodableType, &DecodableType::arg4> },
+        { to_underlying(Fields::kArg5), &detail::DecodeStructField<DecodableType, &DecodableType::arg5> },
+        { to_underlying(Fields::kArg6), &detail::DecodeStructField<DecodableType, &DecodableType::arg6> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -32106,7 +38237,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -32149,6 +38284,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+        { to_underlying(Fields::kArg2), &detail::DecodeStructField<DecodableType, &DecodableType::arg2> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -32161,7 +38302,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -32187,6 +38332,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -32199,7 +38349,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -32221,6 +38375,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -32233,7 +38392,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -32256,6 +38419,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+        { to_underlying(Fields::kArg2), &detail::DecodeStructField<DecodableType, &DecodableType::arg2> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -32268,7 +38437,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -32299,6 +38472,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+        { to_underlying(Fields::kArg2), &detail::DecodeStructField<DecodableType, &DecodableType::arg2> },
+        { to_underlying(Fields::kArg3), &detail::DecodeStructField<DecodableType, &DecodableType::arg3> },
+        { to_underlying(Fields::kArg4), &detail::DecodeStructField<DecodableType, &DecodableType::arg4> },
+        { to_underlying(Fields::kArg5), &detail::DecodeStructField<DecodableType, &DecodableType::arg5> },
+        { to_underlying(Fields::kArg6), &detail::DecodeStructField<DecodableType, &DecodableType::arg6> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -32311,7 +38494,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -32356,6 +38543,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kWasPresent), &detail::DecodeStructField<DecodableType, &DecodableType::wasPresent> },
+        { to_underlying(Fields::kWasNull), &detail::DecodeStructField<DecodableType, &DecodableType::wasNull> },
+        { to_underlying(Fields::kValue), &detail::DecodeStructField<DecodableType, &DecodableType::value> },
+        { to_underlying(Fields::kOriginalValue), &detail::DecodeStructField<DecodableType, &DecodableType::originalValue> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -32368,7 +38563,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kWasPresent))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kWasPresent))
         {
             err = DataModel::Decode(reader, wasPresent);
         }
@@ -32402,6 +38601,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -32414,7 +38618,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -32463,6 +38671,62 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNullableIntWasNull),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableIntWasNull> },
+        { to_underlying(Fields::kNullableIntValue), &detail::DecodeStructField<DecodableType, &DecodableType::nullableIntValue> },
+        { to_underlying(Fields::kOptionalIntWasPresent),
+          &detail::DecodeStructField<DecodableType, &DecodableType::optionalIntWasPresent> },
+        { to_underlying(Fields::kOptionalIntValue), &detail::DecodeStructField<DecodableType, &DecodableType::optionalIntValue> },
+        { to_underlying(Fields::kNullableOptionalIntWasPresent),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableOptionalIntWasPresent> },
+        { to_underlying(Fields::kNullableOptionalIntWasNull),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableOptionalIntWasNull> },
+        { to_underlying(Fields::kNullableOptionalIntValue),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableOptionalIntValue> },
+        { to_underlying(Fields::kNullableStringWasNull),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableStringWasNull> },
+        { to_underlying(Fields::kNullableStringValue),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableStringValue> },
+        { to_underlying(Fields::kOptionalStringWasPresent),
+          &detail::DecodeStructField<DecodableType, &DecodableType::optionalStringWasPresent> },
+        { to_underlying(Fields::kOptionalStringValue),
+          &detail::DecodeStructField<DecodableType, &DecodableType::optionalStringValue> },
+        { to_underlying(Fields::kNullableOptionalStringWasPresent),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableOptionalStringWasPresent> },
+        { to_underlying(Fields::kNullableOptionalStringWasNull),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableOptionalStringWasNull> },
+        { to_underlying(Fields::kNullableOptionalStringValue),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableOptionalStringValue> },
+        { to_underlying(Fields::kNullableStructWasNull),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableStructWasNull> },
+        { to_underlying(Fields::kNullableStructValue),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableStructValue> },
+        { to_underlying(Fields::kOptionalStructWasPresent),
+          &detail::DecodeStructField<DecodableType, &DecodableType::optionalStructWasPresent> },
+        { to_underlying(Fields::kOptionalStructValue),
+          &detail::DecodeStructField<DecodableType, &DecodableType::optionalStructValue> },
+        { to_underlying(Fields::kNullableOptionalStructWasPresent),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableOptionalStructWasPresent> },
+        { to_underlying(Fields::kNullableOptionalStructWasNull),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableOptionalStructWasNull> },
+        { to_underlying(Fields::kNullableOptionalStructValue),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableOptionalStructValue> },
+        { to_underlying(Fields::kNullableListWasNull),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableListWasNull> },
+        { to_underlying(Fields::kNullableListValue), &detail::DecodeStructField<DecodableType, &DecodableType::nullableListValue> },
+        { to_underlying(Fields::kOptionalListWasPresent),
+          &detail::DecodeStructField<DecodableType, &DecodableType::optionalListWasPresent> },
+        { to_underlying(Fields::kOptionalListValue), &detail::DecodeStructField<DecodableType, &DecodableType::optionalListValue> },
+        { to_underlying(Fields::kNullableOptionalListWasPresent),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableOptionalListWasPresent> },
+        { to_underlying(Fields::kNullableOptionalListWasNull),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableOptionalListWasNull> },
+        { to_underlying(Fields::kNullableOptionalListValue),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableOptionalListValue> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -32475,7 +38739,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNullableIntWasNull))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNullableIntWasNull))
         {
             err = DataModel::Decode(reader, nullableIntWasNull);
         }
@@ -32605,6 +38873,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -32617,7 +38890,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -32639,6 +38916,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kValue), &detail::DecodeStructField<DecodableType, &DecodableType::value> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -32651,7 +38933,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kValue))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kValue))
         {
             err = DataModel::Decode(reader, value);
         }
@@ -32673,6 +38959,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -32685,7 +38976,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -32707,6 +39002,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -32719,7 +39019,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -32741,6 +39045,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -32753,7 +39062,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -32775,6 +39088,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kValue), &detail::DecodeStructField<DecodableType, &DecodableType::value> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -32787,7 +39105,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kValue))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kValue))
         {
             err = DataModel::Decode(reader, value);
         }
@@ -32809,6 +39131,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -32821,7 +39148,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -32843,6 +39174,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kValue), &detail::DecodeStructField<DecodableType, &DecodableType::value> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -32855,7 +39191,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kValue))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kValue))
         {
             err = DataModel::Decode(reader, value);
         }
@@ -32877,6 +39217,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -32889,7 +39234,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -32911,6 +39260,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kBuffer), &detail::DecodeStructField<DecodableType, &DecodableType::buffer> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -32923,7 +39277,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kBuffer))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kBuffer))
         {
             err = DataModel::Decode(reader, buffer);
         }
@@ -32945,6 +39303,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -32957,7 +39320,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -32979,6 +39346,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPayload), &detail::DecodeStructField<DecodableType, &DecodableType::payload> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -32991,7 +39363,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPayload))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPayload))
         {
             err = DataModel::Decode(reader, payload);
         }
@@ -33014,6 +39390,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+        { to_underlying(Fields::kArg2), &detail::DecodeStructField<DecodableType, &DecodableType::arg2> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -33026,7 +39408,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -33053,6 +39439,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kField1), &detail::DecodeStructField<DecodableType, &DecodableType::field1> },
+        { to_underlying(Fields::kField2), &detail::DecodeStructField<DecodableType, &DecodableType::field2> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -33065,7 +39457,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kField1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kField1))
         {
             err = DataModel::Decode(reader, field1);
         }
@@ -33091,6 +39487,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -33103,7 +39504,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -33136,6 +39541,26 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kNullableInt), &detail::DecodeStructField<DecodableType, &DecodableType::nullableInt> },
+        { to_underlying(Fields::kOptionalInt), &detail::DecodeStructField<DecodableType, &DecodableType::optionalInt> },
+        { to_underlying(Fields::kNullableOptionalInt),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableOptionalInt> },
+        { to_underlying(Fields::kNullableString), &detail::DecodeStructField<DecodableType, &DecodableType::nullableString> },
+        { to_underlying(Fields::kOptionalString), &detail::DecodeStructField<DecodableType, &DecodableType::optionalString> },
+        { to_underlying(Fields::kNullableOptionalString),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableOptionalString> },
+        { to_underlying(Fields::kNullableStruct), &detail::DecodeStructField<DecodableType, &DecodableType::nullableStruct> },
+        { to_underlying(Fields::kOptionalStruct), &detail::DecodeStructField<DecodableType, &DecodableType::optionalStruct> },
+        { to_underlying(Fields::kNullableOptionalStruct),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableOptionalStruct> },
+        { to_underlying(Fields::kNullableList), &detail::DecodeStructField<DecodableType, &DecodableType::nullableList> },
+        { to_underlying(Fields::kOptionalList), &detail::DecodeStructField<DecodableType, &DecodableType::optionalList> },
+        { to_underlying(Fields::kNullableOptionalList),
+          &detail::DecodeStructField<DecodableType, &DecodableType::nullableOptionalList> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -33148,7 +39573,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kNullableInt))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kNullableInt))
         {
             err = DataModel::Decode(reader, nullableInt);
         }
@@ -33214,6 +39643,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -33226,7 +39660,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -33268,6 +39706,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -33280,7 +39723,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -33304,6 +39751,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+        { to_underlying(Fields::kArg2), &detail::DecodeStructField<DecodableType, &DecodableType::arg2> },
+        { to_underlying(Fields::kArg3), &detail::DecodeStructField<DecodableType, &DecodableType::arg3> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -33316,7 +39770,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -33346,6 +39804,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -33358,7 +39821,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -33382,6 +39849,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSleepBeforeResponseTimeMs),
+          &detail::DecodeStructField<DecodableType, &DecodableType::sleepBeforeResponseTimeMs> },
+        { to_underlying(Fields::kSizeOfResponseBuffer),
+          &detail::DecodeStructField<DecodableType, &DecodableType::sizeOfResponseBuffer> },
+        { to_underlying(Fields::kFillCharacter), &detail::DecodeStructField<DecodableType, &DecodableType::fillCharacter> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -33394,7 +39870,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSleepBeforeResponseTimeMs))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSleepBeforeResponseTimeMs))
         {
             err = DataModel::Decode(reader, sleepBeforeResponseTimeMs);
         }
@@ -33426,6 +39906,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kSleepBeforeResponseTimeMs),
+          &detail::DecodeStructField<DecodableType, &DecodableType::sleepBeforeResponseTimeMs> },
+        { to_underlying(Fields::kSizeOfResponseBuffer),
+          &detail::DecodeStructField<DecodableType, &DecodableType::sizeOfResponseBuffer> },
+        { to_underlying(Fields::kFillCharacter), &detail::DecodeStructField<DecodableType, &DecodableType::fillCharacter> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -33438,7 +39927,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kSleepBeforeResponseTimeMs))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kSleepBeforeResponseTimeMs))
         {
             err = DataModel::Decode(reader, sleepBeforeResponseTimeMs);
         }
@@ -33468,6 +39961,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kPayload), &detail::DecodeStructField<DecodableType, &DecodableType::payload> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -33480,7 +39978,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kPayload))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kPayload))
         {
             err = DataModel::Decode(reader, payload);
         }
@@ -33503,6 +40005,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kField1), &detail::DecodeStructField<DecodableType, &DecodableType::field1> },
+        { to_underlying(Fields::kField2), &detail::DecodeStructField<DecodableType, &DecodableType::field2> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -33515,7 +40023,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kField1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kField1))
         {
             err = DataModel::Decode(reader, field1);
         }
@@ -33541,6 +40053,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -33553,7 +40070,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -33576,6 +40097,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+        { to_underlying(Fields::kEventNumber), &detail::DecodeStructField<DecodableType, &DecodableType::eventNumber> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -33588,7 +40115,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -33822,6 +40353,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+        { to_underlying(Fields::kArg2), &detail::DecodeStructField<DecodableType, &DecodableType::arg2> },
+        { to_underlying(Fields::kArg3), &detail::DecodeStructField<DecodableType, &DecodableType::arg3> },
+        { to_underlying(Fields::kArg4), &detail::DecodeStructField<DecodableType, &DecodableType::arg4> },
+        { to_underlying(Fields::kArg5), &detail::DecodeStructField<DecodableType, &DecodableType::arg5> },
+        { to_underlying(Fields::kArg6), &detail::DecodeStructField<DecodableType, &DecodableType::arg6> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -33834,7 +40375,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -33877,6 +40422,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -33889,7 +40439,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kFabricIndex))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kFabricIndex))
         {
             err = DataModel::Decode(reader, fabricIndex);
         }
@@ -33912,6 +40466,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -33924,7 +40483,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -33956,6 +40519,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kType), &detail::DecodeStructField<DecodableType, &DecodableType::type> },
+        { to_underlying(Fields::kId), &detail::DecodeStructField<DecodableType, &DecodableType::id> },
+        { to_underlying(Fields::kNumCallsToSkip), &detail::DecodeStructField<DecodableType, &DecodableType::numCallsToSkip> },
+        { to_underlying(Fields::kNumCallsToFail), &detail::DecodeStructField<DecodableType, &DecodableType::numCallsToFail> },
+        { to_underlying(Fields::kTakeMutex), &detail::DecodeStructField<DecodableType, &DecodableType::takeMutex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -33968,7 +40540,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kType))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kType))
         {
             err = DataModel::Decode(reader, type);
         }
@@ -34008,6 +40584,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kType), &detail::DecodeStructField<DecodableType, &DecodableType::type> },
+        { to_underlying(Fields::kId), &detail::DecodeStructField<DecodableType, &DecodableType::id> },
+        { to_underlying(Fields::kPercentage), &detail::DecodeStructField<DecodableType, &DecodableType::percentage> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -34020,7 +40603,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kType))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kType))
         {
             err = DataModel::Decode(reader, type);
         }
@@ -34099,6 +40686,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kReturnValue), &detail::DecodeStructField<DecodableType, &DecodableType::returnValue> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -34111,7 +40703,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kReturnValue))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kReturnValue))
         {
             err = DataModel::Decode(reader, returnValue);
         }
@@ -34134,6 +40730,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kArg1), &detail::DecodeStructField<DecodableType, &DecodableType::arg1> },
+        { to_underlying(Fields::kArg2), &detail::DecodeStructField<DecodableType, &DecodableType::arg2> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -34146,7 +40748,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kArg1))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kArg1))
         {
             err = DataModel::Decode(reader, arg1);
         }
@@ -34200,6 +40806,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
+    static constexpr detail::StructFieldDecoder __fields[] = {
+        { to_underlying(Fields::kCount), &detail::DecodeStructField<DecodableType, &DecodableType::count> },
+        { to_underlying(Fields::kFabricIndex), &detail::DecodeStructField<DecodableType, &DecodableType::fabricIndex> },
+    };
+    detail::InOrderFieldDecoder __inOrder(__fields);
+
     detail::StructDecodeIterator __iterator(reader);
     while (true)
     {
@@ -34212,7 +40824,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         CHIP_ERROR err              = CHIP_NO_ERROR;
         const uint8_t __context_tag = std::get<uint8_t>(__element);
 
-        if (__context_tag == to_underlying(Fields::kCount))
+        if (__inOrder.FindNext(__context_tag))
+        {
+            err = __inOrder.DecodeNext(reader, this);
+        }
+        else if (__context_tag == to_underlying(Fields::kCount))
         {
             err = DataModel::Decode(reader, count);
         }